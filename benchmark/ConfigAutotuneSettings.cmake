@@ -26,6 +26,10 @@ function(read_config_autotune_settings file list_across_names list_across output
     set(list_across "int int64_t uint8_t rocprim::half float double;\
 true false;true false;64 128;1 2 4 8 16" PARENT_SCOPE)
     set(output_pattern_suffix "@DataType@_@Left@_@InPlace@_@BlockSize@_@ItemsPerThread@" PARENT_SCOPE)
+  elseif(file STREQUAL "benchmark_device_histogram")
+    set(list_across_names "SampleType;Channels_ActiveChannels;BlockSize;ItemsPerThread;SharedImplHistograms" PARENT_SCOPE)
+    set(list_across "uint8_t int float;1,1 4,3;128 256;4 8 12 16;1 3" PARENT_SCOPE)
+    set(output_pattern_suffix "@SampleType@_@Channels_ActiveChannels@_@BlockSize@_@ItemsPerThread@_@SharedImplHistograms@" PARENT_SCOPE)
   elseif(file STREQUAL "benchmark_device_merge_sort")
     set(list_across_names "KeyType_ValueType;MergeBlockSizeExponent;SortBlockSizeExponent" PARENT_SCOPE)
     # first list is keys, second list is key,value pairs
@@ -61,10 +65,37 @@ int8_t,int8_t uint8_t,uint8_t rocprim::half,rocprim::half;\
     set(list_across_names "DataType;BlockSize;ItemsPerThread" PARENT_SCOPE)
     set(list_across "int float double int8_t int64_t rocprim::half;64 128 256;1 2 4 8 16" PARENT_SCOPE)
     set(output_pattern_suffix "@DataType@_@BlockSize@_@ItemsPerThread@" PARENT_SCOPE)
+  elseif(file STREQUAL "benchmark_device_reduce_by_key")
+    set(list_across_names "KeyType_ValueType;BlockSize;ItemsPerThread;TilesPerBlock" PARENT_SCOPE)
+    set(list_across "\
+int,int int,float int,double int64_t,int64_t int8_t,int8_t rocprim::half,rocprim::half;\
+64 128 256;5 9 11 15 20;1 2" PARENT_SCOPE)
+    set(output_pattern_suffix "@KeyType_ValueType@_@BlockSize@_@ItemsPerThread@_@TilesPerBlock@" PARENT_SCOPE)
   elseif(file STREQUAL "benchmark_device_scan")
+    # scan_by_key is tuned by benchmark_device_scan_by_key for all key types
     set(list_across_names "ByKey;Excl;DataType" PARENT_SCOPE)
-    set(list_across "true false;true false;\
+    set(list_across "false;true false;\
 int float double int64_t int8_t rocprim::half" PARENT_SCOPE)
     set(output_pattern_suffix "@ByKey@_@Excl@_@DataType@" PARENT_SCOPE)
+  elseif(file STREQUAL "benchmark_device_scan_by_key")
+    set(list_across_names "KeyType_ValueType;Excl" PARENT_SCOPE)
+    set(list_across "\
+int,int int,float int,double int,int64_t int,int8_t int,rocprim::half \
+int64_t,int float,int double,int;\
+true false" PARENT_SCOPE)
+    set(output_pattern_suffix "@KeyType_ValueType@_@Excl@" PARENT_SCOPE)
+  elseif(file STREQUAL "benchmark_device_segmented_radix_sort")
+    set(list_across_names "KeyType_ValueType;LongRadixBits_ShortRadixBits;ItemsPerThread" PARENT_SCOPE)
+    # first list is keys, second list is key,value pairs
+    set(list_across "\
+int int64_t uint8_t float rocprim::half \
+\
+int,float int64_t,double uint8_t,uint8_t;\
+4,3 6,5 7,6 8,7;4 7 10 13" PARENT_SCOPE)
+    set(output_pattern_suffix "@KeyType_ValueType@_@LongRadixBits_ShortRadixBits@_@ItemsPerThread@" PARENT_SCOPE)
+  elseif(file STREQUAL "benchmark_device_select")
+    set(list_across_names "DataType;BlockSize;ItemsPerThread" PARENT_SCOPE)
+    set(list_across "int int8_t int64_t float double rocprim::half;64 128 256;4 8 12 16" PARENT_SCOPE)
+    set(output_pattern_suffix "@DataType@_@BlockSize@_@ItemsPerThread@" PARENT_SCOPE)
   endif()
 endfunction()
\ No newline at end of file
@@ -60,6 +60,7 @@ void kernel(const T * d_input, const unsigned int * d_ranks, T * d_output)
     Runner::template run<T, BlockSize, ItemsPerThread, Trials>(d_input, d_ranks, d_output);
 }
 
+template<rp::block_exchange_policy Policy = rp::block_exchange_policy::padding>
 struct blocked_to_striped
 {
     template<
@@ -80,7 +81,7 @@ struct blocked_to_striped
         ROCPRIM_NO_UNROLL
         for(unsigned int trial = 0; trial < Trials; trial++)
         {
-            rp::block_exchange<T, BlockSize, ItemsPerThread> exchange;
+            rp::block_exchange<T, BlockSize, ItemsPerThread, 1, 1, Policy> exchange;
             exchange.blocked_to_striped(input, input);
             ::rocprim::syncthreads();
         }
@@ -89,6 +90,7 @@ struct blocked_to_striped
     }
 };
 
+template<rp::block_exchange_policy Policy = rp::block_exchange_policy::padding>
 struct striped_to_blocked
 {
     template<
@@ -109,7 +111,7 @@ struct striped_to_blocked
         ROCPRIM_NO_UNROLL
         for(unsigned int trial = 0; trial < Trials; trial++)
         {
-            rp::block_exchange<T, BlockSize, ItemsPerThread> exchange;
+            rp::block_exchange<T, BlockSize, ItemsPerThread, 1, 1, Policy> exchange;
             exchange.striped_to_blocked(input, input);
             ::rocprim::syncthreads();
         }
@@ -118,6 +120,7 @@ struct striped_to_blocked
     }
 };
 
+template<rp::block_exchange_policy Policy = rp::block_exchange_policy::padding>
 struct blocked_to_warp_striped
 {
     template<
@@ -138,7 +141,7 @@ struct blocked_to_warp_striped
         ROCPRIM_NO_UNROLL
         for(unsigned int trial = 0; trial < Trials; trial++)
         {
-            rp::block_exchange<T, BlockSize, ItemsPerThread> exchange;
+            rp::block_exchange<T, BlockSize, ItemsPerThread, 1, 1, Policy> exchange;
             exchange.blocked_to_warp_striped(input, input);
             ::rocprim::syncthreads();
         }
@@ -147,6 +150,7 @@ struct blocked_to_warp_striped
     }
 };
 
+template<rp::block_exchange_policy Policy = rp::block_exchange_policy::padding>
 struct warp_striped_to_blocked
 {
     template<
@@ -167,7 +171,7 @@ struct warp_striped_to_blocked
         ROCPRIM_NO_UNROLL
         for(unsigned int trial = 0; trial < Trials; trial++)
         {
-            rp::block_exchange<T, BlockSize, ItemsPerThread> exchange;
+            rp::block_exchange<T, BlockSize, ItemsPerThread, 1, 1, Policy> exchange;
             exchange.warp_striped_to_blocked(input, input);
             ::rocprim::syncthreads();
         }
@@ -352,6 +356,30 @@ void add_benchmarks(const std::string& name,
     benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
 }
 
+template<rp::block_exchange_policy Policy>
+void add_policy_benchmarks(const std::string& policy_name,
+                           std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                           hipStream_t stream,
+                           size_t size)
+{
+    add_benchmarks<blocked_to_striped<Policy>>("blocked_to_striped_" + policy_name,
+                                               benchmarks,
+                                               stream,
+                                               size);
+    add_benchmarks<striped_to_blocked<Policy>>("striped_to_blocked_" + policy_name,
+                                               benchmarks,
+                                               stream,
+                                               size);
+    add_benchmarks<blocked_to_warp_striped<Policy>>("blocked_to_warp_striped_" + policy_name,
+                                                    benchmarks,
+                                                    stream,
+                                                    size);
+    add_benchmarks<warp_striped_to_blocked<Policy>>("warp_striped_to_blocked_" + policy_name,
+                                                    benchmarks,
+                                                    stream,
+                                                    size);
+}
+
 int main(int argc, char *argv[])
 {
     cli::Parser parser(argc, argv);
@@ -373,13 +401,19 @@ int main(int argc, char *argv[])
 
     // Add benchmarks
     std::vector<benchmark::internal::Benchmark*> benchmarks;
-    add_benchmarks<blocked_to_striped>("blocked_to_striped", benchmarks, stream, size);
-    add_benchmarks<striped_to_blocked>("striped_to_blocked", benchmarks, stream, size);
-    add_benchmarks<blocked_to_warp_striped>("blocked_to_warp_striped", benchmarks, stream, size);
-    add_benchmarks<warp_striped_to_blocked>("warp_striped_to_blocked", benchmarks, stream, size);
+    add_benchmarks<blocked_to_striped<>>("blocked_to_striped", benchmarks, stream, size);
+    add_benchmarks<striped_to_blocked<>>("striped_to_blocked", benchmarks, stream, size);
+    add_benchmarks<blocked_to_warp_striped<>>("blocked_to_warp_striped", benchmarks, stream, size);
+    add_benchmarks<warp_striped_to_blocked<>>("warp_striped_to_blocked", benchmarks, stream, size);
     add_benchmarks<scatter_to_blocked>("scatter_to_blocked", benchmarks, stream, size);
     add_benchmarks<scatter_to_striped>("scatter_to_striped", benchmarks, stream, size);
 
+    // Other layouts of the shared memory and the in-register transposition within warps
+    using policy = rp::block_exchange_policy;
+    add_policy_benchmarks<policy::none>("none", benchmarks, stream, size);
+    add_policy_benchmarks<policy::swizzle>("swizzle", benchmarks, stream, size);
+    add_policy_benchmarks<policy::warp_shuffle>("warp_shuffle", benchmarks, stream, size);
+
     // Use manual timing
     for(auto& b : benchmarks)
     {
@@ -175,6 +175,14 @@ void run_benchmark(benchmark::State& state, hipStream_t stream, size_t N)
     CREATE_BENCHMARK(type, block, 8), \
     CREATE_BENCHMARK(type, block, 16)
 
+// BINS - number of bins, larger than the block
+#define CREATE_WIDE_BENCHMARK(T, BS, IPT, BINS) \
+    benchmark::RegisterBenchmark( \
+        (std::string("block_histogram<"#T", "#BS", "#IPT", "#BINS", " + algorithm_name + ">.") + method_name).c_str(), \
+        run_benchmark<Benchmark, T, BS, IPT, BINS>, \
+        stream, size \
+    )
+
 template<class Benchmark>
 void add_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
                     const std::string& method_name,
@@ -189,7 +197,12 @@ void add_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
         BENCHMARK_TYPE(int, 512),
 
         BENCHMARK_TYPE(unsigned long long, 256),
-        BENCHMARK_TYPE(unsigned long long, 320)
+        BENCHMARK_TYPE(unsigned long long, 320),
+
+        CREATE_WIDE_BENCHMARK(int, 256, 4, 1024),
+        CREATE_WIDE_BENCHMARK(int, 256, 8, 1024),
+        CREATE_WIDE_BENCHMARK(int, 256, 4, 2048),
+        CREATE_WIDE_BENCHMARK(int, 256, 8, 2048)
     };
     benchmarks.insert(benchmarks.end(), new_benchmarks.begin(), new_benchmarks.end());
 }
@@ -225,6 +238,11 @@ int main(int argc, char *argv[])
     add_benchmarks<histogram_s_t>(
         benchmarks, "histogram", "using_sort", stream, size
     );
+    // using_warp_privatized
+    using histogram_w_t = histogram<rocprim::block_histogram_algorithm::using_warp_privatized>;
+    add_benchmarks<histogram_w_t>(
+        benchmarks, "histogram", "using_warp_privatized", stream, size
+    );
 
     // Use manual timing
     for(auto& b : benchmarks)
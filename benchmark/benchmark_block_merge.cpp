@@ -0,0 +1,361 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Google Benchmark
+#include "benchmark/benchmark.h"
+// CmdParser
+#include "cmdparser.hpp"
+// HIP API
+#include <hip/hip_runtime.h>
+// rocPRIM
+#include <rocprim/rocprim.hpp>
+
+#include "benchmark_utils.hpp"
+
+#ifndef DEFAULT_N
+const size_t DEFAULT_N = 1024 * 1024 * 32;
+#endif
+
+// Every block merges the two sorted halves of its tile
+template<class K, class V, unsigned int BlockSize, unsigned int ItemsPerThread>
+__global__
+__launch_bounds__(BlockSize)
+void block_merge_kernel(const K* input_keys,
+                        const V* input_values,
+                        K*       output_keys,
+                        V*       output_values)
+{
+    using block_merge_type = rocprim::block_merge<K, BlockSize, ItemsPerThread, V>;
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int flat_tid     = threadIdx.x;
+    const unsigned int block_offset = blockIdx.x * items_per_block;
+
+    ROCPRIM_SHARED_MEMORY typename block_merge_type::storage_type storage;
+
+    K keys[ItemsPerThread];
+    V values[ItemsPerThread];
+    rocprim::block_load_direct_blocked(flat_tid, input_keys + block_offset, keys);
+    rocprim::block_load_direct_blocked(flat_tid, input_values + block_offset, values);
+
+    block_merge_type().merge(keys, values, items_per_block / 2, storage);
+
+    rocprim::block_store_direct_blocked(flat_tid, output_keys + block_offset, keys);
+    rocprim::block_store_direct_blocked(flat_tid, output_values + block_offset, values);
+}
+
+template<class K, unsigned int BlockSize, unsigned int ItemsPerThread>
+__global__
+__launch_bounds__(BlockSize)
+void block_merge_keys_kernel(const K* input_keys,
+                             const rocprim::empty_type*,
+                             K* output_keys,
+                             rocprim::empty_type*)
+{
+    using block_merge_type = rocprim::block_merge<K, BlockSize, ItemsPerThread>;
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int flat_tid     = threadIdx.x;
+    const unsigned int block_offset = blockIdx.x * items_per_block;
+
+    ROCPRIM_SHARED_MEMORY typename block_merge_type::storage_type storage;
+
+    K keys[ItemsPerThread];
+    rocprim::block_load_direct_blocked(flat_tid, input_keys + block_offset, keys);
+
+    block_merge_type().merge(keys, items_per_block / 2, storage);
+
+    rocprim::block_store_direct_blocked(flat_tid, output_keys + block_offset, keys);
+}
+
+// Every logical warp merges the two sorted halves of its items
+template<class K, unsigned int BlockSize, unsigned int WarpSize, unsigned int ItemsPerThread>
+__global__
+__launch_bounds__(BlockSize)
+void warp_merge_keys_kernel(const K* input_keys, K* output_keys)
+{
+    using warp_merge_type = rocprim::warp_merge<K, ItemsPerThread, WarpSize>;
+    constexpr unsigned int warps_per_block = BlockSize / WarpSize;
+    constexpr unsigned int items_per_warp  = WarpSize * ItemsPerThread;
+
+    const unsigned int warp_id = threadIdx.x / WarpSize;
+    const unsigned int lane    = threadIdx.x % WarpSize;
+    const unsigned int offset  = (blockIdx.x * warps_per_block + warp_id) * items_per_warp;
+
+    ROCPRIM_SHARED_MEMORY typename warp_merge_type::storage_type storage[warps_per_block];
+
+    K keys[ItemsPerThread];
+    rocprim::block_load_direct_blocked(lane, input_keys + offset, keys);
+
+    warp_merge_type().merge(keys, items_per_warp / 2, storage[warp_id]);
+
+    rocprim::block_store_direct_blocked(lane, output_keys + offset, keys);
+}
+
+// Generates keys with sorted halves of every group of merged items
+template<class K>
+std::vector<K> get_merge_input(const size_t size, const unsigned int items_per_group)
+{
+    std::vector<K> keys = get_random_data<K>(size, 0, 100);
+    for(size_t offset = 0; offset < size; offset += items_per_group / 2)
+    {
+        std::sort(keys.begin() + offset, keys.begin() + offset + items_per_group / 2);
+    }
+    return keys;
+}
+
+template<class K,
+         class V,
+         unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         unsigned int Trials = 100>
+void run_block_benchmark(benchmark::State& state, hipStream_t stream, size_t size)
+{
+    constexpr bool with_values     = !std::is_same<V, rocprim::empty_type>::value;
+    constexpr auto items_per_block = BlockSize * ItemsPerThread;
+    const auto     blocks          = (size + items_per_block - 1) / items_per_block;
+    size                           = blocks * items_per_block;
+
+    const std::vector<K> input_keys = get_merge_input<K>(size, items_per_block);
+    std::vector<V>       input_values(with_values ? size : 1);
+
+    K* d_input_keys;
+    K* d_output_keys;
+    V* d_input_values;
+    V* d_output_values;
+    HIP_CHECK(hipMalloc(&d_input_keys, size * sizeof(K)));
+    HIP_CHECK(hipMalloc(&d_output_keys, size * sizeof(K)));
+    HIP_CHECK(hipMalloc(&d_input_values, input_values.size() * sizeof(V)));
+    HIP_CHECK(hipMalloc(&d_output_values, input_values.size() * sizeof(V)));
+    HIP_CHECK(hipMemcpy(d_input_keys, input_keys.data(), size * sizeof(K), hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemcpy(d_input_values,
+                        input_values.data(),
+                        input_values.size() * sizeof(V),
+                        hipMemcpyHostToDevice));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(unsigned int trial = 0; trial < Trials; trial++)
+        {
+            if(with_values)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(block_merge_kernel<K, V, BlockSize, ItemsPerThread>),
+                    dim3(blocks),
+                    dim3(BlockSize),
+                    0,
+                    stream,
+                    d_input_keys,
+                    d_input_values,
+                    d_output_keys,
+                    d_output_values);
+            }
+            else
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(block_merge_keys_kernel<K, BlockSize, ItemsPerThread>),
+                    dim3(blocks),
+                    dim3(BlockSize),
+                    0,
+                    stream,
+                    d_input_keys,
+                    reinterpret_cast<rocprim::empty_type*>(d_input_values),
+                    d_output_keys,
+                    reinterpret_cast<rocprim::empty_type*>(d_output_values));
+            }
+        }
+        HIP_CHECK(hipGetLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds
+            = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    state.SetBytesProcessed(state.iterations() * Trials * size
+                            * (sizeof(K) + (with_values ? sizeof(V) : 0)));
+    state.SetItemsProcessed(state.iterations() * Trials * size);
+
+    HIP_CHECK(hipFree(d_input_keys));
+    HIP_CHECK(hipFree(d_output_keys));
+    HIP_CHECK(hipFree(d_input_values));
+    HIP_CHECK(hipFree(d_output_values));
+}
+
+template<class K,
+         unsigned int BlockSize,
+         unsigned int WarpSize,
+         unsigned int ItemsPerThread,
+         unsigned int Trials = 100>
+void run_warp_benchmark(benchmark::State& state, hipStream_t stream, size_t size)
+{
+    constexpr auto items_per_block = BlockSize * ItemsPerThread;
+    const auto     blocks          = (size + items_per_block - 1) / items_per_block;
+    size                           = blocks * items_per_block;
+
+    const std::vector<K> input_keys = get_merge_input<K>(size, WarpSize * ItemsPerThread);
+
+    K* d_input_keys;
+    K* d_output_keys;
+    HIP_CHECK(hipMalloc(&d_input_keys, size * sizeof(K)));
+    HIP_CHECK(hipMalloc(&d_output_keys, size * sizeof(K)));
+    HIP_CHECK(hipMemcpy(d_input_keys, input_keys.data(), size * sizeof(K), hipMemcpyHostToDevice));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(unsigned int trial = 0; trial < Trials; trial++)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(warp_merge_keys_kernel<K, BlockSize, WarpSize, ItemsPerThread>),
+                dim3(blocks),
+                dim3(BlockSize),
+                0,
+                stream,
+                d_input_keys,
+                d_output_keys);
+        }
+        HIP_CHECK(hipGetLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds
+            = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    state.SetBytesProcessed(state.iterations() * Trials * size * sizeof(K));
+    state.SetItemsProcessed(state.iterations() * Trials * size);
+
+    HIP_CHECK(hipFree(d_input_keys));
+    HIP_CHECK(hipFree(d_output_keys));
+}
+
+#define CREATE_BLOCK_BENCHMARK(K, V, BS, IPT)                       \
+    benchmark::RegisterBenchmark(                                   \
+        "block_merge<" #K ", " #BS ", " #IPT ", " #V ">.merge",     \
+        run_block_benchmark<K, V, BS, IPT>,                         \
+        stream,                                                     \
+        size)
+
+#define CREATE_WARP_BENCHMARK(K, BS, WS, IPT)                       \
+    benchmark::RegisterBenchmark(                                   \
+        "warp_merge<" #K ", " #IPT ", " #WS ">.merge(" #BS ")",     \
+        run_warp_benchmark<K, BS, WS, IPT>,                         \
+        stream,                                                     \
+        size)
+
+// The items per thread candidates of the merge steps of block_sort_merge and device merges
+#define BENCHMARK_BLOCK_TYPE(K, V)            \
+    CREATE_BLOCK_BENCHMARK(K, V, 128, 4),     \
+    CREATE_BLOCK_BENCHMARK(K, V, 128, 8),     \
+    CREATE_BLOCK_BENCHMARK(K, V, 128, 16),    \
+    CREATE_BLOCK_BENCHMARK(K, V, 256, 1),     \
+    CREATE_BLOCK_BENCHMARK(K, V, 256, 4),     \
+    CREATE_BLOCK_BENCHMARK(K, V, 256, 7),     \
+    CREATE_BLOCK_BENCHMARK(K, V, 256, 8),     \
+    CREATE_BLOCK_BENCHMARK(K, V, 256, 16),    \
+    CREATE_BLOCK_BENCHMARK(K, V, 512, 4),     \
+    CREATE_BLOCK_BENCHMARK(K, V, 512, 8),     \
+    CREATE_BLOCK_BENCHMARK(K, V, 1024, 4)
+
+// Large values with fewer items per block, so that the storage fits in shared memory
+#define BENCHMARK_BLOCK_LARGE_TYPE(K, V)      \
+    CREATE_BLOCK_BENCHMARK(K, V, 128, 4),     \
+    CREATE_BLOCK_BENCHMARK(K, V, 128, 8),     \
+    CREATE_BLOCK_BENCHMARK(K, V, 256, 4),     \
+    CREATE_BLOCK_BENCHMARK(K, V, 256, 7),     \
+    CREATE_BLOCK_BENCHMARK(K, V, 256, 8)
+
+#define BENCHMARK_WARP_TYPE(K)                \
+    CREATE_WARP_BENCHMARK(K, 256, 16, 4),     \
+    CREATE_WARP_BENCHMARK(K, 256, 32, 4),     \
+    CREATE_WARP_BENCHMARK(K, 256, 32, 8),     \
+    CREATE_WARP_BENCHMARK(K, 256, 64, 2),     \
+    CREATE_WARP_BENCHMARK(K, 256, 64, 4),     \
+    CREATE_WARP_BENCHMARK(K, 256, 64, 8)
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of values");
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const size_t size   = parser.get<size_t>("size");
+    const int    trials = parser.get<int>("trials");
+
+    // HIP
+    hipStream_t stream = 0; // default
+
+    // Benchmark info
+    add_common_benchmark_info();
+    benchmark::AddCustomContext("size", std::to_string(size));
+
+    using custom_int_double = custom_type<int, double>;
+
+    std::vector<benchmark::internal::Benchmark*> benchmarks = {
+        BENCHMARK_BLOCK_TYPE(int, rocprim::empty_type),
+        BENCHMARK_BLOCK_TYPE(float, rocprim::empty_type),
+        BENCHMARK_BLOCK_TYPE(double, rocprim::empty_type),
+        BENCHMARK_BLOCK_TYPE(uint8_t, rocprim::empty_type),
+        BENCHMARK_BLOCK_TYPE(int, int),
+        BENCHMARK_BLOCK_TYPE(float, unsigned int),
+        BENCHMARK_BLOCK_LARGE_TYPE(int64_t, custom_int_double),
+
+        BENCHMARK_WARP_TYPE(int),
+        BENCHMARK_WARP_TYPE(double),
+    };
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
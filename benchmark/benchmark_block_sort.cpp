@@ -59,6 +59,20 @@ const size_t DEFAULT_N = 1024 * 1024 * 128;
     CREATE_BENCHMARK_IPT(K, V, BS, 1) \
     CREATE_BENCHMARK_IPT(K, V, BS, 4)
 
+// Large and non-power-of-two items per thread are only efficient with the merge sort,
+// these are the candidates for the block-sort step of device_merge_sort
+#define CREATE_MERGE_BENCHMARK_IPT(K, V, BS, IPT)                                                 \
+    config_autotune_register::create<                                                             \
+        block_sort_benchmark<K, V, BS, IPT, rocprim::block_sort_algorithm::merge_sort, true>>();  \
+    config_autotune_register::create<                                                             \
+        block_sort_benchmark<K, V, BS, IPT, rocprim::block_sort_algorithm::merge_sort, false>>();
+
+#define CREATE_MERGE_BENCHMARK(K, V, BS)     \
+    CREATE_MERGE_BENCHMARK_IPT(K, V, BS, 7)  \
+    CREATE_MERGE_BENCHMARK_IPT(K, V, BS, 8)  \
+    CREATE_MERGE_BENCHMARK_IPT(K, V, BS, 16) \
+    CREATE_MERGE_BENCHMARK_IPT(K, V, BS, 32)
+
 int main(int argc, char* argv[])
 {
     cli::Parser parser(argc, argv);
@@ -93,6 +107,12 @@ int main(int argc, char* argv[])
     CREATE_BENCHMARK(double, int64_t, 512)
     CREATE_BENCHMARK(rocprim::half, int16_t, 512)
     CREATE_BENCHMARK(uint8_t, uint32_t, 512)
+
+    CREATE_MERGE_BENCHMARK(int, rocprim::empty_type, 256)
+    CREATE_MERGE_BENCHMARK(uint8_t, rocprim::empty_type, 256)
+    CREATE_MERGE_BENCHMARK(double, rocprim::empty_type, 128)
+    CREATE_MERGE_BENCHMARK(int, int, 128)
+    CREATE_MERGE_BENCHMARK(float, double, 128)
 #endif
 
     std::vector<benchmark::internal::Benchmark*> benchmarks = {};
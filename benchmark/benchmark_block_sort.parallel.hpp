@@ -95,7 +95,9 @@ template<class KeyType,
          class ValueType,
          unsigned int                  BlockSize,
          unsigned int                  ItemsPerThread,
-         rocprim::block_sort_algorithm block_sort_algorithm>
+         rocprim::block_sort_algorithm block_sort_algorithm,
+         std::enable_if_t<block_sort_algorithm != rocprim::block_sort_algorithm::merge_sort, bool>
+         = true>
 __global__ __launch_bounds__(BlockSize) void stable_sort_kernel(const KeyType* input,
                                                                 KeyType*       output)
 {
@@ -141,6 +143,44 @@ __global__ __launch_bounds__(BlockSize) void stable_sort_kernel(const KeyType* i
     rocprim::block_store_direct_blocked(lid, output + block_offset, keys);
 }
 
+// The merge sort is stable, so the keys are sorted with their positions as values like in the
+// block-sort step of device_merge_sort
+template<class KeyType,
+         class ValueType,
+         unsigned int                  BlockSize,
+         unsigned int                  ItemsPerThread,
+         rocprim::block_sort_algorithm block_sort_algorithm,
+         std::enable_if_t<block_sort_algorithm == rocprim::block_sort_algorithm::merge_sort, bool>
+         = true>
+__global__ __launch_bounds__(BlockSize) void stable_sort_kernel(const KeyType* input,
+                                                                KeyType*       output)
+{
+    const unsigned int lid          = threadIdx.x;
+    const unsigned int block_offset = blockIdx.x * ItemsPerThread * BlockSize;
+
+    KeyType keys[ItemsPerThread];
+    rocprim::block_load_direct_striped<BlockSize>(lid, input + block_offset, keys);
+
+    unsigned int ranks[ItemsPerThread];
+    ROCPRIM_UNROLL
+    for(unsigned int item = 0; item < ItemsPerThread; ++item)
+    {
+        ranks[item] = ItemsPerThread * lid + item;
+    }
+
+    rocprim::block_sort<KeyType, BlockSize, ItemsPerThread, unsigned int, block_sort_algorithm>
+        bsort;
+    bsort.sort(keys, ranks);
+
+    ROCPRIM_UNROLL
+    for(unsigned int item = 0; item < ItemsPerThread; ++item)
+    {
+        keys[item] = keys[item] + static_cast<KeyType>(ranks[item]);
+    }
+
+    rocprim::block_store_direct_blocked(lid, output + block_offset, keys);
+}
+
 template<class KeyType,
          class ValueType,
          unsigned int                  BlockSize,
@@ -183,6 +183,7 @@ struct device_adjacent_difference_benchmark : public config_autotune_interface
         HIP_CHECK(hipDeviceSynchronize());
 
         // Run
+        device_energy_meter energy_meter;
         for(auto _ : state)
         {
             auto start = std::chrono::high_resolution_clock::now();
@@ -200,6 +201,8 @@ struct device_adjacent_difference_benchmark : public config_autotune_interface
         }
         state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
         state.SetItemsProcessed(state.iterations() * batch_size * size);
+        add_bandwidth_counters(state, batch_size * size, 2 * sizeof(T));
+        energy_meter.add_counters(state, batch_size * size);
 
         hipFree(d_input);
         if(!in_place)
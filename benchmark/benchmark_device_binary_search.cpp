@@ -50,7 +50,7 @@ const unsigned int warmup_size = 5;
 template<class T>
 void run_lower_bound_benchmark(benchmark::State& state, hipStream_t stream,
                                size_t haystack_size, size_t needles_size,
-                               bool sorted_needles)
+                               bool sorted_needles, bool merge_search)
 {
     using haystack_type = T;
     using needle_type = T;
@@ -91,50 +91,47 @@ void run_lower_bound_benchmark(benchmark::State& state, hipStream_t stream,
         )
     );
 
+    // Sorted needles can be merged with the haystack instead of searched independently
+    const auto lower_bound = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+    {
+        return merge_search
+            ? rocprim::sorted_lower_bound(
+                d_temporary_storage, temporary_storage_bytes,
+                d_haystack, d_needles, d_output,
+                haystack_size, needles_size,
+                compare_op,
+                stream
+            )
+            : rocprim::lower_bound(
+                d_temporary_storage, temporary_storage_bytes,
+                d_haystack, d_needles, d_output,
+                haystack_size, needles_size,
+                compare_op,
+                stream
+            );
+    };
+
     void * d_temporary_storage = nullptr;
     size_t temporary_storage_bytes;
-    HIP_CHECK(
-        rocprim::lower_bound(
-            d_temporary_storage, temporary_storage_bytes,
-            d_haystack, d_needles, d_output,
-            haystack_size, needles_size,
-            compare_op,
-            stream
-        )
-    );
+    HIP_CHECK(lower_bound(d_temporary_storage, temporary_storage_bytes));
 
     HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
 
     // Warm-up
     for(size_t i = 0; i < warmup_size; i++)
     {
-        HIP_CHECK(
-            rocprim::lower_bound(
-                d_temporary_storage, temporary_storage_bytes,
-                d_haystack, d_needles, d_output,
-                haystack_size, needles_size,
-                compare_op,
-                stream
-            )
-        );
+        HIP_CHECK(lower_bound(d_temporary_storage, temporary_storage_bytes));
     }
     HIP_CHECK(hipDeviceSynchronize());
 
+    device_energy_meter energy_meter;
     for(auto _ : state)
     {
         auto start = std::chrono::high_resolution_clock::now();
 
         for(size_t i = 0; i < batch_size; i++)
         {
-            HIP_CHECK(
-                rocprim::lower_bound(
-                    d_temporary_storage, temporary_storage_bytes,
-                    d_haystack, d_needles, d_output,
-                    haystack_size, needles_size,
-                    compare_op,
-                    stream
-                )
-            );
+            HIP_CHECK(lower_bound(d_temporary_storage, temporary_storage_bytes));
         }
         HIP_CHECK(hipDeviceSynchronize());
 
@@ -145,6 +142,10 @@ void run_lower_bound_benchmark(benchmark::State& state, hipStream_t stream,
     }
     state.SetBytesProcessed(state.iterations() * batch_size * needles_size * sizeof(needle_type));
     state.SetItemsProcessed(state.iterations() * batch_size * needles_size);
+    add_bandwidth_counters(state,
+                           batch_size * needles_size,
+                           sizeof(needle_type) + sizeof(output_type));
+    energy_meter.add_counters(state, batch_size * needles_size);
 
     HIP_CHECK(hipFree(d_temporary_storage));
     HIP_CHECK(hipFree(d_haystack));
@@ -152,18 +153,21 @@ void run_lower_bound_benchmark(benchmark::State& state, hipStream_t stream,
     HIP_CHECK(hipFree(d_output));
 }
 
-#define CREATE_LOWER_BOUND_BENCHMARK(T, K, SORTED) \
+#define CREATE_LOWER_BOUND_BENCHMARK(T, K, SORTED, MERGE) \
 benchmark::RegisterBenchmark( \
     ( \
-        std::string("lower_bound") + "<" #T ">(" #K "\% " + \
+        std::string(MERGE ? "sorted_lower_bound" : "lower_bound") + "<" #T ">(" #K "\% " + \
         (SORTED ? "sorted" : "random") + " needles)" \
     ).c_str(), \
-    [=](benchmark::State& state) { run_lower_bound_benchmark<T>(state, stream, size, size * K / 100, SORTED); } \
+    [=](benchmark::State& state) { run_lower_bound_benchmark<T>(state, stream, size, size * K / 100, SORTED, MERGE); } \
 )
 
 #define BENCHMARK_TYPE(type) \
-    CREATE_LOWER_BOUND_BENCHMARK(type, 10, false), \
-    CREATE_LOWER_BOUND_BENCHMARK(type, 10, true)
+    CREATE_LOWER_BOUND_BENCHMARK(type, 10, false, false), \
+    CREATE_LOWER_BOUND_BENCHMARK(type, 10, true, false), \
+    CREATE_LOWER_BOUND_BENCHMARK(type, 10, true, true), \
+    CREATE_LOWER_BOUND_BENCHMARK(type, 100, true, false), \
+    CREATE_LOWER_BOUND_BENCHMARK(type, 100, true, true)
 
 int main(int argc, char *argv[])
 {
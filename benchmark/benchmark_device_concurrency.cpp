@@ -0,0 +1,430 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Throughput of device-level algorithms running concurrently on several streams, like
+// independent pipelines sharing one device.
+//
+// Every benchmark runs one instance of an algorithm with its own buffers and temporary storage
+// on each of N streams. An iteration enqueues all instances and waits for all streams, the
+// iteration time is the wall time of all instances. Counters:
+// * bytes_per_second, items_per_second, bandwidth_pct - the aggregate throughput of all
+//   instances,
+// * solo_us - the time of one instance running alone on the device,
+// * stream_us - the mean time between events recorded on every stream before and after its
+//   instance,
+// * slowdown, max_slowdown - the mean and the largest time of an instance relative to solo_us.
+// Look-back algorithms are sensitive to concurrent instances, because their blocks wait for
+// blocks of lower tiles which may not be scheduled yet.
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Google Benchmark
+#include "benchmark/benchmark.h"
+// CmdParser
+#include "cmdparser.hpp"
+#include "benchmark_utils.hpp"
+
+// HIP API
+#include <hip/hip_runtime.h>
+
+// rocPRIM
+#include <rocprim/rocprim.hpp>
+
+#ifndef DEFAULT_N
+const size_t DEFAULT_N = 1024 * 1024 * 8;
+#endif
+
+namespace
+{
+
+constexpr unsigned int warmup_size = 5;
+
+const std::vector<unsigned int> stream_counts{1, 2, 4, 8};
+
+struct is_even
+{
+    ROCPRIM_HOST_DEVICE
+    bool operator()(const int value) const
+    {
+        return value % 2 == 0;
+    }
+};
+
+// One instance of an algorithm with its own buffers
+class instance
+{
+public:
+    virtual ~instance() = default;
+    virtual void run(hipStream_t stream) = 0;
+};
+
+template<class T>
+class scan_instance : public instance
+{
+public:
+    explicit scan_instance(const std::vector<T>& input) : size_(input.size())
+    {
+        HIP_CHECK(hipMalloc(&d_input_, size_ * sizeof(T)));
+        HIP_CHECK(hipMalloc(&d_output_, size_ * sizeof(T)));
+        HIP_CHECK(hipMemcpy(d_input_, input.data(), size_ * sizeof(T), hipMemcpyHostToDevice));
+        HIP_CHECK(rocprim::inclusive_scan(nullptr,
+                                          storage_size_,
+                                          d_input_,
+                                          d_output_,
+                                          size_,
+                                          rocprim::plus<T>()));
+        HIP_CHECK(hipMalloc(&d_temporary_storage_, storage_size_));
+    }
+
+    ~scan_instance() override
+    {
+        HIP_CHECK(hipFree(d_input_));
+        HIP_CHECK(hipFree(d_output_));
+        HIP_CHECK(hipFree(d_temporary_storage_));
+    }
+
+    void run(const hipStream_t stream) override
+    {
+        HIP_CHECK(rocprim::inclusive_scan(d_temporary_storage_,
+                                          storage_size_,
+                                          d_input_,
+                                          d_output_,
+                                          size_,
+                                          rocprim::plus<T>(),
+                                          stream));
+    }
+
+    static constexpr size_t bytes_per_element = 2 * sizeof(T);
+
+private:
+    size_t size_;
+    T*     d_input_;
+    T*     d_output_;
+    void*  d_temporary_storage_;
+    size_t storage_size_;
+};
+
+template<class T>
+class select_instance : public instance
+{
+public:
+    explicit select_instance(const std::vector<T>& input) : size_(input.size())
+    {
+        HIP_CHECK(hipMalloc(&d_input_, size_ * sizeof(T)));
+        HIP_CHECK(hipMalloc(&d_output_, size_ * sizeof(T)));
+        HIP_CHECK(hipMalloc(&d_selected_count_output_, sizeof(unsigned int)));
+        HIP_CHECK(hipMemcpy(d_input_, input.data(), size_ * sizeof(T), hipMemcpyHostToDevice));
+        HIP_CHECK(rocprim::select(nullptr,
+                                  storage_size_,
+                                  d_input_,
+                                  d_output_,
+                                  d_selected_count_output_,
+                                  size_,
+                                  is_even()));
+        HIP_CHECK(hipMalloc(&d_temporary_storage_, storage_size_));
+    }
+
+    ~select_instance() override
+    {
+        HIP_CHECK(hipFree(d_input_));
+        HIP_CHECK(hipFree(d_output_));
+        HIP_CHECK(hipFree(d_selected_count_output_));
+        HIP_CHECK(hipFree(d_temporary_storage_));
+    }
+
+    void run(const hipStream_t stream) override
+    {
+        HIP_CHECK(rocprim::select(d_temporary_storage_,
+                                  storage_size_,
+                                  d_input_,
+                                  d_output_,
+                                  d_selected_count_output_,
+                                  size_,
+                                  is_even(),
+                                  stream));
+    }
+
+    // The input is read, about a half of it is selected
+    static constexpr size_t bytes_per_element = sizeof(T) + sizeof(T) / 2;
+
+private:
+    size_t        size_;
+    T*            d_input_;
+    T*            d_output_;
+    unsigned int* d_selected_count_output_;
+    void*         d_temporary_storage_;
+    size_t        storage_size_;
+};
+
+template<class T>
+class reduce_instance : public instance
+{
+public:
+    explicit reduce_instance(const std::vector<T>& input) : size_(input.size())
+    {
+        HIP_CHECK(hipMalloc(&d_input_, size_ * sizeof(T)));
+        HIP_CHECK(hipMalloc(&d_output_, sizeof(T)));
+        HIP_CHECK(hipMemcpy(d_input_, input.data(), size_ * sizeof(T), hipMemcpyHostToDevice));
+        HIP_CHECK(rocprim::reduce(nullptr,
+                                  storage_size_,
+                                  d_input_,
+                                  d_output_,
+                                  size_,
+                                  rocprim::plus<T>()));
+        HIP_CHECK(hipMalloc(&d_temporary_storage_, storage_size_));
+    }
+
+    ~reduce_instance() override
+    {
+        HIP_CHECK(hipFree(d_input_));
+        HIP_CHECK(hipFree(d_output_));
+        HIP_CHECK(hipFree(d_temporary_storage_));
+    }
+
+    void run(const hipStream_t stream) override
+    {
+        HIP_CHECK(rocprim::reduce(d_temporary_storage_,
+                                  storage_size_,
+                                  d_input_,
+                                  d_output_,
+                                  size_,
+                                  rocprim::plus<T>(),
+                                  stream));
+    }
+
+    static constexpr size_t bytes_per_element = sizeof(T);
+
+private:
+    size_t size_;
+    T*     d_input_;
+    T*     d_output_;
+    void*  d_temporary_storage_;
+    size_t storage_size_;
+};
+
+template<class T>
+class radix_sort_instance : public instance
+{
+public:
+    explicit radix_sort_instance(const std::vector<T>& input) : size_(input.size())
+    {
+        HIP_CHECK(hipMalloc(&d_input_, size_ * sizeof(T)));
+        HIP_CHECK(hipMalloc(&d_output_, size_ * sizeof(T)));
+        HIP_CHECK(hipMemcpy(d_input_, input.data(), size_ * sizeof(T), hipMemcpyHostToDevice));
+        HIP_CHECK(
+            rocprim::radix_sort_keys(nullptr, storage_size_, d_input_, d_output_, size_));
+        HIP_CHECK(hipMalloc(&d_temporary_storage_, storage_size_));
+    }
+
+    ~radix_sort_instance() override
+    {
+        HIP_CHECK(hipFree(d_input_));
+        HIP_CHECK(hipFree(d_output_));
+        HIP_CHECK(hipFree(d_temporary_storage_));
+    }
+
+    void run(const hipStream_t stream) override
+    {
+        HIP_CHECK(rocprim::radix_sort_keys(d_temporary_storage_,
+                                           storage_size_,
+                                           d_input_,
+                                           d_output_,
+                                           size_,
+                                           0,
+                                           sizeof(T) * 8,
+                                           stream));
+    }
+
+    static constexpr size_t bytes_per_element = 2 * sizeof(T);
+
+private:
+    size_t size_;
+    T*     d_input_;
+    T*     d_output_;
+    void*  d_temporary_storage_;
+    size_t storage_size_;
+};
+
+// The time of every instance (between events on its stream) and the wall time of all of them
+float run_instances(const std::vector<std::unique_ptr<instance>>& instances,
+                    const std::vector<hipStream_t>&               streams,
+                    const std::vector<hipEvent_t>&                start_events,
+                    const std::vector<hipEvent_t>&                stop_events,
+                    std::vector<float>&                           stream_milliseconds)
+{
+    const auto start = std::chrono::high_resolution_clock::now();
+    for(size_t i = 0; i < instances.size(); i++)
+    {
+        HIP_CHECK(hipEventRecord(start_events[i], streams[i]));
+        instances[i]->run(streams[i]);
+        HIP_CHECK(hipEventRecord(stop_events[i], streams[i]));
+    }
+    for(size_t i = 0; i < instances.size(); i++)
+    {
+        HIP_CHECK(hipStreamSynchronize(streams[i]));
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+
+    for(size_t i = 0; i < instances.size(); i++)
+    {
+        HIP_CHECK(hipEventElapsedTime(&stream_milliseconds[i], start_events[i], stop_events[i]));
+    }
+    return std::chrono::duration<float, std::milli>(end - start).count();
+}
+
+template<class Instance>
+void run_concurrency_benchmark(benchmark::State&  state,
+                               const size_t       size,
+                               const unsigned int stream_count)
+{
+    using T = int;
+    const std::vector<T> input
+        = get_random_data<T>(size, std::numeric_limits<T>::min(), std::numeric_limits<T>::max());
+
+    std::vector<std::unique_ptr<instance>> instances;
+    std::vector<hipStream_t>               streams(stream_count);
+    std::vector<hipEvent_t>                start_events(stream_count);
+    std::vector<hipEvent_t>                stop_events(stream_count);
+    for(unsigned int i = 0; i < stream_count; i++)
+    {
+        instances.emplace_back(new Instance(input));
+        HIP_CHECK(hipStreamCreateWithFlags(&streams[i], hipStreamNonBlocking));
+        HIP_CHECK(hipEventCreate(&start_events[i]));
+        HIP_CHECK(hipEventCreate(&stop_events[i]));
+    }
+    std::vector<float> stream_milliseconds(stream_count);
+
+    // Warm-up
+    for(size_t i = 0; i < warmup_size; i++)
+    {
+        run_instances(instances, streams, start_events, stop_events, stream_milliseconds);
+    }
+
+    // The time of one instance running alone
+    std::vector<float> solo_milliseconds;
+    for(size_t i = 0; i < warmup_size; i++)
+    {
+        HIP_CHECK(hipEventRecord(start_events[0], streams[0]));
+        instances[0]->run(streams[0]);
+        HIP_CHECK(hipEventRecord(stop_events[0], streams[0]));
+        HIP_CHECK(hipEventSynchronize(stop_events[0]));
+        float milliseconds;
+        HIP_CHECK(hipEventElapsedTime(&milliseconds, start_events[0], stop_events[0]));
+        solo_milliseconds.push_back(milliseconds);
+    }
+    std::sort(solo_milliseconds.begin(), solo_milliseconds.end());
+    const double solo = solo_milliseconds[solo_milliseconds.size() / 2];
+
+    double stream_sum   = 0;
+    double max_slowdown = 0;
+    for(auto _ : state)
+    {
+        const float milliseconds
+            = run_instances(instances, streams, start_events, stop_events, stream_milliseconds);
+        for(const float stream_time : stream_milliseconds)
+        {
+            stream_sum += stream_time;
+            max_slowdown = std::max(max_slowdown, stream_time / solo);
+        }
+        state.SetIterationTime(milliseconds / 1000);
+    }
+
+    const size_t items = size * stream_count;
+    state.SetBytesProcessed(state.iterations() * items * sizeof(T));
+    state.SetItemsProcessed(state.iterations() * items);
+    add_bandwidth_counters(state, items, Instance::bytes_per_element);
+    const double stream_mean = stream_sum / (state.iterations() * stream_count);
+    state.counters["solo_us"]      = solo * 1000;
+    state.counters["stream_us"]    = stream_mean * 1000;
+    state.counters["slowdown"]     = stream_mean / solo;
+    state.counters["max_slowdown"] = max_slowdown;
+
+    instances.clear();
+    for(unsigned int i = 0; i < stream_count; i++)
+    {
+        HIP_CHECK(hipStreamDestroy(streams[i]));
+        HIP_CHECK(hipEventDestroy(start_events[i]));
+        HIP_CHECK(hipEventDestroy(stop_events[i]));
+    }
+}
+
+} // namespace
+
+#define CREATE_BENCHMARK(ALGORITHM, INSTANCE)                                          \
+    for(const unsigned int stream_count : stream_counts)                               \
+    {                                                                                  \
+        benchmarks.push_back(benchmark::RegisterBenchmark(                             \
+            (std::string("concurrent<" ALGORITHM "<int>,streams:")                     \
+             + std::to_string(stream_count) + ">(" + std::to_string(size) + ")")       \
+                .c_str(),                                                              \
+            [=](benchmark::State& state)                                               \
+            { run_concurrency_benchmark<INSTANCE>(state, size, stream_count); }));     \
+    }
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of values per stream");
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const size_t size   = parser.get<size_t>("size");
+    const int    trials = parser.get<int>("trials");
+
+    // Benchmark info
+    add_common_benchmark_info();
+    benchmark::AddCustomContext("size", std::to_string(size));
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks;
+    CREATE_BENCHMARK("inclusive_scan", scan_instance<int>)
+    CREATE_BENCHMARK("select", select_instance<int>)
+    CREATE_BENCHMARK("reduce", reduce_instance<int>)
+    CREATE_BENCHMARK("radix_sort_keys", radix_sort_instance<int>)
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
@@ -31,6 +31,7 @@
 #include "benchmark/benchmark.h"
 // CmdParser
 #include "benchmark_utils.hpp"
+#include "benchmark_device_histogram.parallel.hpp"
 #include "cmdparser.hpp"
 
 // HIP API
@@ -151,6 +152,7 @@ void run_even_benchmark(benchmark::State& state,
     }
     HIP_CHECK(hipDeviceSynchronize());
 
+    device_energy_meter energy_meter;
     for(auto _ : state)
     {
         auto start = std::chrono::high_resolution_clock::now();
@@ -177,6 +179,118 @@ void run_even_benchmark(benchmark::State& state,
     }
     state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
     state.SetItemsProcessed(state.iterations() * batch_size * size);
+    add_bandwidth_counters(state, batch_size * size, sizeof(T));
+    energy_meter.add_counters(state, batch_size * size);
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_histogram));
+}
+
+// A part of samples (skew_percents %) is in the middle bin, the other samples are uniform
+template<class T>
+std::vector<T> generate_skewed(size_t size, int skew_percents, int lower_level, int upper_level)
+{
+    std::random_device                 rd;
+    std::default_random_engine         gen(rd());
+    std::uniform_int_distribution<int> percent_distribution(0, 99);
+    std::uniform_int_distribution<int> level_distribution(lower_level, upper_level - 1);
+    std::vector<T>                     data(size);
+    std::generate(data.begin(),
+                  data.end(),
+                  [&]()
+                  {
+                      return percent_distribution(gen) < skew_percents
+                                 ? T((lower_level + upper_level) / 2)
+                                 : T(level_distribution(gen));
+                  });
+    return data;
+}
+
+template<class T, bool WarpAggregation>
+void run_skewed_even_benchmark(benchmark::State& state,
+                               size_t            bins,
+                               int               skew_percents,
+                               hipStream_t       stream,
+                               size_t            size)
+{
+    using counter_type = unsigned int;
+    using config
+        = rp::histogram_config<rp::kernel_config<256, 8>, 1024, 2048, 3, WarpAggregation>;
+
+    const T lower_level = 0;
+    const T upper_level = bins;
+
+    // Generate data
+    std::vector<T> input = generate_skewed<T>(size, skew_percents, lower_level, upper_level);
+
+    T*            d_input;
+    counter_type* d_histogram;
+    HIP_CHECK(hipMalloc(&d_input, size * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_histogram, bins * sizeof(counter_type)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+    void*  d_temporary_storage     = nullptr;
+    size_t temporary_storage_bytes = 0;
+    HIP_CHECK(rp::histogram_even<config>(d_temporary_storage,
+                                         temporary_storage_bytes,
+                                         d_input,
+                                         size,
+                                         d_histogram,
+                                         bins + 1,
+                                         lower_level,
+                                         upper_level,
+                                         stream,
+                                         false));
+
+    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Warm-up
+    for(size_t i = 0; i < warmup_size; i++)
+    {
+        HIP_CHECK(rp::histogram_even<config>(d_temporary_storage,
+                                             temporary_storage_bytes,
+                                             d_input,
+                                             size,
+                                             d_histogram,
+                                             bins + 1,
+                                             lower_level,
+                                             upper_level,
+                                             stream,
+                                             false));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    device_energy_meter energy_meter;
+    for(auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(size_t i = 0; i < batch_size; i++)
+        {
+            HIP_CHECK(rp::histogram_even<config>(d_temporary_storage,
+                                                 temporary_storage_bytes,
+                                                 d_input,
+                                                 size,
+                                                 d_histogram,
+                                                 bins + 1,
+                                                 lower_level,
+                                                 upper_level,
+                                                 stream,
+                                                 false));
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds
+            = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
+    state.SetItemsProcessed(state.iterations() * batch_size * size);
+    add_bandwidth_counters(state, batch_size * size, sizeof(T));
+    energy_meter.add_counters(state, batch_size * size);
 
     HIP_CHECK(hipFree(d_temporary_storage));
     HIP_CHECK(hipFree(d_input));
@@ -248,6 +362,7 @@ void run_multi_even_benchmark(benchmark::State& state,
     }
     HIP_CHECK(hipDeviceSynchronize());
 
+    device_energy_meter energy_meter;
     for(auto _ : state)
     {
         auto start = std::chrono::high_resolution_clock::now();
@@ -274,6 +389,8 @@ void run_multi_even_benchmark(benchmark::State& state,
     }
     state.SetBytesProcessed(state.iterations() * batch_size * size * Channels * sizeof(T));
     state.SetItemsProcessed(state.iterations() * batch_size * size * Channels);
+    add_bandwidth_counters(state, batch_size * size * Channels, sizeof(T));
+    energy_meter.add_counters(state, batch_size * size * Channels);
 
     HIP_CHECK(hipFree(d_temporary_storage));
     HIP_CHECK(hipFree(d_input));
@@ -333,6 +450,7 @@ void run_range_benchmark(benchmark::State& state, size_t bins, hipStream_t strea
     }
     HIP_CHECK(hipDeviceSynchronize());
 
+    device_energy_meter energy_meter;
     for(auto _ : state)
     {
         auto start = std::chrono::high_resolution_clock::now();
@@ -358,6 +476,8 @@ void run_range_benchmark(benchmark::State& state, size_t bins, hipStream_t strea
     }
     state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
     state.SetItemsProcessed(state.iterations() * batch_size * size);
+    add_bandwidth_counters(state, batch_size * size, sizeof(T));
+    energy_meter.add_counters(state, batch_size * size);
 
     HIP_CHECK(hipFree(d_temporary_storage));
     HIP_CHECK(hipFree(d_input));
@@ -435,6 +555,7 @@ void run_multi_range_benchmark(benchmark::State& state,
     }
     HIP_CHECK(hipDeviceSynchronize());
 
+    device_energy_meter energy_meter;
     for(auto _ : state)
     {
         auto start = std::chrono::high_resolution_clock::now();
@@ -460,6 +581,8 @@ void run_multi_range_benchmark(benchmark::State& state,
     }
     state.SetBytesProcessed(state.iterations() * batch_size * size * Channels * sizeof(T));
     state.SetItemsProcessed(state.iterations() * batch_size * size * Channels);
+    add_bandwidth_counters(state, batch_size * size * Channels, sizeof(T));
+    energy_meter.add_counters(state, batch_size * size * Channels);
 
     HIP_CHECK(hipFree(d_temporary_storage));
     HIP_CHECK(hipFree(d_input));
@@ -524,6 +647,39 @@ void add_even_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmark
     };
 }
 
+#define CREATE_SKEWED_EVEN_BENCHMARK(T, BINS, WARP_AGGREGATION)                               \
+    benchmark::RegisterBenchmark(                                                             \
+        (std::string("histogram_even_skewed") + "<" #T ", warp_aggregation = "                \
+         #WARP_AGGREGATION ">" + "(" + std::to_string(skew_percents) + "% in one bin, "       \
+         + std::to_string(BINS) + " bins)")                                                   \
+            .c_str(),                                                                         \
+        [=](benchmark::State& state)                                                          \
+        {                                                                                     \
+            run_skewed_even_benchmark<T, WARP_AGGREGATION>(state,                             \
+                                                           BINS,                              \
+                                                           skew_percents,                     \
+                                                           stream,                            \
+                                                           size);                             \
+        })
+
+void add_skewed_even_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                                hipStream_t                                   stream,
+                                size_t                                        size)
+{
+    for(int skew_percents : {0, 50, 90, 99})
+    {
+        std::vector<benchmark::internal::Benchmark*> bs = {
+            CREATE_SKEWED_EVEN_BENCHMARK(int, 256, false),
+            CREATE_SKEWED_EVEN_BENCHMARK(int, 256, true),
+            CREATE_SKEWED_EVEN_BENCHMARK(int, 2048, false),
+            CREATE_SKEWED_EVEN_BENCHMARK(int, 2048, true),
+            CREATE_SKEWED_EVEN_BENCHMARK(unsigned short, 256, false),
+            CREATE_SKEWED_EVEN_BENCHMARK(unsigned short, 256, true),
+        };
+        benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
+    };
+}
+
 #define CREATE_MULTI_EVEN_BENCHMARK(CHANNELS, ACTIVE_CHANNELS, T, BINS, SCALE)                 \
     benchmark::RegisterBenchmark(                                                              \
         (std::string("multi_histogram_even") + "<" #CHANNELS ", " #ACTIVE_CHANNELS ", " #T ">" \
@@ -608,6 +764,17 @@ int main(int argc, char* argv[])
     cli::Parser parser(argc, argv);
     parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of values");
     parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+#ifdef BENCHMARK_CONFIG_TUNING
+    // optionally run an evenly split subset of benchmarks, when making multiple program invocations
+    parser.set_optional<int>("parallel_instance",
+                             "parallel_instance",
+                             0,
+                             "parallel instance index");
+    parser.set_optional<int>("parallel_instances",
+                             "parallel_instances",
+                             1,
+                             "total parallel instances");
+#endif
     parser.run_and_exit_if_error();
 
     // Parse argv
@@ -624,10 +791,23 @@ int main(int argc, char* argv[])
 
     // Add benchmarks
     std::vector<benchmark::internal::Benchmark*> benchmarks;
+#ifdef BENCHMARK_CONFIG_TUNING
+    const int parallel_instance = parser.get<int>("parallel_instance");
+    const int parallel_instances = parser.get<int>("parallel_instances");
+    config_autotune_register::register_benchmark_subset(benchmarks,
+                                                        parallel_instance,
+                                                        parallel_instances,
+                                                        size,
+                                                        stream);
+    benchmark::AddCustomContext("autotune_config_pattern",
+                                device_histogram_benchmark<>::get_name_pattern().c_str());
+#else
     add_even_benchmarks(benchmarks, stream, size);
+    add_skewed_even_benchmarks(benchmarks, stream, size);
     add_multi_even_benchmarks(benchmarks, stream, size);
     add_range_benchmarks(benchmarks, stream, size);
     add_multi_range_benchmarks(benchmarks, stream, size);
+#endif
 
     // Use manual timing
     for(auto& b : benchmarks)
@@ -0,0 +1,156 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef ROCPRIM_BENCHMARK_DEVICE_HISTOGRAM_PARALLEL_HPP_
+#define ROCPRIM_BENCHMARK_DEVICE_HISTOGRAM_PARALLEL_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// HIP API
+#include <hip/hip_runtime.h>
+
+// rocPRIM HIP API
+#include <rocprim/rocprim.hpp>
+
+#include "benchmark_utils.hpp"
+
+template<typename T                  = int,
+         unsigned int Channels       = 1,
+         unsigned int ActiveChannels = 1,
+         typename Config             = rocprim::detail::
+             default_histogram_config<ROCPRIM_TARGET_ARCH, T, Channels, ActiveChannels>>
+struct device_histogram_benchmark : public config_autotune_interface
+{
+    static std::string get_name_pattern()
+    {
+        return R"regex((?P<algo>\S*?)<)regex"
+               R"regex((?P<sample_type>\S*),\s*(?P<channels>[0-9]+),\s*)regex"
+               R"regex((?P<active_channels>[0-9]+),\s*histogram_config<\s*kernel_config<)regex"
+               R"regex(\s*(?P<block_size>[0-9]+),\s*(?P<items_per_thread>[0-9]+)>,)regex"
+               R"regex(\s*(?P<shared_impl_histograms>[0-9]+)>>)regex";
+    }
+
+    std::string name() const override
+    {
+        return std::string("device_histogram<" + std::string(Traits<T>::name()) + ", "
+                           + std::to_string(Channels) + ", " + std::to_string(ActiveChannels)
+                           + ", histogram_config<kernel_config<"
+                           + pad_string(std::to_string(Config::histogram::block_size), 3) + ", "
+                           + pad_string(std::to_string(Config::histogram::items_per_thread), 2)
+                           + ">, " + std::to_string(Config::shared_impl_histograms) + ">>");
+    }
+
+    static constexpr unsigned int batch_size  = 10;
+    static constexpr unsigned int warmup_size = 5;
+    // The bins of the 8-bit samples, the largest count of bins of the shared memory histograms
+    static constexpr unsigned int bins = 256;
+
+    void run(benchmark::State& state, size_t size, const hipStream_t stream) const override
+    {
+        using counter_type = unsigned int;
+
+        unsigned int num_levels[ActiveChannels];
+        int          lower_level[ActiveChannels];
+        int          upper_level[ActiveChannels];
+        for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+        {
+            lower_level[channel] = 0;
+            upper_level[channel] = bins;
+            num_levels[channel]  = bins + 1;
+        }
+
+        const std::vector<T> input = get_random_data<T>(size * Channels, 0, bins - 1);
+
+        T*            d_input;
+        counter_type* d_histogram[ActiveChannels];
+        HIP_CHECK(hipMalloc(&d_input, size * Channels * sizeof(T)));
+        for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+        {
+            HIP_CHECK(hipMalloc(&d_histogram[channel], bins * sizeof(counter_type)));
+        }
+        HIP_CHECK(
+            hipMemcpy(d_input, input.data(), size * Channels * sizeof(T), hipMemcpyHostToDevice));
+
+        auto dispatch = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+        {
+            return rocprim::multi_histogram_even<Channels, ActiveChannels, Config>(
+                d_temporary_storage,
+                temporary_storage_bytes,
+                d_input,
+                size,
+                d_histogram,
+                num_levels,
+                lower_level,
+                upper_level,
+                stream);
+        };
+
+        void*  d_temporary_storage     = nullptr;
+        size_t temporary_storage_bytes = 0;
+        HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+        HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        // Warm-up
+        for(size_t i = 0; i < warmup_size; i++)
+        {
+            HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        device_energy_meter energy_meter;
+        for(auto _ : state)
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+
+            for(size_t i = 0; i < batch_size; i++)
+            {
+                HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+            }
+            HIP_CHECK(hipStreamSynchronize(stream));
+
+            auto end = std::chrono::high_resolution_clock::now();
+            auto elapsed_seconds
+                = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+            state.SetIterationTime(elapsed_seconds.count());
+        }
+        state.SetBytesProcessed(state.iterations() * batch_size * size * Channels * sizeof(T));
+        state.SetItemsProcessed(state.iterations() * batch_size * size * Channels);
+        add_bandwidth_counters(state, batch_size * size * Channels, sizeof(T));
+        energy_meter.add_counters(state, batch_size * size * Channels);
+
+        HIP_CHECK(hipFree(d_temporary_storage));
+        HIP_CHECK(hipFree(d_input));
+        for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+        {
+            HIP_CHECK(hipFree(d_histogram[channel]));
+        }
+    }
+};
+
+#endif // ROCPRIM_BENCHMARK_DEVICE_HISTOGRAM_PARALLEL_HPP_
@@ -0,0 +1,340 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Latency of device-level algorithms at small sizes, where the host overhead dominates.
+//
+// Every iteration measures one call as an application observes it: the query of the size of
+// the temporary storage, the call itself and the synchronization of the stream. The iteration
+// time is this end-to-end time, and the counters split it up:
+// * p50_us, p99_us - percentiles of the end-to-end time,
+// * query_us - the query of the size of the temporary storage,
+// * enqueue_us - the host time of the call until it returns, which resolves the config and
+//   launches the kernels,
+// * gpu_us - the time between events recorded on the stream before and after the call,
+// * dispatch_us - one query of the target architecture of the stream (device properties and
+//   config dispatch), which is part of both the query and the call.
+// The counters other than the percentiles are medians of all iterations.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <vector>
+
+// Google Benchmark
+#include "benchmark/benchmark.h"
+// CmdParser
+#include "cmdparser.hpp"
+#include "benchmark_utils.hpp"
+
+// HIP API
+#include <hip/hip_runtime.h>
+
+// rocPRIM
+#include <rocprim/rocprim.hpp>
+
+namespace
+{
+
+constexpr unsigned int warmup_size = 10;
+
+// Sizes from 1 to 64K items
+const std::vector<size_t> sizes{1, 16, 256, 1024, 4096, 16384, 65536};
+
+double get_percentile(std::vector<double> samples, const double percentile)
+{
+    if(samples.empty())
+    {
+        return 0;
+    }
+    std::sort(samples.begin(), samples.end());
+    const size_t index = static_cast<size_t>(std::ceil(percentile * samples.size()));
+    return samples[std::min(samples.size() - 1, index == 0 ? 0 : index - 1)];
+}
+
+double get_microseconds(const std::chrono::high_resolution_clock::time_point start,
+                        const std::chrono::high_resolution_clock::time_point end)
+{
+    return std::chrono::duration<double, std::micro>(end - start).count();
+}
+
+// Algorithm must be callable as hipError_t(void* temporary_storage, size_t& storage_size)
+template<class Algorithm>
+void run_latency_benchmark(benchmark::State& state,
+                           const hipStream_t stream,
+                           Algorithm         algorithm)
+{
+    using clock = std::chrono::high_resolution_clock;
+
+    size_t temporary_storage_bytes = 0;
+    HIP_CHECK(algorithm(nullptr, temporary_storage_bytes));
+    void* d_temporary_storage;
+    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+
+    hipEvent_t start_event;
+    hipEvent_t stop_event;
+    HIP_CHECK(hipEventCreate(&start_event));
+    HIP_CHECK(hipEventCreate(&stop_event));
+
+    // Warm-up, the first calls load the kernels
+    for(size_t i = 0; i < warmup_size; i++)
+    {
+        HIP_CHECK(algorithm(d_temporary_storage, temporary_storage_bytes));
+    }
+    HIP_CHECK(hipStreamSynchronize(stream));
+
+    std::vector<double> total_times;
+    std::vector<double> query_times;
+    std::vector<double> enqueue_times;
+    std::vector<double> gpu_times;
+    std::vector<double> dispatch_times;
+    for(auto _ : state)
+    {
+        const auto dispatch_start = clock::now();
+        rocprim::detail::target_arch target_arch;
+        HIP_CHECK(rocprim::detail::host_target_arch(stream, target_arch));
+        benchmark::DoNotOptimize(target_arch);
+        const auto dispatch_end = clock::now();
+
+        const auto start        = clock::now();
+        size_t     storage_size = 0;
+        HIP_CHECK(algorithm(nullptr, storage_size));
+        const auto queried = clock::now();
+        HIP_CHECK(hipEventRecord(start_event, stream));
+        HIP_CHECK(algorithm(d_temporary_storage, storage_size));
+        HIP_CHECK(hipEventRecord(stop_event, stream));
+        const auto enqueued = clock::now();
+        HIP_CHECK(hipStreamSynchronize(stream));
+        const auto end = clock::now();
+
+        float gpu_milliseconds;
+        HIP_CHECK(hipEventElapsedTime(&gpu_milliseconds, start_event, stop_event));
+
+        total_times.push_back(get_microseconds(start, end));
+        query_times.push_back(get_microseconds(start, queried));
+        enqueue_times.push_back(get_microseconds(queried, enqueued));
+        gpu_times.push_back(gpu_milliseconds * 1000.0);
+        dispatch_times.push_back(get_microseconds(dispatch_start, dispatch_end));
+        state.SetIterationTime(total_times.back() / 1e6);
+    }
+
+    state.counters["p50_us"]      = get_percentile(total_times, 0.5);
+    state.counters["p99_us"]      = get_percentile(total_times, 0.99);
+    state.counters["query_us"]    = get_percentile(query_times, 0.5);
+    state.counters["enqueue_us"]  = get_percentile(enqueue_times, 0.5);
+    state.counters["gpu_us"]      = get_percentile(gpu_times, 0.5);
+    state.counters["dispatch_us"] = get_percentile(dispatch_times, 0.5);
+
+    HIP_CHECK(hipEventDestroy(start_event));
+    HIP_CHECK(hipEventDestroy(stop_event));
+    HIP_CHECK(hipFree(d_temporary_storage));
+}
+
+struct is_even
+{
+    ROCPRIM_HOST_DEVICE
+    bool operator()(const int value) const
+    {
+        return value % 2 == 0;
+    }
+};
+
+void run_reduce_benchmark(benchmark::State& state, const size_t size, const hipStream_t stream)
+{
+    using T                    = int;
+    const std::vector<T> input = get_random_data<T>(size, 0, 1000);
+
+    T* d_input;
+    T* d_output;
+    HIP_CHECK(hipMalloc(&d_input, size * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_output, sizeof(T)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+    run_latency_benchmark(
+        state,
+        stream,
+        [&](void* temporary_storage, size_t& storage_size)
+        {
+            return rocprim::reduce(temporary_storage,
+                                   storage_size,
+                                   d_input,
+                                   d_output,
+                                   T(0),
+                                   size,
+                                   rocprim::plus<T>(),
+                                   stream);
+        });
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
+
+void run_scan_benchmark(benchmark::State& state, const size_t size, const hipStream_t stream)
+{
+    using T                    = int;
+    const std::vector<T> input = get_random_data<T>(size, 0, 1000);
+
+    T* d_input;
+    T* d_output;
+    HIP_CHECK(hipMalloc(&d_input, size * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_output, size * sizeof(T)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+    run_latency_benchmark(
+        state,
+        stream,
+        [&](void* temporary_storage, size_t& storage_size)
+        {
+            return rocprim::inclusive_scan(temporary_storage,
+                                           storage_size,
+                                           d_input,
+                                           d_output,
+                                           size,
+                                           rocprim::plus<T>(),
+                                           stream);
+        });
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
+
+void run_select_benchmark(benchmark::State& state, const size_t size, const hipStream_t stream)
+{
+    using T                    = int;
+    const std::vector<T> input = get_random_data<T>(size, 0, 1000);
+
+    T*            d_input;
+    T*            d_output;
+    unsigned int* d_selected_count_output;
+    HIP_CHECK(hipMalloc(&d_input, size * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_output, size * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_selected_count_output, sizeof(unsigned int)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+    run_latency_benchmark(
+        state,
+        stream,
+        [&](void* temporary_storage, size_t& storage_size)
+        {
+            return rocprim::select(temporary_storage,
+                                   storage_size,
+                                   d_input,
+                                   d_output,
+                                   d_selected_count_output,
+                                   size,
+                                   is_even(),
+                                   stream);
+        });
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipFree(d_selected_count_output));
+}
+
+void run_radix_sort_benchmark(benchmark::State& state, const size_t size, const hipStream_t stream)
+{
+    using T                    = int;
+    const std::vector<T> input = get_random_data<T>(size,
+                                                    std::numeric_limits<T>::min(),
+                                                    std::numeric_limits<T>::max());
+
+    T* d_input;
+    T* d_output;
+    HIP_CHECK(hipMalloc(&d_input, size * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_output, size * sizeof(T)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+    run_latency_benchmark(
+        state,
+        stream,
+        [&](void* temporary_storage, size_t& storage_size)
+        {
+            return rocprim::radix_sort_keys(temporary_storage,
+                                            storage_size,
+                                            d_input,
+                                            d_output,
+                                            size,
+                                            0,
+                                            sizeof(T) * 8,
+                                            stream);
+        });
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
+
+} // namespace
+
+#define CREATE_BENCHMARK(ALGORITHM, FUNCTION)                                          \
+    for(const size_t size : sizes)                                                     \
+    {                                                                                  \
+        benchmarks.push_back(benchmark::RegisterBenchmark(                             \
+            (std::string("latency<" ALGORITHM "<int>>(") + std::to_string(size) + ")") \
+                .c_str(),                                                              \
+            FUNCTION,                                                                  \
+            size,                                                                      \
+            stream));                                                                  \
+    }
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const int trials = parser.get<int>("trials");
+
+    // HIP
+    hipStream_t stream = 0; // default
+
+    // Benchmark info
+    add_common_benchmark_info();
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks;
+    CREATE_BENCHMARK("reduce", run_reduce_benchmark)
+    CREATE_BENCHMARK("inclusive_scan", run_scan_benchmark)
+    CREATE_BENCHMARK("select", run_select_benchmark)
+    CREATE_BENCHMARK("radix_sort_keys", run_radix_sort_benchmark)
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMicrosecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
@@ -20,6 +20,7 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include <algorithm>
 #include <iostream>
 #include <chrono>
 #include <string>
@@ -376,6 +377,7 @@ void run_benchmark(benchmark::State& state,
     HIP_CHECK(hipDeviceSynchronize());
 
     const unsigned int batch_size = 10;
+    device_energy_meter energy_meter;
     for(auto _ : state)
     {
         auto start = std::chrono::high_resolution_clock::now();
@@ -397,6 +399,8 @@ void run_benchmark(benchmark::State& state,
     }
     state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
     state.SetItemsProcessed(state.iterations() * batch_size * size);
+    add_bandwidth_counters(state, batch_size * size, 2 * sizeof(T));
+    energy_meter.add_counters(state, batch_size * size);
 
     HIP_CHECK(hipFree(d_input));
     HIP_CHECK(hipFree(d_output));
@@ -432,6 +436,7 @@ void run_benchmark_memcpy(benchmark::State& state,
     HIP_CHECK(hipDeviceSynchronize());
 
     const unsigned int batch_size = 10;
+    device_energy_meter energy_meter;
     for(auto _ : state)
     {
         auto start = std::chrono::high_resolution_clock::now();
@@ -449,11 +454,128 @@ void run_benchmark_memcpy(benchmark::State& state,
     }
     state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
     state.SetItemsProcessed(state.iterations() * batch_size * size);
+    add_bandwidth_counters(state, batch_size * size, 2 * sizeof(T));
+    energy_meter.add_counters(state, batch_size * size);
 
     HIP_CHECK(hipFree(d_input));
     HIP_CHECK(hipFree(d_output));
 }
 
+enum host_memory_access
+{
+    // The pinned input is copied to device memory before the kernel reads it
+    pinned_copy,
+    // The kernel reads the input in place from mapped pinned memory
+    pinned_mapped,
+    // The managed input is migrated to the device by a prefetch before the kernel reads it
+    managed_prefetch,
+};
+
+// Reads inputs which reside in host memory, the throughput is bound by the PCIe or xGMI link
+template<
+    class T,
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    host_memory_access Access
+>
+void run_benchmark_host_memory(benchmark::State& state,
+                               size_t size,
+                               const hipStream_t stream)
+{
+    const size_t grid_size = size / (BlockSize * ItemsPerThread);
+    const std::vector<T> input = get_random_data<T>(size, T(0), T(100));
+
+    int device_id;
+    HIP_CHECK(hipGetDevice(&device_id));
+
+    T * h_input;
+    T * d_input;
+    T * d_output;
+    if(Access == managed_prefetch)
+    {
+        HIP_CHECK(hipMallocManaged(reinterpret_cast<void**>(&h_input), size * sizeof(T)));
+    }
+    else
+    {
+        HIP_CHECK(hipHostMalloc(reinterpret_cast<void**>(&h_input), size * sizeof(T),
+                                hipHostMallocMapped));
+    }
+    HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&d_input), size * sizeof(T)));
+    HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&d_output), size * sizeof(T)));
+    std::copy(input.begin(), input.end(), h_input);
+
+    rocprim::mapped_host_iterator<T> mapped_input;
+    if(Access == managed_prefetch)
+    {
+        mapped_input = rocprim::mapped_host_iterator<T>(h_input);
+    }
+    else
+    {
+        HIP_CHECK(rocprim::make_mapped_host_iterator(h_input, mapped_input));
+    }
+
+    operation<no_operation, T, ItemsPerThread, BlockSize> selected_operation;
+
+    auto run = [&]()
+    {
+        T * kernel_input = mapped_input.base();
+        if(Access == pinned_copy)
+        {
+            HIP_CHECK(hipMemcpyAsync(d_input, h_input, size * sizeof(T),
+                                     hipMemcpyHostToDevice, stream));
+            kernel_input = d_input;
+        }
+        else if(Access == managed_prefetch)
+        {
+            HIP_CHECK(mapped_input.prefetch(size, device_id, stream));
+        }
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(operation_kernel<T, BlockSize, ItemsPerThread, vectorized>),
+            dim3(grid_size), dim3(BlockSize), 0, stream,
+            kernel_input, d_output, selected_operation
+        );
+    };
+
+    // Warm-up
+    run();
+    HIP_CHECK(hipDeviceSynchronize());
+
+    device_energy_meter energy_meter;
+    for(auto _ : state)
+    {
+        if(Access == managed_prefetch)
+        {
+            // Every iteration migrates the input from the host again
+            HIP_CHECK(mapped_input.prefetch(size, hipCpuDeviceId, stream));
+            HIP_CHECK(hipStreamSynchronize(stream));
+        }
+
+        auto start = std::chrono::high_resolution_clock::now();
+        run();
+        HIP_CHECK(hipStreamSynchronize(stream));
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds =
+            std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    state.SetBytesProcessed(state.iterations() * size * sizeof(T));
+    state.SetItemsProcessed(state.iterations() * size);
+    add_bandwidth_counters(state, size, 2 * sizeof(T));
+    energy_meter.add_counters(state, size);
+
+    if(Access == managed_prefetch)
+    {
+        HIP_CHECK(hipFree(h_input));
+    }
+    else
+    {
+        HIP_CHECK(hipHostFree(h_input));
+    }
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
+
 #define CREATE_BENCHMARK(METHOD, OPERATION, T, SIZE, BLOCK_SIZE, IPT) \
 benchmark::RegisterBenchmark( \
     (#METHOD "_" #OPERATION "<" #T "," #SIZE ",BS:" #BLOCK_SIZE ",IPT:" #IPT ">"), \
@@ -466,6 +588,12 @@ benchmark::RegisterBenchmark( \
     ("Memcpy<" #T "," #SIZE">"), run_benchmark_memcpy<T>, SIZE, stream \
 )
 
+#define CREATE_BENCHMARK_HOST_MEMORY(ACCESS, T, SIZE, BLOCK_SIZE, IPT) \
+benchmark::RegisterBenchmark( \
+    (#ACCESS "<" #T "," #SIZE ",BS:" #BLOCK_SIZE ",IPT:" #IPT ">"), \
+    run_benchmark_host_memory<T, BLOCK_SIZE, IPT, ACCESS>, SIZE, stream \
+)
+
 template<class T>
 constexpr unsigned int megabytes(unsigned int size)
 {
@@ -494,6 +622,13 @@ int main(int argc, char *argv[])
         // simple memory copy not running kernel
         CREATE_BENCHMARK_MEMCPY(int, megabytes<int>(128)),
 
+        // reading inputs in host memory
+        CREATE_BENCHMARK_HOST_MEMORY(pinned_copy, int, megabytes<int>(128), 256, 4),
+        CREATE_BENCHMARK_HOST_MEMORY(pinned_mapped, int, megabytes<int>(128), 256, 4),
+        CREATE_BENCHMARK_HOST_MEMORY(pinned_mapped, int, megabytes<int>(128), 256, 16),
+        CREATE_BENCHMARK_HOST_MEMORY(managed_prefetch, int, megabytes<int>(128), 256, 4),
+        CREATE_BENCHMARK_HOST_MEMORY(pinned_mapped, uint64_t, megabytes<uint64_t>(128), 256, 4),
+
         // simple memory copy
         CREATE_BENCHMARK(block_primitives_transpose, no_operation, int, megabytes<int>(128), 128, 1),
         CREATE_BENCHMARK(block_primitives_transpose, no_operation, int, megabytes<int>(128), 128, 2),
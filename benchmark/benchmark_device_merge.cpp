@@ -112,6 +112,7 @@ void run_merge_keys_benchmark(benchmark::State& state, hipStream_t stream, size_
     }
     HIP_CHECK(hipDeviceSynchronize());
 
+    device_energy_meter energy_meter;
     for (auto _ : state)
     {
         auto start = std::chrono::high_resolution_clock::now();
@@ -135,6 +136,8 @@ void run_merge_keys_benchmark(benchmark::State& state, hipStream_t stream, size_
     }
     state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(key_type));
     state.SetItemsProcessed(state.iterations() * batch_size * size);
+    add_bandwidth_counters(state, batch_size * size, 2 * sizeof(key_type));
+    energy_meter.add_counters(state, batch_size * size);
 
     HIP_CHECK(hipFree(d_temporary_storage));
     HIP_CHECK(hipFree(d_keys_input1));
@@ -221,6 +224,7 @@ void run_merge_pairs_benchmark(benchmark::State& state, hipStream_t stream, size
     }
     HIP_CHECK(hipDeviceSynchronize());
 
+    device_energy_meter energy_meter;
     for (auto _ : state)
     {
         auto start = std::chrono::high_resolution_clock::now();
@@ -246,6 +250,8 @@ void run_merge_pairs_benchmark(benchmark::State& state, hipStream_t stream, size
     }
     state.SetBytesProcessed(state.iterations() * batch_size * size * (sizeof(key_type) + sizeof(value_type)));
     state.SetItemsProcessed(state.iterations() * batch_size * size);
+    add_bandwidth_counters(state, batch_size * size, 2 * (sizeof(key_type) + sizeof(value_type)));
+    energy_meter.add_counters(state, batch_size * size);
 
     HIP_CHECK(hipFree(d_temporary_storage));
     HIP_CHECK(hipFree(d_keys_input1));
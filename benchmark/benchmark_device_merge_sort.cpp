@@ -42,10 +42,11 @@
 const size_t DEFAULT_N = 1024 * 1024 * 32;
 #endif
 
-#define CREATE_BENCHMARK(...)                                    \
-    {                                                            \
-        const device_merge_sort_benchmark<__VA_ARGS__> instance; \
-        REGISTER_BENCHMARK(benchmarks, size, stream, instance);  \
+#define CREATE_BENCHMARK(...)                                                  \
+    for(const sort_key_distribution distribution : distributions)              \
+    {                                                                          \
+        const device_merge_sort_benchmark<__VA_ARGS__> instance(distribution); \
+        REGISTER_BENCHMARK(benchmarks, size, stream, instance);                \
     }
 
 int main(int argc, char *argv[])
@@ -63,6 +64,13 @@ int main(int argc, char *argv[])
                              "parallel_instances",
                              1,
                              "total parallel instances");
+#else
+    parser.set_optional<std::string>("distribution",
+                                     "distribution",
+                                     "all",
+                                     "key distributions: all or a comma separated list of "
+                                     "uniform, sorted, reverse_sorted, nearly_sorted, "
+                                     "few_unique, zipf, low_entropy, equal_high_bits");
 #endif
     parser.run_and_exit_if_error();
 
@@ -91,6 +99,9 @@ int main(int argc, char *argv[])
     benchmark::AddCustomContext("autotune_config_pattern",
                                 device_merge_sort_benchmark<>::get_name_pattern().c_str());
 #else // BENCHMARK_CONFIG_TUNING
+    const std::vector<sort_key_distribution> distributions
+        = parse_sort_key_distributions(parser.get<std::string>("distribution"));
+
     CREATE_BENCHMARK(int)
     CREATE_BENCHMARK(long long)
     CREATE_BENCHMARK(int8_t)
@@ -63,12 +63,20 @@ struct device_merge_sort_benchmark : public config_autotune_interface
                    : std::string(Traits<Value>::name()) + ", ")
             + "merge_sort_config<" + pad_string(std::to_string(Config::sort_config::block_size), 4)
             + ", " + pad_string(std::to_string(Config::sort_config::items_per_thread), 2) + ", "
-            + pad_string(std::to_string(Config::merge_impl1_config::block_size), 4) + ">>");
+            + pad_string(std::to_string(Config::merge_impl1_config::block_size), 4) + ">>"
+            + get_sort_key_distribution_suffix(distribution));
     }
 
     static constexpr unsigned int batch_size  = 10;
     static constexpr unsigned int warmup_size = 5;
 
+    sort_key_distribution distribution;
+
+    explicit device_merge_sort_benchmark(
+        const sort_key_distribution distribution = sort_key_distribution::uniform)
+        : distribution(distribution)
+    {}
+
     // keys benchmark
     template<typename val = Value>
     auto do_run(benchmark::State& state, size_t size, const hipStream_t stream) const ->
@@ -77,17 +85,7 @@ struct device_merge_sort_benchmark : public config_autotune_interface
         using key_type = Key;
 
         // Generate data
-        std::vector<key_type> keys_input;
-        if(std::is_floating_point<key_type>::value)
-        {
-            keys_input = get_random_data<key_type>(size, (key_type)-1000, (key_type) + 1000);
-        }
-        else
-        {
-            keys_input = get_random_data<key_type>(size,
-                                                   std::numeric_limits<key_type>::min(),
-                                                   std::numeric_limits<key_type>::max());
-        }
+        std::vector<key_type> keys_input = get_sort_keys<key_type>(size, distribution);
 
         key_type* d_keys_input;
         key_type* d_keys_output;
@@ -128,6 +126,7 @@ struct device_merge_sort_benchmark : public config_autotune_interface
         }
         HIP_CHECK(hipDeviceSynchronize());
 
+        device_energy_meter energy_meter;
         for(auto _ : state)
         {
             auto start = std::chrono::high_resolution_clock::now();
@@ -152,6 +151,8 @@ struct device_merge_sort_benchmark : public config_autotune_interface
         }
         state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(key_type));
         state.SetItemsProcessed(state.iterations() * batch_size * size);
+        add_bandwidth_counters(state, batch_size * size, 2 * sizeof(key_type));
+        energy_meter.add_counters(state, batch_size * size);
 
         HIP_CHECK(hipFree(d_temporary_storage));
         HIP_CHECK(hipFree(d_keys_input));
@@ -167,17 +168,7 @@ struct device_merge_sort_benchmark : public config_autotune_interface
         using value_type = Value;
 
         // Generate data
-        std::vector<key_type> keys_input;
-        if(std::is_floating_point<key_type>::value)
-        {
-            keys_input = get_random_data<key_type>(size, (key_type)-1000, (key_type) + 1000);
-        }
-        else
-        {
-            keys_input = get_random_data<key_type>(size,
-                                                   std::numeric_limits<key_type>::min(),
-                                                   std::numeric_limits<key_type>::max());
-        }
+        std::vector<key_type> keys_input = get_sort_keys<key_type>(size, distribution);
 
         std::vector<value_type> values_input(size);
         std::iota(values_input.begin(), values_input.end(), 0);
@@ -234,6 +225,7 @@ struct device_merge_sort_benchmark : public config_autotune_interface
         }
         HIP_CHECK(hipDeviceSynchronize());
 
+        device_energy_meter energy_meter;
         for(auto _ : state)
         {
             auto start = std::chrono::high_resolution_clock::now();
@@ -261,6 +253,10 @@ struct device_merge_sort_benchmark : public config_autotune_interface
         state.SetBytesProcessed(state.iterations() * batch_size * size
                                 * (sizeof(key_type) + sizeof(value_type)));
         state.SetItemsProcessed(state.iterations() * batch_size * size);
+        add_bandwidth_counters(state,
+                               batch_size * size,
+                               2 * (sizeof(key_type) + sizeof(value_type)));
+        energy_meter.add_counters(state, batch_size * size);
 
         HIP_CHECK(hipFree(d_temporary_storage));
         HIP_CHECK(hipFree(d_keys_input));
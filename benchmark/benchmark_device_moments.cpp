@@ -0,0 +1,288 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// HIP API
+#include <hip/hip_runtime.h>
+
+// rocPRIM HIP API
+#include <rocprim/rocprim.hpp>
+
+// CmdParser
+#include "cmdparser.hpp"
+
+#include "benchmark_utils.hpp"
+
+#ifndef DEFAULT_N
+const size_t DEFAULT_N = 1024 * 1024 * 128;
+#endif
+
+template<typename T>
+using moments_result_t = rocprim::moments_result<
+    typename std::conditional<std::is_same<T, double>::value, double, float>::type>;
+
+// Mean and variance of the whole input, the bandwidth is compared with device_reduce<T>
+template<typename T>
+struct device_moments_benchmark : public config_autotune_interface
+{
+    using result_type = moments_result_t<T>;
+
+    std::string name() const override
+    {
+        return std::string("device_moments<" + std::string(Traits<T>::name())
+                           + ", default_config>");
+    }
+
+    static constexpr unsigned int batch_size  = 10;
+    static constexpr unsigned int warmup_size = 5;
+
+    void run(benchmark::State& state, size_t size, const hipStream_t stream) const override
+    {
+        std::vector<T> input = get_random_data<T>(size, T(0), T(100));
+
+        T*           d_input;
+        result_type* d_output;
+        HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&d_input), size * sizeof(T)));
+        HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&d_output), sizeof(result_type)));
+        HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        auto dispatch = [&](void* d_temp_storage, size_t& temp_storage_size_bytes)
+        {
+            return rocprim::moments(d_temp_storage,
+                                    temp_storage_size_bytes,
+                                    d_input,
+                                    d_output,
+                                    size,
+                                    stream);
+        };
+
+        // Allocate temporary storage memory
+        size_t temp_storage_size_bytes;
+        void*  d_temp_storage = nullptr;
+        HIP_CHECK(dispatch(d_temp_storage, temp_storage_size_bytes));
+        HIP_CHECK(hipMalloc(&d_temp_storage, temp_storage_size_bytes));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        // Warm-up
+        for(size_t i = 0; i < warmup_size; i++)
+        {
+            HIP_CHECK(dispatch(d_temp_storage, temp_storage_size_bytes));
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        device_energy_meter energy_meter;
+        for(auto _ : state)
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+
+            for(size_t i = 0; i < batch_size; i++)
+            {
+                HIP_CHECK(dispatch(d_temp_storage, temp_storage_size_bytes));
+            }
+            HIP_CHECK(hipStreamSynchronize(stream));
+
+            auto end = std::chrono::high_resolution_clock::now();
+            auto elapsed_seconds
+                = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+            state.SetIterationTime(elapsed_seconds.count());
+        }
+        state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
+        state.SetItemsProcessed(state.iterations() * batch_size * size);
+        add_bandwidth_counters(state, batch_size * size, sizeof(T));
+        energy_meter.add_counters(state, batch_size * size);
+
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_output));
+        HIP_CHECK(hipFree(d_temp_storage));
+    }
+};
+
+// Mean and variance of about Segments segments of uniformly distributed lengths
+template<typename T, size_t Segments>
+struct device_segmented_moments_benchmark : public config_autotune_interface
+{
+    using result_type = moments_result_t<T>;
+    using offset_type = int;
+
+    std::string name() const override
+    {
+        return std::string("device_segmented_moments<" + std::string(Traits<T>::name())
+                           + ", default_config>(~" + std::to_string(Segments) + " segments)");
+    }
+
+    static constexpr unsigned int batch_size  = 10;
+    static constexpr unsigned int warmup_size = 5;
+
+    void run(benchmark::State& state, size_t size, const hipStream_t stream) const override
+    {
+        const unsigned int             seed = 123;
+        const std::vector<offset_type> offsets
+            = get_segment_offsets<offset_type>(size,
+                                               Segments,
+                                               segment_length_distribution::uniform,
+                                               seed);
+        const unsigned int segments = offsets.size() - 1;
+
+        std::vector<T> input = get_random_data<T>(size, T(0), T(100));
+
+        T*           d_input;
+        offset_type* d_offsets;
+        result_type* d_output;
+        HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&d_input), size * sizeof(T)));
+        HIP_CHECK(
+            hipMalloc(reinterpret_cast<void**>(&d_offsets), offsets.size() * sizeof(offset_type)));
+        HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&d_output), segments * sizeof(result_type)));
+        HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_offsets,
+                            offsets.data(),
+                            offsets.size() * sizeof(offset_type),
+                            hipMemcpyHostToDevice));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        auto dispatch = [&](void* d_temp_storage, size_t& temp_storage_size_bytes)
+        {
+            return rocprim::segmented_moments(d_temp_storage,
+                                              temp_storage_size_bytes,
+                                              d_input,
+                                              d_output,
+                                              segments,
+                                              d_offsets,
+                                              d_offsets + 1,
+                                              stream);
+        };
+
+        // Allocate temporary storage memory
+        size_t temp_storage_size_bytes;
+        void*  d_temp_storage = nullptr;
+        HIP_CHECK(dispatch(d_temp_storage, temp_storage_size_bytes));
+        HIP_CHECK(hipMalloc(&d_temp_storage, temp_storage_size_bytes));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        // Warm-up
+        for(size_t i = 0; i < warmup_size; i++)
+        {
+            HIP_CHECK(dispatch(d_temp_storage, temp_storage_size_bytes));
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        device_energy_meter energy_meter;
+        for(auto _ : state)
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+
+            for(size_t i = 0; i < batch_size; i++)
+            {
+                HIP_CHECK(dispatch(d_temp_storage, temp_storage_size_bytes));
+            }
+            HIP_CHECK(hipStreamSynchronize(stream));
+
+            auto end = std::chrono::high_resolution_clock::now();
+            auto elapsed_seconds
+                = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+            state.SetIterationTime(elapsed_seconds.count());
+        }
+        state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
+        state.SetItemsProcessed(state.iterations() * batch_size * size);
+        add_bandwidth_counters(state, batch_size * size, sizeof(T));
+        energy_meter.add_counters(state, batch_size * size);
+
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_offsets));
+        HIP_CHECK(hipFree(d_output));
+        HIP_CHECK(hipFree(d_temp_storage));
+    }
+};
+
+#define CREATE_BENCHMARK(T)                                     \
+    {                                                           \
+        const device_moments_benchmark<T> instance;             \
+        REGISTER_BENCHMARK(benchmarks, size, stream, instance); \
+    }
+
+#define CREATE_SEGMENTED_BENCHMARK(T, SEGMENTS)                         \
+    {                                                                   \
+        const device_segmented_moments_benchmark<T, SEGMENTS> instance; \
+        REGISTER_BENCHMARK(benchmarks, size, stream, instance);         \
+    }
+
+int main(int argc, char *argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of values");
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const size_t size = parser.get<size_t>("size");
+    const int trials = parser.get<int>("trials");
+
+    // HIP
+    hipStream_t stream = 0; // default
+
+    // Benchmark info
+    add_common_benchmark_info();
+    benchmark::AddCustomContext("size", std::to_string(size));
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks = {};
+
+    CREATE_BENCHMARK(float)
+    CREATE_BENCHMARK(double)
+    CREATE_BENCHMARK(int)
+    CREATE_BENCHMARK(rocprim::half)
+
+    CREATE_SEGMENTED_BENCHMARK(float, 100)
+    CREATE_SEGMENTED_BENCHMARK(float, 10000)
+    CREATE_SEGMENTED_BENCHMARK(double, 100)
+    CREATE_SEGMENTED_BENCHMARK(double, 10000)
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+
+    return 0;
+}
@@ -128,6 +128,7 @@ void run_flagged_benchmark(benchmark::State& state,
     HIP_CHECK(hipDeviceSynchronize());
 
     const unsigned int batch_size = 10;
+    device_energy_meter energy_meter;
     for(auto _ : state)
     {
         auto start = std::chrono::high_resolution_clock::now();
@@ -153,6 +154,8 @@ void run_flagged_benchmark(benchmark::State& state,
     }
     state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
     state.SetItemsProcessed(state.iterations() * batch_size * size);
+    add_bandwidth_counters(state, batch_size * size, 2 * sizeof(T) + sizeof(FlagType));
+    energy_meter.add_counters(state, batch_size * size);
 
     hipFree(d_input);
     hipFree(d_flags);
@@ -226,6 +229,7 @@ void run_if_benchmark(benchmark::State& state,
     HIP_CHECK(hipDeviceSynchronize());
 
     const unsigned int batch_size = 10;
+    device_energy_meter energy_meter;
     for(auto _ : state)
     {
         auto start = std::chrono::high_resolution_clock::now();
@@ -251,6 +255,8 @@ void run_if_benchmark(benchmark::State& state,
     }
     state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
     state.SetItemsProcessed(state.iterations() * batch_size * size);
+    add_bandwidth_counters(state, batch_size * size, 2 * sizeof(T));
+    energy_meter.add_counters(state, batch_size * size);
 
     hipFree(d_input);
     hipFree(d_output);
@@ -337,6 +343,7 @@ void run_three_way_benchmark(benchmark::State& state,
     HIP_CHECK(hipDeviceSynchronize());
 
     const unsigned int batch_size = 10;
+    device_energy_meter energy_meter;
     for(auto _ : state)
     {
         auto start = std::chrono::high_resolution_clock::now();
@@ -365,6 +372,8 @@ void run_three_way_benchmark(benchmark::State& state,
     }
     state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
     state.SetItemsProcessed(state.iterations() * batch_size * size);
+    add_bandwidth_counters(state, batch_size * size, 2 * sizeof(T));
+    energy_meter.add_counters(state, batch_size * size);
 
     hipFree(d_input);
     hipFree(d_output_first);
@@ -374,6 +383,86 @@ void run_three_way_benchmark(benchmark::State& state,
     hipFree(d_temp_storage);
 }
 
+struct is_even
+{
+    ROCPRIM_HOST_DEVICE
+    bool operator()(const int value) const
+    {
+        return value % 2 == 0;
+    }
+};
+
+// Partitions of size / stream_count items each on stream_count streams at the same time, the
+// look-back of the partitions waits for the selected counts of the preceding blocks with Backoff.
+template<rocprim::lookback_backoff Backoff>
+void run_backoff_benchmark(benchmark::State&  state,
+                           const size_t       size,
+                           const unsigned int stream_count)
+{
+    using T      = int;
+    using config = rocprim::select_config<256,
+                                          13,
+                                          rocprim::block_load_method::block_load_transpose,
+                                          rocprim::block_load_method::block_load_transpose,
+                                          rocprim::block_load_method::block_load_transpose,
+                                          rocprim::block_scan_algorithm::using_warp_scan,
+                                          ROCPRIM_GRID_SIZE_LIMIT,
+                                          rocprim::load_default,
+                                          rocprim::store_default,
+                                          0,
+                                          Backoff>;
+
+    const size_t         instance_size = size / stream_count;
+    const std::vector<T> input         = get_random_data<T>(instance_size * stream_count, 0, 1000);
+
+    T*            d_input;
+    T*            d_output;
+    unsigned int* d_selected_count_output;
+    HIP_CHECK(hipMalloc(&d_input, input.size() * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_output, input.size() * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_selected_count_output, stream_count * sizeof(unsigned int)));
+    HIP_CHECK(
+        hipMemcpy(d_input, input.data(), input.size() * sizeof(T), hipMemcpyHostToDevice));
+
+    size_t instance_storage_bytes = 0;
+    HIP_CHECK(rocprim::partition<config>(nullptr,
+                                         instance_storage_bytes,
+                                         d_input,
+                                         d_output,
+                                         d_selected_count_output,
+                                         instance_size,
+                                         is_even()));
+    instance_storage_bytes = rocprim::detail::align_size(instance_storage_bytes);
+    char* d_temporary_storage;
+    HIP_CHECK(hipMalloc(&d_temporary_storage, instance_storage_bytes * stream_count));
+
+    run_concurrent_streams_benchmark(
+        state,
+        stream_count,
+        [&](const unsigned int instance, const hipStream_t stream)
+        {
+            const size_t offset        = instance * instance_size;
+            size_t       storage_bytes = instance_storage_bytes;
+            return rocprim::partition<config>(d_temporary_storage
+                                                  + instance * instance_storage_bytes,
+                                              storage_bytes,
+                                              d_input + offset,
+                                              d_output + offset,
+                                              d_selected_count_output + instance,
+                                              instance_size,
+                                              is_even(),
+                                              stream);
+        });
+
+    state.SetBytesProcessed(state.iterations() * input.size() * sizeof(T));
+    state.SetItemsProcessed(state.iterations() * input.size());
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipFree(d_selected_count_output));
+    HIP_CHECK(hipFree(d_temporary_storage));
+}
+
 #define CREATE_PARTITION_FLAGGED_BENCHMARK(T, F, p) \
 benchmark::RegisterBenchmark( \
     ("partition(flags)<" #T "," #F ", "#T", unsigned int>(p = " #p")"), \
@@ -410,6 +499,21 @@ benchmark::RegisterBenchmark( \
     CREATE_PARTITION_THREE_WAY_BENCHMARK(type, 0.5f, 0.75f), \
     CREATE_PARTITION_THREE_WAY_BENCHMARK(type, 0.75f, 1.f)
 
+#define CREATE_BACKOFF_BENCHMARK(BACKOFF, STREAMS)                                        \
+    benchmark::RegisterBenchmark(                                                       \
+        (std::string("partition(if)_backoff<int, ") + get_lookback_backoff_name(BACKOFF) \
+         + ">(streams " #STREAMS ")")                                                   \
+            .c_str(),                                                                   \
+        run_backoff_benchmark<BACKOFF>,                                                 \
+        size,                                                                           \
+        STREAMS)
+
+#define BENCHMARK_BACKOFF(STREAMS)                                                 \
+    CREATE_BACKOFF_BENCHMARK(rocprim::lookback_backoff::automatic, STREAMS),         \
+    CREATE_BACKOFF_BENCHMARK(rocprim::lookback_backoff::spin, STREAMS),              \
+    CREATE_BACKOFF_BENCHMARK(rocprim::lookback_backoff::exponential_sleep, STREAMS), \
+    CREATE_BACKOFF_BENCHMARK(rocprim::lookback_backoff::bounded_sleep, STREAMS)
+
 int main(int argc, char *argv[])
 {
     cli::Parser parser(argc, argv);
@@ -457,7 +561,10 @@ int main(int argc, char *argv[])
         BENCHMARK_THREE_WAY_TYPE(uint8_t),
         BENCHMARK_THREE_WAY_TYPE(int8_t),
         BENCHMARK_THREE_WAY_TYPE(rocprim::half),
-        BENCHMARK_THREE_WAY_TYPE(custom_int_double)
+        BENCHMARK_THREE_WAY_TYPE(custom_int_double),
+
+        BENCHMARK_BACKOFF(1),
+        BENCHMARK_BACKOFF(4)
     };
 
     // Use manual timing
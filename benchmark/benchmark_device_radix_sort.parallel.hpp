@@ -40,6 +40,21 @@
 
 namespace rp = rocprim;
 
+// The values of the pairs benchmarks, nested custom types are built from their members
+template<typename T>
+inline auto make_value(const size_t i) ->
+    typename std::enable_if<!is_custom_type<T>::value, T>::type
+{
+    return T(i);
+}
+
+template<typename T>
+inline auto make_value(const size_t i) ->
+    typename std::enable_if<is_custom_type<T>::value, T>::type
+{
+    return T(make_value<typename T::first_type>(i), make_value<typename T::second_type>(i));
+}
+
 template<typename Key   = int,
          typename Value = rocprim::empty_type,
          typename Config
@@ -76,35 +91,35 @@ struct device_radix_sort_benchmark : public config_autotune_interface
             + ", " + pad_string(std::to_string(Config::sort_single::items_per_thread), 2) + ">, "
             + "kernel_config<" + pad_string(std::to_string(Config::sort_merge::block_size), 4)
             + ", " + pad_string(std::to_string(Config::sort_merge::items_per_thread), 2) + ">, "
-            + std::to_string(Config::force_single_kernel_config) + ">>");
+            + std::to_string(Config::force_single_kernel_config) + ">>"
+            + (scatter_run_length > 0
+                   ? ", write_combining<" + std::to_string(scatter_run_length) + ">"
+                   : ""s)
+            + (indirect ? ", indirect"s : ""s)
+            + get_sort_key_distribution_suffix(distribution));
     }
 
     static constexpr unsigned int batch_size  = 10;
     static constexpr unsigned int warmup_size = 5;
+    static constexpr unsigned int scatter_run_length
+        = rocprim::detail::radix_sort_scatter_run_length<Config>::value;
+    // Whether large inputs are sorted as (key, index) pairs and the values are gathered
+    static constexpr bool indirect
+        = rocprim::detail::radix_sort_indirect_enabled<Config, Value, unsigned int>::value;
 
-    static std::vector<Key> generate_keys(size_t size)
-    {
-        using key_type = Key;
+    sort_key_distribution distribution;
 
-        if(std::is_floating_point<key_type>::value)
-        {
-            return get_random_data<key_type>(size, (key_type)-1000, (key_type) + 1000, size);
-        }
-        else
-        {
-            return get_random_data<key_type>(size,
-                                             std::numeric_limits<key_type>::min(),
-                                             std::numeric_limits<key_type>::max(),
-                                             size);
-        }
-    }
+    explicit device_radix_sort_benchmark(
+        const sort_key_distribution distribution = sort_key_distribution::uniform)
+        : distribution(distribution)
+    {}
 
     // keys benchmark
     template<typename val = Value>
     auto do_run(benchmark::State& state, size_t size, const hipStream_t stream) const ->
         typename std::enable_if<std::is_same<val, ::rocprim::empty_type>::value, void>::type
     {
-        auto keys_input = generate_keys(size);
+        auto keys_input = get_sort_keys<Key>(size, distribution);
 
         using key_type = Key;
 
@@ -148,6 +163,7 @@ struct device_radix_sort_benchmark : public config_autotune_interface
         }
         HIP_CHECK(hipDeviceSynchronize());
 
+        device_energy_meter energy_meter;
         for(auto _ : state)
         {
             auto start = std::chrono::high_resolution_clock::now();
@@ -173,6 +189,8 @@ struct device_radix_sort_benchmark : public config_autotune_interface
         }
         state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(key_type));
         state.SetItemsProcessed(state.iterations() * batch_size * size);
+        add_bandwidth_counters(state, batch_size * size, 2 * sizeof(key_type));
+        energy_meter.add_counters(state, batch_size * size);
 
         HIP_CHECK(hipFree(d_temporary_storage));
         HIP_CHECK(hipFree(d_keys_input));
@@ -184,7 +202,7 @@ struct device_radix_sort_benchmark : public config_autotune_interface
     auto do_run(benchmark::State& state, size_t size, const hipStream_t stream) const ->
         typename std::enable_if<!std::is_same<val, ::rocprim::empty_type>::value, void>::type
     {
-        auto keys_input = generate_keys(size);
+        auto keys_input = get_sort_keys<Key>(size, distribution);
 
         using key_type   = Key;
         using value_type = Value;
@@ -192,7 +210,7 @@ struct device_radix_sort_benchmark : public config_autotune_interface
         std::vector<value_type> values_input(size);
         for(size_t i = 0; i < size; i++)
         {
-            values_input[i] = value_type(i);
+            values_input[i] = make_value<value_type>(i);
         }
 
         key_type* d_keys_input;
@@ -247,6 +265,7 @@ struct device_radix_sort_benchmark : public config_autotune_interface
         }
         HIP_CHECK(hipDeviceSynchronize());
 
+        device_energy_meter energy_meter;
         for(auto _ : state)
         {
             auto start = std::chrono::high_resolution_clock::now();
@@ -275,6 +294,10 @@ struct device_radix_sort_benchmark : public config_autotune_interface
         state.SetBytesProcessed(state.iterations() * batch_size * size
                                 * (sizeof(key_type) + sizeof(value_type)));
         state.SetItemsProcessed(state.iterations() * batch_size * size);
+        add_bandwidth_counters(state,
+                               batch_size * size,
+                               2 * (sizeof(key_type) + sizeof(value_type)));
+        energy_meter.add_counters(state, batch_size * size);
 
         HIP_CHECK(hipFree(d_temporary_storage));
         HIP_CHECK(hipFree(d_keys_input));
@@ -375,15 +398,54 @@ struct device_radix_sort_single_benchmark_generator
 
 #else // BENCHMARK_CONFIG_TUNING
 
-    #define CREATE_RADIX_SORT_BENCHMARK(...)                         \
-        {                                                            \
-            const device_radix_sort_benchmark<__VA_ARGS__> instance; \
-            REGISTER_BENCHMARK(benchmarks, size, stream, instance);  \
+// The default configuration with the write-combining scatter of the runs of at least 16 items
+template<typename Key,
+         typename Value = rocprim::empty_type,
+         typename Base
+         = rocprim::detail::default_radix_sort_config<ROCPRIM_TARGET_ARCH, Key, Value>>
+using write_combining_radix_sort_config
+    = rocprim::radix_sort_config<Base::long_radix_bits,
+                                 Base::short_radix_bits,
+                                 typename Base::scan,
+                                 typename Base::sort,
+                                 typename Base::sort_single,
+                                 typename Base::sort_merge,
+                                 Base::merge_size_limit_blocks,
+                                 Base::force_single_kernel_config,
+                                 Base::use_onesweep,
+                                 typename Base::onesweep_histogram,
+                                 typename Base::onesweep,
+                                 Base::store_cache_modifier,
+                                 16>;
+
+// The default configuration which moves the values with the keys in every pass
+template<typename Key, typename Value>
+struct direct_radix_sort_config
+    : rocprim::detail::default_radix_sort_config<ROCPRIM_TARGET_ARCH, Key, Value>
+{
+    static constexpr unsigned int indirect_value_size_threshold
+        = std::numeric_limits<unsigned int>::max();
+};
+
+// The default configuration which sorts the indices of all values larger than the indices
+template<typename Key, typename Value>
+struct indirect_radix_sort_config
+    : rocprim::detail::default_radix_sort_config<ROCPRIM_TARGET_ARCH, Key, Value>
+{
+    static constexpr unsigned int indirect_value_size_threshold = 0;
+};
+
+    #define CREATE_RADIX_SORT_BENCHMARK(...)                                       \
+        for(const sort_key_distribution distribution : distributions)             \
+        {                                                                          \
+            const device_radix_sort_benchmark<__VA_ARGS__> instance(distribution); \
+            REGISTER_BENCHMARK(benchmarks, size, stream, instance);                \
         }
 
 inline void add_sort_keys_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
                                      hipStream_t                                   stream,
-                                     size_t                                        size)
+                                     size_t                                        size,
+                                     const std::vector<sort_key_distribution>&     distributions)
 {
     CREATE_RADIX_SORT_BENCHMARK(int)
     CREATE_RADIX_SORT_BENCHMARK(float)
@@ -392,11 +454,14 @@ inline void add_sort_keys_benchmarks(std::vector<benchmark::internal::Benchmark*
     CREATE_RADIX_SORT_BENCHMARK(uint8_t)
     CREATE_RADIX_SORT_BENCHMARK(rocprim::half)
     CREATE_RADIX_SORT_BENCHMARK(short)
+
+    CREATE_RADIX_SORT_BENCHMARK(int, rocprim::empty_type, write_combining_radix_sort_config<int>)
 }
 
 inline void add_sort_pairs_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
                                       hipStream_t                                   stream,
-                                      size_t                                        size)
+                                      size_t                                        size,
+                                      const std::vector<sort_key_distribution>&     distributions)
 {
     using custom_float2  = custom_type<float, float>;
     using custom_double2 = custom_type<double, double>;
@@ -417,6 +482,24 @@ inline void add_sort_pairs_benchmarks(std::vector<benchmark::internal::Benchmark
     CREATE_RADIX_SORT_BENCHMARK(int8_t, int8_t)
     CREATE_RADIX_SORT_BENCHMARK(uint8_t, uint8_t)
     CREATE_RADIX_SORT_BENCHMARK(rocprim::half, rocprim::half)
+
+    CREATE_RADIX_SORT_BENCHMARK(int, float, write_combining_radix_sort_config<int, float>)
+
+    // The crossover of moving large values with the keys and gathering them once
+    using custom_double4 = custom_type<custom_double2, custom_double2>;
+    using custom_double8 = custom_type<custom_double4, custom_double4>;
+    CREATE_RADIX_SORT_BENCHMARK(int, custom_double2, direct_radix_sort_config<int, custom_double2>)
+    CREATE_RADIX_SORT_BENCHMARK(int,
+                                custom_double2,
+                                indirect_radix_sort_config<int, custom_double2>)
+    CREATE_RADIX_SORT_BENCHMARK(int, custom_double4, direct_radix_sort_config<int, custom_double4>)
+    CREATE_RADIX_SORT_BENCHMARK(int,
+                                custom_double4,
+                                indirect_radix_sort_config<int, custom_double4>)
+    CREATE_RADIX_SORT_BENCHMARK(int, custom_double8, direct_radix_sort_config<int, custom_double8>)
+    CREATE_RADIX_SORT_BENCHMARK(int,
+                                custom_double8,
+                                indirect_radix_sort_config<int, custom_double8>)
 }
 
 #endif // BENCHMARK_CONFIG_TUNING
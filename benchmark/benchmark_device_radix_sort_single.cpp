@@ -54,6 +54,13 @@ int main(int argc, char *argv[])
                              "parallel_instances",
                              1,
                              "total parallel instances");
+#else
+    parser.set_optional<std::string>("distribution",
+                                     "distribution",
+                                     "all",
+                                     "key distributions: all or a comma separated list of "
+                                     "uniform, sorted, reverse_sorted, nearly_sorted, "
+                                     "few_unique, zipf, low_entropy, equal_high_bits");
 #endif
     parser.run_and_exit_if_error();
 
@@ -82,8 +89,10 @@ int main(int argc, char *argv[])
     benchmark::AddCustomContext("autotune_config_pattern",
                                 device_radix_sort_benchmark<>::get_name_pattern().c_str());
 #else // BENCHMARK_CONFIG_TUNING
-    add_sort_keys_benchmarks(benchmarks, stream, size);
-    add_sort_pairs_benchmarks(benchmarks, stream, size);
+    const std::vector<sort_key_distribution> distributions
+        = parse_sort_key_distributions(parser.get<std::string>("distribution"));
+    add_sort_keys_benchmarks(benchmarks, stream, size, distributions);
+    add_sort_pairs_benchmarks(benchmarks, stream, size, distributions);
 #endif // BENCHMARK_CONFIG_TUNING
 
     // Use manual timing
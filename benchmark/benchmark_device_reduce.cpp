@@ -20,8 +20,11 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include <chrono>
 #include <cstddef>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 // Google Benchmark
 #include <benchmark/benchmark.h>
@@ -48,6 +51,194 @@ const size_t DEFAULT_N = 1024 * 1024 * 128;
         REGISTER_BENCHMARK(benchmarks, size, stream, instance); \
     }
 
+// Cost of the bitwise-reproducible sum compared to device_reduce<T, default_config>
+template<typename T>
+struct device_deterministic_reduce_benchmark : public config_autotune_interface
+{
+    std::string name() const override
+    {
+        return std::string("device_deterministic_reduce<" + std::string(Traits<T>::name())
+                           + ", default_config>");
+    }
+
+    static constexpr unsigned int batch_size  = 10;
+    static constexpr unsigned int warmup_size = 5;
+
+    void run(benchmark::State& state, size_t size, const hipStream_t stream) const override
+    {
+        std::vector<T> input = get_random_data<T>(size, T(-1000), T(1000));
+
+        T* d_input;
+        T* d_output;
+        HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&d_input), size * sizeof(T)));
+        HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&d_output), sizeof(T)));
+        HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        // Allocate temporary storage memory
+        size_t temp_storage_size_bytes;
+        void*  d_temp_storage = nullptr;
+        // Get size of d_temp_storage
+        HIP_CHECK(rocprim::deterministic_reduce(d_temp_storage,
+                                                temp_storage_size_bytes,
+                                                d_input,
+                                                d_output,
+                                                size,
+                                                stream));
+        HIP_CHECK(hipMalloc(&d_temp_storage, temp_storage_size_bytes));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        // Warm-up
+        for(size_t i = 0; i < warmup_size; i++)
+        {
+            HIP_CHECK(rocprim::deterministic_reduce(d_temp_storage,
+                                                    temp_storage_size_bytes,
+                                                    d_input,
+                                                    d_output,
+                                                    size,
+                                                    stream));
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        device_energy_meter energy_meter;
+        for(auto _ : state)
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+
+            for(size_t i = 0; i < batch_size; i++)
+            {
+                HIP_CHECK(rocprim::deterministic_reduce(d_temp_storage,
+                                                        temp_storage_size_bytes,
+                                                        d_input,
+                                                        d_output,
+                                                        size,
+                                                        stream));
+            }
+            HIP_CHECK(hipStreamSynchronize(stream));
+
+            auto end = std::chrono::high_resolution_clock::now();
+            auto elapsed_seconds
+                = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+            state.SetIterationTime(elapsed_seconds.count());
+        }
+        state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
+        state.SetItemsProcessed(state.iterations() * batch_size * size);
+        add_bandwidth_counters(state, batch_size * size, sizeof(T));
+        energy_meter.add_counters(state, batch_size * size);
+
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_output));
+        HIP_CHECK(hipFree(d_temp_storage));
+    }
+};
+
+#define CREATE_DETERMINISTIC_BENCHMARK(T)                        \
+    {                                                            \
+        const device_deterministic_reduce_benchmark<T> instance; \
+        REGISTER_BENCHMARK(benchmarks, size, stream, instance);  \
+    }
+
+// Sum of squares, the squares are accumulated in float for floating-point inputs and in int for
+// integral inputs
+template<typename T>
+struct square_op
+{
+    using result_type = typename std::conditional<std::is_integral<T>::value, int, float>::type;
+
+    ROCPRIM_HOST_DEVICE
+    result_type operator()(const T value) const
+    {
+        const result_type x = static_cast<result_type>(value);
+        return x * x;
+    }
+};
+
+// transform_reduce loads the input pointer as vectors and squares the items in registers
+template<typename T>
+struct device_transform_reduce_benchmark : public config_autotune_interface
+{
+    using result_type = typename square_op<T>::result_type;
+
+    std::string name() const override
+    {
+        return std::string("device_transform_reduce<" + std::string(Traits<T>::name())
+                           + ", square, default_config>");
+    }
+
+    static constexpr unsigned int batch_size  = 10;
+    static constexpr unsigned int warmup_size = 5;
+
+    void run(benchmark::State& state, size_t size, const hipStream_t stream) const override
+    {
+        std::vector<T> input = get_random_data<T>(size, T(-10), T(10));
+
+        T*           d_input;
+        result_type* d_output;
+        HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&d_input), size * sizeof(T)));
+        HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&d_output), sizeof(result_type)));
+        HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        auto dispatch = [&](void* d_temp_storage, size_t& temp_storage_size_bytes)
+        {
+            return rocprim::transform_reduce(d_temp_storage,
+                                             temp_storage_size_bytes,
+                                             d_input,
+                                             d_output,
+                                             result_type(0),
+                                             size,
+                                             rocprim::plus<result_type>(),
+                                             square_op<T>(),
+                                             stream);
+        };
+
+        // Allocate temporary storage memory
+        size_t temp_storage_size_bytes;
+        void*  d_temp_storage = nullptr;
+        HIP_CHECK(dispatch(d_temp_storage, temp_storage_size_bytes));
+        HIP_CHECK(hipMalloc(&d_temp_storage, temp_storage_size_bytes));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        // Warm-up
+        for(size_t i = 0; i < warmup_size; i++)
+        {
+            HIP_CHECK(dispatch(d_temp_storage, temp_storage_size_bytes));
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        device_energy_meter energy_meter;
+        for(auto _ : state)
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+
+            for(size_t i = 0; i < batch_size; i++)
+            {
+                HIP_CHECK(dispatch(d_temp_storage, temp_storage_size_bytes));
+            }
+            HIP_CHECK(hipStreamSynchronize(stream));
+
+            auto end = std::chrono::high_resolution_clock::now();
+            auto elapsed_seconds
+                = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+            state.SetIterationTime(elapsed_seconds.count());
+        }
+        state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
+        state.SetItemsProcessed(state.iterations() * batch_size * size);
+        add_bandwidth_counters(state, batch_size * size, sizeof(T));
+        energy_meter.add_counters(state, batch_size * size);
+
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_output));
+        HIP_CHECK(hipFree(d_temp_storage));
+    }
+};
+
+#define CREATE_TRANSFORM_BENCHMARK(T)                           \
+    {                                                           \
+        const device_transform_reduce_benchmark<T> instance;    \
+        REGISTER_BENCHMARK(benchmarks, size, stream, instance); \
+    }
+
 int main(int argc, char *argv[])
 {
     cli::Parser parser(argc, argv);
@@ -99,10 +290,14 @@ int main(int argc, char *argv[])
 
     CREATE_BENCHMARK(float, rocprim::plus<float>)
     CREATE_BENCHMARK(double, rocprim::plus<double>)
+    CREATE_DETERMINISTIC_BENCHMARK(float)
+    CREATE_DETERMINISTIC_BENCHMARK(double)
 
     CREATE_BENCHMARK(int8_t, rocprim::plus<int8_t>)
     CREATE_BENCHMARK(uint8_t, rocprim::plus<uint8_t>)
     CREATE_BENCHMARK(rocprim::half, rocprim::plus<rocprim::half>)
+    CREATE_TRANSFORM_BENCHMARK(int8_t)
+    CREATE_TRANSFORM_BENCHMARK(rocprim::half)
 
     CREATE_BENCHMARK(custom_float2, rocprim::plus<custom_float2>)
     CREATE_BENCHMARK(custom_double2, rocprim::plus<custom_double2>)
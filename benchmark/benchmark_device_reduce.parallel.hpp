@@ -119,6 +119,7 @@ struct device_reduce_benchmark : public config_autotune_interface
         }
         HIP_CHECK(hipDeviceSynchronize());
 
+        device_energy_meter energy_meter;
         for(auto _ : state)
         {
             auto start = std::chrono::high_resolution_clock::now();
@@ -142,6 +143,8 @@ struct device_reduce_benchmark : public config_autotune_interface
         }
         state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
         state.SetItemsProcessed(state.iterations() * batch_size * size);
+        add_bandwidth_counters(state, batch_size * size, sizeof(T));
+        energy_meter.add_counters(state, batch_size * size);
 
         HIP_CHECK(hipFree(d_input));
         HIP_CHECK(hipFree(d_output));
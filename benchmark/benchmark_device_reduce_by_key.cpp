@@ -32,6 +32,7 @@
 // CmdParser
 #include "cmdparser.hpp"
 #include "benchmark_utils.hpp"
+#include "benchmark_device_reduce_by_key.parallel.hpp"
 
 // HIP API
 #include <hip/hip_runtime.h>
@@ -139,6 +140,7 @@ void run_benchmark(benchmark::State& state, size_t max_length, hipStream_t strea
     }
     HIP_CHECK(hipDeviceSynchronize());
 
+    device_energy_meter energy_meter;
     for (auto _ : state)
     {
         auto start = std::chrono::high_resolution_clock::now();
@@ -165,6 +167,8 @@ void run_benchmark(benchmark::State& state, size_t max_length, hipStream_t strea
     }
     state.SetBytesProcessed(state.iterations() * batch_size * size * (sizeof(key_type) + sizeof(value_type)));
     state.SetItemsProcessed(state.iterations() * batch_size * size);
+    add_bandwidth_counters(state, batch_size * size, sizeof(key_type) + sizeof(value_type));
+    energy_meter.add_counters(state, batch_size * size);
 
     HIP_CHECK(hipFree(d_temporary_storage));
     HIP_CHECK(hipFree(d_keys_input));
@@ -211,11 +215,147 @@ void add_benchmarks(size_t max_length,
     benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
 }
 
+// Reductions by key of size / stream_count items each on stream_count streams at the same time,
+// the look-back of the reductions waits for the carry-outs of the preceding tiles with Backoff.
+template<rocprim::lookback_backoff Backoff>
+void run_backoff_benchmark(benchmark::State&  state,
+                           const size_t       size,
+                           const unsigned int stream_count)
+{
+    using key_type   = int;
+    using value_type = float;
+    using config     = rocprim::reduce_by_key_config_v2<
+        256,
+        15,
+        rocprim::block_load_method::block_load_transpose,
+        rocprim::block_load_method::block_load_transpose,
+        rocprim::block_scan_algorithm::using_warp_scan,
+        1,
+        ROCPRIM_GRID_SIZE_LIMIT,
+        Backoff>;
+
+    const size_t instance_size = size / stream_count;
+    const size_t items         = instance_size * stream_count;
+
+    // Runs of 1 to 100 equal keys
+    std::vector<key_type>  keys_input(items);
+    const std::vector<int> lengths = get_random_data<int>(items, 1, 100);
+    size_t                 offset  = 0;
+    for(size_t i = 0; offset < items; i++)
+    {
+        const size_t end = std::min(items, offset + lengths[i]);
+        std::fill(keys_input.begin() + offset, keys_input.begin() + end, static_cast<key_type>(i));
+        offset = end;
+    }
+    const std::vector<value_type> values_input = get_random_data<value_type>(items, 0, 1000);
+
+    key_type*     d_keys_input;
+    value_type*   d_values_input;
+    key_type*     d_unique_output;
+    value_type*   d_aggregates_output;
+    unsigned int* d_unique_count_output;
+    HIP_CHECK(hipMalloc(&d_keys_input, items * sizeof(key_type)));
+    HIP_CHECK(hipMalloc(&d_values_input, items * sizeof(value_type)));
+    HIP_CHECK(hipMalloc(&d_unique_output, items * sizeof(key_type)));
+    HIP_CHECK(hipMalloc(&d_aggregates_output, items * sizeof(value_type)));
+    HIP_CHECK(hipMalloc(&d_unique_count_output, stream_count * sizeof(unsigned int)));
+    HIP_CHECK(hipMemcpy(d_keys_input,
+                        keys_input.data(),
+                        items * sizeof(key_type),
+                        hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemcpy(d_values_input,
+                        values_input.data(),
+                        items * sizeof(value_type),
+                        hipMemcpyHostToDevice));
+
+    rocprim::plus<value_type>   reduce_op;
+    rocprim::equal_to<key_type> key_compare_op;
+
+    size_t instance_storage_bytes = 0;
+    HIP_CHECK(rocprim::reduce_by_key<config>(nullptr,
+                                             instance_storage_bytes,
+                                             d_keys_input,
+                                             d_values_input,
+                                             instance_size,
+                                             d_unique_output,
+                                             d_aggregates_output,
+                                             d_unique_count_output,
+                                             reduce_op,
+                                             key_compare_op));
+    instance_storage_bytes = rocprim::detail::align_size(instance_storage_bytes);
+    char* d_temporary_storage;
+    HIP_CHECK(hipMalloc(&d_temporary_storage, instance_storage_bytes * stream_count));
+
+    run_concurrent_streams_benchmark(
+        state,
+        stream_count,
+        [&](const unsigned int instance, const hipStream_t stream)
+        {
+            const size_t instance_offset = instance * instance_size;
+            size_t       storage_bytes   = instance_storage_bytes;
+            return rocprim::reduce_by_key<config>(d_temporary_storage
+                                                      + instance * instance_storage_bytes,
+                                                  storage_bytes,
+                                                  d_keys_input + instance_offset,
+                                                  d_values_input + instance_offset,
+                                                  instance_size,
+                                                  d_unique_output + instance_offset,
+                                                  d_aggregates_output + instance_offset,
+                                                  d_unique_count_output + instance,
+                                                  reduce_op,
+                                                  key_compare_op,
+                                                  stream);
+        });
+
+    state.SetBytesProcessed(state.iterations() * items * (sizeof(key_type) + sizeof(value_type)));
+    state.SetItemsProcessed(state.iterations() * items);
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_keys_input));
+    HIP_CHECK(hipFree(d_values_input));
+    HIP_CHECK(hipFree(d_unique_output));
+    HIP_CHECK(hipFree(d_aggregates_output));
+    HIP_CHECK(hipFree(d_unique_count_output));
+}
+
+#define CREATE_BACKOFF_BENCHMARK(BACKOFF, STREAMS)                          \
+    benchmarks.push_back(benchmark::RegisterBenchmark(                    \
+        (std::string("reduce_by_key_backoff<int, float, ")                \
+         + get_lookback_backoff_name(BACKOFF) + ">(streams "              \
+         + std::to_string(STREAMS) + ")")                                 \
+            .c_str(),                                                     \
+        run_backoff_benchmark<BACKOFF>,                                   \
+        size,                                                             \
+        STREAMS))
+
+void add_backoff_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                            size_t                                        size)
+{
+    for(const unsigned int streams : {1u, 4u})
+    {
+        CREATE_BACKOFF_BENCHMARK(rocprim::lookback_backoff::automatic, streams);
+        CREATE_BACKOFF_BENCHMARK(rocprim::lookback_backoff::spin, streams);
+        CREATE_BACKOFF_BENCHMARK(rocprim::lookback_backoff::exponential_sleep, streams);
+        CREATE_BACKOFF_BENCHMARK(rocprim::lookback_backoff::bounded_sleep, streams);
+    }
+}
+
 int main(int argc, char *argv[])
 {
     cli::Parser parser(argc, argv);
     parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of values");
     parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+#ifdef BENCHMARK_CONFIG_TUNING
+    // optionally run an evenly split subset of benchmarks, when making multiple program invocations
+    parser.set_optional<int>("parallel_instance",
+                             "parallel_instance",
+                             0,
+                             "parallel instance index");
+    parser.set_optional<int>("parallel_instances",
+                             "parallel_instances",
+                             1,
+                             "total parallel instances");
+#endif
     parser.run_and_exit_if_error();
 
     // Parse argv
@@ -232,8 +372,21 @@ int main(int argc, char *argv[])
 
     // Add benchmarks
     std::vector<benchmark::internal::Benchmark*> benchmarks;
+#ifdef BENCHMARK_CONFIG_TUNING
+    const int parallel_instance = parser.get<int>("parallel_instance");
+    const int parallel_instances = parser.get<int>("parallel_instances");
+    config_autotune_register::register_benchmark_subset(benchmarks,
+                                                        parallel_instance,
+                                                        parallel_instances,
+                                                        size,
+                                                        stream);
+    benchmark::AddCustomContext("autotune_config_pattern",
+                                device_reduce_by_key_benchmark<>::get_name_pattern().c_str());
+#else
     add_benchmarks(1000, benchmarks, stream, size);
     add_benchmarks(10, benchmarks, stream, size);
+    add_backoff_benchmarks(benchmarks, size);
+#endif
 
     // Use manual timing
     for(auto& b : benchmarks)
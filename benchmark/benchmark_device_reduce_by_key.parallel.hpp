@@ -0,0 +1,172 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef ROCPRIM_BENCHMARK_DEVICE_REDUCE_BY_KEY_PARALLEL_HPP_
+#define ROCPRIM_BENCHMARK_DEVICE_REDUCE_BY_KEY_PARALLEL_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// HIP API
+#include <hip/hip_runtime.h>
+
+// rocPRIM HIP API
+#include <rocprim/rocprim.hpp>
+
+#include "benchmark_utils.hpp"
+
+template<typename Key    = int,
+         typename Value  = float,
+         typename Config = rocprim::detail::
+             default_reduce_by_key_config<ROCPRIM_TARGET_ARCH, Key, Value>>
+struct device_reduce_by_key_benchmark : public config_autotune_interface
+{
+    static std::string get_name_pattern()
+    {
+        return R"regex((?P<algo>\S*?)<)regex"
+               R"regex((?P<key_type>\S*),\s*(?P<value_type>\S*),\s*reduce_by_key_config_v2<)regex"
+               R"regex(\s*(?P<block_size>[0-9]+),\s*(?P<items_per_thread>[0-9]+),)regex"
+               R"regex(\s*(?P<tiles_per_block>[0-9]+)>>)regex";
+    }
+
+    std::string name() const override
+    {
+        return std::string("device_reduce_by_key<" + std::string(Traits<Key>::name()) + ", "
+                           + std::string(Traits<Value>::name()) + ", reduce_by_key_config_v2<"
+                           + pad_string(std::to_string(Config::block_size), 3) + ", "
+                           + pad_string(std::to_string(Config::items_per_thread), 2) + ", "
+                           + std::to_string(Config::tiles_per_block) + ">>");
+    }
+
+    static constexpr unsigned int batch_size  = 10;
+    static constexpr unsigned int warmup_size = 5;
+    // The keys are runs of random lengths in [1, max_segment_length]
+    static constexpr size_t max_segment_length = 1000;
+
+    void run(benchmark::State& state, size_t size, const hipStream_t stream) const override
+    {
+        using key_type   = Key;
+        using value_type = Value;
+
+        // Consecutive runs have different keys, the keys are small enough to be represented
+        // exactly by all key types
+        std::vector<key_type> keys_input(size);
+        const std::vector<size_t> run_lengths
+            = get_random_data<size_t>(100000, 1, max_segment_length);
+        unsigned int unique_count = 0;
+        for(size_t offset = 0; offset < size; unique_count++)
+        {
+            const size_t length = run_lengths[unique_count % run_lengths.size()];
+            const size_t end    = std::min(size, offset + length);
+            std::fill(keys_input.begin() + offset,
+                      keys_input.begin() + end,
+                      key_type(static_cast<int>(unique_count % 1024)));
+            offset = end;
+        }
+        const std::vector<value_type> values_input
+            = get_random_data<value_type>(size, value_type(0), value_type(100));
+
+        key_type*     d_keys_input;
+        value_type*   d_values_input;
+        key_type*     d_unique_output;
+        value_type*   d_aggregates_output;
+        unsigned int* d_unique_count_output;
+        HIP_CHECK(hipMalloc(&d_keys_input, size * sizeof(key_type)));
+        HIP_CHECK(hipMalloc(&d_values_input, size * sizeof(value_type)));
+        HIP_CHECK(hipMalloc(&d_unique_output, unique_count * sizeof(key_type)));
+        HIP_CHECK(hipMalloc(&d_aggregates_output, unique_count * sizeof(value_type)));
+        HIP_CHECK(hipMalloc(&d_unique_count_output, sizeof(unsigned int)));
+        HIP_CHECK(hipMemcpy(d_keys_input,
+                            keys_input.data(),
+                            size * sizeof(key_type),
+                            hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_values_input,
+                            values_input.data(),
+                            size * sizeof(value_type),
+                            hipMemcpyHostToDevice));
+
+        auto dispatch = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+        {
+            return rocprim::reduce_by_key<Config>(d_temporary_storage,
+                                                  temporary_storage_bytes,
+                                                  d_keys_input,
+                                                  d_values_input,
+                                                  size,
+                                                  d_unique_output,
+                                                  d_aggregates_output,
+                                                  d_unique_count_output,
+                                                  rocprim::plus<value_type>(),
+                                                  rocprim::equal_to<key_type>(),
+                                                  stream);
+        };
+
+        void*  d_temporary_storage     = nullptr;
+        size_t temporary_storage_bytes = 0;
+        HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+        HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        // Warm-up
+        for(size_t i = 0; i < warmup_size; i++)
+        {
+            HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        device_energy_meter energy_meter;
+        for(auto _ : state)
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+
+            for(size_t i = 0; i < batch_size; i++)
+            {
+                HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+            }
+            HIP_CHECK(hipStreamSynchronize(stream));
+
+            auto end = std::chrono::high_resolution_clock::now();
+            auto elapsed_seconds
+                = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+            state.SetIterationTime(elapsed_seconds.count());
+        }
+        state.SetBytesProcessed(state.iterations() * batch_size * size
+                                * (sizeof(key_type) + sizeof(value_type)));
+        state.SetItemsProcessed(state.iterations() * batch_size * size);
+        add_bandwidth_counters(state, batch_size * size, sizeof(key_type) + sizeof(value_type));
+        energy_meter.add_counters(state, batch_size * size);
+
+        HIP_CHECK(hipFree(d_temporary_storage));
+        HIP_CHECK(hipFree(d_keys_input));
+        HIP_CHECK(hipFree(d_values_input));
+        HIP_CHECK(hipFree(d_unique_output));
+        HIP_CHECK(hipFree(d_aggregates_output));
+        HIP_CHECK(hipFree(d_unique_count_output));
+    }
+};
+
+#endif // ROCPRIM_BENCHMARK_DEVICE_REDUCE_BY_KEY_PARALLEL_HPP_
@@ -117,6 +117,7 @@ void run_encode_benchmark(benchmark::State& state, size_t max_length, hipStream_
     HIP_CHECK(hipDeviceSynchronize());
 
     const unsigned int batch_size = 10;
+    device_energy_meter energy_meter;
     for (auto _ : state)
     {
         auto start = std::chrono::high_resolution_clock::now();
@@ -139,6 +140,8 @@ void run_encode_benchmark(benchmark::State& state, size_t max_length, hipStream_
     }
     state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(key_type));
     state.SetItemsProcessed(state.iterations() * batch_size * size);
+    add_bandwidth_counters(state, batch_size * size, sizeof(key_type));
+    energy_meter.add_counters(state, batch_size * size);
 
     HIP_CHECK(hipFree(d_temporary_storage));
     HIP_CHECK(hipFree(d_input));
@@ -220,6 +223,7 @@ void run_non_trivial_runs_benchmark(benchmark::State& state, size_t max_length,
     HIP_CHECK(hipDeviceSynchronize());
 
     const unsigned int batch_size = 10;
+    device_energy_meter energy_meter;
     for (auto _ : state)
     {
         auto start = std::chrono::high_resolution_clock::now();
@@ -242,6 +246,8 @@ void run_non_trivial_runs_benchmark(benchmark::State& state, size_t max_length,
     }
     state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(key_type));
     state.SetItemsProcessed(state.iterations() * batch_size * size);
+    add_bandwidth_counters(state, batch_size * size, sizeof(key_type));
+    energy_meter.add_counters(state, batch_size * size);
 
     HIP_CHECK(hipFree(d_temporary_storage));
     HIP_CHECK(hipFree(d_input));
@@ -22,6 +22,7 @@
 
 #include <cstddef>
 #include <string>
+#include <vector>
 
 // Google Benchmark
 #include <benchmark/benchmark.h>
@@ -42,6 +43,71 @@
 const size_t DEFAULT_N = 1024 * 1024 * 32;
 #endif
 
+// Inclusive scans of size / stream_count items each on stream_count streams at the same time,
+// the look-back of the scans waits for the prefixes of the preceding blocks with Backoff. The
+// scans contend for the compute units, so the look-back waits longer than when a scan runs alone.
+template<rocprim::lookback_backoff Backoff>
+void run_backoff_benchmark(benchmark::State&  state,
+                           const size_t       size,
+                           const unsigned int stream_count)
+{
+    using T      = int;
+    using config = rocprim::scan_config<256,
+                                        16,
+                                        true,
+                                        rocprim::block_load_method::block_load_transpose,
+                                        rocprim::block_store_method::block_store_transpose,
+                                        rocprim::block_scan_algorithm::using_warp_scan,
+                                        ROCPRIM_GRID_SIZE_LIMIT,
+                                        0,
+                                        Backoff>;
+
+    const size_t         instance_size = size / stream_count;
+    const std::vector<T> input         = get_random_data<T>(instance_size * stream_count, 1, 10);
+
+    T* d_input;
+    T* d_output;
+    HIP_CHECK(hipMalloc(&d_input, input.size() * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_output, input.size() * sizeof(T)));
+    HIP_CHECK(
+        hipMemcpy(d_input, input.data(), input.size() * sizeof(T), hipMemcpyHostToDevice));
+
+    size_t instance_storage_bytes = 0;
+    HIP_CHECK(rocprim::inclusive_scan<config>(nullptr,
+                                              instance_storage_bytes,
+                                              d_input,
+                                              d_output,
+                                              instance_size,
+                                              rocprim::plus<T>()));
+    instance_storage_bytes = rocprim::detail::align_size(instance_storage_bytes);
+    char* d_temporary_storage;
+    HIP_CHECK(hipMalloc(&d_temporary_storage, instance_storage_bytes * stream_count));
+
+    run_concurrent_streams_benchmark(
+        state,
+        stream_count,
+        [&](const unsigned int instance, const hipStream_t stream)
+        {
+            const size_t offset        = instance * instance_size;
+            size_t       storage_bytes = instance_storage_bytes;
+            return rocprim::inclusive_scan<config>(d_temporary_storage
+                                                       + instance * instance_storage_bytes,
+                                                   storage_bytes,
+                                                   d_input + offset,
+                                                   d_output + offset,
+                                                   instance_size,
+                                                   rocprim::plus<T>(),
+                                                   stream);
+        });
+
+    state.SetBytesProcessed(state.iterations() * input.size() * sizeof(T));
+    state.SetItemsProcessed(state.iterations() * input.size());
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipFree(d_temporary_storage));
+}
+
 #define CREATE_BY_KEY_BENCHMARK(EXCL, T, SCAN_OP, MSL)                     \
     {                                                                      \
         const device_scan_benchmark<true, EXCL, T, SCAN_OP, MSL> instance; \
@@ -59,6 +125,44 @@ const size_t DEFAULT_N = 1024 * 1024 * 32;
     CREATE_BY_KEY_BENCHMARK(EXCL, T, SCAN_OP, 4096)                    \
     CREATE_BY_KEY_BENCHMARK(EXCL, T, SCAN_OP, 65536)
 
+// Small tiles, the tile ids of the look-back are taken often. Compare with builds defining
+// ROCPRIM_ORDERED_BLOCK_ID_STRIPES=1 to measure the striped tile ids of multi-die devices.
+template<unsigned int ItemsPerThread>
+using small_tile_scan_config
+    = rocprim::scan_config<256,
+                           ItemsPerThread,
+                           true,
+                           rocprim::block_load_method::block_load_transpose,
+                           rocprim::block_store_method::block_store_transpose,
+                           rocprim::block_scan_algorithm::using_warp_scan>;
+
+#define CREATE_SMALL_TILE_BENCHMARK(IPT)                                           \
+    {                                                                            \
+        const device_scan_benchmark<false,                                       \
+                                    false,                                       \
+                                    int,                                         \
+                                    rocprim::plus<int>,                          \
+                                    1024,                                        \
+                                    small_tile_scan_config<IPT>>                 \
+            instance;                                                            \
+        REGISTER_BENCHMARK(benchmarks, size, stream, instance);                  \
+    }
+
+#define CREATE_BACKOFF_BENCHMARK(BACKOFF, STREAMS)                                      \
+    benchmarks.push_back(benchmark::RegisterBenchmark(                                \
+        (std::string("device_scan_backoff<int, ") + get_lookback_backoff_name(BACKOFF) \
+         + ">(streams " #STREAMS ")")                                                 \
+            .c_str(),                                                                 \
+        run_backoff_benchmark<BACKOFF>,                                               \
+        size,                                                                         \
+        STREAMS));
+
+#define CREATE_BACKOFF_BENCHMARKS(STREAMS)                                        \
+    CREATE_BACKOFF_BENCHMARK(rocprim::lookback_backoff::automatic, STREAMS)         \
+    CREATE_BACKOFF_BENCHMARK(rocprim::lookback_backoff::spin, STREAMS)              \
+    CREATE_BACKOFF_BENCHMARK(rocprim::lookback_backoff::exponential_sleep, STREAMS) \
+    CREATE_BACKOFF_BENCHMARK(rocprim::lookback_backoff::bounded_sleep, STREAMS)
+
 int main(int argc, char *argv[])
 {
     cli::Parser parser(argc, argv);
@@ -137,6 +241,13 @@ int main(int argc, char *argv[])
 
     CREATE_BENCHMARK(false, rocprim::half, rocprim::plus<rocprim::half>)
     CREATE_BENCHMARK(true, rocprim::half, rocprim::plus<rocprim::half>)
+
+    CREATE_SMALL_TILE_BENCHMARK(1)
+    CREATE_SMALL_TILE_BENCHMARK(2)
+    CREATE_SMALL_TILE_BENCHMARK(4)
+
+    CREATE_BACKOFF_BENCHMARKS(1)
+    CREATE_BACKOFF_BENCHMARKS(4)
 #endif
 
     // Use manual timing
@@ -43,7 +43,8 @@ template<bool ByKey                    = false,
          class T                       = int,
          class BinaryFunction          = rocprim::plus<T>,
          unsigned int MaxSegmentLength = 1024,
-         class Config = rocprim::detail::default_scan_config<ROCPRIM_TARGET_ARCH, T>>
+         class Config = rocprim::detail::default_scan_config<ROCPRIM_TARGET_ARCH, T>,
+         class Key    = int>
 struct device_scan_benchmark : public config_autotune_interface
 {
     static std::string get_name_pattern()
@@ -71,7 +72,7 @@ struct device_scan_benchmark : public config_autotune_interface
         using namespace std::string_literals;
         return std::string(
             "device_scan" + (ByKey ? "_by_key"s : ""s) + "<" + std::string(Traits<T>::name()) + ", "
-            + (ByKey ? (std::string(Traits<T>::name()) + ", ") : ""s)
+            + (ByKey ? (std::string(Traits<Key>::name()) + ", ") : ""s)
             + (Exclusive ? "exclusive"s : "inclusive"s) + ", "
             + (ByKey ? (pad_string(std::to_string(MaxSegmentLength), 5) + ", ") : ""s)
             + "scan_config<" + pad_string(std::to_string(Config::block_size), 3) + ", "
@@ -222,6 +223,7 @@ struct device_scan_benchmark : public config_autotune_interface
         HIP_CHECK(hipDeviceSynchronize());
 
         const unsigned int batch_size = 10;
+        device_energy_meter energy_meter;
         for(auto _ : state)
         {
             auto start = std::chrono::high_resolution_clock::now();
@@ -245,6 +247,8 @@ struct device_scan_benchmark : public config_autotune_interface
         }
         state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
         state.SetItemsProcessed(state.iterations() * batch_size * size);
+        add_bandwidth_counters(state, batch_size * size, 2 * sizeof(T));
+        energy_meter.add_counters(state, batch_size * size);
 
         HIP_CHECK(hipFree(d_input));
         HIP_CHECK(hipFree(d_output));
@@ -313,6 +317,7 @@ struct device_scan_benchmark : public config_autotune_interface
         HIP_CHECK(hipDeviceSynchronize());
 
         const unsigned int batch_size = 10;
+        device_energy_meter energy_meter;
         for(auto _ : state)
         {
             const auto start = std::chrono::high_resolution_clock::now();
@@ -340,6 +345,8 @@ struct device_scan_benchmark : public config_autotune_interface
         }
         state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
         state.SetItemsProcessed(state.iterations() * batch_size * size);
+        add_bandwidth_counters(state, batch_size * size, sizeof(K) + 2 * sizeof(T));
+        energy_meter.add_counters(state, batch_size * size);
 
         HIP_CHECK(hipFree(d_input));
         HIP_CHECK(hipFree(d_keys));
@@ -358,7 +365,7 @@ struct device_scan_benchmark : public config_autotune_interface
     auto do_run(benchmark::State& state, size_t size, const hipStream_t stream) const ->
         typename std::enable_if<by_key, void>::type
     {
-        run_benchmark_by_key<int, rocprim::equal_to<int>>(state, size, stream, BinaryFunction());
+        run_benchmark_by_key<Key, rocprim::equal_to<Key>>(state, size, stream, BinaryFunction());
     }
 
     void run(benchmark::State& state, size_t size, hipStream_t stream) const override
@@ -385,7 +392,7 @@ inline constexpr unsigned int get_max_items_per_thread(size_t bytes)
     }
 }
 
-template<typename T, bool ByKey, bool Excl>
+template<typename T, bool ByKey, bool Excl, typename Key = int>
 struct device_scan_benchmark_generator
 {
     template<rocprim::block_scan_algorithm BlockScanAlgorithm, typename index_range>
@@ -412,7 +419,8 @@ struct device_scan_benchmark_generator
                                                  true,
                                                  rocprim::block_load_method::block_load_transpose,
                                                  rocprim::block_store_method::block_store_transpose,
-                                                 BlockScanAlgorithm>>>());
+                                                 BlockScanAlgorithm>,
+                            Key>>());
                 }
             };
 
@@ -447,6 +455,11 @@ struct device_scan_benchmark_generator
     }
 };
 
+// The tuning benchmarks of scan_by_key, the types are in the order of the selection types
+template<typename Key, typename Value, bool Excl>
+using device_scan_by_key_benchmark_generator
+    = device_scan_benchmark_generator<Value, true, Excl, Key>;
+
 #endif // BENCHMARK_CONFIG_TUNING
 
 #endif // ROCPRIM_BENCHMARK_DEVICE_SCAN_PARALLEL_HPP_
@@ -0,0 +1,217 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Summed-area table of an image with rocprim::inclusive_scan_2d, compared with a 1D
+// rocprim::inclusive_scan of the same number of items, which reads and writes the items once too.
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+// Google Benchmark
+#include "benchmark/benchmark.h"
+// CmdParser
+#include "cmdparser.hpp"
+#include "benchmark_utils.hpp"
+
+// HIP API
+#include <hip/hip_runtime.h>
+
+// rocPRIM
+#include <rocprim/rocprim.hpp>
+
+#ifndef DEFAULT_WIDTH
+const unsigned int DEFAULT_WIDTH = 8192;
+#endif
+
+#ifndef DEFAULT_HEIGHT
+const unsigned int DEFAULT_HEIGHT = 8192;
+#endif
+
+const unsigned int batch_size  = 10;
+const unsigned int warmup_size = 5;
+
+// Run must be callable as hipError_t(void* temporary_storage, size_t& storage_size, T* input,
+// T* output)
+template<class T, class Run>
+void run_scan_benchmark(benchmark::State&  state,
+                        const unsigned int width,
+                        const unsigned int height,
+                        const hipStream_t  stream,
+                        Run                run)
+{
+    const size_t   size  = static_cast<size_t>(width) * height;
+    std::vector<T> input = get_random_data<T>(size, T(0), T(1));
+
+    T* d_input;
+    T* d_output;
+    HIP_CHECK(hipMalloc(&d_input, size * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_output, size * sizeof(T)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+    size_t temporary_storage_bytes = 0;
+    HIP_CHECK(run(nullptr, temporary_storage_bytes, d_input, d_output));
+    void* d_temporary_storage;
+    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Warm-up
+    for(size_t i = 0; i < warmup_size; i++)
+    {
+        HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes, d_input, d_output));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    device_energy_meter energy_meter;
+    for(auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(size_t i = 0; i < batch_size; i++)
+        {
+            HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes, d_input, d_output));
+        }
+        HIP_CHECK(hipStreamSynchronize(stream));
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds
+            = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
+    state.SetItemsProcessed(state.iterations() * batch_size * size);
+    add_bandwidth_counters(state, batch_size * size, 2 * sizeof(T));
+    energy_meter.add_counters(state, batch_size * size);
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
+
+template<class T>
+void run_scan_2d_benchmark(benchmark::State&  state,
+                           const unsigned int width,
+                           const unsigned int height,
+                           const hipStream_t  stream)
+{
+    run_scan_benchmark<T>(state,
+                          width,
+                          height,
+                          stream,
+                          [&](void* temporary_storage, size_t& storage_size, T* input, T* output)
+                          {
+                              return rocprim::inclusive_scan_2d(temporary_storage,
+                                                                storage_size,
+                                                                input,
+                                                                output,
+                                                                width,
+                                                                height,
+                                                                rocprim::plus<T>(),
+                                                                stream);
+                          });
+}
+
+template<class T>
+void run_scan_1d_benchmark(benchmark::State&  state,
+                           const unsigned int width,
+                           const unsigned int height,
+                           const hipStream_t  stream)
+{
+    const size_t size = static_cast<size_t>(width) * height;
+    run_scan_benchmark<T>(state,
+                          width,
+                          height,
+                          stream,
+                          [&](void* temporary_storage, size_t& storage_size, T* input, T* output)
+                          {
+                              return rocprim::inclusive_scan(temporary_storage,
+                                                             storage_size,
+                                                             input,
+                                                             output,
+                                                             size,
+                                                             rocprim::plus<T>(),
+                                                             stream);
+                          });
+}
+
+#define CREATE_BENCHMARK(T)                                        \
+    benchmark::RegisterBenchmark("inclusive_scan_2d<" #T ">",      \
+                                 run_scan_2d_benchmark<T>,         \
+                                 width,                            \
+                                 height,                           \
+                                 stream),                          \
+        benchmark::RegisterBenchmark("inclusive_scan_1d<" #T ">",  \
+                                     run_scan_1d_benchmark<T>,     \
+                                     width,                        \
+                                     height,                       \
+                                     stream)
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<unsigned int>("width", "width", DEFAULT_WIDTH, "number of columns");
+    parser.set_optional<unsigned int>("height", "height", DEFAULT_HEIGHT, "number of rows");
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const unsigned int width  = parser.get<unsigned int>("width");
+    const unsigned int height = parser.get<unsigned int>("height");
+    const int          trials = parser.get<int>("trials");
+
+    // HIP
+    hipStream_t stream = 0; // default
+
+    // Benchmark info
+    add_common_benchmark_info();
+    benchmark::AddCustomContext("width", std::to_string(width));
+    benchmark::AddCustomContext("height", std::to_string(height));
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks = {
+        CREATE_BENCHMARK(int),
+        CREATE_BENCHMARK(float),
+        CREATE_BENCHMARK(double),
+    };
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+
+    return 0;
+}
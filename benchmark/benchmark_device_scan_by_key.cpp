@@ -0,0 +1,337 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <locale>
+#include <string>
+#include <limits>
+
+// Google Benchmark
+#include "benchmark/benchmark.h"
+// CmdParser
+#include "cmdparser.hpp"
+#include "benchmark_utils.hpp"
+#include "benchmark_device_scan.parallel.hpp"
+
+// HIP API
+#include <hip/hip_runtime.h>
+
+// rocPRIM
+#include <rocprim/rocprim.hpp>
+
+#ifndef DEFAULT_N
+const size_t DEFAULT_N = 1024 * 1024 * 32;
+#endif
+
+namespace rp = rocprim;
+
+const unsigned int batch_size = 10;
+const unsigned int warmup_size = 5;
+
+template<bool Exclusive, class Key, class Value>
+auto run_scan_by_key(void * temporary_storage,
+                     size_t& storage_size,
+                     Key * keys_input,
+                     Value * values_input,
+                     Value * values_output,
+                     const size_t size,
+                     hipStream_t stream)
+    -> typename std::enable_if<Exclusive, hipError_t>::type
+{
+    return rp::exclusive_scan_by_key(
+        temporary_storage, storage_size,
+        keys_input, values_input, values_output,
+        Value(), size,
+        rp::plus<Value>(), rp::equal_to<Key>(),
+        stream
+    );
+}
+
+template<bool Exclusive, class Key, class Value>
+auto run_scan_by_key(void * temporary_storage,
+                     size_t& storage_size,
+                     Key * keys_input,
+                     Value * values_input,
+                     Value * values_output,
+                     const size_t size,
+                     hipStream_t stream)
+    -> typename std::enable_if<!Exclusive, hipError_t>::type
+{
+    return rp::inclusive_scan_by_key(
+        temporary_storage, storage_size,
+        keys_input, values_input, values_output,
+        size,
+        rp::plus<Value>(), rp::equal_to<Key>(),
+        stream
+    );
+}
+
+template<bool Exclusive, class Key, class Value>
+void run_benchmark(benchmark::State& state,
+                   size_t max_length,
+                   segment_length_distribution distribution,
+                   hipStream_t stream,
+                   size_t size)
+{
+    using key_type = Key;
+    using value_type = Value;
+
+    // Generate data
+    std::vector<key_type> keys_input(size);
+
+    if(distribution == segment_length_distribution::uniform)
+    {
+        unsigned int unique_count = 0;
+        std::vector<size_t> key_counts = get_random_data<size_t>(100000, 1, max_length);
+        size_t offset = 0;
+        while(offset < size)
+        {
+            const size_t key_count = key_counts[unique_count % key_counts.size()];
+            const size_t end = std::min(size, offset + key_count);
+            for(size_t i = offset; i < end; i++)
+            {
+                keys_input[i] = unique_count;
+            }
+
+            unique_count++;
+            offset += key_count;
+        }
+    }
+    else
+    {
+        // The skewed distributions keep the mean length of the uniform runs of keys
+        const double mean_length = (1.0 + max_length) / 2.0;
+        const size_t segments = std::max<size_t>(1, std::round(size / mean_length));
+        const std::vector<size_t> offsets
+            = get_segment_offsets<size_t>(size, segments, distribution, std::random_device{}());
+        for(size_t segment = 0; segment < segments; segment++)
+        {
+            std::fill(keys_input.begin() + offsets[segment],
+                      keys_input.begin() + offsets[segment + 1],
+                      static_cast<key_type>(segment));
+        }
+    }
+
+    std::vector<value_type> values_input(size, value_type(1));
+
+    key_type * d_keys_input;
+    HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&d_keys_input), size * sizeof(key_type)));
+    HIP_CHECK(
+        hipMemcpy(
+            d_keys_input, keys_input.data(),
+            size * sizeof(key_type),
+            hipMemcpyHostToDevice
+        )
+    );
+
+    value_type * d_values_input;
+    HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&d_values_input), size * sizeof(value_type)));
+    HIP_CHECK(
+        hipMemcpy(
+            d_values_input, values_input.data(),
+            size * sizeof(value_type),
+            hipMemcpyHostToDevice
+        )
+    );
+
+    value_type * d_values_output;
+    HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&d_values_output), size * sizeof(value_type)));
+
+    void * d_temporary_storage = nullptr;
+    size_t temporary_storage_bytes = 0;
+
+    HIP_CHECK((
+        run_scan_by_key<Exclusive>(
+            nullptr, temporary_storage_bytes,
+            d_keys_input, d_values_input, d_values_output,
+            size, stream
+        )
+    ));
+
+    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Warm-up
+    for(size_t i = 0; i < warmup_size; i++)
+    {
+        HIP_CHECK((
+            run_scan_by_key<Exclusive>(
+                d_temporary_storage, temporary_storage_bytes,
+                d_keys_input, d_values_input, d_values_output,
+                size, stream
+            )
+        ));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    device_energy_meter energy_meter;
+    for (auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(size_t i = 0; i < batch_size; i++)
+        {
+            HIP_CHECK((
+                run_scan_by_key<Exclusive>(
+                    d_temporary_storage, temporary_storage_bytes,
+                    d_keys_input, d_values_input, d_values_output,
+                    size, stream
+                )
+            ));
+        }
+        HIP_CHECK(hipStreamSynchronize(stream));
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds =
+            std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    state.SetBytesProcessed(state.iterations() * batch_size * size * (sizeof(key_type) + sizeof(value_type)));
+    state.SetItemsProcessed(state.iterations() * batch_size * size);
+    add_bandwidth_counters(state, batch_size * size, sizeof(key_type) + 2 * sizeof(value_type));
+    energy_meter.add_counters(state, batch_size * size);
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_keys_input));
+    HIP_CHECK(hipFree(d_values_input));
+    HIP_CHECK(hipFree(d_values_output));
+}
+
+#define CREATE_BENCHMARK(Exclusive, Key, Value) \
+benchmark::RegisterBenchmark( \
+    (std::string(Exclusive ? "exclusive" : "inclusive") + "_scan_by_key" + \
+        "<" #Key ", " #Value ">" + \
+        "([1, " + std::to_string(max_length) + "])" + \
+        get_segment_length_distribution_suffix(distribution) \
+    ).c_str(), \
+    run_benchmark<Exclusive, Key, Value>, \
+    max_length, distribution, stream, size \
+)
+
+void add_benchmarks(size_t max_length,
+                    segment_length_distribution distribution,
+                    std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                    hipStream_t stream,
+                    size_t size)
+{
+    // 8, 16 and 32-byte values use the look-back state of wide values
+    using custom_float2 = custom_type<float, float>;
+    using custom_double2 = custom_type<double, double>;
+    using custom_double4 = custom_type<custom_double2, custom_double2>;
+
+    std::vector<benchmark::internal::Benchmark*> bs =
+    {
+        CREATE_BENCHMARK(false, int, int),
+        CREATE_BENCHMARK(false, int, double),
+        CREATE_BENCHMARK(false, int, custom_float2),
+        CREATE_BENCHMARK(false, int, custom_double2),
+        CREATE_BENCHMARK(false, int, custom_double4),
+
+        CREATE_BENCHMARK(true, int, int),
+        CREATE_BENCHMARK(true, int, double),
+        CREATE_BENCHMARK(true, int, custom_float2),
+        CREATE_BENCHMARK(true, int, custom_double2),
+        CREATE_BENCHMARK(true, int, custom_double4),
+    };
+
+    benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
+}
+
+int main(int argc, char *argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of values");
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.set_optional<std::string>("segments",
+                                     "segments",
+                                     "all",
+                                     "segment length distributions: all or a comma separated "
+                                     "list of uniform, power_law, bimodal");
+#ifdef BENCHMARK_CONFIG_TUNING
+    // optionally run an evenly split subset of benchmarks, when making multiple program invocations
+    parser.set_optional<int>("parallel_instance",
+                             "parallel_instance",
+                             0,
+                             "parallel instance index");
+    parser.set_optional<int>("parallel_instances",
+                             "parallel_instances",
+                             1,
+                             "total parallel instances");
+#endif
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const size_t size = parser.get<size_t>("size");
+    const int trials = parser.get<int>("trials");
+    const std::vector<segment_length_distribution> segment_distributions
+        = parse_segment_length_distributions(parser.get<std::string>("segments"));
+
+    // HIP
+    hipStream_t stream = 0; // default
+
+    // Benchmark info
+    add_common_benchmark_info();
+    benchmark::AddCustomContext("size", std::to_string(size));
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks;
+#ifdef BENCHMARK_CONFIG_TUNING
+    const int parallel_instance = parser.get<int>("parallel_instance");
+    const int parallel_instances = parser.get<int>("parallel_instances");
+    config_autotune_register::register_benchmark_subset(benchmarks,
+                                                        parallel_instance,
+                                                        parallel_instances,
+                                                        size,
+                                                        stream);
+    benchmark::AddCustomContext("autotune_config_pattern",
+                                device_scan_benchmark<true>::get_name_pattern().c_str());
+#else
+    for(const auto distribution : segment_distributions)
+    {
+        add_benchmarks(1000, distribution, benchmarks, stream, size);
+        add_benchmarks(10, distribution, benchmarks, stream, size);
+    }
+#endif
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
@@ -32,6 +32,7 @@
 // CmdParser
 #include "cmdparser.hpp"
 #include "benchmark_utils.hpp"
+#include "benchmark_device_segmented_radix_sort.parallel.hpp"
 
 // HIP API
 #include <hip/hip_runtime.h>
@@ -55,20 +56,23 @@ constexpr std::array<size_t, 4> segment_lengths{30, 256, 3000, 300000};
 }
 
 
-template<class Key>
-void run_sort_keys_benchmark(benchmark::State& state,
-                             size_t num_segments,
-                             size_t mean_segment_length,
-                             size_t target_size,
-                             hipStream_t stream)
+template<class Offset>
+std::vector<Offset> get_offsets(size_t num_segments,
+                                size_t mean_segment_length,
+                                segment_length_distribution distribution)
 {
-    using offset_type = int;
-    using key_type = Key;
+    static constexpr int seed = 716;
+    if(distribution != segment_length_distribution::uniform)
+    {
+        return get_segment_offsets<Offset>(num_segments * mean_segment_length,
+                                           num_segments,
+                                           distribution,
+                                           seed);
+    }
 
-    std::vector<offset_type> offsets;
+    std::vector<Offset> offsets;
     offsets.push_back(0);
 
-    static constexpr int seed = 716;
     std::default_random_engine gen(seed);
 
     std::normal_distribution<double> segment_length_dis(static_cast<double>(mean_segment_length),
@@ -82,31 +86,168 @@ void run_sort_keys_benchmark(benchmark::State& state,
         {
             continue;
         }
-        const offset_type segment_length = static_cast<offset_type>(segment_length_candidate);
+        const Offset segment_length = static_cast<Offset>(segment_length_candidate);
         offset += segment_length;
         offsets.push_back(offset);
         ++segment_index;
     }
-    const size_t size = offset;
-    const size_t segments_count = offsets.size() - 1;
+    return offsets;
+}
 
-    std::vector<key_type> keys_input;
-    if(std::is_floating_point<key_type>::value)
+// The config with partitioning enabled for any number of segments, so the segments of a length
+// class are sorted by the kernel of the class even if they are fewer than partitioning_threshold
+template<class Config, class WarpSortConfig = typename Config::warp_sort_config>
+struct partitioned_config
+{
+    using type = Config;
+};
+
+template<class Config,
+         unsigned int LogicalWarpSizeSmall,
+         unsigned int ItemsPerThreadSmall,
+         unsigned int BlockSizeSmall,
+         unsigned int PartitioningThreshold,
+         bool         EnableUnpartitionedWarpSort,
+         unsigned int LogicalWarpSizeMedium,
+         unsigned int ItemsPerThreadMedium,
+         unsigned int BlockSizeMedium,
+         bool         UseRadixSortSmall>
+struct partitioned_config<Config,
+                          rp::WarpSortConfig<LogicalWarpSizeSmall,
+                                             ItemsPerThreadSmall,
+                                             BlockSizeSmall,
+                                             PartitioningThreshold,
+                                             EnableUnpartitionedWarpSort,
+                                             LogicalWarpSizeMedium,
+                                             ItemsPerThreadMedium,
+                                             BlockSizeMedium,
+                                             UseRadixSortSmall>>
+{
+    using type = rp::segmented_radix_sort_config<Config::long_radix_bits,
+                                                 Config::short_radix_bits,
+                                                 typename Config::sort,
+                                                 rp::WarpSortConfig<LogicalWarpSizeSmall,
+                                                                    ItemsPerThreadSmall,
+                                                                    BlockSizeSmall,
+                                                                    0,
+                                                                    EnableUnpartitionedWarpSort,
+                                                                    LogicalWarpSizeMedium,
+                                                                    ItemsPerThreadMedium,
+                                                                    BlockSizeMedium,
+                                                                    UseRadixSortSmall>,
+                                                 Config::device_sort_threshold>;
+};
+
+// Sorts the small, medium and large segments and the segments sorted by the device-level radix
+// sort separately, and reports the number of segments and the time of one sort of each class.
+// Comparing the sum of the times with the time of the whole sort shows the cost or the benefit
+// of the partitioning.
+template<class Config, class Offset, class SortFunction>
+void add_segment_class_counters(benchmark::State& state,
+                                const std::vector<Offset>& offsets,
+                                size_t batch_size,
+                                SortFunction sort)
+{
+    using warp_sort_config = typename Config::warp_sort_config;
+    const size_t max_small_length
+        = warp_sort_config::items_per_thread_small * warp_sort_config::logical_warp_size_small;
+    const size_t max_medium_length
+        = warp_sort_config::items_per_thread_medium * warp_sort_config::logical_warp_size_medium;
+    const size_t max_large_length = Config::device_sort_threshold != 0
+        ? Config::device_sort_threshold : std::numeric_limits<size_t>::max();
+
+    constexpr size_t class_count = 4;
+    const char* class_names[class_count] = {"small", "medium", "large", "device"};
+    std::vector<Offset> begin_offsets[class_count];
+    std::vector<Offset> end_offsets[class_count];
+    for(size_t segment = 0; segment + 1 < offsets.size(); segment++)
     {
-        keys_input = get_random_data<key_type>(
-            size,
-            static_cast<key_type>(-1000),
-            static_cast<key_type>(1000)
-        );
+        const size_t length = offsets[segment + 1] - offsets[segment];
+        const size_t segment_class = length <= max_small_length ? 0
+            : length <= max_medium_length ? 1
+            : length <= max_large_length ? 2 : 3;
+        begin_offsets[segment_class].push_back(offsets[segment]);
+        end_offsets[segment_class].push_back(offsets[segment + 1]);
     }
-    else
+
+    for(size_t segment_class = 0; segment_class < class_count; segment_class++)
     {
-        keys_input = get_random_data<key_type>(
-            size,
-            std::numeric_limits<key_type>::min(),
-            std::numeric_limits<key_type>::max()
-        );
+        const std::string name = class_names[segment_class];
+        const size_t segments = begin_offsets[segment_class].size();
+        double milliseconds = 0;
+        if(segments > 0)
+        {
+            Offset * d_begin_offsets;
+            Offset * d_end_offsets;
+            HIP_CHECK(hipMalloc(&d_begin_offsets, segments * sizeof(Offset)));
+            HIP_CHECK(hipMalloc(&d_end_offsets, segments * sizeof(Offset)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_begin_offsets, begin_offsets[segment_class].data(),
+                    segments * sizeof(Offset),
+                    hipMemcpyHostToDevice
+                )
+            );
+            HIP_CHECK(
+                hipMemcpy(
+                    d_end_offsets, end_offsets[segment_class].data(),
+                    segments * sizeof(Offset),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            void * d_temporary_storage = nullptr;
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(sort(d_temporary_storage, temporary_storage_bytes,
+                           d_begin_offsets, d_end_offsets, segments));
+            HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+
+            // Warm-up
+            for(size_t i = 0; i < warmup_size; i++)
+            {
+                HIP_CHECK(sort(d_temporary_storage, temporary_storage_bytes,
+                               d_begin_offsets, d_end_offsets, segments));
+            }
+            HIP_CHECK(hipDeviceSynchronize());
+
+            auto start = std::chrono::high_resolution_clock::now();
+            for(size_t i = 0; i < batch_size; i++)
+            {
+                HIP_CHECK(sort(d_temporary_storage, temporary_storage_bytes,
+                               d_begin_offsets, d_end_offsets, segments));
+            }
+            HIP_CHECK(hipDeviceSynchronize());
+            auto end = std::chrono::high_resolution_clock::now();
+            milliseconds
+                = std::chrono::duration<double, std::milli>(end - start).count() / batch_size;
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_begin_offsets));
+            HIP_CHECK(hipFree(d_end_offsets));
+        }
+        state.counters[name + "_segments"] = static_cast<double>(segments);
+        state.counters[name + "_ms"] = milliseconds;
     }
+}
+
+template<class Key>
+void run_sort_keys_benchmark(benchmark::State& state,
+                             size_t num_segments,
+                             size_t mean_segment_length,
+                             size_t target_size,
+                             sort_key_distribution distribution,
+                             segment_length_distribution segment_distribution,
+                             hipStream_t stream)
+{
+    using offset_type = int;
+    using key_type = Key;
+
+    const std::vector<offset_type> offsets
+        = get_offsets<offset_type>(num_segments, mean_segment_length, segment_distribution);
+    const size_t size = offsets.back();
+    const size_t segments_count = offsets.size() - 1;
+
+    std::vector<key_type> keys_input = get_sort_keys<key_type>(size, distribution);
     size_t batch_size = 1;
     if(size < target_size)
     {
@@ -165,6 +306,7 @@ void run_sort_keys_benchmark(benchmark::State& state,
     }
     HIP_CHECK(hipDeviceSynchronize());
 
+    device_energy_meter energy_meter;
     for (auto _ : state)
     {
         auto start = std::chrono::high_resolution_clock::now();
@@ -190,6 +332,25 @@ void run_sort_keys_benchmark(benchmark::State& state,
     }
     state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(key_type));
     state.SetItemsProcessed(state.iterations() * batch_size * size);
+    add_bandwidth_counters(state, batch_size * size, 2 * sizeof(key_type));
+    energy_meter.add_counters(state, batch_size * size);
+
+    using config = rp::detail::
+        default_segmented_radix_sort_config<ROCPRIM_TARGET_ARCH, key_type, rp::empty_type>;
+    add_segment_class_counters<config>(
+        state, offsets, batch_size,
+        [&](void * temporary_storage, size_t& storage_size,
+            offset_type * begin_offsets, offset_type * end_offsets, unsigned int segments)
+        {
+            return rp::segmented_radix_sort_keys<typename partitioned_config<config>::type>(
+                temporary_storage, storage_size,
+                d_keys_input, d_keys_output, size,
+                segments, begin_offsets, end_offsets,
+                0, sizeof(key_type) * 8,
+                stream, false
+            );
+        }
+    );
 
     HIP_CHECK(hipFree(d_temporary_storage));
     HIP_CHECK(hipFree(d_offsets));
@@ -202,55 +363,20 @@ void run_sort_pairs_benchmark(benchmark::State& state,
                               size_t num_segments,
                               size_t mean_segment_length,
                               size_t target_size,
+                              sort_key_distribution distribution,
+                              segment_length_distribution segment_distribution,
                               hipStream_t stream)
 {
     using offset_type = int;
     using key_type = Key;
     using value_type = Value;
 
-    // Generate data
-    std::vector<offset_type> offsets;
-    offsets.push_back(0);
-
-    static constexpr int seed = 716;
-    std::default_random_engine gen(seed);
-
-    std::normal_distribution<double> segment_length_dis(static_cast<double>(mean_segment_length),
-                                                        0.1 * mean_segment_length);
-
-    size_t offset = 0;
-    for(size_t segment_index = 0; segment_index < num_segments;)
-    {
-        const double segment_length_candidate = std::round(segment_length_dis(gen));
-        if (segment_length_candidate < 0)
-        {
-            continue;
-        }
-        const offset_type segment_length = static_cast<offset_type>(segment_length_candidate);
-        offset += segment_length;
-        offsets.push_back(offset);
-        ++segment_index;
-    }
-    const size_t size = offset;
+    const std::vector<offset_type> offsets
+        = get_offsets<offset_type>(num_segments, mean_segment_length, segment_distribution);
+    const size_t size = offsets.back();
     const size_t segments_count = offsets.size() - 1;
 
-    std::vector<key_type> keys_input;
-    if(std::is_floating_point<key_type>::value)
-    {
-        keys_input = get_random_data<key_type>(
-            size,
-            static_cast<key_type>(-1000),
-            static_cast<key_type>(1000)
-        );
-    }
-    else
-    {
-        keys_input = get_random_data<key_type>(
-            size,
-            std::numeric_limits<key_type>::min(),
-            std::numeric_limits<key_type>::max()
-        );
-    }
+    std::vector<key_type> keys_input = get_sort_keys<key_type>(size, distribution);
     size_t batch_size = 1;
     if(size < target_size)
     {
@@ -324,6 +450,7 @@ void run_sort_pairs_benchmark(benchmark::State& state,
     }
     HIP_CHECK(hipDeviceSynchronize());
 
+    device_energy_meter energy_meter;
     for (auto _ : state)
     {
         auto start = std::chrono::high_resolution_clock::now();
@@ -351,6 +478,25 @@ void run_sort_pairs_benchmark(benchmark::State& state,
         state.iterations() * batch_size * size * (sizeof(key_type) + sizeof(value_type))
     );
     state.SetItemsProcessed(state.iterations() * batch_size * size);
+    add_bandwidth_counters(state, batch_size * size, 2 * (sizeof(key_type) + sizeof(value_type)));
+    energy_meter.add_counters(state, batch_size * size);
+
+    using config = rp::detail::
+        default_segmented_radix_sort_config<ROCPRIM_TARGET_ARCH, key_type, value_type>;
+    add_segment_class_counters<config>(
+        state, offsets, batch_size,
+        [&](void * temporary_storage, size_t& storage_size,
+            offset_type * begin_offsets, offset_type * end_offsets, unsigned int segments)
+        {
+            return rp::segmented_radix_sort_pairs<typename partitioned_config<config>::type>(
+                temporary_storage, storage_size,
+                d_keys_input, d_keys_output, d_values_input, d_values_output, size,
+                segments, begin_offsets, end_offsets,
+                0, sizeof(key_type) * 8,
+                stream, false
+            );
+        }
+    );
 
     HIP_CHECK(hipFree(d_temporary_storage));
     HIP_CHECK(hipFree(d_offsets));
@@ -365,7 +511,9 @@ void add_sort_keys_benchmarks(std::vector<benchmark::internal::Benchmark *> &ben
                               hipStream_t stream,
                               size_t max_size,
                               size_t min_size,
-                              size_t target_size)
+                              size_t target_size,
+                              const std::vector<sort_key_distribution>& distributions,
+                              const std::vector<segment_length_distribution>& segment_distributions)
 {
     std::string name = Traits<KeyT>::name();
     for(const auto segment_count : segment_counts)
@@ -377,13 +525,21 @@ void add_sort_keys_benchmarks(std::vector<benchmark::internal::Benchmark *> &ben
             {
                 continue;
             }
-            benchmarks.push_back(
-                benchmark::RegisterBenchmark(
-                    (std::string("sort_keys<") + name + ">(" + std::to_string(segment_count) +
-                        " segments with length ~" + std::to_string(segment_length) +")").c_str(),
-                    [=](benchmark::State &state) { run_sort_keys_benchmark<KeyT>(state, segment_count, segment_length, target_size, stream); }
-                )
-            );
+            for(const auto distribution : distributions)
+            {
+                for(const auto segment_distribution : segment_distributions)
+                {
+                    benchmarks.push_back(
+                        benchmark::RegisterBenchmark(
+                            (std::string("sort_keys<") + name + ">(" + std::to_string(segment_count) +
+                                " segments with length ~" + std::to_string(segment_length) + ")" +
+                                get_sort_key_distribution_suffix(distribution) +
+                                get_segment_length_distribution_suffix(segment_distribution)).c_str(),
+                            [=](benchmark::State &state) { run_sort_keys_benchmark<KeyT>(state, segment_count, segment_length, target_size, distribution, segment_distribution, stream); }
+                        )
+                    );
+                }
+            }
         }
     }
 }
@@ -393,7 +549,9 @@ void add_sort_pairs_benchmarks(std::vector<benchmark::internal::Benchmark *> &be
                                hipStream_t stream,
                                size_t max_size,
                                size_t min_size,
-                               size_t target_size)
+                               size_t target_size,
+                               const std::vector<sort_key_distribution>& distributions,
+                               const std::vector<segment_length_distribution>& segment_distributions)
 {
     std::string key_name = Traits<KeyT>::name();
     std::string value_name = Traits<ValueT>::name();
@@ -406,13 +564,21 @@ void add_sort_pairs_benchmarks(std::vector<benchmark::internal::Benchmark *> &be
             {
                 continue;
             }
-            benchmarks.push_back(
-                benchmark::RegisterBenchmark(
-                    (std::string("sort_pairs<") + key_name + ", " + value_name + ">(" + std::to_string(segment_count) +
-                        " segments with length ~" + std::to_string(segment_length) +")").c_str(),
-                    [=](benchmark::State &state) { run_sort_pairs_benchmark<KeyT, ValueT>(state, segment_count, segment_length, target_size, stream); }
-                )
-            );
+            for(const auto distribution : distributions)
+            {
+                for(const auto segment_distribution : segment_distributions)
+                {
+                    benchmarks.push_back(
+                        benchmark::RegisterBenchmark(
+                            (std::string("sort_pairs<") + key_name + ", " + value_name + ">(" + std::to_string(segment_count) +
+                                " segments with length ~" + std::to_string(segment_length) + ")" +
+                                get_sort_key_distribution_suffix(distribution) +
+                                get_segment_length_distribution_suffix(segment_distribution)).c_str(),
+                            [=](benchmark::State &state) { run_sort_pairs_benchmark<KeyT, ValueT>(state, segment_count, segment_length, target_size, distribution, segment_distribution, stream); }
+                        )
+                    );
+                }
+            }
         }
     }
 }
@@ -422,12 +588,38 @@ int main(int argc, char *argv[])
     cli::Parser parser(argc, argv);
     parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of values");
     parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.set_optional<std::string>("distribution",
+                                     "distribution",
+                                     "uniform",
+                                     "key distributions: all or a comma separated list of "
+                                     "uniform, sorted, reverse_sorted, nearly_sorted, "
+                                     "few_unique, zipf, low_entropy, equal_high_bits");
+    parser.set_optional<std::string>("segments",
+                                     "segments",
+                                     "all",
+                                     "segment length distributions: all or a comma separated "
+                                     "list of uniform, power_law, bimodal");
+#ifdef BENCHMARK_CONFIG_TUNING
+    // optionally run an evenly split subset of benchmarks, when making multiple program invocations
+    parser.set_optional<int>("parallel_instance",
+                             "parallel_instance",
+                             0,
+                             "parallel instance index");
+    parser.set_optional<int>("parallel_instances",
+                             "parallel_instances",
+                             1,
+                             "total parallel instances");
+#endif
     parser.run_and_exit_if_error();
 
     // Parse argv
     benchmark::Initialize(&argc, argv);
     const size_t size = parser.get<size_t>("size");
     const int trials = parser.get<int>("trials");
+    const std::vector<sort_key_distribution> distributions
+        = parse_sort_key_distributions(parser.get<std::string>("distribution"));
+    const std::vector<segment_length_distribution> segment_distributions
+        = parse_segment_length_distributions(parser.get<std::string>("segments"));
 
     // HIP
     hipStream_t stream = 0; // default
@@ -438,22 +630,34 @@ int main(int argc, char *argv[])
 
     // Add benchmarks
     std::vector<benchmark::internal::Benchmark*> benchmarks;
-    add_sort_keys_benchmarks<float>(benchmarks, stream, size, min_size, size / 2);
-    add_sort_keys_benchmarks<double>(benchmarks, stream, size, min_size, size / 2);
-    add_sort_keys_benchmarks<int8_t>(benchmarks, stream, size, min_size, size / 2);
-    add_sort_keys_benchmarks<uint8_t>(benchmarks, stream, size, min_size, size / 2);
-    add_sort_keys_benchmarks<rocprim::half>(benchmarks, stream, size, min_size, size / 2);
-    add_sort_keys_benchmarks<int>(benchmarks, stream, size, min_size, size / 2);
+#ifdef BENCHMARK_CONFIG_TUNING
+    const int parallel_instance = parser.get<int>("parallel_instance");
+    const int parallel_instances = parser.get<int>("parallel_instances");
+    config_autotune_register::register_benchmark_subset(benchmarks,
+                                                        parallel_instance,
+                                                        parallel_instances,
+                                                        size,
+                                                        stream);
+    benchmark::AddCustomContext("autotune_config_pattern",
+                                device_segmented_radix_sort_benchmark<>::get_name_pattern().c_str());
+#else
+    add_sort_keys_benchmarks<float>(benchmarks, stream, size, min_size, size / 2, distributions, segment_distributions);
+    add_sort_keys_benchmarks<double>(benchmarks, stream, size, min_size, size / 2, distributions, segment_distributions);
+    add_sort_keys_benchmarks<int8_t>(benchmarks, stream, size, min_size, size / 2, distributions, segment_distributions);
+    add_sort_keys_benchmarks<uint8_t>(benchmarks, stream, size, min_size, size / 2, distributions, segment_distributions);
+    add_sort_keys_benchmarks<rocprim::half>(benchmarks, stream, size, min_size, size / 2, distributions, segment_distributions);
+    add_sort_keys_benchmarks<int>(benchmarks, stream, size, min_size, size / 2, distributions, segment_distributions);
 
     using custom_float2 = custom_type<float, float>;
     using custom_double2 = custom_type<double, double>;
-    add_sort_pairs_benchmarks<int, float>(benchmarks, stream, size, min_size, size / 2);
-    add_sort_pairs_benchmarks<long long, double>(benchmarks, stream, size, min_size, size / 2);
-    add_sort_pairs_benchmarks<int8_t, int8_t>(benchmarks, stream, size, min_size, size / 2);
-    add_sort_pairs_benchmarks<uint8_t, uint8_t>(benchmarks, stream, size, min_size, size / 2);
-    add_sort_pairs_benchmarks<rocprim::half, rocprim::half>(benchmarks, stream, size, min_size, size / 2);
-    add_sort_pairs_benchmarks<int, custom_float2>(benchmarks, stream, size, min_size, size / 2);
-    add_sort_pairs_benchmarks<long long, custom_double2>(benchmarks, stream, size, min_size, size / 2);
+    add_sort_pairs_benchmarks<int, float>(benchmarks, stream, size, min_size, size / 2, distributions, segment_distributions);
+    add_sort_pairs_benchmarks<long long, double>(benchmarks, stream, size, min_size, size / 2, distributions, segment_distributions);
+    add_sort_pairs_benchmarks<int8_t, int8_t>(benchmarks, stream, size, min_size, size / 2, distributions, segment_distributions);
+    add_sort_pairs_benchmarks<uint8_t, uint8_t>(benchmarks, stream, size, min_size, size / 2, distributions, segment_distributions);
+    add_sort_pairs_benchmarks<rocprim::half, rocprim::half>(benchmarks, stream, size, min_size, size / 2, distributions, segment_distributions);
+    add_sort_pairs_benchmarks<int, custom_float2>(benchmarks, stream, size, min_size, size / 2, distributions, segment_distributions);
+    add_sort_pairs_benchmarks<long long, custom_double2>(benchmarks, stream, size, min_size, size / 2, distributions, segment_distributions);
+#endif
 
     // Use manual timing
     for(auto& b : benchmarks)
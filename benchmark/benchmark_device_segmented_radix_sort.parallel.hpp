@@ -0,0 +1,266 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef ROCPRIM_BENCHMARK_DEVICE_SEGMENTED_RADIX_SORT_PARALLEL_HPP_
+#define ROCPRIM_BENCHMARK_DEVICE_SEGMENTED_RADIX_SORT_PARALLEL_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// HIP API
+#include <hip/hip_runtime.h>
+
+// rocPRIM HIP API
+#include <rocprim/rocprim.hpp>
+
+#include "benchmark_utils.hpp"
+
+template<typename Key   = int,
+         typename Value = rocprim::empty_type,
+         typename Config
+         = rocprim::detail::default_segmented_radix_sort_config<ROCPRIM_TARGET_ARCH, Key, Value>>
+struct device_segmented_radix_sort_benchmark : public config_autotune_interface
+{
+    static std::string get_name_pattern()
+    {
+        return R"regex((?P<algo>\S*?)<)regex"
+               R"regex((?P<key_type>\S*),(?:\s*(?P<value_type>\S*),)?\s*)regex"
+               R"regex(segmented_radix_sort_config<\s*(?P<long_radix_bits>[0-9]+),)regex"
+               R"regex(\s*(?P<short_radix_bits>[0-9]+),\s*kernel_config<)regex"
+               R"regex(\s*(?P<block_size>[0-9]+),\s*(?P<items_per_thread>[0-9]+)>>>)regex";
+    }
+
+    std::string name() const override
+    {
+        using namespace std::string_literals;
+        return std::string(
+            "device_segmented_radix_sort<" + std::string(Traits<Key>::name()) + ", "
+            + (std::is_same<Value, rocprim::empty_type>::value
+                   ? ""s
+                   : std::string(Traits<Value>::name()) + ", ")
+            + "segmented_radix_sort_config<" + std::to_string(Config::long_radix_bits) + ", "
+            + std::to_string(Config::short_radix_bits) + ", kernel_config<"
+            + pad_string(std::to_string(Config::sort::block_size), 3) + ", "
+            + pad_string(std::to_string(Config::sort::items_per_thread), 2) + ">>>");
+    }
+
+    static constexpr unsigned int batch_size  = 10;
+    static constexpr unsigned int warmup_size = 5;
+    // Segments of these lengths are sorted by the block-level radix sort, which is tuned here
+    static constexpr size_t mean_segment_length = 4096;
+    static constexpr unsigned int seed          = 716;
+
+    static std::vector<Value> get_values(std::true_type /*keys_only*/, size_t /*size*/)
+    {
+        return {};
+    }
+
+    static std::vector<Value> get_values(std::false_type /*keys_only*/, size_t size)
+    {
+        std::vector<Value> values(size);
+        for(size_t i = 0; i < size; i++)
+        {
+            values[i] = Value(i);
+        }
+        return values;
+    }
+
+    // Sorts the keys only
+    template<typename OffsetT>
+    static hipError_t dispatch(std::true_type /*keys_only*/,
+                               void*          d_temporary_storage,
+                               size_t&        temporary_storage_bytes,
+                               Key*           d_keys_input,
+                               Key*           d_keys_output,
+                               Value*         /*d_values_input*/,
+                               Value*         /*d_values_output*/,
+                               size_t         size,
+                               unsigned int   segments,
+                               OffsetT*       d_offsets,
+                               hipStream_t    stream)
+    {
+        return rocprim::segmented_radix_sort_keys<Config>(d_temporary_storage,
+                                                          temporary_storage_bytes,
+                                                          d_keys_input,
+                                                          d_keys_output,
+                                                          size,
+                                                          segments,
+                                                          d_offsets,
+                                                          d_offsets + 1,
+                                                          0,
+                                                          sizeof(Key) * 8,
+                                                          stream);
+    }
+
+    // Sorts the keys and the values
+    template<typename OffsetT>
+    static hipError_t dispatch(std::false_type /*keys_only*/,
+                               void*           d_temporary_storage,
+                               size_t&         temporary_storage_bytes,
+                               Key*            d_keys_input,
+                               Key*            d_keys_output,
+                               Value*          d_values_input,
+                               Value*          d_values_output,
+                               size_t          size,
+                               unsigned int    segments,
+                               OffsetT*        d_offsets,
+                               hipStream_t     stream)
+    {
+        return rocprim::segmented_radix_sort_pairs<Config>(d_temporary_storage,
+                                                           temporary_storage_bytes,
+                                                           d_keys_input,
+                                                           d_keys_output,
+                                                           d_values_input,
+                                                           d_values_output,
+                                                           size,
+                                                           segments,
+                                                           d_offsets,
+                                                           d_offsets + 1,
+                                                           0,
+                                                           sizeof(Key) * 8,
+                                                           stream);
+    }
+
+    void run(benchmark::State& state, size_t size, const hipStream_t stream) const override
+    {
+        using offset_type = int;
+        using keys_only   = std::is_same<Value, rocprim::empty_type>;
+
+        const unsigned int segments
+            = static_cast<unsigned int>(std::max<size_t>(1, size / mean_segment_length));
+        const std::vector<offset_type> offsets = get_segment_offsets<offset_type>(
+            size, segments, segment_length_distribution::uniform, seed);
+        const std::vector<Key> keys_input
+            = get_sort_keys<Key>(size, sort_key_distribution::uniform);
+
+        offset_type* d_offsets;
+        Key*         d_keys_input;
+        Key*         d_keys_output;
+        Value*       d_values_input  = nullptr;
+        Value*       d_values_output = nullptr;
+        HIP_CHECK(hipMalloc(&d_offsets, offsets.size() * sizeof(offset_type)));
+        HIP_CHECK(hipMalloc(&d_keys_input, size * sizeof(Key)));
+        HIP_CHECK(hipMalloc(&d_keys_output, size * sizeof(Key)));
+        HIP_CHECK(hipMemcpy(d_offsets,
+                            offsets.data(),
+                            offsets.size() * sizeof(offset_type),
+                            hipMemcpyHostToDevice));
+        HIP_CHECK(
+            hipMemcpy(d_keys_input, keys_input.data(), size * sizeof(Key), hipMemcpyHostToDevice));
+        if(!keys_only::value)
+        {
+            const std::vector<Value> values_input = get_values(keys_only{}, size);
+            HIP_CHECK(hipMalloc(&d_values_input, size * sizeof(Value)));
+            HIP_CHECK(hipMalloc(&d_values_output, size * sizeof(Value)));
+            HIP_CHECK(hipMemcpy(d_values_input,
+                                values_input.data(),
+                                size * sizeof(Value),
+                                hipMemcpyHostToDevice));
+        }
+
+        auto sort = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+        {
+            return dispatch(keys_only{},
+                            d_temporary_storage,
+                            temporary_storage_bytes,
+                            d_keys_input,
+                            d_keys_output,
+                            d_values_input,
+                            d_values_output,
+                            size,
+                            segments,
+                            d_offsets,
+                            stream);
+        };
+
+        void*  d_temporary_storage     = nullptr;
+        size_t temporary_storage_bytes = 0;
+        HIP_CHECK(sort(d_temporary_storage, temporary_storage_bytes));
+        HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        // Warm-up
+        for(size_t i = 0; i < warmup_size; i++)
+        {
+            HIP_CHECK(sort(d_temporary_storage, temporary_storage_bytes));
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        device_energy_meter energy_meter;
+        for(auto _ : state)
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+
+            for(size_t i = 0; i < batch_size; i++)
+            {
+                HIP_CHECK(sort(d_temporary_storage, temporary_storage_bytes));
+            }
+            HIP_CHECK(hipStreamSynchronize(stream));
+
+            auto end = std::chrono::high_resolution_clock::now();
+            auto elapsed_seconds
+                = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+            state.SetIterationTime(elapsed_seconds.count());
+        }
+        const size_t item_size = sizeof(Key) + (keys_only::value ? 0 : sizeof(Value));
+        state.SetBytesProcessed(state.iterations() * batch_size * size * item_size);
+        state.SetItemsProcessed(state.iterations() * batch_size * size);
+        add_bandwidth_counters(state, batch_size * size, item_size);
+        energy_meter.add_counters(state, batch_size * size);
+
+        HIP_CHECK(hipFree(d_temporary_storage));
+        HIP_CHECK(hipFree(d_offsets));
+        HIP_CHECK(hipFree(d_keys_input));
+        HIP_CHECK(hipFree(d_keys_output));
+        HIP_CHECK(hipFree(d_values_input));
+        HIP_CHECK(hipFree(d_values_output));
+    }
+};
+
+template<unsigned int LongRadixBits,
+         unsigned int ShortRadixBits,
+         unsigned int ItemsPerThread,
+         typename Key,
+         typename Value = rocprim::empty_type>
+struct device_segmented_radix_sort_benchmark_generator
+{
+    static void create(std::vector<std::unique_ptr<config_autotune_interface>>& storage)
+    {
+        storage.emplace_back(std::make_unique<device_segmented_radix_sort_benchmark<
+                                 Key,
+                                 Value,
+                                 rocprim::segmented_radix_sort_config<
+                                     LongRadixBits,
+                                     ShortRadixBits,
+                                     rocprim::kernel_config<256u, ItemsPerThread>,
+                                     rocprim::select_warp_sort_config_t<Key>>>>());
+    }
+};
+
+#endif // ROCPRIM_BENCHMARK_DEVICE_SEGMENTED_RADIX_SORT_PARALLEL_HPP_
@@ -49,29 +49,20 @@ const unsigned int batch_size = 10;
 const unsigned int warmup_size = 5;
 
 template<class T>
-void run_benchmark(benchmark::State& state, size_t desired_segments, hipStream_t stream, size_t size)
+void run_benchmark(benchmark::State& state,
+                   size_t desired_segments,
+                   segment_length_distribution distribution,
+                   hipStream_t stream,
+                   size_t size)
 {
     using offset_type = int;
     using value_type = T;
 
     // Generate data
     const unsigned int seed = 123;
-    std::default_random_engine gen(seed);
-
-    const double avg_segment_length = static_cast<double>(size) / desired_segments;
-    std::uniform_real_distribution<double> segment_length_dis(0, avg_segment_length * 2);
-
-    std::vector<offset_type> offsets;
-    unsigned int segments_count = 0;
-    size_t offset = 0;
-    while(offset < size)
-    {
-        const size_t segment_length = std::round(segment_length_dis(gen));
-        offsets.push_back(offset);
-        segments_count++;
-        offset += segment_length;
-    }
-    offsets.push_back(size);
+    const std::vector<offset_type> offsets
+        = get_segment_offsets<offset_type>(size, desired_segments, distribution, seed);
+    const unsigned int segments_count = offsets.size() - 1;
 
     std::vector<value_type> values_input(size);
     std::iota(values_input.begin(), values_input.end(), 0);
@@ -135,6 +126,7 @@ void run_benchmark(benchmark::State& state, size_t desired_segments, hipStream_t
     }
     HIP_CHECK(hipDeviceSynchronize());
 
+    device_energy_meter energy_meter;
     for (auto _ : state)
     {
         auto start = std::chrono::high_resolution_clock::now();
@@ -161,6 +153,8 @@ void run_benchmark(benchmark::State& state, size_t desired_segments, hipStream_t
     }
     state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(value_type));
     state.SetItemsProcessed(state.iterations() * batch_size * size);
+    add_bandwidth_counters(state, batch_size * size, sizeof(value_type));
+    energy_meter.add_counters(state, batch_size * size);
 
     HIP_CHECK(hipFree(d_temporary_storage));
     HIP_CHECK(hipFree(d_offsets));
@@ -171,10 +165,11 @@ void run_benchmark(benchmark::State& state, size_t desired_segments, hipStream_t
 #define CREATE_BENCHMARK(T, SEGMENTS) \
 benchmark::RegisterBenchmark( \
     (std::string("segmented_reduce") + "<" #T ">" + \
-        "(~" + std::to_string(SEGMENTS) + " segments)" \
+        "(~" + std::to_string(SEGMENTS) + " segments)" + \
+        get_segment_length_distribution_suffix(distribution) \
     ).c_str(), \
     run_benchmark<T>, \
-    SEGMENTS, stream, size \
+    SEGMENTS, distribution, stream, size \
 )
 
 #define BENCHMARK_TYPE(type) \
@@ -186,7 +181,8 @@ benchmark::RegisterBenchmark( \
 
 void add_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
                     hipStream_t stream,
-                    size_t size)
+                    size_t size,
+                    segment_length_distribution distribution)
 {
     using custom_float2 = custom_type<float, float>;
     using custom_double2 = custom_type<double, double>;
@@ -211,12 +207,19 @@ int main(int argc, char *argv[])
     cli::Parser parser(argc, argv);
     parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of values");
     parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.set_optional<std::string>("segments",
+                                     "segments",
+                                     "all",
+                                     "segment length distributions: all or a comma separated "
+                                     "list of uniform, power_law, bimodal");
     parser.run_and_exit_if_error();
 
     // Parse argv
     benchmark::Initialize(&argc, argv);
     const size_t size = parser.get<size_t>("size");
     const int trials = parser.get<int>("trials");
+    const std::vector<segment_length_distribution> segment_distributions
+        = parse_segment_length_distributions(parser.get<std::string>("segments"));
 
     // HIP
     hipStream_t stream = 0; // default
@@ -227,7 +230,10 @@ int main(int argc, char *argv[])
 
     // Add benchmarks
     std::vector<benchmark::internal::Benchmark*> benchmarks;
-    add_benchmarks(benchmarks, stream, size);
+    for(const auto distribution : segment_distributions)
+    {
+        add_benchmarks(benchmarks, stream, size, distribution);
+    }
 
     // Use manual timing
     for(auto& b : benchmarks)
@@ -34,6 +34,7 @@
 // CmdParser
 #include "cmdparser.hpp"
 #include "benchmark_utils.hpp"
+#include "benchmark_device_select.parallel.hpp"
 
 // HIP API
 #include <hip/hip_runtime.h>
@@ -127,6 +128,7 @@ void run_flagged_benchmark(benchmark::State& state,
     HIP_CHECK(hipDeviceSynchronize());
 
     const unsigned int batch_size = 10;
+    device_energy_meter energy_meter;
     for(auto _ : state)
     {
         auto start = std::chrono::high_resolution_clock::now();
@@ -152,6 +154,8 @@ void run_flagged_benchmark(benchmark::State& state,
     }
     state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
     state.SetItemsProcessed(state.iterations() * batch_size * size);
+    add_bandwidth_counters(state, batch_size * size, sizeof(T) + sizeof(FlagType));
+    energy_meter.add_counters(state, batch_size * size);
 
     hipFree(d_input);
     hipFree(d_flags);
@@ -229,6 +233,7 @@ void run_selectop_benchmark(benchmark::State& state,
     HIP_CHECK(hipDeviceSynchronize());
 
     const unsigned int batch_size = 10;
+    device_energy_meter energy_meter;
     for(auto _ : state)
     {
         auto start = std::chrono::high_resolution_clock::now();
@@ -254,6 +259,8 @@ void run_selectop_benchmark(benchmark::State& state,
     }
     state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
     state.SetItemsProcessed(state.iterations() * batch_size * size);
+    add_bandwidth_counters(state, batch_size * size, sizeof(T));
+    energy_meter.add_counters(state, batch_size * size);
 
     hipFree(d_input);
     hipFree(d_output);
@@ -337,6 +344,7 @@ void run_unique_benchmark(benchmark::State& state,
     HIP_CHECK(hipDeviceSynchronize());
 
     const unsigned int batch_size = 10;
+    device_energy_meter energy_meter;
     for(auto _ : state)
     {
         auto start = std::chrono::high_resolution_clock::now();
@@ -362,6 +370,8 @@ void run_unique_benchmark(benchmark::State& state,
     }
     state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
     state.SetItemsProcessed(state.iterations() * batch_size * size);
+    add_bandwidth_counters(state, batch_size * size, sizeof(T));
+    energy_meter.add_counters(state, batch_size * size);
 
     hipFree(d_input);
     hipFree(d_output);
@@ -450,6 +460,7 @@ void run_unique_by_key_benchmark(benchmark::State& state,
     HIP_CHECK(hipDeviceSynchronize());
 
     const unsigned int batch_size = 10;
+    device_energy_meter energy_meter;
     for(auto _ : state)
     {
         auto start = std::chrono::high_resolution_clock::now();
@@ -475,6 +486,8 @@ void run_unique_by_key_benchmark(benchmark::State& state,
     }
     state.SetBytesProcessed(state.iterations() * batch_size * size * (sizeof(Key) + sizeof(Value)));
     state.SetItemsProcessed(state.iterations() * batch_size * size);
+    add_bandwidth_counters(state, batch_size * size, sizeof(Key) + sizeof(Value));
+    energy_meter.add_counters(state, batch_size * size);
 
     hipFree(d_keys_input);
     hipFree(d_values_input);
@@ -537,6 +550,17 @@ int main(int argc, char *argv[])
     cli::Parser parser(argc, argv);
     parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of values");
     parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+#ifdef BENCHMARK_CONFIG_TUNING
+    // optionally run an evenly split subset of benchmarks, when making multiple program invocations
+    parser.set_optional<int>("parallel_instance",
+                             "parallel_instance",
+                             0,
+                             "parallel instance index");
+    parser.set_optional<int>("parallel_instances",
+                             "parallel_instances",
+                             1,
+                             "total parallel instances");
+#endif
     parser.run_and_exit_if_error();
 
     // Parse argv
@@ -551,11 +575,23 @@ int main(int argc, char *argv[])
     add_common_benchmark_info();
     benchmark::AddCustomContext("size", std::to_string(size));
 
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks;
+#ifdef BENCHMARK_CONFIG_TUNING
+    const int parallel_instance = parser.get<int>("parallel_instance");
+    const int parallel_instances = parser.get<int>("parallel_instances");
+    config_autotune_register::register_benchmark_subset(benchmarks,
+                                                        parallel_instance,
+                                                        parallel_instances,
+                                                        size,
+                                                        stream);
+    benchmark::AddCustomContext("autotune_config_pattern",
+                                device_select_benchmark<>::get_name_pattern().c_str());
+#else
     using custom_double2 = custom_type<double, double>;
     using custom_int_double = custom_type<int, double>;
 
-    // Add benchmarks
-    std::vector<benchmark::internal::Benchmark*> benchmarks =
+    benchmarks =
     {
         BENCHMARK_FLAGGED_TYPE(int, unsigned char),
         BENCHMARK_FLAGGED_TYPE(float, unsigned char),
@@ -589,6 +625,7 @@ int main(int argc, char *argv[])
         BENCHMARK_UNIQUE_BY_KEY_TYPE(rocprim::half, rocprim::half),
         BENCHMARK_UNIQUE_BY_KEY_TYPE(custom_int_double, custom_int_double)
     };
+#endif
 
     // Use manual timing
     for(auto& b : benchmarks)
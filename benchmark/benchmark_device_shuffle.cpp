@@ -0,0 +1,234 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Random shuffle with rocprim::shuffle, compared with sorting the values by random keys with
+// rocprim::radix_sort_pairs. The random keys are generated once before the measurement.
+
+#include <chrono>
+#include <limits>
+#include <string>
+#include <vector>
+
+// Google Benchmark
+#include "benchmark/benchmark.h"
+// CmdParser
+#include "cmdparser.hpp"
+#include "benchmark_utils.hpp"
+
+// HIP API
+#include <hip/hip_runtime.h>
+
+// rocPRIM
+#include <rocprim/rocprim.hpp>
+
+#ifndef DEFAULT_N
+const size_t DEFAULT_N = 1024 * 1024 * 128;
+#endif
+
+const unsigned int batch_size  = 10;
+const unsigned int warmup_size = 5;
+
+template<class T>
+void run_shuffle_benchmark(benchmark::State& state, const size_t size, const hipStream_t stream)
+{
+    std::vector<T> input = get_random_data<T>(size, T(0), T(1000));
+
+    T* d_input;
+    T* d_output;
+    HIP_CHECK(hipMalloc(&d_input, size * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_output, size * sizeof(T)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Warm-up
+    for(size_t i = 0; i < warmup_size; i++)
+    {
+        HIP_CHECK(rocprim::shuffle(d_input, d_output, size, i, stream));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    device_energy_meter energy_meter;
+    for(auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(size_t i = 0; i < batch_size; i++)
+        {
+            HIP_CHECK(rocprim::shuffle(d_input, d_output, size, i, stream));
+        }
+        HIP_CHECK(hipStreamSynchronize(stream));
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds
+            = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
+    state.SetItemsProcessed(state.iterations() * batch_size * size);
+    add_bandwidth_counters(state, batch_size * size, 2 * sizeof(T));
+    energy_meter.add_counters(state, batch_size * size);
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
+
+template<class T>
+void run_sort_shuffle_benchmark(benchmark::State& state,
+                                const size_t      size,
+                                const hipStream_t stream)
+{
+    using key_type = unsigned int;
+
+    std::vector<T>        input = get_random_data<T>(size, T(0), T(1000));
+    std::vector<key_type> keys  = get_random_data<key_type>(size,
+                                                           std::numeric_limits<key_type>::min(),
+                                                           std::numeric_limits<key_type>::max());
+
+    T*        d_input;
+    T*        d_output;
+    key_type* d_keys_input;
+    key_type* d_keys_output;
+    HIP_CHECK(hipMalloc(&d_input, size * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_output, size * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_keys_input, size * sizeof(key_type)));
+    HIP_CHECK(hipMalloc(&d_keys_output, size * sizeof(key_type)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+    HIP_CHECK(
+        hipMemcpy(d_keys_input, keys.data(), size * sizeof(key_type), hipMemcpyHostToDevice));
+
+    size_t temporary_storage_bytes = 0;
+    HIP_CHECK(rocprim::radix_sort_pairs(nullptr,
+                                        temporary_storage_bytes,
+                                        d_keys_input,
+                                        d_keys_output,
+                                        d_input,
+                                        d_output,
+                                        size,
+                                        0,
+                                        sizeof(key_type) * 8,
+                                        stream));
+    void* d_temporary_storage;
+    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    auto run = [&]()
+    {
+        HIP_CHECK(rocprim::radix_sort_pairs(d_temporary_storage,
+                                            temporary_storage_bytes,
+                                            d_keys_input,
+                                            d_keys_output,
+                                            d_input,
+                                            d_output,
+                                            size,
+                                            0,
+                                            sizeof(key_type) * 8,
+                                            stream));
+    };
+
+    // Warm-up
+    for(size_t i = 0; i < warmup_size; i++)
+    {
+        run();
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(size_t i = 0; i < batch_size; i++)
+        {
+            run();
+        }
+        HIP_CHECK(hipStreamSynchronize(stream));
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds
+            = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
+    state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipFree(d_keys_input));
+    HIP_CHECK(hipFree(d_keys_output));
+}
+
+#define CREATE_BENCHMARK(T)                                                                    \
+    benchmark::RegisterBenchmark("shuffle<" #T ">", run_shuffle_benchmark<T>, size, stream),   \
+        benchmark::RegisterBenchmark("sort_shuffle<" #T ">",                                   \
+                                     run_sort_shuffle_benchmark<T>,                            \
+                                     size,                                                     \
+                                     stream)
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of values");
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const size_t size   = parser.get<size_t>("size");
+    const int    trials = parser.get<int>("trials");
+
+    // HIP
+    hipStream_t stream = 0; // default
+
+    // Benchmark info
+    add_common_benchmark_info();
+    benchmark::AddCustomContext("size", std::to_string(size));
+
+    using custom_double2 = custom_type<double, double>;
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks = {
+        CREATE_BENCHMARK(int),
+        CREATE_BENCHMARK(long long),
+        CREATE_BENCHMARK(custom_double2),
+    };
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+
+    return 0;
+}
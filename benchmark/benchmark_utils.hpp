@@ -22,10 +22,16 @@
 #define ROCPRIM_BENCHMARK_UTILS_HPP_
 
 #include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
 #include <vector>
 #include <random>
 #include <type_traits>
 #include <string>
+#include <map>
 #include <memory>
 
 #ifdef WIN32
@@ -35,6 +41,10 @@
 #include <rocprim/rocprim.hpp>
 #include "benchmark/benchmark.h"
 
+#ifdef BENCHMARK_ENERGY
+#include <rocm_smi/rocm_smi.h>
+#endif
+
 #define HIP_CHECK(condition)         \
   {                                  \
     hipError_t error = condition;    \
@@ -268,6 +278,366 @@ inline auto get_random_data(size_t size, T min, T max, size_t max_random_size =
     return data;
 }
 
+// Distributions of the keys of the sort benchmarks. The performance of the sorts depends on the
+// order of the input, on the number of distinct keys and on the number of bits which differ.
+enum class sort_key_distribution
+{
+    uniform, // full range for integers, [-1000, 1000] for floating point types
+    sorted, // uniform keys in ascending order
+    reverse_sorted, // uniform keys in descending order
+    nearly_sorted, // sorted keys, 1% of them swapped with keys at random positions
+    few_unique, // 16 distinct uniform keys
+    zipf, // 65536 distinct uniform keys, the frequency of the k-th key is proportional to 1/k
+    low_entropy, // bitwise AND of 3 uniform keys, so every bit is set with probability 1/8
+    equal_high_bits // uniform keys with the same upper half of the bits
+};
+
+inline const std::vector<sort_key_distribution>& get_sort_key_distributions()
+{
+    static const std::vector<sort_key_distribution> distributions{
+        sort_key_distribution::uniform,
+        sort_key_distribution::sorted,
+        sort_key_distribution::reverse_sorted,
+        sort_key_distribution::nearly_sorted,
+        sort_key_distribution::few_unique,
+        sort_key_distribution::zipf,
+        sort_key_distribution::low_entropy,
+        sort_key_distribution::equal_high_bits};
+    return distributions;
+}
+
+inline const char* get_sort_key_distribution_name(const sort_key_distribution distribution)
+{
+    switch(distribution)
+    {
+        case sort_key_distribution::uniform: return "uniform";
+        case sort_key_distribution::sorted: return "sorted";
+        case sort_key_distribution::reverse_sorted: return "reverse_sorted";
+        case sort_key_distribution::nearly_sorted: return "nearly_sorted";
+        case sort_key_distribution::few_unique: return "few_unique";
+        case sort_key_distribution::zipf: return "zipf";
+        case sort_key_distribution::low_entropy: return "low_entropy";
+        case sort_key_distribution::equal_high_bits: return "equal_high_bits";
+    }
+    return "unknown";
+}
+
+// Suffix of the names of the sort benchmarks, empty for uniform keys so the names of the
+// existing benchmarks do not change
+inline std::string get_sort_key_distribution_suffix(const sort_key_distribution distribution)
+{
+    return distribution == sort_key_distribution::uniform
+               ? std::string()
+               : std::string("/distribution:") + get_sort_key_distribution_name(distribution);
+}
+
+// Parses a comma separated list of distribution names, "all" selects every distribution
+template<class Distribution, class NameFunction>
+inline std::vector<Distribution> parse_distributions(const std::string&               names,
+                                                     const std::vector<Distribution>& all,
+                                                     NameFunction                     get_name)
+{
+    if(names == "all")
+    {
+        return all;
+    }
+    std::vector<Distribution> distributions;
+    size_t begin = 0;
+    while(begin <= names.size())
+    {
+        const size_t      end      = std::min(names.find(',', begin), names.size());
+        const std::string name     = names.substr(begin, end - begin);
+        const auto        has_name = [&](const Distribution distribution)
+        { return name == get_name(distribution); };
+        const auto it = std::find_if(all.begin(), all.end(), has_name);
+        if(it == all.end())
+        {
+            std::cout << "Unknown distribution: " << name << std::endl;
+            exit(1);
+        }
+        distributions.push_back(*it);
+        begin = end + 1;
+    }
+    return distributions;
+}
+
+inline std::vector<sort_key_distribution> parse_sort_key_distributions(const std::string& names)
+{
+    return parse_distributions(names,
+                               get_sort_key_distributions(),
+                               get_sort_key_distribution_name);
+}
+
+template<class T>
+inline auto get_random_sort_key(engine_type& gen)
+    -> typename std::enable_if<rocprim::is_integral<T>::value, T>::type
+{
+    using dis_type = typename std::conditional<
+        is_valid_for_int_distribution<T>::value,
+        T,
+        typename std::conditional<std::is_signed<T>::value, int, unsigned int>::type>::type;
+    std::uniform_int_distribution<dis_type> distribution(std::numeric_limits<T>::min(),
+                                                         std::numeric_limits<T>::max());
+    return static_cast<T>(distribution(gen));
+}
+
+template<class T>
+inline auto get_random_sort_key(engine_type& gen)
+    -> typename std::enable_if<rocprim::is_floating_point<T>::value, T>::type
+{
+    using dis_type =
+        typename std::conditional<std::is_same<rocprim::half, T>::value, float, T>::type;
+    std::uniform_real_distribution<dis_type> distribution(-1000, 1000);
+    return static_cast<T>(distribution(gen));
+}
+
+template<class T>
+inline auto get_random_sort_key(engine_type& gen)
+    -> typename std::enable_if<is_custom_type<T>::value, T>::type
+{
+    auto x = get_random_sort_key<typename T::first_type>(gen);
+    return T(x, get_random_sort_key<typename T::second_type>(gen));
+}
+
+// Combines the bits of the keys with a bitwise AND
+template<class T>
+inline auto and_sort_key_bits(const T a, const T b)
+    -> typename std::enable_if<!is_custom_type<T>::value, T>::type
+{
+    using bits_type = typename rocprim::get_unsigned_bits_type<T>::unsigned_type;
+    bits_type a_bits;
+    bits_type b_bits;
+    std::memcpy(&a_bits, &a, sizeof(T));
+    std::memcpy(&b_bits, &b, sizeof(T));
+    a_bits = static_cast<bits_type>(a_bits & b_bits);
+    T result;
+    std::memcpy(&result, &a_bits, sizeof(T));
+    return result;
+}
+
+template<class T>
+inline auto and_sort_key_bits(const T a, const T b)
+    -> typename std::enable_if<is_custom_type<T>::value, T>::type
+{
+    return T(and_sort_key_bits(a.x, b.x), and_sort_key_bits(a.y, b.y));
+}
+
+// Replaces the upper half of the bits of the key with the upper half of the bits of prefix.
+// The sign and the exponent of floating point types lie in the upper half, so the keys stay
+// finite.
+template<class T>
+inline auto set_sort_key_high_bits(const T key, const T prefix)
+    -> typename std::enable_if<!is_custom_type<T>::value, T>::type
+{
+    using bits_type = typename rocprim::get_unsigned_bits_type<T>::unsigned_type;
+    constexpr bits_type high_mask
+        = static_cast<bits_type>(std::numeric_limits<bits_type>::max() << (sizeof(T) * 8 / 2));
+    bits_type key_bits;
+    bits_type prefix_bits;
+    std::memcpy(&key_bits, &key, sizeof(T));
+    std::memcpy(&prefix_bits, &prefix, sizeof(T));
+    key_bits = static_cast<bits_type>((key_bits & ~high_mask) | (prefix_bits & high_mask));
+    T result;
+    std::memcpy(&result, &key_bits, sizeof(T));
+    return result;
+}
+
+template<class T>
+inline auto set_sort_key_high_bits(const T key, const T prefix)
+    -> typename std::enable_if<is_custom_type<T>::value, T>::type
+{
+    return T(set_sort_key_high_bits(key.x, prefix.x), set_sort_key_high_bits(key.y, prefix.y));
+}
+
+template<class T>
+struct sort_key_less
+{
+    bool operator()(const T& a, const T& b) const
+    {
+        return a < b;
+    }
+};
+
+template<>
+struct sort_key_less<rocprim::half> : half_less
+{};
+
+// Generates the keys of a sort benchmark with the given distribution. Unlike get_random_data(),
+// the whole sequence is random, as replicated blocks would change the order of the keys.
+template<class T>
+inline std::vector<T> get_sort_keys(const size_t size, const sort_key_distribution distribution)
+{
+    engine_type    gen{std::random_device{}()};
+    std::vector<T> data(size);
+    const auto     random_key = [&]() { return get_random_sort_key<T>(gen); };
+
+    if(distribution == sort_key_distribution::few_unique)
+    {
+        std::vector<T> values(16);
+        std::generate(values.begin(), values.end(), random_key);
+        std::uniform_int_distribution<size_t> index(0, values.size() - 1);
+        std::generate(data.begin(), data.end(), [&]() { return values[index(gen)]; });
+    }
+    else if(distribution == sort_key_distribution::zipf)
+    {
+        std::vector<T> values(1 << 16);
+        std::generate(values.begin(), values.end(), random_key);
+        std::vector<double> weights(values.size());
+        for(size_t i = 0; i < weights.size(); i++)
+        {
+            weights[i] = 1.0 / static_cast<double>(i + 1);
+        }
+        std::discrete_distribution<size_t> index(weights.begin(), weights.end());
+        std::generate(data.begin(), data.end(), [&]() { return values[index(gen)]; });
+    }
+    else if(distribution == sort_key_distribution::low_entropy)
+    {
+        std::generate(data.begin(),
+                      data.end(),
+                      [&]()
+                      {
+                          const T a = random_key();
+                          const T b = random_key();
+                          return and_sort_key_bits(and_sort_key_bits(a, b), random_key());
+                      });
+    }
+    else if(distribution == sort_key_distribution::equal_high_bits)
+    {
+        const T prefix = random_key();
+        std::generate(data.begin(),
+                      data.end(),
+                      [&]() { return set_sort_key_high_bits(random_key(), prefix); });
+    }
+    else
+    {
+        std::generate(data.begin(), data.end(), random_key);
+    }
+
+    if(distribution == sort_key_distribution::sorted
+       || distribution == sort_key_distribution::reverse_sorted
+       || distribution == sort_key_distribution::nearly_sorted)
+    {
+        std::sort(data.begin(), data.end(), sort_key_less<T>());
+    }
+    if(distribution == sort_key_distribution::reverse_sorted)
+    {
+        std::reverse(data.begin(), data.end());
+    }
+    if(distribution == sort_key_distribution::nearly_sorted && size > 0)
+    {
+        std::uniform_int_distribution<size_t> index(0, size - 1);
+        for(size_t i = 0; i < size / 100; i++)
+        {
+            std::swap(data[index(gen)], data[index(gen)]);
+        }
+    }
+    return data;
+}
+
+// Distributions of the lengths of the segments of the segmented benchmarks
+enum class segment_length_distribution
+{
+    uniform, // lengths spread evenly around the mean length
+    power_law, // the length of the k-th longest segment is proportional to 1/k: one huge
+               // segment and many tiny ones
+    bimodal // 90% short segments and 10% segments 100 times longer
+};
+
+inline const std::vector<segment_length_distribution>& get_segment_length_distributions()
+{
+    static const std::vector<segment_length_distribution> distributions{
+        segment_length_distribution::uniform,
+        segment_length_distribution::power_law,
+        segment_length_distribution::bimodal};
+    return distributions;
+}
+
+inline const char* get_segment_length_distribution_name(
+    const segment_length_distribution distribution)
+{
+    switch(distribution)
+    {
+        case segment_length_distribution::uniform: return "uniform";
+        case segment_length_distribution::power_law: return "power_law";
+        case segment_length_distribution::bimodal: return "bimodal";
+    }
+    return "unknown";
+}
+
+// Suffix of the names of the segmented benchmarks, empty for uniform lengths so the names of the
+// existing benchmarks do not change
+inline std::string
+    get_segment_length_distribution_suffix(const segment_length_distribution distribution)
+{
+    return distribution == segment_length_distribution::uniform
+               ? std::string()
+               : std::string("/segments:") + get_segment_length_distribution_name(distribution);
+}
+
+inline std::vector<segment_length_distribution>
+    parse_segment_length_distributions(const std::string& names)
+{
+    return parse_distributions(names,
+                               get_segment_length_distributions(),
+                               get_segment_length_distribution_name);
+}
+
+// Generates the offsets of segments which cover size items. The lengths are drawn from the
+// distribution and scaled so they add up to size, uniform lengths are in [0, 2 * size / segments].
+// The order of the segments is random, so the long segments of the skewed distributions are not
+// all at the beginning.
+template<class Offset>
+inline std::vector<Offset> get_segment_offsets(const size_t                      size,
+                                               const size_t                      segments,
+                                               const segment_length_distribution distribution,
+                                               const unsigned int                seed)
+{
+    std::default_random_engine gen(seed);
+    std::vector<double>        weights(segments);
+    if(distribution == segment_length_distribution::power_law)
+    {
+        for(size_t i = 0; i < segments; i++)
+        {
+            weights[i] = 1.0 / static_cast<double>(i + 1);
+        }
+        std::shuffle(weights.begin(), weights.end(), gen);
+    }
+    else if(distribution == segment_length_distribution::bimodal)
+    {
+        std::bernoulli_distribution            long_segment(0.1);
+        std::uniform_real_distribution<double> jitter(0.5, 1.5);
+        for(double& weight : weights)
+        {
+            weight = (long_segment(gen) ? 100.0 : 1.0) * jitter(gen);
+        }
+    }
+    else
+    {
+        std::uniform_real_distribution<double> length(0.0, 2.0);
+        for(double& weight : weights)
+        {
+            weight = length(gen);
+        }
+    }
+
+    double total = 0;
+    for(const double weight : weights)
+    {
+        total += weight;
+    }
+    std::vector<Offset> offsets(segments + 1);
+    offsets[0]    = 0;
+    double prefix = 0;
+    for(size_t i = 0; i < segments; i++)
+    {
+        prefix += weights[i];
+        offsets[i + 1] = static_cast<Offset>(
+            std::min(static_cast<double>(size), std::round(prefix / total * size)));
+    }
+    offsets[segments] = static_cast<Offset>(size);
+    return offsets;
+}
+
 inline bool is_warp_size_supported(const unsigned int required_warp_size)
 {
     return ::rocprim::host_warp_size() >= required_warp_size;
@@ -501,6 +871,19 @@ inline const char* Traits<custom_type<long long, double>>::name()
     return "custom_type<int64_t,double>";
 }
 template<>
+inline const char*
+    Traits<custom_type<custom_type<double, double>, custom_type<double, double>>>::name()
+{
+    return "custom_type<custom_double2,custom_double2>";
+}
+template<>
+inline const char*
+    Traits<custom_type<custom_type<custom_type<double, double>, custom_type<double, double>>,
+                       custom_type<custom_type<double, double>, custom_type<double, double>>>>::name()
+{
+    return "custom_type<custom_double4,custom_double4>";
+}
+template<>
 inline const char* Traits<rocprim::empty_type>::name()
 {
     return "empty_type";
@@ -516,6 +899,282 @@ inline const char* Traits<HIP_vector_type<double, 2>>::name()
     return "double2";
 }
 
+// Every thread copies 16-byte vectors in a grid-stride loop, which reaches the bandwidth of
+// device memory on all architectures supported by rocPRIM
+template<unsigned int BlockSize>
+__global__ __launch_bounds__(BlockSize) void bandwidth_copy_kernel(const uint4* input,
+                                                                   uint4*       output,
+                                                                   const size_t size)
+{
+    const size_t stride = size_t(gridDim.x) * BlockSize;
+    for(size_t i = size_t(blockIdx.x) * BlockSize + threadIdx.x; i < size; i += stride)
+    {
+        output[i] = input[i];
+    }
+}
+
+// Measures the achievable bandwidth of device memory (bytes read and written per second) with
+// a copy kernel. The buffers are much larger than the L2 cache, the best of several runs is
+// used. The measurement runs once per device, the results are cached.
+inline double get_achievable_bandwidth()
+{
+    static std::map<int, double> bandwidths;
+
+    int device_id = 0;
+    HIP_CHECK(hipGetDevice(&device_id));
+    const auto it = bandwidths.find(device_id);
+    if(it != bandwidths.end())
+    {
+        return it->second;
+    }
+
+    hipDeviceProp_t devProp;
+    HIP_CHECK(hipGetDeviceProperties(&devProp, device_id));
+
+    constexpr unsigned int block_size = 256;
+    constexpr unsigned int runs       = 10;
+    const size_t           bytes      = std::min<size_t>(
+        std::max<size_t>(size_t(256) << 20, size_t(16) * devProp.l2CacheSize),
+        devProp.totalGlobalMem / 8);
+    const size_t       size      = bytes / sizeof(uint4);
+    const unsigned int grid_size = devProp.multiProcessorCount * 8;
+
+    uint4* d_input;
+    uint4* d_output;
+    HIP_CHECK(hipMalloc(&d_input, size * sizeof(uint4)));
+    HIP_CHECK(hipMalloc(&d_output, size * sizeof(uint4)));
+    HIP_CHECK(hipMemset(d_input, 0, size * sizeof(uint4)));
+
+    hipEvent_t start, stop;
+    HIP_CHECK(hipEventCreate(&start));
+    HIP_CHECK(hipEventCreate(&stop));
+
+    // Warm-up
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(bandwidth_copy_kernel<block_size>),
+                       dim3(grid_size),
+                       dim3(block_size),
+                       0,
+                       0,
+                       d_input,
+                       d_output,
+                       size);
+    HIP_CHECK(hipGetLastError());
+    HIP_CHECK(hipDeviceSynchronize());
+
+    float best_ms = std::numeric_limits<float>::max();
+    for(unsigned int run = 0; run < runs; run++)
+    {
+        HIP_CHECK(hipEventRecord(start, 0));
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(bandwidth_copy_kernel<block_size>),
+                           dim3(grid_size),
+                           dim3(block_size),
+                           0,
+                           0,
+                           d_input,
+                           d_output,
+                           size);
+        HIP_CHECK(hipGetLastError());
+        HIP_CHECK(hipEventRecord(stop, 0));
+        HIP_CHECK(hipEventSynchronize(stop));
+
+        float elapsed_ms;
+        HIP_CHECK(hipEventElapsedTime(&elapsed_ms, start, stop));
+        best_ms = std::min(best_ms, elapsed_ms);
+    }
+
+    HIP_CHECK(hipEventDestroy(start));
+    HIP_CHECK(hipEventDestroy(stop));
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+
+    const double bandwidth = 2.0 * size * sizeof(uint4) / (best_ms / 1000.0);
+    bandwidths[device_id]  = bandwidth;
+    return bandwidth;
+}
+
+// Reports the memory traffic of a device-level benchmark: `bytes_per_element` is the number of
+// bytes which an algorithm must read and write at least per item of the input (for example
+// 2 * sizeof(T) for a scan), `bandwidth_pct` is the bandwidth of this traffic as a percentage
+// of the achievable bandwidth measured by get_achievable_bandwidth(). `items` is the number of
+// items processed per iteration.
+inline void add_bandwidth_counters(benchmark::State& state,
+                                   const size_t      items,
+                                   const size_t      bytes_per_element)
+{
+    const double bytes = static_cast<double>(state.iterations()) * items * bytes_per_element;
+    state.counters["bytes_per_element"] = static_cast<double>(bytes_per_element);
+    state.counters["bandwidth_pct"]
+        = benchmark::Counter(100.0 * bytes / get_achievable_bandwidth(),
+                             benchmark::Counter::kIsRate);
+}
+
+// Measures the energy used by the device during the loop of a device-level benchmark with the
+// energy counter of the ROCm SMI library. The meter is constructed right before the loop and
+// add_counters() is called after it, `items` is the number of items processed per iteration.
+// It reports the energy per item (`nj_per_element`) and the average power (`avg_power_w`) of
+// the whole loop. The counters are only added if the benchmarks are built with
+// BENCHMARK_ENERGY and the device supports the energy counter.
+class device_energy_meter
+{
+public:
+    device_energy_meter()
+    {
+#ifdef BENCHMARK_ENERGY
+        device_ = get_smi_device();
+        valid_  = device_ != invalid_device && read(start_energy_, start_timestamp_);
+#endif
+    }
+
+    void add_counters(benchmark::State& state, const size_t items) const
+    {
+#ifdef BENCHMARK_ENERGY
+        double   energy;
+        uint64_t timestamp;
+        if(!valid_ || !read(energy, timestamp) || timestamp <= start_timestamp_)
+        {
+            return;
+        }
+        const double joules  = (energy - start_energy_) * 1e-6;
+        const double seconds = (timestamp - start_timestamp_) * 1e-9;
+        state.counters["nj_per_element"]
+            = 1e9 * joules / (static_cast<double>(state.iterations()) * items);
+        state.counters["avg_power_w"] = joules / seconds;
+#else
+        (void)state;
+        (void)items;
+#endif
+    }
+
+#ifdef BENCHMARK_ENERGY
+private:
+    static constexpr uint32_t invalid_device = std::numeric_limits<uint32_t>::max();
+
+    // The SMI index of the current HIP device, they are matched by their PCI addresses
+    static uint32_t get_smi_device()
+    {
+        static std::map<int, uint32_t> devices;
+
+        int device_id = 0;
+        HIP_CHECK(hipGetDevice(&device_id));
+        const auto it = devices.find(device_id);
+        if(it != devices.end())
+        {
+            return it->second;
+        }
+
+        static const bool initialized = rsmi_init(0) == RSMI_STATUS_SUCCESS;
+        uint32_t          smi_device  = invalid_device;
+        uint32_t          count       = 0;
+        if(initialized && rsmi_num_monitor_devices(&count) == RSMI_STATUS_SUCCESS)
+        {
+            hipDeviceProp_t devProp;
+            HIP_CHECK(hipGetDeviceProperties(&devProp, device_id));
+            for(uint32_t i = 0; i < count; i++)
+            {
+                // Bits 63:32 are the domain, 15:8 the bus and 7:3 the device
+                uint64_t bdfid;
+                if(rsmi_dev_pci_id_get(i, &bdfid) == RSMI_STATUS_SUCCESS
+                   && (bdfid >> 32) == static_cast<uint64_t>(devProp.pciDomainID)
+                   && ((bdfid >> 8) & 0xff) == static_cast<uint64_t>(devProp.pciBusID)
+                   && ((bdfid >> 3) & 0x1f) == static_cast<uint64_t>(devProp.pciDeviceID))
+                {
+                    smi_device = i;
+                    break;
+                }
+            }
+        }
+        if(smi_device == invalid_device)
+        {
+            std::cout << "ROCm SMI device of HIP device " << device_id
+                      << " not found, the energy is not reported" << std::endl;
+        }
+        devices[device_id] = smi_device;
+        return smi_device;
+    }
+
+    // The accumulated energy of the device in microjoules and its timestamp in nanoseconds
+    bool read(double& energy, uint64_t& timestamp) const
+    {
+        uint64_t counter;
+        float    resolution;
+        if(rsmi_dev_energy_count_get(device_, &counter, &resolution, &timestamp)
+           != RSMI_STATUS_SUCCESS)
+        {
+            return false;
+        }
+        energy = static_cast<double>(counter) * resolution;
+        return true;
+    }
+
+    uint32_t device_          = invalid_device;
+    bool     valid_           = false;
+    double   start_energy_    = 0;
+    uint64_t start_timestamp_ = 0;
+#endif
+};
+
+inline const char* get_lookback_backoff_name(const rocprim::lookback_backoff backoff)
+{
+    switch(backoff)
+    {
+        case rocprim::lookback_backoff::automatic: return "automatic";
+        case rocprim::lookback_backoff::spin: return "spin";
+        case rocprim::lookback_backoff::exponential_sleep: return "exponential_sleep";
+        case rocprim::lookback_backoff::bounded_sleep: return "bounded_sleep";
+            // Not using `default: ...` because it kills effectiveness of -Wswitch
+    }
+    return "unknown_backoff";
+}
+
+// Runs instances of a device-level algorithm concurrently on stream_count streams, so their
+// kernels contend for the device like the ones of an application with many streams.
+// `algorithm(instance, stream)` enqueues the call of the instance and returns its hipError_t,
+// the time of an iteration is the time until all streams are finished.
+template<class Algorithm>
+inline void run_concurrent_streams_benchmark(benchmark::State&  state,
+                                             const unsigned int stream_count,
+                                             Algorithm          algorithm)
+{
+    std::vector<hipStream_t> streams(stream_count);
+    for(hipStream_t& stream : streams)
+    {
+        HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+    }
+    const auto run_all = [&]()
+    {
+        for(unsigned int instance = 0; instance < stream_count; instance++)
+        {
+            HIP_CHECK(algorithm(instance, streams[instance]));
+        }
+        for(const hipStream_t stream : streams)
+        {
+            HIP_CHECK(hipStreamSynchronize(stream));
+        }
+    };
+
+    // Warm-up
+    for(unsigned int i = 0; i < 5; i++)
+    {
+        run_all();
+    }
+
+    for(auto _ : state)
+    {
+        const auto start = std::chrono::high_resolution_clock::now();
+        run_all();
+        const auto end = std::chrono::high_resolution_clock::now();
+
+        auto elapsed_seconds
+            = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+
+    for(const hipStream_t stream : streams)
+    {
+        HIP_CHECK(hipStreamDestroy(stream));
+    }
+}
+
 inline void add_common_benchmark_info()
 {
     hipDeviceProp_t   devProp;
@@ -611,6 +1270,8 @@ inline void add_common_benchmark_info()
     num("hdp_arch_has_surface_funcs", arch.hasSurfaceFuncs);
     num("hdp_arch_has_3d_grid", arch.has3dGrid);
     num("hdp_arch_has_dynamic_parallelism", arch.hasDynamicParallelism);
+
+    num("achievable_bandwidth_gb_per_s", get_achievable_bandwidth() / 1e9);
 }
 
 #endif // ROCPRIM_BENCHMARK_UTILS_HPP_
@@ -106,6 +106,32 @@ struct StripedToBlockedShuffleOp
     }
 };
 
+// The same as BlockedToStripedOp and StripedToBlockedOp, with warp_exchange_algorithm::shuffle,
+// the storage is empty
+struct BlockedToStripedShuffleAlgorithmOp : BlockedToStripedOp
+{};
+
+struct StripedToBlockedShuffleAlgorithmOp : StripedToBlockedOp
+{};
+
+template<class Op>
+struct exchange_op_algorithm
+    : std::integral_constant<rocprim::warp_exchange_algorithm,
+                             rocprim::warp_exchange_algorithm::shared_memory>
+{};
+
+template<>
+struct exchange_op_algorithm<BlockedToStripedShuffleAlgorithmOp>
+    : std::integral_constant<rocprim::warp_exchange_algorithm,
+                             rocprim::warp_exchange_algorithm::shuffle>
+{};
+
+template<>
+struct exchange_op_algorithm<StripedToBlockedShuffleAlgorithmOp>
+    : std::integral_constant<rocprim::warp_exchange_algorithm,
+                             rocprim::warp_exchange_algorithm::shuffle>
+{};
+
 struct ScatterToStripedOp
 {
     template<
@@ -147,7 +173,8 @@ auto warp_exchange_kernel(T* d_output, unsigned int trials) -> typename std::ena
     using warp_exchange_type = ::rocprim::warp_exchange<
         T,
         ItemsPerThread,
-        DeviceSelectWarpSize<LogicalWarpSize>::value
+        DeviceSelectWarpSize<LogicalWarpSize>::value,
+        exchange_op_algorithm<Op>::value
     >;
     constexpr unsigned int warps_in_block = BlockSize / LogicalWarpSize;
     const unsigned int warp_id = hipThreadIdx_x / LogicalWarpSize;
@@ -321,6 +348,29 @@ int main(int argc, char *argv[])
         CREATE_BENCHMARK(int, 256, 16, 16, StripedToBlockedShuffleOp),
         CREATE_BENCHMARK(int, 256, 16, 32, StripedToBlockedShuffleOp),
 
+        CREATE_BENCHMARK(int, 256,  1, 16, BlockedToStripedShuffleAlgorithmOp),
+        CREATE_BENCHMARK(int, 256,  1, 32, BlockedToStripedShuffleAlgorithmOp),
+        CREATE_BENCHMARK(int, 256,  4, 16, BlockedToStripedShuffleAlgorithmOp),
+        CREATE_BENCHMARK(int, 256,  4, 32, BlockedToStripedShuffleAlgorithmOp),
+        CREATE_BENCHMARK(int, 256,  8, 32, BlockedToStripedShuffleAlgorithmOp),
+        CREATE_BENCHMARK(double, 256, 8, 32, BlockedToStripedShuffleAlgorithmOp),
+        CREATE_BENCHMARK(int, 256, 16, 16, BlockedToStripedShuffleAlgorithmOp),
+        CREATE_BENCHMARK(int, 256, 16, 32, BlockedToStripedShuffleAlgorithmOp),
+
+        CREATE_BENCHMARK(int, 256,  1, 16, StripedToBlockedShuffleAlgorithmOp),
+        CREATE_BENCHMARK(int, 256,  1, 32, StripedToBlockedShuffleAlgorithmOp),
+        CREATE_BENCHMARK(int, 256,  4, 16, StripedToBlockedShuffleAlgorithmOp),
+        CREATE_BENCHMARK(int, 256,  4, 32, StripedToBlockedShuffleAlgorithmOp),
+        CREATE_BENCHMARK(int, 256,  8, 32, StripedToBlockedShuffleAlgorithmOp),
+        CREATE_BENCHMARK(double, 256, 8, 32, StripedToBlockedShuffleAlgorithmOp),
+        CREATE_BENCHMARK(int, 256, 16, 16, StripedToBlockedShuffleAlgorithmOp),
+        CREATE_BENCHMARK(int, 256, 16, 32, StripedToBlockedShuffleAlgorithmOp),
+
+        CREATE_BENCHMARK(int, 256,  8, 32, BlockedToStripedOp),
+        CREATE_BENCHMARK(double, 256, 8, 32, BlockedToStripedOp),
+        CREATE_BENCHMARK(int, 256,  8, 32, StripedToBlockedOp),
+        CREATE_BENCHMARK(double, 256, 8, 32, StripedToBlockedOp),
+
         CREATE_BENCHMARK(int, 256,  1, 16, ScatterToStripedOp),
         CREATE_BENCHMARK(int, 256,  1, 32, ScatterToStripedOp),
         CREATE_BENCHMARK(int, 256,  4, 16, ScatterToStripedOp),
@@ -348,6 +398,14 @@ int main(int argc, char *argv[])
             CREATE_BENCHMARK(int, 256,  4, 64, StripedToBlockedShuffleOp),
             CREATE_BENCHMARK(int, 256, 16, 64, StripedToBlockedShuffleOp),
 
+            CREATE_BENCHMARK(int, 256,  1, 64, BlockedToStripedShuffleAlgorithmOp),
+            CREATE_BENCHMARK(int, 256,  4, 64, BlockedToStripedShuffleAlgorithmOp),
+            CREATE_BENCHMARK(int, 256, 16, 64, BlockedToStripedShuffleAlgorithmOp),
+
+            CREATE_BENCHMARK(int, 256,  1, 64, StripedToBlockedShuffleAlgorithmOp),
+            CREATE_BENCHMARK(int, 256,  4, 64, StripedToBlockedShuffleAlgorithmOp),
+            CREATE_BENCHMARK(int, 256, 16, 64, StripedToBlockedShuffleAlgorithmOp),
+
             CREATE_BENCHMARK(int, 256,  1, 64, ScatterToStripedOp),
             CREATE_BENCHMARK(int, 256,  4, 64, ScatterToStripedOp),
             CREATE_BENCHMARK(int, 256, 16, 64, ScatterToStripedOp)
@@ -0,0 +1,239 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+// Google Benchmark
+#include "benchmark/benchmark.h"
+// CmdParser
+#include "cmdparser.hpp"
+#include "benchmark_utils.hpp"
+
+// HIP API
+#include <hip/hip_runtime.h>
+#include <rocprim/warp/warp_load.hpp>
+#include <rocprim/warp/warp_store.hpp>
+
+#ifndef DEFAULT_N
+const size_t DEFAULT_N = 1024 * 1024 * 32;
+#endif
+
+// Every warp copies its tile with warp_load and warp_store, a tile per warp like in kernels that
+// process a row per warp. When Guarded is true the tiles are copied with the guarded loads and
+// stores, and the last thread of a warp has only half of its items valid.
+template<
+    class T,
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int LogicalWarpSize,
+    rocprim::warp_load_method LoadMethod,
+    rocprim::warp_store_method StoreMethod,
+    bool Guarded
+>
+__global__
+__launch_bounds__(BlockSize)
+void warp_load_store_kernel(T* d_input, T* d_output, unsigned int trials)
+{
+    using warp_load_type = rocprim::warp_load<
+        T,
+        ItemsPerThread,
+        DeviceSelectWarpSize<LogicalWarpSize>::value,
+        LoadMethod
+    >;
+    using warp_store_type = rocprim::warp_store<
+        T,
+        ItemsPerThread,
+        DeviceSelectWarpSize<LogicalWarpSize>::value,
+        StoreMethod
+    >;
+
+    constexpr unsigned int tile_size      = LogicalWarpSize * ItemsPerThread;
+    constexpr unsigned int warps_in_block = BlockSize / LogicalWarpSize;
+    constexpr unsigned int valid          = tile_size - ItemsPerThread / 2;
+    const unsigned int     warp_id        = hipThreadIdx_x / LogicalWarpSize;
+    const unsigned int     offset         = (hipBlockIdx_x * warps_in_block + warp_id) * tile_size;
+
+    ROCPRIM_SHARED_MEMORY union
+    {
+        typename warp_load_type::storage_type  load;
+        typename warp_store_type::storage_type store;
+    } storage[warps_in_block];
+
+    ROCPRIM_NO_UNROLL
+    for(unsigned int trial = 0; trial < trials; trial++)
+    {
+        T items[ItemsPerThread];
+        if(Guarded)
+        {
+            warp_load_type().load(d_input + offset, items, valid, T(0), storage[warp_id].load);
+            rocprim::wave_barrier();
+            warp_store_type().store(d_output + offset, items, valid, storage[warp_id].store);
+        }
+        else
+        {
+            warp_load_type().load(d_input + offset, items, storage[warp_id].load);
+            rocprim::wave_barrier();
+            warp_store_type().store(d_output + offset, items, storage[warp_id].store);
+        }
+        rocprim::wave_barrier();
+    }
+}
+
+template<
+    class T,
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int LogicalWarpSize,
+    rocprim::warp_load_method LoadMethod,
+    rocprim::warp_store_method StoreMethod,
+    bool Guarded = false
+>
+void run_benchmark(benchmark::State& state, hipStream_t stream, size_t N)
+{
+    constexpr unsigned int trials = 100;
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    const unsigned int size = items_per_block * ((N + items_per_block - 1) / items_per_block);
+
+    std::vector<T> input = get_random_data<T>(size, T(0), T(100));
+    T* d_input;
+    T* d_output;
+    HIP_CHECK(hipMalloc(&d_input, size * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_output, size * sizeof(T)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(warp_load_store_kernel<
+                    T,
+                    BlockSize,
+                    ItemsPerThread,
+                    LogicalWarpSize,
+                    LoadMethod,
+                    StoreMethod,
+                    Guarded
+                >
+            ),
+            dim3(size / items_per_block), dim3(BlockSize), 0, stream,
+            d_input, d_output, trials
+        );
+
+        HIP_CHECK(hipPeekAtLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds =
+            std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    // Every item is read and written in a trial
+    state.SetBytesProcessed(state.iterations() * trials * size * sizeof(T) * 2);
+    state.SetItemsProcessed(state.iterations() * trials * size);
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
+
+#define CREATE_BENCHMARK(T, BS, IT, WS, LM, SM, G) \
+benchmark::RegisterBenchmark( \
+    "warp_load_store<"#T", "#BS", "#IT", "#WS", "#LM", "#SM", guarded: "#G">.", \
+    &run_benchmark<T, BS, IT, WS, \
+                   rocprim::warp_load_method::LM, rocprim::warp_store_method::SM, G>, \
+    stream, size \
+)
+
+#define CREATE_BENCHMARKS(T, BS, IT, WS, G) \
+    CREATE_BENCHMARK(T, BS, IT, WS, warp_load_direct, warp_store_direct, G), \
+    CREATE_BENCHMARK(T, BS, IT, WS, warp_load_striped, warp_store_striped, G), \
+    CREATE_BENCHMARK(T, BS, IT, WS, warp_load_vectorize, warp_store_vectorize, G), \
+    CREATE_BENCHMARK(T, BS, IT, WS, warp_load_transpose, warp_store_transpose, G)
+
+int main(int argc, char *argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of values");
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const size_t size = parser.get<size_t>("size");
+    const int trials = parser.get<int>("trials");
+
+    // HIP
+    hipStream_t stream = 0; // default
+
+    // Benchmark info
+    add_common_benchmark_info();
+    benchmark::AddCustomContext("size", std::to_string(size));
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks{
+        CREATE_BENCHMARKS(int, 256,  4, 16, false),
+        CREATE_BENCHMARKS(int, 256,  4, 32, false),
+        CREATE_BENCHMARKS(int, 256, 16, 32, false),
+        CREATE_BENCHMARKS(double, 256, 4, 32, false),
+
+        CREATE_BENCHMARKS(int, 256,  4, 32, true),
+        CREATE_BENCHMARKS(int, 256, 16, 32, true)
+    };
+
+    if(is_warp_size_supported(64))
+    {
+        std::vector<benchmark::internal::Benchmark*> additional_benchmarks{
+            CREATE_BENCHMARKS(int, 256,  4, 64, false),
+            CREATE_BENCHMARKS(int, 256, 16, 64, false),
+            CREATE_BENCHMARKS(int, 256,  4, 64, true)
+        };
+        benchmarks.insert(
+            benchmarks.end(),
+            additional_benchmarks.begin(),
+            additional_benchmarks.end()
+        );
+    }
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for (auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
@@ -27,6 +27,7 @@
 #include <string>
 #include <cstdio>
 #include <cstdlib>
+#include <numeric>
 
 // Google Benchmark
 #include "benchmark/benchmark.h"
@@ -52,7 +53,7 @@ template<
 >
 __global__
 __launch_bounds__(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE)
-void warp_reduce_kernel(const T * d_input, T * d_output)
+void warp_reduce_kernel(const T * d_input, T * d_output, long long * d_cycles)
 {
     const unsigned int i = blockIdx.x * blockDim.x + threadIdx.x;
 
@@ -60,13 +61,19 @@ void warp_reduce_kernel(const T * d_input, T * d_output)
 
     using wreduce_t = rocprim::warp_reduce<T, WarpSize, AllReduce>;
     __shared__ typename wreduce_t::storage_type storage;
+    const long long start = clock64();
     ROCPRIM_NO_UNROLL
     for(unsigned int trial = 0; trial < Trials; trial++)
     {
         wreduce_t().reduce(value, value, storage);
     }
+    const long long end = clock64();
 
     d_output[i] = value;
+    if(threadIdx.x == 0)
+    {
+        d_cycles[blockIdx.x] = end - start;
+    }
 }
 
 template<
@@ -77,7 +84,7 @@ template<
 >
 __global__
 __launch_bounds__(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE)
-void segmented_warp_reduce_kernel(const T* d_input, Flag* d_flags, T* d_output)
+void segmented_warp_reduce_kernel(const T* d_input, Flag* d_flags, T* d_output, long long* d_cycles)
 {
     const unsigned int i = blockIdx.x * blockDim.x + threadIdx.x;
 
@@ -86,13 +93,19 @@ void segmented_warp_reduce_kernel(const T* d_input, Flag* d_flags, T* d_output)
 
     using wreduce_t = rocprim::warp_reduce<T, WarpSize>;
     __shared__ typename wreduce_t::storage_type storage;
+    const long long start = clock64();
     ROCPRIM_NO_UNROLL
     for(unsigned int trial = 0; trial < Trials; trial++)
     {
         wreduce_t().head_segmented_reduce(value, value, flag, storage);
     }
+    const long long end = clock64();
 
     d_output[i] = value;
+    if(threadIdx.x == 0)
+    {
+        d_cycles[blockIdx.x] = end - start;
+    }
 }
 
 template<
@@ -105,14 +118,14 @@ template<
     class Flag
 >
 inline
-auto execute_warp_reduce_kernel(T* input, T* output, Flag* /* flags */,
+auto execute_warp_reduce_kernel(T* input, T* output, Flag* /* flags */, long long* cycles,
                                 size_t size, hipStream_t stream)
     -> typename std::enable_if<!Segmented>::type
 {
     hipLaunchKernelGGL(
         HIP_KERNEL_NAME(warp_reduce_kernel<AllReduce, T, WarpSize, Trials>),
         dim3(size/BlockSize), dim3(BlockSize), 0, stream,
-        input, output
+        input, output, cycles
     );
     HIP_CHECK(hipGetLastError());
 }
@@ -127,14 +140,14 @@ template<
     class Flag
 >
 inline
-auto execute_warp_reduce_kernel(T* input, T* output, Flag* flags,
+auto execute_warp_reduce_kernel(T* input, T* output, Flag* flags, long long* cycles,
                                 size_t size, hipStream_t stream)
     -> typename std::enable_if<Segmented>::type
 {
     hipLaunchKernelGGL(
         HIP_KERNEL_NAME(segmented_warp_reduce_kernel<T, Flag, WarpSize, Trials>),
         dim3(size/BlockSize), dim3(BlockSize), 0, stream,
-        input, flags, output
+        input, flags, output, cycles
     );
     HIP_CHECK(hipGetLastError());
 }
@@ -152,15 +165,18 @@ void run_benchmark(benchmark::State& state, hipStream_t stream, size_t N)
     using flag_type = unsigned char;
 
     const auto size = BlockSize * ((N + BlockSize - 1)/BlockSize);
+    const auto blocks = size / BlockSize;
 
     std::vector<T> input = get_random_data<T>(size, T(0), T(10));
     std::vector<flag_type> flags = get_random_data<flag_type>(size, 0, 1);
     T * d_input;
     flag_type * d_flags;
     T * d_output;
+    long long * d_cycles;
     HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&d_input), size * sizeof(T)));
     HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&d_flags), size * sizeof(flag_type)));
     HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&d_output), size * sizeof(T)));
+    HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&d_cycles), blocks * sizeof(long long)));
     HIP_CHECK(
         hipMemcpy(
             d_input, input.data(),
@@ -181,7 +197,7 @@ void run_benchmark(benchmark::State& state, hipStream_t stream, size_t N)
     {
         auto start = std::chrono::high_resolution_clock::now();
         execute_warp_reduce_kernel<AllReduce, Segmented, WarpSize, BlockSize, Trials>(
-            d_input, d_output, d_flags, size, stream
+            d_input, d_output, d_flags, d_cycles, size, stream
         );
         HIP_CHECK(hipDeviceSynchronize());
 
@@ -193,9 +209,22 @@ void run_benchmark(benchmark::State& state, hipStream_t stream, size_t N)
     state.SetBytesProcessed(state.iterations() * Trials * size * sizeof(T));
     state.SetItemsProcessed(state.iterations() * Trials * size);
 
+    // Device clock cycles of one warp-level operation, averaged over the blocks of the last launch
+    std::vector<long long> cycles(blocks);
+    HIP_CHECK(
+        hipMemcpy(
+            cycles.data(), d_cycles,
+            blocks * sizeof(long long),
+            hipMemcpyDeviceToHost
+        )
+    );
+    const double total_cycles = std::accumulate(cycles.begin(), cycles.end(), 0.0);
+    state.counters["cycles_per_op"] = total_cycles / (blocks * Trials);
+
     HIP_CHECK(hipFree(d_input));
     HIP_CHECK(hipFree(d_output));
     HIP_CHECK(hipFree(d_flags));
+    HIP_CHECK(hipFree(d_cycles));
 }
 
 #define CREATE_BENCHMARK(T, WS, BS) \
@@ -205,11 +234,18 @@ benchmark::RegisterBenchmark( \
     stream, size \
 )
 
+// Logical warps which fit in a wave32 (RDNA) hardware warp
 #define BENCHMARK_TYPE(type) \
+    CREATE_BENCHMARK(type, 16, 64), \
     CREATE_BENCHMARK(type, 32, 64), \
+    CREATE_BENCHMARK(type, 32, 256)
+
+// Logical warps which require a wave64 hardware warp
+#define BENCHMARK_TYPE_WS64(type) \
     CREATE_BENCHMARK(type, 37, 64), \
     CREATE_BENCHMARK(type, 61, 64), \
-    CREATE_BENCHMARK(type, 64, 64)
+    CREATE_BENCHMARK(type, 64, 64), \
+    CREATE_BENCHMARK(type, 64, 256)
 
 template<bool AllReduce, bool Segmented>
 void add_benchmarks(const std::string& name,
@@ -227,6 +263,20 @@ void add_benchmarks(const std::string& name,
         BENCHMARK_TYPE(rocprim::half)
     };
 
+    if(is_warp_size_supported(64))
+    {
+        std::vector<benchmark::internal::Benchmark*> additional_benchmarks =
+        {
+            BENCHMARK_TYPE_WS64(int),
+            BENCHMARK_TYPE_WS64(float),
+            BENCHMARK_TYPE_WS64(double),
+            BENCHMARK_TYPE_WS64(int8_t),
+            BENCHMARK_TYPE_WS64(uint8_t),
+            BENCHMARK_TYPE_WS64(rocprim::half)
+        };
+        bs.insert(bs.end(), additional_benchmarks.begin(), additional_benchmarks.end());
+    }
+
     benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
 }
 
@@ -27,6 +27,7 @@
 #include <string>
 #include <cstdio>
 #include <cstdlib>
+#include <numeric>
 
 // Google Benchmark
 #include "benchmark/benchmark.h"
@@ -48,39 +49,51 @@ namespace rp = rocprim;
 template<class T, unsigned int WarpSize, unsigned int Trials>
 __global__
 __launch_bounds__(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE)
-void warp_inclusive_scan_kernel(const T* input, T* output)
+void warp_inclusive_scan_kernel(const T* input, T* output, long long* cycles)
 {
     const unsigned int i = blockIdx.x * blockDim.x + threadIdx.x;
     auto value = input[i];
 
     using wscan_t = rp::warp_scan<T, WarpSize>;
     __shared__ typename wscan_t::storage_type storage;
+    const long long start = clock64();
     ROCPRIM_NO_UNROLL
     for(unsigned int trial = 0; trial < Trials; trial++)
     {
         wscan_t().inclusive_scan(value, value, storage);
     }
+    const long long end = clock64();
 
     output[i] = value;
+    if(threadIdx.x == 0)
+    {
+        cycles[blockIdx.x] = end - start;
+    }
 }
 
 template<class T, unsigned int WarpSize, unsigned int Trials>
 __global__
 __launch_bounds__(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE)
-void warp_exclusive_scan_kernel(const T* input, T* output, const T init)
+void warp_exclusive_scan_kernel(const T* input, T* output, const T init, long long* cycles)
 {
     const unsigned int i = blockIdx.x * blockDim.x + threadIdx.x;
     auto value = input[i];
 
     using wscan_t = rp::warp_scan<T, WarpSize>;
     __shared__ typename wscan_t::storage_type storage;
+    const long long start = clock64();
     ROCPRIM_NO_UNROLL
     for(unsigned int trial = 0; trial < Trials; trial++)
     {
         wscan_t().exclusive_scan(value, value, init, storage);
     }
+    const long long end = clock64();
 
     output[i] = value;
+    if(threadIdx.x == 0)
+    {
+        cycles[blockIdx.x] = end - start;
+    }
 }
 
 template<
@@ -94,12 +107,15 @@ void run_benchmark(benchmark::State& state, hipStream_t stream, size_t size)
 {
     // Make sure size is a multiple of BlockSize
     size = BlockSize * ((size + BlockSize - 1)/BlockSize);
+    const size_t blocks = size / BlockSize;
     // Allocate and fill memory
     std::vector<T> input(size, (T)1);
     T * d_input;
     T * d_output;
+    long long * d_cycles;
     HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&d_input), size * sizeof(T)));
     HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&d_output), size * sizeof(T)));
+    HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&d_cycles), blocks * sizeof(long long)));
     HIP_CHECK(
         hipMemcpy(
             d_input, input.data(),
@@ -117,7 +133,7 @@ void run_benchmark(benchmark::State& state, hipStream_t stream, size_t size)
             hipLaunchKernelGGL(
                 HIP_KERNEL_NAME(warp_inclusive_scan_kernel<T, WarpSize, Trials>),
                 dim3(size/BlockSize), dim3(BlockSize), 0, stream,
-                d_input, d_output
+                d_input, d_output, d_cycles
             );
         }
         else
@@ -125,7 +141,7 @@ void run_benchmark(benchmark::State& state, hipStream_t stream, size_t size)
             hipLaunchKernelGGL(
                 HIP_KERNEL_NAME(warp_exclusive_scan_kernel<T, WarpSize, Trials>),
                 dim3(size/BlockSize), dim3(BlockSize), 0, stream,
-                d_input, d_output, input[0]
+                d_input, d_output, input[0], d_cycles
             );
         }
         HIP_CHECK(hipGetLastError());
@@ -140,8 +156,21 @@ void run_benchmark(benchmark::State& state, hipStream_t stream, size_t size)
     state.SetBytesProcessed(state.iterations() * size * sizeof(T) * Trials);
     state.SetItemsProcessed(state.iterations() * size * Trials);
 
+    // Device clock cycles of one warp-level operation, averaged over the blocks of the last launch
+    std::vector<long long> cycles(blocks);
+    HIP_CHECK(
+        hipMemcpy(
+            cycles.data(), d_cycles,
+            blocks * sizeof(long long),
+            hipMemcpyDeviceToHost
+        )
+    );
+    const double total_cycles = std::accumulate(cycles.begin(), cycles.end(), 0.0);
+    state.counters["cycles_per_op"] = total_cycles / (blocks * Trials);
+
     HIP_CHECK(hipFree(d_input));
     HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipFree(d_cycles));
 }
 
 #define CREATE_BENCHMARK(T, BS, WS, INCLUSIVE) \
@@ -151,16 +180,22 @@ void run_benchmark(benchmark::State& state, hipStream_t stream, size_t size)
         stream, size \
     )
 
+// Logical warps which fit in a wave32 (RDNA) hardware warp
 #define BENCHMARK_TYPE(type) \
-    CREATE_BENCHMARK(type, 64, 64, Inclusive), \
-    CREATE_BENCHMARK(type, 128, 64, Inclusive), \
-    CREATE_BENCHMARK(type, 256, 64, Inclusive), \
+    CREATE_BENCHMARK(type, 64, 32, Inclusive), \
+    CREATE_BENCHMARK(type, 128, 32, Inclusive), \
     CREATE_BENCHMARK(type, 256, 32, Inclusive), \
     CREATE_BENCHMARK(type, 256, 16, Inclusive), \
-    CREATE_BENCHMARK(type, 63, 63, Inclusive), \
     CREATE_BENCHMARK(type, 62, 31, Inclusive), \
     CREATE_BENCHMARK(type, 60, 15, Inclusive)
 
+// Logical warps which require a wave64 hardware warp
+#define BENCHMARK_TYPE_WS64(type) \
+    CREATE_BENCHMARK(type, 64, 64, Inclusive), \
+    CREATE_BENCHMARK(type, 128, 64, Inclusive), \
+    CREATE_BENCHMARK(type, 256, 64, Inclusive), \
+    CREATE_BENCHMARK(type, 63, 63, Inclusive)
+
 template<bool Inclusive>
 void add_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
                     const std::string& method_name,
@@ -181,6 +216,23 @@ void add_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
         BENCHMARK_TYPE(custom_double2),
         BENCHMARK_TYPE(custom_int_double)
     };
+    if(is_warp_size_supported(64))
+    {
+        std::vector<benchmark::internal::Benchmark*> additional_benchmarks =
+        {
+            BENCHMARK_TYPE_WS64(int),
+            BENCHMARK_TYPE_WS64(float),
+            BENCHMARK_TYPE_WS64(double),
+            BENCHMARK_TYPE_WS64(int8_t),
+            BENCHMARK_TYPE_WS64(uint8_t),
+            BENCHMARK_TYPE_WS64(rocprim::half),
+            BENCHMARK_TYPE_WS64(custom_double2),
+            BENCHMARK_TYPE_WS64(custom_int_double)
+        };
+        new_benchmarks.insert(new_benchmarks.end(),
+                              additional_benchmarks.begin(),
+                              additional_benchmarks.end());
+    }
     benchmarks.insert(benchmarks.end(), new_benchmarks.begin(), new_benchmarks.end());
 }
 
@@ -39,5 +39,6 @@ function(print_configuration_summary)
   message(STATUS "  BUILD_TEST                : ${BUILD_TEST}")
   message(STATUS "  BUILD_BENCHMARK           : ${BUILD_BENCHMARK}")
   message(STATUS "  BUILD_EXAMPLE             : ${BUILD_EXAMPLE}")
+  message(STATUS "  BUILD_INSTANTIATIONS      : ${BUILD_INSTANTIATIONS}")
   message(STATUS "  USE_HIP_CPU               : ${USE_HIP_CPU}")
 endfunction()
@@ -1145,6 +1145,283 @@ public:
         base_type::template apply_right_partial<as_flags, reversed>(
             input, output, op, valid_items, storage.get().right);
     }
+    /// \brief Apply a function to each consecutive pair of elements of the same segment
+    /// partitioned across threads in the block and write the output to the position of the left
+    /// item.
+    ///
+    /// Segments are given by head flags: an item with its head flag set is the first item of its
+    /// segment, it is not combined with the last item of the previous segment.
+    /// \code
+    /// output[0] = input[0]
+    /// // For each i in [1, block_size * ItemsPerThread) across threads in a block
+    /// output[i] = head_flags[i] ? input[i] : op(input[i], input[i-1]);
+    /// \endcode
+    ///
+    /// \tparam Output - [inferred] the type of output, must be assignable from the result of `op`
+    /// and from `T`
+    /// \tparam ItemsPerThread - [inferred] the number of items processed by each thread
+    /// \tparam Flag - [inferred] the type of the head flags, must be contextually convertible
+    /// to `bool`
+    /// \tparam BinaryFunction - [inferred] the type of the function to apply
+    /// \param [in] input - array that data is loaded from partitioned across the threads in the block
+    /// \param [out] output - array where the result of function application will be written to
+    /// \param [in] head_flags - array of the head flags of the items partitioned across the threads
+    /// in the block
+    /// \param [in] op - binary function applied to the items.
+    /// The signature of the function should be equivalent to the following:
+    /// `bool f(const T &a, const T &b)` The signature does not need to have
+    /// `const &` but the function object must not modify the objects passed to it.
+    /// \param storage - reference to a temporary storage object of type #storage_type
+    /// \par Storage reuse
+    /// Synchronization barrier should be placed before `storage` is reused
+    /// or repurposed: `__syncthreads()` or \link syncthreads() rocprim::syncthreads() \endlink.
+    template <typename Output, unsigned int ItemsPerThread, typename Flag, typename BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void
+        subtract_left_segmented(const T (&input)[ItemsPerThread],
+                                Output (&output)[ItemsPerThread],
+                                const Flag (&head_flags)[ItemsPerThread],
+                                const BinaryFunction op,
+                                storage_type&        storage)
+    {
+        subtract_left(input, output, op, storage);
+        detail::copy_flagged_items(input, output, head_flags);
+    }
+
+    /// \brief Apply a function to each consecutive pair of elements of the same segment
+    /// partitioned across threads in the block and write the output to the position of the left
+    /// item, with an explicit item before the tile.
+    ///
+    /// This combines subtract_left_segmented() with a tile predecessor, which is used for the
+    /// first item of the tile unless its head flag is set.
+    /// \tparam Output - [inferred] the type of output, must be assignable from the result of `op`
+    /// and from `T`
+    /// \tparam ItemsPerThread - [inferred] the number of items processed by each thread
+    /// \tparam Flag - [inferred] the type of the head flags, must be contextually convertible
+    /// to `bool`
+    /// \tparam BinaryFunction - [inferred] the type of the function to apply
+    /// \param [in] input - array that data is loaded from partitioned across the threads in the block
+    /// \param [out] output - array where the result of function application will be written to
+    /// \param [in] head_flags - array of the head flags of the items partitioned across the threads
+    /// in the block
+    /// \param [in] op - binary function applied to the items.
+    /// The signature of the function should be equivalent to the following:
+    /// `bool f(const T &a, const T &b)` The signature does not need to have
+    /// `const &` but the function object must not modify the objects passed to it.
+    /// \param [in] tile_predecessor - the item before the tile
+    /// \param storage - reference to a temporary storage object of type #storage_type
+    /// \par Storage reuse
+    /// Synchronization barrier should be placed before `storage` is reused
+    /// or repurposed: `__syncthreads()` or \link syncthreads() rocprim::syncthreads() \endlink.
+    template <typename Output, unsigned int ItemsPerThread, typename Flag, typename BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void
+        subtract_left_segmented(const T (&input)[ItemsPerThread],
+                                Output (&output)[ItemsPerThread],
+                                const Flag (&head_flags)[ItemsPerThread],
+                                const BinaryFunction op,
+                                const T              tile_predecessor,
+                                storage_type&        storage)
+    {
+        subtract_left(input, output, op, tile_predecessor, storage);
+        detail::copy_flagged_items(input, output, head_flags);
+    }
+
+    /// \brief Apply a function to each consecutive pair of elements of the same segment
+    /// partitioned across threads in the block and write the output to the position of the left
+    /// item, in a partial tile.
+    ///
+    /// This combines subtract_left_segmented() with subtract_left_partial(), the "invalid" items
+    /// in [valid_items, block_size * ItemsPerThread) are copied.
+    /// \tparam Output - [inferred] the type of output, must be assignable from the result of `op`
+    /// and from `T`
+    /// \tparam ItemsPerThread - [inferred] the number of items processed by each thread
+    /// \tparam Flag - [inferred] the type of the head flags, must be contextually convertible
+    /// to `bool`
+    /// \tparam BinaryFunction - [inferred] the type of the function to apply
+    /// \param [in] input - array that data is loaded from partitioned across the threads in the block
+    /// \param [out] output - array where the result of function application will be written to
+    /// \param [in] head_flags - array of the head flags of the items partitioned across the threads
+    /// in the block
+    /// \param [in] op - binary function applied to the items.
+    /// The signature of the function should be equivalent to the following:
+    /// `bool f(const T &a, const T &b)` The signature does not need to have
+    /// `const &` but the function object must not modify the objects passed to it.
+    /// \param [in] valid_items - number of items in the block which are considered "valid" and will
+    /// be used. Must be less or equal to `BlockSize` * `ItemsPerThread`
+    /// \param storage - reference to a temporary storage object of type #storage_type
+    /// \par Storage reuse
+    /// Synchronization barrier should be placed before `storage` is reused
+    /// or repurposed: `__syncthreads()` or \link syncthreads() rocprim::syncthreads() \endlink.
+    template <typename Output, unsigned int ItemsPerThread, typename Flag, typename BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void
+        subtract_left_segmented_partial(const T (&input)[ItemsPerThread],
+                                        Output (&output)[ItemsPerThread],
+                                        const Flag (&head_flags)[ItemsPerThread],
+                                        const BinaryFunction op,
+                                        const unsigned int   valid_items,
+                                        storage_type&        storage)
+    {
+        subtract_left_partial(input, output, op, valid_items, storage);
+        detail::copy_flagged_items(input, output, head_flags);
+    }
+
+    /// \brief Apply a function to each consecutive pair of elements of the same segment
+    /// partitioned across threads in the block and write the output to the position of the left
+    /// item, in a partial tile with a predecessor.
+    ///
+    /// This combines subtract_left_segmented_partial() with a tile predecessor.
+    /// \tparam Output - [inferred] the type of output, must be assignable from the result of `op`
+    /// and from `T`
+    /// \tparam ItemsPerThread - [inferred] the number of items processed by each thread
+    /// \tparam Flag - [inferred] the type of the head flags, must be contextually convertible
+    /// to `bool`
+    /// \tparam BinaryFunction - [inferred] the type of the function to apply
+    /// \param [in] input - array that data is loaded from partitioned across the threads in the block
+    /// \param [out] output - array where the result of function application will be written to
+    /// \param [in] head_flags - array of the head flags of the items partitioned across the threads
+    /// in the block
+    /// \param [in] op - binary function applied to the items.
+    /// The signature of the function should be equivalent to the following:
+    /// `bool f(const T &a, const T &b)` The signature does not need to have
+    /// `const &` but the function object must not modify the objects passed to it.
+    /// \param [in] tile_predecessor - the item before the tile
+    /// \param [in] valid_items - number of items in the block which are considered "valid" and will
+    /// be used. Must be less or equal to `BlockSize` * `ItemsPerThread`
+    /// \param storage - reference to a temporary storage object of type #storage_type
+    /// \par Storage reuse
+    /// Synchronization barrier should be placed before `storage` is reused
+    /// or repurposed: `__syncthreads()` or \link syncthreads() rocprim::syncthreads() \endlink.
+    template <typename Output, unsigned int ItemsPerThread, typename Flag, typename BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void
+        subtract_left_segmented_partial(const T (&input)[ItemsPerThread],
+                                        Output (&output)[ItemsPerThread],
+                                        const Flag (&head_flags)[ItemsPerThread],
+                                        const BinaryFunction op,
+                                        const T              tile_predecessor,
+                                        const unsigned int   valid_items,
+                                        storage_type&        storage)
+    {
+        subtract_left_partial(input, output, op, tile_predecessor, valid_items, storage);
+        detail::copy_flagged_items(input, output, head_flags);
+    }
+
+    /// \brief Apply a function to each consecutive pair of elements of the same segment
+    /// partitioned across threads in the block and write the output to the position of the right
+    /// item.
+    ///
+    /// Segments are given by tail flags: an item with its tail flag set is the last item of its
+    /// segment, it is not combined with the first item of the next segment.
+    /// \code
+    /// // For each i in [0, block_size * ItemsPerThread - 1) across threads in a block
+    /// output[i] = tail_flags[i] ? input[i] : op(input[i], input[i+1]);
+    /// output[block_size * ItemsPerThread - 1] = input[block_size * ItemsPerThread - 1]
+    /// \endcode
+    ///
+    /// \tparam Output - [inferred] the type of output, must be assignable from the result of `op`
+    /// and from `T`
+    /// \tparam ItemsPerThread - [inferred] the number of items processed by each thread
+    /// \tparam Flag - [inferred] the type of the tail flags, must be contextually convertible
+    /// to `bool`
+    /// \tparam BinaryFunction - [inferred] the type of the function to apply
+    /// \param [in] input - array that data is loaded from partitioned across the threads in the block
+    /// \param [out] output - array where the result of function application will be written to
+    /// \param [in] tail_flags - array of the tail flags of the items partitioned across the threads
+    /// in the block
+    /// \param [in] op - binary function applied to the items.
+    /// The signature of the function should be equivalent to the following:
+    /// `bool f(const T &a, const T &b)` The signature does not need to have
+    /// `const &` but the function object must not modify the objects passed to it.
+    /// \param storage - reference to a temporary storage object of type #storage_type
+    /// \par Storage reuse
+    /// Synchronization barrier should be placed before `storage` is reused
+    /// or repurposed: `__syncthreads()` or \link syncthreads() rocprim::syncthreads() \endlink.
+    template <typename Output, unsigned int ItemsPerThread, typename Flag, typename BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void
+        subtract_right_segmented(const T (&input)[ItemsPerThread],
+                                 Output (&output)[ItemsPerThread],
+                                 const Flag (&tail_flags)[ItemsPerThread],
+                                 const BinaryFunction op,
+                                 storage_type&        storage)
+    {
+        subtract_right(input, output, op, storage);
+        detail::copy_flagged_items(input, output, tail_flags);
+    }
+
+    /// \brief Apply a function to each consecutive pair of elements of the same segment
+    /// partitioned across threads in the block and write the output to the position of the right
+    /// item, with an explicit item after the tile.
+    ///
+    /// This combines subtract_right_segmented() with a tile successor, which is used for the
+    /// last item of the tile unless its tail flag is set.
+    /// \tparam Output - [inferred] the type of output, must be assignable from the result of `op`
+    /// and from `T`
+    /// \tparam ItemsPerThread - [inferred] the number of items processed by each thread
+    /// \tparam Flag - [inferred] the type of the tail flags, must be contextually convertible
+    /// to `bool`
+    /// \tparam BinaryFunction - [inferred] the type of the function to apply
+    /// \param [in] input - array that data is loaded from partitioned across the threads in the block
+    /// \param [out] output - array where the result of function application will be written to
+    /// \param [in] tail_flags - array of the tail flags of the items partitioned across the threads
+    /// in the block
+    /// \param [in] op - binary function applied to the items.
+    /// The signature of the function should be equivalent to the following:
+    /// `bool f(const T &a, const T &b)` The signature does not need to have
+    /// `const &` but the function object must not modify the objects passed to it.
+    /// \param [in] tile_successor - the item after the tile
+    /// \param storage - reference to a temporary storage object of type #storage_type
+    /// \par Storage reuse
+    /// Synchronization barrier should be placed before `storage` is reused
+    /// or repurposed: `__syncthreads()` or \link syncthreads() rocprim::syncthreads() \endlink.
+    template <typename Output, unsigned int ItemsPerThread, typename Flag, typename BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void
+        subtract_right_segmented(const T (&input)[ItemsPerThread],
+                                 Output (&output)[ItemsPerThread],
+                                 const Flag (&tail_flags)[ItemsPerThread],
+                                 const BinaryFunction op,
+                                 const T              tile_successor,
+                                 storage_type&        storage)
+    {
+        subtract_right(input, output, op, tile_successor, storage);
+        detail::copy_flagged_items(input, output, tail_flags);
+    }
+
+    /// \brief Apply a function to each consecutive pair of elements of the same segment
+    /// partitioned across threads in the block and write the output to the position of the right
+    /// item, in a partial tile.
+    ///
+    /// This combines subtract_right_segmented() with subtract_right_partial(), the "invalid"
+    /// items in [valid_items, block_size * ItemsPerThread) are copied.
+    /// \tparam Output - [inferred] the type of output, must be assignable from the result of `op`
+    /// and from `T`
+    /// \tparam ItemsPerThread - [inferred] the number of items processed by each thread
+    /// \tparam Flag - [inferred] the type of the tail flags, must be contextually convertible
+    /// to `bool`
+    /// \tparam BinaryFunction - [inferred] the type of the function to apply
+    /// \param [in] input - array that data is loaded from partitioned across the threads in the block
+    /// \param [out] output - array where the result of function application will be written to
+    /// \param [in] tail_flags - array of the tail flags of the items partitioned across the threads
+    /// in the block
+    /// \param [in] op - binary function applied to the items.
+    /// The signature of the function should be equivalent to the following:
+    /// `bool f(const T &a, const T &b)` The signature does not need to have
+    /// `const &` but the function object must not modify the objects passed to it.
+    /// \param [in] valid_items - number of items in the block which are considered "valid" and will
+    /// be used. Must be less or equal to `BlockSize` * `ItemsPerThread`
+    /// \param storage - reference to a temporary storage object of type #storage_type
+    /// \par Storage reuse
+    /// Synchronization barrier should be placed before `storage` is reused
+    /// or repurposed: `__syncthreads()` or \link syncthreads() rocprim::syncthreads() \endlink.
+    template <typename Output, unsigned int ItemsPerThread, typename Flag, typename BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void
+        subtract_right_segmented_partial(const T (&input)[ItemsPerThread],
+                                         Output (&output)[ItemsPerThread],
+                                         const Flag (&tail_flags)[ItemsPerThread],
+                                         const BinaryFunction op,
+                                         const unsigned int   valid_items,
+                                         storage_type&        storage)
+    {
+        subtract_right_partial(input, output, op, valid_items, storage);
+        detail::copy_flagged_items(input, output, tail_flags);
+    }
 };
 
 END_ROCPRIM_NAMESPACE
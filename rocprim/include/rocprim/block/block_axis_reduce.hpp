@@ -0,0 +1,244 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_BLOCK_BLOCK_AXIS_REDUCE_HPP_
+#define ROCPRIM_BLOCK_BLOCK_AXIS_REDUCE_HPP_
+
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/various.hpp"
+
+#include "../intrinsics.hpp"
+#include "../functional.hpp"
+
+#include "../warp/warp_reduce.hpp"
+#include "detail/block_axis_transpose.hpp"
+
+/// \addtogroup blockmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief Axis of a multidimensional block along which block_axis_reduce and block_axis_scan
+/// operate.
+enum class block_axis
+{
+    /// \brief Rows, the threads with the same y and z coordinates.
+    x,
+    /// \brief Columns, the threads with the same x and z coordinates.
+    y
+};
+
+namespace detail
+{
+
+// Storage of the warp operations of every line and, for columns, of the transposition
+template<class T,
+         unsigned int BlockSizeX,
+         unsigned int BlockSizeY,
+         unsigned int BlockSizeZ,
+         block_axis   Axis,
+         class WarpStorage>
+struct block_axis_storage
+{
+    static constexpr unsigned int line_size = Axis == block_axis::x ? BlockSizeX : BlockSizeY;
+    static constexpr unsigned int lines     = BlockSizeX * BlockSizeY * BlockSizeZ / line_size;
+
+    using transpose_type = block_axis_transpose<T, BlockSizeX, BlockSizeY, BlockSizeZ>;
+
+    typename std::conditional<Axis == block_axis::y,
+                              typename transpose_type::storage_type,
+                              empty_storage_type>::type transpose;
+    WarpStorage warps[lines];
+};
+
+} // end namespace detail
+
+/// \brief The block_axis_reduce class is a block level parallel primitive which reduces the items
+/// of every row or every column of a multidimensional block.
+///
+/// \tparam T - the input/output type.
+/// \tparam BlockSizeX - the number of threads in a block along the x dimension.
+/// \tparam BlockSizeY - the number of threads in a block along the y dimension.
+/// \tparam Axis - the axis of the reduction, rows (\p block_axis::x) or columns (\p block_axis::y).
+/// \tparam BlockSizeZ - the number of threads in a block along the z dimension.
+///
+/// \par Overview
+/// * The block must be launched with the sizes \p BlockSizeX, \p BlockSizeY and \p BlockSizeZ.
+/// * The number of threads along \p Axis must be a power of two not larger than the hardware warp
+///   size, so every line is held by a logical warp.
+/// * Rows are reduced in registers by warp reductions. Columns are transposed in the shared memory
+///   to rows first, which is cheaper than a transposition with block_exchange, then reduced.
+/// * The result is returned to every thread of the line.
+///
+/// \par Examples
+/// \parblock
+/// In the examples the rows of a block of 16x16 threads are summed.
+///
+/// \code{.cpp}
+/// __global__ void example_kernel(...) // blockDim = dim3(16, 16)
+/// {
+///     // specialize block_axis_reduce for int and the rows of a block of 16x16 threads
+///     using block_axis_reduce_int
+///         = rocprim::block_axis_reduce<int, 16, 16, rocprim::block_axis::x>;
+///     // allocate storage in shared memory
+///     __shared__ block_axis_reduce_int::storage_type storage;
+///
+///     int value = ...;
+///     // execute reduce
+///     block_axis_reduce_int().reduce(
+///         value, // input
+///         value, // output
+///         storage
+///     );
+///     ...
+/// }
+/// \endcode
+/// \endparblock
+template<
+    class T,
+    unsigned int BlockSizeX,
+    unsigned int BlockSizeY,
+    block_axis Axis,
+    unsigned int BlockSizeZ = 1
+>
+class block_axis_reduce
+{
+    static constexpr unsigned int line_size = Axis == block_axis::x ? BlockSizeX : BlockSizeY;
+    static_assert(::rocprim::detail::is_power_of_two(line_size)
+                      && line_size <= ::rocprim::device_warp_size(),
+                  "The number of threads along Axis must be a power of two not larger than the "
+                  "warp size");
+
+    using warp_reduce_type = ::rocprim::warp_reduce<T, line_size, true>;
+    using transpose_type = detail::block_axis_transpose<T, BlockSizeX, BlockSizeY, BlockSizeZ>;
+    using storage_type_ = detail::block_axis_storage<T,
+                                                     BlockSizeX,
+                                                     BlockSizeY,
+                                                     BlockSizeZ,
+                                                     Axis,
+                                                     typename warp_reduce_type::storage_type>;
+
+public:
+    /// \brief Struct used to allocate a temporary memory that is required for thread
+    /// communication during operations provided by related parallel primitive.
+    ///
+    /// Depending on the implemention the operations exposed by parallel primitive may
+    /// require a temporary storage for thread communication. The storage should be allocated
+    /// using keywords <tt>__shared__</tt>. It can be aliased to
+    /// an externally allocated memory, or be a part of a union type with other storage types
+    /// to increase shared memory reusability.
+    #ifndef DOXYGEN_SHOULD_SKIP_THIS // hides storage_type implementation for Doxygen
+    using storage_type = detail::raw_storage<storage_type_>;
+    #else
+    using storage_type = storage_type_; // only for Doxygen
+    #endif
+
+    /// \brief Reduces the items of the line of the calling thread, using temporary storage.
+    ///
+    /// \tparam BinaryFunction - type of binary function used for reduce. Default type
+    /// is rocprim::plus<T>.
+    ///
+    /// \param [in] input - thread input value.
+    /// \param [out] output - reference to a thread output value. May be aliased with \p input.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] reduce_op - binary operation function object that will be used for reduce.
+    /// The signature of the function should be equivalent to the following:
+    /// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+    /// <tt>const &</tt>, but function object must not modify the objects passed to it.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class BinaryFunction = ::rocprim::plus<T>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void reduce(T input,
+                T& output,
+                storage_type& storage,
+                BinaryFunction reduce_op = BinaryFunction())
+    {
+        reduce_impl(std::integral_constant<bool, Axis == block_axis::y>(),
+                    input,
+                    output,
+                    storage.get(),
+                    reduce_op);
+    }
+
+    /// \overload
+    /// \brief Reduces the items of the line of the calling thread.
+    ///
+    /// * This overload does not accept storage argument. Required shared memory is
+    /// allocated by the method itself.
+    ///
+    /// \tparam BinaryFunction - type of binary function used for reduce. Default type
+    /// is rocprim::plus<T>.
+    ///
+    /// \param [in] input - thread input value.
+    /// \param [out] output - reference to a thread output value. May be aliased with \p input.
+    /// \param [in] reduce_op - binary operation function object that will be used for reduce.
+    template<class BinaryFunction = ::rocprim::plus<T>>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void reduce(T input,
+                T& output,
+                BinaryFunction reduce_op = BinaryFunction())
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        reduce(input, output, storage, reduce_op);
+    }
+
+private:
+    template<class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void reduce_impl(std::false_type /*columns*/,
+                     T input,
+                     T& output,
+                     storage_type_& storage,
+                     BinaryFunction reduce_op)
+    {
+        // Rows are held by consecutive lanes
+        const detail::block_axis_thread<BlockSizeX, BlockSizeY, BlockSizeZ> thread;
+        const unsigned int line_id = thread.row_major_id() / line_size;
+        warp_reduce_type().reduce(input, output, storage.warps[line_id], reduce_op);
+    }
+
+    template<class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void reduce_impl(std::true_type /*columns*/,
+                     T input,
+                     T& output,
+                     storage_type_& storage,
+                     BinaryFunction reduce_op)
+    {
+        const detail::block_axis_thread<BlockSizeX, BlockSizeY, BlockSizeZ> thread;
+        const unsigned int line_id = thread.row_major_id() / line_size;
+        transpose_type transpose;
+        T value = transpose.to_columns(input, storage.transpose);
+        warp_reduce_type().reduce(value, value, storage.warps[line_id], reduce_op);
+        output = transpose.from_columns(value, storage.transpose);
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group blockmodule
+
+#endif // ROCPRIM_BLOCK_BLOCK_AXIS_REDUCE_HPP_
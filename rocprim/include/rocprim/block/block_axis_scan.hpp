@@ -0,0 +1,265 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_BLOCK_BLOCK_AXIS_SCAN_HPP_
+#define ROCPRIM_BLOCK_BLOCK_AXIS_SCAN_HPP_
+
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/various.hpp"
+
+#include "../intrinsics.hpp"
+#include "../functional.hpp"
+
+#include "../warp/warp_scan.hpp"
+#include "block_axis_reduce.hpp"
+#include "detail/block_axis_transpose.hpp"
+
+/// \addtogroup blockmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief The block_axis_scan class is a block level parallel primitive which scans the items
+/// of every row or every column of a multidimensional block.
+///
+/// \tparam T - the input/output type.
+/// \tparam BlockSizeX - the number of threads in a block along the x dimension.
+/// \tparam BlockSizeY - the number of threads in a block along the y dimension.
+/// \tparam Axis - the axis of the scan, rows (\p block_axis::x) or columns (\p block_axis::y).
+/// \tparam BlockSizeZ - the number of threads in a block along the z dimension.
+///
+/// \par Overview
+/// * The block must be launched with the sizes \p BlockSizeX, \p BlockSizeY and \p BlockSizeZ.
+/// * The number of threads along \p Axis must be a power of two not larger than the hardware warp
+///   size, so every line is held by a logical warp.
+/// * Rows are scanned in registers by warp scans. Columns are transposed in the shared memory
+///   to rows first, which is cheaper than a transposition with block_exchange, then scanned.
+/// * A summed-area table of a tile is an inclusive scan of the rows followed by an inclusive
+///   scan of the columns.
+///
+/// \par Examples
+/// \parblock
+/// In the examples the summed-area table of a tile of 16x16 items is computed.
+///
+/// \code{.cpp}
+/// __global__ void example_kernel(...) // blockDim = dim3(16, 16)
+/// {
+///     using row_scan = rocprim::block_axis_scan<int, 16, 16, rocprim::block_axis::x>;
+///     using column_scan = rocprim::block_axis_scan<int, 16, 16, rocprim::block_axis::y>;
+///     // allocate storage in shared memory
+///     __shared__ column_scan::storage_type storage;
+///
+///     int value = ...;
+///     // execute scans, the row scan uses only registers
+///     row_scan().inclusive_scan(value, value);
+///     column_scan().inclusive_scan(value, value, storage);
+///     ...
+/// }
+/// \endcode
+/// \endparblock
+template<
+    class T,
+    unsigned int BlockSizeX,
+    unsigned int BlockSizeY,
+    block_axis Axis,
+    unsigned int BlockSizeZ = 1
+>
+class block_axis_scan
+{
+    static constexpr unsigned int line_size = Axis == block_axis::x ? BlockSizeX : BlockSizeY;
+    static_assert(::rocprim::detail::is_power_of_two(line_size)
+                      && line_size <= ::rocprim::device_warp_size(),
+                  "The number of threads along Axis must be a power of two not larger than the "
+                  "warp size");
+
+    using warp_scan_type = ::rocprim::warp_scan<T, line_size>;
+    using transpose_type = detail::block_axis_transpose<T, BlockSizeX, BlockSizeY, BlockSizeZ>;
+    using storage_type_ = detail::block_axis_storage<T,
+                                                     BlockSizeX,
+                                                     BlockSizeY,
+                                                     BlockSizeZ,
+                                                     Axis,
+                                                     typename warp_scan_type::storage_type>;
+
+public:
+    /// \brief Struct used to allocate a temporary memory that is required for thread
+    /// communication during operations provided by related parallel primitive.
+    ///
+    /// Depending on the implemention the operations exposed by parallel primitive may
+    /// require a temporary storage for thread communication. The storage should be allocated
+    /// using keywords <tt>__shared__</tt>. It can be aliased to
+    /// an externally allocated memory, or be a part of a union type with other storage types
+    /// to increase shared memory reusability.
+    #ifndef DOXYGEN_SHOULD_SKIP_THIS // hides storage_type implementation for Doxygen
+    using storage_type = detail::raw_storage<storage_type_>;
+    #else
+    using storage_type = storage_type_; // only for Doxygen
+    #endif
+
+    /// \brief Performs inclusive scan of the line of the calling thread, using temporary storage.
+    ///
+    /// \tparam BinaryFunction - type of binary function used for scan. Default type
+    /// is rocprim::plus<T>.
+    ///
+    /// \param [in] input - thread input value.
+    /// \param [out] output - reference to a thread output value. May be aliased with \p input.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] scan_op - binary operation function object that will be used for scan.
+    /// The signature of the function should be equivalent to the following:
+    /// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+    /// <tt>const &</tt>, but function object must not modify the objects passed to it.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class BinaryFunction = ::rocprim::plus<T>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void inclusive_scan(T input,
+                        T& output,
+                        storage_type& storage,
+                        BinaryFunction scan_op = BinaryFunction())
+    {
+        scan_impl(std::integral_constant<bool, Axis == block_axis::y>(),
+                  input,
+                  output,
+                  storage.get(),
+                  [scan_op](T value, T& result, typename warp_scan_type::storage_type& warp)
+                  { warp_scan_type().inclusive_scan(value, result, warp, scan_op); });
+    }
+
+    /// \overload
+    /// \brief Performs inclusive scan of the line of the calling thread.
+    ///
+    /// * This overload does not accept storage argument. Required shared memory is
+    /// allocated by the method itself.
+    ///
+    /// \tparam BinaryFunction - type of binary function used for scan. Default type
+    /// is rocprim::plus<T>.
+    ///
+    /// \param [in] input - thread input value.
+    /// \param [out] output - reference to a thread output value. May be aliased with \p input.
+    /// \param [in] scan_op - binary operation function object that will be used for scan.
+    template<class BinaryFunction = ::rocprim::plus<T>>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void inclusive_scan(T input,
+                        T& output,
+                        BinaryFunction scan_op = BinaryFunction())
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        inclusive_scan(input, output, storage, scan_op);
+    }
+
+    /// \brief Performs exclusive scan of the line of the calling thread, using temporary storage.
+    ///
+    /// \tparam BinaryFunction - type of binary function used for scan. Default type
+    /// is rocprim::plus<T>.
+    ///
+    /// \param [in] input - thread input value.
+    /// \param [out] output - reference to a thread output value. May be aliased with \p input.
+    /// \param [in] init - initial value used to start the exclusive scan of every line.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] scan_op - binary operation function object that will be used for scan.
+    /// The signature of the function should be equivalent to the following:
+    /// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+    /// <tt>const &</tt>, but function object must not modify the objects passed to it.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class BinaryFunction = ::rocprim::plus<T>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void exclusive_scan(T input,
+                        T& output,
+                        T init,
+                        storage_type& storage,
+                        BinaryFunction scan_op = BinaryFunction())
+    {
+        scan_impl(std::integral_constant<bool, Axis == block_axis::y>(),
+                  input,
+                  output,
+                  storage.get(),
+                  [init, scan_op](T value, T& result, typename warp_scan_type::storage_type& warp)
+                  { warp_scan_type().exclusive_scan(value, result, init, warp, scan_op); });
+    }
+
+    /// \overload
+    /// \brief Performs exclusive scan of the line of the calling thread.
+    ///
+    /// * This overload does not accept storage argument. Required shared memory is
+    /// allocated by the method itself.
+    ///
+    /// \tparam BinaryFunction - type of binary function used for scan. Default type
+    /// is rocprim::plus<T>.
+    ///
+    /// \param [in] input - thread input value.
+    /// \param [out] output - reference to a thread output value. May be aliased with \p input.
+    /// \param [in] init - initial value used to start the exclusive scan of every line.
+    /// \param [in] scan_op - binary operation function object that will be used for scan.
+    template<class BinaryFunction = ::rocprim::plus<T>>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void exclusive_scan(T input,
+                        T& output,
+                        T init,
+                        BinaryFunction scan_op = BinaryFunction())
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        exclusive_scan(input, output, init, storage, scan_op);
+    }
+
+private:
+    template<class WarpScan>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void scan_impl(std::false_type /*columns*/,
+                   T input,
+                   T& output,
+                   storage_type_& storage,
+                   WarpScan warp_scan)
+    {
+        // Rows are held by consecutive lanes
+        const detail::block_axis_thread<BlockSizeX, BlockSizeY, BlockSizeZ> thread;
+        const unsigned int line_id = thread.row_major_id() / line_size;
+        warp_scan(input, output, storage.warps[line_id]);
+    }
+
+    template<class WarpScan>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void scan_impl(std::true_type /*columns*/,
+                   T input,
+                   T& output,
+                   storage_type_& storage,
+                   WarpScan warp_scan)
+    {
+        const detail::block_axis_thread<BlockSizeX, BlockSizeY, BlockSizeZ> thread;
+        const unsigned int line_id = thread.row_major_id() / line_size;
+        transpose_type transpose;
+        T value = transpose.to_columns(input, storage.transpose);
+        warp_scan(value, value, storage.warps[line_id]);
+        output = transpose.from_columns(value, storage.transpose);
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group blockmodule
+
+#endif // ROCPRIM_BLOCK_BLOCK_AXIS_SCAN_HPP_
@@ -0,0 +1,319 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_BLOCK_BLOCK_DECODE_HPP_
+#define ROCPRIM_BLOCK_BLOCK_DECODE_HPP_
+
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/various.hpp"
+
+#include "../intrinsics.hpp"
+#include "../functional.hpp"
+#include "../iterator/dictionary_iterator.hpp"
+
+#include "block_load_func.hpp"
+#include "block_scan.hpp"
+
+/// \addtogroup blockmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief The \p block_dictionary class is a block level parallel primitive which copies the
+/// dictionary of a \p dictionary_iterator to shared memory, so the codes of the block are
+/// resolved without reading the dictionary from global memory.
+///
+/// \tparam T - the type of the values of the dictionary.
+/// \tparam BlockSizeX - the number of threads in a block's x dimension.
+/// \tparam MaxDictionarySize - the largest number of values of a dictionary which is copied to
+/// shared memory, it determines the size of \p storage_type.
+/// \tparam BlockSizeY - the number of threads in a block's y dimension, defaults to 1.
+/// \tparam BlockSizeZ - the number of threads in a block's z dimension, defaults to 1.
+///
+/// \par Overview
+/// * \p stage() copies the dictionary cooperatively by all threads of the block and returns a
+/// \p dictionary_iterator over the copy in shared memory, at the same codes.
+/// * Dictionaries larger than \p MaxDictionarySize are not copied, the returned iterator then
+/// reads the dictionary from global memory.
+/// * Only dictionaries stored in memory are supported, the dictionary iterator of the input
+/// must be convertible to <tt>const T*</tt>.
+///
+/// \par Example:
+/// \parblock
+/// In the example a block of 256 threads decodes 4 values per thread with a dictionary of at
+/// most 1024 \p float values.
+///
+/// \code{.cpp}
+/// __global__ void example_kernel(const float * dictionary, unsigned int dictionary_size,
+///                                const unsigned short * codes, ...)
+/// {
+///     using block_dictionary_type = rocprim::block_dictionary<float, 256, 1024>;
+///     __shared__ block_dictionary_type::storage_type storage;
+///
+///     auto input = rocprim::make_dictionary_iterator(dictionary, dictionary_size, codes);
+///     auto staged = block_dictionary_type().stage(input, storage);
+///     float values[4];
+///     rocprim::block_load_direct_blocked(threadIdx.x, staged + blockIdx.x * 256 * 4, values);
+///     ...
+/// }
+/// \endcode
+/// \endparblock
+template<
+    class T,
+    unsigned int BlockSizeX,
+    unsigned int MaxDictionarySize,
+    unsigned int BlockSizeY = 1,
+    unsigned int BlockSizeZ = 1
+>
+class block_dictionary
+{
+    static constexpr unsigned int BlockSize = BlockSizeX * BlockSizeY * BlockSizeZ;
+
+    static_assert(MaxDictionarySize > 0, "MaxDictionarySize must be greater than 0");
+
+    // Struct used for creating a raw_storage object for this primitive's temporary storage.
+    struct storage_type_
+    {
+        T dictionary[MaxDictionarySize];
+    };
+
+public:
+    /// \brief Struct used to allocate a temporary memory that is required for thread
+    /// communication during operations provided by related parallel primitive.
+    ///
+    /// Depending on the implemention the operations exposed by parallel primitive may
+    /// require a temporary storage for thread communication. The storage should be allocated
+    /// using keywords \p __shared__. It can be aliased to
+    /// an externally allocated memory, or be a part of a union with other storage types
+    /// to increase shared memory reusability.
+    #ifndef DOXYGEN_SHOULD_SKIP_THIS // hides storage_type implementation for Doxygen
+    using storage_type = detail::raw_storage<storage_type_>;
+    #else
+    using storage_type = storage_type_; // only for Doxygen
+    #endif
+
+    /// \brief Copies the dictionary of the input to shared memory if it fits.
+    ///
+    /// \tparam DictionaryPointer - [inferred] the type of the dictionary of the input, it must
+    /// be convertible to <tt>const T*</tt>.
+    /// \tparam CodeIterator - [inferred] the type of the codes of the input.
+    ///
+    /// \param [in] input - the dictionary-encoded input, the same for all threads of the block.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    ///
+    /// \returns An iterator at the same codes as \p input, which resolves them in \p storage
+    /// if the dictionary has at most \p MaxDictionarySize values.
+    ///
+    /// \par Storage reusage
+    /// The returned iterator reads \p storage, it must not be reused or repurposed while the
+    /// iterator is used.
+    template<class DictionaryPointer, class CodeIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    dictionary_iterator<const T*, CodeIterator>
+    stage(dictionary_iterator<DictionaryPointer, CodeIterator> input,
+          storage_type& storage)
+    {
+        static_assert(std::is_convertible<DictionaryPointer, const T*>::value,
+                      "The dictionary of the input must be convertible to const T*.");
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+
+        const T*           dictionary      = input.dictionary();
+        const unsigned int dictionary_size = input.dictionary_size();
+        // The condition is uniform across the block, so all threads reach the barrier
+        if(dictionary_size <= MaxDictionarySize)
+        {
+            storage_type_& storage_ = storage.get();
+            for(unsigned int i = flat_id; i < dictionary_size; i += BlockSize)
+            {
+                storage_.dictionary[i] = dictionary[i];
+            }
+            ::rocprim::syncthreads();
+            dictionary = storage_.dictionary;
+        }
+        return dictionary_iterator<const T*, CodeIterator>(dictionary,
+                                                           dictionary_size,
+                                                           input.codes());
+    }
+
+    /// \overload
+    /// \brief Copies the dictionary of the input to shared memory if it fits.
+    ///
+    /// * This overload does not accept storage argument. Required shared memory is
+    /// allocated by the method itself.
+    ///
+    /// \param [in] input - the dictionary-encoded input, the same for all threads of the block.
+    template<class DictionaryPointer, class CodeIterator>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    dictionary_iterator<const T*, CodeIterator>
+    stage(dictionary_iterator<DictionaryPointer, CodeIterator> input)
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        return stage(input, storage);
+    }
+};
+
+/// \brief The \p block_delta_decode class is a block level parallel primitive which decodes
+/// tiles of delta-encoded values into a blocked arrangement of items across the thread block.
+///
+/// \tparam T - the type of the deltas and the decoded values.
+/// \tparam BlockSizeX - the number of threads in a block's x dimension.
+/// \tparam ItemsPerThread - the number of items to be processed by each thread.
+/// \tparam BlockSizeY - the number of threads in a block's y dimension, defaults to 1.
+/// \tparam BlockSizeZ - the number of threads in a block's z dimension, defaults to 1.
+///
+/// \par Overview
+/// * \p decode() loads a tile of deltas in a blocked arrangement and computes the values with
+/// an inclusive block-wide scan, which is added to the prefix carried from the previous tiles.
+/// The prefix is then advanced by the sum of the deltas of the tile.
+/// * The first tile of a sequence starts with the prefix <tt>T(0)</tt>, or with the value
+/// preceding the tile, for example a checkpoint of a \p delta_decoding_iterator. In contrast
+/// to the random access of \p delta_decoding_iterator each delta is read once.
+///
+/// \par Example:
+/// \parblock
+/// In the example a block of 128 threads decodes tiles of 4 \p int items per thread.
+///
+/// \code{.cpp}
+/// __global__ void example_kernel(const int * deltas, unsigned int tiles, ...)
+/// {
+///     using block_decode_type = rocprim::block_delta_decode<int, 128, 4>;
+///     __shared__ block_decode_type::storage_type storage;
+///
+///     int prefix = 0;
+///     for(unsigned int tile = 0; tile < tiles; tile++)
+///     {
+///         int values[4];
+///         block_decode_type().decode(deltas + tile * 128 * 4, values, prefix, storage);
+///         ...
+///         rocprim::syncthreads();
+///     }
+/// }
+/// \endcode
+/// \endparblock
+template<
+    class T,
+    unsigned int BlockSizeX,
+    unsigned int ItemsPerThread,
+    unsigned int BlockSizeY = 1,
+    unsigned int BlockSizeZ = 1
+>
+class block_delta_decode
+{
+    using block_scan_type = block_scan<T,
+                                       BlockSizeX,
+                                       block_scan_algorithm::default_algorithm,
+                                       BlockSizeY,
+                                       BlockSizeZ>;
+
+public:
+    /// \brief Struct used to allocate a temporary memory that is required for thread
+    /// communication during operations provided by related parallel primitive.
+    ///
+    /// Depending on the implemention the operations exposed by parallel primitive may
+    /// require a temporary storage for thread communication. The storage should be allocated
+    /// using keywords \p __shared__. It can be aliased to
+    /// an externally allocated memory, or be a part of a union with other storage types
+    /// to increase shared memory reusability.
+    using storage_type = typename block_scan_type::storage_type;
+
+    /// \brief Decodes a tile of deltas.
+    ///
+    /// \tparam DeltaIterator - [inferred] an iterator type for the deltas (can be a simple
+    /// pointer.
+    ///
+    /// \param [in] block_deltas - the iterator at the first delta of the tile.
+    /// \param [out] items - array that the decoded values are stored to.
+    /// \param [in,out] prefix - the value preceding the tile, it is advanced to the last value
+    /// of the tile. It must be the same for all threads of the block.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class DeltaIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void decode(DeltaIterator block_deltas,
+                T (&items)[ItemsPerThread],
+                T& prefix,
+                storage_type& storage)
+    {
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        T deltas[ItemsPerThread];
+        block_load_direct_blocked(flat_id, block_deltas, deltas);
+        decode_deltas(deltas, items, prefix, storage);
+    }
+
+    /// \brief Decodes a tile of deltas, which is guarded by range \p valid.
+    ///
+    /// \tparam DeltaIterator - [inferred] an iterator type for the deltas (can be a simple
+    /// pointer.
+    ///
+    /// \param [in] block_deltas - the iterator at the first delta of the tile.
+    /// \param [out] items - array that the decoded values are stored to, the items at and
+    /// after \p valid are set to the last valid value.
+    /// \param [in] valid - maximum range of valid deltas to load.
+    /// \param [in,out] prefix - the value preceding the tile, it is advanced to the last valid
+    /// value. It must be the same for all threads of the block.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class DeltaIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void decode(DeltaIterator block_deltas,
+                T (&items)[ItemsPerThread],
+                unsigned int valid,
+                T& prefix,
+                storage_type& storage)
+    {
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        T deltas[ItemsPerThread];
+        // Zero deltas past the end leave the sum unchanged
+        block_load_direct_blocked(flat_id, block_deltas, deltas, valid, T(0));
+        decode_deltas(deltas, items, prefix, storage);
+    }
+
+private:
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void decode_deltas(T (&deltas)[ItemsPerThread],
+                       T (&items)[ItemsPerThread],
+                       T& prefix,
+                       storage_type& storage)
+    {
+        T reduction;
+        block_scan_type().inclusive_scan(deltas, items, reduction, storage, ::rocprim::plus<T>());
+        ROCPRIM_UNROLL
+        for(unsigned int item = 0; item < ItemsPerThread; item++)
+        {
+            items[item] = prefix + items[item];
+        }
+        prefix = prefix + reduction;
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group blockmodule
+
+#endif // ROCPRIM_BLOCK_BLOCK_DECODE_HPP_
@@ -0,0 +1,144 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef ROCPRIM_BLOCK_BLOCK_DYNAMIC_STORAGE_HPP_
+#define ROCPRIM_BLOCK_BLOCK_DYNAMIC_STORAGE_HPP_
+
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../functional.hpp"
+
+/// \addtogroup blockmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// The unit of the dynamic shared memory, the storage of a primitive can be aligned up to it
+struct alignas(16) dynamic_shared_memory_unit
+{
+    unsigned char bytes[16];
+};
+
+ROCPRIM_DEVICE ROCPRIM_INLINE
+unsigned char* dynamic_shared_memory()
+{
+    HIP_DYNAMIC_SHARED(dynamic_shared_memory_unit, rocprim_dynamic_shared_memory);
+    return reinterpret_cast<unsigned char*>(rocprim_dynamic_shared_memory);
+}
+
+template<class... BlockPrimitives>
+struct max_storage_size;
+
+template<class BlockPrimitive>
+struct max_storage_size<BlockPrimitive>
+    : std::integral_constant<unsigned int,
+                             sizeof(typename BlockPrimitive::storage_type)>
+{};
+
+template<class BlockPrimitive, class... BlockPrimitives>
+struct max_storage_size<BlockPrimitive, BlockPrimitives...>
+    : std::integral_constant<unsigned int,
+                             ::rocprim::max(max_storage_size<BlockPrimitive>::value,
+                                            max_storage_size<BlockPrimitives...>::value)>
+{};
+
+} // end namespace detail
+
+/// \brief Returns the size in bytes of the dynamic shared memory which holds the storage of any
+/// of the block-level primitives \p BlockPrimitives.
+///
+/// The value is the size of the dynamic shared memory (the \p sharedMemBytes parameter of
+/// the launch) of a kernel which gets the storage of the primitives with dynamic_storage().
+/// It is available on the host, so the shared memory of a kernel can be selected at run time
+/// for the shape of the tiles that it processes.
+///
+/// \tparam BlockPrimitives - types of block-level primitives with a \p storage_type, e.g.
+/// \p block_scan, \p block_exchange or \p block_radix_sort.
+template<class... BlockPrimitives>
+ROCPRIM_HOST_DEVICE inline
+constexpr unsigned int storage_size_bytes()
+{
+    return detail::max_storage_size<BlockPrimitives...>::value;
+}
+
+/// \brief Returns the storage of the block-level primitive \p BlockPrimitive in the dynamic
+/// shared memory of the kernel.
+///
+/// The storages of all primitives start at the beginning of the dynamic shared memory, so they
+/// alias like the members of a union: a synchronization barrier is needed before the storage of
+/// another primitive is used. The kernel must be launched with at least
+/// \p storage_size_bytes<BlockPrimitive>() bytes of dynamic shared memory.
+///
+/// Unlike the storage declared with \p __shared__, only the storage of the primitives which are
+/// used by a launch is allocated. One kernel can select one of several shapes of tiles at run
+/// time (for example the items per thread) and be launched with the shared memory of
+/// the selected shape, instead of the static shared memory of all shapes.
+///
+/// \tparam BlockPrimitive - type of a block-level primitive with a \p storage_type.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// template<unsigned int ItemsPerThread>
+/// __device__ void scan_tile(int* data)
+/// {
+///     using block_scan_int = rocprim::block_scan<int, 256>;
+///     int values[ItemsPerThread];
+///     ...
+///     block_scan_int().inclusive_scan(
+///         values, values, rocprim::dynamic_storage<block_scan_int>());
+///     ...
+/// }
+///
+/// __global__ void example_kernel(int* data, bool long_tiles)
+/// {
+///     if(long_tiles)
+///         scan_tile<8>(data);
+///     else
+///         scan_tile<2>(data);
+/// }
+///
+/// // The storage of block_scan does not depend on the items per thread
+/// const unsigned int shared_memory
+///     = rocprim::storage_size_bytes<rocprim::block_scan<int, 256>>();
+/// hipLaunchKernelGGL(example_kernel, grid_size, 256, shared_memory, stream, data, long_tiles);
+/// \endcode
+/// \endparblock
+template<class BlockPrimitive>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+typename BlockPrimitive::storage_type& dynamic_storage()
+{
+    using storage_type = typename BlockPrimitive::storage_type;
+    static_assert(alignof(storage_type) <= alignof(detail::dynamic_shared_memory_unit),
+                  "The storage cannot be aligned in the dynamic shared memory");
+    return *reinterpret_cast<storage_type*>(detail::dynamic_shared_memory());
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group blockmodule
+
+#endif // ROCPRIM_BLOCK_BLOCK_DYNAMIC_STORAGE_HPP_
@@ -21,6 +21,8 @@
 #ifndef ROCPRIM_BLOCK_BLOCK_EXCHANGE_HPP_
 #define ROCPRIM_BLOCK_BLOCK_EXCHANGE_HPP_
 
+#include <type_traits>
+
 #include "../config.hpp"
 #include "../detail/various.hpp"
 
@@ -28,17 +30,43 @@
 #include "../functional.hpp"
 #include "../types.hpp"
 
+#include "../warp/warp_exchange.hpp"
+
 /// \addtogroup blockmodule
 /// @{
 
 BEGIN_ROCPRIM_NAMESPACE
 
+/// \brief Policy of \p block_exchange, it selects the layout of the items in the shared memory
+/// and how items are exchanged within warps.
+enum class block_exchange_policy
+{
+    /// When \p ItemsPerThread is a power of two, every row of LDS banks is padded by one item.
+    /// A row holds fewer items when the items are larger than a bank.
+    padding,
+    /// Items are stored without padding, the storage is the smallest.
+    none,
+    /// Items within every row of LDS banks are permuted with the index of the row (XOR swizzle).
+    /// It avoids the same bank conflicts as \p padding without the extra storage. Falls back
+    /// to \p padding when a row does not hold a power-of-two number of items.
+    swizzle,
+    /// Like \p padding, but the transpositions between blocked and warp-striped arrangements
+    /// are performed in registers with warp shuffles, without the shared memory. It is used
+    /// when all warps are full and \p ItemsPerThread divides the warp size, every thread
+    /// performs \p ItemsPerThread shuffles.
+    warp_shuffle
+};
+
 /// \brief The \p block_exchange class is a block level parallel primitive which provides
 /// methods for rearranging items partitioned across threads in a block.
 ///
 /// \tparam T - the input type.
 /// \tparam BlockSize - the number of threads in a block.
 /// \tparam ItemsPerThread - the number of items contributed by each thread.
+/// \tparam BlockSizeY - the number of threads in a block along the y dimension.
+/// \tparam BlockSizeZ - the number of threads in a block along the z dimension.
+/// \tparam Policy - the layout of the items in the shared memory and the exchange within warps,
+/// see \p block_exchange_policy.
 ///
 /// \par Overview
 /// * The \p block_exchange class supports the following rearrangement methods:
@@ -48,7 +76,9 @@ BEGIN_ROCPRIM_NAMESPACE
 ///   * Transposing a warp-striped arrangement to a blocked arrangement.
 ///   * Scattering items to a blocked arrangement.
 ///   * Scattering items to a striped arrangement.
-/// * Data is automatically be padded to ensure zero bank conflicts.
+///   * Scattering items to a warp-striped arrangement.
+/// * Data is automatically be padded to ensure zero bank conflicts, \p Policy selects
+///   a different layout.
 ///
 /// \par Examples
 /// \parblock
@@ -76,7 +106,8 @@ template<
     unsigned int BlockSizeX,
     unsigned int ItemsPerThread,
     unsigned int BlockSizeY = 1,
-    unsigned int BlockSizeZ = 1
+    unsigned int BlockSizeZ = 1,
+    block_exchange_policy Policy = block_exchange_policy::padding
 >
 class block_exchange
 {
@@ -93,13 +124,35 @@ class block_exchange
     static constexpr bool has_bank_conflicts =
         ItemsPerThread >= 2 && ::rocprim::detail::is_power_of_two(ItemsPerThread);
     static constexpr unsigned int banks_no = ::rocprim::detail::get_lds_banks_no();
+    // Number of items in one row of banks (banks_no 4-byte words), items larger than 4 bytes
+    // occupy several banks
+    static constexpr unsigned int row_items
+        = sizeof(T) > 4 && ::rocprim::detail::is_power_of_two(sizeof(T))
+              ? ::rocprim::max<unsigned int>(1u, banks_no * 4 / sizeof(T))
+              : banks_no;
+    static constexpr bool use_swizzle = has_bank_conflicts
+                                        && Policy == block_exchange_policy::swizzle
+                                        && ::rocprim::detail::is_power_of_two(row_items);
+    static constexpr bool use_padding
+        = has_bank_conflicts && Policy != block_exchange_policy::none && !use_swizzle;
     static constexpr unsigned int bank_conflicts_padding =
-        has_bank_conflicts ? (BlockSize * ItemsPerThread / banks_no) : 0;
+        use_padding ? (BlockSize * ItemsPerThread / row_items) : 0;
+    // Swizzling permutes items within whole rows
+    static constexpr unsigned int buffer_size
+        = use_swizzle
+              ? ::rocprim::detail::ceiling_div(BlockSize * ItemsPerThread, row_items) * row_items
+              : BlockSize * ItemsPerThread + bank_conflicts_padding;
+
+    // Warp-striped transpositions are done with shuffles within full warps
+    static constexpr bool use_warp_shuffle = Policy == block_exchange_policy::warp_shuffle
+                                             && BlockSize % warp_size == 0
+                                             && warp_size % ItemsPerThread == 0;
+    using warp_exchange_type = ::rocprim::warp_exchange<T, ItemsPerThread, warp_size>;
 
     // Struct used for creating a raw_storage object for this primitive's temporary storage.
     struct storage_type_
     {
-        T buffer[BlockSize * ItemsPerThread + bank_conflicts_padding];
+        T buffer[buffer_size];
     };
 
 public:
@@ -169,19 +222,12 @@ public:
                             U (&output)[ItemsPerThread],
                             storage_type& storage)
     {
-        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
-        storage_type_& storage_ = storage.get();
-
-        for(unsigned int i = 0; i < ItemsPerThread; i++)
-        {
-            storage_.buffer[index(flat_id * ItemsPerThread + i)] = input[i];
-        }
-        ::rocprim::syncthreads();
-
-        for(unsigned int i = 0; i < ItemsPerThread; i++)
-        {
-            output[i] = storage_.buffer[index(i * BlockSize + flat_id)];
-        }
+        // In a block of one warp the striped arrangement is the warp-striped arrangement
+        blocked_to_striped_impl(
+            std::integral_constant<bool, use_warp_shuffle && BlockSize == warp_size>(),
+            input,
+            output,
+            storage);
     }
 
     /// \brief Transposes a striped arrangement of items to a blocked arrangement
@@ -235,19 +281,11 @@ public:
                             U (&output)[ItemsPerThread],
                             storage_type& storage)
     {
-        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
-        storage_type_& storage_ = storage.get();
-
-        for(unsigned int i = 0; i < ItemsPerThread; i++)
-        {
-            storage_.buffer[index(i * BlockSize + flat_id)] = input[i];
-        }
-        ::rocprim::syncthreads();
-
-        for(unsigned int i = 0; i < ItemsPerThread; i++)
-        {
-            output[i] = storage_.buffer[index(flat_id * ItemsPerThread + i)];
-        }
+        striped_to_blocked_impl(
+            std::integral_constant<bool, use_warp_shuffle && BlockSize == warp_size>(),
+            input,
+            output,
+            storage);
     }
 
     /// \brief Transposes a blocked arrangement of items to a warp-striped arrangement
@@ -301,24 +339,10 @@ public:
                                  U (&output)[ItemsPerThread],
                                  storage_type& storage)
     {
-        constexpr unsigned int items_per_warp = warp_size * ItemsPerThread;
-        const unsigned int lane_id = ::rocprim::lane_id();
-        const unsigned int warp_id = ::rocprim::warp_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
-        const unsigned int current_warp_size = get_current_warp_size();
-        const unsigned int offset = warp_id * items_per_warp;
-        storage_type_& storage_ = storage.get();
-
-        for(unsigned int i = 0; i < ItemsPerThread; i++)
-        {
-            storage_.buffer[index(offset + lane_id * ItemsPerThread + i)] = input[i];
-        }
-
-        ::rocprim::wave_barrier();
-
-        for(unsigned int i = 0; i < ItemsPerThread; i++)
-        {
-            output[i] = storage_.buffer[index(offset + i * current_warp_size + lane_id)];
-        }
+        blocked_to_warp_striped_impl(std::integral_constant<bool, use_warp_shuffle>(),
+                                     input,
+                                     output,
+                                     storage);
     }
 
     /// \brief Transposes a warp-striped arrangement of items to a blocked arrangement
@@ -372,24 +396,10 @@ public:
                                  U (&output)[ItemsPerThread],
                                  storage_type& storage)
     {
-        constexpr unsigned int items_per_warp = warp_size * ItemsPerThread;
-        const unsigned int lane_id = ::rocprim::lane_id();
-        const unsigned int warp_id = ::rocprim::warp_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
-        const unsigned int current_warp_size = get_current_warp_size();
-        const unsigned int offset = warp_id * items_per_warp;
-        storage_type_& storage_ = storage.get();
-
-        for(unsigned int i = 0; i < ItemsPerThread; i++)
-        {
-            storage_.buffer[index(offset + i * current_warp_size + lane_id)] = input[i];
-        }
-
-        ::rocprim::wave_barrier();
-
-        for(unsigned int i = 0; i < ItemsPerThread; i++)
-        {
-            output[i] = storage_.buffer[index(offset + lane_id * ItemsPerThread + i)];
-        }
+        warp_striped_to_blocked_impl(std::integral_constant<bool, use_warp_shuffle>(),
+                                     input,
+                                     output,
+                                     storage);
     }
 
     /// \brief Scatters items to a blocked arrangement based on their ranks
@@ -499,6 +509,84 @@ public:
         }
     }
 
+    /// \brief Scatters items to a warp-striped arrangement based on their ranks
+    /// across the thread block.
+    ///
+    /// \tparam U - [inferred] the output type.
+    /// \tparam Offset - [inferred] the rank type.
+    ///
+    /// \param [in] input - array that data is loaded from.
+    /// \param [out] output - array that data is loaded to.
+    /// \param [out] ranks - array that has rank of data.
+    template<class U, class Offset>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void scatter_to_warp_striped(const T (&input)[ItemsPerThread],
+                                 U (&output)[ItemsPerThread],
+                                 const Offset (&ranks)[ItemsPerThread])
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        scatter_to_warp_striped(input, output, ranks, storage);
+    }
+
+    /// \brief Scatters items to a warp-striped arrangement based on their ranks
+    /// across the thread block, using temporary storage.
+    ///
+    /// \tparam U - [inferred] the output type.
+    /// \tparam Offset - [inferred] the rank type.
+    ///
+    /// \param [in] input - array that data is loaded from.
+    /// \param [out] output - array that data is loaded to.
+    /// \param [out] ranks - array that has rank of data.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ///
+    /// \par Example.
+    /// \code{.cpp}
+    /// __global__ void example_kernel(...)
+    /// {
+    ///     // specialize block_exchange for int, block of 128 threads and 8 items per thread
+    ///     using block_exchange_int = rocprim::block_exchange<int, 128, 8>;
+    ///     // allocate storage in shared memory
+    ///     __shared__ block_exchange_int::storage_type storage;
+    ///
+    ///     int items[8];
+    ///     int ranks[8];
+    ///     ...
+    ///     block_exchange_int b_exchange;
+    ///     b_exchange.scatter_to_warp_striped(items, items, ranks, storage);
+    ///     ...
+    /// }
+    /// \endcode
+    template<class U, class Offset>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void scatter_to_warp_striped(const T (&input)[ItemsPerThread],
+                                 U (&output)[ItemsPerThread],
+                                 const Offset (&ranks)[ItemsPerThread],
+                                 storage_type& storage)
+    {
+        constexpr unsigned int items_per_warp = warp_size * ItemsPerThread;
+        const unsigned int lane_id = ::rocprim::lane_id();
+        const unsigned int warp_id = ::rocprim::warp_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        const unsigned int current_warp_size = get_current_warp_size();
+        const unsigned int offset = warp_id * items_per_warp;
+        storage_type_& storage_ = storage.get();
+
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            const Offset rank = ranks[i];
+            storage_.buffer[index(rank)] = input[i];
+        }
+        ::rocprim::syncthreads();
+
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            output[i] = storage_.buffer[index(offset + i * current_warp_size + lane_id)];
+        }
+    }
+
     /// \brief Scatters items to a striped arrangement based on their ranks
     /// across the thread block.
     ///
@@ -743,6 +831,144 @@ public:
 
 private:
 
+    template<class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void blocked_to_striped_impl(std::false_type /*use_warp_shuffle*/,
+                                 const T (&input)[ItemsPerThread],
+                                 U (&output)[ItemsPerThread],
+                                 storage_type& storage)
+    {
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        storage_type_& storage_ = storage.get();
+
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            storage_.buffer[index(flat_id * ItemsPerThread + i)] = input[i];
+        }
+        ::rocprim::syncthreads();
+
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            output[i] = storage_.buffer[index(i * BlockSize + flat_id)];
+        }
+    }
+
+    template<class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void blocked_to_striped_impl(std::true_type /*use_warp_shuffle*/,
+                                 const T (&input)[ItemsPerThread],
+                                 U (&output)[ItemsPerThread],
+                                 storage_type& /*storage*/)
+    {
+        warp_exchange_type().blocked_to_striped_shuffle(input, output);
+    }
+
+    template<class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void striped_to_blocked_impl(std::false_type /*use_warp_shuffle*/,
+                                 const T (&input)[ItemsPerThread],
+                                 U (&output)[ItemsPerThread],
+                                 storage_type& storage)
+    {
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        storage_type_& storage_ = storage.get();
+
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            storage_.buffer[index(i * BlockSize + flat_id)] = input[i];
+        }
+        ::rocprim::syncthreads();
+
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            output[i] = storage_.buffer[index(flat_id * ItemsPerThread + i)];
+        }
+    }
+
+    template<class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void striped_to_blocked_impl(std::true_type /*use_warp_shuffle*/,
+                                 const T (&input)[ItemsPerThread],
+                                 U (&output)[ItemsPerThread],
+                                 storage_type& /*storage*/)
+    {
+        warp_exchange_type().striped_to_blocked_shuffle(input, output);
+    }
+
+    template<class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void blocked_to_warp_striped_impl(std::false_type /*use_warp_shuffle*/,
+                                      const T (&input)[ItemsPerThread],
+                                      U (&output)[ItemsPerThread],
+                                      storage_type& storage)
+    {
+        constexpr unsigned int items_per_warp = warp_size * ItemsPerThread;
+        const unsigned int lane_id = ::rocprim::lane_id();
+        const unsigned int warp_id = ::rocprim::warp_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        const unsigned int current_warp_size = get_current_warp_size();
+        const unsigned int offset = warp_id * items_per_warp;
+        storage_type_& storage_ = storage.get();
+
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            storage_.buffer[index(offset + lane_id * ItemsPerThread + i)] = input[i];
+        }
+
+        ::rocprim::wave_barrier();
+
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            output[i] = storage_.buffer[index(offset + i * current_warp_size + lane_id)];
+        }
+    }
+
+    template<class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void blocked_to_warp_striped_impl(std::true_type /*use_warp_shuffle*/,
+                                      const T (&input)[ItemsPerThread],
+                                      U (&output)[ItemsPerThread],
+                                      storage_type& /*storage*/)
+    {
+        warp_exchange_type().blocked_to_striped_shuffle(input, output);
+    }
+
+    template<class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void warp_striped_to_blocked_impl(std::false_type /*use_warp_shuffle*/,
+                                      const T (&input)[ItemsPerThread],
+                                      U (&output)[ItemsPerThread],
+                                      storage_type& storage)
+    {
+        constexpr unsigned int items_per_warp = warp_size * ItemsPerThread;
+        const unsigned int lane_id = ::rocprim::lane_id();
+        const unsigned int warp_id = ::rocprim::warp_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        const unsigned int current_warp_size = get_current_warp_size();
+        const unsigned int offset = warp_id * items_per_warp;
+        storage_type_& storage_ = storage.get();
+
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            storage_.buffer[index(offset + i * current_warp_size + lane_id)] = input[i];
+        }
+
+        ::rocprim::wave_barrier();
+
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            output[i] = storage_.buffer[index(offset + lane_id * ItemsPerThread + i)];
+        }
+    }
+
+    template<class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void warp_striped_to_blocked_impl(std::true_type /*use_warp_shuffle*/,
+                                      const T (&input)[ItemsPerThread],
+                                      U (&output)[ItemsPerThread],
+                                      storage_type& /*storage*/)
+    {
+        warp_exchange_type().striped_to_blocked_shuffle(input, output);
+    }
+
     ROCPRIM_DEVICE ROCPRIM_INLINE
     unsigned int get_current_warp_size() const
     {
@@ -756,8 +982,11 @@ private:
     ROCPRIM_DEVICE ROCPRIM_INLINE
     unsigned int index(unsigned int n)
     {
-        // Move every 32-bank wide "row" (32 banks * 4 bytes) by one item
-        return has_bank_conflicts ? (n + n / banks_no) : n;
+        // Permute the items within every row of banks (banks_no banks * 4 bytes) by the index
+        // of the row, or move every row by one item
+        return use_swizzle   ? (n ^ ((n / row_items) % row_items))
+               : use_padding ? (n + n / row_items)
+                             : n;
     }
 };
 
@@ -31,6 +31,7 @@
 
 #include "detail/block_histogram_atomic.hpp"
 #include "detail/block_histogram_sort.hpp"
+#include "detail/block_histogram_warp_privatized.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -55,6 +56,15 @@ enum class block_histogram_algorithm
     /// * Performance is consistent regardless of sample bin distribution.
     using_sort,
 
+    /// Every warp counts its items with atomic additions in its own sub-histogram in the shared
+    /// memory, then the sub-histograms are summed into the bin counts.
+    /// \par Performance Notes:
+    /// * Atomic additions contend only within a warp, which suits skewed distributions of
+    /// many (e.g. 1024 - 4096) bins.
+    /// * The counts of warps with less than 2^16 items are packed as two 16-bit counters per
+    /// 32-bit word, the storage is <tt>ceil(Bins / 2) * warps</tt> words.
+    using_warp_privatized,
+
     /// \brief Default block_histogram algorithm.
     default_algorithm = using_atomic,
 };
@@ -81,6 +91,13 @@ struct select_block_histogram_impl<block_histogram_algorithm::using_sort>
     using type = block_histogram_sort<T, BlockSizeX, BlockSizeY, BlockSizeZ, ItemsPerThread, Bins>;
 };
 
+template<>
+struct select_block_histogram_impl<block_histogram_algorithm::using_warp_privatized>
+{
+    template<class T, unsigned int BlockSizeX, unsigned int BlockSizeY, unsigned int BlockSizeZ, unsigned int ItemsPerThread, unsigned int Bins>
+    using type = block_histogram_warp_privatized<T, BlockSizeX, BlockSizeY, BlockSizeZ, ItemsPerThread, Bins>;
+};
+
 } // end namespace detail
 
 /// \brief The block_histogram class is a block level parallel primitive which provides methods
@@ -93,8 +110,8 @@ struct select_block_histogram_impl<block_histogram_algorithm::using_sort>
 /// \tparam Algorithm - selected histogram algorithm, block_histogram_algorithm::default_algorithm by default.
 ///
 /// \par Overview
-/// * block_histogram has two alternative implementations: \p block_histogram_algorithm::using_atomic
-///   and block_histogram_algorithm::using_sort.
+/// * block_histogram has three alternative implementations: \p block_histogram_algorithm::using_atomic,
+///   block_histogram_algorithm::using_sort and block_histogram_algorithm::using_warp_privatized.
 ///
 /// \par Examples
 /// \parblock
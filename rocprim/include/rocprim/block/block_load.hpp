@@ -27,6 +27,9 @@
 #include "../intrinsics.hpp"
 #include "../functional.hpp"
 #include "../types.hpp"
+#include "../iterator/bitpacked_iterator.hpp"
+#include "../iterator/strided_iterator.hpp"
+#include "../iterator/transform_iterator.hpp"
 
 #include "block_load_func.hpp"
 #include "block_exchange.hpp"
@@ -62,6 +65,8 @@ enum class block_load_method
     ///   * \p ItemsPerThread is odd.
     ///   * The datatype \p T is not a primitive or a HIP vector type (e.g. int2,
     /// int4, etc.
+    /// * For a \p permutation_iterator over a pointer to indices, the indices are loaded as
+    /// vectors with the same requirements and the items are gathered one by one.
     block_load_vectorize,
 
     /// A striped arrangement of data from continuous memory is locally transposed
@@ -106,6 +111,18 @@ enum class block_load_method
 ///   * [block_load_transpose](\ref ::block_load_method::block_load_transpose)
 ///   * [block_load_warp_transpose](\ref ::block_load_method::block_load_warp_transpose)
 ///
+/// * Loads which are guarded by a range with a fall-back value for out-of-bound items use buffer
+/// loads when the input is a pointer, see \p block_load_direct_blocked_buffer.
+/// * Full tiles of a \p bitpacked_iterator are loaded by \p block_load_vectorize and
+/// \p block_load_transpose with vector loads of the packed words, which are unpacked in
+/// registers.
+/// * Full tiles of a \p transform_iterator over a pointer are loaded by \p block_load_vectorize
+/// and \p block_load_transpose with vector loads of the underlying items, which are transformed
+/// in registers.
+/// * \p block_load_transpose loads a \p strided_iterator over a pointer with a small stride as
+/// contiguous tiles through shared memory, and a \p pitched_2d_iterator row by row with
+/// incrementally advanced rows and columns, so both are loaded with coalesced accesses.
+///
 /// \par Example:
 /// \parblock
 /// In the examples load operation is performed on block of 128 threads, using type
@@ -233,8 +250,8 @@ public:
                       "The type T must be such that an object of type InputIterator "
                       "can be dereferenced and then implicitly converted to T.");
         const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
-        block_load_direct_blocked(flat_id, block_input, items, valid,
-                                  out_of_bounds);
+        block_load_direct_blocked_buffer(flat_id, block_input, items, valid,
+                                         out_of_bounds);
     }
 
     /// \brief Loads data from continuous memory into an arrangement of items across the
@@ -449,8 +466,8 @@ public:
                       "The type T must be such that an object of type InputIterator "
                       "can be dereferenced and then implicitly converted to T.");
         const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
-        block_load_direct_striped<BlockSize>(flat_id, block_input, items, valid,
-                                             out_of_bounds);
+        block_load_direct_striped_buffer<BlockSize>(flat_id, block_input, items, valid,
+                                                    out_of_bounds);
     }
 
     template<class InputIterator>
@@ -501,8 +518,8 @@ public:
                       "can be dereferenced and then implicitly converted to T.");
         (void) storage;
         const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
-        block_load_direct_striped<BlockSize>(flat_id, block_input, items, valid,
-                                             out_of_bounds);
+        block_load_direct_striped_buffer<BlockSize>(flat_id, block_input, items, valid,
+                                                    out_of_bounds);
     }
 };
 
@@ -546,6 +563,46 @@ public:
         block_load_direct_blocked(flat_id, block_input, items);
     }
 
+    template<class ValueIterator, class Index, class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(permutation_iterator<ValueIterator, Index*> block_input,
+              U (&items)[ItemsPerThread])
+    {
+        using value_type = typename std::iterator_traits<ValueIterator>::value_type;
+        static_assert(std::is_convertible<value_type, T>::value,
+                      "The type T must be such that an object of type ValueIterator "
+                      "can be dereferenced and then implicitly converted to T.");
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        // The indices are loaded as vectors, the values are gathered
+        block_load_direct_blocked_vectorized(flat_id, block_input, items);
+    }
+
+    template<unsigned int BitWidth, class V, class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(bitpacked_iterator<BitWidth, V> block_input,
+              U (&items)[ItemsPerThread])
+    {
+        static_assert(std::is_convertible<V, T>::value,
+                      "The type T must be such that an object of type InputIterator "
+                      "can be dereferenced and then implicitly converted to T.");
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        // The packed words are loaded as vectors and unpacked in registers
+        block_load_direct_blocked_vectorized(flat_id, block_input, items);
+    }
+
+    template<class V, class UnaryFunction, class ValueType, class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(transform_iterator<V*, UnaryFunction, ValueType> block_input,
+              U (&items)[ItemsPerThread])
+    {
+        static_assert(std::is_convertible<ValueType, T>::value,
+                      "The type T must be such that an object of type InputIterator "
+                      "can be dereferenced and then implicitly converted to T.");
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        // The underlying items are loaded as vectors and transformed in registers
+        block_load_direct_blocked_vectorized(flat_id, block_input, items);
+    }
+
     template<class InputIterator>
     ROCPRIM_DEVICE ROCPRIM_INLINE
     void load(InputIterator block_input,
@@ -575,8 +632,8 @@ public:
                       "The type T must be such that an object of type InputIterator "
                       "can be dereferenced and then implicitly converted to T.");
         const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
-        block_load_direct_blocked(flat_id, block_input, items, valid,
-                                  out_of_bounds);
+        block_load_direct_blocked_buffer(flat_id, block_input, items, valid,
+                                         out_of_bounds);
     }
 
     ROCPRIM_DEVICE ROCPRIM_INLINE
@@ -701,8 +758,8 @@ public:
                       "can be dereferenced and then implicitly converted to T.");
         ROCPRIM_SHARED_MEMORY storage_type storage;
         const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
-        block_load_direct_striped<BlockSize>(flat_id, block_input, items, valid,
-                                             out_of_bounds);
+        block_load_direct_striped_buffer<BlockSize>(flat_id, block_input, items, valid,
+                                                    out_of_bounds);
         block_exchange_type().striped_to_blocked(items, items, storage);
     }
 
@@ -753,10 +810,217 @@ public:
                       "The type T must be such that an object of type InputIterator "
                       "can be dereferenced and then implicitly converted to T.");
         const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
-        block_load_direct_striped<BlockSize>(flat_id, block_input, items, valid,
-                                             out_of_bounds);
+        block_load_direct_striped_buffer<BlockSize>(flat_id, block_input, items, valid,
+                                                    out_of_bounds);
         block_exchange_type().striped_to_blocked(items, items, storage);
     }
+    /// \brief Loads a full tile through a \p bitpacked_iterator. The items are unpacked
+    /// directly into the blocked arrangement from vector loads of the packed words, no
+    /// exchange through shared memory is needed.
+    template<unsigned int BitWidth, class V>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void load(bitpacked_iterator<BitWidth, V> block_input,
+              T (&items)[ItemsPerThread])
+    {
+        static_assert(std::is_convertible<V, T>::value,
+                      "The type T must be such that an object of type InputIterator "
+                      "can be dereferenced and then implicitly converted to T.");
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        block_load_direct_blocked_vectorized(flat_id, block_input, items);
+    }
+
+    template<unsigned int BitWidth, class V>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(bitpacked_iterator<BitWidth, V> block_input,
+              T (&items)[ItemsPerThread],
+              storage_type& storage)
+    {
+        (void)storage;
+        load(block_input, items);
+    }
+
+    /// \brief Loads a full tile through a \p transform_iterator. When the underlying iterator is
+    /// a pointer aligned to the vectors, the underlying items are loaded as vectors striped
+    /// across the threads and transformed in registers before the exchange through shared memory.
+    template<class InputIterator, class UnaryFunction, class ValueType>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void load(transform_iterator<InputIterator, UnaryFunction, ValueType> block_input,
+              T (&items)[ItemsPerThread])
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        load(block_input, items, storage);
+    }
+
+    template<class InputIterator, class UnaryFunction, class ValueType>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(transform_iterator<InputIterator, UnaryFunction, ValueType> block_input,
+              T (&items)[ItemsPerThread],
+              storage_type& storage)
+    {
+        static_assert(std::is_convertible<ValueType, T>::value,
+                      "The type T must be such that an object of type InputIterator "
+                      "can be dereferenced and then implicitly converted to T.");
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        const unsigned int items_per_vector
+            = detail::block_load_vector_striped<BlockSize>(flat_id, block_input, items);
+        if(items_per_vector == 0)
+        {
+            block_load_direct_striped<BlockSize>(flat_id, block_input, items);
+            block_exchange_type().striped_to_blocked(items, items, storage);
+            return;
+        }
+
+        // The item i of the thread is the item i % n of the vector flat_id + (i / n) * BlockSize
+        unsigned int ranks[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int item = 0; item < ItemsPerThread; item++)
+        {
+            const unsigned int vector = flat_id + (item / items_per_vector) * BlockSize;
+            ranks[item]               = vector * items_per_vector + item % items_per_vector;
+        }
+        block_exchange_type().scatter_to_blocked(items, items, ranks, storage);
+    }
+
+    /// \brief Loads data through a \p strided_iterator over a pointer. A stride of 1 is loaded
+    /// as the pointer itself, strides up to \p max_tiled_stride are loaded as contiguous tiles
+    /// through shared memory, so the global accesses stay coalesced.
+    template<class V>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void load(strided_iterator<V*> block_input,
+              T (&items)[ItemsPerThread])
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        load(block_input, items, storage);
+    }
+
+    template<class V>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void load(strided_iterator<V*> block_input,
+              T (&items)[ItemsPerThread],
+              unsigned int valid)
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        load(block_input, items, valid, storage);
+    }
+
+    template<class V, class Default>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void load(strided_iterator<V*> block_input,
+              T (&items)[ItemsPerThread],
+              unsigned int valid,
+              Default out_of_bounds)
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        load(block_input, items, valid, out_of_bounds, storage);
+    }
+
+    template<class V>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(strided_iterator<V*> block_input,
+              T (&items)[ItemsPerThread],
+              storage_type& storage)
+    {
+        load(block_input, items, BlockSize * ItemsPerThread, storage);
+    }
+
+    template<class V>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(strided_iterator<V*> block_input,
+              T (&items)[ItemsPerThread],
+              unsigned int valid,
+              storage_type& storage)
+    {
+        static_assert(std::is_convertible<V, T>::value,
+                      "The type T must be such that an object of type InputIterator "
+                      "can be dereferenced and then implicitly converted to T.");
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        const auto stride = block_input.stride();
+        if(stride == 1)
+        {
+            block_load_direct_striped<BlockSize>(flat_id, block_input.base(), items, valid);
+            block_exchange_type().striped_to_blocked(items, items, storage);
+        }
+        else if(stride > 1 && stride <= max_tiled_stride)
+        {
+            load_strided_tiles(flat_id,
+                               block_input.base(),
+                               static_cast<unsigned int>(stride),
+                               items,
+                               valid,
+                               storage);
+        }
+        else
+        {
+            block_load_direct_striped<BlockSize>(flat_id, block_input, items, valid);
+            block_exchange_type().striped_to_blocked(items, items, storage);
+        }
+    }
+
+    template<class V, class Default>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(strided_iterator<V*> block_input,
+              T (&items)[ItemsPerThread],
+              unsigned int valid,
+              Default out_of_bounds,
+              storage_type& storage)
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int item = 0; item < ItemsPerThread; item++)
+        {
+            items[item] = static_cast<T>(out_of_bounds);
+        }
+        load(block_input, items, valid, storage);
+    }
+
+    /// The largest stride of a \p strided_iterator loaded as contiguous tiles.
+    static constexpr unsigned int max_tiled_stride = 4;
+
+private:
+    // Loads the span of the strided items as stride contiguous, coalesced tiles of
+    // BlockSize * ItemsPerThread elements and picks every stride-th element of each tile.
+    template<class V>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load_strided_tiles(const unsigned int flat_id,
+                            V* input,
+                            const unsigned int stride,
+                            T (&items)[ItemsPerThread],
+                            const unsigned int valid,
+                            storage_type& storage)
+    {
+        constexpr unsigned int tile_size = BlockSize * ItemsPerThread;
+        // The exchange buffer holds at least tile_size items
+        T* tile = reinterpret_cast<T*>(&storage);
+
+        const unsigned int span = valid == 0 ? 0 : (valid - 1) * stride + 1;
+        for(unsigned int tile_offset = 0; tile_offset < span; tile_offset += tile_size)
+        {
+            if(tile_offset != 0)
+            {
+                ::rocprim::syncthreads();
+            }
+            ROCPRIM_UNROLL
+            for(unsigned int item = 0; item < ItemsPerThread; item++)
+            {
+                const unsigned int index = item * BlockSize + flat_id;
+                if(tile_offset + index < span)
+                {
+                    tile[index] = input[tile_offset + index];
+                }
+            }
+            ::rocprim::syncthreads();
+            ROCPRIM_UNROLL
+            for(unsigned int item = 0; item < ItemsPerThread; item++)
+            {
+                const unsigned int index    = flat_id * ItemsPerThread + item;
+                const unsigned int position = index * stride;
+                if(index < valid && position >= tile_offset
+                   && position - tile_offset < tile_size)
+                {
+                    items[item] = tile[position - tile_offset];
+                }
+            }
+        }
+    }
 };
 
 template<
@@ -0,0 +1,271 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef ROCPRIM_BLOCK_BLOCK_LOAD_BALANCE_HPP_
+#define ROCPRIM_BLOCK_BLOCK_LOAD_BALANCE_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/merge_path.hpp"
+#include "../detail/various.hpp"
+
+#include "../intrinsics.hpp"
+#include "../functional.hpp"
+
+#include "../iterator/counting_iterator.hpp"
+
+/// \addtogroup blockmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Orders the ends of the segments before the outputs: the end e of a segment precedes
+// the output i when e <= i, so the output is not in the segment
+struct load_balance_offset_less
+{
+    template<class T, class U>
+    ROCPRIM_HOST_DEVICE inline
+    bool operator()(const T& a, const U& b) const
+    {
+        return static_cast<size_t>(a) < static_cast<size_t>(b);
+    }
+};
+
+} // end namespace detail
+
+/// \brief The block_load_balance class is a block level parallel primitive which distributes
+/// the work items of CSR-like segments evenly over the threads of a block.
+///
+/// \tparam BlockSizeX - the number of threads in a block's x dimension.
+/// \tparam ItemsPerThread - the number of steps of the merge path walked by every thread.
+/// \tparam BlockSizeY - the number of threads in a block's y dimension, defaults to 1.
+/// \tparam BlockSizeZ - the number of threads in a block's z dimension, defaults to 1.
+///
+/// \par Overview
+/// * The segments are given by the offsets of their first outputs, the exclusive scan of their
+///   numbers of outputs (for example the row offsets of a CSR matrix): the output \p i belongs to
+///   the segment \p s when <tt>segment_offsets[s] <= i < segment_offsets[s + 1]</tt>.
+/// * The outputs and the ends of the segments are merged as in a merge path, the path has
+///   <tt>path_size(segments, outputs)</tt> steps and every block processes a tile of
+///   \p items_per_tile consecutive steps. Both long segments and runs of empty segments are
+///   split evenly, a tile has at most \p items_per_tile outputs.
+/// * Every thread finds the start of its steps by a binary search, and then walks them
+///   serially, monotonically loading the offsets of the segments it crosses.
+///
+/// \par Examples
+/// \parblock
+/// In the examples the nonzeros of a CSR matrix are expanded to their rows.
+///
+/// \code{.cpp}
+/// __global__ void example_kernel(const int * row_offsets, unsigned int rows, size_t nonzeros, ...)
+/// {
+///     using block_load_balance_t = rocprim::block_load_balance<128, 4>;
+///     __shared__ block_load_balance_t::storage_type storage;
+///
+///     unsigned int row_ids[4];
+///     size_t tile_output_begin;
+///     unsigned int tile_outputs;
+///     block_load_balance_t().search(
+///         row_offsets, rows, nonzeros,
+///         size_t(blockIdx.x) * block_load_balance_t::items_per_tile,
+///         row_ids, tile_output_begin, tile_outputs, storage
+///     );
+///     // row_ids[i] is the row of the nonzero tile_output_begin + threadIdx.x * 4 + i
+///     // if threadIdx.x * 4 + i < tile_outputs
+///     ...
+/// }
+/// \endcode
+/// \endparblock
+template<
+    unsigned int BlockSizeX,
+    unsigned int ItemsPerThread,
+    unsigned int BlockSizeY = 1,
+    unsigned int BlockSizeZ = 1
+>
+class block_load_balance
+{
+    static constexpr unsigned int BlockSize = BlockSizeX * BlockSizeY * BlockSizeZ;
+
+public:
+    /// \brief The number of steps of the merge path processed by a block.
+    static constexpr unsigned int items_per_tile = BlockSize * ItemsPerThread;
+
+private:
+    // Struct used for creating a raw_storage object for this primitive's temporary storage.
+    struct storage_type_
+    {
+        unsigned int segment_ids[items_per_tile];
+    };
+
+public:
+    /// \brief Struct used to allocate a temporary memory that is required for thread
+    /// communication during operations provided by related parallel primitive.
+    ///
+    /// Depending on the implemention the operations exposed by parallel primitive may
+    /// require a temporary storage for thread communication. The storage should be allocated
+    /// using keywords <tt>__shared__</tt>. It can be aliased to
+    /// an externally allocated memory, or be a part of a union type with other storage types
+    /// to increase shared memory reusability.
+    #ifndef DOXYGEN_SHOULD_SKIP_THIS // hides storage_type implementation for Doxygen
+    using storage_type = detail::raw_storage<storage_type_>;
+    #else
+    using storage_type = storage_type_; // only for Doxygen
+    #endif
+
+    /// \brief Returns the number of steps of the merge path of \p segments segments with
+    /// \p outputs outputs in total.
+    ///
+    /// Only the ends of the segments before the last one are merged, the end of the last
+    /// segment is \p outputs.
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    static constexpr size_t path_size(const unsigned int segments, const size_t outputs)
+    {
+        return segments == 0 ? outputs : outputs + segments - 1;
+    }
+
+    /// \brief Finds the segments of the outputs of a tile of the merge path.
+    ///
+    /// \tparam OffsetIterator - random-access iterator type of the offsets of the segments.
+    ///
+    /// \param [in] segment_offsets - the offsets of the first outputs of the segments,
+    /// \p segments values sorted in ascending order, the first one is \p 0 and the others are
+    /// not larger than \p outputs.
+    /// \param [in] segments - the number of segments.
+    /// \param [in] outputs - the total number of outputs of the segments.
+    /// \param [in] tile_begin - the first step of the merge path processed by the block, usually
+    /// <tt>blockIdx.x * items_per_tile</tt>. It must be the same for all threads of the block.
+    /// \param [out] segment_ids - the segments of the outputs of the tile in a blocked
+    /// arrangement: <tt>segment_ids[i]</tt> is the segment of the output
+    /// <tt>tile_output_begin + flat_id * ItemsPerThread + i</tt>, it is valid if
+    /// <tt>flat_id * ItemsPerThread + i < tile_outputs</tt>.
+    /// \param [out] tile_output_begin - the first output of the tile.
+    /// \param [out] tile_outputs - the number of outputs of the tile.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class OffsetIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void search(OffsetIterator     segment_offsets,
+                const unsigned int segments,
+                const size_t       outputs,
+                const size_t       tile_begin,
+                unsigned int (&segment_ids)[ItemsPerThread],
+                size_t&            tile_output_begin,
+                unsigned int&      tile_outputs,
+                storage_type&      storage)
+    {
+        const unsigned int flat_id
+            = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        const auto   ends      = segment_offsets + 1;
+        const size_t end_count = segments == 0 ? 0 : segments - 1;
+        const size_t path_end  = path_size(segments, outputs);
+
+        const size_t tile_end      = ::rocprim::min<size_t>(tile_begin + items_per_tile, path_end);
+        const size_t thread_begin
+            = ::rocprim::min<size_t>(tile_begin + flat_id * ItemsPerThread, tile_end);
+
+        const auto outputs_input = ::rocprim::counting_iterator<size_t>(0);
+        const auto less          = detail::load_balance_offset_less();
+
+        // The number of segment ends before the steps is the segment of the next output
+        const size_t tile_segment
+            = detail::merge_path(ends, outputs_input, end_count, outputs, tile_begin, less);
+        const size_t tile_segment_end
+            = detail::merge_path(ends, outputs_input, end_count, outputs, tile_end, less);
+        size_t segment
+            = detail::merge_path(ends, outputs_input, end_count, outputs, thread_begin, less);
+        size_t output = thread_begin - segment;
+
+        tile_output_begin = tile_begin - tile_segment;
+        tile_outputs      = static_cast<unsigned int>(tile_end - tile_segment_end
+                                                      - tile_output_begin);
+
+        auto& segment_ids_shared = storage.get().segment_ids;
+        size_t segment_end = segment < end_count ? static_cast<size_t>(ends[segment]) : outputs;
+        const size_t thread_end = ::rocprim::min<size_t>(thread_begin + ItemsPerThread, tile_end);
+        for(size_t step = thread_begin; step < thread_end; ++step)
+        {
+            if(segment_end <= output)
+            {
+                // Crosses the end of the segment
+                ++segment;
+                segment_end = segment < end_count ? static_cast<size_t>(ends[segment]) : outputs;
+            }
+            else
+            {
+                segment_ids_shared[output - tile_output_begin] = static_cast<unsigned int>(segment);
+                ++output;
+            }
+        }
+        ::rocprim::syncthreads();
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            const unsigned int index = flat_id * ItemsPerThread + i;
+            if(index < tile_outputs)
+            {
+                segment_ids[i] = segment_ids_shared[index];
+            }
+        }
+    }
+
+    /// \overload
+    /// \brief Finds the segments of the outputs of a tile of the merge path.
+    ///
+    /// * This overload does not accept storage argument. Required shared memory is
+    /// allocated by the method itself.
+    template<class OffsetIterator>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void search(OffsetIterator     segment_offsets,
+                const unsigned int segments,
+                const size_t       outputs,
+                const size_t       tile_begin,
+                unsigned int (&segment_ids)[ItemsPerThread],
+                size_t&            tile_output_begin,
+                unsigned int&      tile_outputs)
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        search(segment_offsets,
+               segments,
+               outputs,
+               tile_begin,
+               segment_ids,
+               tile_output_begin,
+               tile_outputs,
+               storage);
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group blockmodule
+
+#endif // ROCPRIM_BLOCK_BLOCK_LOAD_BALANCE_HPP_
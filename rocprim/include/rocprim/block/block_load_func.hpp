@@ -21,11 +21,18 @@
 #ifndef ROCPRIM_BLOCK_BLOCK_LOAD_FUNC_HPP_
 #define ROCPRIM_BLOCK_BLOCK_LOAD_FUNC_HPP_
 
+#include <limits>
+#include <type_traits>
+
 #include "../config.hpp"
 #include "../detail/various.hpp"
 
 #include "../intrinsics.hpp"
 #include "../functional.hpp"
+#include "../iterator/bitpacked_iterator.hpp"
+#include "../iterator/permutation_iterator.hpp"
+#include "../iterator/pitched_2d_iterator.hpp"
+#include "../iterator/transform_iterator.hpp"
 #include "../types.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
@@ -221,6 +228,172 @@ block_load_direct_blocked_vectorized(unsigned int flat_id,
     block_load_direct_blocked(flat_id, block_input, items);
 }
 
+namespace detail
+{
+
+template<unsigned int BitWidth, class V, class U, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_bitpacked(unsigned int                    flat_id,
+                          bitpacked_iterator<BitWidth, V> block_input,
+                          U (&items)[ItemsPerThread],
+                          std::false_type)
+{
+    block_load_direct_blocked(flat_id, block_input, items);
+}
+
+template<unsigned int BitWidth, class V, class U, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_bitpacked(unsigned int                    flat_id,
+                          bitpacked_iterator<BitWidth, V> block_input,
+                          U (&items)[ItemsPerThread],
+                          std::true_type)
+{
+    constexpr unsigned int words_per_thread = ItemsPerThread * BitWidth / 32;
+    using vector_type = typename match_vector_type<unsigned int, words_per_thread>::type;
+
+    const size_t first_bit
+        = (static_cast<size_t>(block_input.index()) + flat_id * ItemsPerThread) * BitWidth;
+    const unsigned int* thread_words = block_input.words() + first_bit / 32;
+    if(first_bit % 32 != 0
+       || reinterpret_cast<uintptr_t>(thread_words) % sizeof(vector_type) != 0)
+    {
+        block_load_direct_blocked(flat_id, block_input, items);
+        return;
+    }
+
+    unsigned int words[words_per_thread];
+    block_load_direct_blocked_vectorized(0, thread_words, words);
+
+    ROCPRIM_UNROLL
+    for(unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        // The indices are known at compile time, the words stay in registers
+        const unsigned int bit   = item * BitWidth;
+        const unsigned int word  = bit / 32;
+        const unsigned int shift = bit % 32;
+        const unsigned int high  = shift + BitWidth > 32 ? words[word + 1] : 0u;
+        items[item] = bitpacked_extract<BitWidth, V>(words[word], high, shift);
+    }
+}
+
+} // end namespace detail
+
+/// \brief Loads integers packed with a fixed number of bits per value into a blocked
+/// arrangement of items across the thread block, the packed words of each thread are
+/// loaded as vectors and unpacked in registers.
+///
+/// The words are loaded with \p block_load_direct_blocked_vectorized when the items of a
+/// thread fill whole words (<tt>ItemsPerThread * BitWidth</tt> is a multiple of 32) and the
+/// first item of the thread starts at a word which is aligned for the vector loads,
+/// otherwise each item is unpacked from the one or two words holding it.
+///
+/// \tparam BitWidth - [inferred] the number of bits of each value
+/// \tparam V - [inferred] the value type of the iterator
+/// \tparam U - [inferred] the output data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the bit-packed iterator from the thread block to load from
+/// \param items - array that data is loaded to
+template<
+    unsigned int BitWidth,
+    class V,
+    class U,
+    unsigned int ItemsPerThread
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_blocked_vectorized(unsigned int flat_id,
+                                          bitpacked_iterator<BitWidth, V> block_input,
+                                          U (&items)[ItemsPerThread])
+{
+    detail::block_load_bitpacked(
+        flat_id,
+        block_input,
+        items,
+        std::integral_constant<bool, (ItemsPerThread * BitWidth) % 32 == 0>());
+}
+
+/// \brief Gathers data through a \p permutation_iterator into a blocked arrangement of items
+/// across the thread block, the indices are loaded as vectors.
+///
+/// The indices are loaded by \p block_load_direct_blocked_vectorized, so the same alignment
+/// requirements apply to the offset of the indices (\p block_input.indices()). Each value is then
+/// gathered separately.
+///
+/// \tparam ValueIterator - [inferred] the iterator type of the values
+/// \tparam Index - [inferred] the type of the indices
+/// \tparam U - [inferred] the output data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the permutation iterator from the thread block to load from
+/// \param items - array that data is loaded to
+template<
+    class ValueIterator,
+    class Index,
+    class U,
+    unsigned int ItemsPerThread
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_blocked_vectorized(unsigned int flat_id,
+                                          permutation_iterator<ValueIterator, Index*> block_input,
+                                          U (&items)[ItemsPerThread])
+{
+    typename std::remove_cv<Index>::type indices[ItemsPerThread];
+    block_load_direct_blocked_vectorized(flat_id, block_input.indices(), indices);
+
+    const ValueIterator values = block_input.values();
+    ROCPRIM_UNROLL
+    for (unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        items[item] = values[indices[item]];
+    }
+}
+
+/// \brief Loads data from continuous memory through a \p transform_iterator over a pointer into
+/// a blocked arrangement of items across the thread block, the underlying items are loaded as
+/// vectors.
+///
+/// The underlying items are loaded by \p block_load_direct_blocked_vectorized, so the same
+/// alignment requirements apply to the offset of the underlying pointer
+/// (\p block_input.base()). The function is then applied to the items in registers.
+///
+/// \tparam T - [inferred] the type of the underlying items
+/// \tparam UnaryFunction - [inferred] the type of the function applied to the items
+/// \tparam ValueType - [inferred] the value type of the iterator
+/// \tparam U - [inferred] the output data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the transform iterator from the thread block to load from
+/// \param items - array that data is loaded to
+template<
+    class T,
+    class UnaryFunction,
+    class ValueType,
+    class U,
+    unsigned int ItemsPerThread
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_blocked_vectorized(
+    unsigned int                                     flat_id,
+    transform_iterator<T*, UnaryFunction, ValueType> block_input,
+    U (&items)[ItemsPerThread])
+{
+    typename std::remove_cv<T>::type values[ItemsPerThread];
+    block_load_direct_blocked_vectorized(flat_id, block_input.base(), values);
+
+    UnaryFunction transform_op = block_input.transform_op();
+    ROCPRIM_UNROLL
+    for (unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        items[item] = transform_op(values[item]);
+    }
+}
+
 /// \brief Loads data from continuous memory into a striped arrangement of items
 /// across the thread block.
 ///
@@ -343,6 +516,460 @@ void block_load_direct_striped(unsigned int flat_id,
     block_load_direct_striped<BlockSize>(flat_id, block_input, items, valid);
 }
 
+/// \brief Loads data from the rows of a pitched 2D allocation into a striped arrangement of
+/// items across the thread block.
+///
+/// The row and the column of each thread are computed once and advanced incrementally, the
+/// consecutive threads access consecutive elements of a row.
+///
+/// \tparam BlockSize - the number of threads in a block
+/// \tparam U - [inferred] the element type of the iterator
+/// \tparam T - [inferred] the data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the pitched iterator from the thread block to load from
+/// \param items - array that data is loaded to
+template<
+    unsigned int BlockSize,
+    class U,
+    class T,
+    unsigned int ItemsPerThread
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_striped(unsigned int flat_id,
+                               pitched_2d_iterator<U> block_input,
+                               T (&items)[ItemsPerThread])
+{
+    block_load_direct_striped<BlockSize>(flat_id,
+                                         block_input,
+                                         items,
+                                         BlockSize * ItemsPerThread);
+}
+
+/// \brief Loads data from the rows of a pitched 2D allocation into a striped arrangement of
+/// items across the thread block, which is guarded by range \p valid.
+///
+/// The row and the column of each thread are computed once and advanced incrementally, the
+/// consecutive threads access consecutive elements of a row.
+///
+/// \tparam BlockSize - the number of threads in a block
+/// \tparam U - [inferred] the element type of the iterator
+/// \tparam T - [inferred] the data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the pitched iterator from the thread block to load from
+/// \param items - array that data is loaded to
+/// \param valid - maximum range of valid numbers to load
+template<
+    unsigned int BlockSize,
+    class U,
+    class T,
+    unsigned int ItemsPerThread
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_striped(unsigned int flat_id,
+                               pitched_2d_iterator<U> block_input,
+                               T (&items)[ItemsPerThread],
+                               unsigned int valid)
+{
+    const size_t width = block_input.width();
+    const size_t start = static_cast<size_t>(block_input.index()) + flat_id;
+    size_t       row    = start / width;
+    size_t       column = start - row * width;
+    ROCPRIM_UNROLL
+    for (unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        if (flat_id + item * BlockSize < valid)
+        {
+            items[item] = block_input.row(row)[column];
+        }
+        column += BlockSize;
+        if (column >= width)
+        {
+            row += column / width;
+            column %= width;
+        }
+    }
+}
+
+namespace detail
+{
+
+// Loads the vectors flat_id, flat_id + BlockSize, flat_id + 2 * BlockSize... of a full tile, the
+// items [i * n, (i + 1) * n) of the thread are the items of the vector flat_id + i * BlockSize,
+// where n is the returned number of items per vector. Nothing is loaded and 0 is returned when
+// the items are not vectorizable or block_input is not aligned to the vectors.
+template<unsigned int BlockSize, class InputIterator, class U, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+unsigned int block_load_vector_striped(unsigned int /*flat_id*/,
+                                       InputIterator /*block_input*/,
+                                       U (&/*items*/)[ItemsPerThread])
+{
+    return 0;
+}
+
+template<unsigned int BlockSize, class T, class U, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+auto block_load_vector_striped(unsigned int flat_id, T* block_input, U (&items)[ItemsPerThread])
+    -> typename std::enable_if<is_vectorizable<typename std::remove_cv<T>::type,
+                                               ItemsPerThread>::value,
+                               unsigned int>::type
+{
+    using value_type  = typename std::remove_cv<T>::type;
+    using vector_type = typename match_vector_type<value_type, ItemsPerThread>::type;
+    constexpr unsigned int vectors_per_thread
+        = (sizeof(value_type) * ItemsPerThread) / sizeof(vector_type);
+    constexpr unsigned int items_per_vector = ItemsPerThread / vectors_per_thread;
+
+    if(reinterpret_cast<uintptr_t>(block_input) % sizeof(vector_type) != 0)
+    {
+        return 0;
+    }
+
+    const vector_type* vector_ptr = reinterpret_cast<const vector_type*>(block_input);
+    vector_type        vector_items[vectors_per_thread];
+    ROCPRIM_UNROLL
+    for(unsigned int item = 0; item < vectors_per_thread; item++)
+    {
+        vector_items[item] = vector_ptr[flat_id + item * BlockSize];
+    }
+
+    ROCPRIM_UNROLL
+    for(unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        items[item] = *(reinterpret_cast<const value_type*>(vector_items) + item);
+    }
+    return items_per_vector;
+}
+
+// The underlying items of a transform_iterator are loaded as vectors and the function is applied
+// in registers
+template<unsigned int BlockSize,
+         class InputIterator,
+         class UnaryFunction,
+         class ValueType,
+         class U,
+         unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+unsigned int block_load_vector_striped(
+    unsigned int                                                flat_id,
+    transform_iterator<InputIterator, UnaryFunction, ValueType> block_input,
+    U (&items)[ItemsPerThread])
+{
+    typename std::iterator_traits<InputIterator>::value_type values[ItemsPerThread];
+    const unsigned int items_per_vector
+        = block_load_vector_striped<BlockSize>(flat_id, block_input.base(), values);
+    if(items_per_vector == 0)
+    {
+        return 0;
+    }
+
+    UnaryFunction transform_op = block_input.transform_op();
+    ROCPRIM_UNROLL
+    for(unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        items[item] = transform_op(values[item]);
+    }
+    return items_per_vector;
+}
+
+} // end namespace detail
+
+namespace detail
+{
+
+#if ROCPRIM_DETAIL_USE_BUFFER_LOAD
+
+// The loads are not predicated: the resource covers the valid items only, and the hardware
+// returns zeros for the items after them.
+template<unsigned int Stride, class V, class T, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_buffer(unsigned int thread_offset,
+                       const V* block_input,
+                       T (&items)[ItemsPerThread],
+                       unsigned int valid,
+                       std::true_type /*is_buffer_loadable*/)
+{
+    constexpr unsigned int max_valid = std::numeric_limits<unsigned int>::max() / sizeof(V);
+    const buffer_resource resource
+        = make_buffer_resource(block_input, ::rocprim::min(valid, max_valid) * sizeof(V));
+    ROCPRIM_UNROLL
+    for (unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        items[item] = buffer_load<V>(resource, (thread_offset + item * Stride) * sizeof(V));
+    }
+}
+
+#endif // ROCPRIM_DETAIL_USE_BUFFER_LOAD
+
+template<unsigned int Stride, class V, class T, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_buffer(unsigned int thread_offset,
+                       const V* block_input,
+                       T (&items)[ItemsPerThread],
+                       unsigned int valid,
+                       std::false_type /*is_buffer_loadable*/)
+{
+    ROCPRIM_UNROLL
+    for (unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        if (thread_offset + item * Stride < valid)
+        {
+            items[item] = block_input[thread_offset + item * Stride];
+        }
+    }
+}
+
+template<unsigned int Stride, class T, unsigned int ItemsPerThread, class Default>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void select_out_of_bounds(unsigned int thread_offset,
+                          T (&items)[ItemsPerThread],
+                          unsigned int valid,
+                          Default out_of_bounds)
+{
+    ROCPRIM_UNROLL
+    for (unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        items[item] = thread_offset + item * Stride < valid ? items[item] : T(out_of_bounds);
+    }
+}
+
+} // end namespace detail
+
+/// \brief Loads data from continuous memory into a blocked arrangement of items
+/// across the thread block, which is guarded by range \p valid, using buffer loads.
+///
+/// When \p block_input is a pointer to a type which can be loaded with buffer loads
+/// (trivially copyable types of 4, 8 or 16 bytes aligned to at least 4 bytes) on the target,
+/// the loads are not guarded by comparisons: a buffer resource covers the valid items and the
+/// hardware returns zeros for the out-of-bound items. Otherwise the items are loaded as with
+/// \p block_load_direct_blocked.
+///
+/// \tparam InputIterator - [inferred] an iterator type for input (can be a simple
+/// pointer
+/// \tparam T - [inferred] the data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the input iterator from the thread block to load from, it should be
+/// the same for all threads of the block
+/// \param items - array that data is loaded to, the values of out-of-bound items are unspecified
+/// \param valid - maximum range of valid numbers to load
+template<
+    class InputIterator,
+    class T,
+    unsigned int ItemsPerThread
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_blocked_buffer(unsigned int flat_id,
+                                      InputIterator block_input,
+                                      T (&items)[ItemsPerThread],
+                                      unsigned int valid)
+{
+    block_load_direct_blocked(flat_id, block_input, items, valid);
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<
+    class V,
+    class T,
+    unsigned int ItemsPerThread
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_blocked_buffer(unsigned int flat_id,
+                                      V* block_input,
+                                      T (&items)[ItemsPerThread],
+                                      unsigned int valid)
+{
+    using value_type = typename std::remove_cv<V>::type;
+    detail::block_load_buffer<1>(flat_id * ItemsPerThread,
+                                 static_cast<const value_type*>(block_input),
+                                 items,
+                                 valid,
+                                 detail::is_buffer_loadable<value_type>());
+}
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/// \brief Loads data from continuous memory into a blocked arrangement of items
+/// across the thread block, which is guarded by range with a fall-back value
+/// for out-of-bound elements, using buffer loads.
+///
+/// When \p block_input is a pointer to a type which can be loaded with buffer loads
+/// on the target, the out-of-bound items are replaced with \p out_of_bounds by selects
+/// after unguarded buffer loads. Otherwise the items are loaded as with
+/// \p block_load_direct_blocked.
+///
+/// \tparam InputIterator - [inferred] an iterator type for input (can be a simple
+/// pointer
+/// \tparam T - [inferred] the data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+/// \tparam Default - [inferred] The data type of the default value
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the input iterator from the thread block to load from, it should be
+/// the same for all threads of the block
+/// \param items - array that data is loaded to
+/// \param valid - maximum range of valid numbers to load
+/// \param out_of_bounds - default value assigned to out-of-bound items
+template<
+    class InputIterator,
+    class T,
+    unsigned int ItemsPerThread,
+    class Default
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_blocked_buffer(unsigned int flat_id,
+                                      InputIterator block_input,
+                                      T (&items)[ItemsPerThread],
+                                      unsigned int valid,
+                                      Default out_of_bounds)
+{
+    block_load_direct_blocked(flat_id, block_input, items, valid, out_of_bounds);
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<
+    class V,
+    class T,
+    unsigned int ItemsPerThread,
+    class Default
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_blocked_buffer(unsigned int flat_id,
+                                      V* block_input,
+                                      T (&items)[ItemsPerThread],
+                                      unsigned int valid,
+                                      Default out_of_bounds)
+{
+    block_load_direct_blocked_buffer(flat_id, block_input, items, valid);
+    detail::select_out_of_bounds<1>(flat_id * ItemsPerThread, items, valid, out_of_bounds);
+}
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/// \brief Loads data from continuous memory into a striped arrangement of items
+/// across the thread block, which is guarded by range \p valid, using buffer loads.
+///
+/// When \p block_input is a pointer to a type which can be loaded with buffer loads
+/// (trivially copyable types of 4, 8 or 16 bytes aligned to at least 4 bytes) on the target,
+/// the loads are not guarded by comparisons: a buffer resource covers the valid items and the
+/// hardware returns zeros for the out-of-bound items. Otherwise the items are loaded as with
+/// \p block_load_direct_striped.
+///
+/// \tparam BlockSize - the number of threads in a block
+/// \tparam InputIterator - [inferred] an iterator type for input (can be a simple
+/// pointer
+/// \tparam T - [inferred] the data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the input iterator from the thread block to load from, it should be
+/// the same for all threads of the block
+/// \param items - array that data is loaded to, the values of out-of-bound items are unspecified
+/// \param valid - maximum range of valid numbers to load
+template<
+    unsigned int BlockSize,
+    class InputIterator,
+    class T,
+    unsigned int ItemsPerThread
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_striped_buffer(unsigned int flat_id,
+                                      InputIterator block_input,
+                                      T (&items)[ItemsPerThread],
+                                      unsigned int valid)
+{
+    block_load_direct_striped<BlockSize>(flat_id, block_input, items, valid);
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<
+    unsigned int BlockSize,
+    class V,
+    class T,
+    unsigned int ItemsPerThread
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_striped_buffer(unsigned int flat_id,
+                                      V* block_input,
+                                      T (&items)[ItemsPerThread],
+                                      unsigned int valid)
+{
+    using value_type = typename std::remove_cv<V>::type;
+    detail::block_load_buffer<BlockSize>(flat_id,
+                                         static_cast<const value_type*>(block_input),
+                                         items,
+                                         valid,
+                                         detail::is_buffer_loadable<value_type>());
+}
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/// \brief Loads data from continuous memory into a striped arrangement of items
+/// across the thread block, which is guarded by range with a fall-back value
+/// for out-of-bound elements, using buffer loads.
+///
+/// When \p block_input is a pointer to a type which can be loaded with buffer loads
+/// on the target, the out-of-bound items are replaced with \p out_of_bounds by selects
+/// after unguarded buffer loads. Otherwise the items are loaded as with
+/// \p block_load_direct_striped.
+///
+/// \tparam BlockSize - the number of threads in a block
+/// \tparam InputIterator - [inferred] an iterator type for input (can be a simple
+/// pointer
+/// \tparam T - [inferred] the data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+/// \tparam Default - [inferred] The data type of the default value
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the input iterator from the thread block to load from, it should be
+/// the same for all threads of the block
+/// \param items - array that data is loaded to
+/// \param valid - maximum range of valid numbers to load
+/// \param out_of_bounds - default value assigned to out-of-bound items
+template<
+    unsigned int BlockSize,
+    class InputIterator,
+    class T,
+    unsigned int ItemsPerThread,
+    class Default
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_striped_buffer(unsigned int flat_id,
+                                      InputIterator block_input,
+                                      T (&items)[ItemsPerThread],
+                                      unsigned int valid,
+                                      Default out_of_bounds)
+{
+    block_load_direct_striped<BlockSize>(flat_id, block_input, items, valid, out_of_bounds);
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<
+    unsigned int BlockSize,
+    class V,
+    class T,
+    unsigned int ItemsPerThread,
+    class Default
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_striped_buffer(unsigned int flat_id,
+                                      V* block_input,
+                                      T (&items)[ItemsPerThread],
+                                      unsigned int valid,
+                                      Default out_of_bounds)
+{
+    block_load_direct_striped_buffer<BlockSize>(flat_id, block_input, items, valid);
+    detail::select_out_of_bounds<BlockSize>(flat_id, items, valid, out_of_bounds);
+}
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
 /// \brief Loads data from continuous memory into a warp-striped arrangement of items
 /// across the thread block.
 ///
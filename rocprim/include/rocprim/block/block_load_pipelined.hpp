@@ -0,0 +1,217 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_BLOCK_BLOCK_LOAD_PIPELINED_HPP_
+#define ROCPRIM_BLOCK_BLOCK_LOAD_PIPELINED_HPP_
+
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/various.hpp"
+
+#include "../intrinsics.hpp"
+#include "../functional.hpp"
+#include "../types.hpp"
+
+#include "block_load_func.hpp"
+#include "block_exchange.hpp"
+
+/// \addtogroup blockmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief The \p block_load_pipelined class is a block level parallel primitive which loads
+/// tiles of data from continuous memory into a blocked arrangement of items across the thread
+/// block, and overlaps the loading of the next tile with the processing of the current one.
+///
+/// \tparam T - the input/output type.
+/// \tparam BlockSizeX - the number of threads in a block's x dimension.
+/// \tparam ItemsPerThread - the number of items to be processed by each thread.
+/// \tparam BlockSizeY - the number of threads in a block's y dimension, defaults to 1.
+/// \tparam BlockSizeZ - the number of threads in a block's z dimension, defaults to 1.
+///
+/// \par Overview
+/// * Loading is split in two steps: \p prefetch() issues the loads of a tile from global
+/// memory into registers of the object in a striped arrangement, and \p load() transposes
+/// the prefetched tile into a blocked arrangement through shared memory.
+/// * The loads issued by \p prefetch() are only waited for in the following \p load(), so
+/// when the next tile is prefetched before the current tile is processed, the latency of the
+/// global memory is hidden by the processing. It is useful in kernels that loop over tiles,
+/// especially with many items per thread and low occupancy.
+/// * The loads are coalesced as in the \p block_load_transpose method, at the cost of the
+/// registers holding the prefetched tile.
+///
+/// \par Example:
+/// \parblock
+/// In the example a block of 128 threads processes tiles of 8 \p int items per thread.
+///
+/// \code{.cpp}
+/// __global__ void example_kernel(int * input, unsigned int tiles, ...)
+/// {
+///     using block_load_type = rocprim::block_load_pipelined<int, 128, 8>;
+///     __shared__ block_load_type::storage_type storage;
+///
+///     block_load_type block_load;
+///     block_load.prefetch(input);
+///     for(unsigned int tile = 0; tile < tiles; tile++)
+///     {
+///         int items[8];
+///         block_load.load(items, storage);
+///         if(tile + 1 < tiles)
+///         {
+///             // The next tile is loaded while this one is processed
+///             block_load.prefetch(input + (tile + 1) * 128 * 8);
+///         }
+///         ...
+///         rocprim::syncthreads();
+///     }
+/// }
+/// \endcode
+/// \endparblock
+template<
+    class T,
+    unsigned int BlockSizeX,
+    unsigned int ItemsPerThread,
+    unsigned int BlockSizeY = 1,
+    unsigned int BlockSizeZ = 1
+>
+class block_load_pipelined
+{
+    static constexpr unsigned int BlockSize = BlockSizeX * BlockSizeY * BlockSizeZ;
+
+    using block_exchange_type = block_exchange<T, BlockSizeX, ItemsPerThread, BlockSizeY, BlockSizeZ>;
+
+public:
+    /// \brief Struct used to allocate a temporary memory that is required for thread
+    /// communication during operations provided by related parallel primitive.
+    ///
+    /// Depending on the implemention the operations exposed by parallel primitive may
+    /// require a temporary storage for thread communication. The storage should be allocated
+    /// using keywords \p __shared__. It can be aliased to
+    /// an externally allocated memory, or be a part of a union with other storage types
+    /// to increase shared memory reusability.
+    using storage_type = typename block_exchange_type::storage_type;
+
+    /// \brief Issues the loads of a tile from continuous memory.
+    ///
+    /// \tparam InputIterator - [inferred] an iterator type for input (can be a simple
+    /// pointer.
+    ///
+    /// \param [in] block_input - the input iterator from the thread block to load from.
+    ///
+    /// \par Overview
+    /// * The type \p T must be such that an object of type \p InputIterator
+    /// can be dereferenced and then implicitly converted to \p T.
+    template<class InputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void prefetch(InputIterator block_input)
+    {
+        using value_type = typename std::iterator_traits<InputIterator>::value_type;
+        static_assert(std::is_convertible<value_type, T>::value,
+                      "The type T must be such that an object of type InputIterator "
+                      "can be dereferenced and then implicitly converted to T.");
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        block_load_direct_striped<BlockSize>(flat_id, block_input, prefetched_);
+    }
+
+    /// \brief Issues the loads of a tile from continuous memory, which is guarded by
+    /// range \p valid.
+    ///
+    /// \tparam InputIterator - [inferred] an iterator type for input (can be a simple
+    /// pointer.
+    ///
+    /// \param [in] block_input - the input iterator from the thread block to load from.
+    /// \param [in] valid - maximum range of valid numbers to load.
+    ///
+    /// \par Overview
+    /// * The type \p T must be such that an object of type \p InputIterator
+    /// can be dereferenced and then implicitly converted to \p T.
+    template<class InputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void prefetch(InputIterator block_input,
+                  unsigned int valid)
+    {
+        using value_type = typename std::iterator_traits<InputIterator>::value_type;
+        static_assert(std::is_convertible<value_type, T>::value,
+                      "The type T must be such that an object of type InputIterator "
+                      "can be dereferenced and then implicitly converted to T.");
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        block_load_direct_striped<BlockSize>(flat_id, block_input, prefetched_, valid);
+    }
+
+    /// \brief Issues the loads of a tile from continuous memory, which is guarded by
+    /// range \p valid, with a default value for out-of-bound items.
+    ///
+    /// \tparam InputIterator - [inferred] an iterator type for input (can be a simple
+    /// pointer.
+    /// \tparam Default - [inferred] The data type of the default value.
+    ///
+    /// \param [in] block_input - the input iterator from the thread block to load from.
+    /// \param [in] valid - maximum range of valid numbers to load.
+    /// \param [in] out_of_bounds - default value assigned to out-of-bound items.
+    ///
+    /// \par Overview
+    /// * The type \p T must be such that an object of type \p InputIterator
+    /// can be dereferenced and then implicitly converted to \p T.
+    template<
+        class InputIterator,
+        class Default
+    >
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void prefetch(InputIterator block_input,
+                  unsigned int valid,
+                  Default out_of_bounds)
+    {
+        using value_type = typename std::iterator_traits<InputIterator>::value_type;
+        static_assert(std::is_convertible<value_type, T>::value,
+                      "The type T must be such that an object of type InputIterator "
+                      "can be dereferenced and then implicitly converted to T.");
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        block_load_direct_striped<BlockSize>(flat_id, block_input, prefetched_, valid,
+                                             out_of_bounds);
+    }
+
+    /// \brief Returns the last prefetched tile in a blocked arrangement of items.
+    ///
+    /// \param [out] items - array that data is loaded to.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(T (&items)[ItemsPerThread],
+              storage_type& storage)
+    {
+        block_exchange_type().striped_to_blocked(prefetched_, items, storage);
+    }
+
+private:
+    T prefetched_[ItemsPerThread];
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group blockmodule
+
+#endif // ROCPRIM_BLOCK_BLOCK_LOAD_PIPELINED_HPP_
@@ -0,0 +1,362 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef ROCPRIM_BLOCK_BLOCK_MERGE_HPP_
+#define ROCPRIM_BLOCK_BLOCK_MERGE_HPP_
+
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/merge_path.hpp"
+#include "../detail/various.hpp"
+
+#include "../intrinsics.hpp"
+#include "../functional.hpp"
+#include "../types.hpp"
+
+/// \addtogroup blockmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief The block_merge class is a block level parallel primitive which merges two sorted
+/// sequences held by the threads of a block in a blocked arrangement.
+///
+/// \tparam Key - the key type.
+/// \tparam BlockSizeX - the number of threads in a block's x dimension.
+/// \tparam ItemsPerThread - the number of items held by each thread, it can be any number.
+/// \tparam Value - [optional] the value type. By default, it's empty_type (keys only).
+/// \tparam BlockSizeY - the number of threads in a block's y dimension, defaults to 1.
+/// \tparam BlockSizeZ - the number of threads in a block's z dimension, defaults to 1.
+///
+/// \par Overview
+/// * The first \p size1 items of the block (in the blocked arrangement) are the first sorted
+///   sequence and the next \p size2 items are the second one. After the merge the first
+///   <tt>size1 + size2</tt> items of the block are sorted, the items past them are not compared
+///   and left unchanged.
+/// * The items are exchanged through shared memory, and every thread finds the start of its
+///   outputs by a binary search along the merge path (see \p merge_path), so the work is split
+///   evenly across threads whatever the sizes of the sequences are.
+/// * The merge is stable: on ties the items of the first sequence come first.
+///
+/// \par Examples
+/// \parblock
+/// In the examples two sorted lists of 256 keys are merged.
+///
+/// \code{.cpp}
+/// __global__ void example_kernel(...)
+/// {
+///     using block_merge_t = rocprim::block_merge<int, 128, 4>;
+///     __shared__ block_merge_t::storage_type storage;
+///
+///     int keys[4];
+///     // threads 0..63 hold the first list, threads 64..127 the second one
+///     ...
+///     block_merge_t().merge(keys, 256, storage);
+///     ...
+/// }
+/// \endcode
+/// \endparblock
+template<class Key,
+         unsigned int BlockSizeX,
+         unsigned int ItemsPerThread,
+         class Value             = empty_type,
+         unsigned int BlockSizeY = 1,
+         unsigned int BlockSizeZ = 1>
+class block_merge
+{
+    static constexpr unsigned int BlockSize       = BlockSizeX * BlockSizeY * BlockSizeZ;
+    static constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    using storage_type_ = detail::merge_storage<Key, Value, items_per_block>;
+
+public:
+    /// \brief Struct used to allocate a temporary memory that is required for thread
+    /// communication during operations provided by related parallel primitive.
+    ///
+    /// Depending on the implemention the operations exposed by parallel primitive may
+    /// require a temporary storage for thread communication. The storage should be allocated
+    /// using keywords <tt>__shared__</tt>. It can be aliased to
+    /// an externally allocated memory, or be a part of a union type with other storage types
+    /// to increase shared memory reusability.
+    #ifndef DOXYGEN_SHOULD_SKIP_THIS // hides storage_type implementation for Doxygen
+    using storage_type = detail::raw_storage<storage_type_>;
+    #else
+    using storage_type = storage_type_; // only for Doxygen
+    #endif
+
+    /// \brief Returns the number of items of the first sequence among the first \p diag items
+    /// of the stable merge of two sorted sequences.
+    ///
+    /// This is the partitioning step of the merge: the first \p diag merged items are the items
+    /// <tt>[0, split)</tt> of \p keys1 and <tt>[0, diag - split)</tt> of \p keys2, where
+    /// \p split is the returned value. It takes a binary search of
+    /// <tt>log2(min(size1, size2))</tt> steps, so it can be used to split merges of any size
+    /// (for example of tiles of device-wide sequences) evenly across threads or blocks.
+    ///
+    /// \tparam KeysIterator1 - random-access iterator type of the first sequence.
+    /// \tparam KeysIterator2 - random-access iterator type of the second sequence.
+    /// \tparam BinaryFunction - type of binary function used for comparison.
+    ///
+    /// \param [in] keys1 - iterator to the first item of the first sequence.
+    /// \param [in] keys2 - iterator to the first item of the second sequence.
+    /// \param [in] size1 - number of items of the first sequence.
+    /// \param [in] size2 - number of items of the second sequence.
+    /// \param [in] diag - number of merged items, not greater than <tt>size1 + size2</tt>.
+    /// \param [in] compare_function - comparison function object which returns true if the
+    /// first argument is ordered before the second.
+    template<class KeysIterator1,
+             class KeysIterator2,
+             class BinaryFunction = ::rocprim::less<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static unsigned int merge_path(KeysIterator1      keys1,
+                                   KeysIterator2      keys2,
+                                   const unsigned int size1,
+                                   const unsigned int size2,
+                                   const unsigned int diag,
+                                   BinaryFunction     compare_function = BinaryFunction())
+    {
+        return detail::merge_path(keys1, keys2, size1, size2, diag, compare_function);
+    }
+
+    /// \brief Merges the first \p size1 keys of the block with the rest of the keys.
+    ///
+    /// \tparam BinaryFunction - type of binary function used for comparison. Default type
+    /// is rocprim::less<Key>.
+    ///
+    /// \param [in, out] thread_keys - reference to an array of keys provided by a thread.
+    /// \param [in] size1 - number of items of the first sequence, the rest of the items of the
+    /// block are the second sequence.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] compare_function - comparison function object which returns true if the
+    /// first argument is ordered before the second. The signature of the function should be
+    /// equivalent to the following: <tt>bool f(const Key &a, const Key &b);</tt>. The signature
+    /// does not need to have <tt>const &</tt>, but function object must not modify the objects
+    /// passed to it.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class BinaryFunction = ::rocprim::less<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void merge(Key (&thread_keys)[ItemsPerThread],
+               const unsigned int size1,
+               storage_type&      storage,
+               BinaryFunction     compare_function = BinaryFunction())
+    {
+        empty_type thread_values[ItemsPerThread];
+        merge_impl(thread_keys,
+                   thread_values,
+                   size1,
+                   items_per_block - ::rocprim::min(size1, items_per_block),
+                   storage.get(),
+                   compare_function);
+    }
+
+    /// \brief Merges the first \p size1 keys of the block with the next \p size2 keys.
+    ///
+    /// \tparam BinaryFunction - type of binary function used for comparison. Default type
+    /// is rocprim::less<Key>.
+    ///
+    /// \param [in, out] thread_keys - reference to an array of keys provided by a thread.
+    /// \param [in] size1 - number of items of the first sequence.
+    /// \param [in] size2 - number of items of the second sequence, the items past
+    /// <tt>size1 + size2</tt> are not compared and left unchanged.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] compare_function - comparison function object which returns true if the
+    /// first argument is ordered before the second.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class BinaryFunction = ::rocprim::less<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void merge(Key (&thread_keys)[ItemsPerThread],
+               const unsigned int size1,
+               const unsigned int size2,
+               storage_type&      storage,
+               BinaryFunction     compare_function = BinaryFunction())
+    {
+        empty_type thread_values[ItemsPerThread];
+        merge_impl(thread_keys, thread_values, size1, size2, storage.get(), compare_function);
+    }
+
+    /// \brief Merges the first \p size1 keys and values of the block with the rest of them
+    /// by the keys.
+    ///
+    /// \tparam BinaryFunction - type of binary function used for comparison. Default type
+    /// is rocprim::less<Key>.
+    ///
+    /// \param [in, out] thread_keys - reference to an array of keys provided by a thread.
+    /// \param [in, out] thread_values - reference to an array of values provided by a thread.
+    /// \param [in] size1 - number of items of the first sequence, the rest of the items of the
+    /// block are the second sequence.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] compare_function - comparison function object which returns true if the
+    /// first argument is ordered before the second.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class BinaryFunction = ::rocprim::less<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void merge(Key (&thread_keys)[ItemsPerThread],
+               Value (&thread_values)[ItemsPerThread],
+               const unsigned int size1,
+               storage_type&      storage,
+               BinaryFunction     compare_function = BinaryFunction())
+    {
+        merge_impl(thread_keys,
+                   thread_values,
+                   size1,
+                   items_per_block - ::rocprim::min(size1, items_per_block),
+                   storage.get(),
+                   compare_function);
+    }
+
+    /// \brief Merges the first \p size1 keys and values of the block with the next \p size2
+    /// ones by the keys.
+    ///
+    /// \tparam BinaryFunction - type of binary function used for comparison. Default type
+    /// is rocprim::less<Key>.
+    ///
+    /// \param [in, out] thread_keys - reference to an array of keys provided by a thread.
+    /// \param [in, out] thread_values - reference to an array of values provided by a thread.
+    /// \param [in] size1 - number of items of the first sequence.
+    /// \param [in] size2 - number of items of the second sequence, the items past
+    /// <tt>size1 + size2</tt> are not compared and left unchanged.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] compare_function - comparison function object which returns true if the
+    /// first argument is ordered before the second.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class BinaryFunction = ::rocprim::less<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void merge(Key (&thread_keys)[ItemsPerThread],
+               Value (&thread_values)[ItemsPerThread],
+               const unsigned int size1,
+               const unsigned int size2,
+               storage_type&      storage,
+               BinaryFunction     compare_function = BinaryFunction())
+    {
+        merge_impl(thread_keys, thread_values, size1, size2, storage.get(), compare_function);
+    }
+
+private:
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static void store_values(const Value (&values)[ItemsPerThread],
+                             const unsigned int thread_offset,
+                             storage_type_&     storage,
+                             std::true_type)
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            storage.values[thread_offset + i] = values[i];
+        }
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static void store_values(const empty_type (&)[ItemsPerThread],
+                             const unsigned int,
+                             storage_type_&,
+                             std::false_type)
+    {}
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static void load_values(Value (&values)[ItemsPerThread],
+                            const unsigned int (&indices)[ItemsPerThread],
+                            const unsigned int thread_valid,
+                            storage_type_&     storage,
+                            std::true_type)
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            if(i < thread_valid)
+            {
+                values[i] = storage.values[indices[i]];
+            }
+        }
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static void load_values(empty_type (&)[ItemsPerThread],
+                            const unsigned int (&)[ItemsPerThread],
+                            const unsigned int,
+                            storage_type_&,
+                            std::false_type)
+    {}
+
+    template<class V, class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void merge_impl(Key (&keys)[ItemsPerThread],
+                    V (&values)[ItemsPerThread],
+                    unsigned int   size1,
+                    unsigned int   size2,
+                    storage_type_& storage,
+                    BinaryFunction compare_function)
+    {
+        using with_values_type = std::integral_constant<bool, !std::is_same<V, empty_type>::value>;
+
+        size1 = ::rocprim::min(size1, items_per_block);
+        size2 = ::rocprim::min(size2, items_per_block - size1);
+        const unsigned int size = size1 + size2;
+
+        const unsigned int flat_tid
+            = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        const unsigned int thread_offset = flat_tid * ItemsPerThread;
+        const unsigned int thread_begin  = ::rocprim::min(size, thread_offset);
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            storage.keys[thread_offset + i] = keys[i];
+        }
+        store_values(values, thread_offset, storage, with_values_type());
+        ::rocprim::syncthreads();
+
+        const unsigned int split = detail::merge_path(storage.keys,
+                                                      storage.keys + size1,
+                                                      size1,
+                                                      size2,
+                                                      thread_begin,
+                                                      compare_function);
+        const detail::range_t range{split, size1, size1 + thread_begin - split, size};
+
+        unsigned int indices[ItemsPerThread];
+        detail::serial_merge_stable(storage.keys, range, keys, indices, compare_function);
+        load_values(values,
+                    indices,
+                    ::rocprim::min(size - thread_begin, ItemsPerThread),
+                    storage,
+                    with_values_type());
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group blockmodule
+
+#endif // ROCPRIM_BLOCK_BLOCK_MERGE_HPP_
@@ -0,0 +1,377 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_BLOCK_BLOCK_RADIX_RANK_HPP_
+#define ROCPRIM_BLOCK_BLOCK_RADIX_RANK_HPP_
+
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/various.hpp"
+#include "../detail/radix_sort.hpp"
+
+#include "../intrinsics.hpp"
+#include "../functional.hpp"
+#include "../types.hpp"
+
+#include "block_scan.hpp"
+
+/// \addtogroup blockmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief The block_radix_rank class is a block level parallel primitive which provides
+/// methods for ranking items partitioned across threads in a block by their radix digits.
+///
+/// The rank of an item is its position in the block after a stable sort of the items by
+/// their digits, so the items can be scattered (for example, using
+/// <tt>block_exchange::scatter_to_blocked()</tt>) to sort them by their digits or to bucket them.
+///
+/// \tparam BlockSizeX - the number of threads in a block's x dimension.
+/// \tparam RadixBits - the maximum number of bits of a digit, from 1 to 8.
+/// \tparam BlockSizeY - the number of threads in a block's y dimension, defaults to 1.
+/// \tparam BlockSizeZ - the number of threads in a block's z dimension, defaults to 1.
+///
+/// \par Overview
+/// * Items must be in a warp-striped arrangement, for example loaded with
+/// \p block_load_direct_warp_striped or \p block_load_warp_transpose.
+/// * Items of a warp are ranked without block-wide synchronization: the lanes having the same
+/// digit are matched with ballots and only the first of them updates the counter of the digit in
+/// the warp. An exclusive scan of the counters of all warps gives the ranks.
+/// * The digits can be extracted from the keys by a radix key codec (with \p begin_bit and
+/// \p pass_bits), or by a custom function object.
+/// * The exclusive prefix of the numbers of items with smaller digits (the start of every digit)
+/// and the number of items of every digit in the block can be returned as well. Every thread gets
+/// \p digits_per_thread consecutive digits: the thread \p t gets the digits
+/// <tt>t * digits_per_thread</tt> to <tt>(t + 1) * digits_per_thread - 1</tt>, the values of
+/// non-existent digits are zero.
+///
+/// \par Examples
+/// \parblock
+/// In the example 8 items per thread are bucketed by the cell index in their lowest 6 bits,
+/// in a block of 256 threads.
+///
+/// \code{.cpp}
+/// __global__ void example_kernel(const unsigned int* input, unsigned int* output)
+/// {
+///     using block_rank   = rocprim::block_radix_rank<256, 6>;
+///     using block_scatter = rocprim::block_exchange<unsigned int, 256, 8>;
+///     __shared__ union
+///     {
+///         block_rank::storage_type    rank;
+///         block_scatter::storage_type scatter;
+///     } storage;
+///
+///     unsigned int items[8];
+///     rocprim::block_load_direct_warp_striped(threadIdx.x, input, items);
+///
+///     unsigned int ranks[8];
+///     block_rank().rank_keys(items, ranks, storage.rank, 0, 6);
+///     rocprim::syncthreads();
+///     block_scatter().scatter_to_blocked(items, items, ranks, storage.scatter);
+///     rocprim::block_store_direct_blocked(threadIdx.x, output, items);
+/// }
+/// \endcode
+/// \endparblock
+template<
+    unsigned int BlockSizeX,
+    unsigned int RadixBits,
+    unsigned int BlockSizeY = 1,
+    unsigned int BlockSizeZ = 1
+>
+class block_radix_rank
+{
+    static_assert(RadixBits >= 1 && RadixBits <= 8, "RadixBits must be in range [1; 8]");
+
+    static constexpr unsigned int BlockSize = BlockSizeX * BlockSizeY * BlockSizeZ;
+    // Select warp size
+    static constexpr unsigned int warp_size =
+        detail::get_min_warp_size(BlockSize, ::rocprim::device_warp_size());
+    // Number of warps in block
+    static constexpr unsigned int warps_no = (BlockSize + warp_size - 1) / warp_size;
+    static constexpr unsigned int radix_size = 1u << RadixBits;
+    static constexpr unsigned int counters_no = radix_size * warps_no;
+    static constexpr unsigned int counters_per_thread = detail::ceiling_div(counters_no, BlockSize);
+
+    using block_scan_type = ::rocprim::block_scan<
+        unsigned int, BlockSizeX,
+        ::rocprim::block_scan_algorithm::using_warp_scan,
+        BlockSizeY, BlockSizeZ>;
+
+    // Struct used for creating a raw_storage object for this primitive's temporary storage.
+    struct storage_type_
+    {
+        // The counter of the digit d in the warp w is digit_counters[d * warps_no + w]
+        unsigned int digit_counters[counters_no];
+        typename block_scan_type::storage_type scan;
+    };
+
+public:
+
+    /// \brief The number of digits whose prefix and count are returned to every thread.
+    static constexpr unsigned int digits_per_thread = detail::ceiling_div(radix_size, BlockSize);
+
+    /// \brief Struct used to allocate a temporary memory that is required for thread
+    /// communication during operations provided by related parallel primitive.
+    ///
+    /// Depending on the implemention the operations exposed by parallel primitive may
+    /// require a temporary storage for thread communication. The storage should be allocated
+    /// using keywords <tt>__shared__</tt>. It can be aliased to
+    /// an externally allocated memory, or be a part of a union type with other storage types
+    /// to increase shared memory reusability.
+    #ifndef DOXYGEN_SHOULD_SKIP_THIS // hides storage_type implementation for Doxygen
+    using storage_type = detail::raw_storage<storage_type_>;
+    #else
+    using storage_type = storage_type_; // only for Doxygen
+    #endif
+
+    /// \brief Ranks keys in a warp-striped arrangement by their digits in ascending order.
+    ///
+    /// \tparam Key - [inferred] the key type, an arithmetic type.
+    /// \tparam ItemsPerThread - [inferred] the number of items contributed by each thread.
+    ///
+    /// \param [in] keys - reference to an array of keys provided by a thread.
+    /// \param [out] ranks - reference to an array of the ranks of the keys.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] begin_bit - index of the first (least significant) bit of the digit.
+    /// \param [in] pass_bits - [optional] the number of bits of the digit, at most \p RadixBits.
+    /// Default value: \p RadixBits.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class Key, unsigned int ItemsPerThread>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void rank_keys(const Key (&keys)[ItemsPerThread],
+                   unsigned int (&ranks)[ItemsPerThread],
+                   storage_type& storage,
+                   unsigned int begin_bit,
+                   unsigned int pass_bits = RadixBits)
+    {
+        rank_keys(keys, ranks, storage, codec_digit_extractor<Key, false>{begin_bit, pass_bits});
+    }
+
+    /// \brief Ranks keys in a warp-striped arrangement by their digits in descending order.
+    ///
+    /// \tparam Key - [inferred] the key type, an arithmetic type.
+    /// \tparam ItemsPerThread - [inferred] the number of items contributed by each thread.
+    ///
+    /// \param [in] keys - reference to an array of keys provided by a thread.
+    /// \param [out] ranks - reference to an array of the ranks of the keys.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] begin_bit - index of the first (least significant) bit of the digit.
+    /// \param [in] pass_bits - [optional] the number of bits of the digit, at most \p RadixBits.
+    /// Default value: \p RadixBits.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class Key, unsigned int ItemsPerThread>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void rank_keys_desc(const Key (&keys)[ItemsPerThread],
+                        unsigned int (&ranks)[ItemsPerThread],
+                        storage_type& storage,
+                        unsigned int begin_bit,
+                        unsigned int pass_bits = RadixBits)
+    {
+        rank_keys(keys, ranks, storage, codec_digit_extractor<Key, true>{begin_bit, pass_bits});
+    }
+
+    /// \brief Ranks keys in a warp-striped arrangement by the digits returned by
+    /// \p digit_extractor.
+    ///
+    /// \tparam Key - [inferred] the key type.
+    /// \tparam ItemsPerThread - [inferred] the number of items contributed by each thread.
+    /// \tparam DigitExtractor - [inferred] type of the function object returning the digit of a key.
+    ///
+    /// \param [in] keys - reference to an array of keys provided by a thread.
+    /// \param [out] ranks - reference to an array of the ranks of the keys.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] digit_extractor - function object returning the digit of a key, the
+    /// signature should be equivalent to <tt>unsigned int f(const Key& key);</tt>.
+    /// The returned digit must be less than <tt>2^RadixBits</tt>.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class Key, unsigned int ItemsPerThread, class DigitExtractor>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void rank_keys(const Key (&keys)[ItemsPerThread],
+                   unsigned int (&ranks)[ItemsPerThread],
+                   storage_type& storage,
+                   DigitExtractor digit_extractor)
+    {
+        unsigned int digits[ItemsPerThread];
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            digits[i] = digit_extractor(keys[i]);
+        }
+        rank_digits(digits, ranks, storage);
+    }
+
+    /// \brief Ranks keys in a warp-striped arrangement by the digits returned by
+    /// \p digit_extractor, and returns the starts and the counts of the digits in the block.
+    ///
+    /// \tparam Key - [inferred] the key type.
+    /// \tparam ItemsPerThread - [inferred] the number of items contributed by each thread.
+    /// \tparam DigitExtractor - [inferred] type of the function object returning the digit of a key.
+    ///
+    /// \param [in] keys - reference to an array of keys provided by a thread.
+    /// \param [out] ranks - reference to an array of the ranks of the keys.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] digit_extractor - function object returning the digit of a key, the
+    /// signature should be equivalent to <tt>unsigned int f(const Key& key);</tt>.
+    /// The returned digit must be less than <tt>2^RadixBits</tt>.
+    /// \param [out] digit_prefix - the exclusive prefix of the numbers of the items with
+    /// the digits of the thread, that is the rank of the first item with each digit.
+    /// \param [out] digit_counts - the numbers of the items with the digits of the thread.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class Key, unsigned int ItemsPerThread, class DigitExtractor>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void rank_keys(const Key (&keys)[ItemsPerThread],
+                   unsigned int (&ranks)[ItemsPerThread],
+                   storage_type& storage,
+                   DigitExtractor digit_extractor,
+                   unsigned int (&digit_prefix)[digits_per_thread],
+                   unsigned int (&digit_counts)[digits_per_thread])
+    {
+        rank_keys(keys, ranks, storage, digit_extractor);
+
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        storage_type_& storage_ = storage.get();
+        // The counter of the first warp holds the number of items with smaller digits
+        for(unsigned int i = 0; i < digits_per_thread; i++)
+        {
+            const unsigned int digit = flat_id * digits_per_thread + i;
+            digit_prefix[i] = 0;
+            digit_counts[i] = 0;
+            if(digit < radix_size)
+            {
+                const unsigned int next = digit + 1 < radix_size
+                    ? storage_.digit_counters[(digit + 1) * warps_no]
+                    : BlockSize * ItemsPerThread;
+                digit_prefix[i] = storage_.digit_counters[digit * warps_no];
+                digit_counts[i] = next - digit_prefix[i];
+            }
+        }
+    }
+
+private:
+
+    template<class Key, bool Descending>
+    struct codec_digit_extractor
+    {
+        using key_codec = ::rocprim::detail::radix_key_codec<Key, Descending>;
+
+        unsigned int begin_bit;
+        unsigned int pass_bits;
+
+        ROCPRIM_DEVICE ROCPRIM_INLINE
+        unsigned int operator()(const Key& key) const
+        {
+            return key_codec::extract_digit(key_codec::encode(key), begin_bit, pass_bits);
+        }
+    };
+
+    template<unsigned int ItemsPerThread>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void rank_digits(const unsigned int (&digits)[ItemsPerThread],
+                     unsigned int (&ranks)[ItemsPerThread],
+                     storage_type& storage)
+    {
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        const unsigned int warp_id = ::rocprim::warp_id(flat_id);
+        storage_type_& storage_ = storage.get();
+
+        for(unsigned int i = 0; i < counters_per_thread; i++)
+        {
+            const unsigned int counter = flat_id * counters_per_thread + i;
+            if(counter < counters_no)
+            {
+                storage_.digit_counters[counter] = 0;
+            }
+        }
+        ::rocprim::syncthreads();
+
+        // The items of a warp are ranked in their order: item by item, lane by lane
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            const unsigned int digit = digits[i];
+            lane_mask_type peers = ::rocprim::ballot(1);
+            for(unsigned int b = 0; b < RadixBits; b++)
+            {
+                const bool bit_set = (digit & (1u << b)) != 0;
+                const lane_mask_type bit_set_mask = ::rocprim::ballot(bit_set);
+                peers &= bit_set ? bit_set_mask : ~bit_set_mask;
+            }
+            const unsigned int peers_before = ::rocprim::masked_bit_count(peers);
+
+            unsigned int& counter = storage_.digit_counters[digit * warps_no + warp_id];
+            const unsigned int warp_count = counter;
+            // All peers read the counter before the first of them updates it
+            ::rocprim::wave_barrier();
+            if(peers_before == 0)
+            {
+                counter = warp_count + ::rocprim::bit_count(peers);
+            }
+            ::rocprim::wave_barrier();
+            ranks[i] = warp_count + peers_before;
+        }
+        ::rocprim::syncthreads();
+
+        // Exclusive scan of the counters gives the first rank of every digit in every warp
+        unsigned int thread_counters[counters_per_thread];
+        unsigned int thread_count = 0;
+        for(unsigned int i = 0; i < counters_per_thread; i++)
+        {
+            const unsigned int counter = flat_id * counters_per_thread + i;
+            thread_counters[i] = counter < counters_no ? storage_.digit_counters[counter] : 0;
+            thread_count += thread_counters[i];
+        }
+        unsigned int thread_prefix;
+        block_scan_type().exclusive_scan(thread_count, thread_prefix, 0u, storage_.scan);
+        for(unsigned int i = 0; i < counters_per_thread; i++)
+        {
+            const unsigned int counter = flat_id * counters_per_thread + i;
+            if(counter < counters_no)
+            {
+                storage_.digit_counters[counter] = thread_prefix;
+            }
+            thread_prefix += thread_counters[i];
+        }
+        ::rocprim::syncthreads();
+
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            ranks[i] += storage_.digit_counters[digits[i] * warps_no + warp_id];
+        }
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group blockmodule
+
+#endif // ROCPRIM_BLOCK_BLOCK_RADIX_RANK_HPP_
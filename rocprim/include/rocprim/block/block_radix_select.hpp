@@ -0,0 +1,475 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef ROCPRIM_BLOCK_BLOCK_RADIX_SELECT_HPP_
+#define ROCPRIM_BLOCK_BLOCK_RADIX_SELECT_HPP_
+
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/radix_sort.hpp"
+#include "../detail/various.hpp"
+
+#include "../intrinsics.hpp"
+#include "../functional.hpp"
+#include "../types.hpp"
+
+#include "block_exchange.hpp"
+#include "block_scan.hpp"
+
+/// \addtogroup blockmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief The block_radix_select class is a block level parallel primitive which moves the
+/// \p k smallest (or largest) items of a block to the front of the block, without sorting
+/// the whole block.
+///
+/// \tparam Key - the key type.
+/// \tparam BlockSizeX - the number of threads in a block's x dimension.
+/// \tparam ItemsPerThread - the number of items held by each thread.
+/// \tparam Value - [optional] the value type. By default, it's empty_type (keys only).
+/// \tparam BlockSizeY - the number of threads in a block's y dimension, defaults to 1.
+/// \tparam BlockSizeZ - the number of threads in a block's z dimension, defaults to 1.
+///
+/// \par Overview
+/// * \p Key type must be an arithmetic type (that is, an integral type or a floating-point
+///   type). Keys are ordered as by \p block_radix_sort.
+/// * The k-th key is found digit by digit starting from the most significant one: every pass
+///   builds a block histogram of the next 8-bit digit of the keys that match the digits found
+///   so far, and a block scan of the histogram finds the digit of the k-th key. The passes stop
+///   as soon as all keys matching the found digits are selected.
+/// * Then the keys before the k-th key and the first ties of it are compacted to the front of
+///   the block with a block scan of the flags, and the other items after them, both in their
+///   blocked order. The first \p k items are not sorted.
+/// * The selection can be limited to the first \p valid items of the block (in the blocked
+///   arrangement), the items at and past \p valid are not compared and keep their positions.
+/// * The number of items of a block must be less than 65536.
+///
+/// \par Examples
+/// \parblock
+/// In the examples the 16 smallest keys of 128 threads with 4 keys each are selected.
+///
+/// \code{.cpp}
+/// __global__ void example_kernel(...)
+/// {
+///     using block_select_t = rocprim::block_radix_select<float, 128, 4>;
+///     __shared__ block_select_t::storage_type storage;
+///
+///     float keys[4];
+///     ...
+///     block_select_t().select(keys, 16, storage);
+///     // the first 16 keys of the block (threads 0..3) are the 16 smallest ones
+///     ...
+/// }
+/// \endcode
+/// \endparblock
+template<class Key,
+         unsigned int BlockSizeX,
+         unsigned int ItemsPerThread,
+         class Value             = empty_type,
+         unsigned int BlockSizeY = 1,
+         unsigned int BlockSizeZ = 1>
+class block_radix_select
+{
+    static constexpr unsigned int BlockSize       = BlockSizeX * BlockSizeY * BlockSizeZ;
+    static constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    static constexpr unsigned int radix_size      = detail::radix_select_size;
+    // Every thread scans this number of consecutive bins of the histogram
+    static constexpr unsigned int bins_per_thread = detail::ceiling_div(radix_size, BlockSize);
+    // The selected and the tied items are counted in the two halves of a word
+    static constexpr unsigned int tie_shift = 16;
+
+    static_assert(items_per_block < (1u << tie_shift),
+                  "The items of a block must be countable in 16 bits");
+
+    using bit_key_type = typename detail::radix_key_codec<Key>::bit_key_type;
+    using scan_type    = ::rocprim::block_scan<unsigned int,
+                                            BlockSizeX,
+                                            block_scan_algorithm::using_warp_scan,
+                                            BlockSizeY,
+                                            BlockSizeZ>;
+    using keys_exchange_type
+        = ::rocprim::block_exchange<Key, BlockSizeX, ItemsPerThread, BlockSizeY, BlockSizeZ>;
+    using values_exchange_type
+        = ::rocprim::block_exchange<Value, BlockSizeX, ItemsPerThread, BlockSizeY, BlockSizeZ>;
+
+    // Struct used for creating a raw_storage object for this primitive's temporary storage.
+    struct storage_type_
+    {
+        union
+        {
+            typename keys_exchange_type::storage_type   keys_exchange;
+            typename values_exchange_type::storage_type values_exchange;
+            struct
+            {
+                unsigned int                     histogram[radix_size];
+                typename scan_type::storage_type scan;
+            } select;
+        };
+        // The digit of the k-th key found by the last pass and the matching keys before it
+        unsigned int digit;
+        unsigned int before;
+    };
+
+public:
+    /// \brief Struct used to allocate a temporary memory that is required for thread
+    /// communication during operations provided by related parallel primitive.
+    ///
+    /// Depending on the implemention the operations exposed by parallel primitive may
+    /// require a temporary storage for thread communication. The storage should be allocated
+    /// using keywords <tt>__shared__</tt>. It can be aliased to
+    /// an externally allocated memory, or be a part of a union type with other storage types
+    /// to increase shared memory reusability.
+    #ifndef DOXYGEN_SHOULD_SKIP_THIS // hides storage_type implementation for Doxygen
+    using storage_type = detail::raw_storage<storage_type_>;
+    #else
+    using storage_type = storage_type_; // only for Doxygen
+    #endif
+
+    /// \brief Moves the \p k smallest keys of the block to the first \p k positions.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in] k - number of selected keys.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void select(Key (&keys)[ItemsPerThread], const unsigned int k, storage_type& storage)
+    {
+        empty_type values[ItemsPerThread];
+        select_impl<false>(keys, values, k, items_per_block, storage.get());
+    }
+
+    /// \brief Moves the \p k smallest of the first \p valid keys of the block to the first
+    /// \p k positions.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in] k - number of selected keys.
+    /// \param [in] valid - number of valid items in the block, the items in blocked positions
+    /// at and past it keep their positions.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void select(Key (&keys)[ItemsPerThread],
+                const unsigned int k,
+                const unsigned int valid,
+                storage_type&      storage)
+    {
+        empty_type values[ItemsPerThread];
+        select_impl<false>(keys, values, k, valid, storage.get());
+    }
+
+    /// \brief Moves the \p k items of the block with the smallest keys to the first \p k
+    /// positions.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in, out] values - reference to an array of values provided by a thread.
+    /// \param [in] k - number of selected items.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void select(Key (&keys)[ItemsPerThread],
+                Value (&values)[ItemsPerThread],
+                const unsigned int k,
+                storage_type&      storage)
+    {
+        select_impl<false>(keys, values, k, items_per_block, storage.get());
+    }
+
+    /// \brief Moves the \p k of the first \p valid items of the block with the smallest keys
+    /// to the first \p k positions.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in, out] values - reference to an array of values provided by a thread.
+    /// \param [in] k - number of selected items.
+    /// \param [in] valid - number of valid items in the block, the items in blocked positions
+    /// at and past it keep their positions.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void select(Key (&keys)[ItemsPerThread],
+                Value (&values)[ItemsPerThread],
+                const unsigned int k,
+                const unsigned int valid,
+                storage_type&      storage)
+    {
+        select_impl<false>(keys, values, k, valid, storage.get());
+    }
+
+    /// \brief Moves the \p k largest keys of the block to the first \p k positions.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in] k - number of selected keys.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void select_desc(Key (&keys)[ItemsPerThread], const unsigned int k, storage_type& storage)
+    {
+        empty_type values[ItemsPerThread];
+        select_impl<true>(keys, values, k, items_per_block, storage.get());
+    }
+
+    /// \brief Moves the \p k largest of the first \p valid keys of the block to the first
+    /// \p k positions.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in] k - number of selected keys.
+    /// \param [in] valid - number of valid items in the block, the items in blocked positions
+    /// at and past it keep their positions.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void select_desc(Key (&keys)[ItemsPerThread],
+                     const unsigned int k,
+                     const unsigned int valid,
+                     storage_type&      storage)
+    {
+        empty_type values[ItemsPerThread];
+        select_impl<true>(keys, values, k, valid, storage.get());
+    }
+
+    /// \brief Moves the \p k items of the block with the largest keys to the first \p k
+    /// positions.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in, out] values - reference to an array of values provided by a thread.
+    /// \param [in] k - number of selected items.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void select_desc(Key (&keys)[ItemsPerThread],
+                     Value (&values)[ItemsPerThread],
+                     const unsigned int k,
+                     storage_type&      storage)
+    {
+        select_impl<true>(keys, values, k, items_per_block, storage.get());
+    }
+
+    /// \brief Moves the \p k of the first \p valid items of the block with the largest keys
+    /// to the first \p k positions.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in, out] values - reference to an array of values provided by a thread.
+    /// \param [in] k - number of selected items.
+    /// \param [in] valid - number of valid items in the block, the items in blocked positions
+    /// at and past it keep their positions.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void select_desc(Key (&keys)[ItemsPerThread],
+                     Value (&values)[ItemsPerThread],
+                     const unsigned int k,
+                     const unsigned int valid,
+                     storage_type&      storage)
+    {
+        select_impl<true>(keys, values, k, valid, storage.get());
+    }
+
+private:
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static void exchange_values(Value (&values)[ItemsPerThread],
+                                const unsigned int (&ranks)[ItemsPerThread],
+                                storage_type_& storage,
+                                std::true_type)
+    {
+        ::rocprim::syncthreads();
+        values_exchange_type().scatter_to_blocked(values, values, ranks, storage.values_exchange);
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static void exchange_values(empty_type (&)[ItemsPerThread],
+                                const unsigned int (&)[ItemsPerThread],
+                                storage_type_&,
+                                std::false_type)
+    {}
+
+    template<bool Descending, class V>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void select_impl(Key (&keys)[ItemsPerThread],
+                     V (&values)[ItemsPerThread],
+                     unsigned int   k,
+                     unsigned int   valid,
+                     storage_type_& storage)
+    {
+        using codec            = detail::radix_key_codec<Key, Descending>;
+        using with_values_type = std::integral_constant<bool, !std::is_same<V, empty_type>::value>;
+
+        valid = ::rocprim::min(valid, items_per_block);
+        // No items or all of them are selected, they are already in place
+        if(k == 0 || k >= valid)
+        {
+            return;
+        }
+
+        const unsigned int flat_id
+            = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        const unsigned int thread_offset = flat_id * ItemsPerThread;
+
+        bit_key_type bit_keys[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            bit_keys[i] = detail::radix_select_encode<codec>(keys[i]);
+        }
+
+        // Digits of the k-th key found so far, and the number of keys equal to it which are
+        // needed to reach k
+        bit_key_type prefix      = 0;
+        bit_key_type prefix_mask = 0;
+        unsigned int remaining   = k;
+        for(unsigned int end_bit = codec::key_bits; end_bit > 0;)
+        {
+            const unsigned int bit = end_bit > detail::radix_select_bits
+                                         ? end_bit - detail::radix_select_bits
+                                         : 0;
+            const unsigned int digit_mask = (1u << (end_bit - bit)) - 1;
+
+            for(unsigned int i = flat_id; i < radix_size; i += BlockSize)
+            {
+                storage.select.histogram[i] = 0;
+            }
+            ::rocprim::syncthreads();
+
+            ROCPRIM_UNROLL
+            for(unsigned int i = 0; i < ItemsPerThread; i++)
+            {
+                if(thread_offset + i < valid
+                   && static_cast<bit_key_type>(bit_keys[i] & prefix_mask) == prefix)
+                {
+                    const unsigned int digit
+                        = static_cast<unsigned int>(bit_keys[i] >> bit) & digit_mask;
+                    ::rocprim::detail::atomic_add(&storage.select.histogram[digit], 1u);
+                }
+            }
+            ::rocprim::syncthreads();
+
+            // Every thread scans its consecutive bins, the bin where the running count reaches
+            // the remaining keys is the digit of the k-th key
+            const unsigned int first_bin = flat_id * bins_per_thread;
+            unsigned int       counts[bins_per_thread];
+            unsigned int       thread_count = 0;
+            ROCPRIM_UNROLL
+            for(unsigned int i = 0; i < bins_per_thread; i++)
+            {
+                counts[i] = first_bin + i < radix_size ? storage.select.histogram[first_bin + i]
+                                                       : 0u;
+                thread_count += counts[i];
+            }
+            unsigned int before;
+            scan_type().exclusive_scan(thread_count, before, 0u, storage.select.scan);
+            ROCPRIM_UNROLL
+            for(unsigned int i = 0; i < bins_per_thread; i++)
+            {
+                if(before < remaining && before + counts[i] >= remaining)
+                {
+                    storage.digit  = first_bin + i;
+                    storage.before = before;
+                }
+                before += counts[i];
+            }
+            ::rocprim::syncthreads();
+
+            const unsigned int digit = storage.digit;
+            const unsigned int count = storage.select.histogram[digit];
+            prefix |= static_cast<bit_key_type>(static_cast<bit_key_type>(digit) << bit);
+            prefix_mask |= static_cast<bit_key_type>(static_cast<bit_key_type>(digit_mask) << bit);
+            remaining -= storage.before;
+            end_bit = bit;
+            // Every key with the digits found so far is selected, the lower digits do not matter
+            if(count == remaining)
+            {
+                break;
+            }
+            // The histogram is read before it is cleared by the next pass
+            ::rocprim::syncthreads();
+        }
+
+        // The keys before the k-th key and the first ties go to the front in their blocked
+        // order, the other valid items after them
+        unsigned int flags[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            flags[i] = 0;
+            if(thread_offset + i < valid)
+            {
+                const bit_key_type masked_key
+                    = static_cast<bit_key_type>(bit_keys[i] & prefix_mask);
+                flags[i] = masked_key < prefix ? 1u : masked_key == prefix ? 1u << tie_shift : 0u;
+            }
+        }
+        ::rocprim::syncthreads();
+
+        unsigned int positions[ItemsPerThread];
+        scan_type().exclusive_scan(flags, positions, 0u, storage.select.scan);
+
+        unsigned int ranks[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            const unsigned int position = thread_offset + i;
+            const unsigned int selected_before
+                = (positions[i] & ((1u << tie_shift) - 1))
+                  + ::rocprim::min(positions[i] >> tie_shift, remaining);
+            const bool selected
+                = flags[i] == 1u || (flags[i] != 0u && (positions[i] >> tie_shift) < remaining);
+            ranks[i] = position >= valid ? position
+                       : selected        ? selected_before
+                                         : k + position - selected_before;
+        }
+        ::rocprim::syncthreads();
+
+        keys_exchange_type().scatter_to_blocked(keys, keys, ranks, storage.keys_exchange);
+        exchange_values(values, ranks, storage, with_values_type());
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group blockmodule
+
+#endif // ROCPRIM_BLOCK_BLOCK_RADIX_SELECT_HPP_
@@ -33,6 +33,7 @@
 #include "../types.hpp"
 
 #include "block_exchange.hpp"
+#include "block_radix_rank.hpp"
 
 /// \addtogroup blockmodule
 /// @{
@@ -151,10 +152,19 @@ public:
 /// \tparam ItemsPerThread - the number of items contributed by each thread.
 /// \tparam Value - the value type. Default type empty_type indicates
 /// a keys-only sort.
+/// \tparam BlockSizeY - the number of threads in a block's y dimension, defaults to 1.
+/// \tparam BlockSizeZ - the number of threads in a block's z dimension, defaults to 1.
+/// \tparam FloatOrder - the order of floating-point keys, see \p radix_float_order.
+/// \tparam Decomposer - decomposer of keys into their fields, see \p identity_decomposer.
+/// \tparam RadixBitsPerPass - the number of bits of the digits sorted by one pass, from 1 to 8,
+/// defaults to 1. Digits of a single bit are ranked with a block-wide scan of ballots. Larger
+/// digits are ranked by matching the lanes having the same digit in every warp and counting
+/// the digits of the warps in shared memory, which needs several times fewer block-wide
+/// synchronizations.
 ///
 /// \par Overview
 /// * \p Key type must be an arithmetic type (that is, an integral type or a floating-point
-/// type).
+/// type), or a type that is decomposed into such types by \p Decomposer.
 /// * Performance depends on \p BlockSize and \p ItemsPerThread.
 ///   * It is usually better of \p BlockSize is a multiple of the size of the hardware warp.
 ///   * It is usually increased when \p ItemsPerThread is greater than one. However, when there
@@ -194,15 +204,28 @@ template<
     unsigned int ItemsPerThread,
     class Value = empty_type,
     unsigned int BlockSizeY = 1,
-    unsigned int BlockSizeZ = 1
+    unsigned int BlockSizeZ = 1,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+    class Decomposer = identity_decomposer,
+    unsigned int RadixBitsPerPass = 1
 >
 class block_radix_sort
 {
+    static_assert(RadixBitsPerPass >= 1 && RadixBitsPerPass <= 8,
+                  "RadixBitsPerPass must be in range [1; 8]");
+
     static constexpr unsigned int BlockSize = BlockSizeX * BlockSizeY * BlockSizeZ;
     static constexpr bool with_values = !std::is_same<Value, empty_type>::value;
+    static constexpr bool use_match_rank = RadixBitsPerPass > 1;
 
-    using bit_key_type = typename ::rocprim::detail::radix_key_codec<Key>::bit_key_type;
+    using bit_key_type =
+        typename ::rocprim::detail::radix_key_codec<Key, false, FloatOrder, Decomposer>::bit_key_type;
     using bit_block_scan = detail::block_bit_plus_scan<BlockSizeX, BlockSizeY, BlockSizeZ>;
+    using radix_rank_type = typename std::conditional<
+        use_match_rank,
+        ::rocprim::block_radix_rank<BlockSizeX, RadixBitsPerPass, BlockSizeY, BlockSizeZ>,
+        bit_block_scan
+    >::type;
 
     using bit_keys_exchange_type = ::rocprim::block_exchange<bit_key_type, BlockSizeX, ItemsPerThread, BlockSizeY, BlockSizeZ>;
     using values_exchange_type = ::rocprim::block_exchange<Value, BlockSizeX, ItemsPerThread, BlockSizeY, BlockSizeZ>;
@@ -215,7 +238,11 @@ class block_radix_sort
             typename bit_keys_exchange_type::storage_type bit_keys_exchange;
             typename values_exchange_type::storage_type values_exchange;
         };
-        typename block_radix_sort<Key,BlockSizeX,ItemsPerThread,Value,BlockSizeY,BlockSizeZ>::bit_block_scan::storage_type bit_block_scan;
+        union
+        {
+            typename block_radix_sort::bit_block_scan::storage_type bit_block_scan;
+            typename block_radix_sort::radix_rank_type::storage_type radix_rank;
+        };
     };
 
 public:
@@ -895,10 +922,11 @@ private:
                    unsigned int begin_bit,
                    unsigned int end_bit)
     {
-        using key_codec = ::rocprim::detail::radix_key_codec<Key, Descending>;
-        storage_type_& storage_ = storage.get();
+        using key_codec = ::rocprim::detail::radix_key_codec<Key, Descending, FloatOrder, Decomposer>;
 
-        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        // Padding of decomposed keys is not sorted
+        constexpr unsigned int key_bits = key_codec::key_bits;
+        end_bit = ::rocprim::min(end_bit, key_bits);
 
         bit_key_type bit_keys[ItemsPerThread];
         for(unsigned int i = 0; i < ItemsPerThread; i++)
@@ -906,6 +934,35 @@ private:
             bit_keys[i] = key_codec::encode(keys[i]);
         }
 
+        sort_passes<key_codec>(bit_keys, values, storage, begin_bit, end_bit,
+                               std::integral_constant<bool, use_match_rank>());
+
+        if(ToStriped)
+        {
+            to_striped_keys(storage, bit_keys);
+            to_striped_values(storage, values);
+        }
+
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            keys[i] = key_codec::decode(bit_keys[i]);
+        }
+    }
+
+    template<class KeyCodec, class SortedValue>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort_passes(bit_key_type (&bit_keys)[ItemsPerThread],
+                     SortedValue (&values)[ItemsPerThread],
+                     storage_type& storage,
+                     unsigned int begin_bit,
+                     unsigned int end_bit,
+                     std::false_type /*use_match_rank*/)
+    {
+        using key_codec = KeyCodec;
+        storage_type_& storage_ = storage.get();
+
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+
         // Use binary digits (i.e. digits can be 0 or 1)
         for(unsigned int bit = begin_bit; bit < end_bit; bit++)
         {
@@ -936,16 +993,65 @@ private:
             exchange_keys(storage, bit_keys, ranks);
             exchange_values(storage, values, ranks);
         }
+    }
 
-        if(ToStriped)
+    template<class KeyCodec>
+    struct bit_key_digit_extractor
+    {
+        unsigned int bit;
+        unsigned int pass_bits;
+
+        ROCPRIM_DEVICE ROCPRIM_INLINE
+        unsigned int operator()(const bit_key_type& bit_key) const
         {
-            to_striped_keys(storage, bit_keys);
-            to_striped_values(storage, values);
+            return KeyCodec::extract_digit(bit_key, bit, pass_bits);
         }
+    };
 
-        for(unsigned int i = 0; i < ItemsPerThread; i++)
+    template<class KeyCodec, class SortedValue>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort_passes(bit_key_type (&bit_keys)[ItemsPerThread],
+                     SortedValue (&values)[ItemsPerThread],
+                     storage_type& storage,
+                     unsigned int begin_bit,
+                     unsigned int end_bit,
+                     std::true_type /*use_match_rank*/)
+    {
+        using key_codec = KeyCodec;
+        storage_type_& storage_ = storage.get();
+
+        if(begin_bit >= end_bit)
         {
-            keys[i] = key_codec::decode(bit_keys[i]);
+            return;
+        }
+
+        // Digits are ranked in the order of the items in a warp-striped arrangement,
+        // the items are kept in this arrangement until the last pass.
+        bit_keys_exchange_type().blocked_to_warp_striped(bit_keys, bit_keys, storage_.bit_keys_exchange);
+        to_warp_striped_values(storage, values);
+
+        for(unsigned int bit = begin_bit; bit < end_bit; bit += RadixBitsPerPass)
+        {
+            const unsigned int pass_bits = ::rocprim::min(RadixBitsPerPass, end_bit - bit);
+
+            // The storage of the ranks is not shared with the exchanges, and the previous pass
+            // finished reading it before the barrier of its exchange.
+            unsigned int ranks[ItemsPerThread];
+            radix_rank_type().rank_keys(bit_keys,
+                                        ranks,
+                                        storage_.radix_rank,
+                                        bit_key_digit_extractor<key_codec>{bit, pass_bits});
+
+            if(bit + pass_bits >= end_bit)
+            {
+                exchange_keys(storage, bit_keys, ranks);
+                exchange_values(storage, values, ranks);
+            }
+            else
+            {
+                bit_keys_exchange_type().scatter_to_warp_striped(bit_keys, bit_keys, ranks, storage_.bit_keys_exchange);
+                exchange_values_to_warp_striped(storage, values, ranks);
+            }
         }
     }
 
@@ -980,6 +1086,45 @@ private:
         (void) ranks;
     }
 
+    template<class SortedValue>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void exchange_values_to_warp_striped(storage_type& storage,
+                                         SortedValue (&values)[ItemsPerThread],
+                                         const unsigned int (&ranks)[ItemsPerThread])
+    {
+        storage_type_& storage_ = storage.get();
+        ::rocprim::syncthreads(); // Storage will be reused (union), synchronization is needed
+        values_exchange_type().scatter_to_warp_striped(values, values, ranks, storage_.values_exchange);
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void exchange_values_to_warp_striped(storage_type& storage,
+                                         empty_type (&values)[ItemsPerThread],
+                                         const unsigned int (&ranks)[ItemsPerThread])
+    {
+        (void) storage;
+        (void) values;
+        (void) ranks;
+    }
+
+    template<class SortedValue>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void to_warp_striped_values(storage_type& storage,
+                                SortedValue (&values)[ItemsPerThread])
+    {
+        storage_type_& storage_ = storage.get();
+        ::rocprim::syncthreads(); // Storage will be reused (union), synchronization is needed
+        values_exchange_type().blocked_to_warp_striped(values, values, storage_.values_exchange);
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void to_warp_striped_values(storage_type& storage,
+                                empty_type (&values)[ItemsPerThread])
+    {
+        (void) storage;
+        (void) values;
+    }
+
     ROCPRIM_DEVICE ROCPRIM_INLINE
     void to_striped_keys(storage_type& storage,
                          bit_key_type (&bit_keys)[ItemsPerThread])
@@ -104,6 +104,9 @@ struct select_block_reduce_impl<block_reduce_algorithm::raking_reduce_commutativ
 /// * If the block sizes less than 64 only one warp reduction is used. The block reduction algorithm
 ///   stores the result only in the first thread(lane_id = 0 warp_id = 0), when the block size is
 ///   larger then the warp size.
+/// * When each thread provides multiple items, sums of \p rocprim::half items add pairs of
+///   items with packed instructions and sums of \p rocprim::bfloat16 items are accumulated in
+///   fp32 within each thread. The items are then summed in a different order than one by one.
 ///
 /// \par Examples
 /// \parblock
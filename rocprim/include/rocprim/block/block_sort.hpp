@@ -42,7 +42,8 @@ enum class block_sort_algorithm
 {
     /// \brief A bitonic sort based algorithm.
     bitonic_sort,
-    /// \brief A merge sort based algorithm.
+    /// \brief A stable merge sort based algorithm. Any number of items per thread is supported,
+    /// but the block size must be a power of two.
     merge_sort,
     /// \brief Default block_sort algorithm.
     default_algorithm = bitonic_sort,
@@ -100,6 +101,10 @@ struct select_block_sort_impl<block_sort_algorithm::merge_sort>
 ///   * It is better if \p BlockSize is a power of two.
 ///   * If \p BlockSize is not a power of two, or when function with \p size overload is used
 ///     odd-even sort is used instead of bitonic sort, leading to decreased performance.
+/// * With \p block_sort_algorithm::merge_sort the sort is stable: equivalent keys keep the order
+///   of their blocked positions. Every thread sorts its items, then the sorted runs are merged
+///   with merge path partitioning, so large \p ItemsPerThread values (such as 16 or 32) and
+///   values that are not powers of two are supported efficiently.
 ///
 /// \par Examples
 /// \parblock
@@ -335,8 +340,6 @@ public:
     /// \tparam BinaryFunction - type of binary function used for sort. Default type
     /// is rocprim::less<T>.
     ///
-    /// \remark Not implemented for \p block_sort_algorithm::merge_sort
-    ///
     /// \param [in, out] thread_key - reference to a key provided by a thread.
     /// \param [in] storage - reference to a temporary storage object of type storage_type.
     /// \param [in] size - custom size of block to be sorted.
@@ -354,6 +357,64 @@ public:
     {
         base_type::sort(thread_key, storage, size, compare_function);
     }
+
+    /// \brief Block sort for any data type, only the first \p size items of the block (in the
+    /// blocked arrangement) are sorted. If \p size is greater than <tt>BlockSize * ItemsPerThread</tt>,
+    /// this function does nothing.
+    ///
+    /// \tparam BinaryFunction - type of binary function used for sort. Default type
+    /// is rocprim::less<T>.
+    ///
+    /// \remark Only implemented for \p block_sort_algorithm::merge_sort. The items at and past
+    /// \p size are not compared and left unchanged.
+    ///
+    /// \param [in, out] thread_keys - reference to an array of keys provided by a thread.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] size - custom size of block to be sorted.
+    /// \param [in] compare_function - comparison function object which returns true if the
+    /// first argument is is ordered before the second.
+    /// The signature of the function should be equivalent to the following:
+    /// <tt>bool f(const T &a, const T &b);</tt>. The signature does not need to have
+    /// <tt>const &</tt>, but function object must not modify the objects passed to it.
+    template<class BinaryFunction = ::rocprim::less<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort(Key (&thread_keys)[ItemsPerThread],
+              storage_type& storage,
+              const unsigned int size,
+              BinaryFunction compare_function = BinaryFunction())
+    {
+        base_type::sort(thread_keys, storage, size, compare_function);
+    }
+
+    /// \brief Block sort by key for any data type, only the first \p size items of the block
+    /// (in the blocked arrangement) are sorted. If \p size is greater than
+    /// <tt>BlockSize * ItemsPerThread</tt>, this function does nothing.
+    ///
+    /// \tparam BinaryFunction - type of binary function used for sort. Default type
+    /// is rocprim::less<T>.
+    ///
+    /// \remark Only implemented for \p block_sort_algorithm::merge_sort. The items at and past
+    /// \p size are not compared and left unchanged.
+    ///
+    /// \param [in, out] thread_keys - reference to an array of keys provided by a thread.
+    /// \param [in, out] thread_values - reference to an array of values provided by a thread.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] size - custom size of block to be sorted.
+    /// \param [in] compare_function - comparison function object which returns true if the
+    /// first argument is is ordered before the second.
+    /// The signature of the function should be equivalent to the following:
+    /// <tt>bool f(const T &a, const T &b);</tt>. The signature does not need to have
+    /// <tt>const &</tt>, but function object must not modify the objects passed to it.
+    template<class BinaryFunction = ::rocprim::less<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort(Key (&thread_keys)[ItemsPerThread],
+              Value (&thread_values)[ItemsPerThread],
+              storage_type& storage,
+              const unsigned int size,
+              BinaryFunction compare_function = BinaryFunction())
+    {
+        base_type::sort(thread_keys, thread_values, storage, size, compare_function);
+    }
 };
 
 END_ROCPRIM_NAMESPACE
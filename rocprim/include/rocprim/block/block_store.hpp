@@ -64,6 +64,11 @@ enum class block_store_method
     ///   * \p ItemsPerThread is odd.
     ///   * The datatype \p T is not a primitive or a HIP vector type (e.g. int2,
     /// int4, etc.
+    /// * For a \p scatter_iterator over a pointer to indices, the indices are loaded as
+    /// vectors with the same requirements and the items are scattered one by one.
+    /// * For a \p transform_output_iterator with a trivially copyable function, the function
+    /// is applied in registers and the results are stored as vectors to the underlying
+    /// pointer. A \p tee_output_iterator stores to each of its underlying pointers as vectors.
     block_store_vectorize,
 
     /// A blocked arrangement of items is locally transposed and stored as a striped
@@ -383,6 +388,35 @@ public:
         block_store_direct_blocked(flat_id, block_output, items);
     }
 
+    template<class OutputIterator, class Index, class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store(scatter_iterator<OutputIterator, Index*> block_output,
+               U (&items)[ItemsPerThread])
+    {
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        // The indices are loaded as vectors, the items are scattered
+        block_store_direct_blocked_vectorized(flat_id, block_output, items);
+    }
+
+    template<class OutputIterator, class UnaryFunction, class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store(transform_output_iterator<OutputIterator, UnaryFunction> block_output,
+               U (&items)[ItemsPerThread])
+    {
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        // The function is applied in registers, the results are stored as vectors
+        block_store_direct_blocked_vectorized(flat_id, block_output, items);
+    }
+
+    template<class OutputIterator1, class OutputIterator2, class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store(tee_output_iterator<OutputIterator1, OutputIterator2> block_output,
+               U (&items)[ItemsPerThread])
+    {
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        block_store_direct_blocked_vectorized(flat_id, block_output, items);
+    }
+
     template<class OutputIterator>
     ROCPRIM_DEVICE ROCPRIM_INLINE
     void store(OutputIterator block_output,
@@ -23,11 +23,17 @@
 
 #include "../config.hpp"
 #include "../detail/various.hpp"
+#include "../detail/match_result_type.hpp"
 
 #include "../intrinsics.hpp"
 #include "../functional.hpp"
+#include "../iterator/permutation_iterator.hpp"
+#include "../iterator/tee_output_iterator.hpp"
+#include "../iterator/transform_output_iterator.hpp"
 #include "../types.hpp"
 
+#include "block_load_func.hpp"
+
 BEGIN_ROCPRIM_NAMESPACE
 
 /// \addtogroup blockmodule
@@ -185,6 +191,213 @@ block_store_direct_blocked_vectorized(unsigned int flat_id,
     block_store_direct_blocked(flat_id, block_output, items);
 }
 
+/// \brief Scatters a blocked arrangement of items across the thread block through a
+/// \p scatter_iterator, the indices are loaded as vectors.
+///
+/// The indices are loaded by \p block_load_direct_blocked_vectorized, so its alignment
+/// requirements apply to the offset of the indices (\p block_output.indices()). Each item is then
+/// stored separately.
+///
+/// \tparam OutputIterator - [inferred] the iterator type of the output
+/// \tparam Index - [inferred] the type of the indices
+/// \tparam U - [inferred] the input data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_output - the scatter iterator from the thread block to store to
+/// \param items - array that data is stored to thread block
+template<
+    class OutputIterator,
+    class Index,
+    class U,
+    unsigned int ItemsPerThread
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_store_direct_blocked_vectorized(unsigned int flat_id,
+                                           scatter_iterator<OutputIterator, Index*> block_output,
+                                           U (&items)[ItemsPerThread])
+{
+    typename std::remove_cv<Index>::type indices[ItemsPerThread];
+    block_load_direct_blocked_vectorized(flat_id, block_output.indices(), indices);
+
+    const OutputIterator output = block_output.values();
+    ROCPRIM_UNROLL
+    for (unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        output[indices[item]] = items[item];
+    }
+}
+
+namespace detail
+{
+
+// Stores the items of a thread with vector stores to pointers, also through the output
+// iterators which wrap pointers, other iterators are stored item by item
+template<class OutputIterator>
+struct block_store_blocked_vectorized_impl
+{
+    template<class U, unsigned int ItemsPerThread>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    void store(unsigned int flat_id, OutputIterator block_output, U (&items)[ItemsPerThread])
+    {
+        block_store_direct_blocked(flat_id, block_output, items);
+    }
+};
+
+template<class T>
+struct block_store_blocked_vectorized_impl<T*>
+{
+    template<class U, unsigned int ItemsPerThread>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    void store(unsigned int flat_id, T* block_output, U (&items)[ItemsPerThread])
+    {
+        block_store_direct_blocked_vectorized(flat_id, block_output, items);
+    }
+};
+
+template<class OutputIterator, class UnaryFunction>
+struct block_store_blocked_vectorized_impl<transform_output_iterator<OutputIterator, UnaryFunction>>
+{
+    using iterator_type = transform_output_iterator<OutputIterator, UnaryFunction>;
+
+    template<class U, unsigned int ItemsPerThread>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    void store(unsigned int flat_id, iterator_type block_output, U (&items)[ItemsPerThread])
+    {
+        store(flat_id,
+              block_output,
+              items,
+              std::integral_constant<bool,
+                                     std::is_trivially_copyable<UnaryFunction>::value>{});
+    }
+
+private:
+    // The function is applied in registers and the results are stored to the underlying iterator
+    template<class U, unsigned int ItemsPerThread>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    void store(unsigned int flat_id,
+               iterator_type block_output,
+               U (&items)[ItemsPerThread],
+               std::true_type)
+    {
+        using result_type = typename std::remove_cv<typename std::remove_reference<
+            typename invoke_result<UnaryFunction, U>::type>::type>::type;
+
+        UnaryFunction transform_op = block_output.transform_op();
+        result_type   results[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int item = 0; item < ItemsPerThread; item++)
+        {
+            results[item] = transform_op(items[item]);
+        }
+        block_store_blocked_vectorized_impl<OutputIterator>::store(flat_id,
+                                                                   block_output.base(),
+                                                                   results);
+    }
+
+    template<class U, unsigned int ItemsPerThread>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    void store(unsigned int flat_id,
+               iterator_type block_output,
+               U (&items)[ItemsPerThread],
+               std::false_type)
+    {
+        block_store_direct_blocked(flat_id, block_output, items);
+    }
+};
+
+template<class OutputIterator1, class OutputIterator2>
+struct block_store_blocked_vectorized_impl<tee_output_iterator<OutputIterator1, OutputIterator2>>
+{
+    template<class U, unsigned int ItemsPerThread>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    void store(unsigned int                                          flat_id,
+               tee_output_iterator<OutputIterator1, OutputIterator2> block_output,
+               U (&items)[ItemsPerThread])
+    {
+        block_store_blocked_vectorized_impl<OutputIterator1>::store(flat_id,
+                                                                    block_output.first(),
+                                                                    items);
+        block_store_blocked_vectorized_impl<OutputIterator2>::store(flat_id,
+                                                                    block_output.second(),
+                                                                    items);
+    }
+};
+
+} // end namespace detail
+
+/// \brief Stores a blocked arrangement of items from across the thread block through a
+/// \p transform_output_iterator, the results are stored as vectors.
+///
+/// If \p UnaryFunction is trivially copyable, the function is applied in registers and the
+/// results are stored to the underlying iterator, with
+/// \p block_store_direct_blocked_vectorized of the results when it is a pointer, or another
+/// \p transform_output_iterator or \p tee_output_iterator over pointers. Otherwise each item is
+/// stored separately.
+///
+/// \tparam OutputIterator - [inferred] the type of the underlying output iterator
+/// \tparam UnaryFunction - [inferred] the type of the function applied to the items
+/// \tparam U - [inferred] the input data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_output - the transform output iterator from the thread block to store to
+/// \param items - array that data is stored to thread block
+template<
+    class OutputIterator,
+    class UnaryFunction,
+    class U,
+    unsigned int ItemsPerThread
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_store_direct_blocked_vectorized(
+    unsigned int                                             flat_id,
+    transform_output_iterator<OutputIterator, UnaryFunction> block_output,
+    U (&items)[ItemsPerThread])
+{
+    detail::block_store_blocked_vectorized_impl<
+        transform_output_iterator<OutputIterator, UnaryFunction>>::store(flat_id,
+                                                                         block_output,
+                                                                         items);
+}
+
+/// \brief Stores a blocked arrangement of items from across the thread block through a
+/// \p tee_output_iterator, the items are stored as vectors.
+///
+/// The items are stored to each of the underlying iterators, with
+/// \p block_store_direct_blocked_vectorized when it is a pointer, or a
+/// \p transform_output_iterator or another \p tee_output_iterator over pointers. Other
+/// underlying iterators are stored item by item.
+///
+/// \tparam OutputIterator1 - [inferred] the type of the first underlying output iterator
+/// \tparam OutputIterator2 - [inferred] the type of the second underlying output iterator
+/// \tparam U - [inferred] the input data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_output - the tee output iterator from the thread block to store to
+/// \param items - array that data is stored to thread block
+template<
+    class OutputIterator1,
+    class OutputIterator2,
+    class U,
+    unsigned int ItemsPerThread
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_store_direct_blocked_vectorized(
+    unsigned int                                          flat_id,
+    tee_output_iterator<OutputIterator1, OutputIterator2> block_output,
+    U (&items)[ItemsPerThread])
+{
+    detail::block_store_blocked_vectorized_impl<
+        tee_output_iterator<OutputIterator1, OutputIterator2>>::store(flat_id,
+                                                                      block_output,
+                                                                      items);
+}
+
 /// \brief Stores a striped arrangement of items from across the thread block
 /// into a blocked arrangement on continuous memory.
 ///
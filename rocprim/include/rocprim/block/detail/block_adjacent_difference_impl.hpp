@@ -85,6 +85,24 @@ ROCPRIM_DEVICE ROCPRIM_INLINE auto apply(BinaryFunction op,
     return op(b, a);
 }
 
+// Copies the input items where the flags are set to the output. These are the first (left) or
+// the last (right) items of their segments, which are not combined with an item of the
+// neighbouring segment.
+template <typename T, typename Output, typename Flag, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE void copy_flagged_items(const T (&input)[ItemsPerThread],
+                                                      Output (&output)[ItemsPerThread],
+                                                      const Flag (&flags)[ItemsPerThread])
+{
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; ++i)
+    {
+        if(flags[i])
+        {
+            output[i] = input[i];
+        }
+    }
+}
+
 template <typename T,
           unsigned int BlockSizeX,
           unsigned int BlockSizeY = 1,
@@ -0,0 +1,118 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_BLOCK_DETAIL_BLOCK_AXIS_TRANSPOSE_HPP_
+#define ROCPRIM_BLOCK_DETAIL_BLOCK_AXIS_TRANSPOSE_HPP_
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+
+#include "../../intrinsics.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Thread (x, y, z) of the block, the coordinates of the size 1 dimensions are not read
+template<unsigned int BlockSizeX, unsigned int BlockSizeY, unsigned int BlockSizeZ>
+struct block_axis_thread
+{
+    unsigned int x;
+    unsigned int y;
+    unsigned int z;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    block_axis_thread()
+        : x(::rocprim::detail::block_thread_id<0>())
+        , y(BlockSizeY > 1 ? ::rocprim::detail::block_thread_id<1>() : 0)
+        , z(BlockSizeZ > 1 ? ::rocprim::detail::block_thread_id<2>() : 0)
+    {}
+
+    // Flat id with the x dimension fastest, which is how threads are assigned to warps
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    unsigned int row_major_id() const
+    {
+        return (z * BlockSizeY + y) * BlockSizeX + x;
+    }
+
+    // Flat id with the y dimension fastest
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    unsigned int column_major_id() const
+    {
+        return (z * BlockSizeX + x) * BlockSizeY + y;
+    }
+};
+
+// Moves the items of a block between the row-major order of threads and the column-major order,
+// so the columns (all y of the same x and z) are held by consecutive threads. Every column is
+// padded by one item to avoid bank conflicts when the columns are written.
+template<class T, unsigned int BlockSizeX, unsigned int BlockSizeY, unsigned int BlockSizeZ>
+class block_axis_transpose
+{
+    static constexpr unsigned int columns = BlockSizeX * BlockSizeZ;
+    static constexpr unsigned int column_stride = BlockSizeY + 1;
+
+    struct storage_type_
+    {
+        T buffer[columns * column_stride];
+    };
+
+public:
+    using storage_type = detail::raw_storage<storage_type_>;
+
+    // Returns the item at the position of the calling thread in the column-major order
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    T to_columns(const T& input, storage_type& storage)
+    {
+        const block_axis_thread<BlockSizeX, BlockSizeY, BlockSizeZ> thread;
+        storage_type_& storage_ = storage.get();
+
+        storage_.buffer[index(thread.column_major_id())] = input;
+        ::rocprim::syncthreads();
+        return storage_.buffer[index(thread.row_major_id())];
+    }
+
+    // Inverse of to_columns, every thread only reads and writes its own position in between
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    T from_columns(const T& input, storage_type& storage)
+    {
+        const block_axis_thread<BlockSizeX, BlockSizeY, BlockSizeZ> thread;
+        storage_type_& storage_ = storage.get();
+
+        storage_.buffer[index(thread.row_major_id())] = input;
+        ::rocprim::syncthreads();
+        return storage_.buffer[index(thread.column_major_id())];
+    }
+
+private:
+    // Position of the n-th item of the column-major order in the padded buffer
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static unsigned int index(const unsigned int n)
+    {
+        return (n / BlockSizeY) * column_stride + n % BlockSizeY;
+    }
+};
+
+} // end namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_BLOCK_DETAIL_BLOCK_AXIS_TRANSPOSE_HPP_
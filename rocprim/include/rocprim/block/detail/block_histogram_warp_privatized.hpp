@@ -0,0 +1,141 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_BLOCK_DETAIL_BLOCK_HISTOGRAM_WARP_PRIVATIZED_HPP_
+#define ROCPRIM_BLOCK_DETAIL_BLOCK_HISTOGRAM_WARP_PRIVATIZED_HPP_
+
+#include <type_traits>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+
+#include "../../intrinsics.hpp"
+#include "../../functional.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Every warp counts its items in its own sub-histogram in LDS, so atomics contend only within
+// the warp, and the sub-histograms are summed into the output. When a warp has less than 2^16
+// items, two 16-bit counters are packed into one 32-bit word, which halves the storage.
+template<
+    class T,
+    unsigned int BlockSizeX,
+    unsigned int BlockSizeY,
+    unsigned int BlockSizeZ,
+    unsigned int ItemsPerThread,
+    unsigned int Bins
+>
+class block_histogram_warp_privatized
+{
+    static constexpr unsigned int BlockSize = BlockSizeX * BlockSizeY * BlockSizeZ;
+    static_assert(
+        std::is_convertible<T, unsigned int>::value,
+        "T must be convertible to unsigned int"
+    );
+
+    static constexpr unsigned int warp_size = ::rocprim::device_warp_size();
+    static constexpr unsigned int warps_no = ::rocprim::detail::ceiling_div(BlockSize, warp_size);
+
+    // The counts of a warp cannot overflow 16 bits
+    static constexpr bool use_packed_counters = warp_size * ItemsPerThread < (1u << 16);
+    static constexpr unsigned int counter_bits = 16;
+    static constexpr unsigned int bins_per_word = use_packed_counters ? 2 : 1;
+    static constexpr unsigned int words_per_warp
+        = ::rocprim::detail::ceiling_div(Bins, bins_per_word);
+    static constexpr unsigned int words = warps_no * words_per_warp;
+
+public:
+    struct storage_type_
+    {
+        unsigned int counters[words];
+    };
+
+    using storage_type = detail::raw_storage<storage_type_>;
+
+    template<class Counter>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void composite(T (&input)[ItemsPerThread],
+                   Counter hist[Bins])
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        this->composite(input, hist, storage);
+    }
+
+    template<class Counter>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void composite(T (&input)[ItemsPerThread],
+                   Counter hist[Bins],
+                   storage_type& storage)
+    {
+        const unsigned int flat_tid = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        const unsigned int warp_id = ::rocprim::warp_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        storage_type_& storage_ = storage.get();
+
+        ROCPRIM_UNROLL
+        for(unsigned int offset = 0; offset < words; offset += BlockSize)
+        {
+            const unsigned int offset_tid = offset + flat_tid;
+            if(offset_tid < words)
+            {
+                storage_.counters[offset_tid] = 0;
+            }
+        }
+        ::rocprim::syncthreads();
+
+        unsigned int* warp_counters = &storage_.counters[warp_id * words_per_warp];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            const unsigned int bin = static_cast<unsigned int>(input[i]);
+            ::rocprim::detail::atomic_add(&warp_counters[bin / bins_per_word],
+                                          1u << (counter_bits * (bin % bins_per_word)));
+        }
+        ::rocprim::syncthreads();
+
+        ROCPRIM_UNROLL
+        for(unsigned int offset = 0; offset < Bins; offset += BlockSize)
+        {
+            const unsigned int bin = offset + flat_tid;
+            if(bin < Bins)
+            {
+                unsigned int count = 0;
+                ROCPRIM_UNROLL
+                for(unsigned int warp = 0; warp < warps_no; ++warp)
+                {
+                    const unsigned int word
+                        = storage_.counters[warp * words_per_warp + bin / bins_per_word];
+                    count += use_packed_counters
+                                 ? (word >> (counter_bits * (bin % bins_per_word))) & 0xFFFFu
+                                 : word;
+                }
+                hist[bin] += static_cast<Counter>(count);
+            }
+        }
+    }
+};
+
+} // end namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_BLOCK_DETAIL_BLOCK_HISTOGRAM_WARP_PRIVATIZED_HPP_
@@ -29,6 +29,7 @@
 #include "../../intrinsics.hpp"
 #include "../../functional.hpp"
 
+#include "../../thread/thread_reduce.hpp"
 #include "../../warp/warp_reduce.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
@@ -58,6 +59,17 @@ class block_reduce_raking_reduce
     static constexpr bool commutative_only_        = CommutativeOnly && ((BlockSize % warp_size_ == 0) && (BlockSize > warp_size_));
     static constexpr unsigned int sharing_threads_ = ::rocprim::max<int>(1, BlockSize - warp_size_);
     static constexpr unsigned int segment_length_  = sharing_threads_ / warp_size_;
+    // Non-commutative operators: lane i rakes the contiguous threads
+    // [i * ordered_segment_length_, (i + 1) * ordered_segment_length_) so the inputs are reduced
+    // in the order of the threads. Commutative operators rake the threads strided by the warp
+    // size, which is free of bank conflicts.
+    static constexpr unsigned int ordered_segment_length_
+        = ::rocprim::detail::ceiling_div(BlockSize, warp_size_);
+
+    template<class BinaryFunction>
+    using is_commutative_op = std::integral_constant<
+        bool,
+        CommutativeOnly || ::rocprim::is_commutative<BinaryFunction>::value>;
 
     // BlockSize is multiple of hardware warp
     static constexpr bool block_size_smaller_than_warp_size_ = (BlockSize < warp_size_);
@@ -116,12 +128,7 @@ public:
                 BinaryFunction reduce_op)
     {
         // Reduce thread items
-        T thread_input = input[0];
-        ROCPRIM_UNROLL
-        for(unsigned int i = 1; i < ItemsPerThread; i++)
-        {
-            thread_input = reduce_op(thread_input, input[i]);
-        }
+        T thread_input = ::rocprim::detail::thread_reduce_items(input, reduce_op);
 
         // Reduction of reduced values to get partials
         const auto flat_tid = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
@@ -186,14 +193,30 @@ public:
 
 private:
 
-    template<class BinaryFunction, bool FunctionCommutativeOnly = commutative_only_>
+    template<class BinaryFunction,
+             bool Commutative             = is_commutative_op<BinaryFunction>::value,
+             bool FunctionCommutativeOnly = commutative_only_>
     ROCPRIM_DEVICE ROCPRIM_INLINE
     auto reduce_impl(const unsigned int flat_tid,
                      T input,
                      T& output,
                      storage_type& storage,
                      BinaryFunction reduce_op)
-        -> typename std::enable_if<(!FunctionCommutativeOnly), void>::type
+        -> typename std::enable_if<(!Commutative), void>::type
+    {
+        this->reduce_ordered(flat_tid, input, output, BlockSize, storage, reduce_op);
+    }
+
+    template<class BinaryFunction,
+             bool Commutative             = is_commutative_op<BinaryFunction>::value,
+             bool FunctionCommutativeOnly = commutative_only_>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    auto reduce_impl(const unsigned int flat_tid,
+                     T input,
+                     T& output,
+                     storage_type& storage,
+                     BinaryFunction reduce_op)
+        -> typename std::enable_if<(Commutative && !FunctionCommutativeOnly), void>::type
     {
         storage_type_& storage_ = storage.get();
         storage_.threads[flat_tid] = input;
@@ -214,14 +237,16 @@ private:
         }
     }
 
-    template<class BinaryFunction, bool FunctionCommutativeOnly = commutative_only_>
+    template<class BinaryFunction,
+             bool Commutative             = is_commutative_op<BinaryFunction>::value,
+             bool FunctionCommutativeOnly = commutative_only_>
     ROCPRIM_DEVICE ROCPRIM_INLINE
     auto reduce_impl(const unsigned int flat_tid,
                      T input,
                      T& output,
                      storage_type& storage,
                      BinaryFunction reduce_op)
-        -> typename std::enable_if<(FunctionCommutativeOnly), void>::type
+        -> typename std::enable_if<(Commutative && FunctionCommutativeOnly), void>::type
     {
         storage_type_& storage_ = storage.get();
 
@@ -274,14 +299,28 @@ private:
         );
     }
 
-    template<class BinaryFunction>
+    template<class BinaryFunction, bool Commutative = is_commutative_op<BinaryFunction>::value>
     ROCPRIM_DEVICE ROCPRIM_INLINE
-    void reduce_impl(const unsigned int flat_tid,
+    auto reduce_impl(const unsigned int flat_tid,
                      T input,
                      T& output,
                      const unsigned int valid_items,
                      storage_type& storage,
                      BinaryFunction reduce_op)
+        -> typename std::enable_if<(!Commutative), void>::type
+    {
+        this->reduce_ordered(flat_tid, input, output, valid_items, storage, reduce_op);
+    }
+
+    template<class BinaryFunction, bool Commutative = is_commutative_op<BinaryFunction>::value>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    auto reduce_impl(const unsigned int flat_tid,
+                     T input,
+                     T& output,
+                     const unsigned int valid_items,
+                     storage_type& storage,
+                     BinaryFunction reduce_op)
+        -> typename std::enable_if<(Commutative), void>::type
     {
         storage_type_& storage_ = storage.get();
         storage_.threads[flat_tid] = input;
@@ -300,6 +339,39 @@ private:
             warp_reduce_prefix_type().reduce(thread_reduction, output, valid_items, reduce_op);
         }
     }
+
+    template<class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void reduce_ordered(const unsigned int flat_tid,
+                        T input,
+                        T& output,
+                        const unsigned int valid_items,
+                        storage_type& storage,
+                        BinaryFunction reduce_op)
+    {
+        storage_type_& storage_ = storage.get();
+        storage_.threads[flat_tid] = input;
+        ::rocprim::syncthreads();
+
+        if (flat_tid < warp_size_)
+        {
+            const unsigned int segment_begin = flat_tid * ordered_segment_length_;
+            // Lanes past the valid items are not reduced by the warp reduce
+            T thread_reduction = storage_.threads[segment_begin < valid_items ? segment_begin : 0];
+            ROCPRIM_UNROLL
+            for(unsigned int i = 1; i < ordered_segment_length_; i++)
+            {
+                if(segment_begin + i < valid_items)
+                {
+                    thread_reduction
+                        = reduce_op(thread_reduction, storage_.threads[segment_begin + i]);
+                }
+            }
+            const unsigned int valid_lanes
+                = ::rocprim::detail::ceiling_div(valid_items, ordered_segment_length_);
+            warp_reduce_prefix_type().reduce(thread_reduction, output, valid_lanes, reduce_op);
+        }
+    }
 };
 } // end namespace detail
 
@@ -29,6 +29,7 @@
 #include "../../intrinsics.hpp"
 #include "../../functional.hpp"
 
+#include "../../thread/thread_reduce.hpp"
 #include "../../warp/warp_reduce.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
@@ -105,12 +106,7 @@ public:
                 BinaryFunction reduce_op)
     {
         // Reduce thread items
-        T thread_input = input[0];
-        ROCPRIM_UNROLL
-        for(unsigned int i = 1; i < ItemsPerThread; i++)
-        {
-            thread_input = reduce_op(thread_input, input[i]);
-        }
+        T thread_input = ::rocprim::detail::thread_reduce_items(input, reduce_op);
 
         // Reduction of reduced values to get partials
         const auto flat_tid = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
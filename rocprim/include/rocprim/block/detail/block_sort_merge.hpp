@@ -21,16 +21,39 @@
 #ifndef ROCPRIM_BLOCK_DETAIL_BLOCK_SORT_MERGE_HPP_
 #define ROCPRIM_BLOCK_DETAIL_BLOCK_SORT_MERGE_HPP_
 
+#include <type_traits>
+
 #include "../../config.hpp"
 #include "../../detail/merge_path.hpp"
 #include "../../detail/various.hpp"
-#include "../../warp/warp_sort.hpp"
+
+#include "../../intrinsics.hpp"
+#include "../../functional.hpp"
+#include "../../thread/thread_sort.hpp"
+#include "../../types.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
 namespace detail
 {
 
+template<class Key, class Value, unsigned int Size>
+struct block_sort_merge_storage
+{
+    Key   keys[Size];
+    Value values[Size];
+};
+
+template<class Key, unsigned int Size>
+struct block_sort_merge_storage<Key, empty_type, Size>
+{
+    Key keys[Size];
+};
+
+// Stable merge sort of the items of the block in a blocked arrangement. Every thread sorts its
+// own items, then sorted runs of threads are merged in pairs through shared memory, with the
+// merge path partitioning every merge evenly across threads. ItemsPerThread can be any number,
+// only the first size items of the block are compared and the items past them are left unchanged.
 template<class Key,
          unsigned int BlockSizeX,
          unsigned int BlockSizeY,
@@ -41,46 +64,20 @@ class block_sort_merge
 {
     static constexpr const unsigned int BlockSize     = BlockSizeX * BlockSizeY * BlockSizeZ;
     static constexpr const unsigned int ItemsPerBlock = BlockSize * ItemsPerThread;
-    static constexpr const unsigned int WarpSortSize  = std::min(BlockSize, 16u);
-    static constexpr const bool with_values = !std::is_same<Value, rocprim::empty_type>::value;
-    using warp_sort_type                    = rocprim::warp_sort<Key, WarpSortSize, Value>;
-    static_assert(
-        std::is_same<typename warp_sort_type::storage_type, detail::empty_storage_type>::value,
-        "Update block_sort_merge to allocate shared memory for warp_sort.");
 
     static_assert(rocprim::detail::is_power_of_two(BlockSize),
                   "BlockSize must be a power of two for block_sort_merge!");
 
-    static_assert(rocprim::detail::is_power_of_two(ItemsPerThread),
-                  "ItemsPerThread must be a power of two for block_sort_merge!");
-
-    template<bool with_values>
-    struct storage_type_
-    {
-        detail::raw_storage<Key[ItemsPerBlock]> keys;
-    };
-
-    template<>
-    struct storage_type_<true>
-    {
-        detail::raw_storage<Key[ItemsPerBlock]>   keys;
-        detail::raw_storage<Value[ItemsPerBlock]> values;
-    };
+    using storage_type_ = block_sort_merge_storage<Key, Value, ItemsPerBlock>;
 
 public:
-    using storage_type = storage_type_<with_values>;
+    using storage_type = detail::raw_storage<storage_type_>;
 
     template<class BinaryFunction>
     ROCPRIM_DEVICE ROCPRIM_INLINE void
         sort(Key& thread_key, storage_type& storage, BinaryFunction compare_function)
     {
-        Key thread_keys[] = {thread_key};
-        this->sort_impl<ItemsPerBlock>(
-            ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>(),
-            storage,
-            compare_function,
-            thread_keys);
-        thread_key = thread_keys[0];
+        this->sort(thread_key, storage, ItemsPerBlock, compare_function);
     }
 
     template<class BinaryFunction>
@@ -88,11 +85,8 @@ public:
                                             storage_type&  storage,
                                             BinaryFunction compare_function)
     {
-        this->sort_impl<ItemsPerBlock>(
-            ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>(),
-            storage,
-            compare_function,
-            thread_keys);
+        empty_type thread_values[ItemsPerThread];
+        this->sort_impl(thread_keys, thread_values, ItemsPerBlock, storage.get(), compare_function);
     }
 
     template<class BinaryFunction>
@@ -116,30 +110,20 @@ public:
                                             storage_type&  storage,
                                             BinaryFunction compare_function)
     {
-        Key   thread_keys[]   = {thread_key};
-        Value thread_values[] = {thread_value};
-        this->sort_impl<ItemsPerBlock>(
-            ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>(),
-            storage,
-            compare_function,
-            thread_keys,
-            thread_values);
+        Key   thread_keys[ItemsPerThread]   = {thread_key};
+        Value thread_values[ItemsPerThread] = {thread_value};
+        this->sort_impl(thread_keys, thread_values, ItemsPerBlock, storage.get(), compare_function);
         thread_key   = thread_keys[0];
         thread_value = thread_values[0];
     }
 
     template<class BinaryFunction>
-    ROCPRIM_DEVICE inline void sort(Key (&thread_keys)[ItemsPerThread],
-                                    Value (&thread_values)[ItemsPerThread],
-                                    storage_type&  storage,
-                                    BinaryFunction compare_function)
+    ROCPRIM_DEVICE ROCPRIM_INLINE void sort(Key (&thread_keys)[ItemsPerThread],
+                                            Value (&thread_values)[ItemsPerThread],
+                                            storage_type&  storage,
+                                            BinaryFunction compare_function)
     {
-        this->sort_impl<ItemsPerBlock>(
-            ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>(),
-            storage,
-            compare_function,
-            thread_keys,
-            thread_values);
+        this->sort_impl(thread_keys, thread_values, ItemsPerBlock, storage.get(), compare_function);
     }
 
     template<class BinaryFunction>
@@ -159,175 +143,157 @@ public:
         this->sort(thread_keys, thread_values, storage, compare_function);
     }
 
-private:
-    ROCPRIM_DEVICE ROCPRIM_INLINE void
-        copy_to_shared(Key& k, const unsigned int flat_tid, Key* keys_shared)
+    template<class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void sort(Key&               thread_key,
+                                            storage_type&      storage,
+                                            const unsigned int size,
+                                            BinaryFunction     compare_function)
     {
-        keys_shared[flat_tid] = k;
-        ::rocprim::syncthreads();
+        static_assert(ItemsPerThread == 1, "This overload requires ItemsPerThread to be 1.");
+        Key        thread_keys[ItemsPerThread] = {thread_key};
+        empty_type thread_values[ItemsPerThread];
+        this->sort_impl(thread_keys, thread_values, size, storage.get(), compare_function);
+        thread_key = thread_keys[0];
     }
 
-    ROCPRIM_DEVICE ROCPRIM_INLINE void
-        copy_to_shared(Key (&k)[ItemsPerThread], const unsigned int flat_tid, Key* keys_shared)
+    template<class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void sort(Key (&thread_keys)[ItemsPerThread],
+                                            storage_type&      storage,
+                                            const unsigned int size,
+                                            BinaryFunction     compare_function)
     {
-        ROCPRIM_UNROLL
-        for(unsigned int item = 0; item < ItemsPerThread; ++item)
-        {
-            keys_shared[ItemsPerThread * flat_tid + item] = k[item];
-        }
-        ::rocprim::syncthreads();
+        empty_type thread_values[ItemsPerThread];
+        this->sort_impl(thread_keys, thread_values, size, storage.get(), compare_function);
     }
 
-    ROCPRIM_DEVICE ROCPRIM_INLINE void copy_to_shared(
-        Key& k, Value& v, const unsigned int flat_tid, Key* keys_shared, Value* values_shared)
+    template<class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void sort(Key (&thread_keys)[ItemsPerThread],
+                                            Value (&thread_values)[ItemsPerThread],
+                                            storage_type&      storage,
+                                            const unsigned int size,
+                                            BinaryFunction     compare_function)
     {
-        keys_shared[flat_tid]   = k;
-        values_shared[flat_tid] = v;
-        ::rocprim::syncthreads();
+        this->sort_impl(thread_keys, thread_values, size, storage.get(), compare_function);
     }
 
-    ROCPRIM_DEVICE ROCPRIM_INLINE void copy_to_shared(Key (&k)[ItemsPerThread],
-                                                      Value (&v)[ItemsPerThread],
-                                                      const unsigned int flat_tid,
-                                                      Key*               keys_shared,
-                                                      Value*             values_shared)
+private:
+    ROCPRIM_DEVICE ROCPRIM_INLINE static void store_values(const Value (&values)[ItemsPerThread],
+                                                           const unsigned int thread_offset,
+                                                           storage_type_&     storage,
+                                                           std::true_type)
     {
         ROCPRIM_UNROLL
-        for(unsigned int item = 0; item < ItemsPerThread; ++item)
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
         {
-            keys_shared[ItemsPerThread * flat_tid + item]   = k[item];
-            values_shared[ItemsPerThread * flat_tid + item] = v[item];
+            storage.values[thread_offset + i] = values[i];
         }
-        ::rocprim::syncthreads();
     }
 
-    template<unsigned int Size, class BinaryFunction>
-    ROCPRIM_DEVICE ROCPRIM_INLINE void sort_impl(const unsigned int flat_tid,
-                                                 storage_type&      storage,
-                                                 BinaryFunction     compare_function,
-                                                 Key (&keys)[ItemsPerThread])
-    {
-        if(Size > ItemsPerBlock)
-        {
-            return;
-        }
-        warp_sort_type ws;
-        ws.sort(keys, compare_function);
-        sort_merge_impl(flat_tid,
-                        Size,
-                        ItemsPerThread * WarpSortSize,
-                        storage,
-                        compare_function,
-                        keys);
-    }
+    ROCPRIM_DEVICE ROCPRIM_INLINE static void store_values(const empty_type (&)[ItemsPerThread],
+                                                           const unsigned int,
+                                                           storage_type_&,
+                                                           std::false_type)
+    {}
 
-    template<unsigned int Size, class BinaryFunction>
-    ROCPRIM_DEVICE ROCPRIM_INLINE void sort_impl(const unsigned int flat_tid,
-                                                 storage_type&      storage,
-                                                 BinaryFunction     compare_function,
-                                                 Key (&keys)[ItemsPerThread],
-                                                 Value (&values)[ItemsPerThread])
+    ROCPRIM_DEVICE ROCPRIM_INLINE static void
+        load_value(Value& value, const unsigned int index, storage_type_& storage, std::true_type)
     {
-        if(Size > ItemsPerBlock)
-        {
-            return;
-        }
-        warp_sort_type ws;
-        ws.sort(keys, values, compare_function);
-        sort_merge_impl(flat_tid,
-                        Size,
-                        ItemsPerThread * WarpSortSize,
-                        storage,
-                        compare_function,
-                        keys,
-                        values);
+        value = storage.values[index];
     }
 
-    template<class BinaryFunction>
-    ROCPRIM_DEVICE ROCPRIM_INLINE void sort_merge_impl(const unsigned int flat_tid,
-                                                       const unsigned int input_size,
-                                                       unsigned int       sorted_block_size,
-                                                       storage_type&      storage,
-                                                       BinaryFunction     compare_function,
-                                                       Key (&thread_keys)[ItemsPerThread])
+    ROCPRIM_DEVICE ROCPRIM_INLINE static void
+        load_value(empty_type&, const unsigned int, storage_type_&, std::false_type)
+    {}
+
+    template<class V, class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void sort_impl(Key (&keys)[ItemsPerThread],
+                                                 V (&values)[ItemsPerThread],
+                                                 const unsigned int size,
+                                                 storage_type_&     storage,
+                                                 BinaryFunction     compare_function)
     {
-        const unsigned int thread_offset = flat_tid * ItemsPerThread;
-        auto&              keys_shared   = storage.keys.get();
+        using with_values_type = std::integral_constant<bool, !std::is_same<V, empty_type>::value>;
 
-        if(ItemsPerThread == 1 && thread_offset > input_size)
-            return;
-        // loop as long as sorted_block_size < input_size
-        while(sorted_block_size < input_size)
+        if(size > ItemsPerBlock)
         {
-            copy_to_shared(thread_keys, flat_tid, keys_shared);
-            const unsigned int target_sorted_block_size = sorted_block_size * 2;
-            const unsigned int mask                     = target_sorted_block_size - 1;
-            const unsigned int keys1_beg                = ~mask & thread_offset;
-            const unsigned int keys1_end   = std::min(input_size, keys1_beg + sorted_block_size);
-            const unsigned int keys2_end   = std::min(input_size, keys1_end + sorted_block_size);
-            sorted_block_size              = target_sorted_block_size;
-            const unsigned int diag0_local = std::min(input_size, mask & thread_offset);
-
-            const unsigned int num_keys1 = keys1_end - keys1_beg;
-            const unsigned int num_keys2 = keys2_end - keys1_end;
-
-            const unsigned int keys1_beg_local = merge_path(&keys_shared[keys1_beg],
-                                                            &keys_shared[keys1_end],
-                                                            num_keys1,
-                                                            num_keys2,
-                                                            diag0_local,
-                                                            compare_function);
-            const unsigned int keys2_beg_local = diag0_local - keys1_beg_local;
-            range_t            range_local
-                = {keys1_beg_local + keys1_beg, keys1_end, keys2_beg_local + keys1_end, keys2_end};
-
-            serial_merge(keys_shared, thread_keys, range_local, compare_function);
+            return;
         }
-    }
-
-    template<class BinaryFunction>
-    ROCPRIM_DEVICE ROCPRIM_INLINE void sort_merge_impl(const unsigned int flat_tid,
-                                                       const unsigned int input_size,
-                                                       unsigned int       sorted_block_size,
-                                                       storage_type&      storage,
-                                                       BinaryFunction     compare_function,
-                                                       Key (&thread_keys)[ItemsPerThread],
-                                                       Value (&thread_values)[ItemsPerThread])
-    {
+        const unsigned int flat_tid
+            = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
         const unsigned int thread_offset = flat_tid * ItemsPerThread;
-        auto&              keys_shared   = storage.keys.get();
-        auto&              values_shared = storage.values.get();
-        // loop as long as sorted_block_size < input_size
-        while(sorted_block_size < input_size)
+        const unsigned int thread_begin  = ::rocprim::min(size, thread_offset);
+
+        // The transposition network only swaps neighbours in the wrong order, so it is stable
+        ::rocprim::thread_sort<thread_sort_network::odd_even_transposition>(
+            keys,
+            values,
+            ::rocprim::min(size - thread_begin, ItemsPerThread),
+            compare_function);
+
+        // Sorted runs of run_threads threads are merged in pairs, the ranges of the runs are
+        // computed from the thread ids, so ItemsPerThread does not need to be a power of two
+        for(unsigned int run_threads = 1;
+            run_threads < BlockSize && run_threads * ItemsPerThread < size;
+            run_threads *= 2)
         {
-            copy_to_shared(thread_keys, thread_values, flat_tid, keys_shared, values_shared);
-            const unsigned int target_sorted_block_size = sorted_block_size * 2;
-            const unsigned int mask                     = target_sorted_block_size - 1;
-            const unsigned int keys1_beg                = ~mask & thread_offset;
-            const unsigned int keys1_end   = std::min(input_size, keys1_beg + sorted_block_size);
-            const unsigned int keys2_end   = std::min(input_size, keys1_end + sorted_block_size);
-            sorted_block_size              = target_sorted_block_size;
-            const unsigned int diag0_local = std::min(input_size, mask & thread_offset);
-
-            const unsigned int num_keys1 = keys1_end - keys1_beg;
-            const unsigned int num_keys2 = keys2_end - keys1_end;
-
-            const unsigned int keys1_beg_local = merge_path(&keys_shared[keys1_beg],
-                                                            &keys_shared[keys1_end],
-                                                            num_keys1,
-                                                            num_keys2,
-                                                            diag0_local,
-                                                            compare_function);
-            const unsigned int keys2_beg_local = diag0_local - keys1_beg_local;
-            range_t            range_local
-                = {keys1_beg_local + keys1_beg, keys1_end, keys2_beg_local + keys1_end, keys2_end};
-
-            serial_merge(keys_shared,
-                         thread_keys,
-                         values_shared,
-                         thread_values,
-                         range_local,
-                         compare_function);
+            // The storage is read by the previous merge
+            if(run_threads > 1)
+            {
+                ::rocprim::syncthreads();
+            }
+            ROCPRIM_UNROLL
+            for(unsigned int i = 0; i < ItemsPerThread; i++)
+            {
+                storage.keys[thread_offset + i] = keys[i];
+            }
+            store_values(values, thread_offset, storage, with_values_type());
+            ::rocprim::syncthreads();
+
+            const unsigned int run_items   = run_threads * ItemsPerThread;
+            const unsigned int pair_offset = (flat_tid & ~(2 * run_threads - 1)) * ItemsPerThread;
+            const unsigned int keys1_begin = ::rocprim::min(size, pair_offset);
+            const unsigned int keys1_end   = ::rocprim::min(size, pair_offset + run_items);
+            const unsigned int keys2_end   = ::rocprim::min(size, pair_offset + 2 * run_items);
+            const unsigned int diag        = thread_begin - keys1_begin;
+
+            const unsigned int split = merge_path(&storage.keys[keys1_begin],
+                                                  &storage.keys[keys1_end],
+                                                  keys1_end - keys1_begin,
+                                                  keys2_end - keys1_end,
+                                                  diag,
+                                                  compare_function);
+            unsigned int begin1 = keys1_begin + split;
+            unsigned int begin2 = keys1_end + diag - split;
+
+            // Only the remaining items of the runs are read, the outputs at positions
+            // past size are not written. On ties the item of the first run is taken,
+            // which keeps the merge stable.
+            Key key1;
+            Key key2;
+            if(begin1 < keys1_end) key1 = storage.keys[begin1];
+            if(begin2 < keys2_end) key2 = storage.keys[begin2];
+            ROCPRIM_UNROLL
+            for(unsigned int i = 0; i < ItemsPerThread; i++)
+            {
+                const bool has1 = begin1 < keys1_end;
+                const bool has2 = begin2 < keys2_end;
+                if(has1 || has2)
+                {
+                    const bool take1 = has1 && (!has2 || !compare_function(key2, key1));
+                    if(take1)
+                    {
+                        keys[i] = key1;
+                        load_value(values[i], begin1, storage, with_values_type());
+                        if(++begin1 < keys1_end) key1 = storage.keys[begin1];
+                    }
+                    else
+                    {
+                        keys[i] = key2;
+                        load_value(values[i], begin2, storage, with_values_type());
+                        if(++begin2 < keys2_end) key2 = storage.keys[begin2];
+                    }
+                }
+            }
         }
     }
 };
@@ -79,6 +79,13 @@
     #define ROCPRIM_THREAD_STORE_USE_CACHE_MODIFIERS 1
 #endif
 
+// texture_cache_iterator creates texture objects only if this is 1, otherwise it loads through
+// thread_load<load_ldg>: linear fetches through textures are not faster than plain loads on the
+// supported architectures, but creating and destroying the objects costs host time.
+#ifndef ROCPRIM_TEXTURE_CACHE_ITERATOR_USE_TEXTURES
+    #define ROCPRIM_TEXTURE_CACHE_ITERATOR_USE_TEXTURES 0
+#endif
+
 
 // Defines targeted AMD architecture. Supported values:
 // * 803 (gfx803)
@@ -86,6 +93,9 @@
 // * 906 (gfx906)
 // * 908 (gfx908)
 // * 910 (gfx90a)
+// * 940 (gfx940), 941 (gfx941), 942 (gfx942)
+// * 1030 (gfx1030)
+// * 1100 (gfx1100)
 #ifndef ROCPRIM_TARGET_ARCH
     #define ROCPRIM_TARGET_ARCH 0
 #endif
@@ -95,8 +105,28 @@
 #else
     #define ROCPRIM_NAVI 0
 #endif
+
+// DPP row_newbcast (gfx90a and gfx94x) and row_share (gfx10 and later) copy a lane of every row
+// of 16 lanes to all lanes of the row
+#if (__gfx90a__ || __gfx940__ || __gfx941__ || __gfx942__ || ROCPRIM_NAVI)
+    #define ROCPRIM_DETAIL_HAS_DPP_ROW_SHARE 1
+#else
+    #define ROCPRIM_DETAIL_HAS_DPP_ROW_SHARE 0
+#endif
 #define ROCPRIM_ARCH_90a 910
 
+// Number of counters the tile ids of the look-back scan are striped over, see
+// detail::striped_ordered_block_id. gfx94x dispatches the workgroups to its 8 dies (XCDs) in
+// round-robin order, one counter per die keeps most of the atomics of a die on its own counter.
+// Defining ROCPRIM_ORDERED_BLOCK_ID_STRIPES to 1 restores one counter for all blocks.
+#if defined(ROCPRIM_ORDERED_BLOCK_ID_STRIPES)
+    #define ROCPRIM_DETAIL_ORDERED_BLOCK_ID_STRIPES ROCPRIM_ORDERED_BLOCK_ID_STRIPES
+#elif (__gfx940__ || __gfx941__ || __gfx942__)
+    #define ROCPRIM_DETAIL_ORDERED_BLOCK_ID_STRIPES 8
+#else
+    #define ROCPRIM_DETAIL_ORDERED_BLOCK_ID_STRIPES 1
+#endif
+
 /// Supported warp sizes
 #define ROCPRIM_WARP_SIZE_32 32u
 #define ROCPRIM_WARP_SIZE_64 64u
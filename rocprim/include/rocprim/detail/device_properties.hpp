@@ -0,0 +1,136 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DETAIL_DEVICE_PROPERTIES_HPP_
+#define ROCPRIM_DETAIL_DEVICE_PROPERTIES_HPP_
+
+#include <cstring>
+#include <mutex>
+
+#include "../config.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+namespace detail
+{
+
+// The subset of hipDeviceProp_t that is needed to launch device algorithms.
+struct device_properties
+{
+    unsigned int warp_size;
+    unsigned int compute_units;
+    // Whether look-back must use s_sleep while waiting for predecessors (gfx908 revisions < 2).
+    bool use_sleep_scan_state;
+    // Whether kernels can be launched with hipLaunchCooperativeKernel
+    // (hipDeviceAttributeCooperativeLaunch).
+    bool cooperative_launch;
+    char gcn_arch_name[sizeof(hipDeviceProp_t::gcnArchName)];
+};
+
+// Querying hipGetDeviceProperties takes tens of microseconds, so the properties of every
+// device are queried once and then served from this cache.
+class device_properties_cache
+{
+public:
+    static constexpr unsigned int max_devices = 512;
+
+    static device_properties_cache& instance()
+    {
+        static device_properties_cache cache;
+        return cache;
+    }
+
+    hipError_t get(const int device_id, device_properties& props)
+    {
+        if(device_id < 0 || static_cast<unsigned int>(device_id) >= max_devices)
+        {
+            // Device properties cache is too small.
+            return hipErrorInvalidDevice;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        entry& e = entries_[device_id];
+        if(!e.valid)
+        {
+            hipDeviceProp_t  device_props;
+            const hipError_t result = hipGetDeviceProperties(&device_props, device_id);
+            if(result != hipSuccess)
+            {
+                return result;
+            }
+#if HIP_VERSION >= 307
+            const int asic_revision = device_props.asicRevision;
+#else
+            const int asic_revision = 0;
+#endif
+            e.props.warp_size            = static_cast<unsigned int>(device_props.warpSize);
+            e.props.compute_units        = static_cast<unsigned int>(device_props.multiProcessorCount);
+            e.props.use_sleep_scan_state = device_props.gcnArch == 908 && asic_revision < 2;
+            e.props.cooperative_launch   = device_props.cooperativeLaunch != 0;
+            std::memcpy(e.props.gcn_arch_name,
+                        device_props.gcnArchName,
+                        sizeof(e.props.gcn_arch_name));
+            e.valid = true;
+        }
+        props = e.props;
+        return hipSuccess;
+    }
+
+    void invalidate()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for(entry& e : entries_)
+        {
+            e.valid = false;
+        }
+    }
+
+private:
+    struct entry
+    {
+        bool              valid = false;
+        device_properties props;
+    };
+
+    device_properties_cache() = default;
+
+    std::mutex mutex_;
+    entry      entries_[max_devices];
+};
+
+inline hipError_t get_device_properties(const int device_id, device_properties& props)
+{
+    return device_properties_cache::instance().get(device_id, props);
+}
+
+inline hipError_t get_current_device_properties(device_properties& props)
+{
+    int              device_id;
+    const hipError_t result = hipGetDevice(&device_id);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    return get_device_properties(device_id, props);
+}
+
+} // end namespace detail
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DETAIL_DEVICE_PROPERTIES_HPP_
@@ -22,6 +22,9 @@
 #define ROCPRIM_DETAIL_MERGE_PATH_HPP_
 
 #include "../config.hpp"
+#include "../functional.hpp"
+#include "../intrinsics.hpp"
+#include "../types.hpp"
 
 #include <iterator>
 
@@ -81,6 +84,37 @@ ROCPRIM_DEVICE ROCPRIM_INLINE OffsetT merge_path(KeysInputIterator1 keys_input1,
     return begin;
 }
 
+// Returns true when the ItemsPerThread items merged from range all come from one of its two
+// ranges and sets begin to the position of the first of them. With few distinct keys most runs of
+// equal keys are longer than ItemsPerThread, such items are copied without the dependent chain of
+// comparisons of the merge.
+template<unsigned int ItemsPerThread, class KeyType, class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE bool serial_merge_single_run(const KeyType* keys_shared,
+                                                           const range_t  range,
+                                                           BinaryFunction compare_function,
+                                                           unsigned int&  begin)
+{
+    // On ties the items of the first range are taken, so only the last item of the first range
+    // and the first item of the second range have to be compared
+    if(range.begin1 + ItemsPerThread <= range.end1
+       && (range.begin2 >= range.end2
+           || !compare_function(keys_shared[range.begin2],
+                                keys_shared[range.begin1 + ItemsPerThread - 1])))
+    {
+        begin = range.begin1;
+        return true;
+    }
+    if(range.begin2 + ItemsPerThread <= range.end2
+       && (range.begin1 >= range.end1
+           || compare_function(keys_shared[range.begin2 + ItemsPerThread - 1],
+                               keys_shared[range.begin1])))
+    {
+        begin = range.begin2;
+        return true;
+    }
+    return false;
+}
+
 template<class KeyType, unsigned int ItemsPerThread, class BinaryFunction>
 ROCPRIM_DEVICE ROCPRIM_INLINE void serial_merge(KeyType* keys_shared,
                                                 KeyType (&outputs)[ItemsPerThread],
@@ -88,6 +122,19 @@ ROCPRIM_DEVICE ROCPRIM_INLINE void serial_merge(KeyType* keys_shared,
                                                 range_t        range,
                                                 BinaryFunction compare_function)
 {
+    unsigned int run_begin;
+    if(serial_merge_single_run<ItemsPerThread>(keys_shared, range, compare_function, run_begin))
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            outputs[i] = keys_shared[run_begin + i];
+            index[i]   = run_begin + i;
+        }
+        ::rocprim::syncthreads();
+        return;
+    }
+
     KeyType a = keys_shared[range.begin1];
     KeyType b = keys_shared[range.begin2];
 
@@ -122,6 +169,18 @@ ROCPRIM_DEVICE ROCPRIM_INLINE void serial_merge(KeyType* keys_shared,
                                                 range_t        range,
                                                 BinaryFunction compare_function)
 {
+    unsigned int run_begin;
+    if(serial_merge_single_run<ItemsPerThread>(keys_shared, range, compare_function, run_begin))
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            outputs[i] = keys_shared[run_begin + i];
+        }
+        ::rocprim::syncthreads();
+        return;
+    }
+
     KeyType a = keys_shared[range.begin1];
     KeyType b = keys_shared[range.begin2];
 
@@ -157,6 +216,19 @@ ROCPRIM_DEVICE ROCPRIM_INLINE void serial_merge(KeyType* keys_shared,
                                                 range_t        range,
                                                 BinaryFunction compare_function)
 {
+    unsigned int run_begin;
+    if(serial_merge_single_run<ItemsPerThread>(keys_shared, range, compare_function, run_begin))
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            outputs[i] = keys_shared[run_begin + i];
+            values[i]  = values_shared[run_begin + i];
+        }
+        ::rocprim::syncthreads();
+        return;
+    }
+
     KeyType a = keys_shared[range.begin1];
     KeyType b = keys_shared[range.begin2];
 
@@ -185,6 +257,59 @@ ROCPRIM_DEVICE ROCPRIM_INLINE void serial_merge(KeyType* keys_shared,
     ::rocprim::syncthreads();
 }
 
+template<class Key, class Value, unsigned int Size>
+struct merge_storage
+{
+    Key   keys[Size];
+    Value values[Size];
+};
+
+template<class Key, unsigned int Size>
+struct merge_storage<Key, empty_type, Size>
+{
+    Key keys[Size];
+};
+
+// Stable merge of ItemsPerThread items of the sorted ranges [begin1, end1) and [begin2, end2)
+// of keys, on ties the item of the first range is taken. Only the items of the ranges are read,
+// the positions of the merged items are written to indices and the outputs past the end of both
+// ranges are not written.
+template<class Key, unsigned int ItemsPerThread, class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE void serial_merge_stable(const Key* keys,
+                                                       range_t    range,
+                                                       Key (&outputs)[ItemsPerThread],
+                                                       unsigned int (&indices)[ItemsPerThread],
+                                                       BinaryFunction compare_function)
+{
+    Key key1;
+    Key key2;
+    if(range.begin1 < range.end1) key1 = keys[range.begin1];
+    if(range.begin2 < range.end2) key2 = keys[range.begin2];
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        const bool has1 = range.begin1 < range.end1;
+        const bool has2 = range.begin2 < range.end2;
+        if(has1 || has2)
+        {
+            const bool take1 = has1 && (!has2 || !compare_function(key2, key1));
+            if(take1)
+            {
+                outputs[i] = key1;
+                indices[i] = range.begin1;
+                if(++range.begin1 < range.end1) key1 = keys[range.begin1];
+            }
+            else
+            {
+                outputs[i] = key2;
+                indices[i] = range.begin2;
+                if(++range.begin2 < range.end2) key2 = keys[range.begin2];
+            }
+        }
+    }
+}
+
 } // end namespace detail
 
 END_ROCPRIM_NAMESPACE
@@ -22,11 +22,61 @@
 #define ROCPRIM_DETAIL_RADIX_SORT_HPP_
 
 #include <type_traits>
+#include <utility>
 
 #include "../config.hpp"
+#include "../functional.hpp"
 #include "../type_traits.hpp"
+#include "various.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief Order of floating-point keys in radix sorts.
+///
+/// The order only affects floating-point keys, other keys are always sorted by their values.
+enum class radix_float_order
+{
+    /// \brief -0.0 and +0.0 are equal, so their relative order is preserved (stable sort).
+    /// NaNs with the sign bit set go before -inf, other NaNs go after +inf.
+    signed_zeros_equal,
+    /// \brief IEEE 754 totalOrder: -NaN < -inf < ... < -0.0 < +0.0 < ... < +inf < +NaN.
+    total_order,
+    /// \brief -0.0 and +0.0 are equal, all NaNs go after all other keys in both ascending and
+    /// descending sorts. Sorted NaN keys are replaced by a canonical NaN.
+    nans_last
+};
+
+/// \brief Default decomposer of radix sorts, keys are sorted by their own values.
+///
+/// A custom decomposer allows sorting keys of other types (for example structs) by their
+/// arithmetic fields. It must be a default-constructible class with a const call operator that
+/// takes a reference to a key and returns a \p rocprim::tuple of references to its fields
+/// (see \p rocprim::tie). Keys are ordered by the fields in the order of the tuple, the first
+/// field is the most significant one. Every field must be a type supported by radix sorts.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// struct custom_key
+/// {
+///     unsigned int   shard;
+///     float          score;
+///     unsigned short tag;
+/// };
+///
+/// struct custom_key_decomposer
+/// {
+///     ROCPRIM_HOST_DEVICE
+///     rocprim::tuple<unsigned int&, float&, unsigned short&> operator()(custom_key& key) const
+///     {
+///         return rocprim::tie(key.shard, key.score, key.tag);
+///     }
+/// };
+/// \endcode
+/// \endparblock
+struct identity_decomposer
+{};
+
 namespace detail
 {
 
@@ -168,6 +218,14 @@ struct radix_key_codec_floating
         
         return static_cast<unsigned int>(key >> start) & mask;
     }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static bool is_nan(Key key)
+    {
+        const bit_key_type bit_key = __builtin_bit_cast(bit_key_type, key);
+        return (bit_key & float_bit_mask<Key>::exponent) == float_bit_mask<Key>::exponent
+               && (bit_key & float_bit_mask<Key>::mantissa) != 0;
+    }
 };
 
 template<class Key, class Enable = void>
@@ -183,6 +241,19 @@ struct radix_key_codec_base<
     typename std::enable_if<::rocprim::is_integral<Key>::value>::type
 > : radix_key_codec_integral<Key, typename std::make_unsigned<Key>::type> { };
 
+#if ROCPRIM_HAS_INT128_SUPPORT
+// std::make_unsigned is not defined for 128-bit integers in strict ISO C++ mode
+template<>
+struct radix_key_codec_base<::rocprim::int128_t>
+    : radix_key_codec_integral<::rocprim::int128_t, ::rocprim::uint128_t>
+{};
+
+template<>
+struct radix_key_codec_base<::rocprim::uint128_t>
+    : radix_key_codec_integral<::rocprim::uint128_t, ::rocprim::uint128_t>
+{};
+#endif
+
 template<>
 struct radix_key_codec_base<bool>
 {
@@ -220,19 +291,58 @@ struct radix_key_codec_base<float> : radix_key_codec_floating<float, unsigned in
 template<>
 struct radix_key_codec_base<double> : radix_key_codec_floating<double, unsigned long long> { };
 
-template<class Key, bool Descending = false>
-class radix_key_codec : protected radix_key_codec_base<Key>
+// Orders other than the default one only change how floating-point keys are encoded
+template<class Key, radix_float_order Order>
+struct radix_key_order
+    : std::integral_constant<radix_float_order,
+                             ::rocprim::is_floating_point<Key>::value
+                                 ? Order
+                                 : radix_float_order::signed_zeros_equal>
+{};
+
+template<class Key,
+         bool              Descending = false,
+         radix_float_order Order      = radix_float_order::signed_zeros_equal,
+         class Decomposer             = ::rocprim::identity_decomposer>
+class radix_key_codec;
+
+template<class Key, bool Descending, radix_float_order Order>
+class radix_key_codec<Key, Descending, Order, ::rocprim::identity_decomposer>
+    : protected radix_key_codec_base<Key>
 {
     using base_type = radix_key_codec_base<Key>;
 
+    static constexpr radix_float_order order = radix_key_order<Key, Order>::value;
+
+    template<radix_float_order KeyOrder = order>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static auto is_last_nan(Key key)
+        -> typename std::enable_if<KeyOrder == radix_float_order::nans_last, bool>::type
+    {
+        return base_type::is_nan(key);
+    }
+
+    template<radix_float_order KeyOrder = order>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static auto is_last_nan(Key)
+        -> typename std::enable_if<KeyOrder != radix_float_order::nans_last, bool>::type
+    {
+        return false;
+    }
+
 public:
     using bit_key_type = typename base_type::bit_key_type;
 
+    // Number of bits of the key that are sorted
+    static constexpr unsigned int key_bits = sizeof(bit_key_type) * 8;
+
     ROCPRIM_DEVICE ROCPRIM_INLINE
     static bit_key_type encode(Key key)
     {
         bit_key_type bit_key = base_type::encode(key);
-        return (Descending ? ~bit_key : bit_key);
+        bit_key = (Descending ? ~bit_key : bit_key);
+        // All ones is the encoding of a NaN in both directions, so it decodes to a NaN
+        return is_last_nan(key) ? bit_key_type(-1) : bit_key;
     }
 
     ROCPRIM_DEVICE ROCPRIM_INLINE
@@ -245,10 +355,181 @@ public:
     ROCPRIM_DEVICE ROCPRIM_INLINE
     static unsigned int extract_digit(bit_key_type bit_key, unsigned int start, unsigned int radix_bits)
     {
+        if(order == radix_float_order::total_order)
+        {
+            // -0.0 and +0.0 are different keys
+            unsigned int mask = (1u << radix_bits) - 1;
+            return static_cast<unsigned int>(bit_key >> start) & mask;
+        }
         return base_type::extract_digit(bit_key, start, radix_bits);
     }
+
+    // The key that goes after all other keys
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static Key get_out_of_bounds_key()
+    {
+        return decode(bit_key_type(-1));
+    }
 };
 
+template<class Tuple>
+struct radix_tuple_key_bits;
+
+template<>
+struct radix_tuple_key_bits<::rocprim::tuple<>> : std::integral_constant<unsigned int, 0>
+{};
+
+template<class Field, class... Fields>
+struct radix_tuple_key_bits<::rocprim::tuple<Field, Fields...>>
+    : std::integral_constant<
+          unsigned int,
+          radix_key_codec<typename std::remove_reference<Field>::type>::key_bits
+              + radix_tuple_key_bits<::rocprim::tuple<Fields...>>::value>
+{};
+
+// Keys decomposed into fields are encoded in place, every field holds the encoding of its value.
+// The bits of all fields are concatenated for digit extraction, the first field is the most
+// significant one.
+template<class Key, bool Descending, radix_float_order Order, class Decomposer>
+class radix_key_codec
+{
+    using fields_type = decltype(std::declval<const Decomposer&>()(std::declval<Key&>()));
+
+    template<class Field>
+    using field_codec = radix_key_codec<typename std::remove_reference<Field>::type, Descending, Order>;
+
+public:
+    using bit_key_type = Key;
+
+    static constexpr unsigned int key_bits = radix_tuple_key_bits<fields_type>::value;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static bit_key_type encode(Key key)
+    {
+        auto fields = Decomposer{}(key);
+        for_each_in_tuple(fields,
+                          [](auto& field)
+                          {
+                              using field_type = typename std::remove_reference<decltype(field)>::type;
+                              field = __builtin_bit_cast(field_type,
+                                                         field_codec<field_type>::encode(field));
+                          });
+        return key;
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static Key decode(bit_key_type bit_key)
+    {
+        auto fields = Decomposer{}(bit_key);
+        for_each_in_tuple(fields,
+                          [](auto& field)
+                          {
+                              using field_type = typename std::remove_reference<decltype(field)>::type;
+                              using field_bits_type = typename field_codec<field_type>::bit_key_type;
+                              field = field_codec<field_type>::decode(
+                                  __builtin_bit_cast(field_bits_type, field));
+                          });
+        return bit_key;
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static unsigned int extract_digit(bit_key_type bit_key, unsigned int start, unsigned int radix_bits)
+    {
+        const unsigned int end   = start + radix_bits;
+        unsigned int       digit = 0;
+        // Bit offset of the current field, fields are visited from the most significant one
+        unsigned int field_end = key_bits;
+        auto         fields    = Decomposer{}(bit_key);
+        for_each_in_tuple(
+            fields,
+            [&](auto& field)
+            {
+                using field_type      = typename std::remove_reference<decltype(field)>::type;
+                using field_bits_type = typename field_codec<field_type>::bit_key_type;
+                const unsigned int field_begin = field_end - field_codec<field_type>::key_bits;
+                if(start < field_end && end > field_begin)
+                {
+                    const unsigned int begin_bit = ::rocprim::max(start, field_begin);
+                    const unsigned int end_bit   = ::rocprim::min(end, field_end);
+                    digit |= field_codec<field_type>::extract_digit(
+                                 __builtin_bit_cast(field_bits_type, field),
+                                 begin_bit - field_begin,
+                                 end_bit - begin_bit)
+                             << (begin_bit - start);
+                }
+                field_end = field_begin;
+            });
+        return digit;
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static Key get_out_of_bounds_key()
+    {
+        Key  key{};
+        auto fields = Decomposer{}(key);
+        for_each_in_tuple(fields,
+                          [](auto& field)
+                          {
+                              using field_type = typename std::remove_reference<decltype(field)>::type;
+                              using field_bits_type = typename field_codec<field_type>::bit_key_type;
+                              field = __builtin_bit_cast(field_type, field_bits_type(-1));
+                          });
+        return decode(key);
+    }
+};
+
+// Whether key a goes before key b in the order of the digits of their encodings in the bit range
+// [begin_bit, end_bit)
+template<class KeyCodec, class Key>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+bool radix_key_is_before(const Key&        a,
+                         const Key&        b,
+                         const unsigned int begin_bit = 0,
+                         const unsigned int end_bit   = KeyCodec::key_bits)
+{
+    constexpr unsigned int digit_bits = 16;
+
+    const auto a_bits = KeyCodec::encode(a);
+    const auto b_bits = KeyCodec::encode(b);
+    for(unsigned int bit = end_bit; bit > begin_bit;)
+    {
+        const unsigned int length  = ::rocprim::min(digit_bits, bit - begin_bit);
+        bit -= length;
+        const unsigned int a_digit = KeyCodec::extract_digit(a_bits, bit, length);
+        const unsigned int b_digit = KeyCodec::extract_digit(b_bits, bit, length);
+        if(a_digit != b_digit)
+        {
+            return a_digit < b_digit;
+        }
+    }
+    return false;
+}
+
+// Digits of radix selects, which find the keys of given ranks digit by digit
+constexpr unsigned int radix_select_bits = 8;
+constexpr unsigned int radix_select_size = 1u << radix_select_bits;
+
+// Bits of the key where keys that the codec treats as equal (e.g. -0.0 and +0.0) are also equal
+template<class KeyCodec, class Key>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+typename KeyCodec::bit_key_type radix_select_encode(const Key& key)
+{
+    using bit_key_type = typename KeyCodec::bit_key_type;
+
+    const bit_key_type bit_key = KeyCodec::encode(key);
+    bit_key_type       result  = 0;
+    ROCPRIM_UNROLL
+    for(unsigned int bit = 0; bit < KeyCodec::key_bits; bit += radix_select_bits)
+    {
+        const unsigned int current_radix_bits
+            = ::rocprim::min(radix_select_bits, KeyCodec::key_bits - bit);
+        const bit_key_type digit
+            = static_cast<bit_key_type>(KeyCodec::extract_digit(bit_key, bit, current_radix_bits));
+        result |= static_cast<bit_key_type>(digit << bit);
+    }
+    return result;
+}
+
 } // end namespace detail
 END_ROCPRIM_NAMESPACE
 
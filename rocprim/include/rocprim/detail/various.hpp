@@ -21,6 +21,7 @@
 #ifndef ROCPRIM_DETAIL_VARIOUS_HPP_
 #define ROCPRIM_DETAIL_VARIOUS_HPP_
 
+#include <iterator>
 #include <type_traits>
 
 #include "../config.hpp"
@@ -85,6 +86,15 @@ size_t align_size(size_t size, size_t alignment = 256)
     return ceiling_div(size, alignment) * alignment;
 }
 
+// The offsets of segments read from an OffsetIterator are kept in 32 bits if its values are
+// 32-bit integers, otherwise they are kept in 64 bits
+template<class OffsetIterator>
+using segment_offset_type_t = std::conditional_t<
+    sizeof(typename std::iterator_traits<OffsetIterator>::value_type) <= 4,
+    unsigned int,
+    size_t
+>;
+
 // TOOD: Put the block algorithms with warp size variables at device side with macro.
 // Temporary workaround
 template<class T>
@@ -212,6 +222,22 @@ bool are_iterators_equal(Iterator iter1, Iterator iter2)
     return iter1 == iter2;
 }
 
+// Canonical type of an input iterator passed to the kernels. Raw pointers are passed as pointers
+// to const, so calls with T* and const T* inputs instantiate the same kernels.
+template<class Iterator>
+ROCPRIM_HOST_DEVICE inline
+Iterator to_kernel_input_iterator(Iterator iterator)
+{
+    return iterator;
+}
+
+template<class T>
+ROCPRIM_HOST_DEVICE inline
+const T* to_kernel_input_iterator(T* pointer)
+{
+    return pointer;
+}
+
 template<class...>
 using void_t = void;
 
@@ -296,6 +322,34 @@ inline hipError_t memcpy_and_sync(
 #endif
 }
 
+/**
+ * \brief Checks if work enqueued to a stream is captured to a graph
+ *
+ * Device-level algorithms must not read results on the host while the stream is captured,
+ * they skip the optimizations which depend on such reads.
+ *
+ * \param[in] stream The stream to check
+ * \param[out] capturing Set to true if the stream is in capture mode
+ * \return hipError_t error code
+ */
+inline hipError_t is_stream_capturing(hipStream_t stream, bool& capturing)
+{
+    capturing = false;
+    // hipStreamIsCapturing is only supported on rocm 5.0 and above
+#if HIP_VERSION_MAJOR >= 5
+    hipStreamCaptureStatus status;
+    const hipError_t       result = hipStreamIsCapturing(stream, &status);
+    if(hipSuccess != result)
+    {
+        return result;
+    }
+    capturing = status != hipStreamCaptureStatusNone;
+#else
+    (void)stream;
+#endif
+    return hipSuccess;
+}
+
 #if __cpp_lib_as_const >= 201510L
 using ::std::as_const;
 #else
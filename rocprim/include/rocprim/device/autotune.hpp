@@ -0,0 +1,516 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef ROCPRIM_DEVICE_AUTOTUNE_HPP_
+#define ROCPRIM_DEVICE_AUTOTUNE_HPP_
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <typeinfo>
+#include <utility>
+
+#include "../config.hpp"
+#include "../detail/device_properties.hpp"
+#include "../detail/various.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+/// \brief The list of the configs \p autotuned chooses from.
+/// \tparam Configs - the configs of a device-level algorithm, for example \p radix_sort_config
+/// or \p default_config.
+template<class... Configs>
+struct autotune_candidates
+{};
+
+/// \brief The winning configs of \p autotuned, optionally persisted to a file.
+///
+/// \par Overview
+/// * Every entry maps a tuning key, made of the architecture of the device, the name of the
+/// algorithm, the types, the size bucket and the number of candidates, to the index of the
+/// winning candidate.
+/// * When the cache has a file, it is loaded by the constructor and saved after every new entry,
+/// so later processes use the winners without tuning.
+/// * \p instance() is the cache used by default. Its file is the path in the
+/// \p ROCPRIM_AUTOTUNE_CACHE environment variable, if it is set.
+/// * The file is a text file with one entry per line.
+class autotune_cache
+{
+public:
+    /// \brief Creates a cache which is not persisted.
+    autotune_cache() = default;
+
+    /// \brief Creates a cache persisted to a file, the entries of the file are loaded.
+    ///
+    /// \param [in] path - the path of the file. It is created when the first entry is saved.
+    explicit autotune_cache(std::string path) : path_(std::move(path))
+    {
+        (void)load();
+    }
+
+    autotune_cache(const autotune_cache&) = delete;
+    autotune_cache& operator=(const autotune_cache&) = delete;
+
+    /// \brief Returns the cache used by default.
+    static autotune_cache& instance()
+    {
+        static autotune_cache cache(get_default_path());
+        return cache;
+    }
+
+    /// \brief Loads the entries of the file, replacing the entries with the same keys.
+    ///
+    /// \returns \p true if the file is read, \p false if the cache has no file or it cannot be
+    /// opened.
+    bool load()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if(path_.empty())
+        {
+            return false;
+        }
+        std::ifstream file(path_);
+        if(!file)
+        {
+            return false;
+        }
+        std::string  key;
+        unsigned int index;
+        while(file >> key >> index)
+        {
+            entries_[key] = index;
+        }
+        return true;
+    }
+
+    /// \brief Saves all entries to the file.
+    ///
+    /// \returns \p true if the file is written, \p false if the cache has no file or it cannot
+    /// be written.
+    bool save() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return save_locked();
+    }
+
+    /// \brief Looks up the winning candidate of a key.
+    ///
+    /// \param [in] key - the tuning key.
+    /// \param [out] index - the index of the winning candidate.
+    ///
+    /// \returns \p true if the key is found.
+    bool find(const std::string& key, unsigned int& index) const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto                  it = entries_.find(key);
+        if(it == entries_.end())
+        {
+            return false;
+        }
+        index = it->second;
+        return true;
+    }
+
+    /// \brief Stores the winning candidate of a key and saves the file, if the cache has one.
+    ///
+    /// \param [in] key - the tuning key, it must not contain whitespace.
+    /// \param [in] index - the index of the winning candidate.
+    void insert(const std::string& key, const unsigned int index)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_[key] = index;
+        (void)save_locked();
+    }
+
+    /// \brief Removes all entries, the file is not changed.
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_.clear();
+    }
+
+    /// \brief Returns the number of entries.
+    size_t size() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return entries_.size();
+    }
+
+private:
+    static std::string get_default_path()
+    {
+        const char* const path = std::getenv("ROCPRIM_AUTOTUNE_CACHE");
+        return path != nullptr ? std::string(path) : std::string();
+    }
+
+    bool save_locked() const
+    {
+        if(path_.empty())
+        {
+            return false;
+        }
+        std::ofstream file(path_, std::ios::trunc);
+        for(const auto& entry : entries_)
+        {
+            file << entry.first << ' ' << entry.second << '\n';
+        }
+        return static_cast<bool>(file);
+    }
+
+    mutable std::mutex                  mutex_;
+    std::map<std::string, unsigned int> entries_;
+    std::string                         path_;
+};
+
+namespace detail
+{
+
+// Number of timed runs of every candidate, the fastest one is used
+constexpr unsigned int autotune_repetitions = 3;
+
+template<class... Ts>
+struct autotune_type_names;
+
+template<>
+struct autotune_type_names<>
+{
+    static void append(std::ostringstream&) {}
+};
+
+template<class T, class... Ts>
+struct autotune_type_names<T, Ts...>
+{
+    static void append(std::ostringstream& key)
+    {
+        key << typeid(T).name() << ',';
+        autotune_type_names<Ts...>::append(key);
+    }
+};
+
+// Sizes are bucketed by powers of two
+inline unsigned int autotune_size_bucket(size_t size)
+{
+    unsigned int bucket = 0;
+    while(size > 1)
+    {
+        size >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+template<class... Types>
+inline hipError_t make_autotune_key(const char* const  algorithm_name,
+                                    const size_t       size,
+                                    const unsigned int candidates,
+                                    std::string&       key)
+{
+    device_properties props;
+    const hipError_t  error = get_current_device_properties(props);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+    std::ostringstream stream;
+    stream << props.gcn_arch_name << ';' << algorithm_name << ';';
+    autotune_type_names<Types...>::append(stream);
+    stream << ';' << autotune_size_bucket(size) << ';' << candidates;
+    key = stream.str();
+    // Keys are whitespace separated in the file
+    for(char& c : key)
+    {
+        if(std::isspace(static_cast<unsigned char>(c)))
+        {
+            c = '_';
+        }
+    }
+    return hipSuccess;
+}
+
+template<class Candidates>
+struct autotune_dispatch;
+
+template<>
+struct autotune_dispatch<autotune_candidates<>>
+{
+    static constexpr unsigned int size = 0;
+
+    template<class Algorithm>
+    static hipError_t run(unsigned int, Algorithm&, void*, size_t&)
+    {
+        return hipErrorInvalidValue;
+    }
+
+    template<class Algorithm>
+    static hipError_t max_storage_size(Algorithm&, size_t&)
+    {
+        return hipSuccess;
+    }
+};
+
+// Calls the algorithm with the config of a runtime index
+template<class Config, class... Configs>
+struct autotune_dispatch<autotune_candidates<Config, Configs...>>
+{
+    using next_type = autotune_dispatch<autotune_candidates<Configs...>>;
+
+    static constexpr unsigned int size = 1 + sizeof...(Configs);
+
+    template<class Algorithm>
+    static hipError_t run(const unsigned int index,
+                          Algorithm&         algorithm,
+                          void* const        temporary_storage,
+                          size_t&            storage_size)
+    {
+        if(index == 0)
+        {
+            return algorithm(Config{}, temporary_storage, storage_size);
+        }
+        return next_type::run(index - 1, algorithm, temporary_storage, storage_size);
+    }
+
+    template<class Algorithm>
+    static hipError_t max_storage_size(Algorithm& algorithm, size_t& storage_size)
+    {
+        size_t           candidate_size = 0;
+        const hipError_t error          = algorithm(Config{}, nullptr, candidate_size);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        storage_size = std::max(storage_size, candidate_size);
+        return next_type::max_storage_size(algorithm, storage_size);
+    }
+};
+
+// Times all candidates, the output of the winner is written by its final run
+template<class Dispatch, class Algorithm>
+inline hipError_t autotune_candidates_impl(void* const       temporary_storage,
+                                           const size_t      storage_size,
+                                           Algorithm&        algorithm,
+                                           const hipStream_t stream,
+                                           const bool        debug_synchronous,
+                                           unsigned int&     winner)
+{
+    hipEvent_t start;
+    hipEvent_t stop;
+    hipError_t error = hipEventCreate(&start);
+    if(error != hipSuccess) return error;
+    error = hipEventCreate(&stop);
+    if(error != hipSuccess)
+    {
+        (void)hipEventDestroy(start);
+        return error;
+    }
+
+    float      best_time   = std::numeric_limits<float>::max();
+    hipError_t first_error = hipSuccess;
+    winner                 = Dispatch::size;
+    for(unsigned int index = 0; index < Dispatch::size && error == hipSuccess; index++)
+    {
+        hipError_t candidate_error = hipSuccess;
+        float      candidate_time  = std::numeric_limits<float>::max();
+        for(unsigned int i = 0; i < autotune_repetitions && candidate_error == hipSuccess; i++)
+        {
+            size_t candidate_storage_size = storage_size;
+            error = hipEventRecord(start, stream);
+            if(error != hipSuccess) break;
+            candidate_error
+                = Dispatch::run(index, algorithm, temporary_storage, candidate_storage_size);
+            error = hipEventRecord(stop, stream);
+            if(error != hipSuccess) break;
+            error = hipEventSynchronize(stop);
+            if(error != hipSuccess) break;
+            float time;
+            error = hipEventElapsedTime(&time, start, stop);
+            if(error != hipSuccess) break;
+            candidate_time = std::min(candidate_time, time);
+        }
+        if(error != hipSuccess)
+        {
+            break;
+        }
+        if(candidate_error != hipSuccess)
+        {
+            // A config which cannot be launched, for example on this architecture, is skipped
+            (void)hipGetLastError();
+            first_error = first_error == hipSuccess ? candidate_error : first_error;
+            continue;
+        }
+        if(debug_synchronous)
+        {
+            std::cout << "candidate " << index << " " << candidate_time << " ms" << '\n';
+        }
+        if(candidate_time < best_time)
+        {
+            best_time = candidate_time;
+            winner    = index;
+        }
+    }
+    (void)hipEventDestroy(start);
+    (void)hipEventDestroy(stop);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+    return winner == Dispatch::size ? first_error : hipSuccess;
+}
+
+} // end namespace detail
+
+/// \brief Runs a device-level algorithm with the fastest of several configs, tuned at runtime.
+///
+/// \par Overview
+/// * The first call for a tuning key, made of the architecture of the current device,
+/// \p algorithm_name, \p Types, the size bucket (the power of two of \p size) and the number of
+/// candidates, times every candidate config and stores the winner in \p cache. Later calls with
+/// the same key run the winner directly.
+/// * The candidates are instantiated at compile time, the tuning only chooses among them. It
+/// complements the static configs of the supported architectures, for example for other
+/// architectures or types.
+/// * While the key is tuned, the algorithm runs several times per candidate and once more with
+/// the winner, so it must produce the same output every time: the input must not be
+/// overwritten by the output.
+/// * When \p stream is being captured, a key which is not tuned yet runs the first candidate
+/// without tuning.
+/// * A candidate which returns an error while it is tuned is skipped.
+///
+/// \tparam Candidates - \p autotune_candidates of the configs.
+/// \tparam Types - the types which the performance depends on, for example the key and the
+/// value types of a sort.
+/// \tparam Algorithm - [inferred] type of the function object. The signature of the function
+/// should be equivalent to <tt>hipError_t f(Config config, void* temporary_storage,
+/// size_t& storage_size);</tt> for every config of \p Candidates, usually it is a generic lambda
+/// which calls the algorithm with <tt>decltype(config)</tt> as its \p Config.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the largest size (in bytes) required by the candidates is written
+/// to \p storage_size and function returns without running the algorithm.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] algorithm_name - the name of the algorithm in the tuning key, it must not contain
+/// whitespace.
+/// \param [in] size - the size of the problem, which selects the size bucket.
+/// \param [in] algorithm - the function object which runs the algorithm with a config.
+/// \param [in] stream - [optional] the stream the algorithm is enqueued to, the tuning is timed
+/// on it. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, the times of the candidates are printed.
+/// Default value is \p false.
+/// \param [in] cache - [optional] the cache of the winners. Default is
+/// \p autotune_cache::instance().
+///
+/// \returns \p hipSuccess (\p 0) after successful operation; otherwise the error of the
+/// algorithm or a HIP runtime error of type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// using candidates = rocprim::autotune_candidates<
+///     rocprim::default_config,
+///     rocprim::reduce_config<128, 8, rocprim::block_reduce_algorithm::default_algorithm>,
+///     rocprim::reduce_config<256, 16, rocprim::block_reduce_algorithm::default_algorithm>>;
+/// auto run = [&](auto config, void* temporary_storage, size_t& storage_size)
+/// {
+///     return rocprim::reduce<decltype(config)>(temporary_storage, storage_size,
+///                                              input, output, size, rocprim::plus<int>(),
+///                                              stream);
+/// };
+///
+/// size_t temporary_storage_size_bytes;
+/// rocprim::autotuned<candidates, int>(nullptr, temporary_storage_size_bytes, "reduce", size, run);
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // The first call tunes, later calls and later processes (with ROCPRIM_AUTOTUNE_CACHE set)
+/// // use the winner
+/// rocprim::autotuned<candidates, int>(temporary_storage_ptr, temporary_storage_size_bytes,
+///                                     "reduce", size, run, stream);
+/// \endcode
+/// \endparblock
+template<class Candidates, class... Types, class Algorithm>
+inline hipError_t autotuned(void* const       temporary_storage,
+                            size_t&           storage_size,
+                            const char* const algorithm_name,
+                            const size_t      size,
+                            Algorithm&&       algorithm,
+                            const hipStream_t stream            = 0,
+                            const bool        debug_synchronous = false,
+                            autotune_cache&   cache             = autotune_cache::instance())
+{
+    using dispatch_type = detail::autotune_dispatch<Candidates>;
+    static_assert(dispatch_type::size > 0, "Candidates must contain at least one config.");
+
+    if(temporary_storage == nullptr)
+    {
+        storage_size = 0;
+        return dispatch_type::max_storage_size(algorithm, storage_size);
+    }
+
+    std::string key;
+    hipError_t  error
+        = detail::make_autotune_key<Types...>(algorithm_name, size, dispatch_type::size, key);
+    if(error != hipSuccess) return error;
+
+    unsigned int index;
+    if(cache.find(key, index) && index < dispatch_type::size)
+    {
+        return dispatch_type::run(index, algorithm, temporary_storage, storage_size);
+    }
+
+    bool capturing;
+    error = detail::is_stream_capturing(stream, capturing);
+    if(error != hipSuccess) return error;
+    if(capturing)
+    {
+        return dispatch_type::run(0, algorithm, temporary_storage, storage_size);
+    }
+
+    error = detail::autotune_candidates_impl<dispatch_type>(temporary_storage,
+                                                           storage_size,
+                                                           algorithm,
+                                                           stream,
+                                                           debug_synchronous,
+                                                           index);
+    if(error != hipSuccess) return error;
+    if(debug_synchronous)
+    {
+        std::cout << "autotuned " << key << " " << index << '\n';
+    }
+    cache.insert(key, index);
+    return dispatch_type::run(index, algorithm, temporary_storage, storage_size);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_AUTOTUNE_HPP_
@@ -0,0 +1,523 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_CACHING_ALLOCATOR_HPP_
+#define ROCPRIM_DEVICE_CACHING_ALLOCATOR_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+
+// hipMallocAsync and the memory pools are available since ROCm 5.2
+#if HIP_VERSION_MAJOR > 5 || (HIP_VERSION_MAJOR == 5 && HIP_VERSION_MINOR >= 2)
+    #define ROCPRIM_DETAIL_HAS_MALLOC_ASYNC 1
+#else
+    #define ROCPRIM_DETAIL_HAS_MALLOC_ASYNC 0
+#endif
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+/// \brief The way \p caching_allocator gets memory from the device.
+enum class caching_allocator_backend
+{
+    /// \brief Memory is allocated with \p hipMalloc and released blocks are cached by the
+    /// allocator in bins of sizes.
+    malloc,
+    /// \brief Memory is allocated and released with \p hipMallocAsync and \p hipFreeAsync
+    /// on the stream of the allocation, the memory pool of the device caches it. The release
+    /// threshold of the pool is raised to the maximum number of cached bytes. Allocations
+    /// return \p hipErrorNotSupported if HIP is older than 5.2.
+    malloc_async
+};
+
+/// \brief A thread-safe allocator of device memory which caches released blocks for reuse.
+///
+/// \par Overview
+/// * It is intended for temporary storage of device-level algorithms, see
+/// \p with_temporary_storage(), which replaces \p hipMalloc and \p hipFree around every call.
+/// * With the \p malloc backend, requested sizes are rounded up to size classes (bins)
+/// <tt>bin_growth^min_bin, bin_growth^(min_bin + 1), ..., bin_growth^max_bin</tt> bytes.
+/// Larger blocks are not cached, they are allocated and freed on every request.
+/// * Blocks are associated with the stream of their allocation. A released block is reused
+/// immediately by allocations on the same stream, as the work using it was enqueued before.
+/// For other streams it is reused only after the work enqueued before its release has
+/// completed, which is tracked with an event recorded at release.
+/// * No more than \p max_cached_bytes bytes are kept cached, blocks released above the limit
+/// are freed. Cached blocks are freed by \p free_all_cached() and by the destructor.
+/// * When \p hipMalloc fails, the cached blocks of the device are freed and the allocation is
+/// retried.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// rocprim::caching_allocator allocator;
+///
+/// // The temporary storage is taken from the cache and returned to it after the call
+/// hipError_t error = rocprim::with_temporary_storage(
+///     allocator, stream,
+///     [&](void* temporary_storage, size_t& storage_size)
+///     {
+///         return rocprim::reduce(temporary_storage, storage_size,
+///                                input, output, size, rocprim::plus<int>(), stream);
+///     });
+/// \endcode
+/// \endparblock
+class caching_allocator
+{
+public:
+    /// \brief Default growth factor of the bins.
+    static constexpr unsigned int default_bin_growth = 8;
+    /// \brief Default smallest bin, 512 bytes with the default growth.
+    static constexpr unsigned int default_min_bin = 3;
+    /// \brief Default largest bin, 2 MiB with the default growth.
+    static constexpr unsigned int default_max_bin = 7;
+    /// \brief Default limit of cached bytes.
+    static constexpr size_t default_max_cached_bytes = size_t(64) << 20;
+
+    /// \brief Creates an allocator.
+    ///
+    /// \param [in] bin_growth - growth factor of the sizes of the bins, at least 2.
+    /// \param [in] min_bin - the smallest bin.
+    /// \param [in] max_bin - the largest bin, not less than \p min_bin.
+    /// \param [in] max_cached_bytes - the limit of the total size of cached blocks of all
+    /// devices.
+    /// \param [in] backend - the way memory is allocated, see \p caching_allocator_backend.
+    explicit caching_allocator(unsigned int              bin_growth       = default_bin_growth,
+                               unsigned int              min_bin          = default_min_bin,
+                               unsigned int              max_bin          = default_max_bin,
+                               size_t                    max_cached_bytes = default_max_cached_bytes,
+                               caching_allocator_backend backend = caching_allocator_backend::malloc)
+        : backend_(backend)
+        , bin_growth_(bin_growth < 2 ? 2 : bin_growth)
+        , min_bin_(min_bin)
+        , max_bin_(max_bin < min_bin ? min_bin : max_bin)
+        , min_bin_bytes_(power(bin_growth_, min_bin_))
+        , max_bin_bytes_(power(bin_growth_, max_bin_))
+        , max_cached_bytes_(max_cached_bytes)
+    {}
+
+    caching_allocator(const caching_allocator&) = delete;
+    caching_allocator& operator=(const caching_allocator&) = delete;
+
+    /// \brief Frees all cached blocks. Blocks that were not released are not freed.
+    ~caching_allocator()
+    {
+        free_all_cached();
+    }
+
+    /// \brief Allocates a block of at least \p bytes bytes on the current device, which is used
+    /// by work enqueued to \p stream.
+    ///
+    /// \param [out] ptr - the pointer to the block.
+    /// \param [in] bytes - the required size of the block.
+    /// \param [in] stream - [optional] the stream the block is used on. Default is \p 0
+    /// (default stream).
+    ///
+    /// \returns \p hipSuccess (\p 0) after successful allocation, otherwise the HIP runtime
+    /// error of the failed operation.
+    hipError_t allocate(void** ptr, size_t bytes, hipStream_t stream = 0)
+    {
+        *ptr = nullptr;
+        int              device;
+        hipError_t error = hipGetDevice(&device);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+
+        if(backend_ == caching_allocator_backend::malloc_async)
+        {
+            return allocate_async(ptr, bytes, device, stream);
+        }
+
+        block b;
+        b.device = device;
+        b.stream = stream;
+        b.cached = bytes <= max_bin_bytes_;
+        b.bytes  = b.cached ? bin_bytes(bytes)
+                            : ::rocprim::detail::align_size(
+                                bytes,
+                                ::rocprim::detail::temp_storage::default_alignment);
+
+        if(b.cached && reuse_cached_block(b))
+        {
+            *ptr = b.ptr;
+            return hipSuccess;
+        }
+
+        error = hipMalloc(&b.ptr, b.bytes);
+        if(error == hipErrorOutOfMemory)
+        {
+            // Return the cached memory of the device and try again
+            (void)hipGetLastError();
+            error = free_cached(device);
+            if(error != hipSuccess)
+            {
+                return error;
+            }
+            error = hipMalloc(&b.ptr, b.bytes);
+        }
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        error = hipEventCreateWithFlags(&b.ready_event, hipEventDisableTiming);
+        if(error != hipSuccess)
+        {
+            (void)hipFree(b.ptr);
+            return error;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        live_blocks_.emplace(b.ptr, b);
+        *ptr = b.ptr;
+        return hipSuccess;
+    }
+
+    /// \brief Releases a block allocated by \p allocate(). The block can be released right after
+    /// the work using it is enqueued, it is reused by other streams only after that work
+    /// completes.
+    ///
+    /// \param [in] ptr - the pointer to the block.
+    ///
+    /// \returns \p hipSuccess (\p 0) after successful release, \p hipErrorInvalidValue if
+    /// \p ptr was not allocated by this allocator, otherwise the HIP runtime error of the failed
+    /// operation.
+    hipError_t deallocate(void* ptr)
+    {
+        if(ptr == nullptr)
+        {
+            return hipSuccess;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        const auto it = live_blocks_.find(ptr);
+        if(it == live_blocks_.end())
+        {
+            return hipErrorInvalidValue;
+        }
+        block b = it->second;
+        live_blocks_.erase(it);
+
+        if(backend_ == caching_allocator_backend::malloc_async)
+        {
+            lock.unlock();
+#if ROCPRIM_DETAIL_HAS_MALLOC_ASYNC
+            return hipFreeAsync(b.ptr, b.stream);
+#else
+            return hipErrorNotSupported;
+#endif
+        }
+
+        if(b.cached && cached_bytes_ + b.bytes <= max_cached_bytes_)
+        {
+            const hipError_t error = on_device(b.device,
+                                               [&]()
+                                               { return hipEventRecord(b.ready_event, b.stream); });
+            if(error == hipSuccess)
+            {
+                cached_bytes_ += b.bytes;
+                cached_blocks_.push_back(b);
+                return hipSuccess;
+            }
+        }
+        lock.unlock();
+        return free_block(b);
+    }
+
+    /// \brief Frees all cached blocks of all devices.
+    ///
+    /// \returns \p hipSuccess (\p 0) after successful operation, otherwise the HIP runtime
+    /// error of the first failed operation.
+    hipError_t free_all_cached()
+    {
+        std::vector<block> blocks;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            blocks.swap(cached_blocks_);
+            cached_bytes_ = 0;
+        }
+        hipError_t result = hipSuccess;
+        for(const block& b : blocks)
+        {
+            const hipError_t error = free_block(b);
+            result = result == hipSuccess ? error : result;
+        }
+        return result;
+    }
+
+    /// \brief Returns the total size of the cached blocks in bytes.
+    size_t cached_bytes()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return cached_bytes_;
+    }
+
+private:
+    struct block
+    {
+        void*       ptr         = nullptr;
+        size_t      bytes       = 0;
+        int         device      = 0;
+        hipStream_t stream      = 0;
+        hipEvent_t  ready_event = nullptr;
+        bool        cached      = false;
+    };
+
+    static size_t power(size_t base, unsigned int exponent)
+    {
+        size_t result = 1;
+        for(unsigned int i = 0; i < exponent; i++)
+        {
+            result *= base;
+        }
+        return result;
+    }
+
+    size_t bin_bytes(size_t bytes) const
+    {
+        size_t result = min_bin_bytes_;
+        while(result < bytes)
+        {
+            result *= bin_growth_;
+        }
+        return result;
+    }
+
+    // Runs a function with the given device set as the current one
+    template<class Function>
+    static hipError_t on_device(int device, Function function)
+    {
+        int        current;
+        hipError_t error = hipGetDevice(&current);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        if(current != device && (error = hipSetDevice(device)) != hipSuccess)
+        {
+            return error;
+        }
+        error = function();
+        if(current != device)
+        {
+            const hipError_t restore_error = hipSetDevice(current);
+            error = error == hipSuccess ? restore_error : error;
+        }
+        return error;
+    }
+
+    // Takes a cached block of the same device and size, a block of the same stream is preferred
+    // as it can be reused without waiting
+    bool reuse_cached_block(block& b)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto found = cached_blocks_.end();
+        for(auto it = cached_blocks_.begin(); it != cached_blocks_.end(); ++it)
+        {
+            if(it->device != b.device || it->bytes != b.bytes)
+            {
+                continue;
+            }
+            if(it->stream == b.stream)
+            {
+                found = it;
+                break;
+            }
+            if(found == cached_blocks_.end() && hipEventQuery(it->ready_event) == hipSuccess)
+            {
+                found = it;
+            }
+        }
+        if(found == cached_blocks_.end())
+        {
+            return false;
+        }
+        b.ptr         = found->ptr;
+        b.ready_event = found->ready_event;
+        cached_bytes_ -= found->bytes;
+        *found = cached_blocks_.back();
+        cached_blocks_.pop_back();
+        live_blocks_.emplace(b.ptr, b);
+        return true;
+    }
+
+    hipError_t free_block(const block& b)
+    {
+        return on_device(b.device,
+                         [&]()
+                         {
+                             hipError_t error = hipFree(b.ptr);
+                             const hipError_t event_error = hipEventDestroy(b.ready_event);
+                             return error == hipSuccess ? event_error : error;
+                         });
+    }
+
+    hipError_t free_cached(int device)
+    {
+        std::vector<block> blocks;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for(size_t i = 0; i < cached_blocks_.size();)
+            {
+                if(cached_blocks_[i].device == device)
+                {
+                    cached_bytes_ -= cached_blocks_[i].bytes;
+                    blocks.push_back(cached_blocks_[i]);
+                    cached_blocks_[i] = cached_blocks_.back();
+                    cached_blocks_.pop_back();
+                }
+                else
+                {
+                    i++;
+                }
+            }
+        }
+        hipError_t result = hipSuccess;
+        for(const block& b : blocks)
+        {
+            const hipError_t error = free_block(b);
+            result = result == hipSuccess ? error : result;
+        }
+        return result;
+    }
+
+    hipError_t allocate_async(void** ptr, size_t bytes, int device, hipStream_t stream)
+    {
+#if ROCPRIM_DETAIL_HAS_MALLOC_ASYNC
+        hipError_t error = hipSuccess;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if(!pool_configured_)
+            {
+                // Keep up to max_cached_bytes in the pool instead of returning the memory to
+                // the device at every synchronization
+                hipMemPool_t pool;
+                error = hipDeviceGetDefaultMemPool(&pool, device);
+                if(error == hipSuccess)
+                {
+                    uint64_t threshold = max_cached_bytes_;
+                    error = hipMemPoolSetAttribute(pool, hipMemPoolAttrReleaseThreshold, &threshold);
+                }
+                if(error != hipSuccess)
+                {
+                    return error;
+                }
+                pool_configured_ = true;
+            }
+        }
+        error = hipMallocAsync(ptr, bytes, stream);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        block b;
+        b.ptr    = *ptr;
+        b.bytes  = bytes;
+        b.device = device;
+        b.stream = stream;
+        std::lock_guard<std::mutex> lock(mutex_);
+        live_blocks_.emplace(b.ptr, b);
+        return hipSuccess;
+#else
+        (void)ptr;
+        (void)bytes;
+        (void)device;
+        (void)stream;
+        return hipErrorNotSupported;
+#endif
+    }
+
+    const caching_allocator_backend backend_;
+    const size_t                    bin_growth_;
+    const unsigned int              min_bin_;
+    const unsigned int              max_bin_;
+    const size_t                    min_bin_bytes_;
+    const size_t                    max_bin_bytes_;
+    const size_t                    max_cached_bytes_;
+
+    std::mutex                            mutex_;
+    size_t                                cached_bytes_ = 0;
+    std::vector<block>                    cached_blocks_;
+    std::unordered_map<void*, block>      live_blocks_;
+    bool                                  pool_configured_ = false;
+};
+
+/// \brief Runs a device-level algorithm with temporary storage taken from an allocator.
+///
+/// The algorithm is called twice like with a manual allocation: first with \p nullptr
+/// temporary storage to query the required size, then with a block of that size allocated by
+/// \p allocator for \p stream. The block is released right after the second call, so with
+/// \p caching_allocator it is reused by the following algorithms enqueued to the stream.
+///
+/// \tparam Allocator - [inferred] type of the allocator. It must have the member functions
+/// <tt>hipError_t allocate(void** ptr, size_t bytes, hipStream_t stream)</tt> and
+/// <tt>hipError_t deallocate(void* ptr)</tt>, like \p caching_allocator.
+/// \tparam Algorithm - [inferred] type of the function object that runs the algorithm. The
+/// signature of the function should be equivalent to the following:
+/// <tt>hipError_t f(void* temporary_storage, size_t& storage_size);</tt>, it is called with
+/// the arguments it should pass to the device-level algorithm.
+///
+/// \param [in] allocator - the allocator of the temporary storage.
+/// \param [in] stream - the stream the algorithm is enqueued to.
+/// \param [in] algorithm - the function object that calls the device-level algorithm.
+///
+/// \returns \p hipSuccess (\p 0) after a successful run, otherwise the error returned by the
+/// algorithm or the allocator.
+template<class Allocator, class Algorithm>
+inline hipError_t with_temporary_storage(Allocator& allocator,
+                                         const hipStream_t stream,
+                                         Algorithm&& algorithm)
+{
+    size_t     storage_size = 0;
+    hipError_t error        = algorithm(static_cast<void*>(nullptr), storage_size);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    void* temporary_storage;
+    error = allocator.allocate(&temporary_storage, storage_size, stream);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    error = algorithm(temporary_storage, storage_size);
+    const hipError_t deallocate_error = allocator.deallocate(temporary_storage);
+    return error == hipSuccess ? deallocate_error : error;
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_CACHING_ALLOCATOR_HPP_
@@ -0,0 +1,128 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_CALL_INFO_HPP_
+#define ROCPRIM_DEVICE_CALL_INFO_HPP_
+
+#include <cstddef>
+
+#include "../config.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+/// \brief The internal path chosen by the last call of a device-level algorithm on the calling
+/// thread.
+///
+/// \par Overview
+/// * \p radix_sort_keys and \p radix_sort_pairs, \p histogram_even, \p histogram_range and
+/// their multi-channel variants, the scans, and \p partition, \p select and \p unique store
+/// the decisions they make to a thread-local \p device_call_info, which is returned by
+/// \p last_call_info(). Recording it costs a few stores per call.
+/// * The information is stored after all work of the call has been enqueued and only for calls
+/// which do not query the size of the temporary storage and do not fail. Algorithms which call
+/// other algorithms, for example the histogram which sorts the samples, overwrite the
+/// information of the inner calls.
+/// * The numbers of bytes are estimates of the traffic of the passes over the inputs, the
+/// outputs and the intermediate buffers. Small auxiliary arrays, like look-back states and
+/// digit counts, are not included.
+struct device_call_info
+{
+    /// The name of the algorithm, for example \p "radix_sort", \p nullptr if no algorithm
+    /// recorded information since the last \p reset_last_call_info().
+    const char* algorithm = nullptr;
+    /// The internal path, for example \p "onesweep" or \p "shared".
+    const char* path = nullptr;
+    /// The number of passes over the data, for example the number of digit passes of the
+    /// radix sort after skipping uniform digits.
+    unsigned int passes = 0;
+    /// \p true if the decoupled look-back of the call waits with sleeps, which is required by
+    /// some devices.
+    bool lookback_sleep = false;
+    /// The estimated number of bytes read from global memory.
+    size_t bytes_read = 0;
+    /// The estimated number of bytes written to global memory.
+    size_t bytes_written = 0;
+};
+
+/// @}
+// end of group devicemodule
+
+namespace detail
+{
+
+inline device_call_info& get_call_info()
+{
+    thread_local device_call_info info;
+    return info;
+}
+
+inline void record_call_info(const char*  algorithm,
+                             const char*  path,
+                             unsigned int passes,
+                             bool         lookback_sleep,
+                             size_t       bytes_read,
+                             size_t       bytes_written)
+{
+    device_call_info& info = get_call_info();
+    info.algorithm         = algorithm;
+    info.path              = path;
+    info.passes            = passes;
+    info.lookback_sleep    = lookback_sleep;
+    info.bytes_read        = bytes_read;
+    info.bytes_written     = bytes_written;
+}
+
+} // end namespace detail
+
+/// \addtogroup devicemodule
+/// @{
+
+/// \brief Returns the information recorded by the last call of a device-level algorithm on the
+/// calling thread, see \p device_call_info.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// rocprim::radix_sort_keys(temporary_storage_ptr, temporary_storage_size_bytes,
+///                          input, output, size);
+/// const rocprim::device_call_info info = rocprim::last_call_info();
+/// // info.path: "onesweep", info.passes: 4
+/// \endcode
+/// \endparblock
+inline device_call_info last_call_info()
+{
+    return detail::get_call_info();
+}
+
+/// \brief Clears the information returned by \p last_call_info() on the calling thread.
+inline void reset_last_call_info()
+{
+    detail::get_call_info() = device_call_info();
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_CALL_INFO_HPP_
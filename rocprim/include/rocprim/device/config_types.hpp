@@ -27,10 +27,16 @@
 #include <type_traits>
 
 #include <cassert>
+#include <cstddef>
 
 #include "../config.hpp"
 #include "../intrinsics/thread.hpp"
+#include "../detail/device_properties.hpp"
 #include "../detail/various.hpp"
+#include "../thread/thread_load.hpp"
+#include "../thread/thread_store.hpp"
+
+#include "grid_limit.hpp"
 
 /// \addtogroup primitivesmodule_deviceconfigs
 /// @{
@@ -59,6 +65,75 @@ struct kernel_config
     static constexpr unsigned int size_limit = SizeLimit;
 };
 
+/// \brief A bucket of \p size_bucketed_config: inputs of at most \p MaxSize items use \p Config.
+///
+/// \tparam MaxSize - the largest input size of the bucket, in items.
+/// \tparam Config - the configuration of the device-level operation for the bucket, for example
+/// \p radix_sort_config or \p default_config.
+template<size_t MaxSize, class Config>
+struct size_bucket
+{
+    /// \brief The largest input size of the bucket.
+    static constexpr size_t max_size = MaxSize;
+    /// \brief The configuration used for the inputs of the bucket.
+    using config = Config;
+};
+
+/// \brief Configuration of a device-level operation which depends on the size of the input.
+///
+/// \par Overview
+/// * Small inputs are processed faster with small blocks and few items per thread, which
+/// fill all compute units, while large inputs prefer large tiles. \p size_bucketed_config is
+/// a table of configurations indexed by the input size, resolved on the host when the
+/// operation is called.
+/// * The buckets are tested in order and the first bucket whose \p max_size is not smaller
+/// than the size is used. The last bucket is used for all larger inputs, regardless of its
+/// \p max_size.
+/// * The temporary storage size must be queried with the same size as the operation is
+/// called with, so both calls resolve the same bucket.
+/// * Supported by \p reduce and \p radix_sort_keys / \p radix_sort_pairs and the algorithms
+/// based on them.
+///
+/// \tparam Buckets - \p size_bucket types sorted by \p max_size.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// using config = rocprim::size_bucketed_config<
+///     rocprim::size_bucket<
+///         (1 << 16),
+///         rocprim::reduce_config<64, 2, rocprim::block_reduce_algorithm::default_algorithm>>,
+///     rocprim::size_bucket<
+///         (1 << 22),
+///         rocprim::reduce_config<256, 8, rocprim::block_reduce_algorithm::default_algorithm>>,
+///     rocprim::size_bucket<std::numeric_limits<size_t>::max(), rocprim::default_config>>;
+/// rocprim::reduce<config>(temporary_storage_ptr, temporary_storage_size_bytes,
+///                         input, output, size, rocprim::plus<int>());
+/// \endcode
+/// \endparblock
+template<class... Buckets>
+struct size_bucketed_config
+{
+    static_assert(sizeof...(Buckets) > 0, "size_bucketed_config requires at least one bucket");
+};
+
+/// \brief Policy of the decoupled look-back of scan-based device-level algorithms for waiting while
+/// the prefix of a preceding block is not available yet.
+enum class lookback_backoff
+{
+    /// \brief \p bounded_sleep on the architectures where sleeping is faster (gfx90a), \p spin on
+    /// the others.
+    automatic,
+    /// \brief The prefix is polled again without waiting.
+    spin,
+    /// \brief The wavefront sleeps between the polls, the sleep doubles up to 64 sleep intervals.
+    /// It backs off quickly when many kernels running concurrently wait for their prefixes.
+    exponential_sleep,
+    /// \brief The wavefront sleeps between the polls, the sleep grows by one sleep interval up to
+    /// 32 intervals.
+    bounded_sleep
+};
+
 namespace detail
 {
 
@@ -121,6 +196,177 @@ using default_or_custom_config =
         Config
     >::type;
 
+template<class Config>
+struct size_bucket_dispatch
+{
+    template<class Function>
+    static auto run(size_t /*size*/, Function&& function) -> decltype(function(Config{}))
+    {
+        return function(Config{});
+    }
+};
+
+// The last bucket also covers all larger inputs
+template<class Bucket>
+struct size_bucket_dispatch<size_bucketed_config<Bucket>>
+{
+    template<class Function>
+    static auto run(size_t /*size*/, Function&& function)
+        -> decltype(function(typename Bucket::config{}))
+    {
+        return function(typename Bucket::config{});
+    }
+};
+
+template<class Bucket, class... Buckets>
+struct size_bucket_dispatch<size_bucketed_config<Bucket, Buckets...>>
+{
+    template<class Function>
+    static auto run(size_t size, Function&& function)
+        -> decltype(function(typename Bucket::config{}))
+    {
+        if(size <= Bucket::max_size)
+        {
+            return function(typename Bucket::config{});
+        }
+        return size_bucket_dispatch<size_bucketed_config<Buckets...>>::run(size, function);
+    }
+};
+
+template<class Config>
+struct is_size_bucketed_config : std::false_type
+{};
+
+template<class... Buckets>
+struct is_size_bucketed_config<size_bucketed_config<Buckets...>> : std::true_type
+{};
+
+// Calls function with a value of the config of the bucket of size, or with Config itself if
+// it is not a size_bucketed_config. All buckets must produce the same result type.
+template<class Config, class Function>
+auto dispatch_size_bucket(size_t size, Function&& function)
+    -> decltype(size_bucket_dispatch<Config>::run(size, function))
+{
+    return size_bucket_dispatch<Config>::run(size, function);
+}
+
+// Calls function(config, first_size, last_size) for every bucket of Config that covers sizes
+// of at most max_size, with the range of sizes of the bucket clipped to [0, max_size]. Config
+// which is not a size_bucketed_config covers all sizes.
+template<class Config>
+struct size_bucket_for_each
+{
+    template<class Function>
+    static void run(size_t first_size, size_t max_size, Function&& function)
+    {
+        function(Config{}, first_size, max_size);
+    }
+};
+
+template<class Bucket>
+struct size_bucket_for_each<size_bucketed_config<Bucket>>
+{
+    template<class Function>
+    static void run(size_t first_size, size_t max_size, Function&& function)
+    {
+        function(typename Bucket::config{}, first_size, max_size);
+    }
+};
+
+template<class Bucket, class... Buckets>
+struct size_bucket_for_each<size_bucketed_config<Bucket, Buckets...>>
+{
+    template<class Function>
+    static void run(size_t first_size, size_t max_size, Function&& function)
+    {
+        if(first_size > Bucket::max_size)
+        {
+            size_bucket_for_each<size_bucketed_config<Buckets...>>::run(first_size,
+                                                                        max_size,
+                                                                        function);
+            return;
+        }
+        function(typename Bucket::config{},
+                 first_size,
+                 std::min<size_t>(Bucket::max_size, max_size));
+        if(max_size > Bucket::max_size)
+        {
+            size_bucket_for_each<size_bucketed_config<Buckets...>>::run(
+                static_cast<size_t>(Bucket::max_size) + 1,
+                max_size,
+                function);
+        }
+    }
+};
+
+// Cache modifiers of the loads of the inputs and the stores of the outputs of a device-level
+// algorithm. Configurations without the load_cache_modifier or store_cache_modifier members
+// use the default modifiers.
+template<class Config, class = void>
+struct config_load_cache_modifier
+    : std::integral_constant<cache_load_modifier, load_default>
+{};
+
+template<class Config>
+struct config_load_cache_modifier<Config, void_t<decltype(Config::load_cache_modifier)>>
+    : std::integral_constant<cache_load_modifier, Config::load_cache_modifier>
+{};
+
+template<class Config, class = void>
+struct config_store_cache_modifier
+    : std::integral_constant<cache_store_modifier, store_default>
+{};
+
+template<class Config>
+struct config_store_cache_modifier<Config, void_t<decltype(Config::store_cache_modifier)>>
+    : std::integral_constant<cache_store_modifier, Config::store_cache_modifier>
+{};
+
+// Maximum number of blocks per compute unit of the grid of a device-level algorithm, 0 if the
+// grid is not limited. Configurations without the blocks_per_cu member do not limit the grid.
+template<class Config, class = void>
+struct config_blocks_per_cu : std::integral_constant<unsigned int, 0>
+{};
+
+template<class Config>
+struct config_blocks_per_cu<Config, void_t<decltype(Config::blocks_per_cu)>>
+    : std::integral_constant<unsigned int, Config::blocks_per_cu>
+{};
+
+// Look-back backoff policy of a device-level algorithm. Configurations without the backoff
+// member use lookback_backoff::automatic.
+template<class Config, class = void>
+struct config_lookback_backoff
+    : std::integral_constant<lookback_backoff, lookback_backoff::automatic>
+{};
+
+template<class Config>
+struct config_lookback_backoff<Config, void_t<decltype(Config::backoff)>>
+    : std::integral_constant<lookback_backoff, Config::backoff>
+{};
+
+// Limits max_grid_size to blocks_per_cu blocks per compute unit of the current device and to
+// the limit set by scoped_grid_limit, the blocks of such a grid process tiles until all of them
+// are processed. The grid is not changed if blocks_per_cu is 0 and no limit is set.
+template<class Size>
+inline hipError_t limit_grid_size(Size& max_grid_size, const unsigned int blocks_per_cu)
+{
+    max_grid_size = apply_grid_limit(max_grid_size);
+    if(blocks_per_cu == 0)
+    {
+        return hipSuccess;
+    }
+    device_properties props;
+    const hipError_t  result = get_current_device_properties(props);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const size_t limit = std::max<size_t>(size_t(props.compute_units) * blocks_per_cu, 1);
+    max_grid_size      = static_cast<Size>(std::min<size_t>(max_grid_size, limit));
+    return hipSuccess;
+}
+
 enum class target_arch : unsigned int
 {
     // This must be zero, to initialize the device -> architecture cache
@@ -130,7 +376,11 @@ enum class target_arch : unsigned int
     gfx906  = 906,
     gfx908  = 908,
     gfx90a  = 910,
+    gfx940  = 940,
+    gfx941  = 941,
+    gfx942  = 942,
     gfx1030 = 1030,
+    gfx1100 = 1100,
     unknown = std::numeric_limits<unsigned int>::max(),
 };
 
@@ -161,15 +411,27 @@ constexpr bool prefix_equals(const char* lhs, const char* rhs, std::size_t n)
 
 constexpr target_arch get_target_arch_from_name(const char* const arch_name, const std::size_t n)
 {
-    constexpr const char* target_names[]
-        = {"gfx803", "gfx900", "gfx906", "gfx908", "gfx90a", "gfx1030"};
+    constexpr const char* target_names[] = {"gfx803",
+                                            "gfx900",
+                                            "gfx906",
+                                            "gfx908",
+                                            "gfx90a",
+                                            "gfx940",
+                                            "gfx941",
+                                            "gfx942",
+                                            "gfx1030",
+                                            "gfx1100"};
     constexpr target_arch target_architectures[] = {
         target_arch::gfx803,
         target_arch::gfx900,
         target_arch::gfx906,
         target_arch::gfx908,
         target_arch::gfx90a,
+        target_arch::gfx940,
+        target_arch::gfx941,
+        target_arch::gfx942,
         target_arch::gfx1030,
+        target_arch::gfx1100,
     };
     static_assert(sizeof(target_names) / sizeof(target_names[0])
                       == sizeof(target_architectures) / sizeof(target_architectures[0]),
@@ -224,8 +486,16 @@ auto dispatch_target_arch(const target_arch target_arch)
             return Config::template architecture_config<target_arch::gfx908>::params;
         case target_arch::gfx90a:
             return Config::template architecture_config<target_arch::gfx90a>::params;
+        case target_arch::gfx940:
+            return Config::template architecture_config<target_arch::gfx940>::params;
+        case target_arch::gfx941:
+            return Config::template architecture_config<target_arch::gfx941>::params;
+        case target_arch::gfx942:
+            return Config::template architecture_config<target_arch::gfx942>::params;
         case target_arch::gfx1030:
             return Config::template architecture_config<target_arch::gfx1030>::params;
+        case target_arch::gfx1100:
+            return Config::template architecture_config<target_arch::gfx1100>::params;
         case target_arch::invalid:
             assert(false && "Invalid target architecture selected at runtime.");
     }
@@ -249,10 +519,17 @@ inline target_arch parse_gcn_arch(const char* arch_name)
     return get_target_arch_from_name(arch_name, arch_end - arch_name);
 }
 
-inline hipError_t get_device_arch(int device_id, target_arch& arch)
+static constexpr unsigned int device_arch_cache_size = device_properties_cache::max_devices;
+
+inline std::atomic<target_arch>* get_device_arch_cache()
 {
-    static constexpr unsigned int   device_arch_cache_size             = 512;
     static std::atomic<target_arch> arch_cache[device_arch_cache_size] = {};
+    return arch_cache;
+}
+
+inline hipError_t get_device_arch(int device_id, target_arch& arch)
+{
+    std::atomic<target_arch>* const arch_cache = get_device_arch_cache();
 
     assert(device_id >= 0);
     if(static_cast<unsigned int>(device_id) >= device_arch_cache_size)
@@ -267,14 +544,14 @@ inline hipError_t get_device_arch(int device_id, target_arch& arch)
         return hipSuccess;
     }
 
-    hipDeviceProp_t  device_props;
-    const hipError_t result = hipGetDeviceProperties(&device_props, device_id);
+    device_properties props;
+    const hipError_t  result = get_device_properties(device_id, props);
     if(result != hipSuccess)
     {
         return result;
     }
 
-    arch = parse_gcn_arch(device_props.gcnArchName);
+    arch = parse_gcn_arch(props.gcn_arch_name);
     arch_cache[device_id].exchange(arch, std::memory_order_relaxed);
 
     return hipSuccess;
@@ -327,6 +604,22 @@ inline hipError_t host_target_arch(const hipStream_t stream, target_arch& arch)
 
 } // end namespace detail
 
+/// \brief Invalidates the cached properties of all devices.
+///
+/// Device-level algorithms query the properties of a device (architecture, warp size,
+/// number of compute units) once and reuse them in all subsequent calls. This function
+/// forces the properties to be queried again, it should be called if the devices visible
+/// to the process have changed. This function is thread-safe.
+inline void invalidate_device_properties_cache()
+{
+    detail::device_properties_cache::instance().invalidate();
+    std::atomic<detail::target_arch>* const arch_cache = detail::get_device_arch_cache();
+    for(unsigned int i = 0; i < detail::device_arch_cache_size; ++i)
+    {
+        arch_cache[i].store(detail::target_arch::invalid, std::memory_order_relaxed);
+    }
+}
+
 END_ROCPRIM_NAMESPACE
 
 /// @}
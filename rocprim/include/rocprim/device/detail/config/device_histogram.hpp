@@ -0,0 +1,98 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_CONFIG_DEVICE_HISTOGRAM_HPP_
+#define ROCPRIM_DEVICE_DETAIL_CONFIG_DEVICE_HISTOGRAM_HPP_
+
+#include <type_traits>
+
+#include "../../../config.hpp"
+#include "../../../detail/various.hpp"
+
+#include "../../config_types.hpp"
+#include "../../device_histogram_config.hpp"
+#include "../device_config_helper.hpp"
+
+/* DO NOT EDIT THIS FILE
+ * This 'config' file will be overwritten automatically in the near future,
+ * so most likely you want to edit rocprim/device/detail/device_(algo).hpp
+ */
+
+/// \addtogroup primitivesmodule_deviceconfigs
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+template<class Sample, unsigned int Channels, unsigned int ActiveChannels>
+struct histogram_config_803
+{
+    using type = histogram_config<
+        kernel_config<256, histogram_items_per_thread<Sample, Channels, 10u>::value>>;
+};
+
+template<class Sample, unsigned int Channels, unsigned int ActiveChannels>
+struct histogram_config_900
+{
+    using type = histogram_config<
+        kernel_config<256, histogram_items_per_thread<Sample, Channels, 8u>::value>>;
+};
+
+// TODO: We need to update these parameters
+template<class Sample, unsigned int Channels, unsigned int ActiveChannels>
+struct histogram_config_90a
+{
+    using type = histogram_config<
+        kernel_config<256, histogram_items_per_thread<Sample, Channels, 8u>::value>>;
+};
+
+// TODO: We need to update these parameters
+template<class Sample, unsigned int Channels, unsigned int ActiveChannels>
+struct histogram_config_1030
+{
+    using type = histogram_config<
+        kernel_config<256, histogram_items_per_thread<Sample, Channels, 8u>::value>>;
+};
+
+template<unsigned int TargetArch, class Sample, unsigned int Channels, unsigned int ActiveChannels>
+struct default_histogram_config
+    : select_arch<
+        TargetArch,
+        select_arch_case<803, histogram_config_803<Sample, Channels, ActiveChannels> >,
+        select_arch_case<900, histogram_config_900<Sample, Channels, ActiveChannels> >,
+        select_arch_case<ROCPRIM_ARCH_90a, histogram_config_90a<Sample, Channels, ActiveChannels> >,
+        select_arch_case<940, histogram_config_90a<Sample, Channels, ActiveChannels> >,
+        select_arch_case<941, histogram_config_90a<Sample, Channels, ActiveChannels> >,
+        select_arch_case<942, histogram_config_90a<Sample, Channels, ActiveChannels> >,
+        select_arch_case<1030, histogram_config_1030<Sample, Channels, ActiveChannels> >,
+        select_arch_case<1100, histogram_config_1030<Sample, Channels, ActiveChannels> >,
+        histogram_config_900<Sample, Channels, ActiveChannels>
+    > { };
+
+} // end namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group primitivesmodule_deviceconfigs
+
+#endif // ROCPRIM_DEVICE_DETAIL_CONFIG_DEVICE_HISTOGRAM_HPP_
@@ -152,6 +152,7 @@ struct default_merge_sort_config
                   select_arch_case<803, merge_sort_config_803<Key, Value>>,
                   select_arch_case<900, merge_sort_config_900<Key, Value>>,
                   select_arch_case<1030, merge_sort_config_1030<Key, Value>>,
+                  select_arch_case<1100, merge_sort_config_1030<Key, Value>>,
                   merge_sort_config_900<Key, Value>>
 {};
 
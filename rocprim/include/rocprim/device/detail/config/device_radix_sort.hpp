@@ -101,7 +101,21 @@ struct radix_sort_config_803<Key, empty_type>
                                                      6,
                                                      kernel_config<256, 2>,
                                                      kernel_config<256, 7>,
-                                                     kernel_config<256, 12>>>>
+                                                     kernel_config<256, 12>>>,
+                  radix_sort_config<
+                      6,
+                      4,
+                      kernel_config<256, 2>,
+                      kernel_config<256,
+                                    ::rocprim::max(1u,
+                                                   15u
+                                                       / ::rocprim::detail::ceiling_div<unsigned int, unsigned int>(
+                                                           sizeof(Key), sizeof(int)))>,
+                      kernel_config<256,
+                                    ::rocprim::max(1u,
+                                                   10u
+                                                       / ::rocprim::detail::ceiling_div<unsigned int, unsigned int>(
+                                                           sizeof(Key), sizeof(int)))>>>
 {};
 
 template<class Key, class Value>
@@ -162,7 +176,21 @@ struct radix_sort_config_900<Key, empty_type>
                                                      6,
                                                      kernel_config<256, 2>,
                                                      kernel_config<256, 15>,
-                                                     kernel_config<256, 12>>>>
+                                                     kernel_config<256, 12>>>,
+                  radix_sort_config<
+                      6,
+                      4,
+                      kernel_config<256, 2>,
+                      kernel_config<256,
+                                    ::rocprim::max(1u,
+                                                   15u
+                                                       / ::rocprim::detail::ceiling_div<unsigned int, unsigned int>(
+                                                           sizeof(Key), sizeof(int)))>,
+                      kernel_config<256,
+                                    ::rocprim::max(1u,
+                                                   10u
+                                                       / ::rocprim::detail::ceiling_div<unsigned int, unsigned int>(
+                                                           sizeof(Key), sizeof(int)))>>>
 {};
 
 template<class Key, class Value>
@@ -229,7 +257,21 @@ struct radix_sort_config_908<Key, empty_type>
                                                      6,
                                                      kernel_config<256, 4>,
                                                      kernel_config<256, 15>,
-                                                     kernel_config<256, 12>>>>
+                                                     kernel_config<256, 12>>>,
+                  radix_sort_config<
+                      6,
+                      4,
+                      kernel_config<256, 2>,
+                      kernel_config<256,
+                                    ::rocprim::max(1u,
+                                                   15u
+                                                       / ::rocprim::detail::ceiling_div<unsigned int, unsigned int>(
+                                                           sizeof(Key), sizeof(int)))>,
+                      kernel_config<256,
+                                    ::rocprim::max(1u,
+                                                   10u
+                                                       / ::rocprim::detail::ceiling_div<unsigned int, unsigned int>(
+                                                           sizeof(Key), sizeof(int)))>>>
 {};
 
 // TODO: We need to update these parameters
@@ -289,7 +331,21 @@ struct radix_sort_config_90a<Key, empty_type>
                                                      6,
                                                      kernel_config<256, 1>,
                                                      kernel_config<256, 7>,
-                                                     kernel_config<256, 14>>>>
+                                                     kernel_config<256, 14>>>,
+                  radix_sort_config<
+                      6,
+                      4,
+                      kernel_config<256, 2>,
+                      kernel_config<256,
+                                    ::rocprim::max(1u,
+                                                   15u
+                                                       / ::rocprim::detail::ceiling_div<unsigned int, unsigned int>(
+                                                           sizeof(Key), sizeof(int)))>,
+                      kernel_config<256,
+                                    ::rocprim::max(1u,
+                                                   10u
+                                                       / ::rocprim::detail::ceiling_div<unsigned int, unsigned int>(
+                                                           sizeof(Key), sizeof(int)))>>>
 {};
 
 // TODO: We need to update these parameters
@@ -351,7 +407,21 @@ struct radix_sort_config_1030<Key, empty_type>
                                                      6,
                                                      kernel_config<256, 2>,
                                                      kernel_config<256, 15>,
-                                                     kernel_config<256, 15>>>>
+                                                     kernel_config<256, 15>>>,
+                  radix_sort_config<
+                      6,
+                      4,
+                      kernel_config<256, 2>,
+                      kernel_config<256,
+                                    ::rocprim::max(1u,
+                                                   15u
+                                                       / ::rocprim::detail::ceiling_div<unsigned int, unsigned int>(
+                                                           sizeof(Key), sizeof(int)))>,
+                      kernel_config<256,
+                                    ::rocprim::max(1u,
+                                                   10u
+                                                       / ::rocprim::detail::ceiling_div<unsigned int, unsigned int>(
+                                                           sizeof(Key), sizeof(int)))>>>
 {};
 
 template<unsigned int TargetArch, class Key, class Value>
@@ -361,7 +431,11 @@ struct default_radix_sort_config
                   select_arch_case<900, radix_sort_config_900<Key, Value>>,
                   select_arch_case<908, radix_sort_config_908<Key, Value>>,
                   select_arch_case<ROCPRIM_ARCH_90a, radix_sort_config_90a<Key, Value>>,
+                  select_arch_case<940, radix_sort_config_90a<Key, Value>>,
+                  select_arch_case<941, radix_sort_config_90a<Key, Value>>,
+                  select_arch_case<942, radix_sort_config_90a<Key, Value>>,
                   select_arch_case<1030, radix_sort_config_1030<Key, Value>>,
+                  select_arch_case<1100, radix_sort_config_1030<Key, Value>>,
                   radix_sort_config_900<Key, Value>>
 {};
 
@@ -88,7 +88,11 @@ struct default_reduce_config
                   select_arch_case<803, reduce_config_803<Value>>,
                   select_arch_case<900, reduce_config_900<Value>>,
                   select_arch_case<ROCPRIM_ARCH_90a, reduce_config_90a<Value>>,
+                  select_arch_case<940, reduce_config_90a<Value>>,
+                  select_arch_case<941, reduce_config_90a<Value>>,
+                  select_arch_case<942, reduce_config_90a<Value>>,
                   select_arch_case<1030, reduce_config_1030<Value>>,
+                  select_arch_case<1100, reduce_config_1030<Value>>,
                   reduce_config_900<Value>>
 {};
 
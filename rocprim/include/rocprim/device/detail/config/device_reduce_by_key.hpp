@@ -0,0 +1,90 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_CONFIG_DEVICE_REDUCE_BY_KEY_HPP_
+#define ROCPRIM_DEVICE_DETAIL_CONFIG_DEVICE_REDUCE_BY_KEY_HPP_
+
+#include <type_traits>
+
+#include "../../../config.hpp"
+#include "../../../detail/various.hpp"
+#include "../../../functional.hpp"
+
+#include "../../config_types.hpp"
+#include "../../device_reduce_by_key_config.hpp"
+#include "../device_config_helper.hpp"
+
+/* DO NOT EDIT THIS FILE
+ * This 'config' file will be overwritten automatically in the near future,
+ * so most likely you want to edit rocprim/device/detail/device_(algo).hpp
+ */
+
+/// \addtogroup primitivesmodule_deviceconfigs
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// TODO: We need to update these parameters
+// Wave32 (RDNA) has half as many lanes per warp, so large items may shrink the block down to one
+// warp of 32 lanes, and the items per thread scale with size of the items so that 16-byte items
+// do not fill the shared memory of a workgroup.
+template<class Key, class Value>
+struct reduce_by_key_config_1030
+{
+    static constexpr unsigned int size_memory_per_item = ::rocprim::max(sizeof(Key), sizeof(Value));
+
+    static constexpr unsigned int item_scale
+        = ::rocprim::detail::ceiling_div<unsigned int>(size_memory_per_item, 2 * sizeof(int));
+
+    static constexpr unsigned int items_per_thread = ::rocprim::max(1u, 15u / item_scale);
+
+    static constexpr unsigned int block_size
+        = limit_block_size<256U,
+                           items_per_thread * size_memory_per_item,
+                           ROCPRIM_WARP_SIZE_32>::value;
+
+    using type = reduce_by_key_config_v2<
+        block_size,
+        items_per_thread,
+        ::rocprim::block_load_method::block_load_transpose,
+        ::rocprim::block_load_method::block_load_transpose,
+        ::rocprim::block_scan_algorithm::using_warp_scan,
+        size_memory_per_item <= 8 ? 1 : 2>;
+};
+
+template<unsigned int TargetArch, class Key, class Value>
+struct default_reduce_by_key_config
+    : select_arch<TargetArch,
+                  select_arch_case<1030, reduce_by_key_config_1030<Key, Value>>,
+                  select_arch_case<1100, reduce_by_key_config_1030<Key, Value>>,
+                  default_reduce_by_key_config_base<Key, Value>>
+{};
+
+} // end namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group primitivesmodule_deviceconfigs
+
+#endif // ROCPRIM_DEVICE_DETAIL_CONFIG_DEVICE_REDUCE_BY_KEY_HPP_
@@ -125,8 +125,12 @@ struct default_scan_config
                   select_arch_case<803, scan_config_803<Value>>,
                   select_arch_case<900, scan_config_900<Value>>,
                   select_arch_case<ROCPRIM_ARCH_90a, scan_config_90a<Value>>,
+                  select_arch_case<940, scan_config_90a<Value>>,
+                  select_arch_case<941, scan_config_90a<Value>>,
+                  select_arch_case<942, scan_config_90a<Value>>,
                   select_arch_case<908, scan_config_908<Value>>,
                   select_arch_case<1030, scan_config_1030<Value>>,
+                  select_arch_case<1100, scan_config_1030<Value>>,
                   scan_config_900<Value>>
 {};
 
@@ -115,8 +115,12 @@ struct default_scan_by_key_config
     : select_arch<TargetArch,
                   select_arch_case<900, scan_by_key_config_900<Key, Value>>,
                   select_arch_case<ROCPRIM_ARCH_90a, scan_by_key_config_90a<Key, Value>>,
+                  select_arch_case<940, scan_by_key_config_90a<Key, Value>>,
+                  select_arch_case<941, scan_by_key_config_90a<Key, Value>>,
+                  select_arch_case<942, scan_by_key_config_90a<Key, Value>>,
                   select_arch_case<908, scan_by_key_config_908<Key, Value>>,
                   select_arch_case<1030, scan_by_key_config_1030<Key, Value>>,
+                  select_arch_case<1100, scan_by_key_config_1030<Key, Value>>,
                   scan_by_key_config_900<Key, Value>>
 {};
 
@@ -0,0 +1,124 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_ACCUMULATOR_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_ACCUMULATOR_HPP_
+
+#include <iterator>
+#include <type_traits>
+
+#include "../../config.hpp"
+#include "../../detail/match_result_type.hpp"
+#include "../../iterator/transform_iterator.hpp"
+#include "../../types/future_value.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// The accumulator type of a primitive. void is the default of the AccumulatorType parameters,
+// it selects the result type of BinaryFunction for InputType. It is resolved in the body of the
+// primitive, so overload resolution does not instantiate match_result_type with the arguments
+// of another overload (e.g. a stream deduced as BinaryFunction).
+template<class AccumulatorType, class InputType, class BinaryFunction>
+struct resolve_accumulator_type
+{
+    using type = AccumulatorType;
+};
+
+template<class InputType, class BinaryFunction>
+struct resolve_accumulator_type<void, InputType, BinaryFunction>
+    : match_result_type<InputType, BinaryFunction>
+{};
+
+template<class AccumulatorType, class InputType, class BinaryFunction>
+using resolve_accumulator_type_t =
+    typename resolve_accumulator_type<AccumulatorType, InputType, BinaryFunction>::type;
+
+// Converts an input value to the accumulator type of a primitive
+template<class AccumulatorType>
+struct convert_to_accumulator_op
+{
+    template<class T>
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    AccumulatorType operator()(const T& value) const
+    {
+        return static_cast<AccumulatorType>(value);
+    }
+};
+
+template<class InputIterator, class AccumulatorType>
+using is_accumulator_input
+    = std::is_same<typename std::iterator_traits<InputIterator>::value_type, AccumulatorType>;
+
+template<class InputIterator, class AccumulatorType>
+using converted_accumulator_input
+    = transform_iterator<InputIterator,
+                         convert_to_accumulator_op<AccumulatorType>,
+                         AccumulatorType>;
+
+// Input of a primitive with an explicit accumulator type. An input of the accumulator type is
+// passed unchanged, other inputs are converted by a transform_iterator. Full tiles of the
+// transform_iterator over a pointer are still loaded as vectors of the input type, and converted
+// in registers.
+template<class AccumulatorType, class InputIterator>
+inline
+auto to_accumulator_input(InputIterator input) -> typename std::enable_if<
+    is_accumulator_input<InputIterator, AccumulatorType>::value,
+    InputIterator>::type
+{
+    return input;
+}
+
+template<class AccumulatorType, class InputIterator>
+inline
+auto to_accumulator_input(InputIterator input) -> typename std::enable_if<
+    !is_accumulator_input<InputIterator, AccumulatorType>::value,
+    converted_accumulator_input<InputIterator, AccumulatorType>>::type
+{
+    return converted_accumulator_input<InputIterator, AccumulatorType>(
+        input, convert_to_accumulator_op<AccumulatorType>());
+}
+
+// Initial value of a primitive with an explicit accumulator type
+template<class AccumulatorType, class InitValueType>
+inline
+AccumulatorType to_accumulator_initial_value(const InitValueType initial_value)
+{
+    return static_cast<AccumulatorType>(initial_value);
+}
+
+// A future_value is read on the device, so its type must be the accumulator type
+template<class AccumulatorType, class T, class Iter>
+inline
+future_value<T, Iter> to_accumulator_initial_value(const future_value<T, Iter> initial_value)
+{
+    static_assert(std::is_same<T, AccumulatorType>::value,
+                  "The value_type of a future_value initial value must be the accumulator type");
+    return initial_value;
+}
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_ACCUMULATOR_HPP_
@@ -26,11 +26,16 @@
 #include "../../block/block_store.hpp"
 
 #include "../../detail/various.hpp"
+#include "../../intrinsics/atomic.hpp"
 
 #include "../../config.hpp"
+#include "../../types.hpp"
+
+#include "ordered_block_id.hpp"
 
 #include <hip/hip_runtime.h>
 
+#include <algorithm>
 #include <type_traits>
 
 #include <cstdint>
@@ -163,19 +168,56 @@ ROCPRIM_DEVICE ROCPRIM_INLINE auto select_previous_values_iterator(T* /*previous
     return input;
 }
 
+// The unsegmented adjacent difference does not read any flags
+template <bool Right, unsigned int BlockSize, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE void load_segment_boundary_flags(const empty_type /*head_flags*/,
+                                                               bool (&/*flags*/)[ItemsPerThread],
+                                                               const std::size_t /*tile_offset*/,
+                                                               const std::size_t /*size*/)
+{}
+
+// Loads the flags of the items of the tile which are not combined with their neighbours: the
+// heads of the segments (left), or the tails of the segments (right), which are the items before
+// the heads. The last item of the input is a tail.
+template <bool Right, unsigned int BlockSize, unsigned int ItemsPerThread, typename FlagsIt>
+ROCPRIM_DEVICE ROCPRIM_INLINE void load_segment_boundary_flags(const FlagsIt     head_flags,
+                                                               bool (&flags)[ItemsPerThread],
+                                                               const std::size_t tile_offset,
+                                                               const std::size_t size)
+{
+    static constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const std::size_t  first_flag  = tile_offset + (Right ? 1 : 0);
+    const unsigned int valid_flags = static_cast<unsigned int>(
+        std::min<std::size_t>(size - first_flag, items_per_block));
+    ::rocprim::block_load_direct_blocked(::rocprim::detail::block_thread_id<0>(),
+                                         head_flags + first_flag,
+                                         flags,
+                                         valid_flags,
+                                         true);
+}
+
+// Computes the differences of the tile of block_id, before_store is called by all threads
+// when the tile and its neighbouring item have been read and the results are not stored yet.
+// If head_flags is not empty_type, the items are only combined within their segments.
 template <typename Config,
           bool InPlace,
           bool Right,
           typename InputIt,
           typename OutputIt,
-          typename BinaryFunction>
-ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void adjacent_difference_kernel_impl(
+          typename FlagsIt,
+          typename BinaryFunction,
+          typename BeforeStore>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void adjacent_difference_tile_impl(
     const InputIt                                             input,
     const OutputIt                                            output,
     const std::size_t                                         size,
+    const FlagsIt                                             head_flags,
     const BinaryFunction                                      op,
     const typename std::iterator_traits<InputIt>::value_type* previous_values,
-    const std::size_t                                         starting_block)
+    const std::size_t                                         starting_block,
+    const unsigned int                                        block_id,
+    BeforeStore                                               before_store)
 {
     using input_type  = typename std::iterator_traits<InputIt>::value_type;
     using output_type = typename std::iterator_traits<OutputIt>::value_type;
@@ -198,7 +240,6 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void adjacent_difference_kernel_impl(
         typename block_store_type::storage_type store;
     } storage;
 
-    const unsigned int block_id     = blockIdx.x;
     const unsigned int block_offset = block_id * items_per_block;
 
     const std::size_t num_blocks = ceiling_div(size, items_per_block);
@@ -214,6 +255,10 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void adjacent_difference_kernel_impl(
             = static_cast<unsigned int>(size - (num_blocks - 1) * items_per_block);
         block_load_type {}.load(input + block_offset, thread_input, valid_items, storage.load);
     }
+    // The flags use global indices, as the iterator is not offset for the launch
+    bool thread_flags[items_per_thread];
+    load_segment_boundary_flags<Right, block_size>(
+        head_flags, thread_flags, (starting_block + block_id) * items_per_block, size);
     ::rocprim::syncthreads();
 
     // Type tags for tag dispatch.
@@ -243,8 +288,14 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void adjacent_difference_kernel_impl(
                                 storage.adjacent_diff,
                                 in_place,
                                 right);
+    if ROCPRIM_IF_CONSTEXPR(!std::is_same<FlagsIt, empty_type>::value)
+    {
+        copy_flagged_items(thread_input, thread_output, thread_flags);
+    }
     ::rocprim::syncthreads();
 
+    before_store();
+
     if(starting_block + block_id < num_blocks - 1)
     {
         block_store_type {}.store(output + block_offset, thread_output, storage.store);
@@ -257,6 +308,102 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void adjacent_difference_kernel_impl(
     }
 }
 
+template <typename Config,
+          bool InPlace,
+          bool Right,
+          typename InputIt,
+          typename OutputIt,
+          typename FlagsIt,
+          typename BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void adjacent_difference_kernel_impl(
+    const InputIt                                             input,
+    const OutputIt                                            output,
+    const std::size_t                                         size,
+    const FlagsIt                                             head_flags,
+    const BinaryFunction                                      op,
+    const typename std::iterator_traits<InputIt>::value_type* previous_values,
+    const std::size_t                                         starting_block)
+{
+    adjacent_difference_tile_impl<Config, InPlace, Right>(input,
+                                                          output,
+                                                          size,
+                                                          head_flags,
+                                                          op,
+                                                          previous_values,
+                                                          starting_block,
+                                                          blockIdx.x,
+                                                          [] {});
+}
+
+// Single-kernel in-place adjacent difference. Every tile is read by one neighbour: the next tile
+// reads its last item (left) or the previous tile reads its first item (right). The blocks get
+// their tiles from ordered ids so that the block of the reading tile always starts first: from
+// the last tile to the first (left) or from the first to the last (right). A block sets the bit
+// of its tile in read_flags when it has read its neighbouring item, and stores its results when
+// the bit of the reading tile is set. That block got its id before, so it is running and the
+// wait ends without any temporary copies of boundary items.
+//
+// The ids of a launch start at id_base, its tiles start at starting_block.
+template <typename Config,
+          bool Right,
+          typename InputIt,
+          typename FlagsIt,
+          typename BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void adjacent_difference_ordered_inplace_kernel_impl(
+    const InputIt                  values,
+    const std::size_t              size,
+    const FlagsIt                  head_flags,
+    const BinaryFunction           op,
+    ordered_block_id<unsigned int> ordered_bid,
+    unsigned int* const            read_flags,
+    const std::size_t              starting_block,
+    const unsigned int             id_base)
+{
+    static constexpr unsigned int block_size       = Config::block_size;
+    static constexpr unsigned int items_per_thread = Config::items_per_thread;
+    static constexpr unsigned int items_per_block  = block_size * items_per_thread;
+
+    ROCPRIM_SHARED_MEMORY typename ordered_block_id<unsigned int>::storage_type ordered_bid_storage;
+
+    const unsigned int flat_id        = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int current_blocks = ::rocprim::detail::grid_size<0>();
+    const unsigned int ordered_id     = ordered_bid.get(flat_id, ordered_bid_storage) - id_base;
+    const unsigned int block_id       = Right ? ordered_id : current_blocks - 1 - ordered_id;
+
+    const std::size_t num_blocks = ceiling_div(size, items_per_block);
+    const std::size_t tile       = starting_block + block_id;
+
+    // The neighbouring item is read directly from values, as in the out-of-place variants
+    adjacent_difference_tile_impl<Config, false, Right>(
+        values,
+        values,
+        size,
+        head_flags,
+        op,
+        static_cast<const typename std::iterator_traits<InputIt>::value_type*>(nullptr),
+        starting_block,
+        block_id,
+        [&]
+        {
+            if(flat_id == 0)
+            {
+                ::rocprim::detail::memory_fence_device();
+                ::rocprim::detail::atomic_or(&read_flags[tile / 32], 1u << (tile % 32));
+
+                const bool has_reader = Right ? tile != 0 : tile + 1 < num_blocks;
+                if(has_reader)
+                {
+                    const std::size_t  reader = Right ? tile - 1 : tile + 1;
+                    const unsigned int mask   = 1u << (reader % 32);
+                    while((::rocprim::detail::atomic_load_acquire(&read_flags[reader / 32]) & mask)
+                          == 0)
+                    {}
+                }
+            }
+            ::rocprim::syncthreads();
+        });
+}
+
 } // namespace detail
 
 END_ROCPRIM_NAMESPACE
@@ -0,0 +1,184 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_ADJACENT_DIFFERENCE_REDUCE_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_ADJACENT_DIFFERENCE_REDUCE_HPP_
+
+#include <iterator>
+#include <type_traits>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../intrinsics.hpp"
+
+#include "../../block/block_adjacent_difference.hpp"
+#include "../../block/block_load.hpp"
+#include "../../block/block_reduce.hpp"
+
+#include "../config_types.hpp"
+#include "../device_reduce_config.hpp"
+#include "device_reduce.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Reduces the differences of one tile and stores the result in output[block_id]. The differences
+// are indexed from 0, the difference i is difference_op(input[i + 1], input[i]). Every tile loads
+// its items from input + 1 and uses the item before them as the tile predecessor, so the
+// differences are computed in registers and only the partial results are written.
+template<bool WithInitialValue,
+         class Config,
+         class DifferenceType,
+         class ResultType,
+         class InputIterator,
+         class OutputIterator,
+         class InitValueType,
+         class DifferenceOp,
+         class ReduceOp>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void adjacent_difference_reduce_kernel_impl(InputIterator  input,
+                                            const size_t   size,
+                                            OutputIterator output,
+                                            InitValueType  initial_value,
+                                            DifferenceOp   difference_op,
+                                            ReduceOp       reduce_op)
+{
+    static constexpr reduce_config_params params = device_params<Config>();
+
+    constexpr unsigned int block_size       = params.block_size;
+    constexpr unsigned int items_per_thread = params.items_per_thread;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+
+    using input_type      = typename std::iterator_traits<InputIterator>::value_type;
+    using difference_type = DifferenceType;
+    using result_type     = ResultType;
+
+    using block_load_type = ::rocprim::block_load<input_type,
+                                                  block_size,
+                                                  items_per_thread,
+                                                  block_load_method::block_load_transpose>;
+    using block_adjacent_difference_type
+        = ::rocprim::block_adjacent_difference<input_type, block_size>;
+    using block_reduce_type
+        = ::rocprim::block_reduce<result_type, block_size, params.block_reduce_method>;
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        typename block_load_type::storage_type                load;
+        typename block_adjacent_difference_type::storage_type adjacent_difference;
+        typename block_reduce_type::storage_type              reduce;
+    } storage;
+
+    const unsigned int flat_id       = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int flat_block_id = ::rocprim::detail::block_id<0>();
+
+    // There are no differences when the input has less than 2 items, which may not be readable
+    if(size == 0)
+    {
+        if(flat_id == 0)
+        {
+            output[flat_block_id] = static_cast<result_type>(initial_value);
+        }
+        return;
+    }
+
+    const size_t       block_offset     = static_cast<size_t>(flat_block_id) * items_per_block;
+    const unsigned int number_of_blocks = ::rocprim::detail::grid_size<0>();
+    const unsigned int valid_in_last_block
+        = static_cast<unsigned int>(size - items_per_block * (number_of_blocks - 1));
+
+    // The differences of the tile are d[block_offset, block_offset + items_per_block)
+    const input_type tile_predecessor = input[block_offset];
+
+    input_type  values[items_per_thread];
+    result_type output_value;
+    if(flat_block_id == (number_of_blocks - 1)) // last block
+    {
+        block_load_type().load(input + block_offset + 1, values, valid_in_last_block, storage.load);
+        ::rocprim::syncthreads();
+
+        difference_type differences[items_per_thread];
+        block_adjacent_difference_type().subtract_left_partial(values,
+                                                               differences,
+                                                               difference_op,
+                                                               tile_predecessor,
+                                                               valid_in_last_block,
+                                                               storage.adjacent_difference);
+
+        // The valid differences are the first items of the blocked arrangement
+        const unsigned int thread_offset = flat_id * items_per_thread;
+        output_value                     = differences[0];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 1; i < items_per_thread; i++)
+        {
+            if(thread_offset + i < valid_in_last_block)
+            {
+                output_value = reduce_op(output_value, differences[i]);
+            }
+        }
+
+        block_reduce_type().reduce(output_value, // input
+                                   output_value, // output
+                                   ceiling_div(valid_in_last_block, items_per_thread),
+                                   storage.reduce,
+                                   reduce_op);
+    }
+    else
+    {
+        block_load_type().load(input + block_offset + 1, values, storage.load);
+        ::rocprim::syncthreads();
+
+        difference_type differences[items_per_thread];
+        block_adjacent_difference_type().subtract_left(values,
+                                                       differences,
+                                                       difference_op,
+                                                       tile_predecessor,
+                                                       storage.adjacent_difference);
+
+        output_value = differences[0];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 1; i < items_per_thread; i++)
+        {
+            output_value = reduce_op(output_value, differences[i]);
+        }
+
+        block_reduce_type().reduce(output_value, // input
+                                   output_value, // output
+                                   storage.reduce,
+                                   reduce_op);
+    }
+
+    // Save value into output
+    if(flat_id == 0)
+    {
+        output[flat_block_id] = reduce_with_initial<WithInitialValue>(
+            output_value,
+            static_cast<result_type>(initial_value),
+            reduce_op);
+    }
+}
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_ADJACENT_DIFFERENCE_REDUCE_HPP_
@@ -0,0 +1,435 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_ARGMINMAX_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_ARGMINMAX_HPP_
+
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+
+#include "../../intrinsics.hpp"
+#include "../../types.hpp"
+
+#include "../../iterator/counting_iterator.hpp"
+#include "../config_types.hpp"
+#include "../device_reduce_config.hpp"
+#include "device_segmented_reduce.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// The value and the index of the best item are kept in separate registers and shared memory
+// arrays instead of a key_value_pair, whose padding (e.g. a 4-byte index next to a double) would
+// be moved through shuffles and shared memory too. Ties go to the smaller index, as with arg_min
+// and arg_max.
+
+// Index of a thread that has not seen any item yet
+template<class Index>
+ROCPRIM_HOST_DEVICE constexpr Index argminmax_invalid_index()
+{
+    return static_cast<Index>(-1);
+}
+
+// Replaces (value, index) with (other_value, other_index) if the other item is better: smaller
+// (Max is false) or larger (Max is true), or equal with a smaller index. Invalid items never win
+// and always lose, their values are not read.
+template<bool Max, class T, class Index>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void argminmax_combine(T& value, Index& index, const T& other_value, const Index other_index)
+{
+    constexpr Index invalid = argminmax_invalid_index<Index>();
+    if(other_index != invalid
+       && (index == invalid || (Max ? other_value > value : other_value < value)
+           || (other_value == value && other_index < index)))
+    {
+        value = other_value;
+        index = other_index;
+    }
+}
+
+// Reduces the items i = begin, begin + stride, ... below end, the item i has the value values[i]
+// and the index indices[i]. ItemsPerThread items are loaded before they are compared.
+template<unsigned int ItemsPerThread,
+         bool         Max,
+         class ValueIterator,
+         class IndexIterator,
+         class T,
+         class Index>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void argminmax_thread_reduce(ValueIterator values,
+                             IndexIterator indices,
+                             Index         begin,
+                             const Index   end,
+                             const Index   stride,
+                             T&            value,
+                             Index&        index)
+{
+    Index i = begin;
+    while(i < end && end - i > (ItemsPerThread - 1) * stride)
+    {
+        T     item_values[ItemsPerThread];
+        Index item_indices[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int item = 0; item < ItemsPerThread; item++)
+        {
+            item_values[item]  = static_cast<T>(values[i + item * stride]);
+            item_indices[item] = static_cast<Index>(indices[i + item * stride]);
+        }
+        ROCPRIM_UNROLL
+        for(unsigned int item = 0; item < ItemsPerThread; item++)
+        {
+            argminmax_combine<Max>(value, index, item_values[item], item_indices[item]);
+        }
+        i += ItemsPerThread * stride;
+    }
+    for(; i < end; i += stride)
+    {
+        argminmax_combine<Max>(value,
+                               index,
+                               static_cast<T>(values[i]),
+                               static_cast<Index>(indices[i]));
+    }
+}
+
+// Reduces the items of a logical warp, the result is valid in its first thread.
+template<unsigned int WarpSize, bool Max, class T, class Index>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void argminmax_warp_reduce(T& value, Index& index)
+{
+    ROCPRIM_UNROLL
+    for(unsigned int offset = WarpSize / 2; offset > 0; offset /= 2)
+    {
+        const T     other_value = ::rocprim::warp_shuffle_down(value, offset, WarpSize);
+        const Index other_index = ::rocprim::warp_shuffle_down(index, offset, WarpSize);
+        argminmax_combine<Max>(value, index, other_value, other_index);
+    }
+}
+
+// Reduces the items of a block, the result is valid in its first thread.
+template<unsigned int BlockSize, bool Max, class T, class Index>
+class argminmax_block_reduce
+{
+    static constexpr unsigned int warp_size
+        = ::rocprim::detail::get_min_warp_size(BlockSize, ::rocprim::device_warp_size());
+    static constexpr unsigned int warps = BlockSize / warp_size;
+    static_assert(BlockSize % warp_size == 0, "BlockSize must be a multiple of the warp size");
+
+    struct storage_type_
+    {
+        T     values[warps];
+        Index indices[warps];
+    };
+
+public:
+    using storage_type = ::rocprim::detail::raw_storage<storage_type_>;
+
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void reduce(T& value, Index& index, storage_type& storage)
+    {
+        argminmax_warp_reduce<warp_size, Max>(value, index);
+        if(warps == 1)
+        {
+            return;
+        }
+
+        storage_type_&     storage_ = storage.get();
+        const unsigned int flat_id  = ::rocprim::detail::block_thread_id<0>();
+        const unsigned int lane_id  = flat_id % warp_size;
+        const unsigned int warp_id  = flat_id / warp_size;
+        if(lane_id == 0)
+        {
+            storage_.values[warp_id]  = value;
+            storage_.indices[warp_id] = index;
+        }
+        ::rocprim::syncthreads();
+
+        if(flat_id < warp_size)
+        {
+            index = argminmax_invalid_index<Index>();
+            if(flat_id < warps)
+            {
+                value = storage_.values[flat_id];
+                index = storage_.indices[flat_id];
+            }
+            argminmax_warp_reduce<::rocprim::detail::next_power_of_two(warps), Max>(value, index);
+        }
+    }
+};
+
+// Value stored for empty segments and empty inputs, the same as in cub
+template<bool Max, class T>
+ROCPRIM_HOST_DEVICE inline T argminmax_empty_value()
+{
+    return Max ? std::numeric_limits<T>::lowest() : std::numeric_limits<T>::max();
+}
+
+template<bool Max, class OutputIterator, class T, class Index>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void argminmax_store(OutputIterator output, const T& value, const Index index)
+{
+    using output_type = typename std::iterator_traits<OutputIterator>::value_type;
+    using key_type    = typename output_type::key_type;
+    using value_type  = typename output_type::value_type;
+    if(index == argminmax_invalid_index<Index>())
+    {
+        *output = output_type(key_type(1),
+                              static_cast<value_type>(argminmax_empty_value<Max, T>()));
+    }
+    else
+    {
+        *output = output_type(static_cast<key_type>(index), static_cast<value_type>(value));
+    }
+}
+
+// The first pass of argmin and argmax, every block stores the best item of the items
+// i = global thread id + k * (number of threads of the grid).
+template<class Config, bool Max, class InputIterator, class T, class Index>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void argminmax_partial(InputIterator input,
+                       const Index   size,
+                       T*            partial_values,
+                       Index*        partial_indices)
+{
+    static constexpr reduce_config_params params = device_params<Config>();
+
+    constexpr unsigned int block_size       = params.block_size;
+    constexpr unsigned int items_per_thread = params.items_per_thread;
+
+    using reduce_type = argminmax_block_reduce<block_size, Max, T, Index>;
+
+    ROCPRIM_SHARED_MEMORY typename reduce_type::storage_type reduce_storage;
+
+    const unsigned int flat_id  = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int block_id = ::rocprim::detail::block_id<0>();
+    const Index stride = static_cast<Index>(::rocprim::detail::grid_size<0>()) * block_size;
+
+    T     value;
+    Index index = argminmax_invalid_index<Index>();
+    argminmax_thread_reduce<items_per_thread, Max>(input,
+                                                   ::rocprim::counting_iterator<Index>(0),
+                                                   static_cast<Index>(block_id) * block_size
+                                                       + flat_id,
+                                                   size,
+                                                   stride,
+                                                   value,
+                                                   index);
+    reduce_type().reduce(value, index, reduce_storage);
+
+    if(flat_id == 0)
+    {
+        partial_values[block_id]  = value;
+        partial_indices[block_id] = index;
+    }
+}
+
+// The final pass of argmin and argmax, a single block reduces the items (values[i], indices[i])
+// for i in [0, size).
+template<class Config,
+         bool Max,
+         class ValueIterator,
+         class IndexIterator,
+         class OutputIterator,
+         class T,
+         class Index>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void argminmax_final(ValueIterator  values,
+                     IndexIterator  indices,
+                     const Index    size,
+                     OutputIterator output)
+{
+    static constexpr reduce_config_params params = device_params<Config>();
+
+    constexpr unsigned int block_size       = params.block_size;
+    constexpr unsigned int items_per_thread = params.items_per_thread;
+
+    using reduce_type = argminmax_block_reduce<block_size, Max, T, Index>;
+
+    ROCPRIM_SHARED_MEMORY typename reduce_type::storage_type reduce_storage;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+
+    T     value;
+    Index index = argminmax_invalid_index<Index>();
+    argminmax_thread_reduce<items_per_thread, Max>(values,
+                                                   indices,
+                                                   static_cast<Index>(flat_id),
+                                                   size,
+                                                   static_cast<Index>(block_size),
+                                                   value,
+                                                   index);
+    reduce_type().reduce(value, index, reduce_storage);
+
+    if(flat_id == 0)
+    {
+        argminmax_store<Max>(output, value, index);
+    }
+}
+
+// Segmented argmin and argmax, one thread, logical warp or block per segment. The indices are
+// relative to the beginnings of the segments.
+template<class Config, bool Max, class InputIterator, class OutputIterator, class OffsetIterator>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void segmented_argminmax_thread(InputIterator      input,
+                                OutputIterator     output,
+                                const unsigned int segments,
+                                OffsetIterator     begin_offsets,
+                                OffsetIterator     end_offsets)
+{
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    static constexpr reduce_config_params params = device_params<Config>();
+
+    constexpr unsigned int block_size = params.block_size;
+
+    const unsigned int segment_id
+        = ::rocprim::detail::block_id<0>() * block_size + ::rocprim::detail::block_thread_id<0>();
+    if(segment_id >= segments)
+    {
+        return;
+    }
+
+    const unsigned int begin_offset = begin_offsets[segment_id];
+    const unsigned int end_offset   = end_offsets[segment_id];
+
+    value_type   value;
+    unsigned int index = argminmax_invalid_index<unsigned int>();
+    if(end_offset > begin_offset)
+    {
+        argminmax_thread_reduce<1, Max>(input + begin_offset,
+                                        ::rocprim::counting_iterator<unsigned int>(0),
+                                        0u,
+                                        end_offset - begin_offset,
+                                        1u,
+                                        value,
+                                        index);
+    }
+    argminmax_store<Max>(output + segment_id, value, index);
+}
+
+template<class Config, bool Max, class InputIterator, class OutputIterator, class OffsetIterator>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void segmented_argminmax_warp(InputIterator      input,
+                              OutputIterator     output,
+                              const unsigned int segments,
+                              OffsetIterator     begin_offsets,
+                              OffsetIterator     end_offsets)
+{
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    static constexpr reduce_config_params params = device_params<Config>();
+
+    constexpr unsigned int block_size       = params.block_size;
+    constexpr unsigned int items_per_thread = params.items_per_thread;
+    constexpr unsigned int warp_size        = segmented_reduce_warp_size;
+    constexpr unsigned int warps_per_block  = block_size / warp_size;
+    static_assert(block_size % warp_size == 0,
+                  "block_size must be a multiple of segmented_reduce_warp_size");
+
+    const unsigned int flat_id    = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int lane_id    = flat_id % warp_size;
+    const unsigned int warp_id    = flat_id / warp_size;
+    const unsigned int segment_id = ::rocprim::detail::block_id<0>() * warps_per_block + warp_id;
+
+    // All threads of a logical warp leave together
+    if(segment_id >= segments)
+    {
+        return;
+    }
+
+    const unsigned int begin_offset = begin_offsets[segment_id];
+    const unsigned int end_offset   = end_offsets[segment_id];
+
+    value_type   value;
+    unsigned int index = argminmax_invalid_index<unsigned int>();
+    if(end_offset > begin_offset)
+    {
+        argminmax_thread_reduce<items_per_thread, Max>(
+            input + begin_offset,
+            ::rocprim::counting_iterator<unsigned int>(0),
+            lane_id,
+            end_offset - begin_offset,
+            warp_size,
+            value,
+            index);
+    }
+    argminmax_warp_reduce<warp_size, Max>(value, index);
+
+    if(lane_id == 0)
+    {
+        argminmax_store<Max>(output + segment_id, value, index);
+    }
+}
+
+template<class Config, bool Max, class InputIterator, class OutputIterator, class OffsetIterator>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void segmented_argminmax_block(InputIterator  input,
+                               OutputIterator output,
+                               OffsetIterator begin_offsets,
+                               OffsetIterator end_offsets)
+{
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    static constexpr reduce_config_params params = device_params<Config>();
+
+    constexpr unsigned int block_size       = params.block_size;
+    constexpr unsigned int items_per_thread = params.items_per_thread;
+
+    using reduce_type = argminmax_block_reduce<block_size, Max, value_type, unsigned int>;
+
+    ROCPRIM_SHARED_MEMORY typename reduce_type::storage_type reduce_storage;
+
+    const unsigned int flat_id    = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int segment_id = ::rocprim::detail::block_id<0>();
+
+    const unsigned int begin_offset = begin_offsets[segment_id];
+    const unsigned int end_offset   = end_offsets[segment_id];
+
+    value_type   value;
+    unsigned int index = argminmax_invalid_index<unsigned int>();
+    if(end_offset > begin_offset)
+    {
+        argminmax_thread_reduce<items_per_thread, Max>(
+            input + begin_offset,
+            ::rocprim::counting_iterator<unsigned int>(0),
+            flat_id,
+            end_offset - begin_offset,
+            block_size,
+            value,
+            index);
+    }
+    reduce_type().reduce(value, index, reduce_storage);
+
+    if(flat_id == 0)
+    {
+        argminmax_store<Max>(output + segment_id, value, index);
+    }
+}
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_ARGMINMAX_HPP_
@@ -0,0 +1,221 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_BATCH_MEMCPY_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_BATCH_MEMCPY_HPP_
+
+#include <cstdint>
+#include <iterator>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../functional.hpp"
+#include "../../intrinsics.hpp"
+#include "../../intrinsics/atomic.hpp"
+#include "../../thread/thread_load.hpp"
+#include "../../thread/thread_store.hpp"
+
+#include "device_binary_search.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// State of the queue of large buffers, the number of buffers in the high 32 bits and the number
+// of their tiles in the low 32 bits. One atomic addition enqueues a buffer with all its tiles, so
+// the first tiles of the buffers increase with their positions in the queue.
+using batch_memcpy_large_state = unsigned long long;
+
+// The workers of WorkerSize threads copy [0, size) of a buffer, rank is the thread in the worker.
+// When the source and the destination have the same alignment, the bytes before the first
+// aligned 16-byte word are copied, then the words are copied with vector loads and stores, then
+// the bytes after the last word.
+template<unsigned int WorkerSize>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void batch_memcpy_bytes(const unsigned int         rank,
+                        const unsigned char* const source,
+                        unsigned char* const       destination,
+                        const size_t               size)
+{
+    using vector_type            = uint4;
+    constexpr size_t vector_size = sizeof(vector_type);
+
+    const size_t source_misalignment = reinterpret_cast<uintptr_t>(source) % vector_size;
+    const size_t destination_misalignment
+        = reinterpret_cast<uintptr_t>(destination) % vector_size;
+
+    // Misaligned buffers are copied as bytes
+    const size_t head
+        = source_misalignment == destination_misalignment
+              ? ::rocprim::min(size, (vector_size - source_misalignment) % vector_size)
+              : size;
+    for(size_t i = rank; i < head; i += WorkerSize)
+    {
+        destination[i] = source[i];
+    }
+
+    const size_t             vectors       = (size - head) / vector_size;
+    const vector_type* const vector_source = reinterpret_cast<const vector_type*>(source + head);
+    vector_type* const vector_destination  = reinterpret_cast<vector_type*>(destination + head);
+    for(size_t i = rank; i < vectors; i += WorkerSize)
+    {
+        ::rocprim::thread_store(vector_destination + i, ::rocprim::thread_load(vector_source + i));
+    }
+
+    for(size_t i = head + vectors * vector_size + rank; i < size; i += WorkerSize)
+    {
+        destination[i] = source[i];
+    }
+}
+
+template<class Pointer>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+const unsigned char* batch_memcpy_source_bytes(const Pointer pointer)
+{
+    return reinterpret_cast<const unsigned char*>(static_cast<const void*>(pointer));
+}
+
+template<class Pointer>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+unsigned char* batch_memcpy_destination_bytes(const Pointer pointer)
+{
+    return reinterpret_cast<unsigned char*>(static_cast<void*>(pointer));
+}
+
+// Every thread takes one buffer: small buffers are copied by the thread, medium buffers are
+// enqueued for the warps and large buffers for the blocks.
+template<class Config,
+         class InputBufferIterator,
+         class OutputBufferIterator,
+         class BufferSizeIterator>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void batch_memcpy_small_kernel_impl(InputBufferIterator       sources,
+                                    OutputBufferIterator      destinations,
+                                    BufferSizeIterator        sizes,
+                                    const unsigned int        num_buffers,
+                                    unsigned int*             medium_buffers,
+                                    unsigned int*             medium_count,
+                                    unsigned int*             large_buffers,
+                                    unsigned int*             large_first_tiles,
+                                    batch_memcpy_large_state* large_state)
+{
+    const unsigned int buffer = ::rocprim::detail::block_id<0>() * Config::block_size
+                                + ::rocprim::detail::block_thread_id<0>();
+    if(buffer >= num_buffers)
+    {
+        return;
+    }
+
+    const size_t size = static_cast<size_t>(sizes[buffer]);
+    if(size <= Config::small_buffer_size)
+    {
+        batch_memcpy_bytes<1>(0,
+                              batch_memcpy_source_bytes(sources[buffer]),
+                              batch_memcpy_destination_bytes(destinations[buffer]),
+                              size);
+    }
+    else if(size <= Config::medium_buffer_size)
+    {
+        medium_buffers[::rocprim::detail::warp_aggregated_atomic_add(medium_count, 1u)] = buffer;
+    }
+    else
+    {
+        const unsigned long long tiles = ceiling_div(size, Config::tile_size);
+        const batch_memcpy_large_state state
+            = ::rocprim::detail::atomic_add(large_state, (1ull << 32) | tiles);
+        const unsigned int position = static_cast<unsigned int>(state >> 32);
+        large_buffers[position]     = buffer;
+        large_first_tiles[position] = static_cast<unsigned int>(state);
+    }
+}
+
+// Every warp of the grid takes medium buffers from the queue until all of them are copied
+template<class Config,
+         class InputBufferIterator,
+         class OutputBufferIterator,
+         class BufferSizeIterator>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void batch_memcpy_medium_kernel_impl(InputBufferIterator  sources,
+                                     OutputBufferIterator destinations,
+                                     BufferSizeIterator   sizes,
+                                     const unsigned int*  medium_buffers,
+                                     const unsigned int*  medium_count)
+{
+    constexpr unsigned int warp_size       = ::rocprim::device_warp_size();
+    constexpr unsigned int warps_per_block = Config::block_size / warp_size;
+
+    const unsigned int lane  = ::rocprim::lane_id();
+    const unsigned int warps = ::rocprim::detail::grid_size<0>() * warps_per_block;
+    const unsigned int count = *medium_count;
+    for(unsigned int i
+        = ::rocprim::detail::block_id<0>() * warps_per_block + ::rocprim::warp_id();
+        i < count;
+        i += warps)
+    {
+        const unsigned int buffer = medium_buffers[i];
+        batch_memcpy_bytes<warp_size>(lane,
+                                      batch_memcpy_source_bytes(sources[buffer]),
+                                      batch_memcpy_destination_bytes(destinations[buffer]),
+                                      static_cast<size_t>(sizes[buffer]));
+    }
+}
+
+// Every block of the grid takes tiles of large buffers until all of them are copied, the buffer
+// of a tile is found by a binary search of the first tiles of the buffers
+template<class Config,
+         class InputBufferIterator,
+         class OutputBufferIterator,
+         class BufferSizeIterator>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void batch_memcpy_large_kernel_impl(InputBufferIterator             sources,
+                                    OutputBufferIterator            destinations,
+                                    BufferSizeIterator              sizes,
+                                    const unsigned int*             large_buffers,
+                                    const unsigned int*             large_first_tiles,
+                                    const batch_memcpy_large_state* large_state)
+{
+    const batch_memcpy_large_state state = *large_state;
+    const unsigned int             count = static_cast<unsigned int>(state >> 32);
+    const unsigned int             tiles = static_cast<unsigned int>(state);
+
+    for(unsigned int tile = ::rocprim::detail::block_id<0>(); tile < tiles;
+        tile += ::rocprim::detail::grid_size<0>())
+    {
+        const unsigned int position
+            = upper_bound_n(large_first_tiles, count, tile, ::rocprim::less<unsigned int>()) - 1;
+        const unsigned int buffer = large_buffers[position];
+
+        const size_t size   = static_cast<size_t>(sizes[buffer]);
+        const size_t offset = static_cast<size_t>(tile - large_first_tiles[position])
+                              * Config::tile_size;
+        batch_memcpy_bytes<Config::block_size>(
+            ::rocprim::detail::block_thread_id<0>(),
+            batch_memcpy_source_bytes(sources[buffer]) + offset,
+            batch_memcpy_destination_bytes(destinations[buffer]) + offset,
+            ::rocprim::min<size_t>(size - offset, Config::tile_size));
+    }
+}
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_BATCH_MEMCPY_HPP_
@@ -0,0 +1,105 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_BATCHED_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_BATCHED_HPP_
+
+#include <iterator>
+#include <limits>
+#include <vector>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../intrinsics/thread.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Tiles of all problems of a batch are numbered consecutively, so blocks can process
+// tiles of different problems in one launch regardless of how the sizes are distributed.
+struct batched_problem
+{
+    size_t       size;
+    // The index of the first tile of the problem
+    unsigned int tile_offset;
+};
+
+// Fills problems with problem_count + 1 entries, the last one holds the total number of tiles.
+// If tile_per_empty_problem is true, problems without items get one tile (e.g. to store the
+// initial value of a reduction), otherwise they do not have tiles.
+template<class SizeIterator>
+inline hipError_t make_batched_problems(SizeIterator                  sizes,
+                                        const unsigned int            problem_count,
+                                        const unsigned int            items_per_block,
+                                        const bool                    tile_per_empty_problem,
+                                        std::vector<batched_problem>& problems,
+                                        unsigned int&                 number_of_tiles)
+{
+    // The number of tiles is limited by the 32-bit tile indices
+    const size_t max_tiles = std::numeric_limits<unsigned int>::max() - ::rocprim::host_warp_size();
+
+    problems.resize(problem_count + 1);
+    size_t tiles = 0;
+    for(unsigned int i = 0; i < problem_count; i++)
+    {
+        const size_t size = static_cast<size_t>(sizes[i]);
+        problems[i]       = batched_problem{size, static_cast<unsigned int>(tiles)};
+        tiles += (size == 0 && tile_per_empty_problem) ? 1 : ceiling_div(size, items_per_block);
+        if(tiles > max_tiles)
+        {
+            return hipErrorInvalidValue;
+        }
+    }
+    problems[problem_count] = batched_problem{0, static_cast<unsigned int>(tiles)};
+    number_of_tiles         = static_cast<unsigned int>(tiles);
+    return hipSuccess;
+}
+
+// Returns the problem that tile belongs to, i.e. the last problem whose first tile is not
+// after tile. Problems without tiles are never returned.
+ROCPRIM_DEVICE ROCPRIM_INLINE
+unsigned int find_batched_problem(const batched_problem* problems,
+                                  const unsigned int     problem_count,
+                                  const unsigned int     tile)
+{
+    unsigned int begin = 0;
+    unsigned int end   = problem_count;
+    while(end - begin > 1)
+    {
+        const unsigned int mid = begin + (end - begin) / 2;
+        if(problems[mid].tile_offset <= tile)
+        {
+            begin = mid;
+        }
+        else
+        {
+            end = mid;
+        }
+    }
+    return begin;
+}
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_BATCHED_HPP_
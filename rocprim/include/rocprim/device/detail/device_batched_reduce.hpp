@@ -0,0 +1,188 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_BATCHED_REDUCE_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_BATCHED_REDUCE_HPP_
+
+#include <iterator>
+#include <type_traits>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+
+#include "../../intrinsics.hpp"
+#include "../../types.hpp"
+
+#include "../../block/block_load_func.hpp"
+#include "../../block/block_reduce.hpp"
+#include "../config_types.hpp"
+#include "../device_reduce_config.hpp"
+#include "device_batched.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Every block reduces tiles of any problems and stores the partial results of the tiles. The
+// last block to finish a tile of a problem (found with an atomic counter per problem) reduces
+// the partial results of the problem in the order of tiles and stores the final result.
+template<class Config,
+         class ResultType,
+         class InputIterators,
+         class OutputIterators,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void batched_reduce_kernel_impl(InputIterators         inputs,
+                                OutputIterators        outputs,
+                                const batched_problem* problems,
+                                const unsigned int     problem_count,
+                                const unsigned int     number_of_tiles,
+                                BinaryFunction         reduce_op,
+                                ResultType             initial_value,
+                                ResultType*            tile_partials,
+                                unsigned int*          tile_counters)
+{
+    static constexpr reduce_config_params params = device_params<Config>();
+
+    constexpr unsigned int block_size       = params.block_size;
+    constexpr unsigned int items_per_thread = params.items_per_thread;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+
+    using result_type = ResultType;
+
+    using block_reduce_type
+        = ::rocprim::block_reduce<result_type, block_size, params.block_reduce_method>;
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        typename block_reduce_type::storage_type reduce;
+        bool is_last_tile;
+    } storage;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+
+    for(unsigned int tile = ::rocprim::detail::block_id<0>(); tile < number_of_tiles;
+        tile += ::rocprim::detail::grid_size<0>())
+    {
+        const unsigned int    problem    = find_batched_problem(problems, problem_count, tile);
+        const batched_problem current    = problems[problem];
+        const unsigned int    first_tile = current.tile_offset;
+        const unsigned int    tiles      = problems[problem + 1].tile_offset - first_tile;
+
+        if(current.size == 0)
+        {
+            // Empty problems have one tile that only stores the initial value
+            if(flat_id == 0)
+            {
+                *outputs[problem] = initial_value;
+            }
+            continue;
+        }
+
+        const size_t tile_offset = static_cast<size_t>(tile - first_tile) * items_per_block;
+        const auto   input       = inputs[problem] + tile_offset;
+
+        result_type values[items_per_thread];
+        result_type thread_value;
+        unsigned int valid_threads = block_size;
+        if(tile_offset + items_per_block <= current.size)
+        {
+            block_load_direct_striped<block_size>(flat_id, input, values);
+
+            thread_value = values[0];
+            ROCPRIM_UNROLL
+            for(unsigned int i = 1; i < items_per_thread; i++)
+            {
+                thread_value = reduce_op(thread_value, values[i]);
+            }
+        }
+        else
+        {
+            // The last tile of the problem
+            const unsigned int valid = static_cast<unsigned int>(current.size - tile_offset);
+            block_load_direct_striped<block_size>(flat_id, input, values, valid);
+
+            thread_value = values[0];
+            ROCPRIM_UNROLL
+            for(unsigned int i = 1; i < items_per_thread; i++)
+            {
+                if(flat_id + i * block_size < valid)
+                {
+                    thread_value = reduce_op(thread_value, values[i]);
+                }
+            }
+            valid_threads = ::rocprim::min(valid, block_size);
+        }
+
+        result_type tile_value;
+        block_reduce_type().reduce(thread_value, tile_value, valid_threads, storage.reduce, reduce_op);
+
+        if(tiles == 1)
+        {
+            if(flat_id == 0)
+            {
+                *outputs[problem] = reduce_op(initial_value, tile_value);
+            }
+            ::rocprim::syncthreads(); // reuse storage.reduce
+            continue;
+        }
+
+        if(flat_id == 0)
+        {
+            tile_partials[tile] = tile_value;
+            // Make the partial result visible to the last block before incrementing the counter
+            ::rocprim::detail::memory_fence_device();
+            const unsigned int ticket = ::rocprim::detail::atomic_add(&tile_counters[problem], 1u);
+            storage.is_last_tile = ticket == tiles - 1;
+        }
+        ::rocprim::syncthreads();
+
+        if(storage.is_last_tile)
+        {
+            ::rocprim::detail::memory_fence_device();
+
+            result_type partials_value;
+            for(unsigned int i = flat_id; i < tiles; i += block_size)
+            {
+                const result_type partial = tile_partials[first_tile + i];
+                partials_value = i == flat_id ? partial : reduce_op(partials_value, partial);
+            }
+
+            block_reduce_type().reduce(partials_value,
+                                       partials_value,
+                                       ::rocprim::min(tiles, block_size),
+                                       storage.reduce,
+                                       reduce_op);
+
+            if(flat_id == 0)
+            {
+                *outputs[problem] = reduce_op(initial_value, partials_value);
+            }
+        }
+        ::rocprim::syncthreads(); // reuse storage
+    }
+}
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_BATCHED_REDUCE_HPP_
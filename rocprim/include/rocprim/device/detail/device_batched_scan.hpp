@@ -0,0 +1,443 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_BATCHED_SCAN_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_BATCHED_SCAN_HPP_
+
+#include <iterator>
+#include <type_traits>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../functional.hpp"
+#include "../../intrinsics.hpp"
+#include "../../types.hpp"
+
+#include "../../block/block_load.hpp"
+#include "../../block/block_scan.hpp"
+#include "../../block/block_store.hpp"
+#include "../../warp/warp_load.hpp"
+#include "../../warp/warp_scan.hpp"
+#include "../../warp/warp_store.hpp"
+
+#include "device_batched.hpp"
+#include "device_scan_common.hpp"
+#include "lookback_scan_state.hpp"
+#include "ordered_block_id.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Decoupled look-back scan over the tiles of all problems. The first tile of every problem
+// sets its prefix to complete without looking back, so the look-back of the other tiles never
+// crosses the beginning of their problem. Tiles are processed in the order of their ids.
+template<bool Exclusive,
+         class Config,
+         class ResultType,
+         class InputIterators,
+         class OutputIterators,
+         class BinaryFunction,
+         class LookbackScanState>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void batched_scan_kernel_impl(InputIterators                 inputs,
+                              OutputIterators                outputs,
+                              const batched_problem*         problems,
+                              const unsigned int             problem_count,
+                              const unsigned int             number_of_tiles,
+                              ResultType                     initial_value,
+                              BinaryFunction                 scan_op,
+                              LookbackScanState              scan_state,
+                              ordered_block_id<unsigned int> ordered_bid)
+{
+    using result_type = ResultType;
+    static_assert(std::is_same<result_type, typename LookbackScanState::value_type>::value,
+                  "value_type of LookbackScanState must be result_type");
+
+    constexpr unsigned int block_size       = Config::block_size;
+    constexpr unsigned int items_per_thread = Config::items_per_thread;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+
+    using block_load_type
+        = ::rocprim::block_load<result_type, block_size, items_per_thread, Config::block_load_method>;
+    using block_store_type = ::rocprim::
+        block_store<result_type, block_size, items_per_thread, Config::block_store_method>;
+    using block_scan_type = ::rocprim::block_scan<result_type, block_size, Config::block_scan_method>;
+
+    using order_bid_type = ordered_block_id<unsigned int>;
+    using lookback_scan_prefix_op_type
+        = lookback_scan_prefix_op<result_type, BinaryFunction, LookbackScanState>;
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        typename order_bid_type::storage_type ordered_bid;
+        union
+        {
+            typename block_load_type::storage_type  load;
+            typename block_store_type::storage_type store;
+            typename block_scan_type::storage_type  scan;
+        };
+    } storage;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+
+    while(true)
+    {
+        const unsigned int tile = ordered_bid.get(flat_id, storage.ordered_bid);
+        if(tile >= number_of_tiles)
+        {
+            break;
+        }
+
+        const unsigned int    problem     = find_batched_problem(problems, problem_count, tile);
+        const batched_problem current     = problems[problem];
+        const size_t          tile_offset = static_cast<size_t>(tile - current.tile_offset)
+                                   * items_per_block;
+        const bool         is_last_tile = tile_offset + items_per_block >= current.size;
+        const unsigned int valid        = static_cast<unsigned int>(
+            ::rocprim::min<size_t>(current.size - tile_offset, items_per_block));
+
+        const auto input  = inputs[problem] + tile_offset;
+        const auto output = outputs[problem] + tile_offset;
+
+        result_type values[items_per_thread];
+        if(is_last_tile)
+        {
+            block_load_type().load(input, values, valid, *input, storage.load);
+        }
+        else
+        {
+            block_load_type().load(input, values, storage.load);
+        }
+        ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+        if(tile == current.tile_offset)
+        {
+            result_type reduction;
+            lookback_block_scan<Exclusive, block_scan_type>(values, // input/output
+                                                            initial_value,
+                                                            reduction,
+                                                            storage.scan,
+                                                            scan_op);
+
+            if(flat_id == 0)
+            {
+                scan_state.set_complete(tile, reduction);
+            }
+        }
+        else
+        {
+            auto prefix_op = lookback_scan_prefix_op_type(tile, scan_op, scan_state);
+            lookback_block_scan<Exclusive, block_scan_type>(values, // input/output
+                                                            storage.scan,
+                                                            prefix_op,
+                                                            scan_op);
+        }
+        ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+        if(is_last_tile)
+        {
+            block_store_type().store(output, values, valid, storage.store);
+        }
+        else
+        {
+            block_store_type().store(output, values, storage.store);
+        }
+        ::rocprim::syncthreads(); // sync threads to reuse shared memory
+    }
+}
+
+// Prefix of the items of a lane in a logical warp scanning one row, computed from the
+// reductions of the items of the lanes. The exclusive prefix is initial_value combined with the
+// reductions of the previous lanes. The inclusive prefix is the combined reductions of the
+// previous lanes, it is not used by the first lane. A single thread scans its row alone.
+template<bool Exclusive,
+         unsigned int LogicalWarpSize,
+         class WarpScan,
+         class T,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+T batched_scan_rows_lane_prefix(std::true_type /*single thread*/,
+                                const T thread_reduction,
+                                const T initial_value,
+                                typename WarpScan::storage_type& /*storage*/,
+                                BinaryFunction /*scan_op*/)
+{
+    return Exclusive ? initial_value : thread_reduction;
+}
+
+template<bool Exclusive,
+         unsigned int LogicalWarpSize,
+         class WarpScan,
+         class T,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+T batched_scan_rows_lane_prefix(std::false_type /*single thread*/,
+                                const T thread_reduction,
+                                const T initial_value,
+                                typename WarpScan::storage_type& storage,
+                                BinaryFunction scan_op)
+{
+    T prefix;
+    if ROCPRIM_IF_CONSTEXPR(Exclusive)
+    {
+        WarpScan().exclusive_scan(thread_reduction, prefix, initial_value, storage, scan_op);
+    }
+    else
+    {
+        WarpScan().inclusive_scan(thread_reduction, prefix, storage, scan_op);
+        // The inclusive scan of the previous lane is the prefix of this lane
+        prefix = ::rocprim::warp_shuffle_up(prefix, 1, LogicalWarpSize);
+    }
+    return prefix;
+}
+
+// Scan of rows of row_length items, which are not longer than the items of a logical warp of
+// LogicalWarpSize threads. Every logical warp scans one row, so a block scans
+// block_size / LogicalWarpSize rows without synchronizing the threads of the block.
+template<bool Exclusive,
+         class Config,
+         unsigned int LogicalWarpSize,
+         class ResultType,
+         class InputIterator,
+         class OutputIterator,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void batched_scan_rows_warp_kernel_impl(InputIterator      input,
+                                        OutputIterator     output,
+                                        const unsigned int rows,
+                                        const unsigned int row_length,
+                                        ResultType         initial_value,
+                                        BinaryFunction     scan_op)
+{
+    using result_type = ResultType;
+
+    constexpr unsigned int block_size       = Config::block_size;
+    constexpr unsigned int items_per_thread = Config::items_per_thread;
+    constexpr unsigned int warps_per_block  = block_size / LogicalWarpSize;
+
+    // A single thread loads and stores its consecutive items directly
+    constexpr bool             single_thread = LogicalWarpSize == 1;
+    constexpr warp_load_method load_method = single_thread
+                                                 ? warp_load_method::warp_load_direct
+                                                 : warp_load_method::warp_load_transpose;
+    constexpr warp_store_method store_method = single_thread
+                                                   ? warp_store_method::warp_store_direct
+                                                   : warp_store_method::warp_store_transpose;
+
+    using warp_load_type
+        = ::rocprim::warp_load<result_type, items_per_thread, LogicalWarpSize, load_method>;
+    using warp_store_type
+        = ::rocprim::warp_store<result_type, items_per_thread, LogicalWarpSize, store_method>;
+    using warp_scan_type = ::rocprim::warp_scan<result_type, LogicalWarpSize>;
+
+    ROCPRIM_SHARED_MEMORY union
+    {
+        typename warp_load_type::storage_type  load[warps_per_block];
+        typename warp_store_type::storage_type store[warps_per_block];
+        typename warp_scan_type::storage_type  scan[warps_per_block];
+    } storage;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int warp_id = flat_id / LogicalWarpSize;
+    const unsigned int lane_id = ::rocprim::detail::logical_lane_id<LogicalWarpSize>();
+    const unsigned int row     = ::rocprim::detail::block_id<0>() * warps_per_block + warp_id;
+
+    // Logical warps past the last row scan it again without storing it, so the warp-level
+    // primitives of all logical warps of a hardware warp run together
+    const bool   is_valid_row = row < rows;
+    const size_t row_offset
+        = static_cast<size_t>(::rocprim::min(row, rows - 1)) * row_length;
+
+    result_type values[items_per_thread];
+    warp_load_type().load(input + row_offset,
+                          values,
+                          row_length,
+                          static_cast<result_type>(input[row_offset]),
+                          storage.load[warp_id]);
+    ::rocprim::wave_barrier();
+
+    result_type thread_reduction = values[0];
+    ROCPRIM_UNROLL
+    for(unsigned int i = 1; i < items_per_thread; i++)
+    {
+        thread_reduction = scan_op(thread_reduction, values[i]);
+    }
+
+    result_type prefix = batched_scan_rows_lane_prefix<Exclusive, LogicalWarpSize, warp_scan_type>(
+        std::integral_constant<bool, single_thread>(),
+        thread_reduction,
+        initial_value,
+        storage.scan[warp_id],
+        scan_op);
+    ::rocprim::wave_barrier();
+
+    if ROCPRIM_IF_CONSTEXPR(Exclusive)
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < items_per_thread; i++)
+        {
+            const result_type value = values[i];
+            values[i]               = prefix;
+            prefix                  = scan_op(prefix, value);
+        }
+    }
+    else
+    {
+        if(lane_id > 0)
+        {
+            values[0] = scan_op(prefix, values[0]);
+        }
+        ROCPRIM_UNROLL
+        for(unsigned int i = 1; i < items_per_thread; i++)
+        {
+            values[i] = scan_op(values[i - 1], values[i]);
+        }
+    }
+
+    if(is_valid_row)
+    {
+        warp_store_type().store(output + row_offset, values, row_length, storage.store[warp_id]);
+    }
+}
+
+// Decoupled look-back scan over the tiles of rows of row_length items. Every row has
+// tiles_per_row tiles, the first tile of a row sets its prefix to complete without looking
+// back, so the look-back of the other tiles never crosses the beginning of their row. Tiles are
+// processed in the order of their ids.
+template<bool Exclusive,
+         class Config,
+         class ResultType,
+         class InputIterator,
+         class OutputIterator,
+         class BinaryFunction,
+         class LookbackScanState>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void batched_scan_rows_kernel_impl(InputIterator                  input,
+                                   OutputIterator                 output,
+                                   const size_t                   row_length,
+                                   const unsigned int             tiles_per_row,
+                                   const unsigned int             number_of_tiles,
+                                   ResultType                     initial_value,
+                                   BinaryFunction                 scan_op,
+                                   LookbackScanState              scan_state,
+                                   ordered_block_id<unsigned int> ordered_bid)
+{
+    using result_type = ResultType;
+    static_assert(std::is_same<result_type, typename LookbackScanState::value_type>::value,
+                  "value_type of LookbackScanState must be result_type");
+
+    constexpr unsigned int block_size       = Config::block_size;
+    constexpr unsigned int items_per_thread = Config::items_per_thread;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+
+    using block_load_type
+        = ::rocprim::block_load<result_type, block_size, items_per_thread, Config::block_load_method>;
+    using block_store_type = ::rocprim::
+        block_store<result_type, block_size, items_per_thread, Config::block_store_method>;
+    using block_scan_type = ::rocprim::block_scan<result_type, block_size, Config::block_scan_method>;
+
+    using order_bid_type = ordered_block_id<unsigned int>;
+    using lookback_scan_prefix_op_type
+        = lookback_scan_prefix_op<result_type, BinaryFunction, LookbackScanState>;
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        typename order_bid_type::storage_type ordered_bid;
+        union
+        {
+            typename block_load_type::storage_type  load;
+            typename block_store_type::storage_type store;
+            typename block_scan_type::storage_type  scan;
+        };
+    } storage;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+
+    while(true)
+    {
+        const unsigned int tile = ordered_bid.get(flat_id, storage.ordered_bid);
+        if(tile >= number_of_tiles)
+        {
+            break;
+        }
+
+        const unsigned int row         = tile / tiles_per_row;
+        const unsigned int row_tile    = tile % tiles_per_row;
+        const size_t       tile_offset = static_cast<size_t>(row_tile) * items_per_block;
+        const bool         is_last_tile = row_tile == tiles_per_row - 1;
+        const unsigned int valid        = static_cast<unsigned int>(
+            ::rocprim::min<size_t>(row_length - tile_offset, items_per_block));
+
+        const size_t offset = static_cast<size_t>(row) * row_length + tile_offset;
+
+        result_type values[items_per_thread];
+        if(is_last_tile)
+        {
+            block_load_type().load(input + offset, values, valid, input[offset], storage.load);
+        }
+        else
+        {
+            block_load_type().load(input + offset, values, storage.load);
+        }
+        ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+        if(row_tile == 0)
+        {
+            result_type reduction;
+            lookback_block_scan<Exclusive, block_scan_type>(values, // input/output
+                                                            initial_value,
+                                                            reduction,
+                                                            storage.scan,
+                                                            scan_op);
+
+            if(flat_id == 0)
+            {
+                scan_state.set_complete(tile, reduction);
+            }
+        }
+        else
+        {
+            auto prefix_op = lookback_scan_prefix_op_type(tile, scan_op, scan_state);
+            lookback_block_scan<Exclusive, block_scan_type>(values, // input/output
+                                                            storage.scan,
+                                                            prefix_op,
+                                                            scan_op);
+        }
+        ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+        if(is_last_tile)
+        {
+            block_store_type().store(output + offset, values, valid, storage.store);
+        }
+        else
+        {
+            block_store_type().store(output + offset, values, storage.store);
+        }
+        ::rocprim::syncthreads(); // sync threads to reuse shared memory
+    }
+}
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_BATCHED_SCAN_HPP_
@@ -21,6 +21,18 @@
 #ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_BINARY_SEARCH_HPP_
 #define ROCPRIM_DEVICE_DETAIL_DEVICE_BINARY_SEARCH_HPP_
 
+#include <iterator>
+
+#include "../../config.hpp"
+#include "../../detail/merge_path.hpp"
+#include "../../detail/various.hpp"
+#include "../../functional.hpp"
+#include "../../intrinsics.hpp"
+
+#include "../../block/block_reduce.hpp"
+
+#include "device_merge.hpp"
+
 BEGIN_ROCPRIM_NAMESPACE
 
 namespace detail
@@ -113,6 +125,292 @@ struct binary_search_op
     }
 };
 
+// Sorted needles are merged with the haystack along the merge path, so both ranges are read
+// once. For lower bound the needles are the first range and a needle is placed before the equal
+// haystack values, for upper bound the needles are the second range and a needle is placed after
+// them. The result of a needle is the number of haystack values before it in the merged order.
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    bool NeedlesFirst,
+    class IndexIterator,
+    class InputIterator1,
+    class InputIterator2,
+    class OutputIterator,
+    class CompareFunction
+>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void sorted_search_kernel_impl(IndexIterator indices,
+                               InputIterator1 input1,
+                               InputIterator2 input2,
+                               OutputIterator output,
+                               const size_t input1_size,
+                               const size_t input2_size,
+                               CompareFunction compare_function)
+{
+    using input1_type = typename std::iterator_traits<InputIterator1>::value_type;
+    using input2_type = typename std::iterator_traits<InputIterator2>::value_type;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        typename detail::raw_storage<input1_type[items_per_block]> input1;
+        typename detail::raw_storage<input2_type[items_per_block]> input2;
+    } storage;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int flat_block_id = ::rocprim::detail::block_id<0>();
+
+    const range_t range =
+        compute_range(
+            flat_block_id, input1_size, input2_size, items_per_block,
+            indices[flat_block_id], indices[flat_block_id + 1]
+        );
+    const unsigned int count1 = range.count1();
+    const unsigned int count2 = range.count2();
+
+    input1_type* input1_shared = storage.input1.get();
+    input2_type* input2_shared = storage.input2.get();
+    for(unsigned int i = flat_id; i < count1; i += BlockSize)
+    {
+        input1_shared[i] = input1[range.begin1 + i];
+    }
+    for(unsigned int i = flat_id; i < count2; i += BlockSize)
+    {
+        input2_shared[i] = input2[range.begin2 + i];
+    }
+    ::rocprim::syncthreads();
+
+    const unsigned int diag = min(flat_id * ItemsPerThread, count1 + count2);
+    unsigned int i1 =
+        merge_path(
+            input1_shared, input2_shared, count1, count2, diag, compare_function
+        );
+    unsigned int i2 = diag - i1;
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; ++i)
+    {
+        if(i1 + i2 < count1 + count2)
+        {
+            const bool take1 = (i2 >= count2)
+                || ((i1 < count1) && !compare_function(input2_shared[i2], input1_shared[i1]));
+            if(take1 == NeedlesFirst)
+            {
+                const unsigned int needle = NeedlesFirst ? range.begin1 + i1 : range.begin2 + i2;
+                output[needle] = NeedlesFirst ? range.begin2 + i2 : range.begin1 + i1;
+            }
+            if(take1)
+            {
+                ++i1;
+            }
+            else
+            {
+                ++i2;
+            }
+        }
+    }
+}
+
+// The search index of a haystack holds every spacing-th element of the haystack, entries past
+// the end of the haystack repeat its last element.
+inline size_t get_search_index_spacing(size_t haystack_size, unsigned int index_size)
+{
+    return ::rocprim::max<size_t>(1, ceiling_div<size_t>(haystack_size, index_size));
+}
+
+template<class HaystackIterator>
+struct search_index_op
+{
+    HaystackIterator haystack;
+    size_t           haystack_size;
+    size_t           spacing;
+
+    ROCPRIM_HOST_DEVICE inline
+    typename std::iterator_traits<HaystackIterator>::value_type operator()(size_t i) const
+    {
+        return haystack[::rocprim::min(i * spacing, haystack_size - 1)];
+    }
+};
+
+// The index is searched in shared memory first. If c entries of the index are before the needle,
+// the result is within (index[c - 1], index[c]], so only spacing elements of the haystack
+// are searched.
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    class HaystackIterator,
+    class IndexType,
+    class NeedlesIterator,
+    class OutputIterator,
+    class SearchFunction,
+    class CompareFunction
+>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void indexed_search_kernel_impl(HaystackIterator haystack,
+                                const IndexType* index,
+                                const unsigned int index_size,
+                                NeedlesIterator needles,
+                                OutputIterator output,
+                                const size_t haystack_size,
+                                const size_t needles_size,
+                                const size_t spacing,
+                                SearchFunction search_op,
+                                CompareFunction compare_op,
+                                IndexType* index_shared)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int flat_block_id = ::rocprim::detail::block_id<0>();
+    const unsigned int number_of_blocks = ::rocprim::detail::grid_size<0>();
+
+    // The index is loaded once and used for all tiles of the block
+    for(unsigned int i = flat_id; i < index_size; i += BlockSize)
+    {
+        index_shared[i] = index[i];
+    }
+    ::rocprim::syncthreads();
+
+    const size_t tiles = ceiling_div<size_t>(needles_size, items_per_block);
+    for(size_t tile = flat_block_id; tile < tiles; tile += number_of_blocks)
+    {
+        const size_t tile_offset = tile * items_per_block;
+
+        ROCPRIM_UNROLL
+        for(unsigned int item = 0; item < ItemsPerThread; ++item)
+        {
+            const size_t i = tile_offset + item * BlockSize + flat_id;
+            if(i < needles_size)
+            {
+                const auto value = needles[i];
+                const size_t entries = search_op(index_shared, index_size, value, compare_op);
+                const size_t first
+                    = ::rocprim::min(entries == 0 ? 0 : (entries - 1) * spacing + 1, haystack_size);
+                const size_t last = ::rocprim::min(entries * spacing, haystack_size);
+                output[i] = first + search_op(haystack + first, last - first, value, compare_op);
+            }
+        }
+    }
+}
+
+// Every needle is searched in its segment [haystack_offsets[s], haystack_offsets[s + 1]) of the
+// haystack, the result is relative to the beginning of the segment. If the segments of the
+// needles of a tile span at most StagedHaystackSize elements of the haystack (e.g. the needles
+// are sorted by segment and the segments are small), the span is loaded to shared memory once
+// and all needles of the tile are searched there.
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int StagedHaystackSize,
+    class HaystackIterator,
+    class OffsetIterator,
+    class NeedlesIterator,
+    class SegmentIterator,
+    class OutputIterator,
+    class SearchFunction,
+    class CompareFunction
+>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void segmented_search_kernel_impl(HaystackIterator haystack,
+                                  OffsetIterator haystack_offsets,
+                                  NeedlesIterator needles,
+                                  SegmentIterator needle_segments,
+                                  OutputIterator output,
+                                  const size_t needles_size,
+                                  SearchFunction search_op,
+                                  CompareFunction compare_op)
+{
+    using haystack_type = typename std::iterator_traits<HaystackIterator>::value_type;
+    using reduce_type = block_reduce<unsigned int, BlockSize>;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        typename reduce_type::storage_type reduce;
+        unsigned int first_segment;
+        unsigned int last_segment;
+        typename detail::raw_storage<haystack_type[StagedHaystackSize]> haystack;
+    } storage;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int flat_block_id = ::rocprim::detail::block_id<0>();
+
+    const size_t tile_offset = static_cast<size_t>(flat_block_id) * items_per_block;
+    const unsigned int valid_count = static_cast<unsigned int>(
+        ::rocprim::min<size_t>(needles_size - tile_offset, items_per_block));
+
+    unsigned int segments[ItemsPerThread];
+    unsigned int thread_first_segment = ~0u;
+    unsigned int thread_last_segment = 0;
+    ROCPRIM_UNROLL
+    for(unsigned int item = 0; item < ItemsPerThread; ++item)
+    {
+        const unsigned int i = item * BlockSize + flat_id;
+        if(i < valid_count)
+        {
+            segments[item] = static_cast<unsigned int>(needle_segments[tile_offset + i]);
+            thread_first_segment = ::rocprim::min(thread_first_segment, segments[item]);
+            thread_last_segment = ::rocprim::max(thread_last_segment, segments[item]);
+        }
+    }
+
+    unsigned int first_segment;
+    reduce_type().reduce(
+        thread_first_segment, first_segment, storage.reduce, ::rocprim::minimum<unsigned int>());
+    if(flat_id == 0)
+    {
+        storage.first_segment = first_segment;
+    }
+    ::rocprim::syncthreads();
+    unsigned int last_segment;
+    reduce_type().reduce(
+        thread_last_segment, last_segment, storage.reduce, ::rocprim::maximum<unsigned int>());
+    if(flat_id == 0)
+    {
+        storage.last_segment = last_segment;
+    }
+    ::rocprim::syncthreads();
+
+    const size_t span_begin = haystack_offsets[storage.first_segment];
+    const size_t span_size = static_cast<size_t>(haystack_offsets[storage.last_segment + 1])
+        - span_begin;
+    const bool staged = span_size <= StagedHaystackSize;
+
+    haystack_type* haystack_shared = storage.haystack.get();
+    if(staged)
+    {
+        for(unsigned int i = flat_id; i < span_size; i += BlockSize)
+        {
+            haystack_shared[i] = haystack[span_begin + i];
+        }
+        ::rocprim::syncthreads();
+    }
+
+    ROCPRIM_UNROLL
+    for(unsigned int item = 0; item < ItemsPerThread; ++item)
+    {
+        const unsigned int i = item * BlockSize + flat_id;
+        if(i < valid_count)
+        {
+            const auto value = needles[tile_offset + i];
+            const size_t begin = haystack_offsets[segments[item]];
+            const size_t size = static_cast<size_t>(haystack_offsets[segments[item] + 1]) - begin;
+            if(staged)
+            {
+                output[tile_offset + i] = search_op(
+                    haystack_shared + (begin - span_begin), size, value, compare_op);
+            }
+            else
+            {
+                output[tile_offset + i] = search_op(haystack + begin, size, value, compare_op);
+            }
+        }
+    }
+}
+
 } // end of detail namespace
 
 END_ROCPRIM_NAMESPACE
@@ -0,0 +1,131 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_BITMASK_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_BITMASK_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../intrinsics.hpp"
+#include "../../types.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+template<class Word>
+struct is_bitmask_word
+    : std::integral_constant<bool,
+                             std::is_same<Word, unsigned int>::value
+                                 || std::is_same<Word, unsigned long long>::value
+                                 || std::is_same<Word, unsigned long>::value>
+{};
+
+// The bit of the item index of a bitmask, the bits of a word are the items in order from the
+// least significant bit (like the validity bitmaps of Apache Arrow)
+template<class WordIterator>
+struct bitmask_bit_op
+{
+    using word_type = typename std::iterator_traits<WordIterator>::value_type;
+    static constexpr unsigned int word_bits = sizeof(word_type) * 8;
+
+    WordIterator words;
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator()(const size_t index) const
+    {
+        WordIterator words_it = words;
+        return (static_cast<word_type>(words_it[index / word_bits]) >> (index % word_bits)) & 1u;
+    }
+};
+
+// Every warp packs the results of the predicate of warp_size consecutive items with a ballot into
+// 32-bit parts of the tile in shared memory, then the complete words are written coalesced. The
+// items after size are not selected, the words after the last item are not written.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class Word,
+         class InputIterator,
+         class WordIterator,
+         class UnaryPredicate>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void predicate_to_bitmask_kernel_impl(InputIterator  input,
+                                      WordIterator   words,
+                                      const size_t   size,
+                                      UnaryPredicate predicate)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    constexpr unsigned int word_bits       = sizeof(Word) * 8;
+    constexpr unsigned int words_per_block = items_per_block / word_bits;
+    constexpr unsigned int parts_per_word  = word_bits / 32;
+    constexpr unsigned int parts_per_warp  = ::rocprim::device_warp_size() / 32;
+    static_assert(items_per_block % word_bits == 0 && BlockSize % 64 == 0,
+                  "A tile must consist of complete words of complete warps");
+
+    ROCPRIM_SHARED_MEMORY unsigned int parts[items_per_block / 32];
+
+    const unsigned int flat_id      = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int lane_id      = ::rocprim::lane_id();
+    const size_t       block_offset = size_t(::rocprim::detail::block_id<0>()) * items_per_block;
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        const unsigned int   item     = i * BlockSize + flat_id;
+        const size_t         index    = block_offset + item;
+        const bool           selected = index < size && predicate(input[index]);
+        const lane_mask_type mask     = ::rocprim::ballot(selected);
+        if(lane_id < parts_per_warp)
+        {
+            // item - lane_id is the first item of the warp
+            parts[(item - lane_id) / 32 + lane_id]
+                = static_cast<unsigned int>(mask >> (32 * lane_id));
+        }
+    }
+    ::rocprim::syncthreads();
+
+    const size_t words_offset = block_offset / word_bits;
+    const size_t total_words  = ::rocprim::detail::ceiling_div(size, word_bits);
+    for(unsigned int w = flat_id; w < words_per_block; w += BlockSize)
+    {
+        if(words_offset + w < total_words)
+        {
+            Word word = 0;
+            ROCPRIM_UNROLL
+            for(unsigned int p = 0; p < parts_per_word; p++)
+            {
+                word |= static_cast<Word>(parts[w * parts_per_word + p]) << (32 * p);
+            }
+            words[words_offset + w] = word;
+        }
+    }
+}
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_BITMASK_HPP_
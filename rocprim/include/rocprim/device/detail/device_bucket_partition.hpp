@@ -0,0 +1,327 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_BUCKET_PARTITION_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_BUCKET_PARTITION_HPP_
+
+#include <iterator>
+#include <type_traits>
+
+#include "../../config.hpp"
+#include "../../detail/radix_sort.hpp"
+#include "../../detail/various.hpp"
+#include "../../functional.hpp"
+#include "../../intrinsics.hpp"
+#include "../../intrinsics/atomic.hpp"
+#include "../../types.hpp"
+
+#include "../../block/block_discontinuity.hpp"
+#include "../../block/block_exchange.hpp"
+#include "../../block/block_load.hpp"
+#include "../../block/block_radix_sort.hpp"
+#include "../../block/block_scan.hpp"
+
+#include "device_radix_sort.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// The temporary storage has an offset for every pair of a bucket and a block, the offsets of a
+// bucket are contiguous: counts[bucket * number_of_blocks + block]. An exclusive scan of the
+// counts gives every block the position of its first item of every bucket in the output.
+using bucket_partition_offset = size_t;
+
+// Every block counts the buckets of the items of its contiguous range of tiles, in shared memory
+// when there are at most Config::shared_buckets buckets, otherwise with global atomics into
+// counts that are zeroed before.
+template<class Config, class KeysInputIterator, class BucketOp>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void bucket_partition_histogram_kernel_impl(KeysInputIterator        keys_input,
+                                            const size_t             size,
+                                            const size_t             tiles_per_block,
+                                            const unsigned int       num_buckets,
+                                            BucketOp                 bucket_op,
+                                            bucket_partition_offset* counts)
+{
+    static_assert(sizeof(bucket_partition_offset) == sizeof(unsigned long long),
+                  "The counts are incremented by 64-bit atomics");
+
+    constexpr unsigned int block_size       = Config::block_size;
+    constexpr unsigned int items_per_thread = Config::items_per_thread;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+
+    ROCPRIM_SHARED_MEMORY unsigned int histogram[Config::shared_buckets];
+
+    const unsigned int flat_id          = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int flat_block_id    = ::rocprim::detail::block_id<0>();
+    const unsigned int number_of_blocks = ::rocprim::detail::grid_size<0>();
+
+    const bool   shared_histogram = num_buckets <= Config::shared_buckets;
+    const size_t number_of_tiles  = ceiling_div(size, items_per_block);
+    const size_t first_tile       = flat_block_id * tiles_per_block;
+    const size_t last_tile = ::rocprim::min(first_tile + tiles_per_block, number_of_tiles);
+
+    if(shared_histogram)
+    {
+        for(unsigned int bucket = flat_id; bucket < num_buckets; bucket += block_size)
+        {
+            histogram[bucket] = 0;
+        }
+    }
+    ::rocprim::syncthreads();
+
+    for(size_t tile = first_tile; tile < last_tile; tile++)
+    {
+        const size_t       tile_offset = tile * items_per_block;
+        const unsigned int valid_in_tile = static_cast<unsigned int>(
+            ::rocprim::min<size_t>(size - tile_offset, items_per_block));
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < items_per_thread; i++)
+        {
+            const unsigned int index = i * block_size + flat_id;
+            if(index < valid_in_tile)
+            {
+                const unsigned int bucket
+                    = static_cast<unsigned int>(bucket_op(keys_input[tile_offset + index]));
+                if(shared_histogram)
+                {
+                    ::rocprim::detail::atomic_add(&histogram[bucket], 1u);
+                }
+                else
+                {
+                    ::rocprim::detail::atomic_add(
+                        reinterpret_cast<unsigned long long*>(
+                            &counts[static_cast<size_t>(bucket) * number_of_blocks
+                                    + flat_block_id]),
+                        1ull);
+                }
+            }
+        }
+    }
+    ::rocprim::syncthreads();
+
+    if(shared_histogram)
+    {
+        for(unsigned int bucket = flat_id; bucket < num_buckets; bucket += block_size)
+        {
+            counts[static_cast<size_t>(bucket) * number_of_blocks + flat_block_id]
+                = histogram[bucket];
+        }
+    }
+}
+
+// Every block scatters the items of its contiguous range of tiles in order, so the partition is
+// stable. The buckets of a tile are sorted with their positions in the tile by a stable block radix
+// sort, then the items of a bucket are consecutive in the tile: the destination of an item is the
+// offset of its bucket in the block plus its rank in the run of the bucket. The destinations are
+// exchanged to a striped arrangement before the items are written, so consecutive threads write
+// consecutive items of the runs. The offsets of the block are advanced in global memory by the
+// last item of every run.
+template<class Config,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class KeysOutputIterator,
+         class ValuesOutputIterator,
+         class BucketOffsetIterator,
+         class BucketOp>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void bucket_partition_scatter_kernel_impl(KeysInputIterator        keys_input,
+                                          ValuesInputIterator      values_input,
+                                          KeysOutputIterator       keys_output,
+                                          ValuesOutputIterator     values_output,
+                                          const size_t             size,
+                                          const size_t             tiles_per_block,
+                                          const unsigned int       num_buckets,
+                                          const unsigned int       bucket_bits,
+                                          BucketOp                 bucket_op,
+                                          bucket_partition_offset* offsets,
+                                          BucketOffsetIterator     bucket_offsets)
+{
+    constexpr unsigned int block_size       = Config::block_size;
+    constexpr unsigned int items_per_thread = Config::items_per_thread;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+
+    using key_type   = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+
+    static constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+
+    using block_load_type = ::rocprim::block_load<key_type,
+                                                  block_size,
+                                                  items_per_thread,
+                                                  block_load_method::block_load_transpose>;
+    using sort_type = ::rocprim::block_radix_sort<unsigned int,
+                                                  block_size,
+                                                  items_per_thread,
+                                                  unsigned int,
+                                                  1,
+                                                  1,
+                                                  radix_float_order::signed_zeros_equal,
+                                                  identity_decomposer,
+                                                  block_radix_sort_bits_per_pass>;
+    using discontinuity_type = ::rocprim::block_discontinuity<unsigned int, block_size>;
+    using scan_type          = ::rocprim::block_scan<unsigned int, block_size>;
+    using offset_exchange_type
+        = ::rocprim::block_exchange<bucket_partition_offset, block_size, items_per_thread>;
+    using index_exchange_type
+        = ::rocprim::block_exchange<unsigned int, block_size, items_per_thread>;
+
+    ROCPRIM_SHARED_MEMORY union
+    {
+        typename block_load_type::storage_type      load;
+        typename sort_type::storage_type            sort;
+        typename discontinuity_type::storage_type   discontinuity;
+        typename scan_type::storage_type            scan;
+        typename offset_exchange_type::storage_type offset_exchange;
+        typename index_exchange_type::storage_type  index_exchange;
+    } storage;
+
+    const unsigned int flat_id          = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int flat_block_id    = ::rocprim::detail::block_id<0>();
+    const unsigned int number_of_blocks = ::rocprim::detail::grid_size<0>();
+
+    // The offsets of the buckets are the offsets of the first block, they are stored before the
+    // first block advances them
+    if(flat_block_id == 0)
+    {
+        for(unsigned int bucket = flat_id; bucket < num_buckets; bucket += block_size)
+        {
+            bucket_offsets[bucket] = offsets[static_cast<size_t>(bucket) * number_of_blocks];
+        }
+        if(flat_id == 0)
+        {
+            bucket_offsets[num_buckets] = size;
+        }
+    }
+    ::rocprim::syncthreads();
+
+    const size_t number_of_tiles = ceiling_div(size, items_per_block);
+    const size_t first_tile      = flat_block_id * tiles_per_block;
+    const size_t last_tile = ::rocprim::min(first_tile + tiles_per_block, number_of_tiles);
+
+    for(size_t tile = first_tile; tile < last_tile; tile++)
+    {
+        const size_t       tile_offset = tile * items_per_block;
+        const unsigned int valid_in_tile = static_cast<unsigned int>(
+            ::rocprim::min<size_t>(size - tile_offset, items_per_block));
+
+        key_type keys[items_per_thread];
+        if(valid_in_tile == items_per_block)
+        {
+            block_load_type().load(keys_input + tile_offset, keys, storage.load);
+        }
+        else
+        {
+            block_load_type().load(keys_input + tile_offset, keys, valid_in_tile, storage.load);
+        }
+
+        // Items past the size get the bucket num_buckets, which is sorted after all buckets
+        unsigned int buckets[items_per_thread];
+        unsigned int indices[items_per_thread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < items_per_thread; i++)
+        {
+            indices[i] = flat_id * items_per_thread + i;
+            buckets[i] = indices[i] < valid_in_tile
+                             ? static_cast<unsigned int>(bucket_op(keys[i]))
+                             : num_buckets;
+        }
+        ::rocprim::syncthreads();
+
+        sort_type().sort(buckets, indices, storage.sort, 0, bucket_bits);
+        ::rocprim::syncthreads();
+
+        bool heads[items_per_thread];
+        bool tails[items_per_thread];
+        discontinuity_type().flag_heads_and_tails(heads,
+                                                  tails,
+                                                  buckets,
+                                                  ::rocprim::not_equal_to<unsigned int>(),
+                                                  storage.discontinuity);
+        ::rocprim::syncthreads();
+
+        // The start of the run of every item is the last head before it
+        unsigned int run_starts[items_per_thread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < items_per_thread; i++)
+        {
+            run_starts[i] = heads[i] ? flat_id * items_per_thread + i : 0;
+        }
+        scan_type().inclusive_scan(run_starts,
+                                   run_starts,
+                                   storage.scan,
+                                   ::rocprim::maximum<unsigned int>());
+
+        bucket_partition_offset destinations[items_per_thread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < items_per_thread; i++)
+        {
+            const unsigned int position = flat_id * items_per_thread + i;
+            destinations[i]
+                = buckets[i] < num_buckets
+                      ? offsets[static_cast<size_t>(buckets[i]) * number_of_blocks + flat_block_id]
+                            + (position - run_starts[i])
+                      : 0;
+        }
+        // All items read the offsets of their runs before they are advanced
+        ::rocprim::syncthreads();
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < items_per_thread; i++)
+        {
+            if(tails[i] && buckets[i] < num_buckets)
+            {
+                offsets[static_cast<size_t>(buckets[i]) * number_of_blocks + flat_block_id]
+                    = destinations[i] + 1;
+            }
+        }
+
+        offset_exchange_type().blocked_to_striped(destinations,
+                                                  destinations,
+                                                  storage.offset_exchange);
+        ::rocprim::syncthreads();
+        index_exchange_type().blocked_to_striped(indices, indices, storage.index_exchange);
+
+        // The items are read again from the tile, which was just loaded
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < items_per_thread; i++)
+        {
+            if(i * block_size + flat_id < valid_in_tile)
+            {
+                const size_t source = tile_offset + indices[i];
+                keys_output[destinations[i]] = keys_input[source];
+                if ROCPRIM_IF_CONSTEXPR(with_values)
+                {
+                    values_output[destinations[i]] = values_input[source];
+                }
+            }
+        }
+        ::rocprim::syncthreads();
+    }
+}
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_BUCKET_PARTITION_HPP_
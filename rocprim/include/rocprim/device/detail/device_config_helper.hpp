@@ -29,6 +29,7 @@
 #include "../../block/block_load.hpp"
 #include "../../block/block_reduce.hpp"
 #include "../../block/block_scan.hpp"
+#include "../../block/block_sort.hpp"
 #include "../../block/block_store.hpp"
 
 #include "../config_types.hpp"
@@ -47,14 +48,20 @@ template<unsigned int SortBlockSize,
          unsigned int MergeImplMPPartitionBlockSize,
          unsigned int MergeImplMPBlockSize,
          unsigned int MergeImplMPItemsPerThread,
-         unsigned int MinInputSizeMergepath>
+         unsigned int MinInputSizeMergepath,
+         unsigned int IndirectValueSizeThreshold,
+         block_sort_algorithm SortAlgorithm,
+         bool                 DetectSortedRuns>
 struct merge_sort_config_impl
 {
     using sort_config                      = kernel_config<SortBlockSize, SortItemsPerThread>;
     using merge_impl1_config               = kernel_config<MergeImpl1BlockSize, 1>;
     using merge_mergepath_partition_config = kernel_config<MergeImplMPPartitionBlockSize, 1>;
     using merge_mergepath_config = kernel_config<MergeImplMPBlockSize, MergeImplMPItemsPerThread>;
-    static constexpr unsigned int min_input_size_mergepath = MinInputSizeMergepath;
+    static constexpr unsigned int min_input_size_mergepath      = MinInputSizeMergepath;
+    static constexpr unsigned int indirect_value_size_threshold = IndirectValueSizeThreshold;
+    static constexpr block_sort_algorithm sort_algorithm        = SortAlgorithm;
+    static constexpr bool                 detect_sorted_runs    = DetectSortedRuns;
 };
 
 } // namespace detail
@@ -68,6 +75,15 @@ struct merge_sort_config_impl
 /// \tparam MergeImplMPBlockSize - block size in the block merge step using mergepath impl
 /// \tparam MergeImplMPItemsPerThread - ItemsPerThread in the block merge step using mergepath impl
 /// \tparam MinInputSizeMergepath - breakpoint of input-size to use mergepath impl for block merge step
+/// \tparam IndirectValueSizeThreshold - values larger than this (in bytes) are not moved by the
+/// sort and merge steps: (key, index) pairs are sorted instead and the values are gathered once
+/// \tparam SortAlgorithm - block_sort algorithm of the block-sort step. With
+/// block_sort_algorithm::merge_sort, which is stable, the keys are sorted with their indices as
+/// values instead of (key, index) pairs, and \p SortItemsPerThread can be any number.
+/// \tparam DetectSortedRuns - when true, tiles of the block-sort step which are already sorted
+/// are not sorted, and inputs larger than \p MinInputSizeMergepath are sorted by a natural merge
+/// sort: the sorted runs are detected after the block-sort step and only runs are merged, so
+/// inputs made of a few long sorted runs need fewer merge passes.
 template<unsigned int     MergeImpl1BlockSize           = 512,
          unsigned int     SortBlockSize                 = MergeImpl1BlockSize,
          unsigned int     SortItemsPerThread            = 1,
@@ -75,14 +91,20 @@ template<unsigned int     MergeImpl1BlockSize           = 512,
          unsigned int     MergeImplMPBlockSize          = std::min(SortBlockSize, 128u),
          unsigned int     MergeImplMPItemsPerThread
          = SortBlockSize* SortItemsPerThread / MergeImplMPBlockSize,
-         unsigned int     MinInputSizeMergepath = 200000>
+         unsigned int     MinInputSizeMergepath         = 200000,
+         unsigned int     IndirectValueSizeThreshold    = 32,
+         block_sort_algorithm SortAlgorithm             = block_sort_algorithm::default_algorithm,
+         bool                 DetectSortedRuns          = false>
 using merge_sort_config = detail::merge_sort_config_impl<SortBlockSize,
                                                          SortItemsPerThread,
                                                          MergeImpl1BlockSize,
                                                          MergeImplMPPartitionBlockSize,
                                                          MergeImplMPBlockSize,
                                                          MergeImplMPItemsPerThread,
-                                                         MinInputSizeMergepath>;
+                                                         MinInputSizeMergepath,
+                                                         IndirectValueSizeThreshold,
+                                                         SortAlgorithm,
+                                                         DetectSortedRuns>;
 
 namespace detail
 {
@@ -137,6 +159,48 @@ struct default_merge_sort_config_base : default_merge_sort_config_base_helper<Ke
 /// \tparam ShortRadixBits - number of bits in short iterations, must be equal to or less than \p LongRadixBits.
 /// \tparam ScanConfig - configuration of digits scan kernel. Must be \p kernel_config.
 /// \tparam SortConfig - configuration of radix sort kernel. Must be \p kernel_config.
+/// \tparam SortSingleConfig - configuration of the single block radix sort kernel.
+/// \tparam SortMergeConfig - configuration of the radix sort merge kernel.
+/// \tparam MergeSizeLimitBlocks - limit number of blocks to use merge kernel.
+/// \tparam ForceSingleKernelConfig - force use radix sort single kernel configuration.
+/// \tparam UseOnesweep - when true, inputs that are too large for the merge kernel are
+/// sorted with the onesweep algorithm: a single histogram pass computes the digit counts
+/// of all iterations, then every iteration is one fused ranking and scattering kernel that
+/// obtains global digit offsets with decoupled look-back. All iterations use \p LongRadixBits.
+/// \tparam OnesweepHistogramConfig - configuration of the onesweep histogram kernel.
+/// \tparam OnesweepSortConfig - configuration of the onesweep sort and scatter kernel.
+/// \tparam StoreCacheModifier - cache modifier of the stores of the sorted keys and values to
+/// the outputs, it is applied when they are pointers. The outputs also hold the
+/// intermediate results of the iterations, so only the kernel writing the final result uses it.
+/// \tparam ScatterRunLength - when not 0, the sort and scatter kernels write the runs of a digit
+/// that have at least \p ScatterRunLength items of a tile as segments aligned to
+/// \p ScatterRunLength items of the output, so that their writes are combined into full memory
+/// transactions. It needs more shared memory, 0 writes the tile in the striped arrangement.
+/// \tparam CheckSortedInput - when true, inputs that are too large for the merge kernel are
+/// checked for being sorted or strictly reverse sorted in the first pass over the keys, which
+/// already reads all of them. Such inputs are copied or reversed instead of sorted, the check
+/// costs a comparison of every key with its predecessor.
+/// \tparam CompressKeyRange - when true, the minimum and the maximum of 32-bit and 64-bit integer
+/// keys sorted on all bits are found in the first pass over the keys. If the keys span a range
+/// that needs at least two passes less than the keys, the minimum is subtracted from the keys,
+/// only the bits of the range are sorted and the minimum is added back to the sorted keys.
+/// It applies to inputs that are too large for the merge kernel and to pointer key outputs.
+/// \tparam CooperativeSizeLimit - when larger than the limit of the merge kernel, inputs that are
+/// too large for the merge kernel and have at most \p CooperativeSizeLimit items are sorted by a
+/// single kernel launch instead of four launches per iteration. Its grid is not larger than the
+/// number of blocks that are resident at once and all iterations are made by the same blocks,
+/// which wait for each other between the phases of an iteration. All iterations use
+/// \p LongRadixBits, iterations that do not change the order of the keys are skipped on the
+/// device. The kernel is launched by \p hipLaunchCooperativeKernel, which guarantees that all
+/// blocks are resident at once; on devices without cooperative launches
+/// (\p hipDeviceAttributeCooperativeLaunch is 0) these inputs are sorted like larger inputs.
+/// The grid is sized by the occupancy of all compute units of the device, so on a stream
+/// restricted by a compute unit mask the launch can fail with
+/// \p hipErrorCooperativeLaunchTooLarge; use 0 for such streams. 0 disables it.
+/// \tparam IndirectValueSizeThreshold - values larger than this (in bytes) are not moved by the
+/// iterations of inputs that are too large for the merge kernel: (key, index) pairs are sorted
+/// and the values are gathered once by their sorted indices. It does not apply if the double
+/// buffer of the values is given.
 template<unsigned int LongRadixBits,
          unsigned int ShortRadixBits,
          class ScanConfig,
@@ -144,7 +208,16 @@ template<unsigned int LongRadixBits,
          class SortSingleConfig               = kernel_config<256, 10>,
          class SortMergeConfig                = kernel_config<1024, 1>,
          unsigned int MergeSizeLimitBlocks    = 1024U,
-         bool         ForceSingleKernelConfig = false>
+         bool         ForceSingleKernelConfig = false,
+         bool         UseOnesweep             = false,
+         class OnesweepHistogramConfig        = kernel_config<256, 8>,
+         class OnesweepSortConfig             = SortConfig,
+         cache_store_modifier StoreCacheModifier = store_default,
+         unsigned int         ScatterRunLength   = 0,
+         bool                 CheckSortedInput   = false,
+         bool                 CompressKeyRange   = false,
+         unsigned int         CooperativeSizeLimit = 0,
+         unsigned int         IndirectValueSizeThreshold = 16>
 struct radix_sort_config
 {
     /// \brief Number of bits in long iterations.
@@ -164,6 +237,24 @@ struct radix_sort_config
     using sort_merge = SortMergeConfig;
     /// \brief Force use radix sort single kernel configuration.
     static constexpr bool force_single_kernel_config = ForceSingleKernelConfig;
+    /// \brief Use the onesweep algorithm for large inputs.
+    static constexpr bool use_onesweep = UseOnesweep;
+    /// \brief Configuration of onesweep histogram kernel.
+    using onesweep_histogram = OnesweepHistogramConfig;
+    /// \brief Configuration of onesweep sort and scatter kernel.
+    using onesweep = OnesweepSortConfig;
+    /// \brief Cache modifier of the stores of the sorted keys and values to the outputs.
+    static constexpr cache_store_modifier store_cache_modifier = StoreCacheModifier;
+    /// \brief Minimum number of items of the runs written as aligned segments, 0 if disabled.
+    static constexpr unsigned int scatter_run_length = ScatterRunLength;
+    /// \brief Whether sorted and strictly reverse sorted inputs are detected and copied.
+    static constexpr bool check_sorted_input = CheckSortedInput;
+    /// \brief Whether narrow ranges of integer keys are sorted on the bits of the range only.
+    static constexpr bool compress_key_range = CompressKeyRange;
+    /// \brief Largest input sorted by the single cooperative kernel, 0 if disabled.
+    static constexpr unsigned int cooperative_size_limit = CooperativeSizeLimit;
+    /// \brief Values larger than this are sorted as indices and gathered once.
+    static constexpr unsigned int indirect_value_size_threshold = IndirectValueSizeThreshold;
 };
 
 namespace detail
@@ -227,7 +318,21 @@ struct default_radix_sort_config_base_helper<Key, empty_type>
                                                      6,
                                                      kernel_config<256, 2>,
                                                      kernel_config<256, 15>,
-                                                     kernel_config<256, 12>>>>
+                                                     kernel_config<256, 12>>>,
+                  radix_sort_config<
+                      6,
+                      4,
+                      kernel_config<256, 2>,
+                      kernel_config<256,
+                                    ::rocprim::max(1u,
+                                                   15u
+                                                       / ::rocprim::detail::ceiling_div<unsigned int, unsigned int>(
+                                                           sizeof(Key), sizeof(int)))>,
+                      kernel_config<256,
+                                    ::rocprim::max(1u,
+                                                   10u
+                                                       / ::rocprim::detail::ceiling_div<unsigned int, unsigned int>(
+                                                           sizeof(Key), sizeof(int)))>>>
 {};
 
 template<class Value, class Key>
@@ -236,17 +341,47 @@ struct default_radix_sort_config_base : default_radix_sort_config_base_helper<Ke
 
 } // namespace detail
 
+/// \brief Algorithms of device-level segmented reduce.
+enum class segmented_reduce_algorithm
+{
+    /// \brief The algorithm is selected from the average length of the segments.
+    automatic,
+    /// \brief Every segment is reduced by a block.
+    block_per_segment,
+    /// \brief Every segment is reduced by a logical warp, suitable for segments of
+    /// up to a few hundred items.
+    warp_per_segment,
+    /// \brief Every segment is reduced by a thread, suitable for segments of a few items.
+    thread_per_segment,
+    /// \brief All segments and their items are split evenly across blocks, suitable for
+    /// segments of very different lengths. Segments must be sorted and must not overlap.
+    load_balanced
+};
+
 /// \brief Configuration of device-level reduce primitives.
 ///
 /// \tparam BlockSize - number of threads in a block.
 /// \tparam ItemsPerThread - number of items processed by each thread.
 /// \tparam BlockReduceMethod - algorithm for block reduce.
 /// \tparam SizeLimit - limit on the number of items reduced by a single launch
+/// \tparam SinglePass - when true, inputs that do not fit into one block (and do not exceed
+/// \p SizeLimit) are reduced by a single kernel launch: every block stores its partial result
+/// and the last block to finish, found with an atomic ticket counter, reduces the partial results.
+/// Partial results are always reduced in the order of blocks, so the result does not depend
+/// on the completion order of the blocks.
+/// \tparam SegmentedAlgorithm - algorithm of segmented reduce, it is ignored by other primitives.
+/// \tparam BlocksPerCU - when not 0, the grid is limited to \p BlocksPerCU blocks per compute
+/// unit, every block reduces a contiguous range of tiles and the partial results are reduced
+/// by the last block like with \p SinglePass. A limited grid leaves compute units to kernels
+/// running concurrently on other streams. It is ignored by segmented reduce.
 template<
     unsigned int BlockSize,
     unsigned int ItemsPerThread,
     ::rocprim::block_reduce_algorithm BlockReduceMethod,
-    unsigned int SizeLimit = ROCPRIM_GRID_SIZE_LIMIT
+    unsigned int SizeLimit = ROCPRIM_GRID_SIZE_LIMIT,
+    bool SinglePass = false,
+    segmented_reduce_algorithm SegmentedAlgorithm = segmented_reduce_algorithm::automatic,
+    unsigned int BlocksPerCU = 0
 >
 struct reduce_config
 {
@@ -258,6 +393,12 @@ struct reduce_config
     static constexpr block_reduce_algorithm block_reduce_method = BlockReduceMethod;
     /// \brief Limit on the number of items reduced by a single launch
     static constexpr unsigned int size_limit = SizeLimit;
+    /// \brief Whether the reduction is performed by a single kernel launch.
+    static constexpr bool single_pass = SinglePass;
+    /// \brief Algorithm of segmented reduce.
+    static constexpr segmented_reduce_algorithm segmented_algorithm = SegmentedAlgorithm;
+    /// \brief Maximum number of blocks per compute unit, 0 if the grid is not limited.
+    static constexpr unsigned int blocks_per_cu = BlocksPerCU;
 };
 
 namespace detail
@@ -289,13 +430,20 @@ struct default_reduce_config_base : default_reduce_config_base_helper<Value>::ty
 /// \tparam StoreLoadMethod - method for storing values.
 /// \tparam BlockScanMethod - algorithm for block scan.
 /// \tparam SizeLimit - limit on the number of items for a single scan kernel launch.
+/// \tparam BlocksPerCU - when not 0, the grid of the look-back scan is limited to
+/// \p BlocksPerCU blocks per compute unit and every block scans tiles in the order of their
+/// ids until all of them are scanned. A limited grid leaves compute units to kernels running
+/// concurrently on other streams. It is ignored by reduce-then-scan.
+/// \tparam Backoff - policy of the look-back for waiting for the prefixes of the preceding blocks.
 template<unsigned int                    BlockSize,
          unsigned int                    ItemsPerThread,
          bool                            UseLookback,
          ::rocprim::block_load_method    BlockLoadMethod,
          ::rocprim::block_store_method   BlockStoreMethod,
          ::rocprim::block_scan_algorithm BlockScanMethod,
-         unsigned int                    SizeLimit = ROCPRIM_GRID_SIZE_LIMIT>
+         unsigned int                    SizeLimit   = ROCPRIM_GRID_SIZE_LIMIT,
+         unsigned int                    BlocksPerCU = 0,
+         ::rocprim::lookback_backoff     Backoff     = ::rocprim::lookback_backoff::automatic>
 struct scan_config
 {
     /// \brief Number of threads in a block.
@@ -312,6 +460,10 @@ struct scan_config
     static constexpr ::rocprim::block_scan_algorithm block_scan_method = BlockScanMethod;
     /// \brief Limit on the number of items for a single scan kernel launch.
     static constexpr unsigned int size_limit = SizeLimit;
+    /// \brief Maximum number of blocks per compute unit, 0 if the grid is not limited.
+    static constexpr unsigned int blocks_per_cu = BlocksPerCU;
+    /// \brief Policy of the look-back for waiting for the prefixes of the preceding blocks.
+    static constexpr ::rocprim::lookback_backoff backoff = Backoff;
 };
 
 namespace detail
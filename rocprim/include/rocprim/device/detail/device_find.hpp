@@ -0,0 +1,190 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_FIND_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_FIND_HPP_
+
+#include <iterator>
+#include <type_traits>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../functional.hpp"
+#include "../../intrinsics.hpp"
+#include "../../intrinsics/atomic.hpp"
+#include "../../types/tuple.hpp"
+
+#include "../../block/block_load_func.hpp"
+#include "../../block/block_reduce.hpp"
+
+#include "../config_types.hpp"
+#include "../device_reduce_config.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// No item satisfying the predicate has been found
+constexpr unsigned long long find_none = static_cast<unsigned long long>(-1);
+
+// What the store kernel writes: the index of the first found item, or whether an item is found
+enum class find_result
+{
+    index,
+    found,
+    not_found
+};
+
+// Flag of an item for all_of, the items not satisfying the predicate are looked for
+template<class UnaryPredicate>
+struct find_not_op
+{
+    UnaryPredicate predicate;
+
+    template<class T>
+    ROCPRIM_HOST_DEVICE inline
+    bool operator()(const T& value) const
+    {
+        return !predicate(value);
+    }
+};
+
+// Flag of a pair of items for mismatch
+template<class BinaryPredicate>
+struct find_mismatch_op
+{
+    BinaryPredicate equal;
+
+    template<class T1, class T2>
+    ROCPRIM_HOST_DEVICE inline
+    bool operator()(const ::rocprim::tuple<T1, T2>& values) const
+    {
+        return !equal(::rocprim::get<0>(values), ::rocprim::get<1>(values));
+    }
+};
+
+// Finds the first flagged item of the tile of the block, and lowers first_found to its index.
+// A block skips its tile without loading it when an item has already been found before it: the
+// result is the smallest index, so items after it do not change it. The flags are loaded
+// striped, every load of the warp is coalesced and no shared memory exchange is needed.
+template<class Config, class FlagIterator>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void find_kernel_impl(FlagIterator        flags_input,
+                      const size_t        size,
+                      const size_t        starting_offset,
+                      unsigned long long* first_found)
+{
+    static constexpr reduce_config_params params = device_params<Config>();
+
+    constexpr unsigned int block_size       = params.block_size;
+    constexpr unsigned int items_per_thread = params.items_per_thread;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+
+    using block_reduce_type
+        = ::rocprim::block_reduce<unsigned int, block_size, params.block_reduce_method>;
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        bool                                     skip;
+        typename block_reduce_type::storage_type reduce;
+    } storage;
+
+    const unsigned int flat_id       = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int flat_block_id = ::rocprim::detail::block_id<0>();
+    const size_t       block_offset
+        = starting_offset + static_cast<size_t>(flat_block_id) * items_per_block;
+
+    if(flat_id == 0)
+    {
+        storage.skip = ::rocprim::detail::atomic_load_acquire(first_found) <= block_offset;
+    }
+    ::rocprim::syncthreads();
+    if(storage.skip)
+    {
+        return;
+    }
+
+    const unsigned int valid_items
+        = static_cast<unsigned int>(::rocprim::min<size_t>(size - block_offset, items_per_block));
+
+    bool flags[items_per_thread];
+    if(valid_items == items_per_block)
+    {
+        block_load_direct_striped<block_size>(flat_id, flags_input + block_offset, flags);
+    }
+    else
+    {
+        block_load_direct_striped<block_size>(flat_id,
+                                              flags_input + block_offset,
+                                              flags,
+                                              valid_items,
+                                              false);
+    }
+
+    unsigned int first_flagged = items_per_block;
+    ROCPRIM_UNROLL
+    for(unsigned int i = items_per_thread; i-- > 0;)
+    {
+        if(flags[i])
+        {
+            first_flagged = i * block_size + flat_id;
+        }
+    }
+
+    block_reduce_type().reduce(first_flagged,
+                               first_flagged,
+                               storage.reduce,
+                               ::rocprim::minimum<unsigned int>());
+
+    if(flat_id == 0 && first_flagged != items_per_block)
+    {
+        ::rocprim::detail::atomic_min(first_found, block_offset + first_flagged);
+    }
+}
+
+// Stores the index of the first found item, the size of the input if there is none, or whether
+// an item is found
+template<find_result Result, class OutputIterator>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void find_store(OutputIterator                  output,
+                const size_t                    size,
+                const unsigned long long* const first_found)
+{
+    const unsigned long long first = *first_found;
+    if ROCPRIM_IF_CONSTEXPR(Result == find_result::index)
+    {
+        *output = first == find_none ? size : static_cast<size_t>(first);
+    }
+    else if ROCPRIM_IF_CONSTEXPR(Result == find_result::found)
+    {
+        *output = first != find_none;
+    }
+    else
+    {
+        *output = first == find_none;
+    }
+}
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_FIND_HPP_
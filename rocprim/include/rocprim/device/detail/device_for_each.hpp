@@ -0,0 +1,126 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_FOR_EACH_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_FOR_EACH_HPP_
+
+#include <iterator>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../intrinsics.hpp"
+
+#include "../../block/block_load.hpp"
+
+#include "device_transform.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// The items of a tile are loaded like the input of transform, full aligned tiles of pointers are
+// loaded as vectors. The function is applied to the loaded values, so the order of the calls
+// within a tile is not specified.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class InputIterator,
+         class UnaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void for_each_block(InputIterator      block_input,
+                    const bool         is_full_block,
+                    const unsigned int valid_in_block,
+                    UnaryFunction&     function)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+
+    input_type input_values[ItemsPerThread];
+
+    if(!is_full_block)
+    {
+        block_load_direct_striped_buffer<BlockSize>(flat_id,
+                                                    block_input,
+                                                    input_values,
+                                                    valid_in_block);
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            if(BlockSize * i + flat_id < valid_in_block)
+            {
+                function(input_values[i]);
+            }
+        }
+        return;
+    }
+
+    using input_access = transform_vector_access<InputIterator, ItemsPerThread>;
+
+    if(input_access::value && input_access::is_aligned(block_input))
+    {
+        input_access::load(flat_id, block_input, input_values);
+    }
+    else
+    {
+        block_load_direct_striped<BlockSize>(flat_id, block_input, input_values);
+    }
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        function(input_values[i]);
+    }
+}
+
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class InputIterator,
+         class UnaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void for_each_kernel_impl(InputIterator input, const size_t input_size, UnaryFunction function)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int flat_block_id    = ::rocprim::detail::block_id<0>();
+    const unsigned int number_of_blocks = ::rocprim::detail::grid_size<0>();
+    const unsigned int number_of_tiles
+        = ::rocprim::detail::ceiling_div<unsigned int>(input_size, items_per_block);
+
+    // A grid limited by blocks_per_cu is smaller than the number of tiles, then every block
+    // processes every number_of_blocks-th tile
+    for(unsigned int tile = flat_block_id; tile < number_of_tiles; tile += number_of_blocks)
+    {
+        const unsigned int tile_offset        = tile * items_per_block;
+        const unsigned int valid_in_last_tile = input_size - tile_offset;
+
+        for_each_block<BlockSize, ItemsPerThread>(input + tile_offset,
+                                                  tile != (number_of_tiles - 1), // last tile
+                                                  valid_in_last_tile,
+                                                  function);
+    }
+}
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_FOR_EACH_HPP_
@@ -0,0 +1,344 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_HASH_REDUCE_BY_KEY_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_HASH_REDUCE_BY_KEY_HPP_
+
+#include <iterator>
+#include <type_traits>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../intrinsics.hpp"
+#include "../../intrinsics/atomic.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+namespace hash_reduce_by_key
+{
+
+// Accumulators are stored as words of their size, so they can be updated by compare-and-swap
+// loops regardless of their alignment
+template<class Accumulator>
+using word_type_t =
+    typename std::conditional<sizeof(Accumulator) == 4, unsigned int, unsigned long long>::type;
+
+template<class Accumulator>
+struct is_supported_accumulator
+    : std::integral_constant<bool,
+                             (sizeof(Accumulator) == 4 || sizeof(Accumulator) == 8)
+                                 && std::is_trivially_copyable<Accumulator>::value>
+{};
+
+// Slots of the table store the index of the first item of their key plus one, 0 if free
+constexpr unsigned int empty_slot = 0;
+
+// Probes of the table of a block before the item is aggregated directly to the global table
+constexpr unsigned int max_shared_probes = 8;
+
+template<class Accumulator>
+ROCPRIM_DEVICE ROCPRIM_INLINE word_type_t<Accumulator> to_word(const Accumulator& value)
+{
+    return __builtin_bit_cast(word_type_t<Accumulator>, value);
+}
+
+template<class Accumulator>
+ROCPRIM_DEVICE ROCPRIM_INLINE Accumulator from_word(const word_type_t<Accumulator> word)
+{
+    return __builtin_bit_cast(Accumulator, word);
+}
+
+// Combines value into the accumulator stored in *address with a compare-and-swap loop
+template<class Accumulator, class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE void atomic_reduce(word_type_t<Accumulator>* address,
+                                                 const Accumulator&        value,
+                                                 BinaryFunction            reduce_op)
+{
+    using word_type    = word_type_t<Accumulator>;
+    word_type expected = *static_cast<volatile word_type*>(address);
+    while(true)
+    {
+        const word_type desired
+            = to_word<Accumulator>(reduce_op(from_word<Accumulator>(expected), value));
+        const word_type old = ::rocprim::detail::atomic_cas(address, expected, desired);
+        if(old == expected)
+        {
+            return;
+        }
+        expected = old;
+    }
+}
+
+// Finds the slot of the key of item index, or claims a free one. Returns false if the table
+// overflowed: more than max_unique_keys slots are claimed or all slots were probed.
+template<class KeysInputIterator, class KeyCompareFunction, class KeyHash>
+ROCPRIM_DEVICE ROCPRIM_INLINE bool find_or_insert(KeysInputIterator  keys_input,
+                                                  const unsigned int index,
+                                                  unsigned int*      slots,
+                                                  const unsigned int capacity,
+                                                  const unsigned int max_unique_keys,
+                                                  unsigned int*      claimed_count,
+                                                  KeyCompareFunction key_compare_op,
+                                                  KeyHash            key_hash,
+                                                  unsigned int&      slot)
+{
+    const auto key = keys_input[index];
+    // The capacity is a power of two
+    slot = static_cast<unsigned int>(key_hash(key)) & (capacity - 1);
+    for(unsigned int probe = 0; probe < capacity; ++probe)
+    {
+        unsigned int owner = slots[slot];
+        if(owner == empty_slot)
+        {
+            owner = ::rocprim::detail::atomic_cas(&slots[slot], empty_slot, index + 1);
+            if(owner == empty_slot)
+            {
+                // The lanes that inserted a key in this probe reserve their places with
+                // one atomic operation
+                return ::rocprim::detail::warp_aggregated_atomic_add(claimed_count, 1u)
+                       < max_unique_keys;
+            }
+        }
+        if(key_compare_op(keys_input[owner - 1], key))
+        {
+            return true;
+        }
+        slot = (slot + 1) & (capacity - 1);
+    }
+    return false;
+}
+
+// Inserts the keys into the table and stores the slot of every item
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class KeysInputIterator,
+         class KeyCompareFunction,
+         class KeyHash>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void insert_kernel_impl(KeysInputIterator  keys_input,
+                                                            const unsigned int size,
+                                                            unsigned int*      slots,
+                                                            const unsigned int capacity,
+                                                            const unsigned int max_unique_keys,
+                                                            unsigned int*      item_slots,
+                                                            unsigned int*      claimed_count,
+                                                            unsigned int*      overflow,
+                                                            KeyCompareFunction key_compare_op,
+                                                            KeyHash            key_hash)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int flat_id     = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int block_start = ::rocprim::detail::block_id<0>() * items_per_block;
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; ++i)
+    {
+        const unsigned int index = block_start + i * BlockSize + flat_id;
+        if(index < size)
+        {
+            unsigned int slot;
+            if(find_or_insert(keys_input,
+                              index,
+                              slots,
+                              capacity,
+                              max_unique_keys,
+                              claimed_count,
+                              key_compare_op,
+                              key_hash,
+                              slot))
+            {
+                item_slots[index] = slot;
+            }
+            else
+            {
+                *overflow = 1;
+            }
+        }
+    }
+}
+
+// Initializes the accumulator of every claimed slot with the value of its first item
+template<class ValuesInputIterator, class Accumulator>
+ROCPRIM_DEVICE ROCPRIM_INLINE void init_accumulators(ValuesInputIterator       values_input,
+                                                     const unsigned int*       slots,
+                                                     const unsigned int        capacity,
+                                                     word_type_t<Accumulator>* accumulators)
+{
+    const unsigned int slot = ::rocprim::detail::block_id<0>() * ::rocprim::detail::block_size<0>()
+                              + ::rocprim::detail::block_thread_id<0>();
+    if(slot < capacity && slots[slot] != empty_slot)
+    {
+        accumulators[slot]
+            = to_word<Accumulator>(static_cast<Accumulator>(values_input[slots[slot] - 1]));
+    }
+}
+
+// Aggregates the values of the other items to the accumulators of their slots. The values of
+// a tile are first aggregated in a table of the block in shared memory, so hot keys cause one
+// global update per tile instead of one per item; items that do not find a free entry in a
+// few probes are aggregated directly.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class Accumulator,
+         class ValuesInputIterator,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+    aggregate_kernel_impl(ValuesInputIterator       values_input,
+                          const unsigned int        size,
+                          const unsigned int*       slots,
+                          const unsigned int*       item_slots,
+                          word_type_t<Accumulator>* accumulators,
+                          BinaryFunction            reduce_op)
+{
+    using word_type = word_type_t<Accumulator>;
+
+    constexpr unsigned int items_per_block   = BlockSize * ItemsPerThread;
+    constexpr unsigned int shared_table_size = items_per_block;
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        // The global slot of the entry plus one, 0 if free
+        unsigned int slots[shared_table_size];
+        word_type    partials[shared_table_size];
+    } storage;
+
+    const unsigned int flat_id     = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int block_start = ::rocprim::detail::block_id<0>() * items_per_block;
+
+    for(unsigned int entry = flat_id; entry < shared_table_size; entry += BlockSize)
+    {
+        storage.slots[entry] = empty_slot;
+    }
+    ::rocprim::syncthreads();
+
+    Accumulator  values[ItemsPerThread];
+    unsigned int entries[ItemsPerThread];
+    bool         claimed[ItemsPerThread];
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; ++i)
+    {
+        const unsigned int index = block_start + i * BlockSize + flat_id;
+        entries[i]               = shared_table_size;
+        claimed[i]               = false;
+        if(index >= size)
+        {
+            continue;
+        }
+        const unsigned int slot = item_slots[index];
+        // The value of the first item of the key initialized the accumulator
+        if(slots[slot] == index + 1)
+        {
+            continue;
+        }
+        values[i] = static_cast<Accumulator>(values_input[index]);
+
+        unsigned int entry = (slot * 0x9E3779B1u) % shared_table_size;
+        for(unsigned int probe = 0; probe < max_shared_probes; ++probe)
+        {
+            const unsigned int owner
+                = ::rocprim::detail::atomic_cas(&storage.slots[entry], empty_slot, slot + 1);
+            if(owner == empty_slot || owner == slot + 1)
+            {
+                entries[i] = entry;
+                claimed[i] = owner == empty_slot;
+                break;
+            }
+            entry = entry + 1 == shared_table_size ? 0 : entry + 1;
+        }
+        if(entries[i] == shared_table_size)
+        {
+            atomic_reduce(&accumulators[slot], values[i], reduce_op);
+        }
+    }
+    ::rocprim::syncthreads();
+
+    // The items that claimed the entries initialize them, the others aggregate to them
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; ++i)
+    {
+        if(claimed[i])
+        {
+            storage.partials[entries[i]] = to_word<Accumulator>(values[i]);
+        }
+    }
+    ::rocprim::syncthreads();
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; ++i)
+    {
+        if(entries[i] != shared_table_size && !claimed[i])
+        {
+            atomic_reduce(&storage.partials[entries[i]], values[i], reduce_op);
+        }
+    }
+    ::rocprim::syncthreads();
+
+    for(unsigned int entry = flat_id; entry < shared_table_size; entry += BlockSize)
+    {
+        const unsigned int owner = storage.slots[entry];
+        if(owner != empty_slot)
+        {
+            atomic_reduce(&accumulators[owner - 1],
+                          from_word<Accumulator>(storage.partials[entry]),
+                          reduce_op);
+        }
+    }
+}
+
+// Stores the key and the aggregate of every claimed slot at its position among the claimed
+// slots, and the number of claimed slots after the last slot
+template<class KeysInputIterator,
+         class UniqueOutputIterator,
+         class AggregatesOutputIterator,
+         class UniqueCountOutputIterator,
+         class Accumulator>
+ROCPRIM_DEVICE ROCPRIM_INLINE void
+    scatter_groups(KeysInputIterator               keys_input,
+                   const unsigned int*             slots,
+                   const unsigned int              capacity,
+                   const word_type_t<Accumulator>* accumulators,
+                   const unsigned int*             group_ids,
+                   UniqueOutputIterator            unique_output,
+                   AggregatesOutputIterator        aggregates_output,
+                   UniqueCountOutputIterator       unique_count_output)
+{
+    const unsigned int slot = ::rocprim::detail::block_id<0>() * ::rocprim::detail::block_size<0>()
+                              + ::rocprim::detail::block_thread_id<0>();
+    if(slot < capacity && slots[slot] != empty_slot)
+    {
+        const unsigned int group_id = group_ids[slot];
+        unique_output[group_id]     = keys_input[slots[slot] - 1];
+        aggregates_output[group_id] = from_word<Accumulator>(accumulators[slot]);
+    }
+    else if(slot == capacity)
+    {
+        *unique_count_output = group_ids[capacity];
+    }
+}
+
+} // namespace hash_reduce_by_key
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_HASH_REDUCE_BY_KEY_HPP_
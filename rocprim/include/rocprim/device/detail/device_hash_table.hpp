@@ -0,0 +1,247 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_HASH_TABLE_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_HASH_TABLE_HPP_
+
+#include <iterator>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../intrinsics.hpp"
+#include "../../intrinsics/atomic.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+namespace hash_table
+{
+
+// Slots of the table store the index of the last inserted build item of their key plus one,
+// 0 if free. Every build item stores the index of the previous build item of its key plus one,
+// so the items of every key form a list that starts at its slot.
+constexpr unsigned int empty_slot = 0;
+
+// The slots and the lists of a built table
+struct table_view
+{
+    unsigned int* slots;
+    unsigned int* next;
+    unsigned int  capacity;
+};
+
+// The table has twice as many slots as build items rounded up to a power of two, so the probe
+// sequences stay short
+inline unsigned int get_capacity(const size_t build_size)
+{
+    return ::rocprim::detail::next_power_of_two(
+        static_cast<unsigned int>(build_size == 0 ? 1 : 2 * build_size));
+}
+
+// Inserts build item index into the list of its key
+template<class KeysInputIterator, class KeyCompareFunction, class KeyHash>
+ROCPRIM_DEVICE ROCPRIM_INLINE void insert(KeysInputIterator  build_keys,
+                                          const unsigned int index,
+                                          const table_view   table,
+                                          KeyCompareFunction key_compare_op,
+                                          KeyHash            key_hash)
+{
+    const auto key = build_keys[index];
+    // The capacity is a power of two and larger than the number of build items, so a free slot
+    // or the slot of the key is always found
+    unsigned int slot = static_cast<unsigned int>(key_hash(key)) & (table.capacity - 1);
+    while(true)
+    {
+        unsigned int owner = table.slots[slot];
+        if(owner == empty_slot)
+        {
+            owner = ::rocprim::detail::atomic_cas(&table.slots[slot], empty_slot, index + 1);
+            if(owner == empty_slot)
+            {
+                table.next[index] = empty_slot;
+                return;
+            }
+        }
+        // Slots are never freed, so any item of the list has the key of the slot
+        if(key_compare_op(build_keys[owner - 1], key))
+        {
+            table.next[index] = ::rocprim::detail::atomic_exch(&table.slots[slot], index + 1);
+            return;
+        }
+        slot = (slot + 1) & (table.capacity - 1);
+    }
+}
+
+// Returns the first build item of the list of key plus one, 0 if the key is not in the table
+template<class KeysInputIterator, class Key, class KeyCompareFunction, class KeyHash>
+ROCPRIM_DEVICE ROCPRIM_INLINE unsigned int find(KeysInputIterator  build_keys,
+                                                const Key&         key,
+                                                const table_view   table,
+                                                KeyCompareFunction key_compare_op,
+                                                KeyHash            key_hash)
+{
+    unsigned int slot = static_cast<unsigned int>(key_hash(key)) & (table.capacity - 1);
+    while(true)
+    {
+        const unsigned int owner = table.slots[slot];
+        if(owner == empty_slot || key_compare_op(build_keys[owner - 1], key))
+        {
+            return owner;
+        }
+        slot = (slot + 1) & (table.capacity - 1);
+    }
+}
+
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class KeysInputIterator,
+         class KeyCompareFunction,
+         class KeyHash>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void build_kernel_impl(KeysInputIterator  build_keys,
+                                                           const unsigned int build_size,
+                                                           const table_view   table,
+                                                           KeyCompareFunction key_compare_op,
+                                                           KeyHash            key_hash)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int flat_id     = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int block_start = ::rocprim::detail::block_id<0>() * items_per_block;
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; ++i)
+    {
+        const unsigned int index = block_start + i * BlockSize + flat_id;
+        if(index < build_size)
+        {
+            insert(build_keys, index, table, key_compare_op, key_hash);
+        }
+    }
+}
+
+// Stores the number of matches of every probe item, and 0 after the last probe item, so a
+// scan of the counts ends with the total number of matches
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class KeysInputIterator,
+         class ProbeKeysInputIterator,
+         class KeyCompareFunction,
+         class KeyHash>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void count_kernel_impl(KeysInputIterator      build_keys,
+                                                           ProbeKeysInputIterator probe_keys,
+                                                           const unsigned int     probe_size,
+                                                           const table_view       table,
+                                                           unsigned int*          match_counts,
+                                                           KeyCompareFunction     key_compare_op,
+                                                           KeyHash                key_hash)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int flat_id     = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int block_start = ::rocprim::detail::block_id<0>() * items_per_block;
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; ++i)
+    {
+        const unsigned int index = block_start + i * BlockSize + flat_id;
+        if(index < probe_size)
+        {
+            const key_type key = static_cast<key_type>(probe_keys[index]);
+            unsigned int   count = 0;
+            for(unsigned int item = find(build_keys, key, table, key_compare_op, key_hash);
+                item != empty_slot;
+                item = table.next[item - 1])
+            {
+                ++count;
+            }
+            match_counts[index] = count;
+        }
+        else if(index == probe_size)
+        {
+            match_counts[index] = 0;
+        }
+    }
+}
+
+// Writes the pairs of matching build and probe items at the offsets of the probe items, and
+// the total number of matches after the last probe item
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class KeysInputIterator,
+         class ProbeKeysInputIterator,
+         class BuildIndicesOutputIterator,
+         class ProbeIndicesOutputIterator,
+         class MatchCountOutputIterator,
+         class KeyCompareFunction,
+         class KeyHash>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+    write_kernel_impl(KeysInputIterator          build_keys,
+                      ProbeKeysInputIterator     probe_keys,
+                      const unsigned int         probe_size,
+                      const table_view           table,
+                      const size_t*              match_offsets,
+                      BuildIndicesOutputIterator build_indices_output,
+                      ProbeIndicesOutputIterator probe_indices_output,
+                      MatchCountOutputIterator   match_count_output,
+                      KeyCompareFunction         key_compare_op,
+                      KeyHash                    key_hash)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int flat_id     = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int block_start = ::rocprim::detail::block_id<0>() * items_per_block;
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; ++i)
+    {
+        const unsigned int index = block_start + i * BlockSize + flat_id;
+        if(index < probe_size)
+        {
+            const key_type key    = static_cast<key_type>(probe_keys[index]);
+            size_t         offset = match_offsets[index];
+            for(unsigned int item = find(build_keys, key, table, key_compare_op, key_hash);
+                item != empty_slot;
+                item = table.next[item - 1])
+            {
+                build_indices_output[offset] = item - 1;
+                probe_indices_output[offset] = index;
+                ++offset;
+            }
+        }
+        else if(index == probe_size)
+        {
+            *match_count_output = match_offsets[probe_size];
+        }
+    }
+}
+
+} // namespace hash_table
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_HASH_TABLE_HPP_
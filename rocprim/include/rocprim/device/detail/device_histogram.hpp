@@ -32,7 +32,10 @@
 #include "../../type_traits.hpp"
 
 #include "../../block/block_load.hpp"
+#include "../../iterator/counting_iterator.hpp"
+#include "../../iterator/transform_iterator.hpp"
 
+#include "../device_histogram_config.hpp"
 #include "uint_fast_div.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
@@ -167,54 +170,209 @@ struct sample_to_bin_even<Level,
 };
 
 // Returns index of the first element in values that is greater than value, or count if no such element is found.
+// The search is branchless: the range is halved by a select, so all threads of a warp do the
+// same number of steps and the loads do not depend on a data-dependent branch.
 template<class T>
 ROCPRIM_HOST_DEVICE inline unsigned int upper_bound(const T* values, unsigned int count, T value)
 {
-    unsigned int current = 0;
-    while(count > 0)
+    if(count == 0)
     {
-        const unsigned int step = count / 2;
-        const unsigned int next = current + step;
-        if(value < values[next])
-        {
-            count = step;
-        }
-        else
-        {
-            current = next + 1;
-            count -= step + 1;
-        }
+        return 0;
+    }
+    const T* base = values;
+    while(count > 1)
+    {
+        const unsigned int half = count / 2;
+        base                    = (value < base[half]) ? base : base + half;
+        count -= half;
     }
-    return current;
+    return static_cast<unsigned int>(base - values) + (value < *base ? 0 : 1);
 }
 
+// Size of the shared memory used to cache the levels of histogram_range in every block
+constexpr unsigned int histogram_range_shared_levels_bytes = 8192;
+
 template<class Level>
 struct sample_to_bin_range
 {
     unsigned int bins;
     const Level* level_values;
+    // Every coarse_stride-th level, only when the levels do not fit into the shared memory:
+    // the coarse levels are searched first, then the window of coarse_stride levels
+    const Level* coarse_levels;
+    unsigned int coarse_count;
+    unsigned int coarse_stride;
 
     ROCPRIM_HOST_DEVICE inline sample_to_bin_range() = default;
 
     ROCPRIM_HOST_DEVICE inline sample_to_bin_range(unsigned int bins, const Level* level_values)
-        : bins(bins), level_values(level_values)
+        : bins(bins)
+        , level_values(level_values)
+        , coarse_levels(nullptr)
+        , coarse_count(0)
+        , coarse_stride(0)
     {}
 
     template<class Sample>
     ROCPRIM_HOST_DEVICE inline bool operator()(Sample sample, unsigned int& bin) const
     {
         const Level s = static_cast<Level>(sample);
-        bin           = upper_bound(level_values, bins + 1, s) - 1;
+        if(coarse_levels == nullptr)
+        {
+            bin = upper_bound(level_values, bins + 1, s) - 1;
+        }
+        else
+        {
+            // if s is less than the first level, the window starts at 0 and the result is -1
+            const unsigned int coarse = upper_bound(coarse_levels, coarse_count, s);
+            const unsigned int first  = (coarse == 0 ? 0 : coarse - 1) * coarse_stride;
+            const unsigned int count  = ::rocprim::min(coarse_stride, bins + 1 - first);
+            bin                       = first + upper_bound(level_values + first, count, s) - 1;
+        }
         return bin < bins;
     }
 };
 
+// Prepares the bin ops of a block before counting: nothing for the ops that do not read memory
+template<class SampleToBinOp, unsigned int ActiveChannels>
+struct histogram_block_bin_ops
+{
+    using storage_type = empty_storage_type;
+
+    template<unsigned int BlockSize>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static void
+        load(fixed_array<SampleToBinOp, ActiveChannels>& /*sample_to_bin_op*/,
+             storage_type& /*storage*/)
+    {}
+};
+
+// The levels of all channels are copied into the shared memory if they fit, so the searches of
+// all samples do not read the levels from the global memory. Otherwise every channel gets an
+// equal part of the shared memory for a coarse table of every coarse_stride-th level, then only
+// the last step of the search reads a window of the levels from the global memory.
+template<class Level, unsigned int ActiveChannels>
+struct histogram_block_bin_ops<sample_to_bin_range<Level>, ActiveChannels>
+{
+    static constexpr unsigned int capacity = histogram_range_shared_levels_bytes / sizeof(Level);
+    static constexpr unsigned int channel_capacity = capacity / ActiveChannels;
+
+    using storage_type = detail::raw_storage<Level[capacity]>;
+
+    template<unsigned int BlockSize>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static void
+        load(fixed_array<sample_to_bin_range<Level>, ActiveChannels>& sample_to_bin_op,
+             storage_type&                                            storage)
+    {
+        const unsigned int flat_id       = ::rocprim::detail::block_thread_id<0>();
+        Level*             shared_levels = storage.get();
+
+        unsigned int total_levels = 0;
+        for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+        {
+            total_levels += sample_to_bin_op[channel].bins + 1;
+        }
+        const bool fits = total_levels <= capacity;
+
+        unsigned int offset = 0;
+        for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+        {
+            sample_to_bin_range<Level>& op     = sample_to_bin_op[channel];
+            const unsigned int          levels = op.bins + 1;
+            if(fits)
+            {
+                for(unsigned int i = flat_id; i < levels; i += BlockSize)
+                {
+                    shared_levels[offset + i] = op.level_values[i];
+                }
+                op.level_values = shared_levels + offset;
+                offset += levels;
+            }
+            else
+            {
+                const unsigned int stride = ceiling_div(levels, channel_capacity);
+                const unsigned int count  = ceiling_div(levels, stride);
+                for(unsigned int i = flat_id; i < count; i += BlockSize)
+                {
+                    shared_levels[offset + i] = op.level_values[i * stride];
+                }
+                op.coarse_levels = shared_levels + offset;
+                op.coarse_count  = count;
+                op.coarse_stride = stride;
+                offset += channel_capacity;
+            }
+        }
+        ::rocprim::syncthreads();
+    }
+};
+
 template<class T, unsigned int Size>
 struct sample_vector
 {
     T values[Size];
 };
 
+// Joint bin of all active channels of a sample, bins of the channels are combined in
+// row-major order: the last active channel varies fastest.
+template<class Level, unsigned int ActiveChannels>
+struct sample_to_bin_joint_even
+{
+    sample_to_bin_even<Level> channel_sample_to_bin_op[ActiveChannels];
+
+    template<class Sample, unsigned int Channels>
+    ROCPRIM_HOST_DEVICE inline bool operator()(const sample_vector<Sample, Channels>& sample,
+                                               unsigned int&                          bin) const
+    {
+        bin = 0;
+        for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+        {
+            const sample_to_bin_even<Level>& op = channel_sample_to_bin_op[channel];
+
+            unsigned int channel_bin;
+            if(!op(sample.values[channel], channel_bin) || channel_bin >= op.bins)
+            {
+                return false;
+            }
+            bin = bin * op.bins + channel_bin;
+        }
+        return true;
+    }
+};
+
+// Samples of all channels of a pixel as one sample_vector
+template<unsigned int Channels, class SampleIterator>
+struct sample_vector_op
+{
+    using sample_type = typename std::iterator_traits<SampleIterator>::value_type;
+
+    SampleIterator samples;
+
+    ROCPRIM_HOST_DEVICE inline sample_vector<sample_type, Channels> operator()(size_t i) const
+    {
+        sample_vector<sample_type, Channels> value;
+        for(unsigned int channel = 0; channel < Channels; channel++)
+        {
+            value.values[channel] = samples[i * Channels + channel];
+        }
+        return value;
+    }
+};
+
+// Pointers are reinterpreted so samples are still loaded as vectors
+template<unsigned int Channels, class SampleIterator>
+inline auto make_sample_vector_iterator(SampleIterator samples, std::true_type /* is_pointer */)
+    -> const sample_vector<typename std::iterator_traits<SampleIterator>::value_type, Channels>*
+{
+    using sample_type = typename std::iterator_traits<SampleIterator>::value_type;
+    return reinterpret_cast<const sample_vector<sample_type, Channels>*>(samples);
+}
+
+template<unsigned int Channels, class SampleIterator>
+inline auto make_sample_vector_iterator(SampleIterator samples, std::false_type /* is_pointer */)
+{
+    return ::rocprim::make_transform_iterator(::rocprim::make_counting_iterator<size_t>(0),
+                                              sample_vector_op<Channels, SampleIterator>{samples});
+}
+
 // Checks if it is possible to load 2 or 4 sample_vector<Sample, Channels> as one 32-bit value
 template<unsigned int ItemsPerThread, unsigned int Channels, class Sample>
 struct is_sample_vectorizable
@@ -227,8 +385,8 @@ struct is_sample_vectorizable
 template<unsigned int BlockSize, unsigned int ItemsPerThread, unsigned int Channels, class Sample>
 ROCPRIM_DEVICE ROCPRIM_INLINE
     typename std::enable_if<is_sample_vectorizable<ItemsPerThread, Channels, Sample>::value>::type
-    load_samples(unsigned int flat_id,
-                 Sample*      samples,
+    load_samples(unsigned int  flat_id,
+                 const Sample* samples,
                  sample_vector<Sample, Channels> (&values)[ItemsPerThread])
 {
     using packed_samples_type = int[sizeof(Sample) * Channels * ItemsPerThread / sizeof(int)];
@@ -249,11 +407,58 @@ ROCPRIM_DEVICE ROCPRIM_INLINE
     }
 }
 
+// Packed pixels are loaded as 32-bit words, by vector loads of up to 4 words when the pointer
+// is aligned, then the samples are extracted from the words by shifts
+template<unsigned int BlockSize, unsigned int ItemsPerThread, unsigned int Channels, class Sample>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+    typename std::enable_if<is_sample_packed_pixel<Channels, Sample>::value>::type
+    load_samples(unsigned int  flat_id,
+                 const Sample* samples,
+                 sample_vector<Sample, Channels> (&values)[ItemsPerThread])
+{
+    using vector_type = typename match_vector_type<unsigned int, ItemsPerThread>::type;
+
+    constexpr unsigned int sample_bits = 8 * sizeof(Sample);
+    constexpr unsigned int sample_mask = (1u << sample_bits) - 1;
+
+    const unsigned int* words = reinterpret_cast<const unsigned int*>(samples);
+
+    unsigned int pixels[ItemsPerThread];
+    if(reinterpret_cast<uintptr_t>(samples) % sizeof(vector_type) == 0)
+    {
+        block_load_direct_blocked_vectorized(flat_id, words, pixels);
+    }
+    else if(reinterpret_cast<uintptr_t>(samples) % sizeof(unsigned int) == 0)
+    {
+        block_load_direct_striped<BlockSize>(flat_id, words, pixels);
+    }
+    else
+    {
+        block_load_direct_striped<BlockSize>(
+            flat_id,
+            reinterpret_cast<const sample_vector<Sample, Channels>*>(samples),
+            values);
+        return;
+    }
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int channel = 0; channel < Channels; channel++)
+        {
+            values[i].values[channel]
+                = static_cast<Sample>((pixels[i] >> (channel * sample_bits)) & sample_mask);
+        }
+    }
+}
+
 template<unsigned int BlockSize, unsigned int ItemsPerThread, unsigned int Channels, class Sample>
 ROCPRIM_DEVICE ROCPRIM_INLINE
-    typename std::enable_if<!is_sample_vectorizable<ItemsPerThread, Channels, Sample>::value>::type
-    load_samples(unsigned int flat_id,
-                 Sample*      samples,
+    typename std::enable_if<!is_sample_vectorizable<ItemsPerThread, Channels, Sample>::value
+                            && !is_sample_packed_pixel<Channels, Sample>::value>::type
+    load_samples(unsigned int  flat_id,
+                 const Sample* samples,
                  sample_vector<Sample, Channels> (&values)[ItemsPerThread])
 {
     block_load_direct_striped<BlockSize>(
@@ -268,9 +473,9 @@ template<unsigned int BlockSize,
          class Sample,
          class SampleIterator>
 ROCPRIM_DEVICE ROCPRIM_INLINE void
-    load_samples(unsigned int   flat_id,
-                 SampleIterator samples,
-                 sample_vector<Sample, Channels> (&values)[ItemsPerThread])
+    load_samples_blocked(unsigned int   flat_id,
+                         SampleIterator samples,
+                         sample_vector<Sample, Channels> (&values)[ItemsPerThread])
 {
     Sample tmp[Channels * ItemsPerThread];
     block_load_direct_blocked(flat_id, samples, tmp);
@@ -289,10 +494,10 @@ template<unsigned int BlockSize,
          class Sample,
          class SampleIterator>
 ROCPRIM_DEVICE ROCPRIM_INLINE void
-    load_samples(unsigned int   flat_id,
-                 SampleIterator samples,
-                 sample_vector<Sample, Channels> (&values)[ItemsPerThread],
-                 unsigned int valid_count)
+    load_samples_blocked(unsigned int   flat_id,
+                         SampleIterator samples,
+                         sample_vector<Sample, Channels> (&values)[ItemsPerThread],
+                         unsigned int valid_count)
 {
     Sample tmp[Channels * ItemsPerThread];
     block_load_direct_blocked(flat_id, samples, tmp, valid_count * Channels);
@@ -305,6 +510,133 @@ ROCPRIM_DEVICE ROCPRIM_INLINE void
     }
 }
 
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         unsigned int Channels,
+         class Sample,
+         class SampleIterator>
+ROCPRIM_DEVICE ROCPRIM_INLINE void
+    load_samples(unsigned int   flat_id,
+                 SampleIterator samples,
+                 sample_vector<Sample, Channels> (&values)[ItemsPerThread])
+{
+    load_samples_blocked<BlockSize>(flat_id, samples, values);
+}
+
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         unsigned int Channels,
+         class Sample,
+         class SampleIterator>
+ROCPRIM_DEVICE ROCPRIM_INLINE void
+    load_samples(unsigned int   flat_id,
+                 SampleIterator samples,
+                 sample_vector<Sample, Channels> (&values)[ItemsPerThread],
+                 unsigned int valid_count)
+{
+    load_samples_blocked<BlockSize>(flat_id, samples, values, valid_count);
+}
+
+// Weights of the samples of unweighted histograms, every sample adds 1 to its bin
+struct histogram_unit_weights
+{};
+
+// Type of the bins in shared memory: counts of unweighted histograms, sums of weights
+// in the counter type for weighted histograms
+template<class WeightIterator, class Counter>
+struct histogram_bin_type
+{
+    using type = Counter;
+};
+
+template<class Counter>
+struct histogram_bin_type<histogram_unit_weights, Counter>
+{
+    using type = unsigned int;
+};
+
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         unsigned int Channels,
+         class Sample,
+         class SampleIterator>
+ROCPRIM_DEVICE ROCPRIM_INLINE void
+    load_weighted_samples(unsigned int   flat_id,
+                          SampleIterator samples,
+                          histogram_unit_weights /* weights */,
+                          size_t /* weights_offset */,
+                          sample_vector<Sample, Channels> (&values)[ItemsPerThread],
+                          unsigned int (&weight_values)[ItemsPerThread])
+{
+    load_samples<BlockSize>(flat_id, samples, values);
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        weight_values[i] = 1;
+    }
+}
+
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         unsigned int Channels,
+         class Sample,
+         class SampleIterator>
+ROCPRIM_DEVICE ROCPRIM_INLINE void
+    load_weighted_samples(unsigned int   flat_id,
+                          SampleIterator samples,
+                          histogram_unit_weights /* weights */,
+                          size_t /* weights_offset */,
+                          sample_vector<Sample, Channels> (&values)[ItemsPerThread],
+                          unsigned int (&weight_values)[ItemsPerThread],
+                          unsigned int valid_count)
+{
+    load_samples<BlockSize>(flat_id, samples, values, valid_count);
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        weight_values[i] = 1;
+    }
+}
+
+// Samples of weighted histograms are always loaded blocked, so the weights are loaded
+// in the same order
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         unsigned int Channels,
+         class Sample,
+         class SampleIterator,
+         class WeightIterator,
+         class Weight>
+ROCPRIM_DEVICE ROCPRIM_INLINE void
+    load_weighted_samples(unsigned int   flat_id,
+                          SampleIterator samples,
+                          WeightIterator weights,
+                          size_t         weights_offset,
+                          sample_vector<Sample, Channels> (&values)[ItemsPerThread],
+                          Weight (&weight_values)[ItemsPerThread])
+{
+    load_samples_blocked<BlockSize>(flat_id, samples, values);
+    block_load_direct_blocked(flat_id, weights + weights_offset, weight_values);
+}
+
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         unsigned int Channels,
+         class Sample,
+         class SampleIterator,
+         class WeightIterator,
+         class Weight>
+ROCPRIM_DEVICE ROCPRIM_INLINE void
+    load_weighted_samples(unsigned int   flat_id,
+                          SampleIterator samples,
+                          WeightIterator weights,
+                          size_t         weights_offset,
+                          sample_vector<Sample, Channels> (&values)[ItemsPerThread],
+                          Weight (&weight_values)[ItemsPerThread],
+                          unsigned int valid_count)
+{
+    load_samples_blocked<BlockSize>(flat_id, samples, values, valid_count);
+    block_load_direct_blocked(flat_id, weights + weights_offset, weight_values, valid_count);
+}
+
 template<unsigned int BlockSize, unsigned int ActiveChannels, class Counter>
 ROCPRIM_DEVICE ROCPRIM_INLINE void init_histogram(fixed_array<Counter*, ActiveChannels> histogram,
                                                   fixed_array<unsigned int, ActiveChannels> bins)
@@ -312,26 +644,220 @@ ROCPRIM_DEVICE ROCPRIM_INLINE void init_histogram(fixed_array<Counter*, ActiveCh
     const unsigned int flat_id  = ::rocprim::detail::block_thread_id<0>();
     const unsigned int block_id = ::rocprim::detail::block_id<0>();
 
-    const unsigned int index = block_id * BlockSize + flat_id;
+    // The grid can be limited by scoped_grid_limit, then threads clear multiple bins
+    const unsigned int grid_threads = ::rocprim::detail::grid_size<0>() * BlockSize;
     for(unsigned int channel = 0; channel < ActiveChannels; channel++)
     {
-        if(index < bins[channel])
+        for(unsigned int index = block_id * BlockSize + flat_id; index < bins[channel];
+            index += grid_threads)
         {
             histogram[channel][index] = 0;
         }
     }
 }
 
+// Adds a sample to the bins of an unweighted histogram. The lanes of the warp with the
+// same bin are grouped by ballots of the bits of the bins, and the first of them adds the number
+// of lanes, so one atomic operation is issued per unique bin of the warp.
+template<class Counter>
+ROCPRIM_DEVICE ROCPRIM_INLINE void histogram_aggregated_add(Counter*     histogram,
+                                                            unsigned int bin,
+                                                            unsigned int bins_bits,
+                                                            bool         is_valid,
+                                                            unsigned int /* weight */,
+                                                            histogram_unit_weights /* weights */)
+{
+    if(is_valid)
+    {
+        ::rocprim::detail::warp_grouped_atomic_add(histogram, bin, bins_bits, Counter(1));
+    }
+}
+
+// Adds the weight of a sample to the bins of a weighted histogram, weights are not
+// aggregated. Unit weights take the overload above, the conversion of the weight to
+// unsigned int would make the calls ambiguous otherwise.
+template<class Counter,
+         class WeightIterator,
+         class = typename std::enable_if<
+             !std::is_same<WeightIterator, histogram_unit_weights>::value>::type>
+ROCPRIM_DEVICE ROCPRIM_INLINE void histogram_aggregated_add(Counter*     histogram,
+                                                            unsigned int bin,
+                                                            unsigned int /* bins_bits */,
+                                                            bool         is_valid,
+                                                            Counter      weight,
+                                                            WeightIterator /* weights */)
+{
+    if(is_valid)
+    {
+        ::rocprim::detail::atomic_add(&histogram[bin], weight);
+    }
+}
+
+// Counts the rows [start_row, end_row) in the shared histograms of the block and adds them to
+// histogram. The block counts every blocks-th tile of the columns, starting from the tile
+// block_index.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         unsigned int Channels,
+         unsigned int ActiveChannels,
+         unsigned int SharedHistograms,
+         bool         WarpAggregation,
+         class SampleIterator,
+         class WeightIterator,
+         class Counter,
+         class SampleToBinOp,
+         class Bin>
+ROCPRIM_DEVICE ROCPRIM_INLINE void
+    histogram_shared_rows(SampleIterator                             samples,
+                          WeightIterator                             weights,
+                          unsigned int                               columns,
+                          unsigned int                               start_row,
+                          unsigned int                               end_row,
+                          unsigned int                               row_stride,
+                          unsigned int                               block_index,
+                          unsigned int                               blocks,
+                          fixed_array<Counter*, ActiveChannels>      histogram,
+                          fixed_array<SampleToBinOp, ActiveChannels> sample_to_bin_op,
+                          fixed_array<unsigned int, ActiveChannels>  bins,
+                          fixed_array<unsigned int, ActiveChannels>  bins_bits,
+                          Bin*                                       block_histogram_start)
+{
+    using sample_type        = typename std::iterator_traits<SampleIterator>::value_type;
+    using sample_vector_type = sample_vector<sample_type, Channels>;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+
+    using bin_ops_type = histogram_block_bin_ops<SampleToBinOp, ActiveChannels>;
+    ROCPRIM_SHARED_MEMORY typename bin_ops_type::storage_type bin_ops_storage;
+    bin_ops_type::template load<BlockSize>(sample_to_bin_op, bin_ops_storage);
+
+    // starts of the first histogram for each channel
+    Bin*         block_histogram[ActiveChannels];
+    unsigned int total_bins = 0;
+    for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+    {
+        block_histogram[channel] = block_histogram_start + total_bins;
+        total_bins += bins[channel];
+    }
+
+    // partial histogram to work with
+    const unsigned int thread_shift = (flat_id % SharedHistograms) * total_bins;
+
+    // fill all histograms with 0
+    for(unsigned int i = flat_id; i < total_bins * SharedHistograms; i += BlockSize)
+    {
+        block_histogram_start[i] = 0;
+    }
+    ::rocprim::syncthreads();
+
+    const auto count_sample = [&](const sample_vector_type& value, Bin weight, bool is_valid)
+    {
+        for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+        {
+            unsigned int bin = 0;
+            const bool   is_valid_bin
+                = is_valid && sample_to_bin_op[channel](value.values[channel], bin);
+            if(WarpAggregation)
+            {
+                // Heavily skewed inputs would serialize the atomic operations on the
+                // same bin by lanes of the warp
+                histogram_aggregated_add(block_histogram[channel] + thread_shift,
+                                         bin,
+                                         bins_bits[channel],
+                                         is_valid_bin,
+                                         weight,
+                                         weights);
+            }
+            else if(is_valid_bin)
+            {
+                ::rocprim::detail::atomic_add(block_histogram[channel] + bin + thread_shift,
+                                              weight);
+            }
+        }
+    };
+
+    for(unsigned int row = start_row; row < end_row; row++)
+    {
+        SampleIterator row_samples = samples + row * row_stride;
+
+        unsigned int block_offset = block_index * items_per_block;
+        while(block_offset < columns)
+        {
+            sample_vector_type values[ItemsPerThread];
+            Bin                weight_values[ItemsPerThread];
+
+            const size_t weights_offset = static_cast<size_t>(row) * columns + block_offset;
+            if(block_offset + items_per_block <= columns)
+            {
+                load_weighted_samples<BlockSize>(flat_id,
+                                                 row_samples + Channels * block_offset,
+                                                 weights,
+                                                 weights_offset,
+                                                 values,
+                                                 weight_values);
+
+                for(unsigned int i = 0; i < ItemsPerThread; i++)
+                {
+                    count_sample(values[i], weight_values[i], true);
+                }
+            }
+            else
+            {
+                const unsigned int valid_count = columns - block_offset;
+                load_weighted_samples<BlockSize>(flat_id,
+                                                 row_samples + Channels * block_offset,
+                                                 weights,
+                                                 weights_offset,
+                                                 values,
+                                                 weight_values,
+                                                 valid_count);
+
+                for(unsigned int i = 0; i < ItemsPerThread; i++)
+                {
+                    count_sample(values[i],
+                                 weight_values[i],
+                                 flat_id * ItemsPerThread + i < valid_count);
+                }
+            }
+
+            block_offset += blocks * items_per_block;
+        }
+    }
+    ::rocprim::syncthreads();
+
+    for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+    {
+        for(unsigned int bin = flat_id; bin < bins[channel]; bin += BlockSize)
+        {
+            Bin total = 0;
+            for(unsigned int i = 0; i < SharedHistograms; i++)
+            {
+                total += block_histogram[channel][bin + i * total_bins];
+            }
+            if(total != Bin(0))
+            {
+                ::rocprim::detail::atomic_add(&histogram[channel][bin], total);
+            }
+        }
+    }
+}
+
 template<unsigned int BlockSize,
          unsigned int ItemsPerThread,
          unsigned int Channels,
          unsigned int ActiveChannels,
          unsigned int SharedHistograms,
+         bool         WarpAggregation,
          class SampleIterator,
+         class WeightIterator,
          class Counter,
-         class SampleToBinOp>
+         class SampleToBinOp,
+         class Bin>
 ROCPRIM_DEVICE ROCPRIM_INLINE void
     histogram_shared(SampleIterator                             samples,
+                     WeightIterator                             weights,
                      unsigned int                               columns,
                      unsigned int                               rows,
                      unsigned int                               row_stride,
@@ -339,7 +865,103 @@ ROCPRIM_DEVICE ROCPRIM_INLINE void
                      fixed_array<Counter*, ActiveChannels>      histogram,
                      fixed_array<SampleToBinOp, ActiveChannels> sample_to_bin_op,
                      fixed_array<unsigned int, ActiveChannels>  bins,
-                     unsigned int*                              block_histogram_start)
+                     fixed_array<unsigned int, ActiveChannels>  bins_bits,
+                     Bin*                                       block_histogram_start)
+{
+    const unsigned int start_row = ::rocprim::detail::block_id<1>() * rows_per_block;
+    const unsigned int end_row   = ::rocprim::min(rows, start_row + rows_per_block);
+
+    histogram_shared_rows<BlockSize,
+                          ItemsPerThread,
+                          Channels,
+                          ActiveChannels,
+                          SharedHistograms,
+                          WarpAggregation>(samples,
+                                           weights,
+                                           columns,
+                                           start_row,
+                                           end_row,
+                                           row_stride,
+                                           ::rocprim::detail::block_id<0>(),
+                                           ::rocprim::detail::grid_size<0>(),
+                                           histogram,
+                                           sample_to_bin_op,
+                                           bins,
+                                           bins_bits,
+                                           block_histogram_start);
+}
+
+// Shared memory histograms of segments: the block (segment, block_index) counts the samples
+// [begin_offsets[segment], end_offsets[segment]) with blocks blocks per segment and adds them
+// to the bins of the segment, histogram + segment * bins.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         unsigned int SharedHistograms,
+         bool         WarpAggregation,
+         class SampleIterator,
+         class OffsetIterator,
+         class Counter,
+         class SampleToBinOp>
+ROCPRIM_DEVICE ROCPRIM_INLINE void segmented_histogram_shared(SampleIterator samples,
+                                                              OffsetIterator begin_offsets,
+                                                              OffsetIterator end_offsets,
+                                                              Counter*       histogram,
+                                                              SampleToBinOp  sample_to_bin_op,
+                                                              unsigned int   bins,
+                                                              unsigned int   bins_bits,
+                                                              unsigned int*  block_histogram)
+{
+    const unsigned int segment = ::rocprim::detail::block_id<0>();
+
+    const size_t begin = static_cast<size_t>(begin_offsets[segment]);
+    const size_t end   = static_cast<size_t>(end_offsets[segment]);
+    if(end <= begin)
+    {
+        return;
+    }
+
+    Counter* segment_histogram = histogram + static_cast<size_t>(segment) * bins;
+    histogram_shared_rows<BlockSize, ItemsPerThread, 1, 1, SharedHistograms, WarpAggregation>(
+        samples + begin,
+        histogram_unit_weights(),
+        static_cast<unsigned int>(end - begin),
+        0,
+        1,
+        0,
+        ::rocprim::detail::block_id<1>(),
+        ::rocprim::detail::grid_size<1>(),
+        fixed_array<Counter*, 1>(&segment_histogram),
+        fixed_array<SampleToBinOp, 1>(&sample_to_bin_op),
+        fixed_array<unsigned int, 1>(&bins),
+        fixed_array<unsigned int, 1>(&bins_bits),
+        block_histogram);
+}
+
+// Shared memory histogram of a window of bins, for histograms with too many bins for
+// the shared memory. Every channel has window_bins bins in shared memory, the window of
+// the block is selected by the z index of the block: bins [block_id2 * window_bins,
+// (block_id2 + 1) * window_bins) are counted, samples of other bins are skipped.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         unsigned int Channels,
+         unsigned int ActiveChannels,
+         class SampleIterator,
+         class WeightIterator,
+         class Counter,
+         class SampleToBinOp,
+         class Bin>
+ROCPRIM_DEVICE ROCPRIM_INLINE void
+    histogram_shared_window(SampleIterator                             samples,
+                            WeightIterator                             weights,
+                            unsigned int                               columns,
+                            unsigned int                               rows,
+                            unsigned int                               row_stride,
+                            unsigned int                               rows_per_block,
+                            fixed_array<Counter*, ActiveChannels>      histogram,
+                            fixed_array<SampleToBinOp, ActiveChannels> sample_to_bin_op,
+                            fixed_array<unsigned int, ActiveChannels>  bins,
+                            unsigned int                               window_bins,
+                            Bin*                                       block_histogram)
 {
     using sample_type        = typename std::iterator_traits<SampleIterator>::value_type;
     using sample_vector_type = sample_vector<sample_type, Channels>;
@@ -349,27 +971,40 @@ ROCPRIM_DEVICE ROCPRIM_INLINE void
     const unsigned int flat_id    = ::rocprim::detail::block_thread_id<0>();
     const unsigned int block_id0  = ::rocprim::detail::block_id<0>();
     const unsigned int block_id1  = ::rocprim::detail::block_id<1>();
+    const unsigned int block_id2  = ::rocprim::detail::block_id<2>();
     const unsigned int grid_size0 = ::rocprim::detail::grid_size<0>();
 
-    // starts of the first histogram for each channel
-    unsigned int* block_histogram[ActiveChannels];
-    unsigned int  total_bins = 0;
-    for(unsigned int channel = 0; channel < ActiveChannels; channel++)
-    {
-        block_histogram[channel] = block_histogram_start + total_bins;
-        total_bins += bins[channel];
-    }
+    using bin_ops_type = histogram_block_bin_ops<SampleToBinOp, ActiveChannels>;
+    ROCPRIM_SHARED_MEMORY typename bin_ops_type::storage_type bin_ops_storage;
+    bin_ops_type::template load<BlockSize>(sample_to_bin_op, bin_ops_storage);
 
-    // partial histogram to work with
-    const unsigned int thread_shift = (flat_id % SharedHistograms) * total_bins;
+    const unsigned int window_begin = block_id2 * window_bins;
 
-    // fill all histograms with 0
-    for(unsigned int i = flat_id; i < total_bins * SharedHistograms; i += BlockSize)
+    // fill the window of all channels with 0
+    for(unsigned int i = flat_id; i < window_bins * ActiveChannels; i += BlockSize)
     {
-        block_histogram_start[i] = 0;
+        block_histogram[i] = 0;
     }
     ::rocprim::syncthreads();
 
+    const auto count_sample = [&](const sample_vector_type& value, Bin weight)
+    {
+        for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+        {
+            unsigned int bin;
+            if(sample_to_bin_op[channel](value.values[channel], bin))
+            {
+                // Unsigned wrap-around skips the bins before the window
+                const unsigned int window_bin = bin - window_begin;
+                if(window_bin < window_bins)
+                {
+                    ::rocprim::detail::atomic_add(
+                        block_histogram + channel * window_bins + window_bin, weight);
+                }
+            }
+        }
+    };
+
     const unsigned int start_row = block_id1 * rows_per_block;
     const unsigned int end_row   = ::rocprim::min(rows, start_row + rows_per_block);
     for(unsigned int row = start_row; row < end_row; row++)
@@ -380,47 +1015,39 @@ ROCPRIM_DEVICE ROCPRIM_INLINE void
         while(block_offset < columns)
         {
             sample_vector_type values[ItemsPerThread];
+            Bin                weight_values[ItemsPerThread];
 
+            const size_t weights_offset = static_cast<size_t>(row) * columns + block_offset;
             if(block_offset + items_per_block <= columns)
             {
-                load_samples<BlockSize>(flat_id, row_samples + Channels * block_offset, values);
+                load_weighted_samples<BlockSize>(flat_id,
+                                                 row_samples + Channels * block_offset,
+                                                 weights,
+                                                 weights_offset,
+                                                 values,
+                                                 weight_values);
 
                 for(unsigned int i = 0; i < ItemsPerThread; i++)
                 {
-                    for(unsigned int channel = 0; channel < ActiveChannels; channel++)
-                    {
-                        unsigned int bin;
-                        if(sample_to_bin_op[channel](values[i].values[channel], bin))
-                        {
-                            ::rocprim::detail::atomic_add(block_histogram[channel] + bin
-                                                              + thread_shift,
-                                                          1);
-                        }
-                    }
+                    count_sample(values[i], weight_values[i]);
                 }
             }
             else
             {
                 const unsigned int valid_count = columns - block_offset;
-                load_samples<BlockSize>(flat_id,
-                                        row_samples + Channels * block_offset,
-                                        values,
-                                        valid_count);
+                load_weighted_samples<BlockSize>(flat_id,
+                                                 row_samples + Channels * block_offset,
+                                                 weights,
+                                                 weights_offset,
+                                                 values,
+                                                 weight_values,
+                                                 valid_count);
 
                 for(unsigned int i = 0; i < ItemsPerThread; i++)
                 {
                     if(flat_id * ItemsPerThread + i < valid_count)
                     {
-                        for(unsigned int channel = 0; channel < ActiveChannels; channel++)
-                        {
-                            unsigned int bin;
-                            if(sample_to_bin_op[channel](values[i].values[channel], bin))
-                            {
-                                ::rocprim::detail::atomic_add(block_histogram[channel] + bin
-                                                                  + thread_shift,
-                                                              1);
-                            }
-                        }
+                        count_sample(values[i], weight_values[i]);
                     }
                 }
             }
@@ -432,14 +1059,11 @@ ROCPRIM_DEVICE ROCPRIM_INLINE void
 
     for(unsigned int channel = 0; channel < ActiveChannels; channel++)
     {
-        for(unsigned int bin = flat_id; bin < bins[channel]; bin += BlockSize)
+        const unsigned int window_end = ::rocprim::min(bins[channel], window_begin + window_bins);
+        for(unsigned int bin = window_begin + flat_id; bin < window_end; bin += BlockSize)
         {
-            unsigned int total = 0;
-            for(unsigned int i = 0; i < SharedHistograms; i++)
-            {
-                total += block_histogram[channel][bin + i * total_bins];
-            }
-            if(total > 0)
+            const Bin total = block_histogram[channel * window_bins + bin - window_begin];
+            if(total != Bin(0))
             {
                 ::rocprim::detail::atomic_add(&histogram[channel][bin], total);
             }
@@ -452,11 +1076,14 @@ template<unsigned int BlockSize,
          unsigned int Channels,
          unsigned int ActiveChannels,
          class SampleIterator,
+         class WeightIterator,
          class Counter,
          class SampleToBinOp>
 ROCPRIM_DEVICE ROCPRIM_INLINE void
     histogram_global(SampleIterator                             samples,
+                     WeightIterator                             weights,
                      unsigned int                               columns,
+                     unsigned int                               rows,
                      unsigned int                               row_stride,
                      fixed_array<Counter*, ActiveChannels>      histogram,
                      fixed_array<SampleToBinOp, ActiveChannels> sample_to_bin_op,
@@ -464,54 +1091,133 @@ ROCPRIM_DEVICE ROCPRIM_INLINE void
 {
     using sample_type        = typename std::iterator_traits<SampleIterator>::value_type;
     using sample_vector_type = sample_vector<sample_type, Channels>;
+    using bin_type           = typename histogram_bin_type<WeightIterator, Counter>::type;
 
     constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
 
-    const unsigned int flat_id      = ::rocprim::detail::block_thread_id<0>();
-    const unsigned int block_id0    = ::rocprim::detail::block_id<0>();
-    const unsigned int block_id1    = ::rocprim::detail::block_id<1>();
-    const unsigned int block_offset = block_id0 * items_per_block;
+    const unsigned int flat_id    = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int block_id0  = ::rocprim::detail::block_id<0>();
+    const unsigned int block_id1  = ::rocprim::detail::block_id<1>();
+    const unsigned int grid_size0 = ::rocprim::detail::grid_size<0>();
+    const unsigned int grid_size1 = ::rocprim::detail::grid_size<1>();
 
-    samples += block_id1 * row_stride + Channels * block_offset;
+    using bin_ops_type = histogram_block_bin_ops<SampleToBinOp, ActiveChannels>;
+    ROCPRIM_SHARED_MEMORY typename bin_ops_type::storage_type bin_ops_storage;
+    bin_ops_type::template load<BlockSize>(sample_to_bin_op, bin_ops_storage);
 
-    sample_vector_type values[ItemsPerThread];
-    unsigned int       valid_count;
-    if(block_offset + items_per_block <= columns)
+    // The grid covers all tiles unless it is limited by blocks_per_cu, then every block
+    // counts the tiles of the strided rows and columns
+    for(unsigned int row = block_id1; row < rows; row += grid_size1)
     {
-        valid_count = items_per_block;
-        load_samples<BlockSize>(flat_id, samples, values);
+        for(unsigned int block_offset = block_id0 * items_per_block; block_offset < columns;
+            block_offset += grid_size0 * items_per_block)
+        {
+            const SampleIterator tile_samples
+                = samples + static_cast<size_t>(row) * row_stride + Channels * block_offset;
+            const size_t weights_offset = static_cast<size_t>(row) * columns + block_offset;
+
+            sample_vector_type values[ItemsPerThread];
+            bin_type           weight_values[ItemsPerThread];
+            unsigned int       valid_count;
+            if(block_offset + items_per_block <= columns)
+            {
+                valid_count = items_per_block;
+                load_weighted_samples<BlockSize>(flat_id,
+                                                 tile_samples,
+                                                 weights,
+                                                 weights_offset,
+                                                 values,
+                                                 weight_values);
+            }
+            else
+            {
+                valid_count = columns - block_offset;
+                load_weighted_samples<BlockSize>(flat_id,
+                                                 tile_samples,
+                                                 weights,
+                                                 weights_offset,
+                                                 values,
+                                                 weight_values,
+                                                 valid_count);
+            }
+
+            for(unsigned int i = 0; i < ItemsPerThread; i++)
+            {
+                for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+                {
+                    unsigned int bin;
+                    if(sample_to_bin_op[channel](values[i].values[channel], bin))
+                    {
+                        const unsigned int pos = flat_id * ItemsPerThread + i;
+                        histogram_aggregated_add(histogram[channel],
+                                                 bin,
+                                                 bins_bits[channel],
+                                                 pos < valid_count,
+                                                 weight_values[i],
+                                                 weights);
+                    }
+                }
+            }
+        }
     }
-    else
+}
+
+// Bin index of a sample of one channel, samples outside of the histogram get the index
+// bins, which is sorted after all bins and is not counted.
+template<unsigned int Channels, class SampleIterator, class SampleToBinOp>
+struct histogram_sort_key_op
+{
+    SampleIterator samples;
+    unsigned int   columns;
+    unsigned int   row_stride;
+    unsigned int   channel;
+    SampleToBinOp  sample_to_bin_op;
+    unsigned int   bins;
+
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE unsigned int operator()(size_t i) const
     {
-        valid_count = columns - block_offset;
-        load_samples<BlockSize>(flat_id, samples, values, valid_count);
+        const size_t row    = i / columns;
+        const size_t column = i % columns;
+
+        unsigned int bin;
+        if(sample_to_bin_op(samples[row * row_stride + column * Channels + channel], bin))
+        {
+            return bin;
+        }
+        return bins;
     }
+};
 
-    for(unsigned int i = 0; i < ItemsPerThread; i++)
+// Counts of the runs of sorted bin indices. Each position between two different bins is
+// the end of the run of the previous bin and the beginning of the run of the next bin,
+// so the count of a bin is the sum of its end position and its negated beginning position.
+// Every counter is updated at most twice.
+template<unsigned int BlockSize, class Counter>
+ROCPRIM_DEVICE ROCPRIM_INLINE void histogram_sort_counts(const unsigned int* sorted_bins,
+                                                         size_t              size,
+                                                         Counter*            histogram,
+                                                         unsigned int        bins)
+{
+    const size_t i = static_cast<size_t>(::rocprim::detail::block_id<0>()) * BlockSize
+                     + ::rocprim::detail::block_thread_id<0>();
+
+    if(i == 0 || i > size)
     {
-        for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+        return;
+    }
+
+    const unsigned int prev_bin = sorted_bins[i - 1];
+    const unsigned int bin      = i < size ? sorted_bins[i] : bins;
+    if(prev_bin != bin)
+    {
+        if(prev_bin < bins)
         {
-            unsigned int bin;
-            if(sample_to_bin_op[channel](values[i].values[channel], bin))
-            {
-                const unsigned int pos                 = flat_id * ItemsPerThread + i;
-                lane_mask_type     same_bin_lanes_mask = ::rocprim::ballot(pos < valid_count);
-                for(unsigned int b = 0; b < bins_bits[channel]; b++)
-                {
-                    const unsigned int   bit_set      = bin & (1u << b);
-                    const lane_mask_type bit_set_mask = ::rocprim::ballot(bit_set);
-                    same_bin_lanes_mask &= (bit_set ? bit_set_mask : ~bit_set_mask);
-                }
-                const unsigned int same_bin_count = ::rocprim::bit_count(same_bin_lanes_mask);
-                const unsigned int prev_same_bin_count
-                    = ::rocprim::masked_bit_count(same_bin_lanes_mask);
-                if(prev_same_bin_count == 0)
-                {
-                    // Write the number of lanes having this bin,
-                    // if the current lane is the first (and maybe only) lane with this bin.
-                    ::rocprim::detail::atomic_add(&histogram[channel][bin], same_bin_count);
-                }
-            }
+            ::rocprim::detail::atomic_add(&histogram[prev_bin], static_cast<Counter>(i));
+        }
+        if(bin < bins)
+        {
+            ::rocprim::detail::atomic_add(&histogram[bin],
+                                          Counter(0) - static_cast<Counter>(i));
         }
     }
 }
@@ -0,0 +1,149 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_INSTANTIATIONS_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_INSTANTIATIONS_HPP_
+
+// Instantiations of device algorithms for common types and raw pointers, which are compiled
+// once into the rocprim_instantiations library (CMake option BUILD_INSTANTIATIONS). Code that
+// links the library and defines ROCPRIM_USE_INSTANTIATIONS (the library target sets it) sees
+// explicit instantiation declarations of these specializations, so it calls them instead of
+// instantiating the algorithms and their kernels again. The kernels are compiled for the
+// GPU_TARGETS of the library, the application must not run on other targets.
+//
+// An explicit instantiation declaration does not prevent the instantiation of an inline
+// function, which is still instantiated to be inlined. The instantiated algorithms are function
+// templates that are not declared inline for this reason.
+//
+// The macros are expanded at the end of the headers of the algorithms with Prefix being
+// "extern template", and in the sources of the library with Prefix being "template".
+
+// Types of keys and values of the instantiations
+#define ROCPRIM_DETAIL_FOR_EACH_INSTANTIATED_TYPE(Macro, Prefix) \
+    Macro(Prefix, int)                                           \
+    Macro(Prefix, unsigned int)                                  \
+    Macro(Prefix, long long)                                     \
+    Macro(Prefix, unsigned long long)                            \
+    Macro(Prefix, float)                                         \
+    Macro(Prefix, double)
+
+// Types of values of radix_sort_pairs, every key type is combined with every value type
+#define ROCPRIM_DETAIL_FOR_EACH_INSTANTIATED_VALUE_TYPE(Macro, Prefix, Key) \
+    Macro(Prefix, Key, int)                                                 \
+    Macro(Prefix, Key, unsigned int)                                        \
+    Macro(Prefix, Key, float)
+
+// inclusive_scan and exclusive_scan with rocprim::plus
+#define ROCPRIM_DETAIL_SCAN_INSTANTIATIONS(Prefix, T)                                           \
+    Prefix hipError_t inclusive_scan<default_config, T*, T*, ::rocprim::plus<T>>(               \
+        void*,                                                                                  \
+        size_t&,                                                                                \
+        T*,                                                                                     \
+        T*,                                                                                     \
+        const size_t,                                                                           \
+        ::rocprim::plus<T>,                                                                     \
+        const hipStream_t,                                                                      \
+        bool);                                                                                  \
+    Prefix hipError_t exclusive_scan<default_config, T*, T*, T, ::rocprim::plus<T>>(            \
+        void*,                                                                                  \
+        size_t&,                                                                                \
+        T*,                                                                                     \
+        T*,                                                                                     \
+        const T,                                                                                \
+        const size_t,                                                                           \
+        ::rocprim::plus<T>,                                                                     \
+        const hipStream_t,                                                                      \
+        bool);
+
+// reduce with rocprim::plus, with and without an initial value
+#define ROCPRIM_DETAIL_REDUCE_INSTANTIATIONS(Prefix, T)                                         \
+    Prefix hipError_t reduce<default_config, T*, T*, ::rocprim::plus<T>>(                       \
+        void*,                                                                                  \
+        size_t&,                                                                                \
+        T*,                                                                                     \
+        T*,                                                                                     \
+        const size_t,                                                                           \
+        ::rocprim::plus<T>,                                                                     \
+        const hipStream_t,                                                                      \
+        bool);                                                                                  \
+    Prefix hipError_t reduce<default_config, T*, T*, T, ::rocprim::plus<T>>(                    \
+        void*,                                                                                  \
+        size_t&,                                                                                \
+        T*,                                                                                     \
+        T*,                                                                                     \
+        const T,                                                                                \
+        const size_t,                                                                           \
+        ::rocprim::plus<T>,                                                                     \
+        const hipStream_t,                                                                      \
+        bool);
+
+// Ascending radix_sort_keys of size_t and unsigned int sizes
+#define ROCPRIM_DETAIL_RADIX_SORT_KEYS_INSTANTIATION(Prefix, Key, Size)                        \
+    Prefix hipError_t radix_sort_keys<default_config,                                          \
+                                      radix_float_order::signed_zeros_equal,                   \
+                                      Key*,                                                    \
+                                      Key*,                                                    \
+                                      Size,                                                    \
+                                      Key>(void*,                                              \
+                                           size_t&,                                            \
+                                           Key*,                                               \
+                                           Key*,                                               \
+                                           Size,                                               \
+                                           unsigned int,                                       \
+                                           unsigned int,                                       \
+                                           hipStream_t,                                        \
+                                           bool,                                               \
+                                           unsigned int*);
+
+#define ROCPRIM_DETAIL_RADIX_SORT_KEYS_INSTANTIATIONS(Prefix, Key)         \
+    ROCPRIM_DETAIL_RADIX_SORT_KEYS_INSTANTIATION(Prefix, Key, size_t)      \
+    ROCPRIM_DETAIL_RADIX_SORT_KEYS_INSTANTIATION(Prefix, Key, unsigned int)
+
+// Ascending radix_sort_pairs of size_t and unsigned int sizes
+#define ROCPRIM_DETAIL_RADIX_SORT_PAIRS_INSTANTIATION(Prefix, Key, Value, Size)                \
+    Prefix hipError_t radix_sort_pairs<default_config,                                         \
+                                       radix_float_order::signed_zeros_equal,                  \
+                                       Key*,                                                   \
+                                       Key*,                                                   \
+                                       Value*,                                                 \
+                                       Value*,                                                 \
+                                       Size,                                                   \
+                                       Key>(void*,                                             \
+                                            size_t&,                                           \
+                                            Key*,                                              \
+                                            Key*,                                              \
+                                            Value*,                                            \
+                                            Value*,                                            \
+                                            Size,                                              \
+                                            unsigned int,                                      \
+                                            unsigned int,                                      \
+                                            hipStream_t,                                       \
+                                            bool,                                              \
+                                            unsigned int*);
+
+#define ROCPRIM_DETAIL_RADIX_SORT_PAIRS_VALUE_INSTANTIATIONS(Prefix, Key, Value)         \
+    ROCPRIM_DETAIL_RADIX_SORT_PAIRS_INSTANTIATION(Prefix, Key, Value, size_t)            \
+    ROCPRIM_DETAIL_RADIX_SORT_PAIRS_INSTANTIATION(Prefix, Key, Value, unsigned int)
+
+#define ROCPRIM_DETAIL_RADIX_SORT_PAIRS_INSTANTIATIONS(Prefix, Key)                    \
+    ROCPRIM_DETAIL_FOR_EACH_INSTANTIATED_VALUE_TYPE(                                   \
+        ROCPRIM_DETAIL_RADIX_SORT_PAIRS_VALUE_INSTANTIATIONS, Prefix, Key)
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_INSTANTIATIONS_HPP_
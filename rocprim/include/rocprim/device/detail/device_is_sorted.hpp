@@ -0,0 +1,181 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_IS_SORTED_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_IS_SORTED_HPP_
+
+#include <iterator>
+#include <type_traits>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../functional.hpp"
+#include "../../intrinsics.hpp"
+#include "../../intrinsics/atomic.hpp"
+
+#include "../../block/block_adjacent_difference.hpp"
+#include "../../block/block_load.hpp"
+#include "../../block/block_reduce.hpp"
+
+#include "../config_types.hpp"
+#include "../device_reduce_config.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// No unsorted item has been found
+constexpr unsigned long long is_sorted_none = static_cast<unsigned long long>(-1);
+
+// Finds the first unsorted item of the tile of the block, and lowers first_unsorted to its
+// index. A block skips its tile when an unsorted item has already been found before it: the
+// result is the smallest index, so items after it do not change it.
+template<class Config, class InputIterator, class CompareFunction>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void is_sorted_kernel_impl(InputIterator       input,
+                           const size_t        size,
+                           const size_t        starting_offset,
+                           CompareFunction     compare,
+                           unsigned long long* first_unsorted)
+{
+    static constexpr reduce_config_params params = device_params<Config>();
+
+    constexpr unsigned int block_size       = params.block_size;
+    constexpr unsigned int items_per_thread = params.items_per_thread;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    using block_load_type = ::rocprim::block_load<input_type,
+                                                  block_size,
+                                                  items_per_thread,
+                                                  block_load_method::block_load_transpose>;
+    using block_adjacent_difference_type
+        = ::rocprim::block_adjacent_difference<input_type, block_size>;
+    using block_reduce_type
+        = ::rocprim::block_reduce<unsigned int, block_size, params.block_reduce_method>;
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        bool                                                  skip;
+        typename block_load_type::storage_type                load;
+        typename block_adjacent_difference_type::storage_type adjacent_difference;
+        typename block_reduce_type::storage_type              reduce;
+    } storage;
+
+    const unsigned int flat_id       = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int flat_block_id = ::rocprim::detail::block_id<0>();
+    const size_t       block_offset
+        = starting_offset + static_cast<size_t>(flat_block_id) * items_per_block;
+
+    if(flat_id == 0)
+    {
+        storage.skip = ::rocprim::detail::atomic_load_acquire(first_unsorted) <= block_offset;
+    }
+    ::rocprim::syncthreads();
+    if(storage.skip)
+    {
+        return;
+    }
+
+    const unsigned int valid_items
+        = static_cast<unsigned int>(::rocprim::min<size_t>(size - block_offset, items_per_block));
+
+    input_type values[items_per_thread];
+    if(valid_items == items_per_block)
+    {
+        block_load_type().load(input + block_offset, values, storage.load);
+    }
+    else
+    {
+        block_load_type().load(input + block_offset, values, valid_items, storage.load);
+    }
+    ::rocprim::syncthreads();
+
+    // The flag of the item i is compare(input[i], input[i - 1]), i.e. the item is out of order.
+    // The first item is compared with itself, which never flags it.
+    const input_type tile_predecessor = block_offset == 0 ? input[0] : input[block_offset - 1];
+
+    bool flags[items_per_thread];
+    if(valid_items == items_per_block)
+    {
+        block_adjacent_difference_type().subtract_left(values,
+                                                       flags,
+                                                       compare,
+                                                       tile_predecessor,
+                                                       storage.adjacent_difference);
+    }
+    else
+    {
+        block_adjacent_difference_type().subtract_left_partial(values,
+                                                               flags,
+                                                               compare,
+                                                               tile_predecessor,
+                                                               valid_items,
+                                                               storage.adjacent_difference);
+    }
+
+    const unsigned int thread_offset = flat_id * items_per_thread;
+    unsigned int       first_flagged = items_per_block;
+    ROCPRIM_UNROLL
+    for(unsigned int i = items_per_thread; i-- > 0;)
+    {
+        if(flags[i] && thread_offset + i < valid_items)
+        {
+            first_flagged = thread_offset + i;
+        }
+    }
+
+    block_reduce_type().reduce(first_flagged,
+                               first_flagged,
+                               storage.reduce,
+                               ::rocprim::minimum<unsigned int>());
+
+    if(flat_id == 0 && first_flagged != items_per_block)
+    {
+        ::rocprim::detail::atomic_min(first_unsorted, block_offset + first_flagged);
+    }
+}
+
+// Stores whether the range is sorted (IsSortedUntil is false) or the index of the first unsorted
+// item, the size of the input if there is none (IsSortedUntil is true).
+template<bool IsSortedUntil, class OutputIterator>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void is_sorted_store(OutputIterator                  output,
+                     const size_t                    size,
+                     const unsigned long long* const first_unsorted)
+{
+    const unsigned long long first = *first_unsorted;
+    if(IsSortedUntil)
+    {
+        *output = first == is_sorted_none ? size : static_cast<size_t>(first);
+    }
+    else
+    {
+        *output = first == is_sorted_none;
+    }
+}
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_IS_SORTED_HPP_
@@ -68,16 +68,19 @@ void partition_kernel_impl(IndexIterator indices,
                            const unsigned int spacing,
                            BinaryFunction compare_function)
 {
+    // The partitions are 32-bit offsets if the merged size allows, otherwise 64-bit offsets
+    using offset_type = typename std::iterator_traits<IndexIterator>::value_type;
+
     const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
     const unsigned int flat_block_id = ::rocprim::detail::block_id<0>();
     const unsigned int flat_block_size = ::rocprim::detail::block_size<0>();
 
     unsigned int id = flat_block_id * flat_block_size + flat_id;
 
-    unsigned int partition_id = id * spacing;
-    size_t diag = min(static_cast<size_t>(partition_id), input1_size + input2_size);
+    size_t partition_id = static_cast<size_t>(id) * spacing;
+    size_t diag = min(partition_id, input1_size + input2_size);
 
-    unsigned int begin =
+    const offset_type begin =
         merge_path(
             keys_input1,
             keys_input2,
@@ -285,6 +288,7 @@ void merge_kernel_impl(IndexIterator indices,
 {
     using key_type = typename std::iterator_traits<KeysInputIterator1>::value_type;
     using value_type = typename std::iterator_traits<ValuesInputIterator1>::value_type;
+    using offset_type = typename std::iterator_traits<IndexIterator>::value_type;
     using keys_store_type = ::rocprim::block_store<
         key_type, BlockSize, ItemsPerThread,
         ::rocprim::block_store_method::block_store_transpose
@@ -305,22 +309,26 @@ void merge_kernel_impl(IndexIterator indices,
 
     const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
     const unsigned int flat_block_id = ::rocprim::detail::block_id<0>();
-    const unsigned int block_offset = flat_block_id * items_per_block;
-    const unsigned int count = input1_size + input2_size;
-    const unsigned int valid_in_last_block = count - block_offset;
-    const bool         is_incomplete_block = valid_in_last_block < items_per_block;
-
-    const unsigned int p1 = indices[flat_block_id];
-    const unsigned int p2 = indices[flat_block_id + 1];
-
-    range_t range =
-        compute_range(
-            flat_block_id, input1_size, input2_size, items_per_block,
-            p1, p2
-        );
+    const offset_type block_offset = static_cast<offset_type>(flat_block_id) * items_per_block;
+    const offset_type count = input1_size + input2_size;
+    const bool is_incomplete_block = count - block_offset < items_per_block;
+    const unsigned int valid_in_last_block
+        = is_incomplete_block ? static_cast<unsigned int>(count - block_offset) : items_per_block;
+
+    const offset_type p1 = indices[flat_block_id];
+    const offset_type p2 = indices[flat_block_id + 1];
+
+    // The global offsets of the block are kept in offset_type, the range itself is local
+    const offset_type diag2 = min(count, block_offset + items_per_block);
+    const offset_type begin1 = p1;
+    const offset_type begin2 = block_offset - p1;
+    const range_t range = range_t{0,
+                                  static_cast<unsigned int>(p2 - p1),
+                                  0,
+                                  static_cast<unsigned int>((diag2 - p2) - begin2)};
 
     merge_keys<BlockSize>(
-        flat_id, keys_input1, keys_input2, input, index,
+        flat_id, keys_input1 + begin1, keys_input2 + begin2, input, index,
         storage.keys_shared.get(),
         range, compare_function
     );
@@ -346,7 +354,7 @@ void merge_kernel_impl(IndexIterator indices,
     }
 
     merge_values<with_values, BlockSize>(
-        flat_id, values_input1 + range.begin1, values_input2 + range.begin2,
+        flat_id, values_input1 + begin1, values_input2 + begin2,
         values_output + block_offset, index,
         range.count1(), range.count2()
     );
@@ -0,0 +1,458 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_MERGE_K_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_MERGE_K_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "../../config.hpp"
+#include "../../detail/merge_path.hpp"
+#include "../../detail/various.hpp"
+
+#include "../../block/block_reduce.hpp"
+#include "../../functional.hpp"
+#include "../../intrinsics.hpp"
+#include "../../types.hpp"
+
+#include "device_binary_search.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// K-way merge.
+//
+// The output is split into tiles of the merge kernel. For every tile boundary the partition
+// kernel finds how many keys of every run are before the boundary (a multi-sequence merge path).
+// Keys are ordered by the comparison function and equal keys by the index of their run, so the
+// merge is stable.
+//
+// A boundary is found by bisection: all undecided keys of a run are in [lo, hi). In every step
+// the weighted median of the middle keys of all runs (weighted by hi - lo) is the pivot, its rank
+// is the sum of its positions in all runs. The keys on one side of the pivot are decided, which
+// removes at least a quarter of the undecided keys.
+//
+// The merge kernel loads the keys of its tile into shared memory, where they form one sorted
+// list per run. Pairs of lists are merged by merge path until one list is left.
+
+constexpr unsigned int merge_k_partition_block_size      = 64;
+constexpr unsigned int merge_k_partition_runs_per_thread = 4;
+constexpr unsigned int merge_k_max_runs
+    = merge_k_partition_block_size * merge_k_partition_runs_per_thread;
+
+template<class Key, class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+bool merge_k_less(const Key& a,
+                  const unsigned int run_a,
+                  const Key& b,
+                  const unsigned int run_b,
+                  BinaryFunction compare_function)
+{
+    return compare_function(a, b) || (!compare_function(b, a) && run_a < run_b);
+}
+
+// Index of the run of the tile that contains the item, offsets has runs + 1 elements
+ROCPRIM_DEVICE ROCPRIM_INLINE
+unsigned int merge_k_find_run(const unsigned int* offsets,
+                              const unsigned int runs,
+                              const unsigned int item)
+{
+    return upper_bound_n(offsets, runs + 1, item, ::rocprim::less<unsigned int>()) - 1;
+}
+
+template<
+    unsigned int BlockSize,
+    unsigned int RunsPerThread,
+    class KeysInputsIterator,
+    class RunSizesIterator,
+    class BinaryFunction
+>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void merge_k_partition_kernel_impl(unsigned int* splits,
+                                   KeysInputsIterator keys_inputs,
+                                   RunSizesIterator run_sizes,
+                                   const unsigned int runs,
+                                   const unsigned int size,
+                                   const unsigned int spacing,
+                                   BinaryFunction compare_function)
+{
+    using keys_input_type = typename std::iterator_traits<KeysInputsIterator>::value_type;
+    using key_type = typename std::iterator_traits<keys_input_type>::value_type;
+    using reduce_type = ::rocprim::block_reduce<size_t, BlockSize>;
+
+    constexpr unsigned int max_runs = BlockSize * RunsPerThread;
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        typename reduce_type::storage_type reduce;
+        detail::raw_storage<key_type[max_runs]> midpoints;
+        unsigned int weights[max_runs];
+        size_t total_weight;
+        size_t pivot_rank;
+        unsigned int pivot_run;
+        unsigned int pivot_position;
+    } storage;
+
+    key_type* midpoints = storage.midpoints.get();
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int boundary = ::rocprim::detail::block_id<0>();
+    const size_t diag = ::rocprim::min(static_cast<size_t>(boundary) * spacing,
+                                       static_cast<size_t>(size));
+
+    unsigned int run_size[RunsPerThread];
+    unsigned int lo[RunsPerThread];
+    unsigned int hi[RunsPerThread];
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < RunsPerThread; i++)
+    {
+        const unsigned int run = flat_id + i * BlockSize;
+        run_size[i] = run < runs ? static_cast<unsigned int>(run_sizes[run]) : 0;
+        lo[i] = 0;
+        hi[i] = run_size[i];
+    }
+
+    while(true)
+    {
+        size_t thread_weight = 0;
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < RunsPerThread; i++)
+        {
+            const unsigned int run = flat_id + i * BlockSize;
+            if(run < runs)
+            {
+                const unsigned int weight = hi[i] - lo[i];
+                storage.weights[run] = weight;
+                if(weight > 0)
+                {
+                    keys_input_type keys_input = keys_inputs[run];
+                    midpoints[run] = keys_input[lo[i] + weight / 2];
+                }
+                thread_weight += weight;
+            }
+        }
+        ::rocprim::syncthreads();
+
+        size_t total_weight;
+        reduce_type().reduce(thread_weight, total_weight, storage.reduce);
+        if(flat_id == 0)
+        {
+            storage.total_weight = total_weight;
+        }
+        ::rocprim::syncthreads();
+        total_weight = storage.total_weight;
+        if(total_weight == 0)
+        {
+            break;
+        }
+
+        // Exactly one midpoint is the weighted median
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < RunsPerThread; i++)
+        {
+            const unsigned int run = flat_id + i * BlockSize;
+            const unsigned int weight = run < runs ? hi[i] - lo[i] : 0;
+            if(weight > 0)
+            {
+                const key_type midpoint = midpoints[run];
+                size_t less_weight = 0;
+                for(unsigned int other = 0; other < runs; other++)
+                {
+                    const unsigned int other_weight = storage.weights[other];
+                    if(other_weight > 0
+                       && merge_k_less(midpoints[other], other, midpoint, run, compare_function))
+                    {
+                        less_weight += other_weight;
+                    }
+                }
+                if(2 * less_weight <= total_weight && total_weight < 2 * (less_weight + weight))
+                {
+                    storage.pivot_run = run;
+                    storage.pivot_position = lo[i] + weight / 2;
+                }
+            }
+        }
+        ::rocprim::syncthreads();
+
+        const unsigned int pivot_run = storage.pivot_run;
+        const unsigned int pivot_position = storage.pivot_position;
+        const key_type pivot = midpoints[pivot_run];
+
+        // Position of the pivot in every run, equal keys of runs before the pivot's run are before it
+        unsigned int positions[RunsPerThread];
+        size_t thread_rank = 0;
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < RunsPerThread; i++)
+        {
+            const unsigned int run = flat_id + i * BlockSize;
+            positions[i] = 0;
+            if(run < runs)
+            {
+                keys_input_type keys_input = keys_inputs[run];
+                positions[i] = run == pivot_run ? pivot_position
+                    : run < pivot_run ? upper_bound_n(keys_input, run_size[i], pivot, compare_function)
+                    : lower_bound_n(keys_input, run_size[i], pivot, compare_function);
+                thread_rank += positions[i];
+            }
+        }
+
+        size_t pivot_rank;
+        reduce_type().reduce(thread_rank, pivot_rank, storage.reduce);
+        if(flat_id == 0)
+        {
+            storage.pivot_rank = pivot_rank;
+        }
+        ::rocprim::syncthreads();
+        pivot_rank = storage.pivot_rank;
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < RunsPerThread; i++)
+        {
+            const unsigned int run = flat_id + i * BlockSize;
+            if(run < runs)
+            {
+                if(pivot_rank < diag)
+                {
+                    // The pivot and all keys before it are before the boundary
+                    const unsigned int position
+                        = run == pivot_run ? pivot_position + 1 : positions[i];
+                    lo[i] = ::rocprim::max(lo[i], position);
+                }
+                else
+                {
+                    hi[i] = ::rocprim::min(hi[i], positions[i]);
+                }
+            }
+        }
+    }
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < RunsPerThread; i++)
+    {
+        const unsigned int run = flat_id + i * BlockSize;
+        if(run < runs)
+        {
+            splits[static_cast<size_t>(boundary) * runs + run] = lo[i];
+        }
+    }
+}
+
+// Merges pairs of lists of runs [first, first + width) and [first + width, first + 2 * width)
+template<unsigned int ItemsPerThread, class Key, class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void merge_k_merge_lists(const unsigned int flat_id,
+                         const Key* keys_in,
+                         const unsigned int* indices_in,
+                         Key* keys_out,
+                         unsigned int* indices_out,
+                         const unsigned int* offsets,
+                         const unsigned int runs,
+                         const unsigned int width,
+                         const unsigned int count,
+                         BinaryFunction compare_function)
+{
+    unsigned int output = flat_id * ItemsPerThread;
+    const unsigned int output_end = ::rocprim::min(output + ItemsPerThread, count);
+    while(output < output_end)
+    {
+        const unsigned int first = merge_k_find_run(offsets, runs, output) / (2 * width) * (2 * width);
+        const unsigned int begin1 = offsets[first];
+        const unsigned int end1 = offsets[::rocprim::min(first + width, runs)];
+        const unsigned int end2 = offsets[::rocprim::min(first + 2 * width, runs)];
+        const unsigned int diag = output - begin1;
+        const unsigned int split = merge_path(keys_in + begin1, keys_in + end1,
+                                              end1 - begin1, end2 - end1,
+                                              diag, compare_function);
+
+        unsigned int index1 = begin1 + split;
+        unsigned int index2 = end1 + diag - split;
+        const unsigned int chunk_end = ::rocprim::min(output_end, end2);
+        for(; output < chunk_end; output++)
+        {
+            const bool take1 = index2 >= end2
+                || (index1 < end1 && !compare_function(keys_in[index2], keys_in[index1]));
+            const unsigned int index = take1 ? index1++ : index2++;
+            keys_out[output] = keys_in[index];
+            indices_out[output] = indices_in[index];
+        }
+    }
+}
+
+template<
+    bool WithValues,
+    unsigned int BlockSize,
+    class ValuesInputsIterator,
+    class ValuesOutputIterator
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+typename std::enable_if<WithValues>::type
+merge_k_store_values(const unsigned int flat_id,
+                     ValuesInputsIterator values_inputs,
+                     ValuesOutputIterator values_output,
+                     const unsigned int* indices,
+                     const unsigned int* offsets,
+                     const unsigned int* begins,
+                     const unsigned int runs,
+                     const unsigned int count)
+{
+    using values_input_type = typename std::iterator_traits<ValuesInputsIterator>::value_type;
+
+    for(unsigned int i = flat_id; i < count; i += BlockSize)
+    {
+        const unsigned int index = indices[i];
+        const unsigned int run = merge_k_find_run(offsets, runs, index);
+        values_input_type values_input = values_inputs[run];
+        values_output[i] = values_input[begins[run] + index - offsets[run]];
+    }
+}
+
+template<
+    bool WithValues,
+    unsigned int BlockSize,
+    class ValuesInputsIterator,
+    class ValuesOutputIterator
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+typename std::enable_if<!WithValues>::type
+merge_k_store_values(const unsigned int flat_id,
+                     ValuesInputsIterator values_inputs,
+                     ValuesOutputIterator values_output,
+                     const unsigned int* indices,
+                     const unsigned int* offsets,
+                     const unsigned int* begins,
+                     const unsigned int runs,
+                     const unsigned int count)
+{
+    (void) flat_id;
+    (void) values_inputs;
+    (void) values_output;
+    (void) indices;
+    (void) offsets;
+    (void) begins;
+    (void) runs;
+    (void) count;
+}
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int MaxRuns,
+    class KeysInputsIterator,
+    class KeysOutputIterator,
+    class ValuesInputsIterator,
+    class ValuesOutputIterator,
+    class BinaryFunction
+>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void merge_k_kernel_impl(const unsigned int* splits,
+                         KeysInputsIterator keys_inputs,
+                         KeysOutputIterator keys_output,
+                         ValuesInputsIterator values_inputs,
+                         ValuesOutputIterator values_output,
+                         const unsigned int runs,
+                         const unsigned int size,
+                         BinaryFunction compare_function)
+{
+    using keys_input_type = typename std::iterator_traits<KeysInputsIterator>::value_type;
+    using key_type = typename std::iterator_traits<keys_input_type>::value_type;
+    using values_input_type = typename std::iterator_traits<ValuesInputsIterator>::value_type;
+    using value_type = typename std::iterator_traits<values_input_type>::value_type;
+    constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        detail::raw_storage<key_type[2 * items_per_block]> keys;
+        unsigned int indices[2 * items_per_block];
+        unsigned int offsets[MaxRuns + 1];
+        unsigned int begins[MaxRuns];
+    } storage;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int flat_block_id = ::rocprim::detail::block_id<0>();
+    const unsigned int block_offset = flat_block_id * items_per_block;
+    const unsigned int count = ::rocprim::min(items_per_block, size - block_offset);
+
+    // Range of every run in the tile
+    for(unsigned int run = flat_id; run < runs; run += BlockSize)
+    {
+        const unsigned int begin = splits[static_cast<size_t>(flat_block_id) * runs + run];
+        const unsigned int end = splits[static_cast<size_t>(flat_block_id + 1) * runs + run];
+        storage.begins[run] = begin;
+        storage.offsets[run + 1] = end - begin;
+    }
+    ::rocprim::syncthreads();
+    if(flat_id == 0)
+    {
+        storage.offsets[0] = 0;
+        for(unsigned int run = 0; run < runs; run++)
+        {
+            storage.offsets[run + 1] += storage.offsets[run];
+        }
+    }
+    ::rocprim::syncthreads();
+
+    key_type* keys_shared = storage.keys.get();
+    for(unsigned int i = flat_id; i < count; i += BlockSize)
+    {
+        const unsigned int run = merge_k_find_run(storage.offsets, runs, i);
+        keys_input_type keys_input = keys_inputs[run];
+        keys_shared[i] = keys_input[storage.begins[run] + i - storage.offsets[run]];
+        storage.indices[i] = i;
+    }
+    ::rocprim::syncthreads();
+
+    unsigned int current = 0;
+    for(unsigned int width = 1; width < runs; width *= 2)
+    {
+        merge_k_merge_lists<ItemsPerThread>(
+            flat_id,
+            keys_shared + current * items_per_block,
+            storage.indices + current * items_per_block,
+            keys_shared + (current ^ 1) * items_per_block,
+            storage.indices + (current ^ 1) * items_per_block,
+            storage.offsets, runs, width, count, compare_function
+        );
+        current ^= 1;
+        ::rocprim::syncthreads();
+    }
+
+    for(unsigned int i = flat_id; i < count; i += BlockSize)
+    {
+        keys_output[block_offset + i] = keys_shared[current * items_per_block + i];
+    }
+
+    merge_k_store_values<with_values, BlockSize>(
+        flat_id, values_inputs, values_output + block_offset,
+        storage.indices + current * items_per_block,
+        storage.offsets, storage.begins, runs, count
+    );
+}
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_MERGE_K_HPP_
@@ -32,6 +32,7 @@
 #include "../../types.hpp"
 
 #include "../../block/block_load.hpp"
+#include "../../block/block_discontinuity.hpp"
 #include "../../block/block_load_func.hpp"
 #include "../../block/block_sort.hpp"
 #include "../../block/block_store.hpp"
@@ -265,11 +266,15 @@ struct block_store_impl<true, BlockSize, ItemsPerThread, Key, Value> {
     }
 };
 
-template <unsigned int BlockSize, unsigned int ItemsPerThread, class Key>
+template<unsigned int         BlockSize,
+         unsigned int         ItemsPerThread,
+         class Key,
+         block_sort_algorithm Algorithm = block_sort_algorithm::default_algorithm>
 struct block_sort_impl
 {
     using stable_key_type = rocprim::tuple<Key, unsigned int>;
-    using block_sort_type = ::rocprim::block_sort<stable_key_type, BlockSize, ItemsPerThread>;
+    using block_sort_type
+        = ::rocprim::block_sort<stable_key_type, BlockSize, ItemsPerThread, empty_type, Algorithm>;
 
     using storage_type = typename block_sort_type::storage_type;
 
@@ -305,10 +310,151 @@ struct block_sort_impl
                 );
         }
     }
+
+    // Sorts the keys stably, ranks are the positions in the block the sorted keys come from,
+    // only the ranks of the first valid_in_last_block keys of an incomplete block are meaningful
+    template<class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort(Key (&keys)[ItemsPerThread],
+              unsigned int (&ranks)[ItemsPerThread],
+              storage_type& storage,
+              const unsigned int valid_in_last_block,
+              const bool is_incomplete_block,
+              BinaryFunction compare_function)
+    {
+        const unsigned int flat_id = block_thread_id<0>();
+
+        // Special comparison that preserves relative order of equal keys
+        auto stable_compare_function
+            = [compare_function](const stable_key_type& a, const stable_key_type& b) mutable -> bool
+        {
+            const bool ab = compare_function(rocprim::get<0>(a), rocprim::get<0>(b));
+            return ab
+                   || (!compare_function(rocprim::get<0>(b), rocprim::get<0>(a))
+                       && (rocprim::get<1>(a) < rocprim::get<1>(b)));
+        };
+
+        stable_key_type stable_keys[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int item = 0; item < ItemsPerThread; ++item)
+        {
+            stable_keys[item] = rocprim::make_tuple(keys[item], ItemsPerThread * flat_id + item);
+        }
+
+        sort(stable_keys, storage, valid_in_last_block, is_incomplete_block, stable_compare_function);
+
+        ROCPRIM_UNROLL
+        for(unsigned int item = 0; item < ItemsPerThread; ++item)
+        {
+            keys[item]  = rocprim::get<0>(stable_keys[item]);
+            ranks[item] = rocprim::get<1>(stable_keys[item]);
+        }
+    }
 };
 
-template<unsigned int BlockSize,
-         unsigned int ItemsPerThread,
+// The merge sort of block_sort is stable, so the keys are sorted with their positions as values
+// instead of (key, position) pairs, and the items past the end of an incomplete block are not
+// compared at all
+template<unsigned int BlockSize, unsigned int ItemsPerThread, class Key>
+struct block_sort_impl<BlockSize, ItemsPerThread, Key, block_sort_algorithm::merge_sort>
+{
+    using block_sort_type = ::rocprim::block_sort<Key,
+                                                  BlockSize,
+                                                  ItemsPerThread,
+                                                  unsigned int,
+                                                  block_sort_algorithm::merge_sort>;
+
+    using storage_type = typename block_sort_type::storage_type;
+
+    template<class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort(Key (&keys)[ItemsPerThread],
+              unsigned int (&ranks)[ItemsPerThread],
+              storage_type& storage,
+              const unsigned int valid_in_last_block,
+              const bool is_incomplete_block,
+              BinaryFunction compare_function)
+    {
+        const unsigned int flat_id = block_thread_id<0>();
+        ROCPRIM_UNROLL
+        for(unsigned int item = 0; item < ItemsPerThread; ++item)
+        {
+            ranks[item] = ItemsPerThread * flat_id + item;
+        }
+
+        if(is_incomplete_block)
+        {
+            block_sort_type().sort(keys, ranks, storage, valid_in_last_block, compare_function);
+        }
+        else
+        {
+            block_sort_type().sort(keys, ranks, storage, compare_function);
+        }
+    }
+};
+
+// Checks if the keys of a tile in blocked arrangement are already sorted. The block-sort step is
+// stable, so sorted tiles are not changed by it and are stored without being sorted.
+template<unsigned int BlockSize, unsigned int ItemsPerThread, class Key>
+struct block_sorted_check_impl
+{
+    using block_discontinuity_type = ::rocprim::block_discontinuity<Key, BlockSize>;
+
+    struct storage_type_
+    {
+        typename block_discontinuity_type::storage_type discontinuity;
+        unsigned int                                    unsorted;
+    };
+
+    using storage_type = detail::raw_storage<storage_type_>;
+
+    template<class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    bool is_sorted(const Key (&keys)[ItemsPerThread],
+                   const unsigned int valid_in_last_block,
+                   const bool         is_incomplete_block,
+                   BinaryFunction     compare_function,
+                   storage_type&      storage)
+    {
+        storage_type_&     storage_ = storage.get();
+        const unsigned int flat_id  = ::rocprim::detail::block_thread_id<0>();
+        if(flat_id == 0)
+        {
+            storage_.unsorted = 0;
+        }
+
+        // A key is flagged if it is ordered before its predecessor
+        bool descents[ItemsPerThread];
+        block_discontinuity_type().flag_heads(descents,
+                                              keys,
+                                              [&](const Key& previous, const Key& key)
+                                              { return compare_function(key, previous); },
+                                              storage_.discontinuity);
+
+        bool unsorted = false;
+        ROCPRIM_UNROLL
+        for(unsigned int item = 0; item < ItemsPerThread; ++item)
+        {
+            const unsigned int idx = ItemsPerThread * flat_id + item;
+            unsorted |= descents[item] && idx != 0
+                        && (!is_incomplete_block || idx < valid_in_last_block);
+        }
+        if(unsorted)
+        {
+            storage_.unsorted = 1;
+        }
+        ::rocprim::syncthreads();
+        const bool sorted = storage_.unsorted == 0;
+        // Synchronize before reusing shared memory
+        ::rocprim::syncthreads();
+        return sorted;
+    }
+};
+
+template<unsigned int         BlockSize,
+         unsigned int         ItemsPerThread,
+         block_sort_algorithm Algorithm,
+         bool                 SkipSortedTiles,
          class KeysInputIterator,
          class KeysOutputIterator,
          class ValuesInputIterator,
@@ -335,14 +481,16 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE auto block_sort_kernel_impl(KeysInputIterato
     const unsigned int     flat_block_id   = block_id<0>();
     constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
 
-    const OffsetT      block_offset        = flat_block_id * items_per_block;
+    const OffsetT      block_offset        = static_cast<OffsetT>(flat_block_id) * items_per_block;
     const unsigned int valid_in_last_block = input_size - block_offset;
     const bool         is_incomplete_block = flat_block_id == (input_size / items_per_block);
 
     key_type keys[ItemsPerThread];
 
     using block_load_keys_impl = block_load_keys_impl<BlockSize, ItemsPerThread, key_type>;
-    using block_sort_impl      = block_sort_impl<BlockSize, ItemsPerThread, key_type>;
+    using block_sort_impl      = block_sort_impl<BlockSize, ItemsPerThread, key_type, Algorithm>;
+    using block_sorted_check_impl
+        = block_sorted_check_impl<BlockSize, ItemsPerThread, key_type>;
     using block_load_values_impl
         = block_load_values_impl<with_values, BlockSize, ItemsPerThread, value_type>;
     using block_store_impl
@@ -350,8 +498,9 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE auto block_sort_kernel_impl(KeysInputIterato
 
     ROCPRIM_SHARED_MEMORY union
     {
-        typename block_load_keys_impl::storage_type   load_keys;
-        typename block_sort_impl::storage_type        sort;
+        typename block_load_keys_impl::storage_type    load_keys;
+        typename block_sorted_check_impl::storage_type sorted_check;
+        typename block_sort_impl::storage_type         sort;
         typename block_load_values_impl::storage_type load_values;
         typename block_store_impl::storage_type       store;
     } storage;
@@ -363,41 +512,36 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE auto block_sort_kernel_impl(KeysInputIterato
                                 keys,
                                 storage.load_keys);
 
-    using stable_key_type = typename block_sort_impl::stable_key_type;
-
-    // Special comparison that preserves relative order of equal keys
-    auto stable_compare_function
-        = [compare_function](const stable_key_type& a, const stable_key_type& b) mutable -> bool
-    {
-        const bool ab = compare_function(rocprim::get<0>(a), rocprim::get<0>(b));
-        return ab
-               || (!compare_function(rocprim::get<0>(b), rocprim::get<0>(a))
-                   && (rocprim::get<1>(a) < rocprim::get<1>(b)));
-    };
-
-    stable_key_type stable_keys[ItemsPerThread];
-    ROCPRIM_UNROLL
-    for(unsigned int item = 0; item < ItemsPerThread; ++item)
-    {
-        stable_keys[item] = rocprim::make_tuple(keys[item], ItemsPerThread * flat_id + item);
-    }
-
     // Synchronize before reusing shared memory
     ::rocprim::syncthreads();
 
-    block_sort_impl().sort(stable_keys,
-                           storage.sort,
-                           valid_in_last_block,
-                           is_incomplete_block,
-                           stable_compare_function);
+    bool tile_sorted = false;
+    if ROCPRIM_IF_CONSTEXPR(SkipSortedTiles)
+    {
+        tile_sorted = block_sorted_check_impl().is_sorted(keys,
+                                                          valid_in_last_block,
+                                                          is_incomplete_block,
+                                                          compare_function,
+                                                          storage.sorted_check);
+    }
 
     unsigned int ranks[ItemsPerThread];
-
-    ROCPRIM_UNROLL
-    for(unsigned int item = 0; item < ItemsPerThread; ++item)
+    if(tile_sorted)
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int item = 0; item < ItemsPerThread; ++item)
+        {
+            ranks[item] = ItemsPerThread * flat_id + item;
+        }
+    }
+    else
     {
-        keys[item]  = rocprim::get<0>(stable_keys[item]);
-        ranks[item] = rocprim::get<1>(stable_keys[item]);
+        block_sort_impl().sort(keys,
+                               ranks,
+                               storage.sort,
+                               valid_in_last_block,
+                               is_incomplete_block,
+                               compare_function);
     }
 
     value_type values[ItemsPerThread];
@@ -425,8 +569,10 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE auto block_sort_kernel_impl(KeysInputIterato
 // ValueTypes with misaligned datastructures in them (e.g. custom_char_double)
 // when storing/loading those ValueTypes to/from registers.
 // Thus this is a temporary workaround.
-template<unsigned int BlockSize,
-         unsigned int ItemsPerThread,
+template<unsigned int         BlockSize,
+         unsigned int         ItemsPerThread,
+         block_sort_algorithm Algorithm,
+         bool                 SkipSortedTiles,
          class KeysInputIterator,
          class KeysOutputIterator,
          class ValuesInputIterator,
@@ -453,23 +599,26 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE auto block_sort_kernel_impl(KeysInputIterato
     const unsigned int flat_block_id = block_id<0>();
     constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
 
-    const OffsetT block_offset = flat_block_id * items_per_block;
+    const OffsetT block_offset = static_cast<OffsetT>(flat_block_id) * items_per_block;
     const unsigned int valid_in_last_block = input_size - block_offset;
     const bool is_incomplete_block = flat_block_id == (input_size / items_per_block);
 
     key_type keys[ItemsPerThread];
 
     using block_load_keys_impl = block_load_keys_impl<BlockSize, ItemsPerThread, key_type>;
-    using block_sort_impl = block_sort_impl<BlockSize, ItemsPerThread, key_type>;
+    using block_sort_impl = block_sort_impl<BlockSize, ItemsPerThread, key_type, Algorithm>;
+    using block_sorted_check_impl
+        = block_sorted_check_impl<BlockSize, ItemsPerThread, key_type>;
     using block_store_impl
         = block_store_impl<false, BlockSize, ItemsPerThread, key_type, rocprim::empty_type>;
 
     using values_storage_ = value_type[items_per_block];
     ROCPRIM_SHARED_MEMORY union {
-        typename block_load_keys_impl::storage_type   load_keys;
-        typename block_sort_impl::storage_type        sort;
-        detail::raw_storage<values_storage_>          load_values;
-        typename block_store_impl::storage_type       store;
+        typename block_load_keys_impl::storage_type    load_keys;
+        typename block_sorted_check_impl::storage_type sorted_check;
+        typename block_sort_impl::storage_type         sort;
+        detail::raw_storage<values_storage_>           load_values;
+        typename block_store_impl::storage_type        store;
     } storage;
 
     block_load_keys_impl().load(
@@ -481,40 +630,38 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE auto block_sort_kernel_impl(KeysInputIterato
         storage.load_keys
     );
 
-    using stable_key_type = typename block_sort_impl::stable_key_type;
-
-    // Special comparison that preserves relative order of equal keys
-    auto stable_compare_function = [compare_function](const stable_key_type& a, const stable_key_type& b) mutable -> bool
-    {
-        const bool ab = compare_function(rocprim::get<0>(a), rocprim::get<0>(b));
-        return ab
-               || (!compare_function(rocprim::get<0>(b), rocprim::get<0>(a))
-                   && (rocprim::get<1>(a) < rocprim::get<1>(b)));
-    };
-
-    stable_key_type stable_keys[ItemsPerThread];
-    ROCPRIM_UNROLL
-    for(unsigned int item = 0; item < ItemsPerThread; ++item) {
-        stable_keys[item] = rocprim::make_tuple(keys[item], ItemsPerThread * flat_id + item);
-    }
-
     // Synchronize before reusing shared memory
     ::rocprim::syncthreads();
 
-    block_sort_impl().sort(
-        stable_keys,
-        storage.sort,
-        valid_in_last_block,
-        is_incomplete_block,
-        stable_compare_function
-    );
+    bool tile_sorted = false;
+    if ROCPRIM_IF_CONSTEXPR(SkipSortedTiles)
+    {
+        tile_sorted = block_sorted_check_impl().is_sorted(keys,
+                                                          valid_in_last_block,
+                                                          is_incomplete_block,
+                                                          compare_function,
+                                                          storage.sorted_check);
+    }
 
     unsigned int ranks[ItemsPerThread];
-
-    ROCPRIM_UNROLL
-    for(unsigned int item = 0; item < ItemsPerThread; ++item) {
-        keys[item]  = rocprim::get<0>(stable_keys[item]);
-        ranks[item] = rocprim::get<1>(stable_keys[item]);
+    if(tile_sorted)
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int item = 0; item < ItemsPerThread; ++item)
+        {
+            ranks[item] = ItemsPerThread * flat_id + item;
+        }
+    }
+    else
+    {
+        block_sort_impl().sort(
+            keys,
+            ranks,
+            storage.sort,
+            valid_in_last_block,
+            is_incomplete_block,
+            compare_function
+        );
     }
 
     rocprim::empty_type values[ItemsPerThread];
@@ -609,7 +756,7 @@ ROCPRIM_DEVICE ROCPRIM_INLINE void block_merge_kernel_impl(KeysInputIterator
     const bool             is_incomplete_block = flat_block_id == (input_size / items_per_block);
     // ^ bounds-checking: if input_size is not a multiple of items_per_block and
     // this is the last block: true, false otherwise
-    const OffsetT block_offset        = flat_block_id * items_per_block;
+    const OffsetT block_offset        = static_cast<OffsetT>(flat_block_id) * items_per_block;
     const OffsetT valid_in_last_block = input_size - block_offset;
 
     OffsetT block_thread_offset = block_offset + flat_id * ItemsPerThread;
@@ -647,7 +794,7 @@ ROCPRIM_DEVICE ROCPRIM_INLINE void block_merge_kernel_impl(KeysInputIterator
     // tilegroup_id is the id of the input sorted_block
     const unsigned int tilegroup_id = ~mask & flat_block_id;
     const unsigned int block_is_odd = merged_tiles_number & tilegroup_id;
-    const OffsetT      block_start  = tilegroup_id * items_per_block;
+    const OffsetT      block_start  = static_cast<OffsetT>(tilegroup_id) * items_per_block;
     const OffsetT      next_block_start_
         = block_is_odd ? block_start - sorted_block_size : block_start + sorted_block_size;
     const OffsetT next_block_start = min(next_block_start_, input_size);
@@ -662,7 +809,7 @@ ROCPRIM_DEVICE ROCPRIM_INLINE void block_merge_kernel_impl(KeysInputIterator
             ROCPRIM_UNROLL
             for(unsigned int i = 0; i < ItemsPerThread; i++)
             {
-                const unsigned int id = block_thread_offset + i;
+                const OffsetT id = block_thread_offset + i;
                 if(id < input_size)
                 {
                     keys_output[id] = keys[i];
@@ -678,8 +825,8 @@ ROCPRIM_DEVICE ROCPRIM_INLINE void block_merge_kernel_impl(KeysInputIterator
             ROCPRIM_UNROLL
             for(unsigned int i = 0; i < ItemsPerThread; i++)
             {
-                const unsigned int id = block_thread_offset + i;
-                keys_output[id]       = keys[i];
+                const OffsetT id = block_thread_offset + i;
+                keys_output[id]  = keys[i];
                 if ROCPRIM_IF_CONSTEXPR(with_values)
                 {
                     values_output[id] = values[i];
@@ -689,36 +836,27 @@ ROCPRIM_DEVICE ROCPRIM_INLINE void block_merge_kernel_impl(KeysInputIterator
         return;
     }
 
+    // The rank of a key in the other block is its number of keys that go before it: ties are
+    // broken by (key, position), so the keys of the odd block go after the equal keys of the even
+    // block. A single binary search finds the rank, so long runs of equal keys take the same
+    // number of steps as distinct keys. The keys of a thread are sorted, so the search of a key
+    // starts at the rank of the previous one.
+    OffsetT rank_begin = next_block_start;
     const auto merge_function = [&](OffsetT i)
     {
-        OffsetT left_id  = next_block_start;
+        OffsetT left_id  = rank_begin;
         OffsetT right_id = next_block_end;
 
         while(left_id < right_id)
         {
             OffsetT  mid_id  = (left_id + right_id) / 2;
             key_type mid_key = keys_input[mid_id];
-            bool     smaller = compare_function(mid_key, keys[i]);
-            left_id          = smaller ? mid_id + 1 : left_id;
-            right_id         = smaller ? right_id : mid_id;
-        }
-
-        right_id = next_block_end;
-        if(block_is_odd && left_id != right_id)
-        {
-            key_type upper_key = keys_input[left_id];
-            while(!compare_function(upper_key, keys[i]) && !compare_function(keys[i], upper_key)
-                  && left_id < right_id)
-            {
-                OffsetT  mid_id  = (left_id + right_id) / 2;
-                key_type mid_key = keys_input[mid_id];
-                bool     equal
-                    = !compare_function(mid_key, keys[i]) && !compare_function(keys[i], mid_key);
-                left_id   = equal ? mid_id + 1 : left_id + 1;
-                right_id  = equal ? right_id : mid_id;
-                upper_key = keys_input[left_id];
-            }
+            bool     before  = block_is_odd ? !compare_function(keys[i], mid_key)
+                                            : compare_function(mid_key, keys[i]);
+            left_id          = before ? mid_id + 1 : left_id;
+            right_id         = before ? right_id : mid_id;
         }
+        rank_begin = left_id;
 
         OffsetT offset = min(block_start, next_block_start); // get start of resulting merged block
         offset += left_id - next_block_start; // add offset of found position in other block
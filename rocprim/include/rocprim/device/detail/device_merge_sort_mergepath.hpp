@@ -101,7 +101,9 @@ namespace detail
                                                                       ValuesInputIterator  values_input,
                                                                       ValuesOutputIterator values_output,
                                                                       const OffsetT        input_size,
-                                                                      const OffsetT  sorted_block_size,
+                                                                      const OffsetT  tilegroup_mid,
+                                                                      const OffsetT  tilegroup_end,
+                                                                      const bool     is_last_tile_in_group,
                                                                       BinaryFunction compare_function,
                                                                       const OffsetT* merge_partitions)
         -> std::enable_if_t<(!std::is_trivially_copyable<ValueType>::value
@@ -135,23 +137,19 @@ namespace detail
         const OffsetT partition_beg = merge_partitions[flat_block_id];
         const OffsetT partition_end = merge_partitions[flat_block_id + 1];
 
-        const unsigned int merged_tiles_number = sorted_block_size / items_per_tile;
-        const unsigned int target_merged_tiles_number = merged_tiles_number * 2;
-        const unsigned int mask  = target_merged_tiles_number - 1;
-        const unsigned int tilegroup_start_id  = ~mask & flat_block_id;
-        const OffsetT tilegroup_start = items_per_tile * tilegroup_start_id; // Tile-group starts here
-
-        const OffsetT diag = items_per_tile * flat_block_id - tilegroup_start;
+        // The first sorted block of the tile-group ends at tilegroup_mid, the second one at
+        // tilegroup_end
+        const OffsetT tile_start = static_cast<OffsetT>(items_per_tile) * flat_block_id;
 
         const OffsetT keys1_beg = partition_beg;
         OffsetT keys1_end = partition_end;
-        const OffsetT keys2_beg = rocprim::min(input_size, 2 * tilegroup_start + sorted_block_size + diag - partition_beg);
-        OffsetT keys2_end = rocprim::min(input_size, 2 * tilegroup_start + sorted_block_size + diag + items_per_tile - partition_end);
+        const OffsetT keys2_beg = rocprim::min(input_size, tilegroup_mid + tile_start - partition_beg);
+        OffsetT keys2_end = rocprim::min(input_size, tilegroup_mid + tile_start + items_per_tile - partition_end);
 
-        if (mask == (mask & flat_block_id)) // If last tile in the tile-group
+        if (is_last_tile_in_group)
         {
-            keys1_end = rocprim::min(input_size, tilegroup_start + sorted_block_size);
-            keys2_end = rocprim::min(input_size, tilegroup_start + sorted_block_size * 2);
+            keys1_end = rocprim::min(input_size, tilegroup_mid);
+            keys2_end = rocprim::min(input_size, tilegroup_end);
         }
 
         // Number of keys per tile
@@ -217,7 +215,7 @@ namespace detail
             rocprim::syncthreads();
         }
 
-        const OffsetT offset = flat_block_id * items_per_tile;
+        const OffsetT offset = static_cast<OffsetT>(flat_block_id) * items_per_tile;
         block_store().store(offset,
                             input_size - offset,
                             IsIncompleteTile,
@@ -246,7 +244,9 @@ namespace detail
                                                                       ValuesInputIterator  values_input,
                                                                       ValuesOutputIterator values_output,
                                                                       const OffsetT        input_size,
-                                                                      const OffsetT  sorted_block_size,
+                                                                      const OffsetT  tilegroup_mid,
+                                                                      const OffsetT  tilegroup_end,
+                                                                      const bool     is_last_tile_in_group,
                                                                       BinaryFunction compare_function,
                                                                       const OffsetT* merge_partitions)
         -> std::enable_if_t<(std::is_trivially_copyable<ValueType>::value
@@ -280,23 +280,19 @@ namespace detail
         const OffsetT partition_beg = merge_partitions[flat_block_id];
         const OffsetT partition_end = merge_partitions[flat_block_id + 1];
 
-        const unsigned int merged_tiles_number = sorted_block_size / items_per_tile;
-        const unsigned int target_merged_tiles_number = merged_tiles_number * 2;
-        const unsigned int mask  = target_merged_tiles_number - 1;
-        const unsigned int tilegroup_start_id  = ~mask & flat_block_id;
-        const OffsetT tilegroup_start = items_per_tile * tilegroup_start_id; // Tile-group starts here
-
-        const OffsetT diag = items_per_tile * flat_block_id - tilegroup_start;
+        // The first sorted block of the tile-group ends at tilegroup_mid, the second one at
+        // tilegroup_end
+        const OffsetT tile_start = static_cast<OffsetT>(items_per_tile) * flat_block_id;
 
         const OffsetT keys1_beg = partition_beg;
         OffsetT keys1_end = partition_end;
-        const OffsetT keys2_beg = rocprim::min(input_size, 2 * tilegroup_start + sorted_block_size + diag - partition_beg);
-        OffsetT keys2_end = rocprim::min(input_size, 2 * tilegroup_start + sorted_block_size + diag + items_per_tile - partition_end);
+        const OffsetT keys2_beg = rocprim::min(input_size, tilegroup_mid + tile_start - partition_beg);
+        OffsetT keys2_end = rocprim::min(input_size, tilegroup_mid + tile_start + items_per_tile - partition_end);
 
-        if (mask == (mask & flat_block_id)) // If last tile in the tile-group
+        if (is_last_tile_in_group)
         {
-            keys1_end = rocprim::min(input_size, tilegroup_start + sorted_block_size);
-            keys2_end = rocprim::min(input_size, tilegroup_start + sorted_block_size * 2);
+            keys1_end = rocprim::min(input_size, tilegroup_mid);
+            keys2_end = rocprim::min(input_size, tilegroup_end);
         }
 
         // Number of keys per tile
@@ -377,7 +373,8 @@ namespace detail
             }
 
             rocprim::syncthreads();
-            const OffsetT thread_offset = items_per_tile * flat_block_id + ItemsPerThread * flat_id;
+            const OffsetT thread_offset
+                = static_cast<OffsetT>(items_per_tile) * flat_block_id + ItemsPerThread * flat_id;
             if(is_incomplete_tile)
             {
                 ROCPRIM_UNROLL
@@ -401,7 +398,7 @@ namespace detail
             rocprim::syncthreads();
         }
 
-        const OffsetT offset = flat_block_id * items_per_tile;
+        const OffsetT offset = static_cast<OffsetT>(flat_block_id) * items_per_tile;
         value_type values[ItemsPerThread];
         block_store().store(offset,
                             input_size - offset,
@@ -431,12 +428,111 @@ namespace detail
                                 BinaryFunction       compare_function,
                                 const OffsetT*       merge_partitions)
     {
+        constexpr unsigned int items_per_tile = BlockSize * ItemsPerThread;
+
+        const unsigned int flat_block_id = block_id<0>();
+
+        const unsigned int merged_tiles_number = sorted_block_size / items_per_tile;
+        const unsigned int target_merged_tiles_number = merged_tiles_number * 2;
+        const unsigned int mask  = target_merged_tiles_number - 1;
+        const unsigned int tilegroup_start_id  = ~mask & flat_block_id;
+        // Tile-group starts here
+        const OffsetT tilegroup_start = static_cast<OffsetT>(items_per_tile) * tilegroup_start_id;
+
+        block_merge_process_tile<BlockSize, ItemsPerThread>(keys_input,
+                                                            keys_output,
+                                                            values_input,
+                                                            values_output,
+                                                            input_size,
+                                                            tilegroup_start + sorted_block_size,
+                                                            tilegroup_start + 2 * sorted_block_size,
+                                                            mask == (mask & flat_block_id),
+                                                            compare_function,
+                                                            merge_partitions);
+    }
+
+    // Finds the tiles of the pair of sorted runs which contains the tile in a pass of the natural
+    // merge sort. The runs start at the tiles in run_starts, the i-th pass merges the runs which
+    // are 2^i runs apart, so stride is 2^i. Runs past run_count start at the end of the input.
+    template<class OffsetT>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void merge_runs_tilegroup(const OffsetT*     run_starts,
+                              const unsigned int run_count,
+                              const unsigned int stride,
+                              const OffsetT      tiles,
+                              const OffsetT      tile_id,
+                              OffsetT&           first_tile,
+                              OffsetT&           mid_tile,
+                              OffsetT&           end_tile)
+    {
+        const auto run_start = [&](const unsigned int run) -> OffsetT
+        { return run < run_count ? run_starts[run] : tiles; };
+
+        // Binary search of the last pair which does not start after the tile
+        const unsigned int pair_stride = 2 * stride;
+        unsigned int       pair_beg    = 0;
+        unsigned int       pair_end    = ceiling_div(run_count, pair_stride);
+        while(pair_end - pair_beg > 1)
+        {
+            const unsigned int pair = (pair_beg + pair_end) / 2;
+            if(run_start(pair * pair_stride) <= tile_id)
+            {
+                pair_beg = pair;
+            }
+            else
+            {
+                pair_end = pair;
+            }
+        }
+
+        first_tile = run_start(pair_beg * pair_stride);
+        mid_tile   = run_start(pair_beg * pair_stride + stride);
+        end_tile   = run_start(pair_beg * pair_stride + pair_stride);
+    }
+
+    template<unsigned int BlockSize,
+             unsigned int ItemsPerThread,
+             class KeysInputIterator,
+             class KeysOutputIterator,
+             class ValuesInputIterator,
+             class ValuesOutputIterator,
+             class OffsetT,
+             class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+        block_merge_runs_kernel_impl(KeysInputIterator    keys_input,
+                                     KeysOutputIterator   keys_output,
+                                     ValuesInputIterator  values_input,
+                                     ValuesOutputIterator values_output,
+                                     const OffsetT        input_size,
+                                     BinaryFunction       compare_function,
+                                     const OffsetT*       merge_partitions,
+                                     const OffsetT*       run_starts,
+                                     const unsigned int   run_count,
+                                     const unsigned int   stride)
+    {
+        constexpr unsigned int items_per_tile = BlockSize * ItemsPerThread;
+
+        const OffsetT tile_id = block_id<0>();
+        const OffsetT tiles   = ceiling_div(input_size, items_per_tile);
+
+        OffsetT first_tile, mid_tile, end_tile;
+        merge_runs_tilegroup(run_starts,
+                             run_count,
+                             stride,
+                             tiles,
+                             tile_id,
+                             first_tile,
+                             mid_tile,
+                             end_tile);
+
         block_merge_process_tile<BlockSize, ItemsPerThread>(keys_input,
                                                             keys_output,
                                                             values_input,
                                                             values_output,
                                                             input_size,
-                                                            sorted_block_size,
+                                                            items_per_tile * mid_tile,
+                                                            items_per_tile * end_tile,
+                                                            tile_id + 1 == end_tile,
                                                             compare_function,
                                                             merge_partitions);
     }
@@ -0,0 +1,344 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_MULTI_DEVICE_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_MULTI_DEVICE_HPP_
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include "../../config.hpp"
+#include "../../detail/match_result_type.hpp"
+#include "../../detail/temp_storage.hpp"
+#include "../../functional.hpp"
+#include "../../iterator/constant_iterator.hpp"
+#include "../../iterator/counting_iterator.hpp"
+#include "../../iterator/transform_iterator.hpp"
+#include "../../types/future_value.hpp"
+
+#include "../device_reduce.hpp"
+#include "../device_scan.hpp"
+#include "../device_transform.hpp"
+
+#include "device_scan_common.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+enum class multi_device_op
+{
+    reduce,
+    inclusive_scan,
+    exclusive_scan
+};
+
+// Events of the devices, the local totals of the devices are ready when they complete
+class multi_device_events
+{
+public:
+    explicit multi_device_events(const unsigned int device_count)
+        : events_(device_count, nullptr)
+    {}
+
+    multi_device_events(const multi_device_events&) = delete;
+    multi_device_events& operator=(const multi_device_events&) = delete;
+
+    ~multi_device_events()
+    {
+        // The pending work is not affected by destroying the events
+        for(hipEvent_t event : events_)
+        {
+            if(event != nullptr)
+            {
+                (void)hipEventDestroy(event);
+            }
+        }
+    }
+
+    // Must be called with the device of the stream set as the current one
+    hipError_t record(const unsigned int d, const hipStream_t stream)
+    {
+        hipError_t error = hipEventCreateWithFlags(&events_[d], hipEventDisableTiming);
+        if(error != hipSuccess)
+        {
+            events_[d] = nullptr;
+            return error;
+        }
+        return hipEventRecord(events_[d], stream);
+    }
+
+    hipEvent_t operator[](const unsigned int d) const
+    {
+        return events_[d];
+    }
+
+private:
+    std::vector<hipEvent_t> events_;
+};
+
+// Pointers to the partitions of the temporary storage of one device
+template<class T>
+struct multi_device_scan_storage
+{
+    T*     total;
+    T*     totals;
+    T*     prefix;
+    void*  nested_storage;
+    size_t nested_storage_size;
+};
+
+template<multi_device_op Op,
+         class InputIterator,
+         class OutputIterator,
+         class InitValueType,
+         class BinaryFunction>
+inline hipError_t multi_device_scan_impl(void* const*          temporary_storage,
+                                         size_t*               storage_sizes,
+                                         const int*            devices,
+                                         const unsigned int    device_count,
+                                         const InputIterator*  inputs,
+                                         const OutputIterator* outputs,
+                                         const InitValueType   initial_value,
+                                         const size_t*         sizes,
+                                         BinaryFunction        op,
+                                         const hipStream_t*    streams,
+                                         const bool            debug_synchronous)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+    using T          = typename match_result_type<input_type, BinaryFunction>::type;
+    using combined_op_type   = scan_first_combined_op<InputIterator, T, BinaryFunction>;
+    using combined_iterator  = transform_iterator<counting_iterator<size_t>, combined_op_type, T>;
+    using storage_type       = multi_device_scan_storage<T>;
+    using prefix_future_type = ::rocprim::future_value<T, T*>;
+    constexpr bool with_init = Op != multi_device_op::inclusive_scan;
+    constexpr bool is_reduce = Op == multi_device_op::reduce;
+
+    const auto stream_of = [&](unsigned int d) { return streams != nullptr ? streams[d] : 0; };
+    // The devices which combine the totals of other devices: the first one for reduce and all
+    // non-empty ones for scans
+    const auto is_target = [&](unsigned int d) { return is_reduce ? d == 0 : sizes[d] > 0; };
+    const auto make_combined_iterator = [&](unsigned int d, const T* prefix)
+    {
+        return combined_iterator(counting_iterator<size_t>(0),
+                                 combined_op_type{inputs[d], prefix, op});
+    };
+
+    std::vector<storage_type> storages(device_count);
+    for(unsigned int d = 0; d < device_count; d++)
+    {
+        hipError_t error = hipSetDevice(devices[d]);
+        if(error != hipSuccess) return error;
+        storage_type&     storage = storages[d];
+        const hipStream_t stream  = stream_of(d);
+
+        // The sizes of the nested algorithms do not depend on the pointers. The totals are the
+        // initial value (if any) and the totals of all devices at most.
+        size_t local_bytes = 0;
+        error = ::rocprim::reduce(nullptr, local_bytes, inputs[d], storage.total, sizes[d], op,
+                                  stream);
+        if(error != hipSuccess) return error;
+        size_t prefix_bytes = 0;
+        size_t scan_bytes   = 0;
+        if(is_reduce && is_target(d))
+        {
+            error = ::rocprim::reduce(nullptr, prefix_bytes, storage.totals, outputs[0],
+                                      device_count + 1, op, stream);
+            if(error != hipSuccess) return error;
+        }
+        else if(!is_reduce)
+        {
+            error = ::rocprim::reduce(nullptr, prefix_bytes, storage.totals, storage.prefix,
+                                      device_count + 1, op, stream);
+            if(error != hipSuccess) return error;
+            if(Op == multi_device_op::exclusive_scan)
+            {
+                error = ::rocprim::exclusive_scan(nullptr, scan_bytes, inputs[d], outputs[d],
+                                                  prefix_future_type(storage.prefix), sizes[d],
+                                                  op, stream);
+            }
+            else
+            {
+                error = ::rocprim::inclusive_scan(nullptr, scan_bytes,
+                                                  make_combined_iterator(d, storage.prefix),
+                                                  outputs[d], sizes[d], op, stream);
+            }
+            if(error != hipSuccess) return error;
+        }
+        // The nested algorithms run one after another, they share their storage
+        storage.nested_storage_size = std::max({local_bytes, prefix_bytes, scan_bytes});
+
+        size_t storage_size = temporary_storage != nullptr ? storage_sizes[d] : 0;
+        error = temp_storage::partition(
+            temporary_storage != nullptr ? temporary_storage[d] : nullptr,
+            storage_size,
+            temp_storage::make_linear_partition(
+                temp_storage::ptr_aligned_array(&storage.total, 1),
+                temp_storage::ptr_aligned_array(&storage.totals, device_count + 1),
+                temp_storage::ptr_aligned_array(&storage.prefix, 1),
+                temp_storage::make_partition(&storage.nested_storage,
+                                             storage.nested_storage_size)));
+        if(error != hipSuccess) return error;
+        if(temporary_storage == nullptr)
+        {
+            storage_sizes[d] = storage_size;
+        }
+    }
+    if(temporary_storage == nullptr)
+    {
+        return hipSuccess;
+    }
+
+    // Every device reduces its items, the completion of the total is marked by an event
+    multi_device_events events(device_count);
+    for(unsigned int d = 0; d < device_count; d++)
+    {
+        if(sizes[d] == 0)
+        {
+            continue;
+        }
+        hipError_t error = hipSetDevice(devices[d]);
+        if(error != hipSuccess) return error;
+        storage_type&     storage     = storages[d];
+        const hipStream_t stream      = stream_of(d);
+        size_t            nested_size = storage.nested_storage_size;
+        error = ::rocprim::reduce(storage.nested_storage, nested_size, inputs[d], storage.total,
+                                  sizes[d], op, stream, debug_synchronous);
+        if(error != hipSuccess) return error;
+        error = events.record(d, stream);
+        if(error != hipSuccess) return error;
+    }
+
+    // Every target device waits for the totals of the previous devices, copies them through peer
+    // memory and reduces them to the prefix of its items, which is read by the scan on the device,
+    // so the host does not wait for anything
+    for(unsigned int d = 0; d < device_count; d++)
+    {
+        if(!is_target(d))
+        {
+            continue;
+        }
+        hipError_t error = hipSetDevice(devices[d]);
+        if(error != hipSuccess) return error;
+        storage_type&     storage     = storages[d];
+        const hipStream_t stream      = stream_of(d);
+        size_t            nested_size = storage.nested_storage_size;
+
+        size_t count = 0;
+        if(with_init)
+        {
+            error = ::rocprim::transform(constant_iterator<T>(static_cast<T>(initial_value)),
+                                         storage.totals, 1, ::rocprim::identity<T>(), stream,
+                                         debug_synchronous);
+            if(error != hipSuccess) return error;
+            count++;
+        }
+        const unsigned int sources = is_reduce ? device_count : d;
+        for(unsigned int s = 0; s < sources; s++)
+        {
+            if(sizes[s] == 0)
+            {
+                continue;
+            }
+            error = hipStreamWaitEvent(stream, events[s], 0);
+            if(error != hipSuccess) return error;
+            error = hipMemcpyPeerAsync(storage.totals + count, devices[d],
+                                       storages[s].total, devices[s],
+                                       sizeof(T), stream);
+            if(error != hipSuccess) return error;
+            count++;
+        }
+
+        if(is_reduce)
+        {
+            error = ::rocprim::reduce(storage.nested_storage, nested_size, storage.totals,
+                                      outputs[0], count, op, stream, debug_synchronous);
+            if(error != hipSuccess) return error;
+            continue;
+        }
+        if(count > 0)
+        {
+            error = ::rocprim::reduce(storage.nested_storage, nested_size, storage.totals,
+                                      storage.prefix, count, op, stream, debug_synchronous);
+            if(error != hipSuccess) return error;
+        }
+        nested_size = storage.nested_storage_size;
+        if(Op == multi_device_op::exclusive_scan)
+        {
+            error = ::rocprim::exclusive_scan(storage.nested_storage, nested_size,
+                                              inputs[d], outputs[d],
+                                              prefix_future_type(storage.prefix), sizes[d],
+                                              op, stream, debug_synchronous);
+        }
+        else
+        {
+            error = ::rocprim::inclusive_scan(storage.nested_storage, nested_size,
+                                              make_combined_iterator(d, count > 0 ? storage.prefix
+                                                                                  : nullptr),
+                                              outputs[d], sizes[d], op, stream,
+                                              debug_synchronous);
+        }
+        if(error != hipSuccess) return error;
+    }
+    return hipSuccess;
+}
+
+// Calls the implementation and restores the current device
+template<multi_device_op Op,
+         class InputIterator,
+         class OutputIterator,
+         class InitValueType,
+         class BinaryFunction>
+inline hipError_t multi_device_scan(void* const*          temporary_storage,
+                                    size_t*               storage_sizes,
+                                    const int*            devices,
+                                    const unsigned int    device_count,
+                                    const InputIterator*  inputs,
+                                    const OutputIterator* outputs,
+                                    const InitValueType   initial_value,
+                                    const size_t*         sizes,
+                                    BinaryFunction        op,
+                                    const hipStream_t*    streams,
+                                    const bool            debug_synchronous)
+{
+    if(device_count == 0)
+    {
+        return hipSuccess;
+    }
+    int        current_device;
+    hipError_t error = hipGetDevice(&current_device);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+    error = multi_device_scan_impl<Op>(temporary_storage, storage_sizes, devices, device_count,
+                                       inputs, outputs, initial_value, sizes, op, streams,
+                                       debug_synchronous);
+    const hipError_t restore_error = hipSetDevice(current_device);
+    return error != hipSuccess ? error : restore_error;
+}
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_MULTI_DEVICE_HPP_
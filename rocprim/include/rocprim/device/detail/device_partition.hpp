@@ -28,6 +28,7 @@
 #include "../../intrinsics.hpp"
 #include "../../functional.hpp"
 #include "../../types.hpp"
+#include "../../types/tuple.hpp"
 
 #include "../../block/block_load.hpp"
 #include "../../block/block_store.hpp"
@@ -380,6 +381,89 @@ ROCPRIM_DEVICE ROCPRIM_INLINE auto partition_scatter(ValueType (&values)[ItemsPe
     }
 }
 
+// Two-way partition, the selected and the rejected values are written to separate outputs,
+// both in the order of the input. The tile is reordered in shared memory like in the one-output
+// partition, then the rejected values follow their offset in the input instead of the end of the
+// output.
+template<bool         OnlySelected,
+         unsigned int BlockSize,
+         class ValueType,
+         unsigned int ItemsPerThread,
+         class OffsetType,
+         class SelectedOutputIterator,
+         class RejectedOutputIterator,
+         class ScatterStorageType>
+ROCPRIM_DEVICE ROCPRIM_INLINE auto partition_scatter(
+    ValueType (&values)[ItemsPerThread],
+    bool (&is_selected)[ItemsPerThread],
+    OffsetType (&output_indices)[ItemsPerThread],
+    ::rocprim::tuple<SelectedOutputIterator, RejectedOutputIterator> output,
+    const size_t /*total_size*/,
+    const OffsetType    selected_prefix,
+    const OffsetType    selected_in_block,
+    ScatterStorageType& storage,
+    const unsigned int  flat_block_id,
+    const unsigned int  flat_block_thread_id,
+    const bool          is_global_last_block,
+    const unsigned int  valid_in_global_last_block,
+    size_t (&prev_selected_count_values)[1],
+    size_t prev_processed) -> typename std::enable_if<!OnlySelected>::type
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    // Scatter selected/rejected values to shared memory
+    auto scatter_storage = storage.get();
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        unsigned int item_index = (flat_block_thread_id * ItemsPerThread) + i;
+        unsigned int selected_item_index = output_indices[i] - selected_prefix;
+        unsigned int rejected_item_index = (item_index - selected_item_index) + selected_in_block;
+        // index of item in scatter_storage
+        unsigned int scatter_index = is_selected[i] ? selected_item_index : rejected_item_index;
+        scatter_storage[scatter_index] = values[i];
+    }
+    ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+    const size_t selected_output_prefix = prev_selected_count_values[0] + selected_prefix;
+    // The rejected values of the previous tiles, minus the selected values of this tile which
+    // precede the rejected values in shared memory
+    const size_t rejected_output_prefix = prev_processed + size_t(flat_block_id) * items_per_block
+                                          - selected_output_prefix - selected_in_block;
+
+    const auto save_to_output = [=](const unsigned int item_index) mutable
+    {
+        if(item_index < selected_in_block)
+        {
+            get<0>(output)[selected_output_prefix + item_index] = scatter_storage[item_index];
+        }
+        else
+        {
+            get<1>(output)[rejected_output_prefix + item_index] = scatter_storage[item_index];
+        }
+    };
+
+    if(is_global_last_block)
+    {
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            const unsigned int item_index = i * BlockSize + flat_block_thread_id;
+            if(item_index < valid_in_global_last_block)
+            {
+                save_to_output(item_index);
+            }
+        }
+    }
+    else
+    {
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            const unsigned int item_index = i * BlockSize + flat_block_thread_id;
+            save_to_output(item_index);
+        }
+    }
+}
+
 template<bool         OnlySelected,
          unsigned int BlockSize,
          class ValueType,
@@ -596,6 +680,24 @@ ROCPRIM_DEVICE void load_selected_count(const size_t* const prev_selected_count,
     }
 }
 
+template<class BlockLoadType, class ValueIterator, class ValueType, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE void
+    partition_block_load_values(ValueIterator block_values_input,
+                                ValueType (&values)[ItemsPerThread],
+                                typename BlockLoadType::storage_type& storage,
+                                const bool                            is_global_last_block,
+                                const unsigned int                    valid_in_global_last_block)
+{
+    if(is_global_last_block)
+    {
+        BlockLoadType().load(block_values_input, values, valid_in_global_last_block, storage);
+    }
+    else
+    {
+        BlockLoadType().load(block_values_input, values, storage);
+    }
+}
+
 template<select_method SelectMethod,
          bool          OnlySelected,
          class Config,
@@ -655,7 +757,8 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
 
     // Offset prefix operation type
     using offset_scan_prefix_op_type = offset_lookback_scan_prefix_op<
-        offset_type, OffsetLookbackScanState
+        offset_type, OffsetLookbackScanState, ::rocprim::plus<offset_type>,
+        config_lookback_backoff_type<Config, OffsetLookbackScanState>
     >;
 
     // Memory required for 2-phase scatter
@@ -693,6 +796,314 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
     size_t prev_selected_count_values[sizeof...(UnaryPredicates)]{};
     load_selected_count(prev_selected_count, prev_selected_count_values);
 
+    const auto flat_block_thread_id = ::rocprim::detail::block_thread_id<0>();
+    // A grid limited by blocks_per_cu is smaller than the number of tiles, in that case every
+    // block processes tiles until all of them are processed. Tiles are processed in the order of
+    // their ids so the look-back never waits for a tile that is not being processed by a resident
+    // block.
+    const bool multiple_tiles_per_block = ::rocprim::detail::grid_size<0>() < number_of_blocks;
+    unsigned int flat_block_id = ordered_bid.get(flat_block_thread_id, storage.ordered_bid);
+    while(true)
+    {
+        const auto block_offset         = flat_block_id * items_per_block;
+        const unsigned int valid_in_global_last_block
+            = total_size - prev_processed - items_per_block * (number_of_blocks - 1);
+        const bool is_last_launch
+            = total_size <= prev_processed + number_of_blocks * items_per_block;
+        const bool is_global_last_block = is_last_launch && flat_block_id == (number_of_blocks - 1);
+
+        key_type         keys[items_per_thread];
+        is_selected_type is_selected;
+        offset_type      output_indices[items_per_thread];
+
+        // Load input values into values
+        if(is_global_last_block)
+        {
+            block_load_key_type().load(keys_input + block_offset,
+                                       keys,
+                                       valid_in_global_last_block,
+                                       storage.load_keys);
+        }
+        else
+        {
+            block_load_key_type()
+                .load(
+                    keys_input + block_offset,
+                    keys,
+                    storage.load_keys
+                );
+        }
+        ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+        static constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+        // Selected values are only written to positions that are not after their input positions,
+        // and a block writes only after all previous blocks published their counts. So when the
+        // values are loaded before the count is published, the outputs can alias the inputs
+        // (in-place selection).
+        static constexpr bool load_values_early = OnlySelected && with_values;
+
+        value_type values[items_per_thread];
+        if ROCPRIM_IF_CONSTEXPR (load_values_early) {
+            partition_block_load_values<block_load_value_type>(values_input + block_offset,
+                                                               values,
+                                                               storage.load_values,
+                                                               is_global_last_block,
+                                                               valid_in_global_last_block);
+            ::rocprim::syncthreads(); // sync threads to reuse shared memory
+        }
+
+        // Load selection flags into is_selected, generate them using
+        // input value and selection predicate, or generate them using
+        // block_discontinuity primitive
+        const bool is_first_block = flat_block_id == 0 && prev_processed == 0;
+        partition_block_load_flags<SelectMethod,
+                                   block_size,
+                                   block_load_flag_type,
+                                   block_discontinuity_key_type>(keys_input + block_offset - 1,
+                                                                 flags + block_offset,
+                                                                 keys,
+                                                                 is_selected,
+                                                                 predicates...,
+                                                                 inequality_op,
+                                                                 storage,
+                                                                 is_first_block,
+                                                                 flat_block_thread_id,
+                                                                 is_global_last_block,
+                                                                 valid_in_global_last_block);
+
+        // Convert true/false is_selected flags to 0s and 1s
+        convert_selected_to_indices(output_indices, is_selected);
+
+        // Number of selected values in previous blocks
+        offset_type selected_prefix{};
+        // Number of selected values in this block
+        offset_type selected_in_block{};
+
+        // Calculate number of selected values in block and their indices
+        if(flat_block_id == 0)
+        {
+            block_scan_offset_type()
+                .exclusive_scan(
+                    output_indices,
+                    output_indices,
+                    offset_type{}, /** initial value */
+                    selected_in_block,
+                    storage.scan_offsets,
+                    ::rocprim::plus<offset_type>()
+                );
+            if(flat_block_thread_id == 0)
+            {
+                offset_scan_state.set_complete(flat_block_id, selected_in_block);
+            }
+            ::rocprim::syncthreads(); // sync threads to reuse shared memory
+        }
+        else
+        {
+            ROCPRIM_SHARED_MEMORY
+            typename offset_scan_prefix_op_type::storage_type storage_prefix_op;
+            auto prefix_op = offset_scan_prefix_op_type(
+                flat_block_id,
+                offset_scan_state,
+                storage_prefix_op
+            );
+            block_scan_offset_type()
+                .exclusive_scan(
+                    output_indices,
+                    output_indices,
+                    storage.scan_offsets,
+                    prefix_op,
+                    ::rocprim::plus<offset_type>()
+                );
+            ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+            selected_in_block = prefix_op.get_reduction();
+            selected_prefix   = prefix_op.get_prefix();
+        }
+
+        // Scatter selected and rejected values
+        partition_scatter<OnlySelected, block_size>(keys,
+                                                    is_selected,
+                                                    output_indices,
+                                                    keys_output,
+                                                    total_size,
+                                                    selected_prefix,
+                                                    selected_in_block,
+                                                    storage.exchange_keys,
+                                                    flat_block_id,
+                                                    flat_block_thread_id,
+                                                    is_global_last_block,
+                                                    valid_in_global_last_block,
+                                                    prev_selected_count_values,
+                                                    prev_processed);
+
+        if ROCPRIM_IF_CONSTEXPR (with_values) {
+            if ROCPRIM_IF_CONSTEXPR (!load_values_early) {
+                ::rocprim::syncthreads(); // sync threads to reuse shared memory
+                partition_block_load_values<block_load_value_type>(values_input + block_offset,
+                                                                   values,
+                                                                   storage.load_values,
+                                                                   is_global_last_block,
+                                                                   valid_in_global_last_block);
+            }
+            ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+            partition_scatter<OnlySelected, block_size>(values,
+                                                        is_selected,
+                                                        output_indices,
+                                                        values_output,
+                                                        total_size,
+                                                        selected_prefix,
+                                                        selected_in_block,
+                                                        storage.exchange_values,
+                                                        flat_block_id,
+                                                        flat_block_thread_id,
+                                                        is_global_last_block,
+                                                        valid_in_global_last_block,
+                                                        prev_selected_count_values,
+                                                        prev_processed);
+        }
+
+        // Last block in grid stores number of selected values
+        const bool is_last_block = flat_block_id == (number_of_blocks - 1);
+        if(is_last_block && flat_block_thread_id == 0)
+        {
+            store_selected_count(selected_count,
+                                 prev_selected_count_values,
+                                 selected_prefix,
+                                 selected_in_block);
+        }
+
+        if(!multiple_tiles_per_block)
+        {
+            break;
+        }
+        ::rocprim::syncthreads(); // sync threads to reuse shared memory
+        flat_block_id = ordered_bid.get(flat_block_thread_id, storage.ordered_bid);
+        if(flat_block_id >= number_of_blocks)
+        {
+            break;
+        }
+    }
+}
+
+// Combines (count, value) pairs of a scan over the selected items only. The value of a pair
+// without selected items is undefined and it is ignored.
+template<class ValueType, class BinaryFunction>
+struct select_scan_pair_op
+{
+    using pair_type = ::rocprim::tuple<unsigned int, ValueType>;
+
+    BinaryFunction scan_op;
+
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    pair_type operator()(const pair_type& a, const pair_type& b) const
+    {
+        const unsigned int a_count = ::rocprim::get<0>(a);
+        const unsigned int b_count = ::rocprim::get<0>(b);
+        if(a_count == 0)
+        {
+            return b;
+        }
+        if(b_count == 0)
+        {
+            return a;
+        }
+        return pair_type(a_count + b_count, scan_op(::rocprim::get<1>(a), ::rocprim::get<1>(b)));
+    }
+};
+
+// Transforms an input value and selects the transformed value by the predicate. It is specialized
+// by transform operations that select the values themselves, like the stages of a tile pipeline.
+template<class TransformOp, class UnaryPredicate>
+struct transform_select_item
+{
+    template<class Input, class Value>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static bool apply(TransformOp&    transform_op,
+                      UnaryPredicate& predicate,
+                      const Input&    input,
+                      Value&          value)
+    {
+        value = transform_op(input);
+        return predicate(value);
+    }
+};
+
+// Transforms the input, selects the transformed values by the predicate and scans the selected
+// values in one look-back pass. The look-back state holds the number of selected values and
+// their reduction, so the offsets of the compacted outputs and the running scan are known
+// together. Launches are chained by prev_selected_count and prev_scan_value.
+template<class Config,
+         class InputIterator,
+         class OutputIterator,
+         class ScanOutputIterator,
+         class ValueType,
+         class TransformOp,
+         class UnaryPredicate,
+         class BinaryFunction,
+         class PairLookbackScanState>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+    transform_select_scan_kernel_impl(InputIterator                  input,
+                                      OutputIterator                 output,
+                                      ScanOutputIterator             scan_output,
+                                      size_t*                        selected_count,
+                                      ValueType*                     scan_value,
+                                      const size_t*                  prev_selected_count,
+                                      const ValueType*               prev_scan_value,
+                                      const size_t                   prev_processed,
+                                      const size_t                   total_size,
+                                      TransformOp                    transform_op,
+                                      UnaryPredicate                 predicate,
+                                      BinaryFunction                 scan_op,
+                                      PairLookbackScanState          pair_scan_state,
+                                      const unsigned int             number_of_blocks,
+                                      ordered_block_id<unsigned int> ordered_bid)
+{
+    constexpr auto block_size = Config::block_size;
+    constexpr auto items_per_thread = Config::items_per_thread;
+    constexpr unsigned int items_per_block = block_size * items_per_thread;
+
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+    using value_type = ValueType;
+    using pair_scan_op_type = select_scan_pair_op<value_type, BinaryFunction>;
+    using pair_type = typename pair_scan_op_type::pair_type;
+    static_assert(std::is_same<pair_type, typename PairLookbackScanState::value_type>::value,
+                  "value_type of PairLookbackScanState must be a (count, value) tuple");
+
+    using block_load_input_type = ::rocprim::block_load<
+        input_type, block_size, items_per_thread,
+        Config::key_block_load_method
+    >;
+    using block_scan_pair_type = ::rocprim::block_scan<
+        pair_type, block_size,
+        Config::block_scan_method
+    >;
+    using order_bid_type = ordered_block_id<unsigned int>;
+    using pair_scan_prefix_op_type = offset_lookback_scan_prefix_op<
+        pair_type, PairLookbackScanState, pair_scan_op_type,
+        config_lookback_backoff_type<Config, PairLookbackScanState>
+    >;
+
+    using exchange_values_storage_type = value_type[items_per_block];
+    using raw_exchange_values_storage_type = typename detail::raw_storage<exchange_values_storage_type>;
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        typename order_bid_type::storage_type ordered_bid;
+        union
+        {
+            raw_exchange_values_storage_type exchange_values;
+            typename block_load_input_type::storage_type load_input;
+            typename block_scan_pair_type::storage_type scan_pairs;
+        };
+    } storage;
+
+    // Loaded before the ordered block id, see partition_kernel_impl
+    size_t prev_selected_count_values[1];
+    load_selected_count(prev_selected_count, prev_selected_count_values);
+    const value_type prev_value = prev_selected_count_values[0] > 0 ? prev_scan_value[0]
+                                                                    : value_type{};
+
     const auto flat_block_thread_id = ::rocprim::detail::block_thread_id<0>();
     const auto flat_block_id = ordered_bid.get(flat_block_thread_id, storage.ordered_bid);
     const auto block_offset         = flat_block_id * items_per_block;
@@ -701,160 +1112,378 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
     const bool is_last_launch = total_size <= prev_processed + number_of_blocks * items_per_block;
     const bool is_global_last_block = is_last_launch && flat_block_id == (number_of_blocks - 1);
 
-    key_type         keys[items_per_thread];
-    is_selected_type is_selected;
-    offset_type      output_indices[items_per_thread];
+    input_type inputs[items_per_thread];
+    if(is_global_last_block)
+    {
+        block_load_input_type().load(input + block_offset,
+                                     inputs,
+                                     valid_in_global_last_block,
+                                     storage.load_input);
+    }
+    else
+    {
+        block_load_input_type().load(input + block_offset, inputs, storage.load_input);
+    }
+    ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+    value_type values[items_per_thread];
+    bool       is_selected[items_per_thread];
+    pair_type  pairs[items_per_thread];
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; i++)
+    {
+        const bool is_valid = !is_global_last_block
+            || flat_block_thread_id * items_per_thread + i < valid_in_global_last_block;
+        if(is_valid)
+        {
+            is_selected[i] = transform_select_item<TransformOp, UnaryPredicate>::apply(transform_op,
+                                                                                       predicate,
+                                                                                       inputs[i],
+                                                                                       values[i]);
+        }
+        else
+        {
+            is_selected[i] = false;
+        }
+        pairs[i] = pair_type(is_selected[i] ? 1 : 0, values[i]);
+    }
+
+    const pair_scan_op_type pair_scan_op{scan_op};
+    // Number of selected values in previous blocks and their reduction
+    pair_type prefix(0, value_type{});
+    // Number of selected values in this block and their reduction
+    pair_type reduction;
+    if(flat_block_id == 0)
+    {
+        block_scan_pair_type().inclusive_scan(pairs,
+                                              pairs,
+                                              reduction,
+                                              storage.scan_pairs,
+                                              pair_scan_op);
+        if(flat_block_thread_id == 0)
+        {
+            pair_scan_state.set_complete(flat_block_id, reduction);
+        }
+        ::rocprim::syncthreads(); // sync threads to reuse shared memory
+    }
+    else
+    {
+        ROCPRIM_SHARED_MEMORY typename pair_scan_prefix_op_type::storage_type storage_prefix_op;
+        auto prefix_op = pair_scan_prefix_op_type(
+            flat_block_id,
+            pair_scan_state,
+            storage_prefix_op,
+            pair_scan_op
+        );
+        block_scan_pair_type().inclusive_scan(pairs, pairs, storage.scan_pairs, prefix_op, pair_scan_op);
+        ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+        reduction = prefix_op.get_reduction();
+        prefix    = prefix_op.get_prefix();
+    }
+
+    // Exclusive offsets of the selected values and their scan including the previous launches
+    unsigned int output_indices[items_per_thread];
+    value_type   scan_values[items_per_thread];
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; i++)
+    {
+        output_indices[i] = ::rocprim::get<0>(pairs[i]) - (is_selected[i] ? 1 : 0);
+        scan_values[i]    = prev_selected_count_values[0] > 0
+                                ? scan_op(prev_value, ::rocprim::get<1>(pairs[i]))
+                                : ::rocprim::get<1>(pairs[i]);
+    }
+    const unsigned int selected_prefix   = ::rocprim::get<0>(prefix);
+    const unsigned int selected_in_block = ::rocprim::get<0>(reduction);
+
+    partition_scatter<true, block_size>(values,
+                                        is_selected,
+                                        output_indices,
+                                        output,
+                                        total_size,
+                                        selected_prefix,
+                                        selected_in_block,
+                                        storage.exchange_values,
+                                        flat_block_id,
+                                        flat_block_thread_id,
+                                        is_global_last_block,
+                                        valid_in_global_last_block,
+                                        prev_selected_count_values,
+                                        prev_processed);
+    ::rocprim::syncthreads(); // sync threads to reuse shared memory
+    partition_scatter<true, block_size>(scan_values,
+                                        is_selected,
+                                        output_indices,
+                                        scan_output,
+                                        total_size,
+                                        selected_prefix,
+                                        selected_in_block,
+                                        storage.exchange_values,
+                                        flat_block_id,
+                                        flat_block_thread_id,
+                                        is_global_last_block,
+                                        valid_in_global_last_block,
+                                        prev_selected_count_values,
+                                        prev_processed);
+
+    // Last block in grid stores number of selected values and their reduction
+    const bool is_last_block = flat_block_id == (number_of_blocks - 1);
+    if(is_last_block && flat_block_thread_id == 0)
+    {
+        const pair_type launch_reduction = pair_scan_op(prefix, reduction);
+        selected_count[0] = prev_selected_count_values[0] + ::rocprim::get<0>(launch_reduction);
+        if(::rocprim::get<0>(launch_reduction) == 0)
+        {
+            scan_value[0] = prev_value;
+        }
+        else
+        {
+            scan_value[0] = prev_selected_count_values[0] > 0
+                                ? scan_op(prev_value, ::rocprim::get<1>(launch_reduction))
+                                : ::rocprim::get<1>(launch_reduction);
+        }
+    }
+}
+
+// Number of values in each bucket of partition_n, the look-back scans all of them at once
+template<unsigned int Buckets>
+struct partition_n_counts
+{
+    unsigned int values[Buckets];
+
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    friend partition_n_counts operator+(const partition_n_counts& a, const partition_n_counts& b)
+    {
+        partition_n_counts result;
+        ROCPRIM_UNROLL
+        for(unsigned int bucket = 0; bucket < Buckets; bucket++)
+        {
+            result.values[bucket] = a.values[bucket] + b.values[bucket];
+        }
+        return result;
+    }
+};
+
+// Output iterators of partition_n, one for each bucket
+template<class OutputIterator, unsigned int Buckets>
+struct partition_n_outputs
+{
+    OutputIterator outputs[Buckets];
+};
+
+// Each thread counts its values per bucket and the counts are scanned by the block with
+// a look-back prefix, so a tile learns the offsets of all buckets in one pass. The values
+// are grouped by bucket in shared memory and written out contiguously for each bucket.
+template<class Config,
+         unsigned int Buckets,
+         class InputIterator,
+         class OutputIterator,
+         class BucketOp,
+         class CountsLookbackScanState>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+    partition_n_kernel_impl(InputIterator                               input,
+                            partition_n_outputs<OutputIterator, Buckets> outputs,
+                            size_t*                                     bucket_counts,
+                            const size_t*                               prev_bucket_counts,
+                            const size_t                                prev_processed,
+                            const size_t                                total_size,
+                            BucketOp                                    bucket_op,
+                            CountsLookbackScanState                     counts_scan_state,
+                            const unsigned int                          number_of_blocks,
+                            ordered_block_id<unsigned int>              ordered_bid)
+{
+    constexpr auto block_size = Config::block_size;
+    constexpr auto items_per_thread = Config::items_per_thread;
+    constexpr unsigned int items_per_block = block_size * items_per_thread;
+
+    using key_type = typename std::iterator_traits<InputIterator>::value_type;
+    using counts_type = partition_n_counts<Buckets>;
+    static_assert(std::is_same<counts_type, typename CountsLookbackScanState::value_type>::value,
+                  "value_type of CountsLookbackScanState must be partition_n_counts");
+
+    using block_load_key_type = ::rocprim::block_load<
+        key_type, block_size, items_per_thread,
+        Config::key_block_load_method
+    >;
+    using block_scan_counts_type = ::rocprim::block_scan<
+        counts_type, block_size,
+        Config::block_scan_method
+    >;
+    using order_bid_type = ordered_block_id<unsigned int>;
+    using counts_scan_prefix_op_type = offset_lookback_scan_prefix_op<
+        counts_type, CountsLookbackScanState, ::rocprim::plus<counts_type>,
+        config_lookback_backoff_type<Config, CountsLookbackScanState>
+    >;
+
+    using exchange_keys_storage_type = key_type[items_per_block];
+    using raw_exchange_keys_storage_type = typename detail::raw_storage<exchange_keys_storage_type>;
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        typename order_bid_type::storage_type ordered_bid;
+        union
+        {
+            raw_exchange_keys_storage_type exchange_keys;
+            typename block_load_key_type::storage_type load_keys;
+            typename block_scan_counts_type::storage_type scan_counts;
+        };
+        // Where the buckets begin in the tile and in their outputs
+        unsigned int bucket_begins[Buckets + 1];
+        size_t       bucket_offsets[Buckets];
+    } storage;
+
+    // Loaded before the ordered block id, see partition_kernel_impl
+    size_t prev_bucket_count_values[Buckets];
+    load_selected_count(prev_bucket_counts, prev_bucket_count_values);
+
+    const auto flat_block_thread_id = ::rocprim::detail::block_thread_id<0>();
+    const auto flat_block_id = ordered_bid.get(flat_block_thread_id, storage.ordered_bid);
+    const auto block_offset         = flat_block_id * items_per_block;
+    const unsigned int valid_in_global_last_block
+        = total_size - prev_processed - items_per_block * (number_of_blocks - 1);
+    const bool is_last_launch = total_size <= prev_processed + number_of_blocks * items_per_block;
+    const bool is_global_last_block = is_last_launch && flat_block_id == (number_of_blocks - 1);
 
-    // Load input values into values
+    key_type keys[items_per_thread];
     if(is_global_last_block)
     {
-        block_load_key_type().load(keys_input + block_offset,
+        block_load_key_type().load(input + block_offset,
                                    keys,
                                    valid_in_global_last_block,
                                    storage.load_keys);
     }
     else
     {
-        block_load_key_type()
-            .load(
-                keys_input + block_offset,
-                keys,
-                storage.load_keys
-            );
+        block_load_key_type().load(input + block_offset, keys, storage.load_keys);
     }
     ::rocprim::syncthreads(); // sync threads to reuse shared memory
 
-    // Load selection flags into is_selected, generate them using
-    // input value and selection predicate, or generate them using
-    // block_discontinuity primitive
-    const bool is_first_block = flat_block_id == 0 && prev_processed == 0;
-    partition_block_load_flags<SelectMethod,
-                               block_size,
-                               block_load_flag_type,
-                               block_discontinuity_key_type>(keys_input + block_offset - 1,
-                                                             flags + block_offset,
-                                                             keys,
-                                                             is_selected,
-                                                             predicates...,
-                                                             inequality_op,
-                                                             storage,
-                                                             is_first_block,
-                                                             flat_block_thread_id,
-                                                             is_global_last_block,
-                                                             valid_in_global_last_block);
-
-    // Convert true/false is_selected flags to 0s and 1s
-    convert_selected_to_indices(output_indices, is_selected);
-
-    // Number of selected values in previous blocks
-    offset_type selected_prefix{};
-    // Number of selected values in this block
-    offset_type selected_in_block{};
-
-    // Calculate number of selected values in block and their indices
+    // Values outside of the input and with invalid bucket ids get the bucket Buckets,
+    // they are not counted and not written
+    unsigned int buckets[items_per_thread];
+    counts_type  thread_counts;
+    ROCPRIM_UNROLL
+    for(unsigned int bucket = 0; bucket < Buckets; bucket++)
+    {
+        thread_counts.values[bucket] = 0;
+    }
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; i++)
+    {
+        const bool is_valid = !is_global_last_block
+            || flat_block_thread_id * items_per_thread + i < valid_in_global_last_block;
+        buckets[i] = is_valid ? static_cast<unsigned int>(bucket_op(keys[i])) : Buckets;
+        // Bucket ids are compared with every bucket, so the counts stay in registers
+        ROCPRIM_UNROLL
+        for(unsigned int bucket = 0; bucket < Buckets; bucket++)
+        {
+            thread_counts.values[bucket] += buckets[i] == bucket ? 1 : 0;
+        }
+    }
+
+    counts_type thread_prefix;
+    counts_type block_prefix;
+    counts_type reduction;
     if(flat_block_id == 0)
     {
-        block_scan_offset_type()
-            .exclusive_scan(
-                output_indices,
-                output_indices,
-                offset_type{}, /** initial value */
-                selected_in_block,
-                storage.scan_offsets,
-                ::rocprim::plus<offset_type>()
-            );
+        counts_type zero;
+        ROCPRIM_UNROLL
+        for(unsigned int bucket = 0; bucket < Buckets; bucket++)
+        {
+            zero.values[bucket] = 0;
+        }
+        block_scan_counts_type().exclusive_scan(thread_counts,
+                                                thread_prefix,
+                                                zero,
+                                                reduction,
+                                                storage.scan_counts,
+                                                ::rocprim::plus<counts_type>());
         if(flat_block_thread_id == 0)
         {
-            offset_scan_state.set_complete(flat_block_id, selected_in_block);
+            counts_scan_state.set_complete(flat_block_id, reduction);
         }
-        ::rocprim::syncthreads(); // sync threads to reuse shared memory
+        block_prefix = zero;
     }
     else
     {
-        ROCPRIM_SHARED_MEMORY typename offset_scan_prefix_op_type::storage_type storage_prefix_op;
-        auto prefix_op = offset_scan_prefix_op_type(
+        ROCPRIM_SHARED_MEMORY typename counts_scan_prefix_op_type::storage_type storage_prefix_op;
+        auto prefix_op = counts_scan_prefix_op_type(
             flat_block_id,
-            offset_scan_state,
+            counts_scan_state,
             storage_prefix_op
         );
-        block_scan_offset_type()
-            .exclusive_scan(
-                output_indices,
-                output_indices,
-                storage.scan_offsets,
-                prefix_op,
-                ::rocprim::plus<offset_type>()
-            );
+        block_scan_counts_type().exclusive_scan(thread_counts,
+                                                thread_prefix,
+                                                storage.scan_counts,
+                                                prefix_op,
+                                                ::rocprim::plus<counts_type>());
         ::rocprim::syncthreads(); // sync threads to reuse shared memory
 
-        selected_in_block = prefix_op.get_reduction();
-        selected_prefix   = prefix_op.get_prefix();
-    }
-
-    // Scatter selected and rejected values
-    partition_scatter<OnlySelected, block_size>(keys,
-                                                is_selected,
-                                                output_indices,
-                                                keys_output,
-                                                total_size,
-                                                selected_prefix,
-                                                selected_in_block,
-                                                storage.exchange_keys,
-                                                flat_block_id,
-                                                flat_block_thread_id,
-                                                is_global_last_block,
-                                                valid_in_global_last_block,
-                                                prev_selected_count_values,
-                                                prev_processed);
-
-    static constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
-
-    if ROCPRIM_IF_CONSTEXPR (with_values) {
-        value_type values[items_per_thread];
+        reduction    = prefix_op.get_reduction();
+        block_prefix = prefix_op.get_prefix();
+    }
 
-        ::rocprim::syncthreads(); // sync threads to reuse shared memory
-        if(is_global_last_block)
+    if(flat_block_thread_id == 0)
+    {
+        unsigned int bucket_begin = 0;
+        ROCPRIM_UNROLL
+        for(unsigned int bucket = 0; bucket < Buckets; bucket++)
         {
-            block_load_value_type().load(values_input + block_offset,
-                                         values,
-                                         valid_in_global_last_block,
-                                         storage.load_values);
+            storage.bucket_begins[bucket]  = bucket_begin;
+            storage.bucket_offsets[bucket] = prev_bucket_count_values[bucket]
+                                             + block_prefix.values[bucket];
+            bucket_begin += reduction.values[bucket];
         }
-        else
+        storage.bucket_begins[Buckets] = bucket_begin;
+    }
+    ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+    // Group the values by bucket in shared memory
+    auto scatter_storage = storage.exchange_keys.get();
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; i++)
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int bucket = 0; bucket < Buckets; bucket++)
         {
-            block_load_value_type()
-                .load(
-                    values_input + block_offset,
-                    values,
-                    storage.load_values
-                );
+            if(buckets[i] == bucket)
+            {
+                const unsigned int scatter_index = storage.bucket_begins[bucket]
+                                                   + thread_prefix.values[bucket]
+                                                   - block_prefix.values[bucket];
+                scatter_storage[scatter_index] = keys[i];
+                thread_prefix.values[bucket]++;
+            }
         }
-        ::rocprim::syncthreads(); // sync threads to reuse shared memory
+    }
+    ::rocprim::syncthreads(); // sync threads to reuse shared memory
 
-        partition_scatter<OnlySelected, block_size>(values,
-                                                    is_selected,
-                                                    output_indices,
-                                                    values_output,
-                                                    total_size,
-                                                    selected_prefix,
-                                                    selected_in_block,
-                                                    storage.exchange_values,
-                                                    flat_block_id,
-                                                    flat_block_thread_id,
-                                                    is_global_last_block,
-                                                    valid_in_global_last_block,
-                                                    prev_selected_count_values,
-                                                    prev_processed);
+    // Coalesced write of every bucket from shared memory to its output
+    const unsigned int selected_in_block = storage.bucket_begins[Buckets];
+    for(unsigned int item_index = flat_block_thread_id; item_index < selected_in_block;
+        item_index += block_size)
+    {
+        unsigned int bucket = 0;
+        ROCPRIM_UNROLL
+        for(unsigned int next_bucket = 1; next_bucket < Buckets; next_bucket++)
+        {
+            bucket += item_index >= storage.bucket_begins[next_bucket] ? 1 : 0;
+        }
+        const size_t output_index
+            = storage.bucket_offsets[bucket] + item_index - storage.bucket_begins[bucket];
+        outputs.outputs[bucket][output_index] = scatter_storage[item_index];
     }
 
-    // Last block in grid stores number of selected values
+    // Last block in grid stores number of values in every bucket
     const bool is_last_block = flat_block_id == (number_of_blocks - 1);
     if(is_last_block && flat_block_thread_id == 0)
     {
-        store_selected_count(selected_count,
-                             prev_selected_count_values,
-                             selected_prefix,
-                             selected_in_block);
+        ROCPRIM_UNROLL
+        for(unsigned int bucket = 0; bucket < Buckets; bucket++)
+        {
+            bucket_counts[bucket] = prev_bucket_count_values[bucket] + block_prefix.values[bucket]
+                                    + reduction.values[bucket];
+        }
     }
 }
 
@@ -0,0 +1,359 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_RADIX_SELECT_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_RADIX_SELECT_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "../../config.hpp"
+#include "../../detail/radix_sort.hpp"
+#include "../../detail/various.hpp"
+#include "../../intrinsics.hpp"
+#include "../../types/future_value.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Radix select.
+//
+// The k-th key in sorted order is found digit by digit starting from the most significant one.
+// Every pass builds a histogram of the next digit of the keys that match the digits found so far,
+// and a single block picks the digit where the running count reaches the number of keys that are
+// still missing. Several ranks are selected at once with one state and one histogram per rank.
+// All state is kept on the device, so no host synchronization is needed between passes.
+
+// Number of ranks that one launch of the histogram kernel counts in shared memory
+constexpr unsigned int radix_select_max_states = 8;
+
+template<class BitKey>
+struct radix_select_state
+{
+    // Digits of the selected key found so far
+    BitKey prefix;
+    // Bits of prefix that are already known
+    BitKey prefix_mask;
+    // Number of keys that go before the selected key
+    size_t less_count;
+    // Number of keys equal to the selected key that are needed to reach the rank
+    size_t remaining;
+};
+
+// One block per state, RankOp returns the number of keys up to and including the selected one.
+template<class BitKey, class RankOp>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void radix_select_init_kernel_impl(radix_select_state<BitKey>* states,
+                                   unsigned long long*         histograms,
+                                   RankOp                      rank_op)
+{
+    const unsigned int flat_id  = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int state_id = ::rocprim::detail::block_id<0>();
+    if(flat_id < radix_select_size)
+    {
+        histograms[state_id * radix_select_size + flat_id] = 0;
+    }
+    if(flat_id == 0)
+    {
+        radix_select_state<BitKey>& state = states[state_id];
+        state.prefix      = 0;
+        state.prefix_mask = 0;
+        state.less_count  = 0;
+        state.remaining   = rank_op(state_id);
+    }
+}
+
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class KeyCodec,
+         class KeysInputIterator>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void radix_select_histogram_kernel_impl(
+    KeysInputIterator                                          keys_input,
+    const size_t                                               size,
+    const radix_select_state<typename KeyCodec::bit_key_type>* states,
+    const unsigned int                                         state_count,
+    unsigned long long*                                        histograms,
+    const unsigned int                                         bit,
+    const unsigned int                                         current_radix_bits)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    using bit_key_type = typename KeyCodec::bit_key_type;
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        unsigned int block_histograms[radix_select_max_states][radix_select_size];
+        bit_key_type prefixes[radix_select_max_states];
+        bit_key_type prefix_masks[radix_select_max_states];
+    } storage;
+
+    const unsigned int flat_id  = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int block_id = ::rocprim::detail::block_id<0>();
+    const size_t       stride   = size_t(::rocprim::detail::grid_size<0>()) * items_per_block;
+
+    for(unsigned int i = flat_id; i < state_count * radix_select_size; i += BlockSize)
+    {
+        storage.block_histograms[i / radix_select_size][i % radix_select_size] = 0;
+    }
+    if(flat_id < state_count)
+    {
+        storage.prefixes[flat_id]     = states[flat_id].prefix;
+        storage.prefix_masks[flat_id] = states[flat_id].prefix_mask;
+    }
+    ::rocprim::syncthreads();
+
+    const unsigned int digit_mask = (1u << current_radix_bits) - 1;
+
+    for(size_t block_offset = size_t(block_id) * items_per_block; block_offset < size;
+        block_offset += stride)
+    {
+        // Striped arrangement, the order of keys is irrelevant, only totals matter
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            const size_t index = block_offset + i * BlockSize + flat_id;
+            if(index < size)
+            {
+                const bit_key_type bit_key = radix_select_encode<KeyCodec>(keys_input[index]);
+                const unsigned int digit   = static_cast<unsigned int>(bit_key >> bit) & digit_mask;
+                for(unsigned int s = 0; s < state_count; s++)
+                {
+                    if(static_cast<bit_key_type>(bit_key & storage.prefix_masks[s])
+                       == storage.prefixes[s])
+                    {
+                        ::rocprim::detail::atomic_add(&storage.block_histograms[s][digit], 1u);
+                    }
+                }
+            }
+        }
+    }
+    ::rocprim::syncthreads();
+
+    for(unsigned int i = flat_id; i < state_count * radix_select_size; i += BlockSize)
+    {
+        const unsigned int count
+            = storage.block_histograms[i / radix_select_size][i % radix_select_size];
+        if(count != 0)
+        {
+            ::rocprim::detail::atomic_add(&histograms[i], static_cast<unsigned long long>(count));
+        }
+    }
+}
+
+// One block per state
+template<class BitKey>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void radix_select_digit_kernel_impl(radix_select_state<BitKey>* states,
+                                    unsigned long long*         histograms,
+                                    const unsigned int          bit,
+                                    const unsigned int          current_radix_bits)
+{
+    const unsigned int  flat_id   = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int  state_id  = ::rocprim::detail::block_id<0>();
+    unsigned long long* histogram = histograms + state_id * radix_select_size;
+    if(flat_id == 0)
+    {
+        radix_select_state<BitKey>& state = states[state_id];
+
+        // There are only radix_select_size digits, so a sequential scan is cheap enough
+        const unsigned int radix_size = 1u << current_radix_bits;
+        const size_t       remaining  = state.remaining;
+        size_t             before     = 0;
+        unsigned int       digit      = 0;
+        while(digit + 1 < radix_size && before + histogram[digit] < remaining)
+        {
+            before += histogram[digit];
+            digit++;
+        }
+        state.prefix |= static_cast<BitKey>(static_cast<BitKey>(digit) << bit);
+        state.prefix_mask |= static_cast<BitKey>(static_cast<BitKey>(radix_size - 1) << bit);
+        state.less_count += before;
+        state.remaining -= before;
+    }
+    ::rocprim::syncthreads();
+
+    // Clear the histogram for the next pass
+    if(flat_id < radix_select_size)
+    {
+        histogram[flat_id] = 0;
+    }
+}
+
+template<class KeyCodec, class OutputIterator>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void radix_select_store_kernel_impl(
+    const radix_select_state<typename KeyCodec::bit_key_type>* states,
+    const unsigned int                                         state_count,
+    OutputIterator                                             output)
+{
+    const unsigned int state_id = ::rocprim::detail::block_id<0>() * radix_select_size
+                                  + ::rocprim::detail::block_thread_id<0>();
+    if(state_id < state_count)
+    {
+        output[state_id] = KeyCodec::decode(states[state_id].prefix);
+    }
+}
+
+// Rank of a single k, which can be a future_value
+template<class K>
+struct select_kth_rank_op
+{
+    K      k;
+    size_t size;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    size_t operator()(unsigned int /*state_id*/) const
+    {
+        const size_t index = static_cast<size_t>(get_input_value(k));
+        return ::rocprim::min(index, size - 1) + 1;
+    }
+};
+
+// Ranks of several ks, one per state
+template<class KIterator>
+struct select_kth_ranks_op
+{
+    KIterator ks;
+    size_t    size;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    size_t operator()(unsigned int state_id) const
+    {
+        const size_t index = static_cast<size_t>(ks[state_id]);
+        return ::rocprim::min(index, size - 1) + 1;
+    }
+};
+
+// The first k keys are selected
+struct topk_rank_op
+{
+    size_t k;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    size_t operator()(unsigned int /*state_id*/) const
+    {
+        return k;
+    }
+};
+
+// Selects keys that go before the threshold.
+template<class KeyCodec>
+struct topk_before_threshold_op
+{
+    const radix_select_state<typename KeyCodec::bit_key_type>* state;
+
+    template<class Key>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    bool operator()(const Key& key) const
+    {
+        return radix_select_encode<KeyCodec>(key) < state->prefix;
+    }
+};
+
+// Selects keys that are equal to the threshold.
+template<class KeyCodec>
+struct topk_at_threshold_op
+{
+    const radix_select_state<typename KeyCodec::bit_key_type>* state;
+
+    template<class Key>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    bool operator()(const Key& key) const
+    {
+        return radix_select_encode<KeyCodec>(key) == state->prefix;
+    }
+};
+
+// Output iterator for keys equal to the threshold. They are stored after the keys that go before
+// the threshold, and only the first state->remaining of them are stored at all.
+template<class OutputIterator, class BitKey>
+class topk_tie_output_iterator
+{
+public:
+    struct reference
+    {
+        OutputIterator                    output;
+        size_t                            index;
+        const radix_select_state<BitKey>* state;
+
+        template<class T>
+        ROCPRIM_DEVICE ROCPRIM_INLINE
+        reference& operator=(const T& value)
+        {
+            if(index < state->remaining)
+            {
+                output[state->less_count + index] = value;
+            }
+            return *this;
+        }
+    };
+
+    using value_type        = typename std::iterator_traits<OutputIterator>::value_type;
+    using pointer           = void;
+    using difference_type   = std::ptrdiff_t;
+    using iterator_category = std::random_access_iterator_tag;
+
+    ROCPRIM_HOST_DEVICE inline
+    topk_tie_output_iterator(OutputIterator                    output,
+                             const radix_select_state<BitKey>* state,
+                             size_t                            index = 0)
+        : output_(output), state_(state), index_(index)
+    {}
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator*() const
+    {
+        return reference{output_, index_, state_};
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator[](difference_type distance) const
+    {
+        return reference{output_, index_ + distance, state_};
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    topk_tie_output_iterator operator+(difference_type distance) const
+    {
+        return topk_tie_output_iterator(output_, state_, index_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    topk_tie_output_iterator& operator+=(difference_type distance)
+    {
+        index_ += distance;
+        return *this;
+    }
+
+private:
+    OutputIterator                    output_;
+    const radix_select_state<BitKey>* state_;
+    size_t                            index_;
+};
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_RADIX_SELECT_HPP_
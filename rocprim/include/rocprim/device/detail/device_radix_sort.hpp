@@ -37,13 +37,22 @@
 #include "../../block/block_load.hpp"
 #include "../../block/block_load_func.hpp"
 #include "../../block/block_scan.hpp"
+#include "../../block/block_store.hpp"
 #include "../../block/block_radix_sort.hpp"
 
+#include "grid_barrier.hpp"
+#include "lookback_scan_state.hpp"
+#include "ordered_block_id.hpp"
+
 BEGIN_ROCPRIM_NAMESPACE
 
 namespace detail
 {
 
+// Bits of the digits ranked by one pass of block_radix_sort in the device-level sorts:
+// multi-bit digits are ranked with warp matches, which needs fewer block-wide barriers.
+constexpr unsigned int block_radix_sort_bits_per_pass = 4;
+
 // Wrapping functions that allow one to call proper methods (with or without values)
 // (a variant with values is enabled only when Value is not empty_type)
 template<bool Descending = false, class SortType, class SortKey, class SortValue, unsigned int ItemsPerThread>
@@ -90,7 +99,9 @@ template<
     unsigned int BlockSize,
     unsigned int ItemsPerThread,
     unsigned int RadixBits,
-    bool Descending
+    bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer
 >
 struct radix_digit_count_helper
 {
@@ -124,7 +135,7 @@ struct radix_digit_count_helper
 
         using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
 
-        using key_codec = radix_key_codec<key_type, Descending>;
+        using key_codec = radix_key_codec<key_type, Descending, FloatOrder, Decomposer>;
         using bit_key_type = typename key_codec::bit_key_type;
 
         const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
@@ -195,6 +206,8 @@ template<
     unsigned int BlockSize,
     unsigned int ItemsPerThread,
     bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
     class Key,
     class Value
 >
@@ -205,7 +218,7 @@ struct radix_sort_single_helper
     using key_type = Key;
     using value_type = Value;
 
-    using key_codec = radix_key_codec<key_type, Descending>;
+    using key_codec = radix_key_codec<key_type, Descending, FloatOrder, Decomposer>;
     using bit_key_type = typename key_codec::bit_key_type;
     using keys_load_type = ::rocprim::block_load<
         key_type, BlockSize, ItemsPerThread,
@@ -213,7 +226,7 @@ struct radix_sort_single_helper
     using values_load_type = ::rocprim::block_load<
         value_type, BlockSize, ItemsPerThread,
         ::rocprim::block_load_method::block_load_transpose>;
-    using sort_type = ::rocprim::block_radix_sort<key_type, BlockSize, ItemsPerThread, value_type>;
+    using sort_type = ::rocprim::block_radix_sort<key_type, BlockSize, ItemsPerThread, value_type, 1, 1, FloatOrder, Decomposer, block_radix_sort_bits_per_pass>;
 
     static constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
 
@@ -252,7 +265,7 @@ struct radix_sort_single_helper
 
         using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
 
-        using key_codec = radix_key_codec<key_type, Descending>;
+        using key_codec = radix_key_codec<key_type, Descending, FloatOrder, Decomposer>;
         using bit_key_type = typename key_codec::bit_key_type;
 
         key_type keys[ItemsPerThread];
@@ -269,7 +282,7 @@ struct radix_sort_single_helper
         }
         else
         {
-            const key_type out_of_bounds = key_codec::decode(bit_key_type(-1));
+            const key_type out_of_bounds = key_codec::get_out_of_bounds_key();
             valid_in_last_block = size - items_per_block * (number_of_blocks - 1);
             keys_load_type().load(keys_input + block_offset, keys, valid_in_last_block, out_of_bounds, storage.keys_load);
             if(with_values)
@@ -298,14 +311,183 @@ struct radix_sort_single_helper
     }
 };
 
+// Write-combining scatter of a sorted tile. The items of digit runs of at least RunLength items
+// are assigned to threads by their destinations instead of their positions in the tile: every run
+// gets a slot of virtual positions that starts at the alignment of its first destination modulo
+// RunLength, so consecutive threads write whole aligned segments of RunLength items. Shorter runs
+// are packed after the slots of the long runs. The virtual positions of the tile are mapped to
+// the positions of the sorted items, which are staged in shared memory.
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int RadixBits,
+    unsigned int RunLength,
+    class KeyCodec,
+    class Value,
+    class Offset
+>
+struct radix_write_combining_scatter
+{
+    static constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    static constexpr unsigned int radix_size = 1 << RadixBits;
+    // Every long run needs at most 2 * (RunLength - 1) virtual positions more than its items and
+    // there are at most items_per_block / RunLength long runs
+    static constexpr unsigned int max_virtual_size = 3 * items_per_block;
+    static constexpr unsigned short invalid_position = 0xFFFF;
+
+    static_assert(RunLength > 0, "RunLength must be greater than 0");
+    static_assert(items_per_block < invalid_position, "Items per block must fit in unsigned short");
+    static_assert(radix_size <= BlockSize, "Radix size must not exceed BlockSize");
+
+    using bit_key_type = typename KeyCodec::bit_key_type;
+    using value_type = Value;
+    // The numbers of virtual positions of long runs in the high half, of short runs in the low half
+    using scan_type = ::rocprim::block_scan<unsigned long long, BlockSize>;
+
+    static constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+
+    struct stage_type
+    {
+        bit_key_type keys[items_per_block];
+        value_type values[with_values ? items_per_block : 1];
+    };
+
+    struct storage_type_
+    {
+        union
+        {
+            typename scan_type::storage_type scan;
+            detail::raw_storage<stage_type> stage;
+        };
+        unsigned short positions[max_virtual_size];
+        unsigned int run_starts[radix_size];
+    };
+
+    using storage_type = detail::raw_storage<storage_type_>;
+
+    // starts are the positions of the first items of the digits in the sorted tile and
+    // digit_starts their destinations, the items are in the blocked arrangement.
+    template<class KeysOutputIterator, class ValuesOutputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void scatter(const bit_key_type (&bit_keys)[ItemsPerThread],
+                 const value_type (&values)[ItemsPerThread],
+                 const unsigned int valid_count,
+                 const unsigned short * starts,
+                 const unsigned short * ends,
+                 const Offset * digit_starts,
+                 const unsigned int bit,
+                 const unsigned int current_radix_bits,
+                 KeysOutputIterator keys_output,
+                 ValuesOutputIterator values_output,
+                 storage_type& storage)
+    {
+        const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+        storage_type_& storage_ = storage.get();
+
+        unsigned long long slots = 0;
+        unsigned int count = 0;
+        unsigned int alignment = 0;
+        if(flat_id < radix_size)
+        {
+            const unsigned int start = starts[flat_id];
+            const unsigned int end = ends[flat_id];
+            count = start < valid_count ? ::rocprim::min(valid_count - 1, end) - start + 1 : 0;
+            alignment = static_cast<unsigned int>(digit_starts[flat_id] % RunLength);
+            // A long run is padded to whole segments, its first item is at the alignment of its
+            // destination
+            const unsigned int segments = ::rocprim::detail::ceiling_div(alignment + count, RunLength);
+            slots = count >= RunLength
+                ? static_cast<unsigned long long>(segments * RunLength) << 32
+                : count;
+        }
+        unsigned long long prefix;
+        unsigned long long total;
+        scan_type().exclusive_scan(slots, prefix, 0ull, total, storage_.scan,
+                                   ::rocprim::plus<unsigned long long>());
+        const unsigned int long_size = static_cast<unsigned int>(total >> 32);
+        const unsigned int virtual_size = long_size + static_cast<unsigned int>(total);
+        ::rocprim::syncthreads();
+
+        if(flat_id < radix_size)
+        {
+            storage_.run_starts[flat_id] = count >= RunLength
+                ? static_cast<unsigned int>(prefix >> 32) + alignment
+                : long_size + static_cast<unsigned int>(prefix);
+        }
+        for(unsigned int v = flat_id; v < virtual_size; v += BlockSize)
+        {
+            storage_.positions[v] = invalid_position;
+        }
+        stage_type& stage = storage_.stage.get();
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            const unsigned int pos = flat_id * ItemsPerThread + i;
+            stage.keys[pos] = bit_keys[i];
+            if(with_values)
+            {
+                stage.values[pos] = values[i];
+            }
+        }
+        ::rocprim::syncthreads();
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            const unsigned int pos = flat_id * ItemsPerThread + i;
+            if(pos < valid_count)
+            {
+                const unsigned int digit
+                    = KeyCodec::extract_digit(bit_keys[i], bit, current_radix_bits);
+                storage_.positions[storage_.run_starts[digit] + pos - starts[digit]]
+                    = static_cast<unsigned short>(pos);
+            }
+        }
+        ::rocprim::syncthreads();
+
+        for(unsigned int v = flat_id; v < virtual_size; v += BlockSize)
+        {
+            const unsigned int pos = storage_.positions[v];
+            if(pos != invalid_position)
+            {
+                const bit_key_type bit_key = stage.keys[pos];
+                const unsigned int digit
+                    = KeyCodec::extract_digit(bit_key, bit, current_radix_bits);
+                const Offset dst = pos - starts[digit] + digit_starts[digit];
+                keys_output[dst] = KeyCodec::decode(bit_key);
+                if(with_values)
+                {
+                    values_output[dst] = stage.values[pos];
+                }
+            }
+        }
+    }
+};
+
+// The storage of the write-combining scatter is only instantiated when it is used
+template<bool WriteCombining, class Scatter>
+struct radix_scatter_storage
+{
+    using type = ::rocprim::empty_type;
+};
+
+template<class Scatter>
+struct radix_scatter_storage<true, Scatter>
+{
+    using type = typename Scatter::storage_type;
+};
+
 template<
     unsigned int BlockSize,
     unsigned int ItemsPerThread,
     unsigned int RadixBits,
     bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
     class Key,
     class Value,
-    class Offset
+    class Offset,
+    unsigned int ScatterRunLength = 0
 >
 struct radix_sort_and_scatter_helper
 {
@@ -315,7 +497,7 @@ struct radix_sort_and_scatter_helper
     using key_type = Key;
     using value_type = Value;
 
-    using key_codec = radix_key_codec<key_type, Descending>;
+    using key_codec = radix_key_codec<key_type, Descending, FloatOrder, Decomposer>;
     using bit_key_type = typename key_codec::bit_key_type;
     using keys_load_type = ::rocprim::block_load<
         key_type, BlockSize, ItemsPerThread,
@@ -323,12 +505,16 @@ struct radix_sort_and_scatter_helper
     using values_load_type = ::rocprim::block_load<
         value_type, BlockSize, ItemsPerThread,
         ::rocprim::block_load_method::block_load_transpose>;
-    using sort_type = ::rocprim::block_radix_sort<key_type, BlockSize, ItemsPerThread, value_type>;
+    using sort_type = ::rocprim::block_radix_sort<key_type, BlockSize, ItemsPerThread, value_type, 1, 1, FloatOrder, Decomposer, block_radix_sort_bits_per_pass>;
     using discontinuity_type = ::rocprim::block_discontinuity<unsigned int, BlockSize>;
     using bit_keys_exchange_type = ::rocprim::block_exchange<bit_key_type, BlockSize, ItemsPerThread>;
     using values_exchange_type = ::rocprim::block_exchange<value_type, BlockSize, ItemsPerThread>;
+    using scatter_type = radix_write_combining_scatter<
+        BlockSize, ItemsPerThread, RadixBits, ::rocprim::max(ScatterRunLength, 1u),
+        key_codec, value_type, Offset>;
 
     static constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+    static constexpr bool write_combining = ScatterRunLength > 0;
 
     struct storage_type
     {
@@ -340,6 +526,7 @@ struct radix_sort_and_scatter_helper
             typename discontinuity_type::storage_type discontinuity;
             typename bit_keys_exchange_type::storage_type bit_keys_exchange;
             typename values_exchange_type::storage_type values_exchange;
+            typename radix_scatter_storage<write_combining, scatter_type>::type scatter;
         };
 
         unsigned short starts[radix_size];
@@ -348,6 +535,64 @@ struct radix_sort_and_scatter_helper
         Offset digit_starts[radix_size];
     };
 
+    // Writes the sorted tile, the items are in the blocked arrangement
+    template<bool IsFull, class KeysOutputIterator, class ValuesOutputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void scatter_tile(std::false_type /* write_combining */,
+                      bit_key_type (&bit_keys)[ItemsPerThread],
+                      value_type (&values)[ItemsPerThread],
+                      const unsigned int valid_count,
+                      const unsigned int bit,
+                      const unsigned int current_radix_bits,
+                      KeysOutputIterator keys_output,
+                      ValuesOutputIterator values_output,
+                      storage_type& storage)
+    {
+        const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+
+        // Rearrange to striped arrangement to have faster coalesced writes instead of
+        // scattering of blocked-arranged items
+        bit_keys_exchange_type().blocked_to_striped(bit_keys, bit_keys, storage.bit_keys_exchange);
+        if(with_values)
+        {
+            ::rocprim::syncthreads();
+            values_exchange_type().blocked_to_striped(values, values, storage.values_exchange);
+        }
+
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            const unsigned int digit = key_codec::extract_digit(bit_keys[i], bit, current_radix_bits);
+            const unsigned int pos = i * BlockSize + flat_id;
+            if(IsFull || (pos < valid_count))
+            {
+                const Offset dst = pos - storage.starts[digit] + storage.digit_starts[digit];
+                keys_output[dst] = key_codec::decode(bit_keys[i]);
+                if(with_values)
+                {
+                    values_output[dst] = values[i];
+                }
+            }
+        }
+    }
+
+    template<bool IsFull, class KeysOutputIterator, class ValuesOutputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void scatter_tile(std::true_type /* write_combining */,
+                      bit_key_type (&bit_keys)[ItemsPerThread],
+                      value_type (&values)[ItemsPerThread],
+                      const unsigned int valid_count,
+                      const unsigned int bit,
+                      const unsigned int current_radix_bits,
+                      KeysOutputIterator keys_output,
+                      ValuesOutputIterator values_output,
+                      storage_type& storage)
+    {
+        scatter_type().scatter(bit_keys, values, valid_count,
+                               storage.starts, storage.ends, storage.digit_starts,
+                               bit, current_radix_bits,
+                               keys_output, values_output, storage.scatter);
+    }
+
     template<
         bool IsFull = false,
         class KeysInputIterator,
@@ -393,7 +638,7 @@ struct radix_sort_and_scatter_helper
             {
                 valid_count = end_offset - block_offset;
                 // Sort will leave "invalid" (out of size) items at the end of the sorted sequence
-                const key_type out_of_bounds = key_codec::decode(bit_key_type(-1));
+                const key_type out_of_bounds = key_codec::get_out_of_bounds_key();
                 keys_load_type().load(keys_input + block_offset, keys, valid_count, out_of_bounds, storage.keys_load);
                 if(with_values)
                 {
@@ -442,29 +687,9 @@ struct radix_sort_and_scatter_helper
             }
 
             ::rocprim::syncthreads();
-            // Rearrange to striped arrangement to have faster coalesced writes instead of
-            // scattering of blocked-arranged items
-            bit_keys_exchange_type().blocked_to_striped(bit_keys, bit_keys, storage.bit_keys_exchange);
-            if(with_values)
-            {
-                ::rocprim::syncthreads();
-                values_exchange_type().blocked_to_striped(values, values, storage.values_exchange);
-            }
-
-            for(unsigned int i = 0; i < ItemsPerThread; i++)
-            {
-                const unsigned int digit = key_codec::extract_digit(bit_keys[i], bit, current_radix_bits);
-                const unsigned int pos = i * BlockSize + flat_id;
-                if(IsFull || (pos < valid_count))
-                {
-                    const Offset dst = pos - storage.starts[digit] + storage.digit_starts[digit];
-                    keys_output[dst] = key_codec::decode(bit_keys[i]);
-                    if(with_values)
-                    {
-                        values_output[dst] = values[i];
-                    }
-                }
-            }
+            scatter_tile<IsFull>(std::integral_constant<bool, write_combining>(),
+                                 bit_keys, values, valid_count, bit, current_radix_bits,
+                                 keys_output, values_output, storage);
 
             ::rocprim::syncthreads();
 
@@ -483,11 +708,36 @@ struct radix_sort_and_scatter_helper
     }
 };
 
+// Returns the offset of the first item of the batch, the first full_batches batches have
+// blocks_per_full_batch blocks and the following ones one block less
+template<unsigned int ItemsPerBlock, class Offset>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+Offset radix_sort_batch_offset(const unsigned int batch_id,
+                               const unsigned int blocks_per_full_batch,
+                               const unsigned int full_batches,
+                               unsigned int&      blocks_per_batch)
+{
+    Offset block_offset;
+    if(batch_id < full_batches)
+    {
+        blocks_per_batch = blocks_per_full_batch;
+        block_offset = batch_id * blocks_per_batch;
+    }
+    else
+    {
+        blocks_per_batch = blocks_per_full_batch - 1;
+        block_offset = batch_id * blocks_per_batch + full_batches;
+    }
+    return block_offset * ItemsPerBlock;
+}
+
 template<
     unsigned int BlockSize,
     unsigned int ItemsPerThread,
     unsigned int RadixBits,
     bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
     class KeysInputIterator,
     class Offset
 >
@@ -503,26 +753,16 @@ void fill_digit_counts(KeysInputIterator keys_input,
     constexpr unsigned int radix_size = 1 << RadixBits;
     constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
 
-    using count_helper_type = radix_digit_count_helper<::rocprim::device_warp_size(), BlockSize, ItemsPerThread, RadixBits, Descending>;
+    using count_helper_type = radix_digit_count_helper<::rocprim::device_warp_size(), BlockSize, ItemsPerThread, RadixBits, Descending, FloatOrder, Decomposer>;
 
     ROCPRIM_SHARED_MEMORY typename count_helper_type::storage_type storage;
 
     const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
     const unsigned int batch_id = ::rocprim::detail::block_id<0>();
 
-    Offset block_offset;
     unsigned int blocks_per_batch;
-    if(batch_id < full_batches)
-    {
-        blocks_per_batch = blocks_per_full_batch;
-        block_offset = batch_id * blocks_per_batch;
-    }
-    else
-    {
-        blocks_per_batch = blocks_per_full_batch - 1;
-        block_offset = batch_id * blocks_per_batch + full_batches;
-    }
-    block_offset *= items_per_block;
+    const Offset block_offset = radix_sort_batch_offset<items_per_block, Offset>(
+        batch_id, blocks_per_full_batch, full_batches, blocks_per_batch);
 
     unsigned int digit_count;
     if(batch_id < ::rocprim::detail::grid_size<0>() - 1)
@@ -567,31 +807,39 @@ void scan_batches(Offset * batch_digit_counts,
 
     using scan_type = typename ::rocprim::block_scan<Offset, BlockSize>;
 
-    const unsigned int digit = ::rocprim::detail::block_id<0>();
     const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
 
-    Offset values[ItemsPerThread];
-    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    // The grid can be smaller than radix_size when it is limited by scoped_grid_limit, then
+    // blocks scan multiple digits
+    for(unsigned int digit = ::rocprim::detail::block_id<0>(); digit < radix_size;
+        digit += ::rocprim::detail::grid_size<0>())
     {
-        const unsigned int batch_id = flat_id * ItemsPerThread + i;
-        values[i] = (batch_id < batches ? batch_digit_counts[batch_id * radix_size + digit] : 0);
-    }
+        Offset values[ItemsPerThread];
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            const unsigned int batch_id = flat_id * ItemsPerThread + i;
+            values[i]
+                = (batch_id < batches ? batch_digit_counts[batch_id * radix_size + digit] : 0);
+        }
 
-    Offset digit_count;
-    scan_type().exclusive_scan(values, values, 0, digit_count);
+        Offset digit_count;
+        scan_type().exclusive_scan(values, values, 0, digit_count);
 
-    for(unsigned int i = 0; i < ItemsPerThread; i++)
-    {
-        const unsigned int batch_id = flat_id * ItemsPerThread + i;
-        if(batch_id < batches)
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
         {
-            batch_digit_counts[batch_id * radix_size + digit] = values[i];
+            const unsigned int batch_id = flat_id * ItemsPerThread + i;
+            if(batch_id < batches)
+            {
+                batch_digit_counts[batch_id * radix_size + digit] = values[i];
+            }
         }
-    }
 
-    if(flat_id == 0)
-    {
-        digit_counts[digit] = digit_count;
+        if(flat_id == 0)
+        {
+            digit_counts[digit] = digit_count;
+        }
+        // The storage of the block scan is reused by the next digit
+        ::rocprim::syncthreads();
     }
 }
 
@@ -617,6 +865,8 @@ template<
     unsigned int BlockSize,
     unsigned int ItemsPerThread,
     bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
     class KeysInputIterator,
     class KeysOutputIterator,
     class ValuesInputIterator,
@@ -635,7 +885,7 @@ void sort_single(KeysInputIterator keys_input,
     using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
 
     using sort_single_helper = radix_sort_single_helper<
-        BlockSize, ItemsPerThread, Descending,
+        BlockSize, ItemsPerThread, Descending, FloatOrder, Decomposer,
         key_type, value_type
     >;
 
@@ -653,6 +903,9 @@ template<
     unsigned int ItemsPerThread,
     unsigned int RadixBits,
     bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
+    unsigned int ScatterRunLength,
     class KeysInputIterator,
     class KeysOutputIterator,
     class ValuesInputIterator,
@@ -679,8 +932,8 @@ void sort_and_scatter(KeysInputIterator keys_input,
     using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
 
     using sort_and_scatter_helper = radix_sort_and_scatter_helper<
-        BlockSize, ItemsPerThread, RadixBits, Descending,
-        key_type, value_type, Offset
+        BlockSize, ItemsPerThread, RadixBits, Descending, FloatOrder, Decomposer,
+        key_type, value_type, Offset, ScatterRunLength
     >;
 
     ROCPRIM_SHARED_MEMORY typename sort_and_scatter_helper::storage_type storage;
@@ -688,19 +941,9 @@ void sort_and_scatter(KeysInputIterator keys_input,
     const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
     const unsigned int batch_id = ::rocprim::detail::block_id<0>();
 
-    Offset block_offset;
     unsigned int blocks_per_batch;
-    if(batch_id < full_batches)
-    {
-        blocks_per_batch = blocks_per_full_batch;
-        block_offset = batch_id * blocks_per_batch;
-    }
-    else
-    {
-        blocks_per_batch = blocks_per_full_batch - 1;
-        block_offset = batch_id * blocks_per_batch + full_batches;
-    }
-    block_offset *= items_per_block;
+    const Offset block_offset = radix_sort_batch_offset<items_per_block, Offset>(
+        batch_id, blocks_per_full_batch, full_batches, blocks_per_batch);
 
     Offset digit_start = 0;
     if(flat_id < radix_size)
@@ -730,70 +973,1320 @@ void sort_and_scatter(KeysInputIterator keys_input,
     }
 }
 
-template<class T>
-ROCPRIM_DEVICE ROCPRIM_INLINE
-auto compare_nan_sensitive(const T& a, const T& b)
-    -> typename std::enable_if<rocprim::is_floating_point<T>::value, bool>::type
+// Sorts the whole input in a single launch. The blocks of the grid are the batches of
+// sort_and_scatter and all of them must be resident at once, the phases of every pass are
+// separated by the grid barrier: counting the digits of the batches, scanning the counts of
+// every digit over the batches, and scanning the totals of the digits, which every block does
+// for itself, followed by the sorting and scattering of the batches. Passes in which all keys
+// have the same digit are skipped. All passes sort RadixBits bits, the first one moves the keys
+// to the output if first_to_output is true and to the temporary buffers otherwise. The sorted
+// keys end in the output, they are copied from the temporary buffers if an odd number of passes
+// was skipped. The number of passes made is written to executed_passes.
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int RadixBits,
+    unsigned int ScanItemsPerThread,
+    bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
+    unsigned int ScatterRunLength,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class Offset
+>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void sort_cooperative(KeysInputIterator keys_input,
+                      typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
+                      KeysOutputIterator keys_output,
+                      ValuesInputIterator values_input,
+                      typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
+                      ValuesOutputIterator values_output,
+                      Offset size,
+                      Offset * batch_digit_counts,
+                      Offset * digit_counts,
+                      grid_barrier barrier,
+                      unsigned int * executed_passes,
+                      bool first_to_output,
+                      unsigned int begin_bit,
+                      unsigned int end_bit,
+                      unsigned int blocks_per_full_batch,
+                      unsigned int full_batches)
 {
-    // Beware: the performance of this function is extremely vulnerable to refactoring.
-    // Always check benchmark_device_segmented_radix_sort and benchmark_device_radix_sort
-    // when making changes to this function.
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    constexpr unsigned int radix_size = 1 << RadixBits;
 
-    using bit_key_type = typename float_bit_mask<T>::bit_type;
-    static constexpr auto sign_bit = float_bit_mask<T>::sign_bit;
-    
-    auto a_bits = __builtin_bit_cast(bit_key_type, a);
-    auto b_bits = __builtin_bit_cast(bit_key_type, b);
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
 
-    // convert -0.0 to +0.0
-    a_bits = a_bits == sign_bit ? 0 : a_bits;
-    b_bits = b_bits == sign_bit ? 0 : b_bits;
-    // invert negatives, put 1 into sign bit for positives 
-    a_bits ^= (sign_bit & a_bits) == 0 ? sign_bit : bit_key_type(-1);
-    b_bits ^= (sign_bit & b_bits) == 0 ? sign_bit : bit_key_type(-1);
+    constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
 
-    // sort numbers and NaNs according to their bit representation
-    return a_bits > b_bits;
-}
+    using count_helper_type = radix_digit_count_helper<::rocprim::device_warp_size(), BlockSize, ItemsPerThread, RadixBits, Descending, FloatOrder, Decomposer>;
+    using sort_and_scatter_helper = radix_sort_and_scatter_helper<
+        BlockSize, ItemsPerThread, RadixBits, Descending, FloatOrder, Decomposer,
+        key_type, value_type, Offset, ScatterRunLength
+    >;
+    using scan_type = ::rocprim::block_scan<Offset, BlockSize>;
 
-template<class T>
-ROCPRIM_DEVICE ROCPRIM_INLINE
-auto compare_nan_sensitive(const T& a, const T& b)
-    -> typename std::enable_if<!rocprim::is_floating_point<T>::value, bool>::type
-{
-    return a > b;
-}
+    ROCPRIM_SHARED_MEMORY union
+    {
+        typename count_helper_type::storage_type count;
+        typename scan_type::storage_type scan;
+        typename sort_and_scatter_helper::storage_type sort;
+    } storage;
+    ROCPRIM_SHARED_MEMORY unsigned int is_uniform;
 
-template<
-    bool Descending,
-    bool UseRadixMask,
-    class T,
-    class Enable = void
->
-struct radix_merge_compare;
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int batch_id = ::rocprim::detail::block_id<0>();
+    const unsigned int batches = ::rocprim::detail::grid_size<0>();
+    const bool is_last_batch = batch_id == batches - 1;
 
-template<class T>
-struct radix_merge_compare<false, false, T>
-{
-    ROCPRIM_DEVICE ROCPRIM_INLINE
-    bool operator()(const T& a, const T& b) const
+    unsigned int blocks_per_batch;
+    const Offset batch_begin = radix_sort_batch_offset<items_per_block, Offset>(
+        batch_id, blocks_per_full_batch, full_batches, blocks_per_batch);
+    const Offset batch_end
+        = is_last_batch ? size : batch_begin + blocks_per_batch * items_per_block;
+
+    const auto count_digits = [&](auto keys,
+                                  const unsigned int bit,
+                                  const unsigned int current_radix_bits,
+                                  unsigned int& digit_count)
     {
-        return compare_nan_sensitive<T>(b, a);
-    }
-};
+        if(is_last_batch)
+        {
+            count_helper_type().template count_digits<false>(
+                keys, batch_begin, batch_end, bit, current_radix_bits, storage.count, digit_count);
+        }
+        else
+        {
+            count_helper_type().template count_digits<true>(
+                keys, batch_begin, batch_end, bit, current_radix_bits, storage.count, digit_count);
+        }
+    };
+    const auto sort_and_scatter = [&](auto keys_in,
+                                      auto keys_out,
+                                      auto values_in,
+                                      auto values_out,
+                                      const unsigned int bit,
+                                      const unsigned int current_radix_bits,
+                                      const Offset digit_start)
+    {
+        if(is_last_batch)
+        {
+            sort_and_scatter_helper().template sort_and_scatter<false>(
+                keys_in, keys_out, values_in, values_out,
+                batch_begin, batch_end,
+                bit, current_radix_bits,
+                digit_start,
+                storage.sort
+            );
+        }
+        else
+        {
+            sort_and_scatter_helper().template sort_and_scatter<true>(
+                keys_in, keys_out, values_in, values_out,
+                batch_begin, batch_end,
+                bit, current_radix_bits,
+                digit_start,
+                storage.sort
+            );
+        }
+    };
 
-template<class T>
-struct radix_merge_compare<true, false, T>
-{
-    ROCPRIM_DEVICE ROCPRIM_INLINE
-    bool operator()(const T& a, const T& b) const
+    enum class buffer
     {
-        return compare_nan_sensitive<T>(a, b);
-    }
+        input,
+        tmp,
+        output
+    };
+    buffer source = buffer::input;
+    unsigned int passes = 0;
+    for(unsigned int bit = begin_bit; bit < end_bit; bit += RadixBits)
+    {
+        const unsigned int current_radix_bits = ::rocprim::min(RadixBits, end_bit - bit);
+
+        unsigned int digit_count;
+        if(source == buffer::input)
+        {
+            count_digits(keys_input, bit, current_radix_bits, digit_count);
+        }
+        else if(source == buffer::tmp)
+        {
+            count_digits(keys_tmp, bit, current_radix_bits, digit_count);
+        }
+        else
+        {
+            count_digits(keys_output, bit, current_radix_bits, digit_count);
+        }
+        if(flat_id < radix_size)
+        {
+            batch_digit_counts[batch_id * radix_size + flat_id] = digit_count;
+        }
+        barrier.sync();
+
+        // The counts of a digit are scanned over the batches by one block
+        for(unsigned int digit = batch_id; digit < radix_size; digit += batches)
+        {
+            Offset values[ScanItemsPerThread];
+            for(unsigned int i = 0; i < ScanItemsPerThread; i++)
+            {
+                const unsigned int batch = flat_id * ScanItemsPerThread + i;
+                values[i] = (batch < batches ? batch_digit_counts[batch * radix_size + digit] : 0);
+            }
+
+            Offset digit_total;
+            scan_type().exclusive_scan(values, values, Offset(0), digit_total, storage.scan);
+
+            for(unsigned int i = 0; i < ScanItemsPerThread; i++)
+            {
+                const unsigned int batch = flat_id * ScanItemsPerThread + i;
+                if(batch < batches)
+                {
+                    batch_digit_counts[batch * radix_size + digit] = values[i];
+                }
+            }
+            if(flat_id == 0)
+            {
+                digit_counts[digit] = digit_total;
+            }
+            // The storage of the block scan is reused by the next digit
+            ::rocprim::syncthreads();
+        }
+        barrier.sync();
+
+        // Every block reads the same totals, so all blocks skip the same passes
+        const Offset digit_total = flat_id < radix_size ? digit_counts[flat_id] : 0;
+        if(flat_id == 0)
+        {
+            is_uniform = 0;
+        }
+        ::rocprim::syncthreads();
+        if(digit_total == size)
+        {
+            is_uniform = 1;
+        }
+        Offset digit_start;
+        scan_type().exclusive_scan(digit_total, digit_start, Offset(0), storage.scan);
+        ::rocprim::syncthreads();
+        if(is_uniform != 0)
+        {
+            continue;
+        }
+        if(flat_id < radix_size)
+        {
+            digit_start += batch_digit_counts[batch_id * radix_size + flat_id];
+        }
+
+        if(source == buffer::input)
+        {
+            if(first_to_output)
+            {
+                sort_and_scatter(keys_input, keys_output, values_input, values_output,
+                                 bit, current_radix_bits, digit_start);
+                source = buffer::output;
+            }
+            else
+            {
+                sort_and_scatter(keys_input, keys_tmp, values_input, values_tmp,
+                                 bit, current_radix_bits, digit_start);
+                source = buffer::tmp;
+            }
+        }
+        else if(source == buffer::tmp)
+        {
+            sort_and_scatter(keys_tmp, keys_output, values_tmp, values_output,
+                             bit, current_radix_bits, digit_start);
+            source = buffer::output;
+        }
+        else
+        {
+            sort_and_scatter(keys_output, keys_tmp, values_output, values_tmp,
+                             bit, current_radix_bits, digit_start);
+            source = buffer::tmp;
+        }
+        passes++;
+        barrier.sync();
+    }
+
+    // Every block copies its own batch
+    const auto copy_to_output = [&](auto keys, auto values)
+    {
+        for(Offset i = batch_begin + flat_id; i < batch_end; i += BlockSize)
+        {
+            keys_output[i] = keys[i];
+            if(with_values)
+            {
+                values_output[i] = values[i];
+            }
+        }
+    };
+    if(source == buffer::input)
+    {
+        copy_to_output(keys_input, values_input);
+    }
+    else if(source == buffer::tmp)
+    {
+        copy_to_output(keys_tmp, values_tmp);
+    }
+
+    if(batch_id == 0 && flat_id == 0)
+    {
+        *executed_passes = passes;
+    }
+}
+
+// Compares the keys of a tile loaded in the striped arrangement with their predecessors in
+// the input. not_ascending is set if a key goes before its predecessor, not_descending if a key
+// does not go before its predecessor, so the input is sorted if no key sets the first flag and
+// strictly reverse sorted if no key sets the second one. The predecessors are shuffled from
+// the previous lanes, only the first lane of a warp loads its predecessor.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class KeyCodec,
+         class KeysInputIterator,
+         class Key,
+         class Offset>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void check_striped_keys_order(KeysInputIterator  keys_input,
+                              const Key (&keys)[ItemsPerThread],
+                              const Offset       block_offset,
+                              const unsigned int valid_count,
+                              const unsigned int begin_bit,
+                              const unsigned int end_bit,
+                              bool&              not_ascending,
+                              bool&              not_descending)
+{
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int lane_id = ::rocprim::lane_id();
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        // All lanes take part in the shuffle, the keys of invalid items are not used
+        const Key previous_lane_key = ::rocprim::warp_shuffle_up(keys[i], 1);
+
+        const unsigned int index = i * BlockSize + flat_id;
+        if(index < valid_count && (block_offset != 0 || index != 0))
+        {
+            const Key previous_key = lane_id == 0
+                                         ? static_cast<Key>(keys_input[block_offset + index - 1])
+                                         : previous_lane_key;
+            if(radix_key_is_before<KeyCodec>(keys[i], previous_key, begin_bit, end_bit))
+            {
+                not_ascending = true;
+            }
+            else
+            {
+                not_descending = true;
+            }
+        }
+    }
+}
+
+// Onesweep radix sort was implemented based on:
+// Adinets, A. and Merrill, D. Onesweep: A Faster Least Significant Digit Radix Sort for GPUs.
+// arXiv:2206.01784. Jun. 2022.
+
+// Atomically adds to a global digit counter of either 32-bit or 64-bit offset type.
+template<class Offset>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void onesweep_atomic_add(Offset* address, const Offset value)
+{
+    static_assert(sizeof(Offset) == 4 || sizeof(Offset) == 8, "Offset must be 32-bit or 64-bit");
+    using atomic_type = typename std::
+        conditional<sizeof(Offset) == 4, unsigned int, unsigned long long>::type;
+    ::rocprim::detail::atomic_add(reinterpret_cast<atomic_type*>(address),
+                                  static_cast<atomic_type>(value));
+}
+
+// Records the order flags of a block in order_flags, which must be zeroed before the launch:
+// order_flags[0] is set to 1 if the keys are not sorted, order_flags[1] if they are
+// not strictly reverse sorted.
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void store_keys_order_flags(unsigned int* order_flags,
+                            const bool    not_ascending,
+                            const bool    not_descending)
+{
+    ROCPRIM_SHARED_MEMORY unsigned int block_order_flags[2];
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    if(flat_id < 2)
+    {
+        block_order_flags[flat_id] = 0;
+    }
+    ::rocprim::syncthreads();
+    if(not_ascending)
+    {
+        block_order_flags[0] = 1;
+    }
+    if(not_descending)
+    {
+        block_order_flags[1] = 1;
+    }
+    ::rocprim::syncthreads();
+    if(flat_id < 2 && block_order_flags[flat_id] != 0)
+    {
+        order_flags[flat_id] = 1;
+    }
+}
+
+// Tracks the minimum and the maximum of the bit keys of a thread, the range of all keys is
+// recorded in key_range: key_range[0] must be set to all ones and key_range[1] to 0 before
+// the launch. The disabled tracker does nothing, so it accepts bit keys of any type.
+template<class BitKey, bool Enabled>
+struct radix_bit_keys_range
+{
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void update(const BitKey& /* bit_key */)
+    {}
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store(unsigned long long* /* key_range */)
+    {}
+};
+
+template<class BitKey>
+struct radix_bit_keys_range<BitKey, true>
+{
+    unsigned long long min_bit_key = ~0ull;
+    unsigned long long max_bit_key = 0;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void update(const BitKey& bit_key)
+    {
+        min_bit_key = ::rocprim::min(min_bit_key, static_cast<unsigned long long>(bit_key));
+        max_bit_key = ::rocprim::max(max_bit_key, static_cast<unsigned long long>(bit_key));
+    }
+
+    // The range of the block is reduced in shared memory, so there are two global atomics
+    // per block
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store(unsigned long long* key_range)
+    {
+        ROCPRIM_SHARED_MEMORY unsigned long long block_key_range[2];
+
+        const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+        if(flat_id == 0)
+        {
+            block_key_range[0] = ~0ull;
+            block_key_range[1] = 0;
+        }
+        ::rocprim::syncthreads();
+        ::rocprim::detail::atomic_min(&block_key_range[0], min_bit_key);
+        ::rocprim::detail::atomic_max(&block_key_range[1], max_bit_key);
+        ::rocprim::syncthreads();
+        if(flat_id == 0)
+        {
+            ::rocprim::detail::atomic_min(&key_range[0], block_key_range[0]);
+            ::rocprim::detail::atomic_max(&key_range[1], block_key_range[1]);
+        }
+    }
+};
+
+// Counts the digits of all iterations in a single pass over the keys. The counts of
+// the i-th iteration are accumulated in digit_counts[i * radix_size, (i + 1) * radix_size).
+// If CheckOrder is true, the order of the keys is recorded in order_flags in the same pass,
+// see store_keys_order_flags. If FindRange is true, the range of the bit keys is recorded in
+// key_range, see radix_bit_keys_range.
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int RadixBits,
+    bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
+    bool CheckOrder,
+    bool FindRange,
+    class KeysInputIterator,
+    class Offset
+>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void onesweep_histograms(KeysInputIterator keys_input,
+                         Offset * digit_counts,
+                         unsigned int * order_flags,
+                         unsigned long long * key_range,
+                         const Offset size,
+                         const unsigned int begin_bit,
+                         const unsigned int end_bit)
+{
+    constexpr unsigned int radix_size = 1 << RadixBits;
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using key_codec = radix_key_codec<key_type, Descending, FloatOrder, Decomposer>;
+    using bit_key_type = typename key_codec::bit_key_type;
+
+    constexpr unsigned int max_iterations
+        = ::rocprim::detail::ceiling_div(key_codec::key_bits, RadixBits);
+
+    ROCPRIM_SHARED_MEMORY unsigned int histograms[max_iterations * radix_size];
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int flat_block_id = ::rocprim::detail::block_id<0>();
+    const unsigned int number_of_blocks = ::rocprim::detail::grid_size<0>();
+    const unsigned int iterations = ::rocprim::detail::ceiling_div(end_bit - begin_bit, RadixBits);
+
+    for(unsigned int i = flat_id; i < iterations * radix_size; i += BlockSize)
+    {
+        histograms[i] = 0;
+    }
+    ::rocprim::syncthreads();
+
+    bool not_ascending  = false;
+    bool not_descending = false;
+
+    radix_bit_keys_range<bit_key_type, FindRange> range;
+
+    for(Offset block_offset = static_cast<Offset>(flat_block_id) * items_per_block;
+        block_offset < size;
+        block_offset += static_cast<Offset>(number_of_blocks) * items_per_block)
+    {
+        key_type keys[ItemsPerThread];
+        // Use loading into a striped arrangement because an order of items is irrelevant,
+        // only totals matter
+        const bool is_full_block = block_offset + items_per_block <= size;
+        const unsigned int valid_count
+            = is_full_block ? items_per_block : static_cast<unsigned int>(size - block_offset);
+        if(is_full_block)
+        {
+            block_load_direct_striped<BlockSize>(flat_id, keys_input + block_offset, keys);
+        }
+        else
+        {
+            block_load_direct_striped<BlockSize>(flat_id, keys_input + block_offset, keys, valid_count);
+        }
+
+        if(CheckOrder)
+        {
+            check_striped_keys_order<BlockSize, ItemsPerThread, key_codec>(keys_input,
+                                                                           keys,
+                                                                           block_offset,
+                                                                           valid_count,
+                                                                           begin_bit,
+                                                                           end_bit,
+                                                                           not_ascending,
+                                                                           not_descending);
+        }
+
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            if(i * BlockSize + flat_id < valid_count)
+            {
+                const bit_key_type bit_key = key_codec::encode(keys[i]);
+                range.update(bit_key);
+                for(unsigned int iteration = 0; iteration < iterations; iteration++)
+                {
+                    const unsigned int bit = begin_bit + iteration * RadixBits;
+                    const unsigned int current_radix_bits = ::rocprim::min(RadixBits, end_bit - bit);
+                    const unsigned int digit
+                        = key_codec::extract_digit(bit_key, bit, current_radix_bits);
+                    ::rocprim::detail::atomic_add(&histograms[iteration * radix_size + digit], 1u);
+                }
+            }
+        }
+    }
+    ::rocprim::syncthreads();
+
+    for(unsigned int i = flat_id; i < iterations * radix_size; i += BlockSize)
+    {
+        const unsigned int count = histograms[i];
+        if(count != 0)
+        {
+            onesweep_atomic_add(&digit_counts[i], static_cast<Offset>(count));
+        }
+    }
+
+    if(CheckOrder)
+    {
+        store_keys_order_flags(order_flags, not_ascending, not_descending);
+    }
+    range.store(key_range);
+}
+
+// Scans the digit counts of one iteration. The iteration needs no pass over the keys if all keys
+// have the same digit, nonuniform_digits[iteration] is set to 0 in this case and to 1 otherwise.
+template<unsigned int RadixBits, class Offset>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void onesweep_scan_histograms(Offset * digit_counts,
+                              unsigned int * nonuniform_digits,
+                              const Offset size)
+{
+    constexpr unsigned int radix_size = 1 << RadixBits;
+
+    ROCPRIM_SHARED_MEMORY unsigned int is_uniform;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int iteration = ::rocprim::detail::block_id<0>();
+
+    if(flat_id == 0)
+    {
+        is_uniform = 0;
+    }
+    ::rocprim::syncthreads();
+    if(digit_counts[iteration * radix_size + flat_id] == size)
+    {
+        is_uniform = 1;
+    }
+    ::rocprim::syncthreads();
+    if(flat_id == 0)
+    {
+        nonuniform_digits[iteration] = is_uniform == 0;
+    }
+
+    scan_digits<RadixBits>(digit_counts + iteration * radix_size);
+}
+
+// Finds the iterations in which not all keys have the same digit: nonuniform_digits[i] is set to 1
+// if the digits of the i-th iteration differ, it must be zeroed before the launch. The first
+// long_iterations iterations sort LongRadixBits bits and the following ones ShortRadixBits bits.
+// If CheckOrder is true, the order of the keys is recorded in order_flags in the same pass,
+// see store_keys_order_flags. If FindRange is true, the range of the bit keys is recorded in
+// key_range, see radix_bit_keys_range.
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int LongRadixBits,
+    unsigned int ShortRadixBits,
+    bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
+    bool CheckOrder,
+    bool FindRange,
+    class KeysInputIterator,
+    class Offset
+>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void find_nonuniform_digits(KeysInputIterator keys_input,
+                            unsigned int * nonuniform_digits,
+                            unsigned int * order_flags,
+                            unsigned long long * key_range,
+                            const Offset size,
+                            const unsigned int begin_bit,
+                            const unsigned int end_bit,
+                            const unsigned int long_iterations,
+                            const unsigned int iterations)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using key_codec = radix_key_codec<key_type, Descending, FloatOrder, Decomposer>;
+    using bit_key_type = typename key_codec::bit_key_type;
+
+    constexpr unsigned int max_iterations
+        = ::rocprim::detail::ceiling_div(key_codec::key_bits, ShortRadixBits);
+
+    ROCPRIM_SHARED_MEMORY unsigned int block_nonuniform_digits[max_iterations];
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int flat_block_id = ::rocprim::detail::block_id<0>();
+    const unsigned int number_of_blocks = ::rocprim::detail::grid_size<0>();
+
+    for(unsigned int i = flat_id; i < iterations; i += BlockSize)
+    {
+        block_nonuniform_digits[i] = 0;
+    }
+    ::rocprim::syncthreads();
+
+    // Digits of all keys are compared with digits of the first key
+    const bit_key_type first_bit_key = key_codec::encode(keys_input[0]);
+
+    bool not_ascending  = false;
+    bool not_descending = false;
+
+    radix_bit_keys_range<bit_key_type, FindRange> range;
+
+    for(Offset block_offset = static_cast<Offset>(flat_block_id) * items_per_block;
+        block_offset < size;
+        block_offset += static_cast<Offset>(number_of_blocks) * items_per_block)
+    {
+        key_type keys[ItemsPerThread];
+        const bool is_full_block = block_offset + items_per_block <= size;
+        const unsigned int valid_count
+            = is_full_block ? items_per_block : static_cast<unsigned int>(size - block_offset);
+        if(is_full_block)
+        {
+            block_load_direct_striped<BlockSize>(flat_id, keys_input + block_offset, keys);
+        }
+        else
+        {
+            block_load_direct_striped<BlockSize>(flat_id, keys_input + block_offset, keys, valid_count);
+        }
+
+        if(CheckOrder)
+        {
+            check_striped_keys_order<BlockSize, ItemsPerThread, key_codec>(keys_input,
+                                                                           keys,
+                                                                           block_offset,
+                                                                           valid_count,
+                                                                           begin_bit,
+                                                                           end_bit,
+                                                                           not_ascending,
+                                                                           not_descending);
+        }
+
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            if(i * BlockSize + flat_id < valid_count)
+            {
+                const bit_key_type bit_key = key_codec::encode(keys[i]);
+                range.update(bit_key);
+                unsigned int bit = begin_bit;
+                for(unsigned int iteration = 0; iteration < iterations; iteration++)
+                {
+                    const unsigned int radix_bits
+                        = iteration < long_iterations ? LongRadixBits : ShortRadixBits;
+                    const unsigned int current_radix_bits = ::rocprim::min(radix_bits, end_bit - bit);
+                    if(key_codec::extract_digit(bit_key, bit, current_radix_bits)
+                       != key_codec::extract_digit(first_bit_key, bit, current_radix_bits))
+                    {
+                        block_nonuniform_digits[iteration] = 1;
+                    }
+                    bit += radix_bits;
+                }
+            }
+        }
+    }
+    ::rocprim::syncthreads();
+
+    for(unsigned int i = flat_id; i < iterations; i += BlockSize)
+    {
+        if(block_nonuniform_digits[i] != 0)
+        {
+            nonuniform_digits[i] = 1;
+        }
+    }
+
+    if(CheckOrder)
+    {
+        store_keys_order_flags(order_flags, not_ascending, not_descending);
+    }
+    range.store(key_range);
+}
+
+// Counting sort of keys whose sorted bits are the whole key: the keys are counted per value and
+// the sorted keys are written as runs of the values, so the keys are not scattered.
+
+// Counts the keys of every bit key in counts, which must be zeroed before the launch. Keys of up
+// to 8 bits are counted in shared memory first. Wider keys are counted by global atomics, equal
+// consecutive keys of a thread are counted by one atomic.
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    bool Descending,
+    class KeysInputIterator,
+    class Offset
+>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void counting_sort_histogram(KeysInputIterator keys_input,
+                             Offset * counts,
+                             const Offset size)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using key_codec = radix_key_codec<key_type, Descending>;
+
+    constexpr unsigned int bins = 1u << key_codec::key_bits;
+    constexpr bool shared_counts = key_codec::key_bits <= 8;
+
+    ROCPRIM_SHARED_MEMORY unsigned int block_counts[shared_counts ? bins : 1];
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int flat_block_id = ::rocprim::detail::block_id<0>();
+    const unsigned int number_of_blocks = ::rocprim::detail::grid_size<0>();
+
+    if(shared_counts)
+    {
+        for(unsigned int i = flat_id; i < bins; i += BlockSize)
+        {
+            block_counts[i] = 0;
+        }
+        ::rocprim::syncthreads();
+    }
+
+    for(Offset block_offset = static_cast<Offset>(flat_block_id) * items_per_block;
+        block_offset < size;
+        block_offset += static_cast<Offset>(number_of_blocks) * items_per_block)
+    {
+        key_type keys[ItemsPerThread];
+        // The blocked arrangement keeps the equal consecutive keys of the input in one thread
+        const bool is_full_block = block_offset + items_per_block <= size;
+        const unsigned int valid_count
+            = is_full_block ? items_per_block : static_cast<unsigned int>(size - block_offset);
+        if(is_full_block)
+        {
+            block_load_direct_blocked(flat_id, keys_input + block_offset, keys);
+        }
+        else
+        {
+            block_load_direct_blocked(flat_id, keys_input + block_offset, keys, valid_count);
+        }
+
+        unsigned int run_bin = 0;
+        unsigned int run_count = 0;
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            if(flat_id * ItemsPerThread + i < valid_count)
+            {
+                const unsigned int bin = key_codec::encode(keys[i]);
+                if(shared_counts)
+                {
+                    ::rocprim::detail::atomic_add(&block_counts[bin], 1u);
+                }
+                else
+                {
+                    if(run_count != 0 && bin != run_bin)
+                    {
+                        onesweep_atomic_add(&counts[run_bin], static_cast<Offset>(run_count));
+                        run_count = 0;
+                    }
+                    run_bin = bin;
+                    run_count++;
+                }
+            }
+        }
+        if(run_count != 0)
+        {
+            onesweep_atomic_add(&counts[run_bin], static_cast<Offset>(run_count));
+        }
+    }
+
+    if(shared_counts)
+    {
+        ::rocprim::syncthreads();
+        for(unsigned int i = flat_id; i < bins; i += BlockSize)
+        {
+            const unsigned int count = block_counts[i];
+            if(count != 0)
+            {
+                onesweep_atomic_add(&counts[i], static_cast<Offset>(count));
+            }
+        }
+    }
+}
+
+// Returns the first bin in [first, last) whose end is after position
+template<class Offset>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+unsigned int counting_sort_find_bin(const Offset * bin_ends,
+                                    unsigned int first,
+                                    unsigned int last,
+                                    const Offset position)
+{
+    while(first < last)
+    {
+        const unsigned int mid = first + (last - first) / 2;
+        if(bin_ends[mid] <= position)
+        {
+            first = mid + 1;
+        }
+        else
+        {
+            last = mid;
+        }
+    }
+    return first;
+}
+
+// Writes the sorted keys as runs of the values of the bins, bin_ends is the inclusive scan of
+// the counts. The keys of a thread are consecutive, so the bin of every key is searched only
+// after the end of the bin of the previous key. The ends of up to 8-bit keys are searched in
+// shared memory.
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    bool Descending,
+    class Key,
+    class KeysOutputIterator,
+    class Offset
+>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void counting_sort_write_runs(const Offset * bin_ends,
+                              KeysOutputIterator keys_output,
+                              const Offset size)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    using key_codec = radix_key_codec<Key, Descending>;
+    using bit_key_type = typename key_codec::bit_key_type;
+    using block_store_type = ::rocprim::block_store<Key, BlockSize, ItemsPerThread,
+                                                    block_store_method::block_store_transpose>;
+
+    constexpr unsigned int bins = 1u << key_codec::key_bits;
+    constexpr bool shared_ends = key_codec::key_bits <= 8;
+
+    ROCPRIM_SHARED_MEMORY Offset block_bin_ends[shared_ends ? bins : 1];
+    ROCPRIM_SHARED_MEMORY typename block_store_type::storage_type store_storage;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int flat_block_id = ::rocprim::detail::block_id<0>();
+    const unsigned int number_of_blocks = ::rocprim::detail::grid_size<0>();
+
+    const Offset * ends = bin_ends;
+    if(shared_ends)
+    {
+        for(unsigned int i = flat_id; i < bins; i += BlockSize)
+        {
+            block_bin_ends[i] = bin_ends[i];
+        }
+        ::rocprim::syncthreads();
+        ends = block_bin_ends;
+    }
+
+    for(Offset block_offset = static_cast<Offset>(flat_block_id) * items_per_block;
+        block_offset < size;
+        block_offset += static_cast<Offset>(number_of_blocks) * items_per_block)
+    {
+        const Offset thread_offset = block_offset + flat_id * ItemsPerThread;
+
+        Key keys[ItemsPerThread];
+        unsigned int bin = 0;
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            const Offset position = thread_offset + i;
+            if(position < size && ends[bin] <= position)
+            {
+                bin = counting_sort_find_bin(ends, bin + 1, bins, position);
+            }
+            keys[i] = key_codec::decode(static_cast<bit_key_type>(bin));
+        }
+
+        if(block_offset + items_per_block <= size)
+        {
+            block_store_type().store(keys_output + block_offset, keys, store_storage);
+        }
+        else
+        {
+            block_store_type().store(keys_output + block_offset,
+                                     keys,
+                                     static_cast<unsigned int>(size - block_offset),
+                                     store_storage);
+        }
+        ::rocprim::syncthreads();
+    }
+}
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int RadixBits,
+    bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
+    class Key,
+    class Value,
+    class Offset,
+    unsigned int ScatterRunLength = 0
+>
+struct radix_onesweep_helper
+{
+    static constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    static constexpr unsigned int radix_size = 1 << RadixBits;
+
+    using key_type = Key;
+    using value_type = Value;
+
+    using key_codec = radix_key_codec<key_type, Descending, FloatOrder, Decomposer>;
+    using bit_key_type = typename key_codec::bit_key_type;
+    using keys_load_type = ::rocprim::block_load<
+        key_type, BlockSize, ItemsPerThread,
+        ::rocprim::block_load_method::block_load_transpose>;
+    using values_load_type = ::rocprim::block_load<
+        value_type, BlockSize, ItemsPerThread,
+        ::rocprim::block_load_method::block_load_transpose>;
+    using sort_type = ::rocprim::block_radix_sort<key_type, BlockSize, ItemsPerThread, value_type, 1, 1, FloatOrder, Decomposer, block_radix_sort_bits_per_pass>;
+    using discontinuity_type = ::rocprim::block_discontinuity<unsigned int, BlockSize>;
+    using bit_keys_exchange_type = ::rocprim::block_exchange<bit_key_type, BlockSize, ItemsPerThread>;
+    using values_exchange_type = ::rocprim::block_exchange<value_type, BlockSize, ItemsPerThread>;
+    using ordered_bid_type = ordered_block_id<unsigned int>;
+    using scatter_type = radix_write_combining_scatter<
+        BlockSize, ItemsPerThread, RadixBits, ::rocprim::max(ScatterRunLength, 1u),
+        key_codec, value_type, Offset>;
+
+    static constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+    static constexpr bool write_combining = ScatterRunLength > 0;
+
+    static_assert(items_per_block <= std::numeric_limits<unsigned short>::max(),
+                  "Items per block must fit in unsigned short");
+    static_assert(radix_size <= BlockSize, "Radix size must not exceed BlockSize");
+
+    struct storage_type
+    {
+        typename ordered_bid_type::storage_type ordered_bid;
+        union
+        {
+            typename keys_load_type::storage_type keys_load;
+            typename values_load_type::storage_type values_load;
+            typename sort_type::storage_type sort;
+            typename discontinuity_type::storage_type discontinuity;
+            typename bit_keys_exchange_type::storage_type bit_keys_exchange;
+            typename values_exchange_type::storage_type values_exchange;
+            typename radix_scatter_storage<write_combining, scatter_type>::type scatter;
+        };
+
+        unsigned short starts[radix_size];
+        unsigned short ends[radix_size];
+
+        Offset digit_starts[radix_size];
+    };
+
+    // Writes the sorted tile, the items are in the blocked arrangement
+    template<class KeysOutputIterator, class ValuesOutputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void scatter_tile(std::false_type /* write_combining */,
+                      bit_key_type (&bit_keys)[ItemsPerThread],
+                      value_type (&values)[ItemsPerThread],
+                      const unsigned int valid_count,
+                      const unsigned int bit,
+                      const unsigned int current_radix_bits,
+                      KeysOutputIterator keys_output,
+                      ValuesOutputIterator values_output,
+                      storage_type& storage)
+    {
+        const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+
+        // Rearrange to striped arrangement to have faster coalesced writes instead of
+        // scattering of blocked-arranged items
+        bit_keys_exchange_type().blocked_to_striped(bit_keys, bit_keys, storage.bit_keys_exchange);
+        if(with_values)
+        {
+            ::rocprim::syncthreads();
+            values_exchange_type().blocked_to_striped(values, values, storage.values_exchange);
+        }
+        ::rocprim::syncthreads();
+
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            const unsigned int digit = key_codec::extract_digit(bit_keys[i], bit, current_radix_bits);
+            const unsigned int pos = i * BlockSize + flat_id;
+            if(pos < valid_count)
+            {
+                const Offset dst = pos - storage.starts[digit] + storage.digit_starts[digit];
+                keys_output[dst] = key_codec::decode(bit_keys[i]);
+                if(with_values)
+                {
+                    values_output[dst] = values[i];
+                }
+            }
+        }
+    }
+
+    template<class KeysOutputIterator, class ValuesOutputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void scatter_tile(std::true_type /* write_combining */,
+                      bit_key_type (&bit_keys)[ItemsPerThread],
+                      value_type (&values)[ItemsPerThread],
+                      const unsigned int valid_count,
+                      const unsigned int bit,
+                      const unsigned int current_radix_bits,
+                      KeysOutputIterator keys_output,
+                      ValuesOutputIterator values_output,
+                      storage_type& storage)
+    {
+        scatter_type().scatter(bit_keys, values, valid_count,
+                               storage.starts, storage.ends, storage.digit_starts,
+                               bit, current_radix_bits,
+                               keys_output, values_output, storage.scatter);
+    }
+
+    template<
+        class KeysInputIterator,
+        class KeysOutputIterator,
+        class ValuesInputIterator,
+        class ValuesOutputIterator,
+        class LookbackScanState
+    >
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort_and_scatter(KeysInputIterator keys_input,
+                          KeysOutputIterator keys_output,
+                          ValuesInputIterator values_input,
+                          ValuesOutputIterator values_output,
+                          const Offset size,
+                          const Offset * global_digit_starts,
+                          LookbackScanState lookback_states,
+                          ordered_bid_type ordered_bid,
+                          const unsigned int bit,
+                          const unsigned int current_radix_bits,
+                          storage_type& storage)
+    {
+        const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+        // Blocks must process tiles in the order they are scheduled, otherwise the look-back
+        // could wait for a block that is not resident yet.
+        const unsigned int flat_block_id = ordered_bid.get(flat_id, storage.ordered_bid);
+        const Offset block_offset = static_cast<Offset>(flat_block_id) * items_per_block;
+        const bool is_full_block = block_offset + items_per_block <= size;
+        const unsigned int valid_count
+            = is_full_block ? items_per_block : static_cast<unsigned int>(size - block_offset);
+
+        key_type keys[ItemsPerThread];
+        value_type values[ItemsPerThread];
+        if(is_full_block)
+        {
+            keys_load_type().load(keys_input + block_offset, keys, storage.keys_load);
+            if(with_values)
+            {
+                ::rocprim::syncthreads();
+                values_load_type().load(values_input + block_offset, values, storage.values_load);
+            }
+        }
+        else
+        {
+            // Sort will leave "invalid" (out of size) items at the end of the sorted sequence
+            const key_type out_of_bounds = key_codec::get_out_of_bounds_key();
+            keys_load_type().load(keys_input + block_offset, keys, valid_count, out_of_bounds, storage.keys_load);
+            if(with_values)
+            {
+                ::rocprim::syncthreads();
+                values_load_type().load(values_input + block_offset, values, valid_count, storage.values_load);
+            }
+        }
+
+        if(flat_id < radix_size)
+        {
+            storage.starts[flat_id] = valid_count;
+            storage.ends[flat_id] = valid_count;
+        }
+
+        ::rocprim::syncthreads();
+        sort_block<Descending>(sort_type(), keys, values, storage.sort, bit, bit + current_radix_bits);
+
+        bit_key_type bit_keys[ItemsPerThread];
+        unsigned int digits[ItemsPerThread];
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            bit_keys[i] = key_codec::encode(keys[i]);
+            digits[i] = key_codec::extract_digit(bit_keys[i], bit, current_radix_bits);
+        }
+
+        bool head_flags[ItemsPerThread];
+        bool tail_flags[ItemsPerThread];
+        ::rocprim::not_equal_to<unsigned int> flag_op;
+
+        ::rocprim::syncthreads();
+        discontinuity_type().flag_heads_and_tails(head_flags, tail_flags, digits, flag_op, storage.discontinuity);
+
+        // Fill start and end position of subsequence for every digit
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            const unsigned int digit = digits[i];
+            const unsigned int pos = flat_id * ItemsPerThread + i;
+            if(head_flags[i])
+            {
+                storage.starts[digit] = pos;
+            }
+            if(tail_flags[i])
+            {
+                storage.ends[digit] = pos;
+            }
+        }
+        ::rocprim::syncthreads();
+
+        // Decoupled look-back: the i-th thread computes the global offset of the i-th digit
+        // by accumulating the counts of this digit in all preceding blocks.
+        if(flat_id < radix_size)
+        {
+            using flag_type = typename LookbackScanState::flag_type;
+
+            const unsigned int digit = flat_id;
+            const unsigned int start = storage.starts[digit];
+            const unsigned int end = storage.ends[digit];
+            const Offset count = start < valid_count
+                ? static_cast<Offset>(::rocprim::min(valid_count - 1, end) - start + 1)
+                : Offset(0);
+
+            Offset prefix = 0;
+            if(flat_block_id == 0)
+            {
+                lookback_states.set_complete(digit, count);
+            }
+            else
+            {
+                lookback_states.set_partial(flat_block_id * radix_size + digit, count);
+
+                unsigned int look_block_id = flat_block_id;
+                flag_type flag;
+                do
+                {
+                    --look_block_id;
+                    Offset value;
+                    lookback_states.get(look_block_id * radix_size + digit, flag, value);
+                    prefix += value;
+                }
+                while(flag != PREFIX_COMPLETE && look_block_id > 0);
+
+                lookback_states.set_complete(flat_block_id * radix_size + digit, prefix + count);
+            }
+            storage.digit_starts[digit] = global_digit_starts[digit] + prefix;
+        }
+
+        scatter_tile(std::integral_constant<bool, write_combining>(),
+                     bit_keys, values, valid_count, bit, current_radix_bits,
+                     keys_output, values_output, storage);
+    }
 };
 
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int RadixBits,
+    bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
+    unsigned int ScatterRunLength,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class Offset,
+    class LookbackScanState
+>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void onesweep_iteration(KeysInputIterator keys_input,
+                        KeysOutputIterator keys_output,
+                        ValuesInputIterator values_input,
+                        ValuesOutputIterator values_output,
+                        const Offset size,
+                        const Offset * global_digit_starts,
+                        LookbackScanState lookback_states,
+                        ordered_block_id<unsigned int> ordered_bid,
+                        const unsigned int bit,
+                        const unsigned int current_radix_bits)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+
+    using onesweep_helper = radix_onesweep_helper<
+        BlockSize, ItemsPerThread, RadixBits, Descending, FloatOrder, Decomposer,
+        key_type, value_type, Offset, ScatterRunLength
+    >;
+
+    ROCPRIM_SHARED_MEMORY typename onesweep_helper::storage_type storage;
+
+    onesweep_helper().sort_and_scatter(
+        keys_input, keys_output, values_input, values_output,
+        size, global_digit_starts,
+        lookback_states, ordered_bid,
+        bit, current_radix_bits,
+        storage
+    );
+}
+
+template<class T>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+auto compare_nan_sensitive(const T& a, const T& b)
+    -> typename std::enable_if<rocprim::is_floating_point<T>::value, bool>::type
+{
+    // Beware: the performance of this function is extremely vulnerable to refactoring.
+    // Always check benchmark_device_segmented_radix_sort and benchmark_device_radix_sort
+    // when making changes to this function.
+
+    using bit_key_type = typename float_bit_mask<T>::bit_type;
+    static constexpr auto sign_bit = float_bit_mask<T>::sign_bit;
+    
+    auto a_bits = __builtin_bit_cast(bit_key_type, a);
+    auto b_bits = __builtin_bit_cast(bit_key_type, b);
+
+    // convert -0.0 to +0.0
+    a_bits = a_bits == sign_bit ? 0 : a_bits;
+    b_bits = b_bits == sign_bit ? 0 : b_bits;
+    // invert negatives, put 1 into sign bit for positives 
+    a_bits ^= (sign_bit & a_bits) == 0 ? sign_bit : bit_key_type(-1);
+    b_bits ^= (sign_bit & b_bits) == 0 ? sign_bit : bit_key_type(-1);
+
+    // sort numbers and NaNs according to their bit representation
+    return a_bits > b_bits;
+}
+
 template<class T>
-struct radix_merge_compare<false, true, T, typename std::enable_if<rocprim::is_integral<T>::value>::type>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+auto compare_nan_sensitive(const T& a, const T& b)
+    -> typename std::enable_if<!rocprim::is_floating_point<T>::value, bool>::type
+{
+    return a > b;
+}
+
+template<
+    bool Descending,
+    bool UseRadixMask,
+    class T,
+    radix_float_order Order = radix_float_order::signed_zeros_equal,
+    class Decomposer = ::rocprim::identity_decomposer,
+    class Enable = void
+>
+struct radix_merge_compare;
+
+template<class T, radix_float_order Order>
+struct radix_merge_compare<false, false, T, Order, ::rocprim::identity_decomposer,
+    typename std::enable_if<radix_key_order<T, Order>::value == radix_float_order::signed_zeros_equal>::type>
+{
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    bool operator()(const T& a, const T& b) const
+    {
+        return compare_nan_sensitive<T>(b, a);
+    }
+};
+
+template<class T, radix_float_order Order>
+struct radix_merge_compare<true, false, T, Order, ::rocprim::identity_decomposer,
+    typename std::enable_if<radix_key_order<T, Order>::value == radix_float_order::signed_zeros_equal>::type>
+{
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    bool operator()(const T& a, const T& b) const
+    {
+        return compare_nan_sensitive<T>(a, b);
+    }
+};
+
+// Other orders of floating-point keys are compared as their encodings
+template<bool Descending, class T, radix_float_order Order>
+struct radix_merge_compare<Descending, false, T, Order, ::rocprim::identity_decomposer,
+    typename std::enable_if<radix_key_order<T, Order>::value != radix_float_order::signed_zeros_equal>::type>
+{
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    bool operator()(const T& a, const T& b) const
+    {
+        return radix_key_is_before<radix_key_codec<T, Descending, Order>>(a, b);
+    }
+};
+
+// Decomposed keys are compared as their encodings, in the whole key or only in the sorted bits
+template<bool Descending, class T, radix_float_order Order, class Decomposer>
+struct radix_merge_compare<Descending, false, T, Order, Decomposer,
+    typename std::enable_if<!std::is_same<Decomposer, ::rocprim::identity_decomposer>::value>::type>
+{
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    bool operator()(const T& a, const T& b) const
+    {
+        return radix_key_is_before<radix_key_codec<T, Descending, Order, Decomposer>>(a, b);
+    }
+};
+
+template<bool Descending, class T, radix_float_order Order, class Decomposer>
+struct radix_merge_compare<Descending, true, T, Order, Decomposer,
+    typename std::enable_if<!std::is_same<Decomposer, ::rocprim::identity_decomposer>::value>::type>
+{
+    unsigned int begin_bit;
+    unsigned int end_bit;
+
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    radix_merge_compare(const unsigned int start_bit, const unsigned int current_radix_bits)
+        : begin_bit(start_bit), end_bit(start_bit + current_radix_bits)
+    {}
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    bool operator()(const T& a, const T& b) const
+    {
+        return radix_key_is_before<radix_key_codec<T, Descending, Order, Decomposer>>(a,
+                                                                                     b,
+                                                                                     begin_bit,
+                                                                                     end_bit);
+    }
+};
+
+template<class T, radix_float_order Order>
+struct radix_merge_compare<false, true, T, Order, ::rocprim::identity_decomposer, typename std::enable_if<rocprim::is_integral<T>::value>::type>
 {
     T radix_mask;
 
@@ -814,8 +2307,8 @@ struct radix_merge_compare<false, true, T, typename std::enable_if<rocprim::is_i
     }
 };
 
-template<class T>
-struct radix_merge_compare<true, true, T, typename std::enable_if<rocprim::is_integral<T>::value>::type>
+template<class T, radix_float_order Order>
+struct radix_merge_compare<true, true, T, Order, ::rocprim::identity_decomposer, typename std::enable_if<rocprim::is_integral<T>::value>::type>
 {
     T radix_mask;
 
@@ -836,10 +2329,12 @@ struct radix_merge_compare<true, true, T, typename std::enable_if<rocprim::is_in
     }
 };
 
-template<bool Descending, class T>
+template<bool Descending, class T, radix_float_order Order>
 struct radix_merge_compare<Descending,
                            true,
                            T,
+                           Order,
+                           ::rocprim::identity_decomposer,
                            typename std::enable_if<!rocprim::is_integral<T>::value>::type>
 {
     // radix_merge_compare supports masks only for integrals.
@@ -852,6 +2347,66 @@ struct radix_merge_compare<Descending,
     bool operator()(const T&, const T&) const { return false; }
 };
 
+// Pairs of keys and values of at most 32 bits each are sorted as 64-bit words: the encoded key
+// is stored in the upper half and the bits of the value in the lower half, so every pass scatters
+// one array instead of two. The values are below the sorted bits and the sort is stable, so equal
+// keys keep their order. -0.0 and +0.0 have different encodings, therefore floating-point keys
+// are packed only for radix_float_order::total_order.
+template<class Key, class Value, radix_float_order FloatOrder, class Decomposer>
+struct radix_sort_packs_pairs
+    : std::integral_constant<
+          bool,
+          std::is_same<Decomposer, ::rocprim::identity_decomposer>::value
+              && !std::is_same<Value, ::rocprim::empty_type>::value
+              && sizeof(Key) <= 4
+              && (sizeof(Value) == 1 || sizeof(Value) == 2 || sizeof(Value) == 4)
+              && std::is_trivially_copyable<Value>::value
+              && (!::rocprim::is_floating_point<Key>::value
+                  || FloatOrder == radix_float_order::total_order)>
+{};
+
+template<class Key, class Value, bool Descending, radix_float_order FloatOrder>
+struct radix_pair_packer
+{
+    using packed_type     = unsigned long long;
+    using codec           = radix_key_codec<Key, Descending, FloatOrder>;
+    using bit_key_type    = typename codec::bit_key_type;
+    using value_bits_type = typename ::rocprim::get_unsigned_bits_type<Value>::unsigned_type;
+
+    // Number of the lower bits which store the value
+    static constexpr unsigned int value_bits = 32;
+
+    struct pack_op
+    {
+        template<class Pair>
+        ROCPRIM_DEVICE ROCPRIM_INLINE
+        packed_type operator()(const Pair& pair) const
+        {
+            const Value       value      = ::rocprim::get<1>(pair);
+            const packed_type packed_key = codec::encode(::rocprim::get<0>(pair));
+            return (packed_key << value_bits) | __builtin_bit_cast(value_bits_type, value);
+        }
+    };
+
+    struct unpack_key_op
+    {
+        ROCPRIM_DEVICE ROCPRIM_INLINE
+        Key operator()(const packed_type packed) const
+        {
+            return codec::decode(static_cast<bit_key_type>(packed >> value_bits));
+        }
+    };
+
+    struct unpack_value_op
+    {
+        ROCPRIM_DEVICE ROCPRIM_INLINE
+        Value operator()(const packed_type packed) const
+        {
+            return __builtin_bit_cast(Value, static_cast<value_bits_type>(packed));
+        }
+    };
+};
+
 } // end namespace detail
 
 END_ROCPRIM_NAMESPACE
@@ -74,6 +74,126 @@ auto reduce_with_initial(T output,
     return output;
 }
 
+// Loads a full tile for a commutative reduction, the items of a thread may be in any order.
+// Pointers, also the pointers under a transform_iterator, are loaded as vectors striped across the
+// threads (see block_load_vector_striped), which keeps the loads coalesced.
+template<unsigned int BlockSize, class InputIterator, class T, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void load_commutative_tile(const unsigned int flat_id,
+                           InputIterator      tile_input,
+                           T (&items)[ItemsPerThread])
+{
+    // Only the input pointer can be unaligned, the tiles are multiples of the vectors
+    if(block_load_vector_striped<BlockSize>(flat_id, tile_input, items) == 0)
+    {
+        block_load_direct_striped<BlockSize>(flat_id, tile_input, items);
+    }
+}
+
+// Reduces the first valid items of a tile (valid <= BlockSize * ItemsPerThread), the result is
+// only valid in thread 0. Commutative operators load the items striped, other operators load
+// them blocked so every thread reduces contiguous items and the threads are reduced in order.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class BlockReduce,
+         class ResultType,
+         class InputIterator,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void reduce_tile(const unsigned int                flat_id,
+                 InputIterator                     tile_input,
+                 const unsigned int                valid,
+                 ResultType&                       output,
+                 typename BlockReduce::storage_type& storage,
+                 BinaryFunction                    reduce_op,
+                 std::true_type /*commutative*/)
+{
+    ResultType values[ItemsPerThread];
+    if(valid == BlockSize * ItemsPerThread)
+    {
+        load_commutative_tile<BlockSize>(flat_id, tile_input, values);
+        BlockReduce().reduce(values, output, storage, reduce_op);
+        return;
+    }
+
+    block_load_direct_striped_buffer<BlockSize>(flat_id, tile_input, values, valid);
+    output = values[0];
+    ROCPRIM_UNROLL
+    for(unsigned int i = 1; i < ItemsPerThread; i++)
+    {
+        if(flat_id + i * BlockSize < valid)
+        {
+            output = reduce_op(output, values[i]);
+        }
+    }
+    BlockReduce().reduce(output, output, ::rocprim::min(valid, BlockSize), storage, reduce_op);
+}
+
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class BlockReduce,
+         class ResultType,
+         class InputIterator,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void reduce_tile(const unsigned int                flat_id,
+                 InputIterator                     tile_input,
+                 const unsigned int                valid,
+                 ResultType&                       output,
+                 typename BlockReduce::storage_type& storage,
+                 BinaryFunction                    reduce_op,
+                 std::false_type /*commutative*/)
+{
+    ResultType values[ItemsPerThread];
+    if(valid == BlockSize * ItemsPerThread)
+    {
+        block_load_direct_blocked(flat_id, tile_input, values);
+        BlockReduce().reduce(values, output, storage, reduce_op);
+        return;
+    }
+
+    block_load_direct_blocked(flat_id, tile_input, values, valid);
+    const unsigned int thread_offset = flat_id * ItemsPerThread;
+    output                           = values[0];
+    ROCPRIM_UNROLL
+    for(unsigned int i = 1; i < ItemsPerThread; i++)
+    {
+        if(thread_offset + i < valid)
+        {
+            output = reduce_op(output, values[i]);
+        }
+    }
+    BlockReduce().reduce(output,
+                         output,
+                         ::rocprim::detail::ceiling_div(valid, ItemsPerThread),
+                         storage,
+                         reduce_op);
+}
+
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class BlockReduce,
+         class ResultType,
+         class InputIterator,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void reduce_tile(const unsigned int                  flat_id,
+                 InputIterator                       tile_input,
+                 const unsigned int                  valid,
+                 ResultType&                         output,
+                 typename BlockReduce::storage_type& storage,
+                 BinaryFunction                      reduce_op)
+{
+    reduce_tile<BlockSize, ItemsPerThread, BlockReduce>(
+        flat_id,
+        tile_input,
+        valid,
+        output,
+        storage,
+        reduce_op,
+        std::integral_constant<bool, ::rocprim::is_commutative<BinaryFunction>::value>{});
+}
+
 template<
     bool WithInitialValue,
     class Config,
@@ -107,57 +227,278 @@ void block_reduce_kernel_impl(InputIterator input,
     const unsigned int number_of_blocks = ::rocprim::detail::grid_size<0>();
     auto valid_in_last_block = input_size - items_per_block * (number_of_blocks - 1);
 
-    result_type values[items_per_thread];
+    ROCPRIM_SHARED_MEMORY typename block_reduce_type::storage_type storage;
+
+    const unsigned int valid_in_block = flat_block_id == (number_of_blocks - 1) // last block
+        ? static_cast<unsigned int>(valid_in_last_block) : items_per_block;
     result_type output_value;
-    if(flat_block_id == (number_of_blocks - 1)) // last block
+    reduce_tile<block_size, items_per_thread, block_reduce_type>(
+        flat_id, input + block_offset, valid_in_block, output_value, storage, reduce_op);
+
+    // Save value into output
+    if(flat_id == 0)
     {
-        block_load_direct_striped<block_size>(
-            flat_id,
-            input + block_offset,
-            values,
-            valid_in_last_block
-        );
+        output[flat_block_id] = input_size == 0
+            ? static_cast<result_type>(initial_value)
+            : reduce_with_initial<WithInitialValue>(
+                output_value,
+                static_cast<result_type>(initial_value),
+                reduce_op
+            );
+    }
+}
 
-        output_value = values[0];
-        ROCPRIM_UNROLL
-        for(unsigned int i = 1; i < items_per_thread; i++)
+// Reduces the tiles [tile_begin, tile_end) of the input, the result is only valid in thread 0.
+// Commutative operators: every thread accumulates its striped items of all tiles, and the block
+// reduces the values of the threads once.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class BlockReduce,
+         class ResultType,
+         class InputIterator,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void single_pass_reduce_tiles(const unsigned int                  flat_id,
+                              InputIterator                       input,
+                              const size_t                        input_size,
+                              const size_t                        tile_begin,
+                              const size_t                        tile_end,
+                              ResultType&                         block_value,
+                              typename BlockReduce::storage_type& storage,
+                              BinaryFunction                      reduce_op,
+                              std::true_type /*commutative*/)
+{
+    constexpr unsigned int block_size       = BlockSize;
+    constexpr unsigned int items_per_thread = ItemsPerThread;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+    using result_type                       = ResultType;
+
+    result_type thread_value;
+    unsigned int valid_threads = block_size;
+    for(size_t tile = tile_begin; tile < tile_end; tile++)
+    {
+        const size_t tile_offset = tile * items_per_block;
+        result_type values[items_per_thread];
+        if(tile_offset + items_per_block <= input_size)
         {
-            unsigned int offset = i * block_size;
-            if(flat_id + offset < valid_in_last_block)
+            load_commutative_tile<block_size>(flat_id, input + tile_offset, values);
+
+            ROCPRIM_UNROLL
+            for(unsigned int i = 0; i < items_per_thread; i++)
             {
-                output_value = reduce_op(output_value, values[i]);
+                thread_value = (tile == tile_begin && i == 0)
+                    ? values[0] : reduce_op(thread_value, values[i]);
             }
         }
+        else
+        {
+            // The last tile of the input
+            const unsigned int valid = static_cast<unsigned int>(input_size - tile_offset);
+            block_load_direct_striped_buffer<block_size>(
+                flat_id, input + tile_offset, values, valid);
 
-        block_reduce_type()
-            .reduce(
-                output_value, // input
-                output_value, // output
-                valid_in_last_block,
-                reduce_op
-            );
+            ROCPRIM_UNROLL
+            for(unsigned int i = 0; i < items_per_thread; i++)
+            {
+                if(flat_id + i * block_size < valid)
+                {
+                    thread_value = (tile == tile_begin && i == 0)
+                        ? values[0] : reduce_op(thread_value, values[i]);
+                }
+            }
+            if(tile == tile_begin)
+            {
+                valid_threads = ::rocprim::min(valid, block_size);
+            }
+        }
+    }
+
+    BlockReduce().reduce(thread_value, block_value, valid_threads, storage, reduce_op);
+}
+
+// Other operators: the tiles are reduced one by one and thread 0 accumulates them in order.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class BlockReduce,
+         class ResultType,
+         class InputIterator,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void single_pass_reduce_tiles(const unsigned int                  flat_id,
+                              InputIterator                       input,
+                              const size_t                        input_size,
+                              const size_t                        tile_begin,
+                              const size_t                        tile_end,
+                              ResultType&                         block_value,
+                              typename BlockReduce::storage_type& storage,
+                              BinaryFunction                      reduce_op,
+                              std::false_type /*commutative*/)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    for(size_t tile = tile_begin; tile < tile_end; tile++)
+    {
+        const size_t       tile_offset = tile * items_per_block;
+        const unsigned int valid       = static_cast<unsigned int>(
+            ::rocprim::min<size_t>(input_size - tile_offset, items_per_block));
+        if(tile != tile_begin)
+        {
+            ::rocprim::syncthreads(); // reuse storage
+        }
+        ResultType tile_value;
+        reduce_tile<BlockSize, ItemsPerThread, BlockReduce>(
+            flat_id, input + tile_offset, valid, tile_value, storage, reduce_op);
+        block_value = tile == tile_begin ? tile_value : reduce_op(block_value, tile_value);
+    }
+}
+
+// Single-pass reduction: every block reduces a contiguous range of tiles and stores its partial
+// result, the last block to finish (found with an atomic ticket counter) reduces the partial results
+// of all blocks in the order of blocks and stores the final result.
+template<
+    bool WithInitialValue,
+    class Config,
+    class ResultType,
+    class InputIterator,
+    class OutputIterator,
+    class InitValueType,
+    class BinaryFunction
+>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void single_pass_reduce_kernel_impl(InputIterator input,
+                                    const size_t input_size,
+                                    OutputIterator output,
+                                    InitValueType initial_value,
+                                    BinaryFunction reduce_op,
+                                    ResultType * block_partials,
+                                    unsigned int * ticket_counter)
+{
+    static constexpr reduce_config_params params = device_params<Config>();
+
+    constexpr unsigned int block_size       = params.block_size;
+    constexpr unsigned int items_per_thread = params.items_per_thread;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+
+    using result_type = ResultType;
+
+    using block_reduce_type
+        = ::rocprim::block_reduce<result_type, block_size, params.block_reduce_method>;
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        typename block_reduce_type::storage_type reduce;
+        bool is_last_block;
+    } storage;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int flat_block_id = ::rocprim::detail::block_id<0>();
+    const unsigned int number_of_blocks = ::rocprim::detail::grid_size<0>();
+    const size_t number_of_tiles = ::rocprim::detail::ceiling_div(input_size, items_per_block);
+
+    // Tiles are distributed evenly, every block has at least one tile
+    const size_t tile_begin = flat_block_id * number_of_tiles / number_of_blocks;
+    const size_t tile_end = (flat_block_id + 1) * number_of_tiles / number_of_blocks;
+
+    result_type block_value;
+    single_pass_reduce_tiles<block_size, items_per_thread, block_reduce_type>(
+        flat_id, input, input_size, tile_begin, tile_end, block_value, storage.reduce, reduce_op,
+        std::integral_constant<bool, ::rocprim::is_commutative<BinaryFunction>::value>{});
+
+    if(flat_id == 0)
+    {
+        block_partials[flat_block_id] = block_value;
+        // Make the partial result visible to the last block before taking a ticket
+        ::rocprim::detail::memory_fence_device();
+        const unsigned int ticket = ::rocprim::detail::atomic_add(ticket_counter, 1u);
+        storage.is_last_block = ticket == number_of_blocks - 1;
     }
-    else
+    ::rocprim::syncthreads();
+
+    if(!storage.is_last_block)
     {
-        block_load_direct_striped<block_size>(
-            flat_id,
-            input + block_offset,
-            values
+        return;
+    }
+    ::rocprim::detail::memory_fence_device();
+
+    // The number of blocks does not exceed the number of items in a block
+    result_type partials_value;
+    ::rocprim::syncthreads(); // reuse storage.reduce
+    reduce_tile<block_size, items_per_thread, block_reduce_type>(
+        flat_id, block_partials, number_of_blocks, partials_value, storage.reduce, reduce_op);
+
+    if(flat_id == 0)
+    {
+        output[0] = reduce_with_initial<WithInitialValue>(
+            partials_value,
+            static_cast<result_type>(initial_value),
+            reduce_op
         );
+    }
+}
 
-        // load input values into values
-        block_reduce_type()
-            .reduce(
-                values, // input
-                output_value, // output
-                reduce_op
-            );
+// Block reduction with a size which is only known on the device. The grid is sized for an upper
+// bound of the size, blocks past the size exit early. The first block of the first launch always
+// stores its result (the initial value if the size is zero), and stores the number of partial
+// results to nested_size (if it is not nullptr), which is the size of the next reduction level.
+template<
+    bool WithInitialValue,
+    class Config,
+    class ResultType,
+    class InputIterator,
+    class SizeType,
+    class OutputIterator,
+    class InitValueType,
+    class BinaryFunction
+>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void block_reduce_future_size_kernel_impl(InputIterator input,
+                                          const SizeType size,
+                                          const size_t offset,
+                                          OutputIterator output,
+                                          InitValueType initial_value,
+                                          BinaryFunction reduce_op,
+                                          size_t * nested_size)
+{
+    static constexpr reduce_config_params params = device_params<Config>();
+
+    constexpr unsigned int block_size       = params.block_size;
+    constexpr unsigned int items_per_thread = params.items_per_thread;
+
+    using result_type = ResultType;
+
+    using block_reduce_type
+        = ::rocprim::block_reduce<result_type, block_size, params.block_reduce_method>;
+    constexpr unsigned int items_per_block = block_size * items_per_thread;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int flat_block_id = ::rocprim::detail::block_id<0>();
+
+    const size_t total_size = static_cast<size_t>(get_input_value(size));
+    const size_t input_size = total_size > offset ? total_size - offset : 0;
+    const size_t block_offset = static_cast<size_t>(flat_block_id) * items_per_block;
+
+    const bool is_first_block = offset == 0 && flat_block_id == 0;
+    if(is_first_block && flat_id == 0 && nested_size != nullptr)
+    {
+        *nested_size = ::rocprim::detail::ceiling_div(total_size, items_per_block);
     }
+    if(block_offset >= input_size && !is_first_block)
+    {
+        return;
+    }
+    const unsigned int valid_in_block = input_size > block_offset
+        ? static_cast<unsigned int>(::rocprim::min<size_t>(input_size - block_offset, items_per_block))
+        : 0;
+
+    ROCPRIM_SHARED_MEMORY typename block_reduce_type::storage_type storage;
+
+    result_type output_value;
+    reduce_tile<block_size, items_per_thread, block_reduce_type>(
+        flat_id, input + block_offset, valid_in_block, output_value, storage, reduce_op);
 
     // Save value into output
     if(flat_id == 0)
     {
-        output[flat_block_id] = input_size == 0
+        output[flat_block_id] = valid_in_block == 0
             ? static_cast<result_type>(initial_value)
             : reduce_with_initial<WithInitialValue>(
                 output_value,
@@ -166,6 +507,7 @@ void block_reduce_kernel_impl(InputIterator input,
             );
     }
 }
+
 } // end of detail namespace
 
 END_ROCPRIM_NAMESPACE
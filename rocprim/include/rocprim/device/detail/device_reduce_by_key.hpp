@@ -52,12 +52,14 @@ template<typename ValueIterator, typename BinaryOp>
 using accumulator_type_t =
     typename detail::match_result_type<reduce_by_key::value_type_t<ValueIterator>, BinaryOp>::type;
 
-template<typename AccumulatorType>
-using wrapped_type_t = rocprim::tuple<unsigned int, AccumulatorType>;
+// HeadCount is the type of the number of segment heads carried through the look-back,
+// it is 64-bit when the whole input is processed by a single launch.
+template<typename AccumulatorType, typename HeadCount = unsigned int>
+using wrapped_type_t = rocprim::tuple<HeadCount, AccumulatorType>;
 
-template<typename AccumulatorType, bool UseSleep = false>
+template<typename AccumulatorType, bool UseSleep = false, typename HeadCount = unsigned int>
 using lookback_scan_state_t
-    = detail::lookback_scan_state<wrapped_type_t<AccumulatorType>, UseSleep>;
+    = detail::lookback_scan_state<wrapped_type_t<AccumulatorType, HeadCount>, UseSleep>;
 
 template<typename KeyType,
          typename AccumulatorType,
@@ -192,7 +194,9 @@ template<typename KeyType,
          unsigned int         ItemsPerThread,
          block_load_method    load_keys_method,
          block_load_method    load_values_method,
-         block_scan_algorithm scan_algorithm>
+         block_scan_algorithm scan_algorithm,
+         lookback_backoff     backoff,
+         typename HeadCount = unsigned int>
 class tile_helper
 {
 private:
@@ -203,7 +207,7 @@ private:
                                                  load_keys_method,
                                                  load_values_method>;
 
-    using wrapped_type = reduce_by_key::wrapped_type_t<AccumulatorType>;
+    using wrapped_type = reduce_by_key::wrapped_type_t<AccumulatorType, HeadCount>;
 
     using discontinuity_type = reduce_by_key::discontinuity_helper<KeyType, BlockSize>;
     using block_scan_type    = rocprim::block_scan<wrapped_type, BlockSize, scan_algorithm>;
@@ -302,7 +306,7 @@ public:
             rocprim::get<1>(wrapped_values[i]) = values[i];
         }
 
-        unsigned int segment_heads_before   = 0;
+        HeadCount    segment_heads_before   = 0;
         unsigned int segment_heads_in_block = 0;
         wrapped_type reduction;
 
@@ -310,12 +314,13 @@ public:
         // multiple launches occur due to large indices
         if(is_first_tile)
         {
-            wrapped_type initial_value = ::rocprim::make_tuple(0u, values[0] /* dummy value */);
+            wrapped_type initial_value
+                = ::rocprim::make_tuple(HeadCount(0), values[0] /* dummy value */);
 
             // previous_accumulated is used to pass the accumulated value from the previous launch
             if(previous_accumulated != nullptr)
             {
-                initial_value = ::rocprim::make_tuple(0u, *previous_accumulated);
+                initial_value = ::rocprim::make_tuple(HeadCount(0), *previous_accumulated);
             }
 
             block_scan_type{}.exclusive_scan(wrapped_values,
@@ -332,15 +337,18 @@ public:
                 scan_state.set_complete(0, reduction);
             }
 
-            segment_heads_in_block = rocprim::get<0>(reduction);
+            segment_heads_in_block = static_cast<unsigned int>(rocprim::get<0>(reduction));
         }
         else
         {
+            using backoff_type =
+                typename select_lookback_backoff<backoff, LookbackScanState>::type;
             auto lookback_op = detail::lookback_scan_prefix_op<wrapped_type,
                                                                decltype(wrapped_op),
-                                                               decltype(scan_state)>{tile_id,
-                                                                                     wrapped_op,
-                                                                                     scan_state};
+                                                               decltype(scan_state),
+                                                               backoff_type>{tile_id,
+                                                                             wrapped_op,
+                                                                             scan_state};
 
             auto offset_lookback_op = prefix_op_factory::create(lookback_op, storage.scan.prefix);
 
@@ -353,8 +361,8 @@ public:
 
             segment_heads_before
                 = rocprim::get<0>(prefix_op_factory::get_prefix(storage.scan.prefix));
-            segment_heads_in_block
-                = rocprim::get<0>(prefix_op_factory::get_reduction(storage.scan.prefix));
+            segment_heads_in_block = static_cast<unsigned int>(
+                rocprim::get<0>(prefix_op_factory::get_reduction(storage.scan.prefix)));
             reduction = wrapped_op(prefix_op_factory::get_prefix(storage.scan.prefix),
                                    prefix_op_factory::get_reduction(storage.scan.prefix));
         }
@@ -372,7 +380,10 @@ public:
             [&keys](unsigned int i) { return keys[i]; },
             head_flags,
             [&](const unsigned int i)
-            { return rocprim::get<0>(wrapped_values[i]) - segment_heads_before; },
+            {
+                return static_cast<unsigned int>(rocprim::get<0>(wrapped_values[i])
+                                                 - segment_heads_before);
+            },
             segment_heads_in_block,
             flat_thread_id,
             storage.scatter_keys);
@@ -398,7 +409,8 @@ public:
             [&wrapped_values](unsigned int i) { return rocprim::get<1>(wrapped_values[i]); },
             head_flags,
             [&, offset = segment_heads_before + (is_global_first_tile ? 1 : 0)](
-                const unsigned int i) { return rocprim::get<0>(wrapped_values[i]) - offset; },
+                const unsigned int i)
+            { return static_cast<unsigned int>(rocprim::get<0>(wrapped_values[i]) - offset); },
             reductions_in_block,
             flat_thread_id,
             storage.scatter_values);
@@ -416,7 +428,10 @@ public:
     }
 };
 
+// When Persistent is true, every block processes tiles until all of them are processed,
+// otherwise a block processes at most Config::tiles_per_block tiles.
 template<typename Config,
+         bool Persistent,
          typename AccumulatorType,
          typename KeyIterator,
          typename ValueIterator,
@@ -452,6 +467,8 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
     static constexpr unsigned int         items_per_tile     = block_size * items_per_thread;
 
     using key_type = reduce_by_key::value_type_t<KeyIterator>;
+    using head_count_type
+        = ::rocprim::tuple_element_t<0, typename LookbackScanState::value_type>;
 
     using tile_processor = tile_helper<key_type,
                                        AccumulatorType,
@@ -459,7 +476,9 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
                                        items_per_thread,
                                        load_keys_method,
                                        load_values_method,
-                                       scan_algorithm>;
+                                       scan_algorithm,
+                                       config_lookback_backoff<Config>::value,
+                                       head_count_type>;
 
     ROCPRIM_SHARED_MEMORY union
     {
@@ -467,7 +486,7 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
         typename tile_processor::storage_type            tile;
     } storage;
 
-    for(unsigned int i = 0; i < tiles_per_block; ++i)
+    for(unsigned int i = 0; Persistent || i < tiles_per_block; ++i)
     {
         rocprim::syncthreads();
         const std::size_t tile_id = ordered_tile_id.get(threadIdx.x, storage.tile_id);
@@ -0,0 +1,661 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_REDUCE_BY_KEY_COLUMNS_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_REDUCE_BY_KEY_COLUMNS_HPP_
+
+#include "device_reduce_by_key.hpp"
+#include "device_scan_common.hpp"
+#include "lookback_scan_state.hpp"
+#include "ordered_block_id.hpp"
+
+#include "../../block/block_load.hpp"
+#include "../../block/block_scan.hpp"
+#include "../../detail/binary_op_wrappers.hpp"
+#include "../../detail/various.hpp"
+#include "../../functional.hpp"
+#include "../../intrinsics/thread.hpp"
+#include "../../types/integer_sequence.hpp"
+#include "../../types/tuple.hpp"
+
+#include "../../config.hpp"
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+namespace reduce_by_key
+{
+
+// Every column is scanned as (value, head flag) pairs in its own look-back lane, so the flag is
+// packed into the status word of the lane and the payload is only the value of the column.
+template<typename AccumulatorType, bool UseSleep = false>
+using column_scan_state_t
+    = detail::lookback_scan_state<::rocprim::tuple<AccumulatorType, bool>, UseSleep>;
+
+// The number of segment heads has a look-back lane of its own, which is a single atomic
+// with 32-bit head counts.
+template<typename HeadCount, bool UseSleep = false>
+using head_scan_state_t = detail::lookback_scan_state<HeadCount, UseSleep>;
+
+template<typename... AccumulatorTypes>
+struct column_scan_states
+{
+    template<bool UseSleep>
+    using type = ::rocprim::tuple<column_scan_state_t<AccumulatorTypes, UseSleep>...>;
+
+    template<bool UseSleep, size_t... Indices>
+    ROCPRIM_HOST static inline
+    type<UseSleep> create(void* const* storage,
+                          const unsigned int number_of_tiles,
+                          ::rocprim::index_sequence<Indices...>)
+    {
+        return ::rocprim::make_tuple(
+            column_scan_state_t<AccumulatorTypes, UseSleep>::create(storage[Indices],
+                                                                    number_of_tiles)...);
+    }
+
+    // This is valid even with the states which use sleep
+    template<size_t... Indices>
+    ROCPRIM_HOST static inline
+    auto make_partition(void** storage,
+                        const unsigned int number_of_tiles,
+                        ::rocprim::index_sequence<Indices...>)
+    {
+        return detail::temp_storage::make_linear_partition(detail::temp_storage::make_partition(
+            &storage[Indices],
+            column_scan_state_t<AccumulatorTypes>::get_temp_storage_layout(number_of_tiles))...);
+    }
+};
+
+template<typename HeadScanState, typename... ColumnScanStates, size_t... Indices>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void init_columns_scan_states(HeadScanState                          head_scan_state,
+                              ::rocprim::tuple<ColumnScanStates...>& column_scan_states,
+                              const unsigned int                     number_of_tiles,
+                              ordered_block_id<unsigned int>         ordered_bid,
+                              const unsigned int                     flat_thread_id,
+                              ::rocprim::index_sequence<Indices...>)
+{
+    init_lookback_scan_state(head_scan_state, number_of_tiles, ordered_bid, flat_thread_id);
+    auto swallow = {(::rocprim::get<Indices>(column_scan_states)
+                         .initialize_prefix(flat_thread_id, number_of_tiles),
+                     0)...};
+    (void)swallow;
+}
+
+template<typename HeadScanState, typename... ColumnScanStates>
+ROCPRIM_KERNEL __launch_bounds__(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE) void columns_init_kernel(
+    HeadScanState                         head_scan_state,
+    ::rocprim::tuple<ColumnScanStates...> column_scan_states,
+    const unsigned int                    number_of_tiles,
+    ordered_block_id<unsigned int>        ordered_bid)
+{
+    const unsigned int block_id        = ::rocprim::detail::block_id<0>();
+    const unsigned int block_size      = ::rocprim::detail::block_size<0>();
+    const unsigned int block_thread_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int grid_threads    = ::rocprim::detail::grid_size<0>() * block_size;
+
+    for(unsigned int flat_thread_id = (block_id * block_size) + block_thread_id;
+        flat_thread_id < number_of_tiles || flat_thread_id < ::rocprim::device_warp_size();
+        flat_thread_id += grid_threads)
+    {
+        init_columns_scan_states(head_scan_state,
+                                 column_scan_states,
+                                 number_of_tiles,
+                                 ordered_bid,
+                                 flat_thread_id,
+                                 ::rocprim::index_sequence_for<ColumnScanStates...>());
+    }
+}
+
+// Storage of the columns, which are processed one after another
+template<typename... Storages>
+union columns_storage;
+
+template<typename Storage>
+union columns_storage<Storage>
+{
+    Storage first;
+};
+
+template<typename Storage, typename... Storages>
+union columns_storage<Storage, Storages...>
+{
+    Storage                      first;
+    columns_storage<Storages...> rest;
+};
+
+template<size_t Index>
+struct get_column_storage
+{
+    template<typename Storage>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static auto& get(Storage& storage)
+    {
+        return get_column_storage<Index - 1>::get(storage.rest);
+    }
+};
+
+template<>
+struct get_column_storage<0>
+{
+    template<typename Storage>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static auto& get(Storage& storage)
+    {
+        return storage.first;
+    }
+};
+
+// The segmented scan of one column of a tile, the segment heads are already known
+template<typename AccumulatorType,
+         unsigned int         BlockSize,
+         unsigned int         ItemsPerThread,
+         block_load_method    load_values_method,
+         block_scan_algorithm scan_algorithm,
+         lookback_backoff     backoff>
+class column_helper
+{
+private:
+    using wrapped_type = ::rocprim::tuple<AccumulatorType, bool>;
+
+    using block_load_values
+        = block_load<AccumulatorType, BlockSize, ItemsPerThread, load_values_method>;
+    using block_scan_type   = rocprim::block_scan<wrapped_type, BlockSize, scan_algorithm>;
+    using prefix_op_factory = detail::offset_lookback_scan_factory<wrapped_type>;
+    using scatter_values_type
+        = reduce_by_key::scatter_helper<AccumulatorType, BlockSize, ItemsPerThread>;
+
+public:
+    union storage_type
+    {
+        typename block_load_values::storage_type load;
+        struct
+        {
+            typename prefix_op_factory::storage_type prefix;
+            typename block_scan_type::storage_type   scan;
+        } scan;
+        typename scatter_values_type::storage_type scatter;
+    };
+
+    // reduction_flags are the heads which write the reduction of the preceding segment and
+    // reduction_indices are their indices in the reductions of the tile
+    template<typename ValueIterator,
+             typename TileReductionIterator,
+             typename ReductionIterator,
+             typename BinaryOp,
+             typename LookbackScanState,
+             typename HeadCount>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+        process_tile(const ValueIterator   tile_values,
+                     TileReductionIterator tile_reductions,
+                     ReductionIterator     reductions,
+                     BinaryOp              reduce_op,
+                     LookbackScanState     scan_state,
+                     const unsigned int (&head_flags)[ItemsPerThread],
+                     const unsigned int (&reduction_flags)[ItemsPerThread],
+                     const HeadCount (&reduction_indices)[ItemsPerThread],
+                     const unsigned int    reductions_in_tile,
+                     const std::size_t     total_segment_heads,
+                     const unsigned int    tile_id,
+                     const bool            is_global_last_tile,
+                     const unsigned int    valid_in_global_last_tile,
+                     storage_type&         storage)
+    {
+        static constexpr unsigned int items_per_tile = BlockSize * ItemsPerThread;
+
+        auto wrapped_op
+            = headflag_scan_op_wrapper<AccumulatorType, bool, BinaryOp>{reduce_op};
+
+        const unsigned int flat_thread_id = threadIdx.x;
+
+        AccumulatorType values[ItemsPerThread];
+        ::rocprim::syncthreads();
+        if(!is_global_last_tile)
+        {
+            block_load_values{}.load(tile_values, values, storage.load);
+        }
+        else
+        {
+            block_load_values{}.load(tile_values,
+                                     values,
+                                     valid_in_global_last_tile,
+                                     storage.load);
+        }
+        ::rocprim::syncthreads();
+
+        wrapped_type wrapped_values[ItemsPerThread];
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            wrapped_values[i] = wrapped_type{values[i], head_flags[i] != 0};
+        }
+
+        wrapped_type reduction;
+        if(tile_id == 0)
+        {
+            // The first item is a segment head, so the initial value is not in any reduction
+            const wrapped_type initial_value = wrapped_type{values[0] /* dummy value */, false};
+
+            block_scan_type{}.exclusive_scan(wrapped_values,
+                                             wrapped_values,
+                                             initial_value,
+                                             reduction,
+                                             storage.scan.scan,
+                                             wrapped_op);
+            reduction = wrapped_op(initial_value, reduction);
+
+            if(flat_thread_id == 0)
+            {
+                scan_state.set_complete(0, reduction);
+            }
+        }
+        else
+        {
+            using backoff_type =
+                typename select_lookback_backoff<backoff, LookbackScanState>::type;
+            auto lookback_op = detail::lookback_scan_prefix_op<wrapped_type,
+                                                               decltype(wrapped_op),
+                                                               decltype(scan_state),
+                                                               backoff_type>{tile_id,
+                                                                             wrapped_op,
+                                                                             scan_state};
+
+            auto offset_lookback_op = prefix_op_factory::create(lookback_op, storage.scan.prefix);
+
+            block_scan_type{}.exclusive_scan(wrapped_values,
+                                             wrapped_values,
+                                             storage.scan.scan,
+                                             offset_lookback_op,
+                                             wrapped_op);
+            ::rocprim::syncthreads();
+
+            reduction = wrapped_op(prefix_op_factory::get_prefix(storage.scan.prefix),
+                                   prefix_op_factory::get_reduction(storage.scan.prefix));
+        }
+        ::rocprim::syncthreads();
+
+        // The exclusive scan of a segment head is the reduction of the preceding segment
+        scatter_values_type{}.scatter(
+            tile_reductions,
+            [&wrapped_values](unsigned int i) { return rocprim::get<0>(wrapped_values[i]); },
+            reduction_flags,
+            [&reduction_indices](const unsigned int i)
+            { return static_cast<unsigned int>(reduction_indices[i]); },
+            reductions_in_tile,
+            flat_thread_id,
+            storage.scatter);
+
+        if(is_global_last_tile && flat_thread_id == BlockSize - 1
+           && valid_in_global_last_tile == items_per_tile)
+        {
+            reductions[total_segment_heads - 1] = rocprim::get<0>(reduction);
+        }
+    }
+};
+
+// The keys of a tile are loaded, flagged and scattered once, then every column is scanned in its
+// own look-back lane. Only the values of one column are in the registers at a time.
+template<typename KeyType,
+         unsigned int         BlockSize,
+         unsigned int         ItemsPerThread,
+         block_load_method    load_keys_method,
+         block_load_method    load_values_method,
+         block_scan_algorithm scan_algorithm,
+         lookback_backoff     backoff,
+         typename HeadCount,
+         typename... AccumulatorTypes>
+class columns_tile_helper
+{
+private:
+    using block_load_keys    = block_load<KeyType, BlockSize, ItemsPerThread, load_keys_method>;
+    using discontinuity_type = reduce_by_key::discontinuity_helper<KeyType, BlockSize>;
+    using block_scan_type    = rocprim::block_scan<HeadCount, BlockSize, scan_algorithm>;
+    using prefix_op_factory  = detail::offset_lookback_scan_factory<HeadCount>;
+    using scatter_keys_type  = reduce_by_key::scatter_helper<KeyType, BlockSize, ItemsPerThread>;
+
+    template<typename AccumulatorType>
+    using column_type = column_helper<AccumulatorType,
+                                      BlockSize,
+                                      ItemsPerThread,
+                                      load_values_method,
+                                      scan_algorithm,
+                                      backoff>;
+
+public:
+    union storage_type
+    {
+        typename block_load_keys::storage_type load;
+        struct
+        {
+            typename discontinuity_type::storage_type flags;
+            typename prefix_op_factory::storage_type  prefix;
+            typename block_scan_type::storage_type    scan;
+        } scan;
+        typename scatter_keys_type::storage_type scatter_keys;
+        columns_storage<typename column_type<AccumulatorTypes>::storage_type...> columns;
+    };
+
+    template<typename KeyIterator,
+             typename ValueIterators,
+             typename UniqueIterator,
+             typename ReductionIterators,
+             typename UniqueCountIterator,
+             typename CompareFunction,
+             typename BinaryOps,
+             typename HeadScanState,
+             typename ColumnScanStates>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+        process_tile(const KeyIterator     tile_keys,
+                     const ValueIterators  tile_values,
+                     UniqueIterator        unique_keys,
+                     ReductionIterators    reductions,
+                     UniqueCountIterator   unique_count,
+                     BinaryOps             reduce_ops,
+                     const CompareFunction compare,
+                     HeadScanState         head_scan_state,
+                     ColumnScanStates      column_scan_states,
+                     const unsigned int    tile_id,
+                     const std::size_t     number_of_tiles,
+                     const std::size_t     size,
+                     storage_type&         storage)
+    {
+        static constexpr unsigned int items_per_tile = BlockSize * ItemsPerThread;
+
+        const bool is_global_first_tile = tile_id == 0;
+        const bool is_global_last_tile  = tile_id == number_of_tiles - 1;
+
+        const unsigned int valid_in_global_last_tile
+            = static_cast<unsigned int>(size - ((number_of_tiles - 1) * items_per_tile));
+
+        const unsigned int flat_thread_id = threadIdx.x;
+
+        KeyType keys[ItemsPerThread];
+        if(!is_global_last_tile)
+        {
+            block_load_keys{}.load(tile_keys, keys, storage.load);
+        }
+        else
+        {
+            // Pad with the last valid value so out-of-bound items are not flagged
+            block_load_keys{}.load(tile_keys,
+                                   keys,
+                                   valid_in_global_last_tile,
+                                   tile_keys[valid_in_global_last_tile - 1],
+                                   storage.load);
+        }
+        ::rocprim::syncthreads();
+
+        unsigned int head_flags[ItemsPerThread];
+        discontinuity_type{}.flag_heads(tile_keys,
+                                        keys,
+                                        compare,
+                                        head_flags,
+                                        is_global_first_tile,
+                                        storage.scan.flags);
+
+        HeadCount head_indices[ItemsPerThread];
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            head_indices[i] = head_flags[i];
+        }
+
+        HeadCount    segment_heads_before = 0;
+        unsigned int segment_heads_in_block;
+        if(is_global_first_tile)
+        {
+            HeadCount reduction;
+            block_scan_type{}.exclusive_scan(head_indices,
+                                             head_indices,
+                                             HeadCount(0),
+                                             reduction,
+                                             storage.scan.scan,
+                                             ::rocprim::plus<HeadCount>());
+            if(flat_thread_id == 0)
+            {
+                head_scan_state.set_complete(0, reduction);
+            }
+            segment_heads_in_block = static_cast<unsigned int>(reduction);
+        }
+        else
+        {
+            using backoff_type = typename select_lookback_backoff<backoff, HeadScanState>::type;
+            auto lookback_op   = detail::lookback_scan_prefix_op<HeadCount,
+                                                               ::rocprim::plus<HeadCount>,
+                                                               decltype(head_scan_state),
+                                                               backoff_type>{
+                tile_id,
+                ::rocprim::plus<HeadCount>(),
+                head_scan_state};
+
+            auto offset_lookback_op = prefix_op_factory::create(lookback_op, storage.scan.prefix);
+
+            block_scan_type{}.exclusive_scan(head_indices,
+                                             head_indices,
+                                             storage.scan.scan,
+                                             offset_lookback_op,
+                                             ::rocprim::plus<HeadCount>());
+            ::rocprim::syncthreads();
+
+            segment_heads_before = prefix_op_factory::get_prefix(storage.scan.prefix);
+            segment_heads_in_block
+                = static_cast<unsigned int>(prefix_op_factory::get_reduction(storage.scan.prefix));
+        }
+        ::rocprim::syncthreads();
+
+        scatter_keys_type{}.scatter(
+            unique_keys + segment_heads_before,
+            [&keys](unsigned int i) { return keys[i]; },
+            head_flags,
+            [&](const unsigned int i)
+            { return static_cast<unsigned int>(head_indices[i] - segment_heads_before); },
+            segment_heads_in_block,
+            flat_thread_id,
+            storage.scatter_keys);
+
+        // The first item in the global first tile does not have a reduction
+        // The first out of bounds item in the global last tile has the reduction for the last segment
+        const unsigned int reductions_in_block
+            = segment_heads_in_block - (is_global_first_tile ? 1 : 0)
+              + (is_global_last_tile && valid_in_global_last_tile != items_per_tile ? 1 : 0);
+
+        unsigned int reduction_flags[ItemsPerThread];
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            reduction_flags[i] = head_flags[i];
+            head_indices[i] -= segment_heads_before + (is_global_first_tile ? 1 : 0);
+        }
+        if(is_global_first_tile && flat_thread_id == 0)
+        {
+            reduction_flags[0] = 0;
+        }
+        if(is_global_last_tile && flat_thread_id == valid_in_global_last_tile / ItemsPerThread)
+        {
+            reduction_flags[valid_in_global_last_tile - flat_thread_id * ItemsPerThread] = 1;
+        }
+
+        const std::size_t total_segment_heads = segment_heads_before + segment_heads_in_block;
+        if(is_global_last_tile && flat_thread_id == BlockSize - 1)
+        {
+            *unique_count = total_segment_heads;
+        }
+
+        process_columns(tile_values,
+                        reductions,
+                        reduce_ops,
+                        column_scan_states,
+                        head_flags,
+                        reduction_flags,
+                        head_indices,
+                        segment_heads_before - (!is_global_first_tile ? 1 : 0),
+                        reductions_in_block,
+                        total_segment_heads,
+                        tile_id,
+                        is_global_last_tile,
+                        valid_in_global_last_tile,
+                        storage,
+                        ::rocprim::index_sequence_for<AccumulatorTypes...>());
+    }
+
+private:
+    template<typename ValueIterators,
+             typename ReductionIterators,
+             typename BinaryOps,
+             typename ColumnScanStates,
+             size_t... Indices>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+        process_columns(const ValueIterators tile_values,
+                        ReductionIterators   reductions,
+                        BinaryOps            reduce_ops,
+                        ColumnScanStates     column_scan_states,
+                        const unsigned int (&head_flags)[ItemsPerThread],
+                        const unsigned int (&reduction_flags)[ItemsPerThread],
+                        const HeadCount (&reduction_indices)[ItemsPerThread],
+                        const HeadCount    reductions_before,
+                        const unsigned int reductions_in_block,
+                        const std::size_t  total_segment_heads,
+                        const unsigned int tile_id,
+                        const bool         is_global_last_tile,
+                        const unsigned int valid_in_global_last_tile,
+                        storage_type&      storage,
+                        ::rocprim::index_sequence<Indices...>)
+    {
+        auto swallow = {
+            (column_type<AccumulatorTypes>{}.process_tile(
+                 ::rocprim::get<Indices>(tile_values),
+                 ::rocprim::get<Indices>(reductions) + reductions_before,
+                 ::rocprim::get<Indices>(reductions),
+                 ::rocprim::get<Indices>(reduce_ops),
+                 ::rocprim::get<Indices>(column_scan_states),
+                 head_flags,
+                 reduction_flags,
+                 reduction_indices,
+                 reductions_in_block,
+                 total_segment_heads,
+                 tile_id,
+                 is_global_last_tile,
+                 valid_in_global_last_tile,
+                 get_column_storage<Indices>::get(storage.columns)),
+             0)...};
+        (void)swallow;
+    }
+};
+
+template<size_t... Indices, typename... ValueIterators>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+::rocprim::tuple<ValueIterators...>
+    offset_columns(const ::rocprim::tuple<ValueIterators...>& values,
+                   const std::size_t                          offset,
+                   ::rocprim::index_sequence<Indices...>)
+{
+    return ::rocprim::make_tuple((::rocprim::get<Indices>(values) + offset)...);
+}
+
+// Every block processes tiles in the order of their ids until all of them are processed
+template<typename Config,
+         typename KeyIterator,
+         typename... ValueIterators,
+         typename UniqueIterator,
+         typename... ReductionIterators,
+         typename UniqueCountIterator,
+         typename CompareFunction,
+         typename... BinaryOps,
+         typename HeadScanState,
+         typename... ColumnScanStates>
+ROCPRIM_KERNEL __launch_bounds__(Config::block_size) void columns_kernel(
+    const KeyIterator                             keys_input,
+    const ::rocprim::tuple<ValueIterators...>     values_input,
+    const UniqueIterator                          unique_keys,
+    const ::rocprim::tuple<ReductionIterators...> reductions,
+    const UniqueCountIterator                     unique_count,
+    const ::rocprim::tuple<BinaryOps...>          reduce_ops,
+    const CompareFunction                         compare,
+    const HeadScanState                           head_scan_state,
+    const ::rocprim::tuple<ColumnScanStates...>   column_scan_states,
+    ordered_block_id<unsigned int>                ordered_tile_id,
+    const std::size_t                             number_of_tiles,
+    const std::size_t                             size)
+{
+    static constexpr unsigned int         block_size         = Config::block_size;
+    static constexpr unsigned int         items_per_thread   = Config::items_per_thread;
+    static constexpr block_load_method    load_keys_method   = Config::load_keys_method;
+    static constexpr block_load_method    load_values_method = Config::load_values_method;
+    static constexpr block_scan_algorithm scan_algorithm     = Config::scan_algorithm;
+    static constexpr unsigned int         items_per_tile     = block_size * items_per_thread;
+
+    using key_type        = reduce_by_key::value_type_t<KeyIterator>;
+    using head_count_type = typename HeadScanState::value_type;
+
+    using tile_processor = columns_tile_helper<
+        key_type,
+        block_size,
+        items_per_thread,
+        load_keys_method,
+        load_values_method,
+        scan_algorithm,
+        config_lookback_backoff<Config>::value,
+        head_count_type,
+        ::rocprim::tuple_element_t<0, typename ColumnScanStates::value_type>...>;
+
+    ROCPRIM_SHARED_MEMORY union
+    {
+        typename decltype(ordered_tile_id)::storage_type tile_id;
+        typename tile_processor::storage_type            tile;
+    } storage;
+
+    while(true)
+    {
+        ::rocprim::syncthreads();
+        const std::size_t tile_id = ordered_tile_id.get(threadIdx.x, storage.tile_id);
+        if(tile_id >= number_of_tiles)
+        {
+            return;
+        }
+
+        const std::size_t tile_offset = tile_id * items_per_tile;
+
+        ::rocprim::syncthreads();
+        tile_processor{}.process_tile(
+            keys_input + tile_offset,
+            offset_columns(values_input,
+                           tile_offset,
+                           ::rocprim::index_sequence_for<ValueIterators...>()),
+            unique_keys,
+            reductions,
+            unique_count,
+            reduce_ops,
+            compare,
+            head_scan_state,
+            column_scan_states,
+            static_cast<unsigned int>(tile_id),
+            number_of_tiles,
+            size,
+            storage.tile);
+    }
+}
+
+} // namespace reduce_by_key
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_REDUCE_BY_KEY_COLUMNS_HPP_
@@ -0,0 +1,240 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_REPRODUCIBLE_SUM_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_REPRODUCIBLE_SUM_HPP_
+
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+#include "../../config.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Reproducible floating-point summation by pre-rounding.
+//
+// Every value is split into reproducible_sum_levels integer digits on a fixed-point grid that
+// is derived from the largest finite magnitude of the whole input and the number of values.
+// Integer addition is associative, so the sum of the digits does not depend on the order in
+// which values are combined, i.e. it is the same for every block size, items per thread,
+// number of blocks and GPU architecture. The grid leaves ceil(log2(size)) bits of headroom in
+// every digit, so the digit sums can never overflow.
+
+template<class T>
+struct is_reproducible_sum_type
+    : std::integral_constant<bool, std::is_same<T, float>::value || std::is_same<T, double>::value>
+{};
+
+constexpr unsigned int reproducible_sum_levels = 3;
+
+constexpr unsigned int reproducible_sum_nan     = 1;
+constexpr unsigned int reproducible_sum_pos_inf = 2;
+constexpr unsigned int reproducible_sum_neg_inf = 4;
+
+struct reproducible_sum_accumulator
+{
+    long long    digits[reproducible_sum_levels];
+    // Non-finite values are not representable on the grid, they are tracked as flags
+    unsigned int non_finite;
+};
+
+struct reproducible_sum_op
+{
+    ROCPRIM_HOST_DEVICE inline
+    reproducible_sum_accumulator operator()(const reproducible_sum_accumulator& a,
+                                            const reproducible_sum_accumulator& b) const
+    {
+        reproducible_sum_accumulator result;
+        for(unsigned int i = 0; i < reproducible_sum_levels; i++)
+        {
+            result.digits[i] = a.digits[i] + b.digits[i];
+        }
+        result.non_finite = a.non_finite | b.non_finite;
+        return result;
+    }
+};
+
+// Number of bits of a digit that are used by a single value, the remaining bits are headroom
+// for the sum of size values.
+inline int reproducible_sum_digit_bits(const size_t size)
+{
+    int log2_size = 0;
+    while(log2_size < 62 && (size_t(1) << log2_size) < size)
+    {
+        log2_size++;
+    }
+    return 62 - log2_size;
+}
+
+// Magnitude of a value for finding the grid, non-finite values do not affect the grid.
+template<class T>
+struct reproducible_sum_max_abs_op
+{
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    double operator()(const T& value) const
+    {
+        const double x = static_cast<double>(value);
+        return ::isfinite(x) ? ::fabs(x) : 0.0;
+    }
+};
+
+// Exponent of the grid of the most significant digit
+ROCPRIM_DEVICE ROCPRIM_INLINE
+int reproducible_sum_scale(const double max_abs, const int digit_bits)
+{
+    int exponent;
+    ::frexp(max_abs, &exponent);
+    // max_abs < 2^exponent, so all scaled values are less than 2^digit_bits in magnitude
+    return digit_bits - exponent;
+}
+
+template<class T>
+struct reproducible_sum_split_op
+{
+    const double* max_abs;
+    int           digit_bits;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    reproducible_sum_accumulator operator()(const T& value) const
+    {
+        reproducible_sum_accumulator result{};
+        const double x = static_cast<double>(value);
+        if(::isnan(x))
+        {
+            result.non_finite = reproducible_sum_nan;
+        }
+        else if(::isinf(x))
+        {
+            result.non_finite = x > 0 ? reproducible_sum_pos_inf : reproducible_sum_neg_inf;
+        }
+        else
+        {
+            // Scaling by powers of two and removing the integer part are exact
+            double y = ::ldexp(x, reproducible_sum_scale(*max_abs, digit_bits));
+            for(unsigned int i = 0; i < reproducible_sum_levels; i++)
+            {
+                const double digit = ::rint(y);
+                result.digits[i]   = static_cast<long long>(digit);
+                y                  = ::ldexp(y - digit, digit_bits);
+            }
+        }
+        return result;
+    }
+};
+
+template<class T>
+struct reproducible_sum_to_value_op
+{
+    const double* max_abs;
+    int           digit_bits;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    T operator()(const reproducible_sum_accumulator& sum) const
+    {
+        const bool pos_inf = (sum.non_finite & reproducible_sum_pos_inf) != 0;
+        const bool neg_inf = (sum.non_finite & reproducible_sum_neg_inf) != 0;
+        if((sum.non_finite & reproducible_sum_nan) != 0 || (pos_inf && neg_inf))
+        {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+        if(pos_inf || neg_inf)
+        {
+            return pos_inf ? std::numeric_limits<T>::infinity()
+                           : -std::numeric_limits<T>::infinity();
+        }
+        // Least significant digits first, so they are not lost before being added
+        double result = 0.0;
+        for(unsigned int i = reproducible_sum_levels; i > 0; i--)
+        {
+            result = ::ldexp(result, -digit_bits) + static_cast<double>(sum.digits[i - 1]);
+        }
+        return static_cast<T>(::ldexp(result, -reproducible_sum_scale(*max_abs, digit_bits)));
+    }
+};
+
+// Output iterator that converts accumulated digits to values when they are stored.
+template<class OutputIterator, class T>
+class reproducible_sum_output_iterator
+{
+public:
+    struct reference
+    {
+        OutputIterator                  output;
+        reproducible_sum_to_value_op<T> to_value;
+
+        ROCPRIM_DEVICE ROCPRIM_INLINE
+        reference& operator=(const reproducible_sum_accumulator& sum)
+        {
+            *output = to_value(sum);
+            return *this;
+        }
+    };
+
+    using value_type        = reproducible_sum_accumulator;
+    using pointer           = void;
+    using difference_type   = std::ptrdiff_t;
+    using iterator_category = std::random_access_iterator_tag;
+
+    ROCPRIM_HOST_DEVICE inline
+    reproducible_sum_output_iterator(OutputIterator output, reproducible_sum_to_value_op<T> to_value)
+        : output_(output), to_value_(to_value)
+    {}
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator*() const
+    {
+        return reference{output_, to_value_};
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator[](difference_type distance) const
+    {
+        return reference{output_ + distance, to_value_};
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reproducible_sum_output_iterator operator+(difference_type distance) const
+    {
+        return reproducible_sum_output_iterator(output_ + distance, to_value_);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reproducible_sum_output_iterator& operator+=(difference_type distance)
+    {
+        output_ += distance;
+        return *this;
+    }
+
+private:
+    OutputIterator                  output_;
+    reproducible_sum_to_value_op<T> to_value_;
+};
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_REPRODUCIBLE_SUM_HPP_
@@ -0,0 +1,443 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_RUN_LENGTH_ENCODE_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_RUN_LENGTH_ENCODE_HPP_
+
+#include <type_traits>
+#include <iterator>
+
+#include "../../detail/merge_path.hpp"
+#include "../../detail/various.hpp"
+#include "../../intrinsics.hpp"
+#include "../../functional.hpp"
+#include "../../types.hpp"
+#include "../../types/tuple.hpp"
+
+#include "../../block/block_load.hpp"
+#include "../../block/block_scan.hpp"
+#include "../../block/block_discontinuity.hpp"
+#include "../../iterator/counting_iterator.hpp"
+
+#include "lookback_scan_state.hpp"
+#include "ordered_block_id.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// (number of runs, offset of the last head) pairs, the offset of the last head of a prefix
+// is the largest offset of its heads.
+using run_length_pair = ::rocprim::tuple<unsigned int, unsigned int>;
+
+struct run_length_scan_op
+{
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    run_length_pair operator()(const run_length_pair& a, const run_length_pair& b) const
+    {
+        return run_length_pair(::rocprim::get<0>(a) + ::rocprim::get<0>(b),
+                               ::rocprim::max(::rocprim::get<1>(a), ::rocprim::get<1>(b)));
+    }
+};
+
+// Flags a discontinuity between different keys, and at the end of the valid items, so the last
+// valid item is a tail.
+template<class EqualityOp>
+struct run_length_flag_op
+{
+    EqualityOp   equality_op;
+    unsigned int valid_count;
+
+    template<class T>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    bool operator()(const T& a, const T& b, unsigned int b_index) const
+    {
+        return b_index >= valid_count || !equality_op(a, b);
+    }
+};
+
+// Stores the first item of a run at its head and the length of the run at its tail
+template<bool NonTrivialRuns,
+         class KeyType,
+         unsigned int ItemsPerThread,
+         class UniqueOutputIterator,
+         class CountsOutputIterator>
+ROCPRIM_DEVICE ROCPRIM_INLINE auto run_length_store(KeyType (&keys)[ItemsPerThread],
+                                                    bool (&head_flags)[ItemsPerThread],
+                                                    bool (&tail_flags)[ItemsPerThread],
+                                                    run_length_pair (&pairs)[ItemsPerThread],
+                                                    const unsigned int   thread_offset,
+                                                    UniqueOutputIterator unique_output,
+                                                    CountsOutputIterator counts_output) ->
+    typename std::enable_if<!NonTrivialRuns>::type
+{
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        const unsigned int run_index = ::rocprim::get<0>(pairs[i]) - 1;
+        if(head_flags[i])
+        {
+            unique_output[run_index] = keys[i];
+        }
+        if(tail_flags[i])
+        {
+            counts_output[run_index] = thread_offset + i + 1 - ::rocprim::get<1>(pairs[i]);
+        }
+    }
+}
+
+// Stores the offset and the length of a run of at least two items at its tail
+template<bool NonTrivialRuns,
+         class KeyType,
+         unsigned int ItemsPerThread,
+         class OffsetsOutputIterator,
+         class CountsOutputIterator>
+ROCPRIM_DEVICE ROCPRIM_INLINE auto run_length_store(KeyType (&/*keys*/)[ItemsPerThread],
+                                                    bool (&head_flags)[ItemsPerThread],
+                                                    bool (&tail_flags)[ItemsPerThread],
+                                                    run_length_pair (&pairs)[ItemsPerThread],
+                                                    const unsigned int    thread_offset,
+                                                    OffsetsOutputIterator offsets_output,
+                                                    CountsOutputIterator  counts_output) ->
+    typename std::enable_if<NonTrivialRuns>::type
+{
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        // A tail which is not a head ends a run of at least two items
+        if(tail_flags[i] && !head_flags[i])
+        {
+            const unsigned int run_index = ::rocprim::get<0>(pairs[i]) - 1;
+            const unsigned int head_offset = ::rocprim::get<1>(pairs[i]);
+            offsets_output[run_index] = head_offset;
+            counts_output[run_index] = thread_offset + i + 1 - head_offset;
+        }
+    }
+}
+
+// Run-length encoding in one look-back pass. Heads and tails of runs are flagged by
+// block_discontinuity, the scan of (run count, last head offset) pairs gives the index of the run
+// of every item and the offset of its head. The first item of a run is stored at its head,
+// the length at its tail. With NonTrivialRuns only runs longer than one item are counted, and
+// the offset of the head is stored instead of the first item.
+template<bool NonTrivialRuns,
+         class Config,
+         class InputIterator,
+         class FirstOutputIterator,
+         class CountsOutputIterator,
+         class RunsCountOutputIterator,
+         class EqualityOp,
+         class RunLookbackScanState>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+    run_length_encode_kernel_impl(InputIterator                  input,
+                                  const unsigned int             size,
+                                  FirstOutputIterator            first_output,
+                                  CountsOutputIterator           counts_output,
+                                  RunsCountOutputIterator        runs_count_output,
+                                  EqualityOp                     equality_op,
+                                  RunLookbackScanState           scan_state,
+                                  const unsigned int             number_of_blocks,
+                                  ordered_block_id<unsigned int> ordered_bid)
+{
+    constexpr auto block_size = Config::block_size;
+    constexpr auto items_per_thread = Config::items_per_thread;
+    constexpr unsigned int items_per_block = block_size * items_per_thread;
+
+    using key_type = typename std::iterator_traits<InputIterator>::value_type;
+    using pair_type = run_length_pair;
+    static_assert(std::is_same<pair_type, typename RunLookbackScanState::value_type>::value,
+                  "value_type of RunLookbackScanState must be run_length_pair");
+
+    using block_load_key_type = ::rocprim::block_load<
+        key_type, block_size, items_per_thread,
+        Config::key_block_load_method
+    >;
+    using block_discontinuity_key_type = ::rocprim::block_discontinuity<
+        key_type, block_size
+    >;
+    using block_scan_pair_type = ::rocprim::block_scan<
+        pair_type, block_size,
+        Config::block_scan_method
+    >;
+    using order_bid_type = ordered_block_id<unsigned int>;
+    using pair_scan_prefix_op_type = offset_lookback_scan_prefix_op<
+        pair_type, RunLookbackScanState, run_length_scan_op
+    >;
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        typename order_bid_type::storage_type ordered_bid;
+        union
+        {
+            typename block_load_key_type::storage_type load_keys;
+            typename block_discontinuity_key_type::storage_type discontinuity_keys;
+            typename block_scan_pair_type::storage_type scan_pairs;
+        };
+    } storage;
+
+    const auto flat_block_thread_id = ::rocprim::detail::block_thread_id<0>();
+    const auto flat_block_id = ordered_bid.get(flat_block_thread_id, storage.ordered_bid);
+    const unsigned int block_offset = flat_block_id * items_per_block;
+    const bool is_first_block = flat_block_id == 0;
+    const bool is_last_block = flat_block_id == (number_of_blocks - 1);
+    const unsigned int valid_in_block
+        = is_last_block ? size - block_offset : items_per_block;
+
+    key_type keys[items_per_thread];
+    if(is_last_block)
+    {
+        block_load_key_type().load(input + block_offset,
+                                   keys,
+                                   valid_in_block,
+                                   storage.load_keys);
+    }
+    else
+    {
+        block_load_key_type().load(input + block_offset, keys, storage.load_keys);
+    }
+    ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+    // The successor of a full block is compared with its last item, it is never past the end
+    const run_length_flag_op<EqualityOp> flag_op{
+        equality_op, is_last_block ? valid_in_block : items_per_block + 1};
+
+    bool head_flags[items_per_thread];
+    bool tail_flags[items_per_thread];
+    if(is_first_block && is_last_block)
+    {
+        block_discontinuity_key_type().flag_heads_and_tails(
+            head_flags, tail_flags, keys, flag_op, storage.discontinuity_keys);
+    }
+    else if(is_first_block)
+    {
+        const key_type tile_successor = input[block_offset + items_per_block];
+        block_discontinuity_key_type().flag_heads_and_tails(
+            head_flags, tail_flags, tile_successor, keys, flag_op, storage.discontinuity_keys);
+    }
+    else if(is_last_block)
+    {
+        const key_type tile_predecessor = input[block_offset - 1];
+        block_discontinuity_key_type().flag_heads_and_tails(
+            head_flags, tile_predecessor, tail_flags, keys, flag_op, storage.discontinuity_keys);
+    }
+    else
+    {
+        const key_type tile_predecessor = input[block_offset - 1];
+        const key_type tile_successor = input[block_offset + items_per_block];
+        block_discontinuity_key_type().flag_heads_and_tails(head_flags,
+                                                            tile_predecessor,
+                                                            tail_flags,
+                                                            tile_successor,
+                                                            keys,
+                                                            flag_op,
+                                                            storage.discontinuity_keys);
+    }
+    ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+    pair_type pairs[items_per_thread];
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; i++)
+    {
+        const unsigned int item_index = flat_block_thread_id * items_per_thread + i;
+        if(item_index >= valid_in_block)
+        {
+            head_flags[i] = false;
+            tail_flags[i] = false;
+        }
+        const bool is_counted_head = NonTrivialRuns ? head_flags[i] && !tail_flags[i]
+                                                    : head_flags[i];
+        pairs[i] = pair_type(is_counted_head ? 1 : 0, head_flags[i] ? block_offset + item_index : 0);
+    }
+
+    // Runs in previous blocks and in this block
+    pair_type prefix(0, 0);
+    pair_type reduction;
+    if(is_first_block)
+    {
+        block_scan_pair_type().inclusive_scan(pairs,
+                                              pairs,
+                                              reduction,
+                                              storage.scan_pairs,
+                                              run_length_scan_op());
+        if(flat_block_thread_id == 0)
+        {
+            scan_state.set_complete(flat_block_id, reduction);
+        }
+    }
+    else
+    {
+        ROCPRIM_SHARED_MEMORY typename pair_scan_prefix_op_type::storage_type storage_prefix_op;
+        auto prefix_op = pair_scan_prefix_op_type(
+            flat_block_id,
+            scan_state,
+            storage_prefix_op,
+            run_length_scan_op()
+        );
+        block_scan_pair_type().inclusive_scan(
+            pairs, pairs, storage.scan_pairs, prefix_op, run_length_scan_op());
+        ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+        reduction = prefix_op.get_reduction();
+        prefix    = prefix_op.get_prefix();
+    }
+
+    run_length_store<NonTrivialRuns>(keys,
+                                     head_flags,
+                                     tail_flags,
+                                     pairs,
+                                     block_offset + flat_block_thread_id * items_per_thread,
+                                     first_output,
+                                     counts_output);
+
+    // Last block in grid stores number of runs
+    if(is_last_block && flat_block_thread_id == 0)
+    {
+        runs_count_output[0] = ::rocprim::get<0>(run_length_scan_op()(prefix, reduction));
+    }
+}
+
+struct run_length_decode_offset_less
+{
+    template<class T, class U>
+    ROCPRIM_HOST_DEVICE inline
+    bool operator()(const T& a, const U& b) const
+    {
+        return static_cast<size_t>(a) < static_cast<size_t>(b);
+    }
+};
+
+// Run-length decoding by merge path. The end offsets of the runs are merged with the indices of
+// the output items, an item belongs to the run of the first end offset greater than its index.
+// Every block walks an equal part of the path in tiles of items_per_block steps. The bounds of
+// a tile are found by one search in the end offsets, and the end offsets of the runs of the tile
+// are staged in shared memory, so the threads search only in the tile.
+template<class Config, class ValuesInputIterator, class OutputIterator>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void run_length_decode_kernel_impl(ValuesInputIterator values_input,
+                                   const size_t*       end_offsets,
+                                   const size_t        runs,
+                                   OutputIterator      output)
+{
+    constexpr unsigned int block_size       = Config::block_size;
+    constexpr unsigned int items_per_thread = Config::items_per_thread;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        size_t tile_runs_begin;
+        size_t tile_runs_end;
+        // End offsets of the runs of the tile, relative to the first item of the tile
+        unsigned int run_ends[items_per_block];
+    } storage;
+
+    const unsigned int flat_id  = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int block_id = ::rocprim::detail::block_id<0>();
+
+    const size_t items      = end_offsets[runs - 1];
+    const size_t path_size  = runs + items;
+    const size_t block_path = ::rocprim::detail::ceiling_div<size_t>(
+        path_size, ::rocprim::detail::grid_size<0>());
+    const size_t block_begin = ::rocprim::min(path_size, block_id * block_path);
+    const size_t block_end   = ::rocprim::min(path_size, block_begin + block_path);
+
+    const ::rocprim::counting_iterator<size_t> item_indices(0);
+
+    for(size_t tile_begin = block_begin; tile_begin < block_end; tile_begin += items_per_block)
+    {
+        const size_t tile_end = ::rocprim::min(block_end, tile_begin + items_per_block);
+        if(flat_id < 2)
+        {
+            const size_t diag      = flat_id == 0 ? tile_begin : tile_end;
+            const size_t tile_runs = merge_path(end_offsets,
+                                                item_indices,
+                                                runs,
+                                                items,
+                                                diag,
+                                                run_length_decode_offset_less());
+            if(flat_id == 0)
+            {
+                storage.tile_runs_begin = tile_runs;
+            }
+            else
+            {
+                storage.tile_runs_end = tile_runs;
+            }
+        }
+        ::rocprim::syncthreads();
+
+        const size_t       tile_runs_begin = storage.tile_runs_begin;
+        const size_t       tile_items_begin = tile_begin - tile_runs_begin;
+        const unsigned int tile_runs
+            = static_cast<unsigned int>(storage.tile_runs_end - tile_runs_begin);
+        const unsigned int tile_items
+            = static_cast<unsigned int>(tile_end - tile_begin) - tile_runs;
+
+        // The end offsets of the runs of the tile are in [tile_items_begin, tile_items_end]
+        for(unsigned int i = flat_id; i < tile_runs; i += block_size)
+        {
+            storage.run_ends[i]
+                = static_cast<unsigned int>(end_offsets[tile_runs_begin + i] - tile_items_begin);
+        }
+        ::rocprim::syncthreads();
+
+        const unsigned int thread_begin
+            = ::rocprim::min(tile_runs + tile_items, flat_id * items_per_thread);
+        unsigned int run  = merge_path(storage.run_ends,
+                                      item_indices,
+                                      tile_runs,
+                                      tile_items,
+                                      thread_begin,
+                                      run_length_decode_offset_less());
+        unsigned int item = thread_begin - run;
+
+        // Walk the thread's part of the path, the values are read once for every run
+        value_type value;
+        bool       loaded = false;
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < items_per_thread; i++)
+        {
+            if(run < tile_runs && storage.run_ends[run] <= item)
+            {
+                run++;
+                loaded = false;
+            }
+            else if(item < tile_items)
+            {
+                if(!loaded)
+                {
+                    value  = values_input[tile_runs_begin + run];
+                    loaded = true;
+                }
+                output[tile_items_begin + item] = value;
+                item++;
+            }
+        }
+        ::rocprim::syncthreads(); // sync threads to reuse shared memory
+    }
+}
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_RUN_LENGTH_ENCODE_HPP_
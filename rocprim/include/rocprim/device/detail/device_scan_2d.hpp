@@ -0,0 +1,310 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_SCAN_2D_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_SCAN_2D_HPP_
+
+#include <iterator>
+#include <type_traits>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../functional.hpp"
+#include "../../intrinsics.hpp"
+#include "../../types.hpp"
+
+#include "../../block/block_axis_scan.hpp"
+#include "../../block/block_load_func.hpp"
+#include "../../block/block_store_func.hpp"
+
+#include "lookback_scan_state.hpp"
+#include "ordered_block_id.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Look-back along one line of tiles, a row or a column of the image. The entries of the tiles of
+// a line are consecutive, starting at first. Publishes the aggregate of the tile at position
+// index of the line and returns the reduction of the aggregates of the preceding tiles, which
+// is not used by the first tile of the line. The first tile always completes without looking
+// back, so the look-back of the other tiles stops at it at the latest.
+template<class T, class BinaryFunction, class LookbackScanState>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+T scan_2d_look_back(LookbackScanState& state,
+                    const unsigned int first,
+                    const unsigned int index,
+                    const T            aggregate,
+                    BinaryFunction     scan_op)
+{
+    using flag_type = typename LookbackScanState::flag_type;
+
+    if(index == 0)
+    {
+        state.set_complete(first, aggregate);
+        return aggregate;
+    }
+    state.set_partial(first + index, aggregate);
+
+    flag_type    flag;
+    T            carry;
+    unsigned int previous = index - 1;
+    state.get(first + previous, flag, carry);
+    while(flag != PREFIX_COMPLETE)
+    {
+        T value;
+        previous--;
+        state.get(first + previous, flag, value);
+        carry = scan_op(value, carry);
+    }
+    state.set_complete(first + index, scan_op(carry, aggregate));
+    return carry;
+}
+
+// Summed-area table of a row-major image in one pass. A tile has block_size_y rows of
+// block_size_x * items_per_thread items, every thread holds consecutive items of a row.
+// The rows of a tile are scanned in registers, then completed with the carries from the tiles
+// to the left, looked back along the rows of row_state. The columns are scanned next and
+// completed with the carries from the tiles above, looked back along the columns of
+// column_state. Tiles are processed in the row-major order of their ids, so all tiles to the
+// left and above are already running and the look-backs cannot deadlock. The scan operator
+// must be associative and commutative, because the order of the operands is row-by-row within
+// a tile and column-by-column between tiles.
+//
+// The exclusive scan stores initial_value combined with the inclusive scan of an item to the
+// next item of the row and the column, and initial_value to the first row and column.
+template<bool Exclusive,
+         class Config,
+         class ResultType,
+         class InputIterator,
+         class OutputIterator,
+         class BinaryFunction,
+         class LookbackScanState>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void scan_2d_kernel_impl(InputIterator                  input,
+                         OutputIterator                 output,
+                         const unsigned int             width,
+                         const unsigned int             height,
+                         const unsigned int             tile_columns,
+                         ResultType                     initial_value,
+                         BinaryFunction                 scan_op,
+                         LookbackScanState              row_state,
+                         LookbackScanState              column_state,
+                         ordered_block_id<unsigned int> ordered_bid)
+{
+    using result_type = ResultType;
+    static_assert(std::is_same<result_type, typename LookbackScanState::value_type>::value,
+                  "value_type of LookbackScanState must be result_type");
+
+    constexpr unsigned int block_size_x     = Config::block_size_x;
+    constexpr unsigned int block_size_y     = Config::block_size_y;
+    constexpr unsigned int block_size       = block_size_x * block_size_y;
+    constexpr unsigned int items_per_thread = Config::items_per_thread;
+    constexpr unsigned int tile_width       = block_size_x * items_per_thread;
+    constexpr unsigned int tile_height      = block_size_y;
+
+    using row_scan_type
+        = ::rocprim::block_axis_scan<result_type, block_size_x, block_size_y, block_axis::x>;
+    using column_scan_type
+        = ::rocprim::block_axis_scan<result_type, block_size_x, block_size_y, block_axis::y>;
+    using order_bid_type = ordered_block_id<unsigned int>;
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        typename order_bid_type::storage_type ordered_bid;
+        union
+        {
+            typename row_scan_type::storage_type    row_scan;
+            typename column_scan_type::storage_type column_scan;
+        };
+        // The aggregates and then the carries of the rows and the columns of the tile
+        raw_storage<result_type[tile_height]> rows;
+        raw_storage<result_type[tile_width]>  columns;
+    } storage;
+
+    const unsigned int x       = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int y       = ::rocprim::detail::block_thread_id<1>();
+    const unsigned int flat_id = y * block_size_x + x;
+
+    const unsigned int tile        = ordered_bid.get(flat_id, storage.ordered_bid);
+    const unsigned int band        = tile / tile_columns;
+    const unsigned int tile_column = tile % tile_columns;
+    const unsigned int bands       = ::rocprim::detail::ceiling_div(height, tile_height);
+
+    const unsigned int tile_x        = tile_column * tile_width;
+    const unsigned int tile_y        = band * tile_height;
+    const unsigned int valid_columns = ::rocprim::min(width - tile_x, tile_width);
+    const unsigned int valid_rows    = ::rocprim::min(height - tile_y, tile_height);
+    const bool         is_valid_row  = y < valid_rows;
+    const unsigned int thread_offset = x * items_per_thread;
+
+    // Threads past the last row load it again and threads past the last column load the first
+    // item of their row, so all values are valid. They only affect the items after them.
+    const unsigned int row       = tile_y + ::rocprim::min(y, valid_rows - 1);
+    const auto         row_input = input + static_cast<size_t>(row) * width + tile_x;
+
+    result_type values[items_per_thread];
+    block_load_direct_blocked(x,
+                              row_input,
+                              values,
+                              valid_columns,
+                              static_cast<result_type>(row_input[0]));
+
+    // Scan the rows of the tile
+    ROCPRIM_UNROLL
+    for(unsigned int i = 1; i < items_per_thread; i++)
+    {
+        values[i] = scan_op(values[i - 1], values[i]);
+    }
+    result_type thread_prefix;
+    row_scan_type().inclusive_scan(values[items_per_thread - 1],
+                                   thread_prefix,
+                                   storage.row_scan,
+                                   scan_op);
+    // The inclusive scan of the previous thread of the row is the prefix of this thread
+    thread_prefix = ::rocprim::warp_shuffle_up(thread_prefix, 1, block_size_x);
+    if(x > 0)
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < items_per_thread; i++)
+        {
+            values[i] = scan_op(thread_prefix, values[i]);
+        }
+    }
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; i++)
+    {
+        if(is_valid_row && thread_offset + i == valid_columns - 1)
+        {
+            storage.rows.get()[y] = values[i];
+        }
+    }
+    ::rocprim::syncthreads();
+
+    if(x == 0 && is_valid_row)
+    {
+        storage.rows.get()[y] = scan_2d_look_back(row_state,
+                                                  row * tile_columns,
+                                                  tile_column,
+                                                  storage.rows.get()[y],
+                                                  scan_op);
+    }
+    ::rocprim::syncthreads();
+
+    if(tile_column > 0 && is_valid_row)
+    {
+        const result_type carry = storage.rows.get()[y];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < items_per_thread; i++)
+        {
+            values[i] = scan_op(carry, values[i]);
+        }
+    }
+
+    // Scan the columns of the tile
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; i++)
+    {
+        column_scan_type().inclusive_scan(values[i], values[i], storage.column_scan, scan_op);
+        ::rocprim::syncthreads();
+    }
+
+    if(y == valid_rows - 1)
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < items_per_thread; i++)
+        {
+            if(thread_offset + i < valid_columns)
+            {
+                storage.columns.get()[thread_offset + i] = values[i];
+            }
+        }
+    }
+    ::rocprim::syncthreads();
+
+    for(unsigned int column = flat_id; column < valid_columns; column += block_size)
+    {
+        storage.columns.get()[column] = scan_2d_look_back(column_state,
+                                                          (tile_x + column) * bands,
+                                                          band,
+                                                          storage.columns.get()[column],
+                                                          scan_op);
+    }
+    ::rocprim::syncthreads();
+
+    if(band > 0)
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < items_per_thread; i++)
+        {
+            if(thread_offset + i < valid_columns)
+            {
+                values[i] = scan_op(storage.columns.get()[thread_offset + i], values[i]);
+            }
+        }
+    }
+
+    if ROCPRIM_IF_CONSTEXPR(Exclusive)
+    {
+        if(band == 0)
+        {
+            for(unsigned int column = flat_id; column < valid_columns; column += block_size)
+            {
+                output[tile_x + column] = initial_value;
+            }
+        }
+        if(tile_column == 0 && flat_id < valid_rows)
+        {
+            output[static_cast<size_t>(tile_y + flat_id) * width] = initial_value;
+        }
+
+        if(is_valid_row && row + 1 < height)
+        {
+            const auto shifted_output
+                = output + static_cast<size_t>(row + 1) * width + tile_x + 1 + thread_offset;
+            ROCPRIM_UNROLL
+            for(unsigned int i = 0; i < items_per_thread; i++)
+            {
+                if(thread_offset + i < valid_columns && tile_x + thread_offset + i + 1 < width)
+                {
+                    shifted_output[i] = scan_op(initial_value, values[i]);
+                }
+            }
+        }
+    }
+    else
+    {
+        if(is_valid_row)
+        {
+            block_store_direct_blocked(x,
+                                       output + static_cast<size_t>(row) * width + tile_x,
+                                       values,
+                                       valid_columns);
+        }
+    }
+}
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_SCAN_2D_HPP_
@@ -251,7 +251,8 @@ namespace detail
               typename ResultType,
               typename CompareFunction,
               typename BinaryFunction,
-              typename LookbackScanState>
+              typename LookbackScanState,
+              typename TotalOutputIterator>
     ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void device_scan_by_key_kernel_impl(
         KeyInputIterator                              keys,
         InputIterator                                 values,
@@ -264,7 +265,8 @@ namespace detail
         const size_t                                  starting_block,
         const size_t                                  number_of_blocks,
         ordered_block_id<unsigned int>                ordered_bid,
-        const rocprim::tuple<ResultType, bool>* const previous_last_value)
+        const rocprim::tuple<ResultType, bool>* const previous_last_value,
+        TotalOutputIterator                           total_output)
     {
         using result_type = ResultType;
         static_assert(std::is_same<rocprim::tuple<ResultType, bool>,
@@ -380,6 +382,29 @@ namespace detail
                               size,
                               wrapped_values,
                               storage.store);
+
+        // The total is the scan of the last segment up to and including the last item
+        if(starting_block + flat_block_id == number_of_blocks - 1)
+        {
+            constexpr unsigned int items_per_block = block_size * items_per_thread;
+
+            const unsigned int last_item
+                = static_cast<unsigned int>(size - items_per_block * (number_of_blocks - 1) - 1);
+            if(flat_thread_id == last_item / items_per_thread)
+            {
+                for(unsigned int i = 0; i < items_per_thread; i++)
+                {
+                    if(i == last_item % items_per_thread)
+                    {
+                        write_scan_total<Exclusive>(total_output,
+                                                    values + flat_block_id * items_per_block
+                                                        + last_item,
+                                                    rocprim::get<0>(wrapped_values[i]),
+                                                    scan_op);
+                    }
+                }
+            }
+        }
     }
 } // namespace detail
 
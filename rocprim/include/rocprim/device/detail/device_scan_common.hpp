@@ -54,12 +54,12 @@ ROCPRIM_DEVICE ROCPRIM_INLINE void
     }
 }
 
-template<typename LookBackScanState>
+template<typename LookBackScanState, typename OrderedBlockId>
 ROCPRIM_DEVICE ROCPRIM_INLINE void
-    init_lookback_scan_state(LookBackScanState              lookback_scan_state,
-                             const unsigned int             number_of_blocks,
-                             ordered_block_id<unsigned int> ordered_bid,
-                             unsigned int                   flat_thread_id)
+    init_lookback_scan_state(LookBackScanState  lookback_scan_state,
+                             const unsigned int number_of_blocks,
+                             OrderedBlockId     ordered_bid,
+                             unsigned int       flat_thread_id)
 {
     // Reset ordered_block_id.
     if(flat_thread_id == 0)
@@ -71,32 +71,44 @@ ROCPRIM_DEVICE ROCPRIM_INLINE void
     lookback_scan_state.initialize_prefix(flat_thread_id, number_of_blocks);
 }
 
-template<typename LookBackScanState>
+template<typename LookBackScanState, typename OrderedBlockId = ordered_block_id<unsigned int>>
 ROCPRIM_KERNEL
     __launch_bounds__(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE) void init_lookback_scan_state_kernel(
         LookBackScanState                             lookback_scan_state,
         const unsigned int                            number_of_blocks,
-        ordered_block_id<unsigned int>                ordered_bid,
+        OrderedBlockId                                ordered_bid,
         unsigned int                                  save_index = 0,
         typename LookBackScanState::value_type* const save_dest  = nullptr)
 {
     const unsigned int block_id        = ::rocprim::detail::block_id<0>();
     const unsigned int block_size      = ::rocprim::detail::block_size<0>();
     const unsigned int block_thread_id = ::rocprim::detail::block_thread_id<0>();
-    const unsigned int flat_thread_id  = (block_id * block_size) + block_thread_id;
-
-    // Save the reduction (i.e. the last prefix) from the previous user of lookback_scan_state.
-    if(save_dest != nullptr)
+    const unsigned int grid_threads    = ::rocprim::detail::grid_size<0>() * block_size;
+
+    // The grid can be smaller than the number of prefixes when it is limited by
+    // scoped_grid_limit, then threads initialize multiple prefixes. The value of save_index
+    // is saved by the same thread that resets it.
+    for(unsigned int flat_thread_id = (block_id * block_size) + block_thread_id;
+        flat_thread_id < number_of_blocks || flat_thread_id < ::rocprim::device_warp_size();
+        flat_thread_id += grid_threads)
     {
-        access_indexed_lookback_value(lookback_scan_state,
-                                      number_of_blocks,
-                                      save_index,
-                                      flat_thread_id,
-                                      [&](typename LookBackScanState::value_type value)
-                                      { *save_dest = value; });
+        // Save the reduction (i.e. the last prefix) from the previous user of
+        // lookback_scan_state.
+        if(save_dest != nullptr)
+        {
+            access_indexed_lookback_value(lookback_scan_state,
+                                          number_of_blocks,
+                                          save_index,
+                                          flat_thread_id,
+                                          [&](typename LookBackScanState::value_type value)
+                                          { *save_dest = value; });
+        }
+
+        init_lookback_scan_state(lookback_scan_state,
+                                 number_of_blocks,
+                                 ordered_bid,
+                                 flat_thread_id);
     }
-
-    init_lookback_scan_state(lookback_scan_state, number_of_blocks, ordered_bid, flat_thread_id);
 }
 
     template <bool Exclusive,
@@ -177,6 +189,58 @@ ROCPRIM_KERNEL
                                    scan_op);
     }
 
+// The input of an inclusive scan which continues a previous scan, the prefix is combined with
+// the first item. No prefix is combined when it is nullptr.
+template<class InputIterator, class T, class BinaryFunction>
+struct scan_first_combined_op
+{
+    InputIterator  input;
+    const T*       prefix;
+    BinaryFunction scan_op;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    T operator()(const size_t i) const
+    {
+        const T value = input[i];
+        return i == 0 && prefix != nullptr ? scan_op(*prefix, value) : value;
+    }
+};
+
+// The total of a scan is not written
+struct scan_no_total_output
+{};
+
+template<bool Exclusive, class InputIterator, class T, class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void write_scan_total(scan_no_total_output /*total_output*/,
+                      InputIterator /*last_input*/,
+                      const T& /*last_value*/,
+                      BinaryFunction /*scan_op*/)
+{}
+
+// Writes the total of a scan by the thread with the last item: the last output of an inclusive
+// scan, or the last output of an exclusive scan combined with the last input.
+template<bool Exclusive,
+         class TotalOutputIterator,
+         class InputIterator,
+         class T,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void write_scan_total(TotalOutputIterator total_output,
+                      InputIterator       last_input,
+                      const T&            last_value,
+                      BinaryFunction      scan_op)
+{
+    if ROCPRIM_IF_CONSTEXPR(Exclusive)
+    {
+        *total_output = scan_op(last_value, static_cast<T>(*last_input));
+    }
+    else
+    {
+        *total_output = last_value;
+    }
+}
+
 } // namespace detail
 
 END_ROCPRIM_NAMESPACE
@@ -55,19 +55,7 @@ template<
     class ResultType,
     class LookbackScanState
 >
-ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
-void lookback_scan_kernel_impl(InputIterator input,
-                               OutputIterator output,
-                               const size_t size,
-                               ResultType initial_value,
-                               BinaryFunction scan_op,
-                               LookbackScanState scan_state,
-                               const unsigned int number_of_blocks,
-                               ordered_block_id<unsigned int> ordered_bid,
-                               ResultType * previous_last_element = nullptr,
-                               ResultType * new_last_element = nullptr,
-                               bool override_first_value = false,
-                               bool save_last_value = false)
+struct lookback_scan_block
 {
     using result_type = ResultType;
     static_assert(
@@ -75,9 +63,9 @@ void lookback_scan_kernel_impl(InputIterator input,
         "value_type of LookbackScanState must be result_type"
     );
 
-    constexpr auto block_size = Config::block_size;
-    constexpr auto items_per_thread = Config::items_per_thread;
-    constexpr unsigned int items_per_block = block_size * items_per_thread;
+    static constexpr auto block_size = Config::block_size;
+    static constexpr auto items_per_thread = Config::items_per_thread;
+    static constexpr unsigned int items_per_block = block_size * items_per_thread;
 
     using block_load_type = ::rocprim::block_load<
         result_type, block_size, items_per_thread,
@@ -92,12 +80,13 @@ void lookback_scan_kernel_impl(InputIterator input,
         Config::block_scan_method
     >;
 
-    using order_bid_type = ordered_block_id<unsigned int>;
+    using order_bid_type = striped_ordered_block_id<unsigned int>;
     using lookback_scan_prefix_op_type = lookback_scan_prefix_op<
-        result_type, BinaryFunction, LookbackScanState
+        result_type, BinaryFunction, LookbackScanState,
+        config_lookback_backoff_type<Config, LookbackScanState>
     >;
 
-    ROCPRIM_SHARED_MEMORY struct
+    struct storage_type
     {
         typename order_bid_type::storage_type ordered_bid;
         union
@@ -106,112 +95,198 @@ void lookback_scan_kernel_impl(InputIterator input,
             typename block_store_type::storage_type store;
             typename block_scan_type::storage_type scan;
         };
-    } storage;
-
-    const auto flat_block_thread_id = ::rocprim::detail::block_thread_id<0>();
-    const auto flat_block_id = ordered_bid.get(flat_block_thread_id, storage.ordered_bid);
-    const unsigned int block_offset = flat_block_id * items_per_block;
-    const auto valid_in_last_block = size - items_per_block * (number_of_blocks - 1);
-
-    // For input values
-    result_type values[items_per_thread];
+    };
 
-    // load input values into values
-    if(flat_block_id == (number_of_blocks - 1)) // last block
+    // Scans the tile flat_block_id, size is the number of items in the whole input.
+    template<class TotalOutputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void scan(InputIterator input,
+              OutputIterator output,
+              const size_t size,
+              ResultType initial_value,
+              BinaryFunction scan_op,
+              LookbackScanState scan_state,
+              const unsigned int number_of_blocks,
+              const unsigned int flat_block_id,
+              ResultType * previous_last_element,
+              ResultType * new_last_element,
+              bool override_first_value,
+              bool save_last_value,
+              TotalOutputIterator total_output,
+              storage_type& storage)
     {
-        block_load_type()
-            .load(
-                input + block_offset,
-                values,
-                valid_in_last_block,
-                *(input + block_offset),
-                storage.load
-            );
-    }
-    else
-    {
-        block_load_type()
-            .load(
-                input + block_offset,
-                values,
-                storage.load
-            );
-    }
-    ::rocprim::syncthreads(); // sync threads to reuse shared memory
+        const auto flat_block_thread_id = ::rocprim::detail::block_thread_id<0>();
+        // 64-bit offsets: the input may have more than 2^32 items
+        const size_t block_offset = static_cast<size_t>(flat_block_id) * items_per_block;
+        const unsigned int valid_in_last_block = static_cast<unsigned int>(
+            size - static_cast<size_t>(items_per_block) * (number_of_blocks - 1));
 
-    if(flat_block_id == 0)
-    {
-        // override_first_value only true when the first chunk already processed
-        // and input iterator starts from an offset.
-        if(override_first_value)
+        // For input values
+        result_type values[items_per_thread];
+
+        // load input values into values
+        if(flat_block_id == (number_of_blocks - 1)) // last block
         {
-            if(Exclusive)
-                initial_value = scan_op(previous_last_element[0], static_cast<result_type>(*(input-1)));
-            else if(flat_block_thread_id == 0)
-                values[0] = scan_op(previous_last_element[0], values[0]);
+            block_load_type()
+                .load(
+                    input + block_offset,
+                    values,
+                    valid_in_last_block,
+                    *(input + block_offset),
+                    storage.load
+                );
         }
-
-        result_type reduction;
-        lookback_block_scan<Exclusive, block_scan_type>(
-            values, // input/output
-            initial_value,
-            reduction,
-            storage.scan,
-            scan_op
-        );
-
-        if(flat_block_thread_id == 0)
+        else
         {
-            scan_state.set_complete(flat_block_id, reduction);
+            block_load_type()
+                .load(
+                    input + block_offset,
+                    values,
+                    storage.load
+                );
         }
-    }
-    else
-    {
-        // Scan of block values
-        auto prefix_op = lookback_scan_prefix_op_type(
-            flat_block_id, scan_op, scan_state
-        );
-        lookback_block_scan<Exclusive, block_scan_type>(
-            values, // input/output
-            storage.scan,
-            prefix_op,
-            scan_op
-        );
-    }
-    ::rocprim::syncthreads(); // sync threads to reuse shared memory
+        ::rocprim::syncthreads(); // sync threads to reuse shared memory
 
-    // Save values into output array
-    if(flat_block_id == (number_of_blocks - 1)) // last block
-    {
-        block_store_type()
-            .store(
-                output + block_offset,
-                values,
-                valid_in_last_block,
-                storage.store
+        if(flat_block_id == 0)
+        {
+            // override_first_value only true when the first chunk already processed
+            // and input iterator starts from an offset.
+            if(override_first_value)
+            {
+                if(Exclusive)
+                    initial_value = scan_op(previous_last_element[0], static_cast<result_type>(*(input-1)));
+                else if(flat_block_thread_id == 0)
+                    values[0] = scan_op(previous_last_element[0], values[0]);
+            }
+
+            result_type reduction;
+            lookback_block_scan<Exclusive, block_scan_type>(
+                values, // input/output
+                initial_value,
+                reduction,
+                storage.scan,
+                scan_op
+            );
+
+            if(flat_block_thread_id == 0)
+            {
+                scan_state.set_complete(flat_block_id, reduction);
+            }
+        }
+        else
+        {
+            // Scan of block values
+            auto prefix_op = lookback_scan_prefix_op_type(
+                flat_block_id, scan_op, scan_state
+            );
+            lookback_block_scan<Exclusive, block_scan_type>(
+                values, // input/output
+                storage.scan,
+                prefix_op,
+                scan_op
             );
+        }
+        ::rocprim::syncthreads(); // sync threads to reuse shared memory
 
-        if(save_last_value &&
-           (::rocprim::detail::block_thread_id<0>() ==
-           (valid_in_last_block - 1) / items_per_thread))
+        // Save values into output array
+        if(flat_block_id == (number_of_blocks - 1)) // last block
         {
-            for(unsigned int i = 0; i < items_per_thread; i++)
+            block_store_type()
+                .store(
+                    output + block_offset,
+                    values,
+                    valid_in_last_block,
+                    storage.store
+                );
+
+            const unsigned int last_item = valid_in_last_block - 1;
+            if(flat_block_thread_id == last_item / items_per_thread)
             {
-                if(i == (valid_in_last_block - 1) % items_per_thread)
+                for(unsigned int i = 0; i < items_per_thread; i++)
                 {
-                    new_last_element[0] = values[i];
+                    if(i == last_item % items_per_thread)
+                    {
+                        if(save_last_value)
+                        {
+                            new_last_element[0] = values[i];
+                        }
+                        write_scan_total<Exclusive>(
+                            total_output, input + block_offset + last_item, values[i], scan_op);
+                    }
                 }
             }
         }
+        else
+        {
+            block_store_type()
+                .store(
+                    output + block_offset,
+                    values,
+                    storage.store
+                );
+        }
     }
-    else
+};
+
+template<
+    bool Exclusive,
+    class Config,
+    class InputIterator,
+    class OutputIterator,
+    class BinaryFunction,
+    class ResultType,
+    class LookbackScanState,
+    class TotalOutputIterator
+>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void lookback_scan_kernel_impl(InputIterator input,
+                               OutputIterator output,
+                               const size_t size,
+                               ResultType initial_value,
+                               BinaryFunction scan_op,
+                               LookbackScanState scan_state,
+                               const unsigned int number_of_blocks,
+                               striped_ordered_block_id<unsigned int> ordered_bid,
+                               TotalOutputIterator total_output,
+                               ResultType * previous_last_element = nullptr,
+                               ResultType * new_last_element = nullptr,
+                               bool override_first_value = false,
+                               bool save_last_value = false)
+{
+    using lookback_scan_block_type = lookback_scan_block<
+        Exclusive, Config, InputIterator, OutputIterator,
+        BinaryFunction, ResultType, LookbackScanState
+    >;
+
+    ROCPRIM_SHARED_MEMORY typename lookback_scan_block_type::storage_type storage;
+
+    const auto flat_block_thread_id = ::rocprim::detail::block_thread_id<0>();
+    // A grid can be smaller than the number of tiles (the number of threads in a grid is
+    // limited), in that case every block scans tiles until all of them are processed.
+    // Tiles are scanned in the order of their ids so the look-back never waits for
+    // a tile that is not being processed by a resident block.
+    const bool multiple_tiles_per_block = ::rocprim::detail::grid_size<0>() < number_of_blocks;
+    unsigned int flat_block_id = ordered_bid.get(flat_block_thread_id, storage.ordered_bid);
+    while(true)
     {
-        block_store_type()
-            .store(
-                output + block_offset,
-                values,
-                storage.store
-            );
+        lookback_scan_block_type().scan(
+            input, output, size, initial_value, scan_op,
+            scan_state, number_of_blocks, flat_block_id,
+            previous_last_element, new_last_element,
+            override_first_value, save_last_value,
+            total_output,
+            storage
+        );
+        if(!multiple_tiles_per_block)
+        {
+            break;
+        }
+        ::rocprim::syncthreads(); // sync threads to reuse shared memory
+        flat_block_id = ordered_bid.get(flat_block_thread_id, storage.ordered_bid);
+        if(flat_block_id >= number_of_blocks)
+        {
+            break;
+        }
     }
 }
 
@@ -36,6 +36,8 @@
 #include "../../block/block_scan.hpp"
 #include "../../block/block_reduce.hpp"
 
+#include "device_scan_common.hpp"
+
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -100,14 +102,16 @@ template<
     class InputIterator,
     class OutputIterator,
     class BinaryFunction,
-    class ResultType
+    class ResultType,
+    class TotalOutputIterator
 >
 ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
 void single_scan_kernel_impl(InputIterator input,
                              const size_t input_size,
                              ResultType initial_value,
                              OutputIterator output,
-                             BinaryFunction scan_op)
+                             BinaryFunction scan_op,
+                             TotalOutputIterator total_output)
 {
     constexpr unsigned int block_size = Config::block_size;
     constexpr unsigned int items_per_thread = Config::items_per_thread;
@@ -163,6 +167,18 @@ void single_scan_kernel_impl(InputIterator input,
             input_size,
             storage.store
         );
+
+    const unsigned int last_item = static_cast<unsigned int>(input_size - 1);
+    if(::rocprim::detail::block_thread_id<0>() == last_item / items_per_thread)
+    {
+        for(unsigned int i = 0; i < items_per_thread; i++)
+        {
+            if(i == last_item % items_per_thread)
+            {
+                write_scan_total<Exclusive>(total_output, input + last_item, values[i], scan_op);
+            }
+        }
+    }
 }
 
 // Calculates block prefixes that will be used in final_scan
@@ -318,7 +334,8 @@ template<
     class InputIterator,
     class OutputIterator,
     class BinaryFunction,
-    class ResultType
+    class ResultType,
+    class TotalOutputIterator
 >
 ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
 void final_scan_kernel_impl(InputIterator input,
@@ -327,6 +344,7 @@ void final_scan_kernel_impl(InputIterator input,
                             ResultType initial_value,
                             BinaryFunction scan_op,
                             ResultType * block_prefixes,
+                            TotalOutputIterator total_output,
                             ResultType * previous_last_element = nullptr,
                             ResultType * new_last_element = nullptr,
                             bool override_first_value = false,
@@ -425,15 +443,19 @@ void final_scan_kernel_impl(InputIterator input,
                 storage.store
             );
 
-        if(save_last_value &&
-           (::rocprim::detail::block_thread_id<0>() ==
-           (valid_in_last_block - 1) / items_per_thread))
+        const unsigned int last_item = static_cast<unsigned int>(valid_in_last_block - 1);
+        if(::rocprim::detail::block_thread_id<0>() == last_item / items_per_thread)
         {
             for(unsigned int i = 0; i < items_per_thread; i++)
             {
-                if(i == (valid_in_last_block - 1) % items_per_thread)
+                if(i == last_item % items_per_thread)
                 {
-                    new_last_element[0] = values[i];
+                    if(save_last_value)
+                    {
+                        new_last_element[0] = values[i];
+                    }
+                    write_scan_total<Exclusive>(
+                        total_output, input + block_offset + last_item, values[i], scan_op);
                 }
             }
         }
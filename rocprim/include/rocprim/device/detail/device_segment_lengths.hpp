@@ -0,0 +1,137 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_SEGMENT_LENGTHS_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_SEGMENT_LENGTHS_HPP_
+
+#include <cstddef>
+#include <iterator>
+
+#include "../../config.hpp"
+#include "../../functional.hpp"
+#include "../../detail/temp_storage.hpp"
+#include "../../detail/various.hpp"
+#include "../../iterator/counting_iterator.hpp"
+#include "../../iterator/transform_iterator.hpp"
+
+#include "../device_scan.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Length of a segment, 0 for the one past the last segment, so that the exclusive scan of
+// segments + 1 lengths writes the end of the last segment too
+template<class LengthIterator, class OffsetT>
+struct segment_length_or_zero_op
+{
+    LengthIterator lengths;
+    unsigned int   segments;
+
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    OffsetT operator()(const unsigned int segment_index) const
+    {
+        LengthIterator lengths_it = lengths;
+        return segment_index < segments ? static_cast<OffsetT>(lengths_it[segment_index])
+                                        : OffsetT(0);
+    }
+};
+
+// Runs a segmented algorithm on segments given by their lengths. The offsets of the segments are
+// computed by a single exclusive scan into the temporary storage, then the algorithm is called
+// as algorithm(temporary_storage, storage_size, offsets, offsets + 1) with the rest of the
+// storage. The storage of the scan and of the algorithm is shared, as they do not overlap in time.
+template<class LengthIterator, class Algorithm>
+inline
+hipError_t segment_lengths_to_offsets(void*          temporary_storage,
+                                      size_t&        storage_size,
+                                      LengthIterator lengths,
+                                      unsigned int   segments,
+                                      Algorithm      algorithm,
+                                      hipStream_t    stream,
+                                      bool           debug_synchronous)
+{
+    using offset_type = segment_offset_type_t<LengthIterator>;
+
+    const auto lengths_input = ::rocprim::make_transform_iterator(
+        ::rocprim::counting_iterator<unsigned int>(0),
+        segment_length_or_zero_op<LengthIterator, offset_type>{lengths, segments});
+
+    offset_type* offsets{};
+    size_t       scan_storage_size{};
+    void*        scan_temporary_storage{};
+    size_t       algorithm_storage_size{};
+    void*        algorithm_temporary_storage{};
+
+    hipError_t result = ::rocprim::exclusive_scan(nullptr,
+                                                  scan_storage_size,
+                                                  lengths_input,
+                                                  offsets,
+                                                  offset_type(0),
+                                                  size_t(segments) + 1,
+                                                  ::rocprim::plus<offset_type>(),
+                                                  stream,
+                                                  debug_synchronous);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    result = algorithm(static_cast<void*>(nullptr), algorithm_storage_size, offsets, offsets + 1);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&offsets, size_t(segments) + 1),
+            detail::temp_storage::make_union_partition(
+                detail::temp_storage::make_partition(&scan_temporary_storage, scan_storage_size),
+                detail::temp_storage::make_partition(&algorithm_temporary_storage,
+                                                     algorithm_storage_size))));
+    if(result != hipSuccess || temporary_storage == nullptr)
+    {
+        return result;
+    }
+
+    result = ::rocprim::exclusive_scan(scan_temporary_storage,
+                                       scan_storage_size,
+                                       lengths_input,
+                                       offsets,
+                                       offset_type(0),
+                                       size_t(segments) + 1,
+                                       ::rocprim::plus<offset_type>(),
+                                       stream,
+                                       debug_synchronous);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    return algorithm(algorithm_temporary_storage, algorithm_storage_size, offsets, offsets + 1);
+}
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_SEGMENT_LENGTHS_HPP_
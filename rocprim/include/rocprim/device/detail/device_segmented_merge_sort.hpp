@@ -0,0 +1,624 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_SEGMENTED_MERGE_SORT_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_SEGMENTED_MERGE_SORT_HPP_
+
+#include <iterator>
+#include <type_traits>
+
+#include "../../config.hpp"
+#include "../../detail/merge_path.hpp"
+#include "../../detail/various.hpp"
+
+#include "../../intrinsics.hpp"
+#include "../../functional.hpp"
+#include "../../types.hpp"
+
+#include "../../warp/warp_load.hpp"
+#include "../../warp/warp_sort.hpp"
+#include "../../warp/warp_store.hpp"
+
+#include "device_merge_sort.hpp"
+#include "device_merge_sort_mergepath.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Keys are sorted with their index in the segment. Equal keys are ordered by the index, so the
+// sort is stable, and indices past the end of the segment are ordered after all valid keys.
+template<class Key, class BinaryFunction>
+struct segmented_merge_sort_stable_compare
+{
+    using stable_key_type = ::rocprim::tuple<Key, unsigned int>;
+
+    BinaryFunction compare_function;
+    unsigned int   valid_count;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    bool operator()(const stable_key_type& a, const stable_key_type& b)
+    {
+        const bool a_oor = ::rocprim::get<1>(a) >= valid_count;
+        const bool b_oor = ::rocprim::get<1>(b) >= valid_count;
+        if(a_oor || b_oor)
+        {
+            return !a_oor;
+        }
+        const bool ab = compare_function(::rocprim::get<0>(a), ::rocprim::get<0>(b));
+        return ab
+               || (!compare_function(::rocprim::get<0>(b), ::rocprim::get<0>(a))
+                   && ::rocprim::get<1>(a) < ::rocprim::get<1>(b));
+    }
+};
+
+template<unsigned int LogicalWarpSize, unsigned int ItemsPerThread, class Key, class Value>
+class segmented_merge_sort_warp_helper
+{
+    using key_type   = Key;
+    using value_type = Value;
+
+    using keys_load_type = ::rocprim::warp_load<key_type, ItemsPerThread, LogicalWarpSize,
+                                                ::rocprim::warp_load_method::warp_load_striped>;
+    using values_load_type = ::rocprim::warp_load<value_type, ItemsPerThread, LogicalWarpSize,
+                                                  ::rocprim::warp_load_method::warp_load_striped>;
+    using keys_store_type   = ::rocprim::warp_store<key_type, ItemsPerThread, LogicalWarpSize>;
+    using values_store_type = ::rocprim::warp_store<value_type, ItemsPerThread, LogicalWarpSize>;
+    using stable_key_type   = ::rocprim::tuple<key_type, unsigned int>;
+    using sort_type         = ::rocprim::warp_sort<stable_key_type, LogicalWarpSize, value_type>;
+
+    static constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+
+public:
+    static constexpr unsigned int items_per_warp = ItemsPerThread * LogicalWarpSize;
+
+    union storage_type
+    {
+        typename keys_load_type::storage_type    keys_load;
+        typename values_load_type::storage_type  values_load;
+        typename keys_store_type::storage_type   keys_store;
+        typename values_store_type::storage_type values_store;
+        typename sort_type::storage_type         sort;
+    };
+
+    template<
+        class KeysInputIterator,
+        class KeysOutputIterator,
+        class ValuesInputIterator,
+        class ValuesOutputIterator,
+        class BinaryFunction
+    >
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort(KeysInputIterator keys_input,
+              KeysOutputIterator keys_output,
+              ValuesInputIterator values_input,
+              ValuesOutputIterator values_output,
+              unsigned int begin_offset,
+              unsigned int end_offset,
+              BinaryFunction compare_function,
+              storage_type& storage)
+    {
+        const unsigned int num_items = end_offset - begin_offset;
+
+        key_type        keys[ItemsPerThread];
+        stable_key_type stable_keys[ItemsPerThread];
+        value_type      values[ItemsPerThread];
+        keys_load_type().load(keys_input + begin_offset, keys, num_items, storage.keys_load);
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            ::rocprim::get<0>(stable_keys[i]) = keys[i];
+            ::rocprim::get<1>(stable_keys[i]) =
+                ::rocprim::detail::logical_lane_id<LogicalWarpSize>() + LogicalWarpSize * i;
+        }
+
+        if(with_values)
+        {
+            ::rocprim::wave_barrier();
+            values_load_type().load(values_input + begin_offset, values, num_items, storage.values_load);
+        }
+
+        ::rocprim::wave_barrier();
+        sort_type().sort(stable_keys,
+                         values,
+                         storage.sort,
+                         segmented_merge_sort_stable_compare<key_type, BinaryFunction>{
+                             compare_function, num_items});
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            keys[i] = ::rocprim::get<0>(stable_keys[i]);
+        }
+        ::rocprim::wave_barrier();
+        keys_store_type().store(keys_output + begin_offset, keys, num_items, storage.keys_store);
+
+        if(with_values)
+        {
+            ::rocprim::wave_barrier();
+            values_store_type().store(values_output + begin_offset, values, num_items, storage.values_store);
+        }
+    }
+};
+
+// Block-wide steps of the sort: a block sort of one tile, and a merge path merge of one
+// output tile of two sorted runs. Both are used for segments of one block.
+template<unsigned int BlockSize, unsigned int ItemsPerThread, class Key, class Value>
+class segmented_merge_sort_block_helper
+{
+    using key_type   = Key;
+    using value_type = Value;
+
+    static constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+    static constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    using block_load_keys_type = block_load_keys_impl<BlockSize, ItemsPerThread, key_type>;
+    using block_sort_type      = block_sort_impl<BlockSize, ItemsPerThread, key_type>;
+    using block_load_values_type
+        = block_load_values_impl<with_values, BlockSize, ItemsPerThread, value_type>;
+    using block_store_type
+        = block_store_impl<with_values, BlockSize, ItemsPerThread, key_type, value_type>;
+    using stable_key_type = typename block_sort_type::stable_key_type;
+
+    // One more item is read past the end of the runs by serial_merge
+    using keys_storage_   = key_type[items_per_block + 1];
+    using values_storage_ = value_type[items_per_block + 1];
+
+public:
+    struct storage_type
+    {
+        union
+        {
+            typename block_load_keys_type::storage_type   load_keys;
+            typename block_sort_type::storage_type        sort;
+            typename block_load_values_type::storage_type load_values;
+            typename block_store_type::storage_type       store;
+            detail::raw_storage<keys_storage_>            keys;
+            detail::raw_storage<values_storage_>          values;
+        };
+        unsigned int splits[2];
+    };
+
+    // Sorts count <= items_per_block items, the iterators point to the first item of the tile
+    template<
+        class KeysInputIterator,
+        class KeysOutputIterator,
+        class ValuesInputIterator,
+        class ValuesOutputIterator,
+        class BinaryFunction
+    >
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort_tile(KeysInputIterator keys_input,
+                   KeysOutputIterator keys_output,
+                   ValuesInputIterator values_input,
+                   ValuesOutputIterator values_output,
+                   const unsigned int count,
+                   BinaryFunction compare_function,
+                   storage_type& storage)
+    {
+        const unsigned int flat_id       = block_thread_id<0>();
+        const bool         is_incomplete = count < items_per_block;
+
+        key_type keys[ItemsPerThread];
+        block_load_keys_type().load(0u, count, is_incomplete, keys_input, keys, storage.load_keys);
+
+        stable_key_type stable_keys[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int item = 0; item < ItemsPerThread; ++item)
+        {
+            stable_keys[item] = ::rocprim::make_tuple(keys[item], ItemsPerThread * flat_id + item);
+        }
+
+        // Synchronize before reusing shared memory
+        ::rocprim::syncthreads();
+
+        // The comparison orders the items past the end after the valid ones, so the sort of a
+        // complete tile is not slower with it
+        block_sort_type().sort(stable_keys,
+                               storage.sort,
+                               count,
+                               false,
+                               segmented_merge_sort_stable_compare<key_type, BinaryFunction>{
+                                   compare_function, count});
+
+        unsigned int ranks[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int item = 0; item < ItemsPerThread; ++item)
+        {
+            keys[item]  = ::rocprim::get<0>(stable_keys[item]);
+            ranks[item] = ::rocprim::get<1>(stable_keys[item]);
+        }
+
+        value_type values[ItemsPerThread];
+        // Load the values with the already sorted indices
+        block_load_values_type().load(flat_id,
+                                      ranks,
+                                      0u,
+                                      count,
+                                      is_incomplete,
+                                      values_input,
+                                      values,
+                                      storage.load_values);
+
+        block_store_type().store(0u,
+                                 count,
+                                 is_incomplete,
+                                 keys_output,
+                                 values_output,
+                                 keys,
+                                 values,
+                                 storage.store);
+    }
+
+    // Merges the output tile starting at tile_offset of a pass that merges pairs of sorted runs
+    // of sorted_block_size items, the iterators point to the first item of the segment
+    template<
+        class KeysInputIterator,
+        class KeysOutputIterator,
+        class ValuesInputIterator,
+        class ValuesOutputIterator,
+        class BinaryFunction
+    >
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void merge_tile(KeysInputIterator keys_input,
+                    KeysOutputIterator keys_output,
+                    ValuesInputIterator values_input,
+                    ValuesOutputIterator values_output,
+                    const unsigned int size,
+                    const unsigned int sorted_block_size,
+                    const unsigned int tile_offset,
+                    BinaryFunction compare_function,
+                    storage_type& storage)
+    {
+        const unsigned int flat_id       = block_thread_id<0>();
+        const unsigned int tile_end      = ::rocprim::min(tile_offset + items_per_block, size);
+        const unsigned int count         = tile_end - tile_offset;
+        const bool         is_incomplete = count < items_per_block;
+
+        // Runs of the pair that contains the tile
+        const size_t       pair_size   = 2 * static_cast<size_t>(sorted_block_size);
+        const unsigned int keys1_beg   = static_cast<unsigned int>(tile_offset / pair_size * pair_size);
+        const unsigned int keys1_end   = static_cast<unsigned int>(
+            ::rocprim::min(static_cast<size_t>(size), keys1_beg + static_cast<size_t>(sorted_block_size)));
+        const unsigned int keys2_end   = static_cast<unsigned int>(
+            ::rocprim::min(static_cast<size_t>(size), keys1_beg + pair_size));
+        const unsigned int diag_beg    = tile_offset - keys1_beg;
+        const unsigned int diag_end    = tile_end - keys1_beg;
+
+        // Synchronize before reusing shared memory
+        ::rocprim::syncthreads();
+        if(flat_id < 2)
+        {
+            storage.splits[flat_id] = merge_path(keys_input + keys1_beg,
+                                                 keys_input + keys1_end,
+                                                 keys1_end - keys1_beg,
+                                                 keys2_end - keys1_end,
+                                                 flat_id == 0 ? diag_beg : diag_end,
+                                                 compare_function);
+        }
+        ::rocprim::syncthreads();
+
+        const unsigned int split_beg = storage.splits[0];
+        const unsigned int split_end = storage.splits[1];
+        const unsigned int num_keys1 = split_end - split_beg;
+        const unsigned int num_keys2 = count - num_keys1;
+        const unsigned int input1    = keys1_beg + split_beg;
+        const unsigned int input2    = keys1_end + diag_beg - split_beg;
+
+        key_type keys[ItemsPerThread];
+        gmem_to_reg<ItemsPerThread>(keys,
+                                    keys_input + input1,
+                                    keys_input + input2,
+                                    num_keys1,
+                                    num_keys2,
+                                    is_incomplete);
+        value_type values[ItemsPerThread];
+        if ROCPRIM_IF_CONSTEXPR(with_values)
+        {
+            gmem_to_reg<ItemsPerThread>(values,
+                                        values_input + input1,
+                                        values_input + input2,
+                                        num_keys1,
+                                        num_keys2,
+                                        is_incomplete);
+        }
+
+        auto& keys_shared   = storage.keys.get();
+        auto& values_shared = storage.values.get();
+
+        reg_to_shared<BlockSize, ItemsPerThread>(keys_shared, keys);
+        ::rocprim::syncthreads();
+
+        const unsigned int diag_local = ::rocprim::min(count, ItemsPerThread * flat_id);
+        const unsigned int keys1_beg_local = merge_path(keys_shared,
+                                                        &keys_shared[num_keys1],
+                                                        num_keys1,
+                                                        num_keys2,
+                                                        diag_local,
+                                                        compare_function);
+        const range_t range_local = {keys1_beg_local,
+                                     num_keys1,
+                                     diag_local - keys1_beg_local + num_keys1,
+                                     count};
+
+        unsigned int indices[ItemsPerThread];
+        serial_merge(keys_shared, keys, indices, range_local, compare_function);
+
+        if ROCPRIM_IF_CONSTEXPR(with_values)
+        {
+            reg_to_shared<BlockSize, ItemsPerThread>(values_shared, values);
+            ::rocprim::syncthreads();
+
+            ROCPRIM_UNROLL
+            for(unsigned int item = 0; item < ItemsPerThread; ++item)
+            {
+                if(ItemsPerThread * flat_id + item < count)
+                {
+                    values[item] = values_shared[indices[item]];
+                }
+            }
+        }
+
+        block_store_type().store(tile_offset,
+                                 count,
+                                 is_incomplete,
+                                 keys_output,
+                                 values_output,
+                                 keys,
+                                 values,
+                                 storage.store);
+    }
+
+    template<
+        class KeysInputIterator,
+        class KeysOutputIterator,
+        class ValuesInputIterator,
+        class ValuesOutputIterator,
+        class BinaryFunction
+    >
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void merge_pass(KeysInputIterator keys_input,
+                    KeysOutputIterator keys_output,
+                    ValuesInputIterator values_input,
+                    ValuesOutputIterator values_output,
+                    const unsigned int size,
+                    const unsigned int sorted_block_size,
+                    BinaryFunction compare_function,
+                    storage_type& storage)
+    {
+        for(unsigned int tile_offset = 0; tile_offset < size; tile_offset += items_per_block)
+        {
+            merge_tile(keys_input, keys_output, values_input, values_output,
+                       size, sorted_block_size, tile_offset, compare_function, storage);
+            if(size - tile_offset <= items_per_block)
+            {
+                break;
+            }
+        }
+        // The next pass reads the output of the other threads
+        ::rocprim::syncthreads();
+    }
+};
+
+template<
+    unsigned int LogicalWarpSize,
+    unsigned int ItemsPerThread,
+    unsigned int BlockSize,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class SegmentIndexIterator,
+    class OffsetIterator,
+    class BinaryFunction
+>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void segmented_merge_sort_small(KeysInputIterator keys_input,
+                                KeysOutputIterator keys_output,
+                                ValuesInputIterator values_input,
+                                ValuesOutputIterator values_output,
+                                unsigned int num_segments,
+                                SegmentIndexIterator segment_indices,
+                                OffsetIterator begin_offsets,
+                                OffsetIterator end_offsets,
+                                BinaryFunction compare_function)
+{
+    static_assert(BlockSize % LogicalWarpSize == 0, "LogicalWarpSize must be a divisor of BlockSize");
+    static constexpr unsigned int warps_per_block = BlockSize / LogicalWarpSize;
+
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+
+    using warp_sort_helper_type
+        = segmented_merge_sort_warp_helper<LogicalWarpSize, ItemsPerThread, key_type, value_type>;
+
+    ROCPRIM_SHARED_MEMORY typename warp_sort_helper_type::storage_type storage[warps_per_block];
+
+    const unsigned int block_id = ::rocprim::detail::block_id<0>();
+    const unsigned int logical_warp_id = ::rocprim::detail::logical_warp_id<LogicalWarpSize>();
+    const unsigned int segment_index = block_id * warps_per_block + logical_warp_id;
+    if(segment_index >= num_segments)
+    {
+        return;
+    }
+
+    const unsigned int segment_id = segment_indices[segment_index];
+    const unsigned int begin_offset = begin_offsets[segment_id];
+    const unsigned int end_offset = end_offsets[segment_id];
+    if(end_offset <= begin_offset)
+    {
+        return;
+    }
+    warp_sort_helper_type().sort(
+        keys_input, keys_output, values_input, values_output,
+        begin_offset, end_offset, compare_function, storage[logical_warp_id]
+    );
+}
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class SegmentIndexIterator,
+    class OffsetIterator,
+    class BinaryFunction
+>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void segmented_merge_sort_medium(KeysInputIterator keys_input,
+                                 KeysOutputIterator keys_output,
+                                 ValuesInputIterator values_input,
+                                 ValuesOutputIterator values_output,
+                                 SegmentIndexIterator segment_indices,
+                                 OffsetIterator begin_offsets,
+                                 OffsetIterator end_offsets,
+                                 BinaryFunction compare_function)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+
+    using block_helper_type
+        = segmented_merge_sort_block_helper<BlockSize, ItemsPerThread, key_type, value_type>;
+
+    ROCPRIM_SHARED_MEMORY typename block_helper_type::storage_type storage;
+
+    const unsigned int segment_id = segment_indices[::rocprim::detail::block_id<0>()];
+    const unsigned int begin_offset = begin_offsets[segment_id];
+    const unsigned int end_offset = end_offsets[segment_id];
+    if(end_offset <= begin_offset)
+    {
+        return;
+    }
+    block_helper_type().sort_tile(
+        keys_input + begin_offset, keys_output + begin_offset,
+        values_input + begin_offset, values_output + begin_offset,
+        end_offset - begin_offset, compare_function, storage
+    );
+}
+
+// Sorts the tiles of the segment and merges them in passes. The buffer that receives the sorted
+// tiles is chosen so the last pass writes the output.
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class SegmentIndexIterator,
+    class OffsetIterator,
+    class BinaryFunction
+>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void segmented_merge_sort_large(KeysInputIterator keys_input,
+                                typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
+                                KeysOutputIterator keys_output,
+                                ValuesInputIterator values_input,
+                                typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
+                                ValuesOutputIterator values_output,
+                                SegmentIndexIterator segment_indices,
+                                OffsetIterator begin_offsets,
+                                OffsetIterator end_offsets,
+                                BinaryFunction compare_function)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+
+    using block_helper_type
+        = segmented_merge_sort_block_helper<BlockSize, ItemsPerThread, key_type, value_type>;
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    ROCPRIM_SHARED_MEMORY typename block_helper_type::storage_type storage;
+
+    const unsigned int segment_id = segment_indices[::rocprim::detail::block_id<0>()];
+    const unsigned int begin_offset = begin_offsets[segment_id];
+    const unsigned int end_offset = end_offsets[segment_id];
+    if(end_offset <= begin_offset)
+    {
+        return;
+    }
+    const unsigned int size = end_offset - begin_offset;
+
+    unsigned int passes = 0;
+    for(size_t sorted_block_size = items_per_block; sorted_block_size < size; sorted_block_size *= 2)
+    {
+        passes++;
+    }
+    bool in_output = passes % 2 == 0;
+
+    for(unsigned int tile_offset = 0; tile_offset < size; tile_offset += items_per_block)
+    {
+        const unsigned int count = ::rocprim::min(items_per_block, size - tile_offset);
+        const unsigned int offset = begin_offset + tile_offset;
+        if(in_output)
+        {
+            block_helper_type().sort_tile(
+                keys_input + offset, keys_output + offset,
+                values_input + offset, values_output + offset,
+                count, compare_function, storage
+            );
+        }
+        else
+        {
+            block_helper_type().sort_tile(
+                keys_input + offset, keys_tmp + offset,
+                values_input + offset, values_tmp + offset,
+                count, compare_function, storage
+            );
+        }
+        // Synchronize before reusing shared memory and reading the sorted tiles
+        ::rocprim::syncthreads();
+        if(count == size - tile_offset)
+        {
+            break;
+        }
+    }
+
+    for(size_t sorted_block_size = items_per_block; sorted_block_size < size; sorted_block_size *= 2)
+    {
+        if(in_output)
+        {
+            block_helper_type().merge_pass(
+                keys_output + begin_offset, keys_tmp + begin_offset,
+                values_output + begin_offset, values_tmp + begin_offset,
+                size, static_cast<unsigned int>(sorted_block_size), compare_function, storage
+            );
+        }
+        else
+        {
+            block_helper_type().merge_pass(
+                keys_tmp + begin_offset, keys_output + begin_offset,
+                values_tmp + begin_offset, values_output + begin_offset,
+                size, static_cast<unsigned int>(sorted_block_size), compare_function, storage
+            );
+        }
+        in_output = !in_output;
+    }
+}
+
+} // end namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_SEGMENTED_MERGE_SORT_HPP_
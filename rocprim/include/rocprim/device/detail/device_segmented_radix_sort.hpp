@@ -36,7 +36,8 @@
 #include "../../block/block_scan.hpp"
 
 #include "../../warp/warp_load.hpp"
-#include "../../warp/warp_sort.hpp"
+#include "../../warp/warp_merge_sort.hpp"
+#include "../../warp/warp_radix_sort.hpp"
 #include "../../warp/warp_store.hpp"
 
 #include "../device_segmented_radix_sort_config.hpp"
@@ -54,7 +55,9 @@ template<
     unsigned int BlockSize,
     unsigned int ItemsPerThread,
     unsigned int RadixBits,
-    bool Descending
+    bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer
 >
 class segmented_radix_sort_helper
 {
@@ -63,18 +66,18 @@ class segmented_radix_sort_helper
     using key_type = Key;
     using value_type = Value;
 
-    using count_helper_type = radix_digit_count_helper<WarpSize, BlockSize, ItemsPerThread, RadixBits, Descending>;
+    using count_helper_type = radix_digit_count_helper<WarpSize, BlockSize, ItemsPerThread, RadixBits, Descending, FloatOrder, Decomposer>;
     using scan_type = typename ::rocprim::block_scan<unsigned int, radix_size>;
     using sort_and_scatter_helper = radix_sort_and_scatter_helper<
-        BlockSize, ItemsPerThread, RadixBits, Descending,
+        BlockSize, ItemsPerThread, RadixBits, Descending, FloatOrder, Decomposer,
         key_type, value_type, unsigned int>;
 
 public:
 
     union storage_type
     {
-        typename segmented_radix_sort_helper<Key, Value, WarpSize, BlockSize, ItemsPerThread, RadixBits, Descending>::count_helper_type::storage_type count_helper;
-        typename segmented_radix_sort_helper<Key, Value, WarpSize, BlockSize, ItemsPerThread, RadixBits, Descending>::sort_and_scatter_helper::storage_type sort_and_scatter_helper;
+        typename segmented_radix_sort_helper<Key, Value, WarpSize, BlockSize, ItemsPerThread, RadixBits, Descending, FloatOrder, Decomposer>::count_helper_type::storage_type count_helper;
+        typename segmented_radix_sort_helper<Key, Value, WarpSize, BlockSize, ItemsPerThread, RadixBits, Descending, FloatOrder, Decomposer>::sort_and_scatter_helper::storage_type sort_and_scatter_helper;
     };
 
     template<
@@ -267,14 +270,16 @@ template<
     class Value,
     unsigned int BlockSize,
     unsigned int ItemsPerThread,
-    bool Descending
+    bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer
 >
 class segmented_radix_sort_single_block_helper
 {
     using key_type = Key;
     using value_type = Value;
 
-    using key_codec = radix_key_codec<key_type, Descending>;
+    using key_codec = radix_key_codec<key_type, Descending, FloatOrder, Decomposer>;
     using bit_key_type = typename key_codec::bit_key_type;
     using keys_load_type = ::rocprim::block_load<
         key_type, BlockSize, ItemsPerThread,
@@ -282,7 +287,7 @@ class segmented_radix_sort_single_block_helper
     using values_load_type = ::rocprim::block_load<
         value_type, BlockSize, ItemsPerThread,
         ::rocprim::block_load_method::block_load_transpose>;
-    using sort_type = ::rocprim::block_radix_sort<key_type, BlockSize, ItemsPerThread, value_type>;
+    using sort_type = ::rocprim::block_radix_sort<key_type, BlockSize, ItemsPerThread, value_type, 1, 1, FloatOrder, Decomposer, block_radix_sort_bits_per_pass>;
     using keys_store_type = ::rocprim::block_store<
         key_type, BlockSize, ItemsPerThread,
         ::rocprim::block_store_method::block_store_transpose>;
@@ -387,7 +392,7 @@ public:
 
         using shorter_single_block_helper = segmented_radix_sort_single_block_helper<
             key_type, value_type,
-            BlockSize, ItemsPerThread / 2, Descending
+            BlockSize, ItemsPerThread / 2, Descending, FloatOrder, Decomposer
         >;
 
         // Segment is longer than supported by this function
@@ -413,7 +418,7 @@ public:
         value_type values[ItemsPerThread];
         const unsigned int valid_count = end_offset - begin_offset;
         // Sort will leave "invalid" (out of size) items at the end of the sorted sequence
-        const key_type out_of_bounds = key_codec::decode(bit_key_type(-1));
+        const key_type out_of_bounds = key_codec::get_out_of_bounds_key();
         keys_load_type().load(keys_input + begin_offset, keys, valid_count, out_of_bounds, storage.keys_load);
         if(with_values)
         {
@@ -440,9 +445,11 @@ template<
     class Key,
     class Value,
     unsigned int BlockSize,
-    bool Descending
+    bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer
 >
-class segmented_radix_sort_single_block_helper<Key, Value, BlockSize, 0, Descending>
+class segmented_radix_sort_single_block_helper<Key, Value, BlockSize, 0, Descending, FloatOrder, Decomposer>
 {
 public:
 
@@ -471,12 +478,16 @@ public:
     }
 };
 
-template<unsigned int LogicalWarpSize, unsigned int ItemsPerThread, unsigned int BlockSize>
+template<unsigned int LogicalWarpSize,
+         unsigned int ItemsPerThread,
+         unsigned int BlockSize,
+         bool         UseRadixSort = false>
 struct WarpSortHelperConfig
 {
     static constexpr unsigned int logical_warp_size = LogicalWarpSize;
     static constexpr unsigned int items_per_thread  = ItemsPerThread;
     static constexpr unsigned int block_size        = BlockSize;
+    static constexpr bool         use_radix_sort    = UseRadixSort;
 };
 
 struct DisabledWarpSortHelperConfig
@@ -484,6 +495,7 @@ struct DisabledWarpSortHelperConfig
     static constexpr unsigned int logical_warp_size = 1;
     static constexpr unsigned int items_per_thread  = 1;
     static constexpr unsigned int block_size        = 1;
+    static constexpr bool         use_radix_sort    = false;
 };
 
 template<class Config>
@@ -492,7 +504,8 @@ using select_warp_sort_helper_config_small_t
                          DisabledWarpSortHelperConfig,
                          WarpSortHelperConfig<Config::logical_warp_size_small,
                                               Config::items_per_thread_small,
-                                              Config::block_size_small>>;
+                                              Config::block_size_small,
+                                              Config::use_radix_sort_small>>;
 
 template<class Config>
 using select_warp_sort_helper_config_medium_t
@@ -507,6 +520,8 @@ template<
     class Key,
     class Value,
     bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
     class Enable = void
 >
 struct segmented_warp_sort_helper
@@ -521,12 +536,17 @@ struct segmented_warp_sort_helper
     }
 };
 
-template<class Config, class Key, class Value, bool Descending>
+template<class Config,
+         class Key,
+         class Value,
+         bool              Descending,
+         radix_float_order FloatOrder,
+         class Decomposer>
 class segmented_warp_sort_helper<
     Config,
     Key,
     Value,
-    Descending,
+    Descending, FloatOrder, Decomposer,
     std::enable_if_t<!std::is_same<DisabledWarpSortHelperConfig, Config>::value>>
 {
     static constexpr unsigned int logical_warp_size = Config::logical_warp_size;
@@ -534,30 +554,58 @@ class segmented_warp_sort_helper<
 
     using key_type     = Key;
     using value_type   = Value;
-    using key_codec    = ::rocprim::detail::radix_key_codec<key_type, Descending>;
-    using bit_key_type = typename key_codec::bit_key_type;
 
-    using keys_load_type        = ::rocprim::warp_load<key_type, items_per_thread, logical_warp_size, ::rocprim::warp_load_method::warp_load_striped>;
-    using values_load_type      = ::rocprim::warp_load<value_type, items_per_thread, logical_warp_size, ::rocprim::warp_load_method::warp_load_striped>;
-    using keys_store_type       = ::rocprim::warp_store<key_type, items_per_thread, logical_warp_size>;
-    using values_store_type     = ::rocprim::warp_store<value_type, items_per_thread, logical_warp_size>;
+    // Both the merge sort and the radix sort are stable and sort only the items of the segment,
+    // so the keys are loaded in their order in memory without out-of-bounds keys
+    using keys_load_type        = ::rocprim::warp_load<key_type, items_per_thread, logical_warp_size, ::rocprim::warp_load_method::warp_load_transpose>;
+    using values_load_type      = ::rocprim::warp_load<value_type, items_per_thread, logical_warp_size, ::rocprim::warp_load_method::warp_load_transpose>;
+    using keys_store_type       = ::rocprim::warp_store<key_type, items_per_thread, logical_warp_size, ::rocprim::warp_store_method::warp_store_transpose>;
+    using values_store_type     = ::rocprim::warp_store<value_type, items_per_thread, logical_warp_size, ::rocprim::warp_store_method::warp_store_transpose>;
     template<bool UseRadixMask>
-    using radix_comparator_type = ::rocprim::detail::radix_merge_compare<Descending, UseRadixMask, key_type>;
-    using stable_key_type       = ::rocprim::tuple<key_type, unsigned int>;
-    using sort_type             = ::rocprim::warp_sort<stable_key_type, logical_warp_size, value_type>;
+    using radix_comparator_type = ::rocprim::detail::radix_merge_compare<Descending, UseRadixMask, key_type, FloatOrder, Decomposer>;
+    using merge_sort_type       = ::rocprim::warp_merge_sort<key_type, items_per_thread, logical_warp_size, value_type>;
+    using radix_sort_type       = ::rocprim::warp_radix_sort<key_type, items_per_thread, logical_warp_size, value_type, FloatOrder, Decomposer>;
+    using sort_type             = std::conditional_t<Config::use_radix_sort, radix_sort_type, merge_sort_type>;
 
     static constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
 
-    template<class ComparatorT>
     ROCPRIM_DEVICE ROCPRIM_INLINE
-    decltype(auto) make_stable_comparator(ComparatorT comparator)
+    void sort_items(key_type (&keys)[items_per_thread],
+                    value_type (&values)[items_per_thread],
+                    unsigned int num_items,
+                    unsigned int begin_bit,
+                    unsigned int end_bit,
+                    typename merge_sort_type::storage_type& storage,
+                    std::false_type /*use_radix_sort*/)
+    {
+        if(begin_bit == 0 && end_bit == 8 * sizeof(key_type))
+        {
+            merge_sort_type().sort(keys, values, num_items, storage, radix_comparator_type<false>{});
+        }
+        else
+        {
+            radix_comparator_type<true> comparator(begin_bit, end_bit - begin_bit);
+            merge_sort_type().sort(keys, values, num_items, storage, comparator);
+        }
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort_items(key_type (&keys)[items_per_thread],
+                    value_type (&values)[items_per_thread],
+                    unsigned int num_items,
+                    unsigned int begin_bit,
+                    unsigned int end_bit,
+                    typename radix_sort_type::storage_type& storage,
+                    std::true_type /*use_radix_sort*/)
     {
-        return [comparator](const stable_key_type& a, const stable_key_type& b) -> bool
+        if(Descending)
+        {
+            radix_sort_type().sort_desc(keys, values, num_items, storage, begin_bit, end_bit);
+        }
+        else
         {
-            const bool ab = comparator(rocprim::get<0>(a), rocprim::get<0>(b));
-            const bool ba = comparator(rocprim::get<0>(b), rocprim::get<0>(a));
-            return ab || (!ba && (rocprim::get<1>(a) < rocprim::get<1>(b)));
-        };
+            radix_sort_type().sort(keys, values, num_items, storage, begin_bit, end_bit);
+        }
     }
 
 public:
@@ -590,20 +638,10 @@ public:
               storage_type& storage)
     {
         const unsigned int num_items = end_offset - begin_offset;
-        const key_type out_of_bounds = key_codec::decode(bit_key_type(-1));
 
         key_type keys[items_per_thread];
-        stable_key_type stable_keys[items_per_thread];
         value_type values[items_per_thread];
-        keys_load_type().load(keys_input + begin_offset, keys, num_items, out_of_bounds, storage.keys_load);
-
-        ROCPRIM_UNROLL
-        for(unsigned int i = 0; i < items_per_thread; i++)
-        {
-            ::rocprim::get<0>(stable_keys[i]) = keys[i];
-            ::rocprim::get<1>(stable_keys[i]) =
-                ::rocprim::detail::logical_lane_id<logical_warp_size>() + logical_warp_size * i;
-        }
+        keys_load_type().load(keys_input + begin_offset, keys, num_items, storage.keys_load);
 
         if(with_values)
         {
@@ -612,24 +650,9 @@ public:
         }
 
         ::rocprim::wave_barrier();
-        if(begin_bit == 0 && end_bit == 8 * sizeof(key_type))
-        {
-            sort_type().sort(stable_keys,
-                             values,
-                             storage.sort,
-                             make_stable_comparator(radix_comparator_type<false>{}));
-        }
-        else
-        {
-            radix_comparator_type<true> comparator(begin_bit, end_bit - begin_bit);
-            sort_type().sort(stable_keys, values, storage.sort, make_stable_comparator(comparator));
-        }
+        sort_items(keys, values, num_items, begin_bit, end_bit, storage.sort,
+                   std::integral_constant<bool, Config::use_radix_sort>{});
 
-        ROCPRIM_UNROLL
-        for(unsigned int i = 0; i < items_per_thread; i++)
-        {
-            keys[i] = ::rocprim::get<0>(stable_keys[i]);
-        }
         ::rocprim::wave_barrier();
         keys_store_type().store(keys_output + begin_offset, keys, num_items, storage.keys_store);
 
@@ -681,9 +704,28 @@ public:
     }
 };
 
+// With 64-bit offsets the iterators are moved to the beginning of the segment, so the helpers
+// work with 32-bit offsets relative to it. 32-bit offsets are used as they are.
+template<class OffsetT>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+OffsetT segmented_sort_offset_base(const OffsetT begin_offset)
+{
+    return sizeof(OffsetT) > sizeof(unsigned int) ? begin_offset : OffsetT(0);
+}
+
+template<class OffsetT, class... Iterators>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void segmented_sort_advance(const OffsetT base, Iterators&... iterators)
+{
+    int expand[] = {(iterators += base, 0)...};
+    (void)expand;
+}
+
 template<
     class Config,
     bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
     class KeysInputIterator,
     class KeysOutputIterator,
     class ValuesInputIterator,
@@ -718,23 +760,23 @@ void segmented_sort(KeysInputIterator keys_input,
     using single_block_helper_type = segmented_radix_sort_single_block_helper<
         key_type, value_type,
         block_size, items_per_thread,
-        Descending
+        Descending, FloatOrder, Decomposer
     >;
     using long_radix_helper_type = segmented_radix_sort_helper<
         key_type, value_type,
         ::rocprim::device_warp_size(), block_size, items_per_thread,
-        long_radix_bits, Descending
+        long_radix_bits, Descending, FloatOrder, Decomposer
     >;
     using short_radix_helper_type = segmented_radix_sort_helper<
         key_type, value_type,
         ::rocprim::device_warp_size(), block_size, items_per_thread,
-        short_radix_bits, Descending
+        short_radix_bits, Descending, FloatOrder, Decomposer
     >;
     using warp_sort_helper_type = segmented_warp_sort_helper<
         select_warp_sort_helper_config_small_t<typename Config::warp_sort_config>,
         key_type,
         value_type,
-        Descending>;
+        Descending, FloatOrder, Decomposer>;
     static constexpr unsigned int items_per_warp = warp_sort_helper_type::items_per_warp;
 
     ROCPRIM_SHARED_MEMORY union
@@ -747,14 +789,26 @@ void segmented_sort(KeysInputIterator keys_input,
 
     const unsigned int segment_id = ::rocprim::detail::block_id<0>();
 
-    const unsigned int begin_offset = begin_offsets[segment_id];
-    const unsigned int end_offset = end_offsets[segment_id];
+    using offset_type = segment_offset_type_t<OffsetIterator>;
+    const offset_type segment_begin = begin_offsets[segment_id];
+    const offset_type segment_end = end_offsets[segment_id];
 
     // Empty segment
-    if(end_offset <= begin_offset)
+    if(segment_end <= segment_begin)
+    {
+        return;
+    }
+    // Segment sorted by the device-level radix sort
+    if(Config::device_sort_threshold != 0
+       && segment_end - segment_begin > Config::device_sort_threshold)
     {
         return;
     }
+    const offset_type base = segmented_sort_offset_base(segment_begin);
+    segmented_sort_advance(
+        base, keys_input, keys_tmp, keys_output, values_input, values_tmp, values_output);
+    const unsigned int begin_offset = static_cast<unsigned int>(segment_begin - base);
+    const unsigned int end_offset = static_cast<unsigned int>(segment_end - base);
 
     if(end_offset - begin_offset > items_per_block)
     {
@@ -814,6 +868,8 @@ void segmented_sort(KeysInputIterator keys_input,
 template<
     class Config,
     bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
     class KeysInputIterator,
     class KeysOutputIterator,
     class ValuesInputIterator,
@@ -849,17 +905,17 @@ void segmented_sort_large(KeysInputIterator keys_input,
     using single_block_helper_type = segmented_radix_sort_single_block_helper<
         key_type, value_type,
         block_size, items_per_thread,
-        Descending
+        Descending, FloatOrder, Decomposer
     >;
     using long_radix_helper_type = segmented_radix_sort_helper<
         key_type, value_type,
         ::rocprim::device_warp_size(), block_size, items_per_thread,
-        long_radix_bits, Descending
+        long_radix_bits, Descending, FloatOrder, Decomposer
     >;
     using short_radix_helper_type = segmented_radix_sort_helper<
         key_type, value_type,
         ::rocprim::device_warp_size(), block_size, items_per_thread,
-        short_radix_bits, Descending
+        short_radix_bits, Descending, FloatOrder, Decomposer
     >;
 
     ROCPRIM_SHARED_MEMORY union
@@ -871,13 +927,26 @@ void segmented_sort_large(KeysInputIterator keys_input,
 
     const unsigned int block_id = ::rocprim::detail::block_id<0>();
     const unsigned int segment_id = segment_indices[block_id];
-    const unsigned int begin_offset = begin_offsets[segment_id];
-    const unsigned int end_offset = end_offsets[segment_id];
 
-    if(end_offset <= begin_offset)
+    using offset_type = segment_offset_type_t<OffsetIterator>;
+    const offset_type segment_begin = begin_offsets[segment_id];
+    const offset_type segment_end = end_offsets[segment_id];
+
+    if(segment_end <= segment_begin)
     {
         return;
     }
+    // Segment sorted by the device-level radix sort
+    if(Config::device_sort_threshold != 0
+       && segment_end - segment_begin > Config::device_sort_threshold)
+    {
+        return;
+    }
+    const offset_type base = segmented_sort_offset_base(segment_begin);
+    segmented_sort_advance(
+        base, keys_input, keys_tmp, keys_output, values_input, values_tmp, values_output);
+    const unsigned int begin_offset = static_cast<unsigned int>(segment_begin - base);
+    const unsigned int end_offset = static_cast<unsigned int>(segment_end - base);
 
     if(end_offset - begin_offset > items_per_block)
     {
@@ -924,6 +993,8 @@ void segmented_sort_large(KeysInputIterator keys_input,
 template<
     class Config,
     bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
     class KeysInputIterator,
     class KeysOutputIterator,
     class ValuesInputIterator,
@@ -955,7 +1026,7 @@ void segmented_sort_small(KeysInputIterator keys_input,
     using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
 
     using warp_sort_helper_type = segmented_warp_sort_helper<
-        Config, key_type, value_type, Descending
+        Config, key_type, value_type, Descending, FloatOrder, Decomposer
     >;
 
     ROCPRIM_SHARED_MEMORY typename warp_sort_helper_type::storage_type storage;
@@ -969,12 +1040,19 @@ void segmented_sort_small(KeysInputIterator keys_input,
     }
 
     const unsigned int segment_id = segment_indices[segment_index];
-    const unsigned int begin_offset = begin_offsets[segment_id];
-    const unsigned int end_offset = end_offsets[segment_id];
-    if(end_offset <= begin_offset)
+
+    using offset_type = segment_offset_type_t<OffsetIterator>;
+    const offset_type segment_begin = begin_offsets[segment_id];
+    const offset_type segment_end = end_offsets[segment_id];
+    if(segment_end <= segment_begin)
     {
         return;
     }
+    const offset_type base = segmented_sort_offset_base(segment_begin);
+    segmented_sort_advance(
+        base, keys_input, keys_tmp, keys_output, values_input, values_tmp, values_output);
+    const unsigned int begin_offset = static_cast<unsigned int>(segment_begin - base);
+    const unsigned int end_offset = static_cast<unsigned int>(segment_end - base);
     warp_sort_helper_type().sort(
         keys_input, keys_tmp, keys_output,
         values_input, values_tmp, values_output,
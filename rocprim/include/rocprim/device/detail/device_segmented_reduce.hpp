@@ -25,6 +25,8 @@
 #include <iterator>
 
 #include "../../config.hpp"
+#include "../../detail/match_result_type.hpp"
+#include "../../detail/merge_path.hpp"
 #include "../../detail/various.hpp"
 
 #include "../../intrinsics.hpp"
@@ -32,6 +34,9 @@
 
 #include "../../block/block_load_func.hpp"
 #include "../../block/block_reduce.hpp"
+#include "../../block/block_scan.hpp"
+#include "../../iterator/counting_iterator.hpp"
+#include "../../warp/warp_reduce.hpp"
 #include "../config_types.hpp"
 #include "../device_reduce_config.hpp"
 
@@ -63,14 +68,15 @@ void segmented_reduce(InputIterator input,
     constexpr unsigned int items_per_block  = block_size * items_per_thread;
 
     using reduce_type = ::rocprim::block_reduce<ResultType, block_size, params.block_reduce_method>;
+    using offset_type = segment_offset_type_t<OffsetIterator>;
 
     ROCPRIM_SHARED_MEMORY typename reduce_type::storage_type reduce_storage;
 
     const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
     const unsigned int segment_id = ::rocprim::detail::block_id<0>();
 
-    const unsigned int begin_offset = begin_offsets[segment_id];
-    const unsigned int end_offset = end_offsets[segment_id];
+    const offset_type begin_offset = begin_offsets[segment_id];
+    const offset_type end_offset = end_offsets[segment_id];
 
     // Empty segment
     if(end_offset <= begin_offset)
@@ -83,16 +89,16 @@ void segmented_reduce(InputIterator input,
     }
 
     ResultType result;
-    unsigned int block_offset = begin_offset;
+    offset_type block_offset = begin_offset;
     if(block_offset + items_per_block > end_offset)
     {
         // Segment is shorter than items_per_block
 
         // Load the partial block and reduce the current thread's values
-        const unsigned int valid_count = end_offset - block_offset;
+        const unsigned int valid_count = static_cast<unsigned int>(end_offset - block_offset);
         if(flat_id < valid_count)
         {
-            unsigned int offset = block_offset + flat_id;
+            offset_type offset = block_offset + flat_id;
             result = input[offset];
             offset += block_size;
             while(offset < end_offset)
@@ -140,7 +146,7 @@ void segmented_reduce(InputIterator input,
         }
 
         // Load the last (probably partial) block and continue reduction
-        const unsigned int valid_count = end_offset - block_offset;
+        const unsigned int valid_count = static_cast<unsigned int>(end_offset - block_offset);
         block_load_direct_striped<block_size>(flat_id, input + block_offset, values, valid_count);
         for(unsigned int i = 0; i < items_per_thread; i++)
         {
@@ -160,6 +166,437 @@ void segmented_reduce(InputIterator input,
     }
 }
 
+// Number of threads of a logical warp that reduces one segment in warp_per_segment algorithm
+constexpr unsigned int segmented_reduce_warp_size = 16;
+
+// The algorithm that is used for the given average length of segments
+inline segmented_reduce_algorithm
+    select_segmented_reduce_algorithm(const reduce_config_params params,
+                                      const size_t               average_segment_length)
+{
+    if(average_segment_length <= params.items_per_thread)
+    {
+        return segmented_reduce_algorithm::thread_per_segment;
+    }
+    if(average_segment_length <= segmented_reduce_warp_size * params.items_per_thread)
+    {
+        return segmented_reduce_algorithm::warp_per_segment;
+    }
+    return segmented_reduce_algorithm::block_per_segment;
+}
+
+template<
+    class Config,
+    class InputIterator,
+    class OutputIterator,
+    class OffsetIterator,
+    class ResultType,
+    class BinaryFunction
+>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void segmented_reduce_thread(InputIterator input,
+                             OutputIterator output,
+                             const unsigned int segments,
+                             OffsetIterator begin_offsets,
+                             OffsetIterator end_offsets,
+                             BinaryFunction reduce_op,
+                             ResultType initial_value)
+{
+    static constexpr reduce_config_params params = device_params<Config>();
+
+    constexpr unsigned int block_size = params.block_size;
+
+    const unsigned int segment_id
+        = ::rocprim::detail::block_id<0>() * block_size + ::rocprim::detail::block_thread_id<0>();
+    if(segment_id >= segments)
+    {
+        return;
+    }
+
+    using offset_type = segment_offset_type_t<OffsetIterator>;
+
+    const offset_type begin_offset = begin_offsets[segment_id];
+    const offset_type end_offset = end_offsets[segment_id];
+
+    ResultType result = initial_value;
+    for(offset_type offset = begin_offset; offset < end_offset; offset++)
+    {
+        result = reduce_op(result, static_cast<ResultType>(input[offset]));
+    }
+    output[segment_id] = result;
+}
+
+template<
+    class Config,
+    class InputIterator,
+    class OutputIterator,
+    class OffsetIterator,
+    class ResultType,
+    class BinaryFunction
+>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void segmented_reduce_warp(InputIterator input,
+                           OutputIterator output,
+                           const unsigned int segments,
+                           OffsetIterator begin_offsets,
+                           OffsetIterator end_offsets,
+                           BinaryFunction reduce_op,
+                           ResultType initial_value)
+{
+    static constexpr reduce_config_params params = device_params<Config>();
+
+    constexpr unsigned int block_size      = params.block_size;
+    constexpr unsigned int warp_size       = segmented_reduce_warp_size;
+    constexpr unsigned int warps_per_block = block_size / warp_size;
+    static_assert(block_size % warp_size == 0,
+                  "block_size must be a multiple of segmented_reduce_warp_size");
+
+    using reduce_type = ::rocprim::warp_reduce<ResultType, warp_size>;
+
+    ROCPRIM_SHARED_MEMORY typename reduce_type::storage_type reduce_storage[warps_per_block];
+
+    const unsigned int flat_id    = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int lane_id    = flat_id % warp_size;
+    const unsigned int warp_id    = flat_id / warp_size;
+    const unsigned int segment_id = ::rocprim::detail::block_id<0>() * warps_per_block + warp_id;
+
+    // All threads of a logical warp leave together
+    if(segment_id >= segments)
+    {
+        return;
+    }
+
+    using offset_type = segment_offset_type_t<OffsetIterator>;
+
+    const offset_type begin_offset = begin_offsets[segment_id];
+    const offset_type end_offset = end_offsets[segment_id];
+
+    // Empty segment
+    if(end_offset <= begin_offset)
+    {
+        if(lane_id == 0)
+        {
+            output[segment_id] = initial_value;
+        }
+        return;
+    }
+
+    // Reduce the current thread's values, consecutive threads load consecutive items
+    const offset_type valid_count = end_offset - begin_offset;
+    ResultType result;
+    offset_type offset = begin_offset + lane_id;
+    if(offset < end_offset)
+    {
+        result = input[offset];
+        offset += warp_size;
+        while(offset < end_offset)
+        {
+            result = reduce_op(result, static_cast<ResultType>(input[offset]));
+            offset += warp_size;
+        }
+    }
+
+    // Reduce threads' reductions to compute the final result
+    reduce_type().reduce(result,
+                         result,
+                         static_cast<int>(::rocprim::min(valid_count, offset_type(warp_size))),
+                         reduce_storage[warp_id],
+                         reduce_op);
+
+    if(lane_id == 0)
+    {
+        output[segment_id] = reduce_op(initial_value, result);
+    }
+}
+
+// Load-balanced segmented reduce.
+//
+// The segments and their items form the merge path of the end offsets and the item indices,
+// every block processes an equal part of this path. Segments that end in the part of a block are
+// stored by the block, except the segment that is in progress at the beginning of the part: its
+// values from the previous blocks are added by the fix-up kernel.
+
+constexpr unsigned int segmented_reduce_no_segment = static_cast<unsigned int>(-1);
+
+// Partial reduction of a segment, valid is false when it does not have any items.
+template<class T>
+struct segmented_reduce_carry
+{
+    unsigned int segment;
+    bool         valid;
+    T            value;
+};
+
+// Combines partial reductions of the same segment, the right one wins for different segments.
+template<class T, class BinaryFunction>
+struct segmented_reduce_carry_op
+{
+    BinaryFunction reduce_op;
+
+    ROCPRIM_HOST_DEVICE inline
+    segmented_reduce_carry<T> operator()(const segmented_reduce_carry<T>& a,
+                                         const segmented_reduce_carry<T>& b) const
+    {
+        if(a.segment != b.segment || !a.valid)
+        {
+            return b;
+        }
+        if(!b.valid)
+        {
+            return segmented_reduce_carry<T>{b.segment, true, a.value};
+        }
+        return segmented_reduce_carry<T>{b.segment, true, reduce_op(a.value, b.value)};
+    }
+};
+
+struct segmented_reduce_offset_less
+{
+    template<class T, class U>
+    ROCPRIM_HOST_DEVICE inline
+    bool operator()(const T& a, const U& b) const
+    {
+        return static_cast<size_t>(a) < static_cast<size_t>(b);
+    }
+};
+
+template<
+    class Config,
+    class InputIterator,
+    class OutputIterator,
+    class OffsetIterator,
+    class ResultType,
+    class BinaryFunction
+>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void segmented_reduce_load_balanced(InputIterator input,
+                                    OutputIterator output,
+                                    const unsigned int segments,
+                                    OffsetIterator begin_offsets,
+                                    OffsetIterator end_offsets,
+                                    const size_t* span,
+                                    segmented_reduce_carry<ResultType>* heads,
+                                    segmented_reduce_carry<ResultType>* tails,
+                                    BinaryFunction reduce_op,
+                                    ResultType initial_value)
+{
+    static constexpr reduce_config_params params = device_params<Config>();
+
+    constexpr unsigned int block_size       = params.block_size;
+    constexpr unsigned int items_per_thread = params.items_per_thread;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+
+    using carry_type    = segmented_reduce_carry<ResultType>;
+    using carry_op_type = segmented_reduce_carry_op<ResultType, BinaryFunction>;
+    using scan_type     = ::rocprim::block_scan<carry_type, block_size>;
+
+    ROCPRIM_SHARED_MEMORY typename scan_type::storage_type scan_storage;
+
+    const unsigned int  flat_id  = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int  block_id = ::rocprim::detail::block_id<0>();
+    const carry_op_type carry_op{reduce_op};
+
+    const size_t items      = *span;
+    const size_t base       = static_cast<size_t>(begin_offsets[0]);
+    const size_t path_size  = segments + items;
+    const size_t block_path = ::rocprim::detail::ceiling_div<size_t>(
+        path_size, ::rocprim::detail::grid_size<0>());
+    const size_t block_begin = ::rocprim::min(path_size, block_id * block_path);
+    const size_t block_end   = ::rocprim::min(path_size, block_begin + block_path);
+
+    const ::rocprim::counting_iterator<size_t> item_offsets(base);
+
+    // The segment in progress at the beginning of the block's part
+    const size_t block_segment = merge_path(end_offsets,
+                                            item_offsets,
+                                            static_cast<size_t>(segments),
+                                            items,
+                                            block_begin,
+                                            segmented_reduce_offset_less());
+
+    carry_type block_carry;
+    block_carry.segment = static_cast<unsigned int>(block_segment);
+    block_carry.valid   = false;
+
+    for(size_t tile_begin = block_begin; tile_begin < block_end; tile_begin += items_per_block)
+    {
+        const size_t thread_begin
+            = ::rocprim::min(block_end, tile_begin + flat_id * items_per_thread);
+        const size_t thread_end = ::rocprim::min(block_end, thread_begin + items_per_thread);
+
+        const size_t first_segment = merge_path(end_offsets,
+                                                item_offsets,
+                                                static_cast<size_t>(segments),
+                                                items,
+                                                thread_begin,
+                                                segmented_reduce_offset_less());
+
+        size_t segment = first_segment;
+        size_t item    = base + thread_begin - first_segment;
+        size_t segment_begin = segment < segments ? static_cast<size_t>(begin_offsets[segment]) : 0;
+        size_t segment_end = segment < segments ? static_cast<size_t>(end_offsets[segment]) : 0;
+
+        // Walk the thread's part of the path, remember values of the segments that end in it
+        bool       ends[items_per_thread];
+        bool       valids[items_per_thread];
+        ResultType values[items_per_thread];
+        bool       valid = false;
+        ResultType value;
+        for(unsigned int i = 0; i < items_per_thread; i++)
+        {
+            ends[i] = false;
+            if(thread_begin + i < thread_end)
+            {
+                if(segment < segments && segment_end <= item)
+                {
+                    ends[i]   = true;
+                    valids[i] = valid;
+                    values[i] = value;
+                    valid     = false;
+                    segment++;
+                    if(segment < segments)
+                    {
+                        segment_begin = static_cast<size_t>(begin_offsets[segment]);
+                        segment_end   = static_cast<size_t>(end_offsets[segment]);
+                    }
+                }
+                else
+                {
+                    // Items between segments do not belong to any segment
+                    if(item >= segment_begin)
+                    {
+                        const ResultType x = input[item];
+                        value = valid ? reduce_op(value, x) : x;
+                        valid = true;
+                    }
+                    item++;
+                }
+            }
+        }
+
+        // Values of the segment in progress from the previous threads and tiles
+        carry_type thread_carry;
+        thread_carry.segment = static_cast<unsigned int>(segment);
+        thread_carry.valid   = valid;
+        thread_carry.value   = value;
+        carry_type carry_in;
+        carry_type reduction;
+        scan_type().exclusive_scan(thread_carry,
+                                   carry_in,
+                                   block_carry,
+                                   reduction,
+                                   scan_storage,
+                                   carry_op);
+        block_carry = carry_op(block_carry, reduction);
+
+        unsigned int current = static_cast<unsigned int>(first_segment);
+        bool         first   = true;
+        for(unsigned int i = 0; i < items_per_thread; i++)
+        {
+            if(ends[i])
+            {
+                carry_type c;
+                c.segment = current;
+                c.valid   = valids[i];
+                c.value   = values[i];
+                if(first)
+                {
+                    c     = carry_op(carry_in, c);
+                    first = false;
+                }
+                if(current == block_segment)
+                {
+                    heads[block_id] = c;
+                }
+                else
+                {
+                    output[current] = c.valid ? reduce_op(initial_value, c.value) : initial_value;
+                }
+                current++;
+            }
+        }
+        ::rocprim::syncthreads();
+    }
+
+    if(flat_id == 0)
+    {
+        tails[block_id] = block_carry;
+        if(block_carry.segment == block_segment)
+        {
+            // The segment in progress at the beginning does not end in this block
+            carry_type head;
+            head.segment    = segmented_reduce_no_segment;
+            head.valid      = false;
+            heads[block_id] = head;
+        }
+    }
+}
+
+// Stores the segments in progress at the beginnings of blocks, tails are inclusively scanned
+// with segmented_reduce_carry_op.
+template<
+    unsigned int BlockSize,
+    class OutputIterator,
+    class ResultType,
+    class BinaryFunction
+>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void segmented_reduce_fixup(OutputIterator output,
+                            const segmented_reduce_carry<ResultType>* heads,
+                            const segmented_reduce_carry<ResultType>* tails,
+                            const unsigned int number_of_blocks,
+                            BinaryFunction reduce_op,
+                            ResultType initial_value)
+{
+    using carry_type = segmented_reduce_carry<ResultType>;
+
+    const unsigned int block_id
+        = ::rocprim::detail::block_id<0>() * BlockSize + ::rocprim::detail::block_thread_id<0>();
+    if(block_id >= number_of_blocks)
+    {
+        return;
+    }
+
+    carry_type c = heads[block_id];
+    if(c.segment == segmented_reduce_no_segment)
+    {
+        return;
+    }
+    if(block_id > 0)
+    {
+        c = segmented_reduce_carry_op<ResultType, BinaryFunction>{reduce_op}(tails[block_id - 1], c);
+    }
+    output[c.segment] = c.valid ? reduce_op(initial_value, c.value) : initial_value;
+}
+
+// Value of the nonzero item of a CSR matrix for segmented_gather_reduce:
+// gather_op(x[columns[item]], values[item])
+template<class XIterator, class ColumnIterator, class ValueIterator, class GatherOp>
+using segmented_gather_result_t = typename std::decay<typename invoke_result<
+    GatherOp,
+    typename std::iterator_traits<XIterator>::value_type,
+    typename std::iterator_traits<ValueIterator>::value_type>::type>::type;
+
+template<class XIterator, class ColumnIterator, class ValueIterator, class GatherOp>
+struct segmented_gather_op
+{
+    using result_type
+        = segmented_gather_result_t<XIterator, ColumnIterator, ValueIterator, GatherOp>;
+
+    XIterator      x;
+    ColumnIterator columns;
+    ValueIterator  values;
+    GatherOp       gather_op;
+
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    result_type operator()(const size_t item) const
+    {
+        XIterator      x_it       = x;
+        ColumnIterator columns_it = columns;
+        ValueIterator  values_it  = values;
+        return gather_op(x_it[columns_it[item]], values_it[item]);
+    }
+};
+
 } // end of detail namespace
 
 END_ROCPRIM_NAMESPACE
@@ -144,6 +144,7 @@ void segmented_scan(InputIterator input,
         result_type, block_size,
         Config::block_scan_method
     >;
+    using offset_type = segment_offset_type_t<OffsetIterator>;
 
     ROCPRIM_SHARED_MEMORY union
     {
@@ -153,8 +154,8 @@ void segmented_scan(InputIterator input,
     } storage;
 
     const unsigned int segment_id = ::rocprim::detail::block_id<0>();
-    const unsigned int begin_offset = begin_offsets[segment_id];
-    const unsigned int end_offset = end_offsets[segment_id];
+    const offset_type begin_offset = begin_offsets[segment_id];
+    const offset_type end_offset = end_offsets[segment_id];
 
     // Empty segment
     if(end_offset <= begin_offset)
@@ -166,13 +167,13 @@ void segmented_scan(InputIterator input,
     result_type values[items_per_thread];
     result_type prefix = initial_value;
 
-    unsigned int block_offset = begin_offset;
+    offset_type block_offset = begin_offset;
     if(block_offset + items_per_block > end_offset)
     {
         // Segment is shorter than items_per_block
 
         // Load the partial block
-        const unsigned int valid_count = end_offset - block_offset;
+        const unsigned int valid_count = static_cast<unsigned int>(end_offset - block_offset);
         block_load_type().load(input + block_offset, values, valid_count, storage.load);
         ::rocprim::syncthreads();
         // Perform scan operation
@@ -216,7 +217,7 @@ void segmented_scan(InputIterator input,
         }
 
         // Load the last (probably partial) block and continue scanning
-        const unsigned int valid_count = end_offset - block_offset;
+        const unsigned int valid_count = static_cast<unsigned int>(end_offset - block_offset);
         block_load_type().load(input + block_offset, values, valid_count, storage.load);
         ::rocprim::syncthreads();
         // Perform scan operation
@@ -229,6 +230,21 @@ void segmented_scan(InputIterator input,
     }
 }
 
+// Head flag of the item at index i, computed from the keys: the first item and every item
+// whose key does not compare equal to the key of the previous item start a segment.
+template<class KeysInputIterator, class KeyCompareFunction>
+struct segmented_scan_key_head_flag_op
+{
+    KeysInputIterator  keys_input;
+    KeyCompareFunction key_compare_op;
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator()(const size_t i) const
+    {
+        return i == 0 || !key_compare_op(keys_input[i - 1], keys_input[i]);
+    }
+};
+
 } // end of detail namespace
 
 END_ROCPRIM_NAMESPACE
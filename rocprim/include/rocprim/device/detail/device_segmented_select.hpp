@@ -0,0 +1,369 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_SEGMENTED_SELECT_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_SEGMENTED_SELECT_HPP_
+
+#include <iterator>
+#include <type_traits>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../functional.hpp"
+#include "../../intrinsics.hpp"
+
+#include "../../block/block_discontinuity.hpp"
+#include "../../block/block_load.hpp"
+#include "../../block/block_scan.hpp"
+
+#include "device_partition.hpp"
+#include "lookback_scan_state.hpp"
+#include "ordered_block_id.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Flags an item when it starts a segment or differs from its predecessor, so that the heads of
+// the segments are forced discontinuities. Items after valid_count are unflagged.
+template<class InequalityOp>
+struct segment_head_inequality_op
+{
+    InequalityOp inequality_op;
+    const bool*  segment_heads;
+    unsigned int valid_count;
+
+    template<class T, class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    bool operator()(const T& a, const U& b, unsigned int b_index)
+    {
+        return b_index < valid_count && (segment_heads[b_index] || inequality_op(a, b));
+    }
+};
+
+// Index of the first segment that begins at or after position, the offsets are sorted
+template<class OffsetIterator>
+ROCPRIM_DEVICE ROCPRIM_INLINE unsigned int
+    segmented_select_first_segment(OffsetIterator     offsets,
+                                   const unsigned int segments,
+                                   const unsigned int position)
+{
+    unsigned int first = 0;
+    unsigned int last  = segments;
+    while(first < last)
+    {
+        const unsigned int middle = first + (last - first) / 2;
+        if(static_cast<unsigned int>(offsets[middle]) < position)
+        {
+            first = middle + 1;
+        }
+        else
+        {
+            last = middle;
+        }
+    }
+    return first;
+}
+
+// Flags the items that satisfy the predicate
+template<bool         Unique,
+         unsigned int BlockSize,
+         class BlockDiscontinuityType,
+         class InputIterator,
+         class ValueType,
+         unsigned int ItemsPerThread,
+         class UnaryPredicate,
+         class StorageType,
+         class InputOffsetIterator>
+ROCPRIM_DEVICE ROCPRIM_INLINE auto
+    segmented_select_flags(InputIterator /*input*/,
+                           ValueType (&values)[ItemsPerThread],
+                           bool (&is_selected)[ItemsPerThread],
+                           UnaryPredicate predicate,
+                           StorageType& /*storage*/,
+                           InputOffsetIterator /*input_offsets*/,
+                           const unsigned int /*segments*/,
+                           const unsigned int /*first_segment*/,
+                           const unsigned int /*flat_block_id*/,
+                           const unsigned int flat_block_thread_id,
+                           const unsigned int /*block_offset*/,
+                           const unsigned int valid_in_block) -> std::enable_if_t<!Unique>
+{
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        is_selected[i]
+            = flat_block_thread_id * ItemsPerThread + i < valid_in_block && predicate(values[i]);
+    }
+}
+
+// Flags the heads of the segments that begin in the tile, then flags the items that are
+// either segment heads or differ from their predecessor
+template<bool         Unique,
+         unsigned int BlockSize,
+         class BlockDiscontinuityType,
+         class InputIterator,
+         class ValueType,
+         unsigned int ItemsPerThread,
+         class InequalityOp,
+         class StorageType,
+         class InputOffsetIterator>
+ROCPRIM_DEVICE ROCPRIM_INLINE auto
+    segmented_select_flags(InputIterator input,
+                           ValueType (&values)[ItemsPerThread],
+                           bool (&is_selected)[ItemsPerThread],
+                           InequalityOp        inequality_op,
+                           StorageType&        storage,
+                           InputOffsetIterator input_offsets,
+                           const unsigned int  segments,
+                           const unsigned int  first_segment,
+                           const unsigned int  flat_block_id,
+                           const unsigned int  flat_block_thread_id,
+                           const unsigned int  block_offset,
+                           const unsigned int  valid_in_block) -> std::enable_if_t<Unique>
+{
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        storage.segment_heads[flat_block_thread_id * ItemsPerThread + i] = false;
+    }
+    ::rocprim::syncthreads();
+    for(unsigned int segment = first_segment + flat_block_thread_id; segment < segments;
+        segment += BlockSize)
+    {
+        const unsigned int segment_begin = input_offsets[segment];
+        if(segment_begin >= block_offset + valid_in_block)
+        {
+            break;
+        }
+        storage.segment_heads[segment_begin - block_offset] = true;
+    }
+    ::rocprim::syncthreads();
+
+    segment_head_inequality_op<InequalityOp> flag_op{inequality_op,
+                                                     storage.segment_heads,
+                                                     valid_in_block};
+    if(flat_block_id == 0)
+    {
+        BlockDiscontinuityType().flag_heads(is_selected,
+                                            values,
+                                            flag_op,
+                                            storage.discontinuity_values);
+    }
+    else
+    {
+        const ValueType predecessor = input[block_offset - 1];
+        BlockDiscontinuityType().flag_heads(is_selected,
+                                            predecessor,
+                                            values,
+                                            flag_op,
+                                            storage.discontinuity_values);
+    }
+    // The first item of the input is flagged by flag_heads, even when the input is empty
+    if(valid_in_block == 0)
+    {
+        is_selected[0] = false;
+    }
+}
+
+// Selects the items of a tile with a single look-back scan of the selection flags. The segments
+// that begin in the tile find their new offset in the exclusive prefixes of the tile; segments
+// that begin at the end of the input are handled by the last tile.
+//
+// When Unique is true, select_op is an inequality operator and an item is selected when it is
+// the head of a segment or differs from its predecessor. Otherwise select_op is a predicate.
+template<bool Unique,
+         class Config,
+         class InputIterator,
+         class OutputIterator,
+         class OutputOffsetIterator,
+         class InputOffsetIterator,
+         class SelectOp,
+         class OffsetLookbackScanState>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+    segmented_select_kernel_impl(InputIterator                  input,
+                                 OutputIterator                 output,
+                                 OutputOffsetIterator           output_offsets,
+                                 const unsigned int             size,
+                                 const unsigned int             segments,
+                                 InputOffsetIterator            input_offsets,
+                                 SelectOp                       select_op,
+                                 OffsetLookbackScanState        offset_scan_state,
+                                 const unsigned int             number_of_blocks,
+                                 ordered_block_id<unsigned int> ordered_bid)
+{
+    static constexpr unsigned int block_size       = Config::block_size;
+    static constexpr unsigned int items_per_thread = Config::items_per_thread;
+    static constexpr unsigned int items_per_block  = block_size * items_per_thread;
+
+    using value_type  = typename std::iterator_traits<InputIterator>::value_type;
+    using offset_type = unsigned int;
+
+    using block_load_type
+        = ::rocprim::block_load<value_type, block_size, items_per_thread, Config::load_method>;
+    using block_scan_type          = ::rocprim::block_scan<offset_type, block_size>;
+    using block_discontinuity_type = ::rocprim::block_discontinuity<value_type, block_size>;
+    using order_bid_type           = ordered_block_id<unsigned int>;
+    using backoff_type = config_lookback_backoff_type<Config, OffsetLookbackScanState>;
+    using offset_scan_prefix_op_type = offset_lookback_scan_prefix_op<offset_type,
+                                                                      OffsetLookbackScanState,
+                                                                      ::rocprim::plus<offset_type>,
+                                                                      backoff_type>;
+    using raw_exchange_values_storage_type = detail::raw_storage<value_type[items_per_block]>;
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        typename order_bid_type::storage_type ordered_bid;
+        unsigned int                          first_segment;
+        bool                                  segment_heads[Unique ? items_per_block : 1];
+        union
+        {
+            typename block_load_type::storage_type          load_values;
+            typename block_discontinuity_type::storage_type discontinuity_values;
+            typename block_scan_type::storage_type          scan_offsets;
+            offset_type                                     tile_offsets[items_per_block];
+            raw_exchange_values_storage_type                exchange_values;
+        };
+    } storage;
+
+    const unsigned int flat_block_thread_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int flat_block_id = ordered_bid.get(flat_block_thread_id, storage.ordered_bid);
+
+    const unsigned int block_offset   = flat_block_id * items_per_block;
+    const bool         is_last_block  = flat_block_id == number_of_blocks - 1;
+    const unsigned int valid_in_block = is_last_block ? size - block_offset : items_per_block;
+    const unsigned int tile_end       = block_offset + valid_in_block;
+
+    if(flat_block_thread_id == 0)
+    {
+        storage.first_segment
+            = segmented_select_first_segment(input_offsets, segments, block_offset);
+    }
+
+    value_type values[items_per_thread];
+    if(is_last_block)
+    {
+        block_load_type().load(input + block_offset, values, valid_in_block, storage.load_values);
+    }
+    else
+    {
+        block_load_type().load(input + block_offset, values, storage.load_values);
+    }
+    ::rocprim::syncthreads(); // sync threads to reuse shared memory
+    const unsigned int first_segment = storage.first_segment;
+
+    bool is_selected[items_per_thread];
+    segmented_select_flags<Unique, block_size, block_discontinuity_type>(input,
+                                                                         values,
+                                                                         is_selected,
+                                                                         select_op,
+                                                                         storage,
+                                                                         input_offsets,
+                                                                         segments,
+                                                                         first_segment,
+                                                                         flat_block_id,
+                                                                         flat_block_thread_id,
+                                                                         block_offset,
+                                                                         valid_in_block);
+    ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+    offset_type output_indices[items_per_thread];
+    convert_selected_to_indices(output_indices, is_selected);
+
+    offset_type selected_prefix{};
+    offset_type selected_in_block{};
+    if(flat_block_id == 0)
+    {
+        block_scan_type().exclusive_scan(output_indices,
+                                         output_indices,
+                                         offset_type{},
+                                         selected_in_block,
+                                         storage.scan_offsets,
+                                         ::rocprim::plus<offset_type>());
+        if(flat_block_thread_id == 0)
+        {
+            offset_scan_state.set_complete(flat_block_id, selected_in_block);
+        }
+    }
+    else
+    {
+        ROCPRIM_SHARED_MEMORY typename offset_scan_prefix_op_type::storage_type storage_prefix_op;
+        auto prefix_op
+            = offset_scan_prefix_op_type(flat_block_id, offset_scan_state, storage_prefix_op);
+        block_scan_type().exclusive_scan(output_indices,
+                                         output_indices,
+                                         storage.scan_offsets,
+                                         prefix_op,
+                                         ::rocprim::plus<offset_type>());
+        ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+        selected_in_block = prefix_op.get_reduction();
+        selected_prefix   = prefix_op.get_prefix();
+    }
+    ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+    // The new offset of a segment is the number of selected items before its head
+    for(unsigned int i = 0; i < items_per_thread; i++)
+    {
+        storage.tile_offsets[flat_block_thread_id * items_per_thread + i] = output_indices[i];
+    }
+    ::rocprim::syncthreads();
+    const offset_type selected_end = selected_prefix + selected_in_block;
+    for(unsigned int segment = first_segment + flat_block_thread_id; segment < segments;
+        segment += block_size)
+    {
+        const unsigned int segment_begin = input_offsets[segment];
+        if(!is_last_block && segment_begin >= tile_end)
+        {
+            break;
+        }
+        output_offsets[segment] = segment_begin < tile_end
+                                      ? storage.tile_offsets[segment_begin - block_offset]
+                                      : selected_end;
+    }
+    if(is_last_block && flat_block_thread_id == 0)
+    {
+        output_offsets[segments] = selected_end;
+    }
+    ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+    size_t prev_selected_count_values[1]{};
+    partition_scatter<true, block_size>(values,
+                                        is_selected,
+                                        output_indices,
+                                        output,
+                                        size,
+                                        selected_prefix,
+                                        selected_in_block,
+                                        storage.exchange_values,
+                                        flat_block_id,
+                                        flat_block_thread_id,
+                                        is_last_block,
+                                        valid_in_block,
+                                        prev_selected_count_values,
+                                        0);
+}
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_SEGMENTED_SELECT_HPP_
@@ -0,0 +1,291 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_SEGMENTED_SET_OPERATIONS_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_SEGMENTED_SET_OPERATIONS_HPP_
+
+#include <iterator>
+#include <type_traits>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../functional.hpp"
+#include "../../intrinsics.hpp"
+
+#include "../../block/block_scan.hpp"
+#include "../../thread/thread_search.hpp"
+#include "../../warp/warp_scan.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Exclusive scan of the selection flags of the threads of a logical warp
+template<unsigned int LogicalWarpSize>
+struct segmented_set_intersection_warp_scan
+{
+    using scan_type    = ::rocprim::warp_scan<unsigned int, LogicalWarpSize>;
+    using storage_type = typename scan_type::storage_type;
+
+    storage_type& storage;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE void operator()(const unsigned int flag,
+                                                  unsigned int&      prefix,
+                                                  unsigned int&      reduction) const
+    {
+        scan_type().exclusive_scan(flag, prefix, 0u, reduction, storage);
+        // The storage is reused by the next tile
+        ::rocprim::wave_barrier();
+    }
+};
+
+// Exclusive scan of the selection flags of the threads of a block
+template<unsigned int BlockSize>
+struct segmented_set_intersection_block_scan
+{
+    using scan_type    = ::rocprim::block_scan<unsigned int, BlockSize>;
+    using storage_type = typename scan_type::storage_type;
+
+    storage_type& storage;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE void operator()(const unsigned int flag,
+                                                  unsigned int&      prefix,
+                                                  unsigned int&      reduction) const
+    {
+        scan_type().exclusive_scan(flag, prefix, 0u, reduction, storage);
+        // The storage is reused by the next tile
+        ::rocprim::syncthreads();
+    }
+};
+
+// Intersects one pair of sorted lists with the threads of a logical warp or a block and returns
+// the number of keys of the intersection. Thread thread_id checks the keys thread_id,
+// thread_id + threads, ... of the first list. A key with rank r among its equal keys of the
+// first list is selected if the second list has more than r equal keys, like in
+// std::set_intersection. The lower bounds of the keys of a thread in the second list increase,
+// so every search gallops forwards from the previous one of the thread and the rank is found by
+// galloping backwards, their costs are logarithmic in the distances instead of the list sizes.
+template<bool WriteOutput,
+         class Scan,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class KeysOutputIterator,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE unsigned int
+    segmented_set_intersection_pair(const Scan         scan,
+                                    const unsigned int thread_id,
+                                    const unsigned int threads,
+                                    KeysInputIterator1 keys_input1,
+                                    const unsigned int input1_size,
+                                    KeysInputIterator2 keys_input2,
+                                    const unsigned int input2_size,
+                                    KeysOutputIterator keys_output,
+                                    BinaryFunction     compare_function)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator1>::value_type;
+
+    unsigned int count       = 0;
+    unsigned int lower_bound = 0;
+    // All threads run the same number of iterations because of the scans
+    for(unsigned int tile_offset = 0; tile_offset < input1_size; tile_offset += threads)
+    {
+        const unsigned int index    = tile_offset + thread_id;
+        bool               selected = false;
+        key_type           key;
+        if(index < input1_size)
+        {
+            key         = keys_input1[index];
+            lower_bound = ::rocprim::gallop_lower_bound(keys_input2,
+                                                        lower_bound,
+                                                        input2_size,
+                                                        key,
+                                                        compare_function);
+            const unsigned int first_index
+                = ::rocprim::gallop_lower_bound_backward(keys_input1,
+                                                         index,
+                                                         key,
+                                                         compare_function);
+            // Keys of the second list from lower_bound are not less than key
+            const unsigned int other_index = lower_bound + (index - first_index);
+            selected                       = other_index < input2_size
+                       && !compare_function(key, keys_input2[other_index]);
+        }
+
+        unsigned int prefix;
+        unsigned int reduction;
+        scan(selected ? 1u : 0u, prefix, reduction);
+        if(WriteOutput && selected)
+        {
+            keys_output[count + prefix] = key;
+        }
+        count += reduction;
+    }
+    return count;
+}
+
+// Every block intersects warps_per_block consecutive pairs. Pairs with a first list of at most
+// LargePairThreshold keys are intersected by one logical warp each, larger pairs by all threads
+// of the block after the warps are done. The counting pass (WriteOutput = false) stores the
+// sizes of the intersections to pair_counts, the writing pass stores the keys of the
+// intersections and output_offsets from the exclusive scan of these sizes in pair_offsets.
+template<bool         WriteOutput,
+         unsigned int BlockSize,
+         unsigned int LogicalWarpSize,
+         unsigned int LargePairThreshold,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class KeysOutputIterator,
+         class OutputOffsetIterator,
+         class OffsetIterator1,
+         class OffsetIterator2,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+    segmented_set_intersection_kernel_impl(KeysInputIterator1   keys_input1,
+                                           KeysInputIterator2   keys_input2,
+                                           KeysOutputIterator   keys_output,
+                                           OutputOffsetIterator output_offsets,
+                                           unsigned int*        pair_counts,
+                                           const unsigned int*  pair_offsets,
+                                           const unsigned int   pairs,
+                                           OffsetIterator1      begin_offsets1,
+                                           OffsetIterator1      end_offsets1,
+                                           OffsetIterator2      begin_offsets2,
+                                           OffsetIterator2      end_offsets2,
+                                           BinaryFunction       compare_function)
+{
+    static_assert(BlockSize % LogicalWarpSize == 0,
+                  "BlockSize must be a multiple of LogicalWarpSize");
+    static_assert(LogicalWarpSize <= ::rocprim::device_warp_size(),
+                  "LogicalWarpSize must not be greater than the warp size of the device");
+
+    constexpr unsigned int warps_per_block = BlockSize / LogicalWarpSize;
+
+    using warp_scan_type  = segmented_set_intersection_warp_scan<LogicalWarpSize>;
+    using block_scan_type = segmented_set_intersection_block_scan<BlockSize>;
+
+    ROCPRIM_SHARED_MEMORY union
+    {
+        typename warp_scan_type::storage_type  warp_scan[warps_per_block];
+        typename block_scan_type::storage_type block_scan;
+    } storage;
+
+    const unsigned int flat_id    = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int lane_id    = flat_id % LogicalWarpSize;
+    const unsigned int warp_id    = flat_id / LogicalWarpSize;
+    const unsigned int first_pair = ::rocprim::detail::block_id<0>() * warps_per_block;
+
+    if(first_pair == 0 && flat_id == 0)
+    {
+        // The extra element makes the exclusive scan of the counts end with the total count
+        if(WriteOutput)
+        {
+            output_offsets[pairs] = pair_offsets[pairs];
+        }
+        else
+        {
+            pair_counts[pairs] = 0;
+        }
+    }
+
+    const auto process_pair = [&](const auto scan,
+                                  const unsigned int thread_id,
+                                  const unsigned int threads,
+                                  const unsigned int pair_id,
+                                  const unsigned int begin1,
+                                  const unsigned int size1)
+    {
+        const unsigned int begin2 = begin_offsets2[pair_id];
+        const unsigned int end2   = end_offsets2[pair_id];
+        const unsigned int size2  = end2 > begin2 ? end2 - begin2 : 0;
+        const unsigned int output_offset = WriteOutput ? pair_offsets[pair_id] : 0;
+
+        const unsigned int count = segmented_set_intersection_pair<WriteOutput>(
+            scan,
+            thread_id,
+            threads,
+            keys_input1 + begin1,
+            size1,
+            keys_input2 + begin2,
+            size2,
+            keys_output + output_offset,
+            compare_function);
+        if(thread_id == 0)
+        {
+            if(WriteOutput)
+            {
+                output_offsets[pair_id] = output_offset;
+            }
+            else
+            {
+                pair_counts[pair_id] = count;
+            }
+        }
+    };
+
+    // Small pairs, one per logical warp
+    const unsigned int pair_id = first_pair + warp_id;
+    if(pair_id < pairs)
+    {
+        const unsigned int begin1 = begin_offsets1[pair_id];
+        const unsigned int end1   = end_offsets1[pair_id];
+        const unsigned int size1  = end1 > begin1 ? end1 - begin1 : 0;
+        if(size1 <= LargePairThreshold)
+        {
+            process_pair(warp_scan_type{storage.warp_scan[warp_id]},
+                         lane_id,
+                         LogicalWarpSize,
+                         pair_id,
+                         begin1,
+                         size1);
+        }
+    }
+
+    // Large pairs of the block, one after the other by all threads
+    bool storage_in_use = true;
+    for(unsigned int i = 0; i < warps_per_block && first_pair + i < pairs; ++i)
+    {
+        const unsigned int large_pair_id = first_pair + i;
+        const unsigned int begin1        = begin_offsets1[large_pair_id];
+        const unsigned int end1          = end_offsets1[large_pair_id];
+        const unsigned int size1         = end1 > begin1 ? end1 - begin1 : 0;
+        if(size1 > LargePairThreshold)
+        {
+            if(storage_in_use)
+            {
+                // The warps are done with the storage of their scans
+                ::rocprim::syncthreads();
+                storage_in_use = false;
+            }
+            process_pair(block_scan_type{storage.block_scan},
+                         flat_id,
+                         BlockSize,
+                         large_pair_id,
+                         begin1,
+                         size1);
+        }
+    }
+}
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_SEGMENTED_SET_OPERATIONS_HPP_
@@ -0,0 +1,429 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_SEGMENTED_TOPK_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_SEGMENTED_TOPK_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "../../config.hpp"
+#include "../../detail/radix_sort.hpp"
+#include "../../detail/various.hpp"
+#include "../../intrinsics.hpp"
+#include "../../types.hpp"
+#include "../../block/block_load.hpp"
+#include "../../block/block_scan.hpp"
+
+#include "device_radix_select.hpp"
+#include "device_segmented_radix_sort.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Segmented top-k.
+//
+// The outputs of every segment start at segment * k. Segments that fit into a logical warp are
+// sorted by the warp sort of the segmented radix sort and only their first k items are stored.
+// In longer segments a block finds the k-th key by radix select in shared memory, stopping as
+// soon as all keys that share the digits found so far are needed, and compacts the selected
+// items in their input order; the segmented radix sort then sorts the selected items.
+
+// Output iterator that stores the items of a segment at their position in the segment, and
+// only the first limit of them
+template<class OutputIterator>
+class segmented_topk_output_iterator
+{
+public:
+    struct reference
+    {
+        OutputIterator output;
+        size_t         position;
+        size_t         limit;
+
+        template<class T>
+        ROCPRIM_DEVICE ROCPRIM_INLINE
+        reference& operator=(const T& value)
+        {
+            if(position < limit)
+            {
+                output[position] = value;
+            }
+            return *this;
+        }
+    };
+
+    using value_type        = typename std::iterator_traits<OutputIterator>::value_type;
+    using pointer           = void;
+    using difference_type   = std::ptrdiff_t;
+    using iterator_category = std::random_access_iterator_tag;
+
+    // begin is the index of the first item of the segment
+    ROCPRIM_HOST_DEVICE inline
+    segmented_topk_output_iterator(OutputIterator output,
+                                   const size_t   begin,
+                                   const size_t   limit,
+                                   const size_t   index = 0)
+        : output_(output), begin_(begin), limit_(limit), index_(index)
+    {}
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator*() const
+    {
+        return reference{output_, index_ - begin_, limit_};
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator[](difference_type distance) const
+    {
+        return reference{output_, index_ + distance - begin_, limit_};
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    segmented_topk_output_iterator operator+(difference_type distance) const
+    {
+        return segmented_topk_output_iterator(output_, begin_, limit_, index_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    segmented_topk_output_iterator& operator+=(difference_type distance)
+    {
+        index_ += distance;
+        return *this;
+    }
+
+private:
+    OutputIterator output_;
+    size_t         begin_;
+    size_t         limit_;
+    size_t         index_;
+};
+
+// Offsets of the selected items of the long segments in the buffer, the short segments are
+// already stored and their ranges are empty
+template<class OffsetIterator>
+struct segmented_topk_buffer_offset_op
+{
+    OffsetIterator begin_offsets;
+    OffsetIterator end_offsets;
+    unsigned int   k;
+    unsigned int   max_small_segment_length;
+    bool           end;
+
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    unsigned int operator()(const unsigned int segment) const
+    {
+        OffsetIterator     begin_offsets_it = begin_offsets;
+        OffsetIterator     end_offsets_it   = end_offsets;
+        const unsigned int begin            = begin_offsets_it[segment];
+        const unsigned int end_offset       = end_offsets_it[segment];
+        const unsigned int length           = end_offset > begin ? end_offset - begin : 0;
+        const unsigned int selected
+            = end && length > max_small_segment_length ? ::rocprim::min(k, length) : 0;
+        return segment * k + selected;
+    }
+};
+
+template<class WarpSortHelperConfig,
+         bool              Descending,
+         radix_float_order FloatOrder,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class SegmentIndexIterator,
+         class OffsetIterator>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void segmented_topk_small(KeysInputIterator    keys_input,
+                          KeysOutputIterator   keys_output,
+                          ValuesInputIterator  values_input,
+                          ValuesOutputIterator values_output,
+                          const unsigned int   num_segments,
+                          SegmentIndexIterator segment_indices,
+                          OffsetIterator       begin_offsets,
+                          OffsetIterator       end_offsets,
+                          const unsigned int   k)
+{
+    static constexpr unsigned int block_size        = WarpSortHelperConfig::block_size;
+    static constexpr unsigned int logical_warp_size = WarpSortHelperConfig::logical_warp_size;
+    static_assert(block_size % logical_warp_size == 0,
+                  "logical_warp_size must be a divisor of block_size");
+    static constexpr unsigned int warps_per_block = block_size / logical_warp_size;
+
+    using key_type   = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+
+    using warp_sort_helper_type = segmented_warp_sort_helper<WarpSortHelperConfig,
+                                                             key_type,
+                                                             value_type,
+                                                             Descending,
+                                                             FloatOrder,
+                                                             ::rocprim::identity_decomposer>;
+
+    ROCPRIM_SHARED_MEMORY typename warp_sort_helper_type::storage_type storage[warps_per_block];
+
+    const unsigned int block_id        = ::rocprim::detail::block_id<0>();
+    const unsigned int logical_warp_id = ::rocprim::detail::logical_warp_id<logical_warp_size>();
+    const unsigned int segment_index   = block_id * warps_per_block + logical_warp_id;
+    if(segment_index >= num_segments)
+    {
+        return;
+    }
+
+    const unsigned int segment      = segment_indices[segment_index];
+    const unsigned int begin_offset = begin_offsets[segment];
+    const unsigned int end_offset   = end_offsets[segment];
+    if(end_offset <= begin_offset)
+    {
+        return;
+    }
+    // The whole segment is sorted, it is not longer than a few items per thread
+    const size_t output_offset = size_t(segment) * k;
+    warp_sort_helper_type().sort(
+        keys_input,
+        segmented_topk_output_iterator<KeysOutputIterator>(keys_output + output_offset,
+                                                           begin_offset,
+                                                           k),
+        values_input,
+        segmented_topk_output_iterator<ValuesOutputIterator>(values_output + output_offset,
+                                                             begin_offset,
+                                                             k),
+        begin_offset,
+        end_offset,
+        0,
+        8 * sizeof(key_type),
+        storage[logical_warp_id]);
+}
+
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class KeyCodec,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class SegmentIndexIterator,
+         class OffsetIterator>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void segmented_topk_select(
+    KeysInputIterator                                               keys_input,
+    typename std::iterator_traits<KeysInputIterator>::value_type*   keys_buffer,
+    ValuesInputIterator                                             values_input,
+    typename std::iterator_traits<ValuesInputIterator>::value_type* values_buffer,
+    SegmentIndexIterator                                            segment_indices,
+    OffsetIterator                                                  begin_offsets,
+    OffsetIterator                                                  end_offsets,
+    const unsigned int                                              k)
+{
+    using key_type     = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type   = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    using bit_key_type = typename KeyCodec::bit_key_type;
+    using load_type    = ::rocprim::block_load<key_type,
+                                           BlockSize,
+                                           ItemsPerThread,
+                                           block_load_method::block_load_transpose>;
+    using scan_type = ::rocprim::block_scan<unsigned int, BlockSize>;
+
+    constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    constexpr unsigned int key_bits        = KeyCodec::key_bits;
+    constexpr unsigned int passes = ::rocprim::detail::ceiling_div(key_bits, radix_select_bits);
+    // The selected and the tied items of a tile are counted in the two halves of a word
+    constexpr unsigned int tie_shift = 16;
+    static_assert(items_per_block < (1u << tie_shift),
+                  "The items of a block must be countable in 16 bits");
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        unsigned int histogram[radix_select_size];
+        // Digits of the k-th key found so far
+        bit_key_type prefix;
+        bit_key_type prefix_mask;
+        // Keys before the k-th key and keys equal to it that are needed to reach k
+        unsigned int less_count;
+        unsigned int remaining;
+        bool         done;
+        union
+        {
+            typename load_type::storage_type load;
+            typename scan_type::storage_type scan;
+        };
+    } storage;
+
+    const unsigned int flat_id      = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int segment      = segment_indices[::rocprim::detail::block_id<0>()];
+    const unsigned int begin_offset = begin_offsets[segment];
+    const unsigned int end_offset   = end_offsets[segment];
+    if(end_offset <= begin_offset)
+    {
+        return;
+    }
+    const unsigned int length         = end_offset - begin_offset;
+    key_type* const    segment_keys   = keys_buffer + size_t(segment) * k;
+    value_type* const  segment_values = values_buffer + size_t(segment) * k;
+
+    // All items are selected
+    if(length <= k)
+    {
+        for(unsigned int i = flat_id; i < length; i += BlockSize)
+        {
+            segment_keys[i] = keys_input[begin_offset + i];
+            if(with_values)
+            {
+                segment_values[i] = values_input[begin_offset + i];
+            }
+        }
+        return;
+    }
+
+    if(flat_id == 0)
+    {
+        storage.prefix      = 0;
+        storage.prefix_mask = 0;
+        storage.less_count  = 0;
+        storage.remaining   = k;
+        storage.done        = false;
+    }
+    for(unsigned int pass = 0; pass < passes; pass++)
+    {
+        const unsigned int end_bit = key_bits - pass * radix_select_bits;
+        const unsigned int bit     = end_bit > radix_select_bits ? end_bit - radix_select_bits : 0;
+        const unsigned int current_radix_bits = end_bit - bit;
+        const unsigned int digit_mask         = (1u << current_radix_bits) - 1;
+
+        for(unsigned int i = flat_id; i < radix_select_size; i += BlockSize)
+        {
+            storage.histogram[i] = 0;
+        }
+        ::rocprim::syncthreads();
+
+        const bit_key_type prefix      = storage.prefix;
+        const bit_key_type prefix_mask = storage.prefix_mask;
+        for(unsigned int i = flat_id; i < length; i += BlockSize)
+        {
+            const bit_key_type bit_key
+                = radix_select_encode<KeyCodec>(keys_input[begin_offset + i]);
+            if(static_cast<bit_key_type>(bit_key & prefix_mask) == prefix)
+            {
+                const unsigned int digit = static_cast<unsigned int>(bit_key >> bit) & digit_mask;
+                ::rocprim::detail::atomic_add(&storage.histogram[digit], 1u);
+            }
+        }
+        ::rocprim::syncthreads();
+
+        if(flat_id == 0)
+        {
+            // There are only radix_select_size digits, so a sequential scan is cheap enough
+            const unsigned int radix_size = 1u << current_radix_bits;
+            const unsigned int remaining  = storage.remaining;
+            unsigned int       before     = 0;
+            unsigned int       digit      = 0;
+            while(digit + 1 < radix_size && before + storage.histogram[digit] < remaining)
+            {
+                before += storage.histogram[digit];
+                digit++;
+            }
+            storage.prefix |= static_cast<bit_key_type>(static_cast<bit_key_type>(digit) << bit);
+            storage.prefix_mask
+                |= static_cast<bit_key_type>(static_cast<bit_key_type>(radix_size - 1) << bit);
+            storage.less_count += before;
+            storage.remaining -= before;
+            // Every key with the digits found so far is selected, the lower digits do not matter
+            storage.done = storage.histogram[digit] == storage.remaining;
+        }
+        ::rocprim::syncthreads();
+
+        if(storage.done)
+        {
+            break;
+        }
+    }
+
+    const bit_key_type prefix      = storage.prefix;
+    const bit_key_type prefix_mask = storage.prefix_mask;
+    const unsigned int less_count  = storage.less_count;
+    const unsigned int remaining   = storage.remaining;
+
+    // The selected items are compacted in their input order, so the ties that come first in
+    // the input are selected. The loop ends when all selected items are stored.
+    unsigned int less_offset = 0;
+    unsigned int tie_offset  = 0;
+    for(unsigned int tile_offset = 0;
+        tile_offset < length && (less_offset < less_count || tie_offset < remaining);
+        tile_offset += items_per_block)
+    {
+        const unsigned int valid = ::rocprim::min(items_per_block, length - tile_offset);
+
+        key_type keys[ItemsPerThread];
+        load_type().load(keys_input + begin_offset + tile_offset, keys, valid, storage.load);
+
+        unsigned int flags[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            flags[i] = 0;
+            if(flat_id * ItemsPerThread + i < valid)
+            {
+                const bit_key_type masked_key = static_cast<bit_key_type>(
+                    radix_select_encode<KeyCodec>(keys[i]) & prefix_mask);
+                flags[i] = masked_key < prefix ? 1u : masked_key == prefix ? 1u << tie_shift : 0u;
+            }
+        }
+        ::rocprim::syncthreads();
+
+        unsigned int positions[ItemsPerThread];
+        unsigned int tile_count;
+        scan_type().exclusive_scan(flags, positions, 0u, tile_count, storage.scan);
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            unsigned int position = k;
+            if(flags[i] == 1u)
+            {
+                position = less_offset + (positions[i] & ((1u << tie_shift) - 1));
+            }
+            else if(flags[i] != 0u)
+            {
+                const unsigned int tie = tie_offset + (positions[i] >> tie_shift);
+                position               = tie < remaining ? less_count + tie : k;
+            }
+            if(position < k)
+            {
+                segment_keys[position] = keys[i];
+                if(with_values)
+                {
+                    segment_values[position]
+                        = values_input[begin_offset + tile_offset + flat_id * ItemsPerThread + i];
+                }
+            }
+        }
+        less_offset += tile_count & ((1u << tie_shift) - 1);
+        tie_offset += tile_count >> tie_shift;
+        ::rocprim::syncthreads();
+    }
+}
+
+} // end namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_SEGMENTED_TOPK_HPP_
@@ -0,0 +1,298 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_SET_OPERATIONS_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_SET_OPERATIONS_HPP_
+
+#include <iterator>
+#include <type_traits>
+
+#include "../../config.hpp"
+#include "../../detail/merge_path.hpp"
+#include "../../detail/various.hpp"
+#include "../../functional.hpp"
+#include "../../intrinsics.hpp"
+#include "../../types.hpp"
+
+#include "../../thread/thread_search.hpp"
+
+#include "../../block/block_scan.hpp"
+
+#include "device_merge.hpp"
+#include "lookback_scan_state.hpp"
+#include "ordered_block_id.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+enum class set_operation
+{
+    intersection,
+    union_,
+    difference,
+    symmetric_difference
+};
+
+// Returns true if the key at input_index of its input is a part of the output of the set
+// operation. The inputs are merged with the keys of the first input before equal keys of the
+// second input, other_index is the number of keys of the other input before the key in this
+// order: the lower bound of the key in the second input for keys of the first input, the upper
+// bound of the key in the first input for keys of the second input.
+//
+// Of a key with m copies in the first and n copies in the second input, the intersection
+// contains the first min(m, n) copies of the first input, the union all copies of the first
+// input and the last max(n - m, 0) copies of the second input, the difference the last
+// max(m - n, 0) copies of the first input and the symmetric difference the last copies of both.
+// This matches std::set_intersection, std::set_union, std::set_difference and
+// std::set_symmetric_difference, and the merged order keeps these copies sorted.
+template<set_operation Operation,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class Key,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE bool is_in_set_operation_output(KeysInputIterator1 keys_input1,
+                                                              KeysInputIterator2 keys_input2,
+                                                              const unsigned int input2_size,
+                                                              const Key&         key,
+                                                              const bool         from_first,
+                                                              const unsigned int input_index,
+                                                              const unsigned int other_index,
+                                                              BinaryFunction     compare_function)
+{
+    if(from_first)
+    {
+        if ROCPRIM_IF_CONSTEXPR(Operation == set_operation::union_)
+        {
+            return true;
+        }
+        const unsigned int other_count
+            = ::rocprim::gallop_upper_bound(keys_input2, other_index, input2_size, key,
+                                           compare_function)
+              - other_index;
+        if(other_count == 0)
+        {
+            return Operation != set_operation::intersection;
+        }
+        const unsigned int first_index
+            = ::rocprim::gallop_lower_bound_backward(keys_input1,
+                                                     input_index,
+                                                     key,
+                                                     compare_function);
+        const unsigned int rank = input_index - first_index;
+        return Operation == set_operation::intersection ? rank < other_count
+                                                        : rank >= other_count;
+    }
+    else
+    {
+        if ROCPRIM_IF_CONSTEXPR(Operation == set_operation::intersection
+                                || Operation == set_operation::difference)
+        {
+            return false;
+        }
+        const unsigned int other_first_index
+            = ::rocprim::gallop_lower_bound_backward(keys_input1,
+                                                     other_index,
+                                                     key,
+                                                     compare_function);
+        const unsigned int other_count = other_index - other_first_index;
+        if(other_count == 0)
+        {
+            return true;
+        }
+        const unsigned int first_index
+            = ::rocprim::gallop_lower_bound_backward(keys_input2,
+                                                     input_index,
+                                                     key,
+                                                     compare_function);
+        const unsigned int rank = input_index - first_index;
+        return rank >= other_count;
+    }
+}
+
+// Merges a tile of the inputs like merge_kernel, selects the keys of the output of the set
+// operation and compacts them with a decoupled look-back of the output counts of the tiles.
+template<set_operation Operation,
+         unsigned int  BlockSize,
+         unsigned int  ItemsPerThread,
+         class IndexIterator,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class KeysOutputIterator,
+         class ValuesInputIterator1,
+         class ValuesInputIterator2,
+         class ValuesOutputIterator,
+         class OutputCountIterator,
+         class BinaryFunction,
+         class LookbackScanState>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+    set_operation_kernel_impl(IndexIterator                  indices,
+                              KeysInputIterator1             keys_input1,
+                              KeysInputIterator2             keys_input2,
+                              KeysOutputIterator             keys_output,
+                              ValuesInputIterator1           values_input1,
+                              ValuesInputIterator2           values_input2,
+                              ValuesOutputIterator           values_output,
+                              OutputCountIterator            output_count,
+                              const unsigned int             input1_size,
+                              const unsigned int             input2_size,
+                              BinaryFunction                 compare_function,
+                              LookbackScanState              scan_state,
+                              const unsigned int             number_of_blocks,
+                              ordered_block_id<unsigned int> ordered_bid)
+{
+    using key_type   = typename std::iterator_traits<KeysInputIterator1>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator1>::value_type;
+    using block_scan_type = ::rocprim::block_scan<unsigned int, BlockSize>;
+    using prefix_op_type  = offset_lookback_scan_prefix_op<unsigned int, LookbackScanState>;
+    using order_bid_type  = ordered_block_id<unsigned int>;
+
+    constexpr bool         with_values      = !std::is_same<value_type, empty_type>::value;
+    constexpr unsigned int items_per_block  = BlockSize * ItemsPerThread;
+    constexpr unsigned int input_block_size = items_per_block + 1;
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        typename order_bid_type::storage_type ordered_bid;
+        union
+        {
+            typename detail::raw_storage<key_type[input_block_size]> keys_shared;
+            typename block_scan_type::storage_type                  scan;
+        };
+    } storage;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    // Tiles are processed in the order of their ids so the look-back never waits for a tile
+    // that is not being processed by a resident block
+    const unsigned int flat_block_id = ordered_bid.get(flat_id, storage.ordered_bid);
+
+    const range_t range = compute_range(flat_block_id,
+                                        input1_size,
+                                        input2_size,
+                                        items_per_block,
+                                        indices[flat_block_id],
+                                        indices[flat_block_id + 1]);
+    const unsigned int count = range.count1() + range.count2();
+
+    key_type     keys[ItemsPerThread];
+    unsigned int index[ItemsPerThread];
+    merge_keys<BlockSize>(flat_id,
+                          keys_input1,
+                          keys_input2,
+                          keys,
+                          index,
+                          storage.keys_shared.get(),
+                          range,
+                          compare_function);
+
+    // Position in the sources and selection of every merged key
+    unsigned int input_indices[ItemsPerThread];
+    bool         from_first[ItemsPerThread];
+    unsigned int output_indices[ItemsPerThread];
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; ++i)
+    {
+        const unsigned int position = flat_id * ItemsPerThread + i;
+        from_first[i]               = index[i] < range.count1();
+        // The number of keys of the other input before this key in the merged order is the
+        // number of keys of the tile before it minus the ones of its own input
+        const unsigned int local_index = from_first[i] ? index[i] : index[i] - range.count1();
+        input_indices[i] = (from_first[i] ? range.begin1 : range.begin2) + local_index;
+        const unsigned int other_index
+            = (from_first[i] ? range.begin2 : range.begin1) + position - local_index;
+        output_indices[i]
+            = position < count
+              && is_in_set_operation_output<Operation>(keys_input1,
+                                                       keys_input2,
+                                                       input2_size,
+                                                       keys[i],
+                                                       from_first[i],
+                                                       input_indices[i],
+                                                       other_index,
+                                                       compare_function)
+                  ? 1
+                  : 0;
+    }
+
+    bool is_selected[ItemsPerThread];
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; ++i)
+    {
+        is_selected[i] = output_indices[i] != 0;
+    }
+
+    // Number of selected keys in previous tiles and in this tile
+    unsigned int selected_prefix = 0;
+    unsigned int selected_in_block;
+    if(flat_block_id == 0)
+    {
+        block_scan_type().exclusive_scan(output_indices,
+                                         output_indices,
+                                         0u,
+                                         selected_in_block,
+                                         storage.scan,
+                                         ::rocprim::plus<unsigned int>());
+        if(flat_id == 0)
+        {
+            scan_state.set_complete(flat_block_id, selected_in_block);
+        }
+    }
+    else
+    {
+        ROCPRIM_SHARED_MEMORY typename prefix_op_type::storage_type storage_prefix_op;
+        auto prefix_op = prefix_op_type(flat_block_id, scan_state, storage_prefix_op);
+        block_scan_type().exclusive_scan(output_indices,
+                                         output_indices,
+                                         storage.scan,
+                                         prefix_op,
+                                         ::rocprim::plus<unsigned int>());
+        ::rocprim::syncthreads();
+
+        selected_in_block = prefix_op.get_reduction();
+        selected_prefix   = prefix_op.get_prefix();
+    }
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; ++i)
+    {
+        if(is_selected[i])
+        {
+            keys_output[output_indices[i]] = keys[i];
+            if ROCPRIM_IF_CONSTEXPR(with_values)
+            {
+                values_output[output_indices[i]] = from_first[i]
+                                                       ? values_input1[input_indices[i]]
+                                                       : values_input2[input_indices[i]];
+            }
+        }
+    }
+
+    if(flat_block_id == number_of_blocks - 1 && flat_id == 0)
+    {
+        *output_count = selected_prefix + selected_in_block;
+    }
+}
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_SET_OPERATIONS_HPP_
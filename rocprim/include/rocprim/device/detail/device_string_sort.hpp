@@ -0,0 +1,231 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_STRING_SORT_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_STRING_SORT_HPP_
+
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+
+#include "../../intrinsics.hpp"
+#include "../../functional.hpp"
+#include "../../thread/thread_load.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Every radix pass sorts a 64-bit key made of the next string_sort_chunk_bytes bytes of the
+// string (big-endian, padded with zeros) and a length class in the lowest byte. The length
+// class is the number of remaining bytes, or string_sort_more_bytes if the string continues
+// after the chunk, so a string ordered before its extensions and strings with a common prefix
+// stay tied only if they both continue.
+constexpr unsigned int string_sort_chunk_bytes = 7;
+constexpr unsigned char string_sort_more_bytes = string_sort_chunk_bytes + 1;
+
+constexpr unsigned int string_sort_block_size = 256;
+
+// Per-position state: the position starts a group of strings with the same prefix, and
+// the group is still tied and must be refined by the next pass.
+constexpr unsigned char string_sort_group_head = 1;
+constexpr unsigned char string_sort_group_tied = 2;
+
+template<class OffsetIterator>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+uint64_t string_sort_load_key(const unsigned char * chars,
+                              OffsetIterator offsets,
+                              const unsigned int string_id,
+                              const unsigned int pass)
+{
+    using offset_type = typename std::iterator_traits<OffsetIterator>::value_type;
+
+    const offset_type begin = offsets[string_id];
+    const offset_type length = offsets[string_id + 1] - begin;
+    const offset_type skip = static_cast<offset_type>(pass) * string_sort_chunk_bytes;
+    const offset_type remaining = length > skip ? length - skip : 0;
+    const unsigned int count = static_cast<unsigned int>(
+        ::rocprim::min<offset_type>(remaining, string_sort_chunk_bytes));
+    const unsigned char * chunk = chars + begin + skip;
+
+    uint64_t key = 0;
+    if(count == string_sort_chunk_bytes && remaining > string_sort_chunk_bytes
+       && reinterpret_cast<uintptr_t>(chunk) % sizeof(uint64_t) == 0)
+    {
+        // The string continues after the chunk, so the whole aligned word is in the buffer
+        const uint64_t word = ::rocprim::thread_load<load_ldg>(
+            reinterpret_cast<const uint64_t *>(chunk));
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < string_sort_chunk_bytes; i++)
+        {
+            key = (key << 8) | ((word >> (8 * i)) & 0xFF);
+        }
+    }
+    else
+    {
+        for(unsigned int i = 0; i < string_sort_chunk_bytes; i++)
+        {
+            const uint64_t byte = i < count ? ::rocprim::thread_load<load_ldg>(chunk + i) : 0;
+            key = (key << 8) | byte;
+        }
+    }
+    const unsigned char length_class
+        = remaining > string_sort_chunk_bytes ? string_sort_more_bytes
+                                              : static_cast<unsigned char>(remaining);
+    return (key << 8) | length_class;
+}
+
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void string_sort_init(unsigned int * permutation,
+                      unsigned char * flags,
+                      unsigned int * begin_offsets,
+                      unsigned int * end_offsets,
+                      const unsigned int size)
+{
+    const unsigned int position = ::rocprim::detail::block_id<0>() * string_sort_block_size
+        + ::rocprim::detail::block_thread_id<0>();
+    if(position >= size)
+    {
+        return;
+    }
+    permutation[position] = position;
+    const unsigned char tied = size > 1 ? string_sort_group_tied : 0;
+    flags[position] = position == 0 ? (tied | string_sort_group_head) : tied;
+    if(position == 0)
+    {
+        // All strings start in one tied group
+        begin_offsets[0] = 0;
+        end_offsets[0] = size;
+    }
+}
+
+template<class OffsetIterator>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void string_sort_load_keys(const unsigned char * chars,
+                           OffsetIterator offsets,
+                           const unsigned int * permutation,
+                           const unsigned char * flags,
+                           uint64_t * keys,
+                           const unsigned int size,
+                           const unsigned int pass)
+{
+    const unsigned int position = ::rocprim::detail::block_id<0>() * string_sort_block_size
+        + ::rocprim::detail::block_thread_id<0>();
+    if(position >= size || (flags[position] & string_sort_group_tied) == 0)
+    {
+        return;
+    }
+    keys[position] = string_sort_load_key(chars, offsets, permutation[position], pass);
+}
+
+// Splits the tied groups at the positions where the sorted keys differ. A new group stays tied
+// if it has at least two strings and all of them continue after the current chunk.
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void string_sort_split_groups(const uint64_t * keys,
+                              const unsigned char * flags_input,
+                              unsigned char * flags_output,
+                              const unsigned int size)
+{
+    const unsigned int position = ::rocprim::detail::block_id<0>() * string_sort_block_size
+        + ::rocprim::detail::block_thread_id<0>();
+    if(position >= size)
+    {
+        return;
+    }
+    const unsigned char flags = flags_input[position];
+    if((flags & string_sort_group_tied) == 0)
+    {
+        flags_output[position] = flags;
+        return;
+    }
+    // Neighbours are read only if they are in the same group, so their keys are up to date
+    const uint64_t key = keys[position];
+    const bool head = (flags & string_sort_group_head) != 0 || keys[position - 1] != key;
+    const bool tail = position + 1 == size
+        || (flags_input[position + 1] & string_sort_group_head) != 0
+        || keys[position + 1] != key;
+    const bool tied = (key & 0xFF) == string_sort_more_bytes && !(head && tail);
+    flags_output[position] = (head ? string_sort_group_head : 0) | (tied ? string_sort_group_tied : 0);
+}
+
+struct string_sort_select_group_begin
+{
+    const unsigned char * flags;
+
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    bool operator()(const unsigned int position) const
+    {
+        return flags[position] == (string_sort_group_head | string_sort_group_tied);
+    }
+};
+
+// Selects the ends of the tied groups, the input is the position past the last string
+struct string_sort_select_group_end
+{
+    const unsigned char * flags;
+    unsigned int size;
+
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    bool operator()(const unsigned int end) const
+    {
+        return (flags[end - 1] & string_sort_group_tied) != 0
+            && (end == size || (flags[end] & string_sort_group_head) != 0);
+    }
+};
+
+// Compares the strings lexicographically from the byte skip, bytes are unsigned
+template<class OffsetIterator>
+struct string_sort_compare
+{
+    using offset_type = typename std::iterator_traits<OffsetIterator>::value_type;
+
+    const unsigned char * chars;
+    OffsetIterator offsets;
+    offset_type skip;
+
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    bool operator()(const unsigned int a, const unsigned int b) const
+    {
+        const offset_type a_end = offsets[a + 1];
+        const offset_type b_end = offsets[b + 1];
+        offset_type a_position = ::rocprim::min<offset_type>(offsets[a] + skip, a_end);
+        offset_type b_position = ::rocprim::min<offset_type>(offsets[b] + skip, b_end);
+        for(; a_position < a_end && b_position < b_end; a_position++, b_position++)
+        {
+            const unsigned char a_char = chars[a_position];
+            const unsigned char b_char = chars[b_position];
+            if(a_char != b_char)
+            {
+                return a_char < b_char;
+            }
+        }
+        return a_end - a_position < b_end - b_position;
+    }
+};
+
+} // end namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_STRING_SORT_HPP_
@@ -0,0 +1,223 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_TILE_PIPELINE_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_TILE_PIPELINE_HPP_
+
+#include <type_traits>
+#include <utility>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+
+#include "device_partition.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+template<class Op>
+struct tile_transform_stage
+{
+    Op op;
+};
+
+template<class UnaryPredicate>
+struct tile_select_stage
+{
+    UnaryPredicate predicate;
+};
+
+template<class BinaryFunction>
+struct tile_inclusive_scan_stage
+{
+    BinaryFunction op;
+};
+
+template<class Stage>
+struct is_tile_scan_stage : std::false_type
+{};
+
+template<class BinaryFunction>
+struct is_tile_scan_stage<tile_inclusive_scan_stage<BinaryFunction>> : std::true_type
+{};
+
+template<class Op, class T>
+ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+auto apply_tile_stage(const tile_transform_stage<Op>& stage, const T& value, bool& /*selected*/)
+    -> decltype(stage.op(value))
+{
+    return stage.op(value);
+}
+
+// The predicates of rejected values are not evaluated
+template<class UnaryPredicate, class T>
+ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+T apply_tile_stage(const tile_select_stage<UnaryPredicate>& stage, const T& value, bool& selected)
+{
+    selected = selected && stage.predicate(value);
+    return value;
+}
+
+// The scan is done by the look-back of the pipeline, the values pass through
+template<class BinaryFunction, class T>
+ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+T apply_tile_stage(const tile_inclusive_scan_stage<BinaryFunction>& /*stage*/,
+                   const T& value,
+                   bool& /*selected*/)
+{
+    return value;
+}
+
+// The stages of a pipeline, applied to every value in order
+template<class... Stages>
+struct tile_stage_list;
+
+template<>
+struct tile_stage_list<>
+{
+    static constexpr bool has_scan = false;
+
+    template<class T>
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    T apply(const T& value, bool& /*selected*/) const
+    {
+        return value;
+    }
+};
+
+template<class Stage, class... Stages>
+struct tile_stage_list<Stage, Stages...>
+{
+    static_assert(!is_tile_scan_stage<Stage>::value || sizeof...(Stages) == 0,
+                  "The scan must be the last stage of a tile pipeline");
+
+    static constexpr bool has_scan
+        = is_tile_scan_stage<Stage>::value || tile_stage_list<Stages...>::has_scan;
+
+    Stage                      stage;
+    tile_stage_list<Stages...> stages;
+
+    template<class T>
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    auto apply(const T& value, bool& selected) const
+        -> decltype(stages.apply(apply_tile_stage(stage, value, selected), selected))
+    {
+        return stages.apply(apply_tile_stage(stage, value, selected), selected);
+    }
+};
+
+// The operation of the scan, which is the last stage
+template<class StageList>
+struct tile_scan_op_type;
+
+template<class BinaryFunction>
+struct tile_scan_op_type<tile_stage_list<tile_inclusive_scan_stage<BinaryFunction>>>
+{
+    using type = BinaryFunction;
+};
+
+template<class Stage, class NextStage, class... Stages>
+struct tile_scan_op_type<tile_stage_list<Stage, NextStage, Stages...>>
+    : tile_scan_op_type<tile_stage_list<NextStage, Stages...>>
+{};
+
+template<class BinaryFunction>
+ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+BinaryFunction
+    get_tile_scan_op(const tile_stage_list<tile_inclusive_scan_stage<BinaryFunction>>& stages)
+{
+    return stages.stage.op;
+}
+
+template<class Stage, class NextStage, class... Stages>
+ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+typename tile_scan_op_type<tile_stage_list<Stage, NextStage, Stages...>>::type
+    get_tile_scan_op(const tile_stage_list<Stage, NextStage, Stages...>& stages)
+{
+    return get_tile_scan_op(stages.stages);
+}
+
+ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+tile_stage_list<> make_tile_stage_list()
+{
+    return tile_stage_list<>{};
+}
+
+template<class Stage, class... Stages>
+ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+tile_stage_list<Stage, Stages...> make_tile_stage_list(const Stage& stage, const Stages&... stages)
+{
+    return tile_stage_list<Stage, Stages...>{stage, make_tile_stage_list(stages...)};
+}
+
+// All stages of a pipeline are one transform operation of the fused select and scan kernel, the
+// predicates of the select stages are evaluated by the transform_select_item specialization
+template<class StageList>
+struct tile_pipeline_transform_op
+{
+    StageList stages;
+
+    template<class T>
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    auto operator()(const T& value) const -> decltype(stages.apply(value, std::declval<bool&>()))
+    {
+        bool selected = true;
+        return stages.apply(value, selected);
+    }
+};
+
+struct tile_pipeline_select_op
+{};
+
+template<class StageList>
+struct transform_select_item<tile_pipeline_transform_op<StageList>, tile_pipeline_select_op>
+{
+    template<class Input, class Value>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static bool apply(tile_pipeline_transform_op<StageList>& transform_op,
+                      tile_pipeline_select_op& /*predicate*/,
+                      const Input& input,
+                      Value&       value)
+    {
+        bool selected = true;
+        value         = transform_op.stages.apply(input, selected);
+        return selected;
+    }
+};
+
+// The scan of a pipeline without a scan stage, its results are discarded
+struct tile_pipeline_no_scan_op
+{
+    template<class T>
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    T operator()(const T& /*a*/, const T& b) const
+    {
+        return b;
+    }
+};
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_TILE_PIPELINE_HPP_
@@ -23,9 +23,11 @@
 
 #include <type_traits>
 #include <iterator>
+#include <utility>
 
 #include "../../config.hpp"
 #include "../../detail/various.hpp"
+#include "../../detail/all_true.hpp"
 #include "../../detail/match_result_type.hpp"
 
 #include "../../intrinsics.hpp"
@@ -34,6 +36,14 @@
 
 #include "../../block/block_load.hpp"
 #include "../../block/block_store.hpp"
+#ifndef __HIP_CPU_RT__
+#include "../../iterator/mapped_host_iterator.hpp"
+#endif
+#include "../../iterator/permutation_iterator.hpp"
+#include "../../iterator/tee_output_iterator.hpp"
+#include "../../iterator/transform_output_iterator.hpp"
+#include "../../iterator/zip_iterator.hpp"
+#include "../../types/tuple.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -68,6 +78,420 @@ private:
     BinaryFunction binary_op_;
 };
 
+// Wrapper for unpacking tuple to be used with a function of several arguments.
+// See transform function which accepts tuples of input and output iterators.
+template<class NaryFunction>
+struct unpack_nary_op
+{
+    ROCPRIM_HOST_DEVICE inline
+    unpack_nary_op() = default;
+
+    ROCPRIM_HOST_DEVICE inline
+    unpack_nary_op(NaryFunction nary_op) : nary_op_(nary_op)
+    {
+    }
+
+    template<class... Types>
+    ROCPRIM_HOST_DEVICE inline
+    auto operator()(const ::rocprim::tuple<Types...>& t)
+        -> decltype(std::declval<NaryFunction&>()(std::declval<const Types&>()...))
+    {
+        return invoke(t, ::rocprim::index_sequence_for<Types...>());
+    }
+
+private:
+    template<class... Types, size_t... Indices>
+    ROCPRIM_HOST_DEVICE inline
+    auto invoke(const ::rocprim::tuple<Types...>& t, ::rocprim::index_sequence<Indices...>)
+        -> decltype(std::declval<NaryFunction&>()(::rocprim::get<Indices>(t)...))
+    {
+        return nary_op_(::rocprim::get<Indices>(t)...);
+    }
+
+    NaryFunction nary_op_;
+};
+
+// Items of full blocks are accessed as 16-byte vectors if the iterators are pointers, the items of
+// a thread fill whole vectors and the block is aligned. Other iterators use blocked accesses, which
+// are never selected at run time.
+using transform_vector_type = typename make_vector_type<int, 4>::type;
+
+template<class Iterator, unsigned int ItemsPerThread>
+struct transform_vector_access : std::false_type
+{
+    ROCPRIM_HOST_DEVICE static inline
+    bool is_aligned(Iterator)
+    {
+        return false;
+    }
+
+    template<class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    void load(unsigned int flat_id, Iterator block_input, U (&items)[ItemsPerThread])
+    {
+        block_load_direct_blocked(flat_id, block_input, items);
+    }
+
+    template<class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    void store(unsigned int flat_id, Iterator block_output, U (&items)[ItemsPerThread])
+    {
+        block_store_direct_blocked(flat_id, block_output, items);
+    }
+};
+
+template<class T, unsigned int ItemsPerThread>
+struct transform_vector_access<T*, ItemsPerThread>
+    : std::integral_constant<bool, (sizeof(T) * ItemsPerThread) % sizeof(transform_vector_type) == 0>
+{
+    static constexpr unsigned int vectors_per_thread
+        = (sizeof(T) * ItemsPerThread) / sizeof(transform_vector_type);
+
+    ROCPRIM_HOST_DEVICE static inline
+    bool is_aligned(T* ptr)
+    {
+        return reinterpret_cast<uintptr_t>(ptr) % sizeof(transform_vector_type) == 0;
+    }
+
+    template<class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    void load(unsigned int flat_id, T* block_input, U (&items)[ItemsPerThread])
+    {
+        using value_type = typename std::remove_cv<T>::type;
+        transform_vector_type vector_items[vectors_per_thread];
+
+        const transform_vector_type* vector_ptr
+            = reinterpret_cast<const transform_vector_type*>(block_input) + flat_id * vectors_per_thread;
+
+        ROCPRIM_UNROLL
+        for(unsigned int item = 0; item < vectors_per_thread; item++)
+        {
+            vector_items[item] = vector_ptr[item];
+        }
+
+        ROCPRIM_UNROLL
+        for(unsigned int item = 0; item < ItemsPerThread; item++)
+        {
+            items[item] = reinterpret_cast<const value_type*>(vector_items)[item];
+        }
+    }
+
+    template<class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    void store(unsigned int flat_id, T* block_output, U (&items)[ItemsPerThread])
+    {
+        transform_vector_type vector_items[vectors_per_thread];
+
+        ROCPRIM_UNROLL
+        for(unsigned int item = 0; item < ItemsPerThread; item++)
+        {
+            reinterpret_cast<T*>(vector_items)[item] = items[item];
+        }
+
+        transform_vector_type* vector_ptr
+            = reinterpret_cast<transform_vector_type*>(block_output) + flat_id * vectors_per_thread;
+
+        ROCPRIM_UNROLL
+        for(unsigned int item = 0; item < vectors_per_thread; item++)
+        {
+            vector_ptr[item] = vector_items[item];
+        }
+    }
+};
+
+// Gathers and scatters through pointers to indices, the indices are loaded as vectors
+template<class ValueIterator, class Index, unsigned int ItemsPerThread>
+struct transform_vector_access<permutation_iterator<ValueIterator, Index*>, ItemsPerThread>
+    : transform_vector_access<Index*, ItemsPerThread>
+{
+    using index_access = transform_vector_access<Index*, ItemsPerThread>;
+    using index_type   = typename std::remove_cv<Index>::type;
+
+    ROCPRIM_HOST_DEVICE static inline
+    bool is_aligned(permutation_iterator<ValueIterator, Index*> iterator)
+    {
+        return index_access::is_aligned(iterator.indices());
+    }
+
+    template<class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    void load(unsigned int                                flat_id,
+              permutation_iterator<ValueIterator, Index*> block_input,
+              U (&items)[ItemsPerThread])
+    {
+        index_type indices[ItemsPerThread];
+        index_access::load(flat_id, block_input.indices(), indices);
+
+        const ValueIterator values = block_input.values();
+        ROCPRIM_UNROLL
+        for(unsigned int item = 0; item < ItemsPerThread; item++)
+        {
+            items[item] = values[indices[item]];
+        }
+    }
+
+    template<class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    void store(unsigned int                                flat_id,
+               permutation_iterator<ValueIterator, Index*> block_output,
+               U (&items)[ItemsPerThread])
+    {
+        index_type indices[ItemsPerThread];
+        index_access::load(flat_id, block_output.indices(), indices);
+
+        const ValueIterator values = block_output.values();
+        ROCPRIM_UNROLL
+        for(unsigned int item = 0; item < ItemsPerThread; item++)
+        {
+            values[indices[item]] = items[item];
+        }
+    }
+};
+
+#ifndef __HIP_CPU_RT__
+// Host memory accessed in place is read and written as vectors like device pointers, wide accesses
+// use the PCIe or xGMI link far better than the accesses of single items
+template<class T, unsigned int ItemsPerThread>
+struct transform_vector_access<mapped_host_iterator<T>, ItemsPerThread>
+    : transform_vector_access<T*, ItemsPerThread>
+{
+    using pointer_access = transform_vector_access<T*, ItemsPerThread>;
+
+    ROCPRIM_HOST_DEVICE static inline
+    bool is_aligned(mapped_host_iterator<T> iterator)
+    {
+        return pointer_access::is_aligned(iterator.base());
+    }
+
+    template<class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    void load(unsigned int            flat_id,
+              mapped_host_iterator<T> block_input,
+              U (&items)[ItemsPerThread])
+    {
+        pointer_access::load(flat_id, block_input.base(), items);
+    }
+
+    template<class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    void store(unsigned int            flat_id,
+               mapped_host_iterator<T> block_output,
+               U (&items)[ItemsPerThread])
+    {
+        pointer_access::store(flat_id, block_output.base(), items);
+    }
+};
+#endif
+
+// The function of the output iterator is applied in registers, the results are stored as vectors
+template<class OutputIterator, class UnaryFunction, unsigned int ItemsPerThread>
+struct transform_vector_access<transform_output_iterator<OutputIterator, UnaryFunction>,
+                               ItemsPerThread>
+    : std::integral_constant<bool,
+                             transform_vector_access<OutputIterator, ItemsPerThread>::value
+                                 && std::is_trivially_copyable<UnaryFunction>::value>
+{
+    using base_access   = transform_vector_access<OutputIterator, ItemsPerThread>;
+    using iterator_type = transform_output_iterator<OutputIterator, UnaryFunction>;
+
+    ROCPRIM_HOST_DEVICE static inline
+    bool is_aligned(iterator_type iterator)
+    {
+        return base_access::is_aligned(iterator.base());
+    }
+
+    template<class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    void store(unsigned int flat_id, iterator_type block_output, U (&items)[ItemsPerThread])
+    {
+        using result_type = typename std::remove_cv<typename std::remove_reference<
+            typename invoke_result<UnaryFunction, U>::type>::type>::type;
+
+        UnaryFunction transform_op = block_output.transform_op();
+        result_type   results[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int item = 0; item < ItemsPerThread; item++)
+        {
+            results[item] = transform_op(items[item]);
+        }
+        base_access::store(flat_id, block_output.base(), results);
+    }
+};
+
+// Both copies are stored as vectors
+template<class OutputIterator1, class OutputIterator2, unsigned int ItemsPerThread>
+struct transform_vector_access<tee_output_iterator<OutputIterator1, OutputIterator2>,
+                               ItemsPerThread>
+    : std::integral_constant<bool,
+                             transform_vector_access<OutputIterator1, ItemsPerThread>::value
+                                 && transform_vector_access<OutputIterator2, ItemsPerThread>::value>
+{
+    using first_access  = transform_vector_access<OutputIterator1, ItemsPerThread>;
+    using second_access = transform_vector_access<OutputIterator2, ItemsPerThread>;
+    using iterator_type = tee_output_iterator<OutputIterator1, OutputIterator2>;
+
+    ROCPRIM_HOST_DEVICE static inline
+    bool is_aligned(iterator_type iterator)
+    {
+        return first_access::is_aligned(iterator.first())
+               && second_access::is_aligned(iterator.second());
+    }
+
+    template<class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    void store(unsigned int flat_id, iterator_type block_output, U (&items)[ItemsPerThread])
+    {
+        first_access::store(flat_id, block_output.first(), items);
+        second_access::store(flat_id, block_output.second(), items);
+    }
+};
+
+// Zipped pointers of the binary and n-ary transforms, every range is accessed as vectors
+template<unsigned int ItemsPerThread, class... Types>
+struct transform_zip_vector_access
+    : std::integral_constant<
+          bool,
+          all_true<transform_vector_access<Types*, ItemsPerThread>::value...>::value>
+{
+    using iterator_type = ::rocprim::zip_iterator<::rocprim::tuple<Types*...>>;
+
+    template<size_t Index>
+    using stream_access = transform_vector_access<
+        typename ::rocprim::tuple_element<Index, ::rocprim::tuple<Types*...>>::type,
+        ItemsPerThread>;
+
+    template<size_t Index>
+    using stream_value_type = typename std::remove_cv<
+        typename ::rocprim::tuple_element<Index, ::rocprim::tuple<Types...>>::type>::type;
+
+    // The references of the pointers are not dereferenced, only their addresses are taken
+    template<size_t Index>
+    ROCPRIM_HOST_DEVICE static inline
+    auto stream_pointer(iterator_type it) -> decltype(&::rocprim::get<Index>(*it))
+    {
+        return &::rocprim::get<Index>(*it);
+    }
+
+    template<size_t... Indices>
+    ROCPRIM_HOST_DEVICE static inline
+    bool is_aligned_impl(iterator_type it, ::rocprim::index_sequence<Indices...>)
+    {
+        bool aligned = true;
+        auto swallow = {(aligned = aligned && stream_access<Indices>::is_aligned(stream_pointer<Indices>(it)), 0)...};
+        (void)swallow;
+        return aligned;
+    }
+
+    ROCPRIM_HOST_DEVICE static inline
+    bool is_aligned(iterator_type it)
+    {
+        return is_aligned_impl(it, ::rocprim::index_sequence_for<Types...>());
+    }
+
+    template<size_t Index, class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    void load_stream(unsigned int flat_id, iterator_type block_input, U (&items)[ItemsPerThread])
+    {
+        stream_value_type<Index> stream_items[ItemsPerThread];
+        stream_access<Index>::load(flat_id, stream_pointer<Index>(block_input), stream_items);
+
+        ROCPRIM_UNROLL
+        for(unsigned int item = 0; item < ItemsPerThread; item++)
+        {
+            ::rocprim::get<Index>(items[item]) = stream_items[item];
+        }
+    }
+
+    template<size_t Index, class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    void store_stream(unsigned int flat_id, iterator_type block_output, U (&items)[ItemsPerThread])
+    {
+        stream_value_type<Index> stream_items[ItemsPerThread];
+
+        ROCPRIM_UNROLL
+        for(unsigned int item = 0; item < ItemsPerThread; item++)
+        {
+            stream_items[item] = ::rocprim::get<Index>(items[item]);
+        }
+
+        stream_access<Index>::store(flat_id, stream_pointer<Index>(block_output), stream_items);
+    }
+
+    template<class U, size_t... Indices>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    void load_impl(unsigned int flat_id,
+                   iterator_type block_input,
+                   U (&items)[ItemsPerThread],
+                   ::rocprim::index_sequence<Indices...>)
+    {
+        auto swallow = {(load_stream<Indices>(flat_id, block_input, items), 0)...};
+        (void)swallow;
+    }
+
+    template<class U, size_t... Indices>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    void store_impl(unsigned int flat_id,
+                    iterator_type block_output,
+                    U (&items)[ItemsPerThread],
+                    ::rocprim::index_sequence<Indices...>)
+    {
+        auto swallow = {(store_stream<Indices>(flat_id, block_output, items), 0)...};
+        (void)swallow;
+    }
+
+    template<class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    void load(unsigned int flat_id, iterator_type block_input, U (&items)[ItemsPerThread])
+    {
+        load_impl(flat_id, block_input, items, ::rocprim::index_sequence_for<Types...>());
+    }
+
+    template<class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    void store(unsigned int flat_id, iterator_type block_output, U (&items)[ItemsPerThread])
+    {
+        store_impl(flat_id, block_output, items, ::rocprim::index_sequence_for<Types...>());
+    }
+};
+
+template<class... Types, unsigned int ItemsPerThread>
+struct transform_vector_access<::rocprim::zip_iterator<::rocprim::tuple<Types*...>>, ItemsPerThread>
+    : transform_zip_vector_access<ItemsPerThread, Types...>
+{};
+
+// Returns the number of items before the first item at which the input and the output are both
+// aligned for vector accesses, or 0 if they cannot be aligned together.
+template<unsigned int ItemsPerThread, class InputIterator, class OutputIterator>
+inline size_t transform_unaligned_head(InputIterator input, OutputIterator output, const size_t size)
+{
+    using input_access = transform_vector_access<InputIterator, ItemsPerThread>;
+    using output_access = transform_vector_access<OutputIterator, ItemsPerThread>;
+
+    if(!input_access::value || !output_access::value)
+    {
+        return 0;
+    }
+    for(size_t head = 0; head < ::rocprim::min<size_t>(size, sizeof(transform_vector_type)); head++)
+    {
+        if(input_access::is_aligned(input + head) && output_access::is_aligned(output + head))
+        {
+            return head;
+        }
+    }
+    return 0;
+}
+
+// Output value types which can not hold the results: void (the value type of write-only
+// output iterators) or tuples with a void element (zipped outputs of such iterators)
+template<class T>
+struct output_type_has_void : std::is_void<T>
+{};
+
+template<class... Types>
+struct output_type_has_void<::rocprim::tuple<Types...>>
+    : std::integral_constant<bool, !all_true<!output_type_has_void<Types>::value...>::value>
+{};
+
 template<
     unsigned int BlockSize,
     unsigned int ItemsPerThread,
@@ -77,42 +501,37 @@ template<
     class UnaryFunction
 >
 ROCPRIM_DEVICE ROCPRIM_INLINE
-void transform_kernel_impl(InputIterator input,
-                           const size_t input_size,
-                           OutputIterator output,
-                           UnaryFunction transform_op)
+void transform_block(InputIterator block_input,
+                     OutputIterator block_output,
+                     const bool is_full_block,
+                     const unsigned int valid_in_block,
+                     UnaryFunction transform_op)
 {
     using input_type = typename std::iterator_traits<InputIterator>::value_type;
     using output_type = typename std::iterator_traits<OutputIterator>::value_type;
     using result_type =
         typename std::conditional<
-            std::is_void<output_type>::value, ResultType, output_type
+            output_type_has_void<output_type>::value, ResultType, output_type
         >::type;
 
-    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
-
     const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
-    const unsigned int flat_block_id = ::rocprim::detail::block_id<0>();
-    const unsigned int block_offset = flat_block_id * items_per_block;
-    const unsigned int number_of_blocks = ::rocprim::detail::grid_size<0>();
-    const unsigned int valid_in_last_block = input_size - block_offset;
 
     input_type input_values[ItemsPerThread];
     result_type output_values[ItemsPerThread];
 
-    if(flat_block_id == (number_of_blocks - 1)) // last block
+    if(!is_full_block)
     {
-        block_load_direct_striped<BlockSize>(
+        block_load_direct_striped_buffer<BlockSize>(
             flat_id,
-            input + block_offset,
+            block_input,
             input_values,
-            valid_in_last_block
+            valid_in_block
         );
 
         ROCPRIM_UNROLL
         for(unsigned int i = 0; i < ItemsPerThread; i++)
         {
-            if(BlockSize * i + flat_id < valid_in_last_block)
+            if(BlockSize * i + flat_id < valid_in_block)
             {
                 output_values[i] = transform_op(input_values[i]);
             }
@@ -120,16 +539,34 @@ void transform_kernel_impl(InputIterator input,
 
         block_store_direct_striped<BlockSize>(
             flat_id,
-            output + block_offset,
+            block_output,
             output_values,
-            valid_in_last_block
+            valid_in_block
         );
     }
     else
     {
+        using input_access = transform_vector_access<InputIterator, ItemsPerThread>;
+        using output_access = transform_vector_access<OutputIterator, ItemsPerThread>;
+
+        if(input_access::value && output_access::value
+           && input_access::is_aligned(block_input) && output_access::is_aligned(block_output))
+        {
+            input_access::load(flat_id, block_input, input_values);
+
+            ROCPRIM_UNROLL
+            for(unsigned int i = 0; i < ItemsPerThread; i++)
+            {
+                output_values[i] = transform_op(input_values[i]);
+            }
+
+            output_access::store(flat_id, block_output, output_values);
+            return;
+        }
+
         block_load_direct_striped<BlockSize>(
             flat_id,
-            input + block_offset,
+            block_input,
             input_values
         );
 
@@ -141,12 +578,91 @@ void transform_kernel_impl(InputIterator input,
 
         block_store_direct_striped<BlockSize>(
             flat_id,
-            output + block_offset,
+            block_output,
             output_values
         );
     }
 }
 
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    class ResultType,
+    class InputIterator,
+    class OutputIterator,
+    class UnaryFunction
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void transform_kernel_impl(InputIterator input,
+                           const size_t input_size,
+                           OutputIterator output,
+                           UnaryFunction transform_op)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int flat_block_id = ::rocprim::detail::block_id<0>();
+    const unsigned int number_of_blocks = ::rocprim::detail::grid_size<0>();
+    const unsigned int number_of_tiles
+        = ::rocprim::detail::ceiling_div<unsigned int>(input_size, items_per_block);
+
+    // A grid limited by blocks_per_cu is smaller than the number of tiles, then every block
+    // transforms every number_of_blocks-th tile
+    for(unsigned int tile = flat_block_id; tile < number_of_tiles; tile += number_of_blocks)
+    {
+        const unsigned int tile_offset = tile * items_per_block;
+        const unsigned int valid_in_last_tile = input_size - tile_offset;
+
+        transform_block<BlockSize, ItemsPerThread, ResultType>(
+            input + tile_offset,
+            output + tile_offset,
+            tile != (number_of_tiles - 1), // last tile
+            valid_in_last_tile,
+            transform_op
+        );
+    }
+}
+
+// The size is only known on the device, the grid is sized for an upper bound of it.
+// Blocks past the size exit early.
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    class ResultType,
+    class InputIterator,
+    class SizeType,
+    class OutputIterator,
+    class UnaryFunction
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void transform_future_size_kernel_impl(InputIterator input,
+                                       const SizeType size,
+                                       const size_t offset,
+                                       OutputIterator output,
+                                       UnaryFunction transform_op)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const size_t total_size = static_cast<size_t>(get_input_value(size));
+    const size_t input_size = total_size > offset ? total_size - offset : 0;
+
+    const unsigned int flat_block_id = ::rocprim::detail::block_id<0>();
+    const size_t block_offset = static_cast<size_t>(flat_block_id) * items_per_block;
+    if(block_offset >= input_size)
+    {
+        return;
+    }
+    const unsigned int valid_in_block
+        = static_cast<unsigned int>(::rocprim::min<size_t>(input_size - block_offset, items_per_block));
+
+    transform_block<BlockSize, ItemsPerThread, ResultType>(
+        input + block_offset,
+        output + block_offset,
+        valid_in_block == items_per_block,
+        valid_in_block,
+        transform_op
+    );
+}
+
 } // end of detail namespace
 
 END_ROCPRIM_NAMESPACE
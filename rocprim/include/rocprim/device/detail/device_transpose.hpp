@@ -0,0 +1,206 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_TRANSPOSE_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_TRANSPOSE_HPP_
+
+#include <iterator>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+
+#include "../../intrinsics.hpp"
+
+#include "../../block/block_exchange.hpp"
+#include "../../block/block_load.hpp"
+#include "../../block/block_store.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// The iterators of the fields of a struct of arrays, passed to the kernels by value
+template<class Iterator, unsigned int Fields>
+struct transpose_field_iterators
+{
+    Iterator fields[Fields];
+
+    ROCPRIM_HOST_DEVICE Iterator& operator[](unsigned int field)
+    {
+        return fields[field];
+    }
+
+    ROCPRIM_HOST_DEVICE const Iterator& operator[](unsigned int field) const
+    {
+        return fields[field];
+    }
+};
+
+// Every thread loads RecordsPerThread whole records with vector loads of its consecutive values,
+// every field is moved to the striped arrangement in shared memory and stored coalesced. With one
+// record per thread the blocked and striped arrangements are the same, so nothing is exchanged.
+template<unsigned int BlockSize,
+         unsigned int RecordsPerThread,
+         unsigned int Fields,
+         class T,
+         class InputIterator,
+         class OutputIterator>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void aos_to_soa_kernel_impl(InputIterator                                       input,
+                            transpose_field_iterators<OutputIterator, Fields> outputs,
+                            const size_t                                        size)
+{
+    static constexpr unsigned int items_per_thread  = RecordsPerThread * Fields;
+    static constexpr unsigned int records_per_block = BlockSize * RecordsPerThread;
+
+    using load_type = ::rocprim::
+        block_load<T, BlockSize, items_per_thread, block_load_method::block_load_vectorize>;
+    using exchange_type = ::rocprim::block_exchange<T, BlockSize, RecordsPerThread>;
+
+    ROCPRIM_SHARED_MEMORY typename exchange_type::storage_type storage;
+
+    const unsigned int flat_id      = ::rocprim::detail::block_thread_id<0>();
+    const size_t       block_offset = static_cast<size_t>(::rocprim::detail::block_id<0>())
+                                * records_per_block;
+    const unsigned int valid = static_cast<unsigned int>(
+        ::rocprim::min<size_t>(size - block_offset, records_per_block));
+    const bool full_block = valid == records_per_block;
+
+    T values[items_per_thread];
+    if(full_block)
+    {
+        load_type().load(input + block_offset * Fields, values);
+    }
+    else
+    {
+        load_type().load(input + block_offset * Fields, values, valid * Fields);
+    }
+
+    ROCPRIM_UNROLL
+    for(unsigned int field = 0; field < Fields; field++)
+    {
+        T field_values[RecordsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int record = 0; record < RecordsPerThread; record++)
+        {
+            field_values[record] = values[record * Fields + field];
+        }
+        if ROCPRIM_IF_CONSTEXPR(RecordsPerThread > 1)
+        {
+            if(field > 0)
+            {
+                ::rocprim::syncthreads();
+            }
+            exchange_type().blocked_to_striped(field_values, field_values, storage);
+        }
+        if(full_block)
+        {
+            block_store_direct_striped<BlockSize>(flat_id,
+                                                  outputs[field] + block_offset,
+                                                  field_values);
+        }
+        else
+        {
+            block_store_direct_striped<BlockSize>(flat_id,
+                                                  outputs[field] + block_offset,
+                                                  field_values,
+                                                  valid);
+        }
+    }
+}
+
+// The fields are loaded coalesced in the striped arrangement and moved to the blocked
+// arrangement in shared memory, then every thread stores its whole records with vector stores
+template<unsigned int BlockSize,
+         unsigned int RecordsPerThread,
+         unsigned int Fields,
+         class T,
+         class InputIterator,
+         class OutputIterator>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void soa_to_aos_kernel_impl(transpose_field_iterators<InputIterator, Fields> inputs,
+                            OutputIterator                                     output,
+                            const size_t                                       size)
+{
+    static constexpr unsigned int items_per_thread  = RecordsPerThread * Fields;
+    static constexpr unsigned int records_per_block = BlockSize * RecordsPerThread;
+
+    using store_type = ::rocprim::
+        block_store<T, BlockSize, items_per_thread, block_store_method::block_store_vectorize>;
+    using exchange_type = ::rocprim::block_exchange<T, BlockSize, RecordsPerThread>;
+
+    ROCPRIM_SHARED_MEMORY typename exchange_type::storage_type storage;
+
+    const unsigned int flat_id      = ::rocprim::detail::block_thread_id<0>();
+    const size_t       block_offset = static_cast<size_t>(::rocprim::detail::block_id<0>())
+                                * records_per_block;
+    const unsigned int valid = static_cast<unsigned int>(
+        ::rocprim::min<size_t>(size - block_offset, records_per_block));
+    const bool full_block = valid == records_per_block;
+
+    T values[items_per_thread];
+    ROCPRIM_UNROLL
+    for(unsigned int field = 0; field < Fields; field++)
+    {
+        T field_values[RecordsPerThread];
+        if(full_block)
+        {
+            block_load_direct_striped<BlockSize>(flat_id,
+                                                 inputs[field] + block_offset,
+                                                 field_values);
+        }
+        else
+        {
+            block_load_direct_striped<BlockSize>(flat_id,
+                                                 inputs[field] + block_offset,
+                                                 field_values,
+                                                 valid);
+        }
+        if ROCPRIM_IF_CONSTEXPR(RecordsPerThread > 1)
+        {
+            if(field > 0)
+            {
+                ::rocprim::syncthreads();
+            }
+            exchange_type().striped_to_blocked(field_values, field_values, storage);
+        }
+        ROCPRIM_UNROLL
+        for(unsigned int record = 0; record < RecordsPerThread; record++)
+        {
+            values[record * Fields + field] = field_values[record];
+        }
+    }
+
+    if(full_block)
+    {
+        store_type().store(output + block_offset * Fields, values);
+    }
+    else
+    {
+        store_type().store(output + block_offset * Fields, values, valid * Fields);
+    }
+}
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_TRANSPOSE_HPP_
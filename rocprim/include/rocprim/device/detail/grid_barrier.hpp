@@ -0,0 +1,100 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_GRID_BARRIER_HPP_
+#define ROCPRIM_DEVICE_DETAIL_GRID_BARRIER_HPP_
+
+#include "../../config.hpp"
+#include "../../detail/temp_storage.hpp"
+#include "../../intrinsics.hpp"
+
+#include "lookback_scan_state.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// A barrier of all blocks of a grid. All blocks of the grid must be resident at once, so the
+// grid must not be larger than the number of blocks the device can run concurrently.
+// The state is the number of blocks that arrived at the barrier and the generation of the
+// barrier, it must be zeroed before the launch. Every block reads the generation and arrives,
+// the last block to arrive resets the count and starts the next generation, which the other
+// blocks wait for.
+struct grid_barrier
+{
+    ROCPRIM_HOST static inline
+    grid_barrier create(unsigned int * state)
+    {
+        grid_barrier barrier;
+        barrier.state = state;
+        return barrier;
+    }
+
+    ROCPRIM_HOST static inline
+    size_t get_storage_size()
+    {
+        return 2 * sizeof(unsigned int);
+    }
+
+    ROCPRIM_HOST static inline detail::temp_storage::layout get_temp_storage_layout()
+    {
+        return detail::temp_storage::layout{get_storage_size(), alignof(unsigned int)};
+    }
+
+    // Returns when all blocks of the grid called it, the global memory writes of every block
+    // before the call are visible to all blocks after it
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sync()
+    {
+        ::rocprim::syncthreads();
+        if(::rocprim::detail::block_thread_id<0>() == 0)
+        {
+            unsigned int* const arrived    = state;
+            unsigned int* const generation = state + 1;
+
+            const unsigned int current = ::rocprim::detail::atomic_load_acquire(generation);
+            ::rocprim::detail::memory_fence_device();
+            const unsigned int blocks = ::rocprim::detail::grid_size<0>();
+            if(::rocprim::detail::atomic_add(arrived, 1u) == blocks - 1)
+            {
+                ::rocprim::detail::atomic_exch(arrived, 0u);
+                ::rocprim::detail::atomic_store_release(generation, current + 1);
+            }
+            else
+            {
+                while(::rocprim::detail::atomic_load_acquire(generation) == current)
+                {
+                    lookback_sleep();
+                }
+            }
+            ::rocprim::detail::memory_fence_device();
+        }
+        ::rocprim::syncthreads();
+    }
+
+    unsigned int* state;
+};
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_GRID_BARRIER_HPP_
@@ -27,14 +27,18 @@
 #include "../../intrinsics.hpp"
 #include "../../type_traits.hpp"
 #include "../../types.hpp"
+#include "../../types/tuple.hpp"
 
 #include "../../warp/detail/warp_reduce_crosslane.hpp"
 #include "../../warp/detail/warp_scan_crosslane.hpp"
 
 #include "../../detail/binary_op_wrappers.hpp"
+#include "../../detail/device_properties.hpp"
 #include "../../detail/temp_storage.hpp"
 #include "../../detail/various.hpp"
 
+#include "../config_types.hpp"
+
 extern "C"
 {
     void __builtin_amdgcn_s_sleep(int);
@@ -60,6 +64,101 @@ enum prefix_flag
     PREFIX_COMPLETE = 2
 };
 
+// The flags of the prefixes can be tagged with the epoch of the launch that wrote them, then
+// a state reused by consecutive launches is not initialized again: the prefixes of the other
+// epochs are empty for the current launch. Epoch 0 is the untagged state, which is initialized
+// before every launch. The padding keeps PREFIX_INVALID, which is not a tagged flag (the complete
+// flag of the epoch 63 would be PREFIX_INVALID in a char).
+constexpr unsigned int lookback_max_epoch = 62;
+
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void lookback_sleep()
+{
+#ifndef __HIP_CPU_RT__
+    __builtin_amdgcn_s_sleep(1);
+#else
+    std::this_thread::sleep_for(std::chrono::microseconds{1});
+#endif
+}
+
+// Backoff policies of the look-back, wait() is called before every poll of a prefix that was
+// still empty. A new policy object is used for every prefix.
+struct lookback_spin_backoff
+{
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void wait() {}
+};
+
+// The number of sleep intervals, which are constants of s_sleep, grows by one up to MaxSleep.
+template<unsigned int MaxSleep = 32>
+struct lookback_bounded_sleep_backoff
+{
+    unsigned int sleeps = 1;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void wait()
+    {
+        for(unsigned int i = 0; i < sleeps; i++)
+        {
+            lookback_sleep();
+        }
+        sleeps = ::rocprim::min(sleeps + 1, MaxSleep);
+    }
+};
+
+// The number of sleep intervals doubles up to MaxSleep.
+template<unsigned int MaxSleep = 64>
+struct lookback_exponential_sleep_backoff
+{
+    unsigned int sleeps = 1;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void wait()
+    {
+        for(unsigned int i = 0; i < sleeps; i++)
+        {
+            lookback_sleep();
+        }
+        sleeps = ::rocprim::min(sleeps * 2, MaxSleep);
+    }
+};
+
+// Backoff of the look-back state with UseSleep, it is the policy of lookback_backoff::automatic.
+template<bool UseSleep>
+using default_lookback_backoff = typename std::
+    conditional<UseSleep, lookback_bounded_sleep_backoff<>, lookback_spin_backoff>::type;
+
+// Policy type of Backoff for LookbackScanState
+template<lookback_backoff Backoff, class LookbackScanState>
+struct select_lookback_backoff
+{
+    using type = typename LookbackScanState::default_backoff_type;
+};
+
+template<class LookbackScanState>
+struct select_lookback_backoff<lookback_backoff::spin, LookbackScanState>
+{
+    using type = lookback_spin_backoff;
+};
+
+template<class LookbackScanState>
+struct select_lookback_backoff<lookback_backoff::exponential_sleep, LookbackScanState>
+{
+    using type = lookback_exponential_sleep_backoff<>;
+};
+
+template<class LookbackScanState>
+struct select_lookback_backoff<lookback_backoff::bounded_sleep, LookbackScanState>
+{
+    using type = lookback_bounded_sleep_backoff<>;
+};
+
+// Backoff policy type of Config for LookbackScanState
+template<class Config, class LookbackScanState>
+using config_lookback_backoff_type =
+    typename select_lookback_backoff<config_lookback_backoff<Config>::value,
+                                     LookbackScanState>::type;
+
 // lookback_scan_state object keeps track of prefixes status for
 // a look-back prefix scan. Initially every prefix can be either
 // invalid (padding values) or empty. One thread in a block should
@@ -96,17 +195,29 @@ public:
     // Type used for flag/flag of block prefix
     using flag_type = flag_type_;
     using value_type = T;
+    // Backoff of the look-back when no policy is given
+    using default_backoff_type = default_lookback_backoff<UseSleep>;
 
     // temp_storage must point to allocation of get_storage_size(number_of_blocks) bytes
     ROCPRIM_HOST static inline
-    lookback_scan_state create(void* temp_storage, const unsigned int number_of_blocks)
+    lookback_scan_state create(void* temp_storage,
+                               const unsigned int number_of_blocks,
+                               const unsigned int epoch = 0)
     {
         (void) number_of_blocks;
         lookback_scan_state state;
         state.prefixes = reinterpret_cast<prefix_underlying_type*>(temp_storage);
+        state.epoch    = epoch;
         return state;
     }
 
+    // Tags the prefixes written and read by the next launch with epoch
+    ROCPRIM_HOST inline
+    void set_epoch(const unsigned int epoch)
+    {
+        this->epoch = epoch;
+    }
+
     ROCPRIM_HOST static inline
     size_t get_storage_size(const unsigned int number_of_blocks)
     {
@@ -165,15 +276,14 @@ public:
     }
 
     // block_id must be > 0
+    template<class Backoff = default_backoff_type>
     ROCPRIM_DEVICE ROCPRIM_INLINE
     void get(const unsigned int block_id, flag_type& flag, T& value)
     {
         constexpr unsigned int padding = ::rocprim::device_warp_size();
 
         prefix_type prefix;
-
-        const unsigned int SLEEP_MAX = 32;
-        unsigned int times_through = 1;
+        Backoff     backoff;
 
         prefix_underlying_type p = ::rocprim::detail::atomic_add(&prefixes[padding + block_id], 0);
 #ifndef __HIP_CPU_RT__
@@ -181,19 +291,10 @@ public:
 #else
         std::memcpy(&prefix, &p, sizeof(prefix_type));
 #endif
-        while(prefix.flag == PREFIX_EMPTY)
+        flag = untag(prefix.flag);
+        while(flag == PREFIX_EMPTY)
         {
-            if (UseSleep)
-            {
-                for (unsigned int j = 0; j < times_through; j++)
-#ifndef __HIP_CPU_RT__
-                    __builtin_amdgcn_s_sleep(1);
-#else
-                    std::this_thread::sleep_for(std::chrono::microseconds{1});
-#endif
-                if (times_through < SLEEP_MAX)
-                    times_through++;
-            }
+            backoff.wait();
             // atomic_add(..., 0) is used to load values atomically
             prefix_underlying_type p = ::rocprim::detail::atomic_add(&prefixes[padding + block_id], 0);
 #ifndef __HIP_CPU_RT__
@@ -201,10 +302,10 @@ public:
 #else
             std::memcpy(&prefix, &p, sizeof(prefix_type));
 #endif
+            flag = untag(prefix.flag);
         }
 
         // return
-        flag = prefix.flag;
         value = prefix.value;
     }
 
@@ -214,7 +315,8 @@ private:
     {
         constexpr unsigned int padding = ::rocprim::device_warp_size();
 
-        prefix_type prefix = { flag, value };
+        const prefix_type prefix
+            = {static_cast<flag_type>(static_cast<unsigned char>(flag) | (epoch << 2)), value};
         prefix_underlying_type p;
 #ifndef __HIP_CPU_RT__
         __builtin_memcpy(&p, &prefix, sizeof(prefix_type));
@@ -224,22 +326,49 @@ private:
         ::rocprim::detail::atomic_exch(&prefixes[padding + block_id], p);
     }
 
+    // The flag of the current epoch, flags of other epochs are empty
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    flag_type untag(const flag_type tagged_flag) const
+    {
+        const unsigned int bits = static_cast<unsigned char>(tagged_flag);
+        if(tagged_flag == PREFIX_INVALID)
+        {
+            return tagged_flag;
+        }
+        return (bits >> 2) == epoch ? static_cast<flag_type>(bits & 3u) : flag_type(PREFIX_EMPTY);
+    }
+
     prefix_underlying_type * prefixes;
+    unsigned int epoch;
 };
 
-// Flag, partial and final prefixes are stored in separate arrays.
-// Consistency ensured by memory fences between flag and prefixes load/store operations.
+// Flags are stored in a separate array, the partial and the complete prefix of a block are
+// packed next to each other in the array of payloads, so prefixes of any size can be used.
+// Consistency is ensured by release stores and acquire loads of the flags: the payload is written
+// before the flag is released, and it is read after the flag is acquired.
 template<class T, bool UseSleep>
 struct lookback_scan_state<T, UseSleep, false>
 {
+private:
+    // We need separate partial and complete prefixes, because the value could be overwritten
+    // while a block reads it after loading the partial flag.
+    struct prefix_payload
+    {
+        T partial;
+        T complete;
+    };
 
 public:
     using flag_type  = unsigned int;
     using value_type = T;
+    // Backoff of the look-back when no policy is given
+    using default_backoff_type = default_lookback_backoff<UseSleep>;
 
     // temp_storage must point to allocation of get_storage_size(number_of_blocks) bytes
     ROCPRIM_HOST static inline
-    lookback_scan_state create(void* temp_storage, const unsigned int number_of_blocks)
+    lookback_scan_state create(void* temp_storage,
+                               const unsigned int number_of_blocks,
+                               const unsigned int epoch = 0)
     {
         const auto n = ::rocprim::host_warp_size() + number_of_blocks;
         lookback_scan_state state;
@@ -247,28 +376,31 @@ public:
         auto ptr = static_cast<char*>(temp_storage);
 
         state.prefixes_flags = reinterpret_cast<flag_type*>(ptr);
-        ptr += ::rocprim::detail::align_size(n * sizeof(flag_type));
-
-        state.prefixes_partial_values = reinterpret_cast<T*>(ptr);
-        ptr += ::rocprim::detail::align_size(n * sizeof(T));
+        ptr += get_payloads_offset(n);
 
-        state.prefixes_complete_values = reinterpret_cast<T*>(ptr);
+        state.prefixes_payloads = reinterpret_cast<prefix_payload*>(ptr);
+        state.epoch             = epoch;
         return state;
     }
 
+    // Tags the prefixes written and read by the next launch with epoch
+    ROCPRIM_HOST inline
+    void set_epoch(const unsigned int epoch)
+    {
+        this->epoch = epoch;
+    }
+
     ROCPRIM_HOST static inline
     size_t get_storage_size(const unsigned int number_of_blocks)
     {
         const auto n = ::rocprim::host_warp_size() + number_of_blocks;
-        size_t size = ::rocprim::detail::align_size(n * sizeof(flag_type));
-        size += 2 * ::rocprim::detail::align_size(n * sizeof(T));
-        return size;
+        return get_payloads_offset(n) + n * sizeof(prefix_payload);
     }
 
     ROCPRIM_HOST static inline detail::temp_storage::layout
         get_temp_storage_layout(const unsigned int number_of_blocks)
     {
-        size_t alignment = std::max(alignof(flag_type), alignof(T));
+        size_t alignment = std::max(alignof(flag_type), alignof(prefix_payload));
         return detail::temp_storage::layout{get_storage_size(number_of_blocks), alignment};
     }
 
@@ -292,9 +424,9 @@ public:
     {
         constexpr unsigned int padding = ::rocprim::device_warp_size();
 
-        prefixes_partial_values[padding + block_id] = value;
-        ::rocprim::detail::memory_fence_device();
-        ::rocprim::detail::atomic_exch(&prefixes_flags[padding + block_id], PREFIX_PARTIAL);
+        prefixes_payloads[padding + block_id].partial = value;
+        ::rocprim::detail::atomic_store_release(&prefixes_flags[padding + block_id],
+                                                PREFIX_PARTIAL | (epoch << 2));
     }
 
     ROCPRIM_DEVICE ROCPRIM_INLINE
@@ -302,57 +434,226 @@ public:
     {
         constexpr unsigned int padding = ::rocprim::device_warp_size();
 
-        prefixes_complete_values[padding + block_id] = value;
-        ::rocprim::detail::memory_fence_device();
-        ::rocprim::detail::atomic_exch(&prefixes_flags[padding + block_id], PREFIX_COMPLETE);
+        prefixes_payloads[padding + block_id].complete = value;
+        ::rocprim::detail::atomic_store_release(&prefixes_flags[padding + block_id],
+                                                PREFIX_COMPLETE | (epoch << 2));
     }
 
     // block_id must be > 0
+    template<class Backoff = default_backoff_type>
     ROCPRIM_DEVICE ROCPRIM_INLINE
     void get(const unsigned int block_id, flag_type& flag, T& value)
     {
         constexpr unsigned int padding = ::rocprim::device_warp_size();
 
-        const unsigned int SLEEP_MAX = 32;
-        unsigned int times_through = 1;
+        Backoff backoff;
 
-        // atomic_add(..., 0) is used to load values atomically
-        flag = ::rocprim::detail::atomic_add(&prefixes_flags[padding + block_id], 0);
-        ::rocprim::detail::memory_fence_device();
+        flag = untag(::rocprim::detail::atomic_load_acquire(&prefixes_flags[padding + block_id]));
         while(flag == PREFIX_EMPTY)
         {
-            if (UseSleep)
-            {
-                for (unsigned int j = 0; j < times_through; j++)
-#ifndef __HIP_CPU_RT__
-                    __builtin_amdgcn_s_sleep(1);
-#else
-                    std::this_thread::sleep_for(std::chrono::microseconds{1});
-#endif
-                if (times_through < SLEEP_MAX)
-                    times_through++;
-            }
-
-            flag = ::rocprim::detail::atomic_add(&prefixes_flags[padding + block_id], 0);
-            ::rocprim::detail::memory_fence_device();
+            backoff.wait();
+            flag = untag(
+                ::rocprim::detail::atomic_load_acquire(&prefixes_flags[padding + block_id]));
         }
 
         if(flag == PREFIX_PARTIAL)
-            value = prefixes_partial_values[padding + block_id];
+            value = prefixes_payloads[padding + block_id].partial;
         else
-            value = prefixes_complete_values[padding + block_id];
+            value = prefixes_payloads[padding + block_id].complete;
     }
 
 private:
+    ROCPRIM_HOST static inline
+    size_t get_payloads_offset(const size_t n)
+    {
+        return ::rocprim::detail::align_size(n * sizeof(flag_type));
+    }
+
+    // The flag of the current epoch, flags of other epochs are empty
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    flag_type untag(const flag_type tagged_flag) const
+    {
+        if(tagged_flag == static_cast<flag_type>(PREFIX_INVALID))
+        {
+            return tagged_flag;
+        }
+        return (tagged_flag >> 2) == epoch ? tagged_flag & 3u : flag_type(PREFIX_EMPTY);
+    }
+
     flag_type * prefixes_flags;
-    // We need to separate arrays for partial and final prefixes, because
-    // value can be overwritten before flag is changed (flag and value are
-    // not stored in single instruction).
-    T * prefixes_partial_values;
-    T * prefixes_complete_values;
+    prefix_payload * prefixes_payloads;
+    unsigned int epoch;
 };
 
-template<class T, class BinaryFunction, class LookbackScanState>
+// Look-back state of scan-by-key, which scans (value, flag) pairs. The flag of the pair is packed
+// into the status word of the block, so the payload is only the value, without the padding
+// of the pair. Values which are small enough with the flag still use the single atomic path.
+template<class T, bool UseSleep>
+struct lookback_scan_state<::rocprim::tuple<T, bool>, UseSleep, false>
+{
+private:
+    using pair_type = ::rocprim::tuple<T, bool>;
+
+    // Bit of the status word which holds the flag of the pair, the epoch is above it
+    static constexpr unsigned int pair_flag_bit = 1u << 8;
+    static constexpr unsigned int epoch_shift   = 9;
+
+    struct prefix_payload
+    {
+        T partial;
+        T complete;
+    };
+
+public:
+    using flag_type  = unsigned int;
+    using value_type = pair_type;
+    // Backoff of the look-back when no policy is given
+    using default_backoff_type = default_lookback_backoff<UseSleep>;
+
+    // temp_storage must point to allocation of get_storage_size(number_of_blocks) bytes
+    ROCPRIM_HOST static inline
+    lookback_scan_state create(void* temp_storage,
+                               const unsigned int number_of_blocks,
+                               const unsigned int epoch = 0)
+    {
+        const auto n = ::rocprim::host_warp_size() + number_of_blocks;
+        lookback_scan_state state;
+
+        auto ptr = static_cast<char*>(temp_storage);
+
+        state.prefixes_statuses = reinterpret_cast<unsigned int*>(ptr);
+        ptr += get_payloads_offset(n);
+
+        state.prefixes_payloads = reinterpret_cast<prefix_payload*>(ptr);
+        state.epoch             = epoch;
+        return state;
+    }
+
+    // Tags the prefixes written and read by the next launch with epoch
+    ROCPRIM_HOST inline
+    void set_epoch(const unsigned int epoch)
+    {
+        this->epoch = epoch;
+    }
+
+    ROCPRIM_HOST static inline
+    size_t get_storage_size(const unsigned int number_of_blocks)
+    {
+        const auto n = ::rocprim::host_warp_size() + number_of_blocks;
+        return get_payloads_offset(n) + n * sizeof(prefix_payload);
+    }
+
+    ROCPRIM_HOST static inline detail::temp_storage::layout
+        get_temp_storage_layout(const unsigned int number_of_blocks)
+    {
+        size_t alignment = std::max(alignof(unsigned int), alignof(prefix_payload));
+        return detail::temp_storage::layout{get_storage_size(number_of_blocks), alignment};
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void initialize_prefix(const unsigned int block_id,
+                           const unsigned int number_of_blocks)
+    {
+        constexpr unsigned int padding = ::rocprim::device_warp_size();
+        if(block_id < number_of_blocks)
+        {
+            prefixes_statuses[padding + block_id] = PREFIX_EMPTY;
+        }
+        if(block_id < padding)
+        {
+            prefixes_statuses[block_id] = static_cast<unsigned int>(PREFIX_INVALID);
+        }
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void set_partial(const unsigned int block_id, const pair_type value)
+    {
+        constexpr unsigned int padding = ::rocprim::device_warp_size();
+
+        prefixes_payloads[padding + block_id].partial = ::rocprim::get<0>(value);
+        ::rocprim::detail::atomic_store_release(&prefixes_statuses[padding + block_id],
+                                                make_status(PREFIX_PARTIAL, value));
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void set_complete(const unsigned int block_id, const pair_type value)
+    {
+        constexpr unsigned int padding = ::rocprim::device_warp_size();
+
+        prefixes_payloads[padding + block_id].complete = ::rocprim::get<0>(value);
+        ::rocprim::detail::atomic_store_release(&prefixes_statuses[padding + block_id],
+                                                make_status(PREFIX_COMPLETE, value));
+    }
+
+    // block_id must be > 0
+    template<class Backoff = default_backoff_type>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void get(const unsigned int block_id, flag_type& flag, pair_type& value)
+    {
+        constexpr unsigned int padding = ::rocprim::device_warp_size();
+
+        Backoff backoff;
+
+        unsigned int status
+            = untag(::rocprim::detail::atomic_load_acquire(&prefixes_statuses[padding + block_id]));
+        while(status == PREFIX_EMPTY)
+        {
+            backoff.wait();
+            status = untag(
+                ::rocprim::detail::atomic_load_acquire(&prefixes_statuses[padding + block_id]));
+        }
+
+        if(status == static_cast<unsigned int>(PREFIX_INVALID))
+        {
+            flag = status;
+            return;
+        }
+        flag = status & (pair_flag_bit - 1);
+        ::rocprim::get<1>(value) = (status & pair_flag_bit) != 0;
+        if(flag == PREFIX_PARTIAL)
+            ::rocprim::get<0>(value) = prefixes_payloads[padding + block_id].partial;
+        else
+            ::rocprim::get<0>(value) = prefixes_payloads[padding + block_id].complete;
+    }
+
+private:
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    unsigned int make_status(const prefix_flag flag, const pair_type& value) const
+    {
+        return static_cast<unsigned int>(flag) | (::rocprim::get<1>(value) ? pair_flag_bit : 0u)
+               | (epoch << epoch_shift);
+    }
+
+    // The status of the current epoch without the epoch, statuses of other epochs are empty
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    unsigned int untag(const unsigned int tagged_status) const
+    {
+        if(tagged_status == static_cast<unsigned int>(PREFIX_INVALID))
+        {
+            return tagged_status;
+        }
+        return (tagged_status >> epoch_shift) == epoch
+                   ? tagged_status & ((1u << epoch_shift) - 1)
+                   : static_cast<unsigned int>(PREFIX_EMPTY);
+    }
+
+    ROCPRIM_HOST static inline
+    size_t get_payloads_offset(const size_t n)
+    {
+        return ::rocprim::detail::align_size(n * sizeof(unsigned int));
+    }
+
+    unsigned int * prefixes_statuses;
+    prefix_payload * prefixes_payloads;
+    unsigned int epoch;
+};
+
+// Backoff is the policy of waiting for the prefixes of the preceding blocks, see
+// lookback_spin_backoff.
+template<class T,
+         class BinaryFunction,
+         class LookbackScanState,
+         class Backoff = typename LookbackScanState::default_backoff_type>
 class lookback_scan_prefix_op
 {
     using flag_type = typename LookbackScanState::flag_type;
@@ -391,7 +692,7 @@ public:
         >;
 
         T block_prefix;
-        scan_state_.get(block_id, flag, block_prefix);
+        scan_state_.template get<Backoff>(block_id, flag, block_prefix);
 
         auto headflag_scan_op = headflag_scan_op_type(scan_op_);
         warp_reduce_prefix_type()
@@ -453,22 +754,12 @@ protected:
 
 inline hipError_t is_sleep_scan_state_used(bool& use_sleep)
 {
-    hipDeviceProp_t prop;
-    int             deviceId;
-    if(const hipError_t error = hipGetDevice(&deviceId))
+    device_properties props;
+    if(const hipError_t error = get_current_device_properties(props))
     {
         return error;
     }
-    else if(const hipError_t error = hipGetDeviceProperties(&prop, deviceId))
-    {
-        return error;
-    }
-#if HIP_VERSION >= 307
-    const int asicRevision = prop.asicRevision;
-#else
-    const int asicRevision = 0;
-#endif
-    use_sleep = prop.gcnArch == 908 && asicRevision < 2;
+    use_sleep = props.use_sleep_scan_state;
     return hipSuccess;
 }
 
@@ -511,12 +802,15 @@ public:
     }
 };
 
-template<class T, class LookbackScanState, class BinaryOp = ::rocprim::plus<T>>
+template<class T,
+         class LookbackScanState,
+         class BinaryOp = ::rocprim::plus<T>,
+         class Backoff  = typename LookbackScanState::default_backoff_type>
 class offset_lookback_scan_prefix_op
-    : public lookback_scan_prefix_op<T, BinaryOp, LookbackScanState>
+    : public lookback_scan_prefix_op<T, BinaryOp, LookbackScanState, Backoff>
 {
 private:
-    using base_type = lookback_scan_prefix_op<T, BinaryOp, LookbackScanState>;
+    using base_type = lookback_scan_prefix_op<T, BinaryOp, LookbackScanState, Backoff>;
     using factory   = detail::offset_lookback_scan_factory<T>;
 
     ROCPRIM_DEVICE ROCPRIM_INLINE base_type& base()
@@ -26,6 +26,7 @@
 
 #include "../../detail/temp_storage.hpp"
 #include "../../detail/various.hpp"
+#include "../../functional.hpp"
 #include "../../intrinsics.hpp"
 #include "../../types.hpp"
 
@@ -86,6 +87,103 @@ struct ordered_block_id
     id_type* id;
 };
 
+// Generates ordered unique ids for blocks in a grid like ordered_block_id, but from several
+// counters (stripes) instead of one. The block with the hardware id b takes the ids of the stripe
+// s = b % stripes: s, s + stripes, s + 2 * stripes and so on. When the stripes match the dies of
+// the device (the XCDs of gfx94x get the blocks in round-robin order), the atomics of a die go to
+// its own counter on its own cache line instead of bouncing one cache line between all dies.
+//
+// Ids are still safe for the look-back: the hardware dispatches the blocks in the order of their
+// ids and the ids of a stripe are taken in increasing order, so when a block holds the id i every
+// id lower than i is taken by a block that is (or was) resident. The number of stripes actually
+// used is limited by the grid size so every stripe is taken by at least one block, persistent
+// blocks that call get() repeatedly stay on their stripe.
+//
+// The counters can be reused by consecutive launches without reset(): a launch of the epoch e
+// raises every counter it takes from to at least e << epoch_shift and subtracts that base from the
+// ids. Then every launch must take fewer than 1 << epoch_shift ids from a stripe (together with
+// the ids left by the previous epoch).
+template<class T /* id type */ = unsigned int,
+         unsigned int MaxStripes = 8>
+struct striped_ordered_block_id
+{
+    static_assert(std::is_integral<T>::value, "T must be integer");
+    using id_type = T;
+
+    static constexpr unsigned int max_stripes = MaxStripes;
+    static constexpr unsigned int stripes
+        = ROCPRIM_DETAIL_ORDERED_BLOCK_ID_STRIPES < MaxStripes
+              ? ROCPRIM_DETAIL_ORDERED_BLOCK_ID_STRIPES
+              : MaxStripes;
+    static_assert(stripes > 0, "ROCPRIM_ORDERED_BLOCK_ID_STRIPES must be positive");
+
+    // Every counter is on its own cache line
+    static constexpr size_t counter_alignment = 128;
+    static constexpr size_t counter_stride    = counter_alignment / sizeof(id_type);
+
+    static constexpr unsigned int epoch_shift = 24;
+
+    // shared memory temporary storage type
+    struct storage_type
+    {
+        id_type id;
+    };
+
+    ROCPRIM_HOST static inline
+    striped_ordered_block_id create(id_type * ids, const unsigned int epoch = 0)
+    {
+        striped_ordered_block_id ordered_id;
+        ordered_id.ids        = ids;
+        ordered_id.epoch_base = static_cast<id_type>(epoch) << epoch_shift;
+        return ordered_id;
+    }
+
+    // The storage has all max_stripes counters because the host does not know how many stripes
+    // the device code uses
+    ROCPRIM_HOST static inline
+    size_t get_storage_size()
+    {
+        return max_stripes * counter_alignment;
+    }
+
+    ROCPRIM_HOST static inline detail::temp_storage::layout get_temp_storage_layout()
+    {
+        return detail::temp_storage::layout{get_storage_size(), counter_alignment};
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void reset()
+    {
+        for(unsigned int stripe = 0; stripe < stripes; stripe++)
+        {
+            ids[stripe * counter_stride] = static_cast<id_type>(0);
+        }
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    id_type get(unsigned int tid, storage_type& storage)
+    {
+        if(tid == 0)
+        {
+            const unsigned int used_stripes
+                = ::rocprim::min(stripes, ::rocprim::detail::grid_size<0>());
+            const unsigned int stripe  = ::rocprim::detail::block_id<0>() % used_stripes;
+            id_type*           counter = ids + stripe * counter_stride;
+            if(epoch_base != 0)
+            {
+                ::rocprim::detail::atomic_max(counter, epoch_base);
+            }
+            const id_type index = ::rocprim::detail::atomic_add(counter, 1) - epoch_base;
+            storage.id          = index * used_stripes + stripe;
+        }
+        ::rocprim::syncthreads();
+        return storage.id;
+    }
+
+    id_type* ids;
+    id_type  epoch_base;
+};
+
 } // end of detail namespace
 
 END_ROCPRIM_NAMESPACE
@@ -22,11 +22,13 @@
 #define ROCPRIM_DEVICE_DEVICE_ADJACENT_DIFFERENCE_HPP_
 
 #include "detail/device_adjacent_difference.hpp"
+#include "detail/ordered_block_id.hpp"
 
 #include "device_adjacent_difference_config.hpp"
 
 #include "config_types.hpp"
 #include "device_transform.hpp"
+#include "instrumentation.hpp"
 
 #include "../config.hpp"
 #include "../functional.hpp"
@@ -57,6 +59,7 @@ BEGIN_ROCPRIM_NAMESPACE
         auto _error = hipGetLastError();                                                         \
         if(_error != hipSuccess)                                                                 \
             return _error;                                                                       \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size);                                          \
         if(debug_synchronous)                                                                    \
         {                                                                                        \
             std::cout << name << "(" << size << ")";                                             \
@@ -76,30 +79,143 @@ template <typename Config,
           bool Right,
           typename InputIt,
           typename OutputIt,
+          typename FlagsIt,
           typename BinaryFunction>
 void ROCPRIM_KERNEL __launch_bounds__(Config::block_size) adjacent_difference_kernel(
     const InputIt                                             input,
     const OutputIt                                            output,
     const std::size_t                                         size,
+    const FlagsIt                                             head_flags,
     const BinaryFunction                                      op,
     const typename std::iterator_traits<InputIt>::value_type* previous_values,
     const std::size_t                                         starting_block)
 {
     adjacent_difference_kernel_impl<Config, InPlace, Right>(
-        input, output, size, op, previous_values, starting_block);
+        input, output, size, head_flags, op, previous_values, starting_block);
 }
 
+template <typename Config,
+          bool Right,
+          typename InputIt,
+          typename FlagsIt,
+          typename BinaryFunction>
+void ROCPRIM_KERNEL __launch_bounds__(Config::block_size)
+    adjacent_difference_ordered_inplace_kernel(
+    const InputIt                  values,
+    const std::size_t              size,
+    const FlagsIt                  head_flags,
+    const BinaryFunction           op,
+    ordered_block_id<unsigned int> ordered_bid,
+    unsigned int* const            read_flags,
+    const std::size_t              starting_block,
+    const unsigned int             id_base)
+{
+    adjacent_difference_ordered_inplace_kernel_impl<Config, Right>(
+        values, size, head_flags, op, ordered_bid, read_flags, starting_block, id_base);
+}
+
+template <typename Config,
+          bool Right,
+          typename InputIt,
+          typename FlagsIt,
+          typename BinaryFunction>
+hipError_t adjacent_difference_ordered_inplace_impl(const InputIt        values,
+                                                    const std::size_t    size,
+                                                    const FlagsIt        head_flags,
+                                                    const BinaryFunction op,
+                                                    unsigned int* const  ordered_state,
+                                                    const hipStream_t    stream,
+                                                    const bool           debug_synchronous)
+{
+    static constexpr unsigned int block_size       = Config::block_size;
+    static constexpr unsigned int items_per_thread = Config::items_per_thread;
+    static constexpr unsigned int items_per_block  = block_size * items_per_thread;
+
+    const std::size_t num_blocks = ceiling_div(size, items_per_block);
+
+    hipError_t error = hipMemsetAsync(ordered_state,
+                                      0,
+                                      (1 + ceiling_div(num_blocks, 32u)) * sizeof(unsigned int),
+                                      stream);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+    auto ordered_bid = ordered_block_id<unsigned int>::create(ordered_state);
+
+    static constexpr unsigned int size_limit     = Config::size_limit;
+    static constexpr auto number_of_blocks_limit = std::max(size_limit / items_per_block, 1u);
+    static constexpr auto aligned_size_limit     = number_of_blocks_limit * items_per_block;
+
+    const auto number_of_launch = ceiling_div(size, aligned_size_limit);
+
+    if(debug_synchronous)
+    {
+        std::cout << "----------------------------------\n";
+        std::cout << "size:               " << size << '\n';
+        std::cout << "aligned_size_limit: " << aligned_size_limit << '\n';
+        std::cout << "number_of_launch:   " << number_of_launch << '\n';
+        std::cout << "block_size:         " << block_size << '\n';
+        std::cout << "items_per_block:    " << items_per_block << '\n';
+        std::cout << "----------------------------------\n";
+    }
+
+    // As the blocks in a launch, the launches go in the order in which their tiles are read
+    unsigned int id_base = 0;
+    for(std::size_t j = 0; j < number_of_launch; ++j)
+    {
+        const std::size_t i              = Right ? j : number_of_launch - 1 - j;
+        const std::size_t offset         = i * aligned_size_limit;
+        const auto        current_size   = static_cast<unsigned int>(
+            std::min<std::size_t>(size - offset, aligned_size_limit));
+        const auto        current_blocks = ceiling_div(current_size, items_per_block);
+        const auto        starting_block = i * number_of_blocks_limit;
+
+        std::chrono::time_point<std::chrono::high_resolution_clock> start;
+        if(debug_synchronous)
+        {
+            std::cout << "index:            " << i << '\n';
+            std::cout << "current_size:     " << current_size << '\n';
+            std::cout << "number of blocks: " << current_blocks << '\n';
+
+            start = std::chrono::high_resolution_clock::now();
+        }
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("adjacent_difference_ordered_inplace_kernel");
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(adjacent_difference_ordered_inplace_kernel<Config, Right>),
+            dim3(current_blocks),
+            dim3(block_size),
+            0,
+            stream,
+            values + offset,
+            size,
+            head_flags,
+            op,
+            ordered_bid,
+            ordered_state + 1,
+            starting_block,
+            id_base);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(
+            "adjacent_difference_ordered_inplace_kernel", current_size, start);
+        id_base += current_blocks;
+    }
+    return hipSuccess;
+}
+
+// The items are only combined within their segments if head_flags is not empty_type
 template <typename Config,
           bool InPlace,
           bool Right,
           typename InputIt,
           typename OutputIt,
+          typename FlagsIt,
           typename BinaryFunction>
 hipError_t adjacent_difference_impl(void* const          temporary_storage,
                                     std::size_t&         storage_size,
                                     const InputIt        input,
                                     const OutputIt       output,
                                     const std::size_t    size,
+                                    const FlagsIt        head_flags,
                                     const BinaryFunction op,
                                     const hipStream_t    stream,
                                     const bool           debug_synchronous)
@@ -114,15 +230,23 @@ hipError_t adjacent_difference_impl(void* const          temporary_storage,
     static constexpr unsigned int items_per_thread = config::items_per_thread;
     static constexpr unsigned int items_per_block  = block_size * items_per_thread;
 
+    static constexpr bool ordered = InPlace && config_ordered_in_place<config>::value;
+
     const std::size_t num_blocks = ceiling_div(size, items_per_block);
-    const std::size_t num_previous_values = InPlace && num_blocks >= 2 ? num_blocks - 1 : 0;
+    const std::size_t num_previous_values
+        = InPlace && !ordered && num_blocks >= 2 ? num_blocks - 1 : 0;
+    // The ordered id and a bit for every tile
+    const std::size_t num_ordered_state = ordered ? 1 + ceiling_div(num_blocks, 32u) : 0;
 
-    value_type* previous_values;
+    value_type*   previous_values;
+    unsigned int* ordered_state;
 
     const hipError_t partition_result = detail::temp_storage::partition(
         temporary_storage,
         storage_size,
-        detail::temp_storage::ptr_aligned_array(&previous_values, num_previous_values));
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&previous_values, num_previous_values),
+            detail::temp_storage::ptr_aligned_array(&ordered_state, num_ordered_state)));
     if(partition_result != hipSuccess || temporary_storage == nullptr)
     {
         return partition_result;
@@ -133,6 +257,17 @@ hipError_t adjacent_difference_impl(void* const          temporary_storage,
         return hipSuccess;
     }
 
+    if ROCPRIM_IF_CONSTEXPR(ordered)
+    {
+        return adjacent_difference_ordered_inplace_impl<config, Right>(input,
+                                                                       size,
+                                                                       head_flags,
+                                                                       op,
+                                                                       ordered_state,
+                                                                       stream,
+                                                                       debug_synchronous);
+    }
+
     // Copy values before they are overwritten to use as tile predecessors/successors
     // previous_values is not dereferenced when the operation is not in place
     if ROCPRIM_IF_CONSTEXPR(InPlace)
@@ -192,6 +327,7 @@ hipError_t adjacent_difference_impl(void* const          temporary_storage,
 
             start = std::chrono::high_resolution_clock::now();
         }
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("adjacent_difference_kernel");
         hipLaunchKernelGGL(HIP_KERNEL_NAME(adjacent_difference_kernel<config, InPlace, Right>),
                            dim3(current_blocks),
                            dim3(block_size),
@@ -200,6 +336,7 @@ hipError_t adjacent_difference_impl(void* const          temporary_storage,
                            input + offset,
                            output + offset,
                            size,
+                           head_flags,
                            op,
                            previous_values + starting_block,
                            starting_block);
@@ -208,6 +345,35 @@ hipError_t adjacent_difference_impl(void* const          temporary_storage,
     }
     return hipSuccess;
 }
+// Flags the items whose indices are offsets of segments
+template <typename OffsetIterator>
+struct segment_head_flag_op
+{
+    OffsetIterator offsets;
+    unsigned int   segments;
+
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE bool operator()(const std::size_t index) const
+    {
+        OffsetIterator offsets_it = offsets;
+        // Binary search of the first offset not less than index, the offsets are ascending
+        unsigned int left  = 0;
+        unsigned int right = segments;
+        while(left < right)
+        {
+            const unsigned int mid = left + (right - left) / 2;
+            if(static_cast<std::size_t>(offsets_it[mid]) < index)
+            {
+                left = mid + 1;
+            }
+            else
+            {
+                right = mid;
+            }
+        }
+        return left < segments && static_cast<std::size_t>(offsets_it[left]) == index;
+    }
+};
+
 } // namespace detail
 
 #undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
@@ -310,8 +476,15 @@ hipError_t adjacent_difference(void* const          temporary_storage,
 {
     static constexpr bool in_place = false;
     static constexpr bool right    = false;
-    return detail::adjacent_difference_impl<Config, in_place, right>(
-        temporary_storage, storage_size, input, output, size, op, stream, debug_synchronous);
+    return detail::adjacent_difference_impl<Config, in_place, right>(temporary_storage,
+                                                                     storage_size,
+                                                                     input,
+                                                                     output,
+                                                                     size,
+                                                                     ::rocprim::empty_type {},
+                                                                     op,
+                                                                     stream,
+                                                                     debug_synchronous);
 }
 
 /// \brief Parallel primitive for applying a binary operation across pairs of consecutive elements
@@ -327,6 +500,12 @@ hipError_t adjacent_difference(void* const          temporary_storage,
 /// }
 /// \endcode
 ///
+/// The boundary items of the tiles are copied to temporary storage before they are overwritten,
+/// unless the config enables `ordered_in_place` (the default config does for types larger than
+/// 8 bytes). Then a single kernel runs, and a block overwrites its tile only after the block of
+/// the neighbouring tile has read the item it needs, so the temporary storage only holds a bit
+/// per tile.
+///
 /// \tparam Config - [optional] configuration of the primitive. It can be
 /// `adjacent_difference_config` or a class with the same members.
 /// \tparam InputIt - [inferred] random-access iterator type of the value range. Must meet the
@@ -362,8 +541,15 @@ hipError_t adjacent_difference_inplace(void* const          temporary_storage,
 {
     static constexpr bool in_place = true;
     static constexpr bool right    = false;
-    return detail::adjacent_difference_impl<Config, in_place, right>(
-        temporary_storage, storage_size, values, values, size, op, stream, debug_synchronous);
+    return detail::adjacent_difference_impl<Config, in_place, right>(temporary_storage,
+                                                                     storage_size,
+                                                                     values,
+                                                                     values,
+                                                                     size,
+                                                                     ::rocprim::empty_type {},
+                                                                     op,
+                                                                     stream,
+                                                                     debug_synchronous);
 }
 
 /// \brief Parallel primitive for applying a binary operation across pairs of consecutive elements
@@ -459,8 +645,15 @@ hipError_t adjacent_difference_right(void* const          temporary_storage,
 {
     static constexpr bool in_place = false;
     static constexpr bool right    = true;
-    return detail::adjacent_difference_impl<Config, in_place, right>(
-        temporary_storage, storage_size, input, output, size, op, stream, debug_synchronous);
+    return detail::adjacent_difference_impl<Config, in_place, right>(temporary_storage,
+                                                                     storage_size,
+                                                                     input,
+                                                                     output,
+                                                                     size,
+                                                                     ::rocprim::empty_type {},
+                                                                     op,
+                                                                     stream,
+                                                                     debug_synchronous);
 }
 
 /// \brief Parallel primitive for applying a binary operation across pairs of consecutive elements
@@ -476,6 +669,12 @@ hipError_t adjacent_difference_right(void* const          temporary_storage,
 /// }
 /// \endcode
 ///
+/// The boundary items of the tiles are copied to temporary storage before they are overwritten,
+/// unless the config enables `ordered_in_place` (the default config does for types larger than
+/// 8 bytes). Then a single kernel runs, and a block overwrites its tile only after the block of
+/// the neighbouring tile has read the item it needs, so the temporary storage only holds a bit
+/// per tile.
+///
 /// \tparam Config - [optional] configuration of the primitive. It can be
 /// `adjacent_difference_config` or a class with the same members.
 /// \tparam InputIt - [inferred] random-access iterator type of the value range. Must meet the
@@ -511,8 +710,350 @@ hipError_t adjacent_difference_right_inplace(void* const          temporary_stor
 {
     static constexpr bool in_place = true;
     static constexpr bool right    = true;
-    return detail::adjacent_difference_impl<Config, in_place, right>(
-        temporary_storage, storage_size, values, values, size, op, stream, debug_synchronous);
+    return detail::adjacent_difference_impl<Config, in_place, right>(temporary_storage,
+                                                                     storage_size,
+                                                                     values,
+                                                                     values,
+                                                                     size,
+                                                                     ::rocprim::empty_type {},
+                                                                     op,
+                                                                     stream,
+                                                                     debug_synchronous);
+}
+
+/// \brief Parallel primitive for applying a binary operation across pairs of consecutive elements
+/// of the same segment in device accessible memory. Writes the output to the position of the left
+/// item.
+///
+/// Segments are given by head flags. The first item of every segment is copied to the output,
+/// so it is not combined with the last item of the previous segment. The boundary rule is applied
+/// in the same pass as the differences. Equivalent to the following code
+/// \code{.cpp}
+/// output[0] = input[0];
+/// for(std::size_t int i = 1; i < size; ++i)
+/// {
+///     output[i] = head_flags[i] ? input[i] : op(input[i], input[i - 1]);
+/// }
+/// \endcode
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// `adjacent_difference_config` or a class with the same members.
+/// \tparam InputIt - [inferred] random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIt - [inferred] random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam FlagsIt - [inferred] random-access iterator type of the head flags. Its value type must
+/// be convertible to `bool`. It can be a simple pointer type, or the iterator returned by
+/// \p make_segment_head_flags for segments given by offsets.
+/// \tparam BinaryFunction - [inferred] binary operation function object that will be applied to
+/// consecutive items of the same segment. The signature of the function should be equivalent to
+/// the following: `U f(const T1& a, const T2& b)`. The signature does not need to have
+/// `const &`, but function object must not modify the object passed to it
+/// \param temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// `storage_size` and function returns without performing the operation
+/// \param storage_size - reference to a size (in bytes) of `temporary_storage`
+/// \param input - iterator to the input range
+/// \param output - iterator to the output range, must not have any overlap with input
+/// \param head_flags - iterator to the head flags of the items. An item with its head flag set is
+/// the first item of its segment. The flag of the first item is ignored.
+/// \param size - number of items in the input
+/// \param op - [optional] the binary operation to apply
+/// \param stream - [optional] HIP stream object. Default is `0` (the default stream)
+/// \param debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors and extra debugging info is printed to the
+/// standard output. Default value is `false`
+///
+/// \return `hipSuccess` (0) after successful operation, otherwise the HIP runtime error of
+/// type `hipError_t`
+///
+/// \par Example
+/// \parblock
+/// In this example the differences are computed within each of two segments.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp> //or <rocprim/device/device_adjacent_difference.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// std::size_t size; // e.g., 8
+/// int* input; // e.g., [1, 3, 6, 10, 2, 4, 8, 16]
+/// int* head_flags; // e.g., [1, 0, 0, 0, 1, 0, 0, 0]
+/// int* output; // empty array of 8 elements
+///
+/// std::size_t temporary_storage_size_bytes;
+/// void* temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::segmented_adjacent_difference(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, head_flags, size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform segmented adjacent difference
+/// rocprim::segmented_adjacent_difference(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, head_flags, size
+/// );
+/// // output: [1, 2, 3, 4, 2, 2, 4, 8]
+/// \endcode
+/// \endparblock
+template <typename Config = default_config,
+          typename InputIt,
+          typename OutputIt,
+          typename FlagsIt,
+          typename BinaryFunction = ::rocprim::minus<>>
+hipError_t segmented_adjacent_difference(
+    void* const          temporary_storage,
+    std::size_t&         storage_size,
+    const InputIt        input,
+    const OutputIt       output,
+    const FlagsIt        head_flags,
+    const std::size_t    size,
+    const BinaryFunction op                = BinaryFunction {},
+    const hipStream_t    stream            = 0,
+    const bool           debug_synchronous = false)
+{
+    static constexpr bool in_place = false;
+    static constexpr bool right    = false;
+    return detail::adjacent_difference_impl<Config, in_place, right>(temporary_storage,
+                                                                     storage_size,
+                                                                     input,
+                                                                     output,
+                                                                     size,
+                                                                     head_flags,
+                                                                     op,
+                                                                     stream,
+                                                                     debug_synchronous);
+}
+
+/// \brief Parallel primitive for applying a binary operation across pairs of consecutive elements
+/// of the same segment in device accessible memory. Writes the output to the position of the left
+/// item in place.
+///
+/// This is the in-place variant of \p segmented_adjacent_difference, the boundary items are
+/// handled like in \p adjacent_difference_inplace. Equivalent to the following code
+/// \code{.cpp}
+/// for(std::size_t int i = size - 1; i > 0; --i)
+/// {
+///     values[i] = head_flags[i] ? values[i] : op(values[i], values[i - 1]);
+/// }
+/// \endcode
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// `adjacent_difference_config` or a class with the same members.
+/// \tparam InputIt - [inferred] random-access iterator type of the value range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam FlagsIt - [inferred] random-access iterator type of the head flags. Its value type must
+/// be convertible to `bool`. It can be a simple pointer type, or the iterator returned by
+/// \p make_segment_head_flags for segments given by offsets.
+/// \tparam BinaryFunction - [inferred] binary operation function object that will be applied to
+/// consecutive items of the same segment. The signature of the function should be equivalent to
+/// the following: `U f(const T1& a, const T2& b)`. The signature does not need to have
+/// `const &`, but function object must not modify the object passed to it
+/// \param temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// `storage_size` and function returns without performing the operation
+/// \param storage_size - reference to a size (in bytes) of `temporary_storage`
+/// \param values - iterator to the range values, will be overwritten with the results
+/// \param head_flags - iterator to the head flags of the items. An item with its head flag set is
+/// the first item of its segment. The flag of the first item is ignored.
+/// \param size - number of items in the input
+/// \param op - [optional] the binary operation to apply
+/// \param stream - [optional] HIP stream object. Default is `0` (the default stream)
+/// \param debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors and extra debugging info is printed to the
+/// standard output. Default value is `false`
+///
+/// \return `hipSuccess` (0) after successful operation, otherwise the HIP runtime error of
+/// type `hipError_t`
+template <typename Config = default_config,
+          typename InputIt,
+          typename FlagsIt,
+          typename BinaryFunction = ::rocprim::minus<>>
+hipError_t segmented_adjacent_difference_inplace(
+    void* const          temporary_storage,
+    std::size_t&         storage_size,
+    const InputIt        values,
+    const FlagsIt        head_flags,
+    const std::size_t    size,
+    const BinaryFunction op                = BinaryFunction {},
+    const hipStream_t    stream            = 0,
+    const bool           debug_synchronous = false)
+{
+    static constexpr bool in_place = true;
+    static constexpr bool right    = false;
+    return detail::adjacent_difference_impl<Config, in_place, right>(temporary_storage,
+                                                                     storage_size,
+                                                                     values,
+                                                                     values,
+                                                                     size,
+                                                                     head_flags,
+                                                                     op,
+                                                                     stream,
+                                                                     debug_synchronous);
+}
+
+/// \brief Parallel primitive for applying a binary operation across pairs of consecutive elements
+/// of the same segment in device accessible memory. Writes the output to the position of the right
+/// item.
+///
+/// Segments are given by head flags. The last item of every segment, the item before a head, is
+/// copied to the output, so it is not combined with the first item of the next segment. The
+/// boundary rule is applied in the same pass as the differences. Equivalent to the following code
+/// \code{.cpp}
+/// for(std::size_t int i = 0; i < size - 1; ++i)
+/// {
+///     output[i] = head_flags[i + 1] ? input[i] : op(input[i], input[i + 1]);
+/// }
+/// output[size - 1] = input[size - 1];
+/// \endcode
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// `adjacent_difference_config` or a class with the same members.
+/// \tparam InputIt - [inferred] random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIt - [inferred] random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam FlagsIt - [inferred] random-access iterator type of the head flags. Its value type must
+/// be convertible to `bool`. It can be a simple pointer type, or the iterator returned by
+/// \p make_segment_head_flags for segments given by offsets.
+/// \tparam BinaryFunction - [inferred] binary operation function object that will be applied to
+/// consecutive items of the same segment. The signature of the function should be equivalent to
+/// the following: `U f(const T1& a, const T2& b)`. The signature does not need to have
+/// `const &`, but function object must not modify the object passed to it
+/// \param temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// `storage_size` and function returns without performing the operation
+/// \param storage_size - reference to a size (in bytes) of `temporary_storage`
+/// \param input - iterator to the input range
+/// \param output - iterator to the output range, must not have any overlap with input
+/// \param head_flags - iterator to the head flags of the items. An item with its head flag set is
+/// the first item of its segment. The flag of the first item is ignored.
+/// \param size - number of items in the input
+/// \param op - [optional] the binary operation to apply
+/// \param stream - [optional] HIP stream object. Default is `0` (the default stream)
+/// \param debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors and extra debugging info is printed to the
+/// standard output. Default value is `false`
+///
+/// \return `hipSuccess` (0) after successful operation, otherwise the HIP runtime error of
+/// type `hipError_t`
+template <typename Config = default_config,
+          typename InputIt,
+          typename OutputIt,
+          typename FlagsIt,
+          typename BinaryFunction = ::rocprim::minus<>>
+hipError_t segmented_adjacent_difference_right(
+    void* const          temporary_storage,
+    std::size_t&         storage_size,
+    const InputIt        input,
+    const OutputIt       output,
+    const FlagsIt        head_flags,
+    const std::size_t    size,
+    const BinaryFunction op                = BinaryFunction {},
+    const hipStream_t    stream            = 0,
+    const bool           debug_synchronous = false)
+{
+    static constexpr bool in_place = false;
+    static constexpr bool right    = true;
+    return detail::adjacent_difference_impl<Config, in_place, right>(temporary_storage,
+                                                                     storage_size,
+                                                                     input,
+                                                                     output,
+                                                                     size,
+                                                                     head_flags,
+                                                                     op,
+                                                                     stream,
+                                                                     debug_synchronous);
+}
+
+/// \brief Parallel primitive for applying a binary operation across pairs of consecutive elements
+/// of the same segment in device accessible memory. Writes the output to the position of the right
+/// item in place.
+///
+/// This is the in-place variant of \p segmented_adjacent_difference_right, the boundary items are
+/// handled like in \p adjacent_difference_right_inplace. Equivalent to the following code
+/// \code{.cpp}
+/// for(std::size_t int i = 0; i < size - 1; ++i)
+/// {
+///     values[i] = head_flags[i + 1] ? values[i] : op(values[i], values[i + 1]);
+/// }
+/// \endcode
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// `adjacent_difference_config` or a class with the same members.
+/// \tparam InputIt - [inferred] random-access iterator type of the value range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam FlagsIt - [inferred] random-access iterator type of the head flags. Its value type must
+/// be convertible to `bool`. It can be a simple pointer type, or the iterator returned by
+/// \p make_segment_head_flags for segments given by offsets.
+/// \tparam BinaryFunction - [inferred] binary operation function object that will be applied to
+/// consecutive items of the same segment. The signature of the function should be equivalent to
+/// the following: `U f(const T1& a, const T2& b)`. The signature does not need to have
+/// `const &`, but function object must not modify the object passed to it
+/// \param temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// `storage_size` and function returns without performing the operation
+/// \param storage_size - reference to a size (in bytes) of `temporary_storage`
+/// \param values - iterator to the range values, will be overwritten with the results
+/// \param head_flags - iterator to the head flags of the items. An item with its head flag set is
+/// the first item of its segment. The flag of the first item is ignored.
+/// \param size - number of items in the input
+/// \param op - [optional] the binary operation to apply
+/// \param stream - [optional] HIP stream object. Default is `0` (the default stream)
+/// \param debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors and extra debugging info is printed to the
+/// standard output. Default value is `false`
+///
+/// \return `hipSuccess` (0) after successful operation, otherwise the HIP runtime error of
+/// type `hipError_t`
+template <typename Config = default_config,
+          typename InputIt,
+          typename FlagsIt,
+          typename BinaryFunction = ::rocprim::minus<>>
+hipError_t segmented_adjacent_difference_right_inplace(
+    void* const          temporary_storage,
+    std::size_t&         storage_size,
+    const InputIt        values,
+    const FlagsIt        head_flags,
+    const std::size_t    size,
+    const BinaryFunction op                = BinaryFunction {},
+    const hipStream_t    stream            = 0,
+    const bool           debug_synchronous = false)
+{
+    static constexpr bool in_place = true;
+    static constexpr bool right    = true;
+    return detail::adjacent_difference_impl<Config, in_place, right>(temporary_storage,
+                                                                     storage_size,
+                                                                     values,
+                                                                     values,
+                                                                     size,
+                                                                     head_flags,
+                                                                     op,
+                                                                     stream,
+                                                                     debug_synchronous);
+}
+
+/// \brief Returns a random-access iterator of the head flags of segments given by their offsets,
+/// for the segmented adjacent difference primitives.
+///
+/// The flag of an item is set if its index is one of the offsets. Every flag is found by a binary
+/// search over the offsets, so no temporary storage or separate pass is needed to compute them.
+///
+/// \tparam OffsetIterator - [inferred] random-access iterator type of the offsets. It can be
+/// a simple pointer type.
+/// \param offsets - iterator to the ascending offsets of the first items of the segments
+/// \param segments - number of offsets
+template <typename OffsetIterator>
+ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    transform_iterator<counting_iterator<std::size_t>, detail::segment_head_flag_op<OffsetIterator>>
+    make_segment_head_flags(const OffsetIterator offsets, const unsigned int segments)
+{
+    return make_transform_iterator(
+        counting_iterator<std::size_t>(0),
+        detail::segment_head_flag_op<OffsetIterator> {offsets, segments});
 }
 
 /// @}
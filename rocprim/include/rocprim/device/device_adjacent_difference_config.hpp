@@ -45,15 +45,21 @@ BEGIN_ROCPRIM_NAMESPACE
 /// \tparam StoreMethod - method for storing values
 /// \tparam SizeLimit - limit on the number of items for a single adjacent_difference kernel launch.
 /// Larger input sizes will be broken up to multiple kernel launches.
+/// \tparam OrderedInPlace - when true, the in-place variants do not copy the boundary items of
+/// all tiles to temporary storage before the differences are stored. Instead a block overwrites
+/// its tile only after the block of the neighbouring tile has read the item it needs from it.
 template <unsigned int       BlockSize,
           unsigned int       ItemsPerThread,
-          block_load_method  LoadMethod  = block_load_method::block_load_transpose,
-          block_store_method StoreMethod = block_store_method::block_store_transpose,
-          unsigned int       SizeLimit   = ROCPRIM_GRID_SIZE_LIMIT>
+          block_load_method  LoadMethod     = block_load_method::block_load_transpose,
+          block_store_method StoreMethod    = block_store_method::block_store_transpose,
+          unsigned int       SizeLimit      = ROCPRIM_GRID_SIZE_LIMIT,
+          bool               OrderedInPlace = false>
 struct adjacent_difference_config : kernel_config<BlockSize, ItemsPerThread, SizeLimit>
 {
     static constexpr block_load_method  load_method  = LoadMethod;
     static constexpr block_store_method store_method = StoreMethod;
+    /// \brief Whether the in-place variants order the blocks instead of copying boundary items.
+    static constexpr bool ordered_in_place = OrderedInPlace;
 };
 
 namespace detail
@@ -65,7 +71,25 @@ struct adjacent_difference_config_fallback
     static constexpr unsigned int item_scale
         = ::rocprim::detail::ceiling_div<unsigned int>(sizeof(Value), sizeof(int));
 
-    using type = adjacent_difference_config<256, ::rocprim::max(1u, 16u / item_scale)>;
+    // Copying the boundary items of large values costs more than ordering the blocks
+    using type = adjacent_difference_config<256,
+                                            ::rocprim::max(1u, 16u / item_scale),
+                                            block_load_method::block_load_transpose,
+                                            block_store_method::block_store_transpose,
+                                            ROCPRIM_GRID_SIZE_LIMIT,
+                                            (sizeof(Value) > 8)>;
+};
+
+// Configurations without the ordered_in_place member copy the boundary items
+template <class Config, class = void>
+struct config_ordered_in_place : std::false_type
+{
+};
+
+template <class Config>
+struct config_ordered_in_place<Config, void_t<decltype(Config::ordered_in_place)>>
+    : std::integral_constant<bool, Config::ordered_in_place>
+{
 };
 
 template <unsigned int TargetArch, class Value>
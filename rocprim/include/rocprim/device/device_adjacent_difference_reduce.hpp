@@ -0,0 +1,391 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_ADJACENT_DIFFERENCE_REDUCE_HPP_
+#define ROCPRIM_DEVICE_DEVICE_ADJACENT_DIFFERENCE_REDUCE_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../functional.hpp"
+#include "../detail/match_result_type.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+
+#include "config_types.hpp"
+#include "detail/device_adjacent_difference_reduce.hpp"
+#include "device_reduce.hpp"
+#include "device_reduce_config.hpp"
+#include "instrumentation.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+template<bool WithInitialValue,
+         class Config,
+         class DifferenceType,
+         class ResultType,
+         class InputIterator,
+         class OutputIterator,
+         class InitValueType,
+         class DifferenceOp,
+         class ReduceOp>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().block_size)
+void adjacent_difference_reduce_kernel(InputIterator  input,
+                                       const size_t   size,
+                                       OutputIterator output,
+                                       InitValueType  initial_value,
+                                       DifferenceOp   difference_op,
+                                       ReduceOp       reduce_op)
+{
+    adjacent_difference_reduce_kernel_impl<WithInitialValue, Config, DifferenceType, ResultType>(
+        input, size, output, initial_value, difference_op, reduce_op);
+}
+
+#define ROCPRIM_DETAIL_HIP_SYNC(name, size, start) \
+    ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
+    if(debug_synchronous) \
+    { \
+        std::cout << name << "(" << size << ")"; \
+        auto _error = hipStreamSynchronize(stream); \
+        if(_error != hipSuccess) return _error; \
+        auto _end = std::chrono::high_resolution_clock::now(); \
+        auto _d = std::chrono::duration_cast<std::chrono::duration<double>>(_end - start); \
+        std::cout << " " << _d.count() * 1000 << " ms" << '\n'; \
+    }
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
+    { \
+        auto _error = hipGetLastError(); \
+        if(_error != hipSuccess) return _error; \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
+        if(debug_synchronous) \
+        { \
+            std::cout << name << "(" << size << ")"; \
+            auto __error = hipStreamSynchronize(stream); \
+            if(__error != hipSuccess) return __error; \
+            auto _end = std::chrono::high_resolution_clock::now(); \
+            auto _d = std::chrono::duration_cast<std::chrono::duration<double>>(_end - start); \
+            std::cout << " " << _d.count() * 1000 << " ms" << '\n'; \
+        } \
+    }
+
+// The structure of reduce_config_impl over the size - 1 differences of the input: every block
+// reduces the differences of one tile, the partial results of the blocks are reduced by a nested
+// device-level reduction. The differences themselves are never stored.
+template<class Config,
+         class InputIterator,
+         class OutputIterator,
+         class InitValueType,
+         class DifferenceOp,
+         class ReduceOp>
+inline hipError_t adjacent_difference_reduce_impl(void*               temporary_storage,
+                                                  size_t&             storage_size,
+                                                  InputIterator       input,
+                                                  OutputIterator      output,
+                                                  const InitValueType initial_value,
+                                                  const size_t        size,
+                                                  DifferenceOp        difference_op,
+                                                  ReduceOp            reduce_op,
+                                                  const hipStream_t   stream,
+                                                  bool                debug_synchronous)
+{
+    using input_type      = typename std::iterator_traits<InputIterator>::value_type;
+    using difference_type = typename std::decay<
+        typename invoke_result<DifferenceOp, input_type, input_type>::type>::type;
+    using result_type = typename match_result_type<difference_type, ReduceOp>::type;
+
+    using config = wrapped_reduce_config<Config, result_type>;
+
+    detail::target_arch target_arch;
+    hipError_t          result = host_target_arch(stream, target_arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const reduce_config_params params = dispatch_target_arch<config>(target_arch);
+
+    const unsigned int block_size       = params.block_size;
+    const unsigned int items_per_thread = params.items_per_thread;
+    const auto         items_per_block  = block_size * items_per_thread;
+
+    const size_t differences      = size == 0 ? 0 : size - 1;
+    const size_t number_of_blocks = ceiling_div(differences, items_per_block);
+
+    const size_t block_prefix_size = number_of_blocks > 1 ? number_of_blocks : 0;
+
+    // Pointer to array with block_prefixes
+    result_type* block_prefixes{};
+    void*        nested_temp_storage{};
+
+    size_t nested_temp_storage_size = 0;
+    if(number_of_blocks > 1)
+    {
+        result = reduce_impl<true, Config>(nullptr,
+                                           nested_temp_storage_size,
+                                           block_prefixes, // input
+                                           output, // output
+                                           initial_value,
+                                           number_of_blocks, // input size
+                                           reduce_op,
+                                           stream,
+                                           debug_synchronous);
+        if(result != hipSuccess)
+        {
+            return result;
+        }
+    }
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&block_prefixes, block_prefix_size),
+            detail::temp_storage::make_partition(&nested_temp_storage,
+                                                 nested_temp_storage_size,
+                                                 alignof(result_type))));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    // Start point for time measurements
+    std::chrono::high_resolution_clock::time_point start;
+
+    const auto size_limit             = params.size_limit;
+    const auto number_of_blocks_limit = ::rocprim::max<size_t>(size_limit / items_per_block, 1);
+
+    if(debug_synchronous)
+    {
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << number_of_blocks << '\n';
+        std::cout << "number of blocks limit " << number_of_blocks_limit << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+    }
+
+    if(number_of_blocks > 1)
+    {
+        const auto aligned_size_limit = number_of_blocks_limit * items_per_block;
+
+        // The differences of a launch start at offset, they also read the item at offset + size
+        const auto number_of_launch = ceiling_div(differences, aligned_size_limit);
+        for(size_t i = 0, offset = 0; i < number_of_launch; ++i, offset += aligned_size_limit)
+        {
+            const auto current_size   = std::min<size_t>(differences - offset, aligned_size_limit);
+            const auto current_blocks = ceiling_div(current_size, items_per_block);
+
+            if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+            ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("adjacent_difference_reduce_kernel");
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(
+                    adjacent_difference_reduce_kernel<false, config, difference_type, result_type>),
+                dim3(current_blocks),
+                dim3(block_size),
+                0,
+                stream,
+                input + offset,
+                current_size,
+                block_prefixes + i * number_of_blocks_limit,
+                initial_value,
+                difference_op,
+                reduce_op);
+            ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("adjacent_difference_reduce_kernel",
+                                                        current_size,
+                                                        start);
+        }
+
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("nested_device_reduce");
+        result = reduce_impl<true, Config>(nested_temp_storage,
+                                           nested_temp_storage_size,
+                                           block_prefixes, // input
+                                           output, // output
+                                           initial_value,
+                                           number_of_blocks, // input size
+                                           reduce_op,
+                                           stream,
+                                           debug_synchronous);
+        if(result != hipSuccess) return result;
+        ROCPRIM_DETAIL_HIP_SYNC("nested_device_reduce", number_of_blocks, start);
+    }
+    else
+    {
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("adjacent_difference_reduce_kernel");
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(
+                adjacent_difference_reduce_kernel<true, config, difference_type, result_type>),
+            dim3(1), dim3(block_size), 0, stream,
+            input, differences, output, initial_value, difference_op, reduce_op
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("adjacent_difference_reduce_kernel",
+                                                    differences,
+                                                    start);
+    }
+
+    return hipSuccess;
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+#undef ROCPRIM_DETAIL_HIP_SYNC
+
+} // end of detail namespace
+
+/// \brief Parallel fused adjacent difference and reduction primitive for device level.
+///
+/// adjacent_difference_reduce reduces the differences of the consecutive pairs of items of the
+/// input in one pass, without storing the differences:
+/// \code
+/// output[0] = reduce_op(initial_value, difference_op(input[1], input[0]), ...,
+///                       difference_op(input[size - 1], input[size - 2]))
+/// \endcode
+/// It computes the result of \p adjacent_difference followed by \p reduce of the last
+/// <tt>size - 1</tt> items of its output, such as the number of changes of the values with
+/// <tt>rocprim::not_equal_to</tt> or the largest step with <tt>rocprim::maximum</tt>.
+///
+/// \par Overview
+/// * Does not support non-commutative reduction operators. Reduction operator should also be
+/// associative. When used with non-associative functions the results may be non-deterministic
+/// and/or vary in precision.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input must have at least \p size elements, while \p output
+/// only needs one element.
+/// * When \p size is less than 2 there are no differences and \p initial_value is written.
+/// * The differences are computed with \p block_adjacent_difference in the tiles of the
+/// reduction, every tile also loads the item before it. Only the partial results of the tiles
+/// are stored in \p temporary_storage.
+/// * The result type of \p difference_op and then the result type of \p reduce_op is used for
+/// accumulation.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p reduce_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam InitValueType - type of the initial value.
+/// \tparam DifferenceOp - type of binary function computing the differences. Default type
+/// is \p rocprim::minus<T>, where \p T is a \p value_type of \p InputIterator.
+/// \tparam ReduceOp - type of binary function used for reduction. Default type is
+/// \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [in] initial_value - initial value to start the reduction.
+/// \param [in] size - number of element in the input range.
+/// \param [in] difference_op - binary operation function object applied to the consecutive
+/// pairs of items. It is called as <tt>difference_op(input[i], input[i - 1])</tt>, like the
+/// operator of \p adjacent_difference. The function object must not modify the objects
+/// passed to it. Default is DifferenceOp().
+/// \param [in] reduce_op - binary operation function object that will be used for reduction
+/// of the differences. The signature of the function should be equivalent to the following:
+/// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// Default is ReduceOp().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the number of changes of the values of an array is counted.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;    // e.g., 8
+/// int * input;          // e.g., [1, 1, 2, 2, 2, 5, 1, 1]
+/// int * output;         // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::adjacent_difference_reduce(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, 0, input_size,
+///     rocprim::not_equal_to<int>(), rocprim::plus<int>()
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // count the changes
+/// rocprim::adjacent_difference_reduce(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, 0, input_size,
+///     rocprim::not_equal_to<int>(), rocprim::plus<int>()
+/// );
+/// // output: [3]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class InputIterator,
+    class OutputIterator,
+    class InitValueType,
+    class DifferenceOp = ::rocprim::minus<typename std::iterator_traits<InputIterator>::value_type>,
+    class ReduceOp     = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>>
+inline hipError_t adjacent_difference_reduce(void*               temporary_storage,
+                                             size_t&             storage_size,
+                                             InputIterator       input,
+                                             OutputIterator      output,
+                                             const InitValueType initial_value,
+                                             const size_t        size,
+                                             DifferenceOp        difference_op = DifferenceOp(),
+                                             ReduceOp            reduce_op     = ReduceOp(),
+                                             const hipStream_t   stream        = 0,
+                                             bool                debug_synchronous = false)
+{
+    return detail::adjacent_difference_reduce_impl<Config>(temporary_storage,
+                                                           storage_size,
+                                                           input,
+                                                           output,
+                                                           initial_value,
+                                                           size,
+                                                           difference_op,
+                                                           reduce_op,
+                                                           stream,
+                                                           debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_ADJACENT_DIFFERENCE_REDUCE_HPP_
@@ -0,0 +1,708 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_ARGMINMAX_HPP_
+#define ROCPRIM_DEVICE_DEVICE_ARGMINMAX_HPP_
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/various.hpp"
+#include "../detail/temp_storage.hpp"
+
+#include "../iterator/counting_iterator.hpp"
+#include "detail/config/device_reduce.hpp"
+#include "detail/device_argminmax.hpp"
+#include "device_segmented_reduce.hpp"
+#include "instrumentation.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+template<class Config, bool Max, class InputIterator, class T, class Index>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().block_size) void argminmax_partial_kernel(
+    InputIterator input,
+    const Index   size,
+    T*            partial_values,
+    Index*        partial_indices)
+{
+    argminmax_partial<Config, Max>(input, size, partial_values, partial_indices);
+}
+
+template<class Config,
+         bool Max,
+         class ValueIterator,
+         class IndexIterator,
+         class OutputIterator,
+         class T,
+         class Index>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().block_size) void argminmax_final_kernel(
+    ValueIterator  values,
+    IndexIterator  indices,
+    const Index    size,
+    OutputIterator output)
+{
+    argminmax_final<Config, Max, ValueIterator, IndexIterator, OutputIterator, T>(values,
+                                                                                 indices,
+                                                                                 size,
+                                                                                 output);
+}
+
+template<class Config, bool Max, class InputIterator, class OutputIterator, class OffsetIterator>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().block_size)
+void segmented_argminmax_thread_kernel(InputIterator      input,
+                                       OutputIterator     output,
+                                       const unsigned int segments,
+                                       OffsetIterator     begin_offsets,
+                                       OffsetIterator     end_offsets)
+{
+    segmented_argminmax_thread<Config, Max>(input, output, segments, begin_offsets, end_offsets);
+}
+
+template<class Config, bool Max, class InputIterator, class OutputIterator, class OffsetIterator>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().block_size)
+void segmented_argminmax_warp_kernel(InputIterator      input,
+                                     OutputIterator     output,
+                                     const unsigned int segments,
+                                     OffsetIterator     begin_offsets,
+                                     OffsetIterator     end_offsets)
+{
+    segmented_argminmax_warp<Config, Max>(input, output, segments, begin_offsets, end_offsets);
+}
+
+template<class Config, bool Max, class InputIterator, class OutputIterator, class OffsetIterator>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().block_size)
+void segmented_argminmax_block_kernel(InputIterator  input,
+                                      OutputIterator output,
+                                      OffsetIterator begin_offsets,
+                                      OffsetIterator end_offsets)
+{
+    segmented_argminmax_block<Config, Max>(input, output, begin_offsets, end_offsets);
+}
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
+    { \
+        auto _error = hipGetLastError(); \
+        if(_error != hipSuccess) return _error; \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
+        if(debug_synchronous) \
+        { \
+            std::cout << name << "(" << size << ")"; \
+            auto __error = hipStreamSynchronize(stream); \
+            if(__error != hipSuccess) return __error; \
+            auto _end = std::chrono::high_resolution_clock::now(); \
+            auto _d = std::chrono::duration_cast<std::chrono::duration<double>>(_end - start); \
+            std::cout << " " << _d.count() * 1000 << " ms" << '\n'; \
+        } \
+    }
+
+template<class Config, bool Max, class Index, class InputIterator, class OutputIterator>
+inline hipError_t argminmax_impl(void*          temporary_storage,
+                                 size_t&        storage_size,
+                                 InputIterator  input,
+                                 OutputIterator output,
+                                 const Index    size,
+                                 hipStream_t    stream,
+                                 bool           debug_synchronous)
+{
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    using config = wrapped_reduce_config<Config, value_type>;
+
+    detail::target_arch target_arch;
+    hipError_t          result = host_target_arch(stream, target_arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const reduce_config_params params = dispatch_target_arch<config>(target_arch);
+
+    const unsigned int block_size      = params.block_size;
+    const unsigned int items_per_block = block_size * params.items_per_thread;
+
+    // Every block of the first pass reduces tiles until all of them are reduced, so the single
+    // block of the final pass has at most items_per_block partial results
+    Index number_of_blocks = ::rocprim::min<Index>(
+        ::rocprim::detail::ceiling_div<Index>(size, items_per_block), items_per_block);
+    result = limit_grid_size(number_of_blocks, params.blocks_per_cu);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    // A single block reduces the input directly
+    const bool single_pass = number_of_blocks <= 1;
+
+    value_type* partial_values;
+    Index*      partial_indices;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&partial_values,
+                                                    single_pass ? 0 : number_of_blocks),
+            detail::temp_storage::ptr_aligned_array(&partial_indices,
+                                                    single_pass ? 0 : number_of_blocks)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if(debug_synchronous)
+    {
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << number_of_blocks << '\n';
+    }
+
+    if(single_pass)
+    {
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("argminmax_final_kernel");
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(argminmax_final_kernel<config,
+                                                   Max,
+                                                   InputIterator,
+                                                   ::rocprim::counting_iterator<Index>,
+                                                   OutputIterator,
+                                                   value_type,
+                                                   Index>),
+            dim3(1), dim3(block_size), 0, stream,
+            input, ::rocprim::counting_iterator<Index>(0), size, output
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("argminmax_final_kernel", size, start);
+        return hipSuccess;
+    }
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("argminmax_partial_kernel");
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(argminmax_partial_kernel<config, Max>),
+        dim3(number_of_blocks), dim3(block_size), 0, stream,
+        input, size, partial_values, partial_indices
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("argminmax_partial_kernel", size, start);
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("argminmax_final_kernel");
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(argminmax_final_kernel<config,
+                                               Max,
+                                               value_type*,
+                                               Index*,
+                                               OutputIterator,
+                                               value_type,
+                                               Index>),
+        dim3(1), dim3(block_size), 0, stream,
+        partial_values, partial_indices, number_of_blocks, output
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("argminmax_final_kernel", number_of_blocks, start);
+
+    return hipSuccess;
+}
+
+// 32-bit indices are used when they are enough, they take fewer registers and shuffles
+template<class Config, bool Max, class InputIterator, class OutputIterator>
+inline hipError_t argminmax(void*          temporary_storage,
+                            size_t&        storage_size,
+                            InputIterator  input,
+                            OutputIterator output,
+                            const size_t   size,
+                            hipStream_t    stream,
+                            bool           debug_synchronous)
+{
+    if(size <= std::numeric_limits<unsigned int>::max() - 1)
+    {
+        return argminmax_impl<Config, Max>(temporary_storage,
+                                           storage_size,
+                                           input,
+                                           output,
+                                           static_cast<unsigned int>(size),
+                                           stream,
+                                           debug_synchronous);
+    }
+    return argminmax_impl<Config, Max>(temporary_storage,
+                                       storage_size,
+                                       input,
+                                       output,
+                                       size,
+                                       stream,
+                                       debug_synchronous);
+}
+
+template<class Config, bool Max, class InputIterator, class OutputIterator, class OffsetIterator>
+inline hipError_t segmented_argminmax_impl(void*              temporary_storage,
+                                           size_t&            storage_size,
+                                           InputIterator      input,
+                                           OutputIterator     output,
+                                           const unsigned int segments,
+                                           OffsetIterator     begin_offsets,
+                                           OffsetIterator     end_offsets,
+                                           hipStream_t        stream,
+                                           bool               debug_synchronous)
+{
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    using config = wrapped_reduce_config<Config, value_type>;
+
+    detail::target_arch target_arch;
+    hipError_t          result = host_target_arch(stream, target_arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const reduce_config_params params = dispatch_target_arch<config>(target_arch);
+
+    const unsigned int block_size = params.block_size;
+
+    size_t* span;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&span, 1)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if( segments == 0u )
+        return hipSuccess;
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    segmented_reduce_algorithm algorithm = params.segmented_algorithm;
+    if(algorithm == segmented_reduce_algorithm::automatic)
+    {
+        // Select the algorithm from the average length of segments
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("segmented_reduce_span_kernel");
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(segmented_reduce_span_kernel<OffsetIterator>),
+            dim3(1), dim3(1), 0, stream,
+            begin_offsets, end_offsets, segments, span
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_reduce_span_kernel", 1, start);
+
+        size_t host_span;
+        result = detail::memcpy_and_sync(&host_span,
+                                         span,
+                                         sizeof(host_span),
+                                         hipMemcpyDeviceToHost,
+                                         stream);
+        if(result != hipSuccess)
+        {
+            return result;
+        }
+        algorithm = select_segmented_reduce_algorithm(params, host_span / segments);
+    }
+
+    if(algorithm == segmented_reduce_algorithm::thread_per_segment)
+    {
+        const unsigned int grid_size = ::rocprim::detail::ceiling_div(segments, block_size);
+
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("segmented_argminmax_thread_kernel");
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(segmented_argminmax_thread_kernel<config, Max>),
+            dim3(grid_size), dim3(block_size), 0, stream,
+            input, output, segments,
+            begin_offsets, end_offsets
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_argminmax_thread_kernel",
+                                                    segments,
+                                                    start);
+    }
+    else if(algorithm == segmented_reduce_algorithm::warp_per_segment)
+    {
+        const unsigned int grid_size = ::rocprim::detail::ceiling_div(
+            segments, block_size / segmented_reduce_warp_size);
+
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("segmented_argminmax_warp_kernel");
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(segmented_argminmax_warp_kernel<config, Max>),
+            dim3(grid_size), dim3(block_size), 0, stream,
+            input, output, segments,
+            begin_offsets, end_offsets
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_argminmax_warp_kernel",
+                                                    segments,
+                                                    start);
+    }
+    else
+    {
+        // load_balanced is not provided, such segments are reduced by blocks too
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("segmented_argminmax_block_kernel");
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(segmented_argminmax_block_kernel<config, Max>),
+            dim3(segments), dim3(block_size), 0, stream,
+            input, output,
+            begin_offsets, end_offsets
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_argminmax_block_kernel",
+                                                    segments,
+                                                    start);
+    }
+
+    return hipSuccess;
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
+} // end of detail namespace
+
+/// \brief Parallel argmin primitive for device level.
+///
+/// \p argmin function finds the smallest value of the input and its index. This is the same
+/// result as of \p reduce over \p arg_index_iterator with \p arg_min, but the values and the
+/// indices are reduced in separate registers, without moving \p key_value_pair objects and their
+/// padding through the block-level reduction.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Range specified by \p input must have at least \p size elements, \p output must have
+/// at least 1 element.
+/// * The \p value_type of \p OutputIterator must be <tt>key_value_pair<Key, Value></tt>. The
+/// index of the smallest value is stored to \p key and the value to \p value.
+/// * Values are compared with <tt>operator<</tt> and <tt>operator==</tt>. If several values are
+/// the smallest one, the smallest index is stored.
+/// * If \p size is 0, <tt>{1, std::numeric_limits<T>::max()}</tt> is stored.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p reduce_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to reduce.
+/// \param [out] output - iterator to the output element.
+/// \param [in] size - number of elements in the input range.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the smallest value of an array of floats and its index are found.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;                             // e.g., 8
+/// float * input;                                 // e.g., [4, 7, 1, 2, 5, 1, 3, 8]
+/// rocprim::key_value_pair<int, float> * output;  // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::argmin(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform reduction
+/// rocprim::argmin(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size
+/// );
+/// // output: [{2, 1}]
+/// \endcode
+/// \endparblock
+template<class Config = default_config, class InputIterator, class OutputIterator>
+inline hipError_t argmin(void*             temporary_storage,
+                         size_t&           storage_size,
+                         InputIterator     input,
+                         OutputIterator    output,
+                         const size_t      size,
+                         const hipStream_t stream            = 0,
+                         bool              debug_synchronous = false)
+{
+    return detail::argminmax<Config, false>(temporary_storage,
+                                            storage_size,
+                                            input,
+                                            output,
+                                            size,
+                                            stream,
+                                            debug_synchronous);
+}
+
+/// \brief Parallel argmax primitive for device level.
+///
+/// \p argmax function finds the largest value of the input and its index. This is the same
+/// result as of \p reduce over \p arg_index_iterator with \p arg_max, but the values and the
+/// indices are reduced in separate registers.
+///
+/// \par Overview
+/// * Values are compared with <tt>operator></tt> and <tt>operator==</tt>. If several values are
+/// the largest one, the smallest index is stored.
+/// * If \p size is 0, <tt>{1, std::numeric_limits<T>::lowest()}</tt> is stored.
+/// * Everything else is the same as in \p argmin.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p reduce_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to reduce.
+/// \param [out] output - iterator to the output element.
+/// \param [in] size - number of elements in the input range.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config, class InputIterator, class OutputIterator>
+inline hipError_t argmax(void*             temporary_storage,
+                         size_t&           storage_size,
+                         InputIterator     input,
+                         OutputIterator    output,
+                         const size_t      size,
+                         const hipStream_t stream            = 0,
+                         bool              debug_synchronous = false)
+{
+    return detail::argminmax<Config, true>(temporary_storage,
+                                           storage_size,
+                                           input,
+                                           output,
+                                           size,
+                                           stream,
+                                           debug_synchronous);
+}
+
+/// \brief Parallel segmented argmin primitive for device level.
+///
+/// \p segmented_argmin function finds the smallest value of every segment and its index
+/// relative to the beginning of the segment. This is the same result as of \p segmented_reduce
+/// over \p arg_index_iterator with \p arg_min, except that the indices are relative to the
+/// segments, but the values and the indices are reduced in separate registers.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input must have at least \p size elements, \p output must have
+/// \p segments elements.
+/// * Ranges specified by \p begin_offsets and \p end_offsets must have
+/// at least \p segments elements. They may use the same sequence <tt>offsets</tt> of at least
+/// <tt>segments + 1</tt> elements: <tt>offsets</tt> for \p begin_offsets and
+/// <tt>offsets + 1</tt> for \p end_offsets.
+/// * The \p value_type of \p OutputIterator must be <tt>key_value_pair<Key, Value></tt>.
+/// * Values are compared with <tt>operator<</tt> and <tt>operator==</tt>. If several values are
+/// the smallest one, the smallest index is stored.
+/// * Empty segments store <tt>{1, std::numeric_limits<T>::max()}</tt>.
+/// * Segments are reduced by blocks, logical warps or threads depending on the
+/// \p segmented_algorithm of the config, in the same way as in \p segmented_reduce. With
+/// \p segmented_reduce_algorithm::automatic (default) the algorithm is selected from the average
+/// length of segments, reading it synchronizes with \p stream.
+/// \p segmented_reduce_algorithm::load_balanced is not supported, blocks reduce the segments
+/// instead.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p reduce_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to reduce.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the smallest values of segments of floats and their indices are found, the
+/// segments are reduced by logical warps.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// using config = rocprim::reduce_config<256,
+///                                       4,
+///                                       rocprim::block_reduce_algorithm::default_algorithm,
+///                                       ROCPRIM_GRID_SIZE_LIMIT,
+///                                       false,
+///                                       rocprim::segmented_reduce_algorithm::warp_per_segment>;
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int segments;                         // e.g., 3
+/// float * input;                                 // e.g., [4, 7, 6, 2, 5, 1, 3, 1]
+/// rocprim::key_value_pair<int, float> * output;  // empty array of 3 elements
+/// int * offsets;                                 // e.g. [0, 2, 3, 8]
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::segmented_argmin<config>(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output,
+///     segments, offsets, offsets + 1
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform segmented reduction
+/// rocprim::segmented_argmin<config>(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output,
+///     segments, offsets, offsets + 1
+/// );
+/// // output: [{0, 4}, {0, 6}, {2, 1}]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class OffsetIterator>
+inline hipError_t segmented_argmin(void*              temporary_storage,
+                                   size_t&            storage_size,
+                                   InputIterator      input,
+                                   OutputIterator     output,
+                                   const unsigned int segments,
+                                   OffsetIterator     begin_offsets,
+                                   OffsetIterator     end_offsets,
+                                   const hipStream_t  stream            = 0,
+                                   bool               debug_synchronous = false)
+{
+    return detail::segmented_argminmax_impl<Config, false>(temporary_storage,
+                                                           storage_size,
+                                                           input,
+                                                           output,
+                                                           segments,
+                                                           begin_offsets,
+                                                           end_offsets,
+                                                           stream,
+                                                           debug_synchronous);
+}
+
+/// \brief Parallel segmented argmax primitive for device level.
+///
+/// \p segmented_argmax function finds the largest value of every segment and its index
+/// relative to the beginning of the segment. This is the same result as of \p segmented_reduce
+/// over \p arg_index_iterator with \p arg_max, except that the indices are relative to the
+/// segments, but the values and the indices are reduced in separate registers.
+///
+/// \par Overview
+/// * Values are compared with <tt>operator></tt> and <tt>operator==</tt>. If several values are
+/// the largest one, the smallest index is stored.
+/// * Empty segments store <tt>{1, std::numeric_limits<T>::lowest()}</tt>.
+/// * Everything else is the same as in \p segmented_argmin.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p reduce_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to reduce.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class OffsetIterator>
+inline hipError_t segmented_argmax(void*              temporary_storage,
+                                   size_t&            storage_size,
+                                   InputIterator      input,
+                                   OutputIterator     output,
+                                   const unsigned int segments,
+                                   OffsetIterator     begin_offsets,
+                                   OffsetIterator     end_offsets,
+                                   const hipStream_t  stream            = 0,
+                                   bool               debug_synchronous = false)
+{
+    return detail::segmented_argminmax_impl<Config, true>(temporary_storage,
+                                                          storage_size,
+                                                          input,
+                                                          output,
+                                                          segments,
+                                                          begin_offsets,
+                                                          end_offsets,
+                                                          stream,
+                                                          debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_ARGMINMAX_HPP_
@@ -0,0 +1,336 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_BATCH_MEMCPY_HPP_
+#define ROCPRIM_DEVICE_DEVICE_BATCH_MEMCPY_HPP_
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+
+#include "config_types.hpp"
+#include "detail/device_batch_memcpy.hpp"
+#include "device_batch_memcpy_config.hpp"
+#include "instrumentation.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+template<class Config,
+         class InputBufferIterator,
+         class OutputBufferIterator,
+         class BufferSizeIterator>
+ROCPRIM_KERNEL __launch_bounds__(Config::block_size)
+void batch_memcpy_small_kernel(InputBufferIterator       sources,
+                               OutputBufferIterator      destinations,
+                               BufferSizeIterator        sizes,
+                               const unsigned int        num_buffers,
+                               unsigned int*             medium_buffers,
+                               unsigned int*             medium_count,
+                               unsigned int*             large_buffers,
+                               unsigned int*             large_first_tiles,
+                               batch_memcpy_large_state* large_state)
+{
+    batch_memcpy_small_kernel_impl<Config>(sources,
+                                           destinations,
+                                           sizes,
+                                           num_buffers,
+                                           medium_buffers,
+                                           medium_count,
+                                           large_buffers,
+                                           large_first_tiles,
+                                           large_state);
+}
+
+template<class Config,
+         class InputBufferIterator,
+         class OutputBufferIterator,
+         class BufferSizeIterator>
+ROCPRIM_KERNEL __launch_bounds__(Config::block_size)
+void batch_memcpy_medium_kernel(InputBufferIterator  sources,
+                                OutputBufferIterator destinations,
+                                BufferSizeIterator   sizes,
+                                const unsigned int*  medium_buffers,
+                                const unsigned int*  medium_count)
+{
+    batch_memcpy_medium_kernel_impl<Config>(sources,
+                                            destinations,
+                                            sizes,
+                                            medium_buffers,
+                                            medium_count);
+}
+
+template<class Config,
+         class InputBufferIterator,
+         class OutputBufferIterator,
+         class BufferSizeIterator>
+ROCPRIM_KERNEL __launch_bounds__(Config::block_size)
+void batch_memcpy_large_kernel(InputBufferIterator             sources,
+                               OutputBufferIterator            destinations,
+                               BufferSizeIterator              sizes,
+                               const unsigned int*             large_buffers,
+                               const unsigned int*             large_first_tiles,
+                               const batch_memcpy_large_state* large_state)
+{
+    batch_memcpy_large_kernel_impl<Config>(sources,
+                                           destinations,
+                                           sizes,
+                                           large_buffers,
+                                           large_first_tiles,
+                                           large_state);
+}
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
+    { \
+        auto _error = hipGetLastError(); \
+        if(_error != hipSuccess) return _error; \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
+        if(debug_synchronous) \
+        { \
+            std::cout << name << "(" << size << ")"; \
+            auto __error = hipStreamSynchronize(stream); \
+            if(__error != hipSuccess) return __error; \
+            auto _end = std::chrono::high_resolution_clock::now(); \
+            auto _d = std::chrono::duration_cast<std::chrono::duration<double>>(_end - start); \
+            std::cout << " " << _d.count() * 1000 << " ms" << '\n'; \
+        } \
+    }
+
+// The first kernel sorts the buffers by size, the numbers of medium and large buffers stay in
+// device memory: the grids of the other kernels are limited to a number of blocks per compute
+// unit and read the numbers themselves, so there is no synchronization with the host.
+template<class Config,
+         class InputBufferIterator,
+         class OutputBufferIterator,
+         class BufferSizeIterator>
+inline hipError_t batch_memcpy_impl(void*                temporary_storage,
+                                    size_t&              storage_size,
+                                    InputBufferIterator  sources,
+                                    OutputBufferIterator destinations,
+                                    BufferSizeIterator   sizes,
+                                    const unsigned int   num_buffers,
+                                    const hipStream_t    stream,
+                                    bool                 debug_synchronous)
+{
+    using config = default_or_custom_config<Config, default_batch_memcpy_config>;
+
+    constexpr unsigned int block_size = config::block_size;
+
+    unsigned int*             medium_buffers;
+    unsigned int*             medium_count;
+    unsigned int*             large_buffers;
+    unsigned int*             large_first_tiles;
+    batch_memcpy_large_state* large_state;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&large_state, 1),
+            detail::temp_storage::ptr_aligned_array(&medium_count, 1),
+            detail::temp_storage::ptr_aligned_array(&medium_buffers, num_buffers),
+            detail::temp_storage::ptr_aligned_array(&large_buffers, num_buffers),
+            detail::temp_storage::ptr_aligned_array(&large_first_tiles, num_buffers)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(num_buffers == 0)
+    {
+        return hipSuccess;
+    }
+
+    // The medium buffers need at most one warp each, the limit of the grids is the same for the
+    // tiles of the large buffers
+    unsigned int max_grid_size = num_buffers;
+    hipError_t   result        = limit_grid_size(max_grid_size, config::blocks_per_cu);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const unsigned int small_grid_size = ceiling_div(num_buffers, block_size);
+
+    if(debug_synchronous)
+    {
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "small_grid_size " << small_grid_size << '\n';
+        std::cout << "max_grid_size " << max_grid_size << '\n';
+    }
+
+    result = hipMemsetAsync(large_state, 0, sizeof(*large_state), stream);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    result = hipMemsetAsync(medium_count, 0, sizeof(*medium_count), stream);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    // Start point for time measurements
+    std::chrono::high_resolution_clock::time_point start;
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("batch_memcpy_small_kernel");
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(batch_memcpy_small_kernel<config>),
+        dim3(small_grid_size), dim3(block_size), 0, stream,
+        sources, destinations, sizes, num_buffers,
+        medium_buffers, medium_count, large_buffers, large_first_tiles, large_state
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("batch_memcpy_small_kernel", num_buffers, start);
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("batch_memcpy_medium_kernel");
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(batch_memcpy_medium_kernel<config>),
+        dim3(max_grid_size), dim3(block_size), 0, stream,
+        sources, destinations, sizes, medium_buffers, medium_count
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("batch_memcpy_medium_kernel", num_buffers, start);
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("batch_memcpy_large_kernel");
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(batch_memcpy_large_kernel<config>),
+        dim3(max_grid_size), dim3(block_size), 0, stream,
+        sources, destinations, sizes, large_buffers, large_first_tiles, large_state
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("batch_memcpy_large_kernel", num_buffers, start);
+
+    return hipSuccess;
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
+} // end of detail namespace
+
+/// \brief Parallel batched memcpy primitive for device level.
+///
+/// batch_memcpy copies \p num_buffers buffers of bytes: <tt>sizes[i]</tt> bytes from
+/// <tt>sources[i]</tt> to <tt>destinations[i]</tt> for every \p i, with a few kernel launches
+/// instead of one \p hipMemcpyAsync per buffer.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * The buffers are copied by workers matching their sizes: buffers of at most
+/// \p Config::small_buffer_size bytes by threads, buffers of at most \p Config::medium_buffer_size
+/// bytes by warps, and larger buffers in tiles of \p Config::tile_size bytes by blocks.
+/// * The warps and the blocks take the buffers and the tiles from queues filled on the device,
+/// the function does not synchronize with the host.
+/// * Buffers with the same alignment of the source and the destination are copied with
+/// 16-byte vector loads and stores, other buffers are copied byte by byte.
+/// * The source and destination buffers must not overlap. The total number of tiles of the
+/// large buffers must be less than 2^32.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// \p batch_memcpy_config or a custom class with the same members.
+/// \tparam InputBufferIterator - random-access iterator type of the sources. Its value type
+/// must be a pointer convertible to <tt>const void*</tt>.
+/// \tparam OutputBufferIterator - random-access iterator type of the destinations. Its value
+/// type must be a pointer convertible to <tt>void*</tt>.
+/// \tparam BufferSizeIterator - random-access iterator type of the sizes in bytes. Its value
+/// type must be an integral type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the copies.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] sources - iterator to the first source pointer.
+/// \param [in] destinations - iterator to the first destination pointer.
+/// \param [in] sizes - iterator to the first size in bytes.
+/// \param [in] num_buffers - number of buffers to copy.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful copies; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int num_buffers;   // e.g., 3
+/// const void ** sources;      // device array of 3 pointers to buffers of 8, 1000 and 100000 bytes
+/// void ** destinations;       // device array of 3 pointers to buffers of the same sizes
+/// size_t * sizes;             // e.g., [8, 1000, 100000]
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::batch_memcpy(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     sources, destinations, sizes, num_buffers
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform the copies
+/// rocprim::batch_memcpy(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     sources, destinations, sizes, num_buffers
+/// );
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputBufferIterator,
+         class OutputBufferIterator,
+         class BufferSizeIterator>
+inline hipError_t batch_memcpy(void*                temporary_storage,
+                               size_t&              storage_size,
+                               InputBufferIterator  sources,
+                               OutputBufferIterator destinations,
+                               BufferSizeIterator   sizes,
+                               const unsigned int   num_buffers,
+                               const hipStream_t    stream            = 0,
+                               bool                 debug_synchronous = false)
+{
+    return detail::batch_memcpy_impl<Config>(temporary_storage,
+                                             storage_size,
+                                             sources,
+                                             destinations,
+                                             sizes,
+                                             num_buffers,
+                                             stream,
+                                             debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_BATCH_MEMCPY_HPP_
@@ -0,0 +1,80 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_BATCH_MEMCPY_CONFIG_HPP_
+#define ROCPRIM_DEVICE_DEVICE_BATCH_MEMCPY_CONFIG_HPP_
+
+#include "../config.hpp"
+
+#include "config_types.hpp"
+
+/// \addtogroup primitivesmodule_deviceconfigs
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief Configuration of device-level batched memcpy.
+///
+/// \tparam BlockSize - number of threads in a block.
+/// \tparam SmallBufferSize - buffers of at most \p SmallBufferSize bytes are copied by single
+/// threads.
+/// \tparam MediumBufferSize - buffers of at most \p MediumBufferSize bytes, and larger than
+/// \p SmallBufferSize, are copied by single warps.
+/// \tparam TileSize - larger buffers are split into tiles of \p TileSize bytes, every tile is
+/// copied by a block.
+/// \tparam BlocksPerCU - the medium and large buffers are copied by grids of \p BlocksPerCU
+/// blocks per compute unit, the warps and the blocks take buffers and tiles until all of them
+/// are copied.
+template<unsigned int BlockSize,
+         unsigned int SmallBufferSize,
+         unsigned int MediumBufferSize,
+         unsigned int TileSize,
+         unsigned int BlocksPerCU = 4>
+struct batch_memcpy_config
+{
+    static_assert(SmallBufferSize <= MediumBufferSize,
+                  "SmallBufferSize must not be larger than MediumBufferSize");
+    static_assert(BlocksPerCU > 0, "BlocksPerCU must be greater than 0");
+
+    /// \brief Number of threads in a block.
+    static constexpr unsigned int block_size = BlockSize;
+    /// \brief Largest size in bytes of the buffers copied by threads.
+    static constexpr unsigned int small_buffer_size = SmallBufferSize;
+    /// \brief Largest size in bytes of the buffers copied by warps.
+    static constexpr unsigned int medium_buffer_size = MediumBufferSize;
+    /// \brief Size in bytes of the tiles of large buffers copied by blocks.
+    static constexpr unsigned int tile_size = TileSize;
+    /// \brief Number of blocks per compute unit of the grids copying medium and large buffers.
+    static constexpr unsigned int blocks_per_cu = BlocksPerCU;
+};
+
+namespace detail
+{
+
+using default_batch_memcpy_config = batch_memcpy_config<256, 128, 16384, 32768>;
+
+} // end namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group primitivesmodule_deviceconfigs
+
+#endif // ROCPRIM_DEVICE_DEVICE_BATCH_MEMCPY_CONFIG_HPP_
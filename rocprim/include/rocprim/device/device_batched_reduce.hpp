@@ -0,0 +1,338 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_BATCHED_REDUCE_HPP_
+#define ROCPRIM_DEVICE_DEVICE_BATCHED_REDUCE_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "../config.hpp"
+#include "../functional.hpp"
+#include "../detail/match_result_type.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+
+#include "config_types.hpp"
+#include "detail/device_batched.hpp"
+#include "detail/device_batched_reduce.hpp"
+#include "detail/device_config_helper.hpp"
+#include "device_reduce_config.hpp"
+#include "instrumentation.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+template<class Config,
+         class InputIterators,
+         class OutputIterators,
+         class ResultType,
+         class BinaryFunction>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().block_size) void batched_reduce_kernel(
+    InputIterators         inputs,
+    OutputIterators        outputs,
+    const batched_problem* problems,
+    const unsigned int     problem_count,
+    const unsigned int     number_of_tiles,
+    BinaryFunction         reduce_op,
+    ResultType             initial_value,
+    ResultType*            tile_partials,
+    unsigned int*          tile_counters)
+{
+    batched_reduce_kernel_impl<Config>(inputs,
+                                       outputs,
+                                       problems,
+                                       problem_count,
+                                       number_of_tiles,
+                                       reduce_op,
+                                       initial_value,
+                                       tile_partials,
+                                       tile_counters);
+}
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
+    { \
+        auto _error = hipGetLastError(); \
+        if(_error != hipSuccess) return _error; \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
+        if(debug_synchronous) \
+        { \
+            std::cout << name << "(" << size << ")"; \
+            auto __error = hipStreamSynchronize(stream); \
+            if(__error != hipSuccess) return __error; \
+            auto _end = std::chrono::high_resolution_clock::now(); \
+            auto _d = std::chrono::duration_cast<std::chrono::duration<double>>(_end - start); \
+            std::cout << " " << _d.count() * 1000 << " ms" << '\n'; \
+        } \
+    }
+
+template<class Config,
+         class InputIterators,
+         class OutputIterators,
+         class SizeIterator,
+         class InitValueType,
+         class BinaryFunction>
+inline hipError_t batched_reduce_impl(void*              temporary_storage,
+                                      size_t&            storage_size,
+                                      InputIterators     inputs,
+                                      OutputIterators    outputs,
+                                      SizeIterator       sizes,
+                                      const unsigned int problem_count,
+                                      BinaryFunction     reduce_op,
+                                      InitValueType      initial_value,
+                                      const hipStream_t  stream,
+                                      bool               debug_synchronous)
+{
+    using input_iterator_type = typename std::iterator_traits<InputIterators>::value_type;
+    using input_type          = typename std::iterator_traits<input_iterator_type>::value_type;
+    using result_type =
+        typename ::rocprim::detail::match_result_type<input_type, BinaryFunction>::type;
+
+    using config = wrapped_reduce_config<Config, result_type>;
+
+    detail::target_arch target_arch;
+    hipError_t          result = host_target_arch(stream, target_arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const reduce_config_params params = dispatch_target_arch<config>(target_arch);
+
+    const unsigned int block_size      = params.block_size;
+    const unsigned int items_per_block = block_size * params.items_per_thread;
+
+    // Empty problems get a tile too, it stores the initial value
+    std::vector<batched_problem> host_problems;
+    unsigned int                 number_of_tiles;
+    result = make_batched_problems(sizes,
+                                   problem_count,
+                                   items_per_block,
+                                   true,
+                                   host_problems,
+                                   number_of_tiles);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    batched_problem* problems;
+    result_type*     tile_partials;
+    unsigned int*    tile_counters;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&problems, host_problems.size()),
+            detail::temp_storage::ptr_aligned_array(&tile_partials, number_of_tiles),
+            detail::temp_storage::ptr_aligned_array(&tile_counters, problem_count)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(problem_count == 0u)
+        return hipSuccess;
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if(debug_synchronous)
+    {
+        std::cout << "problems " << problem_count << '\n';
+        std::cout << "number of tiles " << number_of_tiles << '\n';
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+    }
+
+    // The host copy of the problems must stay alive until the copy is complete
+    result = detail::memcpy_and_sync(problems,
+                                     host_problems.data(),
+                                     host_problems.size() * sizeof(batched_problem),
+                                     hipMemcpyHostToDevice,
+                                     stream);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    result = hipMemsetAsync(tile_counters, 0, problem_count * sizeof(unsigned int), stream);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    // Blocks of a smaller grid reduce multiple tiles
+    const unsigned int grid_size
+        = std::min(number_of_tiles, std::numeric_limits<unsigned int>::max() / block_size);
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("batched_reduce");
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(batched_reduce_kernel<config>),
+        dim3(grid_size), dim3(block_size), 0, stream,
+        inputs, outputs, problems, problem_count, number_of_tiles,
+        reduce_op, static_cast<result_type>(initial_value),
+        tile_partials, tile_counters
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("batched_reduce", number_of_tiles, start);
+
+    return hipSuccess;
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
+} // end of detail namespace
+
+/// \brief Parallel batched reduction primitive for device level.
+///
+/// batched_reduce function performs device-wide reduction operations of multiple independent
+/// problems in one launch using binary \p reduce_op operator.
+///
+/// \par Overview
+/// * Every problem has its own input range and output. The tiles of all problems are
+/// distributed evenly over the blocks, so problems of very different sizes are processed
+/// efficiently, unlike \p segmented_reduce, which reduces every segment with one block.
+/// * Partial results of every problem are reduced in a fixed order, so results are
+/// deterministic for a given configuration.
+/// * \p sizes is read on the host, \p inputs and \p outputs are read on the device.
+/// * The total number of tiles of all problems must be less than 2^32, otherwise
+/// \p hipErrorInvalidValue is returned.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer. The size depends on \p sizes.
+/// * Does not support non-commutative reduction operators. Reduction operator should also be
+/// associative.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p reduce_config or
+/// a custom class with the same members.
+/// \tparam InputIterators - random-access iterator type of the range of input iterators. Its
+/// \p value_type must be a random-access iterator type of an input range. Both can be simple
+/// pointer types.
+/// \tparam OutputIterators - random-access iterator type of the range of output iterators. Its
+/// \p value_type must be a random-access iterator type of an output range. Both can be simple
+/// pointer types.
+/// \tparam SizeIterator - random-access iterator type of the sizes of the problems. It can be a
+/// simple pointer type.
+/// \tparam BinaryFunction - type of binary function used for reduction. Default type
+/// is \p rocprim::plus<T>, where \p T is a \p value_type of the input iterators.
+/// \tparam InitValueType - type of the initial value.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] inputs - device-accessible iterator to the first element in the range of
+/// iterators to the input ranges of the problems.
+/// \param [out] outputs - device-accessible iterator to the first element in the range of
+/// iterators to the outputs of the problems.
+/// \param [in] sizes - host-accessible iterator to the first element in the range of the
+/// numbers of elements of the problems.
+/// \param [in] problems - number of problems.
+/// \param [in] reduce_op - binary operation function object that will be used for reduction.
+/// The signature of the function should be equivalent to the following:
+/// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] initial_value - initial value to start the reduction of every problem.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example sums of three arrays of integer values are computed in one call.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int problems;   // e.g., 3
+/// int ** inputs;           // device array of pointers to e.g. [1, 2], [3], [4, 5, 6]
+/// int ** outputs;          // device array of pointers to 1 element each
+/// size_t * sizes;          // host array, e.g. [2, 1, 3]
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::batched_reduce(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     inputs, outputs, sizes, problems
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform batched reduction
+/// rocprim::batched_reduce(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     inputs, outputs, sizes, problems
+/// );
+/// // outputs: [3], [3], [15]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class InputIterators,
+    class OutputIterators,
+    class SizeIterator,
+    class BinaryFunction = ::rocprim::plus<typename std::iterator_traits<
+        typename std::iterator_traits<InputIterators>::value_type>::value_type>,
+    class InitValueType = typename std::iterator_traits<
+        typename std::iterator_traits<InputIterators>::value_type>::value_type>
+inline hipError_t batched_reduce(void*           temporary_storage,
+                                 size_t&         storage_size,
+                                 InputIterators  inputs,
+                                 OutputIterators outputs,
+                                 SizeIterator    sizes,
+                                 unsigned int    problems,
+                                 BinaryFunction  reduce_op         = BinaryFunction(),
+                                 InitValueType   initial_value     = InitValueType(),
+                                 hipStream_t     stream            = 0,
+                                 bool            debug_synchronous = false)
+{
+    return detail::batched_reduce_impl<Config>(temporary_storage,
+                                               storage_size,
+                                               inputs,
+                                               outputs,
+                                               sizes,
+                                               problems,
+                                               reduce_op,
+                                               initial_value,
+                                               stream,
+                                               debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_BATCHED_REDUCE_HPP_
@@ -0,0 +1,921 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_BATCHED_SCAN_HPP_
+#define ROCPRIM_DEVICE_DEVICE_BATCHED_SCAN_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "../config.hpp"
+#include "../functional.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+
+#include "config_types.hpp"
+#include "detail/config/device_scan.hpp"
+#include "detail/device_batched.hpp"
+#include "detail/device_batched_scan.hpp"
+#include "detail/device_scan_common.hpp"
+#include "detail/lookback_scan_state.hpp"
+#include "detail/ordered_block_id.hpp"
+#include "instrumentation.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+template<bool Exclusive,
+         class Config,
+         class InputIterators,
+         class OutputIterators,
+         class ResultType,
+         class BinaryFunction,
+         class LookbackScanState>
+ROCPRIM_KERNEL __launch_bounds__(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE) void batched_scan_kernel(
+    InputIterators                 inputs,
+    OutputIterators                outputs,
+    const batched_problem*         problems,
+    const unsigned int             problem_count,
+    const unsigned int             number_of_tiles,
+    ResultType                     initial_value,
+    BinaryFunction                 scan_op,
+    LookbackScanState              scan_state,
+    ordered_block_id<unsigned int> ordered_bid)
+{
+    batched_scan_kernel_impl<Exclusive, Config>(inputs,
+                                                outputs,
+                                                problems,
+                                                problem_count,
+                                                number_of_tiles,
+                                                initial_value,
+                                                scan_op,
+                                                scan_state,
+                                                ordered_bid);
+}
+
+template<bool Exclusive,
+         class Config,
+         unsigned int LogicalWarpSize,
+         class InputIterator,
+         class OutputIterator,
+         class ResultType,
+         class BinaryFunction>
+ROCPRIM_KERNEL __launch_bounds__(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE) void batched_scan_rows_warp_kernel(
+    InputIterator      input,
+    OutputIterator     output,
+    const unsigned int rows,
+    const unsigned int row_length,
+    ResultType         initial_value,
+    BinaryFunction     scan_op)
+{
+    batched_scan_rows_warp_kernel_impl<Exclusive, Config, LogicalWarpSize>(input,
+                                                                           output,
+                                                                           rows,
+                                                                           row_length,
+                                                                           initial_value,
+                                                                           scan_op);
+}
+
+template<bool Exclusive,
+         class Config,
+         class InputIterator,
+         class OutputIterator,
+         class ResultType,
+         class BinaryFunction,
+         class LookbackScanState>
+ROCPRIM_KERNEL __launch_bounds__(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE) void batched_scan_rows_kernel(
+    InputIterator                  input,
+    OutputIterator                 output,
+    const size_t                   row_length,
+    const unsigned int             tiles_per_row,
+    const unsigned int             number_of_tiles,
+    ResultType                     initial_value,
+    BinaryFunction                 scan_op,
+    LookbackScanState              scan_state,
+    ordered_block_id<unsigned int> ordered_bid)
+{
+    batched_scan_rows_kernel_impl<Exclusive, Config>(input,
+                                                     output,
+                                                     row_length,
+                                                     tiles_per_row,
+                                                     number_of_tiles,
+                                                     initial_value,
+                                                     scan_op,
+                                                     scan_state,
+                                                     ordered_bid);
+}
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
+    { \
+        auto _error = hipGetLastError(); \
+        if(_error != hipSuccess) return _error; \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
+        if(debug_synchronous) \
+        { \
+            std::cout << name << "(" << size << ")"; \
+            auto __error = hipStreamSynchronize(stream); \
+            if(__error != hipSuccess) return __error; \
+            auto _end = std::chrono::high_resolution_clock::now(); \
+            auto _d = std::chrono::duration_cast<std::chrono::duration<double>>(_end - start); \
+            std::cout << " " << _d.count() * 1000 << " ms" << '\n'; \
+        } \
+    }
+
+template<bool Exclusive,
+         class Config,
+         class InputIterators,
+         class OutputIterators,
+         class SizeIterator,
+         class ResultType,
+         class BinaryFunction>
+inline hipError_t batched_scan_impl(void*              temporary_storage,
+                                    size_t&            storage_size,
+                                    InputIterators     inputs,
+                                    OutputIterators    outputs,
+                                    SizeIterator       sizes,
+                                    const unsigned int problem_count,
+                                    const ResultType   initial_value,
+                                    BinaryFunction     scan_op,
+                                    const hipStream_t  stream,
+                                    bool               debug_synchronous)
+{
+    using config = Config;
+
+    using scan_state_type            = detail::lookback_scan_state<ResultType>;
+    using scan_state_with_sleep_type = detail::lookback_scan_state<ResultType, true>;
+    using ordered_block_id_type      = detail::ordered_block_id<unsigned int>;
+
+    constexpr unsigned int block_size      = config::block_size;
+    constexpr unsigned int items_per_block = block_size * config::items_per_thread;
+
+    // Empty problems do not have tiles
+    std::vector<batched_problem> host_problems;
+    unsigned int                 number_of_tiles;
+    hipError_t                   result = make_batched_problems(sizes,
+                                              problem_count,
+                                              items_per_block,
+                                              false,
+                                              host_problems,
+                                              number_of_tiles);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    batched_problem*                problems;
+    void*                           scan_state_storage;
+    ordered_block_id_type::id_type* ordered_bid_storage;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&problems, host_problems.size()),
+            // This is valid even with scan_state_with_sleep_type
+            detail::temp_storage::make_partition(
+                &scan_state_storage,
+                scan_state_type::get_temp_storage_layout(number_of_tiles)),
+            detail::temp_storage::make_partition(&ordered_bid_storage,
+                                                 ordered_block_id_type::get_temp_storage_layout())));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(number_of_tiles == 0u)
+        return hipSuccess;
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if(debug_synchronous)
+    {
+        std::cout << "problems " << problem_count << '\n';
+        std::cout << "number of tiles " << number_of_tiles << '\n';
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+    }
+
+    // The host copy of the problems must stay alive until the copy is complete
+    result = detail::memcpy_and_sync(problems,
+                                     host_problems.data(),
+                                     host_problems.size() * sizeof(batched_problem),
+                                     hipMemcpyHostToDevice,
+                                     stream);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    auto scan_state = scan_state_type::create(scan_state_storage, number_of_tiles);
+    auto scan_state_with_sleep
+        = scan_state_with_sleep_type::create(scan_state_storage, number_of_tiles);
+    auto ordered_bid = ordered_block_id_type::create(ordered_bid_storage);
+
+    bool use_sleep;
+    if(const hipError_t error = is_sleep_scan_state_used(use_sleep))
+    {
+        return error;
+    }
+
+    const unsigned int init_grid_size = ::rocprim::detail::ceiling_div(number_of_tiles, block_size);
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("init_lookback_scan_state_kernel");
+    if(use_sleep)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(init_lookback_scan_state_kernel<scan_state_with_sleep_type>),
+            dim3(init_grid_size), dim3(block_size), 0, stream,
+            scan_state_with_sleep, number_of_tiles, ordered_bid
+        );
+    }
+    else
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(init_lookback_scan_state_kernel<scan_state_type>),
+            dim3(init_grid_size), dim3(block_size), 0, stream,
+            scan_state, number_of_tiles, ordered_bid
+        );
+    }
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_lookback_scan_state_kernel", number_of_tiles, start)
+
+    // Blocks of a smaller grid scan multiple tiles, in the order of tiles
+    const unsigned int grid_size
+        = std::min(number_of_tiles, std::numeric_limits<unsigned int>::max() / block_size);
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("batched_scan_kernel");
+    if(use_sleep)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(batched_scan_kernel<Exclusive, config>),
+            dim3(grid_size), dim3(block_size), 0, stream,
+            inputs, outputs, problems, problem_count, number_of_tiles,
+            initial_value, scan_op, scan_state_with_sleep, ordered_bid
+        );
+    }
+    else
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(batched_scan_kernel<Exclusive, config>),
+            dim3(grid_size), dim3(block_size), 0, stream,
+            inputs, outputs, problems, problem_count, number_of_tiles,
+            initial_value, scan_op, scan_state, ordered_bid
+        );
+    }
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("batched_scan_kernel", number_of_tiles, start)
+
+    return hipSuccess;
+}
+template<bool Exclusive,
+         class Config,
+         unsigned int LogicalWarpSize,
+         class InputIterator,
+         class OutputIterator,
+         class ResultType,
+         class BinaryFunction>
+inline hipError_t batched_scan_rows_warp(InputIterator      input,
+                                         OutputIterator     output,
+                                         const unsigned int rows,
+                                         const unsigned int row_length,
+                                         const ResultType   initial_value,
+                                         BinaryFunction     scan_op,
+                                         const hipStream_t  stream,
+                                         bool               debug_synchronous)
+{
+    constexpr unsigned int block_size     = Config::block_size;
+    constexpr unsigned int rows_per_block = block_size / LogicalWarpSize;
+
+    const unsigned int grid_size = ::rocprim::detail::ceiling_div(rows, rows_per_block);
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if(debug_synchronous)
+    {
+        std::cout << "rows " << rows << '\n';
+        std::cout << "row_length " << row_length << '\n';
+        std::cout << "logical warp size " << LogicalWarpSize << '\n';
+        std::cout << "rows per block " << rows_per_block << '\n';
+    }
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("batched_scan_rows_warp_kernel");
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(batched_scan_rows_warp_kernel<Exclusive, Config, LogicalWarpSize>),
+        dim3(grid_size), dim3(block_size), 0, stream,
+        input, output, rows, row_length, initial_value, scan_op
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("batched_scan_rows_warp_kernel", rows, start)
+
+    return hipSuccess;
+}
+
+template<bool Exclusive,
+         class Config,
+         class InputIterator,
+         class OutputIterator,
+         class ResultType,
+         class BinaryFunction>
+inline hipError_t batched_scan_rows_impl(void*              temporary_storage,
+                                         size_t&            storage_size,
+                                         InputIterator      input,
+                                         OutputIterator     output,
+                                         const unsigned int rows,
+                                         const size_t       row_length,
+                                         const ResultType   initial_value,
+                                         BinaryFunction     scan_op,
+                                         const hipStream_t  stream,
+                                         bool               debug_synchronous)
+{
+    using config = Config;
+
+    using scan_state_type            = detail::lookback_scan_state<ResultType>;
+    using scan_state_with_sleep_type = detail::lookback_scan_state<ResultType, true>;
+    using ordered_block_id_type      = detail::ordered_block_id<unsigned int>;
+
+    constexpr unsigned int block_size       = config::block_size;
+    constexpr unsigned int items_per_thread = config::items_per_thread;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+
+    // Rows that fit in the items of a logical warp are scanned by logical warps, several rows
+    // per block. Logical warps of up to 32 threads fit in the hardware warps of all targets.
+    if(row_length <= 32 * items_per_thread)
+    {
+        if(temporary_storage == nullptr)
+        {
+            // Make sure user won't try to allocate 0 bytes memory, because
+            // hipMalloc will return nullptr when size is zero.
+            storage_size = 4;
+            return hipSuccess;
+        }
+
+        if(rows == 0u || row_length == 0u)
+            return hipSuccess;
+
+        const unsigned int length = static_cast<unsigned int>(row_length);
+        if(length <= items_per_thread)
+        {
+            return batched_scan_rows_warp<Exclusive, config, 1>(
+                input, output, rows, length, initial_value, scan_op, stream, debug_synchronous);
+        }
+        else if(length <= 4 * items_per_thread)
+        {
+            return batched_scan_rows_warp<Exclusive, config, 4>(
+                input, output, rows, length, initial_value, scan_op, stream, debug_synchronous);
+        }
+        else if(length <= 16 * items_per_thread)
+        {
+            return batched_scan_rows_warp<Exclusive, config, 16>(
+                input, output, rows, length, initial_value, scan_op, stream, debug_synchronous);
+        }
+        return batched_scan_rows_warp<Exclusive, config, 32>(
+            input, output, rows, length, initial_value, scan_op, stream, debug_synchronous);
+    }
+
+    // Longer rows are split into tiles, which are scanned by one decoupled look-back
+    const size_t tiles_per_row = ::rocprim::detail::ceiling_div(row_length, items_per_block);
+    const size_t max_tiles = std::numeric_limits<unsigned int>::max() - ::rocprim::host_warp_size();
+    if(tiles_per_row * rows > max_tiles)
+    {
+        return hipErrorInvalidValue;
+    }
+    const unsigned int number_of_tiles = static_cast<unsigned int>(tiles_per_row * rows);
+
+    void*                           scan_state_storage;
+    ordered_block_id_type::id_type* ordered_bid_storage;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            // This is valid even with scan_state_with_sleep_type
+            detail::temp_storage::make_partition(
+                &scan_state_storage,
+                scan_state_type::get_temp_storage_layout(number_of_tiles)),
+            detail::temp_storage::make_partition(&ordered_bid_storage,
+                                                 ordered_block_id_type::get_temp_storage_layout())));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(number_of_tiles == 0u)
+        return hipSuccess;
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if(debug_synchronous)
+    {
+        std::cout << "rows " << rows << '\n';
+        std::cout << "row_length " << row_length << '\n';
+        std::cout << "number of tiles " << number_of_tiles << '\n';
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+    }
+
+    auto scan_state = scan_state_type::create(scan_state_storage, number_of_tiles);
+    auto scan_state_with_sleep
+        = scan_state_with_sleep_type::create(scan_state_storage, number_of_tiles);
+    auto ordered_bid = ordered_block_id_type::create(ordered_bid_storage);
+
+    bool use_sleep;
+    if(const hipError_t error = is_sleep_scan_state_used(use_sleep))
+    {
+        return error;
+    }
+
+    const unsigned int init_grid_size = ::rocprim::detail::ceiling_div(number_of_tiles, block_size);
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("init_lookback_scan_state_kernel");
+    if(use_sleep)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(init_lookback_scan_state_kernel<scan_state_with_sleep_type>),
+            dim3(init_grid_size), dim3(block_size), 0, stream,
+            scan_state_with_sleep, number_of_tiles, ordered_bid
+        );
+    }
+    else
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(init_lookback_scan_state_kernel<scan_state_type>),
+            dim3(init_grid_size), dim3(block_size), 0, stream,
+            scan_state, number_of_tiles, ordered_bid
+        );
+    }
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_lookback_scan_state_kernel", number_of_tiles, start)
+
+    // Blocks of a smaller grid scan multiple tiles, in the order of tiles
+    const unsigned int grid_size
+        = std::min(number_of_tiles, std::numeric_limits<unsigned int>::max() / block_size);
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("batched_scan_rows_kernel");
+    if(use_sleep)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(batched_scan_rows_kernel<Exclusive, config>),
+            dim3(grid_size), dim3(block_size), 0, stream,
+            input, output, row_length, static_cast<unsigned int>(tiles_per_row), number_of_tiles,
+            initial_value, scan_op, scan_state_with_sleep, ordered_bid
+        );
+    }
+    else
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(batched_scan_rows_kernel<Exclusive, config>),
+            dim3(grid_size), dim3(block_size), 0, stream,
+            input, output, row_length, static_cast<unsigned int>(tiles_per_row), number_of_tiles,
+            initial_value, scan_op, scan_state, ordered_bid
+        );
+    }
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("batched_scan_rows_kernel", number_of_tiles, start)
+
+    return hipSuccess;
+}
+
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
+} // end of detail namespace
+
+/// \brief Parallel batched inclusive scan primitive for device level.
+///
+/// batched_inclusive_scan function performs device-wide inclusive prefix scan operations of
+/// multiple independent problems in one launch using binary \p scan_op operator.
+///
+/// \par Overview
+/// * Every problem has its own input and output ranges. The tiles of all problems are
+/// processed by one decoupled look-back scan, so problems of very different sizes are
+/// processed efficiently. The look-back of a tile never crosses the first tile of its problem.
+/// * \p sizes is read on the host, \p inputs and \p outputs are read on the device.
+/// * The total number of tiles of all problems must be less than 2^32, otherwise
+/// \p hipErrorInvalidValue is returned.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer. The size depends on \p sizes.
+/// * Supports non-commutative scan operators. However, a scan operator should be
+/// associative.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p scan_config or
+/// a custom class with the same members. The look-back algorithm is always used.
+/// \tparam InputIterators - random-access iterator type of the range of input iterators. Its
+/// \p value_type must be a random-access iterator type of an input range. Both can be simple
+/// pointer types.
+/// \tparam OutputIterators - random-access iterator type of the range of output iterators. Its
+/// \p value_type must be a random-access iterator type of an output range. Both can be simple
+/// pointer types.
+/// \tparam SizeIterator - random-access iterator type of the sizes of the problems. It can be a
+/// simple pointer type.
+/// \tparam BinaryFunction - type of binary function used for scan. Default type
+/// is \p rocprim::plus<T>, where \p T is a \p value_type of the input iterators.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the scan operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] inputs - device-accessible iterator to the first element in the range of
+/// iterators to the input ranges of the problems.
+/// \param [out] outputs - device-accessible iterator to the first element in the range of
+/// iterators to the output ranges of the problems.
+/// \param [in] sizes - host-accessible iterator to the first element in the range of the
+/// numbers of elements of the problems.
+/// \param [in] problems - number of problems.
+/// \param [in] scan_op - binary operation function object that will be used for scan.
+/// The signature of the function should be equivalent to the following:
+/// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int problems;   // e.g., 3
+/// int ** inputs;           // device array of pointers to e.g. [1, 2], [3], [4, 5, 6]
+/// int ** outputs;          // device array of pointers to 2, 1 and 3 elements
+/// size_t * sizes;          // host array, e.g. [2, 1, 3]
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::batched_inclusive_scan(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     inputs, outputs, sizes, problems
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform batched scan
+/// rocprim::batched_inclusive_scan(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     inputs, outputs, sizes, problems
+/// );
+/// // outputs: [1, 3], [3], [4, 9, 15]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class InputIterators,
+    class OutputIterators,
+    class SizeIterator,
+    class BinaryFunction = ::rocprim::plus<typename std::iterator_traits<
+        typename std::iterator_traits<InputIterators>::value_type>::value_type>>
+inline hipError_t batched_inclusive_scan(void*           temporary_storage,
+                                         size_t&         storage_size,
+                                         InputIterators  inputs,
+                                         OutputIterators outputs,
+                                         SizeIterator    sizes,
+                                         unsigned int    problems,
+                                         BinaryFunction  scan_op           = BinaryFunction(),
+                                         hipStream_t     stream            = 0,
+                                         bool            debug_synchronous = false)
+{
+    using input_iterator_type = typename std::iterator_traits<InputIterators>::value_type;
+    using input_type          = typename std::iterator_traits<input_iterator_type>::value_type;
+
+    // Get default config if Config is default_config
+    using config = detail::default_or_custom_config<
+        Config,
+        detail::default_scan_config<ROCPRIM_TARGET_ARCH, input_type>>;
+
+    return detail::batched_scan_impl<false, config>(temporary_storage,
+                                                    storage_size,
+                                                    inputs,
+                                                    outputs,
+                                                    sizes,
+                                                    problems,
+                                                    // input_type() is a dummy initial value
+                                                    input_type(),
+                                                    scan_op,
+                                                    stream,
+                                                    debug_synchronous);
+}
+
+/// \brief Parallel batched exclusive scan primitive for device level.
+///
+/// batched_exclusive_scan function performs device-wide exclusive prefix scan operations of
+/// multiple independent problems in one launch using binary \p scan_op operator.
+///
+/// \par Overview
+/// * Every problem has its own input and output ranges, every scan starts with
+/// \p initial_value. The tiles of all problems are processed by one decoupled look-back scan,
+/// so problems of very different sizes are processed efficiently.
+/// * \p sizes is read on the host, \p inputs and \p outputs are read on the device.
+/// * The total number of tiles of all problems must be less than 2^32, otherwise
+/// \p hipErrorInvalidValue is returned.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer. The size depends on \p sizes.
+/// * Supports non-commutative scan operators. However, a scan operator should be
+/// associative.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p scan_config or
+/// a custom class with the same members. The look-back algorithm is always used.
+/// \tparam InputIterators - random-access iterator type of the range of input iterators. Its
+/// \p value_type must be a random-access iterator type of an input range. Both can be simple
+/// pointer types.
+/// \tparam OutputIterators - random-access iterator type of the range of output iterators. Its
+/// \p value_type must be a random-access iterator type of an output range. Both can be simple
+/// pointer types.
+/// \tparam SizeIterator - random-access iterator type of the sizes of the problems. It can be a
+/// simple pointer type.
+/// \tparam InitValueType - type of the initial value.
+/// \tparam BinaryFunction - type of binary function used for scan. Default type
+/// is \p rocprim::plus<T>, where \p T is a \p value_type of the input iterators.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the scan operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] inputs - device-accessible iterator to the first element in the range of
+/// iterators to the input ranges of the problems.
+/// \param [out] outputs - device-accessible iterator to the first element in the range of
+/// iterators to the output ranges of the problems.
+/// \param [in] sizes - host-accessible iterator to the first element in the range of the
+/// numbers of elements of the problems.
+/// \param [in] problems - number of problems.
+/// \param [in] initial_value - initial value to start the scan of every problem.
+/// \param [in] scan_op - binary operation function object that will be used for scan.
+/// The signature of the function should be equivalent to the following:
+/// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    class InputIterators,
+    class OutputIterators,
+    class SizeIterator,
+    class InitValueType,
+    class BinaryFunction = ::rocprim::plus<typename std::iterator_traits<
+        typename std::iterator_traits<InputIterators>::value_type>::value_type>>
+inline hipError_t batched_exclusive_scan(void*               temporary_storage,
+                                         size_t&             storage_size,
+                                         InputIterators      inputs,
+                                         OutputIterators     outputs,
+                                         SizeIterator        sizes,
+                                         unsigned int        problems,
+                                         const InitValueType initial_value,
+                                         BinaryFunction      scan_op           = BinaryFunction(),
+                                         hipStream_t         stream            = 0,
+                                         bool                debug_synchronous = false)
+{
+    // Get default config if Config is default_config
+    using config = detail::default_or_custom_config<
+        Config,
+        detail::default_scan_config<ROCPRIM_TARGET_ARCH, InitValueType>>;
+
+    return detail::batched_scan_impl<true, config>(temporary_storage,
+                                                   storage_size,
+                                                   inputs,
+                                                   outputs,
+                                                   sizes,
+                                                   problems,
+                                                   initial_value,
+                                                   scan_op,
+                                                   stream,
+                                                   debug_synchronous);
+}
+
+/// \brief Parallel batched inclusive scan primitive for device level, which scans the rows of
+/// a matrix.
+///
+/// batched_inclusive_scan_rows function performs device-wide inclusive prefix scan operations
+/// of every row of a row-major matrix of \p rows rows of \p row_length items in one launch
+/// using binary \p scan_op operator. No offsets of the rows are needed.
+///
+/// \par Overview
+/// * Rows that fit in the items of a logical warp of up to 32 threads are scanned by logical
+/// warps, several rows per block, so short rows keep all compute units busy.
+/// * Longer rows are split into tiles, which are processed by one decoupled look-back scan.
+/// The look-back of a tile never crosses the first tile of its row. The total number of tiles
+/// of all rows must be less than 2^32, otherwise \p hipErrorInvalidValue is returned.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer. The size depends on \p rows and \p row_length.
+/// * Supports non-commutative scan operators. However, a scan operator should be
+/// associative.
+/// * The scan can be performed in place: \p output can be the same range as \p input.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p scan_config or
+/// a custom class with the same members. The look-back algorithm is always used for long rows.
+/// \tparam InputIterator - random-access iterator type of the input matrix. It can be a simple
+/// pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output matrix. It can be a simple
+/// pointer type.
+/// \tparam BinaryFunction - type of binary function used for scan. Default type
+/// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the scan operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first item of the input matrix, the rows are consecutive.
+/// \param [out] output - iterator to the first item of the output matrix.
+/// \param [in] rows - number of rows.
+/// \param [in] row_length - number of items of every row.
+/// \param [in] scan_op - binary operation function object that will be used for scan.
+/// The signature of the function should be equivalent to the following:
+/// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int rows;   // e.g., 2
+/// size_t row_length;   // e.g., 3
+/// int * input;         // e.g., [1, 2, 3, 4, 5, 6]
+/// int * output;        // empty array of 6 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::batched_inclusive_scan_rows(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, rows, row_length
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform batched scan
+/// rocprim::batched_inclusive_scan_rows(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, rows, row_length
+/// );
+/// // output: [1, 3, 6, 4, 9, 15]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class BinaryFunction
+         = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>>
+inline hipError_t batched_inclusive_scan_rows(void*          temporary_storage,
+                                              size_t&        storage_size,
+                                              InputIterator  input,
+                                              OutputIterator output,
+                                              unsigned int   rows,
+                                              size_t         row_length,
+                                              BinaryFunction scan_op           = BinaryFunction(),
+                                              hipStream_t    stream            = 0,
+                                              bool           debug_synchronous = false)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    // Get default config if Config is default_config
+    using config = detail::default_or_custom_config<
+        Config,
+        detail::default_scan_config<ROCPRIM_TARGET_ARCH, input_type>>;
+
+    return detail::batched_scan_rows_impl<false, config>(temporary_storage,
+                                                         storage_size,
+                                                         input,
+                                                         output,
+                                                         rows,
+                                                         row_length,
+                                                         // input_type() is a dummy initial value
+                                                         input_type(),
+                                                         scan_op,
+                                                         stream,
+                                                         debug_synchronous);
+}
+
+/// \brief Parallel batched exclusive scan primitive for device level, which scans the rows of
+/// a matrix.
+///
+/// batched_exclusive_scan_rows function performs device-wide exclusive prefix scan operations
+/// of every row of a row-major matrix of \p rows rows of \p row_length items in one launch
+/// using binary \p scan_op operator. No offsets of the rows are needed.
+///
+/// \par Overview
+/// * Every row is scanned starting with \p initial_value.
+/// * Rows that fit in the items of a logical warp of up to 32 threads are scanned by logical
+/// warps, several rows per block, so short rows keep all compute units busy.
+/// * Longer rows are split into tiles, which are processed by one decoupled look-back scan.
+/// The look-back of a tile never crosses the first tile of its row. The total number of tiles
+/// of all rows must be less than 2^32, otherwise \p hipErrorInvalidValue is returned.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer. The size depends on \p rows and \p row_length.
+/// * Supports non-commutative scan operators. However, a scan operator should be
+/// associative.
+/// * The scan can be performed in place: \p output can be the same range as \p input.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p scan_config or
+/// a custom class with the same members. The look-back algorithm is always used for long rows.
+/// \tparam InputIterator - random-access iterator type of the input matrix. It can be a simple
+/// pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output matrix. It can be a simple
+/// pointer type.
+/// \tparam InitValueType - type of the initial value.
+/// \tparam BinaryFunction - type of binary function used for scan. Default type
+/// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the scan operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first item of the input matrix, the rows are consecutive.
+/// \param [out] output - iterator to the first item of the output matrix.
+/// \param [in] rows - number of rows.
+/// \param [in] row_length - number of items of every row.
+/// \param [in] initial_value - initial value to start the scan of every row.
+/// \param [in] scan_op - binary operation function object that will be used for scan.
+/// The signature of the function should be equivalent to the following:
+/// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class InitValueType,
+         class BinaryFunction
+         = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>>
+inline hipError_t batched_exclusive_scan_rows(void*               temporary_storage,
+                                              size_t&             storage_size,
+                                              InputIterator       input,
+                                              OutputIterator      output,
+                                              unsigned int        rows,
+                                              size_t              row_length,
+                                              const InitValueType initial_value,
+                                              BinaryFunction      scan_op = BinaryFunction(),
+                                              hipStream_t         stream  = 0,
+                                              bool                debug_synchronous = false)
+{
+    // Get default config if Config is default_config
+    using config = detail::default_or_custom_config<
+        Config,
+        detail::default_scan_config<ROCPRIM_TARGET_ARCH, InitValueType>>;
+
+    return detail::batched_scan_rows_impl<true, config>(temporary_storage,
+                                                        storage_size,
+                                                        input,
+                                                        output,
+                                                        rows,
+                                                        row_length,
+                                                        initial_value,
+                                                        scan_op,
+                                                        stream,
+                                                        debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_BATCHED_SCAN_HPP_
@@ -21,15 +21,24 @@
 #ifndef ROCPRIM_DEVICE_DEVICE_BINARY_SEARCH_HPP_
 #define ROCPRIM_DEVICE_DEVICE_BINARY_SEARCH_HPP_
 
+#include <chrono>
+#include <iostream>
 #include <type_traits>
 #include <iterator>
+#include <limits>
 
 #include "../config.hpp"
+#include "../detail/device_properties.hpp"
+#include "../detail/temp_storage.hpp"
 #include "../detail/various.hpp"
+#include "../iterator/counting_iterator.hpp"
 
 #include "detail/device_binary_search.hpp"
 
+#include "device_merge_config.hpp"
 #include "device_transform.hpp"
+#include "device_transform_config.hpp"
+#include "instrumentation.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -83,6 +92,395 @@ hipError_t binary_search(void * temporary_storage,
     );
 }
 
+template<
+    class IndexIterator,
+    class InputIterator1,
+    class InputIterator2,
+    class CompareFunction
+>
+ROCPRIM_KERNEL
+__launch_bounds__(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE)
+void sorted_search_partition_kernel(IndexIterator index,
+                                    InputIterator1 input1,
+                                    InputIterator2 input2,
+                                    const size_t input1_size,
+                                    const size_t input2_size,
+                                    const unsigned int spacing,
+                                    CompareFunction compare_function)
+{
+    partition_kernel_impl(
+        index, input1, input2, input1_size, input2_size,
+        spacing, compare_function
+    );
+}
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    bool NeedlesFirst,
+    class IndexIterator,
+    class InputIterator1,
+    class InputIterator2,
+    class OutputIterator,
+    class CompareFunction
+>
+ROCPRIM_KERNEL
+__launch_bounds__(BlockSize)
+void sorted_search_kernel(IndexIterator index,
+                          InputIterator1 input1,
+                          InputIterator2 input2,
+                          OutputIterator output,
+                          const size_t input1_size,
+                          const size_t input2_size,
+                          CompareFunction compare_function)
+{
+    sorted_search_kernel_impl<BlockSize, ItemsPerThread, NeedlesFirst>(
+        index, input1, input2, output,
+        input1_size, input2_size, compare_function
+    );
+}
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
+    { \
+        auto _error = hipGetLastError(); \
+        if(_error != hipSuccess) return _error; \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
+        if(debug_synchronous) \
+        { \
+            std::cout << name << "(" << size << ")"; \
+            auto __error = hipStreamSynchronize(stream); \
+            if(__error != hipSuccess) return __error; \
+            auto _end = std::chrono::high_resolution_clock::now(); \
+            auto _d = std::chrono::duration_cast<std::chrono::duration<double>>(_end - start); \
+            std::cout << " " << _d.count() * 1000 << " ms" << '\n'; \
+        } \
+    }
+
+// Merges the needles with the haystack. The needles are input1 and the haystack is input2 if
+// NeedlesFirst (lower bound), otherwise the haystack is input1 and the needles are input2
+// (upper bound).
+template<
+    class Config,
+    bool NeedlesFirst,
+    class InputIterator1,
+    class InputIterator2,
+    class OutputIterator,
+    class CompareFunction
+>
+inline
+hipError_t sorted_search(void * temporary_storage,
+                         size_t& storage_size,
+                         InputIterator1 input1,
+                         InputIterator2 input2,
+                         OutputIterator output,
+                         size_t input1_size,
+                         size_t input2_size,
+                         CompareFunction compare_op,
+                         hipStream_t stream,
+                         bool debug_synchronous)
+{
+    using input1_type = typename std::iterator_traits<InputIterator1>::value_type;
+    using input2_type = typename std::iterator_traits<InputIterator2>::value_type;
+
+    using config = detail::default_or_custom_config<
+        Config,
+        detail::default_merge_config<ROCPRIM_TARGET_ARCH, input1_type, input2_type>
+    >;
+
+    static constexpr unsigned int block_size = config::block_size;
+    static constexpr unsigned int half_block = block_size / 2;
+    static constexpr unsigned int items_per_thread = config::items_per_thread;
+    static constexpr auto items_per_block = block_size * items_per_thread;
+
+    const size_t needles_size = NeedlesFirst ? input1_size : input2_size;
+    const unsigned int partitions
+        = ((input1_size + input2_size) + items_per_block - 1) / items_per_block;
+
+    unsigned int* index;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::ptr_aligned_array(&index, partitions + 1));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(needles_size == 0)
+        return hipSuccess;
+
+    // Start point for time measurements
+    std::chrono::high_resolution_clock::time_point start;
+
+    if(debug_synchronous)
+    {
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << partitions << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+    }
+
+    const unsigned partition_blocks = ((partitions + 1) + half_block - 1) / half_block;
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("sorted_search_partition_kernel");
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(detail::sorted_search_partition_kernel),
+        dim3(partition_blocks), dim3(half_block), 0, stream,
+        index, input1, input2, input1_size, input2_size,
+        items_per_block, compare_op
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("sorted_search_partition_kernel", needles_size, start);
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("sorted_search_kernel");
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(detail::sorted_search_kernel<block_size, items_per_thread, NeedlesFirst>),
+        dim3(partitions), dim3(block_size), 0, stream,
+        index, input1, input2, output,
+        input1_size, input2_size, compare_op
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("sorted_search_kernel", needles_size, start);
+
+    return hipSuccess;
+}
+
+// The index is loaded to shared memory by every block, so blocks process many tiles of needles
+constexpr unsigned int indexed_search_blocks_per_cu = 8;
+constexpr size_t search_index_max_shared_bytes = 32768;
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    class HaystackIterator,
+    class IndexType,
+    class NeedlesIterator,
+    class OutputIterator,
+    class SearchFunction,
+    class CompareFunction
+>
+ROCPRIM_KERNEL
+__launch_bounds__(BlockSize)
+void indexed_search_kernel(HaystackIterator haystack,
+                           const IndexType* index,
+                           const unsigned int index_size,
+                           NeedlesIterator needles,
+                           OutputIterator output,
+                           const size_t haystack_size,
+                           const size_t needles_size,
+                           const size_t spacing,
+                           SearchFunction search_op,
+                           CompareFunction compare_op)
+{
+    HIP_DYNAMIC_SHARED(unsigned int, index_shared);
+
+    indexed_search_kernel_impl<BlockSize, ItemsPerThread>(
+        haystack, index, index_size, needles, output,
+        haystack_size, needles_size, spacing,
+        search_op, compare_op,
+        reinterpret_cast<IndexType*>(index_shared)
+    );
+}
+
+template<
+    class Config,
+    class HaystackIterator,
+    class IndexType,
+    class NeedlesIterator,
+    class OutputIterator,
+    class SearchFunction,
+    class CompareFunction
+>
+inline
+hipError_t indexed_search(void * temporary_storage,
+                          size_t& storage_size,
+                          HaystackIterator haystack,
+                          const IndexType* index,
+                          unsigned int index_size,
+                          NeedlesIterator needles,
+                          OutputIterator output,
+                          size_t haystack_size,
+                          size_t needles_size,
+                          SearchFunction search_op,
+                          CompareFunction compare_op,
+                          hipStream_t stream,
+                          bool debug_synchronous)
+{
+    using value_type = typename std::iterator_traits<NeedlesIterator>::value_type;
+
+    using config = detail::default_or_custom_config<
+        Config,
+        detail::default_transform_config<ROCPRIM_TARGET_ARCH, value_type>
+    >;
+
+    static constexpr unsigned int block_size = config::block_size;
+    static constexpr unsigned int items_per_thread = config::items_per_thread;
+    static constexpr auto items_per_block = block_size * items_per_thread;
+
+    if(index_size == 0 || index_size * sizeof(IndexType) > search_index_max_shared_bytes)
+    {
+        return hipErrorInvalidValue;
+    }
+
+    if(temporary_storage == nullptr)
+    {
+        // Make sure user won't try to allocate 0 bytes memory, otherwise
+        // user may again pass nullptr as temporary_storage
+        storage_size = 4;
+        return hipSuccess;
+    }
+
+    if(needles_size == 0)
+        return hipSuccess;
+
+    device_properties props;
+    hipError_t        error = get_current_device_properties(props);
+    if(error != hipSuccess) return error;
+
+    const size_t tiles = ceiling_div(needles_size, items_per_block);
+    const unsigned int number_of_blocks = static_cast<unsigned int>(::rocprim::min<size_t>(
+        tiles, ::rocprim::max(1u, props.compute_units * indexed_search_blocks_per_cu)));
+    const size_t spacing = get_search_index_spacing(haystack_size, index_size);
+
+    // Start point for time measurements
+    std::chrono::high_resolution_clock::time_point start;
+
+    if(debug_synchronous)
+    {
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << number_of_blocks << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+        std::cout << "spacing " << spacing << '\n';
+    }
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("indexed_search_kernel");
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(detail::indexed_search_kernel<block_size, items_per_thread>),
+        dim3(number_of_blocks), dim3(block_size), index_size * sizeof(IndexType), stream,
+        haystack, index, index_size, needles, output,
+        haystack_size, needles_size, spacing,
+        search_op, compare_op
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("indexed_search_kernel", needles_size, start);
+
+    return hipSuccess;
+}
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int StagedHaystackSize,
+    class HaystackIterator,
+    class OffsetIterator,
+    class NeedlesIterator,
+    class SegmentIterator,
+    class OutputIterator,
+    class SearchFunction,
+    class CompareFunction
+>
+ROCPRIM_KERNEL
+__launch_bounds__(BlockSize)
+void segmented_search_kernel(HaystackIterator haystack,
+                             OffsetIterator haystack_offsets,
+                             NeedlesIterator needles,
+                             SegmentIterator needle_segments,
+                             OutputIterator output,
+                             const size_t needles_size,
+                             SearchFunction search_op,
+                             CompareFunction compare_op)
+{
+    segmented_search_kernel_impl<BlockSize, ItemsPerThread, StagedHaystackSize>(
+        haystack, haystack_offsets, needles, needle_segments, output,
+        needles_size, search_op, compare_op
+    );
+}
+
+template<
+    class Config,
+    class HaystackIterator,
+    class OffsetIterator,
+    class NeedlesIterator,
+    class SegmentIterator,
+    class OutputIterator,
+    class SearchFunction,
+    class CompareFunction
+>
+inline
+hipError_t segmented_search(void * temporary_storage,
+                            size_t& storage_size,
+                            HaystackIterator haystack,
+                            OffsetIterator haystack_offsets,
+                            NeedlesIterator needles,
+                            SegmentIterator needle_segments,
+                            OutputIterator output,
+                            size_t needles_size,
+                            SearchFunction search_op,
+                            CompareFunction compare_op,
+                            hipStream_t stream,
+                            bool debug_synchronous)
+{
+    using value_type = typename std::iterator_traits<NeedlesIterator>::value_type;
+    using haystack_type = typename std::iterator_traits<HaystackIterator>::value_type;
+
+    using config = detail::default_or_custom_config<
+        Config,
+        detail::default_transform_config<ROCPRIM_TARGET_ARCH, value_type>
+    >;
+
+    static constexpr unsigned int block_size = config::block_size;
+    static constexpr unsigned int items_per_thread = config::items_per_thread;
+    static constexpr auto items_per_block = block_size * items_per_thread;
+    // The haystack span of a tile is staged if it is not longer than the tile of needles
+    static constexpr unsigned int staged_haystack_size = ::rocprim::max<unsigned int>(
+        1, ::rocprim::min<unsigned int>(items_per_block,
+                                        search_index_max_shared_bytes / sizeof(haystack_type)));
+
+    if(temporary_storage == nullptr)
+    {
+        // Make sure user won't try to allocate 0 bytes memory, otherwise
+        // user may again pass nullptr as temporary_storage
+        storage_size = 4;
+        return hipSuccess;
+    }
+
+    if(needles_size == 0)
+        return hipSuccess;
+
+    const size_t tiles = ceiling_div(needles_size, items_per_block);
+    if(tiles > std::numeric_limits<unsigned int>::max())
+    {
+        return hipErrorInvalidValue;
+    }
+    const unsigned int number_of_blocks = static_cast<unsigned int>(tiles);
+
+    // Start point for time measurements
+    std::chrono::high_resolution_clock::time_point start;
+
+    if(debug_synchronous)
+    {
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << number_of_blocks << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+        std::cout << "staged_haystack_size " << staged_haystack_size << '\n';
+    }
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("segmented_search_kernel");
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(
+            detail::segmented_search_kernel<block_size, items_per_thread, staged_haystack_size>),
+        dim3(number_of_blocks), dim3(block_size), 0, stream,
+        haystack, haystack_offsets, needles, needle_segments, output,
+        needles_size, search_op, compare_op
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_search_kernel", needles_size, start);
+
+    return hipSuccess;
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
 } // end of detail namespace
 
 template<
@@ -169,6 +567,455 @@ hipError_t binary_search(void * temporary_storage,
     );
 }
 
+/// \brief Finds the lower bounds of sorted needles in a sorted haystack.
+///
+/// \par
+/// * Computes the same result as \p lower_bound, but the needles must be sorted by \p compare_op too.
+/// * Instead of an independent binary search per needle the needles are merged with the haystack
+/// using merge path partitioning, so both ranges are read exactly once.
+/// * The sum of \p haystack_size and \p needles_size must fit \p unsigned \p int.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p merge_config or
+/// a custom class with the same members.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the search.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] haystack - iterator to the first element in the sorted range to search in.
+/// \param [in] needles - iterator to the first element in the sorted range of values to search for.
+/// \param [out] output - iterator to the first element in the range of the found positions, one for
+/// each needle.
+/// \param [in] haystack_size - number of elements in the haystack.
+/// \param [in] needles_size - number of needles.
+/// \param [in] compare_op - binary operation function object which both ranges are sorted by.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful search; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    class HaystackIterator,
+    class NeedlesIterator,
+    class OutputIterator,
+    class CompareFunction = ::rocprim::less<>
+>
+inline
+hipError_t sorted_lower_bound(void * temporary_storage,
+                              size_t& storage_size,
+                              HaystackIterator haystack,
+                              NeedlesIterator needles,
+                              OutputIterator output,
+                              size_t haystack_size,
+                              size_t needles_size,
+                              CompareFunction compare_op = CompareFunction(),
+                              hipStream_t stream = 0,
+                              bool debug_synchronous = false)
+{
+    // Needles are placed before the equal values of the haystack
+    return detail::sorted_search<Config, true>(
+        temporary_storage, storage_size,
+        needles, haystack, output,
+        needles_size, haystack_size,
+        compare_op,
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Finds the upper bounds of sorted needles in a sorted haystack.
+///
+/// \par
+/// * Computes the same result as \p upper_bound, but the needles must be sorted by \p compare_op too.
+/// * Instead of an independent binary search per needle the needles are merged with the haystack
+/// using merge path partitioning, so both ranges are read exactly once.
+/// * The sum of \p haystack_size and \p needles_size must fit \p unsigned \p int.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p merge_config or
+/// a custom class with the same members.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the search.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] haystack - iterator to the first element in the sorted range to search in.
+/// \param [in] needles - iterator to the first element in the sorted range of values to search for.
+/// \param [out] output - iterator to the first element in the range of the found positions, one for
+/// each needle.
+/// \param [in] haystack_size - number of elements in the haystack.
+/// \param [in] needles_size - number of needles.
+/// \param [in] compare_op - binary operation function object which both ranges are sorted by.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful search; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    class HaystackIterator,
+    class NeedlesIterator,
+    class OutputIterator,
+    class CompareFunction = ::rocprim::less<>
+>
+inline
+hipError_t sorted_upper_bound(void * temporary_storage,
+                              size_t& storage_size,
+                              HaystackIterator haystack,
+                              NeedlesIterator needles,
+                              OutputIterator output,
+                              size_t haystack_size,
+                              size_t needles_size,
+                              CompareFunction compare_op = CompareFunction(),
+                              hipStream_t stream = 0,
+                              bool debug_synchronous = false)
+{
+    // Needles are placed after the equal values of the haystack
+    return detail::sorted_search<Config, false>(
+        temporary_storage, storage_size,
+        haystack, needles, output,
+        haystack_size, needles_size,
+        compare_op,
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Builds the search index of a sorted haystack for \p indexed_lower_bound and
+/// \p indexed_upper_bound.
+///
+/// \par
+/// * The index holds every <tt>ceil(haystack_size / index_size)</tt>-th element of the haystack.
+/// Entries past the end of the haystack repeat its last element.
+/// * The index is built once and can be used for any number of searches in the same haystack.
+/// * <tt>index_size * sizeof(IndexType)</tt> must not exceed 32 KB, because every block of the
+/// searches loads the whole index to shared memory.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p transform_config or
+/// a custom class with the same members.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without building the index.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] haystack - iterator to the first element in the sorted range to search in.
+/// \param [out] index - pointer to the first element of the index.
+/// \param [in] haystack_size - number of elements in the haystack.
+/// \param [in] index_size - number of elements in the index.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful build; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    class HaystackIterator,
+    class IndexType
+>
+inline
+hipError_t build_search_index(void * temporary_storage,
+                              size_t& storage_size,
+                              HaystackIterator haystack,
+                              IndexType * index,
+                              size_t haystack_size,
+                              unsigned int index_size,
+                              hipStream_t stream = 0,
+                              bool debug_synchronous = false)
+{
+    if(index_size == 0 || index_size * sizeof(IndexType) > detail::search_index_max_shared_bytes)
+    {
+        return hipErrorInvalidValue;
+    }
+
+    if(temporary_storage == nullptr)
+    {
+        // Make sure user won't try to allocate 0 bytes memory, otherwise
+        // user may again pass nullptr as temporary_storage
+        storage_size = 4;
+        return hipSuccess;
+    }
+
+    if(haystack_size == 0)
+        return hipSuccess;
+
+    return transform<Config>(
+        ::rocprim::make_counting_iterator<size_t>(0), index,
+        index_size,
+        detail::search_index_op<HaystackIterator>{
+            haystack, haystack_size,
+            detail::get_search_index_spacing(haystack_size, index_size)
+        },
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Finds the lower bounds of needles in a sorted haystack using its search index.
+///
+/// \par
+/// * Computes the same result as \p lower_bound. The needles do not need to be sorted.
+/// * Every block loads the index built by \p build_search_index to shared memory and searches it
+/// first, so only <tt>ceil(haystack_size / index_size)</tt> elements of the haystack are searched
+/// for each needle. This avoids cache misses of the top levels of the binary search in large haystacks.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p transform_config or
+/// a custom class with the same members.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the search.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] haystack - iterator to the first element in the sorted range to search in.
+/// \param [in] index - pointer to the first element of the index of the haystack.
+/// \param [in] index_size - number of elements in the index, the same as for \p build_search_index.
+/// \param [in] needles - iterator to the first element in the range of values to search for.
+/// \param [out] output - iterator to the first element in the range of the found positions, one for
+/// each needle.
+/// \param [in] haystack_size - number of elements in the haystack.
+/// \param [in] needles_size - number of needles.
+/// \param [in] compare_op - binary operation function object which the haystack is sorted by.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful search; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    class HaystackIterator,
+    class IndexType,
+    class NeedlesIterator,
+    class OutputIterator,
+    class CompareFunction = ::rocprim::less<>
+>
+inline
+hipError_t indexed_lower_bound(void * temporary_storage,
+                               size_t& storage_size,
+                               HaystackIterator haystack,
+                               const IndexType * index,
+                               unsigned int index_size,
+                               NeedlesIterator needles,
+                               OutputIterator output,
+                               size_t haystack_size,
+                               size_t needles_size,
+                               CompareFunction compare_op = CompareFunction(),
+                               hipStream_t stream = 0,
+                               bool debug_synchronous = false)
+{
+    return detail::indexed_search<Config>(
+        temporary_storage, storage_size,
+        haystack, index, index_size, needles, output,
+        haystack_size, needles_size,
+        detail::lower_bound_search_op(), compare_op,
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Finds the upper bounds of needles in a sorted haystack using its search index.
+///
+/// \par
+/// * Computes the same result as \p upper_bound. The needles do not need to be sorted.
+/// * Every block loads the index built by \p build_search_index to shared memory and searches it
+/// first, so only <tt>ceil(haystack_size / index_size)</tt> elements of the haystack are searched
+/// for each needle. This avoids cache misses of the top levels of the binary search in large haystacks.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p transform_config or
+/// a custom class with the same members.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the search.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] haystack - iterator to the first element in the sorted range to search in.
+/// \param [in] index - pointer to the first element of the index of the haystack.
+/// \param [in] index_size - number of elements in the index, the same as for \p build_search_index.
+/// \param [in] needles - iterator to the first element in the range of values to search for.
+/// \param [out] output - iterator to the first element in the range of the found positions, one for
+/// each needle.
+/// \param [in] haystack_size - number of elements in the haystack.
+/// \param [in] needles_size - number of needles.
+/// \param [in] compare_op - binary operation function object which the haystack is sorted by.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful search; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    class HaystackIterator,
+    class IndexType,
+    class NeedlesIterator,
+    class OutputIterator,
+    class CompareFunction = ::rocprim::less<>
+>
+inline
+hipError_t indexed_upper_bound(void * temporary_storage,
+                               size_t& storage_size,
+                               HaystackIterator haystack,
+                               const IndexType * index,
+                               unsigned int index_size,
+                               NeedlesIterator needles,
+                               OutputIterator output,
+                               size_t haystack_size,
+                               size_t needles_size,
+                               CompareFunction compare_op = CompareFunction(),
+                               hipStream_t stream = 0,
+                               bool debug_synchronous = false)
+{
+    return detail::indexed_search<Config>(
+        temporary_storage, storage_size,
+        haystack, index, index_size, needles, output,
+        haystack_size, needles_size,
+        detail::upper_bound_search_op(), compare_op,
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Finds the lower bounds of needles, each in its own segment of a sorted haystack.
+///
+/// \par
+/// * The haystack is a concatenation of segments, segment \p s is the range
+/// <tt>[haystack_offsets[s], haystack_offsets[s + 1])</tt> and every segment must be sorted
+/// by \p compare_op.
+/// * Needle \p i is searched in segment <tt>needle_segments[i]</tt> and the result is the
+/// lower bound of the needle relative to the beginning of its segment.
+/// * If the segments of the needles of a block are small and close to each other (for example
+/// the needles are sorted by segment), the block loads them to shared memory once, so the
+/// searches do not probe the global memory.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p transform_config or
+/// a custom class with the same members.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the search.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] haystack - iterator to the first element in the segmented haystack.
+/// \param [in] haystack_offsets - iterator to the offsets of the segments of the haystack, it must
+/// have one more element than the number of segments.
+/// \param [in] needles - iterator to the first element in the range of values to search for.
+/// \param [in] needle_segments - iterator to the segment of every needle.
+/// \param [out] output - iterator to the first element in the range of the found positions, one for
+/// each needle.
+/// \param [in] needles_size - number of needles.
+/// \param [in] compare_op - binary operation function object which the segments are sorted by.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful search; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    class HaystackIterator,
+    class OffsetIterator,
+    class NeedlesIterator,
+    class SegmentIterator,
+    class OutputIterator,
+    class CompareFunction = ::rocprim::less<>
+>
+inline
+hipError_t segmented_lower_bound(void * temporary_storage,
+                                size_t& storage_size,
+                                HaystackIterator haystack,
+                                OffsetIterator haystack_offsets,
+                                NeedlesIterator needles,
+                                SegmentIterator needle_segments,
+                                OutputIterator output,
+                                size_t needles_size,
+                                CompareFunction compare_op = CompareFunction(),
+                                hipStream_t stream = 0,
+                                bool debug_synchronous = false)
+{
+    return detail::segmented_search<Config>(
+        temporary_storage, storage_size,
+        haystack, haystack_offsets, needles, needle_segments, output,
+        needles_size,
+        detail::lower_bound_search_op(), compare_op,
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Finds the upper bounds of needles, each in its own segment of a sorted haystack.
+///
+/// \par
+/// * The haystack is a concatenation of segments, segment \p s is the range
+/// <tt>[haystack_offsets[s], haystack_offsets[s + 1])</tt> and every segment must be sorted
+/// by \p compare_op.
+/// * Needle \p i is searched in segment <tt>needle_segments[i]</tt> and the result is the
+/// upper bound of the needle relative to the beginning of its segment.
+/// * If the segments of the needles of a block are small and close to each other (for example
+/// the needles are sorted by segment), the block loads them to shared memory once, so the
+/// searches do not probe the global memory.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p transform_config or
+/// a custom class with the same members.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the search.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] haystack - iterator to the first element in the segmented haystack.
+/// \param [in] haystack_offsets - iterator to the offsets of the segments of the haystack, it must
+/// have one more element than the number of segments.
+/// \param [in] needles - iterator to the first element in the range of values to search for.
+/// \param [in] needle_segments - iterator to the segment of every needle.
+/// \param [out] output - iterator to the first element in the range of the found positions, one for
+/// each needle.
+/// \param [in] needles_size - number of needles.
+/// \param [in] compare_op - binary operation function object which the segments are sorted by.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful search; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    class HaystackIterator,
+    class OffsetIterator,
+    class NeedlesIterator,
+    class SegmentIterator,
+    class OutputIterator,
+    class CompareFunction = ::rocprim::less<>
+>
+inline
+hipError_t segmented_upper_bound(void * temporary_storage,
+                                size_t& storage_size,
+                                HaystackIterator haystack,
+                                OffsetIterator haystack_offsets,
+                                NeedlesIterator needles,
+                                SegmentIterator needle_segments,
+                                OutputIterator output,
+                                size_t needles_size,
+                                CompareFunction compare_op = CompareFunction(),
+                                hipStream_t stream = 0,
+                                bool debug_synchronous = false)
+{
+    return detail::segmented_search<Config>(
+        temporary_storage, storage_size,
+        haystack, haystack_offsets, needles, needle_segments, output,
+        needles_size,
+        detail::upper_bound_search_op(), compare_op,
+        stream, debug_synchronous
+    );
+}
+
 /// @}
 // end of group devicemodule
 
@@ -0,0 +1,271 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef ROCPRIM_DEVICE_DEVICE_BITMASK_HPP_
+#define ROCPRIM_DEVICE_DEVICE_BITMASK_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/various.hpp"
+#include "../iterator/counting_iterator.hpp"
+#include "../iterator/transform_iterator.hpp"
+
+#include "detail/device_bitmask.hpp"
+#include "device_select.hpp"
+#include "instrumentation.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+constexpr unsigned int predicate_to_bitmask_block_size       = 256;
+constexpr unsigned int predicate_to_bitmask_items_per_thread = 8;
+
+template<class Word, class InputIterator, class WordIterator, class UnaryPredicate>
+ROCPRIM_KERNEL __launch_bounds__(predicate_to_bitmask_block_size)
+void predicate_to_bitmask_kernel(InputIterator  input,
+                                 WordIterator   words,
+                                 const size_t   size,
+                                 UnaryPredicate predicate)
+{
+    predicate_to_bitmask_kernel_impl<predicate_to_bitmask_block_size,
+                                     predicate_to_bitmask_items_per_thread,
+                                     Word>(input, words, size, predicate);
+}
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
+    { \
+        auto _error = hipGetLastError(); \
+        if(_error != hipSuccess) return _error; \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
+        if(debug_synchronous) \
+        { \
+            std::cout << name << "(" << size << ")"; \
+            auto __error = hipStreamSynchronize(stream); \
+            if(__error != hipSuccess) return __error; \
+            auto _end = std::chrono::high_resolution_clock::now(); \
+            auto _d = std::chrono::duration_cast<std::chrono::duration<double>>(_end - start); \
+            std::cout << " " << _d.count() * 1000 << " ms" << '\n'; \
+        } \
+    }
+
+} // end of detail namespace
+
+/// \brief Parallel select primitive for device level using a selection bitmask.
+///
+/// Performs a device-wide selection of the values of \p input whose bits in \p bitmask are set,
+/// the selected values are copied to \p output in their input order.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * The value \p i is selected if the bit <tt>i % W</tt> of the word <tt>bitmask[i / W]</tt>
+/// is set, where \p W is the number of bits of the words. The bits of a word are the values in
+/// order from the least significant bit, like the validity bitmaps of Apache Arrow.
+/// * The words are 32-bit or 64-bit unsigned integers.
+/// * Ranges specified by \p input and \p output must have at least \p size elements, while
+/// \p bitmask must have at least <tt>ceil(size / W)</tt> words.
+/// * The words are read instead of a flag per value, 1 bit of the selection is read per value.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p select_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. It can be
+/// a simple pointer type.
+/// \tparam BitmaskIterator - random-access iterator type of the bitmask words. It can be
+/// a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. It can be
+/// a simple pointer type.
+/// \tparam SelectedCountOutputIterator - random-access iterator type of the selected_count_output
+/// value. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the select operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to select values from.
+/// \param [in] bitmask - iterator to the first word of the selection bitmask.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [out] selected_count_output - iterator to the total number of selected values (length
+/// of \p output).
+/// \param [in] size - number of element in the input range.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;       // e.g., 8
+/// int * input;             // e.g., [1, 2, 3, 4, 5, 6, 7, 8]
+/// unsigned int * bitmask;  // e.g., [0b10100110]
+/// int * output;            // empty array of 8 elements
+/// size_t * output_count;   // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::select_bitmask(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, bitmask,
+///     output, output_count,
+///     input_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform selection
+/// rocprim::select_bitmask(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, bitmask,
+///     output, output_count,
+///     input_size
+/// );
+/// // output: [2, 3, 6, 8]
+/// // output_count: 4
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class BitmaskIterator,
+         class OutputIterator,
+         class SelectedCountOutputIterator>
+inline hipError_t select_bitmask(void*                       temporary_storage,
+                                 size_t&                     storage_size,
+                                 InputIterator               input,
+                                 BitmaskIterator             bitmask,
+                                 OutputIterator              output,
+                                 SelectedCountOutputIterator selected_count_output,
+                                 const size_t                size,
+                                 const hipStream_t           stream            = 0,
+                                 const bool                  debug_synchronous = false)
+{
+    using word_type = typename std::iterator_traits<BitmaskIterator>::value_type;
+    static_assert(detail::is_bitmask_word<word_type>::value,
+                  "The words of the bitmask must be 32-bit or 64-bit unsigned integers");
+
+    const auto flags
+        = ::rocprim::make_transform_iterator(::rocprim::counting_iterator<size_t>(0),
+                                             detail::bitmask_bit_op<BitmaskIterator>{bitmask});
+    return ::rocprim::select<Config>(temporary_storage,
+                                     storage_size,
+                                     input,
+                                     flags,
+                                     output,
+                                     selected_count_output,
+                                     size,
+                                     stream,
+                                     debug_synchronous);
+}
+
+/// \brief Packs the results of a predicate into a bitmask.
+///
+/// Sets the bit <tt>i % W</tt> of the word <tt>bitmask[i / W]</tt> to
+/// <tt>predicate(input[i])</tt>, where \p W is the number of bits of the words, so the bitmask
+/// can be passed to \p select_bitmask. Fewer flags are written than the full-width flags of
+/// \p select by a factor of 8 (for 1-byte flags) to 32 (for 4-byte flags).
+///
+/// \par Overview
+/// * The words are 32-bit or 64-bit unsigned integers, the bits of a word are the values in order
+/// from the least significant bit. The bits after \p size in the last word are 0.
+/// * Range specified by \p input must have at least \p size elements, while \p bitmask must have
+/// at least <tt>ceil(size / W)</tt> words.
+/// * The results of the warps are packed with ballots and written to \p bitmask as complete words.
+///
+/// \tparam InputIterator - random-access iterator type of the input range. It can be
+/// a simple pointer type.
+/// \tparam BitmaskIterator - random-access iterator type of the bitmask words, its
+/// \p value_type is the type of the words. It can be a simple pointer type.
+/// \tparam UnaryPredicate - type of the unary predicate.
+///
+/// \param [in] input - iterator to the first element in the range.
+/// \param [out] bitmask - iterator to the first word of the bitmask.
+/// \param [in] size - number of element in the input range.
+/// \param [in] predicate - unary function object which returns \p true if the bit of the element
+/// should be set. The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a);</tt>.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful packing; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class InputIterator, class BitmaskIterator, class UnaryPredicate>
+inline hipError_t predicate_to_bitmask(InputIterator     input,
+                                       BitmaskIterator   bitmask,
+                                       const size_t      size,
+                                       UnaryPredicate    predicate,
+                                       const hipStream_t stream            = 0,
+                                       const bool        debug_synchronous = false)
+{
+    using word_type = typename std::iterator_traits<BitmaskIterator>::value_type;
+    static_assert(detail::is_bitmask_word<word_type>::value,
+                  "The words of the bitmask must be 32-bit or 64-bit unsigned integers");
+
+    constexpr unsigned int block_size = detail::predicate_to_bitmask_block_size;
+    constexpr size_t       items_per_block
+        = block_size * detail::predicate_to_bitmask_items_per_thread;
+    constexpr size_t word_bits = sizeof(word_type) * 8;
+    // Launches of at most 2^30 blocks, the offsets of the launches are multiples of the words
+    constexpr size_t aligned_size_limit = items_per_block << 30;
+
+    // Start point for time measurements
+    std::chrono::high_resolution_clock::time_point start;
+
+    for(size_t offset = 0; offset < size; offset += aligned_size_limit)
+    {
+        const size_t current_size   = std::min(size - offset, aligned_size_limit);
+        const size_t current_blocks = detail::ceiling_div(current_size, items_per_block);
+
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("predicate_to_bitmask_kernel");
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(detail::predicate_to_bitmask_kernel<word_type>),
+            dim3(current_blocks), dim3(block_size), 0, stream,
+            input + offset, bitmask + offset / word_bits, current_size, predicate
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("predicate_to_bitmask_kernel",
+                                                    current_size,
+                                                    start);
+    }
+    return hipSuccess;
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_BITMASK_HPP_
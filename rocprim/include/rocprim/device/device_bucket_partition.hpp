@@ -0,0 +1,498 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_BUCKET_PARTITION_HPP_
+#define ROCPRIM_DEVICE_DEVICE_BUCKET_PARTITION_HPP_
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../functional.hpp"
+#include "../types.hpp"
+
+#include "config_types.hpp"
+#include "detail/device_bucket_partition.hpp"
+#include "device_bucket_partition_config.hpp"
+#include "device_scan.hpp"
+#include "instrumentation.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+template<class Config, class KeysInputIterator, class BucketOp>
+ROCPRIM_KERNEL __launch_bounds__(Config::block_size)
+void bucket_partition_histogram_kernel(KeysInputIterator        keys_input,
+                                       const size_t             size,
+                                       const size_t             tiles_per_block,
+                                       const unsigned int       num_buckets,
+                                       BucketOp                 bucket_op,
+                                       bucket_partition_offset* counts)
+{
+    bucket_partition_histogram_kernel_impl<Config>(keys_input,
+                                                   size,
+                                                   tiles_per_block,
+                                                   num_buckets,
+                                                   bucket_op,
+                                                   counts);
+}
+
+template<class Config,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class KeysOutputIterator,
+         class ValuesOutputIterator,
+         class BucketOffsetIterator,
+         class BucketOp>
+ROCPRIM_KERNEL __launch_bounds__(Config::block_size)
+void bucket_partition_scatter_kernel(KeysInputIterator        keys_input,
+                                     ValuesInputIterator      values_input,
+                                     KeysOutputIterator       keys_output,
+                                     ValuesOutputIterator     values_output,
+                                     const size_t             size,
+                                     const size_t             tiles_per_block,
+                                     const unsigned int       num_buckets,
+                                     const unsigned int       bucket_bits,
+                                     BucketOp                 bucket_op,
+                                     bucket_partition_offset* offsets,
+                                     BucketOffsetIterator     bucket_offsets)
+{
+    bucket_partition_scatter_kernel_impl<Config>(keys_input,
+                                                 values_input,
+                                                 keys_output,
+                                                 values_output,
+                                                 size,
+                                                 tiles_per_block,
+                                                 num_buckets,
+                                                 bucket_bits,
+                                                 bucket_op,
+                                                 offsets,
+                                                 bucket_offsets);
+}
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
+    { \
+        auto _error = hipGetLastError(); \
+        if(_error != hipSuccess) return _error; \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
+        if(debug_synchronous) \
+        { \
+            std::cout << name << "(" << size << ")"; \
+            auto __error = hipStreamSynchronize(stream); \
+            if(__error != hipSuccess) return __error; \
+            auto _end = std::chrono::high_resolution_clock::now(); \
+            auto _d = std::chrono::duration_cast<std::chrono::duration<double>>(_end - start); \
+            std::cout << " " << _d.count() * 1000 << " ms" << '\n'; \
+        } \
+    }
+
+// One histogram pass, one exclusive scan of the counts of every bucket in every block and one
+// scatter pass. The blocks of both passes partition the same contiguous ranges of tiles.
+template<class Config,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class KeysOutputIterator,
+         class ValuesOutputIterator,
+         class BucketOffsetIterator,
+         class BucketOp>
+inline hipError_t bucket_partition_impl(void*                temporary_storage,
+                                        size_t&              storage_size,
+                                        KeysInputIterator    keys_input,
+                                        ValuesInputIterator  values_input,
+                                        KeysOutputIterator   keys_output,
+                                        ValuesOutputIterator values_output,
+                                        BucketOffsetIterator bucket_offsets,
+                                        const size_t         size,
+                                        const unsigned int   num_buckets,
+                                        BucketOp             bucket_op,
+                                        const hipStream_t    stream,
+                                        bool                 debug_synchronous)
+{
+    using config = default_or_custom_config<Config, default_bucket_partition_config>;
+
+    constexpr unsigned int block_size      = config::block_size;
+    constexpr unsigned int items_per_block = block_size * config::items_per_thread;
+
+    if(num_buckets == 0)
+    {
+        return hipErrorInvalidValue;
+    }
+
+    // There is always one block, which stores the offsets of the buckets
+    const size_t number_of_tiles = ceiling_div(size, items_per_block);
+    size_t       max_grid_size   = ::rocprim::max<size_t>(number_of_tiles, 1);
+    hipError_t   result          = limit_grid_size(max_grid_size, config::blocks_per_cu);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const size_t tiles_per_block = ceiling_div(number_of_tiles, max_grid_size);
+    const unsigned int grid_size = static_cast<unsigned int>(
+        tiles_per_block == 0 ? 1 : ceiling_div(number_of_tiles, tiles_per_block));
+    const size_t counts_size = static_cast<size_t>(num_buckets) * grid_size;
+
+    // The bits of the bucket num_buckets, which marks the items past the size in the last tile
+    unsigned int bucket_bits = 0;
+    while(bucket_bits < 32 && (num_buckets >> bucket_bits) != 0)
+    {
+        bucket_bits++;
+    }
+
+    bucket_partition_offset* counts{};
+    bucket_partition_offset* offsets{};
+    void*                    scan_storage{};
+    size_t                   scan_storage_size = 0;
+
+    result = ::rocprim::exclusive_scan(nullptr,
+                                       scan_storage_size,
+                                       counts,
+                                       offsets,
+                                       bucket_partition_offset(0),
+                                       counts_size,
+                                       ::rocprim::plus<bucket_partition_offset>(),
+                                       stream);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&counts, counts_size),
+            detail::temp_storage::ptr_aligned_array(&offsets, counts_size),
+            detail::temp_storage::make_partition(&scan_storage, scan_storage_size)));
+    if(result != hipSuccess || temporary_storage == nullptr)
+    {
+        return result;
+    }
+
+    if(debug_synchronous)
+    {
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "grid_size " << grid_size << '\n';
+        std::cout << "tiles_per_block " << tiles_per_block << '\n';
+        std::cout << "bucket_bits " << bucket_bits << '\n';
+    }
+
+    result = hipMemsetAsync(counts, 0, counts_size * sizeof(*counts), stream);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    // Start point for time measurements
+    std::chrono::high_resolution_clock::time_point start;
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("bucket_partition_histogram_kernel");
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(bucket_partition_histogram_kernel<config>),
+        dim3(grid_size), dim3(block_size), 0, stream,
+        keys_input, size, tiles_per_block, num_buckets, bucket_op, counts
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("bucket_partition_histogram_kernel", size, start);
+
+    result = ::rocprim::exclusive_scan(scan_storage,
+                                       scan_storage_size,
+                                       counts,
+                                       offsets,
+                                       bucket_partition_offset(0),
+                                       counts_size,
+                                       ::rocprim::plus<bucket_partition_offset>(),
+                                       stream,
+                                       debug_synchronous);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("bucket_partition_scatter_kernel");
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(bucket_partition_scatter_kernel<config>),
+        dim3(grid_size), dim3(block_size), 0, stream,
+        keys_input, values_input, keys_output, values_output, size, tiles_per_block,
+        num_buckets, bucket_bits, bucket_op, offsets, bucket_offsets
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("bucket_partition_scatter_kernel", size, start);
+
+    return hipSuccess;
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
+} // end of detail namespace
+
+/// \brief Parallel stable partition of keys into buckets for device level.
+///
+/// bucket_partition_keys copies the keys to \p keys_output grouped by their buckets
+/// <tt>bucket_op(key)</tt>, bucket 0 first, and writes the offsets of the buckets to
+/// \p bucket_offsets. It is a stable counting sort by a small integer, with one histogram pass
+/// and one scatter pass over the input instead of the passes of a radix sort.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * The keys of every bucket keep their relative order, the keys of bucket \p b are
+/// <tt>keys_output[bucket_offsets[b], bucket_offsets[b + 1])</tt>.
+/// * \p bucket_offsets must have <tt>num_buckets + 1</tt> elements, the last one is \p size.
+/// * \p bucket_op must return a bucket in <tt>[0, num_buckets)</tt> for every key.
+/// * Every tile is ranked by a block radix sort of its buckets in shared memory, so the keys
+/// of a bucket are written to consecutive positions by consecutive threads.
+/// * The temporary storage has two offsets for every pair of a bucket and a block of a grid of
+/// \p Config::blocks_per_cu blocks per compute unit.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// \p bucket_partition_config or a custom class with the same members.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam BucketOffsetIterator - random-access iterator type of the offsets of the buckets.
+/// Its value type must be able to hold \p size.
+/// \tparam BucketOp - type of the function returning the bucket of a key, the default is
+/// \p identity, which partitions keys that are buckets themselves.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the partition.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - iterator to the first key of the input range.
+/// \param [out] keys_output - iterator to the first key of the output range.
+/// \param [out] bucket_offsets - iterator to the first of the <tt>num_buckets + 1</tt> offsets.
+/// \param [in] size - number of keys.
+/// \param [in] num_buckets - number of buckets, it must be greater than 0.
+/// \param [in] bucket_op - [optional] function object returning the bucket of a key. The
+/// signature of the function should be equivalent to the following:
+/// <tt>unsigned int f(const Key &key);</tt>.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful partition; \p hipErrorInvalidValue if
+/// \p num_buckets is 0; otherwise a HIP runtime error of type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t size;                  // e.g., 8
+/// unsigned int num_buckets;     // e.g., 3
+/// unsigned int * keys_input;    // e.g., [2, 0, 1, 2, 0, 0, 1, 2]
+/// unsigned int * keys_output;   // empty array of 8 elements
+/// size_t * bucket_offsets;      // empty array of 4 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::bucket_partition_keys(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input, keys_output, bucket_offsets, size, num_buckets
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform partition
+/// rocprim::bucket_partition_keys(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input, keys_output, bucket_offsets, size, num_buckets
+/// );
+/// // keys_output:    [0, 0, 0, 1, 1, 2, 2, 2]
+/// // bucket_offsets: [0, 3, 5, 8]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class BucketOffsetIterator,
+         class BucketOp
+         = ::rocprim::identity<typename std::iterator_traits<KeysInputIterator>::value_type>>
+inline hipError_t bucket_partition_keys(void*                temporary_storage,
+                                        size_t&              storage_size,
+                                        KeysInputIterator    keys_input,
+                                        KeysOutputIterator   keys_output,
+                                        BucketOffsetIterator bucket_offsets,
+                                        const size_t         size,
+                                        const unsigned int   num_buckets,
+                                        BucketOp             bucket_op         = BucketOp(),
+                                        const hipStream_t    stream            = 0,
+                                        bool                 debug_synchronous = false)
+{
+    ::rocprim::empty_type* values = nullptr;
+    return detail::bucket_partition_impl<Config>(temporary_storage,
+                                                 storage_size,
+                                                 keys_input,
+                                                 values,
+                                                 keys_output,
+                                                 values,
+                                                 bucket_offsets,
+                                                 size,
+                                                 num_buckets,
+                                                 bucket_op,
+                                                 stream,
+                                                 debug_synchronous);
+}
+
+/// \brief Parallel stable partition of key-value pairs into buckets for device level.
+///
+/// bucket_partition_pairs copies the keys and the values to \p keys_output and
+/// \p values_output grouped by the buckets <tt>bucket_op(key)</tt> of the keys, bucket 0 first,
+/// and writes the offsets of the buckets to \p bucket_offsets.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * The pairs of every bucket keep their relative order, the pairs of bucket \p b are at
+/// <tt>[bucket_offsets[b], bucket_offsets[b + 1])</tt>.
+/// * \p bucket_offsets must have <tt>num_buckets + 1</tt> elements, the last one is \p size.
+/// * \p bucket_op must return a bucket in <tt>[0, num_buckets)</tt> for every key.
+/// * See \p bucket_partition_keys for the passes and the temporary storage.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// \p bucket_partition_config or a custom class with the same members.
+/// \tparam KeysInputIterator - random-access iterator type of the input keys. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output keys. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator - random-access iterator type of the input values. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesOutputIterator - random-access iterator type of the output values. Must meet
+/// the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam BucketOffsetIterator - random-access iterator type of the offsets of the buckets.
+/// Its value type must be able to hold \p size.
+/// \tparam BucketOp - type of the function returning the bucket of a key, the default is
+/// \p identity, which partitions keys that are buckets themselves.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the partition.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - iterator to the first key of the input range.
+/// \param [out] keys_output - iterator to the first key of the output range.
+/// \param [in] values_input - iterator to the first value of the input range.
+/// \param [out] values_output - iterator to the first value of the output range.
+/// \param [out] bucket_offsets - iterator to the first of the <tt>num_buckets + 1</tt> offsets.
+/// \param [in] size - number of pairs.
+/// \param [in] num_buckets - number of buckets, it must be greater than 0.
+/// \param [in] bucket_op - [optional] function object returning the bucket of a key. The
+/// signature of the function should be equivalent to the following:
+/// <tt>unsigned int f(const Key &key);</tt>.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful partition; \p hipErrorInvalidValue if
+/// \p num_buckets is 0; otherwise a HIP runtime error of type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example rows are partitioned by a partition id computed from their keys.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t size;                  // e.g., 6
+/// unsigned int num_buckets;     // e.g., 4
+/// int * keys_input;             // e.g., [5, 8, 2, 7, 4, 1]
+/// int * keys_output;            // empty array of 6 elements
+/// float * values_input;         // e.g., [0.5, 0.8, 0.2, 0.7, 0.4, 0.1]
+/// float * values_output;        // empty array of 6 elements
+/// size_t * bucket_offsets;      // empty array of 5 elements
+///
+/// auto bucket_op = [] __device__ (int key) -> unsigned int { return key % 4; };
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::bucket_partition_pairs(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input, keys_output, values_input, values_output, bucket_offsets,
+///     size, num_buckets, bucket_op
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform partition
+/// rocprim::bucket_partition_pairs(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input, keys_output, values_input, values_output, bucket_offsets,
+///     size, num_buckets, bucket_op
+/// );
+/// // keys_output:    [8, 4, 5, 1, 2, 7]
+/// // values_output:  [0.8, 0.4, 0.5, 0.1, 0.2, 0.7]
+/// // bucket_offsets: [0, 2, 4, 5, 6]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class BucketOffsetIterator,
+         class BucketOp
+         = ::rocprim::identity<typename std::iterator_traits<KeysInputIterator>::value_type>>
+inline hipError_t bucket_partition_pairs(void*                temporary_storage,
+                                         size_t&              storage_size,
+                                         KeysInputIterator    keys_input,
+                                         KeysOutputIterator   keys_output,
+                                         ValuesInputIterator  values_input,
+                                         ValuesOutputIterator values_output,
+                                         BucketOffsetIterator bucket_offsets,
+                                         const size_t         size,
+                                         const unsigned int   num_buckets,
+                                         BucketOp             bucket_op         = BucketOp(),
+                                         const hipStream_t    stream            = 0,
+                                         bool                 debug_synchronous = false)
+{
+    return detail::bucket_partition_impl<Config>(temporary_storage,
+                                                 storage_size,
+                                                 keys_input,
+                                                 values_input,
+                                                 keys_output,
+                                                 values_output,
+                                                 bucket_offsets,
+                                                 size,
+                                                 num_buckets,
+                                                 bucket_op,
+                                                 stream,
+                                                 debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_BUCKET_PARTITION_HPP_
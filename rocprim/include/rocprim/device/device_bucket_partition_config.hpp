@@ -0,0 +1,72 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_BUCKET_PARTITION_CONFIG_HPP_
+#define ROCPRIM_DEVICE_DEVICE_BUCKET_PARTITION_CONFIG_HPP_
+
+#include "../config.hpp"
+
+#include "config_types.hpp"
+
+/// \addtogroup primitivesmodule_deviceconfigs
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief Configuration of device-level bucket partition.
+///
+/// \tparam BlockSize - number of threads in a block.
+/// \tparam ItemsPerThread - number of items processed by each thread.
+/// \tparam SharedBuckets - the histograms of at most \p SharedBuckets buckets are counted in
+/// shared memory, histograms of more buckets are counted with global atomics.
+/// \tparam BlocksPerCU - the grid is limited to \p BlocksPerCU blocks per compute unit, every
+/// block partitions a contiguous range of tiles. The temporary storage has an offset for every
+/// pair of a bucket and a block.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         unsigned int SharedBuckets = 4096,
+         unsigned int BlocksPerCU   = 2>
+struct bucket_partition_config
+{
+    static_assert(BlocksPerCU > 0, "BlocksPerCU must be greater than 0");
+
+    /// \brief Number of threads in a block.
+    static constexpr unsigned int block_size = BlockSize;
+    /// \brief Number of items processed by each thread.
+    static constexpr unsigned int items_per_thread = ItemsPerThread;
+    /// \brief Largest number of buckets counted in shared memory.
+    static constexpr unsigned int shared_buckets = SharedBuckets;
+    /// \brief Number of blocks per compute unit of the grid.
+    static constexpr unsigned int blocks_per_cu = BlocksPerCU;
+};
+
+namespace detail
+{
+
+using default_bucket_partition_config = bucket_partition_config<256, 8>;
+
+} // end namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group primitivesmodule_deviceconfigs
+
+#endif // ROCPRIM_DEVICE_DEVICE_BUCKET_PARTITION_CONFIG_HPP_
@@ -0,0 +1,564 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_FIND_HPP_
+#define ROCPRIM_DEVICE_DEVICE_FIND_HPP_
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../functional.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../iterator/transform_iterator.hpp"
+#include "../iterator/zip_iterator.hpp"
+
+#include "config_types.hpp"
+#include "detail/device_find.hpp"
+#include "device_reduce_config.hpp"
+#include "instrumentation.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+template<class Config, class FlagIterator>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().block_size)
+void find_kernel(FlagIterator        flags_input,
+                 const size_t        size,
+                 const size_t        starting_offset,
+                 unsigned long long* first_found)
+{
+    find_kernel_impl<Config>(flags_input, size, starting_offset, first_found);
+}
+
+template<find_result Result, class OutputIterator>
+ROCPRIM_KERNEL __launch_bounds__(1)
+void find_store_kernel(OutputIterator                  output,
+                       const size_t                    size,
+                       const unsigned long long* const first_found)
+{
+    find_store<Result>(output, size, first_found);
+}
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
+    { \
+        auto _error = hipGetLastError(); \
+        if(_error != hipSuccess) return _error; \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
+        if(debug_synchronous) \
+        { \
+            std::cout << name << "(" << size << ")"; \
+            auto __error = hipStreamSynchronize(stream); \
+            if(__error != hipSuccess) return __error; \
+            auto _end = std::chrono::high_resolution_clock::now(); \
+            auto _d = std::chrono::duration_cast<std::chrono::duration<double>>(_end - start); \
+            std::cout << " " << _d.count() * 1000 << " ms" << '\n'; \
+        } \
+    }
+
+// The flags are computed by the predicate while they are loaded. The blocks are launched in the
+// order of the tiles and the launches are issued in order, so the tiles after a found item are
+// mostly skipped without loading them, and the atomic minimum makes the result the lowest index
+// regardless of the order the blocks finish in. The result is stored by the device without
+// synchronizing with the host.
+template<find_result Result,
+         class Config,
+         class ValueType,
+         class FlagIterator,
+         class OutputIterator>
+inline hipError_t find_impl(void*             temporary_storage,
+                            size_t&           storage_size,
+                            FlagIterator      flags_input,
+                            OutputIterator    output,
+                            const size_t      size,
+                            const hipStream_t stream,
+                            bool              debug_synchronous)
+{
+    using config = wrapped_reduce_config<Config, ValueType>;
+
+    detail::target_arch target_arch;
+    hipError_t          result = host_target_arch(stream, target_arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const reduce_config_params params = dispatch_target_arch<config>(target_arch);
+
+    const unsigned int block_size       = params.block_size;
+    const unsigned int items_per_thread = params.items_per_thread;
+    const auto         items_per_block  = block_size * items_per_thread;
+
+    unsigned long long* first_found;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&first_found, 1)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    // Start point for time measurements
+    std::chrono::high_resolution_clock::time_point start;
+
+    const size_t number_of_blocks = ceiling_div(size, items_per_block);
+    const size_t number_of_blocks_limit
+        = ::rocprim::max<size_t>(params.size_limit / items_per_block, 1);
+    const size_t aligned_size_limit = number_of_blocks_limit * items_per_block;
+
+    if(debug_synchronous)
+    {
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << number_of_blocks << '\n';
+        std::cout << "number of blocks limit " << number_of_blocks_limit << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+    }
+
+    // All bits set is find_none
+    result = hipMemsetAsync(first_found, 0xFF, sizeof(*first_found), stream);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    for(size_t offset = 0; offset < size; offset += aligned_size_limit)
+    {
+        const size_t current_size   = std::min<size_t>(size - offset, aligned_size_limit);
+        const size_t current_blocks = ceiling_div(current_size, items_per_block);
+
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("find_kernel");
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(find_kernel<config>),
+            dim3(current_blocks), dim3(block_size), 0, stream,
+            flags_input, size, offset, first_found
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("find_kernel", current_size, start);
+    }
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("find_store_kernel");
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(find_store_kernel<Result>),
+        dim3(1), dim3(1), 0, stream,
+        output, size, first_found
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("find_store_kernel", 1, start);
+
+    return hipSuccess;
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
+} // end of detail namespace
+
+/// \brief Parallel primitive for device level finding the first item satisfying a predicate.
+///
+/// find_if writes to \p output the index of the first item \p i for which
+/// <tt>predicate(input[i])</tt> is \p true, or \p size if there is none.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input must have at least \p size elements, while \p output
+/// only needs one element.
+/// * The search stops early: a block skips its tile without loading it when an item satisfying
+/// the predicate has already been found before the tile.
+/// * The result is written to device memory, the function does not synchronize with the host.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p reduce_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type. Its value
+/// type must be able to represent \p size.
+/// \tparam UnaryPredicate - type of unary function used to test the items.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the search.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to search.
+/// \param [out] output - iterator to the element receiving the index of the first item satisfying
+/// the predicate.
+/// \param [in] size - number of element in the input range.
+/// \param [in] predicate - unary function object that returns \p true for the items that are
+/// looked for. The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful search; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;    // e.g., 8
+/// int * input;          // e.g., [1, 2, 3, 4, -5, 6, -7, 8]
+/// size_t * output;      // empty array of 1 element
+///
+/// auto is_negative = [] __device__ (int a) { return a < 0; };
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::find_if(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size, is_negative
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform the search
+/// rocprim::find_if(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size, is_negative
+/// );
+/// // output: [4]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class UnaryPredicate>
+inline hipError_t find_if(void*             temporary_storage,
+                          size_t&           storage_size,
+                          InputIterator     input,
+                          OutputIterator    output,
+                          const size_t      size,
+                          UnaryPredicate    predicate,
+                          const hipStream_t stream            = 0,
+                          bool              debug_synchronous = false)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    return detail::find_impl<detail::find_result::index, Config, input_type>(
+        temporary_storage,
+        storage_size,
+        ::rocprim::make_transform_iterator(detail::to_kernel_input_iterator(input),
+                                           predicate),
+        output,
+        size,
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Parallel primitive for device level checking whether any item satisfies a predicate.
+///
+/// any_of writes to \p output \p true if <tt>predicate(input[i])</tt> is \p true for any item
+/// \p i, \p false otherwise. An empty range has no such item.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input must have at least \p size elements, while \p output
+/// only needs one element.
+/// * The search stops early: a block skips its tile without loading it when an item satisfying
+/// the predicate has already been found before the tile.
+/// * The result is written to device memory, the function does not synchronize with the host.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p reduce_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type. Its value
+/// type must be assignable from \p bool.
+/// \tparam UnaryPredicate - type of unary function used to test the items.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the search.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to search.
+/// \param [out] output - iterator to the element receiving \p true if an item satisfies the
+/// predicate, \p false otherwise.
+/// \param [in] size - number of element in the input range.
+/// \param [in] predicate - unary function object that returns \p true for the items that are
+/// looked for. The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful search; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class UnaryPredicate>
+inline hipError_t any_of(void*             temporary_storage,
+                         size_t&           storage_size,
+                         InputIterator     input,
+                         OutputIterator    output,
+                         const size_t      size,
+                         UnaryPredicate    predicate,
+                         const hipStream_t stream            = 0,
+                         bool              debug_synchronous = false)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    return detail::find_impl<detail::find_result::found, Config, input_type>(
+        temporary_storage,
+        storage_size,
+        ::rocprim::make_transform_iterator(detail::to_kernel_input_iterator(input),
+                                           predicate),
+        output,
+        size,
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Parallel primitive for device level checking whether all items satisfy a predicate.
+///
+/// all_of writes to \p output \p true if <tt>predicate(input[i])</tt> is \p true for every item
+/// \p i, \p false otherwise. All items of an empty range satisfy the predicate. The search stops
+/// at the first item not satisfying the predicate.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input must have at least \p size elements, while \p output
+/// only needs one element.
+/// * The search stops early: a block skips its tile without loading it when an item satisfying
+/// the predicate has already been found before the tile.
+/// * The result is written to device memory, the function does not synchronize with the host.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p reduce_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type. Its value
+/// type must be assignable from \p bool.
+/// \tparam UnaryPredicate - type of unary function used to test the items.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the search.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to search.
+/// \param [out] output - iterator to the element receiving \p true if all items satisfy the
+/// predicate, \p false otherwise.
+/// \param [in] size - number of element in the input range.
+/// \param [in] predicate - unary function object that returns \p true for the items that are
+/// looked for. The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful search; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class UnaryPredicate>
+inline hipError_t all_of(void*             temporary_storage,
+                         size_t&           storage_size,
+                         InputIterator     input,
+                         OutputIterator    output,
+                         const size_t      size,
+                         UnaryPredicate    predicate,
+                         const hipStream_t stream            = 0,
+                         bool              debug_synchronous = false)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    return detail::find_impl<detail::find_result::not_found, Config, input_type>(
+        temporary_storage,
+        storage_size,
+        ::rocprim::make_transform_iterator(detail::to_kernel_input_iterator(input),
+                                           detail::find_not_op<UnaryPredicate>{predicate}),
+        output,
+        size,
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Parallel primitive for device level checking whether no item satisfies a predicate.
+///
+/// none_of writes to \p output \p true if <tt>predicate(input[i])</tt> is \p false for every
+/// item \p i, \p false otherwise. An empty range has no such item.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input must have at least \p size elements, while \p output
+/// only needs one element.
+/// * The search stops early: a block skips its tile without loading it when an item satisfying
+/// the predicate has already been found before the tile.
+/// * The result is written to device memory, the function does not synchronize with the host.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p reduce_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type. Its value
+/// type must be assignable from \p bool.
+/// \tparam UnaryPredicate - type of unary function used to test the items.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the search.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to search.
+/// \param [out] output - iterator to the element receiving \p true if no item satisfies the
+/// predicate, \p false otherwise.
+/// \param [in] size - number of element in the input range.
+/// \param [in] predicate - unary function object that returns \p true for the items that are
+/// looked for. The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful search; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class UnaryPredicate>
+inline hipError_t none_of(void*             temporary_storage,
+                          size_t&           storage_size,
+                          InputIterator     input,
+                          OutputIterator    output,
+                          const size_t      size,
+                          UnaryPredicate    predicate,
+                          const hipStream_t stream            = 0,
+                          bool              debug_synchronous = false)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    return detail::find_impl<detail::find_result::not_found, Config, input_type>(
+        temporary_storage,
+        storage_size,
+        ::rocprim::make_transform_iterator(detail::to_kernel_input_iterator(input),
+                                           predicate),
+        output,
+        size,
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Parallel primitive for device level finding the first position where two ranges differ.
+///
+/// mismatch writes to \p output the index of the first item \p i for which
+/// <tt>equal_op(input1[i], input2[i])</tt> is \p false, or \p size if the ranges are equal.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input1 and \p input2 must have at least \p size elements, while
+/// \p output only needs one element.
+/// * The search stops early: a block skips its tile without loading it when a mismatch has
+/// already been found before the tile.
+/// * The result is written to device memory, the function does not synchronize with the host.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p reduce_config or
+/// a custom class with the same members.
+/// \tparam InputIterator1 - random-access iterator type of the first input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam InputIterator2 - random-access iterator type of the second input range. Must meet
+/// the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type. Its value
+/// type must be able to represent \p size.
+/// \tparam BinaryPredicate - type of binary function used to compare the items for equality.
+/// Default type is \p rocprim::equal_to<>.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the search.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input1 - iterator to the first element in the first range to compare.
+/// \param [in] input2 - iterator to the first element in the second range to compare.
+/// \param [out] output - iterator to the element receiving the index of the first mismatch.
+/// \param [in] size - number of element in the input ranges.
+/// \param [in] equal_op - binary function object that returns \p true for equal items.
+/// The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T1 &a, const T2 &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// Default is BinaryPredicate().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful search; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class InputIterator1,
+         class InputIterator2,
+         class OutputIterator,
+         class BinaryPredicate = ::rocprim::equal_to<>>
+inline hipError_t mismatch(void*             temporary_storage,
+                           size_t&           storage_size,
+                           InputIterator1    input1,
+                           InputIterator2    input2,
+                           OutputIterator    output,
+                           const size_t      size,
+                           BinaryPredicate   equal_op          = BinaryPredicate(),
+                           const hipStream_t stream            = 0,
+                           bool              debug_synchronous = false)
+{
+    using input_type = typename std::iterator_traits<InputIterator1>::value_type;
+
+    return detail::find_impl<detail::find_result::index, Config, input_type>(
+        temporary_storage,
+        storage_size,
+        ::rocprim::make_transform_iterator(
+            ::rocprim::make_zip_iterator(
+                ::rocprim::make_tuple(detail::to_kernel_input_iterator(input1),
+                                      detail::to_kernel_input_iterator(input2))),
+            detail::find_mismatch_op<BinaryPredicate>{equal_op}),
+        output,
+        size,
+        stream,
+        debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_FIND_HPP_
@@ -0,0 +1,274 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_FOR_EACH_HPP_
+#define ROCPRIM_DEVICE_DEVICE_FOR_EACH_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/various.hpp"
+#include "../iterator/detail/cache_modified_iterator.hpp"
+
+#include "config_types.hpp"
+#include "detail/device_for_each.hpp"
+#include "device_transform_config.hpp"
+#include "instrumentation.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class InputIterator,
+         class UnaryFunction>
+ROCPRIM_KERNEL
+__launch_bounds__(BlockSize)
+void for_each_kernel(InputIterator input, const size_t size, UnaryFunction function)
+{
+    for_each_kernel_impl<BlockSize, ItemsPerThread>(input, size, function);
+}
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
+    { \
+        auto _error = hipGetLastError(); \
+        if(_error != hipSuccess) return _error; \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
+        if(debug_synchronous) \
+        { \
+            std::cout << name << "(" << size << ")"; \
+            _error = hipStreamSynchronize(stream); \
+            if(_error != hipSuccess) return _error; \
+            auto _end = std::chrono::high_resolution_clock::now(); \
+            auto _d = std::chrono::duration_cast<std::chrono::duration<double>>(_end - start); \
+            std::cout << " " << _d.count() * 1000 << " ms" << '\n'; \
+        } \
+    }
+
+// Launches like transform: the unaligned head is processed by a separate launch, the rest by
+// launches of at most size_limit items with grids limited by blocks_per_cu
+template<class Config, class InputIterator, class UnaryFunction>
+inline hipError_t for_each_n_impl(InputIterator     input,
+                                  const size_t      size,
+                                  UnaryFunction     function,
+                                  const hipStream_t stream,
+                                  bool              debug_synchronous)
+{
+    if(size == size_t(0))
+        return hipSuccess;
+
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    // Get default config if Config is default_config
+    using config = default_or_custom_config<
+        Config,
+        default_transform_config<ROCPRIM_TARGET_ARCH, input_type>
+    >;
+
+    static constexpr unsigned int block_size = config::block_size;
+    static constexpr unsigned int items_per_thread = config::items_per_thread;
+    static constexpr auto items_per_block = block_size * items_per_thread;
+
+    // Start point for time measurements
+    std::chrono::high_resolution_clock::time_point start;
+
+    static constexpr auto size_limit = config::size_limit;
+    static constexpr auto number_of_blocks_limit
+        = ::rocprim::max<size_t>(size_limit / items_per_block, 1);
+    static constexpr auto aligned_size_limit = number_of_blocks_limit * items_per_block;
+
+    auto number_of_blocks = (size + items_per_block - 1) / items_per_block;
+    if(debug_synchronous)
+    {
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << number_of_blocks << '\n';
+        std::cout << "number of blocks limit " << number_of_blocks_limit << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+    }
+
+    // Items before the first item aligned for vector accesses are processed by a separate
+    // launch, so all following blocks are aligned
+    const size_t head = transform_unaligned_head<items_per_thread>(input, input, size);
+
+    const auto cached_input = make_cache_modified_input_iterator<
+        config_load_cache_modifier<config>::value>(input);
+    using cached_input_type = typename std::remove_const<decltype(cached_input)>::type;
+
+    if(head > 0)
+    {
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("for_each_kernel");
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(for_each_kernel<
+                block_size, items_per_thread, cached_input_type, UnaryFunction
+            >),
+            dim3(1), dim3(block_size), 0, stream,
+            cached_input, head, function
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("for_each_kernel", head, start);
+    }
+
+    size_t max_grid_size = number_of_blocks_limit;
+    const hipError_t grid_result
+        = limit_grid_size(max_grid_size, config_blocks_per_cu<config>::value);
+    if(grid_result != hipSuccess)
+    {
+        return grid_result;
+    }
+
+    const auto number_of_launch = (size - head + aligned_size_limit - 1) / aligned_size_limit;
+    for(size_t i = 0, offset = head; i < number_of_launch; ++i, offset += aligned_size_limit)
+    {
+        const auto current_size = std::min(size - offset, aligned_size_limit);
+        const auto current_blocks
+            = std::min((current_size + items_per_block - 1) / items_per_block, max_grid_size);
+
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("for_each_kernel");
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(for_each_kernel<
+                block_size, items_per_thread, cached_input_type, UnaryFunction
+            >),
+            dim3(current_blocks), dim3(block_size), 0, stream,
+            cached_input + offset, current_size, function
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("for_each_kernel", current_size, start);
+    }
+
+    return hipSuccess;
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
+} // end of detail namespace
+
+/// \brief Parallel for_each_n primitive for device level.
+///
+/// for_each_n applies \p function to each of the first \p size elements of \p input, for
+/// elementwise loops with side effects that do not fit \p transform, for example loops with
+/// several writes or atomic operations.
+///
+/// \par Overview
+/// * The range specified by \p input must have at least \p size elements.
+/// * The elements are loaded like the input of \p transform and \p function is called with the
+/// loaded values: full blocks of aligned pointers are loaded with 16-byte vector loads, and
+/// the configuration (block size, items per thread, cache modifiers and \p blocks_per_cu) is
+/// the one of \p transform.
+/// * \p function cannot modify the elements through its argument, the results must be written
+/// through the pointers it captures. The order of the calls is not specified.
+/// * A \p counting_iterator as \p input makes an index loop over <tt>[0, size)</tt>.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p transform_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam UnaryFunction - type of unary function applied to the elements.
+///
+/// \param [in] input - iterator to the first element in the range.
+/// \param [in] size - number of elements to apply \p function to.
+/// \param [in] function - unary function object applied to the elements. The signature of the
+/// function should be equivalent to the following: <tt>void f(const T &a);</tt>. The signature
+/// does not need to have <tt>const &</tt>, the result of the function is ignored.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful launches; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example a histogram of 4 bins is built with atomic operations.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;    // e.g., 8
+/// int * input;          // e.g., [0, 1, 1, 3, 2, 1, 0, 3]
+/// unsigned int * bins;  // e.g., [0, 0, 0, 0]
+///
+/// // count the values
+/// rocprim::for_each_n(
+///     input, input_size,
+///     [bins] __device__ (int a) { atomicAdd(bins + a, 1u); }
+/// );
+/// // bins: [2, 3, 1, 2]
+/// \endcode
+/// \endparblock
+template<class Config = default_config, class InputIterator, class UnaryFunction>
+inline hipError_t for_each_n(InputIterator     input,
+                             const size_t      size,
+                             UnaryFunction     function,
+                             const hipStream_t stream            = 0,
+                             bool              debug_synchronous = false)
+{
+    return detail::for_each_n_impl<Config>(input, size, function, stream, debug_synchronous);
+}
+
+/// \brief Parallel for_each primitive for device level.
+///
+/// for_each applies \p function to each element of <tt>[first, last)</tt>, it is
+/// <tt>for_each_n(first, last - first, function)</tt>.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p transform_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam UnaryFunction - type of unary function applied to the elements.
+///
+/// \param [in] first - iterator to the first element in the range.
+/// \param [in] last - iterator past the last element in the range.
+/// \param [in] function - unary function object applied to the elements, see \p for_each_n.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful launches; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config, class InputIterator, class UnaryFunction>
+inline hipError_t for_each(InputIterator     first,
+                           InputIterator     last,
+                           UnaryFunction     function,
+                           const hipStream_t stream            = 0,
+                           bool              debug_synchronous = false)
+{
+    return detail::for_each_n_impl<Config>(first,
+                                           static_cast<size_t>(std::distance(first, last)),
+                                           function,
+                                           stream,
+                                           debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_FOR_EACH_HPP_
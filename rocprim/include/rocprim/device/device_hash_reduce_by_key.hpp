@@ -0,0 +1,907 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_HASH_REDUCE_BY_KEY_HPP_
+#define ROCPRIM_DEVICE_DEVICE_HASH_REDUCE_BY_KEY_HPP_
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../functional.hpp"
+#include "../iterator/constant_iterator.hpp"
+#include "../iterator/transform_iterator.hpp"
+
+#include "config_types.hpp"
+#include "detail/device_hash_reduce_by_key.hpp"
+#include "detail/device_reduce_by_key.hpp"
+#include "device_radix_sort.hpp"
+#include "device_reduce_by_key.hpp"
+#include "device_scan.hpp"
+#include "device_transform.hpp"
+#include "instrumentation.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+/// \brief Configuration of \p hash_reduce_by_key. Every block aggregates
+/// <tt>BlockSize * ItemsPerThread</tt> items in a table of as many entries in shared memory.
+template<unsigned int BlockSize, unsigned int ItemsPerThread>
+using hash_reduce_by_key_config = kernel_config<BlockSize, ItemsPerThread>;
+
+/// \brief The default hash function of \p hash_reduce_by_key.
+///
+/// It hashes the object representation of the key, so keys are equal for it if and only if
+/// their bytes are equal. Keys with padding bytes or with equal values of different
+/// representations, like \p -0.0 and \p +0.0, need a custom hash function.
+template<class Key>
+struct default_key_hash
+{
+    /// \brief Returns the hash of \p key.
+    ROCPRIM_HOST_DEVICE inline unsigned int operator()(const Key& key) const
+    {
+        constexpr unsigned int words = (sizeof(Key) + sizeof(unsigned int) - 1)
+                                       / sizeof(unsigned int);
+        unsigned int data[words] = {};
+        __builtin_memcpy(data, &key, sizeof(Key));
+        unsigned int hash = 0x9747B28Cu;
+        for(unsigned int i = 0; i < words; ++i)
+        {
+            hash ^= mix(data[i]);
+            hash = hash * 0x01000193u;
+        }
+        return mix(hash);
+    }
+
+private:
+    // The finalizer of MurmurHash3
+    ROCPRIM_HOST_DEVICE static inline unsigned int mix(unsigned int value)
+    {
+        value ^= value >> 16;
+        value *= 0x85EBCA6Bu;
+        value ^= value >> 13;
+        value *= 0xC2B2AE35u;
+        value ^= value >> 16;
+        return value;
+    }
+};
+
+namespace detail
+{
+
+template<class Config,
+         class KeysInputIterator,
+         class KeyCompareFunction,
+         class KeyHash>
+ROCPRIM_KERNEL __launch_bounds__(Config::block_size) void hash_reduce_by_key_insert_kernel(
+    KeysInputIterator  keys_input,
+    const unsigned int size,
+    unsigned int*      slots,
+    const unsigned int capacity,
+    const unsigned int max_unique_keys,
+    unsigned int*      item_slots,
+    unsigned int*      claimed_count,
+    unsigned int*      overflow,
+    KeyCompareFunction key_compare_op,
+    KeyHash            key_hash)
+{
+    hash_reduce_by_key::insert_kernel_impl<Config::block_size, Config::items_per_thread>(
+        keys_input,
+        size,
+        slots,
+        capacity,
+        max_unique_keys,
+        item_slots,
+        claimed_count,
+        overflow,
+        key_compare_op,
+        key_hash);
+}
+
+template<class Accumulator, class ValuesInputIterator>
+ROCPRIM_KERNEL void hash_reduce_by_key_init_kernel(
+    ValuesInputIterator                            values_input,
+    const unsigned int*                            slots,
+    const unsigned int                             capacity,
+    hash_reduce_by_key::word_type_t<Accumulator>* accumulators)
+{
+    hash_reduce_by_key::init_accumulators<ValuesInputIterator, Accumulator>(values_input,
+                                                                            slots,
+                                                                            capacity,
+                                                                            accumulators);
+}
+
+template<class Config, class Accumulator, class ValuesInputIterator, class BinaryFunction>
+ROCPRIM_KERNEL __launch_bounds__(Config::block_size) void hash_reduce_by_key_aggregate_kernel(
+    ValuesInputIterator                            values_input,
+    const unsigned int                             size,
+    const unsigned int*                            slots,
+    const unsigned int*                            item_slots,
+    hash_reduce_by_key::word_type_t<Accumulator>* accumulators,
+    BinaryFunction                                 reduce_op)
+{
+    hash_reduce_by_key::
+        aggregate_kernel_impl<Config::block_size, Config::items_per_thread, Accumulator>(
+            values_input,
+            size,
+            slots,
+            item_slots,
+            accumulators,
+            reduce_op);
+}
+
+template<class Accumulator,
+         class KeysInputIterator,
+         class UniqueOutputIterator,
+         class AggregatesOutputIterator,
+         class UniqueCountOutputIterator>
+ROCPRIM_KERNEL void hash_reduce_by_key_scatter_kernel(
+    KeysInputIterator                                    keys_input,
+    const unsigned int*                                  slots,
+    const unsigned int                                   capacity,
+    const hash_reduce_by_key::word_type_t<Accumulator>* accumulators,
+    const unsigned int*                                  group_ids,
+    UniqueOutputIterator                                 unique_output,
+    AggregatesOutputIterator                             aggregates_output,
+    UniqueCountOutputIterator                            unique_count_output)
+{
+    hash_reduce_by_key::scatter_groups<KeysInputIterator,
+                                       UniqueOutputIterator,
+                                       AggregatesOutputIterator,
+                                       UniqueCountOutputIterator,
+                                       Accumulator>(keys_input,
+                                                    slots,
+                                                    capacity,
+                                                    accumulators,
+                                                    group_ids,
+                                                    unique_output,
+                                                    aggregates_output,
+                                                    unique_count_output);
+}
+
+namespace hash_reduce_by_key
+{
+
+// Flags the claimed slots for the scan of the group ids
+struct is_claimed_op
+{
+    ROCPRIM_HOST_DEVICE inline unsigned int operator()(const unsigned int owner) const
+    {
+        return owner != empty_slot ? 1 : 0;
+    }
+};
+
+// The sort-based path: the pairs are sorted by key and reduced by reduce_by_key. It is used
+// when the table overflows and for inputs that the table does not support.
+template<class KeysInputIterator,
+         class ValuesInputIterator,
+         class UniqueOutputIterator,
+         class AggregatesOutputIterator,
+         class UniqueCountOutputIterator,
+         class BinaryFunction,
+         class KeyCompareFunction>
+struct sort_path
+{
+    using key_type   = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+
+    key_type*   sorted_keys;
+    value_type* sorted_values;
+    void*       sort_storage;
+    size_t      sort_storage_size;
+    void*       reduce_storage;
+    size_t      reduce_storage_size;
+
+    hipError_t query(KeysInputIterator         keys_input,
+                     ValuesInputIterator       values_input,
+                     const size_t              size,
+                     UniqueOutputIterator      unique_output,
+                     AggregatesOutputIterator  aggregates_output,
+                     UniqueCountOutputIterator unique_count_output,
+                     BinaryFunction            reduce_op,
+                     KeyCompareFunction        key_compare_op,
+                     const hipStream_t         stream)
+    {
+        hipError_t result = ::rocprim::radix_sort_pairs(nullptr,
+                                                        sort_storage_size,
+                                                        keys_input,
+                                                        sorted_keys,
+                                                        values_input,
+                                                        sorted_values,
+                                                        size,
+                                                        0,
+                                                        8 * sizeof(key_type),
+                                                        stream);
+        if(result != hipSuccess)
+        {
+            return result;
+        }
+        return ::rocprim::reduce_by_key(nullptr,
+                                        reduce_storage_size,
+                                        sorted_keys,
+                                        sorted_values,
+                                        size,
+                                        unique_output,
+                                        aggregates_output,
+                                        unique_count_output,
+                                        reduce_op,
+                                        key_compare_op,
+                                        stream);
+    }
+
+    auto partition(const size_t size)
+    {
+        return detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&sorted_keys, size),
+            detail::temp_storage::ptr_aligned_array(&sorted_values, size),
+            detail::temp_storage::make_union_partition(
+                detail::temp_storage::make_partition(&sort_storage, sort_storage_size),
+                detail::temp_storage::make_partition(&reduce_storage, reduce_storage_size)));
+    }
+
+    hipError_t run(KeysInputIterator         keys_input,
+                   ValuesInputIterator       values_input,
+                   const size_t              size,
+                   UniqueOutputIterator      unique_output,
+                   AggregatesOutputIterator  aggregates_output,
+                   UniqueCountOutputIterator unique_count_output,
+                   BinaryFunction            reduce_op,
+                   KeyCompareFunction        key_compare_op,
+                   const hipStream_t         stream,
+                   const bool                debug_synchronous)
+    {
+        hipError_t result = ::rocprim::radix_sort_pairs(sort_storage,
+                                                        sort_storage_size,
+                                                        keys_input,
+                                                        sorted_keys,
+                                                        values_input,
+                                                        sorted_values,
+                                                        size,
+                                                        0,
+                                                        8 * sizeof(key_type),
+                                                        stream,
+                                                        debug_synchronous);
+        if(result != hipSuccess)
+        {
+            return result;
+        }
+        return ::rocprim::reduce_by_key(reduce_storage,
+                                        reduce_storage_size,
+                                        sorted_keys,
+                                        sorted_values,
+                                        size,
+                                        unique_output,
+                                        aggregates_output,
+                                        unique_count_output,
+                                        reduce_op,
+                                        key_compare_op,
+                                        stream,
+                                        debug_synchronous);
+    }
+};
+
+} // namespace hash_reduce_by_key
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start)                           \
+    {                                                                                            \
+        auto _error = hipGetLastError();                                                         \
+        if(_error != hipSuccess)                                                                 \
+            return _error;                                                                       \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size);                                          \
+        if(debug_synchronous)                                                                    \
+        {                                                                                        \
+            std::cout << name << "(" << size << ")";                                             \
+            auto __error = hipStreamSynchronize(stream);                                         \
+            if(__error != hipSuccess)                                                            \
+                return __error;                                                                  \
+            auto _end = std::chrono::high_resolution_clock::now();                               \
+            auto _d = std::chrono::duration_cast<std::chrono::duration<double>>(_end - start);   \
+            std::cout << " " << _d.count() * 1000 << " ms" << '\n';                              \
+        }                                                                                        \
+    }
+
+template<class Config,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class UniqueOutputIterator,
+         class AggregatesOutputIterator,
+         class UniqueCountOutputIterator,
+         class BinaryFunction,
+         class KeyCompareFunction,
+         class KeyHash>
+inline hipError_t hash_reduce_by_key_impl(std::true_type /*is_supported_accumulator*/,
+                                          void*                     temporary_storage,
+                                          size_t&                   storage_size,
+                                          KeysInputIterator         keys_input,
+                                          ValuesInputIterator       values_input,
+                                          const size_t              size,
+                                          UniqueOutputIterator      unique_output,
+                                          AggregatesOutputIterator  aggregates_output,
+                                          UniqueCountOutputIterator unique_count_output,
+                                          const size_t              max_unique_keys,
+                                          BinaryFunction            reduce_op,
+                                          KeyCompareFunction        key_compare_op,
+                                          KeyHash                   key_hash,
+                                          const hipStream_t         stream,
+                                          const bool                debug_synchronous)
+{
+    using accumulator_type = reduce_by_key::accumulator_type_t<ValuesInputIterator, BinaryFunction>;
+    using word_type        = hash_reduce_by_key::word_type_t<accumulator_type>;
+    using sort_path_type   = hash_reduce_by_key::sort_path<KeysInputIterator,
+                                                           ValuesInputIterator,
+                                                           UniqueOutputIterator,
+                                                           AggregatesOutputIterator,
+                                                           UniqueCountOutputIterator,
+                                                           BinaryFunction,
+                                                           KeyCompareFunction>;
+
+    using config = default_or_custom_config<Config, hash_reduce_by_key_config<256, 4>>;
+
+    static constexpr unsigned int block_size      = config::block_size;
+    static constexpr unsigned int items_per_block = block_size * config::items_per_thread;
+
+    // The table stores item indices plus one in 32 bits and has at most 2^31 slots, it has
+    // twice as many slots as keys, so the probe sequences stay short
+    const size_t max_table_keys = std::min(max_unique_keys, size);
+    const bool   use_table
+        = size < std::numeric_limits<unsigned int>::max() && max_table_keys <= (1u << 30);
+    const unsigned int capacity
+        = use_table ? ::rocprim::detail::next_power_of_two(
+              static_cast<unsigned int>(std::max<size_t>(1, 2 * max_table_keys)))
+                    : 0;
+
+    unsigned int* slots{};
+    unsigned int* item_slots{};
+    word_type*    accumulators{};
+    unsigned int* counters{};
+    unsigned int* group_ids{};
+    void*         scan_storage{};
+    size_t        scan_storage_size = 0;
+
+    if(use_table)
+    {
+        hipError_t result = ::rocprim::exclusive_scan(
+            nullptr,
+            scan_storage_size,
+            ::rocprim::make_transform_iterator(slots, hash_reduce_by_key::is_claimed_op{}),
+            group_ids,
+            0u,
+            capacity + 1,
+            ::rocprim::plus<unsigned int>(),
+            stream);
+        if(result != hipSuccess)
+        {
+            return result;
+        }
+    }
+
+    sort_path_type sort_path{};
+    hipError_t     result = sort_path.query(keys_input,
+                                            values_input,
+                                            size,
+                                            unique_output,
+                                            aggregates_output,
+                                            unique_count_output,
+                                            reduce_op,
+                                            key_compare_op,
+                                            stream);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    // The sort-based path runs only after the table overflowed, so they share the storage
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_union_partition(
+            detail::temp_storage::make_linear_partition(
+                // The extra slot is never claimed and ends the scan with the number of groups
+                detail::temp_storage::ptr_aligned_array(&slots, use_table ? capacity + 1 : 0),
+                detail::temp_storage::ptr_aligned_array(&item_slots, use_table ? size : 0),
+                detail::temp_storage::ptr_aligned_array(&accumulators, capacity),
+                detail::temp_storage::ptr_aligned_array(&counters, use_table ? 2 : 0),
+                detail::temp_storage::ptr_aligned_array(&group_ids,
+                                                        use_table ? capacity + 1 : 0),
+                detail::temp_storage::make_partition(&scan_storage, scan_storage_size)),
+            sort_path.partition(size)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(size == 0)
+    {
+        return ::rocprim::transform(::rocprim::constant_iterator<unsigned int>(0),
+                                    unique_count_output,
+                                    1,
+                                    ::rocprim::identity<unsigned int>{},
+                                    stream,
+                                    debug_synchronous);
+    }
+
+    if(!use_table)
+    {
+        return sort_path.run(keys_input,
+                             values_input,
+                             size,
+                             unique_output,
+                             aggregates_output,
+                             unique_count_output,
+                             reduce_op,
+                             key_compare_op,
+                             stream,
+                             debug_synchronous);
+    }
+
+    const unsigned int number_of_blocks
+        = static_cast<unsigned int>(::rocprim::detail::ceiling_div(size, items_per_block));
+    const unsigned int slot_blocks = ::rocprim::detail::ceiling_div(capacity + 1, block_size);
+
+    std::chrono::high_resolution_clock::time_point start;
+    if(debug_synchronous)
+    {
+        std::cout << "capacity " << capacity << '\n';
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << number_of_blocks << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+    }
+
+    result = hipMemsetAsync(slots, 0, (capacity + 1) * sizeof(unsigned int), stream);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    // The claimed slot count and the overflow flag
+    result = hipMemsetAsync(counters, 0, 2 * sizeof(unsigned int), stream);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    if(debug_synchronous)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("hash_reduce_by_key_insert_kernel");
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(hash_reduce_by_key_insert_kernel<config>),
+                       dim3(number_of_blocks),
+                       dim3(block_size),
+                       0,
+                       stream,
+                       keys_input,
+                       static_cast<unsigned int>(size),
+                       slots,
+                       capacity,
+                       static_cast<unsigned int>(max_table_keys),
+                       item_slots,
+                       counters,
+                       counters + 1,
+                       key_compare_op,
+                       key_hash);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("hash_reduce_by_key_insert_kernel", size, start);
+
+    unsigned int overflow;
+    result = detail::memcpy_and_sync(&overflow,
+                                     counters + 1,
+                                     sizeof(overflow),
+                                     hipMemcpyDeviceToHost,
+                                     stream);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    if(overflow != 0)
+    {
+        if(debug_synchronous)
+        {
+            std::cout << "table overflow, using the sort-based path" << '\n';
+        }
+        return sort_path.run(keys_input,
+                             values_input,
+                             size,
+                             unique_output,
+                             aggregates_output,
+                             unique_count_output,
+                             reduce_op,
+                             key_compare_op,
+                             stream,
+                             debug_synchronous);
+    }
+
+    if(debug_synchronous)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("hash_reduce_by_key_init_kernel");
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(hash_reduce_by_key_init_kernel<accumulator_type>),
+                       dim3(slot_blocks),
+                       dim3(block_size),
+                       0,
+                       stream,
+                       values_input,
+                       slots,
+                       capacity,
+                       accumulators);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("hash_reduce_by_key_init_kernel", capacity, start);
+
+    if(debug_synchronous)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("hash_reduce_by_key_aggregate_kernel");
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(hash_reduce_by_key_aggregate_kernel<config, accumulator_type>),
+        dim3(number_of_blocks),
+        dim3(block_size),
+        0,
+        stream,
+        values_input,
+        static_cast<unsigned int>(size),
+        slots,
+        item_slots,
+        accumulators,
+        reduce_op);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("hash_reduce_by_key_aggregate_kernel",
+                                                size,
+                                                start);
+
+    result = ::rocprim::exclusive_scan(
+        scan_storage,
+        scan_storage_size,
+        ::rocprim::make_transform_iterator(slots, hash_reduce_by_key::is_claimed_op{}),
+        group_ids,
+        0u,
+        capacity + 1,
+        ::rocprim::plus<unsigned int>(),
+        stream,
+        debug_synchronous);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    if(debug_synchronous)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("hash_reduce_by_key_scatter_kernel");
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(hash_reduce_by_key_scatter_kernel<accumulator_type>),
+                       dim3(slot_blocks),
+                       dim3(block_size),
+                       0,
+                       stream,
+                       keys_input,
+                       slots,
+                       capacity,
+                       accumulators,
+                       group_ids,
+                       unique_output,
+                       aggregates_output,
+                       unique_count_output);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("hash_reduce_by_key_scatter_kernel",
+                                                capacity + 1,
+                                                start);
+
+    return hipSuccess;
+}
+
+template<class Config,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class UniqueOutputIterator,
+         class AggregatesOutputIterator,
+         class UniqueCountOutputIterator,
+         class BinaryFunction,
+         class KeyCompareFunction,
+         class KeyHash>
+inline hipError_t hash_reduce_by_key_impl(std::false_type /*is_supported_accumulator*/,
+                                          void*                     temporary_storage,
+                                          size_t&                   storage_size,
+                                          KeysInputIterator         keys_input,
+                                          ValuesInputIterator       values_input,
+                                          const size_t              size,
+                                          UniqueOutputIterator      unique_output,
+                                          AggregatesOutputIterator  aggregates_output,
+                                          UniqueCountOutputIterator unique_count_output,
+                                          const size_t /*max_unique_keys*/,
+                                          BinaryFunction            reduce_op,
+                                          KeyCompareFunction        key_compare_op,
+                                          KeyHash /*key_hash*/,
+                                          const hipStream_t         stream,
+                                          const bool                debug_synchronous)
+{
+    using sort_path_type = hash_reduce_by_key::sort_path<KeysInputIterator,
+                                                         ValuesInputIterator,
+                                                         UniqueOutputIterator,
+                                                         AggregatesOutputIterator,
+                                                         UniqueCountOutputIterator,
+                                                         BinaryFunction,
+                                                         KeyCompareFunction>;
+
+    // The values cannot be aggregated by compare-and-swap loops
+    sort_path_type sort_path{};
+    hipError_t     result = sort_path.query(keys_input,
+                                            values_input,
+                                            size,
+                                            unique_output,
+                                            aggregates_output,
+                                            unique_count_output,
+                                            reduce_op,
+                                            key_compare_op,
+                                            stream);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    const hipError_t partition_result = detail::temp_storage::partition(temporary_storage,
+                                                                        storage_size,
+                                                                        sort_path.partition(size));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(size == 0)
+    {
+        return ::rocprim::transform(::rocprim::constant_iterator<unsigned int>(0),
+                                    unique_count_output,
+                                    1,
+                                    ::rocprim::identity<unsigned int>{},
+                                    stream,
+                                    debug_synchronous);
+    }
+
+    return sort_path.run(keys_input,
+                         values_input,
+                         size,
+                         unique_output,
+                         aggregates_output,
+                         unique_count_output,
+                         reduce_op,
+                         key_compare_op,
+                         stream,
+                         debug_synchronous);
+}
+
+template<class Config,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class UniqueOutputIterator,
+         class AggregatesOutputIterator,
+         class UniqueCountOutputIterator,
+         class BinaryFunction,
+         class KeyCompareFunction,
+         class KeyHash>
+inline hipError_t hash_reduce_by_key_impl(void*                     temporary_storage,
+                                          size_t&                   storage_size,
+                                          KeysInputIterator         keys_input,
+                                          ValuesInputIterator       values_input,
+                                          const size_t              size,
+                                          UniqueOutputIterator      unique_output,
+                                          AggregatesOutputIterator  aggregates_output,
+                                          UniqueCountOutputIterator unique_count_output,
+                                          const size_t              max_unique_keys,
+                                          BinaryFunction            reduce_op,
+                                          KeyCompareFunction        key_compare_op,
+                                          KeyHash                   key_hash,
+                                          const hipStream_t         stream,
+                                          const bool                debug_synchronous)
+{
+    using accumulator_type = reduce_by_key::accumulator_type_t<ValuesInputIterator, BinaryFunction>;
+    return hash_reduce_by_key_impl<Config>(
+        hash_reduce_by_key::is_supported_accumulator<accumulator_type>{},
+        temporary_storage,
+        storage_size,
+        keys_input,
+        values_input,
+        size,
+        unique_output,
+        aggregates_output,
+        unique_count_output,
+        max_unique_keys,
+        reduce_op,
+        key_compare_op,
+        key_hash,
+        stream,
+        debug_synchronous);
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
+} // end of detail namespace
+
+/// \brief Parallel reduce-by-key primitive for unsorted keys for device level.
+///
+/// \p hash_reduce_by_key reduces the values of all items with equal keys, wherever they are in
+/// the input, using binary \p reduce_op operator. Unlike \p reduce_by_key, the keys do not
+/// need to be grouped: every distinct key is stored once to \p unique_output, the reduction of
+/// its values to \p aggregates_output and the number of distinct keys to
+/// \p unique_count_output.
+///
+/// \par Overview
+/// * The keys are inserted into a global open-addressing hash table of
+/// <tt>2 * min(max_unique_keys, size)</tt> slots rounded up to a power of two, and the values
+/// are aggregated to the slots of their keys with atomic compare-and-swap loops. Every block
+/// first aggregates its values in a table in shared memory, so frequent keys cause few global
+/// updates. This replaces sorting the pairs and \p reduce_by_key when there are few distinct
+/// keys compared to the number of items.
+/// * \p max_unique_keys is an estimate of the number of distinct keys. When the input has
+/// more, the table overflows and the pairs are sorted by \p radix_sort_pairs and reduced by
+/// \p reduce_by_key instead. This path is also used when the result type of \p reduce_op is
+/// not 4 or 8 bytes large and trivially copyable, or when there are \p 2^32 - 1 items or more.
+/// Both paths require the keys to be sortable by \p radix_sort_pairs.
+/// * Whether the table overflowed is copied to the host, so the function synchronizes
+/// \p stream.
+/// * The order of the unique keys is unspecified; the sort-based path stores them in ascending
+/// order. The values are reduced in an unspecified order, \p reduce_op must be associative
+/// and commutative, and results of floating-point reductions may differ between calls.
+/// * \p key_hash must return equal hashes for keys equal according to \p key_compare_op.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer. The size depends on \p size and
+/// \p max_unique_keys.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// \p hash_reduce_by_key_config or a custom class with the same members.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam UniqueOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam AggregatesOutputIterator - random-access iterator type of the output range. Must meet
+/// the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam UniqueCountOutputIterator - random-access iterator type of the output range. Must
+/// meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam BinaryFunction - type of binary function used for reduction. Default type
+/// is \p rocprim::plus<T>, where \p T is a \p value_type of \p ValuesInputIterator.
+/// \tparam KeyCompareFunction - type of binary function used to determine keys equality.
+/// Default type is \p rocprim::equal_to<T>, where \p T is a \p value_type of
+/// \p KeysInputIterator.
+/// \tparam KeyHash - type of the hash function of the keys. Default type is
+/// \p rocprim::default_key_hash<T>, where \p T is a \p value_type of \p KeysInputIterator.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - iterator to the first element in the range of keys.
+/// \param [in] values_input - iterator to the first element in the range of values to reduce.
+/// \param [in] size - number of element in the input range.
+/// \param [out] unique_output - iterator to the first element in the output range of unique
+/// keys.
+/// \param [out] aggregates_output - iterator to the first element in the output range of
+/// reductions.
+/// \param [out] unique_count_output - iterator to total number of groups.
+/// \param [in] max_unique_keys - the expected maximum number of distinct keys, it sets the size
+/// of the hash table.
+/// \param [in] reduce_op - binary operation function object that will be used for reduction.
+/// The signature of the function should be equivalent to the following:
+/// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// Default is BinaryFunction().
+/// \param [in] key_compare_op - binary operation function object that will be used to
+/// determine key equality. The signature of the function should be equivalent to the
+/// following: <tt>bool f(const T &a, const T &b);</tt>. Default is KeyCompareFunction().
+/// \param [in] key_hash - function object that returns an unsigned integer hash of a key.
+/// Default is KeyHash().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the values of unsorted integer keys are summed.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;          // e.g., 8
+/// int * keys_input;           // e.g., [10, 1, 88, 1, 10, 2, 1, 10]
+/// int * values_input;         // e.g., [ 1, 2,  3, 4,  5, 6, 7,  8]
+/// int * unique_output;        // empty array of at least 4 elements
+/// int * aggregates_output;    // empty array of at least 4 elements
+/// int * unique_count_output;  // empty array of 1 element
+/// size_t max_unique_keys;     // e.g., 16
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::hash_reduce_by_key(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input, values_input, input_size,
+///     unique_output, aggregates_output, unique_count_output, max_unique_keys
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform reduction
+/// rocprim::hash_reduce_by_key(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input, values_input, input_size,
+///     unique_output, aggregates_output, unique_count_output, max_unique_keys
+/// );
+/// // unique_output:       [1, 2, 10, 88] in an unspecified order
+/// // aggregates_output:   [13, 6, 14, 3] in the same order
+/// // unique_count_output: [4]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class UniqueOutputIterator,
+         class AggregatesOutputIterator,
+         class UniqueCountOutputIterator,
+         class BinaryFunction
+         = ::rocprim::plus<typename std::iterator_traits<ValuesInputIterator>::value_type>,
+         class KeyCompareFunction
+         = ::rocprim::equal_to<typename std::iterator_traits<KeysInputIterator>::value_type>,
+         class KeyHash = ::rocprim::default_key_hash<
+             typename std::iterator_traits<KeysInputIterator>::value_type>>
+inline hipError_t hash_reduce_by_key(void*                     temporary_storage,
+                                     size_t&                   storage_size,
+                                     KeysInputIterator         keys_input,
+                                     ValuesInputIterator       values_input,
+                                     const size_t              size,
+                                     UniqueOutputIterator      unique_output,
+                                     AggregatesOutputIterator  aggregates_output,
+                                     UniqueCountOutputIterator unique_count_output,
+                                     const size_t              max_unique_keys,
+                                     BinaryFunction            reduce_op = BinaryFunction(),
+                                     KeyCompareFunction key_compare_op    = KeyCompareFunction(),
+                                     KeyHash            key_hash          = KeyHash(),
+                                     hipStream_t        stream            = 0,
+                                     bool               debug_synchronous = false)
+{
+    return detail::hash_reduce_by_key_impl<Config>(temporary_storage,
+                                                   storage_size,
+                                                   keys_input,
+                                                   values_input,
+                                                   size,
+                                                   unique_output,
+                                                   aggregates_output,
+                                                   unique_count_output,
+                                                   max_unique_keys,
+                                                   reduce_op,
+                                                   key_compare_op,
+                                                   key_hash,
+                                                   stream,
+                                                   debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_HASH_REDUCE_BY_KEY_HPP_
@@ -0,0 +1,816 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_HASH_TABLE_HPP_
+#define ROCPRIM_DEVICE_DEVICE_HASH_TABLE_HPP_
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../functional.hpp"
+
+#include "detail/device_hash_table.hpp"
+#include "device_hash_reduce_by_key.hpp"
+#include "device_hash_table_config.hpp"
+#include "device_reduce.hpp"
+#include "device_scan.hpp"
+#include "instrumentation.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+template<class Config, class KeysInputIterator, class KeyCompareFunction, class KeyHash>
+ROCPRIM_KERNEL __launch_bounds__(Config::block_size) void hash_table_build_kernel(
+    KeysInputIterator            build_keys,
+    const unsigned int           build_size,
+    const hash_table::table_view table,
+    KeyCompareFunction           key_compare_op,
+    KeyHash                      key_hash)
+{
+    hash_table::build_kernel_impl<Config::block_size, Config::items_per_thread>(build_keys,
+                                                                                build_size,
+                                                                                table,
+                                                                                key_compare_op,
+                                                                                key_hash);
+}
+
+template<class Config,
+         class KeysInputIterator,
+         class ProbeKeysInputIterator,
+         class KeyCompareFunction,
+         class KeyHash>
+ROCPRIM_KERNEL __launch_bounds__(Config::block_size) void hash_table_count_kernel(
+    KeysInputIterator            build_keys,
+    ProbeKeysInputIterator       probe_keys,
+    const unsigned int           probe_size,
+    const hash_table::table_view table,
+    unsigned int*                match_counts,
+    KeyCompareFunction           key_compare_op,
+    KeyHash                      key_hash)
+{
+    hash_table::count_kernel_impl<Config::block_size, Config::items_per_thread>(build_keys,
+                                                                                probe_keys,
+                                                                                probe_size,
+                                                                                table,
+                                                                                match_counts,
+                                                                                key_compare_op,
+                                                                                key_hash);
+}
+
+template<class Config,
+         class KeysInputIterator,
+         class ProbeKeysInputIterator,
+         class BuildIndicesOutputIterator,
+         class ProbeIndicesOutputIterator,
+         class MatchCountOutputIterator,
+         class KeyCompareFunction,
+         class KeyHash>
+ROCPRIM_KERNEL __launch_bounds__(Config::block_size) void hash_table_write_kernel(
+    KeysInputIterator            build_keys,
+    ProbeKeysInputIterator       probe_keys,
+    const unsigned int           probe_size,
+    const hash_table::table_view table,
+    const size_t*                match_offsets,
+    BuildIndicesOutputIterator   build_indices_output,
+    ProbeIndicesOutputIterator   probe_indices_output,
+    MatchCountOutputIterator     match_count_output,
+    KeyCompareFunction           key_compare_op,
+    KeyHash                      key_hash)
+{
+    hash_table::write_kernel_impl<Config::block_size, Config::items_per_thread>(
+        build_keys,
+        probe_keys,
+        probe_size,
+        table,
+        match_offsets,
+        build_indices_output,
+        probe_indices_output,
+        match_count_output,
+        key_compare_op,
+        key_hash);
+}
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start)                           \
+    {                                                                                            \
+        auto _error = hipGetLastError();                                                         \
+        if(_error != hipSuccess)                                                                 \
+            return _error;                                                                       \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size);                                          \
+        if(debug_synchronous)                                                                    \
+        {                                                                                        \
+            std::cout << name << "(" << size << ")";                                             \
+            auto __error = hipStreamSynchronize(stream);                                         \
+            if(__error != hipSuccess)                                                            \
+                return __error;                                                                  \
+            auto _end = std::chrono::high_resolution_clock::now();                               \
+            auto _d = std::chrono::duration_cast<std::chrono::duration<double>>(_end - start);   \
+            std::cout << " " << _d.count() * 1000 << " ms" << '\n';                              \
+        }                                                                                        \
+    }
+
+// Build items are indexed by 32-bit integers and the table has twice as many slots
+constexpr size_t hash_table_max_build_size = size_t(1) << 30;
+
+// Finds the slots and the lists in the storage of a table of build_size items
+inline hipError_t hash_table_partition(void*                   table_storage,
+                                       size_t&                 table_storage_size,
+                                       const size_t            build_size,
+                                       hash_table::table_view& table)
+{
+    if(build_size > hash_table_max_build_size)
+    {
+        return hipErrorInvalidValue;
+    }
+    table.capacity = hash_table::get_capacity(build_size);
+    return detail::temp_storage::partition(
+        table_storage,
+        table_storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&table.slots, table.capacity),
+            detail::temp_storage::ptr_aligned_array(&table.next, build_size)));
+}
+
+template<class Config, class KeysInputIterator, class KeyCompareFunction, class KeyHash>
+inline hipError_t hash_table_build_impl(void*              table_storage,
+                                        size_t&            table_storage_size,
+                                        KeysInputIterator  build_keys,
+                                        const size_t       build_size,
+                                        KeyCompareFunction key_compare_op,
+                                        KeyHash            key_hash,
+                                        const hipStream_t  stream,
+                                        const bool         debug_synchronous)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using config
+        = default_or_custom_config<Config,
+                                   default_hash_table_config<ROCPRIM_TARGET_ARCH, key_type>>;
+
+    static constexpr unsigned int block_size      = config::block_size;
+    static constexpr unsigned int items_per_block = block_size * config::items_per_thread;
+
+    hash_table::table_view table{};
+    const hipError_t partition_result
+        = hash_table_partition(table_storage, table_storage_size, build_size, table);
+    if(partition_result != hipSuccess || table_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    hipError_t result
+        = hipMemsetAsync(table.slots, 0, table.capacity * sizeof(unsigned int), stream);
+    if(result != hipSuccess || build_size == 0)
+    {
+        return result;
+    }
+
+    const unsigned int number_of_blocks
+        = static_cast<unsigned int>(::rocprim::detail::ceiling_div(build_size, items_per_block));
+
+    std::chrono::high_resolution_clock::time_point start;
+    if(debug_synchronous)
+    {
+        std::cout << "capacity " << table.capacity << '\n';
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << number_of_blocks << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+        start = std::chrono::high_resolution_clock::now();
+    }
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("hash_table_build_kernel");
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(hash_table_build_kernel<config>),
+                       dim3(number_of_blocks),
+                       dim3(block_size),
+                       0,
+                       stream,
+                       build_keys,
+                       static_cast<unsigned int>(build_size),
+                       table,
+                       key_compare_op,
+                       key_hash);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("hash_table_build_kernel", build_size, start);
+
+    return hipSuccess;
+}
+
+// Stores the number of matches of every probe item to match_counts, which has probe_size + 1
+// elements, the last one is 0
+template<class Config,
+         class KeysInputIterator,
+         class ProbeKeysInputIterator,
+         class KeyCompareFunction,
+         class KeyHash>
+inline hipError_t hash_table_count_matches(const hash_table::table_view table,
+                                           KeysInputIterator            build_keys,
+                                           ProbeKeysInputIterator       probe_keys,
+                                           const size_t                 probe_size,
+                                           unsigned int*                match_counts,
+                                           KeyCompareFunction           key_compare_op,
+                                           KeyHash                      key_hash,
+                                           const hipStream_t            stream,
+                                           const bool                   debug_synchronous)
+{
+    static constexpr unsigned int block_size      = Config::block_size;
+    static constexpr unsigned int items_per_block = block_size * Config::items_per_thread;
+
+    const unsigned int number_of_blocks = static_cast<unsigned int>(
+        ::rocprim::detail::ceiling_div(probe_size + 1, items_per_block));
+
+    std::chrono::high_resolution_clock::time_point start;
+    if(debug_synchronous)
+    {
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << number_of_blocks << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+        start = std::chrono::high_resolution_clock::now();
+    }
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("hash_table_count_kernel");
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(hash_table_count_kernel<Config>),
+                       dim3(number_of_blocks),
+                       dim3(block_size),
+                       0,
+                       stream,
+                       build_keys,
+                       probe_keys,
+                       static_cast<unsigned int>(probe_size),
+                       table,
+                       match_counts,
+                       key_compare_op,
+                       key_hash);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("hash_table_count_kernel", probe_size, start);
+
+    return hipSuccess;
+}
+
+template<class Config,
+         class KeysInputIterator,
+         class ProbeKeysInputIterator,
+         class MatchCountOutputIterator,
+         class KeyCompareFunction,
+         class KeyHash>
+inline hipError_t hash_table_probe_count_impl(void*                    temporary_storage,
+                                              size_t&                  storage_size,
+                                              void*                    table_storage,
+                                              size_t                   table_storage_size,
+                                              KeysInputIterator        build_keys,
+                                              const size_t             build_size,
+                                              ProbeKeysInputIterator   probe_keys,
+                                              const size_t             probe_size,
+                                              MatchCountOutputIterator match_count_output,
+                                              KeyCompareFunction       key_compare_op,
+                                              KeyHash                  key_hash,
+                                              const hipStream_t        stream,
+                                              const bool               debug_synchronous)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using config
+        = default_or_custom_config<Config,
+                                   default_hash_table_config<ROCPRIM_TARGET_ARCH, key_type>>;
+
+    if(probe_size >= std::numeric_limits<unsigned int>::max())
+    {
+        return hipErrorInvalidValue;
+    }
+
+    unsigned int* match_counts{};
+    void*         reduce_storage{};
+    size_t        reduce_storage_size = 0;
+
+    hipError_t result = ::rocprim::reduce(nullptr,
+                                          reduce_storage_size,
+                                          match_counts,
+                                          match_count_output,
+                                          size_t(0),
+                                          probe_size + 1,
+                                          ::rocprim::plus<size_t>(),
+                                          stream);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&match_counts, probe_size + 1),
+            detail::temp_storage::make_partition(&reduce_storage, reduce_storage_size)));
+    if(result != hipSuccess || temporary_storage == nullptr)
+    {
+        return result;
+    }
+
+    hash_table::table_view table{};
+    result = hash_table_partition(table_storage, table_storage_size, build_size, table);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    result = hash_table_count_matches<config>(table,
+                                              build_keys,
+                                              probe_keys,
+                                              probe_size,
+                                              match_counts,
+                                              key_compare_op,
+                                              key_hash,
+                                              stream,
+                                              debug_synchronous);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    return ::rocprim::reduce(reduce_storage,
+                             reduce_storage_size,
+                             match_counts,
+                             match_count_output,
+                             size_t(0),
+                             probe_size + 1,
+                             ::rocprim::plus<size_t>(),
+                             stream,
+                             debug_synchronous);
+}
+
+template<class Config,
+         class KeysInputIterator,
+         class ProbeKeysInputIterator,
+         class BuildIndicesOutputIterator,
+         class ProbeIndicesOutputIterator,
+         class MatchCountOutputIterator,
+         class KeyCompareFunction,
+         class KeyHash>
+inline hipError_t hash_table_probe_impl(void*                      temporary_storage,
+                                        size_t&                    storage_size,
+                                        void*                      table_storage,
+                                        size_t                     table_storage_size,
+                                        KeysInputIterator          build_keys,
+                                        const size_t               build_size,
+                                        ProbeKeysInputIterator     probe_keys,
+                                        const size_t               probe_size,
+                                        BuildIndicesOutputIterator build_indices_output,
+                                        ProbeIndicesOutputIterator probe_indices_output,
+                                        MatchCountOutputIterator   match_count_output,
+                                        KeyCompareFunction         key_compare_op,
+                                        KeyHash                    key_hash,
+                                        const hipStream_t          stream,
+                                        const bool                 debug_synchronous)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using config
+        = default_or_custom_config<Config,
+                                   default_hash_table_config<ROCPRIM_TARGET_ARCH, key_type>>;
+
+    static constexpr unsigned int block_size      = config::block_size;
+    static constexpr unsigned int items_per_block = block_size * config::items_per_thread;
+
+    if(probe_size >= std::numeric_limits<unsigned int>::max())
+    {
+        return hipErrorInvalidValue;
+    }
+
+    unsigned int* match_counts{};
+    size_t*       match_offsets{};
+    void*         scan_storage{};
+    size_t        scan_storage_size = 0;
+
+    // The offsets of the matches of every probe item are found by the decoupled look-back scan
+    hipError_t result = ::rocprim::exclusive_scan(nullptr,
+                                                  scan_storage_size,
+                                                  match_counts,
+                                                  match_offsets,
+                                                  size_t(0),
+                                                  probe_size + 1,
+                                                  ::rocprim::plus<size_t>(),
+                                                  stream);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&match_counts, probe_size + 1),
+            detail::temp_storage::ptr_aligned_array(&match_offsets, probe_size + 1),
+            detail::temp_storage::make_partition(&scan_storage, scan_storage_size)));
+    if(result != hipSuccess || temporary_storage == nullptr)
+    {
+        return result;
+    }
+
+    hash_table::table_view table{};
+    result = hash_table_partition(table_storage, table_storage_size, build_size, table);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    result = hash_table_count_matches<config>(table,
+                                              build_keys,
+                                              probe_keys,
+                                              probe_size,
+                                              match_counts,
+                                              key_compare_op,
+                                              key_hash,
+                                              stream,
+                                              debug_synchronous);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    result = ::rocprim::exclusive_scan(scan_storage,
+                                       scan_storage_size,
+                                       match_counts,
+                                       match_offsets,
+                                       size_t(0),
+                                       probe_size + 1,
+                                       ::rocprim::plus<size_t>(),
+                                       stream,
+                                       debug_synchronous);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    const unsigned int number_of_blocks = static_cast<unsigned int>(
+        ::rocprim::detail::ceiling_div(probe_size + 1, items_per_block));
+
+    std::chrono::high_resolution_clock::time_point start;
+    if(debug_synchronous)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("hash_table_write_kernel");
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(hash_table_write_kernel<config>),
+                       dim3(number_of_blocks),
+                       dim3(block_size),
+                       0,
+                       stream,
+                       build_keys,
+                       probe_keys,
+                       static_cast<unsigned int>(probe_size),
+                       table,
+                       match_offsets,
+                       build_indices_output,
+                       probe_indices_output,
+                       match_count_output,
+                       key_compare_op,
+                       key_hash);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("hash_table_write_kernel", probe_size, start);
+
+    return hipSuccess;
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
+} // namespace detail
+
+/// \brief Builds a hash table of the keys of the build side of a hash join.
+///
+/// \par Overview
+/// * The device hash table primitives join two ranges of keys: \p hash_table_build inserts the
+/// build keys into a table, \p hash_table_probe_count counts the pairs of equal build and probe
+/// keys and \p hash_table_probe writes the indices of the pairs. The count is usually copied to
+/// the host to allocate the outputs of \p hash_table_probe.
+/// * The table is an open-addressing hash table of <tt>2 * build_size</tt> slots rounded up to a
+/// power of two. Slots refer to the build items of one key, so duplicate build keys are
+/// supported and all of them are matched.
+/// * The table stores indices of build items, not keys or values: \p build_keys must stay
+/// valid and unchanged until the table is no longer probed, and the values of the matches can
+/// be gathered with the output indices.
+/// * \p table_storage holds the table. Unlike temporary storage, it must be kept between the
+/// build and the probes of the table. Returns the required size of \p table_storage in
+/// \p table_storage_size if \p table_storage is a null pointer. The size depends only on
+/// \p build_size.
+/// * \p build_size must be at most \p 2^30.
+/// * \p key_hash must return equal hashes for keys equal according to \p key_compare_op.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// \p hash_table_config or a custom class with the same members.
+/// \tparam KeysInputIterator - random-access iterator type of the build keys. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeyCompareFunction - type of binary function used to determine keys equality.
+/// Default type is \p rocprim::equal_to<T>, where \p T is a \p value_type of
+/// \p KeysInputIterator.
+/// \tparam KeyHash - type of the hash function of the keys. Default type is
+/// \p rocprim::default_key_hash<T>, where \p T is a \p value_type of \p KeysInputIterator.
+///
+/// \param [in] table_storage - pointer to a device-accessible storage of the table. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p table_storage_size and function returns without building the table.
+/// \param [in,out] table_storage_size - reference to a size (in bytes) of \p table_storage.
+/// \param [in] build_keys - iterator to the first element in the range of build keys.
+/// \param [in] build_size - number of element in the range of build keys.
+/// \param [in] key_compare_op - binary operation function object that will be used to
+/// determine key equality. The signature of the function should be equivalent to the
+/// following: <tt>bool f(const T &a, const T &b);</tt>. Default is KeyCompareFunction().
+/// \param [in] key_hash - function object that returns an unsigned integer hash of a key.
+/// Default is KeyHash().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful build; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the orders of customers are joined with the customers by the customer id.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t customers_size;        // e.g., 4
+/// int * customer_ids;           // e.g., [7, 3, 9, 5]
+/// size_t orders_size;           // e.g., 6
+/// int * order_customer_ids;     // e.g., [3, 3, 8, 5, 7, 3]
+/// size_t * match_count_output;  // empty array of 1 element
+///
+/// // Build the table of the customers
+/// size_t table_size;
+/// void * table_ptr = nullptr;
+/// rocprim::hash_table_build(table_ptr, table_size, customer_ids, customers_size);
+/// hipMalloc(&table_ptr, table_size);
+/// rocprim::hash_table_build(table_ptr, table_size, customer_ids, customers_size);
+///
+/// // Count the matches of the orders
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// rocprim::hash_table_probe_count(
+///     temporary_storage_ptr, temporary_storage_size_bytes, table_ptr, table_size,
+///     customer_ids, customers_size, order_customer_ids, orders_size, match_count_output
+/// );
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+/// rocprim::hash_table_probe_count(
+///     temporary_storage_ptr, temporary_storage_size_bytes, table_ptr, table_size,
+///     customer_ids, customers_size, order_customer_ids, orders_size, match_count_output
+/// );
+/// // match_count_output: [5]
+///
+/// // Copy the count to the host and allocate the outputs
+/// unsigned int * customer_indices;  // empty array of 5 elements
+/// unsigned int * order_indices;     // empty array of 5 elements
+///
+/// // Write the matches of the orders
+/// temporary_storage_ptr = nullptr;
+/// rocprim::hash_table_probe(
+///     temporary_storage_ptr, temporary_storage_size_bytes, table_ptr, table_size,
+///     customer_ids, customers_size, order_customer_ids, orders_size,
+///     customer_indices, order_indices, match_count_output
+/// );
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+/// rocprim::hash_table_probe(
+///     temporary_storage_ptr, temporary_storage_size_bytes, table_ptr, table_size,
+///     customer_ids, customers_size, order_customer_ids, orders_size,
+///     customer_indices, order_indices, match_count_output
+/// );
+/// // customer_indices:   [1, 1, 3, 0, 1]
+/// // order_indices:      [0, 1, 3, 4, 5]
+/// // match_count_output: [5]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class KeysInputIterator,
+         class KeyCompareFunction
+         = ::rocprim::equal_to<typename std::iterator_traits<KeysInputIterator>::value_type>,
+         class KeyHash = ::rocprim::default_key_hash<
+             typename std::iterator_traits<KeysInputIterator>::value_type>>
+inline hipError_t hash_table_build(void*              table_storage,
+                                   size_t&            table_storage_size,
+                                   KeysInputIterator  build_keys,
+                                   const size_t       build_size,
+                                   KeyCompareFunction key_compare_op    = KeyCompareFunction(),
+                                   KeyHash            key_hash          = KeyHash(),
+                                   hipStream_t        stream            = 0,
+                                   bool               debug_synchronous = false)
+{
+    return detail::hash_table_build_impl<Config>(table_storage,
+                                                 table_storage_size,
+                                                 build_keys,
+                                                 build_size,
+                                                 key_compare_op,
+                                                 key_hash,
+                                                 stream,
+                                                 debug_synchronous);
+}
+
+/// \brief Counts the pairs of equal build and probe keys of a hash table.
+///
+/// \par Overview
+/// * Every probe key is looked up in the table built by \p hash_table_build, and the number of
+/// build items with an equal key is summed over all probe items to \p match_count_output.
+/// * The table arguments \p table_storage, \p table_storage_size, \p build_keys, \p build_size,
+/// \p key_compare_op and \p key_hash must be the same as in the call of \p hash_table_build.
+/// * The probe keys are converted to the \p value_type of \p KeysInputIterator.
+/// * \p probe_size must be less than \p 2^32 - 1.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer. The size depends only on \p probe_size.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// \p hash_table_config or a custom class with the same members.
+/// \tparam KeysInputIterator - random-access iterator type of the build keys. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ProbeKeysInputIterator - random-access iterator type of the probe keys. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam MatchCountOutputIterator - random-access iterator type of the output range. Must
+/// meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam KeyCompareFunction - type of binary function used to determine keys equality.
+/// \tparam KeyHash - type of the hash function of the keys.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the probe.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] table_storage - pointer to the storage of the table.
+/// \param [in] table_storage_size - size (in bytes) of \p table_storage.
+/// \param [in] build_keys - iterator to the first element in the range of build keys.
+/// \param [in] build_size - number of element in the range of build keys.
+/// \param [in] probe_keys - iterator to the first element in the range of probe keys.
+/// \param [in] probe_size - number of element in the range of probe keys.
+/// \param [out] match_count_output - iterator to the total number of matches.
+/// \param [in] key_compare_op - binary operation function object that will be used to
+/// determine key equality. Default is KeyCompareFunction().
+/// \param [in] key_hash - function object that returns an unsigned integer hash of a key.
+/// Default is KeyHash().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful probe; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class KeysInputIterator,
+         class ProbeKeysInputIterator,
+         class MatchCountOutputIterator,
+         class KeyCompareFunction
+         = ::rocprim::equal_to<typename std::iterator_traits<KeysInputIterator>::value_type>,
+         class KeyHash = ::rocprim::default_key_hash<
+             typename std::iterator_traits<KeysInputIterator>::value_type>>
+inline hipError_t hash_table_probe_count(void*                    temporary_storage,
+                                         size_t&                  storage_size,
+                                         void*                    table_storage,
+                                         const size_t             table_storage_size,
+                                         KeysInputIterator        build_keys,
+                                         const size_t             build_size,
+                                         ProbeKeysInputIterator   probe_keys,
+                                         const size_t             probe_size,
+                                         MatchCountOutputIterator match_count_output,
+                                         KeyCompareFunction key_compare_op = KeyCompareFunction(),
+                                         KeyHash            key_hash       = KeyHash(),
+                                         hipStream_t        stream         = 0,
+                                         bool               debug_synchronous = false)
+{
+    return detail::hash_table_probe_count_impl<Config>(temporary_storage,
+                                                       storage_size,
+                                                       table_storage,
+                                                       table_storage_size,
+                                                       build_keys,
+                                                       build_size,
+                                                       probe_keys,
+                                                       probe_size,
+                                                       match_count_output,
+                                                       key_compare_op,
+                                                       key_hash,
+                                                       stream,
+                                                       debug_synchronous);
+}
+
+/// \brief Writes the indices of the pairs of equal build and probe keys of a hash table.
+///
+/// \par Overview
+/// * Every probe key is looked up in the table built by \p hash_table_build. For every build
+/// item with an equal key, the index of the build item is stored to \p build_indices_output
+/// and the index of the probe item to \p probe_indices_output, and the number of pairs is
+/// stored to \p match_count_output.
+/// * The pairs are ordered by probe item. The pairs of one probe item are in an unspecified
+/// order.
+/// * The matches of every probe item are counted first, and their positions in the output are
+/// found by a device-wide exclusive scan of the counts.
+/// * The outputs must be large enough for all pairs; their number can be obtained with
+/// \p hash_table_probe_count.
+/// * The table arguments \p table_storage, \p table_storage_size, \p build_keys, \p build_size,
+/// \p key_compare_op and \p key_hash must be the same as in the call of \p hash_table_build.
+/// * The probe keys are converted to the \p value_type of \p KeysInputIterator.
+/// * \p probe_size must be less than \p 2^32 - 1.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer. The size depends only on \p probe_size.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// \p hash_table_config or a custom class with the same members.
+/// \tparam KeysInputIterator - random-access iterator type of the build keys. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ProbeKeysInputIterator - random-access iterator type of the probe keys. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam BuildIndicesOutputIterator - random-access iterator type of the output range. Must
+/// meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam ProbeIndicesOutputIterator - random-access iterator type of the output range. Must
+/// meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam MatchCountOutputIterator - random-access iterator type of the output range. Must
+/// meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam KeyCompareFunction - type of binary function used to determine keys equality.
+/// \tparam KeyHash - type of the hash function of the keys.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the probe.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] table_storage - pointer to the storage of the table.
+/// \param [in] table_storage_size - size (in bytes) of \p table_storage.
+/// \param [in] build_keys - iterator to the first element in the range of build keys.
+/// \param [in] build_size - number of element in the range of build keys.
+/// \param [in] probe_keys - iterator to the first element in the range of probe keys.
+/// \param [in] probe_size - number of element in the range of probe keys.
+/// \param [out] build_indices_output - iterator to the first element in the output range of
+/// indices of build items.
+/// \param [out] probe_indices_output - iterator to the first element in the output range of
+/// indices of probe items.
+/// \param [out] match_count_output - iterator to the total number of matches.
+/// \param [in] key_compare_op - binary operation function object that will be used to
+/// determine key equality. Default is KeyCompareFunction().
+/// \param [in] key_hash - function object that returns an unsigned integer hash of a key.
+/// Default is KeyHash().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful probe; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class KeysInputIterator,
+         class ProbeKeysInputIterator,
+         class BuildIndicesOutputIterator,
+         class ProbeIndicesOutputIterator,
+         class MatchCountOutputIterator,
+         class KeyCompareFunction
+         = ::rocprim::equal_to<typename std::iterator_traits<KeysInputIterator>::value_type>,
+         class KeyHash = ::rocprim::default_key_hash<
+             typename std::iterator_traits<KeysInputIterator>::value_type>>
+inline hipError_t hash_table_probe(void*                      temporary_storage,
+                                   size_t&                    storage_size,
+                                   void*                      table_storage,
+                                   const size_t               table_storage_size,
+                                   KeysInputIterator          build_keys,
+                                   const size_t               build_size,
+                                   ProbeKeysInputIterator     probe_keys,
+                                   const size_t               probe_size,
+                                   BuildIndicesOutputIterator build_indices_output,
+                                   ProbeIndicesOutputIterator probe_indices_output,
+                                   MatchCountOutputIterator   match_count_output,
+                                   KeyCompareFunction         key_compare_op = KeyCompareFunction(),
+                                   KeyHash                    key_hash       = KeyHash(),
+                                   hipStream_t                stream         = 0,
+                                   bool                       debug_synchronous = false)
+{
+    return detail::hash_table_probe_impl<Config>(temporary_storage,
+                                                 storage_size,
+                                                 table_storage,
+                                                 table_storage_size,
+                                                 build_keys,
+                                                 build_size,
+                                                 probe_keys,
+                                                 probe_size,
+                                                 build_indices_output,
+                                                 probe_indices_output,
+                                                 match_count_output,
+                                                 key_compare_op,
+                                                 key_hash,
+                                                 stream,
+                                                 debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_HASH_TABLE_HPP_
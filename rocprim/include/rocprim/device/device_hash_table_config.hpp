@@ -0,0 +1,108 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_HASH_TABLE_CONFIG_HPP_
+#define ROCPRIM_DEVICE_DEVICE_HASH_TABLE_CONFIG_HPP_
+
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../functional.hpp"
+#include "../detail/various.hpp"
+
+#include "config_types.hpp"
+
+/// \addtogroup primitivesmodule_deviceconfigs
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief Configuration of the kernels of the device-level hash table primitives.
+///
+/// \tparam BlockSize - number of threads in a block.
+/// \tparam ItemsPerThread - number of build or probe items processed by each thread.
+template<unsigned int BlockSize, unsigned int ItemsPerThread>
+struct hash_table_config : kernel_config<BlockSize, ItemsPerThread>
+{};
+
+namespace detail
+{
+
+// Inserts and probes are latency-bound random accesses to the table, so the blocks keep few
+// items per thread and rely on many waves in flight
+template<class Key>
+struct hash_table_config_803
+{
+    static constexpr unsigned int item_scale =
+        ::rocprim::detail::ceiling_div<unsigned int>(sizeof(Key), sizeof(int));
+
+    using type = hash_table_config<256, ::rocprim::max(1u, 4u / item_scale)>;
+};
+
+template<class Key>
+struct hash_table_config_900
+{
+    static constexpr unsigned int item_scale =
+        ::rocprim::detail::ceiling_div<unsigned int>(sizeof(Key), sizeof(int));
+
+    using type = hash_table_config<256, ::rocprim::max(1u, 4u / item_scale)>;
+};
+
+template<class Key>
+struct hash_table_config_90a
+{
+    static constexpr unsigned int item_scale =
+        ::rocprim::detail::ceiling_div<unsigned int>(sizeof(Key), sizeof(int));
+
+    using type = hash_table_config<256, ::rocprim::max(1u, 8u / item_scale)>;
+};
+
+template<class Key>
+struct hash_table_config_1030
+{
+    static constexpr unsigned int item_scale =
+        ::rocprim::detail::ceiling_div<unsigned int>(sizeof(Key), sizeof(int));
+
+    using type = hash_table_config<256, ::rocprim::max(1u, 2u / item_scale)>;
+};
+
+template<unsigned int TargetArch, class Key>
+struct default_hash_table_config
+    : select_arch<
+        TargetArch,
+        select_arch_case<803, hash_table_config_803<Key>>,
+        select_arch_case<900, hash_table_config_900<Key>>,
+        select_arch_case<ROCPRIM_ARCH_90a, hash_table_config_90a<Key>>,
+        select_arch_case<940, hash_table_config_90a<Key>>,
+        select_arch_case<941, hash_table_config_90a<Key>>,
+        select_arch_case<942, hash_table_config_90a<Key>>,
+        select_arch_case<1030, hash_table_config_1030<Key>>,
+        select_arch_case<1100, hash_table_config_1030<Key>>,
+        hash_table_config_900<Key>
+    > { };
+
+} // end namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group primitivesmodule_deviceconfigs
+
+#endif // ROCPRIM_DEVICE_DEVICE_HASH_TABLE_CONFIG_HPP_
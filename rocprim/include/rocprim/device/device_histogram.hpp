@@ -24,14 +24,22 @@
 #include <cmath>
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <type_traits>
 
 #include "../config.hpp"
+#include "../detail/temp_storage.hpp"
 #include "../detail/various.hpp"
 #include "../functional.hpp"
+#include "../iterator/counting_iterator.hpp"
+#include "../iterator/transform_iterator.hpp"
 
 #include "detail/device_histogram.hpp"
+#include "call_info.hpp"
+#include "detail/config/device_histogram.hpp"
 #include "device_histogram_config.hpp"
+#include "device_radix_sort.hpp"
+#include "instrumentation.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -53,23 +61,73 @@ template<unsigned int BlockSize,
          unsigned int Channels,
          unsigned int ActiveChannels,
          unsigned int SharedHistograms,
+         bool         WarpAggregation,
          class SampleIterator,
+         class WeightIterator,
          class Counter,
          class SampleToBinOp>
 ROCPRIM_KERNEL __launch_bounds__(BlockSize) void histogram_shared_kernel(
     SampleIterator                             samples,
+    WeightIterator                             weights,
     unsigned int                               columns,
     unsigned int                               rows,
     unsigned int                               row_stride,
     unsigned int                               rows_per_block,
     fixed_array<Counter*, ActiveChannels>      histogram,
     fixed_array<SampleToBinOp, ActiveChannels> sample_to_bin_op,
-    fixed_array<unsigned int, ActiveChannels>  bins)
+    fixed_array<unsigned int, ActiveChannels>  bins,
+    fixed_array<unsigned int, ActiveChannels>  bins_bits)
+{
+    using bin_type = typename histogram_bin_type<WeightIterator, Counter>::type;
+
+    HIP_DYNAMIC_SHARED(unsigned int, block_histogram);
+
+    histogram_shared<BlockSize,
+                     ItemsPerThread,
+                     Channels,
+                     ActiveChannels,
+                     SharedHistograms,
+                     WarpAggregation>(
+        samples,
+        weights,
+        columns,
+        rows,
+        row_stride,
+        rows_per_block,
+        histogram,
+        sample_to_bin_op,
+        bins,
+        bins_bits,
+        reinterpret_cast<bin_type*>(block_histogram));
+}
+
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         unsigned int Channels,
+         unsigned int ActiveChannels,
+         class SampleIterator,
+         class WeightIterator,
+         class Counter,
+         class SampleToBinOp>
+ROCPRIM_KERNEL __launch_bounds__(BlockSize) void histogram_shared_window_kernel(
+    SampleIterator                             samples,
+    WeightIterator                             weights,
+    unsigned int                               columns,
+    unsigned int                               rows,
+    unsigned int                               row_stride,
+    unsigned int                               rows_per_block,
+    fixed_array<Counter*, ActiveChannels>      histogram,
+    fixed_array<SampleToBinOp, ActiveChannels> sample_to_bin_op,
+    fixed_array<unsigned int, ActiveChannels>  bins,
+    unsigned int                               window_bins)
 {
+    using bin_type = typename histogram_bin_type<WeightIterator, Counter>::type;
+
     HIP_DYNAMIC_SHARED(unsigned int, block_histogram);
 
-    histogram_shared<BlockSize, ItemsPerThread, Channels, ActiveChannels, SharedHistograms>(
+    histogram_shared_window<BlockSize, ItemsPerThread, Channels, ActiveChannels>(
         samples,
+        weights,
         columns,
         rows,
         row_stride,
@@ -77,26 +135,43 @@ ROCPRIM_KERNEL __launch_bounds__(BlockSize) void histogram_shared_kernel(
         histogram,
         sample_to_bin_op,
         bins,
-        block_histogram);
+        window_bins,
+        reinterpret_cast<bin_type*>(block_histogram));
 }
 
+template<unsigned int BlockSize, class Counter>
+ROCPRIM_KERNEL __launch_bounds__(BlockSize) void histogram_sort_counts_kernel(
+    const unsigned int* sorted_bins, size_t size, Counter* histogram, unsigned int bins)
+{
+    histogram_sort_counts<BlockSize>(sorted_bins, size, histogram, bins);
+}
+
+// The samples are read once for every window of bins, so the windowed shared memory
+// histogram is only used up to this many windows, the global histogram is used above.
+constexpr unsigned int histogram_shared_max_windows = 32;
+
 template<unsigned int BlockSize,
          unsigned int ItemsPerThread,
          unsigned int Channels,
          unsigned int ActiveChannels,
          class SampleIterator,
+         class WeightIterator,
          class Counter,
          class SampleToBinOp>
 ROCPRIM_KERNEL __launch_bounds__(BlockSize) void histogram_global_kernel(
     SampleIterator                             samples,
+    WeightIterator                             weights,
     unsigned int                               columns,
+    unsigned int                               rows,
     unsigned int                               row_stride,
     fixed_array<Counter*, ActiveChannels>      histogram,
     fixed_array<SampleToBinOp, ActiveChannels> sample_to_bin_op,
     fixed_array<unsigned int, ActiveChannels>  bins_bits)
 {
     histogram_global<BlockSize, ItemsPerThread, Channels, ActiveChannels>(samples,
+                                                                          weights,
                                                                           columns,
+                                                                          rows,
                                                                           row_stride,
                                                                           histogram,
                                                                           sample_to_bin_op,
@@ -108,6 +183,7 @@ ROCPRIM_KERNEL __launch_bounds__(BlockSize) void histogram_global_kernel(
         auto _error = hipGetLastError();                                                         \
         if(_error != hipSuccess)                                                                 \
             return _error;                                                                       \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size);                                          \
         if(debug_synchronous)                                                                    \
         {                                                                                        \
             std::cout << name << "(" << size << ")";                                             \
@@ -124,25 +200,30 @@ template<unsigned int Channels,
          unsigned int ActiveChannels,
          class Config,
          class SampleIterator,
+         class WeightIterator,
          class Counter,
          class SampleToBinOp>
-inline hipError_t histogram_impl(void*          temporary_storage,
-                                 size_t&        storage_size,
-                                 SampleIterator samples,
-                                 unsigned int   columns,
-                                 unsigned int   rows,
-                                 size_t         row_stride_bytes,
-                                 Counter*       histogram[ActiveChannels],
-                                 unsigned int   levels[ActiveChannels],
-                                 SampleToBinOp  sample_to_bin_op[ActiveChannels],
-                                 hipStream_t    stream,
-                                 bool           debug_synchronous)
+inline hipError_t
+    histogram_impl(std::integral_constant<histogram_algorithm, histogram_algorithm::using_atomic>,
+                   void*          temporary_storage,
+                   size_t&        storage_size,
+                   SampleIterator samples,
+                   WeightIterator weights,
+                   unsigned int   columns,
+                   unsigned int   rows,
+                   size_t         row_stride_bytes,
+                   Counter*       histogram[ActiveChannels],
+                   unsigned int   levels[ActiveChannels],
+                   SampleToBinOp  sample_to_bin_op[ActiveChannels],
+                   hipStream_t    stream,
+                   bool           debug_synchronous,
+                   bool           accumulate)
 {
     using sample_type = typename std::iterator_traits<SampleIterator>::value_type;
 
-    using config = default_or_custom_config<
-        Config,
-        default_histogram_config<ROCPRIM_TARGET_ARCH, sample_type, Channels, ActiveChannels>>;
+    using bin_type    = typename histogram_bin_type<WeightIterator, Counter>::type;
+
+    using config = Config;
 
     static constexpr unsigned int block_size       = config::histogram::block_size;
     static constexpr unsigned int items_per_thread = config::histogram::items_per_thread;
@@ -192,57 +273,138 @@ inline hipError_t histogram_impl(void*          temporary_storage,
 
     std::chrono::high_resolution_clock::time_point start;
 
-    if(debug_synchronous)
+    // All algorithms add to the bins, so accumulating only skips their initialization
+    if(!accumulate)
     {
-        start = std::chrono::high_resolution_clock::now();
+        if(debug_synchronous)
+        {
+            start = std::chrono::high_resolution_clock::now();
+        }
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("init_histogram");
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(init_histogram_kernel<block_size, ActiveChannels>),
+                           dim3(apply_grid_limit(::rocprim::detail::ceiling_div(max_bins,
+                                                                                block_size))),
+                           dim3(block_size),
+                           0,
+                           stream,
+                           fixed_array<Counter*, ActiveChannels>(histogram),
+                           fixed_array<unsigned int, ActiveChannels>(bins));
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_histogram", max_bins, start);
     }
-    hipLaunchKernelGGL(HIP_KERNEL_NAME(init_histogram_kernel<block_size, ActiveChannels>),
-                       dim3(::rocprim::detail::ceiling_div(max_bins, block_size)),
-                       dim3(block_size),
-                       0,
-                       stream,
-                       fixed_array<Counter*, ActiveChannels>(histogram),
-                       fixed_array<unsigned int, ActiveChannels>(bins));
-    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_histogram", max_bins, start);
 
     if(columns == 0 || rows == 0)
     {
         return hipSuccess;
     }
 
+    const unsigned int window_bins
+        = config::shared_impl_max_bins * config::shared_impl_histograms / ActiveChannels;
+    const unsigned int windows = ::rocprim::detail::ceiling_div(max_bins, window_bins);
+
+    // Every pass reads all samples
+    const size_t samples_bytes = size_t(columns) * rows * Channels * sizeof(sample_type);
+
+    // The blocks of a grid limited by blocks_per_cu or scoped_grid_limit count multiple tiles
+    // of samples
+    unsigned int     max_grid_size = config::max_grid_size;
+    const hipError_t grid_result
+        = limit_grid_size(max_grid_size, config_blocks_per_cu<config>::value);
+    if(grid_result != hipSuccess)
+    {
+        return grid_result;
+    }
+
     if(total_bins <= config::shared_impl_max_bins)
     {
         dim3 grid_size;
-        grid_size.x = std::min(config::max_grid_size, blocks_x);
-        grid_size.y = std::min(rows, config::max_grid_size / grid_size.x);
-        const size_t       block_histogram_bytes = total_bins * sizeof(unsigned int);
+        grid_size.x = std::min(max_grid_size, blocks_x);
+        grid_size.y = std::min(rows, max_grid_size / grid_size.x);
+        const size_t       block_histogram_bytes = total_bins * sizeof(bin_type);
         const unsigned int rows_per_block = ::rocprim::detail::ceiling_div(rows, grid_size.y);
         if(debug_synchronous)
         {
             start = std::chrono::high_resolution_clock::now();
         }
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("histogram_shared");
         // use config::shared_impl_histograms histograms in shared memory to reduce bank conflicts
         // for the case of samples concentrated in one bin
         hipLaunchKernelGGL(HIP_KERNEL_NAME(histogram_shared_kernel<block_size,
                                                                    items_per_thread,
                                                                    Channels,
                                                                    ActiveChannels,
-                                                                   config::shared_impl_histograms>),
+                                                                   config::shared_impl_histograms,
+                                                                   config::shared_impl_warp_aggregation>),
                            grid_size,
                            dim3(block_size, 1),
                            config::shared_impl_histograms * block_histogram_bytes,
                            stream,
                            samples,
+                           weights,
                            columns,
                            rows,
                            row_stride,
                            rows_per_block,
                            fixed_array<Counter*, ActiveChannels>(histogram),
                            fixed_array<SampleToBinOp, ActiveChannels>(sample_to_bin_op),
-                           fixed_array<unsigned int, ActiveChannels>(bins));
+                           fixed_array<unsigned int, ActiveChannels>(bins),
+                           fixed_array<unsigned int, ActiveChannels>(bins_bits));
         ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("histogram_shared",
                                                     grid_size.x * grid_size.y * block_size,
                                                     start);
+        // Every block adds its histograms to the output
+        record_call_info("histogram",
+                         "shared",
+                         1,
+                         false,
+                         samples_bytes,
+                         size_t(grid_size.x) * grid_size.y * total_bins * sizeof(Counter));
+    }
+    else if(windows <= histogram_shared_max_windows)
+    {
+        // Every block counts one window of bins of each channel in a single shared
+        // histogram, the shared memory of the shared_impl_histograms copies is used
+        // for the window instead
+        dim3 grid_size;
+        grid_size.x = std::min(max_grid_size, blocks_x);
+        grid_size.y = std::min(rows, max_grid_size / grid_size.x);
+        grid_size.z = windows;
+        const unsigned int rows_per_block = ::rocprim::detail::ceiling_div(rows, grid_size.y);
+        if(debug_synchronous)
+        {
+            start = std::chrono::high_resolution_clock::now();
+        }
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("histogram_shared_window");
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(histogram_shared_window_kernel<block_size,
+                                                           items_per_thread,
+                                                           Channels,
+                                                           ActiveChannels>),
+            grid_size,
+            dim3(block_size, 1),
+            ActiveChannels * window_bins * sizeof(bin_type),
+            stream,
+            samples,
+            weights,
+            columns,
+            rows,
+            row_stride,
+            rows_per_block,
+            fixed_array<Counter*, ActiveChannels>(histogram),
+            fixed_array<SampleToBinOp, ActiveChannels>(sample_to_bin_op),
+            fixed_array<unsigned int, ActiveChannels>(bins),
+            window_bins);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("histogram_shared_window",
+                                                    grid_size.x * grid_size.y * grid_size.z
+                                                        * block_size,
+                                                    start);
+        // The samples are read once for every window
+        record_call_info("histogram",
+                         "shared_window",
+                         windows,
+                         false,
+                         windows * samples_bytes,
+                         size_t(grid_size.x) * grid_size.y * grid_size.z * ActiveChannels
+                             * window_bins * sizeof(Counter));
     }
     else
     {
@@ -250,15 +412,24 @@ inline hipError_t histogram_impl(void*          temporary_storage,
         {
             start = std::chrono::high_resolution_clock::now();
         }
+        dim3 grid_size(blocks_x, rows);
+        if(config_blocks_per_cu<config>::value > 0 || get_grid_limit() > 0)
+        {
+            grid_size.x = std::min(max_grid_size, blocks_x);
+            grid_size.y = std::min(rows, max_grid_size / grid_size.x);
+        }
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("histogram_global");
         hipLaunchKernelGGL(
             HIP_KERNEL_NAME(
                 histogram_global_kernel<block_size, items_per_thread, Channels, ActiveChannels>),
-            dim3(blocks_x, rows),
+            grid_size,
             dim3(block_size, 1),
             0,
             stream,
             samples,
+            weights,
             columns,
+            rows,
             row_stride,
             fixed_array<Counter*, ActiveChannels>(histogram),
             fixed_array<SampleToBinOp, ActiveChannels>(sample_to_bin_op),
@@ -266,6 +437,13 @@ inline hipError_t histogram_impl(void*          temporary_storage,
         ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("histogram_global",
                                                     blocks_x * block_size * rows,
                                                     start);
+        // Every sample is added to the output by an atomic operation
+        record_call_info("histogram",
+                         "global",
+                         1,
+                         false,
+                         samples_bytes,
+                         size_t(columns) * rows * ActiveChannels * sizeof(Counter));
     }
 
     return hipSuccess;
@@ -276,10 +454,221 @@ template<unsigned int Channels,
          class Config,
          class SampleIterator,
          class Counter,
+         class SampleToBinOp>
+inline hipError_t
+    histogram_impl(std::integral_constant<histogram_algorithm, histogram_algorithm::using_sort>,
+                   void*                  temporary_storage,
+                   size_t&                storage_size,
+                   SampleIterator         samples,
+                   histogram_unit_weights /* weights */,
+                   unsigned int           columns,
+                   unsigned int           rows,
+                   size_t                 row_stride_bytes,
+                   Counter*               histogram[ActiveChannels],
+                   unsigned int           levels[ActiveChannels],
+                   SampleToBinOp          sample_to_bin_op[ActiveChannels],
+                   hipStream_t            stream,
+                   bool                   debug_synchronous,
+                   bool                   accumulate)
+{
+    using sample_type = typename std::iterator_traits<SampleIterator>::value_type;
+
+    using config = Config;
+
+    static constexpr unsigned int block_size = config::histogram::block_size;
+
+    if(row_stride_bytes % sizeof(sample_type) != 0)
+    {
+        // Row stride must be a whole multiple of the sample data type size
+        return hipErrorInvalidValue;
+    }
+
+    const unsigned int row_stride = row_stride_bytes / sizeof(sample_type);
+    const size_t       size       = static_cast<size_t>(columns) * rows;
+
+    unsigned int bins[ActiveChannels];
+    unsigned int max_bins = 0;
+    for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+    {
+        bins[channel] = levels[channel] - 1;
+        max_bins      = std::max(max_bins, bins[channel]);
+    }
+    // Samples outside of the histogram have the bin index bins, so it must be sorted too
+    const unsigned int end_bit
+        = static_cast<unsigned int>(std::log2(detail::next_power_of_two(max_bins + 1)));
+
+    using key_op_type = histogram_sort_key_op<Channels, SampleIterator, SampleToBinOp>;
+    const auto get_keys_input = [&](unsigned int channel)
+    {
+        return ::rocprim::make_transform_iterator(
+            ::rocprim::make_counting_iterator<size_t>(0),
+            key_op_type{samples,
+                        columns,
+                        row_stride,
+                        channel,
+                        sample_to_bin_op[channel],
+                        bins[channel]});
+    };
+
+    size_t        sort_storage_size;
+    unsigned int* sorted_bins = nullptr;
+    hipError_t    error       = ::rocprim::radix_sort_keys(nullptr,
+                                                   sort_storage_size,
+                                                   get_keys_input(0),
+                                                   sorted_bins,
+                                                   size,
+                                                   0,
+                                                   end_bit,
+                                                   stream,
+                                                   debug_synchronous);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    void*            sort_storage;
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&sorted_bins, size),
+            detail::temp_storage::make_partition(&sort_storage, sort_storage_size)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    // All algorithms add to the bins, so accumulating only skips their initialization
+    if(!accumulate)
+    {
+        if(debug_synchronous)
+        {
+            start = std::chrono::high_resolution_clock::now();
+        }
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("init_histogram");
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(init_histogram_kernel<block_size, ActiveChannels>),
+                           dim3(apply_grid_limit(::rocprim::detail::ceiling_div(max_bins,
+                                                                                block_size))),
+                           dim3(block_size),
+                           0,
+                           stream,
+                           fixed_array<Counter*, ActiveChannels>(histogram),
+                           fixed_array<unsigned int, ActiveChannels>(bins));
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_histogram", max_bins, start);
+    }
+
+    if(size == 0)
+    {
+        return hipSuccess;
+    }
+
+    // The traffic of the sorts is reported by them, every sorted channel is read once more
+    size_t bytes_read    = 0;
+    size_t bytes_written = 0;
+    for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+    {
+        // The bin indices are computed while the first pass of the sort loads the samples
+        error = ::rocprim::radix_sort_keys(sort_storage,
+                                           sort_storage_size,
+                                           get_keys_input(channel),
+                                           sorted_bins,
+                                           size,
+                                           0,
+                                           end_bit,
+                                           stream,
+                                           debug_synchronous);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        bytes_read += get_call_info().bytes_read + size * sizeof(unsigned int);
+        bytes_written += get_call_info().bytes_written + bins[channel] * sizeof(Counter);
+
+        if(debug_synchronous)
+        {
+            start = std::chrono::high_resolution_clock::now();
+        }
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("histogram_sort_counts");
+        // One more thread for the end of the last run
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(histogram_sort_counts_kernel<block_size>),
+                           dim3(::rocprim::detail::ceiling_div(size + 1, size_t(block_size))),
+                           dim3(block_size),
+                           0,
+                           stream,
+                           sorted_bins,
+                           size,
+                           histogram[channel],
+                           bins[channel]);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("histogram_sort_counts", size + 1, start);
+    }
+    record_call_info("histogram", "sort", ActiveChannels, false, bytes_read, bytes_written);
+
+    return hipSuccess;
+}
+
+template<unsigned int Channels,
+         unsigned int ActiveChannels,
+         class Config,
+         class SampleIterator,
+         class WeightIterator,
+         class Counter,
+         class SampleToBinOp>
+inline hipError_t histogram_impl(void*          temporary_storage,
+                                 size_t&        storage_size,
+                                 SampleIterator samples,
+                                 WeightIterator weights,
+                                 unsigned int   columns,
+                                 unsigned int   rows,
+                                 size_t         row_stride_bytes,
+                                 Counter*       histogram[ActiveChannels],
+                                 unsigned int   levels[ActiveChannels],
+                                 SampleToBinOp  sample_to_bin_op[ActiveChannels],
+                                 hipStream_t    stream,
+                                 bool           debug_synchronous,
+                                 bool           accumulate = false)
+{
+    using sample_type = typename std::iterator_traits<SampleIterator>::value_type;
+
+    using config = default_or_custom_config<
+        Config,
+        default_histogram_config<ROCPRIM_TARGET_ARCH, sample_type, Channels, ActiveChannels>>;
+
+    // Weighted histograms are always computed by the atomic algorithm
+    static constexpr histogram_algorithm algorithm
+        = std::is_same<WeightIterator, histogram_unit_weights>::value
+              ? config::algorithm
+              : histogram_algorithm::using_atomic;
+
+    return histogram_impl<Channels, ActiveChannels, config>(
+        std::integral_constant<histogram_algorithm, algorithm>{},
+        temporary_storage,
+        storage_size,
+        to_kernel_input_iterator(samples),
+        to_kernel_input_iterator(weights),
+        columns,
+        rows,
+        row_stride_bytes,
+        histogram,
+        levels,
+        sample_to_bin_op,
+        stream,
+        debug_synchronous,
+        accumulate);
+}
+
+template<unsigned int Channels,
+         unsigned int ActiveChannels,
+         class Config,
+         class SampleIterator,
+         class WeightIterator,
+         class Counter,
          class Level>
 inline hipError_t histogram_even_impl(void*          temporary_storage,
                                       size_t&        storage_size,
                                       SampleIterator samples,
+                                      WeightIterator weights,
                                       unsigned int   columns,
                                       unsigned int   rows,
                                       size_t         row_stride_bytes,
@@ -288,7 +677,8 @@ inline hipError_t histogram_even_impl(void*          temporary_storage,
                                       Level          lower_level[ActiveChannels],
                                       Level          upper_level[ActiveChannels],
                                       hipStream_t    stream,
-                                      bool           debug_synchronous)
+                                      bool           debug_synchronous,
+                                      bool           accumulate = false)
 {
     for(unsigned int channel = 0; channel < ActiveChannels; channel++)
     {
@@ -310,6 +700,7 @@ inline hipError_t histogram_even_impl(void*          temporary_storage,
     return histogram_impl<Channels, ActiveChannels, Config>(temporary_storage,
                                                             storage_size,
                                                             samples,
+                                                            weights,
                                                             columns,
                                                             rows,
                                                             row_stride_bytes,
@@ -317,18 +708,21 @@ inline hipError_t histogram_even_impl(void*          temporary_storage,
                                                             levels,
                                                             sample_to_bin_op,
                                                             stream,
-                                                            debug_synchronous);
+                                                            debug_synchronous,
+                                                            accumulate);
 }
 
 template<unsigned int Channels,
          unsigned int ActiveChannels,
          class Config,
          class SampleIterator,
+         class WeightIterator,
          class Counter,
          class Level>
 inline hipError_t histogram_range_impl(void*          temporary_storage,
                                        size_t&        storage_size,
                                        SampleIterator samples,
+                                       WeightIterator weights,
                                        unsigned int   columns,
                                        unsigned int   rows,
                                        size_t         row_stride_bytes,
@@ -336,7 +730,8 @@ inline hipError_t histogram_range_impl(void*          temporary_storage,
                                        unsigned int   levels[ActiveChannels],
                                        Level*         level_values[ActiveChannels],
                                        hipStream_t    stream,
-                                       bool           debug_synchronous)
+                                       bool           debug_synchronous,
+                                       bool           accumulate = false)
 {
     for(unsigned int channel = 0; channel < ActiveChannels; channel++)
     {
@@ -357,6 +752,7 @@ inline hipError_t histogram_range_impl(void*          temporary_storage,
     return histogram_impl<Channels, ActiveChannels, Config>(temporary_storage,
                                                             storage_size,
                                                             samples,
+                                                            weights,
                                                             columns,
                                                             rows,
                                                             row_stride_bytes,
@@ -364,7 +760,8 @@ inline hipError_t histogram_range_impl(void*          temporary_storage,
                                                             levels,
                                                             sample_to_bin_op,
                                                             stream,
-                                                            debug_synchronous);
+                                                            debug_synchronous,
+                                                            accumulate);
 }
 
 #undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
@@ -460,6 +857,226 @@ inline hipError_t histogram_even(void*          temporary_storage,
     return detail::histogram_even_impl<1, 1, Config>(temporary_storage,
                                                      storage_size,
                                                      samples,
+                                                     detail::histogram_unit_weights(),
+                                                     size,
+                                                     1,
+                                                     0,
+                                                     histogram_single,
+                                                     levels_single,
+                                                     lower_level_single,
+                                                     upper_level_single,
+                                                     stream,
+                                                     debug_synchronous);
+}
+
+/// \brief Adds the samples to a histogram using equal-width bins.
+///
+/// \par
+/// * The bins are the bins of \p histogram_even.
+/// * The samples are added to the current values of the bins of \p histogram, they are not
+/// initialized to zero. This skips the launch of the initialization, and a stream of batches
+/// can be counted into the same bins by one call per batch.
+/// * \p Counter can be \p unsigned \p long \p long, so that long-running accumulations
+/// do not overflow the bins.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p histogram_config or
+/// a custom class with the same members.
+/// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam Counter - integer type for histogram bin counters.
+/// \tparam Level - type of histogram boundaries (levels)
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the histogram operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] samples - iterator to the first element in the range of input samples.
+/// \param [in] size - number of elements in the samples range.
+/// \param [in,out] histogram - pointer to the first element in the histogram range, the counts
+/// of the samples are added to it.
+/// \param [in] levels - number of boundaries (levels) for histogram bins.
+/// \param [in] lower_level - lower sample value bound (inclusive) for the first histogram bin.
+/// \param [in] upper_level - upper sample value bound (exclusive) for the last histogram bin.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime
+/// error of type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int size;               // e.g., 4
+/// float * samples;                 // e.g., [0.3, 9.5, 8.1, 1.5]
+/// unsigned long long * histogram;  // e.g., [3, 0, 1, 0, 2]
+/// unsigned int levels;             // e.g., 6 (for 5 bins)
+/// float lower_level;               // e.g., 0.0
+/// float upper_level;               // e.g., 10.0
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::histogram_even_accumulate(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, size,
+///     histogram, levels, lower_level, upper_level
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // add the samples to the histogram
+/// rocprim::histogram_even_accumulate(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, size,
+///     histogram, levels, lower_level, upper_level
+/// );
+/// // histogram: [5, 0, 1, 0, 4]
+/// \endcode
+/// \endparblock
+template<class Config = default_config, class SampleIterator, class Counter, class Level>
+inline hipError_t histogram_even_accumulate(void*          temporary_storage,
+                                            size_t&        storage_size,
+                                            SampleIterator samples,
+                                            unsigned int   size,
+                                            Counter*       histogram,
+                                            unsigned int   levels,
+                                            Level          lower_level,
+                                            Level          upper_level,
+                                            hipStream_t    stream            = 0,
+                                            bool           debug_synchronous = false)
+{
+    Counter*     histogram_single[1]   = {histogram};
+    unsigned int levels_single[1]      = {levels};
+    Level        lower_level_single[1] = {lower_level};
+    Level        upper_level_single[1] = {upper_level};
+
+    return detail::histogram_even_impl<1, 1, Config>(temporary_storage,
+                                                     storage_size,
+                                                     samples,
+                                                     detail::histogram_unit_weights(),
+                                                     size,
+                                                     1,
+                                                     0,
+                                                     histogram_single,
+                                                     levels_single,
+                                                     lower_level_single,
+                                                     upper_level_single,
+                                                     stream,
+                                                     debug_synchronous,
+                                                     true);
+}
+
+/// \brief Computes a weighted histogram from a sequence of samples using equal-width bins.
+///
+/// \par
+/// * Every sample adds its weight to its bin, so a bin is the sum of the weights of its samples.
+/// * The number of histogram bins is (\p levels - 1).
+/// * Bins are evenly-segmented and include the same width of sample values:
+/// (\p upper_level - \p lower_level) / (\p levels - 1).
+/// * Weighted histograms are always computed by <tt>histogram_algorithm::using_atomic</tt>,
+/// the \p algorithm of \p Config is ignored.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p histogram_config or
+/// a custom class with the same members.
+/// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam WeightIterator - random-access iterator type of the weights range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam Counter - type of histogram bins, it must support atomic addition: \p float,
+/// \p int, <tt>unsigned int</tt> or <tt>unsigned long long</tt>.
+/// \tparam Level - type of histogram boundaries (levels)
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] samples - iterator to the first element in the range of input samples.
+/// \param [in] weights - iterator to the first element in the range of weights of the samples.
+/// \param [in] size - number of elements in the samples range.
+/// \param [out] histogram - pointer to the first element in the histogram range.
+/// \param [in] levels - number of boundaries (levels) for histogram bins.
+/// \param [in] lower_level - lower sample value bound (inclusive) for the first histogram bin.
+/// \param [in] upper_level - upper sample value bound (exclusive) for the last histogram bin.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level weighted histogram of 5 bins is computed on an array of
+/// float samples.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int size;        // e.g., 8
+/// float * samples;          // e.g., [-10.0, 0.3, 9.5, 8.1, 9.0, -1.0, 3.0, 11.0]
+/// float * weights;          // e.g., [  1.0, 0.5, 2.0, 1.5, 1.0,  3.0, 0.5,  4.0]
+/// float * histogram;        // empty array of at least 5 elements
+/// unsigned int levels;      // e.g., 6 (for 5 bins)
+/// float lower_level;        // e.g., 2.0
+/// float upper_level;        // e.g., 12.0
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::histogram_even_weighted(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, weights, size,
+///     histogram, levels, lower_level, upper_level
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // compute histogram
+/// rocprim::histogram_even_weighted(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, weights, size,
+///     histogram, levels, lower_level, upper_level
+/// );
+/// // histogram: [0.5, 0.0, 0.0, 4.5, 4.0]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class SampleIterator,
+         class WeightIterator,
+         class Counter,
+         class Level>
+inline hipError_t histogram_even_weighted(void*          temporary_storage,
+                                          size_t&        storage_size,
+                                          SampleIterator samples,
+                                          WeightIterator weights,
+                                          unsigned int   size,
+                                          Counter*       histogram,
+                                          unsigned int   levels,
+                                          Level          lower_level,
+                                          Level          upper_level,
+                                          hipStream_t    stream            = 0,
+                                          bool           debug_synchronous = false)
+{
+    Counter*     histogram_single[1]   = {histogram};
+    unsigned int levels_single[1]      = {levels};
+    Level        lower_level_single[1] = {lower_level};
+    Level        upper_level_single[1] = {upper_level};
+
+    return detail::histogram_even_impl<1, 1, Config>(temporary_storage,
+                                                     storage_size,
+                                                     samples,
+                                                     weights,
                                                      size,
                                                      1,
                                                      0,
@@ -570,6 +1187,7 @@ inline hipError_t histogram_even(void*          temporary_storage,
     return detail::histogram_even_impl<1, 1, Config>(temporary_storage,
                                                      storage_size,
                                                      samples,
+                                                     detail::histogram_unit_weights(),
                                                      columns,
                                                      rows,
                                                      row_stride_bytes,
@@ -608,7 +1226,197 @@ inline hipError_t histogram_even(void*          temporary_storage,
 /// \p storage_size and function returns without performing the reduction operation.
 /// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
 /// \param [in] samples - iterator to the first element in the range of input samples.
-/// \param [in] size - number of pixels in the samples range.
+/// \param [in] size - number of pixels in the samples range.
+/// \param [out] histogram - pointers to the first element in the histogram range, one for each active channel.
+/// \param [in] levels - number of boundaries (levels) for histogram bins in each active channel.
+/// \param [in] lower_level - lower sample value bound (inclusive) for the first histogram bin in each active channel.
+/// \param [in] upper_level - upper sample value bound (exclusive) for the last histogram bin in each active channel.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example histograms for 3 channels (RGB) are computed on an array of 8-bit RGBA samples.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int size;        // e.g., 8
+/// unsigned char * samples;  // e.g., [(3, 1, 5, 255), (3, 1, 5, 255), (4, 2, 6, 127), (3, 2, 6, 127),
+///                           //        (0, 0, 0, 100), (0, 1, 0, 100), (0, 0, 1, 255), (0, 1, 1, 255)]
+/// int * histogram[3];       // 3 empty arrays of at least 256 elements each
+/// unsigned int levels[3];   // e.g., [257, 257, 257] (for 256 bins)
+/// int lower_level[3];       // e.g., [0, 0, 0]
+/// int upper_level[3];       // e.g., [256, 256, 256]
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::multi_histogram_even<4, 3>(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, size,
+///     histogram, levels, lower_level, upper_level
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // compute histograms
+/// rocprim::multi_histogram_even<4, 3>(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, size,
+///     histogram, levels, lower_level, upper_level
+/// );
+/// // histogram: [[4, 0, 0, 3, 1, 0, 0, ..., 0],
+/// //             [2, 4, 2, 0, 0, 0, 0, ..., 0],
+/// //             [2, 2, 0, 0, 0, 2, 2, ..., 0]]
+/// \endcode
+/// \endparblock
+template<unsigned int Channels,
+         unsigned int ActiveChannels,
+         class Config = default_config,
+         class SampleIterator,
+         class Counter,
+         class Level>
+inline hipError_t multi_histogram_even(void*          temporary_storage,
+                                       size_t&        storage_size,
+                                       SampleIterator samples,
+                                       unsigned int   size,
+                                       Counter*       histogram[ActiveChannels],
+                                       unsigned int   levels[ActiveChannels],
+                                       Level          lower_level[ActiveChannels],
+                                       Level          upper_level[ActiveChannels],
+                                       hipStream_t    stream            = 0,
+                                       bool           debug_synchronous = false)
+{
+    return detail::histogram_even_impl<Channels, ActiveChannels, Config>(temporary_storage,
+                                                                         storage_size,
+                                                                         samples,
+                                                                         detail::histogram_unit_weights(),
+                                                                         size,
+                                                                         1,
+                                                                         0,
+                                                                         histogram,
+                                                                         levels,
+                                                                         lower_level,
+                                                                         upper_level,
+                                                                         stream,
+                                                                         debug_synchronous);
+}
+
+/// \brief Adds the multi-channel samples to histograms using equal-width bins.
+///
+/// \par
+/// * The bins are the bins of \p multi_histogram_even.
+/// * The samples are added to the current values of the bins of \p histogram, they are not
+/// initialized to zero. This skips the launch of the initialization, and a stream of batches
+/// can be counted into the same bins by one call per batch.
+/// * \p Counter can be \p unsigned \p long \p long, so that long-running accumulations
+/// do not overflow the bins.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Channels - number of channels interleaved in the input samples.
+/// \tparam ActiveChannels - number of channels being used for computing histograms.
+/// \tparam Config - [optional] configuration of the primitive. It can be \p histogram_config or
+/// a custom class with the same members.
+/// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam Counter - integer type for histogram bin counters.
+/// \tparam Level - type of histogram boundaries (levels)
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the histogram operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] samples - iterator to the first element in the range of input samples.
+/// \param [in] size - number of pixels in the samples range.
+/// \param [in,out] histogram - pointers to the first element in the histogram range, one for
+/// each active channel, the counts of the samples are added to them.
+/// \param [in] levels - number of boundaries (levels) for histogram bins in each active channel.
+/// \param [in] lower_level - lower sample value bound (inclusive) for the first histogram bin in
+/// each active channel.
+/// \param [in] upper_level - upper sample value bound (exclusive) for the last histogram bin in
+/// each active channel.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime
+/// error of type \p hipError_t.
+template<unsigned int Channels,
+         unsigned int ActiveChannels,
+         class Config = default_config,
+         class SampleIterator,
+         class Counter,
+         class Level>
+inline hipError_t multi_histogram_even_accumulate(void*          temporary_storage,
+                                                  size_t&        storage_size,
+                                                  SampleIterator samples,
+                                                  unsigned int   size,
+                                                  Counter*       histogram[ActiveChannels],
+                                                  unsigned int   levels[ActiveChannels],
+                                                  Level          lower_level[ActiveChannels],
+                                                  Level          upper_level[ActiveChannels],
+                                                  hipStream_t    stream            = 0,
+                                                  bool           debug_synchronous = false)
+{
+    return detail::histogram_even_impl<Channels, ActiveChannels, Config>(
+        temporary_storage,
+        storage_size,
+        samples,
+        detail::histogram_unit_weights(),
+        size,
+        1,
+        0,
+        histogram,
+        levels,
+        lower_level,
+        upper_level,
+        stream,
+        debug_synchronous,
+        true);
+}
+
+/// \brief Computes histograms from a two-dimensional region of multi-channel samples using equal-width bins.
+///
+/// \par
+/// * The two-dimensional region of interest within \p samples can be specified using the \p columns,
+/// \p rows and \p row_stride_bytes parameters.
+/// * The row stride must be a whole multiple of the sample data type size,
+/// i.e., <tt>(row_stride_bytes % sizeof(std::iterator_traits<SampleIterator>::value_type)) == 0</tt>.
+/// * The input is a sequence of <em>pixel</em> structures, where each pixel comprises
+/// a record of \p Channels consecutive data samples (e.g., \p Channels = 4 for <em>RGBA</em> samples).
+/// * The first \p ActiveChannels channels of total \p Channels channels will be used for computing histograms
+/// (e.g., \p ActiveChannels = 3 for computing histograms of only <em>RGB</em> from <em>RGBA</em> samples).
+/// * For channel<sub><em>i</em></sub> the number of histogram bins is (\p levels[i] - 1).
+/// * For channel<sub><em>i</em></sub> bins are evenly-segmented and include the same width of sample values:
+/// (\p upper_level[i] - \p lower_level[i]) / (\p levels[i] - 1).
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Channels - number of channels interleaved in the input samples.
+/// \tparam ActiveChannels - number of channels being used for computing histograms.
+/// \tparam Config - [optional] configuration of the primitive. It can be \p histogram_config or
+/// a custom class with the same members.
+/// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam Counter - integer type for histogram bin counters.
+/// \tparam Level - type of histogram boundaries (levels)
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] samples - iterator to the first element in the range of input samples.
+/// \param [in] columns - number of elements in each row of the region.
+/// \param [in] rows - number of rows of the region.
+/// \param [in] row_stride_bytes - number of bytes between starts of consecutive rows of the region.
 /// \param [out] histogram - pointers to the first element in the histogram range, one for each active channel.
 /// \param [in] levels - number of boundaries (levels) for histogram bins in each active channel.
 /// \param [in] lower_level - lower sample value bound (inclusive) for the first histogram bin in each active channel.
@@ -628,9 +1436,11 @@ inline hipError_t histogram_even(void*          temporary_storage,
 /// #include <rocprim/rocprim.hpp>
 ///
 /// // Prepare input and output (declare pointers, allocate device memory etc.)
-/// unsigned int size;        // e.g., 8
-/// unsigned char * samples;  // e.g., [(3, 1, 5, 255), (3, 1, 5, 255), (4, 2, 6, 127), (3, 2, 6, 127),
-///                           //        (0, 0, 0, 100), (0, 1, 0, 100), (0, 0, 1, 255), (0, 1, 1, 255)]
+/// unsigned int columns;     // e.g., 4
+/// unsigned int rows;        // e.g., 2
+/// size_t row_stride_bytes;  // e.g., 5 * sizeof(unsigned char)
+/// unsigned char * samples;  // e.g., [(3, 1, 5, 255), (3, 1, 5, 255), (4, 2, 6, 127), (3, 2, 6, 127), (-, -, -, -),
+///                           //        (0, 0, 0, 100), (0, 1, 0, 100), (0, 0, 1, 255), (0, 1, 1, 255), (-, -, -, -)]
 /// int * histogram[3];       // 3 empty arrays of at least 256 elements each
 /// unsigned int levels[3];   // e.g., [257, 257, 257] (for 256 bins)
 /// int lower_level[3];       // e.g., [0, 0, 0]
@@ -641,7 +1451,7 @@ inline hipError_t histogram_even(void*          temporary_storage,
 /// // Get required size of the temporary storage
 /// rocprim::multi_histogram_even<4, 3>(
 ///     temporary_storage_ptr, temporary_storage_size_bytes,
-///     samples, size,
+///     samples, columns, rows, row_stride_bytes,
 ///     histogram, levels, lower_level, upper_level
 /// );
 ///
@@ -651,7 +1461,7 @@ inline hipError_t histogram_even(void*          temporary_storage,
 /// // compute histograms
 /// rocprim::multi_histogram_even<4, 3>(
 ///     temporary_storage_ptr, temporary_storage_size_bytes,
-///     samples, size,
+///     samples, columns, rows, row_stride_bytes,
 ///     histogram, levels, lower_level, upper_level
 /// );
 /// // histogram: [[4, 0, 0, 3, 1, 0, 0, ..., 0],
@@ -668,7 +1478,9 @@ template<unsigned int Channels,
 inline hipError_t multi_histogram_even(void*          temporary_storage,
                                        size_t&        storage_size,
                                        SampleIterator samples,
-                                       unsigned int   size,
+                                       unsigned int   columns,
+                                       unsigned int   rows,
+                                       size_t         row_stride_bytes,
                                        Counter*       histogram[ActiveChannels],
                                        unsigned int   levels[ActiveChannels],
                                        Level          lower_level[ActiveChannels],
@@ -679,9 +1491,10 @@ inline hipError_t multi_histogram_even(void*          temporary_storage,
     return detail::histogram_even_impl<Channels, ActiveChannels, Config>(temporary_storage,
                                                                          storage_size,
                                                                          samples,
-                                                                         size,
-                                                                         1,
-                                                                         0,
+                                                                         detail::histogram_unit_weights(),
+                                                                         columns,
+                                                                         rows,
+                                                                         row_stride_bytes,
                                                                          histogram,
                                                                          levels,
                                                                          lower_level,
@@ -690,25 +1503,25 @@ inline hipError_t multi_histogram_even(void*          temporary_storage,
                                                                          debug_synchronous);
 }
 
-/// \brief Computes histograms from a two-dimensional region of multi-channel samples using equal-width bins.
+/// \brief Computes a joint histogram of the active channels of multi-channel samples using
+/// equal-width bins.
 ///
 /// \par
-/// * The two-dimensional region of interest within \p samples can be specified using the \p columns,
-/// \p rows and \p row_stride_bytes parameters.
-/// * The row stride must be a whole multiple of the sample data type size,
-/// i.e., <tt>(row_stride_bytes % sizeof(std::iterator_traits<SampleIterator>::value_type)) == 0</tt>.
 /// * The input is a sequence of <em>pixel</em> structures, where each pixel comprises
-/// a record of \p Channels consecutive data samples (e.g., \p Channels = 4 for <em>RGBA</em> samples).
-/// * The first \p ActiveChannels channels of total \p Channels channels will be used for computing histograms
-/// (e.g., \p ActiveChannels = 3 for computing histograms of only <em>RGB</em> from <em>RGBA</em> samples).
-/// * For channel<sub><em>i</em></sub> the number of histogram bins is (\p levels[i] - 1).
-/// * For channel<sub><em>i</em></sub> bins are evenly-segmented and include the same width of sample values:
-/// (\p upper_level[i] - \p lower_level[i]) / (\p levels[i] - 1).
+/// a record of \p Channels consecutive data samples (e.g., \p Channels = 2 for 2D points).
+/// * The first \p ActiveChannels channels of total \p Channels channels are binned together,
+/// every pixel increments one bin of the joint histogram.
+/// * For channel<sub><em>i</em></sub> the number of bins is (\p levels[i] - 1), bins are evenly-segmented
+/// and include the same width of sample values: (\p upper_level[i] - \p lower_level[i]) / (\p levels[i] - 1).
+/// * The joint histogram has the product of the numbers of bins of all active channels, and it is stored
+/// in row-major order: the bin of the pixel with channel bins <tt>(b<sub>0</sub>, b<sub>1</sub>)</tt> is
+/// <tt>b<sub>0</sub> * (levels[1] - 1) + b<sub>1</sub></tt>, i.e. the last active channel varies fastest.
+/// * A pixel is counted only if the samples of all its active channels are within their bounds.
 /// * Returns the required size of \p temporary_storage in \p storage_size
 /// if \p temporary_storage in a null pointer.
 ///
 /// \tparam Channels - number of channels interleaved in the input samples.
-/// \tparam ActiveChannels - number of channels being used for computing histograms.
+/// \tparam ActiveChannels - number of channels being used for computing the joint histogram.
 /// \tparam Config - [optional] configuration of the primitive. It can be \p histogram_config or
 /// a custom class with the same members.
 /// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
@@ -721,10 +1534,8 @@ inline hipError_t multi_histogram_even(void*          temporary_storage,
 /// \p storage_size and function returns without performing the reduction operation.
 /// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
 /// \param [in] samples - iterator to the first element in the range of input samples.
-/// \param [in] columns - number of elements in each row of the region.
-/// \param [in] rows - number of rows of the region.
-/// \param [in] row_stride_bytes - number of bytes between starts of consecutive rows of the region.
-/// \param [out] histogram - pointers to the first element in the histogram range, one for each active channel.
+/// \param [in] size - number of pixels in the samples range.
+/// \param [out] histogram - pointer to the first element in the joint histogram range.
 /// \param [in] levels - number of boundaries (levels) for histogram bins in each active channel.
 /// \param [in] lower_level - lower sample value bound (inclusive) for the first histogram bin in each active channel.
 /// \param [in] upper_level - upper sample value bound (exclusive) for the last histogram bin in each active channel.
@@ -733,47 +1544,44 @@ inline hipError_t multi_histogram_even(void*          temporary_storage,
 /// launch is forced in order to check for errors. Default value is \p false.
 ///
 /// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime error of
-/// type \p hipError_t.
+/// type \p hipError_t. \p hipErrorInvalidValue is returned if the number of bins of the joint
+/// histogram does not fit \p unsigned \p int.
 ///
 /// \par Example
 /// \parblock
-/// In this example histograms for 3 channels (RGB) are computed on an array of 8-bit RGBA samples.
+/// In this example a joint 2x3 histogram is computed on an array of 2D points.
 ///
 /// \code{.cpp}
 /// #include <rocprim/rocprim.hpp>
 ///
 /// // Prepare input and output (declare pointers, allocate device memory etc.)
-/// unsigned int columns;     // e.g., 4
-/// unsigned int rows;        // e.g., 2
-/// size_t row_stride_bytes;  // e.g., 5 * sizeof(unsigned char)
-/// unsigned char * samples;  // e.g., [(3, 1, 5, 255), (3, 1, 5, 255), (4, 2, 6, 127), (3, 2, 6, 127), (-, -, -, -),
-///                           //        (0, 0, 0, 100), (0, 1, 0, 100), (0, 0, 1, 255), (0, 1, 1, 255), (-, -, -, -)]
-/// int * histogram[3];       // 3 empty arrays of at least 256 elements each
-/// unsigned int levels[3];   // e.g., [257, 257, 257] (for 256 bins)
-/// int lower_level[3];       // e.g., [0, 0, 0]
-/// int upper_level[3];       // e.g., [256, 256, 256]
+/// unsigned int size;        // e.g., 5
+/// float * samples;          // e.g., [(0.5, 0.5), (0.5, 2.5), (1.5, 1.5), (1.5, 2.5), (2.5, 0.5)]
+/// int * histogram;          // empty array of at least 6 elements
+/// unsigned int levels[2];   // e.g., [3, 4] (for 2 and 3 bins)
+/// float lower_level[2];     // e.g., [0.0, 0.0]
+/// float upper_level[2];     // e.g., [2.0, 3.0]
 ///
 /// size_t temporary_storage_size_bytes;
 /// void * temporary_storage_ptr = nullptr;
 /// // Get required size of the temporary storage
-/// rocprim::multi_histogram_even<4, 3>(
+/// rocprim::joint_histogram_even<2, 2>(
 ///     temporary_storage_ptr, temporary_storage_size_bytes,
-///     samples, columns, rows, row_stride_bytes,
+///     samples, size,
 ///     histogram, levels, lower_level, upper_level
 /// );
 ///
 /// // allocate temporary storage
 /// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
 ///
-/// // compute histograms
-/// rocprim::multi_histogram_even<4, 3>(
+/// // compute the joint histogram
+/// rocprim::joint_histogram_even<2, 2>(
 ///     temporary_storage_ptr, temporary_storage_size_bytes,
-///     samples, columns, rows, row_stride_bytes,
+///     samples, size,
 ///     histogram, levels, lower_level, upper_level
 /// );
-/// // histogram: [[4, 0, 0, 3, 1, 0, 0, ..., 0],
-/// //             [2, 4, 2, 0, 0, 0, 0, ..., 0],
-/// //             [2, 2, 0, 0, 0, 2, 2, ..., 0]]
+/// // histogram: [1, 0, 1,
+/// //             0, 1, 1]
 /// \endcode
 /// \endparblock
 template<unsigned int Channels,
@@ -782,31 +1590,58 @@ template<unsigned int Channels,
          class SampleIterator,
          class Counter,
          class Level>
-inline hipError_t multi_histogram_even(void*          temporary_storage,
+inline hipError_t joint_histogram_even(void*          temporary_storage,
                                        size_t&        storage_size,
                                        SampleIterator samples,
-                                       unsigned int   columns,
-                                       unsigned int   rows,
-                                       size_t         row_stride_bytes,
-                                       Counter*       histogram[ActiveChannels],
+                                       unsigned int   size,
+                                       Counter*       histogram,
                                        unsigned int   levels[ActiveChannels],
                                        Level          lower_level[ActiveChannels],
                                        Level          upper_level[ActiveChannels],
                                        hipStream_t    stream            = 0,
                                        bool           debug_synchronous = false)
 {
-    return detail::histogram_even_impl<Channels, ActiveChannels, Config>(temporary_storage,
-                                                                         storage_size,
-                                                                         samples,
-                                                                         columns,
-                                                                         rows,
-                                                                         row_stride_bytes,
-                                                                         histogram,
-                                                                         levels,
-                                                                         lower_level,
-                                                                         upper_level,
-                                                                         stream,
-                                                                         debug_synchronous);
+    static_assert(ActiveChannels <= Channels,
+                  "ActiveChannels cannot be larger than the number of channels");
+
+    // The joint histogram is computed as a single channel histogram of the pixels
+    detail::sample_to_bin_joint_even<Level, ActiveChannels> sample_to_bin_op[1];
+    unsigned long long total_bins = 1;
+    for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+    {
+        if(levels[channel] < 2)
+        {
+            // Histogram must have at least 1 bin
+            return hipErrorInvalidValue;
+        }
+        sample_to_bin_op[0].channel_sample_to_bin_op[channel]
+            = detail::sample_to_bin_even<Level>(levels[channel] - 1,
+                                                lower_level[channel],
+                                                upper_level[channel]);
+        total_bins *= levels[channel] - 1;
+        if(total_bins >= std::numeric_limits<unsigned int>::max())
+        {
+            return hipErrorInvalidValue;
+        }
+    }
+
+    Counter*     histogram_single[1] = {histogram};
+    unsigned int levels_single[1]    = {static_cast<unsigned int>(total_bins) + 1};
+
+    return detail::histogram_impl<1, 1, Config>(
+        temporary_storage,
+        storage_size,
+        detail::make_sample_vector_iterator<Channels>(samples,
+                                                      std::is_pointer<SampleIterator>{}),
+        detail::histogram_unit_weights(),
+        size,
+        1,
+        0,
+        histogram_single,
+        levels_single,
+        sample_to_bin_op,
+        stream,
+        debug_synchronous);
 }
 
 /// \brief Computes a histogram from a sequence of samples using the specified bin boundary levels.
@@ -893,6 +1728,183 @@ inline hipError_t histogram_range(void*          temporary_storage,
     return detail::histogram_range_impl<1, 1, Config>(temporary_storage,
                                                       storage_size,
                                                       samples,
+                                                      detail::histogram_unit_weights(),
+                                                      size,
+                                                      1,
+                                                      0,
+                                                      histogram_single,
+                                                      levels_single,
+                                                      level_values_single,
+                                                      stream,
+                                                      debug_synchronous);
+}
+
+/// \brief Adds the samples to a histogram using the specified bin boundary levels.
+///
+/// \par
+/// * The bins are the bins of \p histogram_range.
+/// * The samples are added to the current values of the bins of \p histogram, they are not
+/// initialized to zero. This skips the launch of the initialization, and a stream of batches
+/// can be counted into the same bins by one call per batch.
+/// * \p Counter can be \p unsigned \p long \p long, so that long-running accumulations
+/// do not overflow the bins.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p histogram_config or
+/// a custom class with the same members.
+/// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam Counter - integer type for histogram bin counters.
+/// \tparam Level - type of histogram boundaries (levels)
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the histogram operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] samples - iterator to the first element in the range of input samples.
+/// \param [in] size - number of elements in the samples range.
+/// \param [in,out] histogram - pointer to the first element in the histogram range, the counts
+/// of the samples are added to it.
+/// \param [in] levels - number of boundaries (levels) for histogram bins.
+/// \param [in] level_values - iterator to the first element in the range of bin levels.
+/// The range must be sorted.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime
+/// error of type \p hipError_t.
+template<class Config = default_config, class SampleIterator, class Counter, class Level>
+inline hipError_t histogram_range_accumulate(void*          temporary_storage,
+                                             size_t&        storage_size,
+                                             SampleIterator samples,
+                                             unsigned int   size,
+                                             Counter*       histogram,
+                                             unsigned int   levels,
+                                             Level*         level_values,
+                                             hipStream_t    stream            = 0,
+                                             bool           debug_synchronous = false)
+{
+    Counter*     histogram_single[1]    = {histogram};
+    unsigned int levels_single[1]       = {levels};
+    Level*       level_values_single[1] = {level_values};
+
+    return detail::histogram_range_impl<1, 1, Config>(temporary_storage,
+                                                      storage_size,
+                                                      samples,
+                                                      detail::histogram_unit_weights(),
+                                                      size,
+                                                      1,
+                                                      0,
+                                                      histogram_single,
+                                                      levels_single,
+                                                      level_values_single,
+                                                      stream,
+                                                      debug_synchronous,
+                                                      true);
+}
+
+/// \brief Computes a weighted histogram from a sequence of samples using the specified bin
+/// boundary levels.
+///
+/// \par
+/// * Every sample adds its weight to its bin, so a bin is the sum of the weights of its samples.
+/// * The number of histogram bins is (\p levels - 1).
+/// * The range for bin<sub><em>j</em></sub> is [<tt>level_values[j]</tt>, <tt>level_values[j+1]</tt>).
+/// * Weighted histograms are always computed by <tt>histogram_algorithm::using_atomic</tt>,
+/// the \p algorithm of \p Config is ignored.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p histogram_config or
+/// a custom class with the same members.
+/// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam WeightIterator - random-access iterator type of the weights range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam Counter - type of histogram bins, it must support atomic addition: \p float,
+/// \p int, <tt>unsigned int</tt> or <tt>unsigned long long</tt>.
+/// \tparam Level - type of histogram boundaries (levels)
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] samples - iterator to the first element in the range of input samples.
+/// \param [in] weights - iterator to the first element in the range of weights of the samples.
+/// \param [in] size - number of elements in the samples range.
+/// \param [out] histogram - pointer to the first element in the histogram range.
+/// \param [in] levels - number of boundaries (levels) for histogram bins.
+/// \param [in] level_values - pointer to the array of bin boundaries.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level weighted histogram of 5 bins is computed on an array of
+/// float samples.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int size;        // e.g., 8
+/// float * samples;          // e.g., [-10.0, 0.3, 9.5, 8.1, 1.5, 1.9, 100.0, 5.1]
+/// float * weights;          // e.g., [  1.0, 2.0, 0.5, 1.0, 0.5, 1.5,   3.0, 2.0]
+/// float * histogram;        // empty array of at least 5 elements
+/// unsigned int levels;      // e.g., 6 (for 5 bins)
+/// float * level_values;     // e.g., [0.0, 1.0, 5.0, 10.0, 20.0, 50.0]
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::histogram_range_weighted(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, weights, size,
+///     histogram, levels, level_values
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // compute histogram
+/// rocprim::histogram_range_weighted(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, weights, size,
+///     histogram, levels, level_values
+/// );
+/// // histogram: [2.0, 2.0, 3.5, 0.0, 0.0]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class SampleIterator,
+         class WeightIterator,
+         class Counter,
+         class Level>
+inline hipError_t histogram_range_weighted(void*          temporary_storage,
+                                           size_t&        storage_size,
+                                           SampleIterator samples,
+                                           WeightIterator weights,
+                                           unsigned int   size,
+                                           Counter*       histogram,
+                                           unsigned int   levels,
+                                           Level*         level_values,
+                                           hipStream_t    stream            = 0,
+                                           bool           debug_synchronous = false)
+{
+    Counter*     histogram_single[1]    = {histogram};
+    unsigned int levels_single[1]       = {levels};
+    Level*       level_values_single[1] = {level_values};
+
+    return detail::histogram_range_impl<1, 1, Config>(temporary_storage,
+                                                      storage_size,
+                                                      samples,
+                                                      weights,
                                                       size,
                                                       1,
                                                       0,
@@ -997,6 +2009,7 @@ inline hipError_t histogram_range(void*          temporary_storage,
     return detail::histogram_range_impl<1, 1, Config>(temporary_storage,
                                                       storage_size,
                                                       samples,
+                                                      detail::histogram_unit_weights(),
                                                       columns,
                                                       rows,
                                                       row_stride_bytes,
@@ -1100,6 +2113,7 @@ inline hipError_t multi_histogram_range(void*          temporary_storage,
     return detail::histogram_range_impl<Channels, ActiveChannels, Config>(temporary_storage,
                                                                           storage_size,
                                                                           samples,
+                                                                          detail::histogram_unit_weights(),
                                                                           size,
                                                                           1,
                                                                           0,
@@ -1110,6 +2124,76 @@ inline hipError_t multi_histogram_range(void*          temporary_storage,
                                                                           debug_synchronous);
 }
 
+/// \brief Adds the multi-channel samples to histograms using the specified bin boundary levels.
+///
+/// \par
+/// * The bins are the bins of \p multi_histogram_range.
+/// * The samples are added to the current values of the bins of \p histogram, they are not
+/// initialized to zero. This skips the launch of the initialization, and a stream of batches
+/// can be counted into the same bins by one call per batch.
+/// * \p Counter can be \p unsigned \p long \p long, so that long-running accumulations
+/// do not overflow the bins.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Channels - number of channels interleaved in the input samples.
+/// \tparam ActiveChannels - number of channels being used for computing histograms.
+/// \tparam Config - [optional] configuration of the primitive. It can be \p histogram_config or
+/// a custom class with the same members.
+/// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam Counter - integer type for histogram bin counters.
+/// \tparam Level - type of histogram boundaries (levels)
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the histogram operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] samples - iterator to the first element in the range of input samples.
+/// \param [in] size - number of pixels in the samples range.
+/// \param [in,out] histogram - pointers to the first element in the histogram range, one for
+/// each active channel, the counts of the samples are added to them.
+/// \param [in] levels - number of boundaries (levels) for histogram bins in each active channel.
+/// \param [in] level_values - pointer to the array of bin levels for each active channel.
+/// The ranges must be sorted.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime
+/// error of type \p hipError_t.
+template<unsigned int Channels,
+         unsigned int ActiveChannels,
+         class Config = default_config,
+         class SampleIterator,
+         class Counter,
+         class Level>
+inline hipError_t multi_histogram_range_accumulate(void*          temporary_storage,
+                                                   size_t&        storage_size,
+                                                   SampleIterator samples,
+                                                   unsigned int   size,
+                                                   Counter*       histogram[ActiveChannels],
+                                                   unsigned int   levels[ActiveChannels],
+                                                   Level*         level_values[ActiveChannels],
+                                                   hipStream_t    stream            = 0,
+                                                   bool           debug_synchronous = false)
+{
+    return detail::histogram_range_impl<Channels, ActiveChannels, Config>(
+        temporary_storage,
+        storage_size,
+        samples,
+        detail::histogram_unit_weights(),
+        size,
+        1,
+        0,
+        histogram,
+        levels,
+        level_values,
+        stream,
+        debug_synchronous,
+        true);
+}
+
 /// \brief Computes histograms from a two-dimensional region of multi-channel samples using the specified bin
 /// boundary levels.
 ///
@@ -1214,6 +2298,7 @@ inline hipError_t multi_histogram_range(void*          temporary_storage,
     return detail::histogram_range_impl<Channels, ActiveChannels, Config>(temporary_storage,
                                                                           storage_size,
                                                                           samples,
+                                                                          detail::histogram_unit_weights(),
                                                                           columns,
                                                                           rows,
                                                                           row_stride_bytes,
@@ -33,19 +33,55 @@
 
 BEGIN_ROCPRIM_NAMESPACE
 
+/// \brief Available algorithms for device-level histogram operations.
+enum class histogram_algorithm
+{
+    /// Bins are counted by atomic additions in shared memory, in windows of bins
+    /// in shared memory, or in global memory depending on the number of bins.
+    /// \par Performance Notes:
+    /// * Performance may decrease for very large numbers of bins or for narrow sample
+    /// distributions where many concurrent updates are made to the same bin counter.
+    using_atomic,
+
+    /// Bin indices of the samples are sorted by \p radix_sort_keys and the lengths
+    /// of runs of the same bin index are written as bin counts, without materializing
+    /// the unique bins and run lengths of \p run_length_encode.
+    /// \par Performance Notes:
+    /// * Performance is consistent regardless of sample bin distribution and number of bins,
+    /// it is preferable for histograms with millions of bins.
+    /// * Requires temporary storage for the bin indices of all samples.
+    using_sort,
+
+    /// \brief Default histogram algorithm.
+    default_algorithm = using_atomic,
+};
+
 /// \brief Configuration of device-level histogram operation.
 ///
 /// \tparam HistogramConfig - configuration of histogram kernel. Must be \p kernel_config.
 /// \tparam MaxGridSize - maximum number of blocks to launch.
 /// \tparam SharedImplMaxBins - maximum total number of bins for all active channels
 /// for the shared memory histogram implementation (samples -> shared memory bins -> global memory bins),
-/// when exceeded the global memory implementation is used (samples -> global memory bins).
+/// when exceeded the bins are counted in windows of <tt>SharedImplMaxBins * SharedImplHistograms</tt>
+/// bins per channel in the shared memory, each sample is read once for every window. When the number
+/// of windows is too large, the global memory implementation is used (samples -> global memory bins).
 /// \tparam SharedImplHistograms - number of histograms in the shared memory to reduce bank conflicts
 /// for atomic operations with narrow sample distributions. Sweetspot for 9xx and 10xx is 3.
+/// \tparam SharedImplWarpAggregation - if true, lanes of a warp that update the same bin in the
+/// shared memory are grouped by ballots and one atomic operation is issued per unique bin of the warp.
+/// It speeds up heavily skewed sample distributions (for example most samples in one bin),
+/// but it is slower for uniform distributions.
+/// \tparam Algorithm - algorithm of the histogram, see \p histogram_algorithm.
+/// \tparam BlocksPerCU - when not 0, the grid is further limited to \p BlocksPerCU blocks per
+/// compute unit and every block counts samples until all of them are counted. A limited grid
+/// leaves compute units to kernels running concurrently on other streams.
 template<class HistogramConfig,
-         unsigned int MaxGridSize          = 1024,
-         unsigned int SharedImplMaxBins    = 2048,
-         unsigned int SharedImplHistograms = 3>
+         unsigned int        MaxGridSize               = 1024,
+         unsigned int        SharedImplMaxBins         = 2048,
+         unsigned int        SharedImplHistograms      = 3,
+         bool                SharedImplWarpAggregation = false,
+         histogram_algorithm Algorithm                 = histogram_algorithm::default_algorithm,
+         unsigned int        BlocksPerCU               = 0>
 struct histogram_config
 {
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -54,80 +90,131 @@ struct histogram_config
     static constexpr unsigned int max_grid_size = MaxGridSize;
     static constexpr unsigned int shared_impl_max_bins = SharedImplMaxBins;
     static constexpr unsigned int shared_impl_histograms = SharedImplHistograms;
+    static constexpr bool shared_impl_warp_aggregation = SharedImplWarpAggregation;
+    static constexpr histogram_algorithm algorithm = Algorithm;
+    static constexpr unsigned int blocks_per_cu = BlocksPerCU;
 #endif
 };
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 template<class HistogramConfig,
-         unsigned int MaxGridSize,
-         unsigned int SharedImplMaxBins,
-         unsigned int SharedImplHistograms>
-constexpr unsigned int
-    histogram_config<HistogramConfig, MaxGridSize, SharedImplMaxBins, SharedImplHistograms>::
-        max_grid_size;
+         unsigned int        MaxGridSize,
+         unsigned int        SharedImplMaxBins,
+         unsigned int        SharedImplHistograms,
+         bool                SharedImplWarpAggregation,
+         histogram_algorithm Algorithm,
+         unsigned int        BlocksPerCU>
+constexpr unsigned int histogram_config<HistogramConfig,
+                                        MaxGridSize,
+                                        SharedImplMaxBins,
+                                        SharedImplHistograms,
+                                        SharedImplWarpAggregation,
+                                        Algorithm,
+                                        BlocksPerCU>::max_grid_size;
+template<class HistogramConfig,
+         unsigned int        MaxGridSize,
+         unsigned int        SharedImplMaxBins,
+         unsigned int        SharedImplHistograms,
+         bool                SharedImplWarpAggregation,
+         histogram_algorithm Algorithm,
+         unsigned int        BlocksPerCU>
+constexpr unsigned int histogram_config<HistogramConfig,
+                                        MaxGridSize,
+                                        SharedImplMaxBins,
+                                        SharedImplHistograms,
+                                        SharedImplWarpAggregation,
+                                        Algorithm,
+                                        BlocksPerCU>::shared_impl_max_bins;
 template<class HistogramConfig,
-         unsigned int MaxGridSize,
-         unsigned int SharedImplMaxBins,
-         unsigned int SharedImplHistograms>
-constexpr unsigned int
-    histogram_config<HistogramConfig, MaxGridSize, SharedImplMaxBins, SharedImplHistograms>::
-        shared_impl_max_bins;
+         unsigned int        MaxGridSize,
+         unsigned int        SharedImplMaxBins,
+         unsigned int        SharedImplHistograms,
+         bool                SharedImplWarpAggregation,
+         histogram_algorithm Algorithm,
+         unsigned int        BlocksPerCU>
+constexpr unsigned int histogram_config<HistogramConfig,
+                                        MaxGridSize,
+                                        SharedImplMaxBins,
+                                        SharedImplHistograms,
+                                        SharedImplWarpAggregation,
+                                        Algorithm,
+                                        BlocksPerCU>::shared_impl_histograms;
 template<class HistogramConfig,
-         unsigned int MaxGridSize,
-         unsigned int SharedImplMaxBins,
-         unsigned int SharedImplHistograms>
-constexpr unsigned int
-    histogram_config<HistogramConfig, MaxGridSize, SharedImplMaxBins, SharedImplHistograms>::
-        shared_impl_histograms;
+         unsigned int        MaxGridSize,
+         unsigned int        SharedImplMaxBins,
+         unsigned int        SharedImplHistograms,
+         bool                SharedImplWarpAggregation,
+         histogram_algorithm Algorithm,
+         unsigned int        BlocksPerCU>
+constexpr bool histogram_config<HistogramConfig,
+                                MaxGridSize,
+                                SharedImplMaxBins,
+                                SharedImplHistograms,
+                                SharedImplWarpAggregation,
+                                Algorithm,
+                                BlocksPerCU>::shared_impl_warp_aggregation;
+template<class HistogramConfig,
+         unsigned int        MaxGridSize,
+         unsigned int        SharedImplMaxBins,
+         unsigned int        SharedImplHistograms,
+         bool                SharedImplWarpAggregation,
+         histogram_algorithm Algorithm,
+         unsigned int        BlocksPerCU>
+constexpr histogram_algorithm histogram_config<HistogramConfig,
+                                               MaxGridSize,
+                                               SharedImplMaxBins,
+                                               SharedImplHistograms,
+                                               SharedImplWarpAggregation,
+                                               Algorithm,
+                                               BlocksPerCU>::algorithm;
+template<class HistogramConfig,
+         unsigned int        MaxGridSize,
+         unsigned int        SharedImplMaxBins,
+         unsigned int        SharedImplHistograms,
+         bool                SharedImplWarpAggregation,
+         histogram_algorithm Algorithm,
+         unsigned int        BlocksPerCU>
+constexpr unsigned int histogram_config<HistogramConfig,
+                                        MaxGridSize,
+                                        SharedImplMaxBins,
+                                        SharedImplHistograms,
+                                        SharedImplWarpAggregation,
+                                        Algorithm,
+                                        BlocksPerCU>::blocks_per_cu;
 #endif
 
 namespace detail
 {
 
+// Pixels of 4 bytes of integral samples (for example RGBA of 8-bit samples) are loaded as 32-bit
+// words by vector loads of 4 pixels and unpacked in registers
+template<unsigned int Channels, class Sample>
+struct is_sample_packed_pixel
+    : std::integral_constant<bool,
+                             std::is_integral<Sample>::value && sizeof(Sample) < sizeof(int)
+                                 && sizeof(Sample) * Channels == sizeof(int)>
+{};
+
+// Packed pixels are loaded 16 per thread, by 4 128-bit loads
+template<class Sample, unsigned int Channels, unsigned int ItemsPerThread>
+struct histogram_items_per_thread
+    : std::integral_constant<unsigned int,
+                             is_sample_packed_pixel<Channels, Sample>::value
+                                 ? 16u
+                                 : ::rocprim::max(
+                                     static_cast<unsigned int>(
+                                         ItemsPerThread / Channels
+                                         / ::rocprim::detail::ceiling_div(sizeof(Sample),
+                                                                          sizeof(int))),
+                                     1u)>
+{};
+
+// Used for the sample types and channels without a tuned configuration
 template<class Sample, unsigned int Channels, unsigned int ActiveChannels>
-struct histogram_config_803
-{
-    static constexpr unsigned int item_scale = ::rocprim::detail::ceiling_div(sizeof(Sample), sizeof(int));
-
-    using type = histogram_config<kernel_config<256, ::rocprim::max(10u / Channels / item_scale, 1u)>>;
-};
-
-template<class Sample, unsigned int Channels, unsigned int ActiveChannels>
-struct histogram_config_900
-{
-    static constexpr unsigned int item_scale = ::rocprim::detail::ceiling_div(sizeof(Sample), sizeof(int));
-
-    using type = histogram_config<kernel_config<256, ::rocprim::max(8u / Channels / item_scale, 1u)>>;
-};
-
-// TODO: We need to update these parameters
-template<class Sample, unsigned int Channels, unsigned int ActiveChannels>
-struct histogram_config_90a
-{
-    static constexpr unsigned int item_scale = ::rocprim::detail::ceiling_div(sizeof(Sample), sizeof(int));
-
-    using type = histogram_config<kernel_config<256, ::rocprim::max(8u / Channels / item_scale, 1u)>>;
-};
-
-// TODO: We need to update these parameters
-template<class Sample, unsigned int Channels, unsigned int ActiveChannels>
-struct histogram_config_1030
-{
-    static constexpr unsigned int item_scale = ::rocprim::detail::ceiling_div(sizeof(Sample), sizeof(int));
-
-    using type = histogram_config<kernel_config<256, ::rocprim::max(8u / Channels / item_scale, 1u)>>;
-};
-
-template<unsigned int TargetArch, class Sample, unsigned int Channels, unsigned int ActiveChannels>
-struct default_histogram_config
-    : select_arch<
-        TargetArch,
-        select_arch_case<803, histogram_config_803<Sample, Channels, ActiveChannels> >,
-        select_arch_case<900, histogram_config_900<Sample, Channels, ActiveChannels> >,
-        select_arch_case<ROCPRIM_ARCH_90a, histogram_config_90a<Sample, Channels, ActiveChannels> >,
-        select_arch_case<1030, histogram_config_1030<Sample, Channels, ActiveChannels> >,
-        histogram_config_900<Sample, Channels, ActiveChannels>
-    > { };
+struct default_histogram_config_base
+    : histogram_config<
+          kernel_config<256, histogram_items_per_thread<Sample, Channels, 8u>::value>>
+{};
 
 } // end namespace detail
 
@@ -0,0 +1,383 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_IS_SORTED_HPP_
+#define ROCPRIM_DEVICE_DEVICE_IS_SORTED_HPP_
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../functional.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+
+#include "config_types.hpp"
+#include "detail/device_is_sorted.hpp"
+#include "device_reduce_config.hpp"
+#include "instrumentation.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+template<class Config, class InputIterator, class CompareFunction>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().block_size)
+void is_sorted_kernel(InputIterator       input,
+                      const size_t        size,
+                      const size_t        starting_offset,
+                      CompareFunction     compare,
+                      unsigned long long* first_unsorted)
+{
+    is_sorted_kernel_impl<Config>(input, size, starting_offset, compare, first_unsorted);
+}
+
+template<bool IsSortedUntil, class OutputIterator>
+ROCPRIM_KERNEL __launch_bounds__(1)
+void is_sorted_store_kernel(OutputIterator                  output,
+                            const size_t                    size,
+                            const unsigned long long* const first_unsorted)
+{
+    is_sorted_store<IsSortedUntil>(output, size, first_unsorted);
+}
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
+    { \
+        auto _error = hipGetLastError(); \
+        if(_error != hipSuccess) return _error; \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
+        if(debug_synchronous) \
+        { \
+            std::cout << name << "(" << size << ")"; \
+            auto __error = hipStreamSynchronize(stream); \
+            if(__error != hipSuccess) return __error; \
+            auto _end = std::chrono::high_resolution_clock::now(); \
+            auto _d = std::chrono::duration_cast<std::chrono::duration<double>>(_end - start); \
+            std::cout << " " << _d.count() * 1000 << " ms" << '\n'; \
+        } \
+    }
+
+// The blocks are launched in the order of the tiles and the launches are issued in order, so the
+// tiles after an unsorted item are mostly skipped without loading them. The result is stored by
+// the device without synchronizing with the host.
+template<bool IsSortedUntil,
+         class Config,
+         class InputIterator,
+         class OutputIterator,
+         class CompareFunction>
+inline hipError_t is_sorted_impl(void*             temporary_storage,
+                                 size_t&           storage_size,
+                                 InputIterator     input,
+                                 OutputIterator    output,
+                                 const size_t      size,
+                                 CompareFunction   compare,
+                                 const hipStream_t stream,
+                                 bool              debug_synchronous)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    using config = wrapped_reduce_config<Config, input_type>;
+
+    detail::target_arch target_arch;
+    hipError_t          result = host_target_arch(stream, target_arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const reduce_config_params params = dispatch_target_arch<config>(target_arch);
+
+    const unsigned int block_size       = params.block_size;
+    const unsigned int items_per_thread = params.items_per_thread;
+    const auto         items_per_block  = block_size * items_per_thread;
+
+    unsigned long long* first_unsorted;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&first_unsorted, 1)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    // Start point for time measurements
+    std::chrono::high_resolution_clock::time_point start;
+
+    const size_t number_of_blocks = ceiling_div(size, items_per_block);
+    const size_t number_of_blocks_limit
+        = ::rocprim::max<size_t>(params.size_limit / items_per_block, 1);
+    const size_t aligned_size_limit = number_of_blocks_limit * items_per_block;
+
+    if(debug_synchronous)
+    {
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << number_of_blocks << '\n';
+        std::cout << "number of blocks limit " << number_of_blocks_limit << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+    }
+
+    // All bits set is is_sorted_none
+    result = hipMemsetAsync(first_unsorted, 0xFF, sizeof(*first_unsorted), stream);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    for(size_t offset = 0; offset < size; offset += aligned_size_limit)
+    {
+        const size_t current_size   = std::min<size_t>(size - offset, aligned_size_limit);
+        const size_t current_blocks = ceiling_div(current_size, items_per_block);
+
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("is_sorted_kernel");
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(is_sorted_kernel<config>),
+            dim3(current_blocks), dim3(block_size), 0, stream,
+            input, size, offset, compare, first_unsorted
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("is_sorted_kernel", current_size, start);
+    }
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("is_sorted_store_kernel");
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(is_sorted_store_kernel<IsSortedUntil>),
+        dim3(1), dim3(1), 0, stream,
+        output, size, first_unsorted
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("is_sorted_store_kernel", 1, start);
+
+    return hipSuccess;
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
+} // end of detail namespace
+
+/// \brief Parallel sortedness check primitive for device level.
+///
+/// is_sorted checks whether the items of \p input are sorted according to \p compare, i.e.
+/// there is no item \p i for which <tt>compare(input[i], input[i - 1])</tt> is \p true, and
+/// writes the result to \p output.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input must have at least \p size elements, while \p output
+/// only needs one element.
+/// * The check stops early: a block skips its tile without loading it when an unsorted item
+/// has already been found before the tile.
+/// * The result is written to device memory, the function does not synchronize with the host.
+/// An empty range is sorted.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p reduce_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type. Its value
+/// type must be assignable from \p bool.
+/// \tparam CompareFunction - type of binary function used for comparison. Default type
+/// is \p rocprim::less<>.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the check.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to check.
+/// \param [out] output - iterator to the element receiving \p true if the range is sorted,
+/// \p false otherwise.
+/// \param [in] size - number of element in the input range.
+/// \param [in] compare - binary operation function object that will be used for comparison.
+/// The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// Default is CompareFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful check; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;    // e.g., 8
+/// int * input;          // e.g., [1, 2, 2, 4, 3, 6, 7, 8]
+/// bool * output;        // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::is_sorted(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform the check
+/// rocprim::is_sorted(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size
+/// );
+/// // output: [false]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class InputIterator,
+    class OutputIterator,
+    class CompareFunction = ::rocprim::less<>>
+inline hipError_t is_sorted(void*             temporary_storage,
+                            size_t&           storage_size,
+                            InputIterator     input,
+                            OutputIterator    output,
+                            const size_t      size,
+                            CompareFunction   compare           = CompareFunction(),
+                            const hipStream_t stream            = 0,
+                            bool              debug_synchronous = false)
+{
+    return detail::is_sorted_impl<false, Config>(temporary_storage,
+                                                 storage_size,
+                                                 input,
+                                                 output,
+                                                 size,
+                                                 compare,
+                                                 stream,
+                                                 debug_synchronous);
+}
+
+/// \brief Parallel primitive for device level finding the end of the sorted prefix of a range.
+///
+/// is_sorted_until writes to \p output the index of the first item \p i for which
+/// <tt>compare(input[i], input[i - 1])</tt> is \p true, or \p size if the whole range is sorted.
+/// <tt>[input, input + output[0])</tt> is the longest sorted prefix of the range.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input must have at least \p size elements, while \p output
+/// only needs one element.
+/// * The search stops early: a block skips its tile without loading it when an unsorted item
+/// has already been found before the tile.
+/// * The result is written to device memory, the function does not synchronize with the host.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p reduce_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type. Its value
+/// type must be able to represent \p size.
+/// \tparam CompareFunction - type of binary function used for comparison. Default type
+/// is \p rocprim::less<>.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the search.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to search.
+/// \param [out] output - iterator to the element receiving the index of the first unsorted item.
+/// \param [in] size - number of element in the input range.
+/// \param [in] compare - binary operation function object that will be used for comparison.
+/// The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// Default is CompareFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful search; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;    // e.g., 8
+/// int * input;          // e.g., [1, 2, 2, 4, 3, 6, 7, 8]
+/// size_t * output;      // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::is_sorted_until(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform the search
+/// rocprim::is_sorted_until(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size
+/// );
+/// // output: [4]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class InputIterator,
+    class OutputIterator,
+    class CompareFunction = ::rocprim::less<>>
+inline hipError_t is_sorted_until(void*             temporary_storage,
+                                  size_t&           storage_size,
+                                  InputIterator     input,
+                                  OutputIterator    output,
+                                  const size_t      size,
+                                  CompareFunction   compare           = CompareFunction(),
+                                  const hipStream_t stream            = 0,
+                                  bool              debug_synchronous = false)
+{
+    return detail::is_sorted_impl<true, Config>(temporary_storage,
+                                                storage_size,
+                                                input,
+                                                output,
+                                                size,
+                                                compare,
+                                                stream,
+                                                debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_IS_SORTED_HPP_
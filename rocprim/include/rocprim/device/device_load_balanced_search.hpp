@@ -0,0 +1,222 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_LOAD_BALANCED_SEARCH_HPP_
+#define ROCPRIM_DEVICE_DEVICE_LOAD_BALANCED_SEARCH_HPP_
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+
+#include "../config.hpp"
+#include "../detail/various.hpp"
+
+#include "../block/block_load_balance.hpp"
+#include "../block/block_store_func.hpp"
+
+#include "config_types.hpp"
+#include "instrumentation.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class OffsetIterator,
+         class SegmentIdIterator>
+ROCPRIM_KERNEL
+__launch_bounds__(BlockSize)
+void load_balanced_search_kernel(OffsetIterator     segment_offsets,
+                                 const unsigned int segments,
+                                 const size_t       outputs,
+                                 SegmentIdIterator  segment_ids_output)
+{
+    using block_load_balance_type = ::rocprim::block_load_balance<BlockSize, ItemsPerThread>;
+
+    ROCPRIM_SHARED_MEMORY typename block_load_balance_type::storage_type storage;
+
+    const unsigned int flat_id    = ::rocprim::detail::block_thread_id<0>();
+    const size_t       tile_begin = size_t(::rocprim::detail::block_id<0>())
+                              * block_load_balance_type::items_per_tile;
+
+    unsigned int segment_ids[ItemsPerThread];
+    size_t       tile_output_begin;
+    unsigned int tile_outputs;
+    block_load_balance_type().search(segment_offsets,
+                                     segments,
+                                     outputs,
+                                     tile_begin,
+                                     segment_ids,
+                                     tile_output_begin,
+                                     tile_outputs,
+                                     storage);
+
+    block_store_direct_blocked(flat_id,
+                               segment_ids_output + tile_output_begin,
+                               segment_ids,
+                               tile_outputs);
+}
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
+    { \
+        auto _error = hipGetLastError(); \
+        if(_error != hipSuccess) return _error; \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
+        if(debug_synchronous) \
+        { \
+            std::cout << name << "(" << size << ")"; \
+            _error = hipStreamSynchronize(stream); \
+            if(_error != hipSuccess) return _error; \
+            auto _end = std::chrono::high_resolution_clock::now(); \
+            auto _d = std::chrono::duration_cast<std::chrono::duration<double>>(_end - start); \
+            std::cout << " " << _d.count() * 1000 << " ms" << '\n'; \
+        } \
+    }
+
+template<class Config, class OffsetIterator, class SegmentIdIterator>
+inline hipError_t load_balanced_search_impl(OffsetIterator     segment_offsets,
+                                            const unsigned int segments,
+                                            const size_t       outputs,
+                                            SegmentIdIterator  segment_ids_output,
+                                            const hipStream_t  stream,
+                                            const bool         debug_synchronous)
+{
+    using config = default_or_custom_config<Config, kernel_config<256, 8>>;
+
+    static constexpr unsigned int block_size       = config::block_size;
+    static constexpr unsigned int items_per_thread = config::items_per_thread;
+    static constexpr unsigned int items_per_block
+        = block_load_balance<block_size, items_per_thread>::items_per_tile;
+
+    if(outputs == 0)
+    {
+        return hipSuccess;
+    }
+
+    const size_t path_size
+        = block_load_balance<block_size, items_per_thread>::path_size(segments, outputs);
+    const size_t number_of_blocks = (path_size + items_per_block - 1) / items_per_block;
+
+    if(debug_synchronous)
+    {
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << number_of_blocks << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+    }
+
+    // Start point for time measurements
+    std::chrono::high_resolution_clock::time_point start;
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("load_balanced_search_kernel");
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(load_balanced_search_kernel<
+            block_size, items_per_thread, OffsetIterator, SegmentIdIterator
+        >),
+        dim3(number_of_blocks), dim3(block_size), 0, stream,
+        segment_offsets, segments, outputs, segment_ids_output
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("load_balanced_search_kernel", outputs, start);
+
+    return hipSuccess;
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
+} // end of detail namespace
+
+/// \brief Parallel load-balanced search primitive for device level.
+///
+/// load_balanced_search expands CSR-like segments to their work items: for every output \p i
+/// it writes the segment \p s that contains it, <tt>segment_offsets[s] <= i <
+/// segment_offsets[s + 1]</tt>. For example with the row offsets of a CSR matrix it writes
+/// the row of every nonzero, so that a following pass over the nonzeros has exactly the same
+/// work per thread regardless of the lengths of the rows.
+///
+/// \par Overview
+/// * \p segment_offsets are the offsets of the first outputs of the segments, the exclusive scan
+///   of their numbers of outputs. They must be sorted in ascending order, the first one must be
+///   \p 0 and the others must not be larger than \p outputs. The last segment ends at \p outputs.
+/// * The outputs and the ends of the segments are merged as in a merge path (see
+///   \p block_load_balance) and every block processes the same number of steps of the path,
+///   so long segments and runs of empty segments are split evenly over the blocks. Empty
+///   segments have no outputs.
+/// * No temporary storage is needed, every block finds its part of the path by a binary search.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p kernel_config or
+/// a custom class with the same members.
+/// \tparam OffsetIterator - random-access iterator type of the offsets of the segments. It can be
+/// a simple pointer type.
+/// \tparam SegmentIdIterator - random-access iterator type of the output range. Its elements
+/// must be assignable from \p unsigned \p int. It can be a simple pointer type.
+///
+/// \param [in] segment_offsets - iterator to the offsets of the first outputs of the segments.
+/// \param [in] segments - the number of segments.
+/// \param [in] outputs - the total number of outputs of the segments.
+/// \param [out] segment_ids_output - iterator to the first element of the output range, it must
+/// have at least \p outputs elements.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after a successful launch; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int segments;       // e.g., 5
+/// int * segment_offsets;       // e.g., [0, 3, 3, 4, 4]
+/// size_t outputs;              // e.g., 7
+/// unsigned int * segment_ids;  // empty array of 7 elements
+///
+/// rocprim::load_balanced_search(segment_offsets, segments, outputs, segment_ids);
+/// // segment_ids: [0, 0, 0, 2, 4, 4, 4]
+/// \endcode
+/// \endparblock
+template<class Config = default_config, class OffsetIterator, class SegmentIdIterator>
+inline hipError_t load_balanced_search(OffsetIterator     segment_offsets,
+                                       const unsigned int segments,
+                                       const size_t       outputs,
+                                       SegmentIdIterator  segment_ids_output,
+                                       const hipStream_t  stream            = 0,
+                                       const bool         debug_synchronous = false)
+{
+    return detail::load_balanced_search_impl<Config>(segment_offsets,
+                                                     segments,
+                                                     outputs,
+                                                     segment_ids_output,
+                                                     stream,
+                                                     debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_LOAD_BALANCED_SEARCH_HPP_
@@ -23,6 +23,7 @@
 
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <type_traits>
 
 #include "../config.hpp"
@@ -31,6 +32,7 @@
 
 #include "device_merge_config.hpp"
 #include "detail/device_merge.hpp"
+#include "instrumentation.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -98,6 +100,7 @@ void merge_kernel(IndexIterator index,
     { \
         auto _error = hipGetLastError(); \
         if(_error != hipSuccess) return _error; \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
         if(debug_synchronous) \
         { \
             std::cout << name << "(" << size << ")"; \
@@ -111,6 +114,7 @@ void merge_kernel(IndexIterator index,
 
 template<
     class Config,
+    class OffsetT,
     class KeysInputIterator1,
     class KeysInputIterator2,
     class KeysOutputIterator,
@@ -120,19 +124,19 @@ template<
     class BinaryFunction
 >
 inline
-hipError_t merge_impl(void * temporary_storage,
-                      size_t& storage_size,
-                      KeysInputIterator1 keys_input1,
-                      KeysInputIterator2 keys_input2,
-                      KeysOutputIterator keys_output,
-                      ValuesInputIterator1 values_input1,
-                      ValuesInputIterator2 values_input2,
-                      ValuesOutputIterator values_output,
-                      const size_t input1_size,
-                      const size_t input2_size,
-                      BinaryFunction compare_function,
-                      const hipStream_t stream,
-                      bool debug_synchronous)
+hipError_t merge_offset_impl(void * temporary_storage,
+                             size_t& storage_size,
+                             KeysInputIterator1 keys_input1,
+                             KeysInputIterator2 keys_input2,
+                             KeysOutputIterator keys_output,
+                             ValuesInputIterator1 values_input1,
+                             ValuesInputIterator2 values_input2,
+                             ValuesOutputIterator values_output,
+                             const size_t input1_size,
+                             const size_t input2_size,
+                             BinaryFunction compare_function,
+                             const hipStream_t stream,
+                             bool debug_synchronous)
 
 {
     using key_type = typename std::iterator_traits<KeysInputIterator1>::value_type;
@@ -149,10 +153,10 @@ hipError_t merge_impl(void * temporary_storage,
     static constexpr unsigned int items_per_thread = config::items_per_thread;
     static constexpr auto items_per_block = block_size * items_per_thread;
 
-    const unsigned int partitions
-        = ((input1_size + input2_size) + items_per_block - 1) / items_per_block;
+    const unsigned int partitions = static_cast<unsigned int>(
+        ((input1_size + input2_size) + items_per_block - 1) / items_per_block);
 
-    unsigned int* index;
+    OffsetT* index;
 
     const hipError_t partition_result = detail::temp_storage::partition(
         temporary_storage,
@@ -180,6 +184,7 @@ hipError_t merge_impl(void * temporary_storage,
     const unsigned partition_blocks = ((partitions + 1) + half_block - 1) / half_block;
 
     if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("partition_kernel");
     hipLaunchKernelGGL(
         HIP_KERNEL_NAME(detail::partition_kernel),
         dim3(partition_blocks), dim3(half_block), 0, stream,
@@ -189,6 +194,7 @@ hipError_t merge_impl(void * temporary_storage,
     ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("partition_kernel", input1_size, start);
 
     if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("merge_kernel");
     hipLaunchKernelGGL(
         HIP_KERNEL_NAME(detail::merge_kernel<block_size, items_per_thread>),
         dim3(number_of_blocks), dim3(block_size), 0, stream,
@@ -201,6 +207,49 @@ hipError_t merge_impl(void * temporary_storage,
     return hipSuccess;
 }
 
+template<
+    class Config,
+    class KeysInputIterator1,
+    class KeysInputIterator2,
+    class KeysOutputIterator,
+    class ValuesInputIterator1,
+    class ValuesInputIterator2,
+    class ValuesOutputIterator,
+    class BinaryFunction
+>
+inline
+hipError_t merge_impl(void * temporary_storage,
+                      size_t& storage_size,
+                      KeysInputIterator1 keys_input1,
+                      KeysInputIterator2 keys_input2,
+                      KeysOutputIterator keys_output,
+                      ValuesInputIterator1 values_input1,
+                      ValuesInputIterator2 values_input2,
+                      ValuesOutputIterator values_output,
+                      const size_t input1_size,
+                      const size_t input2_size,
+                      BinaryFunction compare_function,
+                      const hipStream_t stream,
+                      bool debug_synchronous)
+{
+    // The partitions are 32-bit offsets while the offsets of the last block can not overflow them
+    if(input1_size + input2_size <= std::numeric_limits<unsigned int>::max() / 2)
+    {
+        return merge_offset_impl<Config, unsigned int>(temporary_storage, storage_size,
+                                                       keys_input1, keys_input2, keys_output,
+                                                       values_input1, values_input2,
+                                                       values_output,
+                                                       input1_size, input2_size,
+                                                       compare_function, stream,
+                                                       debug_synchronous);
+    }
+    return merge_offset_impl<Config, size_t>(temporary_storage, storage_size,
+                                             keys_input1, keys_input2, keys_output,
+                                             values_input1, values_input2, values_output,
+                                             input1_size, input2_size,
+                                             compare_function, stream, debug_synchronous);
+}
+
 #undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
 
 } // end of detail namespace
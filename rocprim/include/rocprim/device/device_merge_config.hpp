@@ -146,7 +146,11 @@ struct default_merge_config
         select_arch_case<803, merge_config_803<Key, Value>>,
         select_arch_case<900, merge_config_900<Key, Value>>,
         select_arch_case<ROCPRIM_ARCH_90a, merge_config_90a<Key, Value>>,
+        select_arch_case<940, merge_config_90a<Key, Value>>,
+        select_arch_case<941, merge_config_90a<Key, Value>>,
+        select_arch_case<942, merge_config_90a<Key, Value>>,
         select_arch_case<1030, merge_config_1030<Key, Value>>,
+        select_arch_case<1100, merge_config_1030<Key, Value>>,
         merge_config_900<Key, Value>
     > { };
 
@@ -0,0 +1,448 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_MERGE_K_HPP_
+#define ROCPRIM_DEVICE_DEVICE_MERGE_K_HPP_
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+
+#include "device_merge_config.hpp"
+#include "detail/device_merge_k.hpp"
+#include "instrumentation.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+template<
+    class KeysInputsIterator,
+    class RunSizesIterator,
+    class BinaryFunction
+>
+ROCPRIM_KERNEL
+__launch_bounds__(merge_k_partition_block_size)
+void merge_k_partition_kernel(unsigned int* splits,
+                              KeysInputsIterator keys_inputs,
+                              RunSizesIterator run_sizes,
+                              const unsigned int runs,
+                              const unsigned int size,
+                              const unsigned int spacing,
+                              BinaryFunction compare_function)
+{
+    merge_k_partition_kernel_impl<merge_k_partition_block_size, merge_k_partition_runs_per_thread>(
+        splits, keys_inputs, run_sizes, runs, size, spacing, compare_function
+    );
+}
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    class KeysInputsIterator,
+    class KeysOutputIterator,
+    class ValuesInputsIterator,
+    class ValuesOutputIterator,
+    class BinaryFunction
+>
+ROCPRIM_KERNEL
+__launch_bounds__(BlockSize)
+void merge_k_kernel(const unsigned int* splits,
+                    KeysInputsIterator keys_inputs,
+                    KeysOutputIterator keys_output,
+                    ValuesInputsIterator values_inputs,
+                    ValuesOutputIterator values_output,
+                    const unsigned int runs,
+                    const unsigned int size,
+                    BinaryFunction compare_function)
+{
+    merge_k_kernel_impl<BlockSize, ItemsPerThread, merge_k_max_runs>(
+        splits, keys_inputs, keys_output, values_inputs, values_output,
+        runs, size, compare_function
+    );
+}
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
+    { \
+        auto _error = hipGetLastError(); \
+        if(_error != hipSuccess) return _error; \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
+        if(debug_synchronous) \
+        { \
+            std::cout << name << "(" << size << ")"; \
+            auto __error = hipStreamSynchronize(stream); \
+            if(__error != hipSuccess) return __error; \
+            auto _end = std::chrono::high_resolution_clock::now(); \
+            auto _d = std::chrono::duration_cast<std::chrono::duration<double>>(_end - start); \
+            std::cout << " " << _d.count() * 1000 << " ms" << '\n'; \
+        } \
+    }
+
+template<
+    class Config,
+    class KeysInputsIterator,
+    class KeysOutputIterator,
+    class ValuesInputsIterator,
+    class ValuesOutputIterator,
+    class RunSizesIterator,
+    class BinaryFunction
+>
+inline
+hipError_t merge_k_impl(void * temporary_storage,
+                        size_t& storage_size,
+                        KeysInputsIterator keys_inputs,
+                        KeysOutputIterator keys_output,
+                        ValuesInputsIterator values_inputs,
+                        ValuesOutputIterator values_output,
+                        RunSizesIterator run_sizes,
+                        const unsigned int runs,
+                        const size_t size,
+                        BinaryFunction compare_function,
+                        const hipStream_t stream,
+                        bool debug_synchronous)
+{
+    using keys_input_type = typename std::iterator_traits<KeysInputsIterator>::value_type;
+    using key_type = typename std::iterator_traits<keys_input_type>::value_type;
+
+    // Values are gathered from global memory, only keys are kept in shared memory
+    using config = detail::default_or_custom_config<
+        Config,
+        detail::default_merge_config<ROCPRIM_TARGET_ARCH, key_type, empty_type>
+    >;
+
+    static constexpr unsigned int block_size = config::block_size;
+    static constexpr unsigned int items_per_thread = config::items_per_thread;
+    static constexpr unsigned int items_per_block = block_size * items_per_thread;
+
+    if(runs > merge_k_max_runs || size > std::numeric_limits<unsigned int>::max())
+    {
+        return hipErrorInvalidValue;
+    }
+
+    const unsigned int blocks
+        = static_cast<unsigned int>((size + items_per_block - 1) / items_per_block);
+
+    unsigned int* splits;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::ptr_aligned_array(&splits, size_t(blocks + 1) * runs));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(blocks == 0u)
+        return hipSuccess;
+
+    // Start point for time measurements
+    std::chrono::high_resolution_clock::time_point start;
+
+    if(debug_synchronous)
+    {
+        std::cout << "runs " << runs << '\n';
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << blocks << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+    }
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("merge_k_partition_kernel");
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(detail::merge_k_partition_kernel),
+        dim3(blocks + 1), dim3(merge_k_partition_block_size), 0, stream,
+        splits, keys_inputs, run_sizes, runs, static_cast<unsigned int>(size),
+        items_per_block, compare_function
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("merge_k_partition_kernel", size, start);
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("merge_k_kernel");
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(detail::merge_k_kernel<block_size, items_per_thread>),
+        dim3(blocks), dim3(block_size), 0, stream,
+        splits, keys_inputs, keys_output, values_inputs, values_output,
+        runs, static_cast<unsigned int>(size), compare_function
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("merge_k_kernel", size, start);
+
+    return hipSuccess;
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
+} // end of detail namespace
+
+/// \brief Parallel k-way merge primitive for device level.
+///
+/// \p merge_k function performs a device-wide merge of \p runs sorted input ranges
+/// in one pass, instead of merging them pairwise.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the merging function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Every input range must be sorted with respect to \p compare_function.
+/// * The merge is stable: equal keys are ordered by the index of their input range,
+/// and keep their order inside a range.
+/// * \p keys_inputs and \p run_sizes must be device-accessible, they are read by the kernels.
+/// * At most 256 runs can be merged and \p size must not be greater than the maximum
+/// value of <tt>unsigned int</tt>, otherwise \p hipErrorInvalidValue is returned.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p merge_config or
+/// a custom class with the same members.
+/// \tparam KeysInputsIterator - random-access iterator type of the array of input ranges.
+/// Its value type must be a random-access iterator type, e.g. a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam RunSizesIterator - random-access iterator type of the sizes of input ranges. Its
+/// value type must be an integral type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the merge operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_inputs - iterator to the first of \p runs iterators to sorted input ranges.
+/// \param [out] keys_output - iterator to the first element in the output range.
+/// \param [in] run_sizes - iterator to the first of \p runs sizes of input ranges.
+/// \param [in] runs - number of input ranges.
+/// \param [in] size - total number of elements in all input ranges.
+/// \param [in] compare_function - binary operation function object that will be used for comparison.
+/// The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful merge; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level ascending merge of three ranges of \p int values
+/// is performed.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int runs;      // e.g., 3
+/// size_t size;            // e.g., 8
+/// int ** keys_inputs;     // e.g., [[0, 3, 6], [1, 4, 7], [2, 5]]
+/// size_t * run_sizes;     // e.g., [3, 3, 2]
+/// int * keys_output;      // empty array of 8 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::merge_k(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_inputs, keys_output, run_sizes, runs, size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform merge
+/// rocprim::merge_k(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_inputs, keys_output, run_sizes, runs, size
+/// );
+/// // keys_output: [0, 1, 2, 3, 4, 5, 6, 7]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class KeysInputsIterator,
+    class KeysOutputIterator,
+    class RunSizesIterator,
+    class BinaryFunction = ::rocprim::less<
+        typename std::iterator_traits<
+            typename std::iterator_traits<KeysInputsIterator>::value_type
+        >::value_type
+    >
+>
+inline
+hipError_t merge_k(void * temporary_storage,
+                   size_t& storage_size,
+                   KeysInputsIterator keys_inputs,
+                   KeysOutputIterator keys_output,
+                   RunSizesIterator run_sizes,
+                   const unsigned int runs,
+                   const size_t size,
+                   BinaryFunction compare_function = BinaryFunction(),
+                   const hipStream_t stream = 0,
+                   bool debug_synchronous = false)
+{
+    empty_type ** values = nullptr;
+    return detail::merge_k_impl<Config>(
+        temporary_storage, storage_size,
+        keys_inputs, keys_output, values, values,
+        run_sizes, runs, size, compare_function,
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel k-way merge primitive for device level.
+///
+/// \p merge_k function performs a device-wide merge of \p runs sorted input ranges
+/// of (key, value) pairs in one pass, instead of merging them pairwise.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the merging function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Every input range of keys must be sorted with respect to \p compare_function.
+/// * The merge is stable: equal keys are ordered by the index of their input range,
+/// and keep their order inside a range.
+/// * \p keys_inputs, \p values_inputs and \p run_sizes must be device-accessible,
+/// they are read by the kernels.
+/// * At most 256 runs can be merged and \p size must not be greater than the maximum
+/// value of <tt>unsigned int</tt>, otherwise \p hipErrorInvalidValue is returned.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p merge_config or
+/// a custom class with the same members.
+/// \tparam KeysInputsIterator - random-access iterator type of the array of keys input ranges.
+/// Its value type must be a random-access iterator type, e.g. a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the keys output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputsIterator - random-access iterator type of the array of values input ranges.
+/// Its value type must be a random-access iterator type, e.g. a simple pointer type.
+/// \tparam ValuesOutputIterator - random-access iterator type of the values output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam RunSizesIterator - random-access iterator type of the sizes of input ranges. Its
+/// value type must be an integral type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the merge operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_inputs - iterator to the first of \p runs iterators to sorted keys input ranges.
+/// \param [out] keys_output - iterator to the first key in the output range.
+/// \param [in] values_inputs - iterator to the first of \p runs iterators to values input ranges.
+/// \param [out] values_output - iterator to the first value in the output range.
+/// \param [in] run_sizes - iterator to the first of \p runs sizes of input ranges.
+/// \param [in] runs - number of input ranges.
+/// \param [in] size - total number of elements in all input ranges.
+/// \param [in] compare_function - binary operation function object that will be used for key comparison.
+/// The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful merge; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level ascending merge of three ranges of (\p int, \p int)
+/// pairs is performed.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int runs;      // e.g., 3
+/// size_t size;            // e.g., 6
+/// int ** keys_inputs;     // e.g., [[0, 2], [0, 1], [1, 2]]
+/// int ** values_inputs;   // e.g., [[10, 11], [20, 21], [30, 31]]
+/// size_t * run_sizes;     // e.g., [2, 2, 2]
+/// int * keys_output;      // empty array of 6 elements
+/// int * values_output;    // empty array of 6 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::merge_k(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_inputs, keys_output, values_inputs, values_output,
+///     run_sizes, runs, size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform merge
+/// rocprim::merge_k(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_inputs, keys_output, values_inputs, values_output,
+///     run_sizes, runs, size
+/// );
+/// // keys_output: [0, 0, 1, 1, 2, 2]
+/// // values_output: [10, 20, 21, 30, 11, 31]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class KeysInputsIterator,
+    class KeysOutputIterator,
+    class ValuesInputsIterator,
+    class ValuesOutputIterator,
+    class RunSizesIterator,
+    class BinaryFunction = ::rocprim::less<
+        typename std::iterator_traits<
+            typename std::iterator_traits<KeysInputsIterator>::value_type
+        >::value_type
+    >
+>
+inline
+hipError_t merge_k(void * temporary_storage,
+                   size_t& storage_size,
+                   KeysInputsIterator keys_inputs,
+                   KeysOutputIterator keys_output,
+                   ValuesInputsIterator values_inputs,
+                   ValuesOutputIterator values_output,
+                   RunSizesIterator run_sizes,
+                   const unsigned int runs,
+                   const size_t size,
+                   BinaryFunction compare_function = BinaryFunction(),
+                   const hipStream_t stream = 0,
+                   bool debug_synchronous = false)
+{
+    return detail::merge_k_impl<Config>(
+        temporary_storage, storage_size,
+        keys_inputs, keys_output, values_inputs, values_output,
+        run_sizes, runs, size, compare_function,
+        stream, debug_synchronous
+    );
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_MERGE_K_HPP_
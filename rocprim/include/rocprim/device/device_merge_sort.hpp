@@ -23,17 +23,21 @@
 
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <type_traits>
 
 #include "../config.hpp"
 #include "../detail/temp_storage.hpp"
 #include "../detail/various.hpp"
+#include "../iterator/counting_iterator.hpp"
 
 #include "detail/config/device_merge_sort.hpp"
 #include "detail/device_merge.hpp"
 #include "detail/device_merge_sort.hpp"
 #include "detail/device_merge_sort_mergepath.hpp"
+#include "device_select.hpp"
 #include "device_transform.hpp"
+#include "instrumentation.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -43,8 +47,10 @@ BEGIN_ROCPRIM_NAMESPACE
 namespace detail
 {
 
-template<unsigned int BlockSize,
-         unsigned int ItemsPerThread,
+template<unsigned int         BlockSize,
+         unsigned int         ItemsPerThread,
+         block_sort_algorithm Algorithm,
+         bool                 SkipSortedTiles,
          class KeysInputIterator,
          class KeysOutputIterator,
          class ValuesInputIterator,
@@ -59,12 +65,13 @@ ROCPRIM_KERNEL
                                                         const OffsetT        sorted_block_size,
                                                         BinaryFunction       compare_function)
 {
-    block_sort_kernel_impl<BlockSize, ItemsPerThread>(keys_input,
-                                                      keys_output,
-                                                      values_input,
-                                                      values_output,
-                                                      sorted_block_size,
-                                                      compare_function);
+    block_sort_kernel_impl<BlockSize, ItemsPerThread, Algorithm, SkipSortedTiles>(
+        keys_input,
+        keys_output,
+        values_input,
+        values_output,
+        sorted_block_size,
+        compare_function);
 }
 
 template<unsigned int BlockSize,
@@ -124,7 +131,40 @@ void block_merge_kernel(KeysInputIterator keys_input,
                                                        merge_partitions);
 }
 
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class OffsetT,
+         class BinaryFunction>
+ROCPRIM_KERNEL
+    __launch_bounds__(BlockSize) void block_merge_runs_kernel(KeysInputIterator    keys_input,
+                                                              KeysOutputIterator   keys_output,
+                                                              ValuesInputIterator  values_input,
+                                                              ValuesOutputIterator values_output,
+                                                              const OffsetT        input_size,
+                                                              BinaryFunction       compare_function,
+                                                              const OffsetT*       merge_partitions,
+                                                              const OffsetT*       run_starts,
+                                                              const unsigned int   run_count,
+                                                              const unsigned int   stride)
+{
+    block_merge_runs_kernel_impl<BlockSize, ItemsPerThread>(keys_input,
+                                                            keys_output,
+                                                            values_input,
+                                                            values_output,
+                                                            input_size,
+                                                            compare_function,
+                                                            merge_partitions,
+                                                            run_starts,
+                                                            run_count,
+                                                            stride);
+}
+
 #define ROCPRIM_DETAIL_HIP_SYNC(name, size, start) \
+    ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
     if(debug_synchronous) \
     { \
         std::cout << name << "(" << size << ")"; \
@@ -139,6 +179,7 @@ void block_merge_kernel(KeysInputIterator keys_input,
     { \
         auto _error = hipGetLastError(); \
         if(_error != hipSuccess) return _error; \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
         if(debug_synchronous) \
         { \
             std::cout << name << "(" << size << ")"; \
@@ -175,7 +216,7 @@ void device_mergepath_partition_kernel(KeysInputIterator keys,
     const unsigned int target_merged_tiles = merged_tiles * 2;
     const unsigned int mask = target_merged_tiles - 1;
     const unsigned int tilegroup_start_id = ~mask & partition_id; // id of the first tile in the current tile-group
-    const OffsetT tilegroup_start = ItemsPerTile * tilegroup_start_id; // index of the first item in the current tile-group
+    const OffsetT tilegroup_start = static_cast<OffsetT>(ItemsPerTile) * tilegroup_start_id; // index of the first item in the current tile-group
 
     const unsigned int local_tile_id = mask & partition_id; // id of the current tile in the current tile-group
 
@@ -184,7 +225,61 @@ void device_mergepath_partition_kernel(KeysInputIterator keys,
     const OffsetT keys2_beg = keys1_end;
     const OffsetT keys2_end = rocprim::min(input_size, keys2_beg + sorted_block_size);
 
-    const OffsetT partition_at = rocprim::min<OffsetT>(keys2_end - keys1_beg, ItemsPerTile * local_tile_id);
+    const OffsetT partition_at
+        = rocprim::min<OffsetT>(keys2_end - keys1_beg,
+                                static_cast<OffsetT>(ItemsPerTile) * local_tile_id);
+
+    const OffsetT partition_diag = ::rocprim::detail::merge_path(keys + keys1_beg,
+                                                                 keys + keys2_beg,
+                                                                 keys1_end - keys1_beg,
+                                                                 keys2_end - keys2_beg,
+                                                                 partition_at,
+                                                                 compare_op);
+
+    merge_partitions[partition_id] = keys1_beg + partition_diag;
+}
+
+// Partitions the merges of a pass of the natural merge sort, see merge_runs_tilegroup.
+template<unsigned int BlockSize, // BlockSize of the partition kernel
+         unsigned int ItemsPerTile, // ItemsPerTile of the block merge kernel
+         typename KeysInputIterator,
+         typename OffsetT,
+         typename CompareOpT>
+ROCPRIM_KERNEL
+__launch_bounds__(BlockSize)
+void device_mergepath_runs_partition_kernel(KeysInputIterator  keys,
+                                            const OffsetT      input_size,
+                                            const unsigned int num_partitions,
+                                            OffsetT*           merge_partitions,
+                                            const CompareOpT   compare_op,
+                                            const OffsetT*     run_starts,
+                                            const unsigned int run_count,
+                                            const unsigned int stride)
+{
+    const OffsetT partition_id = blockIdx.x * BlockSize + threadIdx.x;
+
+    if (partition_id >= num_partitions)
+    {
+        return;
+    }
+
+    OffsetT first_tile, mid_tile, end_tile;
+    merge_runs_tilegroup<OffsetT>(run_starts,
+                                  run_count,
+                                  stride,
+                                  num_partitions - 1,
+                                  partition_id,
+                                  first_tile,
+                                  mid_tile,
+                                  end_tile);
+
+    const OffsetT keys1_beg = rocprim::min(input_size, ItemsPerTile * first_tile);
+    const OffsetT keys1_end = rocprim::min(input_size, ItemsPerTile * mid_tile);
+    const OffsetT keys2_beg = keys1_end;
+    const OffsetT keys2_end = rocprim::min(input_size, ItemsPerTile * end_tile);
+
+    const OffsetT partition_at = rocprim::min<OffsetT>(keys2_end - keys1_beg,
+                                                       ItemsPerTile * (partition_id - first_tile));
 
     const OffsetT partition_diag = ::rocprim::detail::merge_path(keys + keys1_beg,
                                                                  keys + keys2_beg,
@@ -196,8 +291,37 @@ void device_mergepath_partition_kernel(KeysInputIterator keys,
     merge_partitions[partition_id] = keys1_beg + partition_diag;
 }
 
+// A sorted run of the natural merge sort starts at a tile if its first key is ordered before the
+// last key of the previous tile.
+template<unsigned int ItemsPerTile, class KeysIterator, class BinaryFunction, class OffsetT>
+struct merge_sort_run_start_op
+{
+    KeysIterator   keys;
+    BinaryFunction compare_function;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    bool operator()(const OffsetT tile) const
+    {
+        return tile == 0
+               || compare_function(keys[tile * ItemsPerTile], keys[tile * ItemsPerTile - 1]);
+    }
+};
+
+// Configurations with detect_sorted_runs true skip the block sort of sorted tiles and merge the
+// sorted runs of the input instead of blocks of fixed size. Configurations without the
+// detect_sorted_runs member do not detect sorted runs.
+template<class Config, class = void>
+struct merge_sort_detect_sorted_runs : std::false_type
+{};
+
+template<class Config>
+struct merge_sort_detect_sorted_runs<Config, void_t<decltype(Config::detect_sorted_runs)>>
+    : std::integral_constant<bool, Config::detect_sorted_runs>
+{};
+
 template<
     class Config,
+    class OffsetT,
     class KeysInputIterator,
     class KeysOutputIterator,
     class ValuesInputIterator,
@@ -205,18 +329,17 @@ template<
     class BinaryFunction
 >
 inline
-hipError_t merge_sort_impl(void * temporary_storage,
-                           size_t& storage_size,
-                           KeysInputIterator keys_input,
-                           KeysOutputIterator keys_output,
-                           ValuesInputIterator values_input,
-                           ValuesOutputIterator values_output,
-                           const unsigned int size,
-                           BinaryFunction compare_function,
-                           const hipStream_t stream,
-                           bool debug_synchronous)
+hipError_t merge_sort_direct_impl(void * temporary_storage,
+                                  size_t& storage_size,
+                                  KeysInputIterator keys_input,
+                                  KeysOutputIterator keys_output,
+                                  ValuesInputIterator values_input,
+                                  ValuesOutputIterator values_output,
+                                  const OffsetT size,
+                                  BinaryFunction compare_function,
+                                  const hipStream_t stream,
+                                  bool debug_synchronous)
 {
-    using OffsetT = unsigned int;
     using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
     using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
     constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
@@ -244,10 +367,16 @@ hipError_t merge_sort_impl(void * temporary_storage,
                   "merge_mergepath_items_per_block must be greater than or equal to sort_items_per_block");
     static_assert(sort_items_per_block % config::merge_impl1_config::block_size == 0,
                   "Merge block size must be a divisor of the items per block of the sort step");
+    static_assert(is_power_of_two(sort_items_per_block / merge_impl1_items_per_block),
+                  "The items per block of the sort step must be a power of two multiple of the "
+                  "merge block size");
 
-    const unsigned int sort_number_of_blocks = ceiling_div(size, sort_items_per_block);
-    const unsigned int merge_impl1_number_of_blocks = ceiling_div(size, merge_impl1_items_per_block);
-    const unsigned int merge_mergepath_number_of_blocks = ceiling_div(size, merge_mergepath_items_per_block);
+    const unsigned int sort_number_of_blocks
+        = static_cast<unsigned int>(ceiling_div(size, sort_items_per_block));
+    const unsigned int merge_impl1_number_of_blocks
+        = static_cast<unsigned int>(ceiling_div(size, merge_impl1_items_per_block));
+    const unsigned int merge_mergepath_number_of_blocks
+        = static_cast<unsigned int>(ceiling_div(size, merge_mergepath_items_per_block));
 
     bool use_mergepath = size > config::min_input_size_mergepath;
     // variables below used for mergepath
@@ -255,9 +384,42 @@ hipError_t merge_sort_impl(void * temporary_storage,
     const unsigned int merge_partition_number_of_blocks
         = ceiling_div(merge_num_partitions, merge_partition_block_size);
 
+    // Sorted tiles are not sorted by the block-sort step if sorted runs are detected. The runs
+    // start at the tiles of the merge step, so they are merged only if those are the sorted tiles.
+    constexpr bool skip_sorted_tiles = merge_sort_detect_sorted_runs<config>::value;
+    constexpr bool natural_merge
+        = skip_sorted_tiles && merge_mergepath_items_per_block == sort_items_per_block;
+    using run_start_op
+        = merge_sort_run_start_op<merge_mergepath_items_per_block,
+                                  key_type*,
+                                  BinaryFunction,
+                                  OffsetT>;
+    const bool detect_runs = natural_merge && use_mergepath;
+
+    size_t select_storage_size = 0;
+    if ROCPRIM_IF_CONSTEXPR(natural_merge)
+    {
+        if(detect_runs)
+        {
+            const hipError_t error
+                = ::rocprim::select(nullptr,
+                                    select_storage_size,
+                                    ::rocprim::counting_iterator<OffsetT>(0),
+                                    static_cast<OffsetT*>(nullptr),
+                                    static_cast<OffsetT*>(nullptr),
+                                    merge_mergepath_number_of_blocks,
+                                    run_start_op{nullptr, compare_function},
+                                    stream);
+            if(error != hipSuccess) return error;
+        }
+    }
+
     OffsetT*    d_merge_partitions;
     key_type*   keys_buffer;
     value_type* values_buffer;
+    OffsetT*    d_run_starts;
+    OffsetT*    d_run_count;
+    void*       select_storage;
 
     const hipError_t partition_result = detail::temp_storage::partition(
         temporary_storage,
@@ -266,13 +428,18 @@ hipError_t merge_sort_impl(void * temporary_storage,
             detail::temp_storage::ptr_aligned_array(&d_merge_partitions,
                                                     use_mergepath ? merge_num_partitions : 0),
             detail::temp_storage::ptr_aligned_array(&keys_buffer, size),
-            detail::temp_storage::ptr_aligned_array(&values_buffer, with_values ? size : 0)));
+            detail::temp_storage::ptr_aligned_array(&values_buffer, with_values ? size : 0),
+            detail::temp_storage::ptr_aligned_array(
+                &d_run_starts,
+                detect_runs ? merge_mergepath_number_of_blocks : 0),
+            detail::temp_storage::ptr_aligned_array(&d_run_count, detect_runs ? 1 : 0),
+            detail::temp_storage::make_partition(&select_storage, select_storage_size)));
     if(partition_result != hipSuccess || temporary_storage == nullptr)
     {
         return partition_result;
     }
 
-    if( size == size_t(0) )
+    if( size == OffsetT(0) )
         return hipSuccess;
 
     if(debug_synchronous)
@@ -299,9 +466,13 @@ hipError_t merge_sort_impl(void * temporary_storage,
     // Start point for time measurements
     std::chrono::high_resolution_clock::time_point start;
     if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("block_sort_kernel");
 
     hipLaunchKernelGGL(
-        HIP_KERNEL_NAME(block_sort_kernel<sort_block_size, sort_items_per_thread>),
+        HIP_KERNEL_NAME(block_sort_kernel<sort_block_size,
+                                          sort_items_per_thread,
+                                          config::sort_algorithm,
+                                          skip_sorted_tiles>),
         dim3(sort_number_of_blocks), dim3(sort_block_size), 0, stream,
         keys_input, keys_buffer, values_input, values_buffer,
         size, compare_function
@@ -309,7 +480,117 @@ hipError_t merge_sort_impl(void * temporary_storage,
     ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("block_sort_kernel", size, start);
 
     bool temporary_store = true;
-    for(OffsetT block = sort_items_per_block; block < size; block *= 2)
+
+    // The natural merge sort merges pairs of sorted runs until one run is left, so an input of
+    // k sorted runs needs ceil(log2(k)) merge passes. The host reads the number of runs, which it
+    // cannot while the stream is captured to a graph, then the blocks are merged instead.
+    bool merge_runs = false;
+    if ROCPRIM_IF_CONSTEXPR(natural_merge)
+    {
+        bool capturing = false;
+        if(detect_runs)
+        {
+            const hipError_t error = detail::is_stream_capturing(stream, capturing);
+            if(error != hipSuccess) return error;
+        }
+        merge_runs = detect_runs && !capturing;
+
+        if(merge_runs)
+        {
+            hipError_t error = ::rocprim::select(select_storage,
+                                                 select_storage_size,
+                                                 ::rocprim::counting_iterator<OffsetT>(0),
+                                                 d_run_starts,
+                                                 d_run_count,
+                                                 merge_mergepath_number_of_blocks,
+                                                 run_start_op{keys_buffer, compare_function},
+                                                 stream,
+                                                 debug_synchronous);
+            if(error != hipSuccess) return error;
+
+            OffsetT run_count;
+            error = detail::memcpy_and_sync(&run_count,
+                                            d_run_count,
+                                            sizeof(run_count),
+                                            hipMemcpyDeviceToHost,
+                                            stream);
+            if(error != hipSuccess) return error;
+            if(debug_synchronous)
+            {
+                std::cout << "run_count: " << run_count << '\n';
+            }
+
+            for(unsigned int stride = 1; stride < run_count; stride *= 2)
+            {
+                temporary_store = !temporary_store;
+
+                const auto merge_runs_step = [&](auto keys_input_,
+                                                 auto keys_output_,
+                                                 auto values_input_,
+                                                 auto values_output_) -> hipError_t {
+                    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+                    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("device_mergepath_runs_partition_kernel");
+                    hipLaunchKernelGGL(
+                        HIP_KERNEL_NAME(device_mergepath_runs_partition_kernel<
+                                        merge_partition_block_size,
+                                        merge_mergepath_items_per_block>),
+                        dim3(merge_partition_number_of_blocks),
+                        dim3(merge_partition_block_size),
+                        0,
+                        stream,
+                        keys_input_,
+                        size,
+                        merge_num_partitions,
+                        d_merge_partitions,
+                        compare_function,
+                        d_run_starts,
+                        run_count,
+                        stride);
+                    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(
+                        "device_mergepath_runs_partition_kernel",
+                        size,
+                        start);
+
+                    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+                    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("block_merge_runs_kernel");
+                    hipLaunchKernelGGL(
+                        HIP_KERNEL_NAME(block_merge_runs_kernel<merge_mergepath_block_size,
+                                                                merge_mergepath_items_per_thread>),
+                        dim3(merge_mergepath_number_of_blocks),
+                        dim3(merge_mergepath_block_size),
+                        0,
+                        stream,
+                        keys_input_,
+                        keys_output_,
+                        values_input_,
+                        values_output_,
+                        size,
+                        compare_function,
+                        d_merge_partitions,
+                        d_run_starts,
+                        run_count,
+                        stride);
+                    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("block_merge_runs_kernel",
+                                                                size,
+                                                                start);
+                    return hipSuccess;
+                };
+
+                if(temporary_store)
+                {
+                    error = merge_runs_step(keys_output, keys_buffer, values_output, values_buffer);
+                }
+                else
+                {
+                    error = merge_runs_step(keys_buffer, keys_output, values_buffer, values_output);
+                }
+                if(error != hipSuccess) return error;
+            }
+        }
+    }
+
+    // The blocks are not merged if the runs have been merged
+    for(OffsetT block = merge_runs ? size : sort_items_per_block; block < size; block *= 2)
     {
         temporary_store = !temporary_store;
 
@@ -320,6 +601,7 @@ hipError_t merge_sort_impl(void * temporary_storage,
             if(use_mergepath)
             {
                 if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+                ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("device_mergepath_partition_kernel");
                 hipLaunchKernelGGL(HIP_KERNEL_NAME(device_mergepath_partition_kernel<merge_partition_block_size, merge_mergepath_items_per_block>),
                                    dim3(merge_partition_number_of_blocks), dim3(merge_partition_block_size), 0, stream,
                                    keys_input_, size, merge_num_partitions, d_merge_partitions,
@@ -327,6 +609,7 @@ hipError_t merge_sort_impl(void * temporary_storage,
                 ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("device_mergepath_partition_kernel", size, start);
 
                 if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+                ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("block_merge_kernel");
                 hipLaunchKernelGGL(
                     HIP_KERNEL_NAME(block_merge_kernel<merge_mergepath_block_size, merge_mergepath_items_per_thread>),
                     dim3(merge_mergepath_number_of_blocks), dim3(merge_mergepath_block_size), 0, stream,
@@ -338,6 +621,7 @@ hipError_t merge_sort_impl(void * temporary_storage,
             else
             {
                 if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+                ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("block_merge_kernel");
                 hipLaunchKernelGGL(
                     HIP_KERNEL_NAME(
                         block_merge_kernel<merge_impl1_block_size, merge_impl1_items_per_thread>),
@@ -390,6 +674,251 @@ hipError_t merge_sort_impl(void * temporary_storage,
     return hipSuccess;
 }
 
+template<class ValuesInputIterator, class OffsetT>
+struct merge_sort_gather_op
+{
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+
+    ValuesInputIterator values_input;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    value_type operator()(const OffsetT index) const
+    {
+        return values_input[index];
+    }
+};
+
+template<class ValuesInputIterator, class ValuesOutputIterator>
+inline bool merge_sort_values_alias(ValuesInputIterator, ValuesOutputIterator)
+{
+    return false;
+}
+
+template<class T>
+inline bool merge_sort_values_alias(T* values_input, T* values_output)
+{
+    return values_input == values_output;
+}
+
+template<class T>
+inline bool merge_sort_values_alias(const T* values_input, T* values_output)
+{
+    return values_input == values_output;
+}
+
+// Sorts (key, index) pairs and gathers the values once at the end, so large values are read
+// and written once instead of once per merge pass
+template<
+    class Config,
+    class OffsetT,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class BinaryFunction
+>
+inline
+hipError_t merge_sort_indirect_impl(void * temporary_storage,
+                                    size_t& storage_size,
+                                    KeysInputIterator keys_input,
+                                    KeysOutputIterator keys_output,
+                                    ValuesInputIterator values_input,
+                                    ValuesOutputIterator values_output,
+                                    const OffsetT size,
+                                    BinaryFunction compare_function,
+                                    const hipStream_t stream,
+                                    bool debug_synchronous)
+{
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    using gather_op  = merge_sort_gather_op<ValuesInputIterator, OffsetT>;
+
+    const ::rocprim::counting_iterator<OffsetT> indices_input(0);
+
+    OffsetT*      indices_output         = nullptr;
+    value_type*   values_buffer          = nullptr;
+    void*         sort_temporary_storage = nullptr;
+    size_t        sort_storage_size;
+
+    hipError_t error = merge_sort_direct_impl<Config>(nullptr,
+                                                      sort_storage_size,
+                                                      keys_input,
+                                                      keys_output,
+                                                      indices_input,
+                                                      indices_output,
+                                                      size,
+                                                      compare_function,
+                                                      stream,
+                                                      debug_synchronous);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    error = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&indices_output, size),
+            detail::temp_storage::ptr_aligned_array(&values_buffer, size),
+            detail::temp_storage::make_partition(&sort_temporary_storage, sort_storage_size)));
+    if(error != hipSuccess || temporary_storage == nullptr)
+    {
+        return error;
+    }
+
+    if( size == OffsetT(0) )
+        return hipSuccess;
+
+    error = merge_sort_direct_impl<Config>(sort_temporary_storage,
+                                           sort_storage_size,
+                                           keys_input,
+                                           keys_output,
+                                           indices_input,
+                                           indices_output,
+                                           size,
+                                           compare_function,
+                                           stream,
+                                           debug_synchronous);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    // Sorting in place: the values can not be gathered into the range they are read from
+    if(merge_sort_values_alias(values_input, values_output))
+    {
+        error = ::rocprim::transform(indices_output,
+                                     values_buffer,
+                                     size,
+                                     gather_op{values_input},
+                                     stream,
+                                     debug_synchronous);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        return ::rocprim::transform(values_buffer,
+                                    values_output,
+                                    size,
+                                    ::rocprim::identity<value_type>(),
+                                    stream,
+                                    debug_synchronous);
+    }
+
+    return ::rocprim::transform(indices_output,
+                                values_output,
+                                size,
+                                gather_op{values_input},
+                                stream,
+                                debug_synchronous);
+}
+
+template<
+    class Config,
+    class OffsetT,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class BinaryFunction
+>
+inline
+hipError_t merge_sort_impl(void * temporary_storage,
+                           size_t& storage_size,
+                           KeysInputIterator keys_input,
+                           KeysOutputIterator keys_output,
+                           ValuesInputIterator values_input,
+                           ValuesOutputIterator values_output,
+                           const OffsetT size,
+                           BinaryFunction compare_function,
+                           const hipStream_t stream,
+                           bool debug_synchronous,
+                           std::false_type /*use_indirect*/)
+{
+    return merge_sort_direct_impl<Config>(temporary_storage, storage_size,
+                                          keys_input, keys_output, values_input, values_output,
+                                          size, compare_function, stream, debug_synchronous);
+}
+
+template<
+    class Config,
+    class OffsetT,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class BinaryFunction
+>
+inline
+hipError_t merge_sort_impl(void * temporary_storage,
+                           size_t& storage_size,
+                           KeysInputIterator keys_input,
+                           KeysOutputIterator keys_output,
+                           ValuesInputIterator values_input,
+                           ValuesOutputIterator values_output,
+                           const OffsetT size,
+                           BinaryFunction compare_function,
+                           const hipStream_t stream,
+                           bool debug_synchronous,
+                           std::true_type /*use_indirect*/)
+{
+    return merge_sort_indirect_impl<Config>(temporary_storage, storage_size,
+                                            keys_input, keys_output, values_input, values_output,
+                                            size, compare_function, stream, debug_synchronous);
+}
+
+template<
+    class Config,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class BinaryFunction
+>
+inline
+hipError_t merge_sort_impl(void * temporary_storage,
+                           size_t& storage_size,
+                           KeysInputIterator keys_input,
+                           KeysOutputIterator keys_output,
+                           ValuesInputIterator values_input,
+                           ValuesOutputIterator values_output,
+                           const size_t size,
+                           BinaryFunction compare_function,
+                           const hipStream_t stream,
+                           bool debug_synchronous)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+
+    using config = default_or_custom_config<
+        Config,
+        default_merge_sort_config<ROCPRIM_TARGET_ARCH, key_type, value_type>
+    >;
+
+    // Values larger than the threshold are sorted as indices
+    using use_indirect = std::integral_constant<
+        bool,
+        with_values && (sizeof(value_type) > config::indirect_value_size_threshold)
+            && (sizeof(value_type) > sizeof(unsigned int))>;
+
+    // The offsets of a merge pass reach up to three times the size, 32-bit offsets are used
+    // while they can not overflow
+    if(size <= std::numeric_limits<unsigned int>::max() / 4)
+    {
+        return merge_sort_impl<Config, unsigned int>(temporary_storage, storage_size,
+                                                     keys_input, keys_output,
+                                                     values_input, values_output,
+                                                     static_cast<unsigned int>(size),
+                                                     compare_function, stream, debug_synchronous,
+                                                     use_indirect{});
+    }
+    return merge_sort_impl<Config, size_t>(temporary_storage, storage_size,
+                                           keys_input, keys_output, values_input, values_output,
+                                           size, compare_function, stream, debug_synchronous,
+                                           use_indirect{});
+}
+
 #undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
 #undef ROCPRIM_DETAIL_HIP_SYNC
 
@@ -405,6 +934,9 @@ hipError_t merge_sort_impl(void * temporary_storage,
 /// * Returns the required size of \p temporary_storage in \p storage_size
 /// if \p temporary_storage in a null pointer.
 /// * Accepts custom compare_functions for sorting across the device.
+/// * With \p DetectSortedRuns of \p merge_sort_config, inputs made of a few long sorted runs,
+/// for example nearly sorted inputs or concatenations of sorted inputs, are sorted by a natural
+/// merge sort, which merges the runs instead of blocks of fixed size.
 ///
 /// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
@@ -481,7 +1013,7 @@ hipError_t merge_sort(void * temporary_storage,
     empty_type * values = nullptr;
     return detail::merge_sort_impl<Config>(
         temporary_storage, storage_size,
-        keys_input, keys_output, values, values, size,
+        detail::to_kernel_input_iterator(keys_input), keys_output, values, values, size,
         compare_function, stream, debug_synchronous
     );
 }
@@ -496,6 +1028,11 @@ hipError_t merge_sort(void * temporary_storage,
 /// * Returns the required size of \p temporary_storage in \p storage_size
 /// if \p temporary_storage in a null pointer.
 /// * Accepts custom compare_functions for sorting across the device.
+/// * With \p DetectSortedRuns of \p merge_sort_config, inputs made of a few long sorted runs are
+/// sorted by a natural merge sort, which merges the runs instead of blocks of fixed size.
+/// * Values larger than \p IndirectValueSizeThreshold of \p merge_sort_config (32 bytes by
+/// default) are sorted indirectly: (key, index) pairs are sorted and the values are gathered
+/// into \p values_output once, instead of being moved by every merge step.
 ///
 /// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
@@ -586,7 +1123,79 @@ hipError_t merge_sort(void * temporary_storage,
 {
     return detail::merge_sort_impl<Config>(
         temporary_storage, storage_size,
-        keys_input, keys_output, values_input, values_output, size,
+        detail::to_kernel_input_iterator(keys_input), keys_output,
+        detail::to_kernel_input_iterator(values_input), values_output, size,
+        compare_function, stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel merge argsort primitive for device level.
+///
+/// \p merge_sort_argsort function performs a device-wide merge sort of keys based on comparison
+/// function and writes the sorting permutation, the indices of the input keys in the sorted
+/// order, to \p indices_output.
+///
+/// \par Overview
+/// * The indices are generated while the keys are loaded, an index array does not have to be
+/// allocated, filled and read by the first pass. Keys that are equivalent keep the order of
+/// their indices.
+/// * The sorted keys are written to \p keys_output.
+/// * The \p value_type of \p IndicesOutputIterator must be an integral type that can represent
+/// <tt>size - 1</tt>.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p merge_sort_config or
+/// a custom class with the same members.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam IndicesOutputIterator - random-access iterator type of the output range of indices.
+/// Must meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam BinaryFunction - type of binary function used for sort. Default type
+/// is \p rocprim::less<T>, where \p T is a \p value_type of \p KeysInputIterator.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [out] indices_output - pointer to the first element in the output range of indices.
+/// \param [in] size - number of element in the input range.
+/// \param [in] compare_function - binary operation function object that will be used for
+/// comparison. The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class IndicesOutputIterator,
+    class BinaryFunction = ::rocprim::less<typename std::iterator_traits<KeysInputIterator>::value_type>
+>
+inline
+hipError_t merge_sort_argsort(void * temporary_storage,
+                              size_t& storage_size,
+                              KeysInputIterator keys_input,
+                              KeysOutputIterator keys_output,
+                              IndicesOutputIterator indices_output,
+                              const size_t size,
+                              BinaryFunction compare_function = BinaryFunction(),
+                              const hipStream_t stream = 0,
+                              bool debug_synchronous = false)
+{
+    using index_type = typename std::iterator_traits<IndicesOutputIterator>::value_type;
+    static_assert(std::is_integral<index_type>::value, "Indices must be of an integral type.");
+    return detail::merge_sort_impl<Config>(
+        temporary_storage, storage_size,
+        detail::to_kernel_input_iterator(keys_input), keys_output,
+        ::rocprim::counting_iterator<index_type>(0), indices_output, size,
         compare_function, stream, debug_synchronous
     );
 }
@@ -0,0 +1,283 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_MOMENTS_HPP_
+#define ROCPRIM_DEVICE_DEVICE_MOMENTS_HPP_
+
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../functional.hpp"
+#include "../detail/various.hpp"
+#include "../iterator/transform_iterator.hpp"
+
+#include "device_reduce.hpp"
+#include "device_segmented_reduce.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+/// \brief The count, mean and sum of squared deviations from the mean of a range of values,
+/// the result of \p moments and \p segmented_moments.
+///
+/// \tparam T - the floating-point type of the mean and of the sum of squared deviations.
+template<class T>
+struct moments_result
+{
+    /// \brief The number of values.
+    size_t count;
+    /// \brief The mean of the values, 0 if there are no values.
+    T mean;
+    /// \brief The sum of the squared deviations of the values from \p mean.
+    T m2;
+
+    /// \brief Returns the population variance, \p m2 divided by \p count.
+    ROCPRIM_HOST_DEVICE inline
+    T variance() const
+    {
+        return count == 0 ? T(0) : m2 / static_cast<T>(count);
+    }
+
+    /// \brief Returns the sample variance, \p m2 divided by <tt>count - 1</tt>.
+    ROCPRIM_HOST_DEVICE inline
+    T sample_variance() const
+    {
+        return count < 2 ? T(0) : m2 / static_cast<T>(count - 1);
+    }
+};
+
+namespace detail
+{
+
+// double values are accumulated in double, other values in float
+template<class T>
+using moments_accumulator_t =
+    typename std::conditional<std::is_same<T, double>::value, double, float>::type;
+
+template<class T>
+struct moments_from_value_op
+{
+    template<class U>
+    ROCPRIM_HOST_DEVICE inline
+    moments_result<T> operator()(const U& value) const
+    {
+        return moments_result<T>{1, static_cast<T>(value), T(0)};
+    }
+};
+
+// Combines the moments of two ranges (Chan et al.), the mean is moved towards the mean of b by
+// its share of the count and the sum of squared deviations is corrected by the difference of the
+// means. Empty ranges have no weight, so they are identities without a branch.
+template<class T>
+struct moments_combine_op
+{
+    ROCPRIM_HOST_DEVICE inline
+    moments_result<T> operator()(const moments_result<T>& a, const moments_result<T>& b) const
+    {
+        const size_t count   = a.count + b.count;
+        const T      delta   = b.mean - a.mean;
+        const T      b_share = count == 0 ? T(0) : static_cast<T>(b.count) / static_cast<T>(count);
+        return moments_result<T>{count,
+                                 a.mean + delta * b_share,
+                                 a.m2 + b.m2 + delta * delta * static_cast<T>(a.count) * b_share};
+    }
+};
+
+} // end of detail namespace
+
+/// \brief The combination of moments is commutative up to rounding, like the sums of
+/// floating-point values.
+template<class T>
+struct is_commutative<detail::moments_combine_op<T>> : std::true_type
+{};
+
+/// \brief Parallel mean and variance primitive for device level.
+///
+/// moments function computes the count, the mean and the sum of squared deviations from the mean
+/// of the input in a single pass, using the numerically stable pairwise combination of Welford's
+/// algorithm.
+///
+/// \par Overview
+/// * Every value is a range of one value with a mean of the value, the ranges are combined by
+/// correcting the mean and the sum of squared deviations by the difference of their means. This
+/// avoids the cancellation of <tt>E[x^2] - E[x]^2</tt> when the mean is large compared to the
+/// deviations.
+/// * \p double values are accumulated in \p double, other values (for example \p float,
+/// \p rocprim::half or integers) in \p float.
+/// * The accumulator is a structure of scalars, which are kept in separate registers and moved
+/// separately by the warp-level reductions.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p reduce_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range, its elements must
+/// be assignable from \p moments_result. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range.
+/// \param [out] output - iterator to the result.
+/// \param [in] size - number of element in the input range.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;                         // e.g., 4
+/// float * input;                             // e.g., [1, 2, 3, 4]
+/// rocprim::moments_result<float> * output;   // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::moments(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // compute the moments
+/// rocprim::moments(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size
+/// );
+/// // output: [{count = 4, mean = 2.5, m2 = 5}], variance() = 1.25
+/// \endcode
+/// \endparblock
+template<class Config = default_config, class InputIterator, class OutputIterator>
+inline hipError_t moments(void*             temporary_storage,
+                          size_t&           storage_size,
+                          InputIterator     input,
+                          OutputIterator    output,
+                          const size_t      size,
+                          const hipStream_t stream            = 0,
+                          bool              debug_synchronous = false)
+{
+    using input_type       = typename std::iterator_traits<InputIterator>::value_type;
+    using accumulator_type = detail::moments_accumulator_t<input_type>;
+    using result_type      = moments_result<accumulator_type>;
+
+    return detail::reduce_impl<true, Config>(
+        temporary_storage,
+        storage_size,
+        ::rocprim::make_transform_iterator(detail::to_kernel_input_iterator(input),
+                                           detail::moments_from_value_op<accumulator_type>{}),
+        output,
+        result_type{0, accumulator_type(0), accumulator_type(0)},
+        size,
+        detail::moments_combine_op<accumulator_type>{},
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Parallel segmented mean and variance primitive for device level.
+///
+/// segmented_moments function computes the count, the mean and the sum of squared deviations
+/// from the mean of every segment of the input, see \p moments.
+///
+/// \par Overview
+/// * The segment \p i is the range <tt>[begin_offsets[i], end_offsets[i])</tt> of the input.
+/// Empty segments have a count of 0 and a mean and a sum of squared deviations of 0.
+/// * \p double values are accumulated in \p double, other values in \p float.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p reduce_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range, its elements must
+/// be assignable from \p moments_result. It can be a simple pointer type.
+/// \tparam OffsetIterator - random-access iterator type of the offsets of the segments.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range.
+/// \param [out] output - iterator to the first element of the results, one per segment.
+/// \param [in] segments - number of segments.
+/// \param [in] begin_offsets - iterator to the first element of the offsets of the beginnings
+/// of the segments.
+/// \param [in] end_offsets - iterator to the first element of the offsets of the ends of the
+/// segments.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class OffsetIterator>
+inline hipError_t segmented_moments(void*             temporary_storage,
+                                    size_t&           storage_size,
+                                    InputIterator     input,
+                                    OutputIterator    output,
+                                    unsigned int      segments,
+                                    OffsetIterator    begin_offsets,
+                                    OffsetIterator    end_offsets,
+                                    const hipStream_t stream            = 0,
+                                    bool              debug_synchronous = false)
+{
+    using input_type       = typename std::iterator_traits<InputIterator>::value_type;
+    using accumulator_type = detail::moments_accumulator_t<input_type>;
+    using result_type      = moments_result<accumulator_type>;
+
+    return ::rocprim::segmented_reduce<Config>(
+        temporary_storage,
+        storage_size,
+        ::rocprim::make_transform_iterator(detail::to_kernel_input_iterator(input),
+                                           detail::moments_from_value_op<accumulator_type>{}),
+        output,
+        segments,
+        begin_offsets,
+        end_offsets,
+        detail::moments_combine_op<accumulator_type>{},
+        result_type{0, accumulator_type(0), accumulator_type(0)},
+        stream,
+        debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_MOMENTS_HPP_
@@ -33,10 +33,15 @@
 #include "../type_traits.hpp"
 #include "../types.hpp"
 
+#include "call_info.hpp"
+#include "detail/config/device_select.hpp"
 #include "device_select_config.hpp"
 #include "detail/device_scan_common.hpp"
 #include "detail/device_partition.hpp"
 #include "device_transform.hpp"
+#include "instrumentation.hpp"
+
+#include "../iterator/detail/cache_modified_iterator.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -89,7 +94,81 @@ ROCPRIM_KERNEL __launch_bounds__(Config::block_size) void partition_kernel(
                                                               predicates...);
 }
 
+template<class Config,
+         class InputIterator,
+         class OutputIterator,
+         class ScanOutputIterator,
+         class ValueType,
+         class TransformOp,
+         class UnaryPredicate,
+         class BinaryFunction,
+         class PairLookbackScanState>
+ROCPRIM_KERNEL __launch_bounds__(Config::block_size) void transform_select_scan_kernel(
+    InputIterator                  input,
+    OutputIterator                 output,
+    ScanOutputIterator             scan_output,
+    size_t*                        selected_count,
+    ValueType*                     scan_value,
+    const size_t*                  prev_selected_count,
+    const ValueType*               prev_scan_value,
+    const size_t                   prev_processed,
+    const size_t                   total_size,
+    TransformOp                    transform_op,
+    UnaryPredicate                 predicate,
+    BinaryFunction                 scan_op,
+    PairLookbackScanState          pair_scan_state,
+    const unsigned int             number_of_blocks,
+    ordered_block_id<unsigned int> ordered_bid)
+{
+    transform_select_scan_kernel_impl<Config>(input,
+                                              output,
+                                              scan_output,
+                                              selected_count,
+                                              scan_value,
+                                              prev_selected_count,
+                                              prev_scan_value,
+                                              prev_processed,
+                                              total_size,
+                                              transform_op,
+                                              predicate,
+                                              scan_op,
+                                              pair_scan_state,
+                                              number_of_blocks,
+                                              ordered_bid);
+}
+
+template<class Config,
+         unsigned int Buckets,
+         class InputIterator,
+         class OutputIterator,
+         class BucketOp,
+         class CountsLookbackScanState>
+ROCPRIM_KERNEL __launch_bounds__(Config::block_size) void partition_n_kernel(
+    InputIterator                                input,
+    partition_n_outputs<OutputIterator, Buckets> outputs,
+    size_t*                                      bucket_counts,
+    const size_t*                                prev_bucket_counts,
+    const size_t                                 prev_processed,
+    const size_t                                 total_size,
+    BucketOp                                     bucket_op,
+    CountsLookbackScanState                      counts_scan_state,
+    const unsigned int                           number_of_blocks,
+    ordered_block_id<unsigned int>               ordered_bid)
+{
+    partition_n_kernel_impl<Config>(input,
+                                    outputs,
+                                    bucket_counts,
+                                    prev_bucket_counts,
+                                    prev_processed,
+                                    total_size,
+                                    bucket_op,
+                                    counts_scan_state,
+                                    number_of_blocks,
+                                    ordered_bid);
+}
+
 #define ROCPRIM_DETAIL_HIP_SYNC(name, size, start) \
+    ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
     if(debug_synchronous) \
     { \
         std::cout << name << "(" << size << ")"; \
@@ -104,6 +183,7 @@ ROCPRIM_KERNEL __launch_bounds__(Config::block_size) void partition_kernel(
     { \
         auto _error = hipGetLastError(); \
         if(_error != hipSuccess) return _error; \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
         if(debug_synchronous) \
         { \
             std::cout << name << "(" << size << ")"; \
@@ -153,7 +233,7 @@ hipError_t partition_impl(void * temporary_storage,
     // Get default config if Config is default_config
     using config = default_or_custom_config<
         Config,
-        default_select_config<ROCPRIM_TARGET_ARCH, key_type, value_type>
+        default_select_config<ROCPRIM_TARGET_ARCH, key_type>
     >;
 
     using offset_scan_state_type = detail::lookback_scan_state<offset_type>;
@@ -223,19 +303,25 @@ hipError_t partition_impl(void * temporary_storage,
                            stream);
     if (error != hipSuccess) return error;
 
-    hipDeviceProp_t prop;
-    int deviceId;
-    static_cast<void>(hipGetDevice(&deviceId));
-    static_cast<void>(hipGetDeviceProperties(&prop, deviceId));
+    bool use_sleep;
+    error = is_sleep_scan_state_used(use_sleep);
+    if(error != hipSuccess) return error;
 
-#if HIP_VERSION >= 307
-    int asicRevision = prop.asicRevision;
-#else
-    int asicRevision = 0;
-#endif
+    // The blocks of a grid limited by blocks_per_cu or scoped_grid_limit process multiple tiles
+    unsigned int max_grid_size = number_of_blocks;
+    error = limit_grid_size(max_grid_size, config_blocks_per_cu<config>::value);
+    if(error != hipSuccess) return error;
 
     const size_t number_of_launches = ::rocprim::detail::ceiling_div(size, aligned_size_limit);
 
+    // The cache modifiers of the configuration are applied to pointer inputs and outputs
+    constexpr cache_load_modifier  load_modifier  = config_load_cache_modifier<config>::value;
+    constexpr cache_store_modifier store_modifier = config_store_cache_modifier<config>::value;
+    const auto cached_keys_input    = make_cache_modified_input_iterator<load_modifier>(keys_input);
+    const auto cached_values_input  = make_cache_modified_input_iterator<load_modifier>(values_input);
+    const auto cached_keys_output   = make_cache_modified_output_iterator<store_modifier>(keys_output);
+    const auto cached_values_output = make_cache_modified_output_iterator<store_modifier>(values_output);
+
     if(debug_synchronous)
     {
         std::cout << "use_limited_size " << use_limited_size << '\n';
@@ -255,7 +341,8 @@ hipError_t partition_impl(void * temporary_storage,
 
         const unsigned int current_number_of_blocks = ::rocprim::detail::ceiling_div(current_size, items_per_block);
 
-        auto grid_size = ::rocprim::detail::ceiling_div(number_of_blocks, block_size);
+        auto grid_size = std::min(::rocprim::detail::ceiling_div(number_of_blocks, block_size),
+                                  max_grid_size);
 
         if(debug_synchronous)
         {
@@ -264,8 +351,9 @@ hipError_t partition_impl(void * temporary_storage,
 
             start = std::chrono::high_resolution_clock::now();
         }
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("init_offset_scan_state_kernel");
 
-        if (prop.gcnArch == 908 && asicRevision < 2)
+        if(use_sleep)
         {
             hipLaunchKernelGGL(
                 HIP_KERNEL_NAME(init_lookback_scan_state_kernel<offset_scan_state_with_sleep_type>),
@@ -284,10 +372,11 @@ hipError_t partition_impl(void * temporary_storage,
         ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_offset_scan_state_kernel", current_number_of_blocks, start)
 
         if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("partition_kernel");
 
-        grid_size = current_number_of_blocks;
+        grid_size = std::min(current_number_of_blocks, max_grid_size);
 
-        if (prop.gcnArch == 908 && asicRevision < 2)
+        if(use_sleep)
         {
             hipLaunchKernelGGL(
                 HIP_KERNEL_NAME(partition_kernel<SelectMethod, OnlySelected, config>),
@@ -295,11 +384,11 @@ hipError_t partition_impl(void * temporary_storage,
                 dim3(block_size),
                 0,
                 stream,
-                keys_input + prev_processed,
-                values_input + prev_processed,
+                cached_keys_input + prev_processed,
+                cached_values_input + prev_processed,
                 flags + prev_processed,
-                keys_output,
-                values_output,
+                cached_keys_output,
+                cached_values_output,
                 selected_count,
                 prev_selected_count,
                 prev_processed,
@@ -317,11 +406,11 @@ hipError_t partition_impl(void * temporary_storage,
                 dim3(block_size),
                 0,
                 stream,
-                keys_input + prev_processed,
-                values_input + prev_processed,
+                cached_keys_input + prev_processed,
+                cached_values_input + prev_processed,
                 flags + prev_processed,
-                keys_output,
-                values_output,
+                cached_keys_output,
+                cached_values_output,
                 selected_count,
                 prev_selected_count,
                 prev_processed,
@@ -346,6 +435,431 @@ hipError_t partition_impl(void * temporary_storage,
                                  debug_synchronous);
     if (error != hipSuccess) return error;
 
+    // All items are written by partitions, selections write at most all items
+    constexpr bool   with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+    constexpr size_t item_bytes  = sizeof(key_type) + (with_values ? sizeof(value_type) : 0);
+    constexpr size_t flag_bytes
+        = SelectMethod == select_method::flag
+              ? sizeof(typename std::iterator_traits<FlagIterator>::value_type)
+              : 0;
+    record_call_info(!OnlySelected                         ? "partition"
+                     : SelectMethod == select_method::unique ? "unique"
+                                                             : "select",
+                     "lookback",
+                     1,
+                     use_sleep,
+                     size * (item_bytes + flag_bytes),
+                     size * item_bytes);
+
+    return hipSuccess;
+}
+
+template<class Config,
+         class InputIterator,
+         class OutputIterator,
+         class ScanOutputIterator,
+         class SelectedCountOutputIterator,
+         class TransformOp,
+         class UnaryPredicate,
+         class BinaryFunction>
+inline hipError_t transform_select_scan_impl(void*                       temporary_storage,
+                                             size_t&                     storage_size,
+                                             InputIterator               input,
+                                             OutputIterator              output,
+                                             ScanOutputIterator          scan_output,
+                                             SelectedCountOutputIterator selected_count_output,
+                                             const size_t                size,
+                                             TransformOp                 transform_op,
+                                             UnaryPredicate              predicate,
+                                             BinaryFunction              scan_op,
+                                             const hipStream_t           stream,
+                                             bool                        debug_synchronous)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+    using value_type = typename ::rocprim::detail::invoke_result<TransformOp, input_type>::type;
+    using pair_type  = typename select_scan_pair_op<value_type, BinaryFunction>::pair_type;
+
+    // Get default config if Config is default_config
+    using config = default_or_custom_config<
+        Config,
+        default_select_config<ROCPRIM_TARGET_ARCH, value_type>
+    >;
+
+    using pair_scan_state_type = detail::lookback_scan_state<pair_type>;
+    using pair_scan_state_with_sleep_type = detail::lookback_scan_state<pair_type, true>;
+    using ordered_block_id_type = detail::ordered_block_id<unsigned int>;
+
+    static constexpr unsigned int block_size = config::block_size;
+    static constexpr unsigned int items_per_thread = config::items_per_thread;
+    static constexpr auto items_per_block = block_size * items_per_thread;
+
+    static constexpr size_t size_limit = config::size_limit;
+    static constexpr size_t aligned_size_limit = ::rocprim::max<size_t>(size_limit - (size_limit % items_per_block), items_per_block);
+    const size_t limited_size = std::min<size_t>(size, aligned_size_limit);
+
+    const unsigned int number_of_blocks
+        = static_cast<unsigned int>(::rocprim::detail::ceiling_div(limited_size, items_per_block));
+
+    // Calculate required temporary storage
+    void*                           pair_scan_state_storage;
+    ordered_block_id_type::id_type* ordered_bid_storage;
+    size_t*                         selected_count;
+    value_type*                     scan_value;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            // This is valid even with pair_scan_state_with_sleep_type
+            detail::temp_storage::make_partition(
+                &pair_scan_state_storage,
+                pair_scan_state_type::get_temp_storage_layout(number_of_blocks)),
+            detail::temp_storage::make_partition(&ordered_bid_storage,
+                                                 ordered_block_id_type::get_temp_storage_layout()),
+            // The counts and the reductions of this and the previous launch
+            detail::temp_storage::ptr_aligned_array(&selected_count, 2),
+            detail::temp_storage::ptr_aligned_array(&scan_value, 2)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+    size_t*     prev_selected_count = selected_count + 1;
+    value_type* prev_scan_value     = scan_value + 1;
+
+    // Start point for time measurements
+    std::chrono::high_resolution_clock::time_point start;
+
+    auto pair_scan_state
+        = pair_scan_state_type::create(pair_scan_state_storage, number_of_blocks);
+    auto pair_scan_state_with_sleep
+        = pair_scan_state_with_sleep_type::create(pair_scan_state_storage, number_of_blocks);
+
+    auto ordered_bid = ordered_block_id_type::create(ordered_bid_storage);
+
+    hipError_t error;
+
+    // The reductions are ignored while the counts are zero
+    error = hipMemsetAsync(selected_count, 0, sizeof(*selected_count) * 2, stream);
+    if (error != hipSuccess) return error;
+
+    bool use_sleep;
+    error = is_sleep_scan_state_used(use_sleep);
+    if(error != hipSuccess) return error;
+
+    const size_t number_of_launches = ::rocprim::detail::ceiling_div(size, aligned_size_limit);
+
+    if(debug_synchronous)
+    {
+        std::cout << "aligned_size_limit " << aligned_size_limit << '\n';
+        std::cout << "number_of_launches " << number_of_launches << '\n';
+        std::cout << "size " << size << '\n';
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << number_of_blocks << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+    }
+
+    for(size_t i = 0, prev_processed = 0; i < number_of_launches;
+        i++, prev_processed += limited_size)
+    {
+        const unsigned int current_size
+            = static_cast<unsigned int>(std::min<size_t>(size - prev_processed, limited_size));
+
+        const unsigned int current_number_of_blocks = ::rocprim::detail::ceiling_div(current_size, items_per_block);
+
+        auto grid_size = ::rocprim::detail::ceiling_div(number_of_blocks, block_size);
+
+        if(debug_synchronous)
+        {
+            std::cout << "current size " << current_size << '\n';
+            std::cout << "current number of blocks " << current_number_of_blocks << '\n';
+
+            start = std::chrono::high_resolution_clock::now();
+        }
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("init_pair_scan_state_kernel");
+
+        if(use_sleep)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(init_lookback_scan_state_kernel<pair_scan_state_with_sleep_type>),
+                dim3(grid_size), dim3(block_size), 0, stream,
+                pair_scan_state_with_sleep, current_number_of_blocks, ordered_bid
+            );
+        } else
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(init_lookback_scan_state_kernel<pair_scan_state_type>),
+                dim3(grid_size), dim3(block_size), 0, stream,
+                pair_scan_state, current_number_of_blocks, ordered_bid
+            );
+        }
+
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_pair_scan_state_kernel", current_number_of_blocks, start)
+
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("transform_select_scan_kernel");
+
+        grid_size = current_number_of_blocks;
+
+        if(use_sleep)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(transform_select_scan_kernel<config>),
+                dim3(grid_size),
+                dim3(block_size),
+                0,
+                stream,
+                input + prev_processed,
+                output,
+                scan_output,
+                selected_count,
+                scan_value,
+                prev_selected_count,
+                prev_scan_value,
+                prev_processed,
+                size,
+                transform_op,
+                predicate,
+                scan_op,
+                pair_scan_state_with_sleep,
+                current_number_of_blocks,
+                ordered_bid);
+        } else
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(transform_select_scan_kernel<config>),
+                dim3(grid_size),
+                dim3(block_size),
+                0,
+                stream,
+                input + prev_processed,
+                output,
+                scan_output,
+                selected_count,
+                scan_value,
+                prev_selected_count,
+                prev_scan_value,
+                prev_processed,
+                size,
+                transform_op,
+                predicate,
+                scan_op,
+                pair_scan_state,
+                current_number_of_blocks,
+                ordered_bid);
+        }
+
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("transform_select_scan_kernel", size, start)
+
+        std::swap(selected_count, prev_selected_count);
+        std::swap(scan_value, prev_scan_value);
+    }
+
+    error = ::rocprim::transform(prev_selected_count,
+                                 selected_count_output,
+                                 1,
+                                 ::rocprim::identity<>{},
+                                 stream,
+                                 debug_synchronous);
+    if (error != hipSuccess) return error;
+
+    return hipSuccess;
+}
+
+template<class Config,
+         unsigned int Buckets,
+         class InputIterator,
+         class OutputIterator,
+         class BucketCountOutputIterator,
+         class BucketOp>
+inline hipError_t partition_n_impl(void*                                        temporary_storage,
+                                   size_t&                                      storage_size,
+                                   InputIterator                                input,
+                                   partition_n_outputs<OutputIterator, Buckets> outputs,
+                                   BucketCountOutputIterator                    bucket_count_output,
+                                   const size_t                                 size,
+                                   BucketOp                                     bucket_op,
+                                   const hipStream_t                            stream,
+                                   bool                                         debug_synchronous)
+{
+    using key_type    = typename std::iterator_traits<InputIterator>::value_type;
+    using counts_type = partition_n_counts<Buckets>;
+
+    // Get default config if Config is default_config
+    using config = default_or_custom_config<
+        Config,
+        default_select_config<ROCPRIM_TARGET_ARCH, key_type>
+    >;
+
+    using counts_scan_state_type = detail::lookback_scan_state<counts_type>;
+    using counts_scan_state_with_sleep_type = detail::lookback_scan_state<counts_type, true>;
+    using ordered_block_id_type = detail::ordered_block_id<unsigned int>;
+
+    static constexpr unsigned int block_size = config::block_size;
+    static constexpr unsigned int items_per_thread = config::items_per_thread;
+    static constexpr auto items_per_block = block_size * items_per_thread;
+
+    static constexpr size_t size_limit = config::size_limit;
+    static constexpr size_t aligned_size_limit = ::rocprim::max<size_t>(size_limit - (size_limit % items_per_block), items_per_block);
+    const size_t limited_size = std::min<size_t>(size, aligned_size_limit);
+
+    const unsigned int number_of_blocks
+        = static_cast<unsigned int>(::rocprim::detail::ceiling_div(limited_size, items_per_block));
+
+    // Calculate required temporary storage
+    void*                           counts_scan_state_storage;
+    ordered_block_id_type::id_type* ordered_bid_storage;
+    size_t*                         bucket_counts;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            // This is valid even with counts_scan_state_with_sleep_type
+            detail::temp_storage::make_partition(
+                &counts_scan_state_storage,
+                counts_scan_state_type::get_temp_storage_layout(number_of_blocks)),
+            detail::temp_storage::make_partition(&ordered_bid_storage,
+                                                 ordered_block_id_type::get_temp_storage_layout()),
+            // The counts of this and the previous launch, initialized at once
+            detail::temp_storage::ptr_aligned_array(&bucket_counts, 2 * Buckets)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+    size_t* prev_bucket_counts = bucket_counts + Buckets;
+
+    // Start point for time measurements
+    std::chrono::high_resolution_clock::time_point start;
+
+    auto counts_scan_state
+        = counts_scan_state_type::create(counts_scan_state_storage, number_of_blocks);
+    auto counts_scan_state_with_sleep
+        = counts_scan_state_with_sleep_type::create(counts_scan_state_storage, number_of_blocks);
+
+    auto ordered_bid = ordered_block_id_type::create(ordered_bid_storage);
+
+    hipError_t error;
+
+    error = hipMemsetAsync(bucket_counts, 0, sizeof(*bucket_counts) * 2 * Buckets, stream);
+    if (error != hipSuccess) return error;
+
+    bool use_sleep;
+    error = is_sleep_scan_state_used(use_sleep);
+    if(error != hipSuccess) return error;
+
+    const size_t number_of_launches = ::rocprim::detail::ceiling_div(size, aligned_size_limit);
+
+    if(debug_synchronous)
+    {
+        std::cout << "buckets " << Buckets << '\n';
+        std::cout << "aligned_size_limit " << aligned_size_limit << '\n';
+        std::cout << "number_of_launches " << number_of_launches << '\n';
+        std::cout << "size " << size << '\n';
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << number_of_blocks << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+    }
+
+    for(size_t i = 0, prev_processed = 0; i < number_of_launches;
+        i++, prev_processed += limited_size)
+    {
+        const unsigned int current_size
+            = static_cast<unsigned int>(std::min<size_t>(size - prev_processed, limited_size));
+
+        const unsigned int current_number_of_blocks = ::rocprim::detail::ceiling_div(current_size, items_per_block);
+
+        auto grid_size = ::rocprim::detail::ceiling_div(number_of_blocks, block_size);
+
+        if(debug_synchronous)
+        {
+            std::cout << "current size " << current_size << '\n';
+            std::cout << "current number of blocks " << current_number_of_blocks << '\n';
+
+            start = std::chrono::high_resolution_clock::now();
+        }
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("init_counts_scan_state_kernel");
+
+        if(use_sleep)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(init_lookback_scan_state_kernel<counts_scan_state_with_sleep_type>),
+                dim3(grid_size), dim3(block_size), 0, stream,
+                counts_scan_state_with_sleep, current_number_of_blocks, ordered_bid
+            );
+        } else
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(init_lookback_scan_state_kernel<counts_scan_state_type>),
+                dim3(grid_size), dim3(block_size), 0, stream,
+                counts_scan_state, current_number_of_blocks, ordered_bid
+            );
+        }
+
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_counts_scan_state_kernel", current_number_of_blocks, start)
+
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("partition_n_kernel");
+
+        grid_size = current_number_of_blocks;
+
+        if(use_sleep)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(partition_n_kernel<config, Buckets>),
+                dim3(grid_size),
+                dim3(block_size),
+                0,
+                stream,
+                input + prev_processed,
+                outputs,
+                bucket_counts,
+                prev_bucket_counts,
+                prev_processed,
+                size,
+                bucket_op,
+                counts_scan_state_with_sleep,
+                current_number_of_blocks,
+                ordered_bid);
+        } else
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(partition_n_kernel<config, Buckets>),
+                dim3(grid_size),
+                dim3(block_size),
+                0,
+                stream,
+                input + prev_processed,
+                outputs,
+                bucket_counts,
+                prev_bucket_counts,
+                prev_processed,
+                size,
+                bucket_op,
+                counts_scan_state,
+                current_number_of_blocks,
+                ordered_bid);
+        }
+
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("partition_n_kernel", size, start)
+
+        std::swap(bucket_counts, prev_bucket_counts);
+    }
+
+    error = ::rocprim::transform(prev_bucket_counts,
+                                 bucket_count_output,
+                                 Buckets,
+                                 ::rocprim::identity<>{},
+                                 stream,
+                                 debug_synchronous);
+    if (error != hipSuccess) return error;
+
+    record_call_info("partition_n",
+                     "lookback",
+                     1,
+                     use_sleep,
+                     size * sizeof(key_type),
+                     size * sizeof(key_type));
+
     return hipSuccess;
 }
 
@@ -459,7 +973,9 @@ hipError_t partition(void * temporary_storage,
     rocprim::empty_type* const no_values = nullptr; // key only
 
     return detail::partition_impl<detail::select_method::flag, false, Config, offset_type>(
-        temporary_storage, storage_size, input, no_values, flags, output, no_values, selected_count_output,
+        temporary_storage, storage_size,
+        detail::to_kernel_input_iterator(input), no_values, detail::to_kernel_input_iterator(flags),
+        output, no_values, selected_count_output,
         size, inequality_op_type(), stream, debug_synchronous, unary_predicate_type()
     );
 }
@@ -578,8 +1094,211 @@ hipError_t partition(void * temporary_storage,
     rocprim::empty_type* const no_values = nullptr; // key only
 
     return detail::partition_impl<detail::select_method::predicate, false, Config, offset_type>(
-        temporary_storage, storage_size, input, no_values, flags, output, no_values, selected_count_output,
-        size, inequality_op_type(), stream, debug_synchronous, predicate
+        temporary_storage, storage_size,
+        detail::to_kernel_input_iterator(input), no_values, flags, output, no_values,
+        selected_count_output, size, inequality_op_type(), stream, debug_synchronous, predicate
+    );
+}
+
+/// \brief Parallel two-way partition primitive for device level using selection flags.
+///
+/// Performs a device-wide partition based on input \p flags. The values from \p input for which
+/// the corresponding flags are \p true are copied to \p output_selected, the other values are
+/// copied to \p output_rejected.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input and \p flags must have at least \p size elements.
+/// * Ranges specified by \p output_selected and \p output_rejected must have at least so many
+/// elements, that all selected or rejected values can be copied into them.
+/// * Range specified by \p selected_count_output must have at least 1 element.
+/// * Values of \p flag range should be implicitly convertible to `bool` type.
+/// * Relative order is preserved in both outputs, unlike \p partition which copies the rejected
+/// values to the end of its single output in reverse order. The number of rejected values is
+/// <tt>size - *selected_count_output</tt>.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p select_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. It can be
+/// a simple pointer type.
+/// \tparam FlagIterator - random-access iterator type of the flag range. It can be
+/// a simple pointer type.
+/// \tparam SelectedOutputIterator - random-access iterator type of the selected output range. It
+/// can be a simple pointer type.
+/// \tparam RejectedOutputIterator - random-access iterator type of the rejected output range. It
+/// can be a simple pointer type.
+/// \tparam SelectedCountOutputIterator - random-access iterator type of the selected_count_output
+/// value. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the select operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to select values from.
+/// \param [in] flags - iterator to the selection flag corresponding to the first element from \p input range.
+/// \param [out] output_selected - iterator to the first element in the selected output range.
+/// \param [out] output_rejected - iterator to the first element in the rejected output range.
+/// \param [out] selected_count_output - iterator to the total number of selected values (length of
+/// \p output_selected).
+/// \param [in] size - number of element in the input range.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;     // e.g., 8
+/// int * input;           // e.g., [1, 2, 3, 4, 5, 6, 7, 8]
+/// char * flags;          // e.g., [0, 1, 1, 0, 0, 1, 0, 1]
+/// int * output_selected; // empty array of 8 elements
+/// int * output_rejected; // empty array of 8 elements
+/// size_t * output_count; // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::partition_two_way(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, flags,
+///     output_selected, output_rejected, output_count,
+///     input_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform partition
+/// rocprim::partition_two_way(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, flags,
+///     output_selected, output_rejected, output_count,
+///     input_size
+/// );
+/// // output_selected: [2, 3, 6, 8, *, *, *, *]
+/// // output_rejected: [1, 4, 5, 7, *, *, *, *]
+/// // output_count: 4
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class FlagIterator,
+         class SelectedOutputIterator,
+         class RejectedOutputIterator,
+         class SelectedCountOutputIterator>
+inline
+hipError_t partition_two_way(void * temporary_storage,
+                             size_t& storage_size,
+                             InputIterator input,
+                             FlagIterator flags,
+                             SelectedOutputIterator output_selected,
+                             RejectedOutputIterator output_rejected,
+                             SelectedCountOutputIterator selected_count_output,
+                             const size_t size,
+                             const hipStream_t stream = 0,
+                             const bool debug_synchronous = false)
+{
+    // Dummy unary predicate
+    using unary_predicate_type = ::rocprim::empty_type;
+    // Dummy inequality operation
+    using inequality_op_type = ::rocprim::empty_type;
+    using offset_type = unsigned int;
+    rocprim::empty_type* const no_values = nullptr; // key only
+
+    const tuple<SelectedOutputIterator, RejectedOutputIterator> output{output_selected,
+                                                                       output_rejected};
+
+    return detail::partition_impl<detail::select_method::flag, false, Config, offset_type>(
+        temporary_storage, storage_size,
+        detail::to_kernel_input_iterator(input), no_values, detail::to_kernel_input_iterator(flags),
+        output, no_values, selected_count_output,
+        size, inequality_op_type(), stream, debug_synchronous, unary_predicate_type()
+    );
+}
+
+/// \brief Parallel two-way partition primitive for device level using selection predicate.
+///
+/// Performs a device-wide partition using selection predicate. The values from \p input for
+/// which \p predicate returns \p true are copied to \p output_selected, the other values are
+/// copied to \p output_rejected.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Range specified by \p input must have at least \p size elements.
+/// * Ranges specified by \p output_selected and \p output_rejected must have at least so many
+/// elements, that all selected or rejected values can be copied into them.
+/// * Range specified by \p selected_count_output must have at least 1 element.
+/// * Relative order is preserved in both outputs. The number of rejected values is
+/// <tt>size - *selected_count_output</tt>.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p select_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. It can be
+/// a simple pointer type.
+/// \tparam SelectedOutputIterator - random-access iterator type of the selected output range. It
+/// can be a simple pointer type.
+/// \tparam RejectedOutputIterator - random-access iterator type of the rejected output range. It
+/// can be a simple pointer type.
+/// \tparam SelectedCountOutputIterator - random-access iterator type of the selected_count_output
+/// value. It can be a simple pointer type.
+/// \tparam UnaryPredicate - type of a unary selection predicate.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the select operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to select values from.
+/// \param [out] output_selected - iterator to the first element in the selected output range.
+/// \param [out] output_rejected - iterator to the first element in the rejected output range.
+/// \param [out] selected_count_output - iterator to the total number of selected values (length of
+/// \p output_selected).
+/// \param [in] size - number of element in the input range.
+/// \param [in] predicate - unary function object which returns \p true if the element should be
+/// copied to \p output_selected.
+/// The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the object passed to it.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+template<class Config = default_config,
+         class InputIterator,
+         class SelectedOutputIterator,
+         class RejectedOutputIterator,
+         class SelectedCountOutputIterator,
+         class UnaryPredicate>
+inline
+hipError_t partition_two_way(void * temporary_storage,
+                             size_t& storage_size,
+                             InputIterator input,
+                             SelectedOutputIterator output_selected,
+                             RejectedOutputIterator output_rejected,
+                             SelectedCountOutputIterator selected_count_output,
+                             const size_t size,
+                             UnaryPredicate predicate,
+                             const hipStream_t stream = 0,
+                             const bool debug_synchronous = false)
+{
+    // Dummy flag type
+    using flag_type = ::rocprim::empty_type;
+    flag_type * flags = nullptr;
+    // Dummy inequality operation
+    using inequality_op_type = ::rocprim::empty_type;
+    using offset_type = unsigned int;
+    rocprim::empty_type* const no_values = nullptr; // key only
+
+    const tuple<SelectedOutputIterator, RejectedOutputIterator> output{output_selected,
+                                                                       output_rejected};
+
+    return detail::partition_impl<detail::select_method::predicate, false, Config, offset_type>(
+        temporary_storage, storage_size,
+        detail::to_kernel_input_iterator(input), no_values, flags, output, no_values,
+        selected_count_output, size, inequality_op_type(), stream, debug_synchronous, predicate
     );
 }
 
@@ -750,12 +1469,136 @@ hipError_t partition_three_way(void * temporary_storage,
     output_key_iterator_tuple output{ output_first_part, output_second_part, output_unselected };
 
     return detail::partition_impl<detail::select_method::predicate, false, Config, offset_type>(
-        temporary_storage, storage_size, input, no_input_values, flags, output, no_output_values, selected_count_output,
+        temporary_storage, storage_size,
+        detail::to_kernel_input_iterator(input), no_input_values, flags, output, no_output_values,
+        selected_count_output,
         size, inequality_op_type(), stream, debug_synchronous,
         select_first_part_op, select_second_part_op
     );
 }
 
+/// \brief Parallel multi-way partition primitive for device level.
+///
+/// Performs a device-wide partition of the values from \p input into \p Buckets output ranges.
+/// The value \p x is copied to <tt>outputs[bucket_op(x)]</tt>.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Range specified by \p input must have at least \p size elements.
+/// * Each range of \p outputs must have at least so many elements, that all values of its
+/// bucket can be copied into it.
+/// * Range specified by \p bucket_count_output must have at least \p Buckets elements, it
+/// receives the number of values in every bucket.
+/// * Values for which \p bucket_op returns a bucket id not less than \p Buckets are not copied.
+/// * Relative order is preserved in every bucket.
+/// * The partition is a single pass: every tile gets the offsets of all buckets at once by
+/// a decoupled look-back over the per-bucket counts.
+///
+/// \tparam Buckets - number of buckets, it is at most 64.
+/// \tparam Config - [optional] configuration of the primitive. It can be \p select_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. It can be
+/// a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output ranges. It can be
+/// a simple pointer type.
+/// \tparam BucketCountOutputIterator - random-access iterator type of the bucket_count_output
+/// values. It can be a simple pointer type.
+/// \tparam BucketOp - type of a unary function returning the bucket id of a value.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the partition operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to partition.
+/// \param [out] outputs - array of iterators to the first elements of the bucket output ranges.
+/// \param [out] bucket_count_output - iterator to the numbers of values in the buckets.
+/// \param [in] size - number of element in the input range.
+/// \param [in] bucket_op - unary function object which returns the bucket id of a value.
+/// The signature of the function should be equivalent to the following:
+/// <tt>unsigned int f(const T &a);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the object passed to it.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level partition of integer values into 4 buckets by their
+/// remainder of division by 4 is performed.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// auto bucket_op =
+///     [] __device__ (int a) -> unsigned int
+///     {
+///         return a % 4;
+///     };
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;      // e.g., 8
+/// int * input;            // e.g., [1, 2, 3, 4, 5, 6, 7, 8]
+/// int * outputs[4];       // 4 arrays of 8 elements
+/// size_t * bucket_counts; // array of 4 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::partition_n(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, outputs, bucket_counts,
+///     input_size, bucket_op
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform partition
+/// rocprim::partition_n(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, outputs, bucket_counts,
+///     input_size, bucket_op
+/// );
+/// // outputs[0]:    [4, 8]
+/// // outputs[1]:    [1, 5]
+/// // outputs[2]:    [2, 6]
+/// // outputs[3]:    [3, 7]
+/// // bucket_counts: [2, 2, 2, 2]
+/// \endcode
+/// \endparblock
+template <
+    unsigned int Buckets,
+    class Config = default_config,
+    typename InputIterator,
+    typename OutputIterator,
+    typename BucketCountOutputIterator,
+    typename BucketOp>
+inline
+hipError_t partition_n(void * temporary_storage,
+                       size_t& storage_size,
+                       InputIterator input,
+                       const OutputIterator (&outputs)[Buckets],
+                       BucketCountOutputIterator bucket_count_output,
+                       const size_t size,
+                       BucketOp bucket_op,
+                       const hipStream_t stream = 0,
+                       const bool debug_synchronous = false)
+{
+    static_assert(Buckets > 0 && Buckets <= 64, "The number of buckets must be in [1, 64]");
+
+    detail::partition_n_outputs<OutputIterator, Buckets> output_array;
+    for(unsigned int bucket = 0; bucket < Buckets; bucket++)
+    {
+        output_array.outputs[bucket] = outputs[bucket];
+    }
+    return detail::partition_n_impl<Config>(
+        temporary_storage, storage_size,
+        detail::to_kernel_input_iterator(input), output_array, bucket_count_output,
+        size, bucket_op, stream, debug_synchronous
+    );
+}
+
 /// @}
 // end of group devicemodule
 
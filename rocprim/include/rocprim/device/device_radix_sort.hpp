@@ -21,12 +21,17 @@
 #ifndef ROCPRIM_DEVICE_DEVICE_RADIX_SORT_HPP_
 #define ROCPRIM_DEVICE_DEVICE_RADIX_SORT_HPP_
 
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "../config.hpp"
+#include "../detail/device_properties.hpp"
 #include "../detail/radix_sort.hpp"
 #include "../detail/temp_storage.hpp"
 #include "../detail/various.hpp"
@@ -37,10 +42,25 @@
 
 #include "detail/config/device_radix_sort.hpp"
 #include "detail/device_radix_sort.hpp"
+#include "detail/device_instantiations.hpp"
+#include "detail/device_scan_common.hpp"
+#include "detail/lookback_scan_state.hpp"
+#include "detail/ordered_block_id.hpp"
+#include "call_info.hpp"
+#include "device_scan.hpp"
 #include "device_transform.hpp"
+#include "instrumentation.hpp"
 #include "specialization/device_radix_merge_sort.hpp"
 #include "specialization/device_radix_single_sort.hpp"
 
+#include "../iterator/counting_iterator.hpp"
+#include "../iterator/detail/cache_modified_iterator.hpp"
+#include "../iterator/reverse_iterator.hpp"
+#include "../iterator/tee_output_iterator.hpp"
+#include "../iterator/transform_iterator.hpp"
+#include "../iterator/transform_output_iterator.hpp"
+#include "../iterator/zip_iterator.hpp"
+
 /// \addtogroup devicemodule
 /// @{
 
@@ -49,11 +69,145 @@ BEGIN_ROCPRIM_NAMESPACE
 namespace detail
 {
 
+// Minimum length of the runs written by the write-combining scatter, 0 if it is disabled.
+// Configurations without the scatter_run_length member write the tiles in the striped arrangement.
+template<class Config, class = void>
+struct radix_sort_scatter_run_length : std::integral_constant<unsigned int, 0>
+{};
+
+template<class Config>
+struct radix_sort_scatter_run_length<Config, void_t<decltype(Config::scatter_run_length)>>
+    : std::integral_constant<unsigned int, Config::scatter_run_length>
+{};
+
+// Whether the order of the input is checked in the first pass over the keys, so that sorted and
+// strictly reverse sorted inputs are copied instead of sorted. Configurations without
+// the check_sorted_input member do not check it.
+template<class Config, class = void>
+struct radix_sort_check_sorted_input : std::false_type
+{};
+
+template<class Config>
+struct radix_sort_check_sorted_input<Config, void_t<decltype(Config::check_sorted_input)>>
+    : std::integral_constant<bool, Config::check_sorted_input>
+{};
+
+// Whether narrow ranges of keys are sorted on the bits of their range. Configurations without
+// the compress_key_range member sort all bits.
+template<class Config, class = void>
+struct radix_sort_compress_key_range : std::false_type
+{};
+
+template<class Config>
+struct radix_sort_compress_key_range<Config, void_t<decltype(Config::compress_key_range)>>
+    : std::integral_constant<bool, Config::compress_key_range>
+{};
+
+// The largest input sorted by the single cooperative kernel. Configurations without the
+// cooperative_size_limit member do not use it.
+template<class Config, class = void>
+struct radix_sort_cooperative_size_limit : std::integral_constant<unsigned int, 0>
+{};
+
+template<class Config>
+struct radix_sort_cooperative_size_limit<Config,
+                                         void_t<decltype(Config::cooperative_size_limit)>>
+    : std::integral_constant<unsigned int, Config::cooperative_size_limit>
+{};
+
+// The range is found for 32-bit and 64-bit integer keys, the sorted keys are restored in place,
+// so the keys output must be a pointer
+template<class Config, class Key, class Decomposer, class KeysOutputIterator>
+struct radix_sort_compress_key_range_enabled
+    : std::integral_constant<bool,
+                             radix_sort_compress_key_range<Config>::value
+                                 && std::is_same<Decomposer, identity_decomposer>::value
+                                 && ::rocprim::is_integral<Key>::value
+                                 && !std::is_same<Key, bool>::value
+                                 && (sizeof(Key) == 4 || sizeof(Key) == 8)
+                                 && std::is_pointer<KeysOutputIterator>::value>
+{};
+
+// The configuration of the sort of the compressed keys, which have no range to compress and
+// whose order is already checked
+template<class Config>
+struct radix_sort_compressed_config : Config
+{
+    static constexpr bool check_sorted_input = false;
+    static constexpr bool compress_key_range = false;
+};
+
+// Adds offset to the bit keys (Restore is true) or subtracts it (Restore is false). The keys of
+// the compressed sort are read with the minimum bit key subtracted, it is added back to the
+// sorted keys.
+template<class Key, bool Descending, bool Restore>
+struct radix_key_offset_op
+{
+    using key_codec    = radix_key_codec<Key, Descending>;
+    using bit_key_type = typename key_codec::bit_key_type;
+
+    bit_key_type offset;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    Key operator()(const Key& key) const
+    {
+        const bit_key_type bit_key = key_codec::encode(key);
+        return key_codec::decode(Restore ? bit_key + offset : bit_key - offset);
+    }
+};
+
+// The compressed keys are read through a transform_iterator, the sort is in place if its base
+// iterator is the output
+template<class InputIterator, class UnaryFunction, class ValueType, class T>
+inline
+bool are_iterators_equal(transform_iterator<InputIterator, UnaryFunction, ValueType> iter1,
+                         T*                                                         iter2)
+{
+    return are_iterators_equal(iter1.base(), iter2);
+}
+
+// Values larger than this are sorted indirectly (see radix_sort_indirect_impl). Configurations
+// without the indirect_value_size_threshold member move the values in every iteration.
+template<class Config, class = void>
+struct radix_sort_indirect_value_size_threshold
+    : std::integral_constant<unsigned int, std::numeric_limits<unsigned int>::max()>
+{};
+
+template<class Config>
+struct radix_sort_indirect_value_size_threshold<
+    Config,
+    void_t<decltype(Config::indirect_value_size_threshold)>>
+    : std::integral_constant<unsigned int, Config::indirect_value_size_threshold>
+{};
+
+// Values which are larger than the threshold and than the indices replacing them
+template<class Config, class Value, class Index>
+struct radix_sort_indirect_enabled
+    : std::integral_constant<
+          bool,
+          (!std::is_same<Value, ::rocprim::empty_type>::value
+           && sizeof(Value) > radix_sort_indirect_value_size_threshold<Config>::value
+           && sizeof(Value) > sizeof(Index))>
+{};
+
+// Keys-only sorts of 8-bit and 16-bit integer keys are counting sorts if all bits are sorted
+template<class Key, class Value, class Decomposer>
+struct radix_sort_counting_enabled
+    : std::integral_constant<bool,
+                             std::is_same<Value, ::rocprim::empty_type>::value
+                                 && std::is_same<Decomposer, identity_decomposer>::value
+                                 && ::rocprim::is_integral<Key>::value
+                                 && !std::is_same<Key, bool>::value
+                                 && sizeof(Key) <= 2>
+{};
+
 template<
     unsigned int BlockSize,
     unsigned int ItemsPerThread,
     unsigned int RadixBits,
     bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
     class KeysInputIterator,
     class Offset
 >
@@ -67,7 +221,7 @@ void fill_digit_counts_kernel(KeysInputIterator keys_input,
                               unsigned int blocks_per_full_batch,
                               unsigned int full_batches)
 {
-    fill_digit_counts<BlockSize, ItemsPerThread, RadixBits, Descending>(
+    fill_digit_counts<BlockSize, ItemsPerThread, RadixBits, Descending, FloatOrder, Decomposer>(
         keys_input, size,
         batch_digit_counts,
         bit, current_radix_bits,
@@ -106,6 +260,9 @@ template<
     unsigned int ItemsPerThread,
     unsigned int RadixBits,
     bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
+    unsigned int ScatterRunLength,
     class KeysInputIterator,
     class KeysOutputIterator,
     class ValuesInputIterator,
@@ -126,7 +283,8 @@ void sort_and_scatter_kernel(KeysInputIterator keys_input,
                              unsigned int blocks_per_full_batch,
                              unsigned int full_batches)
 {
-    sort_and_scatter<BlockSize, ItemsPerThread, RadixBits, Descending>(
+    sort_and_scatter<BlockSize, ItemsPerThread, RadixBits, Descending, FloatOrder, Decomposer,
+                     ScatterRunLength>(
         keys_input, keys_output, values_input, values_output, size,
         batch_digit_starts, digit_starts,
         bit, current_radix_bits,
@@ -134,12 +292,200 @@ void sort_and_scatter_kernel(KeysInputIterator keys_input,
     );
 }
 
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int RadixBits,
+    bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
+    bool CheckOrder,
+    bool FindRange,
+    class KeysInputIterator,
+    class Offset
+>
+ROCPRIM_KERNEL
+__launch_bounds__(BlockSize)
+void onesweep_histograms_kernel(KeysInputIterator keys_input,
+                                Offset * digit_counts,
+                                unsigned int * order_flags,
+                                unsigned long long * key_range,
+                                Offset size,
+                                unsigned int begin_bit,
+                                unsigned int end_bit)
+{
+    onesweep_histograms<BlockSize, ItemsPerThread, RadixBits, Descending, FloatOrder, Decomposer,
+                        CheckOrder, FindRange>(
+        keys_input, digit_counts, order_flags, key_range, size, begin_bit, end_bit
+    );
+}
+
+template<
+    unsigned int RadixBits,
+    class Offset
+>
+ROCPRIM_KERNEL
+__launch_bounds__(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE)
+void onesweep_scan_histograms_kernel(Offset * digit_counts,
+                                     unsigned int * nonuniform_digits,
+                                     Offset size)
+{
+    onesweep_scan_histograms<RadixBits>(digit_counts, nonuniform_digits, size);
+}
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int LongRadixBits,
+    unsigned int ShortRadixBits,
+    bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
+    bool CheckOrder,
+    bool FindRange,
+    class KeysInputIterator,
+    class Offset
+>
+ROCPRIM_KERNEL
+__launch_bounds__(BlockSize)
+void find_nonuniform_digits_kernel(KeysInputIterator keys_input,
+                                   unsigned int * nonuniform_digits,
+                                   unsigned int * order_flags,
+                                   unsigned long long * key_range,
+                                   Offset size,
+                                   unsigned int begin_bit,
+                                   unsigned int end_bit,
+                                   unsigned int long_iterations,
+                                   unsigned int iterations)
+{
+    find_nonuniform_digits<BlockSize, ItemsPerThread, LongRadixBits, ShortRadixBits,
+                           Descending, FloatOrder, Decomposer, CheckOrder, FindRange>(
+        keys_input, nonuniform_digits, order_flags, key_range, size,
+        begin_bit, end_bit, long_iterations, iterations
+    );
+}
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    bool Descending,
+    class KeysInputIterator,
+    class Offset
+>
+ROCPRIM_KERNEL
+__launch_bounds__(BlockSize)
+void counting_sort_histogram_kernel(KeysInputIterator keys_input,
+                                    Offset * counts,
+                                    Offset size)
+{
+    counting_sort_histogram<BlockSize, ItemsPerThread, Descending>(keys_input, counts, size);
+}
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    bool Descending,
+    class Key,
+    class KeysOutputIterator,
+    class Offset
+>
+ROCPRIM_KERNEL
+__launch_bounds__(BlockSize)
+void counting_sort_write_runs_kernel(const Offset * bin_ends,
+                                     KeysOutputIterator keys_output,
+                                     Offset size)
+{
+    counting_sort_write_runs<BlockSize, ItemsPerThread, Descending, Key>(
+        bin_ends, keys_output, size
+    );
+}
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int RadixBits,
+    unsigned int ScanItemsPerThread,
+    bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
+    unsigned int ScatterRunLength,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class Offset
+>
+ROCPRIM_KERNEL
+__launch_bounds__(BlockSize)
+void sort_cooperative_kernel(KeysInputIterator keys_input,
+                             typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
+                             KeysOutputIterator keys_output,
+                             ValuesInputIterator values_input,
+                             typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
+                             ValuesOutputIterator values_output,
+                             Offset size,
+                             Offset * batch_digit_counts,
+                             Offset * digit_counts,
+                             grid_barrier barrier,
+                             unsigned int * executed_passes,
+                             bool first_to_output,
+                             unsigned int begin_bit,
+                             unsigned int end_bit,
+                             unsigned int blocks_per_full_batch,
+                             unsigned int full_batches)
+{
+    sort_cooperative<BlockSize, ItemsPerThread, RadixBits, ScanItemsPerThread, Descending,
+                     FloatOrder, Decomposer, ScatterRunLength>(
+        keys_input, keys_tmp, keys_output, values_input, values_tmp, values_output, size,
+        batch_digit_counts, digit_counts, barrier, executed_passes, first_to_output,
+        begin_bit, end_bit,
+        blocks_per_full_batch, full_batches
+    );
+}
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int RadixBits,
+    bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
+    unsigned int ScatterRunLength,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class Offset,
+    class LookbackScanState
+>
+ROCPRIM_KERNEL
+__launch_bounds__(BlockSize)
+void onesweep_iteration_kernel(KeysInputIterator keys_input,
+                               KeysOutputIterator keys_output,
+                               ValuesInputIterator values_input,
+                               ValuesOutputIterator values_output,
+                               Offset size,
+                               const Offset * digit_starts,
+                               LookbackScanState lookback_states,
+                               ordered_block_id<unsigned int> ordered_bid,
+                               unsigned int bit,
+                               unsigned int current_radix_bits)
+{
+    onesweep_iteration<BlockSize, ItemsPerThread, RadixBits, Descending, FloatOrder, Decomposer,
+                       ScatterRunLength>(
+        keys_input, keys_output, values_input, values_output, size,
+        digit_starts, lookback_states, ordered_bid,
+        bit, current_radix_bits
+    );
+}
+
 #ifndef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
 
 #define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
     { \
         auto _error = hipGetLastError(); \
         if(_error != hipSuccess) return _error; \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
         if(debug_synchronous) \
         { \
             std::cout << name << "(" << size << ")"; \
@@ -157,6 +503,8 @@ template<
     class Config,
     unsigned int RadixBits,
     bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
     class KeysInputIterator,
     class KeysOutputIterator,
     class ValuesInputIterator,
@@ -175,6 +523,7 @@ hipError_t radix_sort_iteration(KeysInputIterator keys_input,
                                 Offset * digit_counts,
                                 bool from_input,
                                 bool to_output,
+                                bool last_iteration,
                                 unsigned int bit,
                                 unsigned int end_bit,
                                 unsigned int blocks_per_full_batch,
@@ -199,11 +548,12 @@ hipError_t radix_sort_iteration(KeysInputIterator keys_input,
     }
 
     if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("fill_digit_counts");
     if(from_input)
     {
         hipLaunchKernelGGL(
             HIP_KERNEL_NAME(fill_digit_counts_kernel<
-                Config::sort::block_size, Config::sort::items_per_thread, RadixBits, Descending
+                Config::sort::block_size, Config::sort::items_per_thread, RadixBits, Descending, FloatOrder, Decomposer
             >),
             dim3(batches), dim3(Config::sort::block_size), 0, stream,
             keys_input, size,
@@ -218,7 +568,7 @@ hipError_t radix_sort_iteration(KeysInputIterator keys_input,
         {
             hipLaunchKernelGGL(
                 HIP_KERNEL_NAME(fill_digit_counts_kernel<
-                    Config::sort::block_size, Config::sort::items_per_thread, RadixBits, Descending
+                    Config::sort::block_size, Config::sort::items_per_thread, RadixBits, Descending, FloatOrder, Decomposer
                 >),
                 dim3(batches), dim3(Config::sort::block_size), 0, stream,
                 keys_tmp, size,
@@ -231,7 +581,7 @@ hipError_t radix_sort_iteration(KeysInputIterator keys_input,
         {
             hipLaunchKernelGGL(
                 HIP_KERNEL_NAME(fill_digit_counts_kernel<
-                    Config::sort::block_size, Config::sort::items_per_thread, RadixBits, Descending
+                    Config::sort::block_size, Config::sort::items_per_thread, RadixBits, Descending, FloatOrder, Decomposer
                 >),
                 dim3(batches), dim3(Config::sort::block_size), 0, stream,
                 keys_output, size,
@@ -244,14 +594,16 @@ hipError_t radix_sort_iteration(KeysInputIterator keys_input,
     ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("fill_digit_counts", size, start)
 
     if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("scan_batches");
     hipLaunchKernelGGL(
         HIP_KERNEL_NAME(scan_batches_kernel<Config::scan::block_size, Config::scan::items_per_thread, RadixBits>),
-        dim3(radix_size), dim3(Config::scan::block_size), 0, stream,
+        dim3(apply_grid_limit(radix_size)), dim3(Config::scan::block_size), 0, stream,
         batch_digit_counts, digit_counts, batches
     );
     ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("scan_batches", radix_size * Config::scan::block_size, start)
 
     if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("scan_digits");
     hipLaunchKernelGGL(
         HIP_KERNEL_NAME(scan_digits_kernel<RadixBits>),
         dim3(1), dim3(radix_size), 0, stream,
@@ -260,66 +612,65 @@ hipError_t radix_sort_iteration(KeysInputIterator keys_input,
     ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("scan_digits", radix_size, start)
 
     if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("sort_and_scatter");
+    auto sort_and_scatter = [&](auto keys_in, auto keys_out, auto values_in, auto values_out)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(sort_and_scatter_kernel<
+                Config::sort::block_size, Config::sort::items_per_thread, RadixBits, Descending, FloatOrder, Decomposer,
+                radix_sort_scatter_run_length<Config>::value
+            >),
+            dim3(batches), dim3(Config::sort::block_size), 0, stream,
+            keys_in, keys_out, values_in, values_out, size,
+            const_cast<const Offset *>(batch_digit_counts),
+            const_cast<const Offset *>(digit_counts),
+            bit, current_radix_bits,
+            blocks_per_full_batch, full_batches
+        );
+    };
+    // The outputs are read by the next iteration, so only the last iteration stores
+    // with the cache modifier of the configuration
+    constexpr cache_store_modifier store_modifier = config_store_cache_modifier<Config>::value;
     if(from_input)
     {
         if(to_output)
         {
-            hipLaunchKernelGGL(
-                HIP_KERNEL_NAME(sort_and_scatter_kernel<
-                    Config::sort::block_size, Config::sort::items_per_thread, RadixBits, Descending
-                >),
-                dim3(batches), dim3(Config::sort::block_size), 0, stream,
-                keys_input, keys_output, values_input, values_output, size,
-                const_cast<const Offset *>(batch_digit_counts),
-                const_cast<const Offset *>(digit_counts),
-                bit, current_radix_bits,
-                blocks_per_full_batch, full_batches
-            );
+            if(last_iteration)
+            {
+                sort_and_scatter(keys_input,
+                                 make_cache_modified_output_iterator<store_modifier>(keys_output),
+                                 values_input,
+                                 make_cache_modified_output_iterator<store_modifier>(values_output));
+            }
+            else
+            {
+                sort_and_scatter(keys_input, keys_output, values_input, values_output);
+            }
         }
         else
         {
-            hipLaunchKernelGGL(
-                HIP_KERNEL_NAME(sort_and_scatter_kernel<
-                    Config::sort::block_size, Config::sort::items_per_thread, RadixBits, Descending
-                >),
-                dim3(batches), dim3(Config::sort::block_size), 0, stream,
-                keys_input, keys_tmp, values_input, values_tmp, size,
-                const_cast<const Offset *>(batch_digit_counts),
-                const_cast<const Offset *>(digit_counts),
-                bit, current_radix_bits,
-                blocks_per_full_batch, full_batches
-            );
+            sort_and_scatter(keys_input, keys_tmp, values_input, values_tmp);
         }
     }
     else
     {
         if(to_output)
         {
-            hipLaunchKernelGGL(
-                HIP_KERNEL_NAME(sort_and_scatter_kernel<
-                    Config::sort::block_size, Config::sort::items_per_thread, RadixBits, Descending
-                >),
-                dim3(batches), dim3(Config::sort::block_size), 0, stream,
-                keys_tmp, keys_output, values_tmp, values_output, size,
-                const_cast<const Offset *>(batch_digit_counts),
-                const_cast<const Offset *>(digit_counts),
-                bit, current_radix_bits,
-                blocks_per_full_batch, full_batches
-            );
+            if(last_iteration)
+            {
+                sort_and_scatter(keys_tmp,
+                                 make_cache_modified_output_iterator<store_modifier>(keys_output),
+                                 values_tmp,
+                                 make_cache_modified_output_iterator<store_modifier>(values_output));
+            }
+            else
+            {
+                sort_and_scatter(keys_tmp, keys_output, values_tmp, values_output);
+            }
         }
         else
         {
-            hipLaunchKernelGGL(
-                HIP_KERNEL_NAME(sort_and_scatter_kernel<
-                    Config::sort::block_size, Config::sort::items_per_thread, RadixBits, Descending
-                >),
-                dim3(batches), dim3(Config::sort::block_size), 0, stream,
-                keys_output, keys_tmp, values_output, values_tmp, size,
-                const_cast<const Offset *>(batch_digit_counts),
-                const_cast<const Offset *>(digit_counts),
-                bit, current_radix_bits,
-                blocks_per_full_batch, full_batches
-            );
+            sort_and_scatter(keys_output, keys_tmp, values_output, values_tmp);
         }
     }
     ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("sort_and_scatter", size, start)
@@ -327,9 +678,18 @@ hipError_t radix_sort_iteration(KeysInputIterator keys_input,
     return hipSuccess;
 }
 
+// The number of bytes of a key and its value, which are moved by every pass
+template<class Key, class Value>
+constexpr size_t radix_sort_item_bytes()
+{
+    return sizeof(Key) + (std::is_same<Value, ::rocprim::empty_type>::value ? 0 : sizeof(Value));
+}
+
 template<
     class Config,
     bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
     class KeysInputIterator,
     class KeysOutputIterator,
     class ValuesInputIterator,
@@ -374,13 +734,21 @@ hipError_t radix_sort_single_impl(void * temporary_storage,
         if(error != hipSuccess) return error;
     }
 
-    hipError_t error = radix_sort_single<config, Descending>(
-        keys_input, keys_output, values_input, values_output, size,
+    constexpr cache_store_modifier store_modifier = config_store_cache_modifier<config>::value;
+    hipError_t error = radix_sort_single<config, Descending, FloatOrder, Decomposer>(
+        keys_input,
+        make_cache_modified_output_iterator<store_modifier>(keys_output),
+        values_input,
+        make_cache_modified_output_iterator<store_modifier>(values_output),
+        size,
         begin_bit, end_bit,
         stream, debug_synchronous
     );
     if(error != hipSuccess) return error;
 
+    const size_t bytes = size * radix_sort_item_bytes<key_type, value_type>();
+    record_call_info("radix_sort", "single", 1, false, bytes, bytes);
+
     is_result_in_output = true;
     return hipSuccess;
 }
@@ -388,6 +756,8 @@ hipError_t radix_sort_single_impl(void * temporary_storage,
 template<
     class Config,
     bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
     class KeysInputIterator,
     class KeysOutputIterator,
     class ValuesInputIterator,
@@ -451,13 +821,24 @@ hipError_t radix_sort_merge_impl(void * temporary_storage,
         values_tmp = values_tmp_storage;
     }
 
-    hipError_t error = radix_sort_merge<config, Descending>(
+    hipError_t error = radix_sort_merge<config, Descending, FloatOrder, Decomposer>(
         keys_input, keys_tmp, keys_output, values_input, values_tmp, values_output, size,
         begin_bit, end_bit,
         stream, debug_synchronous
     );
     if(error != hipSuccess) return error;
 
+    // The blocks are sorted, then the sorted runs are merged until one run remains
+    constexpr unsigned int items_per_block
+        = config::sort_merge::block_size * config::sort_merge::items_per_thread;
+    unsigned int passes = 1;
+    for(unsigned int sorted_size = items_per_block; sorted_size < size; sorted_size *= 2)
+    {
+        passes++;
+    }
+    const size_t bytes = size_t(passes) * size * radix_sort_item_bytes<key_type, value_type>();
+    record_call_info("radix_sort", "merge", passes, false, bytes, bytes);
+
     is_result_in_output = true;
     return hipSuccess;
 }
@@ -469,9 +850,9 @@ using offset_type_t = std::conditional_t<
     size_t
 >;
 
+// The input is already sorted, because all keys have the same digits or the order check found
+// them sorted, so no pass is needed.
 template<
-    class Config,
-    bool Descending,
     class KeysInputIterator,
     class KeysOutputIterator,
     class ValuesInputIterator,
@@ -479,100 +860,439 @@ template<
     class Size
 >
 inline
-hipError_t radix_sort_iterations_impl(void * temporary_storage,
-                                      size_t& storage_size,
-                                      KeysInputIterator keys_input,
-                                      typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
-                                      KeysOutputIterator keys_output,
-                                      ValuesInputIterator values_input,
-                                      typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
-                                      ValuesOutputIterator values_output,
-                                      Size size,
-                                      bool& is_result_in_output,
-                                      unsigned int begin_bit,
-                                      unsigned int end_bit,
-                                      hipStream_t stream,
-                                      bool debug_synchronous)
+hipError_t radix_sort_copy_sorted_input(KeysInputIterator keys_input,
+                                        KeysOutputIterator keys_output,
+                                        ValuesInputIterator values_input,
+                                        ValuesOutputIterator values_output,
+                                        Size size,
+                                        bool& is_result_in_output,
+                                        bool with_double_buffer,
+                                        hipStream_t stream,
+                                        bool debug_synchronous)
 {
     using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
     using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
-    using offset_type = offset_type_t<Size>;
-
-    using config = default_or_custom_config<
-        Config,
-        default_radix_sort_config<ROCPRIM_TARGET_ARCH, key_type, value_type>
-    >;
 
     constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
 
-    constexpr unsigned int max_radix_size = 1 << config::long_radix_bits;
-
-    constexpr unsigned int scan_size = config::scan::block_size * config::scan::items_per_thread;
-    constexpr unsigned int sort_size = config::sort::block_size * config::sort::items_per_thread;
-
-    const unsigned int blocks = static_cast<unsigned int>(::rocprim::detail::ceiling_div(size, sort_size));
-    const unsigned int blocks_per_full_batch = ::rocprim::detail::ceiling_div(blocks, scan_size);
-    const unsigned int full_batches = blocks % scan_size != 0
-        ? blocks % scan_size
-        : scan_size;
-    const unsigned int batches = (blocks_per_full_batch == 1 ? full_batches : scan_size);
-    const bool with_double_buffer = keys_tmp != nullptr;
-
-    const unsigned int bits = end_bit - begin_bit;
-    const unsigned int iterations = ::rocprim::detail::ceiling_div(bits, config::long_radix_bits);
-    const unsigned int radix_bits_diff = config::long_radix_bits - config::short_radix_bits;
-    const unsigned int short_iterations = radix_bits_diff != 0
-        ? ::rocprim::min(iterations, (config::long_radix_bits * iterations - bits) / std::max(1u, radix_bits_diff))
-        : 0;
-    const unsigned int long_iterations = iterations - short_iterations;
-
-    offset_type* batch_digit_counts;
-    offset_type* digit_counts;
-    key_type*    keys_tmp_storage;
-    value_type*  values_tmp_storage;
-
-    const hipError_t partition_result = detail::temp_storage::partition(
-        temporary_storage,
-        storage_size,
-        detail::temp_storage::make_linear_partition(
-            detail::temp_storage::ptr_aligned_array(&batch_digit_counts, batches * max_radix_size),
-            detail::temp_storage::ptr_aligned_array(&digit_counts, max_radix_size),
-            detail::temp_storage::ptr_aligned_array(&keys_tmp_storage,
-                                                    !with_double_buffer ? size : 0),
-            detail::temp_storage::ptr_aligned_array(&values_tmp_storage,
-                                                    !with_double_buffer && with_values ? size
-                                                                                       : 0)));
-    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    if(with_double_buffer)
     {
-        return partition_result;
-    }
-
-    if( size == 0u )
+        // The sorted keys and values stay in the current buffers
+        is_result_in_output = false;
         return hipSuccess;
+    }
 
-    if(debug_synchronous)
+    if(!::rocprim::detail::are_iterators_equal(keys_input, keys_output))
     {
-        std::cout << "scan_size " << scan_size << '\n';
-        std::cout << "sort_size " << sort_size << '\n';
-        std::cout << "blocks " << blocks << '\n';
-        std::cout << "blocks_per_full_batch " << blocks_per_full_batch << '\n';
-        std::cout << "full_batches " << full_batches << '\n';
-        std::cout << "batches " << batches << '\n';
-        std::cout << "iterations " << iterations << '\n';
-        std::cout << "long_iterations " << long_iterations << '\n';
-        std::cout << "short_iterations " << short_iterations << '\n';
-        hipError_t error = hipStreamSynchronize(stream);
+        hipError_t error = ::rocprim::transform(
+            keys_input, keys_output, size,
+            ::rocprim::identity<key_type>(), stream, debug_synchronous
+        );
         if(error != hipSuccess) return error;
     }
-
-    if(!with_double_buffer)
+    if(with_values && !::rocprim::detail::are_iterators_equal(values_input, values_output))
     {
-        keys_tmp   = keys_tmp_storage;
-        values_tmp = values_tmp_storage;
+        hipError_t error = ::rocprim::transform(
+            values_input, values_output, size,
+            ::rocprim::identity<value_type>(), stream, debug_synchronous
+        );
+        if(error != hipSuccess) return error;
     }
 
-    bool to_output = with_double_buffer || (iterations - 1) % 2 == 0;
-    bool from_input = true;
+    is_result_in_output = true;
+    return hipSuccess;
+}
+
+// Copies the input to the output in the reverse order. If the input is also the output,
+// it is reversed into tmp and copied back.
+template<class InputIterator, class OutputIterator, class Size>
+inline
+hipError_t radix_sort_reverse_copy(InputIterator input,
+                                   typename std::iterator_traits<InputIterator>::value_type * tmp,
+                                   OutputIterator output,
+                                   Size size,
+                                   hipStream_t stream,
+                                   bool debug_synchronous)
+{
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    const auto reversed_input = ::rocprim::make_reverse_iterator(input + size);
+    if(!::rocprim::detail::are_iterators_equal(input, output))
+    {
+        return ::rocprim::transform(reversed_input, output, size,
+                                    ::rocprim::identity<value_type>(), stream, debug_synchronous);
+    }
+
+    hipError_t error = ::rocprim::transform(reversed_input, tmp, size,
+                                            ::rocprim::identity<value_type>(),
+                                            stream, debug_synchronous);
+    if(error != hipSuccess) return error;
+    return ::rocprim::transform(tmp, output, size,
+                                ::rocprim::identity<value_type>(), stream, debug_synchronous);
+}
+
+// The keys are strictly reverse sorted, so the sorted keys and values are the reversed input.
+// There are no equal keys, so reversing keeps the sort stable.
+template<
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class Size
+>
+inline
+hipError_t radix_sort_copy_reversed_input(KeysInputIterator keys_input,
+                                          typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
+                                          KeysOutputIterator keys_output,
+                                          ValuesInputIterator values_input,
+                                          typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
+                                          ValuesOutputIterator values_output,
+                                          Size size,
+                                          bool& is_result_in_output,
+                                          hipStream_t stream,
+                                          bool debug_synchronous)
+{
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+
+    constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+
+    // With double buffers the input is the current buffer and the output is the alternate one
+    hipError_t error = radix_sort_reverse_copy(keys_input, keys_tmp, keys_output, size,
+                                               stream, debug_synchronous);
+    if(error != hipSuccess) return error;
+    if(with_values)
+    {
+        error = radix_sort_reverse_copy(values_input, values_tmp, values_output, size,
+                                        stream, debug_synchronous);
+        if(error != hipSuccess) return error;
+    }
+
+    is_result_in_output = true;
+    return hipSuccess;
+}
+
+// Number of bits of the range of the bit keys found by the first pass, key_range holds
+// the minimum and the maximum
+inline
+unsigned int radix_key_range_bits(const unsigned long long* key_range)
+{
+    unsigned int range_bits = 0;
+    for(unsigned long long range = key_range[1] - key_range[0]; range != 0; range >>= 1)
+    {
+        range_bits++;
+    }
+    return range_bits;
+}
+
+// The keys of disabled configurations are not compressed, it is never called
+template<bool Enabled, class Config, bool Descending, radix_float_order FloatOrder, class... Args>
+inline
+auto radix_sort_compressed_impl(Args&&...)
+    -> typename std::enable_if<!Enabled, hipError_t>::type
+{
+    return hipErrorInvalidValue;
+}
+
+template<
+    bool Enabled,
+    class Config,
+    bool Descending,
+    radix_float_order FloatOrder,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class Size
+>
+inline
+auto radix_sort_compressed_impl(void * temporary_storage,
+                                size_t storage_size,
+                                KeysInputIterator keys_input,
+                                typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
+                                KeysOutputIterator keys_output,
+                                ValuesInputIterator values_input,
+                                typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
+                                ValuesOutputIterator values_output,
+                                Size size,
+                                bool& is_result_in_output,
+                                unsigned long long min_bit_key,
+                                unsigned int range_bits,
+                                hipStream_t stream,
+                                bool debug_synchronous,
+                                unsigned int* executed_passes)
+    -> typename std::enable_if<Enabled, hipError_t>::type;
+
+template<
+    class Config,
+    bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class Size
+>
+inline
+hipError_t radix_sort_iterations_impl(void * temporary_storage,
+                                      size_t& storage_size,
+                                      KeysInputIterator keys_input,
+                                      typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
+                                      KeysOutputIterator keys_output,
+                                      ValuesInputIterator values_input,
+                                      typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
+                                      ValuesOutputIterator values_output,
+                                      Size size,
+                                      bool& is_result_in_output,
+                                      unsigned int begin_bit,
+                                      unsigned int end_bit,
+                                      hipStream_t stream,
+                                      bool debug_synchronous,
+                                      unsigned int* executed_passes)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    using offset_type = offset_type_t<Size>;
+
+    using config = default_or_custom_config<
+        Config,
+        default_radix_sort_config<ROCPRIM_TARGET_ARCH, key_type, value_type>
+    >;
+
+    constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+    constexpr bool check_order = radix_sort_check_sorted_input<config>::value;
+    constexpr bool find_range = radix_sort_compress_key_range_enabled<config,
+                                                                      key_type,
+                                                                      Decomposer,
+                                                                      KeysOutputIterator>::value;
+    // The order flags follow the nonuniform digits, so they are read back together
+    constexpr unsigned int order_flag_count = check_order ? 2 : 0;
+
+    constexpr unsigned int max_radix_size = 1 << config::long_radix_bits;
+
+    constexpr unsigned int scan_size = config::scan::block_size * config::scan::items_per_thread;
+    constexpr unsigned int sort_size = config::sort::block_size * config::sort::items_per_thread;
+
+    const unsigned int blocks = static_cast<unsigned int>(::rocprim::detail::ceiling_div(size, sort_size));
+    // The blocks are split into at most scan_size batches, scoped_grid_limit can reduce the
+    // number of batches and thus the grids of the kernels processing them.
+    const unsigned int max_batches = apply_grid_limit(scan_size);
+    const unsigned int blocks_per_full_batch = ::rocprim::detail::ceiling_div(blocks, max_batches);
+    const unsigned int full_batches = blocks % max_batches != 0
+        ? blocks % max_batches
+        : max_batches;
+    const unsigned int batches = (blocks_per_full_batch == 1 ? full_batches : max_batches);
+    const bool with_double_buffer = keys_tmp != nullptr;
+
+    const unsigned int bits = end_bit - begin_bit;
+    const unsigned int iterations = ::rocprim::detail::ceiling_div(bits, config::long_radix_bits);
+    const unsigned int radix_bits_diff = config::long_radix_bits - config::short_radix_bits;
+    const unsigned int short_iterations = radix_bits_diff != 0
+        ? ::rocprim::min(iterations, (config::long_radix_bits * iterations - bits) / std::max(1u, radix_bits_diff))
+        : 0;
+    const unsigned int long_iterations = iterations - short_iterations;
+
+    // Every block of find_nonuniform_digits_kernel processes several tiles
+    constexpr unsigned int max_find_blocks = 1024;
+    const unsigned int find_blocks = apply_grid_limit(std::min(blocks, max_find_blocks));
+
+    // The range of the keys follows the order flags at a 64-bit aligned offset
+    const unsigned int range_offset
+        = find_range ? ::rocprim::detail::ceiling_div(iterations + order_flag_count, 2u) * 2
+                     : iterations + order_flag_count;
+    const unsigned int flag_count = range_offset + (find_range ? 4 : 0);
+
+    offset_type*  batch_digit_counts;
+    offset_type*  digit_counts;
+    unsigned int* nonuniform_digits;
+    key_type*     keys_tmp_storage;
+    value_type*   values_tmp_storage;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&batch_digit_counts, batches * max_radix_size),
+            detail::temp_storage::ptr_aligned_array(&digit_counts, max_radix_size),
+            detail::temp_storage::make_partition(&nonuniform_digits,
+                                                 sizeof(unsigned int) * flag_count,
+                                                 alignof(unsigned long long)),
+            detail::temp_storage::ptr_aligned_array(&keys_tmp_storage,
+                                                    !with_double_buffer ? size : 0),
+            detail::temp_storage::ptr_aligned_array(&values_tmp_storage,
+                                                    !with_double_buffer && with_values ? size
+                                                                                       : 0)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(executed_passes != nullptr)
+    {
+        *executed_passes = 0;
+    }
+
+    if( size == 0u )
+        return hipSuccess;
+
+    if(debug_synchronous)
+    {
+        std::cout << "scan_size " << scan_size << '\n';
+        std::cout << "sort_size " << sort_size << '\n';
+        std::cout << "blocks " << blocks << '\n';
+        std::cout << "blocks_per_full_batch " << blocks_per_full_batch << '\n';
+        std::cout << "full_batches " << full_batches << '\n';
+        std::cout << "batches " << batches << '\n';
+        std::cout << "iterations " << iterations << '\n';
+        std::cout << "long_iterations " << long_iterations << '\n';
+        std::cout << "short_iterations " << short_iterations << '\n';
+        hipError_t error = hipStreamSynchronize(stream);
+        if(error != hipSuccess) return error;
+    }
+
+    // The compressed sort gets the buffers of the caller, it allocates its own temporary buffers
+    key_type* const   caller_keys_tmp   = keys_tmp;
+    value_type* const caller_values_tmp = values_tmp;
+    if(!with_double_buffer)
+    {
+        keys_tmp   = keys_tmp_storage;
+        values_tmp = values_tmp_storage;
+    }
+
+    // Iterations in which all keys have the same digit do not change the order of keys,
+    // they are skipped. The host cannot read the digits while the stream is captured to a graph,
+    // then all iterations are run. The order and the range of the keys are found in the same
+    // pass if enabled.
+    bool capturing;
+    {
+        const hipError_t error = detail::is_stream_capturing(stream, capturing);
+        if(error != hipSuccess) return error;
+    }
+    std::vector<unsigned int> host_nonuniform_digits(flag_count, 1u);
+    unsigned int              passes = iterations;
+    unsigned long long* const key_range
+        = reinterpret_cast<unsigned long long*>(nonuniform_digits + range_offset);
+    if(!capturing)
+    {
+        std::chrono::high_resolution_clock::time_point start;
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("find_nonuniform_digits");
+        hipError_t error = hipMemsetAsync(nonuniform_digits,
+                                          0,
+                                          sizeof(unsigned int) * flag_count,
+                                          stream);
+        if(error != hipSuccess) return error;
+        if(find_range)
+        {
+            // The minimum starts as all ones
+            error = hipMemsetAsync(key_range, 0xFF, sizeof(unsigned long long), stream);
+            if(error != hipSuccess) return error;
+        }
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(find_nonuniform_digits_kernel<
+                config::sort::block_size, config::sort::items_per_thread,
+                config::long_radix_bits, config::short_radix_bits,
+                Descending, FloatOrder, Decomposer, check_order, find_range
+            >),
+            dim3(find_blocks), dim3(config::sort::block_size), 0, stream,
+            keys_input, nonuniform_digits, nonuniform_digits + iterations, key_range,
+            static_cast<offset_type>(size),
+            begin_bit, end_bit, long_iterations, iterations
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("find_nonuniform_digits", size, start)
+
+        error = detail::memcpy_and_sync(host_nonuniform_digits.data(),
+                                        nonuniform_digits,
+                                        sizeof(unsigned int) * flag_count,
+                                        hipMemcpyDeviceToHost,
+                                        stream);
+        if(error != hipSuccess) return error;
+
+        passes = static_cast<unsigned int>(std::count(host_nonuniform_digits.begin(),
+                                                      host_nonuniform_digits.begin() + iterations,
+                                                      1u));
+    }
+    // Sorted inputs are copied and strictly reverse sorted inputs are reversed without passes
+    const bool is_sorted = check_order && host_nonuniform_digits[iterations] == 0;
+    const bool is_reverse_sorted
+        = check_order && !is_sorted && host_nonuniform_digits[iterations + 1] == 0;
+    if(is_sorted || is_reverse_sorted)
+    {
+        passes = 0;
+    }
+    if(debug_synchronous)
+    {
+        std::cout << "passes " << passes << '\n';
+        if(is_reverse_sorted)
+        {
+            std::cout << "reverse sorted input" << '\n';
+        }
+    }
+    if(executed_passes != nullptr)
+    {
+        *executed_passes = passes;
+    }
+
+    // Keys of a narrow range are sorted on the bits of the range if it saves at least two passes,
+    // which pays for one more read of the keys and the restore of the sorted keys
+    if(find_range && !capturing && passes > 0 && begin_bit == 0
+       && end_bit == sizeof(key_type) * 8)
+    {
+        unsigned long long host_key_range[2];
+        std::memcpy(host_key_range,
+                    host_nonuniform_digits.data() + range_offset,
+                    sizeof(host_key_range));
+        const unsigned int range_bits = radix_key_range_bits(host_key_range);
+        if(::rocprim::detail::ceiling_div(range_bits, config::long_radix_bits) + 2 <= passes)
+        {
+            return radix_sort_compressed_impl<find_range, config, Descending, FloatOrder>(
+                temporary_storage, storage_size,
+                keys_input, caller_keys_tmp, keys_output,
+                values_input, caller_values_tmp, values_output,
+                size, is_result_in_output,
+                host_key_range[0], range_bits,
+                stream, debug_synchronous, executed_passes
+            );
+        }
+    }
+
+    // Every pass reads the keys to count the digits and moves all keys and values, uniform
+    // digits are found by one more read of the keys
+    const size_t item_bytes  = radix_sort_item_bytes<key_type, value_type>();
+    const size_t scan_bytes  = size_t(passes + (capturing ? 0 : 1)) * size * sizeof(key_type);
+    const size_t moved_bytes = size_t(std::max(passes, 1u)) * size * item_bytes;
+    const auto   record      = [&]()
+    {
+        record_call_info("radix_sort",
+                         "iterations",
+                         passes,
+                         false,
+                         scan_bytes + moved_bytes,
+                         moved_bytes);
+    };
+
+    if(passes == 0)
+    {
+        const hipError_t error
+            = is_reverse_sorted
+                  ? radix_sort_copy_reversed_input(keys_input, keys_tmp, keys_output,
+                                                   values_input, values_tmp, values_output,
+                                                   size, is_result_in_output,
+                                                   stream, debug_synchronous)
+                  : radix_sort_copy_sorted_input(keys_input, keys_output,
+                                                 values_input, values_output,
+                                                 size, is_result_in_output,
+                                                 with_double_buffer,
+                                                 stream, debug_synchronous);
+        if(error == hipSuccess)
+        {
+            record();
+        }
+        return error;
+    }
+
+    bool to_output = with_double_buffer || (passes - 1) % 2 == 0;
+    bool from_input = true;
     if(!with_double_buffer && to_output)
     {
         // Copy input keys and values if necessary (in-place sorting: input and output iterators are equal)
@@ -599,13 +1319,40 @@ hipError_t radix_sort_iterations_impl(void * temporary_storage,
         }
     }
 
+    // Iterations where all keys have the same digit are skipped
+    unsigned int last_iteration = 0;
+    for(unsigned int i = 0; i < long_iterations + short_iterations; i++)
+    {
+        if(host_nonuniform_digits[i] != 0) last_iteration = i;
+    }
+
     unsigned int bit = begin_bit;
-    for(unsigned int i = 0; i < long_iterations; i++)
+    for(unsigned int i = 0; i < long_iterations; i++, bit += config::long_radix_bits)
+    {
+        if(host_nonuniform_digits[i] == 0) continue;
+
+        hipError_t error = radix_sort_iteration<config, config::long_radix_bits, Descending, FloatOrder, Decomposer>(
+            keys_input, keys_tmp, keys_output, values_input, values_tmp, values_output,
+            static_cast<offset_type>(size), batch_digit_counts, digit_counts,
+            from_input, to_output, i == last_iteration,
+            bit, end_bit,
+            blocks_per_full_batch, full_batches, batches,
+            stream, debug_synchronous
+        );
+        if(error != hipSuccess) return error;
+
+        is_result_in_output = to_output;
+        from_input = false;
+        to_output = !to_output;
+    }
+    for(unsigned int i = 0; i < short_iterations; i++, bit += config::short_radix_bits)
     {
-        hipError_t error = radix_sort_iteration<config, config::long_radix_bits, Descending>(
+        if(host_nonuniform_digits[long_iterations + i] == 0) continue;
+
+        hipError_t error = radix_sort_iteration<config, config::short_radix_bits, Descending, FloatOrder, Decomposer>(
             keys_input, keys_tmp, keys_output, values_input, values_tmp, values_output,
             static_cast<offset_type>(size), batch_digit_counts, digit_counts,
-            from_input, to_output,
+            from_input, to_output, long_iterations + i == last_iteration,
             bit, end_bit,
             blocks_per_full_batch, full_batches, batches,
             stream, debug_synchronous
@@ -615,32 +1362,1344 @@ hipError_t radix_sort_iterations_impl(void * temporary_storage,
         is_result_in_output = to_output;
         from_input = false;
         to_output = !to_output;
-        bit += config::long_radix_bits;
     }
-    for(unsigned int i = 0; i < short_iterations; i++)
+
+    record();
+    return hipSuccess;
+}
+
+template<
+    class Config,
+    bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class Offset,
+    class LookbackScanState
+>
+inline
+hipError_t radix_sort_onesweep_iteration(KeysInputIterator keys_input,
+                                         typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
+                                         KeysOutputIterator keys_output,
+                                         ValuesInputIterator values_input,
+                                         typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
+                                         ValuesOutputIterator values_output,
+                                         Offset size,
+                                         const Offset * digit_starts,
+                                         LookbackScanState lookback_states,
+                                         ordered_block_id<unsigned int> ordered_bid,
+                                         bool from_input,
+                                         bool to_output,
+                                         bool last_iteration,
+                                         unsigned int bit,
+                                         unsigned int end_bit,
+                                         unsigned int blocks,
+                                         hipStream_t stream,
+                                         bool debug_synchronous)
+{
+    constexpr unsigned int radix_bits = Config::long_radix_bits;
+    constexpr unsigned int radix_size = 1 << radix_bits;
+    constexpr unsigned int block_size = Config::onesweep::block_size;
+    constexpr unsigned int items_per_thread = Config::onesweep::items_per_thread;
+
+    // Handle cases when (end_bit - bit) is not divisible by radix_bits, i.e. the last
+    // iteration has a shorter mask.
+    const unsigned int current_radix_bits = ::rocprim::min(radix_bits, end_bit - bit);
+    const unsigned int states = blocks * radix_size;
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if(debug_synchronous)
+    {
+        std::cout << "bit " << bit << '\n';
+        std::cout << "current_radix_bits " << current_radix_bits << '\n';
+    }
+
+    // Reset the look-back states of all (block, digit) pairs and the ordered block id
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("init_lookback_scan_state_kernel");
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(init_lookback_scan_state_kernel<LookbackScanState>),
+        dim3(apply_grid_limit(
+            ::rocprim::detail::ceiling_div(
+                states, static_cast<unsigned int>(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE)))),
+        dim3(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE), 0, stream,
+        lookback_states, states, ordered_bid
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_lookback_scan_state_kernel", states, start)
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("onesweep_iteration");
+    auto onesweep_iteration = [&](auto keys_in, auto keys_out, auto values_in, auto values_out)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(onesweep_iteration_kernel<
+                block_size, items_per_thread, radix_bits, Descending, FloatOrder, Decomposer,
+                radix_sort_scatter_run_length<Config>::value
+            >),
+            dim3(blocks), dim3(block_size), 0, stream,
+            keys_in, keys_out, values_in, values_out, size,
+            digit_starts, lookback_states, ordered_bid,
+            bit, current_radix_bits
+        );
+    };
+    // The outputs are read by the next iteration, so only the last iteration stores
+    // with the cache modifier of the configuration
+    constexpr cache_store_modifier store_modifier = config_store_cache_modifier<Config>::value;
+    if(from_input)
+    {
+        if(to_output)
+        {
+            if(last_iteration)
+            {
+                onesweep_iteration(keys_input,
+                                   make_cache_modified_output_iterator<store_modifier>(keys_output),
+                                   values_input,
+                                   make_cache_modified_output_iterator<store_modifier>(values_output));
+            }
+            else
+            {
+                onesweep_iteration(keys_input, keys_output, values_input, values_output);
+            }
+        }
+        else
+        {
+            onesweep_iteration(keys_input, keys_tmp, values_input, values_tmp);
+        }
+    }
+    else
+    {
+        if(to_output)
+        {
+            if(last_iteration)
+            {
+                onesweep_iteration(keys_tmp,
+                                   make_cache_modified_output_iterator<store_modifier>(keys_output),
+                                   values_tmp,
+                                   make_cache_modified_output_iterator<store_modifier>(values_output));
+            }
+            else
+            {
+                onesweep_iteration(keys_tmp, keys_output, values_tmp, values_output);
+            }
+        }
+        else
+        {
+            onesweep_iteration(keys_output, keys_tmp, values_output, values_tmp);
+        }
+    }
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("onesweep_iteration", size, start)
+
+    return hipSuccess;
+}
+
+// Onesweep radix sort: digit counts of all iterations are computed in one pass over the keys,
+// after that every iteration needs only one kernel that sorts and scatters the keys, the block
+// offsets of digits are computed with decoupled look-back in the same kernel.
+template<
+    class Config,
+    bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class Size
+>
+inline
+hipError_t radix_sort_onesweep_impl(void * temporary_storage,
+                                    size_t& storage_size,
+                                    KeysInputIterator keys_input,
+                                    typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
+                                    KeysOutputIterator keys_output,
+                                    ValuesInputIterator values_input,
+                                    typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
+                                    ValuesOutputIterator values_output,
+                                    Size size,
+                                    bool& is_result_in_output,
+                                    unsigned int begin_bit,
+                                    unsigned int end_bit,
+                                    hipStream_t stream,
+                                    bool debug_synchronous,
+                                    unsigned int* executed_passes)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    using offset_type = offset_type_t<Size>;
+
+    using config = default_or_custom_config<
+        Config,
+        default_radix_sort_config<ROCPRIM_TARGET_ARCH, key_type, value_type>
+    >;
+
+    using scan_state_type = ::rocprim::detail::lookback_scan_state<offset_type>;
+    using scan_state_with_sleep_type = ::rocprim::detail::lookback_scan_state<offset_type, true>;
+    using ordered_block_id_type = ::rocprim::detail::ordered_block_id<unsigned int>;
+
+    constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+    constexpr bool check_order = radix_sort_check_sorted_input<config>::value;
+    constexpr bool find_range = radix_sort_compress_key_range_enabled<config,
+                                                                      key_type,
+                                                                      Decomposer,
+                                                                      KeysOutputIterator>::value;
+    // The order flags follow the nonuniform digits, so they are read back together
+    constexpr unsigned int order_flag_count = check_order ? 2 : 0;
+
+    constexpr unsigned int radix_bits = config::long_radix_bits;
+    constexpr unsigned int radix_size = 1 << radix_bits;
+
+    constexpr unsigned int histogram_size
+        = config::onesweep_histogram::block_size * config::onesweep_histogram::items_per_thread;
+    constexpr unsigned int sort_size
+        = config::onesweep::block_size * config::onesweep::items_per_thread;
+    // Every histogram block processes several tiles to reduce the number of global atomics
+    constexpr unsigned int max_histogram_blocks = 1024;
+
+    const unsigned int blocks = static_cast<unsigned int>(::rocprim::detail::ceiling_div(size, sort_size));
+    const unsigned int histogram_blocks = static_cast<unsigned int>(
+        std::min<Size>(::rocprim::detail::ceiling_div(size, histogram_size), max_histogram_blocks));
+    const bool with_double_buffer = keys_tmp != nullptr;
+
+    const unsigned int bits = end_bit - begin_bit;
+    const unsigned int iterations = ::rocprim::detail::ceiling_div(bits, radix_bits);
+
+    // The range of the keys follows the order flags at a 64-bit aligned offset
+    const unsigned int range_offset
+        = find_range ? ::rocprim::detail::ceiling_div(iterations + order_flag_count, 2u) * 2
+                     : iterations + order_flag_count;
+    const unsigned int flag_count = range_offset + (find_range ? 4 : 0);
+
+    // Both scan state types have the same layout
+    const detail::temp_storage::layout scan_state_layout
+        = scan_state_type::get_temp_storage_layout(blocks * radix_size);
+
+    offset_type*  digit_counts;
+    unsigned int* nonuniform_digits;
+    void*         scan_state_storage;
+    key_type*    keys_tmp_storage;
+    value_type*  values_tmp_storage;
+    typename ordered_block_id_type::id_type* ordered_bid_storage;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&digit_counts, iterations * radix_size),
+            detail::temp_storage::make_partition(&nonuniform_digits,
+                                                 sizeof(unsigned int) * flag_count,
+                                                 alignof(unsigned long long)),
+            detail::temp_storage::make_partition(&scan_state_storage, scan_state_layout),
+            detail::temp_storage::make_partition(&ordered_bid_storage,
+                                                 ordered_block_id_type::get_temp_storage_layout()),
+            detail::temp_storage::ptr_aligned_array(&keys_tmp_storage,
+                                                    !with_double_buffer ? size : 0),
+            detail::temp_storage::ptr_aligned_array(&values_tmp_storage,
+                                                    !with_double_buffer && with_values ? size
+                                                                                       : 0)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(executed_passes != nullptr)
+    {
+        *executed_passes = 0;
+    }
+
+    if( size == 0u )
+        return hipSuccess;
+
+    bool use_sleep;
+    if(const hipError_t error = is_sleep_scan_state_used(use_sleep))
+    {
+        return error;
+    }
+
+    if(debug_synchronous)
+    {
+        std::cout << "histogram_size " << histogram_size << '\n';
+        std::cout << "sort_size " << sort_size << '\n';
+        std::cout << "histogram_blocks " << histogram_blocks << '\n';
+        std::cout << "blocks " << blocks << '\n';
+        std::cout << "iterations " << iterations << '\n';
+        hipError_t error = hipStreamSynchronize(stream);
+        if(error != hipSuccess) return error;
+    }
+
+    // The compressed sort gets the buffers of the caller, it allocates its own temporary buffers
+    key_type* const   caller_keys_tmp   = keys_tmp;
+    value_type* const caller_values_tmp = values_tmp;
+    if(!with_double_buffer)
+    {
+        keys_tmp   = keys_tmp_storage;
+        values_tmp = values_tmp_storage;
+    }
+
+    auto scan_state = scan_state_type::create(scan_state_storage, blocks * radix_size);
+    auto scan_state_with_sleep
+        = scan_state_with_sleep_type::create(scan_state_storage, blocks * radix_size);
+    auto ordered_bid = ordered_block_id_type::create(ordered_bid_storage);
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("onesweep_histograms");
+    hipError_t error = hipMemsetAsync(digit_counts, 0, sizeof(offset_type) * iterations * radix_size, stream);
+    if(error != hipSuccess) return error;
+    if(check_order)
+    {
+        error = hipMemsetAsync(nonuniform_digits + iterations,
+                               0,
+                               sizeof(unsigned int) * order_flag_count,
+                               stream);
+        if(error != hipSuccess) return error;
+    }
+    unsigned long long* const key_range
+        = reinterpret_cast<unsigned long long*>(nonuniform_digits + range_offset);
+    if(find_range)
+    {
+        // The minimum starts as all ones and the maximum as 0
+        error = hipMemsetAsync(key_range, 0xFF, sizeof(unsigned long long), stream);
+        if(error != hipSuccess) return error;
+        error = hipMemsetAsync(key_range + 1, 0, sizeof(unsigned long long), stream);
+        if(error != hipSuccess) return error;
+    }
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(onesweep_histograms_kernel<
+            config::onesweep_histogram::block_size, config::onesweep_histogram::items_per_thread,
+            radix_bits, Descending, FloatOrder, Decomposer, check_order, find_range
+        >),
+        dim3(histogram_blocks), dim3(config::onesweep_histogram::block_size), 0, stream,
+        keys_input, digit_counts, nonuniform_digits + iterations, key_range,
+        static_cast<offset_type>(size), begin_bit, end_bit
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("onesweep_histograms", size, start)
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("onesweep_scan_histograms");
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(onesweep_scan_histograms_kernel<radix_bits>),
+        dim3(iterations), dim3(radix_size), 0, stream,
+        digit_counts, nonuniform_digits, static_cast<offset_type>(size)
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("onesweep_scan_histograms", iterations * radix_size, start)
+
+    // Iterations in which all keys have the same digit do not change the order of keys,
+    // they are skipped. All iterations are run while the stream is captured to a graph.
+    // The order and the range of the keys are found by the histogram pass if enabled.
+    bool capturing;
+    error = detail::is_stream_capturing(stream, capturing);
+    if(error != hipSuccess) return error;
+    std::vector<unsigned int> host_nonuniform_digits(flag_count, 1u);
+    if(!capturing)
+    {
+        error = detail::memcpy_and_sync(host_nonuniform_digits.data(),
+                                        nonuniform_digits,
+                                        sizeof(unsigned int) * flag_count,
+                                        hipMemcpyDeviceToHost,
+                                        stream);
+        if(error != hipSuccess) return error;
+    }
+
+    // Sorted inputs are copied and strictly reverse sorted inputs are reversed without passes
+    const bool is_sorted = check_order && host_nonuniform_digits[iterations] == 0;
+    const bool is_reverse_sorted
+        = check_order && !is_sorted && host_nonuniform_digits[iterations + 1] == 0;
+    const unsigned int passes
+        = is_sorted || is_reverse_sorted
+              ? 0
+              : static_cast<unsigned int>(std::count(host_nonuniform_digits.begin(),
+                                                     host_nonuniform_digits.begin() + iterations,
+                                                     1u));
+    if(debug_synchronous)
+    {
+        std::cout << "passes " << passes << '\n';
+        if(is_reverse_sorted)
+        {
+            std::cout << "reverse sorted input" << '\n';
+        }
+    }
+    if(executed_passes != nullptr)
+    {
+        *executed_passes = passes;
+    }
+
+    // Keys of a narrow range are sorted on the bits of the range if it saves at least two passes,
+    // which pay for the histograms of the compressed keys and the restore of the sorted keys
+    if(find_range && !capturing && passes > 0 && begin_bit == 0
+       && end_bit == sizeof(key_type) * 8)
+    {
+        unsigned long long host_key_range[2];
+        std::memcpy(host_key_range,
+                    host_nonuniform_digits.data() + range_offset,
+                    sizeof(host_key_range));
+        const unsigned int range_bits = radix_key_range_bits(host_key_range);
+        if(::rocprim::detail::ceiling_div(range_bits, radix_bits) + 2 <= passes)
+        {
+            return radix_sort_compressed_impl<find_range, config, Descending, FloatOrder>(
+                temporary_storage, storage_size,
+                keys_input, caller_keys_tmp, keys_output,
+                values_input, caller_values_tmp, values_output,
+                size, is_result_in_output,
+                host_key_range[0], range_bits,
+                stream, debug_synchronous, executed_passes
+            );
+        }
+    }
+
+    // The histograms of all digits are computed by one read of the keys, every pass moves all
+    // keys and values
+    const size_t item_bytes  = radix_sort_item_bytes<key_type, value_type>();
+    const size_t scan_bytes  = size * sizeof(key_type);
+    const size_t moved_bytes = size_t(std::max(passes, 1u)) * size * item_bytes;
+    const auto   record      = [&]()
+    {
+        record_call_info("radix_sort",
+                         "onesweep",
+                         passes,
+                         use_sleep,
+                         scan_bytes + moved_bytes,
+                         moved_bytes);
+    };
+
+    if(passes == 0)
+    {
+        const hipError_t error
+            = is_reverse_sorted
+                  ? radix_sort_copy_reversed_input(keys_input, keys_tmp, keys_output,
+                                                   values_input, values_tmp, values_output,
+                                                   size, is_result_in_output,
+                                                   stream, debug_synchronous)
+                  : radix_sort_copy_sorted_input(keys_input, keys_output,
+                                                 values_input, values_output,
+                                                 size, is_result_in_output,
+                                                 with_double_buffer,
+                                                 stream, debug_synchronous);
+        if(error == hipSuccess)
+        {
+            record();
+        }
+        return error;
+    }
+
+    bool to_output = with_double_buffer || (passes - 1) % 2 == 0;
+    bool from_input = true;
+    if(!with_double_buffer && to_output)
+    {
+        // Copy input keys and values if necessary (in-place sorting: input and output iterators are equal)
+        const bool keys_equal = ::rocprim::detail::are_iterators_equal(keys_input, keys_output);
+        const bool values_equal = with_values && ::rocprim::detail::are_iterators_equal(values_input, values_output);
+        if(keys_equal || values_equal)
+        {
+            hipError_t error = ::rocprim::transform(
+                keys_input, keys_tmp, size,
+                ::rocprim::identity<key_type>(), stream, debug_synchronous
+            );
+            if(error != hipSuccess) return error;
+
+            if(with_values)
+            {
+                hipError_t error = ::rocprim::transform(
+                    values_input, values_tmp, size,
+                    ::rocprim::identity<value_type>(), stream, debug_synchronous
+                );
+                if(error != hipSuccess) return error;
+            }
+
+            from_input = false;
+        }
+    }
+
+    // Iterations where all keys have the same digit are skipped
+    unsigned int last_iteration = 0;
+    for(unsigned int i = 0; i < iterations; i++)
+    {
+        if(host_nonuniform_digits[i] != 0) last_iteration = i;
+    }
+
+    unsigned int bit = begin_bit;
+    for(unsigned int i = 0; i < iterations; i++, bit += radix_bits)
+    {
+        if(host_nonuniform_digits[i] == 0) continue;
+
+        const offset_type* digit_starts = digit_counts + i * radix_size;
+        hipError_t error = use_sleep
+            ? radix_sort_onesweep_iteration<config, Descending, FloatOrder, Decomposer>(
+                keys_input, keys_tmp, keys_output, values_input, values_tmp, values_output,
+                static_cast<offset_type>(size), digit_starts, scan_state_with_sleep, ordered_bid,
+                from_input, to_output, i == last_iteration,
+                bit, end_bit, blocks,
+                stream, debug_synchronous)
+            : radix_sort_onesweep_iteration<config, Descending, FloatOrder, Decomposer>(
+                keys_input, keys_tmp, keys_output, values_input, values_tmp, values_output,
+                static_cast<offset_type>(size), digit_starts, scan_state, ordered_bid,
+                from_input, to_output, i == last_iteration,
+                bit, end_bit, blocks,
+                stream, debug_synchronous);
+        if(error != hipSuccess) return error;
+
+        is_result_in_output = to_output;
+        from_input = false;
+        to_output = !to_output;
+    }
+
+    record();
+    return hipSuccess;
+}
+
+// Sorts inputs that are too large for the merge sort, Config must be a resolved radix_sort_config.
+template<
+    class Config,
+    bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class Size
+>
+inline
+auto radix_sort_large_impl(void * temporary_storage,
+                           size_t& storage_size,
+                           KeysInputIterator keys_input,
+                           typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
+                           KeysOutputIterator keys_output,
+                           ValuesInputIterator values_input,
+                           typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
+                           ValuesOutputIterator values_output,
+                           Size size,
+                           bool& is_result_in_output,
+                           unsigned int begin_bit,
+                           unsigned int end_bit,
+                           hipStream_t stream,
+                           bool debug_synchronous,
+                           unsigned int* executed_passes)
+    -> typename std::enable_if<Config::use_onesweep, hipError_t>::type
+{
+    return radix_sort_onesweep_impl<Config, Descending, FloatOrder, Decomposer>(
+        temporary_storage, storage_size,
+        keys_input, keys_tmp, keys_output,
+        values_input, values_tmp, values_output,
+        size, is_result_in_output,
+        begin_bit, end_bit,
+        stream, debug_synchronous, executed_passes
+    );
+}
+
+template<
+    class Config,
+    bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class Size
+>
+inline
+auto radix_sort_large_impl(void * temporary_storage,
+                           size_t& storage_size,
+                           KeysInputIterator keys_input,
+                           typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
+                           KeysOutputIterator keys_output,
+                           ValuesInputIterator values_input,
+                           typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
+                           ValuesOutputIterator values_output,
+                           Size size,
+                           bool& is_result_in_output,
+                           unsigned int begin_bit,
+                           unsigned int end_bit,
+                           hipStream_t stream,
+                           bool debug_synchronous,
+                           unsigned int* executed_passes)
+    -> typename std::enable_if<!Config::use_onesweep, hipError_t>::type
+{
+    return radix_sort_iterations_impl<Config, Descending, FloatOrder, Decomposer>(
+        temporary_storage, storage_size,
+        keys_input, keys_tmp, keys_output,
+        values_input, values_tmp, values_output,
+        size, is_result_in_output,
+        begin_bit, end_bit,
+        stream, debug_synchronous, executed_passes
+    );
+}
+
+// Sorts the keys on the range_bits low bits of their range (see radix_sort_config): the keys are
+// read with min_bit_key subtracted from their bit keys and it is added back to the sorted keys.
+// The sort of fewer bits needs less temporary storage than the sort of the caller, so it reuses
+// its temporary storage, the range is already read back.
+template<
+    bool Enabled,
+    class Config,
+    bool Descending,
+    radix_float_order FloatOrder,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class Size
+>
+inline
+auto radix_sort_compressed_impl(void * temporary_storage,
+                                size_t storage_size,
+                                KeysInputIterator keys_input,
+                                typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
+                                KeysOutputIterator keys_output,
+                                ValuesInputIterator values_input,
+                                typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
+                                ValuesOutputIterator values_output,
+                                Size size,
+                                bool& is_result_in_output,
+                                unsigned long long min_bit_key,
+                                unsigned int range_bits,
+                                hipStream_t stream,
+                                bool debug_synchronous,
+                                unsigned int* executed_passes)
+    -> typename std::enable_if<Enabled, hipError_t>::type
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using subtract_op = radix_key_offset_op<key_type, Descending, false>;
+    using restore_op = radix_key_offset_op<key_type, Descending, true>;
+    using bit_key_type = typename subtract_op::bit_key_type;
+
+    if(debug_synchronous)
+    {
+        std::cout << "compressed range_bits " << range_bits << '\n';
+    }
+
+    const bit_key_type offset = static_cast<bit_key_type>(min_bit_key);
+    hipError_t error = radix_sort_large_impl<radix_sort_compressed_config<Config>,
+                                             Descending,
+                                             FloatOrder,
+                                             ::rocprim::identity_decomposer>(
+        temporary_storage, storage_size,
+        ::rocprim::make_transform_iterator(keys_input, subtract_op{offset}), keys_tmp, keys_output,
+        values_input, values_tmp, values_output,
+        size, is_result_in_output,
+        0, range_bits,
+        stream, debug_synchronous, executed_passes
+    );
+    if(error != hipSuccess) return error;
+
+    // With double buffers the sorted keys may be in keys_tmp
+    key_type* const sorted_keys = is_result_in_output ? keys_output : keys_tmp;
+    return ::rocprim::transform(sorted_keys, sorted_keys, size,
+                                restore_op{offset}, stream, debug_synchronous);
+}
+
+// Sorts pairs as 64-bit words (see radix_sort_packs_pairs): the first pass packs the keys and
+// the values when it loads them, the sorted words are unpacked to the outputs after the last pass.
+template<
+    class Config,
+    bool Descending,
+    radix_float_order FloatOrder,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class Size
+>
+inline
+hipError_t radix_sort_packed_pairs_impl(void * temporary_storage,
+                                        size_t& storage_size,
+                                        KeysInputIterator keys_input,
+                                        KeysOutputIterator keys_output,
+                                        ValuesInputIterator values_input,
+                                        ValuesOutputIterator values_output,
+                                        Size size,
+                                        bool& is_result_in_output,
+                                        unsigned int begin_bit,
+                                        unsigned int end_bit,
+                                        hipStream_t stream,
+                                        bool debug_synchronous,
+                                        unsigned int* executed_passes)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    using packer = radix_pair_packer<key_type, value_type, Descending, FloatOrder>;
+    using packed_type = typename packer::packed_type;
+
+    auto packed_input = ::rocprim::make_transform_iterator(
+        ::rocprim::make_zip_iterator(::rocprim::make_tuple(keys_input, values_input)),
+        typename packer::pack_op{});
+
+    ::rocprim::empty_type* values = nullptr;
+    packed_type* packed_output = nullptr;
+    void* sort_storage = nullptr;
+    size_t sort_storage_size;
+    bool is_packed_result_in_output;
+
+    // The sorted bits of the keys are above the bits of the values
+    hipError_t error = radix_sort_large_impl<Config, false, FloatOrder, ::rocprim::identity_decomposer>(
+        nullptr, sort_storage_size,
+        packed_input, nullptr, packed_output,
+        values, nullptr, values,
+        size, is_packed_result_in_output,
+        begin_bit + packer::value_bits, end_bit + packer::value_bits,
+        stream, debug_synchronous, executed_passes
+    );
+    if(error != hipSuccess) return error;
+
+    error = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&packed_output, size),
+            detail::temp_storage::make_partition(&sort_storage, sort_storage_size)));
+    if(error != hipSuccess || temporary_storage == nullptr)
+    {
+        return error;
+    }
+
+    is_result_in_output = true;
+    if(size == 0u)
+    {
+        return hipSuccess;
+    }
+
+    // Without double buffers the sorted words are always stored to packed_output
+    error = radix_sort_large_impl<Config, false, FloatOrder, ::rocprim::identity_decomposer>(
+        sort_storage, sort_storage_size,
+        packed_input, nullptr, packed_output,
+        values, nullptr, values,
+        size, is_packed_result_in_output,
+        begin_bit + packer::value_bits, end_bit + packer::value_bits,
+        stream, debug_synchronous, executed_passes
+    );
+    if(error != hipSuccess) return error;
+
+    return ::rocprim::transform(
+        packed_output,
+        ::rocprim::make_tee_output_iterator(
+            ::rocprim::make_transform_output_iterator(keys_output,
+                                                      typename packer::unpack_key_op{}),
+            ::rocprim::make_transform_output_iterator(values_output,
+                                                      typename packer::unpack_value_op{})),
+        size,
+        ::rocprim::identity<packed_type>(),
+        stream,
+        debug_synchronous
+    );
+}
+
+// Sorts inputs that are too large for the merge sort, pairs are packed when possible.
+// The packed sort needs its own buffers, so sorts with double buffers are not packed.
+template<
+    class Config,
+    bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class Size
+>
+inline
+auto radix_sort_large_pairs_impl(void * temporary_storage,
+                                 size_t& storage_size,
+                                 KeysInputIterator keys_input,
+                                 typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
+                                 KeysOutputIterator keys_output,
+                                 ValuesInputIterator values_input,
+                                 typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
+                                 ValuesOutputIterator values_output,
+                                 Size size,
+                                 bool& is_result_in_output,
+                                 unsigned int begin_bit,
+                                 unsigned int end_bit,
+                                 hipStream_t stream,
+                                 bool debug_synchronous,
+                                 unsigned int* executed_passes)
+    -> typename std::enable_if<
+        radix_sort_packs_pairs<typename std::iterator_traits<KeysInputIterator>::value_type,
+                               typename std::iterator_traits<ValuesInputIterator>::value_type,
+                               FloatOrder,
+                               Decomposer>::value,
+        hipError_t>::type
+{
+    if(keys_tmp == nullptr)
+    {
+        return radix_sort_packed_pairs_impl<Config, Descending, FloatOrder>(
+            temporary_storage, storage_size,
+            keys_input, keys_output,
+            values_input, values_output,
+            size, is_result_in_output,
+            begin_bit, end_bit,
+            stream, debug_synchronous, executed_passes
+        );
+    }
+    return radix_sort_large_impl<Config, Descending, FloatOrder, Decomposer>(
+        temporary_storage, storage_size,
+        keys_input, keys_tmp, keys_output,
+        values_input, values_tmp, values_output,
+        size, is_result_in_output,
+        begin_bit, end_bit,
+        stream, debug_synchronous, executed_passes
+    );
+}
+
+template<
+    class Config,
+    bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class Size
+>
+inline
+auto radix_sort_large_pairs_impl(void * temporary_storage,
+                                 size_t& storage_size,
+                                 KeysInputIterator keys_input,
+                                 typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
+                                 KeysOutputIterator keys_output,
+                                 ValuesInputIterator values_input,
+                                 typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
+                                 ValuesOutputIterator values_output,
+                                 Size size,
+                                 bool& is_result_in_output,
+                                 unsigned int begin_bit,
+                                 unsigned int end_bit,
+                                 hipStream_t stream,
+                                 bool debug_synchronous,
+                                 unsigned int* executed_passes)
+    -> typename std::enable_if<
+        !radix_sort_packs_pairs<typename std::iterator_traits<KeysInputIterator>::value_type,
+                                typename std::iterator_traits<ValuesInputIterator>::value_type,
+                                FloatOrder,
+                                Decomposer>::value,
+        hipError_t>::type
+{
+    return radix_sort_large_impl<Config, Descending, FloatOrder, Decomposer>(
+        temporary_storage, storage_size,
+        keys_input, keys_tmp, keys_output,
+        values_input, values_tmp, values_output,
+        size, is_result_in_output,
+        begin_bit, end_bit,
+        stream, debug_synchronous, executed_passes
+    );
+}
+
+// Other keys and pairs are not sorted by counting, it is never called
+template<bool Enabled, class Config, bool Descending, class... Args>
+inline
+auto radix_sort_counting_impl(Args&&...)
+    -> typename std::enable_if<!Enabled, hipError_t>::type
+{
+    return hipErrorInvalidValue;
+}
+
+// Counting sort of all bits of keys (see radix_sort_counting_enabled): one pass counts every key
+// value, the counts of at most 64K values are scanned and the sorted keys are written as runs of
+// the values without reading the keys again.
+template<
+    bool Enabled,
+    class Config,
+    bool Descending,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class Size
+>
+inline
+auto radix_sort_counting_impl(void * temporary_storage,
+                              size_t& storage_size,
+                              KeysInputIterator keys_input,
+                              KeysOutputIterator keys_output,
+                              Size size,
+                              bool& is_result_in_output,
+                              hipStream_t stream,
+                              bool debug_synchronous,
+                              unsigned int* executed_passes)
+    -> typename std::enable_if<Enabled, hipError_t>::type
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using offset_type = offset_type_t<Size>;
+
+    constexpr unsigned int bins = 1u << (8 * sizeof(key_type));
+    constexpr unsigned int block_size = Config::sort::block_size;
+    constexpr unsigned int items_per_thread = Config::sort::items_per_thread;
+    constexpr unsigned int items_per_block = block_size * items_per_thread;
+    // Every histogram block processes several tiles to reduce the number of global atomics
+    constexpr unsigned int max_histogram_blocks = 1024;
+
+    const unsigned int blocks
+        = static_cast<unsigned int>(::rocprim::detail::ceiling_div(size, items_per_block));
+    const unsigned int histogram_blocks = apply_grid_limit(std::min(blocks, max_histogram_blocks));
+    const unsigned int write_blocks = apply_grid_limit(blocks);
+
+    size_t scan_storage_size;
+    hipError_t error = ::rocprim::inclusive_scan(nullptr, scan_storage_size,
+                                                 static_cast<offset_type*>(nullptr),
+                                                 static_cast<offset_type*>(nullptr),
+                                                 bins, ::rocprim::plus<offset_type>(),
+                                                 stream, debug_synchronous);
+    if(error != hipSuccess) return error;
+
+    offset_type* counts;
+    offset_type* bin_ends;
+    void*        scan_storage;
+
+    error = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&counts, bins),
+            detail::temp_storage::ptr_aligned_array(&bin_ends, bins),
+            detail::temp_storage::make_partition(&scan_storage, scan_storage_size)));
+    if(error != hipSuccess || temporary_storage == nullptr)
+    {
+        return error;
+    }
+
+    if(executed_passes != nullptr)
+    {
+        *executed_passes = 0;
+    }
+
+    if( size == 0u )
+        return hipSuccess;
+
+    if(debug_synchronous)
+    {
+        std::cout << "bins " << bins << '\n';
+        std::cout << "histogram_blocks " << histogram_blocks << '\n';
+        std::cout << "write_blocks " << write_blocks << '\n';
+        error = hipStreamSynchronize(stream);
+        if(error != hipSuccess) return error;
+    }
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("counting_sort_histogram");
+    error = hipMemsetAsync(counts, 0, sizeof(offset_type) * bins, stream);
+    if(error != hipSuccess) return error;
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(counting_sort_histogram_kernel<block_size, items_per_thread, Descending>),
+        dim3(histogram_blocks), dim3(block_size), 0, stream,
+        keys_input, counts, static_cast<offset_type>(size)
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("counting_sort_histogram", size, start)
+
+    error = ::rocprim::inclusive_scan(scan_storage, scan_storage_size,
+                                      counts, bin_ends,
+                                      bins, ::rocprim::plus<offset_type>(),
+                                      stream, debug_synchronous);
+    if(error != hipSuccess) return error;
+
+    // The input was read by the histogram pass, so the keys can be written in place
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("counting_sort_write_runs");
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(counting_sort_write_runs_kernel<
+            block_size, items_per_thread, Descending, key_type
+        >),
+        dim3(write_blocks), dim3(block_size), 0, stream,
+        bin_ends, keys_output, static_cast<offset_type>(size)
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("counting_sort_write_runs", size, start)
+
+    if(executed_passes != nullptr)
+    {
+        *executed_passes = 1;
+    }
+    const size_t bytes = size_t(size) * sizeof(key_type);
+    record_call_info("radix_sort", "counting", 1, false, bytes, bytes);
+
+    is_result_in_output = true;
+    return hipSuccess;
+}
+
+template<bool Enabled, class Config, bool Descending, radix_float_order FloatOrder,
+         class Decomposer, class... Args>
+inline
+auto radix_sort_cooperative_impl(Args&&...)
+    -> typename std::enable_if<!Enabled, hipError_t>::type
+{
+    return hipErrorInvalidValue;
+}
+
+// Sorts the input with a single launch of sort_cooperative_kernel, all passes are made by the
+// same grid, which is not larger than the number of blocks that are resident at once. Each pass
+// of the iterations algorithm takes four launches, which do not pay off for medium inputs.
+// The kernel is launched cooperatively, so the device must support cooperative launches.
+template<
+    bool Enabled,
+    class Config,
+    bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class Size
+>
+inline
+auto radix_sort_cooperative_impl(void * temporary_storage,
+                                 size_t& storage_size,
+                                 KeysInputIterator keys_input,
+                                 typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
+                                 KeysOutputIterator keys_output,
+                                 ValuesInputIterator values_input,
+                                 typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
+                                 ValuesOutputIterator values_output,
+                                 Size size,
+                                 bool& is_result_in_output,
+                                 unsigned int begin_bit,
+                                 unsigned int end_bit,
+                                 hipStream_t stream,
+                                 bool debug_synchronous,
+                                 unsigned int* executed_passes)
+    -> typename std::enable_if<Enabled, hipError_t>::type
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    using offset_type = offset_type_t<Size>;
+
+    constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+
+    constexpr unsigned int radix_bits = Config::long_radix_bits;
+    constexpr unsigned int radix_size = 1 << radix_bits;
+    constexpr unsigned int block_size = Config::sort::block_size;
+    constexpr unsigned int sort_size = block_size * Config::sort::items_per_thread;
+    // The counts of a digit in all batches are scanned by one block, like scan_batches_kernel
+    constexpr unsigned int max_batches = Config::scan::block_size * Config::scan::items_per_thread;
+    constexpr unsigned int scan_items_per_thread
+        = ::rocprim::detail::ceiling_div(max_batches, block_size);
+
+    const auto kernel = sort_cooperative_kernel<
+        block_size, Config::sort::items_per_thread, radix_bits, scan_items_per_thread,
+        Descending, FloatOrder, Decomposer, radix_sort_scatter_run_length<Config>::value,
+        KeysInputIterator, KeysOutputIterator, ValuesInputIterator, ValuesOutputIterator,
+        offset_type
+    >;
+
+    const bool with_double_buffer = keys_tmp != nullptr;
+
+    offset_type*  batch_digit_counts;
+    offset_type*  digit_counts;
+    unsigned int* barrier_state;
+    unsigned int* device_passes;
+    key_type*     keys_tmp_storage;
+    value_type*   values_tmp_storage;
+
+    hipError_t error = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&batch_digit_counts, max_batches * radix_size),
+            detail::temp_storage::ptr_aligned_array(&digit_counts, radix_size),
+            detail::temp_storage::make_partition(&barrier_state,
+                                                 grid_barrier::get_temp_storage_layout()),
+            detail::temp_storage::ptr_aligned_array(&device_passes, 1),
+            detail::temp_storage::ptr_aligned_array(&keys_tmp_storage,
+                                                    !with_double_buffer ? size : 0),
+            detail::temp_storage::ptr_aligned_array(&values_tmp_storage,
+                                                    !with_double_buffer && with_values ? size
+                                                                                       : 0)));
+    if(error != hipSuccess || temporary_storage == nullptr)
+    {
+        return error;
+    }
+
+    if(executed_passes != nullptr)
+    {
+        *executed_passes = 0;
+    }
+
+    if( size == 0u )
+        return hipSuccess;
+
+    // All blocks wait for each other at the grid barrier, so all of them must be resident
+    device_properties props;
+    error = get_current_device_properties(props);
+    if(error != hipSuccess) return error;
+    int blocks_per_cu;
+    error = hipOccupancyMaxActiveBlocksPerMultiprocessor(&blocks_per_cu, kernel, block_size, 0);
+    if(error != hipSuccess) return error;
+    const unsigned int resident_blocks
+        = apply_grid_limit(::rocprim::max(1u, props.compute_units * blocks_per_cu));
+
+    const unsigned int blocks = static_cast<unsigned int>(::rocprim::detail::ceiling_div(size, sort_size));
+    const unsigned int batch_limit = std::min(max_batches, resident_blocks);
+    const unsigned int blocks_per_full_batch = ::rocprim::detail::ceiling_div(blocks, batch_limit);
+    const unsigned int full_batches = blocks % batch_limit != 0
+        ? blocks % batch_limit
+        : batch_limit;
+    const unsigned int batches = (blocks_per_full_batch == 1 ? full_batches : batch_limit);
+
+    if(!with_double_buffer)
+    {
+        keys_tmp   = keys_tmp_storage;
+        values_tmp = values_tmp_storage;
+    }
+
+    // The result is copied to the output after an odd number of passes into the temporary
+    // buffers, so the first pass goes to the output if the number of passes is odd. An input that
+    // is sorted in place is never written before it is read by the first pass.
+    const unsigned int iterations = ::rocprim::detail::ceiling_div(end_bit - begin_bit, radix_bits);
+    const bool keys_equal = ::rocprim::detail::are_iterators_equal(keys_input, keys_output);
+    const bool values_equal
+        = with_values && ::rocprim::detail::are_iterators_equal(values_input, values_output);
+    const bool first_to_output
+        = with_double_buffer || (iterations % 2 == 1 && !keys_equal && !values_equal);
+
+    if(debug_synchronous)
+    {
+        std::cout << "sort_size " << sort_size << '\n';
+        std::cout << "blocks " << blocks << '\n';
+        std::cout << "resident_blocks " << resident_blocks << '\n';
+        std::cout << "blocks_per_full_batch " << blocks_per_full_batch << '\n';
+        std::cout << "full_batches " << full_batches << '\n';
+        std::cout << "batches " << batches << '\n';
+        std::cout << "iterations " << iterations << '\n';
+        error = hipStreamSynchronize(stream);
+        if(error != hipSuccess) return error;
+    }
+
+    std::chrono::high_resolution_clock::time_point start;
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("sort_cooperative");
+    error = hipMemsetAsync(barrier_state, 0, grid_barrier::get_storage_size(), stream);
+    if(error != hipSuccess) return error;
+    // The blocks wait for each other at the grid barrier. An ordinary launch does not guarantee
+    // that they are all resident (other streams or processes may hold compute units), the
+    // cooperative launch does or fails.
+    offset_type  kernel_size                  = static_cast<offset_type>(size);
+    grid_barrier barrier                      = grid_barrier::create(barrier_state);
+    bool         kernel_first_to_output       = first_to_output;
+    unsigned int kernel_blocks_per_full_batch = blocks_per_full_batch;
+    unsigned int kernel_full_batches          = full_batches;
+    void*        kernel_args[]                = {&keys_input,
+                                                 &keys_tmp,
+                                                 &keys_output,
+                                                 &values_input,
+                                                 &values_tmp,
+                                                 &values_output,
+                                                 &kernel_size,
+                                                 &batch_digit_counts,
+                                                 &digit_counts,
+                                                 &barrier,
+                                                 &device_passes,
+                                                 &kernel_first_to_output,
+                                                 &begin_bit,
+                                                 &end_bit,
+                                                 &kernel_blocks_per_full_batch,
+                                                 &kernel_full_batches};
+    error = hipLaunchCooperativeKernel(kernel,
+                                       dim3(batches),
+                                       dim3(block_size),
+                                       kernel_args,
+                                       0,
+                                       stream);
+    if(error != hipSuccess) return error;
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("sort_cooperative", size, start)
+
+    // The passes are skipped on the device, the host reads their number only if it is asked for.
+    // While the stream is captured to a graph it cannot be read, then all passes are reported.
+    unsigned int passes = iterations;
+    if(executed_passes != nullptr)
+    {
+        bool capturing;
+        error = detail::is_stream_capturing(stream, capturing);
+        if(error != hipSuccess) return error;
+        if(!capturing)
+        {
+            error = detail::memcpy_and_sync(&passes,
+                                            device_passes,
+                                            sizeof(unsigned int),
+                                            hipMemcpyDeviceToHost,
+                                            stream);
+            if(error != hipSuccess) return error;
+        }
+        *executed_passes = passes;
+    }
+
+    const size_t item_bytes  = radix_sort_item_bytes<key_type, value_type>();
+    const size_t moved_bytes = size_t(passes) * size * item_bytes;
+    record_call_info("radix_sort",
+                     "cooperative",
+                     passes,
+                     false,
+                     size_t(iterations) * size * sizeof(key_type) + moved_bytes,
+                     moved_bytes);
+
+    is_result_in_output = true;
+    return hipSuccess;
+}
+
+template<
+    class Config,
+    bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class Size
+>
+inline
+hipError_t radix_sort_config_impl(
+    void*                                                           temporary_storage,
+    size_t&                                                         storage_size,
+    KeysInputIterator                                               keys_input,
+    typename std::iterator_traits<KeysInputIterator>::value_type*   keys_tmp,
+    KeysOutputIterator                                              keys_output,
+    ValuesInputIterator                                             values_input,
+    typename std::iterator_traits<ValuesInputIterator>::value_type* values_tmp,
+    ValuesOutputIterator                                            values_output,
+    Size                                                            size,
+    bool&                                                           is_result_in_output,
+    unsigned int                                                    begin_bit,
+    unsigned int                                                    end_bit,
+    hipStream_t                                                     stream,
+    bool                                                            debug_synchronous,
+    unsigned int*                                                   executed_passes);
+
+template<class ValuesInputIterator, class Index>
+struct radix_sort_gather_op
+{
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+
+    ValuesInputIterator values_input;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    value_type operator()(const Index index) const
+    {
+        return values_input[index];
+    }
+};
+
+// Other values are moved with the keys, it is never called
+template<bool Enabled, class Config, bool Descending, radix_float_order FloatOrder,
+         class Decomposer, class... Args>
+inline
+auto radix_sort_indirect_impl(Args&&...)
+    -> typename std::enable_if<!Enabled, hipError_t>::type
+{
+    return hipErrorInvalidValue;
+}
+
+// Sorts (key, index) pairs and gathers the values once at the end, so large values are read
+// and written once instead of once per iteration. The values of an in-place sort are gathered
+// into a buffer that shares the storage of the sort, and then copied to the output.
+template<
+    bool Enabled,
+    class Config,
+    bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class Size
+>
+inline
+auto radix_sort_indirect_impl(void * temporary_storage,
+                              size_t& storage_size,
+                              KeysInputIterator keys_input,
+                              KeysOutputIterator keys_output,
+                              ValuesInputIterator values_input,
+                              ValuesOutputIterator values_output,
+                              Size size,
+                              bool& is_result_in_output,
+                              unsigned int begin_bit,
+                              unsigned int end_bit,
+                              hipStream_t stream,
+                              bool debug_synchronous,
+                              unsigned int* executed_passes)
+    -> typename std::enable_if<Enabled, hipError_t>::type
+{
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    using index_type = offset_type_t<Size>;
+    using gather_op  = radix_sort_gather_op<ValuesInputIterator, index_type>;
+
+    const ::rocprim::counting_iterator<index_type> indices_input(0);
+    const bool values_equal = ::rocprim::detail::are_iterators_equal(values_input, values_output);
+
+    index_type* indices_output         = nullptr;
+    value_type* values_buffer          = nullptr;
+    void*       sort_temporary_storage = nullptr;
+    size_t      sort_storage_size;
+    bool        ignored;
+
+    hipError_t error = radix_sort_config_impl<Config, Descending, FloatOrder, Decomposer>(
+        nullptr, sort_storage_size,
+        keys_input, nullptr, keys_output,
+        indices_input, nullptr, indices_output,
+        size, ignored,
+        begin_bit, end_bit,
+        stream, debug_synchronous, executed_passes
+    );
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    error = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&indices_output, size),
+            detail::temp_storage::make_union_partition(
+                detail::temp_storage::make_partition(&sort_temporary_storage,
+                                                     sort_storage_size),
+                detail::temp_storage::ptr_aligned_array(&values_buffer,
+                                                        values_equal ? size : 0))));
+    if(error != hipSuccess || temporary_storage == nullptr)
     {
-        hipError_t error = radix_sort_iteration<config, config::short_radix_bits, Descending>(
-            keys_input, keys_tmp, keys_output, values_input, values_tmp, values_output,
-            static_cast<offset_type>(size), batch_digit_counts, digit_counts,
-            from_input, to_output,
-            bit, end_bit,
-            blocks_per_full_batch, full_batches, batches,
-            stream, debug_synchronous
-        );
-        if(error != hipSuccess) return error;
+        return error;
+    }
 
-        is_result_in_output = to_output;
-        from_input = false;
-        to_output = !to_output;
-        bit += config::short_radix_bits;
+    error = radix_sort_config_impl<Config, Descending, FloatOrder, Decomposer>(
+        sort_temporary_storage, sort_storage_size,
+        keys_input, nullptr, keys_output,
+        indices_input, nullptr, indices_output,
+        size, ignored,
+        begin_bit, end_bit,
+        stream, debug_synchronous, executed_passes
+    );
+    if(error != hipSuccess)
+    {
+        return error;
     }
 
-    return hipSuccess;
+    is_result_in_output = true;
+    if(values_equal)
+    {
+        error = ::rocprim::transform(indices_output, values_buffer, size,
+                                     gather_op{values_input},
+                                     stream, debug_synchronous);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        return ::rocprim::transform(values_buffer, values_output, size,
+                                    ::rocprim::identity<value_type>(),
+                                    stream, debug_synchronous);
+    }
+    return ::rocprim::transform(indices_output, values_output, size,
+                                gather_op{values_input},
+                                stream, debug_synchronous);
 }
 
 template<
     class Config,
     bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
     class KeysInputIterator,
     class KeysOutputIterator,
     class ValuesInputIterator,
@@ -648,20 +2707,22 @@ template<
     class Size
 >
 inline
-hipError_t radix_sort_impl(void * temporary_storage,
-                           size_t& storage_size,
-                           KeysInputIterator keys_input,
-                           typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
-                           KeysOutputIterator keys_output,
-                           ValuesInputIterator values_input,
-                           typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
-                           ValuesOutputIterator values_output,
-                           Size size,
-                           bool& is_result_in_output,
-                           unsigned int begin_bit,
-                           unsigned int end_bit,
-                           hipStream_t stream,
-                           bool debug_synchronous)
+hipError_t radix_sort_config_impl(
+    void*                                                           temporary_storage,
+    size_t&                                                         storage_size,
+    KeysInputIterator                                               keys_input,
+    typename std::iterator_traits<KeysInputIterator>::value_type*   keys_tmp,
+    KeysOutputIterator                                              keys_output,
+    ValuesInputIterator                                             values_input,
+    typename std::iterator_traits<ValuesInputIterator>::value_type* values_tmp,
+    ValuesOutputIterator                                            values_output,
+    Size                                                            size,
+    bool&                                                           is_result_in_output,
+    unsigned int                                                    begin_bit,
+    unsigned int                                                    end_bit,
+    hipStream_t                                                     stream,
+    bool                                                            debug_synchronous,
+    unsigned int*                                                   executed_passes)
 {
     using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
     using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
@@ -683,9 +2744,55 @@ hipError_t radix_sort_impl(void * temporary_storage,
     constexpr unsigned int single_sort_limit = config::sort_single::block_size * config::sort_single::items_per_thread;
     constexpr unsigned int merge_sort_limit = config::sort_merge::block_size * config::sort_merge::items_per_thread * config::merge_size_limit_blocks;
 
+    // Inputs that are too large for the merge sort and at most cooperative_size_limit items are
+    // sorted by the single cooperative kernel
+    constexpr unsigned int cooperative_size_limit
+        = radix_sort_cooperative_size_limit<config>::value;
+    constexpr bool cooperative_sort = cooperative_size_limit > merge_sort_limit;
+    // The cooperative kernel needs a cooperative launch, devices without it sort these inputs
+    // like the larger ones
+    bool cooperative_launch = false;
+    if(cooperative_sort && size > merge_sort_limit && size <= cooperative_size_limit)
+    {
+        device_properties props;
+        const hipError_t  error = get_current_device_properties(props);
+        if(error != hipSuccess) return error;
+        cooperative_launch = props.cooperative_launch;
+    }
+
+    // Large values of inputs that are too large for the merge sort are sorted as indices, unless
+    // the double buffer of the values is given
+    constexpr bool indirect_sort
+        = radix_sort_indirect_enabled<config, value_type, offset_type_t<Size>>::value;
+
+    // The single block and merge sorts do not make passes over the whole input
+    if(executed_passes != nullptr && size <= merge_sort_limit)
+    {
+        *executed_passes = 0;
+    }
+
+    // Keys that need more than a single block are sorted by counting if all their bits are sorted
+    constexpr bool counting_sort
+        = radix_sort_counting_enabled<key_type, value_type, Decomposer>::value;
+    if(counting_sort && size > single_sort_limit && begin_bit == 0
+       && end_bit == 8 * sizeof(key_type))
+    {
+        return radix_sort_counting_impl<counting_sort, config, Descending>(
+            temporary_storage,
+            storage_size,
+            keys_input,
+            keys_output,
+            size,
+            is_result_in_output,
+            stream,
+            debug_synchronous,
+            executed_passes
+        );
+    }
+
     if( size <= single_sort_limit )
     {
-        return radix_sort_single_impl<Config, Descending>(
+        return radix_sort_single_impl<Config, Descending, FloatOrder, Decomposer>(
             temporary_storage,
             storage_size,
             keys_input,
@@ -702,7 +2809,7 @@ hipError_t radix_sort_impl(void * temporary_storage,
     }
     else if( size <= merge_sort_limit )
     {
-        return radix_sort_merge_impl<Config, Descending>(
+        return radix_sort_merge_impl<Config, Descending, FloatOrder, Decomposer>(
             temporary_storage,
             storage_size,
             keys_input,
@@ -719,9 +2826,48 @@ hipError_t radix_sort_impl(void * temporary_storage,
             debug_synchronous
         );
     }
+    else if( indirect_sort && keys_tmp == nullptr )
+    {
+        return radix_sort_indirect_impl<indirect_sort, Config, Descending, FloatOrder, Decomposer>(
+            temporary_storage,
+            storage_size,
+            keys_input,
+            keys_output,
+            values_input,
+            values_output,
+            size,
+            is_result_in_output,
+            begin_bit,
+            end_bit,
+            stream,
+            debug_synchronous,
+            executed_passes
+        );
+    }
+    else if( cooperative_sort && cooperative_launch && size <= cooperative_size_limit )
+    {
+        return radix_sort_cooperative_impl<cooperative_sort, config, Descending, FloatOrder,
+                                           Decomposer>(
+            temporary_storage,
+            storage_size,
+            keys_input,
+            keys_tmp,
+            keys_output,
+            values_input,
+            values_tmp,
+            values_output,
+            size,
+            is_result_in_output,
+            begin_bit,
+            end_bit,
+            stream,
+            debug_synchronous,
+            executed_passes
+        );
+    }
     else
     {
-        return radix_sort_iterations_impl<Config, Descending>(
+        return radix_sort_large_pairs_impl<config, Descending, FloatOrder, Decomposer>(
             temporary_storage,
             storage_size,
             keys_input,
@@ -735,11 +2881,145 @@ hipError_t radix_sort_impl(void * temporary_storage,
             begin_bit,
             end_bit,
             stream,
-            debug_synchronous
+            debug_synchronous,
+            executed_passes
         );
     }
 }
 
+// Resolves the bucket of size_bucketed_config
+template<
+    class Config,
+    bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class Size
+>
+inline
+hipError_t radix_sort_impl(void * temporary_storage,
+                           size_t& storage_size,
+                           KeysInputIterator keys_input,
+                           typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
+                           KeysOutputIterator keys_output,
+                           ValuesInputIterator values_input,
+                           typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
+                           ValuesOutputIterator values_output,
+                           Size size,
+                           bool& is_result_in_output,
+                           unsigned int begin_bit,
+                           unsigned int end_bit,
+                           hipStream_t stream,
+                           bool debug_synchronous,
+                           unsigned int* executed_passes = nullptr)
+{
+    return dispatch_size_bucket<Config>(
+        static_cast<size_t>(size),
+        [&](auto config)
+        {
+            return radix_sort_config_impl<decltype(config), Descending, FloatOrder, Decomposer>(
+                temporary_storage,
+                storage_size,
+                keys_input,
+                keys_tmp,
+                keys_output,
+                values_input,
+                values_tmp,
+                values_output,
+                size,
+                is_result_in_output,
+                begin_bit,
+                end_bit,
+                stream,
+                debug_synchronous,
+                executed_passes);
+        });
+}
+
+// The size of the temporary storage of the (non-bucketed) Config for size keys, queried like
+// radix_sort_keys and radix_sort_pairs do without the double buffer
+template<class Config,
+         radix_float_order FloatOrder,
+         class Key,
+         class Value>
+inline size_t radix_sort_storage_size(const size_t size, const unsigned int end_bit)
+{
+    size_t storage_size = 0;
+    bool   ignored;
+    radix_sort_config_impl<Config, false, FloatOrder, identity_decomposer>(
+        nullptr, storage_size,
+        static_cast<Key*>(nullptr), nullptr, static_cast<Key*>(nullptr),
+        static_cast<Value*>(nullptr), nullptr, static_cast<Value*>(nullptr),
+        size, ignored,
+        0, end_bit,
+        0, false, nullptr
+    );
+    return storage_size;
+}
+
+// The storage of every path of the sort grows with the size, so within a bucket the largest
+// storage is needed by the largest size, or by the largest size of a path with a smaller limit.
+// Keys sorted by counting use other paths when not all bits are sorted, and only float keys
+// are packed with their values differently for the total order.
+template<class Key, class Value>
+struct radix_sort_storage_bound_op
+{
+    using second_order_type = std::integral_constant<radix_float_order,
+                                                     ::rocprim::is_floating_point<Key>::value
+                                                         ? radix_float_order::total_order
+                                                         : radix_float_order::signed_zeros_equal>;
+
+    size_t& bound;
+
+    template<class BucketConfig>
+    void operator()(BucketConfig, const size_t first_size, const size_t last_size) const
+    {
+        using config = default_or_custom_config<
+            BucketConfig,
+            default_radix_sort_config<ROCPRIM_TARGET_ARCH, Key, Value>>;
+
+        const size_t limits[] = {
+            size_t(config::sort_single::block_size) * config::sort_single::items_per_thread,
+            size_t(config::sort_merge::block_size) * config::sort_merge::items_per_thread
+                * config::merge_size_limit_blocks,
+            radix_sort_cooperative_size_limit<config>::value,
+            last_size,
+        };
+        for(const size_t limit : limits)
+        {
+            if(limit < first_size)
+            {
+                continue;
+            }
+            const size_t size = std::min(limit, last_size);
+            for(const unsigned int end_bit : {8u * sizeof(Key), 8u * sizeof(Key) - 1})
+            {
+                bound = std::max(
+                    {bound,
+                     radix_sort_storage_size<BucketConfig,
+                                             radix_float_order::signed_zeros_equal,
+                                             Key,
+                                             Value>(size, end_bit),
+                     radix_sort_storage_size<BucketConfig,
+                                             second_order_type::value,
+                                             Key,
+                                             Value>(size, end_bit)});
+            }
+        }
+    }
+};
+
+template<class Config, class Key, class Value>
+inline size_t radix_sort_storage_bound(const size_t max_size)
+{
+    size_t bound = 0;
+    size_bucket_for_each<Config>::run(0, max_size, radix_sort_storage_bound_op<Key, Value>{bound});
+    return bound;
+}
+
 #undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
 
 } // end namespace detail
@@ -762,6 +3042,8 @@ hipError_t radix_sort_impl(void * temporary_storage,
 ///
 /// \tparam Config - [optional] configuration of the primitive. It can be \p radix_sort_config or
 /// a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
 /// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
@@ -784,6 +3066,11 @@ hipError_t radix_sort_impl(void * temporary_storage,
 /// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
 /// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
 /// launch is forced in order to check for errors. Default value is \p false.
+/// \param [out] executed_passes - [optional] if not null, the number of passes over the keys
+/// is written here. Passes of digits that are the same for all keys are skipped, finding them
+/// synchronizes \p stream once. Inputs small enough to be sorted by single-block and merge
+/// sorts make no passes and report \p 0, as do sorted and strictly reverse sorted inputs when
+/// the configuration checks the order of the input (\p radix_sort_config::check_sorted_input).
 ///
 /// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
 /// type \p hipError_t.
@@ -822,12 +3109,13 @@ hipError_t radix_sort_impl(void * temporary_storage,
 /// \endparblock
 template<
     class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
     class KeysInputIterator,
     class KeysOutputIterator,
     class Size,
     class Key = typename std::iterator_traits<KeysInputIterator>::value_type
 >
-inline
+// Not inline, see detail/device_instantiations.hpp
 hipError_t radix_sort_keys(void * temporary_storage,
                            size_t& storage_size,
                            KeysInputIterator keys_input,
@@ -836,18 +3124,19 @@ hipError_t radix_sort_keys(void * temporary_storage,
                            unsigned int begin_bit = 0,
                            unsigned int end_bit = 8 * sizeof(Key),
                            hipStream_t stream = 0,
-                           bool debug_synchronous = false)
+                           bool debug_synchronous = false,
+                           unsigned int* executed_passes = nullptr)
 {
     static_assert(std::is_integral<Size>::value, "Size must be an integral type.");
     empty_type * values = nullptr;
     bool ignored;
-    return detail::radix_sort_impl<Config, false>(
+    return detail::radix_sort_impl<Config, false, FloatOrder, identity_decomposer>(
         temporary_storage, storage_size,
         keys_input, nullptr, keys_output,
         values, nullptr, values,
         size, ignored,
         begin_bit, end_bit,
-        stream, debug_synchronous
+        stream, debug_synchronous, executed_passes
     );
 }
 
@@ -869,6 +3158,8 @@ hipError_t radix_sort_keys(void * temporary_storage,
 ///
 /// \tparam Config - [optional] configuration of the primitive. It can be \p radix_sort_config or
 /// a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
 /// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
@@ -891,6 +3182,11 @@ hipError_t radix_sort_keys(void * temporary_storage,
 /// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
 /// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
 /// launch is forced in order to check for errors. Default value is \p false.
+/// \param [out] executed_passes - [optional] if not null, the number of passes over the keys
+/// is written here. Passes of digits that are the same for all keys are skipped, finding them
+/// synchronizes \p stream once. Inputs small enough to be sorted by single-block and merge
+/// sorts make no passes and report \p 0, as do sorted and strictly reverse sorted inputs when
+/// the configuration checks the order of the input (\p radix_sort_config::check_sorted_input).
 ///
 /// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
 /// type \p hipError_t.
@@ -929,6 +3225,7 @@ hipError_t radix_sort_keys(void * temporary_storage,
 /// \endparblock
 template<
     class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
     class KeysInputIterator,
     class KeysOutputIterator,
     class Size,
@@ -943,18 +3240,19 @@ hipError_t radix_sort_keys_desc(void * temporary_storage,
                                 unsigned int begin_bit = 0,
                                 unsigned int end_bit = 8 * sizeof(Key),
                                 hipStream_t stream = 0,
-                                bool debug_synchronous = false)
+                                bool debug_synchronous = false,
+                                unsigned int* executed_passes = nullptr)
 {
     static_assert(std::is_integral<Size>::value, "Size must be an integral type.");
     empty_type * values = nullptr;
     bool ignored;
-    return detail::radix_sort_impl<Config, true>(
+    return detail::radix_sort_impl<Config, true, FloatOrder, identity_decomposer>(
         temporary_storage, storage_size,
         keys_input, nullptr, keys_output,
         values, nullptr, values,
         size, ignored,
         begin_bit, end_bit,
-        stream, debug_synchronous
+        stream, debug_synchronous, executed_passes
     );
 }
 
@@ -974,9 +3272,18 @@ hipError_t radix_sort_keys_desc(void * temporary_storage,
 /// * If \p Key is an integer type and the range of keys is known in advance, the performance
 /// can be improved by setting \p begin_bit and \p end_bit, for example if all keys are in range
 /// [100, 10000], <tt>begin_bit = 0</tt> and <tt>end_bit = 14</tt> will cover the whole range.
+/// * Large inputs of keys and values of at most 32 bits each are sorted as 64-bit words which
+/// contain both the key and the value, so every pass scatters one array instead of two.
+/// Floating-point keys are packed only with \p radix_float_order::total_order. The packed sort
+/// requires a temporary buffer of <tt>2 * size</tt> words.
+/// * Values larger than \p IndirectValueSizeThreshold of \p radix_sort_config (16 bytes by
+/// default) of large inputs are not moved by every pass: (key, index) pairs are sorted and the
+/// values are gathered once by their sorted indices.
 ///
 /// \tparam Config - [optional] configuration of the primitive. It can be \p radix_sort_config or
 /// a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
 /// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
@@ -1005,6 +3312,11 @@ hipError_t radix_sort_keys_desc(void * temporary_storage,
 /// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
 /// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
 /// launch is forced in order to check for errors. Default value is \p false.
+/// \param [out] executed_passes - [optional] if not null, the number of passes over the keys
+/// is written here. Passes of digits that are the same for all keys are skipped, finding them
+/// synchronizes \p stream once. Inputs small enough to be sorted by single-block and merge
+/// sorts make no passes and report \p 0, as do sorted and strictly reverse sorted inputs when
+/// the configuration checks the order of the input (\p radix_sort_config::check_sorted_input).
 ///
 /// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
 /// type \p hipError_t.
@@ -1052,6 +3364,7 @@ hipError_t radix_sort_keys_desc(void * temporary_storage,
 /// \endparblock
 template<
     class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
     class KeysInputIterator,
     class KeysOutputIterator,
     class ValuesInputIterator,
@@ -1059,7 +3372,7 @@ template<
     class Size,
     class Key = typename std::iterator_traits<KeysInputIterator>::value_type
 >
-inline
+// Not inline, see detail/device_instantiations.hpp
 hipError_t radix_sort_pairs(void * temporary_storage,
                             size_t& storage_size,
                             KeysInputIterator keys_input,
@@ -1070,17 +3383,18 @@ hipError_t radix_sort_pairs(void * temporary_storage,
                             unsigned int begin_bit = 0,
                             unsigned int end_bit = 8 * sizeof(Key),
                             hipStream_t stream = 0,
-                            bool debug_synchronous = false)
+                            bool debug_synchronous = false,
+                            unsigned int* executed_passes = nullptr)
 {
     static_assert(std::is_integral<Size>::value, "Size must be an integral type.");
     bool ignored;
-    return detail::radix_sort_impl<Config, false>(
+    return detail::radix_sort_impl<Config, false, FloatOrder, identity_decomposer>(
         temporary_storage, storage_size,
         keys_input, nullptr, keys_output,
         values_input, nullptr, values_output,
         size, ignored,
         begin_bit, end_bit,
-        stream, debug_synchronous
+        stream, debug_synchronous, executed_passes
     );
 }
 
@@ -1100,9 +3414,18 @@ hipError_t radix_sort_pairs(void * temporary_storage,
 /// * If \p Key is an integer type and the range of keys is known in advance, the performance
 /// can be improved by setting \p begin_bit and \p end_bit, for example if all keys are in range
 /// [100, 10000], <tt>begin_bit = 0</tt> and <tt>end_bit = 14</tt> will cover the whole range.
+/// * Large inputs of keys and values of at most 32 bits each are sorted as 64-bit words which
+/// contain both the key and the value, so every pass scatters one array instead of two.
+/// Floating-point keys are packed only with \p radix_float_order::total_order. The packed sort
+/// requires a temporary buffer of <tt>2 * size</tt> words.
+/// * Values larger than \p IndirectValueSizeThreshold of \p radix_sort_config (16 bytes by
+/// default) of large inputs are not moved by every pass: (key, index) pairs are sorted and the
+/// values are gathered once by their sorted indices.
 ///
 /// \tparam Config - [optional] configuration of the primitive. It can be \p radix_sort_config or
 /// a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
 /// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
@@ -1131,6 +3454,11 @@ hipError_t radix_sort_pairs(void * temporary_storage,
 /// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
 /// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
 /// launch is forced in order to check for errors. Default value is \p false.
+/// \param [out] executed_passes - [optional] if not null, the number of passes over the keys
+/// is written here. Passes of digits that are the same for all keys are skipped, finding them
+/// synchronizes \p stream once. Inputs small enough to be sorted by single-block and merge
+/// sorts make no passes and report \p 0, as do sorted and strictly reverse sorted inputs when
+/// the configuration checks the order of the input (\p radix_sort_config::check_sorted_input).
 ///
 /// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
 /// type \p hipError_t.
@@ -1162,47 +3490,209 @@ hipError_t radix_sort_pairs(void * temporary_storage,
 /// // allocate temporary storage
 /// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
 ///
-/// // perform sort
-/// rocprim::radix_sort_pairs_desc(
-///     temporary_storage_ptr, temporary_storage_size_bytes,
-///     keys_input, keys_output, values_input, values_output,
-///     input_size
-/// );
-/// // keys_output:   [ 8, 7,  6,  5, 4, 3,  1,  1]
-/// // values_output: [-8, 7, -5, -4, 3, 2, -1, -2]
-/// \endcode
-/// \endparblock
+/// // perform sort
+/// rocprim::radix_sort_pairs_desc(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input, keys_output, values_input, values_output,
+///     input_size
+/// );
+/// // keys_output:   [ 8, 7,  6,  5, 4, 3,  1,  1]
+/// // values_output: [-8, 7, -5, -4, 3, 2, -1, -2]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class Size,
+    class Key = typename std::iterator_traits<KeysInputIterator>::value_type
+>
+inline
+hipError_t radix_sort_pairs_desc(void * temporary_storage,
+                                 size_t& storage_size,
+                                 KeysInputIterator keys_input,
+                                 KeysOutputIterator keys_output,
+                                 ValuesInputIterator values_input,
+                                 ValuesOutputIterator values_output,
+                                 Size size,
+                                 unsigned int begin_bit = 0,
+                                 unsigned int end_bit = 8 * sizeof(Key),
+                                 hipStream_t stream = 0,
+                                 bool debug_synchronous = false,
+                                 unsigned int* executed_passes = nullptr)
+{
+    static_assert(std::is_integral<Size>::value, "Size must be an integral type.");
+    bool ignored;
+    return detail::radix_sort_impl<Config, true, FloatOrder, identity_decomposer>(
+        temporary_storage, storage_size,
+        keys_input, nullptr, keys_output,
+        values_input, nullptr, values_output,
+        size, ignored,
+        begin_bit, end_bit,
+        stream, debug_synchronous, executed_passes
+    );
+}
+
+/// \brief Parallel ascending radix argsort primitive for device level.
+///
+/// \p radix_sort_argsort function performs a device-wide radix sort of keys and writes the
+/// sorting permutation, the indices of the input keys in the sorted order, to \p indices_output.
+///
+/// \par Overview
+/// * The indices are generated while the keys are loaded, an index array does not have to be
+/// allocated, filled and read by the first pass. Keys with equal values keep the order of
+/// their indices.
+/// * The sorted keys are written to \p keys_output, which is also used as a buffer of
+/// the sort passes.
+/// * The contents of the inputs are not altered by the sorting function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * \p Key type (a \p value_type of \p KeysInputIterator and \p KeysOutputIterator) must be
+/// an arithmetic type (that is, an integral type or a floating-point type).
+/// * The \p value_type of \p IndicesOutputIterator must be an integral type that can represent
+/// <tt>size - 1</tt>.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p radix_sort_config or
+/// a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam IndicesOutputIterator - random-access iterator type of the output range of indices.
+/// Must meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam Size - integral type that represents the problem size.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [out] indices_output - pointer to the first element in the output range of indices.
+/// \param [in] size - number of element in the input range.
+/// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+/// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+/// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+/// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+/// value: \p <tt>8 * sizeof(Key)</tt>.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+/// \param [out] executed_passes - [optional] if not null, the number of passes over the keys
+/// is written here, see \p radix_sort_pairs.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;             // e.g., 8
+/// int * keys_input;              // e.g., [ 6, 3, 5, 4, 1, 8, 1, 7]
+/// int * keys_output;             // empty array of 8 elements
+/// unsigned int * indices_output; // empty array of 8 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::radix_sort_argsort(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input, keys_output, indices_output, input_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform sort
+/// rocprim::radix_sort_argsort(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input, keys_output, indices_output, input_size
+/// );
+/// // keys_output:    [1, 1, 3, 4, 5, 6, 7, 8]
+/// // indices_output: [4, 6, 1, 3, 2, 0, 7, 5]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class IndicesOutputIterator,
+    class Size,
+    class Key = typename std::iterator_traits<KeysInputIterator>::value_type
+>
+inline
+hipError_t radix_sort_argsort(void * temporary_storage,
+                              size_t& storage_size,
+                              KeysInputIterator keys_input,
+                              KeysOutputIterator keys_output,
+                              IndicesOutputIterator indices_output,
+                              Size size,
+                              unsigned int begin_bit = 0,
+                              unsigned int end_bit = 8 * sizeof(Key),
+                              hipStream_t stream = 0,
+                              bool debug_synchronous = false,
+                              unsigned int* executed_passes = nullptr)
+{
+    static_assert(std::is_integral<Size>::value, "Size must be an integral type.");
+    using index_type = typename std::iterator_traits<IndicesOutputIterator>::value_type;
+    static_assert(std::is_integral<index_type>::value, "Indices must be of an integral type.");
+    bool ignored;
+    return detail::radix_sort_impl<Config, false, FloatOrder, identity_decomposer>(
+        temporary_storage, storage_size,
+        keys_input, nullptr, keys_output,
+        ::rocprim::counting_iterator<index_type>(0), nullptr, indices_output,
+        size, ignored,
+        begin_bit, end_bit,
+        stream, debug_synchronous, executed_passes
+    );
+}
+
+/// \brief Parallel descending radix argsort primitive for device level.
+///
+/// \p radix_sort_argsort_desc function performs a device-wide radix sort of keys in descending
+/// order and writes the sorting permutation to \p indices_output, see \p radix_sort_argsort.
+/// Keys with equal values keep the order of their indices.
 template<
     class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
     class KeysInputIterator,
     class KeysOutputIterator,
-    class ValuesInputIterator,
-    class ValuesOutputIterator,
+    class IndicesOutputIterator,
     class Size,
     class Key = typename std::iterator_traits<KeysInputIterator>::value_type
 >
 inline
-hipError_t radix_sort_pairs_desc(void * temporary_storage,
-                                 size_t& storage_size,
-                                 KeysInputIterator keys_input,
-                                 KeysOutputIterator keys_output,
-                                 ValuesInputIterator values_input,
-                                 ValuesOutputIterator values_output,
-                                 Size size,
-                                 unsigned int begin_bit = 0,
-                                 unsigned int end_bit = 8 * sizeof(Key),
-                                 hipStream_t stream = 0,
-                                 bool debug_synchronous = false)
+hipError_t radix_sort_argsort_desc(void * temporary_storage,
+                                   size_t& storage_size,
+                                   KeysInputIterator keys_input,
+                                   KeysOutputIterator keys_output,
+                                   IndicesOutputIterator indices_output,
+                                   Size size,
+                                   unsigned int begin_bit = 0,
+                                   unsigned int end_bit = 8 * sizeof(Key),
+                                   hipStream_t stream = 0,
+                                   bool debug_synchronous = false,
+                                   unsigned int* executed_passes = nullptr)
 {
     static_assert(std::is_integral<Size>::value, "Size must be an integral type.");
+    using index_type = typename std::iterator_traits<IndicesOutputIterator>::value_type;
+    static_assert(std::is_integral<index_type>::value, "Indices must be of an integral type.");
     bool ignored;
-    return detail::radix_sort_impl<Config, true>(
+    return detail::radix_sort_impl<Config, true, FloatOrder, identity_decomposer>(
         temporary_storage, storage_size,
         keys_input, nullptr, keys_output,
-        values_input, nullptr, values_output,
+        ::rocprim::counting_iterator<index_type>(0), nullptr, indices_output,
         size, ignored,
         begin_bit, end_bit,
-        stream, debug_synchronous
+        stream, debug_synchronous, executed_passes
     );
 }
 
@@ -1229,6 +3719,8 @@ hipError_t radix_sort_pairs_desc(void * temporary_storage,
 ///
 /// \tparam Config - [optional] configuration of the primitive. It can be \p radix_sort_config or
 /// a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
 /// \tparam Key - key type. Must be an integral type or a floating-point type.
 /// \tparam Size - integral type that represents the problem size.
 ///
@@ -1248,6 +3740,11 @@ hipError_t radix_sort_pairs_desc(void * temporary_storage,
 /// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
 /// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
 /// launch is forced in order to check for errors. Default value is \p false.
+/// \param [out] executed_passes - [optional] if not null, the number of passes over the keys
+/// is written here. Passes of digits that are the same for all keys are skipped, finding them
+/// synchronizes \p stream once. Inputs small enough to be sorted by single-block and merge
+/// sorts make no passes and report \p 0, as do sorted and strictly reverse sorted inputs when
+/// the configuration checks the order of the input (\p radix_sort_config::check_sorted_input).
 ///
 /// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
 /// type \p hipError_t.
@@ -1288,6 +3785,7 @@ hipError_t radix_sort_pairs_desc(void * temporary_storage,
 /// \endparblock
 template<
     class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
     class Key,
     class Size
 >
@@ -1299,18 +3797,19 @@ hipError_t radix_sort_keys(void * temporary_storage,
                            unsigned int begin_bit = 0,
                            unsigned int end_bit = 8 * sizeof(Key),
                            hipStream_t stream = 0,
-                           bool debug_synchronous = false)
+                           bool debug_synchronous = false,
+                           unsigned int* executed_passes = nullptr)
 {
     static_assert(std::is_integral<Size>::value, "Size must be an integral type.");
     empty_type * values = nullptr;
     bool is_result_in_output;
-    hipError_t error = detail::radix_sort_impl<Config, false>(
+    hipError_t error = detail::radix_sort_impl<Config, false, FloatOrder, identity_decomposer>(
         temporary_storage, storage_size,
         keys.current(), keys.current(), keys.alternate(),
         values, values, values,
         size, is_result_in_output,
         begin_bit, end_bit,
-        stream, debug_synchronous
+        stream, debug_synchronous, executed_passes
     );
     if(temporary_storage != nullptr && is_result_in_output)
     {
@@ -1342,6 +3841,8 @@ hipError_t radix_sort_keys(void * temporary_storage,
 ///
 /// \tparam Config - [optional] configuration of the primitive. It can be \p radix_sort_config or
 /// a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
 /// \tparam Key - key type. Must be an integral type or a floating-point type.
 /// \tparam Size - integral type that represents the problem size.
 ///
@@ -1361,6 +3862,11 @@ hipError_t radix_sort_keys(void * temporary_storage,
 /// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
 /// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
 /// launch is forced in order to check for errors. Default value is \p false.
+/// \param [out] executed_passes - [optional] if not null, the number of passes over the keys
+/// is written here. Passes of digits that are the same for all keys are skipped, finding them
+/// synchronizes \p stream once. Inputs small enough to be sorted by single-block and merge
+/// sorts make no passes and report \p 0, as do sorted and strictly reverse sorted inputs when
+/// the configuration checks the order of the input (\p radix_sort_config::check_sorted_input).
 ///
 /// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
 /// type \p hipError_t.
@@ -1401,6 +3907,7 @@ hipError_t radix_sort_keys(void * temporary_storage,
 /// \endparblock
 template<
     class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
     class Key,
     class Size
 >
@@ -1412,18 +3919,19 @@ hipError_t radix_sort_keys_desc(void * temporary_storage,
                                 unsigned int begin_bit = 0,
                                 unsigned int end_bit = 8 * sizeof(Key),
                                 hipStream_t stream = 0,
-                                bool debug_synchronous = false)
+                                bool debug_synchronous = false,
+                                unsigned int* executed_passes = nullptr)
 {
     static_assert(std::is_integral<Size>::value, "Size must be an integral type.");
     empty_type * values = nullptr;
     bool is_result_in_output;
-    hipError_t error = detail::radix_sort_impl<Config, true>(
+    hipError_t error = detail::radix_sort_impl<Config, true, FloatOrder, identity_decomposer>(
         temporary_storage, storage_size,
         keys.current(), keys.current(), keys.alternate(),
         values, values, values,
         size, is_result_in_output,
         begin_bit, end_bit,
-        stream, debug_synchronous
+        stream, debug_synchronous, executed_passes
     );
     if(temporary_storage != nullptr && is_result_in_output)
     {
@@ -1455,6 +3963,8 @@ hipError_t radix_sort_keys_desc(void * temporary_storage,
 ///
 /// \tparam Config - [optional] configuration of the primitive. It can be \p radix_sort_config or
 /// a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
 /// \tparam Key - key type. Must be an integral type or a floating-point type.
 /// \tparam Value - value type.
 /// \tparam Size - integral type that represents the problem size.
@@ -1477,6 +3987,11 @@ hipError_t radix_sort_keys_desc(void * temporary_storage,
 /// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
 /// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
 /// launch is forced in order to check for errors. Default value is \p false.
+/// \param [out] executed_passes - [optional] if not null, the number of passes over the keys
+/// is written here. Passes of digits that are the same for all keys are skipped, finding them
+/// synchronizes \p stream once. Inputs small enough to be sorted by single-block and merge
+/// sorts make no passes and report \p 0, as do sorted and strictly reverse sorted inputs when
+/// the configuration checks the order of the input (\p radix_sort_config::check_sorted_input).
 ///
 /// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
 /// type \p hipError_t.
@@ -1527,6 +4042,7 @@ hipError_t radix_sort_keys_desc(void * temporary_storage,
 /// \endparblock
 template<
     class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
     class Key,
     class Value,
     class Size
@@ -1540,17 +4056,18 @@ hipError_t radix_sort_pairs(void * temporary_storage,
                             unsigned int begin_bit = 0,
                             unsigned int end_bit = 8 * sizeof(Key),
                             hipStream_t stream = 0,
-                            bool debug_synchronous = false)
+                            bool debug_synchronous = false,
+                            unsigned int* executed_passes = nullptr)
 {
     static_assert(std::is_integral<Size>::value, "Size must be an integral type.");
     bool is_result_in_output;
-    hipError_t error = detail::radix_sort_impl<Config, false>(
+    hipError_t error = detail::radix_sort_impl<Config, false, FloatOrder, identity_decomposer>(
         temporary_storage, storage_size,
         keys.current(), keys.current(), keys.alternate(),
         values.current(), values.current(), values.alternate(),
         size, is_result_in_output,
         begin_bit, end_bit,
-        stream, debug_synchronous
+        stream, debug_synchronous, executed_passes
     );
     if(temporary_storage != nullptr && is_result_in_output)
     {
@@ -1583,6 +4100,8 @@ hipError_t radix_sort_pairs(void * temporary_storage,
 ///
 /// \tparam Config - [optional] configuration of the primitive. It can be \p radix_sort_config or
 /// a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
 /// \tparam Key - key type. Must be an integral type or a floating-point type.
 /// \tparam Value - value type.
 /// \tparam Size - integral type that represents the problem size.
@@ -1605,6 +4124,11 @@ hipError_t radix_sort_pairs(void * temporary_storage,
 /// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
 /// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
 /// launch is forced in order to check for errors. Default value is \p false.
+/// \param [out] executed_passes - [optional] if not null, the number of passes over the keys
+/// is written here. Passes of digits that are the same for all keys are skipped, finding them
+/// synchronizes \p stream once. Inputs small enough to be sorted by single-block and merge
+/// sorts make no passes and report \p 0, as do sorted and strictly reverse sorted inputs when
+/// the configuration checks the order of the input (\p radix_sort_config::check_sorted_input).
 ///
 /// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
 /// type \p hipError_t.
@@ -1649,6 +4173,7 @@ hipError_t radix_sort_pairs(void * temporary_storage,
 /// \endparblock
 template<
     class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
     class Key,
     class Value,
     class Size
@@ -1662,17 +4187,18 @@ hipError_t radix_sort_pairs_desc(void * temporary_storage,
                                  unsigned int begin_bit = 0,
                                  unsigned int end_bit = 8 * sizeof(Key),
                                  hipStream_t stream = 0,
-                                 bool debug_synchronous = false)
+                                 bool debug_synchronous = false,
+                                 unsigned int* executed_passes = nullptr)
 {
     static_assert(std::is_integral<Size>::value, "Size must be an integral type.");
     bool is_result_in_output;
-    hipError_t error = detail::radix_sort_impl<Config, true>(
+    hipError_t error = detail::radix_sort_impl<Config, true, FloatOrder, identity_decomposer>(
         temporary_storage, storage_size,
         keys.current(), keys.current(), keys.alternate(),
         values.current(), values.current(), values.alternate(),
         size, is_result_in_output,
         begin_bit, end_bit,
-        stream, debug_synchronous
+        stream, debug_synchronous, executed_passes
     );
     if(temporary_storage != nullptr && is_result_in_output)
     {
@@ -1682,6 +4208,399 @@ hipError_t radix_sort_pairs_desc(void * temporary_storage,
     return error;
 }
 
+/// \brief Parallel ascending radix sort primitive for device level, for keys that are
+/// decomposed into their fields.
+///
+/// \p radix_sort_keys function performs a device-wide radix sort of keys.
+/// Keys are ordered by the fields returned by \p decomposer in ascending order, the first field
+/// is the most significant one. This overload sorts all bits of the fields.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the sorting function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * \p decomposer must be a default-constructible class, see \p identity_decomposer. It is
+/// constructed again in device code, so it must not hold any state.
+/// * Ranges specified by \p keys_input and \p keys_output must have at least \p size elements.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p radix_sort_config or
+/// a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point fields, see \p radix_float_order.
+/// \tparam Decomposer - type of the decomposer of keys into their fields.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] decomposer - decomposer of keys into a \p rocprim::tuple of references to their fields.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+/// \param [out] executed_passes - [optional] if not null, the number of passes over the keys
+/// is written here. Passes of digits that are the same for all keys are skipped, finding them
+/// synchronizes \p stream once. Inputs small enough to be sorted by single-block and merge
+/// sorts make no passes and report \p 0, as do sorted and strictly reverse sorted inputs when
+/// the configuration checks the order of the input (\p radix_sort_config::check_sorted_input).
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class Size,
+    class Decomposer,
+    class Key = typename std::iterator_traits<KeysInputIterator>::value_type
+>
+inline
+auto radix_sort_keys(void * temporary_storage,
+                     size_t& storage_size,
+                     KeysInputIterator keys_input,
+                     KeysOutputIterator keys_output,
+                     Size size,
+                     Decomposer decomposer,
+                     hipStream_t stream = 0,
+                     bool debug_synchronous = false,
+                     unsigned int* executed_passes = nullptr)
+    -> typename std::enable_if<!std::is_integral<Decomposer>::value, hipError_t>::type
+{
+    static_assert(std::is_integral<Size>::value, "Size must be an integral type.");
+    // The decomposer is stateless, it is constructed again in device code
+    (void)decomposer;
+    empty_type * values = nullptr;
+    bool ignored;
+    return detail::radix_sort_impl<Config, false, FloatOrder, Decomposer>(
+        temporary_storage, storage_size,
+        keys_input, nullptr, keys_output,
+        values, nullptr, values,
+        size, ignored,
+        0, detail::radix_key_codec<Key, false, FloatOrder, Decomposer>::key_bits,
+        stream, debug_synchronous, executed_passes
+    );
+}
+
+/// \brief Parallel descending radix sort primitive for device level, for keys that are
+/// decomposed into their fields.
+///
+/// \p radix_sort_keys_desc function performs a device-wide radix sort of keys.
+/// Keys are ordered by the fields returned by \p decomposer in descending order, the first field
+/// is the most significant one. This overload sorts all bits of the fields.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the sorting function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * \p decomposer must be a default-constructible class, see \p identity_decomposer. It is
+/// constructed again in device code, so it must not hold any state.
+/// * Ranges specified by \p keys_input and \p keys_output must have at least \p size elements.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p radix_sort_config or
+/// a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point fields, see \p radix_float_order.
+/// \tparam Decomposer - type of the decomposer of keys into their fields.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] decomposer - decomposer of keys into a \p rocprim::tuple of references to their fields.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+/// \param [out] executed_passes - [optional] if not null, the number of passes over the keys
+/// is written here. Passes of digits that are the same for all keys are skipped, finding them
+/// synchronizes \p stream once. Inputs small enough to be sorted by single-block and merge
+/// sorts make no passes and report \p 0, as do sorted and strictly reverse sorted inputs when
+/// the configuration checks the order of the input (\p radix_sort_config::check_sorted_input).
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class Size,
+    class Decomposer,
+    class Key = typename std::iterator_traits<KeysInputIterator>::value_type
+>
+inline
+auto radix_sort_keys_desc(void * temporary_storage,
+                          size_t& storage_size,
+                          KeysInputIterator keys_input,
+                          KeysOutputIterator keys_output,
+                          Size size,
+                          Decomposer decomposer,
+                          hipStream_t stream = 0,
+                          bool debug_synchronous = false,
+                          unsigned int* executed_passes = nullptr)
+    -> typename std::enable_if<!std::is_integral<Decomposer>::value, hipError_t>::type
+{
+    static_assert(std::is_integral<Size>::value, "Size must be an integral type.");
+    // The decomposer is stateless, it is constructed again in device code
+    (void)decomposer;
+    empty_type * values = nullptr;
+    bool ignored;
+    return detail::radix_sort_impl<Config, true, FloatOrder, Decomposer>(
+        temporary_storage, storage_size,
+        keys_input, nullptr, keys_output,
+        values, nullptr, values,
+        size, ignored,
+        0, detail::radix_key_codec<Key, false, FloatOrder, Decomposer>::key_bits,
+        stream, debug_synchronous, executed_passes
+    );
+}
+
+/// \brief Parallel ascending radix sort-by-key primitive for device level, for keys that are
+/// decomposed into their fields.
+///
+/// \p radix_sort_pairs function performs a device-wide radix sort of (key, value) pairs.
+/// Keys are ordered by the fields returned by \p decomposer in ascending order, the first field
+/// is the most significant one. This overload sorts all bits of the fields.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the sorting function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * \p decomposer must be a default-constructible class, see \p identity_decomposer. It is
+/// constructed again in device code, so it must not hold any state.
+/// * Ranges specified by \p keys_input, \p keys_output, \p values_input and \p values_output must
+/// have at least \p size elements.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p radix_sort_config or
+/// a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point fields, see \p radix_float_order.
+/// \tparam Decomposer - type of the decomposer of keys into their fields.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] values_input - pointer to the first element in the range to sort.
+/// \param [out] values_output - pointer to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] decomposer - decomposer of keys into a \p rocprim::tuple of references to their fields.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+/// \param [out] executed_passes - [optional] if not null, the number of passes over the keys
+/// is written here. Passes of digits that are the same for all keys are skipped, finding them
+/// synchronizes \p stream once. Inputs small enough to be sorted by single-block and merge
+/// sorts make no passes and report \p 0, as do sorted and strictly reverse sorted inputs when
+/// the configuration checks the order of the input (\p radix_sort_config::check_sorted_input).
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class Size,
+    class Decomposer,
+    class Key = typename std::iterator_traits<KeysInputIterator>::value_type
+>
+inline
+auto radix_sort_pairs(void * temporary_storage,
+                      size_t& storage_size,
+                      KeysInputIterator keys_input,
+                      KeysOutputIterator keys_output,
+                      ValuesInputIterator values_input,
+                      ValuesOutputIterator values_output,
+                      Size size,
+                      Decomposer decomposer,
+                      hipStream_t stream = 0,
+                      bool debug_synchronous = false,
+                      unsigned int* executed_passes = nullptr)
+    -> typename std::enable_if<!std::is_integral<Decomposer>::value, hipError_t>::type
+{
+    static_assert(std::is_integral<Size>::value, "Size must be an integral type.");
+    // The decomposer is stateless, it is constructed again in device code
+    (void)decomposer;
+    bool ignored;
+    return detail::radix_sort_impl<Config, false, FloatOrder, Decomposer>(
+        temporary_storage, storage_size,
+        keys_input, nullptr, keys_output,
+        values_input, nullptr, values_output,
+        size, ignored,
+        0, detail::radix_key_codec<Key, false, FloatOrder, Decomposer>::key_bits,
+        stream, debug_synchronous, executed_passes
+    );
+}
+
+/// \brief Parallel descending radix sort-by-key primitive for device level, for keys that are
+/// decomposed into their fields.
+///
+/// \p radix_sort_pairs_desc function performs a device-wide radix sort of (key, value) pairs.
+/// Keys are ordered by the fields returned by \p decomposer in descending order, the first field
+/// is the most significant one. This overload sorts all bits of the fields.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the sorting function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * \p decomposer must be a default-constructible class, see \p identity_decomposer. It is
+/// constructed again in device code, so it must not hold any state.
+/// * Ranges specified by \p keys_input, \p keys_output, \p values_input and \p values_output must
+/// have at least \p size elements.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p radix_sort_config or
+/// a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point fields, see \p radix_float_order.
+/// \tparam Decomposer - type of the decomposer of keys into their fields.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] values_input - pointer to the first element in the range to sort.
+/// \param [out] values_output - pointer to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] decomposer - decomposer of keys into a \p rocprim::tuple of references to their fields.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+/// \param [out] executed_passes - [optional] if not null, the number of passes over the keys
+/// is written here. Passes of digits that are the same for all keys are skipped, finding them
+/// synchronizes \p stream once. Inputs small enough to be sorted by single-block and merge
+/// sorts make no passes and report \p 0, as do sorted and strictly reverse sorted inputs when
+/// the configuration checks the order of the input (\p radix_sort_config::check_sorted_input).
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class Size,
+    class Decomposer,
+    class Key = typename std::iterator_traits<KeysInputIterator>::value_type
+>
+inline
+auto radix_sort_pairs_desc(void * temporary_storage,
+                           size_t& storage_size,
+                           KeysInputIterator keys_input,
+                           KeysOutputIterator keys_output,
+                           ValuesInputIterator values_input,
+                           ValuesOutputIterator values_output,
+                           Size size,
+                           Decomposer decomposer,
+                           hipStream_t stream = 0,
+                           bool debug_synchronous = false,
+                           unsigned int* executed_passes = nullptr)
+    -> typename std::enable_if<!std::is_integral<Decomposer>::value, hipError_t>::type
+{
+    static_assert(std::is_integral<Size>::value, "Size must be an integral type.");
+    // The decomposer is stateless, it is constructed again in device code
+    (void)decomposer;
+    bool ignored;
+    return detail::radix_sort_impl<Config, true, FloatOrder, Decomposer>(
+        temporary_storage, storage_size,
+        keys_input, nullptr, keys_output,
+        values_input, nullptr, values_output,
+        size, ignored,
+        0, detail::radix_key_codec<Key, false, FloatOrder, Decomposer>::key_bits,
+        stream, debug_synchronous, executed_passes
+    );
+}
+
+/// \brief Upper bound of the size of the temporary storage of \p radix_sort_keys and
+/// \p radix_sort_keys_desc for inputs of at most \p max_size keys.
+///
+/// The bound is computed on the host without any HIP API calls, so the temporary storage can be
+/// allocated once, before the sizes of the inputs are known, and reused by all sorts.
+///
+/// \par Overview
+/// * The bound is valid for any keys iterators, size types, bit ranges and orders of floating
+/// point keys, as long as \p Config is the same.
+/// * Sorts with a custom decomposer are not covered, their storage must be queried.
+///
+/// \tparam Key - key type, it must be an arithmetic type that can be sorted without
+/// a decomposer.
+/// \tparam Config - [optional] configuration of the primitive. It has to be \p radix_sort_config
+/// or a class with the same members.
+///
+/// \param [in] max_size - the largest number of keys that can be sorted with the storage.
+///
+/// \returns the size (in bytes) of temporary storage that is large enough for every sort.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Allocate the storage once for all inputs of at most 1 << 20 keys
+/// size_t temporary_storage_size_bytes
+///     = rocprim::radix_sort_keys_storage_bound<float>(1 << 20);
+/// void * temporary_storage_ptr;
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // sort any input of at most 1 << 20 keys
+/// rocprim::radix_sort_keys(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size
+/// );
+/// \endcode
+/// \endparblock
+template<class Key, class Config = default_config>
+inline size_t radix_sort_keys_storage_bound(const size_t max_size)
+{
+    static_assert(std::is_arithmetic<Key>::value || ::rocprim::is_floating_point<Key>::value,
+                  "Key must be an arithmetic type.");
+    return detail::radix_sort_storage_bound<Config, Key, ::rocprim::empty_type>(max_size);
+}
+
+/// \brief Upper bound of the size of the temporary storage of \p radix_sort_pairs and
+/// \p radix_sort_pairs_desc for inputs of at most \p max_size pairs.
+///
+/// The bound is computed on the host without any HIP API calls, so the temporary storage can be
+/// allocated once, before the sizes of the inputs are known, and reused by all sorts.
+///
+/// \par Overview
+/// * The bound is valid for any keys and values iterators, size types, bit ranges and orders
+/// of floating point keys, as long as \p Config is the same.
+/// * Sorts with a custom decomposer are not covered, their storage must be queried.
+///
+/// \tparam Key - key type, it must be an arithmetic type that can be sorted without
+/// a decomposer.
+/// \tparam Value - value type.
+/// \tparam Config - [optional] configuration of the primitive. It has to be \p radix_sort_config
+/// or a class with the same members.
+///
+/// \param [in] max_size - the largest number of pairs that can be sorted with the storage.
+///
+/// \returns the size (in bytes) of temporary storage that is large enough for every sort.
+template<class Key, class Value, class Config = default_config>
+inline size_t radix_sort_pairs_storage_bound(const size_t max_size)
+{
+    static_assert(std::is_arithmetic<Key>::value || ::rocprim::is_floating_point<Key>::value,
+                  "Key must be an arithmetic type.");
+    return detail::radix_sort_storage_bound<Config, Key, Value>(max_size);
+}
+
+#ifdef ROCPRIM_USE_INSTANTIATIONS
+ROCPRIM_DETAIL_FOR_EACH_INSTANTIATED_TYPE(ROCPRIM_DETAIL_RADIX_SORT_KEYS_INSTANTIATIONS,
+                                          extern template)
+ROCPRIM_DETAIL_FOR_EACH_INSTANTIATED_TYPE(ROCPRIM_DETAIL_RADIX_SORT_PAIRS_INSTANTIATIONS,
+                                          extern template)
+#endif
+
 END_ROCPRIM_NAMESPACE
 
 /// @}
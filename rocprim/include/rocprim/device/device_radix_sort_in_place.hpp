@@ -0,0 +1,906 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_RADIX_SORT_IN_PLACE_HPP_
+#define ROCPRIM_DEVICE_DEVICE_RADIX_SORT_IN_PLACE_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "../config.hpp"
+#include "../detail/radix_sort.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../functional.hpp"
+#include "../iterator/reverse_iterator.hpp"
+#include "../iterator/transform_iterator.hpp"
+#include "../types.hpp"
+
+#include "detail/device_radix_select.hpp"
+#include "device_partition.hpp"
+#include "device_radix_sort.hpp"
+#include "device_select_kth.hpp"
+#include "device_transform.hpp"
+#include "instrumentation.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
+    { \
+        auto _error = hipGetLastError(); \
+        if(_error != hipSuccess) return _error; \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
+        if(debug_synchronous) \
+        { \
+            std::cout << name << "(" << size << ")"; \
+            auto __error = hipStreamSynchronize(stream); \
+            if(__error != hipSuccess) return __error; \
+            auto _end = std::chrono::high_resolution_clock::now(); \
+            auto _d = std::chrono::duration_cast<std::chrono::duration<double>>(_end - start); \
+            std::cout << " " << _d.count() * 1000 << " ms" << '\n'; \
+        } \
+    }
+
+// Keys of consecutive digits of one level of the most significant digit first recursion
+template<class BitKey>
+struct radix_sort_in_place_task
+{
+    // The group consists of keys whose bits [bit, end_bit) are in [first, last]
+    BitKey       first;
+    BitKey       last;
+    unsigned int bit;
+    // Keys of the group can only differ in bits [begin_bit, sort_end_bit)
+    unsigned int sort_end_bit;
+    size_t       count;
+};
+
+template<class BitKey>
+inline BitKey radix_sort_in_place_low_bits(const unsigned int bit)
+{
+    return bit >= sizeof(BitKey) * 8 ? static_cast<BitKey>(~BitKey(0))
+                                     : static_cast<BitKey>((BitKey(1) << bit) - 1);
+}
+
+// Mask of bits [begin_bit, end_bit)
+template<class BitKey>
+inline BitKey radix_sort_in_place_mask(const unsigned int begin_bit, const unsigned int end_bit)
+{
+    return static_cast<BitKey>(radix_sort_in_place_low_bits<BitKey>(end_bit)
+                               & ~radix_sort_in_place_low_bits<BitKey>(begin_bit));
+}
+
+// Selects keys of the group if in_group is true, otherwise all other keys
+template<class KeyCodec>
+struct radix_sort_in_place_group_op
+{
+    using bit_key_type = typename KeyCodec::bit_key_type;
+
+    bit_key_type mask;
+    bit_key_type first;
+    bit_key_type last;
+    bool         in_group;
+
+    template<class Key>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    bool operator()(const Key& key) const
+    {
+        const bit_key_type bits = radix_select_encode<KeyCodec>(key) & mask;
+        return (first <= bits && bits <= last) == in_group;
+    }
+};
+
+template<class T>
+inline T* radix_sort_in_place_advance(T* ptr, const size_t offset)
+{
+    return ptr + offset;
+}
+
+inline ::rocprim::empty_type* radix_sort_in_place_advance(::rocprim::empty_type* ptr,
+                                                          const size_t /*offset*/)
+{
+    return ptr;
+}
+
+// Copies the keys of the group from the unsorted range to the scratch
+template<class KeyCodec, class Key, class Value>
+inline hipError_t radix_sort_in_place_select(void*                                  temporary_storage,
+                                             size_t&                                storage_size,
+                                             Key*                                   keys,
+                                             Value*                                 values,
+                                             Key*                                   keys_scratch,
+                                             Value*                                 values_scratch,
+                                             size_t*                                selected_count,
+                                             const size_t                           size,
+                                             const radix_sort_in_place_group_op<KeyCodec> op,
+                                             const hipStream_t                      stream,
+                                             const bool                             debug_synchronous)
+{
+    ::rocprim::empty_type* const no_flags = nullptr;
+    return partition_impl<select_method::predicate, true, default_config, unsigned int>(
+        temporary_storage,
+        storage_size,
+        keys,
+        values,
+        no_flags,
+        keys_scratch,
+        values_scratch,
+        selected_count,
+        size,
+        ::rocprim::empty_type(),
+        stream,
+        debug_synchronous,
+        op);
+}
+
+// Moves the keys that are not in the group to the back of the range, keeping their order.
+// The selection runs over reversed iterators, so every key moves to a position that is not before
+// its own position in the reversed order. A block stores its keys only after all previous blocks
+// have loaded theirs (they publish their counts after the load), hence the keys can be moved in
+// place. Values are loaded only after the look-back, so they are moved as the keys of another
+// selection that is flagged by the keys still in their original positions.
+template<class KeyCodec, class Key>
+inline hipError_t radix_sort_in_place_compact_keys(void*     temporary_storage,
+                                                   size_t&   storage_size,
+                                                   Key*      keys,
+                                                   size_t*   selected_count,
+                                                   const size_t size,
+                                                   const radix_sort_in_place_group_op<KeyCodec> op,
+                                                   const hipStream_t stream,
+                                                   const bool        debug_synchronous)
+{
+    ::rocprim::empty_type* const no_flags  = nullptr;
+    ::rocprim::empty_type* const no_values = nullptr;
+    const auto reversed_keys = ::rocprim::make_reverse_iterator(keys + size);
+    return partition_impl<select_method::predicate, true, default_config, unsigned int>(
+        temporary_storage,
+        storage_size,
+        reversed_keys,
+        no_values,
+        no_flags,
+        reversed_keys,
+        no_values,
+        selected_count,
+        size,
+        ::rocprim::empty_type(),
+        stream,
+        debug_synchronous,
+        op);
+}
+
+template<class KeyCodec, class Key, class Value>
+inline hipError_t radix_sort_in_place_compact_values(void*     temporary_storage,
+                                                     size_t&   storage_size,
+                                                     Key*      keys,
+                                                     Value*    values,
+                                                     size_t*   selected_count,
+                                                     const size_t size,
+                                                     const radix_sort_in_place_group_op<KeyCodec> op,
+                                                     const hipStream_t stream,
+                                                     const bool        debug_synchronous)
+{
+    ::rocprim::empty_type* const no_values = nullptr;
+    const auto reversed_values = ::rocprim::make_reverse_iterator(values + size);
+    const auto flags
+        = ::rocprim::make_transform_iterator(::rocprim::make_reverse_iterator(keys + size), op);
+    return partition_impl<select_method::flag, true, default_config, unsigned int>(
+        temporary_storage,
+        storage_size,
+        reversed_values,
+        no_values,
+        flags,
+        reversed_values,
+        no_values,
+        selected_count,
+        size,
+        ::rocprim::empty_type(),
+        stream,
+        debug_synchronous,
+        ::rocprim::empty_type());
+}
+
+template<class KeyCodec, class Key>
+inline hipError_t radix_sort_in_place_compact_values(void*   /*temporary_storage*/,
+                                                     size_t& storage_size,
+                                                     Key*    /*keys*/,
+                                                     ::rocprim::empty_type* /*values*/,
+                                                     size_t* /*selected_count*/,
+                                                     const size_t /*size*/,
+                                                     const radix_sort_in_place_group_op<KeyCodec> /*op*/,
+                                                     const hipStream_t /*stream*/,
+                                                     const bool        /*debug_synchronous*/)
+{
+    storage_size = 0;
+    return hipSuccess;
+}
+
+template<class T>
+inline hipError_t radix_sort_in_place_copy(T*                input,
+                                           T*                output,
+                                           const size_t      size,
+                                           const hipStream_t stream,
+                                           const bool        debug_synchronous)
+{
+    return ::rocprim::transform(input,
+                                output,
+                                size,
+                                ::rocprim::identity<T>(),
+                                stream,
+                                debug_synchronous);
+}
+
+inline hipError_t radix_sort_in_place_copy(::rocprim::empty_type* /*input*/,
+                                           ::rocprim::empty_type* /*output*/,
+                                           const size_t /*size*/,
+                                           const hipStream_t /*stream*/,
+                                           const bool /*debug_synchronous*/)
+{
+    return hipSuccess;
+}
+
+template<class Config, bool Descending, radix_float_order FloatOrder, class Key, class Value>
+inline hipError_t radix_sort_in_place_impl(void*             temporary_storage,
+                                           size_t&           storage_size,
+                                           Key*              keys,
+                                           Value*            values,
+                                           const size_t      size,
+                                           size_t            scratch_size,
+                                           const unsigned int begin_bit,
+                                           const unsigned int end_bit,
+                                           const hipStream_t stream,
+                                           bool              debug_synchronous)
+{
+    using key_codec    = radix_key_codec<Key, Descending, FloatOrder>;
+    using bit_key_type = typename key_codec::bit_key_type;
+    using state_type   = radix_select_state<bit_key_type>;
+    using task_type    = radix_sort_in_place_task<bit_key_type>;
+    using group_op     = radix_sort_in_place_group_op<key_codec>;
+
+    constexpr bool with_values = !std::is_same<Value, ::rocprim::empty_type>::value;
+
+    scratch_size = std::max<size_t>(1, std::min(scratch_size, size));
+
+    Key*                keys_scratch        = nullptr;
+    Value*              values_scratch      = nullptr;
+    state_type*         state               = nullptr;
+    unsigned long long* histogram           = nullptr;
+    size_t*             selected_count      = nullptr;
+    void*               nested_temp_storage = nullptr;
+
+    const auto sort_scratch = [&](void*        sort_temp_storage,
+                                  size_t       sort_storage_size,
+                                  const size_t offset,
+                                  const size_t count,
+                                  bool&        is_result_in_output,
+                                  unsigned int sort_end_bit)
+    {
+        return radix_sort_impl<Config, Descending, FloatOrder, ::rocprim::identity_decomposer>(
+            sort_temp_storage,
+            sort_storage_size,
+            keys_scratch,
+            keys_scratch,
+            radix_sort_in_place_advance(keys, offset),
+            values_scratch,
+            values_scratch,
+            radix_sort_in_place_advance(values, offset),
+            count,
+            is_result_in_output,
+            begin_bit,
+            sort_end_bit,
+            stream,
+            debug_synchronous);
+    };
+
+    // All steps run one after another, so they share the storage
+    size_t     nested_storage_size = 0;
+    hipError_t error;
+    if(size > 0)
+    {
+        const group_op op{0, 0, 0, true};
+        size_t         current_storage_size;
+        error = radix_sort_in_place_select(nullptr,
+                                           current_storage_size,
+                                           keys,
+                                           values,
+                                           keys_scratch,
+                                           values_scratch,
+                                           selected_count,
+                                           size,
+                                           op,
+                                           stream,
+                                           debug_synchronous);
+        if(error != hipSuccess) return error;
+        nested_storage_size = std::max(nested_storage_size, current_storage_size);
+
+        error = radix_sort_in_place_compact_keys(nullptr,
+                                                 current_storage_size,
+                                                 keys,
+                                                 selected_count,
+                                                 size,
+                                                 op,
+                                                 stream,
+                                                 debug_synchronous);
+        if(error != hipSuccess) return error;
+        nested_storage_size = std::max(nested_storage_size, current_storage_size);
+
+        error = radix_sort_in_place_compact_values(nullptr,
+                                                   current_storage_size,
+                                                   keys,
+                                                   values,
+                                                   selected_count,
+                                                   size,
+                                                   op,
+                                                   stream,
+                                                   debug_synchronous);
+        if(error != hipSuccess) return error;
+        nested_storage_size = std::max(nested_storage_size, current_storage_size);
+
+        // The storage of the sort only grows with the size and the number of bits
+        bool ignored;
+        current_storage_size = 0;
+        error = radix_sort_impl<Config, Descending, FloatOrder, ::rocprim::identity_decomposer>(
+            nullptr,
+            current_storage_size,
+            keys_scratch,
+            keys_scratch,
+            keys,
+            values_scratch,
+            values_scratch,
+            values,
+            scratch_size,
+            ignored,
+            begin_bit,
+            end_bit,
+            stream,
+            debug_synchronous);
+        if(error != hipSuccess) return error;
+        nested_storage_size = std::max(nested_storage_size, current_storage_size);
+    }
+
+    const hipError_t partition_result = temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        temp_storage::make_linear_partition(
+            temp_storage::ptr_aligned_array(&keys_scratch, size > 0 ? scratch_size : 0),
+            temp_storage::ptr_aligned_array(&values_scratch,
+                                            with_values && size > 0 ? scratch_size : 0),
+            temp_storage::ptr_aligned_array(&state, 1),
+            temp_storage::ptr_aligned_array(&histogram, radix_select_size),
+            temp_storage::ptr_aligned_array(&selected_count, 1),
+            temp_storage::make_partition(&nested_temp_storage, nested_storage_size)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(size == 0 || begin_bit >= end_bit)
+        return hipSuccess;
+
+    constexpr unsigned int block_size      = radix_select_histogram_block_size;
+    constexpr unsigned int items_per_block = block_size * radix_select_histogram_items_per_thread;
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    std::vector<unsigned long long> host_histogram(radix_select_size);
+    std::vector<task_type>          tasks;
+    tasks.push_back(task_type{0, 0, end_bit, end_bit, size});
+
+    // Keys before this position are already in their final positions
+    size_t sorted = 0;
+    while(!tasks.empty())
+    {
+        const task_type task = tasks.back();
+        tasks.pop_back();
+
+        const bit_key_type mask = radix_sort_in_place_mask<bit_key_type>(task.bit, end_bit);
+        const group_op     in_group_op{mask, task.first, task.last, true};
+        const group_op     out_of_group_op{mask, task.first, task.last, false};
+
+        if(task.count > scratch_size && task.bit > begin_bit)
+        {
+            // Too many keys to sort them at once, they are split by their next digit
+            const unsigned int digit_bit = task.bit > begin_bit + radix_select_bits
+                                               ? task.bit - radix_select_bits
+                                               : begin_bit;
+            const unsigned int current_radix_bits = task.bit - digit_bit;
+            const unsigned int radix_size         = 1u << current_radix_bits;
+
+            const state_type host_state{task.first, mask, 0, 0};
+            error = hipMemcpyAsync(state,
+                                   &host_state,
+                                   sizeof(state_type),
+                                   hipMemcpyHostToDevice,
+                                   stream);
+            if(error != hipSuccess) return error;
+            error = hipMemsetAsync(histogram,
+                                   0,
+                                   radix_select_size * sizeof(unsigned long long),
+                                   stream);
+            if(error != hipSuccess) return error;
+
+            const size_t       unsorted_size    = size - sorted;
+            const unsigned int number_of_blocks = static_cast<unsigned int>(
+                std::min<size_t>(ceiling_div(unsorted_size, items_per_block),
+                                 radix_select_histogram_max_blocks));
+
+            if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+            ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("radix_select_histogram_kernel");
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(radix_select_histogram_kernel<block_size,
+                                                              radix_select_histogram_items_per_thread,
+                                                              key_codec>),
+                dim3(number_of_blocks), dim3(block_size), 0, stream,
+                keys + sorted, unsorted_size, state, 1, histogram, digit_bit, current_radix_bits
+            );
+            ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("radix_select_histogram_kernel",
+                                                        unsorted_size,
+                                                        start);
+
+            // The copy also keeps host_state alive until the histogram kernel has read it
+            error = memcpy_and_sync(host_histogram.data(),
+                                    histogram,
+                                    radix_size * sizeof(unsigned long long),
+                                    hipMemcpyDeviceToHost,
+                                    stream);
+            if(error != hipSuccess) return error;
+
+            // Consecutive digits are grouped while their keys fit into the scratch together.
+            // The groups are processed from the smallest one.
+            const size_t first_task = tasks.size();
+            for(unsigned int digit = 0; digit < radix_size;)
+            {
+                if(host_histogram[digit] == 0)
+                {
+                    digit++;
+                    continue;
+                }
+                const unsigned int first_digit = digit;
+                unsigned int       last_digit  = digit;
+                size_t             count       = host_histogram[digit++];
+                while(count <= scratch_size && digit < radix_size
+                      && count + host_histogram[digit] <= scratch_size)
+                {
+                    if(host_histogram[digit] != 0)
+                    {
+                        last_digit = digit;
+                        count += host_histogram[digit];
+                    }
+                    digit++;
+                }
+                tasks.push_back(task_type{
+                    static_cast<bit_key_type>(
+                        task.first | static_cast<bit_key_type>(bit_key_type(first_digit) << digit_bit)),
+                    static_cast<bit_key_type>(
+                        task.first | static_cast<bit_key_type>(bit_key_type(last_digit) << digit_bit)),
+                    digit_bit,
+                    first_digit == last_digit ? digit_bit : task.bit,
+                    count});
+            }
+            std::reverse(tasks.begin() + first_task, tasks.end());
+            continue;
+        }
+
+        // The keys of the group are taken out of the unsorted range to the scratch, the rest of
+        // the unsorted range is moved after them, then the group is stored in front of it.
+        // If the group is larger than the scratch, its keys are all equal, and it is moved in
+        // windows that have at most scratch_size keys of the group.
+        size_t remaining = task.count;
+        // Number of keys at the front of the unsorted range that are known not to be in the group
+        size_t skipped = 0;
+        while(remaining > 0)
+        {
+            const size_t unsorted_size = size - sorted;
+            const size_t window_size = remaining <= scratch_size
+                                           ? unsorted_size
+                                           : std::min(unsorted_size, skipped + scratch_size);
+
+            Key*   window_keys   = keys + sorted;
+            Value* window_values = radix_sort_in_place_advance(values, sorted);
+
+            size_t current_storage_size = nested_storage_size;
+            error = radix_sort_in_place_select(nested_temp_storage,
+                                               current_storage_size,
+                                               window_keys,
+                                               window_values,
+                                               keys_scratch,
+                                               values_scratch,
+                                               selected_count,
+                                               window_size,
+                                               in_group_op,
+                                               stream,
+                                               debug_synchronous);
+            if(error != hipSuccess) return error;
+
+            size_t selected = remaining;
+            if(remaining > scratch_size)
+            {
+                error = memcpy_and_sync(&selected,
+                                        selected_count,
+                                        sizeof(size_t),
+                                        hipMemcpyDeviceToHost,
+                                        stream);
+                if(error != hipSuccess) return error;
+            }
+
+            if(selected > 0)
+            {
+                // Values first, their flags need the keys that are not moved yet
+                current_storage_size = nested_storage_size;
+                error = radix_sort_in_place_compact_values(nested_temp_storage,
+                                                           current_storage_size,
+                                                           window_keys,
+                                                           window_values,
+                                                           selected_count,
+                                                           window_size,
+                                                           out_of_group_op,
+                                                           stream,
+                                                           debug_synchronous);
+                if(error != hipSuccess) return error;
+
+                current_storage_size = nested_storage_size;
+                error = radix_sort_in_place_compact_keys(nested_temp_storage,
+                                                         current_storage_size,
+                                                         window_keys,
+                                                         selected_count,
+                                                         window_size,
+                                                         out_of_group_op,
+                                                         stream,
+                                                         debug_synchronous);
+                if(error != hipSuccess) return error;
+
+                bool is_result_in_output = false;
+                if(task.sort_end_bit > begin_bit)
+                {
+                    // The freed front of the range is the second buffer of the sort
+                    error = sort_scratch(nested_temp_storage,
+                                         nested_storage_size,
+                                         sorted,
+                                         selected,
+                                         is_result_in_output,
+                                         task.sort_end_bit);
+                    if(error != hipSuccess) return error;
+                }
+                if(!is_result_in_output)
+                {
+                    error = radix_sort_in_place_copy(keys_scratch,
+                                                     window_keys,
+                                                     selected,
+                                                     stream,
+                                                     debug_synchronous);
+                    if(error != hipSuccess) return error;
+                    error = radix_sort_in_place_copy(values_scratch,
+                                                     window_values,
+                                                     selected,
+                                                     stream,
+                                                     debug_synchronous);
+                    if(error != hipSuccess) return error;
+                }
+            }
+
+            sorted += selected;
+            remaining -= selected;
+            skipped = window_size - selected;
+        }
+    }
+
+    return hipSuccess;
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
+} // end of detail namespace
+
+/// \brief Parallel in-place radix sort primitive for device level with bounded memory.
+///
+/// \p radix_sort_keys_in_place function sorts keys in ascending order in place, using temporary
+/// storage proportional to \p scratch_size instead of \p size.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * \p Key type must be an arithmetic type (that is, an integral type or a floating-point type).
+/// * Range specified by \p keys must have at least \p size elements.
+/// * Keys are ordered in the same way as by \p radix_sort_keys, and the sort is stable.
+/// * The keys are split by histograms of their most significant 8-bit digits until every group
+/// of consecutive digits fits into a scratch buffer of \p scratch_size keys. The groups are taken
+/// out of the unsorted part of the range one by one from the smallest, the rest is moved after
+/// them in place, and each group is radix sorted from the scratch to the freed part of the range.
+/// * Less memory is traded for extra time: every group needs a pass over the still unsorted keys,
+/// so, for example, <tt>scratch_size = size / 10</tt> makes about 10 times more passes over
+/// the keys than \p radix_sort_keys. Every histogram synchronizes \p stream.
+/// Even more passes are needed for runs of more than \p scratch_size equal keys.
+///
+/// \tparam Config - [optional] configuration of the sorts of groups. It can be
+/// \p radix_sort_config or a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
+/// \tparam Key - key type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in,out] keys - pointer to the first element in the range to sort.
+/// \param [in] size - number of element in the range.
+/// \param [in] scratch_size - number of keys that can be sorted at once, the temporary storage has
+/// room for this many keys. Values larger than \p size are clamped to \p size.
+/// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+/// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+/// Non-default value not supported for floating-point key-types.
+/// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+/// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+/// value: \p <tt>8 * sizeof(Key)</tt>. Non-default value not supported for floating-point key-types.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example an array of integer keys is sorted with room for a tenth of them.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input (declare pointers, allocate device memory etc.)
+/// size_t input_size;   // e.g., 1000000
+/// int * keys;          // e.g., [6, 3, 5, 4, 1, 8, 2, 7, ...]
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::radix_sort_keys_in_place(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys, input_size, input_size / 10
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform sort
+/// rocprim::radix_sort_keys_in_place(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys, input_size, input_size / 10
+/// );
+/// // keys: [1, 2, 3, 4, 5, 6, 7, 8, ...]
+/// \endcode
+/// \endparblock
+template<class Config                = default_config,
+         radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+         class Key>
+inline hipError_t radix_sort_keys_in_place(void*             temporary_storage,
+                                           size_t&           storage_size,
+                                           Key*              keys,
+                                           const size_t      size,
+                                           const size_t      scratch_size,
+                                           unsigned int      begin_bit         = 0,
+                                           unsigned int      end_bit           = 8 * sizeof(Key),
+                                           const hipStream_t stream            = 0,
+                                           bool              debug_synchronous = false)
+{
+    ::rocprim::empty_type* values = nullptr;
+    return detail::radix_sort_in_place_impl<Config, false, FloatOrder>(temporary_storage,
+                                                                       storage_size,
+                                                                       keys,
+                                                                       values,
+                                                                       size,
+                                                                       scratch_size,
+                                                                       begin_bit,
+                                                                       end_bit,
+                                                                       stream,
+                                                                       debug_synchronous);
+}
+
+/// \brief Parallel descending in-place radix sort primitive for device level with bounded memory.
+///
+/// \p radix_sort_keys_in_place_desc function sorts keys in descending order in place, see
+/// \p radix_sort_keys_in_place.
+///
+/// \tparam Config - [optional] configuration of the sorts of groups. It can be
+/// \p radix_sort_config or a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
+/// \tparam Key - key type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in,out] keys - pointer to the first element in the range to sort.
+/// \param [in] size - number of element in the range.
+/// \param [in] scratch_size - number of keys that can be sorted at once, the temporary storage has
+/// room for this many keys. Values larger than \p size are clamped to \p size.
+/// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+/// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+/// Non-default value not supported for floating-point key-types.
+/// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+/// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+/// value: \p <tt>8 * sizeof(Key)</tt>. Non-default value not supported for floating-point key-types.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config                = default_config,
+         radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+         class Key>
+inline hipError_t radix_sort_keys_in_place_desc(void*             temporary_storage,
+                                                size_t&           storage_size,
+                                                Key*              keys,
+                                                const size_t      size,
+                                                const size_t      scratch_size,
+                                                unsigned int      begin_bit = 0,
+                                                unsigned int      end_bit   = 8 * sizeof(Key),
+                                                const hipStream_t stream    = 0,
+                                                bool              debug_synchronous = false)
+{
+    ::rocprim::empty_type* values = nullptr;
+    return detail::radix_sort_in_place_impl<Config, true, FloatOrder>(temporary_storage,
+                                                                      storage_size,
+                                                                      keys,
+                                                                      values,
+                                                                      size,
+                                                                      scratch_size,
+                                                                      begin_bit,
+                                                                      end_bit,
+                                                                      stream,
+                                                                      debug_synchronous);
+}
+
+/// \brief Parallel in-place radix sort-by-key primitive for device level with bounded memory.
+///
+/// \p radix_sort_pairs_in_place function sorts (key, value) pairs by key in ascending order in
+/// place, see \p radix_sort_keys_in_place. The temporary storage has room for \p scratch_size
+/// keys and values.
+///
+/// \tparam Config - [optional] configuration of the sorts of groups. It can be
+/// \p radix_sort_config or a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
+/// \tparam Key - key type.
+/// \tparam Value - value type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in,out] keys - pointer to the first element in the range of keys to sort.
+/// \param [in,out] values - pointer to the first element in the range of values to sort.
+/// \param [in] size - number of element in the range.
+/// \param [in] scratch_size - number of pairs that can be sorted at once, the temporary storage
+/// has room for this many pairs. Values larger than \p size are clamped to \p size.
+/// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+/// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+/// Non-default value not supported for floating-point key-types.
+/// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+/// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+/// value: \p <tt>8 * sizeof(Key)</tt>. Non-default value not supported for floating-point key-types.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config                = default_config,
+         radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+         class Key,
+         class Value>
+inline hipError_t radix_sort_pairs_in_place(void*             temporary_storage,
+                                            size_t&           storage_size,
+                                            Key*              keys,
+                                            Value*            values,
+                                            const size_t      size,
+                                            const size_t      scratch_size,
+                                            unsigned int      begin_bit         = 0,
+                                            unsigned int      end_bit           = 8 * sizeof(Key),
+                                            const hipStream_t stream            = 0,
+                                            bool              debug_synchronous = false)
+{
+    return detail::radix_sort_in_place_impl<Config, false, FloatOrder>(temporary_storage,
+                                                                       storage_size,
+                                                                       keys,
+                                                                       values,
+                                                                       size,
+                                                                       scratch_size,
+                                                                       begin_bit,
+                                                                       end_bit,
+                                                                       stream,
+                                                                       debug_synchronous);
+}
+
+/// \brief Parallel descending in-place radix sort-by-key primitive for device level with
+/// bounded memory.
+///
+/// \p radix_sort_pairs_in_place_desc function sorts (key, value) pairs by key in descending order
+/// in place, see \p radix_sort_keys_in_place.
+///
+/// \tparam Config - [optional] configuration of the sorts of groups. It can be
+/// \p radix_sort_config or a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
+/// \tparam Key - key type.
+/// \tparam Value - value type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in,out] keys - pointer to the first element in the range of keys to sort.
+/// \param [in,out] values - pointer to the first element in the range of values to sort.
+/// \param [in] size - number of element in the range.
+/// \param [in] scratch_size - number of pairs that can be sorted at once, the temporary storage
+/// has room for this many pairs. Values larger than \p size are clamped to \p size.
+/// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+/// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+/// Non-default value not supported for floating-point key-types.
+/// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+/// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+/// value: \p <tt>8 * sizeof(Key)</tt>. Non-default value not supported for floating-point key-types.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config                = default_config,
+         radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+         class Key,
+         class Value>
+inline hipError_t radix_sort_pairs_in_place_desc(void*             temporary_storage,
+                                                 size_t&           storage_size,
+                                                 Key*              keys,
+                                                 Value*            values,
+                                                 const size_t      size,
+                                                 const size_t      scratch_size,
+                                                 unsigned int      begin_bit = 0,
+                                                 unsigned int      end_bit   = 8 * sizeof(Key),
+                                                 const hipStream_t stream    = 0,
+                                                 bool              debug_synchronous = false)
+{
+    return detail::radix_sort_in_place_impl<Config, true, FloatOrder>(temporary_storage,
+                                                                      storage_size,
+                                                                      keys,
+                                                                      values,
+                                                                      size,
+                                                                      scratch_size,
+                                                                      begin_bit,
+                                                                      end_bit,
+                                                                      stream,
+                                                                      debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_RADIX_SORT_IN_PLACE_HPP_
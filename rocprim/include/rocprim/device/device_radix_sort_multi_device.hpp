@@ -0,0 +1,556 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_RADIX_SORT_MULTI_DEVICE_HPP_
+#define ROCPRIM_DEVICE_DEVICE_RADIX_SORT_MULTI_DEVICE_HPP_
+
+#include <algorithm>
+#include <iostream>
+#include <type_traits>
+#include <vector>
+
+#include "../config.hpp"
+#include "../detail/radix_sort.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../iterator/counting_iterator.hpp"
+
+#include "device_binary_search.hpp"
+#include "device_radix_sort.hpp"
+#include "device_transform.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+// Number of keys every device contributes to the selection of the splitters
+constexpr unsigned int multi_device_radix_sort_samples = 256;
+
+// Compares keys in the order of radix_sort
+template<class Key, radix_float_order FloatOrder>
+struct multi_device_radix_key_less
+{
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    bool operator()(const Key& a, const Key& b) const
+    {
+        using codec = radix_key_codec<Key, false, FloatOrder>;
+        return codec::encode(a) < codec::encode(b);
+    }
+};
+
+// Takes the keys at evenly spaced positions of a sorted range
+template<class Key>
+struct multi_device_radix_sample_op
+{
+    const Key* keys;
+    size_t     size;
+    size_t     samples;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    Key operator()(const size_t i) const
+    {
+        return keys[(i * size) / samples];
+    }
+};
+
+// Pointers to the partitions of the temporary storage of one device
+template<class Key, class Value>
+struct multi_device_radix_sort_storage
+{
+    Key*    local_keys;
+    Value*  local_values;
+    Key*    received_keys;
+    Value*  received_values;
+    Key*    samples;
+    Key*    gathered_samples;
+    Key*    sorted_samples;
+    Key*    splitters;
+    size_t* positions;
+    void*   nested_storage;
+    size_t  nested_storage_size;
+};
+
+template<class Config, radix_float_order FloatOrder, class Key, class Value>
+inline hipError_t multi_device_radix_sort_pairs_impl(void* const*       temporary_storage,
+                                                     size_t*            storage_sizes,
+                                                     const int*         devices,
+                                                     const unsigned int device_count,
+                                                     const Key* const*  keys_input,
+                                                     Key* const*        keys_output,
+                                                     const Value* const* values_input,
+                                                     Value* const*      values_output,
+                                                     const size_t*      sizes,
+                                                     const size_t*      output_capacities,
+                                                     size_t*            output_sizes,
+                                                     const hipStream_t* streams,
+                                                     const bool         debug_synchronous)
+{
+    using less_type = multi_device_radix_key_less<Key, FloatOrder>;
+    using storage_type = multi_device_radix_sort_storage<Key, Value>;
+
+    constexpr size_t samples_per_device = multi_device_radix_sort_samples;
+    const size_t     splitter_count     = device_count - 1;
+    const size_t     max_samples        = device_count * samples_per_device;
+
+    const auto stream_of = [&](unsigned int d) { return streams != nullptr ? streams[d] : 0; };
+
+    // Synchronizes the streams of all devices, the next phase uses results of all of them
+    const auto synchronize_all = [&]() -> hipError_t
+    {
+        for(unsigned int d = 0; d < device_count; d++)
+        {
+            hipError_t error = hipSetDevice(devices[d]);
+            if(error != hipSuccess) return error;
+            error = hipStreamSynchronize(stream_of(d));
+            if(error != hipSuccess) return error;
+        }
+        return hipSuccess;
+    };
+
+    std::vector<storage_type> storages(device_count);
+    for(unsigned int d = 0; d < device_count; d++)
+    {
+        hipError_t error = hipSetDevice(devices[d]);
+        if(error != hipSuccess) return error;
+
+        storage_type&     storage  = storages[d];
+        const hipStream_t stream   = stream_of(d);
+        const bool        gathers  = d == 0;
+
+        // The sizes of the nested algorithms do not depend on the pointers
+        size_t local_sort_bytes = 0;
+        error = ::rocprim::radix_sort_pairs<Config, FloatOrder>(nullptr,
+                                                                local_sort_bytes,
+                                                                keys_input[d],
+                                                                storage.local_keys,
+                                                                values_input[d],
+                                                                storage.local_values,
+                                                                sizes[d],
+                                                                0,
+                                                                8 * sizeof(Key),
+                                                                stream);
+        if(error != hipSuccess) return error;
+        size_t final_sort_bytes = 0;
+        error = ::rocprim::radix_sort_pairs<Config, FloatOrder>(nullptr,
+                                                                final_sort_bytes,
+                                                                storage.received_keys,
+                                                                keys_output[d],
+                                                                storage.received_values,
+                                                                values_output[d],
+                                                                output_capacities[d],
+                                                                0,
+                                                                8 * sizeof(Key),
+                                                                stream);
+        if(error != hipSuccess) return error;
+        size_t sample_sort_bytes = 0;
+        if(gathers)
+        {
+            error = ::rocprim::radix_sort_keys<Config, FloatOrder>(nullptr, sample_sort_bytes,
+                                                                   storage.gathered_samples,
+                                                                   storage.sorted_samples,
+                                                                   max_samples, 0, 8 * sizeof(Key),
+                                                                   stream);
+            if(error != hipSuccess) return error;
+        }
+        size_t search_bytes = 0;
+        if(splitter_count > 0)
+        {
+            error = ::rocprim::lower_bound(nullptr, search_bytes,
+                                           storage.local_keys, storage.splitters, storage.positions,
+                                           sizes[d], splitter_count, less_type(), stream);
+            if(error != hipSuccess) return error;
+        }
+        // The nested algorithms run one after another, they share their storage
+        storage.nested_storage_size = std::max({local_sort_bytes, final_sort_bytes,
+                                                sample_sort_bytes, search_bytes});
+
+        size_t storage_size = temporary_storage != nullptr ? storage_sizes[d] : 0;
+        error = temp_storage::partition(
+            temporary_storage != nullptr ? temporary_storage[d] : nullptr,
+            storage_size,
+            temp_storage::make_linear_partition(
+                temp_storage::ptr_aligned_array(&storage.local_keys, sizes[d]),
+                temp_storage::ptr_aligned_array(&storage.local_values, sizes[d]),
+                temp_storage::ptr_aligned_array(&storage.received_keys, output_capacities[d]),
+                temp_storage::ptr_aligned_array(&storage.received_values, output_capacities[d]),
+                temp_storage::ptr_aligned_array(&storage.samples, samples_per_device),
+                temp_storage::ptr_aligned_array(&storage.gathered_samples,
+                                                gathers ? max_samples : 0),
+                temp_storage::ptr_aligned_array(&storage.sorted_samples,
+                                                gathers ? max_samples : 0),
+                temp_storage::ptr_aligned_array(&storage.splitters, splitter_count),
+                temp_storage::ptr_aligned_array(&storage.positions, splitter_count),
+                temp_storage::make_partition(&storage.nested_storage,
+                                             storage.nested_storage_size)));
+        if(error != hipSuccess) return error;
+        if(temporary_storage == nullptr)
+        {
+            storage_sizes[d] = storage_size;
+        }
+    }
+    if(temporary_storage == nullptr)
+    {
+        return hipSuccess;
+    }
+
+    // Every device sorts its keys and takes evenly spaced samples of them, which are gathered on
+    // the first device
+    std::vector<size_t> sample_counts(device_count);
+    size_t              total_samples = 0;
+    for(unsigned int d = 0; d < device_count; d++)
+    {
+        hipError_t error = hipSetDevice(devices[d]);
+        if(error != hipSuccess) return error;
+        storage_type&     storage = storages[d];
+        const hipStream_t stream  = stream_of(d);
+
+        size_t nested_size = storage.nested_storage_size;
+        error = ::rocprim::radix_sort_pairs<Config, FloatOrder>(storage.nested_storage,
+                                                                nested_size,
+                                                                keys_input[d],
+                                                                storage.local_keys,
+                                                                values_input[d],
+                                                                storage.local_values,
+                                                                sizes[d],
+                                                                0,
+                                                                8 * sizeof(Key),
+                                                                stream,
+                                                                debug_synchronous);
+        if(error != hipSuccess) return error;
+
+        sample_counts[d] = std::min(sizes[d], samples_per_device);
+        const multi_device_radix_sample_op<Key> sample_op{storage.local_keys,
+                                                          sizes[d],
+                                                          sample_counts[d]};
+        error = ::rocprim::transform(counting_iterator<size_t>(0),
+                                     storage.samples,
+                                     sample_counts[d],
+                                     sample_op,
+                                     stream,
+                                     debug_synchronous);
+        if(error != hipSuccess) return error;
+        if(sample_counts[d] > 0)
+        {
+            error = hipMemcpyPeerAsync(storages[0].gathered_samples + total_samples, devices[0],
+                                       storage.samples, devices[d],
+                                       sample_counts[d] * sizeof(Key), stream);
+            if(error != hipSuccess) return error;
+        }
+        total_samples += sample_counts[d];
+    }
+    hipError_t error = synchronize_all();
+    if(error != hipSuccess) return error;
+
+    if(total_samples == 0)
+    {
+        std::fill(output_sizes, output_sizes + device_count, size_t(0));
+        return hipSuccess;
+    }
+
+    // The splitters are the samples at the quantiles of all samples, the keys less than the first
+    // splitter go to the first device and so on
+    if(splitter_count > 0)
+    {
+        storage_type&     storage = storages[0];
+        const hipStream_t stream  = stream_of(0);
+        error = hipSetDevice(devices[0]);
+        if(error != hipSuccess) return error;
+        size_t nested_size = storage.nested_storage_size;
+        error = ::rocprim::radix_sort_keys<Config, FloatOrder>(storage.nested_storage, nested_size,
+                                                               storage.gathered_samples,
+                                                               storage.sorted_samples,
+                                                               total_samples, 0, 8 * sizeof(Key),
+                                                               stream, debug_synchronous);
+        if(error != hipSuccess) return error;
+        const multi_device_radix_sample_op<Key> splitter_op{storage.sorted_samples,
+                                                            total_samples,
+                                                            device_count};
+        error = ::rocprim::transform(counting_iterator<size_t>(1),
+                                     storage.splitters,
+                                     splitter_count,
+                                     splitter_op,
+                                     stream,
+                                     debug_synchronous);
+        if(error != hipSuccess) return error;
+        error = hipStreamSynchronize(stream);
+        if(error != hipSuccess) return error;
+    }
+
+    // Every device finds where its sorted keys are split
+    std::vector<size_t> positions(device_count * (splitter_count + 1));
+    for(unsigned int d = 0; d < device_count; d++)
+    {
+        error = hipSetDevice(devices[d]);
+        if(error != hipSuccess) return error;
+        storage_type&     storage = storages[d];
+        const hipStream_t stream  = stream_of(d);
+        size_t* const     device_positions = positions.data() + d * (splitter_count + 1);
+
+        if(splitter_count > 0)
+        {
+            if(d != 0)
+            {
+                error = hipMemcpyPeerAsync(storage.splitters, devices[d],
+                                           storages[0].splitters, devices[0],
+                                           splitter_count * sizeof(Key), stream);
+                if(error != hipSuccess) return error;
+            }
+            size_t nested_size = storage.nested_storage_size;
+            error = ::rocprim::lower_bound(storage.nested_storage, nested_size,
+                                           storage.local_keys, storage.splitters, storage.positions,
+                                           sizes[d], splitter_count, less_type(), stream,
+                                           debug_synchronous);
+            if(error != hipSuccess) return error;
+            error = hipMemcpyAsync(device_positions, storage.positions,
+                                   splitter_count * sizeof(size_t), hipMemcpyDeviceToHost,
+                                   stream);
+            if(error != hipSuccess) return error;
+        }
+        device_positions[splitter_count] = sizes[d];
+    }
+    error = synchronize_all();
+    if(error != hipSuccess) return error;
+
+    // counts[s][t] keys of the device s go to the device t
+    const auto count = [&](unsigned int s, unsigned int t)
+    {
+        const size_t* const source_positions = positions.data() + s * (splitter_count + 1);
+        return source_positions[t] - (t == 0 ? 0 : source_positions[t - 1]);
+    };
+    for(unsigned int t = 0; t < device_count; t++)
+    {
+        output_sizes[t] = 0;
+        for(unsigned int s = 0; s < device_count; s++)
+        {
+            output_sizes[t] += count(s, t);
+        }
+        if(debug_synchronous)
+        {
+            std::cout << "device " << devices[t] << " output_size " << output_sizes[t] << '\n';
+        }
+        if(output_sizes[t] > output_capacities[t])
+        {
+            return hipErrorInvalidValue;
+        }
+    }
+
+    // The buckets are exchanged between the devices, the buckets received by a device are placed
+    // in the order of the source devices
+    std::vector<size_t> received(device_count, 0);
+    for(unsigned int s = 0; s < device_count; s++)
+    {
+        error = hipSetDevice(devices[s]);
+        if(error != hipSuccess) return error;
+        const hipStream_t stream = stream_of(s);
+        for(unsigned int t = 0; t < device_count; t++)
+        {
+            const size_t bucket_size = count(s, t);
+            if(bucket_size == 0)
+            {
+                continue;
+            }
+            const size_t bucket_offset = t == 0 ? 0 : positions[s * (splitter_count + 1) + t - 1];
+            error = hipMemcpyPeerAsync(storages[t].received_keys + received[t], devices[t],
+                                       storages[s].local_keys + bucket_offset, devices[s],
+                                       bucket_size * sizeof(Key), stream);
+            if(error != hipSuccess) return error;
+            error = hipMemcpyPeerAsync(storages[t].received_values + received[t], devices[t],
+                                       storages[s].local_values + bucket_offset, devices[s],
+                                       bucket_size * sizeof(Value), stream);
+            if(error != hipSuccess) return error;
+            received[t] += bucket_size;
+        }
+    }
+    error = synchronize_all();
+    if(error != hipSuccess) return error;
+
+    // Every device sorts the keys of its range
+    for(unsigned int d = 0; d < device_count; d++)
+    {
+        error = hipSetDevice(devices[d]);
+        if(error != hipSuccess) return error;
+        storage_type& storage     = storages[d];
+        size_t        nested_size = storage.nested_storage_size;
+        error = ::rocprim::radix_sort_pairs<Config, FloatOrder>(storage.nested_storage,
+                                                                nested_size,
+                                                                storage.received_keys,
+                                                                keys_output[d],
+                                                                storage.received_values,
+                                                                values_output[d],
+                                                                output_sizes[d],
+                                                                0,
+                                                                8 * sizeof(Key),
+                                                                stream_of(d),
+                                                                debug_synchronous);
+        if(error != hipSuccess) return error;
+    }
+    return hipSuccess;
+}
+
+} // end of detail namespace
+
+/// \brief Parallel ascending radix sort of key-value pairs distributed across several devices.
+///
+/// \p multi_device_radix_sort_pairs sorts the pairs of all devices together. The output of every
+/// device is sorted and holds a range of keys: all keys of a device are ordered before the keys
+/// of the next device.
+///
+/// \par Overview
+/// * Returns the required size of the temporary storage of every device in \p storage_sizes
+/// if \p temporary_storage is a null pointer. The temporary storage of a device must be allocated
+/// on that device.
+/// * \p Key type must be an arithmetic type (that is, an integral type or a floating-point type).
+/// Keys are ordered in the same way as by \p radix_sort_pairs.
+/// * Every device sorts its pairs with \p radix_sort_pairs and contributes evenly spaced samples of
+/// its sorted keys. The first device sorts the samples and picks the keys at their quantiles as
+/// splitters of the ranges. Every device finds the buckets of its sorted keys for the ranges with
+/// \p lower_bound, the buckets are exchanged with \p hipMemcpyPeerAsync, and every device sorts
+/// the received pairs with \p radix_sort_pairs.
+/// * The ranges hold similar numbers of keys unless there are many equal keys, which always end
+/// up on the same device. The output sizes are known only after the exchange, so the output of
+/// every device has a capacity; \p hipErrorInvalidValue is returned before the exchange if
+/// a range does not fit.
+/// * The copies go directly over the links between the devices (like xGMI) if peer access between
+/// them is enabled with \p hipDeviceEnablePeerAccess, otherwise they are staged through the host.
+/// * The function synchronizes the streams of all devices between the phases. The final sorts run
+/// asynchronously on the streams. The current device is restored.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p radix_sort_config or
+/// a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
+/// \tparam Key - key type.
+/// \tparam Value - value type.
+///
+/// \param [in] temporary_storage - pointer to an array of \p device_count pointers to the temporary
+/// storages of the devices. When a null pointer is passed, the required allocation sizes (in bytes)
+/// are written to \p storage_sizes and function returns without performing the sort operation.
+/// \param [in,out] storage_sizes - array of \p device_count sizes (in bytes) of the temporary
+/// storages.
+/// \param [in] devices - array of \p device_count device ids.
+/// \param [in] device_count - number of devices.
+/// \param [in] keys_input - array of pointers to the input keys of the devices.
+/// \param [out] keys_output - array of pointers to the output keys of the devices.
+/// \param [in] values_input - array of pointers to the input values of the devices.
+/// \param [out] values_output - array of pointers to the output values of the devices.
+/// \param [in] sizes - array of the numbers of input pairs of the devices.
+/// \param [in] output_capacities - array of the numbers of pairs that fit into the outputs of the
+/// devices.
+/// \param [out] output_sizes - array the numbers of sorted pairs of the devices are written to.
+/// \param [in] streams - [optional] array of \p device_count streams of the devices. Default is
+/// \p nullptr, the default streams are used.
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input (declare pointers, allocate device memory etc.) for 2 devices
+/// int devices[2] = {0, 1};
+/// size_t sizes[2];            // e.g., [4, 4]
+/// size_t capacities[2];       // e.g., [6, 6]
+/// int* keys_input[2];         // e.g., [[6, 3, 5, 4], [1, 8, 2, 7]]
+/// int* keys_output[2];
+/// double* values_input[2];    // e.g., [[-5, 2, -4, 3], [-1, -8, -2, 0]]
+/// double* values_output[2];
+///
+/// size_t storage_sizes[2];
+/// // Get required sizes of the temporary storages
+/// rocprim::multi_device_radix_sort_pairs(
+///     nullptr, storage_sizes, devices, 2, keys_input, keys_output,
+///     values_input, values_output, sizes, capacities, output_sizes
+/// );
+///
+/// // allocate temporary storages on the devices
+/// void* temporary_storage[2];
+/// hipSetDevice(0); hipMalloc(&temporary_storage[0], storage_sizes[0]);
+/// hipSetDevice(1); hipMalloc(&temporary_storage[1], storage_sizes[1]);
+///
+/// // perform sort
+/// size_t output_sizes[2];
+/// rocprim::multi_device_radix_sort_pairs(
+///     temporary_storage, storage_sizes, devices, 2, keys_input, keys_output,
+///     values_input, values_output, sizes, capacities, output_sizes
+/// );
+/// // output_sizes: [4, 4]
+/// // keys_output:   [[1, 2, 3, 4], [5, 6, 7, 8]]
+/// // values_output: [[-1, -2, 2, 3], [-4, -5, 0, -8]]
+/// \endcode
+/// \endparblock
+template<class Config                = default_config,
+         radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+         class Key,
+         class Value>
+inline hipError_t multi_device_radix_sort_pairs(void* const*        temporary_storage,
+                                                size_t*             storage_sizes,
+                                                const int*          devices,
+                                                const unsigned int  device_count,
+                                                const Key* const*   keys_input,
+                                                Key* const*         keys_output,
+                                                const Value* const* values_input,
+                                                Value* const*       values_output,
+                                                const size_t*       sizes,
+                                                const size_t*       output_capacities,
+                                                size_t*             output_sizes,
+                                                const hipStream_t*  streams           = nullptr,
+                                                const bool          debug_synchronous = false)
+{
+    if(device_count == 0)
+    {
+        return hipSuccess;
+    }
+    int        current_device;
+    hipError_t error = hipGetDevice(&current_device);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+    error = detail::multi_device_radix_sort_pairs_impl<Config, FloatOrder>(temporary_storage,
+                                                                          storage_sizes,
+                                                                          devices,
+                                                                          device_count,
+                                                                          keys_input,
+                                                                          keys_output,
+                                                                          values_input,
+                                                                          values_output,
+                                                                          sizes,
+                                                                          output_capacities,
+                                                                          output_sizes,
+                                                                          streams,
+                                                                          debug_synchronous);
+    const hipError_t restore_error = hipSetDevice(current_device);
+    return error != hipSuccess ? error : restore_error;
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_RADIX_SORT_MULTI_DEVICE_HPP_
@@ -0,0 +1,585 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef ROCPRIM_DEVICE_DEVICE_RADIX_SORT_OUT_OF_CORE_HPP_
+#define ROCPRIM_DEVICE_DEVICE_RADIX_SORT_OUT_OF_CORE_HPP_
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include "../config.hpp"
+#include "../detail/radix_sort.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../iterator/counting_iterator.hpp"
+#include "../types/double_buffer.hpp"
+
+#include "detail/device_binary_search.hpp"
+#include "detail/device_merge_k.hpp"
+#include "device_merge_k.hpp"
+#include "device_radix_sort.hpp"
+#include "device_transform.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+// Compares keys in the order of radix_sort
+template<class Key, radix_float_order FloatOrder>
+struct out_of_core_radix_key_less
+{
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    bool operator()(const Key& a, const Key& b) const
+    {
+        return radix_key_is_before<radix_key_codec<Key, false, FloatOrder>>(a, b);
+    }
+};
+
+// Computes how many keys of the block of a run can be merged before the blocks are loaded again.
+// The run whose last loaded key goes first (the one with the lowest index among equal keys) bounds
+// the window: all keys of the other runs going before that key are in their blocks, so they can be
+// merged, together with the equal keys of the runs placed before it, which keeps the merge stable.
+template<class Key, radix_float_order FloatOrder>
+struct out_of_core_merge_count_op
+{
+    const Key*    block_keys;
+    const size_t* block_sizes;
+    size_t        block_capacity;
+    unsigned int  runs;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    size_t operator()(const unsigned int run) const
+    {
+        const out_of_core_radix_key_less<Key, FloatOrder> less;
+        if(block_sizes[run] == 0)
+        {
+            return 0;
+        }
+        unsigned int bounding_run = runs;
+        for(unsigned int r = 0; r < runs; r++)
+        {
+            if(block_sizes[r] > 0
+               && (bounding_run == runs || less(last_key(r), last_key(bounding_run))))
+            {
+                bounding_run = r;
+            }
+        }
+        if(run == bounding_run)
+        {
+            return block_sizes[run];
+        }
+        const Key  bound = last_key(bounding_run);
+        const Key* keys  = block_keys + run * block_capacity;
+        return run < bounding_run ? upper_bound_n(keys, block_sizes[run], bound, less)
+                                  : lower_bound_n(keys, block_sizes[run], bound, less);
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    Key last_key(const unsigned int run) const
+    {
+        return block_keys[run * block_capacity + block_sizes[run] - 1];
+    }
+};
+
+// The second stream of the sorting of the chunks, it waits for the work enqueued to the stream
+// of the user before
+struct out_of_core_stream
+{
+    hipStream_t stream = nullptr;
+    hipEvent_t  event  = nullptr;
+
+    out_of_core_stream() = default;
+
+    out_of_core_stream(const out_of_core_stream&) = delete;
+    out_of_core_stream& operator=(const out_of_core_stream&) = delete;
+
+    hipError_t create(const hipStream_t dependency)
+    {
+        hipError_t error = hipStreamCreateWithFlags(&stream, hipStreamNonBlocking);
+        if(error != hipSuccess)
+        {
+            stream = nullptr;
+            return error;
+        }
+        error = hipEventCreateWithFlags(&event, hipEventDisableTiming);
+        if(error != hipSuccess)
+        {
+            event = nullptr;
+            return error;
+        }
+        error = hipEventRecord(event, dependency);
+        if(error != hipSuccess) return error;
+        return hipStreamWaitEvent(stream, event, 0);
+    }
+
+    ~out_of_core_stream()
+    {
+        if(stream != nullptr)
+        {
+            (void)hipStreamSynchronize(stream);
+            (void)hipStreamDestroy(stream);
+        }
+        if(event != nullptr)
+        {
+            (void)hipEventDestroy(event);
+        }
+    }
+};
+
+template<class Config, radix_float_order FloatOrder, class Key, class Value>
+inline hipError_t radix_sort_pairs_out_of_core_impl(void*             temporary_storage,
+                                                    size_t&           storage_size,
+                                                    const Key*        keys_input,
+                                                    Key*              keys_runs,
+                                                    Key*              keys_output,
+                                                    const Value*      values_input,
+                                                    Value*            values_runs,
+                                                    Value*            values_output,
+                                                    const size_t      size,
+                                                    const size_t      chunk_size,
+                                                    const hipStream_t stream,
+                                                    const bool        debug_synchronous)
+{
+    using less_type     = out_of_core_radix_key_less<Key, FloatOrder>;
+    using count_op_type = out_of_core_merge_count_op<Key, FloatOrder>;
+
+    if(chunk_size == 0)
+    {
+        return hipErrorInvalidValue;
+    }
+    const size_t runs_size = (size + chunk_size - 1) / chunk_size;
+    if(runs_size > merge_k_max_runs)
+    {
+        return hipErrorInvalidValue;
+    }
+    const unsigned int runs = static_cast<unsigned int>(runs_size);
+    // Runs are merged in windows of at most runs * block_capacity pairs, so the merge fits into
+    // the memory of the sorting of one chunk
+    const size_t merged_runs    = runs > 1 ? runs : 0;
+    const size_t max_window     = std::min(chunk_size,
+                                       size_t(std::numeric_limits<unsigned int>::max()));
+    const size_t block_capacity
+        = merged_runs > 0 ? std::max(size_t(1), max_window / merged_runs) : 0;
+    const size_t window_capacity = merged_runs * block_capacity;
+
+    Key*          chunk_keys[2][2];
+    Value*        chunk_values[2][2];
+    void*         sort_storage[2];
+    Key*          block_keys;
+    Value*        block_values;
+    Key*          window_keys;
+    Value*        window_values;
+    Key**         block_keys_ptrs;
+    Value**       block_values_ptrs;
+    size_t*       block_sizes;
+    size_t*       counts;
+    void*         merge_storage;
+
+    const size_t chunk_capacity = std::min(size, chunk_size);
+
+    size_t sort_bytes = 0;
+    {
+        double_buffer<Key>   keys;
+        double_buffer<Value> values;
+        hipError_t error = ::rocprim::radix_sort_pairs<Config, FloatOrder>(nullptr,
+                                                                           sort_bytes,
+                                                                           keys,
+                                                                           values,
+                                                                           chunk_capacity,
+                                                                           0,
+                                                                           8 * sizeof(Key),
+                                                                           stream);
+        if(error != hipSuccess) return error;
+    }
+    size_t merge_bytes = 0;
+    if(merged_runs > 0)
+    {
+        hipError_t error = ::rocprim::merge_k(nullptr,
+                                              merge_bytes,
+                                              block_keys_ptrs,
+                                              window_keys,
+                                              block_values_ptrs,
+                                              window_values,
+                                              counts,
+                                              runs,
+                                              window_capacity,
+                                              less_type(),
+                                              stream);
+        if(error != hipSuccess) return error;
+    }
+
+    // The chunks are sorted in two slots, so the copy of one chunk overlaps the sorting of the
+    // other one. The merge starts after all chunks are sorted, it reuses their memory.
+    hipError_t error = temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        temp_storage::make_union_partition(
+            temp_storage::make_linear_partition(
+                temp_storage::ptr_aligned_array(&chunk_keys[0][0], chunk_capacity),
+                temp_storage::ptr_aligned_array(&chunk_keys[0][1], chunk_capacity),
+                temp_storage::ptr_aligned_array(&chunk_values[0][0], chunk_capacity),
+                temp_storage::ptr_aligned_array(&chunk_values[0][1], chunk_capacity),
+                temp_storage::make_partition(&sort_storage[0], sort_bytes),
+                temp_storage::ptr_aligned_array(&chunk_keys[1][0], runs > 1 ? chunk_capacity : 0),
+                temp_storage::ptr_aligned_array(&chunk_keys[1][1], runs > 1 ? chunk_capacity : 0),
+                temp_storage::ptr_aligned_array(&chunk_values[1][0],
+                                                runs > 1 ? chunk_capacity : 0),
+                temp_storage::ptr_aligned_array(&chunk_values[1][1],
+                                                runs > 1 ? chunk_capacity : 0),
+                temp_storage::make_partition(&sort_storage[1], runs > 1 ? sort_bytes : 0)),
+            temp_storage::make_linear_partition(
+                temp_storage::ptr_aligned_array(&block_keys, window_capacity),
+                temp_storage::ptr_aligned_array(&block_values, window_capacity),
+                temp_storage::ptr_aligned_array(&window_keys, window_capacity),
+                temp_storage::ptr_aligned_array(&window_values, window_capacity),
+                temp_storage::ptr_aligned_array(&block_keys_ptrs, merged_runs),
+                temp_storage::ptr_aligned_array(&block_values_ptrs, merged_runs),
+                temp_storage::ptr_aligned_array(&block_sizes, merged_runs),
+                temp_storage::ptr_aligned_array(&counts, merged_runs),
+                temp_storage::make_partition(&merge_storage, merge_bytes))));
+    if(error != hipSuccess || temporary_storage == nullptr)
+    {
+        return error;
+    }
+
+    if(size == 0)
+    {
+        return hipSuccess;
+    }
+
+    if(debug_synchronous)
+    {
+        std::cout << "runs " << runs << '\n';
+        std::cout << "chunk_size " << chunk_capacity << '\n';
+        std::cout << "block_capacity " << block_capacity << '\n';
+    }
+
+    // Keys and values of a single run are sorted directly to the output
+    Key* const   sorted_keys   = runs > 1 ? keys_runs : keys_output;
+    Value* const sorted_values = runs > 1 ? values_runs : values_output;
+
+    const auto chunk_offset = [&](size_t chunk) { return chunk * chunk_size; };
+    const auto chunk_length
+        = [&](size_t chunk) { return std::min(chunk_size, size - chunk_offset(chunk)); };
+
+    {
+        out_of_core_stream second_stream;
+        if(runs > 1)
+        {
+            error = second_stream.create(stream);
+            if(error != hipSuccess) return error;
+        }
+        const hipStream_t chunk_streams[2] = {stream, second_stream.stream};
+
+        // The copy of the next chunk is enqueued before the sorting of the current one, so it is
+        // not delayed when radix_sort waits for its intermediate results
+        const auto load_chunk = [&](size_t chunk) -> hipError_t
+        {
+            const unsigned int slot = chunk % 2;
+            hipError_t         load_error
+                = hipMemcpyAsync(chunk_keys[slot][0], keys_input + chunk_offset(chunk),
+                                 chunk_length(chunk) * sizeof(Key), hipMemcpyHostToDevice,
+                                 chunk_streams[slot]);
+            if(load_error != hipSuccess) return load_error;
+            return hipMemcpyAsync(chunk_values[slot][0], values_input + chunk_offset(chunk),
+                                  chunk_length(chunk) * sizeof(Value), hipMemcpyHostToDevice,
+                                  chunk_streams[slot]);
+        };
+
+        error = load_chunk(0);
+        if(error != hipSuccess) return error;
+        for(size_t chunk = 0; chunk < runs; chunk++)
+        {
+            if(chunk + 1 < runs)
+            {
+                error = load_chunk(chunk + 1);
+                if(error != hipSuccess) return error;
+            }
+
+            const unsigned int   slot         = chunk % 2;
+            const hipStream_t    chunk_stream = chunk_streams[slot];
+            double_buffer<Key>   keys(chunk_keys[slot][0], chunk_keys[slot][1]);
+            double_buffer<Value> values(chunk_values[slot][0], chunk_values[slot][1]);
+            size_t               chunk_sort_bytes = sort_bytes;
+            error = ::rocprim::radix_sort_pairs<Config, FloatOrder>(sort_storage[slot],
+                                                                    chunk_sort_bytes,
+                                                                    keys,
+                                                                    values,
+                                                                    chunk_length(chunk),
+                                                                    0,
+                                                                    8 * sizeof(Key),
+                                                                    chunk_stream,
+                                                                    debug_synchronous);
+            if(error != hipSuccess) return error;
+
+            error = hipMemcpyAsync(sorted_keys + chunk_offset(chunk), keys.current(),
+                                   chunk_length(chunk) * sizeof(Key), hipMemcpyDeviceToHost,
+                                   chunk_stream);
+            if(error != hipSuccess) return error;
+            error = hipMemcpyAsync(sorted_values + chunk_offset(chunk), values.current(),
+                                   chunk_length(chunk) * sizeof(Value), hipMemcpyDeviceToHost,
+                                   chunk_stream);
+            if(error != hipSuccess) return error;
+        }
+
+        // The merge reads the runs from the host and reuses the memory of both slots
+        error = hipStreamSynchronize(stream);
+        if(error != hipSuccess) return error;
+        if(runs > 1)
+        {
+            error = hipStreamSynchronize(second_stream.stream);
+            if(error != hipSuccess) return error;
+        }
+    }
+    if(runs == 1)
+    {
+        return hipSuccess;
+    }
+
+    std::vector<Key*>   block_keys_host(runs);
+    std::vector<Value*> block_values_host(runs);
+    for(unsigned int run = 0; run < runs; run++)
+    {
+        block_keys_host[run]   = block_keys + run * block_capacity;
+        block_values_host[run] = block_values + run * block_capacity;
+    }
+    error = hipMemcpyAsync(block_keys_ptrs, block_keys_host.data(), runs * sizeof(Key*),
+                           hipMemcpyHostToDevice, stream);
+    if(error != hipSuccess) return error;
+    error = hipMemcpyAsync(block_values_ptrs, block_values_host.data(), runs * sizeof(Value*),
+                           hipMemcpyHostToDevice, stream);
+    if(error != hipSuccess) return error;
+
+    // Every window loads the next keys of all runs, merges the keys that go before the keys not
+    // loaded yet and copies them to the output. The keys that are not merged are loaded again by
+    // the next window.
+    std::vector<size_t> run_positions(runs, 0);
+    std::vector<size_t> block_sizes_host(runs);
+    std::vector<size_t> counts_host(runs);
+    const count_op_type count_op{block_keys, block_sizes, block_capacity, runs};
+    size_t              merged = 0;
+    while(merged < size)
+    {
+        for(unsigned int run = 0; run < runs; run++)
+        {
+            block_sizes_host[run]
+                = std::min(block_capacity, chunk_length(run) - run_positions[run]);
+            if(block_sizes_host[run] == 0)
+            {
+                continue;
+            }
+            const size_t source = chunk_offset(run) + run_positions[run];
+            error = hipMemcpyAsync(block_keys_host[run], keys_runs + source,
+                                   block_sizes_host[run] * sizeof(Key), hipMemcpyHostToDevice,
+                                   stream);
+            if(error != hipSuccess) return error;
+            error = hipMemcpyAsync(block_values_host[run], values_runs + source,
+                                   block_sizes_host[run] * sizeof(Value), hipMemcpyHostToDevice,
+                                   stream);
+            if(error != hipSuccess) return error;
+        }
+        error = hipMemcpyAsync(block_sizes, block_sizes_host.data(), runs * sizeof(size_t),
+                               hipMemcpyHostToDevice, stream);
+        if(error != hipSuccess) return error;
+
+        error = ::rocprim::transform(counting_iterator<unsigned int>(0),
+                                     counts,
+                                     runs,
+                                     count_op,
+                                     stream,
+                                     debug_synchronous);
+        if(error != hipSuccess) return error;
+        error = hipMemcpyAsync(counts_host.data(), counts, runs * sizeof(size_t),
+                               hipMemcpyDeviceToHost, stream);
+        if(error != hipSuccess) return error;
+        error = hipStreamSynchronize(stream);
+        if(error != hipSuccess) return error;
+
+        size_t window_size = 0;
+        for(unsigned int run = 0; run < runs; run++)
+        {
+            window_size += counts_host[run];
+            run_positions[run] += counts_host[run];
+        }
+        if(debug_synchronous)
+        {
+            std::cout << "window_size " << window_size << '\n';
+        }
+
+        size_t window_merge_bytes = merge_bytes;
+        error = ::rocprim::merge_k(merge_storage,
+                                   window_merge_bytes,
+                                   block_keys_ptrs,
+                                   window_keys,
+                                   block_values_ptrs,
+                                   window_values,
+                                   counts,
+                                   runs,
+                                   window_size,
+                                   less_type(),
+                                   stream,
+                                   debug_synchronous);
+        if(error != hipSuccess) return error;
+        error = hipMemcpyAsync(keys_output + merged, window_keys, window_size * sizeof(Key),
+                               hipMemcpyDeviceToHost, stream);
+        if(error != hipSuccess) return error;
+        error = hipMemcpyAsync(values_output + merged, window_values, window_size * sizeof(Value),
+                               hipMemcpyDeviceToHost, stream);
+        if(error != hipSuccess) return error;
+        merged += window_size;
+    }
+    return hipStreamSynchronize(stream);
+}
+
+} // end namespace detail
+
+/// \brief Radix sort of key-value pairs which are stored in host memory and do not fit into
+/// the memory of the device.
+///
+/// \par Overview
+/// * The input is sorted in chunks of \p chunk_size pairs. The copies of a chunk to the device
+/// overlap the sorting of the previous chunk and the copy of its sorted run back to
+/// \p keys_runs and \p values_runs, which requires two streams: \p stream and another stream
+/// created by the function.
+/// * The runs are merged in windows bounded by the temporary storage: every window loads the next
+/// keys of all runs to the device, merges the ones that go before all keys which are not loaded
+/// yet with \p merge_k and copies them to the output.
+/// * The required temporary storage depends on \p chunk_size and not on \p size, it is about the
+/// storage of \p radix_sort_pairs of one chunk per slot, for two slots.
+/// * The number of chunks must not be greater than 256, otherwise the function returns
+/// \p hipErrorInvalidValue.
+/// * The inputs, the runs and the outputs are in host memory. They should be page-locked
+/// (allocated with \p hipHostMalloc), the copies of pageable memory do not overlap the sorting.
+/// * When the input fits into one chunk, the runs are not used and the sorted pairs are copied
+/// directly to the output.
+/// * The function returns when the output is written, it synchronizes \p stream.
+/// * The order of the keys is the order of \p radix_sort_pairs and the sort is stable.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p radix_sort_config or
+/// a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
+/// \tparam Key - key type.
+/// \tparam Value - value type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the host range to sort.
+/// \param [out] keys_runs - pointer to the first element in the host range of \p size keys the
+/// sorted runs are written to. It can be \p nullptr when \p size is not greater than
+/// \p chunk_size.
+/// \param [out] keys_output - pointer to the first element in the host output range.
+/// \param [in] values_input - pointer to the first element in the host range of values.
+/// \param [out] values_runs - pointer to the first element in the host range of \p size values
+/// of the sorted runs. It can be \p nullptr when \p size is not greater than \p chunk_size.
+/// \param [out] values_output - pointer to the first element in the host output range of values.
+/// \param [in] size - number of pairs to sort.
+/// \param [in] chunk_size - number of pairs sorted on the device at once.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output in page-locked host memory
+/// size_t size;            // e.g., 8
+/// size_t chunk_size;      // e.g., 4
+/// int* keys_input;        // e.g., [6, 3, 5, 4, 1, 8, 2, 7]
+/// int* keys_runs;         // host array of 8 elements
+/// int* keys_output;       // host array of 8 elements
+/// double* values_input;   // e.g., [-5, 2, -4, 3, -1, -8, -2, 7]
+/// double* values_runs;    // host array of 8 elements
+/// double* values_output;  // host array of 8 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::radix_sort_pairs_out_of_core(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input, keys_runs, keys_output,
+///     values_input, values_runs, values_output,
+///     size, chunk_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform sort
+/// rocprim::radix_sort_pairs_out_of_core(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input, keys_runs, keys_output,
+///     values_input, values_runs, values_output,
+///     size, chunk_size
+/// );
+/// // keys_output:   [ 1,  2, 3, 4,  5,  6, 7,  8]
+/// // values_output: [-1, -2, 2, 3, -4, -5, 7, -8]
+/// \endcode
+/// \endparblock
+template<class Config                = default_config,
+         radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+         class Key,
+         class Value>
+inline hipError_t radix_sort_pairs_out_of_core(void*             temporary_storage,
+                                               size_t&           storage_size,
+                                               const Key*        keys_input,
+                                               Key*              keys_runs,
+                                               Key*              keys_output,
+                                               const Value*      values_input,
+                                               Value*            values_runs,
+                                               Value*            values_output,
+                                               const size_t      size,
+                                               const size_t      chunk_size,
+                                               const hipStream_t stream            = 0,
+                                               const bool        debug_synchronous = false)
+{
+    return detail::radix_sort_pairs_out_of_core_impl<Config, FloatOrder>(temporary_storage,
+                                                                        storage_size,
+                                                                        keys_input,
+                                                                        keys_runs,
+                                                                        keys_output,
+                                                                        values_input,
+                                                                        values_runs,
+                                                                        values_output,
+                                                                        size,
+                                                                        chunk_size,
+                                                                        stream,
+                                                                        debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_RADIX_SORT_OUT_OF_CORE_HPP_
@@ -29,13 +29,23 @@
 #include "config_types.hpp"
 
 #include "../config.hpp"
+#include "../functional.hpp"
+#include "../detail/all_true.hpp"
 #include "../detail/match_result_type.hpp"
 #include "../detail/temp_storage.hpp"
 #include "../detail/various.hpp"
+#include "../iterator/transform_iterator.hpp"
+#include "../iterator/zip_iterator.hpp"
+#include "../types/tuple.hpp"
+#include "../types/future_value.hpp"
 
+#include "detail/device_accumulator.hpp"
 #include "detail/device_config_helper.hpp"
+#include "detail/device_instantiations.hpp"
 #include "detail/device_reduce.hpp"
+#include "detail/device_reproducible_sum.hpp"
 #include "device_reduce_config.hpp"
+#include "instrumentation.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -64,7 +74,51 @@ ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().block_size) void block_
     );
 }
 
+template<bool WithInitialValue,
+         class Config,
+         class ResultType,
+         class InputIterator,
+         class OutputIterator,
+         class InitValueType,
+         class BinaryFunction>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().block_size) void single_pass_reduce_kernel(
+    InputIterator  input,
+    const size_t   size,
+    OutputIterator output,
+    InitValueType  initial_value,
+    BinaryFunction reduce_op,
+    ResultType*    block_partials,
+    unsigned int*  ticket_counter)
+{
+    single_pass_reduce_kernel_impl<WithInitialValue, Config, ResultType>(
+        input, size, output, initial_value, reduce_op, block_partials, ticket_counter
+    );
+}
+
+template<bool WithInitialValue,
+         class Config,
+         class ResultType,
+         class InputIterator,
+         class SizeType,
+         class OutputIterator,
+         class InitValueType,
+         class BinaryFunction>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().block_size) void block_reduce_future_size_kernel(
+    InputIterator  input,
+    const SizeType size,
+    const size_t   offset,
+    OutputIterator output,
+    InitValueType  initial_value,
+    BinaryFunction reduce_op,
+    size_t*        nested_size)
+{
+    block_reduce_future_size_kernel_impl<WithInitialValue, Config, ResultType>(
+        input, size, offset, output, initial_value, reduce_op, nested_size
+    );
+}
+
 #define ROCPRIM_DETAIL_HIP_SYNC(name, size, start) \
+    ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
     if(debug_synchronous) \
     { \
         std::cout << name << "(" << size << ")"; \
@@ -79,6 +133,7 @@ ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().block_size) void block_
     { \
         auto _error = hipGetLastError(); \
         if(_error != hipSuccess) return _error; \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
         if(debug_synchronous) \
         { \
             std::cout << name << "(" << size << ")"; \
@@ -100,15 +155,15 @@ template<
     class BinaryFunction
 >
 inline
-hipError_t reduce_impl(void * temporary_storage,
-                       size_t& storage_size,
-                       InputIterator input,
-                       OutputIterator output,
-                       const InitValueType initial_value,
-                       const size_t size,
-                       BinaryFunction reduce_op,
-                       const hipStream_t stream,
-                       bool debug_synchronous)
+hipError_t reduce_config_impl(void * temporary_storage,
+                              size_t& storage_size,
+                              InputIterator input,
+                              OutputIterator output,
+                              const InitValueType initial_value,
+                              const size_t size,
+                              BinaryFunction reduce_op,
+                              const hipStream_t stream,
+                              bool debug_synchronous)
 {
     using input_type = typename std::iterator_traits<InputIterator>::value_type;
     using result_type = typename ::rocprim::detail::match_result_type<
@@ -130,6 +185,63 @@ hipError_t reduce_impl(void * temporary_storage,
     const auto         items_per_block  = block_size * items_per_thread;
 
     const size_t number_of_blocks  = (size + items_per_block - 1) / items_per_block;
+
+    // A grid limited by blocks_per_cu or scoped_grid_limit is reduced by the single-pass
+    // kernel, which already reduces multiple tiles per block
+    if((params.single_pass || params.blocks_per_cu > 0 || get_grid_limit() > 0)
+       && number_of_blocks > 1
+       && size <= params.size_limit)
+    {
+        // The last block reduces all partial results in one tile
+        size_t max_grid_size = items_per_block;
+        result               = limit_grid_size(max_grid_size, params.blocks_per_cu);
+        if(result != hipSuccess)
+        {
+            return result;
+        }
+        const unsigned int single_pass_blocks
+            = static_cast<unsigned int>(std::min<size_t>(number_of_blocks, max_grid_size));
+
+        result_type*  block_partials;
+        unsigned int* ticket_counter;
+
+        const hipError_t partition_result = detail::temp_storage::partition(
+            temporary_storage,
+            storage_size,
+            detail::temp_storage::make_linear_partition(
+                detail::temp_storage::ptr_aligned_array(&block_partials, single_pass_blocks),
+                detail::temp_storage::ptr_aligned_array(&ticket_counter, 1)));
+        if(partition_result != hipSuccess || temporary_storage == nullptr)
+        {
+            return partition_result;
+        }
+
+        std::chrono::high_resolution_clock::time_point start;
+
+        if(debug_synchronous)
+        {
+            std::cout << "block_size " << block_size << '\n';
+            std::cout << "number of blocks " << single_pass_blocks << '\n';
+            std::cout << "items_per_block " << items_per_block << '\n';
+            start = std::chrono::high_resolution_clock::now();
+        }
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("single_pass_reduce_kernel");
+
+        result = hipMemsetAsync(ticket_counter, 0, sizeof(*ticket_counter), stream);
+        if(result != hipSuccess)
+        {
+            return result;
+        }
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(detail::single_pass_reduce_kernel<WithInitialValue, config, result_type>),
+            dim3(single_pass_blocks), dim3(block_size), 0, stream,
+            input, size, output, initial_value, reduce_op, block_partials, ticket_counter
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("single_pass_reduce_kernel", size, start);
+
+        return hipSuccess;
+    }
+
     const size_t block_prefix_size = size <= items_per_block ? 0 : number_of_blocks;
 
     // Pointer to array with block_prefixes
@@ -140,15 +252,15 @@ hipError_t reduce_impl(void * temporary_storage,
     if(number_of_blocks > 1)
     {
         const hipError_t nested_result
-            = reduce_impl<WithInitialValue, Config>(nullptr,
-                                                    nested_temp_storage_size,
-                                                    block_prefixes, // input
-                                                    output, // output
-                                                    initial_value,
-                                                    number_of_blocks, // input size
-                                                    reduce_op,
-                                                    stream,
-                                                    debug_synchronous);
+            = reduce_config_impl<WithInitialValue, Config>(nullptr,
+                                                           nested_temp_storage_size,
+                                                           block_prefixes, // input
+                                                           output, // output
+                                                           initial_value,
+                                                           number_of_blocks, // input size
+                                                           reduce_op,
+                                                           stream,
+                                                           debug_synchronous);
         if(nested_result != hipSuccess)
         {
             return nested_result;
@@ -193,6 +305,7 @@ hipError_t reduce_impl(void * temporary_storage,
             const auto current_blocks = (current_size + items_per_block - 1) / items_per_block;
 
             if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+            ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("block_reduce_kernel");
             hipLaunchKernelGGL(
                 HIP_KERNEL_NAME(detail::block_reduce_kernel<false, config, result_type>),
                 dim3(current_blocks),
@@ -208,21 +321,23 @@ hipError_t reduce_impl(void * temporary_storage,
         }
 
         if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
-        auto error = reduce_impl<WithInitialValue, Config>(nested_temp_storage,
-                                                           nested_temp_storage_size,
-                                                           block_prefixes, // input
-                                                           output, // output
-                                                           initial_value,
-                                                           number_of_blocks, // input size
-                                                           reduce_op,
-                                                           stream,
-                                                           debug_synchronous);
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("nested_device_reduce");
+        auto error = reduce_config_impl<WithInitialValue, Config>(nested_temp_storage,
+                                                                  nested_temp_storage_size,
+                                                                  block_prefixes, // input
+                                                                  output, // output
+                                                                  initial_value,
+                                                                  number_of_blocks, // input size
+                                                                  reduce_op,
+                                                                  stream,
+                                                                  debug_synchronous);
         if(error != hipSuccess) return error;
         ROCPRIM_DETAIL_HIP_SYNC("nested_device_reduce", number_of_blocks, start);
     }
     else
     {
         if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("block_reduce_kernel");
         hipLaunchKernelGGL(
             HIP_KERNEL_NAME(detail::block_reduce_kernel<WithInitialValue, config, result_type>),
             dim3(1), dim3(block_size), 0, stream,
@@ -234,26 +349,377 @@ hipError_t reduce_impl(void * temporary_storage,
     return hipSuccess;
 }
 
+// Resolves the bucket of size_bucketed_config, the nested reductions of the block prefixes
+// use the same config as the whole reduction
+template<
+    bool WithInitialValue,
+    class Config,
+    class InputIterator,
+    class OutputIterator,
+    class InitValueType,
+    class BinaryFunction
+>
+inline
+hipError_t reduce_impl(void * temporary_storage,
+                       size_t& storage_size,
+                       InputIterator input,
+                       OutputIterator output,
+                       const InitValueType initial_value,
+                       const size_t size,
+                       BinaryFunction reduce_op,
+                       const hipStream_t stream,
+                       bool debug_synchronous)
+{
+    return dispatch_size_bucket<Config>(
+        size,
+        [&](auto config)
+        {
+            return reduce_config_impl<WithInitialValue, decltype(config)>(temporary_storage,
+                                                                          storage_size,
+                                                                          input,
+                                                                          output,
+                                                                          initial_value,
+                                                                          size,
+                                                                          reduce_op,
+                                                                          stream,
+                                                                          debug_synchronous);
+        });
+}
+
+template<class Config, class InputIterator, class OutputIterator>
+inline hipError_t deterministic_reduce_impl(void*             temporary_storage,
+                                            size_t&           storage_size,
+                                            InputIterator     input,
+                                            OutputIterator    output,
+                                            const size_t      size,
+                                            const hipStream_t stream,
+                                            bool              debug_synchronous)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+    using split_op   = reproducible_sum_split_op<input_type>;
+    using to_value   = reproducible_sum_to_value_op<input_type>;
+
+    const int digit_bits = reproducible_sum_digit_bits(size);
+
+    double* max_abs{};
+    void*   max_abs_temp_storage{};
+    void*   sum_temp_storage{};
+
+    // The largest magnitude defines the grid, it is computed using the exact maximum operator
+    const auto max_abs_input
+        = ::rocprim::make_transform_iterator(input, reproducible_sum_max_abs_op<input_type>());
+
+    size_t     max_abs_temp_storage_size = 0;
+    hipError_t result                    = reduce_impl<true, Config>(nullptr,
+                                                     max_abs_temp_storage_size,
+                                                     max_abs_input,
+                                                     max_abs,
+                                                     0.0,
+                                                     size,
+                                                     ::rocprim::maximum<double>(),
+                                                     stream,
+                                                     debug_synchronous);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    size_t sum_temp_storage_size = 0;
+    result                       = reduce_impl<false, Config>(
+        nullptr,
+        sum_temp_storage_size,
+        ::rocprim::make_transform_iterator(input, split_op{max_abs, digit_bits}),
+        reproducible_sum_output_iterator<OutputIterator, input_type>(output,
+                                                                     to_value{max_abs, digit_bits}),
+        reproducible_sum_accumulator{},
+        size,
+        reproducible_sum_op(),
+        stream,
+        debug_synchronous);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&max_abs, 1),
+            detail::temp_storage::make_union_partition(
+                detail::temp_storage::make_partition(&max_abs_temp_storage,
+                                                     max_abs_temp_storage_size),
+                detail::temp_storage::make_partition(&sum_temp_storage, sum_temp_storage_size))));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    result = reduce_impl<true, Config>(max_abs_temp_storage,
+                                       max_abs_temp_storage_size,
+                                       max_abs_input,
+                                       max_abs,
+                                       0.0,
+                                       size,
+                                       ::rocprim::maximum<double>(),
+                                       stream,
+                                       debug_synchronous);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    return reduce_impl<false, Config>(
+        sum_temp_storage,
+        sum_temp_storage_size,
+        ::rocprim::make_transform_iterator(input, split_op{max_abs, digit_bits}),
+        reproducible_sum_output_iterator<OutputIterator, input_type>(output,
+                                                                     to_value{max_abs, digit_bits}),
+        reproducible_sum_accumulator{},
+        size,
+        reproducible_sum_op(),
+        stream,
+        debug_synchronous);
+}
+
+// Reduction with a size which is only known on the device. Every level is sized for the upper bound
+// max_size, the number of partial results (the size of the next level) is stored by the first block.
+template<
+    bool WithInitialValue,
+    class Config,
+    class InputIterator,
+    class OutputIterator,
+    class InitValueType,
+    class SizeType,
+    class BinaryFunction
+>
+inline
+hipError_t reduce_future_size_impl(void * temporary_storage,
+                                   size_t& storage_size,
+                                   InputIterator input,
+                                   OutputIterator output,
+                                   const InitValueType initial_value,
+                                   const SizeType size,
+                                   const size_t max_size,
+                                   BinaryFunction reduce_op,
+                                   const hipStream_t stream,
+                                   bool debug_synchronous)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+    using result_type = typename ::rocprim::detail::match_result_type<
+        input_type, BinaryFunction
+    >::type;
+
+    using config = wrapped_reduce_config<Config, result_type>;
+
+    detail::target_arch target_arch;
+    hipError_t          result = host_target_arch(stream, target_arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const reduce_config_params params = dispatch_target_arch<config>(target_arch);
+
+    const unsigned int block_size       = params.block_size;
+    const unsigned int items_per_thread = params.items_per_thread;
+    const auto         items_per_block  = block_size * items_per_thread;
+
+    const size_t number_of_blocks
+        = ::rocprim::max<size_t>((max_size + items_per_block - 1) / items_per_block, 1);
+
+    using nested_size_type = ::rocprim::future_value<size_t, size_t*>;
+
+    // Pointer to array with block_prefixes
+    result_type* block_prefixes{};
+    size_t*      nested_size{};
+    void*        nested_temp_storage{};
+
+    size_t nested_temp_storage_size = 0;
+    if(number_of_blocks > 1)
+    {
+        const hipError_t nested_result
+            = reduce_future_size_impl<WithInitialValue, Config>(nullptr,
+                                                                nested_temp_storage_size,
+                                                                block_prefixes, // input
+                                                                output, // output
+                                                                initial_value,
+                                                                nested_size_type(nested_size),
+                                                                number_of_blocks, // input size
+                                                                reduce_op,
+                                                                stream,
+                                                                debug_synchronous);
+        if(nested_result != hipSuccess)
+        {
+            return nested_result;
+        }
+    }
+
+    const size_t block_prefix_size = number_of_blocks > 1 ? number_of_blocks : 0;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&block_prefixes, block_prefix_size),
+            detail::temp_storage::ptr_aligned_array(&nested_size, block_prefix_size > 0 ? 1 : 0),
+            detail::temp_storage::make_partition(&nested_temp_storage,
+                                                 nested_temp_storage_size,
+                                                 alignof(result_type))));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    // Start point for time measurements
+    std::chrono::high_resolution_clock::time_point start;
+
+    const auto size_limit             = params.size_limit;
+    const auto number_of_blocks_limit = ::rocprim::max<size_t>(size_limit / items_per_block, 1);
+
+    if(debug_synchronous)
+    {
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << number_of_blocks << '\n';
+        std::cout << "number of blocks limit " << number_of_blocks_limit << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+    }
+
+    if(number_of_blocks > 1)
+    {
+        const auto aligned_size_limit = number_of_blocks_limit * items_per_block;
+
+        // Every launch reads the size and skips the blocks past it
+        const auto number_of_launch = (max_size + aligned_size_limit - 1) / aligned_size_limit;
+        for(size_t i = 0, offset = 0; i < number_of_launch; ++i, offset += aligned_size_limit) {
+            const auto current_size = std::min<size_t>(max_size - offset, aligned_size_limit);
+            const auto current_blocks = (current_size + items_per_block - 1) / items_per_block;
+
+            if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+            ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("block_reduce_future_size_kernel");
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(detail::block_reduce_future_size_kernel<false, config, result_type>),
+                dim3(current_blocks),
+                dim3(block_size),
+                0,
+                stream,
+                input + offset,
+                size,
+                offset,
+                block_prefixes + i * number_of_blocks_limit,
+                initial_value,
+                reduce_op,
+                nested_size);
+            ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(
+                "block_reduce_future_size_kernel", current_size, start);
+        }
+
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("nested_device_reduce");
+        auto error = reduce_future_size_impl<WithInitialValue, Config>(nested_temp_storage,
+                                                                       nested_temp_storage_size,
+                                                                       block_prefixes, // input
+                                                                       output, // output
+                                                                       initial_value,
+                                                                       nested_size_type(nested_size),
+                                                                       number_of_blocks, // input size
+                                                                       reduce_op,
+                                                                       stream,
+                                                                       debug_synchronous);
+        if(error != hipSuccess) return error;
+        ROCPRIM_DETAIL_HIP_SYNC("nested_device_reduce", number_of_blocks, start);
+    }
+    else
+    {
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("block_reduce_future_size_kernel");
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(detail::block_reduce_future_size_kernel<WithInitialValue, config, result_type>),
+            dim3(1), dim3(block_size), 0, stream,
+            input, size, size_t(0), output, initial_value, reduce_op, static_cast<size_t*>(nullptr)
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("block_reduce_future_size_kernel", max_size, start);
+    }
+
+    return hipSuccess;
+}
+
 #undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
 #undef ROCPRIM_DETAIL_HIP_SYNC
 
+// Converts an input value to a tuple of copies, one accumulator of each reduction of multi_reduce
+template<class... Results>
+struct multi_reduce_broadcast_op
+{
+    template<class T>
+    ROCPRIM_HOST_DEVICE inline
+    ::rocprim::tuple<Results...> operator()(const T& value) const
+    {
+        return ::rocprim::tuple<Results...>(static_cast<Results>(value)...);
+    }
+};
+
+// Reduces every component of the tuples with its own operator
+template<class... BinaryFunctions>
+struct multi_reduce_op
+{
+    ::rocprim::tuple<BinaryFunctions...> reduce_ops;
+
+    template<class... Results>
+    ROCPRIM_HOST_DEVICE inline
+    ::rocprim::tuple<Results...> operator()(const ::rocprim::tuple<Results...>& a,
+                                            const ::rocprim::tuple<Results...>& b) const
+    {
+        return reduce(a, b, ::rocprim::index_sequence_for<Results...>{});
+    }
+
+private:
+    template<class... Results, size_t... Indices>
+    ROCPRIM_HOST_DEVICE inline
+    ::rocprim::tuple<Results...> reduce(const ::rocprim::tuple<Results...>& a,
+                                        const ::rocprim::tuple<Results...>& b,
+                                        ::rocprim::index_sequence<Indices...>) const
+    {
+        return ::rocprim::tuple<Results...>(::rocprim::get<Indices>(reduce_ops)(
+            ::rocprim::get<Indices>(a),
+            ::rocprim::get<Indices>(b))...);
+    }
+};
+
 } // end of detail namespace
 
+/// \brief The reduction of \p multi_reduce is commutative if all of its operators are.
+template<class... BinaryFunctions>
+struct is_commutative<detail::multi_reduce_op<BinaryFunctions...>>
+    : std::integral_constant<bool,
+                             detail::all_true<is_commutative<BinaryFunctions>::value...>::value>
+{};
+
 /// \brief Parallel reduction primitive for device level.
 ///
 /// reduce function performs a device-wide reduction operation
 /// using binary \p reduce_op operator.
 ///
 /// \par Overview
-/// * Does not support non-commutative reduction operators. Reduction operator should also be
-/// associative. When used with non-associative functions the results may be non-deterministic
-/// and/or vary in precision.
+/// * Supports non-commutative reduction operators, which combine the items in their order.
+/// However, a reduction operator should be associative. When used with non-associative functions
+/// the results may be non-deterministic and/or vary in precision.
+/// * Commutative operators (\p rocprim::is_commutative, which can be specialized for custom
+/// operators) are faster: each thread reduces items striped across the block, loaded as vectors
+/// when \p input is a pointer.
 /// * Returns the required size of \p temporary_storage in \p storage_size
 /// if \p temporary_storage in a null pointer.
 /// * Ranges specified by \p input must have at least \p size elements, while \p output
 /// only needs one element.
-/// * By default, the input type is used for accumulation. A custom type
-/// can be specified using <tt>rocprim::transform_iterator</tt>, see the example below.
+/// * By default, the input type is used for accumulation. A custom type can be specified
+/// with \p AccumulatorType, the input is still loaded as its own type (as vectors when \p input
+/// is a pointer) and converted in registers. A <tt>rocprim::transform_iterator</tt> can be
+/// used too, see the example below.
+/// * The result type of \p reduce_op is used for accumulation too, so \p rocprim::half and
+/// \p rocprim::bfloat16 inputs are accumulated in fp32 with <tt>rocprim::plus<float></tt>.
+/// Sums with <tt>rocprim::plus<rocprim::half></tt> add pairs of items of each thread with
+/// packed instructions.
+/// * Data in pinned host memory can be reduced in place through a \p mapped_host_iterator
+/// instead of being copied to device memory first, each element is read once. Managed memory
+/// should be migrated with \p mapped_host_iterator::prefetch() before the reduction, the
+/// migration page by page on first touch is much slower.
 ///
 /// \tparam Config - [optional] configuration of the primitive. It can be \p reduce_config or
 /// a custom class with the same members.
@@ -264,6 +730,8 @@ hipError_t reduce_impl(void * temporary_storage,
 /// \tparam InitValueType - type of the initial value.
 /// \tparam BinaryFunction - type of binary function used for reduction. Default type
 /// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+/// \tparam AccumulatorType - [optional] type used for accumulation, the input is converted to it
+/// before \p reduce_op is applied. The default (\p void) is the result type of \p reduce_op.
 ///
 /// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
 /// a null pointer is passed, the required allocation size (in bytes) is written to
@@ -367,9 +835,11 @@ template<
     class InputIterator,
     class OutputIterator,
     class InitValueType,
-    class BinaryFunction = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>
+    class BinaryFunction
+        = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>,
+    class AccumulatorType = void
 >
-inline
+// Not inline, see detail/device_instantiations.hpp
 hipError_t reduce(void * temporary_storage,
                  size_t& storage_size,
                  InputIterator input,
@@ -380,9 +850,15 @@ hipError_t reduce(void * temporary_storage,
                  const hipStream_t stream = 0,
                  bool debug_synchronous = false)
 {
+    using accumulator_type = detail::resolve_accumulator_type_t<
+        AccumulatorType,
+        typename std::iterator_traits<InputIterator>::value_type,
+        BinaryFunction>;
+
     return detail::reduce_impl<true, Config>(
         temporary_storage, storage_size,
-        input, output, initial_value, size,
+        detail::to_accumulator_input<accumulator_type>(detail::to_kernel_input_iterator(input)),
+        output, initial_value, size,
         reduce_op, stream, debug_synchronous
     );
 }
@@ -393,15 +869,24 @@ hipError_t reduce(void * temporary_storage,
 /// using binary \p reduce_op operator.
 ///
 /// \par Overview
-/// * Does not support non-commutative reduction operators. Reduction operator should also be
-/// associative. When used with non-associative functions the results may be non-deterministic
-/// and/or vary in precision.
+/// * Supports non-commutative reduction operators, which combine the items in their order.
+/// However, a reduction operator should be associative. When used with non-associative functions
+/// the results may be non-deterministic and/or vary in precision.
+/// * Commutative operators (\p rocprim::is_commutative, which can be specialized for custom
+/// operators) are faster: each thread reduces items striped across the block, loaded as vectors
+/// when \p input is a pointer.
 /// * Returns the required size of \p temporary_storage in \p storage_size
 /// if \p temporary_storage in a null pointer.
 /// * Ranges specified by \p input must have at least \p size elements, while \p output
 /// only needs one element.
-/// * By default, the input type is used for accumulation. A custom type
-/// can be specified using <tt>rocprim::transform_iterator</tt>, see the example below.
+/// * By default, the input type is used for accumulation. A custom type can be specified
+/// with \p AccumulatorType, the input is still loaded as its own type (as vectors when \p input
+/// is a pointer) and converted in registers. A <tt>rocprim::transform_iterator</tt> can be
+/// used too, see the example below.
+/// * The result type of \p reduce_op is used for accumulation too, so \p rocprim::half and
+/// \p rocprim::bfloat16 inputs are accumulated in fp32 with <tt>rocprim::plus<float></tt>.
+/// Sums with <tt>rocprim::plus<rocprim::half></tt> add pairs of items of each thread with
+/// packed instructions.
 ///
 /// \tparam Config - [optional] configuration of the primitive. It can be \p reduce_config or
 /// a custom class with the same members.
@@ -411,6 +896,8 @@ hipError_t reduce(void * temporary_storage,
 /// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
 /// \tparam BinaryFunction - type of binary function used for reduction. Default type
 /// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+/// \tparam AccumulatorType - [optional] type used for accumulation, the input is converted to it
+/// before \p reduce_op is applied. The default (\p void) is the result type of \p reduce_op.
 ///
 /// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
 /// a null pointer is passed, the required allocation size (in bytes) is written to
@@ -497,9 +984,11 @@ template<
     class Config = default_config,
     class InputIterator,
     class OutputIterator,
-    class BinaryFunction = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>
+    class BinaryFunction
+        = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>,
+    class AccumulatorType = void
 >
-inline
+// Not inline, see detail/device_instantiations.hpp
 hipError_t reduce(void * temporary_storage,
                   size_t& storage_size,
                   InputIterator input,
@@ -510,17 +999,465 @@ hipError_t reduce(void * temporary_storage,
                   bool debug_synchronous = false)
 {
     using input_type = typename std::iterator_traits<InputIterator>::value_type;
+    using accumulator_type
+        = detail::resolve_accumulator_type_t<AccumulatorType, input_type, BinaryFunction>;
 
     return detail::reduce_impl<false, Config>(
         temporary_storage, storage_size,
-        input, output, input_type(), size,
+        detail::to_accumulator_input<accumulator_type>(detail::to_kernel_input_iterator(input)),
+        output, input_type(), size,
         reduce_op, stream, debug_synchronous
     );
 }
 
+/// \brief Parallel reduction primitive for device level with a size computed on the device.
+///
+/// reduce function performs a device-wide reduction operation
+/// using binary \p reduce_op operator. The number of elements is read on the device, so it
+/// can be the output of a previous primitive (for example the selected count of \p select)
+/// without synchronizing with the host.
+///
+/// \par Overview
+/// * Supports non-commutative reduction operators, which combine the items in their order.
+/// However, a reduction operator should be associative. When used with non-associative functions
+/// the results may be non-deterministic and/or vary in precision.
+/// * Commutative operators (\p rocprim::is_commutative, which can be specialized for custom
+/// operators) are faster: each thread reduces items striped across the block, loaded as vectors
+/// when \p input is a pointer.
+/// * The grid is sized for \p max_size elements, blocks past the actual size exit early.
+/// * The value of \p size must not be greater than \p max_size.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input must have at least \p size elements, while \p output
+/// only needs one element.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p reduce_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam InitValueType - type of the initial value.
+/// \tparam Size - integral type of the number of elements.
+/// \tparam SizeIterator - iterator type of the device location of the number of elements.
+/// \tparam BinaryFunction - type of binary function used for reduction. Default type
+/// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to reduce.
+/// \param [out] output - iterator to the first element in the output range. It can be
+/// same as \p input.
+/// \param [in] initial_value - initial value to start the reduction.
+/// \param [in] size - number of element in the input range, read on the device.
+/// \param [in] max_size - upper bound of \p size, used to size the grid and the temporary storage.
+/// \param [in] reduce_op - binary operation function object that will be used for reduction.
+/// The signature of the function should be equivalent to the following:
+/// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the selected values of \p select are summed without copying
+/// the number of selected values to the host.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;             // e.g., 8
+/// int * selected;                // e.g., [1, 3, 5, 7, -, -, -, -], selected by rocprim::select
+/// unsigned int * selected_count; // e.g., [4], selected count of rocprim::select
+/// int * output;                  // empty array of 1 element
+///
+/// const auto size = rocprim::future_value<unsigned int>(selected_count);
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::reduce(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     selected, output, 0, size, input_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform reduce
+/// rocprim::reduce(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     selected, output, 0, size, input_size
+/// );
+/// // output: [16]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class InputIterator,
+    class OutputIterator,
+    class InitValueType,
+    class Size,
+    class SizeIterator,
+    class BinaryFunction = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>
+>
+inline
+hipError_t reduce(void * temporary_storage,
+                  size_t& storage_size,
+                  InputIterator input,
+                  OutputIterator output,
+                  const InitValueType initial_value,
+                  const ::rocprim::future_value<Size, SizeIterator> size,
+                  const size_t max_size,
+                  BinaryFunction reduce_op = BinaryFunction(),
+                  const hipStream_t stream = 0,
+                  bool debug_synchronous = false)
+{
+    return detail::reduce_future_size_impl<true, Config>(
+        temporary_storage, storage_size,
+        detail::to_kernel_input_iterator(input), output, initial_value, size, max_size,
+        reduce_op, stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel bitwise-reproducible sum primitive for device level.
+///
+/// deterministic_reduce function computes the sum of floating-point values such that the
+/// result is bitwise identical for every run, configuration and GPU architecture.
+///
+/// \par Overview
+/// * The result of \p reduce with \p rocprim::plus depends on the order of the additions,
+/// which is defined by the block size, items per thread and number of blocks, so it may differ
+/// between architectures and configurations. This function rounds every value to a fixed-point
+/// grid derived from the largest finite magnitude in the input and \p size, and adds the
+/// fixed-point digits using integer arithmetic, which is associative.
+/// * The absolute error of the result is bounded by
+/// <tt>size * max_abs * 2^(3 * (ceil(log2(size)) - 62))</tt>, where \p max_abs is the largest
+/// finite magnitude in the input, plus the rounding of the result to the value type. NaNs, and
+/// infinities of both signs, produce NaN.
+/// * The input is read twice and the accumulation type is wider than the input type, so it is
+/// slower than \p reduce.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input must have at least \p size elements, while \p output
+/// only needs one element.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p reduce_config or
+/// a custom class with the same members. It does not affect the result.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type. Its
+/// \p value_type must be \p float or \p double.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to reduce.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;    // e.g., 4
+/// double * input;       // e.g., [1e20, 1.0, -1e20, 1.0]
+/// double * output;      // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::deterministic_reduce(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform reduce
+/// rocprim::deterministic_reduce(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size
+/// );
+/// // output: [2.0]
+/// \endcode
+/// \endparblock
+template<class Config = default_config, class InputIterator, class OutputIterator>
+inline hipError_t deterministic_reduce(void*             temporary_storage,
+                                       size_t&           storage_size,
+                                       InputIterator     input,
+                                       OutputIterator    output,
+                                       const size_t      size,
+                                       const hipStream_t stream            = 0,
+                                       bool              debug_synchronous = false)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+    static_assert(detail::is_reproducible_sum_type<input_type>::value,
+                  "deterministic_reduce only supports float and double values");
+
+    return detail::deterministic_reduce_impl<Config>(temporary_storage,
+                                                     storage_size,
+                                                     input,
+                                                     output,
+                                                     size,
+                                                     stream,
+                                                     debug_synchronous);
+}
+
+/// \brief Parallel transform-reduce primitive for device level.
+///
+/// transform_reduce function applies \p transform_op to every element of the input and performs
+/// a device-wide reduction of the results using binary \p reduce_op operator.
+///
+/// \par Overview
+/// * It is equivalent to \p reduce of a \p transform_iterator of \p input. When \p input is a
+/// pointer, the input is loaded as vectors and \p transform_op is applied in registers, which is
+/// also done for a \p transform_iterator over a pointer passed to \p reduce.
+/// * Supports non-commutative reduction operators, which combine the items in their order.
+/// However, a reduction operator should be associative. Only commutative operators
+/// (\p rocprim::is_commutative) load the input as vectors.
+/// * The result type of \p transform_op is used for accumulation, for example the squares of
+/// \p rocprim::half values can be returned as \p float.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input must have at least \p size elements, while \p output
+/// only needs one element.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p reduce_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam InitValueType - type of the initial value.
+/// \tparam BinaryFunction - type of binary function used for reduction.
+/// \tparam UnaryFunction - type of unary function applied to the input elements.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to reduce.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [in] initial_value - initial value to start the reduction.
+/// \param [in] size - number of element in the input range.
+/// \param [in] reduce_op - binary operation function object that will be used for reduction
+/// of the transformed elements.
+/// \param [in] transform_op - unary operation function object that is applied to every input
+/// element. The signature of the function should be equivalent to the following:
+/// <tt>T f(const U &a);</tt>, where \p U is the \p value_type of \p InputIterator.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the sum of squares of an array of \p int8_t values is computed.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// auto square = [] __device__ (int8_t x) -> int { return int(x) * int(x); };
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;    // e.g., 4
+/// int8_t * input;       // e.g., [1, -2, 3, -4]
+/// int * output;         // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::transform_reduce(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, 0, input_size, rocprim::plus<int>(), square
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform transform-reduce
+/// rocprim::transform_reduce(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, 0, input_size, rocprim::plus<int>(), square
+/// );
+/// // output: [30]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class InitValueType,
+         class BinaryFunction,
+         class UnaryFunction>
+inline hipError_t transform_reduce(void*               temporary_storage,
+                                   size_t&             storage_size,
+                                   InputIterator       input,
+                                   OutputIterator      output,
+                                   const InitValueType initial_value,
+                                   const size_t        size,
+                                   BinaryFunction      reduce_op,
+                                   UnaryFunction       transform_op,
+                                   const hipStream_t   stream            = 0,
+                                   bool                debug_synchronous = false)
+{
+    return detail::reduce_impl<true, Config>(
+        temporary_storage,
+        storage_size,
+        ::rocprim::make_transform_iterator(detail::to_kernel_input_iterator(input), transform_op),
+        output,
+        initial_value,
+        size,
+        reduce_op,
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Parallel reduction of the same input with multiple operators for device level.
+///
+/// multi_reduce function performs several device-wide reductions of the input, one for every
+/// operator of \p reduce_ops, in a single pass over the input, for example the minimum, the
+/// maximum and the sum of a column.
+///
+/// \par Overview
+/// * The input is read once, every item is reduced to a tuple of accumulators, one per
+/// operator. The accumulator of the reduction \p i has the type of the initial value \p i.
+/// * The tuples are reduced component by component: the warp-level reductions move every
+/// component with its own shuffle or DPP instructions and apply its own operator.
+/// * The reductions are commutative if all the operators are (\p rocprim::is_commutative),
+/// then the input is loaded with vector loads when it is a pointer.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input must have at least \p size elements, while each output of
+/// \p outputs only needs one element.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p reduce_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterators - random-access iterator types of the outputs, one per operator.
+/// \tparam InitValueTypes - types of the initial values, which are the types of the
+/// accumulators.
+/// \tparam BinaryFunctions - types of the binary functions used for the reductions.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to reduce.
+/// \param [out] outputs - tuple of the iterators to the results, the result \p i is the
+/// reduction with the operator \p i.
+/// \param [in] initial_values - tuple of the initial values of the reductions.
+/// \param [in] size - number of element in the input range.
+/// \param [in] reduce_ops - tuple of the binary operation function objects of the reductions.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the minimum, the maximum and the sum of an array of \p float values are
+/// computed in a single pass.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;    // e.g., 4
+/// float * input;        // e.g., [3, -1, 4, 1]
+/// float * min_output;   // empty array of 1 element
+/// float * max_output;   // empty array of 1 element
+/// double * sum_output;  // empty array of 1 element
+///
+/// const auto outputs = rocprim::make_tuple(min_output, max_output, sum_output);
+/// const auto initial_values = rocprim::make_tuple(
+///     std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest(), 0.0);
+/// const auto reduce_ops = rocprim::make_tuple(
+///     rocprim::minimum<float>(), rocprim::maximum<float>(), rocprim::plus<double>());
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::multi_reduce(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, outputs, initial_values, input_size, reduce_ops
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform the reductions
+/// rocprim::multi_reduce(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, outputs, initial_values, input_size, reduce_ops
+/// );
+/// // min_output: [-1], max_output: [4], sum_output: [7]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class... OutputIterators,
+         class... InitValueTypes,
+         class... BinaryFunctions>
+inline hipError_t multi_reduce(
+    void*                                       temporary_storage,
+    size_t&                                     storage_size,
+    InputIterator                               input,
+    const ::rocprim::tuple<OutputIterators...>& outputs,
+    const ::rocprim::tuple<InitValueTypes...>&  initial_values,
+    const size_t                                size,
+    const ::rocprim::tuple<BinaryFunctions...>& reduce_ops,
+    const hipStream_t                           stream            = 0,
+    bool                                        debug_synchronous = false)
+{
+    static_assert(sizeof...(OutputIterators) == sizeof...(BinaryFunctions)
+                      && sizeof...(InitValueTypes) == sizeof...(BinaryFunctions),
+                  "multi_reduce needs one output and one initial value per operator");
+
+    return detail::reduce_impl<true, Config>(
+        temporary_storage,
+        storage_size,
+        ::rocprim::make_transform_iterator(detail::to_kernel_input_iterator(input),
+                                           detail::multi_reduce_broadcast_op<InitValueTypes...>{}),
+        ::rocprim::make_zip_iterator(outputs),
+        initial_values,
+        size,
+        detail::multi_reduce_op<BinaryFunctions...>{reduce_ops},
+        stream,
+        debug_synchronous);
+}
+
 /// @}
 // end of group devicemodule
 
+#ifdef ROCPRIM_USE_INSTANTIATIONS
+ROCPRIM_DETAIL_FOR_EACH_INSTANTIATED_TYPE(ROCPRIM_DETAIL_REDUCE_INSTANTIATIONS, extern template)
+#endif
+
 END_ROCPRIM_NAMESPACE
 
 #endif // ROCPRIM_DEVICE_DEVICE_REDUCE_HPP_
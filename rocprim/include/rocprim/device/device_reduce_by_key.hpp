@@ -22,14 +22,17 @@
 #define ROCPRIM_DEVICE_DEVICE_REDUCE_BY_KEY_HPP_
 
 #include "config_types.hpp"
+#include "detail/config/device_reduce_by_key.hpp"
 #include "device_reduce_by_key_config.hpp"
 #include "device_transform.hpp"
 
 #include "detail/device_reduce_by_key.hpp"
 #include "detail/device_scan_common.hpp"
 #include "detail/lookback_scan_state.hpp"
+#include "instrumentation.hpp"
 
 #include "../config.hpp"
+#include "../detail/device_properties.hpp"
 #include "../detail/match_result_type.hpp"
 #include "../detail/temp_storage.hpp"
 #include "../detail/various.hpp"
@@ -39,6 +42,8 @@
 #include <chrono>
 #include <iostream>
 #include <iterator>
+#include <limits>
+#include <type_traits>
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -120,29 +125,74 @@ ROCPRIM_KERNEL __launch_bounds__(Config::block_size) void kernel(
     const AccumulatorType* const         previous_accumulated,
     const std::size_t                    number_of_tiles_launch)
 {
-    reduce_by_key::kernel_impl<Config>(keys_input,
-                                       values_input,
-                                       unique_keys,
-                                       reductions,
-                                       unique_count,
-                                       reduce_op,
-                                       compare,
-                                       scan_state,
-                                       ordered_tile_id,
-                                       starting_tile,
-                                       total_number_of_tiles,
-                                       size,
-                                       global_head_count,
-                                       previous_accumulated,
-                                       number_of_tiles_launch);
+    reduce_by_key::kernel_impl<Config, /*Persistent=*/false>(keys_input,
+                                                             values_input,
+                                                             unique_keys,
+                                                             reductions,
+                                                             unique_count,
+                                                             reduce_op,
+                                                             compare,
+                                                             scan_state,
+                                                             ordered_tile_id,
+                                                             starting_tile,
+                                                             total_number_of_tiles,
+                                                             size,
+                                                             global_head_count,
+                                                             previous_accumulated,
+                                                             number_of_tiles_launch);
 }
 
+template<typename Config,
+         typename AccumulatorType,
+         typename KeyIterator,
+         typename ValueIterator,
+         typename UniqueIterator,
+         typename ReductionIterator,
+         typename UniqueCountIterator,
+         typename CompareFunction,
+         typename BinaryOp,
+         typename LookbackScanState>
+ROCPRIM_KERNEL __launch_bounds__(Config::block_size) void persistent_kernel(
+    const KeyIterator                    keys_input,
+    const ValueIterator                  values_input,
+    const UniqueIterator                 unique_keys,
+    const ReductionIterator              reductions,
+    const UniqueCountIterator            unique_count,
+    const BinaryOp                       reduce_op,
+    const CompareFunction                compare,
+    const LookbackScanState              scan_state,
+    const ordered_block_id<unsigned int> ordered_tile_id,
+    const std::size_t                    number_of_tiles,
+    const std::size_t                    size)
+{
+    reduce_by_key::kernel_impl<Config, /*Persistent=*/true>(
+        keys_input,
+        values_input,
+        unique_keys,
+        reductions,
+        unique_count,
+        reduce_op,
+        compare,
+        scan_state,
+        ordered_tile_id,
+        0,
+        number_of_tiles,
+        size,
+        nullptr,
+        static_cast<const AccumulatorType*>(nullptr),
+        number_of_tiles);
+}
+
+// Blocks of the persistent kernel launched per compute unit
+constexpr unsigned int persistent_blocks_per_cu = 8;
+
 #define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start)                           \
     do                                                                                           \
     {                                                                                            \
         auto _error = hipGetLastError();                                                         \
         if(_error != hipSuccess)                                                                 \
             return _error;                                                                       \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size);                                          \
         if(debug_synchronous)                                                                    \
         {                                                                                        \
             std::cout << name << "(" << size << ")";                                             \
@@ -164,7 +214,8 @@ template<class Config,
          class UniqueCountOutputIterator,
          class BinaryFunction,
          class KeyCompareFunction>
-hipError_t reduce_by_key_impl(void*                     temporary_storage,
+hipError_t reduce_by_key_impl(std::true_type /*use_size_limit*/,
+                              void*                     temporary_storage,
                               size_t&                   storage_size,
                               KeysInputIterator         keys_input,
                               ValuesInputIterator       values_input,
@@ -182,7 +233,7 @@ hipError_t reduce_by_key_impl(void*                     temporary_storage,
 
     using config = detail::default_or_custom_config<
         Config,
-        reduce_by_key::default_config<ROCPRIM_TARGET_ARCH, key_type, accumulator_type>>;
+        default_reduce_by_key_config<ROCPRIM_TARGET_ARCH, key_type, accumulator_type>>;
 
     using scan_state_type
         = reduce_by_key::lookback_scan_state_t<accumulator_type, /*UseSleep=*/false>;
@@ -305,6 +356,7 @@ hipError_t reduce_by_key_impl(void*                     temporary_storage,
 
             start = std::chrono::high_resolution_clock::now();
         }
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("init_lookback_scan_state_kernel");
 
         with_scan_state(
             [&](const auto scan_state)
@@ -356,6 +408,235 @@ hipError_t reduce_by_key_impl(void*                     temporary_storage,
     return hipSuccess;
 }
 
+// Processes the whole input by a single launch: a grid of resident blocks processes the tiles
+// in the order of their ids, the number of segment heads is 64-bit in the look-back scan state.
+template<class Config,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class UniqueOutputIterator,
+         class AggregatesOutputIterator,
+         class UniqueCountOutputIterator,
+         class BinaryFunction,
+         class KeyCompareFunction>
+hipError_t reduce_by_key_impl(std::false_type /*use_size_limit*/,
+                              void*                     temporary_storage,
+                              size_t&                   storage_size,
+                              KeysInputIterator         keys_input,
+                              ValuesInputIterator       values_input,
+                              const size_t              size,
+                              UniqueOutputIterator      unique_output,
+                              AggregatesOutputIterator  aggregates_output,
+                              UniqueCountOutputIterator unique_count_output,
+                              BinaryFunction            reduce_op,
+                              KeyCompareFunction        key_compare_op,
+                              const hipStream_t         stream,
+                              const bool                debug_synchronous)
+{
+    using key_type         = reduce_by_key::value_type_t<KeysInputIterator>;
+    using accumulator_type = reduce_by_key::accumulator_type_t<ValuesInputIterator, BinaryFunction>;
+
+    using config = detail::default_or_custom_config<
+        Config,
+        default_reduce_by_key_config<ROCPRIM_TARGET_ARCH, key_type, accumulator_type>>;
+
+    using scan_state_type
+        = reduce_by_key::lookback_scan_state_t<accumulator_type, /*UseSleep=*/false, std::size_t>;
+    using scan_state_with_sleep_type
+        = reduce_by_key::lookback_scan_state_t<accumulator_type, /*UseSleep=*/true, std::size_t>;
+
+    using ordered_tile_id_type = detail::ordered_block_id<unsigned int>;
+
+    constexpr unsigned int block_size      = config::block_size;
+    constexpr unsigned int tiles_per_block = config::tiles_per_block;
+    constexpr unsigned int items_per_tile  = block_size * config::items_per_thread;
+
+    const std::size_t full_number_of_tiles = detail::ceiling_div(size, items_per_tile);
+    // The number of tiles is limited by the 32-bit indices of the look-back scan state
+    if(full_number_of_tiles
+       > std::numeric_limits<unsigned int>::max() - ::rocprim::host_warp_size())
+    {
+        return hipErrorInvalidValue;
+    }
+    const unsigned int number_of_tiles = static_cast<unsigned int>(full_number_of_tiles);
+
+    // Calculate required temporary storage
+    void*                          scan_state_storage;
+    ordered_tile_id_type::id_type* ordered_bid_storage;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            // This is valid even with scan_state_with_sleep_type
+            detail::temp_storage::make_partition(
+                &scan_state_storage,
+                scan_state_type::get_temp_storage_layout(number_of_tiles)),
+            detail::temp_storage::make_partition(&ordered_bid_storage,
+                                                 ordered_tile_id_type::get_temp_storage_layout())));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    bool             use_sleep;
+    const hipError_t result = detail::is_sleep_scan_state_used(use_sleep);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    auto with_scan_state
+        = [use_sleep,
+           scan_state = scan_state_type::create(scan_state_storage, number_of_tiles),
+           scan_state_with_sleep
+           = scan_state_with_sleep_type::create(scan_state_storage, number_of_tiles)](
+              auto&& func) mutable -> decltype(auto)
+    {
+        if(use_sleep)
+        {
+            return func(scan_state_with_sleep);
+        }
+        else
+        {
+            return func(scan_state);
+        }
+    };
+
+    auto ordered_bid = ordered_tile_id_type::create(ordered_bid_storage);
+
+    if(size == 0)
+    {
+        // Fill out unique_count_output with zero
+        return rocprim::transform(rocprim::constant_iterator<std::size_t>(0),
+                                  unique_count_output,
+                                  1,
+                                  rocprim::identity<std::size_t>{},
+                                  stream,
+                                  debug_synchronous);
+    }
+
+    device_properties props;
+    const hipError_t  props_result = get_current_device_properties(props);
+    if(props_result != hipSuccess)
+    {
+        return props_result;
+    }
+    // Blocks process tiles until all of them are processed, so the grid is not larger than
+    // the number of blocks that can be resident at once and the limit of scoped_grid_limit.
+    const unsigned int number_of_blocks = apply_grid_limit(
+        std::min(detail::ceiling_div(number_of_tiles, tiles_per_block),
+                 ::rocprim::max(1u, props.compute_units * persistent_blocks_per_cu)));
+    const unsigned int init_grid_size
+        = apply_grid_limit(detail::ceiling_div(number_of_tiles, block_size));
+
+    // Start point for time measurements
+    std::chrono::high_resolution_clock::time_point start;
+    if(debug_synchronous)
+    {
+        std::cout << "size:             " << size << '\n';
+        std::cout << "block_size:       " << block_size << '\n';
+        std::cout << "number_of_tiles:  " << number_of_tiles << '\n';
+        std::cout << "number_of_blocks: " << number_of_blocks << '\n';
+        std::cout << "items_per_tile:   " << items_per_tile << '\n';
+
+        start = std::chrono::high_resolution_clock::now();
+    }
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("init_lookback_scan_state_kernel");
+
+    with_scan_state(
+        [&](const auto scan_state)
+        {
+            hipLaunchKernelGGL(init_lookback_scan_state_kernel,
+                               dim3(init_grid_size),
+                               dim3(block_size),
+                               0,
+                               stream,
+                               scan_state,
+                               number_of_tiles,
+                               ordered_bid);
+        });
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_lookback_scan_state_kernel",
+                                                number_of_tiles,
+                                                start);
+
+    if(debug_synchronous)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("reduce_by_key_persistent_kernel");
+    with_scan_state(
+        [&](const auto scan_state)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(reduce_by_key::persistent_kernel<config, accumulator_type>),
+                dim3(number_of_blocks),
+                dim3(block_size),
+                0,
+                stream,
+                keys_input,
+                values_input,
+                unique_output,
+                aggregates_output,
+                unique_count_output,
+                reduce_op,
+                key_compare_op,
+                scan_state,
+                ordered_bid,
+                number_of_tiles,
+                size);
+        });
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("reduce_by_key_persistent_kernel", size, start);
+
+    return hipSuccess;
+}
+
+template<class Config,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class UniqueOutputIterator,
+         class AggregatesOutputIterator,
+         class UniqueCountOutputIterator,
+         class BinaryFunction,
+         class KeyCompareFunction>
+hipError_t reduce_by_key_impl(void*                     temporary_storage,
+                              size_t&                   storage_size,
+                              KeysInputIterator         keys_input,
+                              ValuesInputIterator       values_input,
+                              const size_t              size,
+                              UniqueOutputIterator      unique_output,
+                              AggregatesOutputIterator  aggregates_output,
+                              UniqueCountOutputIterator unique_count_output,
+                              BinaryFunction            reduce_op,
+                              KeyCompareFunction        key_compare_op,
+                              const hipStream_t         stream,
+                              const bool                debug_synchronous)
+{
+    using key_type         = reduce_by_key::value_type_t<KeysInputIterator>;
+    using accumulator_type = reduce_by_key::accumulator_type_t<ValuesInputIterator, BinaryFunction>;
+
+    using config = detail::default_or_custom_config<
+        Config,
+        default_reduce_by_key_config<ROCPRIM_TARGET_ARCH, key_type, accumulator_type>>;
+
+    // With the default size limit the whole input is processed by a single launch,
+    // otherwise the input is split into launches of size_limit items.
+    using use_size_limit
+        = std::integral_constant<bool, (config::size_limit < ROCPRIM_GRID_SIZE_LIMIT)>;
+
+    return reduce_by_key_impl<config>(use_size_limit{},
+                                      temporary_storage,
+                                      storage_size,
+                                      keys_input,
+                                      values_input,
+                                      size,
+                                      unique_output,
+                                      aggregates_output,
+                                      unique_count_output,
+                                      reduce_op,
+                                      key_compare_op,
+                                      stream,
+                                      debug_synchronous);
+}
+
 #undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
 
 } // namespace reduce_by_key
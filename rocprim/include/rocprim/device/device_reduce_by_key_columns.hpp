@@ -0,0 +1,444 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_REDUCE_BY_KEY_COLUMNS_HPP_
+#define ROCPRIM_DEVICE_DEVICE_REDUCE_BY_KEY_COLUMNS_HPP_
+
+#include "config_types.hpp"
+#include "device_reduce_by_key.hpp"
+#include "detail/config/device_reduce_by_key.hpp"
+#include "device_reduce_by_key_config.hpp"
+#include "device_transform.hpp"
+
+#include "detail/device_reduce_by_key_columns.hpp"
+#include "detail/lookback_scan_state.hpp"
+#include "detail/ordered_block_id.hpp"
+#include "instrumentation.hpp"
+
+#include "../config.hpp"
+#include "../detail/device_properties.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../functional.hpp"
+#include "../iterator/constant_iterator.hpp"
+#include "../types/integer_sequence.hpp"
+#include "../types/tuple.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+namespace reduce_by_key
+{
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start)                           \
+    do                                                                                           \
+    {                                                                                            \
+        auto _error = hipGetLastError();                                                         \
+        if(_error != hipSuccess)                                                                 \
+            return _error;                                                                       \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size);                                          \
+        if(debug_synchronous)                                                                    \
+        {                                                                                        \
+            std::cout << name << "(" << size << ")";                                             \
+            auto __error = hipStreamSynchronize(stream);                                         \
+            if(__error != hipSuccess)                                                            \
+                return __error;                                                                  \
+            auto _end = std::chrono::high_resolution_clock::now();                               \
+            auto _d   = std::chrono::duration_cast<std::chrono::duration<double>>(_end - start); \
+            std::cout << " " << _d.count() * 1000 << " ms" << '\n';                              \
+        }                                                                                        \
+    }                                                                                            \
+    while(false)
+
+template<class Config,
+         class KeysInputIterator,
+         class... ValuesInputIterators,
+         class UniqueOutputIterator,
+         class... AggregatesOutputIterators,
+         class UniqueCountOutputIterator,
+         class... BinaryFunctions,
+         class KeyCompareFunction>
+hipError_t
+    reduce_by_key_columns_impl(void*                                          temporary_storage,
+                               size_t&                                        storage_size,
+                               KeysInputIterator                              keys_input,
+                               ::rocprim::tuple<ValuesInputIterators...>      values_input,
+                               const size_t                                   size,
+                               UniqueOutputIterator                           unique_output,
+                               ::rocprim::tuple<AggregatesOutputIterators...> aggregates_output,
+                               UniqueCountOutputIterator                      unique_count_output,
+                               ::rocprim::tuple<BinaryFunctions...>           reduce_ops,
+                               KeyCompareFunction                             key_compare_op,
+                               const hipStream_t                              stream,
+                               const bool                                     debug_synchronous)
+{
+    static_assert(sizeof...(ValuesInputIterators) > 0, "At least one column must be reduced");
+    static_assert(sizeof...(ValuesInputIterators) == sizeof...(AggregatesOutputIterators)
+                      && sizeof...(ValuesInputIterators) == sizeof...(BinaryFunctions),
+                  "Every column must have an output and a reduction operator");
+
+    constexpr size_t columns = sizeof...(ValuesInputIterators);
+    using column_indices     = ::rocprim::index_sequence_for<ValuesInputIterators...>;
+
+    using key_type = reduce_by_key::value_type_t<KeysInputIterator>;
+    using first_accumulator_type
+        = reduce_by_key::accumulator_type_t<::rocprim::tuple_element_t<0, decltype(values_input)>,
+                                            ::rocprim::tuple_element_t<0, decltype(reduce_ops)>>;
+
+    // The tiles are configured for the keys and the first column
+    using config = detail::default_or_custom_config<
+        Config,
+        default_reduce_by_key_config<ROCPRIM_TARGET_ARCH, key_type, first_accumulator_type>>;
+
+    using scan_states = reduce_by_key::column_scan_states<
+        reduce_by_key::accumulator_type_t<ValuesInputIterators, BinaryFunctions>...>;
+
+    using ordered_tile_id_type = detail::ordered_block_id<unsigned int>;
+
+    constexpr unsigned int block_size      = config::block_size;
+    constexpr unsigned int tiles_per_block = config::tiles_per_block;
+    constexpr unsigned int items_per_tile  = block_size * config::items_per_thread;
+
+    const std::size_t full_number_of_tiles = detail::ceiling_div(size, items_per_tile);
+    // The number of tiles is limited by the 32-bit indices of the look-back scan states
+    if(full_number_of_tiles
+       > std::numeric_limits<unsigned int>::max() - ::rocprim::host_warp_size())
+    {
+        return hipErrorInvalidValue;
+    }
+    const unsigned int number_of_tiles = static_cast<unsigned int>(full_number_of_tiles);
+
+    // The head counts are 32-bit when the number of heads fits, then their look-back lane has
+    // a single atomic per prefix
+    const bool use_narrow_head_count = size <= std::numeric_limits<unsigned int>::max();
+
+    // Calculate required temporary storage
+    void*                          head_scan_state_storage;
+    void*                          wide_head_scan_state_storage;
+    void*                          column_scan_states_storage[columns];
+    ordered_tile_id_type::id_type* ordered_bid_storage;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            // These are valid even with the states which use sleep
+            detail::temp_storage::make_union_partition(
+                detail::temp_storage::make_partition(
+                    &head_scan_state_storage,
+                    reduce_by_key::head_scan_state_t<unsigned int>::get_temp_storage_layout(
+                        number_of_tiles)),
+                detail::temp_storage::make_partition(
+                    &wide_head_scan_state_storage,
+                    reduce_by_key::head_scan_state_t<std::size_t>::get_temp_storage_layout(
+                        number_of_tiles))),
+            scan_states::make_partition(column_scan_states_storage,
+                                        number_of_tiles,
+                                        column_indices{}),
+            detail::temp_storage::make_partition(&ordered_bid_storage,
+                                                 ordered_tile_id_type::get_temp_storage_layout())));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(size == 0)
+    {
+        // Fill out unique_count_output with zero
+        return rocprim::transform(rocprim::constant_iterator<std::size_t>(0),
+                                  unique_count_output,
+                                  1,
+                                  rocprim::identity<std::size_t>{},
+                                  stream,
+                                  debug_synchronous);
+    }
+
+    bool             use_sleep;
+    const hipError_t result = detail::is_sleep_scan_state_used(use_sleep);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    device_properties props;
+    const hipError_t  props_result = get_current_device_properties(props);
+    if(props_result != hipSuccess)
+    {
+        return props_result;
+    }
+    // Blocks process tiles until all of them are processed, so the grid is not larger than
+    // the number of blocks that can be resident at once and the limit of scoped_grid_limit.
+    const unsigned int number_of_blocks = apply_grid_limit(
+        std::min(detail::ceiling_div(number_of_tiles, tiles_per_block),
+                 ::rocprim::max(1u, props.compute_units * persistent_blocks_per_cu)));
+    const unsigned int init_grid_size
+        = apply_grid_limit(detail::ceiling_div(number_of_tiles, block_size));
+
+    auto ordered_bid = ordered_tile_id_type::create(ordered_bid_storage);
+
+    if(debug_synchronous)
+    {
+        std::cout << "size:             " << size << '\n';
+        std::cout << "columns:          " << columns << '\n';
+        std::cout << "block_size:       " << block_size << '\n';
+        std::cout << "number_of_tiles:  " << number_of_tiles << '\n';
+        std::cout << "number_of_blocks: " << number_of_blocks << '\n';
+        std::cout << "items_per_tile:   " << items_per_tile << '\n';
+    }
+
+    const auto launch = [&](auto use_sleep_tag, auto head_count_tag) -> hipError_t
+    {
+        constexpr bool with_sleep = decltype(use_sleep_tag)::value;
+        using head_count_type     = decltype(head_count_tag);
+
+        const auto head_scan_state
+            = reduce_by_key::head_scan_state_t<head_count_type, with_sleep>::create(
+                std::is_same<head_count_type, unsigned int>::value ? head_scan_state_storage
+                                                                   : wide_head_scan_state_storage,
+                number_of_tiles);
+        const auto column_scan_states
+            = scan_states::template create<with_sleep>(column_scan_states_storage,
+                                                       number_of_tiles,
+                                                       column_indices{});
+
+        // Start point for time measurements
+        std::chrono::high_resolution_clock::time_point start;
+        if(debug_synchronous)
+        {
+            start = std::chrono::high_resolution_clock::now();
+        }
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("init_lookback_scan_state_kernel");
+        hipLaunchKernelGGL(reduce_by_key::columns_init_kernel,
+                           dim3(init_grid_size),
+                           dim3(block_size),
+                           0,
+                           stream,
+                           head_scan_state,
+                           column_scan_states,
+                           number_of_tiles,
+                           ordered_bid);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_lookback_scan_state_kernel",
+                                                    number_of_tiles,
+                                                    start);
+
+        if(debug_synchronous)
+        {
+            start = std::chrono::high_resolution_clock::now();
+        }
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("reduce_by_key_columns_kernel");
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(reduce_by_key::columns_kernel<config>),
+                           dim3(number_of_blocks),
+                           dim3(block_size),
+                           0,
+                           stream,
+                           keys_input,
+                           values_input,
+                           unique_output,
+                           aggregates_output,
+                           unique_count_output,
+                           reduce_ops,
+                           key_compare_op,
+                           head_scan_state,
+                           column_scan_states,
+                           ordered_bid,
+                           std::size_t(number_of_tiles),
+                           size);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("reduce_by_key_columns_kernel", size, start);
+        return hipSuccess;
+    };
+
+    if(use_sleep)
+    {
+        return use_narrow_head_count ? launch(std::true_type{}, 0u)
+                                     : launch(std::true_type{}, std::size_t(0));
+    }
+    return use_narrow_head_count ? launch(std::false_type{}, 0u)
+                                 : launch(std::false_type{}, std::size_t(0));
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
+} // namespace reduce_by_key
+
+} // namespace detail
+
+/// \brief Parallel reduce-by-key primitive for device level, which reduces several columns of
+/// values by the same keys.
+///
+/// reduce_by_key_columns function performs a device-wide reduction of every column of values
+/// on groups of consecutive values having the same key, like calling \p reduce_by_key once per
+/// column. The keys are loaded, compared and written to \p unique_output once for all columns.
+/// The reduction of the group in the column \p c is written to the column \p c of
+/// \p aggregates_output.
+///
+/// \par Overview
+/// * Every column is scanned in its own look-back lane with its own \p reduce_op, which keeps
+/// the prefixes of the lanes as narrow as the columns. Compared to a \p zip_iterator of the
+/// columns with a tuple operator, the block prefixes do not become too wide for the single
+/// atomic path, and only the values of one column are held in registers at a time.
+/// * Supports non-commutative reduction operators. However, a reduction operator should be
+/// associative.
+/// * The tiles are configured by \p Config for the keys and the first column. The whole input is
+/// processed by a single launch, \p size_limit of the configuration is not used.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p keys_input and the columns of \p values_input must have at least
+/// \p size elements.
+/// * Range specified by \p unique_count_output must have at least 1 element.
+/// * Ranges specified by \p unique_output and the columns of \p aggregates_output must have at
+/// least <tt>*unique_count_output</tt> (i.e. the number of unique keys) elements.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// `reduce_by_key_config_v2` or `default_config`
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterators - random-access iterator types of the columns of values.
+/// \tparam UniqueOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam AggregatesOutputIterators - random-access iterator types of the columns of
+/// reductions.
+/// \tparam UniqueCountOutputIterator - random-access iterator type of the output range. Must meet
+/// the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam BinaryFunctions - types of the binary functions used for the reductions of the
+/// columns.
+/// \tparam KeyCompareFunction - type of binary function used to determine keys equality. Default
+/// type is \p rocprim::equal_to<T>, where \p T is a \p value_type of \p KeysInputIterator.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - iterator to the first element in the range of keys.
+/// \param [in] values_input - tuple of iterators to the first elements of the columns of values.
+/// \param [in] size - number of element in the input range.
+/// \param [out] unique_output - iterator to the first element in the output range of unique keys.
+/// \param [out] aggregates_output - tuple of iterators to the first elements of the output
+/// columns of reductions.
+/// \param [out] unique_count_output - iterator to total number of groups.
+/// \param [in] reduce_ops - tuple of the binary operation function objects of the columns.
+/// \param [in] key_compare_op - binary operation function object that will be used to determine
+/// key equality. Default is KeyCompareFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the sum of one column and the maximum of another column are computed by
+/// the same keys.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;          // e.g., 8
+/// int * keys_input;           // e.g., [1, 1, 1, 2, 10, 10, 10, 88]
+/// int * sum_input;            // e.g., [1, 2, 3, 4,  5,  6,  7,  8]
+/// float * max_input;          // e.g., [3, 1, 2, 5,  0,  9,  1,  4]
+/// int * unique_output;        // empty array of at least 4 elements
+/// int * sum_output;           // empty array of at least 4 elements
+/// float * max_output;         // empty array of at least 4 elements
+/// int * unique_count_output;  // empty array of 1 element
+///
+/// auto values_input = rocprim::make_tuple(sum_input, max_input);
+/// auto aggregates_output = rocprim::make_tuple(sum_output, max_output);
+/// auto reduce_ops = rocprim::make_tuple(rocprim::plus<int>(), rocprim::maximum<float>());
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::reduce_by_key_columns(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input, values_input, input_size,
+///     unique_output, aggregates_output, unique_count_output, reduce_ops
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform reduction
+/// rocprim::reduce_by_key_columns(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input, values_input, input_size,
+///     unique_output, aggregates_output, unique_count_output, reduce_ops
+/// );
+/// // unique_output:       [1, 2, 10, 88]
+/// // sum_output:          [6, 4, 18,  8]
+/// // max_output:          [3, 5,  9,  4]
+/// // unique_count_output: [4]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class KeysInputIterator,
+         class... ValuesInputIterators,
+         class UniqueOutputIterator,
+         class... AggregatesOutputIterators,
+         class UniqueCountOutputIterator,
+         class... BinaryFunctions,
+         class KeyCompareFunction
+         = ::rocprim::equal_to<typename std::iterator_traits<KeysInputIterator>::value_type>>
+inline hipError_t
+    reduce_by_key_columns(void*                                          temporary_storage,
+                          size_t&                                        storage_size,
+                          KeysInputIterator                              keys_input,
+                          ::rocprim::tuple<ValuesInputIterators...>      values_input,
+                          const size_t                                   size,
+                          UniqueOutputIterator                           unique_output,
+                          ::rocprim::tuple<AggregatesOutputIterators...> aggregates_output,
+                          UniqueCountOutputIterator                      unique_count_output,
+                          ::rocprim::tuple<BinaryFunctions...>           reduce_ops,
+                          KeyCompareFunction key_compare_op    = KeyCompareFunction(),
+                          hipStream_t        stream            = 0,
+                          bool               debug_synchronous = false)
+{
+    return detail::reduce_by_key::reduce_by_key_columns_impl<Config>(temporary_storage,
+                                                                     storage_size,
+                                                                     keys_input,
+                                                                     values_input,
+                                                                     size,
+                                                                     unique_output,
+                                                                     aggregates_output,
+                                                                     unique_count_output,
+                                                                     reduce_ops,
+                                                                     key_compare_op,
+                                                                     stream,
+                                                                     debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_REDUCE_BY_KEY_COLUMNS_HPP_
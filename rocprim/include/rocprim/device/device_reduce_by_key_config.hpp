@@ -30,6 +30,7 @@
 #include "../config.hpp"
 
 #include <algorithm>
+#include <type_traits>
 
 /// \addtogroup primitivesmodule_deviceconfigs
 /// @{
@@ -46,6 +47,7 @@ BEGIN_ROCPRIM_NAMESPACE
  * \tparam ScanAlgorithm block level scan algorithm to use
  * \tparam TilesPerBlock number of tiles (`BlockSize` * `ItemsPerThread` items) to process per block
  * \tparam SizeLimit limit on the number of items for a single reduce_by_key kernel launch.
+ * \tparam Backoff policy of the look-back for waiting for the prefixes of the preceding tiles.
  */
 template<unsigned int         BlockSize,
          unsigned int         ItemsPerThread,
@@ -53,7 +55,8 @@ template<unsigned int         BlockSize,
          block_load_method    LoadValuesMethod = block_load_method::block_load_transpose,
          block_scan_algorithm ScanAlgorithm    = block_scan_algorithm::using_warp_scan,
          unsigned int         TilesPerBlock    = 1,
-         unsigned int         SizeLimit        = ROCPRIM_GRID_SIZE_LIMIT>
+         unsigned int         SizeLimit        = ROCPRIM_GRID_SIZE_LIMIT,
+         lookback_backoff     Backoff          = lookback_backoff::automatic>
 struct reduce_by_key_config_v2
 {
     static constexpr unsigned int         block_size         = BlockSize;
@@ -63,6 +66,7 @@ struct reduce_by_key_config_v2
     static constexpr block_load_method    load_values_method = LoadValuesMethod;
     static constexpr block_scan_algorithm scan_algorithm     = ScanAlgorithm;
     static constexpr unsigned int         size_limit         = SizeLimit;
+    static constexpr lookback_backoff     backoff            = Backoff;
 };
 
 /// \brief Legacy configuration of device-level reduce-by-key operation.
@@ -87,11 +91,10 @@ struct [[deprecated("use reduce_by_key_config_v2")]] reduce_by_key_config
 namespace detail
 {
 
-namespace reduce_by_key
-{
-
+// Configuration of reduce_by_key for the architectures and the key and value types which are
+// not tuned. Large items get fewer items per thread and two tiles per block.
 template<typename Key, typename Value>
-struct fallback_config
+struct default_reduce_by_key_config_base_helper
 {
     static constexpr unsigned int size_memory_per_item = std::max(sizeof(Key), sizeof(Value));
 
@@ -100,7 +103,7 @@ struct fallback_config
 
     static constexpr unsigned int items_per_thread = std::max(1u, 15u / item_scale);
 
-    using type
+    using fallback_type
         = reduce_by_key_config_v2<detail::limit_block_size<256U,
                                                            items_per_thread * size_memory_per_item,
                                                            ROCPRIM_WARP_SIZE_64>::value,
@@ -109,22 +112,23 @@ struct fallback_config
                                   block_load_method::block_load_transpose,
                                   block_scan_algorithm::using_warp_scan,
                                   2>;
+
+    using type = std::conditional_t<
+        size_memory_per_item <= 16,
+        reduce_by_key_config_v2<256,
+                                15,
+                                block_load_method::block_load_transpose,
+                                block_load_method::block_load_transpose,
+                                block_scan_algorithm::using_warp_scan,
+                                sizeof(Value) < 16 ? 1 : 2>,
+        fallback_type>;
 };
 
-template<unsigned int TargetArch, class Key, class Value>
-struct default_config
-    : std::conditional_t<std::max(sizeof(Key), sizeof(Value)) <= 16,
-                         rocprim::reduce_by_key_config_v2<256,
-                                                          15,
-                                                          block_load_method::block_load_transpose,
-                                                          block_load_method::block_load_transpose,
-                                                          block_scan_algorithm::using_warp_scan,
-                                                          sizeof(Value) < 16 ? 1 : 2>,
-                         typename reduce_by_key::fallback_config<Key, Value>::type>
+template<typename Key, typename Value>
+struct default_reduce_by_key_config_base
+    : default_reduce_by_key_config_base_helper<Key, Value>::type
 {};
 
-} // namespace reduce_by_key
-
 } // end namespace detail
 
 END_ROCPRIM_NAMESPACE
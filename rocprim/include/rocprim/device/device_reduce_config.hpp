@@ -35,10 +35,13 @@ namespace detail
 
 struct reduce_config_params
 {
-    unsigned int           block_size;
-    unsigned int           items_per_thread;
-    block_reduce_algorithm block_reduce_method;
-    unsigned int           size_limit;
+    unsigned int               block_size;
+    unsigned int               items_per_thread;
+    block_reduce_algorithm     block_reduce_method;
+    unsigned int               size_limit;
+    bool                       single_pass;
+    segmented_reduce_algorithm segmented_algorithm;
+    unsigned int               blocks_per_cu;
 };
 
 template<typename ReduceConfig>
@@ -47,7 +50,10 @@ constexpr reduce_config_params wrap_reduce_config()
     return reduce_config_params{ReduceConfig::block_size,
                                 ReduceConfig::items_per_thread,
                                 ReduceConfig::block_reduce_method,
-                                ReduceConfig::size_limit};
+                                ReduceConfig::size_limit,
+                                ReduceConfig::single_pass,
+                                ReduceConfig::segmented_algorithm,
+                                config_blocks_per_cu<ReduceConfig>::value};
 }
 
 template<typename ReduceConfig, typename>
@@ -0,0 +1,117 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_REDUCE_MULTI_DEVICE_HPP_
+#define ROCPRIM_DEVICE_DEVICE_REDUCE_MULTI_DEVICE_HPP_
+
+#include <iterator>
+
+#include "../config.hpp"
+#include "../functional.hpp"
+
+#include "detail/device_multi_device.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+/// \brief Parallel reduction of items distributed across several devices.
+///
+/// \p multi_device_reduce reduces the items of all devices with an initial value, the result is
+/// written on the first device.
+///
+/// \par Overview
+/// * Returns the required size of the temporary storage of every device in \p storage_sizes
+/// if \p temporary_storage is a null pointer. The temporary storage of a device must be allocated
+/// on that device.
+/// * Every device reduces its items with \p reduce. The first device waits for the totals with
+/// events, copies them through peer memory and reduces them with the initial value, so the host
+/// does not wait for the devices. The function is asynchronous like \p reduce.
+/// * The copies of the totals go directly over the links between the devices if peer access
+/// between them is enabled with \p hipDeviceEnablePeerAccess.
+/// * \p reduce_op must be associative, the items are reduced in the order of the devices.
+/// * The current device is restored.
+///
+/// \tparam InputIterator - random-access iterator type of the input ranges. It can be a simple
+/// pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output. It can be a simple
+/// pointer type.
+/// \tparam InitValueType - type of the initial value.
+/// \tparam BinaryFunction - type of binary function used for reduction. Default type
+/// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+///
+/// \param [in] temporary_storage - pointer to an array of \p device_count pointers to the temporary
+/// storages of the devices. When a null pointer is passed, the required allocation sizes (in bytes)
+/// are written to \p storage_sizes and function returns without performing the reduction.
+/// \param [in,out] storage_sizes - array of \p device_count sizes (in bytes) of the temporary
+/// storages.
+/// \param [in] devices - array of \p device_count device ids.
+/// \param [in] device_count - number of devices.
+/// \param [in] inputs - array of iterators to the first elements of the input ranges of the
+/// devices.
+/// \param [out] output - iterator to the output on the first device.
+/// \param [in] initial_value - initial value to start the reduction.
+/// \param [in] sizes - array of the numbers of items of the devices.
+/// \param [in] reduce_op - binary operation function object that will be used for reduction.
+/// The default value is \p BinaryFunction().
+/// \param [in] streams - [optional] array of \p device_count streams of the devices. Default is
+/// \p nullptr, the default streams are used.
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class InputIterator,
+         class OutputIterator,
+         class InitValueType,
+         class BinaryFunction
+         = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>>
+inline hipError_t multi_device_reduce(void* const*         temporary_storage,
+                                      size_t*              storage_sizes,
+                                      const int*           devices,
+                                      const unsigned int   device_count,
+                                      const InputIterator* inputs,
+                                      OutputIterator       output,
+                                      const InitValueType  initial_value,
+                                      const size_t*        sizes,
+                                      BinaryFunction       reduce_op         = BinaryFunction(),
+                                      const hipStream_t*   streams           = nullptr,
+                                      const bool           debug_synchronous = false)
+{
+    return detail::multi_device_scan<detail::multi_device_op::reduce>(temporary_storage,
+                                                                      storage_sizes,
+                                                                      devices,
+                                                                      device_count,
+                                                                      inputs,
+                                                                      &output,
+                                                                      initial_value,
+                                                                      sizes,
+                                                                      reduce_op,
+                                                                      streams,
+                                                                      debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_REDUCE_MULTI_DEVICE_HPP_
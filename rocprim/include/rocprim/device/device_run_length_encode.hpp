@@ -21,6 +21,7 @@
 #ifndef ROCPRIM_DEVICE_DEVICE_RUN_LENGTH_ENCODE_HPP_
 #define ROCPRIM_DEVICE_DEVICE_RUN_LENGTH_ENCODE_HPP_
 
+#include <chrono>
 #include <iostream>
 #include <iterator>
 #include <type_traits>
@@ -31,11 +32,22 @@
 #include "../iterator/constant_iterator.hpp"
 #include "../iterator/counting_iterator.hpp"
 #include "../iterator/discard_iterator.hpp"
+#include "../iterator/transform_iterator.hpp"
 #include "../iterator/zip_iterator.hpp"
 
+#include "../detail/device_properties.hpp"
+#include "../detail/temp_storage.hpp"
 #include "device_run_length_encode_config.hpp"
 #include "device_reduce_by_key.hpp"
+#include "device_scan.hpp"
 #include "device_select.hpp"
+#include "detail/config/device_select.hpp"
+#include "device_select_config.hpp"
+#include "device_transform.hpp"
+#include "device_transform_config.hpp"
+#include "detail/device_run_length_encode.hpp"
+#include "detail/device_scan_common.hpp"
+#include "instrumentation.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -48,6 +60,7 @@ namespace detail
 #define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
     { \
         if(error != hipSuccess) return error; \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
         if(debug_synchronous) \
         { \
             std::cout << name << "(" << size << ")"; \
@@ -59,6 +72,289 @@ namespace detail
         } \
     }
 
+template<bool NonTrivialRuns,
+         class Config,
+         class InputIterator,
+         class FirstOutputIterator,
+         class CountsOutputIterator,
+         class RunsCountOutputIterator,
+         class EqualityOp,
+         class RunLookbackScanState>
+ROCPRIM_KERNEL __launch_bounds__(Config::block_size) void run_length_encode_kernel(
+    InputIterator                  input,
+    const unsigned int             size,
+    FirstOutputIterator            first_output,
+    CountsOutputIterator           counts_output,
+    RunsCountOutputIterator        runs_count_output,
+    EqualityOp                     equality_op,
+    RunLookbackScanState           scan_state,
+    const unsigned int             number_of_blocks,
+    ordered_block_id<unsigned int> ordered_bid)
+{
+    run_length_encode_kernel_impl<NonTrivialRuns, Config>(input,
+                                                          size,
+                                                          first_output,
+                                                          counts_output,
+                                                          runs_count_output,
+                                                          equality_op,
+                                                          scan_state,
+                                                          number_of_blocks,
+                                                          ordered_bid);
+}
+
+// Run-length encoding by a single look-back kernel, which only loads the keys. Stores the unique
+// keys (or the offsets of the non-trivial runs) to first_output and the lengths of the runs to
+// counts_output.
+template<bool NonTrivialRuns,
+         class Config,
+         class InputIterator,
+         class FirstOutputIterator,
+         class CountsOutputIterator,
+         class RunsCountOutputIterator>
+inline hipError_t run_length_encode_impl(void*                   temporary_storage,
+                                         size_t&                 storage_size,
+                                         InputIterator           input,
+                                         const unsigned int      size,
+                                         FirstOutputIterator     first_output,
+                                         CountsOutputIterator    counts_output,
+                                         RunsCountOutputIterator runs_count_output,
+                                         const hipStream_t       stream,
+                                         const bool              debug_synchronous)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+    using equality_op_type = ::rocprim::equal_to<input_type>;
+
+    using config = default_or_custom_config<
+        typename default_or_custom_config<Config, default_run_length_encode_config>::select,
+        default_select_config<ROCPRIM_TARGET_ARCH, input_type>
+    >;
+
+    using scan_state_type = detail::lookback_scan_state<run_length_pair>;
+    using scan_state_with_sleep_type = detail::lookback_scan_state<run_length_pair, true>;
+    using ordered_block_id_type = detail::ordered_block_id<unsigned int>;
+
+    static constexpr unsigned int block_size = config::block_size;
+    static constexpr unsigned int items_per_thread = config::items_per_thread;
+    static constexpr unsigned int items_per_block = block_size * items_per_thread;
+
+    const unsigned int number_of_blocks = ::rocprim::detail::ceiling_div(size, items_per_block);
+
+    // Calculate required temporary storage
+    void*                           scan_state_storage;
+    ordered_block_id_type::id_type* ordered_bid_storage;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            // This is valid even with scan_state_with_sleep_type
+            detail::temp_storage::make_partition(
+                &scan_state_storage,
+                scan_state_type::get_temp_storage_layout(number_of_blocks)),
+            detail::temp_storage::make_partition(&ordered_bid_storage,
+                                                 ordered_block_id_type::get_temp_storage_layout())));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(size == 0)
+    {
+        // There are no runs
+        return ::rocprim::transform(::rocprim::constant_iterator<unsigned int>(0),
+                                    runs_count_output,
+                                    1,
+                                    ::rocprim::identity<unsigned int>{},
+                                    stream,
+                                    debug_synchronous);
+    }
+
+    // Start point for time measurements
+    std::chrono::high_resolution_clock::time_point start;
+
+    auto scan_state = scan_state_type::create(scan_state_storage, number_of_blocks);
+    auto scan_state_with_sleep
+        = scan_state_with_sleep_type::create(scan_state_storage, number_of_blocks);
+    auto ordered_bid = ordered_block_id_type::create(ordered_bid_storage);
+
+    bool       use_sleep;
+    hipError_t error = is_sleep_scan_state_used(use_sleep);
+    if(error != hipSuccess) return error;
+
+    if(debug_synchronous)
+    {
+        std::cout << "size " << size << '\n';
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << number_of_blocks << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+        start = std::chrono::high_resolution_clock::now();
+    }
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("init_lookback_scan_state_kernel");
+
+    const unsigned int init_grid_size = ::rocprim::detail::ceiling_div(number_of_blocks, block_size);
+    if(use_sleep)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(init_lookback_scan_state_kernel<scan_state_with_sleep_type>),
+            dim3(init_grid_size), dim3(block_size), 0, stream,
+            scan_state_with_sleep, number_of_blocks, ordered_bid
+        );
+    }
+    else
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(init_lookback_scan_state_kernel<scan_state_type>),
+            dim3(init_grid_size), dim3(block_size), 0, stream,
+            scan_state, number_of_blocks, ordered_bid
+        );
+    }
+    error = hipGetLastError();
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_lookback_scan_state_kernel", number_of_blocks, start)
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("run_length_encode_kernel");
+    if(use_sleep)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(run_length_encode_kernel<NonTrivialRuns, config>),
+            dim3(number_of_blocks), dim3(block_size), 0, stream,
+            input, size, first_output, counts_output, runs_count_output,
+            equality_op_type(), scan_state_with_sleep, number_of_blocks, ordered_bid
+        );
+    }
+    else
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(run_length_encode_kernel<NonTrivialRuns, config>),
+            dim3(number_of_blocks), dim3(block_size), 0, stream,
+            input, size, first_output, counts_output, runs_count_output,
+            equality_op_type(), scan_state, number_of_blocks, ordered_bid
+        );
+    }
+    error = hipGetLastError();
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("run_length_encode_kernel", size, start)
+
+    return hipSuccess;
+}
+
+// The number of blocks of the decoding kernel must not depend on the counts, so that
+// the size of temporary storage is known without reading them
+constexpr unsigned int run_length_decode_blocks_per_cu = 4;
+
+template<class Config, class ValuesInputIterator, class OutputIterator>
+ROCPRIM_KERNEL __launch_bounds__(Config::block_size) void run_length_decode_kernel(
+    ValuesInputIterator values_input,
+    const size_t*       end_offsets,
+    const size_t        runs,
+    OutputIterator      output)
+{
+    run_length_decode_kernel_impl<Config>(values_input, end_offsets, runs, output);
+}
+
+template<class Count>
+struct run_length_decode_count_op
+{
+    ROCPRIM_HOST_DEVICE inline
+    size_t operator()(const Count& count) const
+    {
+        return static_cast<size_t>(count);
+    }
+};
+
+template<class Config,
+         class ValuesInputIterator,
+         class CountsInputIterator,
+         class OutputIterator>
+inline hipError_t run_length_decode_impl(void*               temporary_storage,
+                                         size_t&             storage_size,
+                                         ValuesInputIterator values_input,
+                                         CountsInputIterator counts_input,
+                                         const size_t        runs,
+                                         OutputIterator      output,
+                                         const hipStream_t   stream,
+                                         const bool          debug_synchronous)
+{
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    using count_type = typename std::iterator_traits<CountsInputIterator>::value_type;
+
+    using config = default_or_custom_config<
+        Config,
+        default_transform_config<ROCPRIM_TARGET_ARCH, value_type>
+    >;
+
+    static constexpr unsigned int block_size = config::block_size;
+
+    device_properties props;
+    hipError_t        error = get_current_device_properties(props);
+    if(error != hipSuccess) return error;
+    const unsigned int number_of_blocks
+        = ::rocprim::max(1u, props.compute_units * run_length_decode_blocks_per_cu);
+
+    // The end offsets of the runs are the inclusive scan of the counts
+    const auto counts = ::rocprim::make_transform_iterator(
+        counts_input, run_length_decode_count_op<count_type>());
+
+    size_t* end_offsets;
+    void*   scan_temporary_storage;
+    size_t  scan_storage_size;
+
+    error = ::rocprim::inclusive_scan(nullptr,
+                                      scan_storage_size,
+                                      counts,
+                                      static_cast<size_t*>(nullptr),
+                                      runs,
+                                      ::rocprim::plus<size_t>(),
+                                      stream,
+                                      debug_synchronous);
+    if(error != hipSuccess) return error;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&end_offsets, runs),
+            detail::temp_storage::make_partition(&scan_temporary_storage, scan_storage_size)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(runs == 0)
+        return hipSuccess;
+
+    error = ::rocprim::inclusive_scan(scan_temporary_storage,
+                                      scan_storage_size,
+                                      counts,
+                                      end_offsets,
+                                      runs,
+                                      ::rocprim::plus<size_t>(),
+                                      stream,
+                                      debug_synchronous);
+    if(error != hipSuccess) return error;
+
+    // Start point for time measurements
+    std::chrono::high_resolution_clock::time_point start;
+
+    if(debug_synchronous)
+    {
+        std::cout << "runs " << runs << '\n';
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << number_of_blocks << '\n';
+        start = std::chrono::high_resolution_clock::now();
+    }
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("run_length_decode_kernel");
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(run_length_decode_kernel<config>),
+        dim3(number_of_blocks), dim3(block_size), 0, stream,
+        values_input, end_offsets, runs, output
+    );
+    error = hipGetLastError();
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("run_length_decode_kernel", runs, start)
+
+    return hipSuccess;
+}
+
 } // end detail namespace
 
 /// \brief Parallel run-length encoding for device level.
@@ -159,19 +455,100 @@ hipError_t run_length_encode(void * temporary_storage,
                              hipStream_t stream = 0,
                              bool debug_synchronous = false)
 {
-    using input_type = typename std::iterator_traits<InputIterator>::value_type;
-    using count_type = unsigned int;
+    return detail::run_length_encode_impl<false, Config>(
+        temporary_storage, storage_size,
+        input, size,
+        unique_output, counts_output, runs_count_output,
+        stream, debug_synchronous
+    );
+}
 
-    using config = detail::default_or_custom_config<
-        Config,
-        detail::default_run_length_encode_config
-    >;
+/// \brief Parallel count of runs for device level.
+///
+/// run_length_encode_count function counts the runs (groups) of consecutive values and
+/// writes the number of runs to \p runs_count_output, which is the value \p run_length_encode
+/// writes to its \p runs_count_output. The unique values and the lengths of the runs are not
+/// written.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Range specified by \p input must have at least \p size elements.
+/// * Range specified by \p runs_count_output must have at least 1 element.
+/// * The count is computed by \p reduce over the discontinuities of the input.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p reduce_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam RunsCountOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range of values.
+/// \param [in] size - number of element in the input range.
+/// \param [out] runs_count_output - iterator to total number of runs.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the runs of an array of integer values are counted.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;          // e.g., 8
+/// int * input;                // e.g., [1, 1, 1, 2, 10, 10, 10, 88]
+/// int * runs_count_output;    // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::run_length_encode_count(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, input_size, runs_count_output
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // count runs
+/// rocprim::run_length_encode_count(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, input_size, runs_count_output
+/// );
+/// // runs_count_output: [4]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class InputIterator,
+    class RunsCountOutputIterator
+>
+inline
+hipError_t run_length_encode_count(void * temporary_storage,
+                                   size_t& storage_size,
+                                   InputIterator input,
+                                   unsigned int size,
+                                   RunsCountOutputIterator runs_count_output,
+                                   hipStream_t stream = 0,
+                                   bool debug_synchronous = false)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
 
-    return ::rocprim::reduce_by_key<typename config::reduce_by_key>(
+    return detail::unique_count_impl<Config>(
         temporary_storage, storage_size,
-        input, make_constant_iterator<count_type>(1), size,
-        unique_output, counts_output, runs_count_output,
-        ::rocprim::plus<count_type>(), ::rocprim::equal_to<input_type>(),
+        input, runs_count_output, size,
+        ::rocprim::equal_to<input_type>(),
         stream, debug_synchronous
     );
 }
@@ -275,132 +652,109 @@ hipError_t run_length_encode_non_trivial_runs(void * temporary_storage,
                                               hipStream_t stream = 0,
                                               bool debug_synchronous = false)
 {
-    using input_type = typename std::iterator_traits<InputIterator>::value_type;
-    using offset_type = unsigned int;
-    using count_type = unsigned int;
-    using offset_count_pair = typename ::rocprim::tuple<offset_type, count_type>;
-
-    using config = detail::default_or_custom_config<
-        Config,
-        detail::default_run_length_encode_config
-    >;
-
-    hipError_t error;
-
-    auto reduce_op = [] __device__ (const offset_count_pair& a, const offset_count_pair& b)
-    {
-        return offset_count_pair(
-            ::rocprim::get<0>(a), // Always use offset of the first item of the run
-            ::rocprim::get<1>(a) + ::rocprim::get<1>(b) // Number of items in the run
-        );
-    };
-    auto non_trivial_runs_select_op = [] __device__ (const offset_count_pair& a)
-    {
-        return ::rocprim::get<1>(a) > 1;
-    };
-
-    offset_type * offsets_tmp = nullptr;
-    count_type * counts_tmp = nullptr;
-    count_type * all_runs_count_tmp = nullptr;
-
-    // Calculate size of temporary storage for reduce_by_key operation
-    size_t reduce_by_key_bytes;
-    error = ::rocprim::reduce_by_key<typename config::reduce_by_key>(
-        nullptr, reduce_by_key_bytes,
-        input,
-        ::rocprim::make_zip_iterator(
-            ::rocprim::make_tuple(
-                ::rocprim::make_counting_iterator<offset_type>(0),
-                ::rocprim::make_constant_iterator<count_type>(1)
-            )
-        ),
-        size,
-        ::rocprim::make_discard_iterator(),
-        ::rocprim::make_zip_iterator(::rocprim::make_tuple(offsets_tmp, counts_tmp)),
-        all_runs_count_tmp,
-        reduce_op, ::rocprim::equal_to<input_type>(),
-        stream, debug_synchronous
-    );
-    if(error != hipSuccess) return error;
-    reduce_by_key_bytes = ::rocprim::detail::align_size(reduce_by_key_bytes);
-
-    // Calculate size of temporary storage for select operation
-    size_t select_bytes;
-    error = ::rocprim::select<typename config::select>(
-        nullptr, select_bytes,
-        ::rocprim::make_zip_iterator(::rocprim::make_tuple(offsets_tmp, counts_tmp)),
-        ::rocprim::make_zip_iterator(::rocprim::make_tuple(offsets_output, counts_output)),
-        runs_count_output,
-        size,
-        non_trivial_runs_select_op,
+    return detail::run_length_encode_impl<true, Config>(
+        temporary_storage, storage_size,
+        input, size,
+        offsets_output, counts_output, runs_count_output,
         stream, debug_synchronous
     );
-    if(error != hipSuccess) return error;
-    select_bytes = ::rocprim::detail::align_size(select_bytes);
-
-    const size_t offsets_tmp_bytes = ::rocprim::detail::align_size(size * sizeof(offset_type));
-    const size_t counts_tmp_bytes = ::rocprim::detail::align_size(size * sizeof(count_type));
-    const size_t all_runs_count_tmp_bytes = sizeof(count_type);
-    if(temporary_storage == nullptr)
-    {
-        storage_size = ::rocprim::max(reduce_by_key_bytes, select_bytes) +
-            offsets_tmp_bytes + counts_tmp_bytes + all_runs_count_tmp_bytes;
-        return hipSuccess;
-    }
-
-    char * ptr = reinterpret_cast<char *>(temporary_storage);
-    ptr += ::rocprim::max(reduce_by_key_bytes, select_bytes);
-    offsets_tmp = reinterpret_cast<offset_type *>(ptr);
-    ptr += offsets_tmp_bytes;
-    counts_tmp = reinterpret_cast<count_type *>(ptr);
-    ptr += counts_tmp_bytes;
-    all_runs_count_tmp = reinterpret_cast<count_type *>(ptr);
-
-    std::chrono::high_resolution_clock::time_point start;
+}
 
-    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
-    error = ::rocprim::reduce_by_key<typename config::reduce_by_key>(
-        temporary_storage, reduce_by_key_bytes,
-        input,
-        ::rocprim::make_zip_iterator(
-            ::rocprim::make_tuple(
-                ::rocprim::make_counting_iterator<offset_type>(0),
-                ::rocprim::make_constant_iterator<count_type>(1)
-            )
-        ),
-        size,
-        ::rocprim::make_discard_iterator(), // Ignore unique output
-        ::rocprim::make_zip_iterator(rocprim::make_tuple(offsets_tmp, counts_tmp)),
-        all_runs_count_tmp,
-        reduce_op, ::rocprim::equal_to<input_type>(),
-        stream, debug_synchronous
-    );
-    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("rocprim::reduce_by_key", size, start)
-
-    // Read count of all runs (including trivial runs)
-    count_type all_runs_count;
-    error = detail::memcpy_and_sync(&all_runs_count,
-                                    all_runs_count_tmp,
-                                    sizeof(count_type),
-                                    hipMemcpyDeviceToHost,
-                                    stream);
-    if(error != hipSuccess)
-        return error;
-
-    // Select non-trivial runs
-    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
-    error = ::rocprim::select<typename config::select>(
-        temporary_storage, select_bytes,
-        ::rocprim::make_zip_iterator(::rocprim::make_tuple(offsets_tmp, counts_tmp)),
-        ::rocprim::make_zip_iterator(::rocprim::make_tuple(offsets_output, counts_output)),
-        runs_count_output,
-        all_runs_count,
-        non_trivial_runs_select_op,
+/// \brief Parallel run-length decoding for device level.
+///
+/// run_length_decode function expands the runs of \p values_input, it writes every value
+/// of \p values_input repeated by the value of the corresponding element of \p counts_input
+/// to \p output. It is the inverse of \p run_length_encode.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p values_input and \p counts_input must have at least \p runs
+/// elements.
+/// * Range specified by \p output must have at least as many elements as the sum of the
+/// counts.
+/// * Counts can be zero, such runs are not written.
+/// * The end offsets of the runs are computed by an inclusive scan of the counts,
+/// and merged with the indices of the output by merge path, so every tile of the output
+/// finds its runs with one search.
+///
+/// \tparam Config - [optional] configuration of the decoding kernel. It can be
+/// \p kernel_config or a custom class with the same members.
+/// \tparam ValuesInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam CountsInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] values_input - iterator to the first element in the range of values of the runs.
+/// \param [in] counts_input - iterator to the first element in the range of lengths of the runs.
+/// \param [in] runs - number of runs.
+/// \param [out] output - iterator to the first element in the output range of decoded values.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the runs of an array of integer values are decoded.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t runs;                // e.g., 4
+/// int * values_input;         // e.g., [1, 2, 10, 88]
+/// int * counts_input;         // e.g., [3, 1, 3, 1]
+/// int * output;               // empty array of 8 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::run_length_decode(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     values_input, counts_input, runs, output
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // decode runs
+/// rocprim::run_length_decode(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     values_input, counts_input, runs, output
+/// );
+/// // output: [1, 1, 1, 2, 10, 10, 10, 88]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class ValuesInputIterator,
+    class CountsInputIterator,
+    class OutputIterator
+>
+inline
+hipError_t run_length_decode(void * temporary_storage,
+                             size_t& storage_size,
+                             ValuesInputIterator values_input,
+                             CountsInputIterator counts_input,
+                             size_t runs,
+                             OutputIterator output,
+                             hipStream_t stream = 0,
+                             bool debug_synchronous = false)
+{
+    return detail::run_length_decode_impl<Config>(
+        temporary_storage, storage_size,
+        values_input, counts_input, runs, output,
         stream, debug_synchronous
     );
-    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("rocprim::select", all_runs_count, start)
-
-    return hipSuccess;
 }
 
 #undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
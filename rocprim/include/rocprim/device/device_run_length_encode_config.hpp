@@ -35,10 +35,12 @@ BEGIN_ROCPRIM_NAMESPACE
 
 /// \brief Configuration of device-level run-length encoding operation.
 ///
-/// \tparam ReduceByKeyConfig - configuration of device-level reduce-by-key operation.
-/// Must be \p reduce_by_key_config_v2 or \p default_config.
-/// \tparam SelectConfig - configuration of device-level select operation.
-/// Must be \p select_config or \p default_config.
+/// \tparam ReduceByKeyConfig - ignored: \p run_length_encode and
+/// \p run_length_encode_non_trivial_runs run a single look-back kernel configured by
+/// \p SelectConfig. The parameter is kept for compatibility. Must be
+/// \p reduce_by_key_config_v2 or \p default_config.
+/// \tparam SelectConfig - configuration of the encoding kernel (block size, items per thread,
+/// key load method and block scan method). Must be \p select_config or \p default_config.
 template<
     class ReduceByKeyConfig,
     class SelectConfig = default_config
@@ -46,7 +48,12 @@ template<
 struct run_length_encode_config
 {
     /// \brief Configuration of device-level reduce-by-key operation.
-    using reduce_by_key = ReduceByKeyConfig;
+    ///
+    /// \deprecated The encoding runs in a single kernel configured by \p select, this
+    /// configuration is ignored.
+    using reduce_by_key [[deprecated("run_length_encode_config::reduce_by_key is ignored, the "
+                                     "encoding kernel is configured by the select config.")]]
+    = ReduceByKeyConfig;
     /// \brief Configuration of device-level select operation.
     using select = SelectConfig;
 };
@@ -23,20 +23,29 @@
 
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <type_traits>
 
 #include "../config.hpp"
 #include "../detail/temp_storage.hpp"
 #include "../detail/various.hpp"
 #include "../functional.hpp"
+#include "../iterator/transform_iterator.hpp"
 #include "../type_traits.hpp"
 #include "../types/future_value.hpp"
 
 #include "detail/config/device_scan.hpp"
+#include "detail/device_accumulator.hpp"
 #include "detail/device_scan_common.hpp"
+#include "detail/device_instantiations.hpp"
 #include "detail/device_scan_lookback.hpp"
+#include "detail/device_reproducible_sum.hpp"
 #include "detail/device_scan_reduce_then_scan.hpp"
+#include "call_info.hpp"
+#include "device_reduce.hpp"
 #include "device_transform.hpp"
+#include "instrumentation.hpp"
+#include "lookback_state_cache.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -53,7 +62,8 @@ template<
     class InputIterator,
     class OutputIterator,
     class BinaryFunction,
-    class InitValueType
+    class InitValueType,
+    class TotalOutputIterator
 >
 ROCPRIM_KERNEL
 __launch_bounds__(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE)
@@ -61,10 +71,11 @@ void single_scan_kernel(InputIterator input,
                         const size_t size,
                         const InitValueType initial_value,
                         OutputIterator output,
-                        BinaryFunction scan_op)
+                        BinaryFunction scan_op,
+                        TotalOutputIterator total_output)
 {
     single_scan_kernel_impl<Exclusive, Config>(
-        input, size, get_input_value(initial_value), output, scan_op
+        input, size, get_input_value(initial_value), output, scan_op, total_output
     );
 }
 
@@ -95,7 +106,8 @@ template<
     class InputIterator,
     class OutputIterator,
     class BinaryFunction,
-    class InitValueType
+    class InitValueType,
+    class TotalOutputIterator
 >
 ROCPRIM_KERNEL
 __launch_bounds__(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE)
@@ -105,6 +117,7 @@ void final_scan_kernel(InputIterator input,
                        const InitValueType initial_value,
                        BinaryFunction scan_op,
                        input_type_t<InitValueType>* block_prefixes,
+                       TotalOutputIterator total_output,
                        input_type_t<InitValueType>* previous_last_element = nullptr,
                        input_type_t<InitValueType>* new_last_element = nullptr,
                        bool override_first_value = false,
@@ -112,7 +125,7 @@ void final_scan_kernel(InputIterator input,
 {
     final_scan_kernel_impl<Exclusive, Config>(
         input, size, output, get_input_value(initial_value),
-        scan_op, block_prefixes,
+        scan_op, block_prefixes, total_output,
         previous_last_element, new_last_element,
         override_first_value, save_last_value
     );
@@ -127,7 +140,8 @@ template<
     class OutputIterator,
     class BinaryFunction,
     class InitValueType,
-    class LookBackScanState
+    class LookBackScanState,
+    class TotalOutputIterator
 >
 ROCPRIM_KERNEL
 __launch_bounds__(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE)
@@ -138,7 +152,8 @@ void lookback_scan_kernel(InputIterator input,
                           BinaryFunction scan_op,
                           LookBackScanState lookback_scan_state,
                           const unsigned int number_of_blocks,
-                          ordered_block_id<unsigned int> ordered_bid,
+                          striped_ordered_block_id<unsigned int> ordered_bid,
+                          TotalOutputIterator total_output,
                           input_type_t<InitValueType>* previous_last_element = nullptr,
                           input_type_t<InitValueType>* new_last_element = nullptr,
                           bool override_first_value = false,
@@ -146,13 +161,14 @@ void lookback_scan_kernel(InputIterator input,
 {
     lookback_scan_kernel_impl<Exclusive, Config>(
         input, output, size, get_input_value(initial_value), scan_op,
-        lookback_scan_state, number_of_blocks, ordered_bid,
+        lookback_scan_state, number_of_blocks, ordered_bid, total_output,
         previous_last_element, new_last_element,
         override_first_value, save_last_value
     );
 }
 
 #define ROCPRIM_DETAIL_HIP_SYNC(name, size, start) \
+    ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
     if(debug_synchronous) \
     { \
         std::cout << name << "(" << size << ")"; \
@@ -167,6 +183,7 @@ void lookback_scan_kernel(InputIterator input,
     { \
         auto _error = hipGetLastError(); \
         if(_error != hipSuccess) return _error; \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
         if(debug_synchronous) \
         { \
             std::cout << name << "(" << size << ")"; \
@@ -184,7 +201,8 @@ template<
     class InputIterator,
     class OutputIterator,
     class InitValueType,
-    class BinaryFunction
+    class BinaryFunction,
+    class TotalOutputIterator = scan_no_total_output
 >
 inline
 auto scan_impl(void * temporary_storage,
@@ -195,11 +213,13 @@ auto scan_impl(void * temporary_storage,
                const size_t size,
                BinaryFunction scan_op,
                const hipStream_t stream,
-               bool debug_synchronous)
+               bool debug_synchronous,
+               TotalOutputIterator total_output = TotalOutputIterator())
     -> typename std::enable_if<!Config::use_lookback, hipError_t>::type
 {
     using config = Config;
     using real_init_value_type = input_type_t<InitValueType>;
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
 
     constexpr unsigned int block_size = config::block_size;
     constexpr unsigned int items_per_thread = config::items_per_thread;
@@ -263,6 +283,7 @@ auto scan_impl(void * temporary_storage,
             if( grid_size != 0 )
             {
                 if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+                ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("block_reduce_kernel");
                 hipLaunchKernelGGL(
                     HIP_KERNEL_NAME(detail::block_reduce_kernel<
                         config, InputIterator, BinaryFunction, real_init_value_type
@@ -289,6 +310,7 @@ auto scan_impl(void * temporary_storage,
                 auto nested_temp_storage_size = storage_size - (number_of_blocks * sizeof(real_init_value_type));
 
                 if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+                ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("nested_device_scan");
                 auto error = scan_impl<false, config>(
                     nested_temp_storage,
                     nested_temp_storage_size,
@@ -308,12 +330,13 @@ auto scan_impl(void * temporary_storage,
             // Grid size for final_scan_kernel
             grid_size = number_of_blocks;
             if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+            ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("final_scan_kernel");
             hipLaunchKernelGGL(
                 HIP_KERNEL_NAME(detail::final_scan_kernel<
                     Exclusive, // flag for exclusive scan operation
                     config, // kernel configuration (block size, ipt)
                     InputIterator, OutputIterator,
-                    BinaryFunction, InitValueType
+                    BinaryFunction, InitValueType, TotalOutputIterator
                 >),
                 dim3(grid_size), dim3(block_size), 0, stream,
                 input + offset,
@@ -322,6 +345,7 @@ auto scan_impl(void * temporary_storage,
                 initial_value,
                 scan_op,
                 block_prefixes,
+                total_output,
                 previous_last_element,
                 new_last_element,
                 i != size_t(0) && ((!Exclusive && number_of_blocks == 1) || Exclusive),
@@ -340,6 +364,13 @@ auto scan_impl(void * temporary_storage,
                 if(error != hipSuccess) return error;
             }
         }
+        // The blocks are reduced, then the input is read again by the final scan
+        record_call_info("scan",
+                         "reduce_then_scan",
+                         2,
+                         false,
+                         2 * size * sizeof(input_type),
+                         size * sizeof(real_init_value_type));
     }
     else
     {
@@ -351,16 +382,24 @@ auto scan_impl(void * temporary_storage,
         }
 
         if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("single_scan_kernel");
         hipLaunchKernelGGL(
             HIP_KERNEL_NAME(detail::single_scan_kernel<
                 Exclusive, // flag for exclusive scan operation
                 config, // kernel configuration (block size, ipt)
-                InputIterator, OutputIterator, BinaryFunction
+                InputIterator, OutputIterator, BinaryFunction, InitValueType,
+                TotalOutputIterator
             >),
             dim3(1), dim3(block_size), 0, stream,
-            input, size, initial_value, output, scan_op
+            input, size, initial_value, output, scan_op, total_output
         );
         ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("single_scan_kernel", size, start);
+        record_call_info("scan",
+                         "single",
+                         1,
+                         false,
+                         size * sizeof(input_type),
+                         size * sizeof(real_init_value_type));
     }
     return hipSuccess;
 }
@@ -371,7 +410,8 @@ template<
     class InputIterator,
     class OutputIterator,
     class InitValueType,
-    class BinaryFunction
+    class BinaryFunction,
+    class TotalOutputIterator = scan_no_total_output
 >
 inline
 auto scan_impl(void * temporary_storage,
@@ -382,26 +422,47 @@ auto scan_impl(void * temporary_storage,
                const size_t size,
                BinaryFunction scan_op,
                const hipStream_t stream,
-               bool debug_synchronous)
+               bool debug_synchronous,
+               TotalOutputIterator total_output = TotalOutputIterator())
     -> typename std::enable_if<Config::use_lookback, hipError_t>::type
 {
     using config = Config;
     using real_init_value_type = input_type_t<InitValueType>;
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
 
     using scan_state_type = detail::lookback_scan_state<real_init_value_type>;
     using scan_state_with_sleep_type = detail::lookback_scan_state<real_init_value_type, true>;
-    using ordered_block_id_type = detail::ordered_block_id<unsigned int>;
+    using ordered_block_id_type = detail::striped_ordered_block_id<unsigned int>;
 
     constexpr unsigned int block_size = config::block_size;
     constexpr unsigned int items_per_thread = config::items_per_thread;
     constexpr auto items_per_block = block_size * items_per_thread;
 
     static constexpr size_t size_limit = config::size_limit;
-    static constexpr size_t aligned_size_limit = ::rocprim::max<size_t>(size_limit - size_limit % items_per_block, items_per_block);
+    // With the default size limit the whole input is scanned by one launch sequence using
+    // 64-bit offsets, otherwise the input is split into chunks of size_limit items.
+    static constexpr bool use_size_limit = size_limit < ROCPRIM_GRID_SIZE_LIMIT;
+    static constexpr size_t aligned_size_limit = use_size_limit
+        ? ::rocprim::max<size_t>(size_limit - size_limit % items_per_block, items_per_block)
+        : std::numeric_limits<size_t>::max();
     size_t limited_size = std::min<size_t>(size, aligned_size_limit);
     const bool use_limited_size = limited_size == aligned_size_limit;
 
-    unsigned int number_of_blocks = (limited_size + items_per_block - 1)/items_per_block;
+    const size_t full_number_of_blocks = ::rocprim::detail::ceiling_div(limited_size, items_per_block);
+    // The number of tiles is limited by the 32-bit indices of the look-back scan state
+    if(full_number_of_blocks > std::numeric_limits<unsigned int>::max() - ::rocprim::host_warp_size())
+    {
+        return hipErrorInvalidValue;
+    }
+    unsigned int number_of_blocks = static_cast<unsigned int>(full_number_of_blocks);
+    // The number of threads in a grid is limited, blocks of a smaller grid scan multiple tiles.
+    // The grid can also be limited by blocks_per_cu and scoped_grid_limit.
+    unsigned int max_grid_size = std::numeric_limits<unsigned int>::max() / block_size;
+    if(const hipError_t error
+       = limit_grid_size(max_grid_size, config_blocks_per_cu<config>::value))
+    {
+        return error;
+    }
 
     // Pointer to array with block_prefixes
     void*                           scan_state_storage;
@@ -435,6 +496,55 @@ auto scan_impl(void * temporary_storage,
 
     if(number_of_blocks > 1 || use_limited_size)
     {
+        size_t number_of_launch = (size + limited_size - 1)/limited_size;
+
+        // With a lookback_state_cache the state is kept in the cache between the calls, the
+        // launches are told apart by the epochs of the flags and of the ordered block ids, and
+        // the state is only initialized when it is cleared. Every stripe of the ordered block ids
+        // must give out fewer than 2^epoch_shift ids in a launch.
+        unsigned int first_epoch = 0;
+        bool         clear_state = false;
+        bool         use_cache   = false;
+        if(number_of_blocks < (1u << (ordered_block_id_type::epoch_shift - 1)))
+        {
+            void*                           cached_scan_state_storage;
+            ordered_block_id_type::id_type* cached_ordered_bid_storage;
+            const auto                      cached_partition
+                = detail::temp_storage::make_linear_partition(
+                    detail::temp_storage::make_partition(
+                        &cached_scan_state_storage,
+                        scan_state_type::get_temp_storage_layout(number_of_blocks)),
+                    detail::temp_storage::make_partition(
+                        &cached_ordered_bid_storage,
+                        ordered_block_id_type::get_temp_storage_layout()));
+            size_t cached_state_size;
+            void*  cached_storage;
+            detail::temp_storage::partition(nullptr, cached_state_size, cached_partition);
+            if(const hipError_t error = acquire_lookback_state(
+                   lookback_state_key<scan_state_type>(),
+                   cached_state_size,
+                   number_of_blocks,
+                   static_cast<unsigned int>(std::min<size_t>(number_of_launch, ~0u)),
+                   stream,
+                   cached_storage,
+                   first_epoch,
+                   clear_state))
+            {
+                return error;
+            }
+            if(cached_storage != nullptr)
+            {
+                detail::temp_storage::partition(cached_storage,
+                                                cached_state_size,
+                                                cached_partition);
+                scan_state_storage  = cached_scan_state_storage;
+                ordered_bid_storage = cached_ordered_bid_storage;
+                use_cache           = true;
+            }
+        }
+        // A failed launch leaves the cached state behind the epochs, it is cleared by the next call
+        lookback_state_failure_guard cache_guard(use_cache);
+
         // Create and initialize lookback_scan_state obj
         auto scan_state = scan_state_type::create(scan_state_storage, number_of_blocks);
         auto scan_state_with_sleep
@@ -442,25 +552,21 @@ auto scan_impl(void * temporary_storage,
         // Create and initialize ordered_block_id obj
         auto ordered_bid = ordered_block_id_type::create(ordered_bid_storage);
 
-        hipDeviceProp_t prop;
-        int deviceId;
-        static_cast<void>(hipGetDevice(&deviceId));
-        static_cast<void>(hipGetDeviceProperties(&prop, deviceId));
+        bool use_sleep;
+        if(const hipError_t error = is_sleep_scan_state_used(use_sleep))
+        {
+            return error;
+        }
 
         if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("init_lookback_scan_state_kernel");
 
-#if HIP_VERSION >= 307
-        int asicRevision = prop.asicRevision;
-#else
-        int asicRevision = 0;
-#endif
-
-        size_t number_of_launch = (size + limited_size - 1)/limited_size;
         for (size_t i = 0, offset = 0; i < number_of_launch; i++, offset+=limited_size )
         {
             size_t current_size = std::min<size_t>(size - offset, limited_size);
             number_of_blocks = (current_size + items_per_block - 1)/items_per_block;
-            auto grid_size = (number_of_blocks + block_size - 1)/block_size;
+            auto grid_size = std::min((number_of_blocks + block_size - 1) / block_size,
+                                      max_grid_size);
 
             if(debug_synchronous)
             {
@@ -474,37 +580,53 @@ auto scan_impl(void * temporary_storage,
                 std::cout << "items_per_block " << items_per_block << '\n';
             }
 
-            if (prop.gcnArch == 908 && asicRevision < 2)
+            if(use_cache)
             {
-                hipLaunchKernelGGL(
-                    HIP_KERNEL_NAME(init_lookback_scan_state_kernel<scan_state_with_sleep_type>),
-                    dim3(grid_size), dim3(block_size), 0, stream,
-                    scan_state_with_sleep, number_of_blocks, ordered_bid
-                );
-            } else
+                const unsigned int epoch = first_epoch + static_cast<unsigned int>(i);
+                scan_state.set_epoch(epoch);
+                scan_state_with_sleep.set_epoch(epoch);
+                ordered_bid = ordered_block_id_type::create(ordered_bid_storage, epoch);
+            }
+
+            if(!use_cache || (clear_state && i == 0))
             {
-                hipLaunchKernelGGL(
-                    HIP_KERNEL_NAME(init_lookback_scan_state_kernel<scan_state_type>),
-                    dim3(grid_size), dim3(block_size), 0, stream,
-                    scan_state, number_of_blocks, ordered_bid
-                );
+                if(use_sleep)
+                {
+                    hipLaunchKernelGGL(
+                        HIP_KERNEL_NAME(init_lookback_scan_state_kernel<scan_state_with_sleep_type,
+                                                                        ordered_block_id_type>),
+                        dim3(grid_size), dim3(block_size), 0, stream,
+                        scan_state_with_sleep, number_of_blocks, ordered_bid
+                    );
+                } else
+                {
+                    hipLaunchKernelGGL(
+                        HIP_KERNEL_NAME(init_lookback_scan_state_kernel<scan_state_type,
+                                                                        ordered_block_id_type>),
+                        dim3(grid_size), dim3(block_size), 0, stream,
+                        scan_state, number_of_blocks, ordered_bid
+                    );
+                }
+                ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_lookback_scan_state_kernel", number_of_blocks, start)
             }
-            ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_lookback_scan_state_kernel", number_of_blocks, start)
 
             if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
-            grid_size = number_of_blocks;
-            if (prop.gcnArch == 908 && asicRevision < 2)
+            ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("lookback_scan_kernel");
+            grid_size = std::min(number_of_blocks, max_grid_size);
+            if(use_sleep)
             {
                 hipLaunchKernelGGL(
                     HIP_KERNEL_NAME(lookback_scan_kernel<
                         Exclusive, // flag for exclusive scan operation
                         config, // kernel configuration (block size, ipt)
                         InputIterator, OutputIterator,
-                        BinaryFunction, InitValueType, scan_state_with_sleep_type
+                        BinaryFunction, InitValueType, scan_state_with_sleep_type,
+                        TotalOutputIterator
                     >),
                     dim3(grid_size), dim3(block_size), 0, stream,
                     input + offset, output + offset, current_size, initial_value,
                     scan_op, scan_state_with_sleep, number_of_blocks, ordered_bid,
+                    total_output,
                     previous_last_element, new_last_element,
                     i != size_t(0), number_of_launch > 1
                 );
@@ -526,11 +648,11 @@ auto scan_impl(void * temporary_storage,
                         Exclusive, // flag for exclusive scan operation
                         config, // kernel configuration (block size, ipt)
                         InputIterator, OutputIterator,
-                        BinaryFunction, InitValueType, scan_state_type
+                        BinaryFunction, InitValueType, scan_state_type, TotalOutputIterator
                     >),
                     dim3(grid_size), dim3(block_size), 0, stream,
                     input + offset, output + offset, current_size, initial_value,
-                    scan_op, scan_state, number_of_blocks, ordered_bid,
+                    scan_op, scan_state, number_of_blocks, ordered_bid, total_output,
                     previous_last_element, new_last_element,
                     i != size_t(0), number_of_launch > 1
                 );
@@ -548,6 +670,13 @@ auto scan_impl(void * temporary_storage,
                 if(error != hipSuccess) return error;
             }
         }
+        cache_guard.dismiss();
+        record_call_info("scan",
+                         "lookback",
+                         1,
+                         use_sleep,
+                         size * sizeof(input_type),
+                         size * sizeof(real_init_value_type));
     }
     else
     {
@@ -560,16 +689,24 @@ auto scan_impl(void * temporary_storage,
         }
 
         if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("single_scan_kernel");
         hipLaunchKernelGGL(
             HIP_KERNEL_NAME(single_scan_kernel<
                 Exclusive, // flag for exclusive scan operation
                 config, // kernel configuration (block size, ipt)
-                InputIterator, OutputIterator, BinaryFunction
+                InputIterator, OutputIterator, BinaryFunction, InitValueType,
+                TotalOutputIterator
             >),
             dim3(1), dim3(block_size), 0, stream,
-            input, size, initial_value, output, scan_op
+            input, size, initial_value, output, scan_op, total_output
         );
         ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("single_scan_kernel", size, start);
+        record_call_info("scan",
+                         "single",
+                         1,
+                         false,
+                         size * sizeof(input_type),
+                         size * sizeof(real_init_value_type));
     }
     return hipSuccess;
 }
@@ -591,8 +728,9 @@ auto scan_impl(void * temporary_storage,
 /// * Returns the required size of \p temporary_storage in \p storage_size
 /// if \p temporary_storage in a null pointer.
 /// * Ranges specified by \p input and \p output must have at least \p size elements.
-/// * By default, the input type is used for accumulation. A custom type
-/// can be specified using <tt>rocprim::transform_iterator</tt>, see the example below.
+/// * By default, the input type is used for accumulation. A custom type can be specified
+/// with \p AccumulatorType, see the example below. The input is still loaded as its own type
+/// (as vectors when \p input is a pointer) and converted to \p AccumulatorType in registers.
 ///
 /// \tparam Config - [optional] configuration of the primitive. It can be \p scan_config or
 /// a custom class with the same members.
@@ -602,6 +740,8 @@ auto scan_impl(void * temporary_storage,
 /// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
 /// \tparam BinaryFunction - type of binary function used for scan. Default type
 /// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+/// \tparam AccumulatorType - [optional] type used for accumulation. The default is the
+/// \p value_type of \p InputIterator.
 ///
 /// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
 /// a null pointer is passed, the required allocation size (in bytes) is written to
@@ -664,23 +804,19 @@ auto scan_impl(void * temporary_storage,
 /// short * input;
 /// int * output;
 ///
-/// // Use a transform iterator to specify a custom accumulator type
-/// auto input_iterator = rocprim::make_transform_iterator(
-///     input, [] __device__ (T in) { return static_cast<int>(in); });
-///
 /// size_t temporary_storage_size_bytes;
 /// void * temporary_storage_ptr = nullptr;
-/// // Use the transform iterator
-/// rocprim::inclusive_scan(
+/// // The short inputs are accumulated as int
+/// rocprim::inclusive_scan<rocprim::default_config, short*, int*, rocprim::plus<int>, int>(
 ///     temporary_storage_ptr, temporary_storage_size_bytes,
-///     input_iterator, output, input_size, rocprim::plus<int>()
+///     input, output, input_size, rocprim::plus<int>()
 /// );
 ///
 /// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
 ///
-/// rocprim::inclusive_scan(
+/// rocprim::inclusive_scan<rocprim::default_config, short*, int*, rocprim::plus<int>, int>(
 ///     temporary_storage_ptr, temporary_storage_size_bytes,
-///     input_iterator, output, input_size, rocprim::plus<int>()
+///     input, output, input_size, rocprim::plus<int>()
 /// );
 /// \endcode
 /// \endparblock
@@ -689,9 +825,11 @@ template<
     class Config = default_config,
     class InputIterator,
     class OutputIterator,
-    class BinaryFunction = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>
+    class BinaryFunction
+        = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>,
+    class AccumulatorType = typename std::iterator_traits<InputIterator>::value_type
 >
-inline
+// Not inline, see detail/device_instantiations.hpp
 hipError_t inclusive_scan(void * temporary_storage,
                           size_t& storage_size,
                           InputIterator input,
@@ -701,18 +839,17 @@ hipError_t inclusive_scan(void * temporary_storage,
                           const hipStream_t stream = 0,
                           bool debug_synchronous = false)
 {
-    using input_type = typename std::iterator_traits<InputIterator>::value_type;
-
     // Get default config if Config is default_config
     using config = detail::default_or_custom_config<
         Config,
-        detail::default_scan_config<ROCPRIM_TARGET_ARCH, input_type>
+        detail::default_scan_config<ROCPRIM_TARGET_ARCH, AccumulatorType>
         >;
 
     return detail::scan_impl<false, config>(
         temporary_storage, storage_size,
-        // input_type() is a dummy initial value (not used)
-        input, output, input_type(), size,
+        detail::to_accumulator_input<AccumulatorType>(detail::to_kernel_input_iterator(input)),
+        // AccumulatorType() is a dummy initial value (not used)
+        output, AccumulatorType(), size,
         scan_op, stream, debug_synchronous
     );
 }
@@ -739,6 +876,10 @@ hipError_t inclusive_scan(void * temporary_storage,
 /// \tparam InitValueType - type of the initial value.
 /// \tparam BinaryFunction - type of binary function used for scan. Default type
 /// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+/// \tparam AccumulatorType - [optional] type used for accumulation, \p initial_value is
+/// converted to it and the input is converted to it in registers. The default is the type of
+/// \p initial_value. The \p value_type of a \p rocprim::future_value initial value must be
+/// \p AccumulatorType.
 ///
 /// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
 /// a null pointer is passed, the required allocation size (in bytes) is written to
@@ -807,9 +948,11 @@ template<
     class InputIterator,
     class OutputIterator,
     class InitValueType,
-    class BinaryFunction = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>
+    class BinaryFunction
+        = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>,
+    class AccumulatorType = detail::input_type_t<InitValueType>
 >
-inline
+// Not inline, see detail/device_instantiations.hpp
 hipError_t exclusive_scan(void * temporary_storage,
                           size_t& storage_size,
                           InputIterator input,
@@ -819,6 +962,231 @@ hipError_t exclusive_scan(void * temporary_storage,
                           BinaryFunction scan_op = BinaryFunction(),
                           const hipStream_t stream = 0,
                           bool debug_synchronous = false)
+{
+    // Get default config if Config is default_config
+    using config = detail::default_or_custom_config<
+        Config,
+        detail::default_scan_config<ROCPRIM_TARGET_ARCH, AccumulatorType>
+    >;
+
+    return detail::scan_impl<true, config>(
+        temporary_storage, storage_size,
+        detail::to_kernel_input_iterator(input), output,
+        detail::to_accumulator_initial_value<AccumulatorType>(initial_value), size,
+        scan_op, stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel inclusive scan primitive for device level, which also writes the total.
+///
+/// inclusive_scan_with_total performs the same scan as \p inclusive_scan and also writes the
+/// reduction of the whole input (the last element of the output) to \p total_output. The total
+/// is written by the thread holding the last item of the last block, so no separate reduction
+/// or copy of the last output element is needed.
+///
+/// \par Overview
+/// * Supports non-commutative scan operators. However, a scan operator should be
+/// associative.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input and \p output must have at least \p size elements.
+/// * \p total_output is not written when \p size is \p 0.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p scan_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam TotalOutputIterator - iterator type of the total output. It can be a simple
+/// pointer type.
+/// \tparam BinaryFunction - type of binary function used for scan. Default type
+/// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the scan operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to scan.
+/// \param [out] output - iterator to the first element in the output range. It can be
+/// same as \p input.
+/// \param [out] total_output - iterator to the device-accessible total of the scan.
+/// \param [in] size - number of element in the input range.
+/// \param [in] scan_op - binary operation function object that will be used for scan.
+/// Default is BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;    // e.g., 8
+/// int * input;          // e.g., [1, 2, 3, 4, 5, 6, 7, 8]
+/// int * output;         // empty array of 8 elements
+/// int * total;          // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::inclusive_scan_with_total(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, total, input_size, rocprim::plus<int>()
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform scan
+/// rocprim::inclusive_scan_with_total(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, total, input_size, rocprim::plus<int>()
+/// );
+/// // output: [1, 3, 6, 10, 15, 21, 28, 36]
+/// // total: [36]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class InputIterator,
+    class OutputIterator,
+    class TotalOutputIterator,
+    class BinaryFunction = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>
+>
+inline
+hipError_t inclusive_scan_with_total(void * temporary_storage,
+                                     size_t& storage_size,
+                                     InputIterator input,
+                                     OutputIterator output,
+                                     TotalOutputIterator total_output,
+                                     const size_t size,
+                                     BinaryFunction scan_op = BinaryFunction(),
+                                     const hipStream_t stream = 0,
+                                     bool debug_synchronous = false)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    // Get default config if Config is default_config
+    using config = detail::default_or_custom_config<
+        Config,
+        detail::default_scan_config<ROCPRIM_TARGET_ARCH, input_type>
+        >;
+
+    return detail::scan_impl<false, config>(
+        temporary_storage, storage_size,
+        // input_type() is a dummy initial value (not used)
+        detail::to_kernel_input_iterator(input), output, input_type(), size,
+        scan_op, stream, debug_synchronous, total_output
+    );
+}
+
+/// \brief Parallel exclusive scan primitive for device level, which also writes the total.
+///
+/// exclusive_scan_with_total performs the same scan as \p exclusive_scan and also writes
+/// the reduction of \p initial_value and the whole input (the value that would follow the last
+/// element of the output) to \p total_output. The total is written by the thread holding the
+/// last item of the last block, so no separate reduction or copy is needed.
+///
+/// \par Overview
+/// * Supports non-commutative scan operators. However, a scan operator should be
+/// associative.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input and \p output must have at least \p size elements.
+/// * \p total_output is not written when \p size is \p 0.
+/// * The total is computed from the last input element after the output is stored, so
+/// \p output must not be the same as \p input.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p scan_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam TotalOutputIterator - iterator type of the total output. It can be a simple
+/// pointer type.
+/// \tparam InitValueType - type of the initial value.
+/// \tparam BinaryFunction - type of binary function used for scan. Default type
+/// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the scan operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to scan.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [out] total_output - iterator to the device-accessible total of the scan.
+/// \param [in] initial_value - initial value to start the scan.
+/// A rocpim::future_value may be passed to use a value that will be later computed.
+/// \param [in] size - number of element in the input range.
+/// \param [in] scan_op - binary operation function object that will be used for scan.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the offsets of variable-sized items and the total size are computed
+/// by one scan.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;    // e.g., 5
+/// int * sizes;          // e.g., [3, 1, 4, 1, 5]
+/// int * offsets;        // empty array of 5 elements
+/// int * total;          // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::exclusive_scan_with_total(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     sizes, offsets, total, 0, input_size, rocprim::plus<int>()
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform scan
+/// rocprim::exclusive_scan_with_total(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     sizes, offsets, total, 0, input_size, rocprim::plus<int>()
+/// );
+/// // offsets: [0, 3, 4, 8, 9]
+/// // total: [14]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class InputIterator,
+    class OutputIterator,
+    class TotalOutputIterator,
+    class InitValueType,
+    class BinaryFunction = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>
+>
+inline
+hipError_t exclusive_scan_with_total(void * temporary_storage,
+                                     size_t& storage_size,
+                                     InputIterator input,
+                                     OutputIterator output,
+                                     TotalOutputIterator total_output,
+                                     const InitValueType initial_value,
+                                     const size_t size,
+                                     BinaryFunction scan_op = BinaryFunction(),
+                                     const hipStream_t stream = 0,
+                                     bool debug_synchronous = false)
 {
     using real_init_value_type = detail::input_type_t<InitValueType>;
 
@@ -830,14 +1198,356 @@ hipError_t exclusive_scan(void * temporary_storage,
 
     return detail::scan_impl<true, config>(
         temporary_storage, storage_size,
-        input, output, initial_value, size,
-        scan_op, stream, debug_synchronous
+        detail::to_kernel_input_iterator(input), output, initial_value, size,
+        scan_op, stream, debug_synchronous, total_output
     );
 }
 
+/// \brief Parallel transform-inclusive-scan primitive for device level.
+///
+/// transform_inclusive_scan function applies \p transform_op to every element of the input and
+/// performs a device-wide inclusive prefix scan of the results using binary \p scan_op
+/// operator.
+///
+/// \par Overview
+/// * It is equivalent to \p inclusive_scan of a \p transform_iterator of \p input. When
+/// \p input is a pointer, full tiles of the input are loaded as vectors and \p transform_op is
+/// applied in registers, which is also done for a \p transform_iterator over a pointer passed
+/// to \p inclusive_scan.
+/// * The result type of \p transform_op is used for accumulation.
+/// * Supports non-commutative scan operators. However, a scan operator should be
+/// associative.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input and \p output must have at least \p size elements.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p scan_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam BinaryFunction - type of binary function used for scan.
+/// \tparam UnaryFunction - type of unary function applied to the input elements.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the scan operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to scan.
+/// \param [out] output - iterator to the first element in the output range. It can be
+/// same as \p input.
+/// \param [in] size - number of element in the input range.
+/// \param [in] scan_op - binary operation function object that will be used for scan of the
+/// transformed elements.
+/// \param [in] transform_op - unary operation function object that is applied to every input
+/// element. The signature of the function should be equivalent to the following:
+/// <tt>T f(const U &a);</tt>, where \p U is the \p value_type of \p InputIterator.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the running sums of squares of an array of \p short values are computed.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// auto square = [] __device__ (short x) -> int { return int(x) * int(x); };
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;    // e.g., 4
+/// short * input;        // e.g., [1, 2, 3, 4]
+/// int * output;         // empty array of 4 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::transform_inclusive_scan(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size, rocprim::plus<int>(), square
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform scan
+/// rocprim::transform_inclusive_scan(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size, rocprim::plus<int>(), square
+/// );
+/// // output: [1, 5, 14, 30]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class BinaryFunction,
+         class UnaryFunction>
+inline hipError_t transform_inclusive_scan(void*             temporary_storage,
+                                           size_t&           storage_size,
+                                           InputIterator     input,
+                                           OutputIterator    output,
+                                           const size_t      size,
+                                           BinaryFunction    scan_op,
+                                           UnaryFunction     transform_op,
+                                           const hipStream_t stream            = 0,
+                                           bool              debug_synchronous = false)
+{
+    const auto transformed_input
+        = ::rocprim::make_transform_iterator(detail::to_kernel_input_iterator(input), transform_op);
+    using input_type = typename std::iterator_traits<decltype(transformed_input)>::value_type;
+
+    // Get default config if Config is default_config
+    using config = detail::default_or_custom_config<
+        Config,
+        detail::default_scan_config<ROCPRIM_TARGET_ARCH, input_type>>;
+
+    return detail::scan_impl<false, config>(temporary_storage,
+                                            storage_size,
+                                            transformed_input,
+                                            output,
+                                            // input_type() is a dummy initial value (not used)
+                                            input_type(),
+                                            size,
+                                            scan_op,
+                                            stream,
+                                            debug_synchronous);
+}
+
+/// \brief Parallel transform-exclusive-scan primitive for device level.
+///
+/// transform_exclusive_scan function applies \p transform_op to every element of the input and
+/// performs a device-wide exclusive prefix scan of the results using binary \p scan_op
+/// operator.
+///
+/// \par Overview
+/// * It is equivalent to \p exclusive_scan of a \p transform_iterator of \p input. When
+/// \p input is a pointer, full tiles of the input are loaded as vectors and \p transform_op is
+/// applied in registers, which is also done for a \p transform_iterator over a pointer passed
+/// to \p exclusive_scan.
+/// * Supports non-commutative scan operators. However, a scan operator should be
+/// associative.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input and \p output must have at least \p size elements.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p scan_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam InitValueType - type of the initial value.
+/// \tparam BinaryFunction - type of binary function used for scan.
+/// \tparam UnaryFunction - type of unary function applied to the input elements.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the scan operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to scan.
+/// \param [out] output - iterator to the first element in the output range. It can be
+/// same as \p input.
+/// \param [in] initial_value - initial value to start the scan.
+/// A rocpim::future_value may be passed to use a value that will be later computed.
+/// \param [in] size - number of element in the input range.
+/// \param [in] scan_op - binary operation function object that will be used for scan of the
+/// transformed elements.
+/// \param [in] transform_op - unary operation function object that is applied to every input
+/// element. The signature of the function should be equivalent to the following:
+/// <tt>T f(const U &a);</tt>, where \p U is the \p value_type of \p InputIterator.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class InitValueType,
+         class BinaryFunction,
+         class UnaryFunction>
+inline hipError_t transform_exclusive_scan(void*               temporary_storage,
+                                           size_t&             storage_size,
+                                           InputIterator       input,
+                                           OutputIterator      output,
+                                           const InitValueType initial_value,
+                                           const size_t        size,
+                                           BinaryFunction      scan_op,
+                                           UnaryFunction       transform_op,
+                                           const hipStream_t   stream            = 0,
+                                           bool                debug_synchronous = false)
+{
+    using real_init_value_type = detail::input_type_t<InitValueType>;
+
+    // Get default config if Config is default_config
+    using config = detail::default_or_custom_config<
+        Config,
+        detail::default_scan_config<ROCPRIM_TARGET_ARCH, real_init_value_type>>;
+
+    return detail::scan_impl<true, config>(
+        temporary_storage,
+        storage_size,
+        ::rocprim::make_transform_iterator(detail::to_kernel_input_iterator(input), transform_op),
+        output,
+        initial_value,
+        size,
+        scan_op,
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Parallel bitwise-reproducible inclusive prefix sum primitive for device level.
+///
+/// deterministic_inclusive_scan function computes the inclusive prefix sums of floating-point
+/// values such that the results are bitwise identical for every run, configuration and GPU
+/// architecture.
+///
+/// \par Overview
+/// * The results of \p inclusive_scan with \p rocprim::plus depend on the order of the
+/// additions, which is defined by the block size, items per thread and number of blocks, so
+/// they may differ between architectures and configurations. This function rounds every value
+/// to a fixed-point grid derived from the largest finite magnitude in the input and \p size,
+/// and scans the fixed-point digits using integer arithmetic, which is associative.
+/// * The absolute error of every prefix sum is bounded by
+/// <tt>size * max_abs * 2^(3 * (ceil(log2(size)) - 62))</tt>, where \p max_abs is the largest
+/// finite magnitude in the input, plus the rounding of the result to the value type. NaNs, and
+/// infinities of both signs, produce NaN.
+/// * The input is read twice and the accumulation type is wider than the input type, so it is
+/// slower than \p inclusive_scan.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input and \p output must have at least \p size elements.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p scan_config or
+/// a custom class with the same members. It does not affect the results.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type. Its
+/// \p value_type must be \p float or \p double.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the scan operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to scan.
+/// \param [out] output - iterator to the first element in the output range. It can be
+/// same as \p input.
+/// \param [in] size - number of element in the input range.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config, class InputIterator, class OutputIterator>
+inline hipError_t deterministic_inclusive_scan(void*             temporary_storage,
+                                               size_t&           storage_size,
+                                               InputIterator     input,
+                                               OutputIterator    output,
+                                               const size_t      size,
+                                               const hipStream_t stream            = 0,
+                                               bool              debug_synchronous = false)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+    using split_op   = detail::reproducible_sum_split_op<input_type>;
+    using to_value   = detail::reproducible_sum_to_value_op<input_type>;
+    using output_iterator = detail::reproducible_sum_output_iterator<OutputIterator, input_type>;
+    static_assert(detail::is_reproducible_sum_type<input_type>::value,
+                  "deterministic_inclusive_scan only supports float and double values");
+
+    const int digit_bits = detail::reproducible_sum_digit_bits(size);
+
+    double* max_abs{};
+    void*   max_abs_temp_storage{};
+    void*   scan_temp_storage{};
+
+    // The largest magnitude defines the grid, it is computed using the exact maximum operator
+    const auto max_abs_input = ::rocprim::make_transform_iterator(
+        input, detail::reproducible_sum_max_abs_op<input_type>());
+
+    size_t     max_abs_temp_storage_size = 0;
+    hipError_t result                    = ::rocprim::reduce(nullptr,
+                                          max_abs_temp_storage_size,
+                                          max_abs_input,
+                                          max_abs,
+                                          0.0,
+                                          size,
+                                          ::rocprim::maximum<double>(),
+                                          stream,
+                                          debug_synchronous);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    size_t scan_temp_storage_size = 0;
+    result = ::rocprim::inclusive_scan<Config>(
+        nullptr,
+        scan_temp_storage_size,
+        ::rocprim::make_transform_iterator(input, split_op{max_abs, digit_bits}),
+        output_iterator(output, to_value{max_abs, digit_bits}),
+        size,
+        detail::reproducible_sum_op(),
+        stream,
+        debug_synchronous);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&max_abs, 1),
+            detail::temp_storage::make_union_partition(
+                detail::temp_storage::make_partition(&max_abs_temp_storage,
+                                                     max_abs_temp_storage_size),
+                detail::temp_storage::make_partition(&scan_temp_storage,
+                                                     scan_temp_storage_size))));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    result = ::rocprim::reduce(max_abs_temp_storage,
+                               max_abs_temp_storage_size,
+                               max_abs_input,
+                               max_abs,
+                               0.0,
+                               size,
+                               ::rocprim::maximum<double>(),
+                               stream,
+                               debug_synchronous);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    return ::rocprim::inclusive_scan<Config>(
+        scan_temp_storage,
+        scan_temp_storage_size,
+        ::rocprim::make_transform_iterator(input, split_op{max_abs, digit_bits}),
+        output_iterator(output, to_value{max_abs, digit_bits}),
+        size,
+        detail::reproducible_sum_op(),
+        stream,
+        debug_synchronous);
+}
+
 /// @}
 // end of group devicemodule
 
+#ifdef ROCPRIM_USE_INSTANTIATIONS
+ROCPRIM_DETAIL_FOR_EACH_INSTANTIATED_TYPE(ROCPRIM_DETAIL_SCAN_INSTANTIATIONS, extern template)
+#endif
+
 END_ROCPRIM_NAMESPACE
 
 #endif // ROCPRIM_DEVICE_DEVICE_SCAN_HPP_
@@ -0,0 +1,485 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_SCAN_2D_HPP_
+#define ROCPRIM_DEVICE_DEVICE_SCAN_2D_HPP_
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../functional.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+
+#include "config_types.hpp"
+#include "device_scan_2d_config.hpp"
+#include "detail/device_scan_2d.hpp"
+#include "detail/device_scan_common.hpp"
+#include "detail/lookback_scan_state.hpp"
+#include "detail/ordered_block_id.hpp"
+#include "instrumentation.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+template<bool Exclusive,
+         class Config,
+         class InputIterator,
+         class OutputIterator,
+         class ResultType,
+         class BinaryFunction,
+         class LookbackScanState>
+ROCPRIM_KERNEL __launch_bounds__(Config::block_size) void scan_2d_kernel(
+    InputIterator                  input,
+    OutputIterator                 output,
+    const unsigned int             width,
+    const unsigned int             height,
+    const unsigned int             tile_columns,
+    ResultType                     initial_value,
+    BinaryFunction                 scan_op,
+    LookbackScanState              row_state,
+    LookbackScanState              column_state,
+    ordered_block_id<unsigned int> ordered_bid)
+{
+    scan_2d_kernel_impl<Exclusive, Config>(input,
+                                           output,
+                                           width,
+                                           height,
+                                           tile_columns,
+                                           initial_value,
+                                           scan_op,
+                                           row_state,
+                                           column_state,
+                                           ordered_bid);
+}
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
+    { \
+        auto _error = hipGetLastError(); \
+        if(_error != hipSuccess) return _error; \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
+        if(debug_synchronous) \
+        { \
+            std::cout << name << "(" << size << ")"; \
+            auto __error = hipStreamSynchronize(stream); \
+            if(__error != hipSuccess) return __error; \
+            auto _end = std::chrono::high_resolution_clock::now(); \
+            auto _d = std::chrono::duration_cast<std::chrono::duration<double>>(_end - start); \
+            std::cout << " " << _d.count() * 1000 << " ms" << '\n'; \
+        } \
+    }
+
+template<bool Exclusive,
+         class Config,
+         class InputIterator,
+         class OutputIterator,
+         class ResultType,
+         class BinaryFunction>
+inline hipError_t scan_2d_impl(void*              temporary_storage,
+                               size_t&            storage_size,
+                               InputIterator      input,
+                               OutputIterator     output,
+                               const unsigned int width,
+                               const unsigned int height,
+                               const ResultType   initial_value,
+                               BinaryFunction     scan_op,
+                               const hipStream_t  stream,
+                               bool               debug_synchronous)
+{
+    using config = Config;
+
+    using scan_state_type            = detail::lookback_scan_state<ResultType>;
+    using scan_state_with_sleep_type = detail::lookback_scan_state<ResultType, true>;
+    using ordered_block_id_type      = detail::ordered_block_id<unsigned int>;
+
+    constexpr unsigned int block_size_x = config::block_size_x;
+    constexpr unsigned int block_size_y = config::block_size_y;
+    constexpr unsigned int block_size   = block_size_x * block_size_y;
+    constexpr unsigned int tile_width   = block_size_x * config::items_per_thread;
+    constexpr unsigned int tile_height  = block_size_y;
+
+    // Every row and every column of the image has a look-back entry per tile along it
+    const size_t tile_columns = ::rocprim::detail::ceiling_div<size_t>(width, tile_width);
+    const size_t bands        = ::rocprim::detail::ceiling_div<size_t>(height, tile_height);
+    const size_t max_entries  = std::numeric_limits<unsigned int>::max();
+    if(tile_columns * height > max_entries || bands * width > max_entries)
+    {
+        return hipErrorInvalidValue;
+    }
+    const unsigned int row_entries     = static_cast<unsigned int>(tile_columns * height);
+    const unsigned int column_entries  = static_cast<unsigned int>(bands * width);
+    const unsigned int number_of_tiles = static_cast<unsigned int>(tile_columns * bands);
+
+    void*                           row_state_storage;
+    void*                           column_state_storage;
+    ordered_block_id_type::id_type* ordered_bid_storage;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            // This is valid even with scan_state_with_sleep_type
+            detail::temp_storage::make_partition(
+                &row_state_storage,
+                scan_state_type::get_temp_storage_layout(row_entries)),
+            detail::temp_storage::make_partition(
+                &column_state_storage,
+                scan_state_type::get_temp_storage_layout(column_entries)),
+            detail::temp_storage::make_partition(&ordered_bid_storage,
+                                                 ordered_block_id_type::get_temp_storage_layout())));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(number_of_tiles == 0u)
+        return hipSuccess;
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if(debug_synchronous)
+    {
+        std::cout << "width " << width << '\n';
+        std::cout << "height " << height << '\n';
+        std::cout << "number of tiles " << number_of_tiles << '\n';
+        std::cout << "tile " << tile_width << "x" << tile_height << '\n';
+    }
+
+    auto row_state = scan_state_type::create(row_state_storage, row_entries);
+    auto row_state_with_sleep
+        = scan_state_with_sleep_type::create(row_state_storage, row_entries);
+    auto column_state = scan_state_type::create(column_state_storage, column_entries);
+    auto column_state_with_sleep
+        = scan_state_with_sleep_type::create(column_state_storage, column_entries);
+    auto ordered_bid = ordered_block_id_type::create(ordered_bid_storage);
+
+    bool use_sleep;
+    if(const hipError_t error = is_sleep_scan_state_used(use_sleep))
+    {
+        return error;
+    }
+
+    // Both launches reset ordered_bid, which is not used before the scan kernel
+    const unsigned int entries[] = {row_entries, column_entries};
+    for(unsigned int state = 0; state < 2; state++)
+    {
+        const unsigned int init_grid_size
+            = ::rocprim::detail::ceiling_div(entries[state], block_size);
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("init_lookback_scan_state_kernel");
+        if(use_sleep)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(init_lookback_scan_state_kernel<scan_state_with_sleep_type>),
+                dim3(init_grid_size), dim3(block_size), 0, stream,
+                state == 0 ? row_state_with_sleep : column_state_with_sleep,
+                entries[state], ordered_bid
+            );
+        }
+        else
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(init_lookback_scan_state_kernel<scan_state_type>),
+                dim3(init_grid_size), dim3(block_size), 0, stream,
+                state == 0 ? row_state : column_state,
+                entries[state], ordered_bid
+            );
+        }
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_lookback_scan_state_kernel",
+                                                    entries[state],
+                                                    start)
+    }
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("scan_2d_kernel");
+    if(use_sleep)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(scan_2d_kernel<Exclusive, config>),
+            dim3(number_of_tiles), dim3(block_size_x, block_size_y), 0, stream,
+            input, output, width, height, static_cast<unsigned int>(tile_columns),
+            initial_value, scan_op, row_state_with_sleep, column_state_with_sleep, ordered_bid
+        );
+    }
+    else
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(scan_2d_kernel<Exclusive, config>),
+            dim3(number_of_tiles), dim3(block_size_x, block_size_y), 0, stream,
+            input, output, width, height, static_cast<unsigned int>(tile_columns),
+            initial_value, scan_op, row_state, column_state, ordered_bid
+        );
+    }
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("scan_2d_kernel", number_of_tiles, start)
+
+    return hipSuccess;
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
+} // end of detail namespace
+
+/// \brief Parallel 2D inclusive scan primitive for device level.
+///
+/// inclusive_scan_2d function computes the summed-area table (integral image) of a row-major
+/// image: every output item is the reduction of all input items above and to the left of it,
+/// including the item itself, using binary \p scan_op operator.
+///
+/// \par Overview
+/// * The image is read and written once. The tiles of the image are scanned by one decoupled
+/// look-back in two dimensions: the rows of a tile are completed with the carries of the tiles
+/// to the left and the columns with the carries of the tiles above.
+/// * The temporary storage holds a look-back entry per tile for every row and every column of
+/// the image, <tt>width * height / tile_height + width * height / tile_width</tt> entries.
+/// \p hipErrorInvalidValue is returned if the entries of the rows or the columns do not fit in
+/// 32-bit indices.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * The scan operator must be associative and commutative.
+/// * The ranges specified by \p input and \p output may not overlap.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p scan_2d_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input image. It can be a simple
+/// pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output image. It can be a simple
+/// pointer type.
+/// \tparam BinaryFunction - type of binary function used for scan. Default type
+/// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the scan operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first item of the input image, the rows are consecutive.
+/// \param [out] output - iterator to the first item of the output image.
+/// \param [in] width - number of items of a row of the image.
+/// \param [in] height - number of rows of the image.
+/// \param [in] scan_op - binary operation function object that will be used for scan.
+/// The signature of the function should be equivalent to the following:
+/// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int width;  // e.g., 3
+/// unsigned int height; // e.g., 2
+/// int * input;         // e.g., [1, 2, 3,
+///                      //        4, 5, 6]
+/// int * output;        // empty array of 6 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::inclusive_scan_2d(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, width, height
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform scan
+/// rocprim::inclusive_scan_2d(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, width, height
+/// );
+/// // output: [1, 3, 6,
+/// //          5, 12, 21]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class BinaryFunction
+         = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>>
+inline hipError_t inclusive_scan_2d(void*              temporary_storage,
+                                    size_t&            storage_size,
+                                    InputIterator      input,
+                                    OutputIterator     output,
+                                    const unsigned int width,
+                                    const unsigned int height,
+                                    BinaryFunction     scan_op           = BinaryFunction(),
+                                    const hipStream_t  stream            = 0,
+                                    bool               debug_synchronous = false)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    // Get default config if Config is default_config
+    using config = detail::default_or_custom_config<
+        Config,
+        detail::default_scan_2d_config<ROCPRIM_TARGET_ARCH, input_type>>;
+
+    return detail::scan_2d_impl<false, config>(temporary_storage,
+                                               storage_size,
+                                               input,
+                                               output,
+                                               width,
+                                               height,
+                                               // input_type() is a dummy initial value
+                                               input_type(),
+                                               scan_op,
+                                               stream,
+                                               debug_synchronous);
+}
+
+/// \brief Parallel 2D exclusive scan primitive for device level.
+///
+/// exclusive_scan_2d function computes the exclusive summed-area table of a row-major image:
+/// every output item is \p initial_value combined with the reduction of all input items
+/// strictly above and to the left of it, using binary \p scan_op operator. The items of the
+/// first row and the first column are \p initial_value.
+///
+/// \par Overview
+/// * The image is read and written once. The tiles of the image are scanned by one decoupled
+/// look-back in two dimensions: the rows of a tile are completed with the carries of the tiles
+/// to the left and the columns with the carries of the tiles above.
+/// * The temporary storage holds a look-back entry per tile for every row and every column of
+/// the image, <tt>width * height / tile_height + width * height / tile_width</tt> entries.
+/// \p hipErrorInvalidValue is returned if the entries of the rows or the columns do not fit in
+/// 32-bit indices.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * The scan operator must be associative and commutative.
+/// * The ranges specified by \p input and \p output may not overlap.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p scan_2d_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input image. It can be a simple
+/// pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output image. It can be a simple
+/// pointer type.
+/// \tparam InitValueType - type of the initial value.
+/// \tparam BinaryFunction - type of binary function used for scan. Default type
+/// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the scan operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first item of the input image, the rows are consecutive.
+/// \param [out] output - iterator to the first item of the output image.
+/// \param [in] width - number of items of a row of the image.
+/// \param [in] height - number of rows of the image.
+/// \param [in] initial_value - initial value of the scan.
+/// \param [in] scan_op - binary operation function object that will be used for scan.
+/// The signature of the function should be equivalent to the following:
+/// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int width;  // e.g., 3
+/// unsigned int height; // e.g., 2
+/// int * input;         // e.g., [1, 2, 3,
+///                      //        4, 5, 6]
+/// int * output;        // empty array of 6 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::exclusive_scan_2d(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, width, height, 0
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform scan
+/// rocprim::exclusive_scan_2d(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, width, height, 0
+/// );
+/// // output: [0, 0, 0,
+/// //          0, 1, 3]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class InitValueType,
+         class BinaryFunction
+         = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>>
+inline hipError_t exclusive_scan_2d(void*               temporary_storage,
+                                    size_t&             storage_size,
+                                    InputIterator       input,
+                                    OutputIterator      output,
+                                    const unsigned int  width,
+                                    const unsigned int  height,
+                                    const InitValueType initial_value,
+                                    BinaryFunction      scan_op           = BinaryFunction(),
+                                    const hipStream_t   stream            = 0,
+                                    bool                debug_synchronous = false)
+{
+    // Get default config if Config is default_config
+    using config = detail::default_or_custom_config<
+        Config,
+        detail::default_scan_2d_config<ROCPRIM_TARGET_ARCH, InitValueType>>;
+
+    return detail::scan_2d_impl<true, config>(temporary_storage,
+                                              storage_size,
+                                              input,
+                                              output,
+                                              width,
+                                              height,
+                                              initial_value,
+                                              scan_op,
+                                              stream,
+                                              debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_SCAN_2D_HPP_
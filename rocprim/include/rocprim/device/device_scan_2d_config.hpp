@@ -0,0 +1,86 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_SCAN_2D_CONFIG_HPP_
+#define ROCPRIM_DEVICE_DEVICE_SCAN_2D_CONFIG_HPP_
+
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../functional.hpp"
+#include "../detail/various.hpp"
+
+#include "config_types.hpp"
+
+/// \addtogroup primitivesmodule_deviceconfigs
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief Configuration of device-level 2D scan primitives.
+///
+/// A tile of \p BlockSizeY rows and <tt>BlockSizeX * ItemsPerThread</tt> columns is scanned
+/// by a block of <tt>dim3(BlockSizeX, BlockSizeY)</tt> threads, every thread scans
+/// \p ItemsPerThread consecutive items of a row.
+///
+/// \tparam BlockSizeX - number of threads in a block along the rows. It must be a power of two
+/// not larger than the warp size.
+/// \tparam BlockSizeY - number of threads in a block along the columns. It must be a power of
+/// two not larger than the warp size.
+/// \tparam ItemsPerThread - number of items of a row processed by each thread.
+template<unsigned int BlockSizeX, unsigned int BlockSizeY, unsigned int ItemsPerThread>
+struct scan_2d_config
+{
+    /// \brief Number of threads in a block along the rows.
+    static constexpr unsigned int block_size_x = BlockSizeX;
+    /// \brief Number of threads in a block along the columns.
+    static constexpr unsigned int block_size_y = BlockSizeY;
+    /// \brief Number of threads in a block.
+    static constexpr unsigned int block_size = BlockSizeX * BlockSizeY;
+    /// \brief Number of items of a row processed by each thread.
+    static constexpr unsigned int items_per_thread = ItemsPerThread;
+};
+
+namespace detail
+{
+
+template<class Value>
+struct scan_2d_config_900
+{
+    static constexpr unsigned int item_scale =
+        ::rocprim::detail::ceiling_div<unsigned int>(sizeof(Value), sizeof(int));
+
+    using type = scan_2d_config<16, 16, ::rocprim::max(1u, 8u / item_scale)>;
+};
+
+// The tiles are only limited by the shared memory of the column scans, which is the same on
+// all supported architectures
+template<unsigned int TargetArch, class Value>
+struct default_scan_2d_config : select_arch<TargetArch, scan_2d_config_900<Value>>
+{};
+
+} // end namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group primitivesmodule_deviceconfigs
+
+#endif // ROCPRIM_DEVICE_DEVICE_SCAN_2D_CONFIG_HPP_
@@ -27,6 +27,7 @@
 
 #include "config_types.hpp"
 #include "detail/config/device_scan_by_key.hpp"
+#include "instrumentation.hpp"
 
 #include "../config.hpp"
 #include "../detail/temp_storage.hpp"
@@ -55,7 +56,8 @@ namespace detail
               typename CompareFunction,
               typename BinaryFunction,
               typename LookbackScanState,
-              typename ResultType>
+              typename ResultType,
+              typename TotalOutputIterator>
     void __global__ __launch_bounds__(Config::block_size) device_scan_by_key_kernel(
         const KeyInputIterator                          keys,
         const InputIterator                             values,
@@ -68,7 +70,8 @@ namespace detail
         const size_t                                    starting_block,
         const size_t                                    number_of_blocks,
         const ordered_block_id<unsigned int>            ordered_bid,
-        const ::rocprim::tuple<ResultType, bool>* const previous_last_value)
+        const ::rocprim::tuple<ResultType, bool>* const previous_last_value,
+        const TotalOutputIterator                       total_output)
     {
         device_scan_by_key_kernel_impl<Exclusive, Config>(keys,
                                                           values,
@@ -81,7 +84,8 @@ namespace detail
                                                           starting_block,
                                                           number_of_blocks,
                                                           ordered_bid,
-                                                          previous_last_value);
+                                                          previous_last_value,
+                                                          total_output);
     }
 
 #define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start)                           \
@@ -90,6 +94,7 @@ namespace detail
         auto _error = hipGetLastError();                                                         \
         if(_error != hipSuccess)                                                                 \
             return _error;                                                                       \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size);                                          \
         if(debug_synchronous)                                                                    \
         {                                                                                        \
             std::cout << name << "(" << size << ")";                                             \
@@ -109,18 +114,21 @@ namespace detail
               typename OutputIterator,
               typename InitValueType,
               typename BinaryFunction,
-              typename CompareFunction>
-    inline hipError_t scan_by_key_impl(void* const           temporary_storage,
-                                       size_t&               storage_size,
-                                       KeysInputIterator     keys,
-                                       InputIterator         input,
-                                       OutputIterator        output,
-                                       const InitValueType   initial_value,
-                                       const size_t          size,
-                                       const BinaryFunction  scan_op,
-                                       const CompareFunction compare,
-                                       const hipStream_t     stream,
-                                       const bool            debug_synchronous)
+              typename CompareFunction,
+              typename TotalOutputIterator = scan_no_total_output>
+    inline hipError_t scan_by_key_impl(void* const               temporary_storage,
+                                       size_t&                   storage_size,
+                                       KeysInputIterator         keys,
+                                       InputIterator             input,
+                                       OutputIterator            output,
+                                       const InitValueType       initial_value,
+                                       const size_t              size,
+                                       const BinaryFunction      scan_op,
+                                       const CompareFunction     compare,
+                                       const hipStream_t         stream,
+                                       const bool                debug_synchronous,
+                                       const TotalOutputIterator total_output
+                                       = TotalOutputIterator())
     {
         using config               = Config;
         using real_init_value_type = input_type_t<InitValueType>;
@@ -237,6 +245,7 @@ namespace detail
 
                 start = std::chrono::high_resolution_clock::now();
             }
+            ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("init_lookback_scan_state_kernel");
 
             with_scan_state([&](const auto scan_state) {
                 hipLaunchKernelGGL(init_lookback_scan_state_kernel,
@@ -257,6 +266,7 @@ namespace detail
             {
                 start = std::chrono::high_resolution_clock::now();
             }
+            ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("device_scan_by_key_kernel");
             with_scan_state(
                 [&](auto& scan_state)
                 {
@@ -277,7 +287,8 @@ namespace detail
                         i * number_of_blocks,
                         total_number_of_blocks,
                         ordered_bid,
-                        i > 0 ? as_const_ptr(previous_last_value) : nullptr);
+                        i > 0 ? as_const_ptr(previous_last_value) : nullptr,
+                        total_output);
                 });
             ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(
                 "device_scan_by_key_kernel", current_size, start);
@@ -560,6 +571,201 @@ inline hipError_t exclusive_scan_by_key(void* const                temporary_sto
                                                   debug_synchronous);
 }
 
+/// \brief Parallel inclusive scan-by-key primitive for device level, which also writes the total
+/// of the last segment.
+///
+/// inclusive_scan_by_key_with_total performs the same scan as \p inclusive_scan_by_key and also
+/// writes the reduction of the values of the last segment (the last element of the output) to
+/// \p total_output. The total is written by the thread holding the last item of the last block.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p keys_input, \p values_input, and \p values_output must have
+/// at least \p size elements.
+/// * \p total_output is not written when \p size is \p 0.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p scan_config or
+/// a custom class with the same members.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. It can be
+/// a simple pointer type.
+/// \tparam ValuesInputIterator - random-access iterator type of the input range. It can be
+/// a simple pointer type.
+/// \tparam ValuesOutputIterator - random-access iterator type of the output range. It can be
+/// a simple pointer type.
+/// \tparam TotalOutputIterator - iterator type of the total output. It can be a simple
+/// pointer type.
+/// \tparam BinaryFunction - type of binary function used for scan. Default type
+/// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+/// \tparam KeyCompareFunction - type of binary function used to determine keys equality.
+/// Default type is \p rocprim::equal_to<T>, where \p T is a \p value_type of
+/// \p KeysInputIterator.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the scan operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - iterator to the first element in the range of keys.
+/// \param [in] values_input - iterator to the first element in the range of values to scan.
+/// \param [out] values_output - iterator to the first element in the output value range.
+/// \param [out] total_output - iterator to the device-accessible total of the last segment.
+/// \param [in] size - number of element in the input range.
+/// \param [in] scan_op - binary operation function object that will be used for scanning
+/// input values. Default is BinaryFunction().
+/// \param [in] key_compare_op - binary operation function object that will be used to
+/// determine keys equality. Default is KeyCompareFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template <typename Config = default_config,
+          typename KeysInputIterator,
+          typename ValuesInputIterator,
+          typename ValuesOutputIterator,
+          typename TotalOutputIterator,
+          typename BinaryFunction
+          = ::rocprim::plus<typename std::iterator_traits<ValuesInputIterator>::value_type>,
+          typename KeyCompareFunction
+          = ::rocprim::equal_to<typename std::iterator_traits<KeysInputIterator>::value_type>>
+inline hipError_t inclusive_scan_by_key_with_total(void* const                temporary_storage,
+                                                   size_t&                    storage_size,
+                                                   const KeysInputIterator    keys_input,
+                                                   const ValuesInputIterator  values_input,
+                                                   const ValuesOutputIterator values_output,
+                                                   const TotalOutputIterator  total_output,
+                                                   const size_t               size,
+                                                   const BinaryFunction scan_op = BinaryFunction(),
+                                                   const KeyCompareFunction key_compare_op
+                                                   = KeyCompareFunction(),
+                                                   const hipStream_t stream            = 0,
+                                                   const bool        debug_synchronous = false)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+
+    // Get default config if Config is default_config
+    using config = detail::default_or_custom_config<
+        Config,
+        detail::default_scan_by_key_config<ROCPRIM_TARGET_ARCH, key_type, value_type>>;
+
+    return detail::scan_by_key_impl<false, config>(temporary_storage,
+                                                   storage_size,
+                                                   keys_input,
+                                                   values_input,
+                                                   values_output,
+                                                   value_type(),
+                                                   size,
+                                                   scan_op,
+                                                   key_compare_op,
+                                                   stream,
+                                                   debug_synchronous,
+                                                   total_output);
+}
+
+/// \brief Parallel exclusive scan-by-key primitive for device level, which also writes the total
+/// of the last segment.
+///
+/// exclusive_scan_by_key_with_total performs the same scan as \p exclusive_scan_by_key and also
+/// writes the reduction of \p initial_value and the values of the last segment (the value that
+/// would follow the last element of the output) to \p total_output. The total is written by the
+/// thread holding the last item of the last block.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p keys_input, \p values_input, and \p values_output must have
+/// at least \p size elements.
+/// * \p total_output is not written when \p size is \p 0.
+/// * The total is computed from the last value after the output is stored, so
+/// \p values_output must not be the same as \p values_input.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p scan_config or
+/// a custom class with the same members.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. It can be
+/// a simple pointer type.
+/// \tparam ValuesInputIterator - random-access iterator type of the input range. It can be
+/// a simple pointer type.
+/// \tparam ValuesOutputIterator - random-access iterator type of the output range. It can be
+/// a simple pointer type.
+/// \tparam TotalOutputIterator - iterator type of the total output. It can be a simple
+/// pointer type.
+/// \tparam InitValueType - type of the initial value.
+/// \tparam BinaryFunction - type of binary function used for scan. Default type
+/// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+/// \tparam KeyCompareFunction - type of binary function used to determine keys equality.
+/// Default type is \p rocprim::equal_to<T>, where \p T is a \p value_type of
+/// \p KeysInputIterator.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the scan operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - iterator to the first element in the range of keys.
+/// \param [in] values_input - iterator to the first element in the range of values to scan.
+/// \param [out] values_output - iterator to the first element in the output value range.
+/// \param [out] total_output - iterator to the device-accessible total of the last segment.
+/// \param [in] initial_value - initial value to start the scan.
+/// A rocpim::future_value may be passed to use a value that will be later computed.
+/// \param [in] size - number of element in the input range.
+/// \param [in] scan_op - binary operation function object that will be used for scanning
+/// input values. Default is BinaryFunction().
+/// \param [in] key_compare_op - binary operation function object that will be used to
+/// determine keys equality. Default is KeyCompareFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template <typename Config = default_config,
+          typename KeysInputIterator,
+          typename ValuesInputIterator,
+          typename ValuesOutputIterator,
+          typename TotalOutputIterator,
+          typename InitialValueType,
+          typename BinaryFunction
+          = ::rocprim::plus<typename std::iterator_traits<ValuesInputIterator>::value_type>,
+          typename KeyCompareFunction
+          = ::rocprim::equal_to<typename std::iterator_traits<KeysInputIterator>::value_type>>
+inline hipError_t exclusive_scan_by_key_with_total(void* const                temporary_storage,
+                                                   size_t&                    storage_size,
+                                                   const KeysInputIterator    keys_input,
+                                                   const ValuesInputIterator  values_input,
+                                                   const ValuesOutputIterator values_output,
+                                                   const TotalOutputIterator  total_output,
+                                                   const InitialValueType     initial_value,
+                                                   const size_t               size,
+                                                   const BinaryFunction scan_op = BinaryFunction(),
+                                                   const KeyCompareFunction key_compare_op
+                                                   = KeyCompareFunction(),
+                                                   const hipStream_t stream            = 0,
+                                                   const bool        debug_synchronous = false)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using real_init_value_type = detail::input_type_t<InitialValueType>;
+
+    // Get default config if Config is default_config
+    using config = detail::default_or_custom_config<
+        Config,
+        detail::default_scan_by_key_config<ROCPRIM_TARGET_ARCH, key_type, real_init_value_type>
+    >;
+
+    return detail::scan_by_key_impl<true, config>(temporary_storage,
+                                                  storage_size,
+                                                  keys_input,
+                                                  values_input,
+                                                  values_output,
+                                                  initial_value,
+                                                  size,
+                                                  scan_op,
+                                                  key_compare_op,
+                                                  stream,
+                                                  debug_synchronous,
+                                                  total_output);
+}
+
 /// @}
 // end of group devicemodule
 
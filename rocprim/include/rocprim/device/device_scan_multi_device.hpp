@@ -0,0 +1,228 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_SCAN_MULTI_DEVICE_HPP_
+#define ROCPRIM_DEVICE_DEVICE_SCAN_MULTI_DEVICE_HPP_
+
+#include <iterator>
+
+#include "../config.hpp"
+#include "../functional.hpp"
+
+#include "detail/device_multi_device.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+/// \brief Parallel inclusive scan of items distributed across several devices.
+///
+/// \p multi_device_inclusive_scan scans the items of all devices as one range in the order of the
+/// devices: the output of a device includes the items of all previous devices.
+///
+/// \par Overview
+/// * Returns the required size of the temporary storage of every device in \p storage_sizes
+/// if \p temporary_storage is a null pointer. The temporary storage of a device must be allocated
+/// on that device.
+/// * Every device reduces its items with \p reduce. Every device then waits for the totals of the
+/// previous devices with events, copies them through peer memory and reduces them to the prefix
+/// of its items. The prefix is combined with the first item of the device by the local
+/// \p inclusive_scan on the device, so the host does not wait for the devices. The function is
+/// asynchronous like \p inclusive_scan.
+/// * The copies of the totals go directly over the links between the devices if peer access
+/// between them is enabled with \p hipDeviceEnablePeerAccess.
+/// * \p scan_op must be associative.
+/// * The current device is restored.
+///
+/// \tparam InputIterator - random-access iterator type of the input ranges. It can be a simple
+/// pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output ranges. It can be a simple
+/// pointer type.
+/// \tparam BinaryFunction - type of binary function used for scan. Default type
+/// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+///
+/// \param [in] temporary_storage - pointer to an array of \p device_count pointers to the temporary
+/// storages of the devices. When a null pointer is passed, the required allocation sizes (in bytes)
+/// are written to \p storage_sizes and function returns without performing the scan.
+/// \param [in,out] storage_sizes - array of \p device_count sizes (in bytes) of the temporary
+/// storages.
+/// \param [in] devices - array of \p device_count device ids.
+/// \param [in] device_count - number of devices.
+/// \param [in] inputs - array of iterators to the first elements of the input ranges of the
+/// devices.
+/// \param [out] outputs - array of iterators to the first elements of the output ranges of the
+/// devices.
+/// \param [in] sizes - array of the numbers of items of the devices.
+/// \param [in] scan_op - binary operation function object that will be used for scan.
+/// The default value is \p BinaryFunction().
+/// \param [in] streams - [optional] array of \p device_count streams of the devices. Default is
+/// \p nullptr, the default streams are used.
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class InputIterator,
+         class OutputIterator,
+         class BinaryFunction
+         = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>>
+inline hipError_t multi_device_inclusive_scan(void* const*          temporary_storage,
+                                              size_t*               storage_sizes,
+                                              const int*            devices,
+                                              const unsigned int    device_count,
+                                              const InputIterator*  inputs,
+                                              const OutputIterator* outputs,
+                                              const size_t*         sizes,
+                                              BinaryFunction        scan_op = BinaryFunction(),
+                                              const hipStream_t*    streams = nullptr,
+                                              const bool            debug_synchronous = false)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+    return detail::multi_device_scan<detail::multi_device_op::inclusive_scan>(
+        temporary_storage,
+        storage_sizes,
+        devices,
+        device_count,
+        inputs,
+        outputs,
+        // input_type() is a dummy initial value (not used)
+        input_type(),
+        sizes,
+        scan_op,
+        streams,
+        debug_synchronous);
+}
+
+/// \brief Parallel exclusive scan of items distributed across several devices.
+///
+/// \p multi_device_exclusive_scan scans the items of all devices as one range in the order of the
+/// devices, starting with an initial value.
+///
+/// \par Overview
+/// * Returns the required size of the temporary storage of every device in \p storage_sizes
+/// if \p temporary_storage is a null pointer. The temporary storage of a device must be allocated
+/// on that device.
+/// * Every device reduces its items with \p reduce. Every device then waits for the totals of the
+/// previous devices with events, copies them through peer memory and reduces them with the initial
+/// value to the prefix of its items, which is passed as a \p future_value initial value to the
+/// local \p exclusive_scan, so the host does not wait for the devices. The function is
+/// asynchronous like \p exclusive_scan.
+/// * The copies of the totals go directly over the links between the devices if peer access
+/// between them is enabled with \p hipDeviceEnablePeerAccess.
+/// * \p scan_op must be associative.
+/// * The current device is restored.
+///
+/// \tparam InputIterator - random-access iterator type of the input ranges. It can be a simple
+/// pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output ranges. It can be a simple
+/// pointer type.
+/// \tparam InitValueType - type of the initial value.
+/// \tparam BinaryFunction - type of binary function used for scan. Default type
+/// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+///
+/// \param [in] temporary_storage - pointer to an array of \p device_count pointers to the temporary
+/// storages of the devices. When a null pointer is passed, the required allocation sizes (in bytes)
+/// are written to \p storage_sizes and function returns without performing the scan.
+/// \param [in,out] storage_sizes - array of \p device_count sizes (in bytes) of the temporary
+/// storages.
+/// \param [in] devices - array of \p device_count device ids.
+/// \param [in] device_count - number of devices.
+/// \param [in] inputs - array of iterators to the first elements of the input ranges of the
+/// devices.
+/// \param [out] outputs - array of iterators to the first elements of the output ranges of the
+/// devices.
+/// \param [in] initial_value - initial value to start the scan.
+/// \param [in] sizes - array of the numbers of items of the devices.
+/// \param [in] scan_op - binary operation function object that will be used for scan.
+/// The default value is \p BinaryFunction().
+/// \param [in] streams - [optional] array of \p device_count streams of the devices. Default is
+/// \p nullptr, the default streams are used.
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.) for 2 devices
+/// int devices[2] = {0, 1};
+/// size_t sizes[2];      // e.g., [4, 3]
+/// int* inputs[2];       // e.g., [[1, 2, 3, 4], [5, 6, 7]]
+/// int* outputs[2];      // empty arrays of 4 and 3 elements
+///
+/// size_t storage_sizes[2];
+/// // Get required sizes of the temporary storages
+/// rocprim::multi_device_exclusive_scan(
+///     nullptr, storage_sizes, devices, 2, inputs, outputs, 0, sizes
+/// );
+///
+/// // allocate temporary storages on the devices
+/// void* temporary_storage[2];
+/// hipSetDevice(0); hipMalloc(&temporary_storage[0], storage_sizes[0]);
+/// hipSetDevice(1); hipMalloc(&temporary_storage[1], storage_sizes[1]);
+///
+/// // perform scan
+/// rocprim::multi_device_exclusive_scan(
+///     temporary_storage, storage_sizes, devices, 2, inputs, outputs, 0, sizes
+/// );
+/// // outputs: [[0, 1, 3, 6], [10, 15, 21]]
+/// \endcode
+/// \endparblock
+template<class InputIterator,
+         class OutputIterator,
+         class InitValueType,
+         class BinaryFunction
+         = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>>
+inline hipError_t multi_device_exclusive_scan(void* const*          temporary_storage,
+                                              size_t*               storage_sizes,
+                                              const int*            devices,
+                                              const unsigned int    device_count,
+                                              const InputIterator*  inputs,
+                                              const OutputIterator* outputs,
+                                              const InitValueType   initial_value,
+                                              const size_t*         sizes,
+                                              BinaryFunction        scan_op = BinaryFunction(),
+                                              const hipStream_t*    streams = nullptr,
+                                              const bool            debug_synchronous = false)
+{
+    return detail::multi_device_scan<detail::multi_device_op::exclusive_scan>(temporary_storage,
+                                                                              storage_sizes,
+                                                                              devices,
+                                                                              device_count,
+                                                                              inputs,
+                                                                              outputs,
+                                                                              initial_value,
+                                                                              sizes,
+                                                                              scan_op,
+                                                                              streams,
+                                                                              debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_SCAN_MULTI_DEVICE_HPP_
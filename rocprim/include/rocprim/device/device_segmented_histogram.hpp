@@ -0,0 +1,457 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_SEGMENTED_HISTOGRAM_HPP_
+#define ROCPRIM_DEVICE_DEVICE_SEGMENTED_HISTOGRAM_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <iterator>
+#include <limits>
+
+#include "../config.hpp"
+#include "../detail/device_properties.hpp"
+#include "../detail/various.hpp"
+
+#include "config_types.hpp"
+#include "detail/device_histogram.hpp"
+#include "device_histogram.hpp"
+#include "detail/config/device_histogram.hpp"
+#include "device_histogram_config.hpp"
+#include "instrumentation.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         unsigned int SharedHistograms,
+         bool         WarpAggregation,
+         class SampleIterator,
+         class OffsetIterator,
+         class Counter,
+         class SampleToBinOp>
+ROCPRIM_KERNEL __launch_bounds__(BlockSize) void segmented_histogram_shared_kernel(
+    SampleIterator samples,
+    OffsetIterator begin_offsets,
+    OffsetIterator end_offsets,
+    Counter*       histogram,
+    SampleToBinOp  sample_to_bin_op,
+    unsigned int   bins,
+    unsigned int   bins_bits)
+{
+    HIP_DYNAMIC_SHARED(unsigned int, block_histogram);
+
+    segmented_histogram_shared<BlockSize, ItemsPerThread, SharedHistograms, WarpAggregation>(
+        samples,
+        begin_offsets,
+        end_offsets,
+        histogram,
+        sample_to_bin_op,
+        bins,
+        bins_bits,
+        block_histogram);
+}
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start)                           \
+    {                                                                                            \
+        auto _error = hipGetLastError();                                                         \
+        if(_error != hipSuccess)                                                                 \
+            return _error;                                                                       \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size);                                          \
+        if(debug_synchronous)                                                                    \
+        {                                                                                        \
+            std::cout << name << "(" << size << ")";                                             \
+            auto __error = hipStreamSynchronize(stream);                                         \
+            if(__error != hipSuccess)                                                            \
+                return __error;                                                                  \
+            auto _end = std::chrono::high_resolution_clock::now();                               \
+            auto _d   = std::chrono::duration_cast<std::chrono::duration<double>>(_end - start); \
+            std::cout << " " << _d.count() * 1000 << " ms" << '\n';                              \
+        }                                                                                        \
+    }
+
+// Segments are split into several blocks when there are too few of them to fill the device
+constexpr unsigned int segmented_histogram_blocks_per_cu = 8;
+// The largest number of blocks of a segment, the y dimension of the grid
+constexpr unsigned int segmented_histogram_max_blocks_per_segment = 256;
+
+template<class Config,
+         class SampleIterator,
+         class OffsetIterator,
+         class Counter,
+         class SampleToBinOp>
+inline hipError_t segmented_histogram_impl(void*          temporary_storage,
+                                           size_t&        storage_size,
+                                           SampleIterator samples,
+                                           unsigned int   segments,
+                                           OffsetIterator begin_offsets,
+                                           OffsetIterator end_offsets,
+                                           Counter*       histogram,
+                                           unsigned int   levels,
+                                           SampleToBinOp  sample_to_bin_op,
+                                           hipStream_t    stream,
+                                           bool           debug_synchronous)
+{
+    using sample_type = typename std::iterator_traits<SampleIterator>::value_type;
+
+    using config = default_or_custom_config<
+        Config,
+        default_histogram_config<ROCPRIM_TARGET_ARCH, sample_type, 1, 1>>;
+
+    static constexpr unsigned int block_size       = config::histogram::block_size;
+    static constexpr unsigned int items_per_thread = config::histogram::items_per_thread;
+
+    if(levels < 2)
+    {
+        // Histogram must have at least 1 bin
+        return hipErrorInvalidValue;
+    }
+    const unsigned int bins = levels - 1;
+    const unsigned int bins_bits
+        = static_cast<unsigned int>(std::log2(detail::next_power_of_two(bins)));
+
+    // The bins of a segment must fit in the shared memory, in one copy if they do not fit in
+    // shared_impl_histograms copies
+    const unsigned int max_bins = config::shared_impl_max_bins * config::shared_impl_histograms;
+    if(bins > max_bins
+       || size_t(segments) * bins > std::numeric_limits<unsigned int>::max())
+    {
+        return hipErrorInvalidValue;
+    }
+
+    if(temporary_storage == nullptr)
+    {
+        // Make sure user won't try to allocate 0 bytes memory, because
+        // hipMalloc will return nullptr.
+        storage_size = 4;
+        return hipSuccess;
+    }
+
+    if(segments == 0)
+    {
+        return hipSuccess;
+    }
+
+    device_properties props;
+    hipError_t        result = get_current_device_properties(props);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const unsigned int blocks_per_segment
+        = std::min(segmented_histogram_max_blocks_per_segment,
+                   ::rocprim::max(1u,
+                                  ::rocprim::detail::ceiling_div(
+                                      props.compute_units * segmented_histogram_blocks_per_cu,
+                                      segments)));
+
+    if(debug_synchronous)
+    {
+        std::cout << "segments " << segments << '\n';
+        std::cout << "bins " << bins << '\n';
+        std::cout << "blocks_per_segment " << blocks_per_segment << '\n';
+        result = hipStreamSynchronize(stream);
+        if(result != hipSuccess)
+        {
+            return result;
+        }
+    }
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    // The histograms of all segments are cleared as one array
+    const unsigned int total_bins = segments * bins;
+    if(debug_synchronous)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("init_histogram");
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(init_histogram_kernel<block_size, 1>),
+                       dim3(apply_grid_limit(::rocprim::detail::ceiling_div(total_bins,
+                                                                            block_size))),
+                       dim3(block_size),
+                       0,
+                       stream,
+                       fixed_array<Counter*, 1>(&histogram),
+                       fixed_array<unsigned int, 1>(&total_bins));
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_histogram", total_bins, start);
+
+    const dim3 grid_size(segments, blocks_per_segment);
+    if(debug_synchronous)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("segmented_histogram_shared");
+    if(bins <= config::shared_impl_max_bins)
+    {
+        // use config::shared_impl_histograms histograms in shared memory to reduce bank conflicts
+        // for the case of samples concentrated in one bin
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(
+                segmented_histogram_shared_kernel<block_size,
+                                                  items_per_thread,
+                                                  config::shared_impl_histograms,
+                                                  config::shared_impl_warp_aggregation>),
+            grid_size,
+            dim3(block_size),
+            config::shared_impl_histograms * bins * sizeof(unsigned int),
+            stream,
+            samples,
+            begin_offsets,
+            end_offsets,
+            histogram,
+            sample_to_bin_op,
+            bins,
+            bins_bits);
+    }
+    else
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(
+                segmented_histogram_shared_kernel<block_size,
+                                                  items_per_thread,
+                                                  1,
+                                                  config::shared_impl_warp_aggregation>),
+            grid_size,
+            dim3(block_size),
+            bins * sizeof(unsigned int),
+            stream,
+            samples,
+            begin_offsets,
+            end_offsets,
+            histogram,
+            sample_to_bin_op,
+            bins,
+            bins_bits);
+    }
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_histogram_shared",
+                                                size_t(segments) * blocks_per_segment * block_size,
+                                                start);
+
+    return hipSuccess;
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
+} // namespace detail
+
+/// \brief Computes a histogram of every segment of a sequence of samples using equal-width bins.
+///
+/// \par
+/// * The number of histogram bins is (\p levels - 1), the same for all segments.
+/// * Bins are evenly-segmented and include the same width of sample values:
+/// (\p upper_level - \p lower_level) / (\p levels - 1).
+/// * The segment \p i has the samples <tt>[begin_offsets[i], end_offsets[i])</tt>, its histogram
+/// is written to <tt>histogram + i * (levels - 1)</tt>. Empty segments have histograms of zeros.
+/// * Every segment is counted in the shared memory by one or more blocks in a single launch,
+/// so many small segments (for example the tiles of an image) do not need a launch each. Segments
+/// are split into several blocks when there are too few of them to fill the device.
+/// * The bins of a segment must fit in the shared memory of the \p histogram_config, otherwise
+/// \p hipErrorInvalidValue is returned.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p histogram_config or
+/// a custom class with the same members, its \p algorithm is ignored.
+/// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets. It can be a simple
+/// pointer type.
+/// \tparam Counter - integer type for histogram bin counters.
+/// \tparam Level - type of histogram boundaries (levels)
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] samples - iterator to the first element in the range of input samples.
+/// \param [in] segments - number of segments.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets
+/// of the segments.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets of the
+/// segments.
+/// \param [out] histogram - pointer to the first element of the histograms of all segments, at
+/// least <tt>segments * (levels - 1)</tt> elements.
+/// \param [in] levels - number of boundaries (levels) for histogram bins.
+/// \param [in] lower_level - lower sample value bound (inclusive) for the first histogram bin.
+/// \param [in] upper_level - upper sample value bound (exclusive) for the last histogram bin.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime
+/// error of type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example histograms of 5 bins are computed for 2 segments of float samples.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// float * samples;          // e.g., [-10.0, 0.3, 9.5, 8.1, 1.5, 1.9, 100.0, 5.1]
+/// unsigned int segments;    // e.g., 2
+/// int * offsets;            // e.g., [0, 3, 8]
+/// int * histogram;          // empty array of at least 10 elements
+/// unsigned int levels;      // e.g., 6 (for 5 bins)
+/// float lower_level;        // e.g., 0.0
+/// float upper_level;        // e.g., 10.0
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::segmented_histogram_even(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, segments, offsets, offsets + 1,
+///     histogram, levels, lower_level, upper_level
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // compute histograms
+/// rocprim::segmented_histogram_even(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, segments, offsets, offsets + 1,
+///     histogram, levels, lower_level, upper_level
+/// );
+/// // histogram: [1, 0, 0, 0, 1,
+/// //             2, 0, 1, 0, 1]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class SampleIterator,
+         class OffsetIterator,
+         class Counter,
+         class Level>
+inline hipError_t segmented_histogram_even(void*          temporary_storage,
+                                           size_t&        storage_size,
+                                           SampleIterator samples,
+                                           unsigned int   segments,
+                                           OffsetIterator begin_offsets,
+                                           OffsetIterator end_offsets,
+                                           Counter*       histogram,
+                                           unsigned int   levels,
+                                           Level          lower_level,
+                                           Level          upper_level,
+                                           hipStream_t    stream            = 0,
+                                           bool           debug_synchronous = false)
+{
+    return detail::segmented_histogram_impl<Config>(
+        temporary_storage,
+        storage_size,
+        detail::to_kernel_input_iterator(samples),
+        segments,
+        begin_offsets,
+        end_offsets,
+        histogram,
+        levels,
+        detail::sample_to_bin_even<Level>(levels < 2 ? 1 : levels - 1, lower_level, upper_level),
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Computes a histogram of every segment of a sequence of samples using the specified bin
+/// boundaries.
+///
+/// \par
+/// * The number of histogram bins is (\p levels - 1), the same for all segments.
+/// * The range for bin<sub><em>j</em></sub> is [<tt>level_values[j]</tt>,
+/// <tt>level_values[j+1]</tt>).
+/// * The segment \p i has the samples <tt>[begin_offsets[i], end_offsets[i])</tt>, its histogram
+/// is written to <tt>histogram + i * (levels - 1)</tt>, see \p segmented_histogram_even.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p histogram_config or
+/// a custom class with the same members, its \p algorithm is ignored.
+/// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets. It can be a simple
+/// pointer type.
+/// \tparam Counter - integer type for histogram bin counters.
+/// \tparam Level - type of histogram boundaries (levels)
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] samples - iterator to the first element in the range of input samples.
+/// \param [in] segments - number of segments.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets
+/// of the segments.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets of the
+/// segments.
+/// \param [out] histogram - pointer to the first element of the histograms of all segments, at
+/// least <tt>segments * (levels - 1)</tt> elements.
+/// \param [in] levels - number of boundaries (levels) for histogram bins.
+/// \param [in] level_values - iterator to the array of bin boundaries.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime
+/// error of type \p hipError_t.
+template<class Config = default_config,
+         class SampleIterator,
+         class OffsetIterator,
+         class Counter,
+         class Level>
+inline hipError_t segmented_histogram_range(void*          temporary_storage,
+                                            size_t&        storage_size,
+                                            SampleIterator samples,
+                                            unsigned int   segments,
+                                            OffsetIterator begin_offsets,
+                                            OffsetIterator end_offsets,
+                                            Counter*       histogram,
+                                            unsigned int   levels,
+                                            Level*         level_values,
+                                            hipStream_t    stream            = 0,
+                                            bool           debug_synchronous = false)
+{
+    return detail::segmented_histogram_impl<Config>(
+        temporary_storage,
+        storage_size,
+        detail::to_kernel_input_iterator(samples),
+        segments,
+        begin_offsets,
+        end_offsets,
+        histogram,
+        levels,
+        detail::sample_to_bin_range<Level>(levels < 2 ? 1 : levels - 1, level_values),
+        stream,
+        debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_SEGMENTED_HISTOGRAM_HPP_
@@ -0,0 +1,694 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_SEGMENTED_MERGE_SORT_HPP_
+#define ROCPRIM_DEVICE_DEVICE_SEGMENTED_MERGE_SORT_HPP_
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+
+#include "../functional.hpp"
+#include "../types.hpp"
+
+#include "../iterator/counting_iterator.hpp"
+#include "../iterator/reverse_iterator.hpp"
+#include "detail/device_segmented_merge_sort.hpp"
+#include "device_partition.hpp"
+#include "device_segmented_merge_sort_config.hpp"
+#include "instrumentation.hpp"
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+template<
+    unsigned int LogicalWarpSize,
+    unsigned int ItemsPerThread,
+    unsigned int BlockSize,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class SegmentIndexIterator,
+    class OffsetIterator,
+    class BinaryFunction
+>
+ROCPRIM_KERNEL
+__launch_bounds__(BlockSize)
+void segmented_merge_sort_small_kernel(KeysInputIterator keys_input,
+                                       KeysOutputIterator keys_output,
+                                       ValuesInputIterator values_input,
+                                       ValuesOutputIterator values_output,
+                                       unsigned int num_segments,
+                                       SegmentIndexIterator segment_indices,
+                                       OffsetIterator begin_offsets,
+                                       OffsetIterator end_offsets,
+                                       BinaryFunction compare_function)
+{
+    segmented_merge_sort_small<LogicalWarpSize, ItemsPerThread, BlockSize>(
+        keys_input, keys_output, values_input, values_output,
+        num_segments, segment_indices, begin_offsets, end_offsets,
+        compare_function
+    );
+}
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class SegmentIndexIterator,
+    class OffsetIterator,
+    class BinaryFunction
+>
+ROCPRIM_KERNEL
+__launch_bounds__(BlockSize)
+void segmented_merge_sort_medium_kernel(KeysInputIterator keys_input,
+                                        KeysOutputIterator keys_output,
+                                        ValuesInputIterator values_input,
+                                        ValuesOutputIterator values_output,
+                                        SegmentIndexIterator segment_indices,
+                                        OffsetIterator begin_offsets,
+                                        OffsetIterator end_offsets,
+                                        BinaryFunction compare_function)
+{
+    segmented_merge_sort_medium<BlockSize, ItemsPerThread>(
+        keys_input, keys_output, values_input, values_output,
+        segment_indices, begin_offsets, end_offsets,
+        compare_function
+    );
+}
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class SegmentIndexIterator,
+    class OffsetIterator,
+    class BinaryFunction
+>
+ROCPRIM_KERNEL
+__launch_bounds__(BlockSize)
+void segmented_merge_sort_large_kernel(KeysInputIterator keys_input,
+                                       typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
+                                       KeysOutputIterator keys_output,
+                                       ValuesInputIterator values_input,
+                                       typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
+                                       ValuesOutputIterator values_output,
+                                       SegmentIndexIterator segment_indices,
+                                       OffsetIterator begin_offsets,
+                                       OffsetIterator end_offsets,
+                                       BinaryFunction compare_function)
+{
+    segmented_merge_sort_large<BlockSize, ItemsPerThread>(
+        keys_input, keys_tmp, keys_output, values_input, values_tmp, values_output,
+        segment_indices, begin_offsets, end_offsets,
+        compare_function
+    );
+}
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
+    { \
+        auto _error = hipGetLastError(); \
+        if(_error != hipSuccess) return _error; \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
+        if(debug_synchronous) \
+        { \
+            std::cout << name << "(" << size << ")"; \
+            auto __error = hipStreamSynchronize(stream); \
+            if(__error != hipSuccess) return __error; \
+            auto _end = std::chrono::high_resolution_clock::now(); \
+            auto _d = std::chrono::duration_cast<std::chrono::duration<double>>(_end - start); \
+            std::cout << " " << _d.count() * 1000 << " ms" << '\n'; \
+        } \
+    }
+
+template<
+    class Config,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class OffsetIterator,
+    class BinaryFunction
+>
+inline
+hipError_t segmented_merge_sort_impl(void * temporary_storage,
+                                     size_t& storage_size,
+                                     KeysInputIterator keys_input,
+                                     KeysOutputIterator keys_output,
+                                     ValuesInputIterator values_input,
+                                     ValuesOutputIterator values_output,
+                                     unsigned int size,
+                                     unsigned int segments,
+                                     OffsetIterator begin_offsets,
+                                     OffsetIterator end_offsets,
+                                     BinaryFunction compare_function,
+                                     hipStream_t stream,
+                                     bool debug_synchronous)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    using segment_index_type = unsigned int;
+    using segment_index_iterator = counting_iterator<segment_index_type>;
+
+    using config = default_or_custom_config<
+        Config,
+        default_segmented_merge_sort_config<ROCPRIM_TARGET_ARCH, key_type, value_type>
+    >;
+
+    static constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+    static constexpr unsigned int max_small_segment_length
+        = config::items_per_thread_small * config::logical_warp_size_small;
+    static constexpr unsigned int small_segments_per_block
+        = config::block_size_small / config::logical_warp_size_small;
+    static constexpr unsigned int max_medium_segment_length
+        = config::medium::block_size * config::medium::items_per_thread;
+
+    const auto large_segment_selector = [=](const unsigned int segment_index) mutable -> bool
+    {
+        const unsigned int segment_length
+            = end_offsets[segment_index] - begin_offsets[segment_index];
+        return segment_length > max_medium_segment_length;
+    };
+    const auto medium_segment_selector = [=](const unsigned int segment_index) mutable -> bool
+    {
+        const unsigned int segment_length = end_offsets[segment_index] - begin_offsets[segment_index];
+        return segment_length > max_small_segment_length;
+    };
+
+    const bool do_partitioning = segments >= config::partitioning_threshold;
+
+    segment_index_type* large_segment_indices_output{};
+    // The total number of large and small segments is not above the number of segments
+    // The same buffer is filled with the large and small indices from both directions
+    auto small_segment_indices_output
+        = make_reverse_iterator(large_segment_indices_output + segments);
+    segment_index_type* medium_segment_indices_output{};
+    segment_index_type* segment_count_output{};
+    key_type*           keys_tmp;
+    value_type*         values_tmp;
+    size_t              partition_storage_size{};
+    void*               partition_temporary_storage{};
+
+    hipError_t result = partition_three_way(nullptr,
+                                            partition_storage_size,
+                                            segment_index_iterator{},
+                                            large_segment_indices_output,
+                                            medium_segment_indices_output,
+                                            small_segment_indices_output,
+                                            segment_count_output,
+                                            segments,
+                                            large_segment_selector,
+                                            medium_segment_selector,
+                                            stream,
+                                            debug_synchronous);
+    if(hipSuccess != result)
+    {
+        return result;
+    }
+
+    result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&large_segment_indices_output, segments),
+            detail::temp_storage::ptr_aligned_array(&medium_segment_indices_output, segments),
+            detail::temp_storage::ptr_aligned_array(&segment_count_output, 2),
+            detail::temp_storage::make_partition(&partition_temporary_storage,
+                                                 partition_storage_size),
+            // Large segments are merged between the output and these buffers
+            detail::temp_storage::ptr_aligned_array(&keys_tmp, size),
+            detail::temp_storage::ptr_aligned_array(&values_tmp, with_values ? size : 0)));
+    if(result != hipSuccess || temporary_storage == nullptr)
+    {
+        return result;
+    }
+
+    if(segments == 0u)
+    {
+        return hipSuccess;
+    }
+    if(debug_synchronous)
+    {
+        std::cout << "segments " << segments << '\n';
+        std::cout << "storage_size " << storage_size << '\n';
+        std::cout << "do_partitioning " << do_partitioning << '\n';
+        std::cout << "max_small_segment_length " << max_small_segment_length << '\n';
+        std::cout << "max_medium_segment_length " << max_medium_segment_length << '\n';
+        std::cout << "config::large::block_size: " << config::large::block_size << '\n';
+        std::cout << "config::large::items_per_thread: " << config::large::items_per_thread << '\n';
+        hipError_t error = hipStreamSynchronize(stream);
+        if(error != hipSuccess) return error;
+    }
+
+    std::chrono::high_resolution_clock::time_point start;
+    if(!do_partitioning)
+    {
+        // Without partitioning all segments are sorted by the kernel of the large segments
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("segmented_merge_sort:large_segments");
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(segmented_merge_sort_large_kernel<config::large::block_size,
+                                                              config::large::items_per_thread>),
+            dim3(segments), dim3(config::large::block_size), 0, stream,
+            keys_input, keys_tmp, keys_output, values_input, values_tmp, values_output,
+            segment_index_iterator(0), begin_offsets, end_offsets,
+            compare_function
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_merge_sort:large_segments",
+                                                    segments,
+                                                    start)
+        return hipSuccess;
+    }
+
+    small_segment_indices_output = make_reverse_iterator(large_segment_indices_output + segments);
+    result = partition_three_way(partition_temporary_storage,
+                                 partition_storage_size,
+                                 segment_index_iterator{},
+                                 large_segment_indices_output,
+                                 medium_segment_indices_output,
+                                 small_segment_indices_output,
+                                 segment_count_output,
+                                 segments,
+                                 large_segment_selector,
+                                 medium_segment_selector,
+                                 stream,
+                                 debug_synchronous);
+    if(hipSuccess != result)
+    {
+        return result;
+    }
+    segment_index_type segment_counts[2]{};
+    result = detail::memcpy_and_sync(&segment_counts,
+                                     segment_count_output,
+                                     sizeof(segment_counts),
+                                     hipMemcpyDeviceToHost,
+                                     stream);
+    if(hipSuccess != result)
+    {
+        return result;
+    }
+    const auto large_segment_count  = segment_counts[0];
+    const auto medium_segment_count = segment_counts[1];
+    const auto small_segment_count  = segments - large_segment_count - medium_segment_count;
+    if(debug_synchronous)
+    {
+        std::cout << "large_segment_count " << large_segment_count << '\n';
+        std::cout << "medium_segment_count " << medium_segment_count << '\n';
+        std::cout << "small_segment_count " << small_segment_count << '\n';
+    }
+    if(large_segment_count > 0)
+    {
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("segmented_merge_sort:large_segments");
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(segmented_merge_sort_large_kernel<config::large::block_size,
+                                                              config::large::items_per_thread>),
+            dim3(large_segment_count), dim3(config::large::block_size), 0, stream,
+            keys_input, keys_tmp, keys_output, values_input, values_tmp, values_output,
+            large_segment_indices_output, begin_offsets, end_offsets,
+            compare_function
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_merge_sort:large_segments",
+                                                    large_segment_count,
+                                                    start)
+    }
+    if(medium_segment_count > 0)
+    {
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("segmented_merge_sort:medium_segments");
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(segmented_merge_sort_medium_kernel<config::medium::block_size,
+                                                               config::medium::items_per_thread>),
+            dim3(medium_segment_count), dim3(config::medium::block_size), 0, stream,
+            keys_input, keys_output, values_input, values_output,
+            medium_segment_indices_output, begin_offsets, end_offsets,
+            compare_function
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_merge_sort:medium_segments",
+                                                    medium_segment_count,
+                                                    start)
+    }
+    if(small_segment_count > 0)
+    {
+        const auto small_segment_grid_size
+            = ::rocprim::detail::ceiling_div(small_segment_count, small_segments_per_block);
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("segmented_merge_sort:small_segments");
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(segmented_merge_sort_small_kernel<config::logical_warp_size_small,
+                                                              config::items_per_thread_small,
+                                                              config::block_size_small>),
+            dim3(small_segment_grid_size), dim3(config::block_size_small), 0, stream,
+            keys_input, keys_output, values_input, values_output,
+            small_segment_count, small_segment_indices_output, begin_offsets, end_offsets,
+            compare_function
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_merge_sort:small_segments",
+                                                    small_segment_count,
+                                                    start)
+    }
+    return hipSuccess;
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
+} // end namespace detail
+
+/// \brief Parallel segmented merge sort primitive for device level.
+///
+/// \p segmented_merge_sort function performs a device-wide merge sort across multiple,
+/// non-overlapping sequences of keys. Function sorts input keys based on comparison function.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the sorting function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * The sort is stable: equal keys keep their relative order.
+/// * Keys of any type can be sorted, \p compare_function must be a strict weak ordering.
+/// * Ranges specified by \p keys_input and \p keys_output must have at least \p size elements.
+/// * Ranges specified by \p begin_offsets and \p end_offsets must have
+/// at least \p segments elements. They may use the same sequence <tt>offsets</tt> of at least
+/// <tt>segments + 1</tt> elements: <tt>offsets</tt> for \p begin_offsets and
+/// <tt>offsets + 1</tt> for \p end_offsets.
+/// * Short segments are sorted by a warp or by a block in one pass, longer segments are
+/// sorted by a block in tiles which are merged by merge path, see \p segmented_merge_sort_config.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// \p segmented_merge_sort_config or a custom class with the same members.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam BinaryFunction - type of binary function used for sort. Default type
+/// is \p rocprim::less<Key>.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] compare_function - binary operation function object that will be used for comparison.
+/// The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level descending segmented merge sort is performed on an array of
+/// \p int values.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;      // e.g., 8
+/// int * input;            // e.g., [6, 3, 5, 4, 2, 8, 1, 7]
+/// int * output;           // empty array of 8 elements
+/// unsigned int segments;  // e.g., 3
+/// int * offsets;          // e.g. [0, 2, 3, 8]
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::segmented_merge_sort(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size,
+///     segments, offsets, offsets + 1,
+///     rocprim::greater<int>()
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform sort
+/// rocprim::segmented_merge_sort(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size,
+///     segments, offsets, offsets + 1,
+///     rocprim::greater<int>()
+/// );
+/// // keys_output: [6, 3, 5, 8, 7, 4, 2, 1]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class OffsetIterator,
+    class BinaryFunction = ::rocprim::less<typename std::iterator_traits<KeysInputIterator>::value_type>
+>
+inline
+hipError_t segmented_merge_sort(void * temporary_storage,
+                                size_t& storage_size,
+                                KeysInputIterator keys_input,
+                                KeysOutputIterator keys_output,
+                                unsigned int size,
+                                unsigned int segments,
+                                OffsetIterator begin_offsets,
+                                OffsetIterator end_offsets,
+                                BinaryFunction compare_function = BinaryFunction(),
+                                hipStream_t stream = 0,
+                                bool debug_synchronous = false)
+{
+    empty_type * values = nullptr;
+    return detail::segmented_merge_sort_impl<Config>(
+        temporary_storage, storage_size,
+        keys_input, keys_output, values, values,
+        size, segments, begin_offsets, end_offsets,
+        compare_function, stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel segmented merge sort-by-key primitive for device level.
+///
+/// \p segmented_merge_sort function performs a device-wide merge sort across multiple,
+/// non-overlapping sequences of (key, value) pairs. Function sorts input pairs based on
+/// comparison function of keys.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the sorting function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * The sort is stable: pairs with equal keys keep their relative order.
+/// * Keys of any type can be sorted, \p compare_function must be a strict weak ordering.
+/// * Ranges specified by \p keys_input, \p keys_output, \p values_input and \p values_output must
+/// have at least \p size elements.
+/// * Ranges specified by \p begin_offsets and \p end_offsets must have
+/// at least \p segments elements. They may use the same sequence <tt>offsets</tt> of at least
+/// <tt>segments + 1</tt> elements: <tt>offsets</tt> for \p begin_offsets and
+/// <tt>offsets + 1</tt> for \p end_offsets.
+/// * Short segments are sorted by a warp or by a block in one pass, longer segments are
+/// sorted by a block in tiles which are merged by merge path, see \p segmented_merge_sort_config.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// \p segmented_merge_sort_config or a custom class with the same members.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam BinaryFunction - type of binary function used for sort. Default type
+/// is \p rocprim::less<Key>.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] values_input - pointer to the first element in the range to sort.
+/// \param [out] values_output - pointer to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] compare_function - binary operation function object that will be used for comparison.
+/// The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level ascending segmented merge sort is performed where input keys
+/// are represented by an array of unsigned integers and input values by an array of
+/// <tt>double</tt>s.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;          // e.g., 8
+/// unsigned int * keys_input;  // e.g., [ 6, 3,  5, 4,  1,  8,  1, 7]
+/// double * values_input;      // e.g., [-5, 2, -4, 3, -1, -8, -2, 7]
+/// unsigned int * keys_output; // empty array of 8 elements
+/// double * values_output;     // empty array of 8 elements
+/// unsigned int segments;      // e.g., 3
+/// int * offsets;              // e.g. [0, 2, 3, 8]
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::segmented_merge_sort(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input, keys_output, values_input, values_output,
+///     input_size, segments, offsets, offsets + 1
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform sort
+/// rocprim::segmented_merge_sort(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input, keys_output, values_input, values_output,
+///     input_size, segments, offsets, offsets + 1
+/// );
+/// // keys_output:   [3,  6, 5,  1,  1, 4, 7,  8]
+/// // values_output: [2, -5, -4, -1, -2, 3, 7, -8]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class OffsetIterator,
+    class BinaryFunction = ::rocprim::less<typename std::iterator_traits<KeysInputIterator>::value_type>
+>
+inline
+hipError_t segmented_merge_sort(void * temporary_storage,
+                                size_t& storage_size,
+                                KeysInputIterator keys_input,
+                                KeysOutputIterator keys_output,
+                                ValuesInputIterator values_input,
+                                ValuesOutputIterator values_output,
+                                unsigned int size,
+                                unsigned int segments,
+                                OffsetIterator begin_offsets,
+                                OffsetIterator end_offsets,
+                                BinaryFunction compare_function = BinaryFunction(),
+                                hipStream_t stream = 0,
+                                bool debug_synchronous = false)
+{
+    return detail::segmented_merge_sort_impl<Config>(
+        temporary_storage, storage_size,
+        keys_input, keys_output, values_input, values_output,
+        size, segments, begin_offsets, end_offsets,
+        compare_function, stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel segmented merge argsort primitive for device level.
+///
+/// \p segmented_merge_sort_argsort function performs a device-wide merge sort of keys across
+/// multiple, non-overlapping segments and writes the sorting permutation to \p indices_output.
+///
+/// \par Overview
+/// * The indices are generated while the keys are loaded, an index array does not have to be
+/// allocated, filled and read by the sort. The indices are positions in the whole input, not in
+/// the segments, and equivalent keys keep the order of their indices.
+/// * The \p value_type of \p IndicesOutputIterator must be an integral type that can represent
+/// <tt>size - 1</tt>.
+/// * See \p segmented_merge_sort for the other requirements of the arguments.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class IndicesOutputIterator,
+    class OffsetIterator,
+    class BinaryFunction = ::rocprim::less<typename std::iterator_traits<KeysInputIterator>::value_type>
+>
+inline
+hipError_t segmented_merge_sort_argsort(void * temporary_storage,
+                                        size_t& storage_size,
+                                        KeysInputIterator keys_input,
+                                        KeysOutputIterator keys_output,
+                                        IndicesOutputIterator indices_output,
+                                        unsigned int size,
+                                        unsigned int segments,
+                                        OffsetIterator begin_offsets,
+                                        OffsetIterator end_offsets,
+                                        BinaryFunction compare_function = BinaryFunction(),
+                                        hipStream_t stream = 0,
+                                        bool debug_synchronous = false)
+{
+    using index_type = typename std::iterator_traits<IndicesOutputIterator>::value_type;
+    static_assert(std::is_integral<index_type>::value, "Indices must be of an integral type.");
+    return detail::segmented_merge_sort_impl<Config>(
+        temporary_storage, storage_size,
+        keys_input, keys_output, ::rocprim::counting_iterator<index_type>(0), indices_output,
+        size, segments, begin_offsets, end_offsets,
+        compare_function, stream, debug_synchronous
+    );
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_DEVICE_SEGMENTED_MERGE_SORT_HPP_
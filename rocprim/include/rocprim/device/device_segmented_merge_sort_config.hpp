@@ -0,0 +1,122 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_SEGMENTED_MERGE_SORT_CONFIG_HPP_
+#define ROCPRIM_DEVICE_DEVICE_SEGMENTED_MERGE_SORT_CONFIG_HPP_
+
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/various.hpp"
+#include "../functional.hpp"
+
+#include "config_types.hpp"
+
+/// \addtogroup primitivesmodule_deviceconfigs
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief Configuration of device-level segmented merge sort operation.
+///
+/// Segments are sorted by one of three kernels selected by their length:
+/// * a segment of at most <tt>LogicalWarpSizeSmall * ItemsPerThreadSmall</tt> elements is
+/// sorted by a logical warp,
+/// * a segment of at most <tt>MediumConfig::block_size * MediumConfig::items_per_thread</tt>
+/// elements is sorted by a block in a single block sort,
+/// * a longer segment is sorted by a block, which sorts tiles of
+/// <tt>LargeConfig::block_size * LargeConfig::items_per_thread</tt> elements and merges them
+/// by merge path.
+///
+/// \tparam LogicalWarpSizeSmall - number of threads in the logical warp of the kernel
+/// that processes small segments.
+/// \tparam ItemsPerThreadSmall - number of items processed by a thread in the kernel that processes
+/// small segments.
+/// \tparam BlockSizeSmall - number of threads per block in the kernel which processes the small segments.
+/// \tparam MediumConfig - configuration of the kernel which processes the medium segments.
+/// Must be \p kernel_config.
+/// \tparam LargeConfig - configuration of the kernel which processes the large segments.
+/// Must be \p kernel_config.
+/// \tparam PartitioningThreshold - if the number of segments is at least this threshold, the
+/// segments are partitioned to a small, a medium and a large segment collection. Otherwise, all
+/// segments are sorted by the kernel of the large segments.
+template<
+    unsigned int LogicalWarpSizeSmall,
+    unsigned int ItemsPerThreadSmall,
+    unsigned int BlockSizeSmall,
+    class MediumConfig,
+    class LargeConfig,
+    unsigned int PartitioningThreshold = 3000
+>
+struct segmented_merge_sort_config
+{
+    static_assert(LogicalWarpSizeSmall * ItemsPerThreadSmall
+                      <= MediumConfig::block_size * MediumConfig::items_per_thread,
+                  "The number of items processed by a small warp cannot be larger than the number "
+                  "of items processed by a medium block");
+    /// \brief The number of threads in the logical warp in the small segment processing kernel.
+    static constexpr unsigned int logical_warp_size_small = LogicalWarpSizeSmall;
+    /// \brief The number of items processed by a thread in the small segment processing kernel.
+    static constexpr unsigned int items_per_thread_small = ItemsPerThreadSmall;
+    /// \brief The number of threads per block in the small segment processing kernel.
+    static constexpr unsigned int block_size_small = BlockSizeSmall;
+    /// \brief Configuration of the medium segment processing kernel.
+    using medium = MediumConfig;
+    /// \brief Configuration of the large segment processing kernel.
+    using large = LargeConfig;
+    /// \brief If the number of segments is at least \p partitioning_threshold, then the segments are
+    /// partitioned into small, medium and large segment groups, and each group is handled by a
+    /// different, specialized kernel.
+    static constexpr unsigned int partitioning_threshold = PartitioningThreshold;
+};
+
+namespace detail
+{
+
+template<class Key, class Value>
+struct segmented_merge_sort_config_900
+{
+    static constexpr unsigned int item_scale =
+        ::rocprim::detail::ceiling_div<unsigned int>(::rocprim::max(sizeof(Key), sizeof(Value)), sizeof(int));
+
+    using type = segmented_merge_sort_config<
+        32,
+        ::rocprim::max(1u, 4u / item_scale),
+        256,
+        kernel_config<256, ::rocprim::max(1u, 8u / item_scale)>,
+        kernel_config<256, ::rocprim::max(1u, 8u / item_scale)>
+    >;
+};
+
+template<unsigned int TargetArch, class Key, class Value>
+struct default_segmented_merge_sort_config
+    : select_arch<
+          TargetArch,
+          detail::segmented_merge_sort_config_900<Key, Value>>
+{};
+
+} // end namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group primitivesmodule_deviceconfigs
+
+#endif // ROCPRIM_DEVICE_DEVICE_SEGMENTED_MERGE_SORT_CONFIG_HPP_
@@ -25,6 +25,7 @@
 #include <iterator>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "../config.hpp"
 #include "../detail/various.hpp"
@@ -37,9 +38,15 @@
 #include "../block/block_load.hpp"
 #include "../iterator/counting_iterator.hpp"
 #include "../iterator/reverse_iterator.hpp"
+#include "../iterator/transform_iterator.hpp"
+#include "detail/config/device_segmented_radix_sort.hpp"
+#include "detail/device_segment_lengths.hpp"
 #include "detail/device_segmented_radix_sort.hpp"
 #include "device_partition.hpp"
+#include "device_radix_sort.hpp"
+#include "device_select.hpp"
 #include "device_segmented_radix_sort_config.hpp"
+#include "instrumentation.hpp"
 
 /// \addtogroup devicemodule
 /// @{
@@ -52,6 +59,8 @@ namespace detail
 template<
     class Config,
     bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
     unsigned int BlockSize,
     class KeysInputIterator,
     class KeysOutputIterator,
@@ -75,7 +84,7 @@ void segmented_sort_kernel(KeysInputIterator keys_input,
                            unsigned int begin_bit,
                            unsigned int end_bit)
 {
-    segmented_sort<Config, Descending>(
+    segmented_sort<Config, Descending, FloatOrder, Decomposer>(
         keys_input, keys_tmp, keys_output, values_input, values_tmp, values_output,
         to_output,
         begin_offsets, end_offsets,
@@ -87,6 +96,8 @@ void segmented_sort_kernel(KeysInputIterator keys_input,
 template<
     class Config,
     bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
     unsigned int BlockSize,
     class KeysInputIterator,
     class KeysOutputIterator,
@@ -112,7 +123,7 @@ void segmented_sort_large_kernel(KeysInputIterator keys_input,
                                  unsigned int begin_bit,
                                  unsigned int end_bit)
 {
-    segmented_sort_large<Config, Descending>(
+    segmented_sort_large<Config, Descending, FloatOrder, Decomposer>(
         keys_input, keys_tmp, keys_output, values_input, values_tmp, values_output,
         to_output, segment_indices,
         begin_offsets, end_offsets,
@@ -121,8 +132,10 @@ void segmented_sort_large_kernel(KeysInputIterator keys_input,
     );
 }
 
-template<class Config,
-         bool         Descending,
+template<class             Config,
+         bool              Descending,
+         radix_float_order FloatOrder,
+         class Decomposer,
          unsigned int BlockSize,
          class KeysInputIterator,
          class KeysOutputIterator,
@@ -145,7 +158,7 @@ ROCPRIM_KERNEL __launch_bounds__(BlockSize) void segmented_sort_small_or_medium_
     unsigned int                                                    begin_bit,
     unsigned int                                                    end_bit)
 {
-    segmented_sort_small<Config, Descending>(
+    segmented_sort_small<Config, Descending, FloatOrder, Decomposer>(
         keys_input, keys_tmp, keys_output, values_input, values_tmp, values_output,
         to_output, num_segments, segment_indices,
         begin_offsets, end_offsets,
@@ -157,6 +170,7 @@ ROCPRIM_KERNEL __launch_bounds__(BlockSize) void segmented_sort_small_or_medium_
     { \
         auto _error = hipGetLastError(); \
         if(_error != hipSuccess) return _error; \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
         if(debug_synchronous) \
         { \
             std::cout << name << "(" << size << ")"; \
@@ -239,9 +253,152 @@ struct ThreeWayPartitioner
     }
 };
 
+// Offsets of a segment, segments sorted by the device-level radix sort are copied to the host
+template<class OffsetT>
+struct segmented_radix_sort_segment_bounds
+{
+    OffsetT begin;
+    OffsetT end;
+};
+
+template<class OffsetIterator>
+struct segmented_radix_sort_segment_bounds_op
+{
+    OffsetIterator begin_offsets;
+    OffsetIterator end_offsets;
+
+    using offset_type = segment_offset_type_t<OffsetIterator>;
+
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    segmented_radix_sort_segment_bounds<offset_type>
+        operator()(const unsigned int segment_index) const
+    {
+        OffsetIterator begin_offsets_it = begin_offsets;
+        OffsetIterator end_offsets_it   = end_offsets;
+        return {static_cast<offset_type>(begin_offsets_it[segment_index]),
+                static_cast<offset_type>(end_offsets_it[segment_index])};
+    }
+};
+
+struct segmented_radix_sort_device_segment_selector
+{
+    unsigned int device_sort_threshold;
+
+    template<class OffsetT>
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    bool operator()(const segmented_radix_sort_segment_bounds<OffsetT>& segment) const
+    {
+        return segment.end > segment.begin && segment.end - segment.begin > device_sort_threshold;
+    }
+};
+
+template<class T>
+inline
+hipError_t segmented_radix_sort_move_segment(T * source,
+                                             T * destination,
+                                             const size_t size,
+                                             const hipStream_t stream,
+                                             const bool debug_synchronous)
+{
+    return ::rocprim::transform(source, destination, size,
+                                ::rocprim::identity<T>(), stream, debug_synchronous);
+}
+
+// Only double buffers are moved, they are always pointers
+template<class SourceIterator, class DestinationIterator>
+inline
+hipError_t segmented_radix_sort_move_segment(SourceIterator,
+                                             DestinationIterator,
+                                             const size_t,
+                                             const hipStream_t,
+                                             const bool)
+{
+    return hipErrorInvalidValue;
+}
+
+// Sorts one segment by the device-level radix sort. With double buffers the sorted segment
+// is moved to the buffer that holds the results of the other segments.
+template<
+    bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class OffsetT
+>
+inline
+hipError_t segmented_radix_sort_device_segment(void * temporary_storage,
+                                               size_t storage_size,
+                                               KeysInputIterator keys_input,
+                                               typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
+                                               KeysOutputIterator keys_output,
+                                               ValuesInputIterator values_input,
+                                               typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
+                                               ValuesOutputIterator values_output,
+                                               const segmented_radix_sort_segment_bounds<OffsetT> segment,
+                                               const bool with_double_buffer,
+                                               const bool is_result_in_output,
+                                               unsigned int begin_bit,
+                                               unsigned int end_bit,
+                                               hipStream_t stream,
+                                               bool debug_synchronous)
+{
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+
+    const size_t size = segment.end - segment.begin;
+    bool is_segment_in_output;
+    hipError_t error = radix_sort_impl<default_config, Descending, FloatOrder, Decomposer>(
+        temporary_storage, storage_size,
+        keys_input + segment.begin,
+        with_double_buffer ? keys_tmp + segment.begin : nullptr,
+        keys_output + segment.begin,
+        values_input + segment.begin,
+        with_double_buffer ? values_tmp + segment.begin : nullptr,
+        values_output + segment.begin,
+        size, is_segment_in_output,
+        begin_bit, end_bit,
+        stream, debug_synchronous
+    );
+    if(error != hipSuccess || !with_double_buffer || is_segment_in_output == is_result_in_output)
+    {
+        return error;
+    }
+
+    if(is_segment_in_output)
+    {
+        error = segmented_radix_sort_move_segment(keys_output + segment.begin,
+                                                  keys_tmp + segment.begin,
+                                                  size, stream, debug_synchronous);
+        if(error == hipSuccess && with_values)
+        {
+            error = segmented_radix_sort_move_segment(values_output + segment.begin,
+                                                      values_tmp + segment.begin,
+                                                      size, stream, debug_synchronous);
+        }
+    }
+    else
+    {
+        error = segmented_radix_sort_move_segment(keys_tmp + segment.begin,
+                                                  keys_output + segment.begin,
+                                                  size, stream, debug_synchronous);
+        if(error == hipSuccess && with_values)
+        {
+            error = segmented_radix_sort_move_segment(values_tmp + segment.begin,
+                                                      values_output + segment.begin,
+                                                      size, stream, debug_synchronous);
+        }
+    }
+    return error;
+}
+
 template<
     class Config,
     bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
     class KeysInputIterator,
     class KeysOutputIterator,
     class ValuesInputIterator,
@@ -257,7 +414,7 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
                                      ValuesInputIterator values_input,
                                      typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
                                      ValuesOutputIterator values_output,
-                                     unsigned int size,
+                                     size_t size,
                                      bool& is_result_in_output,
                                      unsigned int segments,
                                      OffsetIterator begin_offsets,
@@ -271,6 +428,12 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
     using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
     using segment_index_type = unsigned int;
     using segment_index_iterator = counting_iterator<segment_index_type>;
+    using offset_type = segment_offset_type_t<OffsetIterator>;
+    using segment_bounds_type = segmented_radix_sort_segment_bounds<offset_type>;
+    using segment_bounds_iterator
+        = transform_iterator<segment_index_iterator,
+                             segmented_radix_sort_segment_bounds_op<OffsetIterator>,
+                             segment_bounds_type>;
 
     static_assert(
         std::is_same<key_type, typename std::iterator_traits<KeysOutputIterator>::value_type>::value,
@@ -313,13 +476,14 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
 
     const auto large_segment_selector = [=](const unsigned int segment_index) mutable -> bool
     {
-        const unsigned int segment_length
+        const offset_type segment_length
             = end_offsets[segment_index] - begin_offsets[segment_index];
         return segment_length > max_medium_segment_length;
     };
     const auto medium_segment_selector = [=](const unsigned int segment_index) mutable -> bool
     {
-        const unsigned int segment_length = end_offsets[segment_index] - begin_offsets[segment_index];
+        const offset_type segment_length
+            = end_offsets[segment_index] - begin_offsets[segment_index];
         return segment_length > max_small_segment_length;
     };
 
@@ -336,6 +500,18 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
     const bool do_partitioning = partitioning_allowed
         && segments >= config::warp_sort_config::partitioning_threshold;
 
+    // Segments longer than device_sort_threshold are sorted by the device-level radix sort. The
+    // number of such segments is limited by the number of keys.
+    const bool use_device_sort
+        = config::device_sort_threshold != 0 && size > config::device_sort_threshold;
+    const size_t max_device_segments
+        = use_device_sort ? size / (config::device_sort_threshold + 1) : 0;
+    const segment_bounds_iterator segment_bounds(
+        segment_index_iterator{},
+        segmented_radix_sort_segment_bounds_op<OffsetIterator>{begin_offsets, end_offsets});
+    const segmented_radix_sort_device_segment_selector device_segment_selector{
+        config::device_sort_threshold};
+
     const size_t            medium_segment_indices_size = three_way_partitioning ? segments : 0;
     static constexpr size_t segment_count_output_size = three_way_partitioning ? 2 : 1;
     const size_t            segment_count_output_bytes
@@ -352,6 +528,12 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
     segment_index_type* segment_count_output{};
     size_t              partition_storage_size{};
     void*               partition_temporary_storage{};
+    segment_bounds_type*                 device_segments{};
+    segment_index_type*                  device_segment_count_output{};
+    size_t                               device_select_storage_size{};
+    void*                                device_select_temporary_storage{};
+    size_t                               device_sort_storage_size{};
+    void*                                device_sort_temporary_storage{};
 
     const auto partitioner_result = partitioner(nullptr,
                                                 partition_storage_size,
@@ -370,6 +552,36 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
         return partitioner_result;
     }
 
+    if(use_device_sort)
+    {
+        hipError_t result = ::rocprim::select(nullptr,
+                                              device_select_storage_size,
+                                              segment_bounds,
+                                              device_segments,
+                                              device_segment_count_output,
+                                              segments,
+                                              device_segment_selector,
+                                              stream,
+                                              debug_synchronous);
+        if(hipSuccess != result)
+        {
+            return result;
+        }
+        bool is_segment_in_output;
+        result = radix_sort_impl<default_config, Descending, FloatOrder, Decomposer>(
+            nullptr, device_sort_storage_size,
+            keys_input, with_double_buffer ? keys_tmp : nullptr, keys_output,
+            values_input, with_double_buffer ? values_tmp : nullptr, values_output,
+            size, is_segment_in_output,
+            begin_bit, end_bit,
+            stream, debug_synchronous
+        );
+        if(hipSuccess != result)
+        {
+            return result;
+        }
+    }
+
     const hipError_t partition_result = detail::temp_storage::partition(
         temporary_storage,
         storage_size,
@@ -380,10 +592,19 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
                                                     medium_segment_indices_size),
             detail::temp_storage::ptr_aligned_array(&segment_count_output,
                                                     segment_count_output_size),
+            detail::temp_storage::ptr_aligned_array(&device_segments, max_device_segments),
+            detail::temp_storage::ptr_aligned_array(&device_segment_count_output,
+                                                    use_device_sort ? 1 : 0),
             detail::temp_storage::make_union_partition(
                 // Partition temporary storage only needed by partitioning.
                 detail::temp_storage::make_partition(&partition_temporary_storage,
                                                      partition_storage_size),
+                // The segments sorted by the device-level radix sort are selected and sorted
+                // before the other segments.
+                detail::temp_storage::make_partition(&device_select_temporary_storage,
+                                                     device_select_storage_size),
+                detail::temp_storage::make_partition(&device_sort_temporary_storage,
+                                                     device_sort_storage_size),
                 // Keys/values temporary storage only needed by sorting.
                 detail::temp_storage::make_linear_partition(
                     detail::temp_storage::ptr_aligned_array(&keys_tmp_storage,
@@ -412,12 +633,74 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
         std::cout << "long_iterations " << long_iterations << '\n';
         std::cout << "short_iterations " << short_iterations << '\n';
         std::cout << "do_partitioning " << do_partitioning << '\n';
+        std::cout << "use_device_sort " << use_device_sort << '\n';
         std::cout << "config::sort::block_size: " << config::sort::block_size << '\n';
         std::cout << "config::sort::items_per_thread: " << config::sort::items_per_thread << '\n';
         hipError_t error = hipStreamSynchronize(stream);
         if(error != hipSuccess) return error;
     }
 
+    if(use_device_sort)
+    {
+        hipError_t result = ::rocprim::select(device_select_temporary_storage,
+                                              device_select_storage_size,
+                                              segment_bounds,
+                                              device_segments,
+                                              device_segment_count_output,
+                                              segments,
+                                              device_segment_selector,
+                                              stream,
+                                              debug_synchronous);
+        if(hipSuccess != result)
+        {
+            return result;
+        }
+        segment_index_type device_segment_count{};
+        result = detail::memcpy_and_sync(&device_segment_count,
+                                         device_segment_count_output,
+                                         sizeof(segment_index_type),
+                                         hipMemcpyDeviceToHost,
+                                         stream);
+        if(hipSuccess != result)
+        {
+            return result;
+        }
+        std::vector<segment_bounds_type> host_device_segments(device_segment_count);
+        if(device_segment_count > 0)
+        {
+            result = detail::memcpy_and_sync(host_device_segments.data(),
+                                             device_segments,
+                                             device_segment_count
+                                                 * sizeof(segment_bounds_type),
+                                             hipMemcpyDeviceToHost,
+                                             stream);
+            if(hipSuccess != result)
+            {
+                return result;
+            }
+        }
+        if(debug_synchronous)
+        {
+            std::cout << "device_segment_count " << device_segment_count << '\n';
+        }
+        // The other segments are skipped by the kernels below
+        for(const segment_bounds_type& segment : host_device_segments)
+        {
+            result = segmented_radix_sort_device_segment<Descending, FloatOrder, Decomposer>(
+                device_sort_temporary_storage, device_sort_storage_size,
+                keys_input, keys_tmp, keys_output,
+                values_input, values_tmp, values_output,
+                segment, with_double_buffer, is_result_in_output,
+                begin_bit, end_bit,
+                stream, debug_synchronous
+            );
+            if(hipSuccess != result)
+            {
+                return result;
+            }
+        }
+    }
+
     if(!with_double_buffer)
     {
         keys_tmp   = keys_tmp_storage;
@@ -466,8 +749,9 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
         {
             std::chrono::high_resolution_clock::time_point start;
             if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+            ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("segmented_sort:large_segments");
             hipLaunchKernelGGL(
-                HIP_KERNEL_NAME(segmented_sort_large_kernel<config, Descending, config::sort::block_size>),
+                HIP_KERNEL_NAME(segmented_sort_large_kernel<config, Descending, FloatOrder, Decomposer, config::sort::block_size>),
                 dim3(large_segment_count), dim3(config::sort::block_size), 0, stream,
                 keys_input, keys_tmp, keys_output, values_input, values_tmp, values_output,
                 to_output, large_segment_indices_output,
@@ -486,11 +770,12 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
             std::chrono::high_resolution_clock::time_point start;
             if(debug_synchronous)
                 start = std::chrono::high_resolution_clock::now();
+            ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("segmented_sort:medium_segments");
             hipLaunchKernelGGL(
                 HIP_KERNEL_NAME(
                     segmented_sort_small_or_medium_kernel<
                         select_warp_sort_helper_config_medium_t<typename config::warp_sort_config>,
-                        Descending,
+                        Descending, FloatOrder, Decomposer,
                         config::warp_sort_config::block_size_medium>),
                 dim3(medium_segment_grid_size),
                 dim3(config::warp_sort_config::block_size_medium),
@@ -519,11 +804,12 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
                                                                                 small_segments_per_block);
             std::chrono::high_resolution_clock::time_point start;
             if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+            ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("segmented_sort:small_segments");
             hipLaunchKernelGGL(
                 HIP_KERNEL_NAME(
                     segmented_sort_small_or_medium_kernel<
                         select_warp_sort_helper_config_small_t<typename config::warp_sort_config>,
-                        Descending,
+                        Descending, FloatOrder, Decomposer,
                         config::warp_sort_config::block_size_small>),
                 dim3(small_segment_grid_size),
                 dim3(config::warp_sort_config::block_size_small),
@@ -551,8 +837,9 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
     {
         std::chrono::high_resolution_clock::time_point start;
         if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("segmented_sort");
         hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(segmented_sort_kernel<config, Descending, config::sort::block_size>),
+            HIP_KERNEL_NAME(segmented_sort_kernel<config, Descending, FloatOrder, Decomposer, config::sort::block_size>),
             dim3(segments), dim3(config::sort::block_size), 0, stream,
             keys_input, keys_tmp, keys_output, values_input, values_tmp, values_output,
             to_output,
@@ -565,6 +852,271 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
     return hipSuccess;
 }
 
+// Offsets of segments that all have the same size
+struct segmented_radix_sort_fixed_offset_op
+{
+    unsigned int segment_size;
+
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    unsigned int operator()(const unsigned int segment_index) const
+    {
+        return segment_index * segment_size;
+    }
+};
+
+template<
+    class Config,
+    bool Descending,
+    radix_float_order FloatOrder,
+    class Decomposer,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator
+>
+inline
+hipError_t segmented_radix_sort_fixed_impl(void * temporary_storage,
+                                           size_t& storage_size,
+                                           KeysInputIterator keys_input,
+                                           KeysOutputIterator keys_output,
+                                           ValuesInputIterator values_input,
+                                           ValuesOutputIterator values_output,
+                                           unsigned int segment_size,
+                                           unsigned int segments,
+                                           unsigned int begin_bit,
+                                           unsigned int end_bit,
+                                           hipStream_t stream,
+                                           bool debug_synchronous)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    using segment_index_type = unsigned int;
+    using segment_index_iterator = counting_iterator<segment_index_type>;
+    using offset_iterator = transform_iterator<segment_index_iterator,
+                                               segmented_radix_sort_fixed_offset_op,
+                                               unsigned int>;
+
+    static_assert(
+        std::is_same<key_type, typename std::iterator_traits<KeysOutputIterator>::value_type>::value,
+        "KeysInputIterator and KeysOutputIterator must have the same value_type"
+    );
+    static_assert(
+        std::is_same<value_type, typename std::iterator_traits<ValuesOutputIterator>::value_type>::value,
+        "ValuesInputIterator and ValuesOutputIterator must have the same value_type"
+    );
+
+    using config = default_or_custom_config<
+        Config,
+        default_segmented_radix_sort_config<ROCPRIM_TARGET_ARCH, key_type, value_type>
+    >;
+
+    static constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+    static constexpr bool warp_sort_allowed =
+        !std::is_same<typename config::warp_sort_config, DisabledWarpSortConfig>::value;
+    static constexpr unsigned int max_small_segment_length
+        = config::warp_sort_config::items_per_thread_small
+          * config::warp_sort_config::logical_warp_size_small;
+    static constexpr unsigned int small_segments_per_block
+        = config::warp_sort_config::block_size_small
+          / config::warp_sort_config::logical_warp_size_small;
+    static constexpr unsigned int max_medium_segment_length
+        = config::warp_sort_config::items_per_thread_medium
+          * config::warp_sort_config::logical_warp_size_medium;
+    static constexpr unsigned int medium_segments_per_block
+        = config::warp_sort_config::block_size_medium
+          / config::warp_sort_config::logical_warp_size_medium;
+    static constexpr unsigned int items_per_block
+        = config::sort::block_size * config::sort::items_per_thread;
+
+    // All segments have the same size, so one kernel sorts all of them and no partitioning is needed
+    const bool use_device_sort
+        = config::device_sort_threshold != 0 && segment_size > config::device_sort_threshold;
+    const bool use_small_warp_sort = warp_sort_allowed && segment_size <= max_small_segment_length;
+    const bool use_medium_warp_sort
+        = warp_sort_allowed && !use_small_warp_sort && segment_size <= max_medium_segment_length;
+    const bool use_block_sort = !use_small_warp_sort && !use_medium_warp_sort && !use_device_sort;
+    // Only segments that are sorted by several radix passes need the temporary buffers
+    const bool use_radix_passes = use_block_sort && segment_size > items_per_block;
+
+    const size_t size = static_cast<size_t>(segment_size) * segments;
+
+    key_type*   keys_tmp;
+    value_type* values_tmp;
+    size_t      device_sort_storage_size{};
+    void*       device_sort_temporary_storage{};
+
+    if(use_device_sort)
+    {
+        bool is_segment_in_output;
+        const hipError_t result = radix_sort_impl<default_config, Descending, FloatOrder, Decomposer>(
+            nullptr, device_sort_storage_size,
+            keys_input, nullptr, keys_output,
+            values_input, nullptr, values_output,
+            segment_size, is_segment_in_output,
+            begin_bit, end_bit,
+            stream, debug_synchronous
+        );
+        if(hipSuccess != result)
+        {
+            return result;
+        }
+    }
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&keys_tmp, use_radix_passes ? size : 0),
+            detail::temp_storage::ptr_aligned_array(&values_tmp,
+                                                    use_radix_passes && with_values ? size : 0),
+            detail::temp_storage::make_partition(&device_sort_temporary_storage,
+                                                 device_sort_storage_size)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(segments == 0u || segment_size == 0u)
+    {
+        return hipSuccess;
+    }
+
+    const unsigned int bits = end_bit - begin_bit;
+    const unsigned int iterations = ::rocprim::detail::ceiling_div(bits, config::long_radix_bits);
+    const bool to_output = (iterations - 1) % 2 == 0;
+    const unsigned int radix_bits_diff = config::long_radix_bits - config::short_radix_bits;
+    const unsigned int short_iterations = radix_bits_diff != 0
+        ? ::rocprim::min(iterations, (config::long_radix_bits * iterations - bits) / radix_bits_diff)
+        : 0;
+    const unsigned int long_iterations = iterations - short_iterations;
+
+    const offset_iterator begin_offsets(segment_index_iterator(0),
+                                        segmented_radix_sort_fixed_offset_op{segment_size});
+    const offset_iterator end_offsets = begin_offsets + 1;
+
+    if(debug_synchronous)
+    {
+        std::cout << "begin_bit " << begin_bit << '\n';
+        std::cout << "end_bit " << end_bit << '\n';
+        std::cout << "segment_size " << segment_size << '\n';
+        std::cout << "segments " << segments << '\n';
+        std::cout << "use_small_warp_sort " << use_small_warp_sort << '\n';
+        std::cout << "use_medium_warp_sort " << use_medium_warp_sort << '\n';
+        std::cout << "use_radix_passes " << use_radix_passes << '\n';
+        std::cout << "use_device_sort " << use_device_sort << '\n';
+        hipError_t error = hipStreamSynchronize(stream);
+        if(error != hipSuccess) return error;
+    }
+
+    if(use_device_sort)
+    {
+        // Every segment is sorted by all blocks of the device
+        for(unsigned int segment_index = 0; segment_index < segments; segment_index++)
+        {
+            const size_t       segment_begin = static_cast<size_t>(segment_index) * segment_size;
+            const hipError_t   result
+                = segmented_radix_sort_device_segment<Descending, FloatOrder, Decomposer>(
+                    device_sort_temporary_storage, device_sort_storage_size,
+                    keys_input, keys_tmp, keys_output,
+                    values_input, values_tmp, values_output,
+                    segmented_radix_sort_segment_bounds<size_t>{segment_begin,
+                                                                segment_begin + segment_size},
+                    false, true,
+                    begin_bit, end_bit,
+                    stream, debug_synchronous
+                );
+            if(hipSuccess != result)
+            {
+                return result;
+            }
+        }
+        return hipSuccess;
+    }
+
+    std::chrono::high_resolution_clock::time_point start;
+    if(use_small_warp_sort)
+    {
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("segmented_sort:small_segments");
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(
+                segmented_sort_small_or_medium_kernel<
+                    select_warp_sort_helper_config_small_t<typename config::warp_sort_config>,
+                    Descending, FloatOrder, Decomposer,
+                    config::warp_sort_config::block_size_small>),
+            dim3(::rocprim::detail::ceiling_div(segments, small_segments_per_block)),
+            dim3(config::warp_sort_config::block_size_small),
+            0,
+            stream,
+            keys_input,
+            keys_tmp,
+            keys_output,
+            values_input,
+            values_tmp,
+            values_output,
+            true,
+            segments,
+            segment_index_iterator(0),
+            begin_offsets,
+            end_offsets,
+            begin_bit,
+            end_bit);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_sort:small_segments",
+                                                    segments,
+                                                    start)
+    }
+    else if(use_medium_warp_sort)
+    {
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("segmented_sort:medium_segments");
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(
+                segmented_sort_small_or_medium_kernel<
+                    select_warp_sort_helper_config_medium_t<typename config::warp_sort_config>,
+                    Descending, FloatOrder, Decomposer,
+                    config::warp_sort_config::block_size_medium>),
+            dim3(::rocprim::detail::ceiling_div(segments, medium_segments_per_block)),
+            dim3(config::warp_sort_config::block_size_medium),
+            0,
+            stream,
+            keys_input,
+            keys_tmp,
+            keys_output,
+            values_input,
+            values_tmp,
+            values_output,
+            true,
+            segments,
+            segment_index_iterator(0),
+            begin_offsets,
+            end_offsets,
+            begin_bit,
+            end_bit);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_sort:medium_segments",
+                                                    segments,
+                                                    start)
+    }
+    else
+    {
+        // Segments that fit into one block are sorted directly to the output
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("segmented_sort:large_segments");
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(segmented_sort_large_kernel<config, Descending, FloatOrder, Decomposer, config::sort::block_size>),
+            dim3(segments), dim3(config::sort::block_size), 0, stream,
+            keys_input, keys_tmp, keys_output, values_input, values_tmp, values_output,
+            to_output, segment_index_iterator(0),
+            begin_offsets, end_offsets,
+            long_iterations, short_iterations,
+            begin_bit, end_bit
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_sort:large_segments",
+                                                    segments,
+                                                    start)
+    }
+    return hipSuccess;
+}
+
 #undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
 
 } // end namespace detail
@@ -591,6 +1143,8 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
 ///
 /// \tparam Config - [optional] configuration of the primitive. It can be
 /// \p segmented_radix_sort_config or a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
 /// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
@@ -659,6 +1213,7 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
 /// \endparblock
 template<
     class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
     class KeysInputIterator,
     class KeysOutputIterator,
     class OffsetIterator,
@@ -669,7 +1224,7 @@ hipError_t segmented_radix_sort_keys(void * temporary_storage,
                                      size_t& storage_size,
                                      KeysInputIterator keys_input,
                                      KeysOutputIterator keys_output,
-                                     unsigned int size,
+                                     size_t size,
                                      unsigned int segments,
                                      OffsetIterator begin_offsets,
                                      OffsetIterator end_offsets,
@@ -680,7 +1235,7 @@ hipError_t segmented_radix_sort_keys(void * temporary_storage,
 {
     empty_type * values = nullptr;
     bool ignored;
-    return detail::segmented_radix_sort_impl<Config, false>(
+    return detail::segmented_radix_sort_impl<Config, false, FloatOrder, identity_decomposer>(
         temporary_storage, storage_size,
         keys_input, nullptr, keys_output,
         values, nullptr, values,
@@ -713,6 +1268,8 @@ hipError_t segmented_radix_sort_keys(void * temporary_storage,
 ///
 /// \tparam Config - [optional] configuration of the primitive. It can be
 /// \p segmented_radix_sort_config or a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
 /// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
@@ -781,6 +1338,7 @@ hipError_t segmented_radix_sort_keys(void * temporary_storage,
 /// \endparblock
 template<
     class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
     class KeysInputIterator,
     class KeysOutputIterator,
     class OffsetIterator,
@@ -791,7 +1349,7 @@ hipError_t segmented_radix_sort_keys_desc(void * temporary_storage,
                                           size_t& storage_size,
                                           KeysInputIterator keys_input,
                                           KeysOutputIterator keys_output,
-                                          unsigned int size,
+                                          size_t size,
                                           unsigned int segments,
                                           OffsetIterator begin_offsets,
                                           OffsetIterator end_offsets,
@@ -802,7 +1360,7 @@ hipError_t segmented_radix_sort_keys_desc(void * temporary_storage,
 {
     empty_type * values = nullptr;
     bool ignored;
-    return detail::segmented_radix_sort_impl<Config, true>(
+    return detail::segmented_radix_sort_impl<Config, true, FloatOrder, identity_decomposer>(
         temporary_storage, storage_size,
         keys_input, nullptr, keys_output,
         values, nullptr, values,
@@ -836,6 +1394,8 @@ hipError_t segmented_radix_sort_keys_desc(void * temporary_storage,
 ///
 /// \tparam Config - [optional] configuration of the primitive. It can be
 /// \p segmented_radix_sort_config or a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
 /// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
@@ -919,6 +1479,7 @@ hipError_t segmented_radix_sort_keys_desc(void * temporary_storage,
 /// \endparblock
 template<
     class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
     class KeysInputIterator,
     class KeysOutputIterator,
     class ValuesInputIterator,
@@ -933,7 +1494,7 @@ hipError_t segmented_radix_sort_pairs(void * temporary_storage,
                                       KeysOutputIterator keys_output,
                                       ValuesInputIterator values_input,
                                       ValuesOutputIterator values_output,
-                                      unsigned int size,
+                                      size_t size,
                                       unsigned int segments,
                                       OffsetIterator begin_offsets,
                                       OffsetIterator end_offsets,
@@ -943,7 +1504,7 @@ hipError_t segmented_radix_sort_pairs(void * temporary_storage,
                                       bool debug_synchronous = false)
 {
     bool ignored;
-    return detail::segmented_radix_sort_impl<Config, false>(
+    return detail::segmented_radix_sort_impl<Config, false, FloatOrder, identity_decomposer>(
         temporary_storage, storage_size,
         keys_input, nullptr, keys_output,
         values_input, nullptr, values_output,
@@ -977,6 +1538,8 @@ hipError_t segmented_radix_sort_pairs(void * temporary_storage,
 ///
 /// \tparam Config - [optional] configuration of the primitive. It can be
 /// \p segmented_radix_sort_config or a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
 /// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
@@ -1056,6 +1619,7 @@ hipError_t segmented_radix_sort_pairs(void * temporary_storage,
 /// \endparblock
 template<
     class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
     class KeysInputIterator,
     class KeysOutputIterator,
     class ValuesInputIterator,
@@ -1070,7 +1634,7 @@ hipError_t segmented_radix_sort_pairs_desc(void * temporary_storage,
                                            KeysOutputIterator keys_output,
                                            ValuesInputIterator values_input,
                                            ValuesOutputIterator values_output,
-                                           unsigned int size,
+                                           size_t size,
                                            unsigned int segments,
                                            OffsetIterator begin_offsets,
                                            OffsetIterator end_offsets,
@@ -1080,7 +1644,7 @@ hipError_t segmented_radix_sort_pairs_desc(void * temporary_storage,
                                            bool debug_synchronous = false)
 {
     bool ignored;
-    return detail::segmented_radix_sort_impl<Config, true>(
+    return detail::segmented_radix_sort_impl<Config, true, FloatOrder, identity_decomposer>(
         temporary_storage, storage_size,
         keys_input, nullptr, keys_output,
         values_input, nullptr, values_output,
@@ -1091,52 +1655,356 @@ hipError_t segmented_radix_sort_pairs_desc(void * temporary_storage,
     );
 }
 
-/// \brief Parallel ascending radix sort primitive for device level.
+/// \brief Parallel ascending segmented radix argsort primitive for device level.
 ///
-/// \p segmented_radix_sort_keys function performs a device-wide radix sort across multiple,
-/// non-overlapping sequences of keys. Function sorts input keys in ascending order.
+/// \p segmented_radix_sort_argsort function performs a device-wide radix sort of keys across
+/// multiple, non-overlapping segments and writes the sorting permutation to \p indices_output.
 ///
 /// \par Overview
-/// * The contents of both buffers of \p keys may be altered by the sorting function.
-/// * \p current() of \p keys is used as the input.
-/// * The function will update \p current() of \p keys to point to the buffer
-/// that contains the output range.
-/// * Returns the required size of \p temporary_storage in \p storage_size
-/// if \p temporary_storage in a null pointer.
-/// * The function requires small \p temporary_storage as it does not need
-/// a temporary buffer of \p size elements.
-/// * \p Key type must be an arithmetic type (that is, an integral type or a floating-point
-/// type).
-/// * Buffers of \p keys must have at least \p size elements.
-/// * Ranges specified by \p begin_offsets and \p end_offsets must have
-/// at least \p segments elements. They may use the same sequence <tt>offsets</tt> of at least
-/// <tt>segments + 1</tt> elements: <tt>offsets</tt> for \p begin_offsets and
-/// <tt>offsets + 1</tt> for \p end_offsets.
-/// * If \p Key is an integer type and the range of keys is known in advance, the performance
-/// can be improved by setting \p begin_bit and \p end_bit, for example if all keys are in range
-/// [100, 10000], <tt>begin_bit = 0</tt> and <tt>end_bit = 14</tt> will cover the whole range.
-///
-/// \tparam Config - [optional] configuration of the primitive. It can be
-/// \p segmented_radix_sort_config or a custom class with the same members.
-/// \tparam Key - key type. Must be an integral type or a floating-point type.
-/// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
-/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// * The indices are generated while the keys are loaded, an index array does not have to be
+/// allocated, filled and read by the sort. The indices are positions in the whole input, not in
+/// the segments, and keys with equal values keep the order of their indices.
+/// * The \p value_type of \p IndicesOutputIterator must be an integral type that can represent
+/// <tt>size - 1</tt>.
+/// * See \p segmented_radix_sort_pairs for the other requirements of the arguments.
 ///
-/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
-/// a null pointer is passed, the required allocation size (in bytes) is written to
-/// \p storage_size and function returns without performing the sort operation.
-/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
-/// \param [in,out] keys - reference to the double-buffer of keys, its \p current()
-/// contains the input range and will be updated to point to the output range.
-/// \param [in] size - number of element in the input range.
-/// \param [in] segments - number of segments in the input range.
-/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
-/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
-/// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
-/// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
-/// Non-default value not supported for floating-point key-types.
-/// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
-/// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class IndicesOutputIterator,
+    class OffsetIterator,
+    class Key = typename std::iterator_traits<KeysInputIterator>::value_type
+>
+inline
+hipError_t segmented_radix_sort_argsort(void * temporary_storage,
+                                        size_t& storage_size,
+                                        KeysInputIterator keys_input,
+                                        KeysOutputIterator keys_output,
+                                        IndicesOutputIterator indices_output,
+                                        size_t size,
+                                        unsigned int segments,
+                                        OffsetIterator begin_offsets,
+                                        OffsetIterator end_offsets,
+                                        unsigned int begin_bit = 0,
+                                        unsigned int end_bit = 8 * sizeof(Key),
+                                        hipStream_t stream = 0,
+                                        bool debug_synchronous = false)
+{
+    using index_type = typename std::iterator_traits<IndicesOutputIterator>::value_type;
+    static_assert(std::is_integral<index_type>::value, "Indices must be of an integral type.");
+    bool ignored;
+    return detail::segmented_radix_sort_impl<Config, false, FloatOrder, identity_decomposer>(
+        temporary_storage, storage_size,
+        keys_input, nullptr, keys_output,
+        ::rocprim::counting_iterator<index_type>(0), nullptr, indices_output,
+        size, ignored,
+        segments, begin_offsets, end_offsets,
+        begin_bit, end_bit,
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel descending segmented radix argsort primitive for device level.
+///
+/// \p segmented_radix_sort_argsort_desc function performs a device-wide radix sort of keys in
+/// descending order across multiple, non-overlapping segments and writes the sorting
+/// permutation to \p indices_output, see \p segmented_radix_sort_argsort.
+template<
+    class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class IndicesOutputIterator,
+    class OffsetIterator,
+    class Key = typename std::iterator_traits<KeysInputIterator>::value_type
+>
+inline
+hipError_t segmented_radix_sort_argsort_desc(void * temporary_storage,
+                                             size_t& storage_size,
+                                             KeysInputIterator keys_input,
+                                             KeysOutputIterator keys_output,
+                                             IndicesOutputIterator indices_output,
+                                             size_t size,
+                                             unsigned int segments,
+                                             OffsetIterator begin_offsets,
+                                             OffsetIterator end_offsets,
+                                             unsigned int begin_bit = 0,
+                                             unsigned int end_bit = 8 * sizeof(Key),
+                                             hipStream_t stream = 0,
+                                             bool debug_synchronous = false)
+{
+    using index_type = typename std::iterator_traits<IndicesOutputIterator>::value_type;
+    static_assert(std::is_integral<index_type>::value, "Indices must be of an integral type.");
+    bool ignored;
+    return detail::segmented_radix_sort_impl<Config, true, FloatOrder, identity_decomposer>(
+        temporary_storage, storage_size,
+        keys_input, nullptr, keys_output,
+        ::rocprim::counting_iterator<index_type>(0), nullptr, indices_output,
+        size, ignored,
+        segments, begin_offsets, end_offsets,
+        begin_bit, end_bit,
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel ascending segmented radix sort primitive for device level, the segments are
+/// given by their lengths.
+///
+/// \p segmented_radix_sort_keys_by_lengths function sorts the keys of every segment in ascending
+/// order, see \p segmented_radix_sort_keys. The segment \p i has \p segment_lengths[i] keys and
+/// begins after the keys of the previous segments.
+///
+/// \par Overview
+/// * The offsets of the segments are computed by one exclusive scan of \p segment_lengths into
+/// \p temporary_storage, so the caller does not need to scan the lengths nor to allocate the
+/// offsets. Segments that already have an array of <tt>segments + 1</tt> offsets should be
+/// sorted by \p segmented_radix_sort_keys with <tt>offsets</tt> and <tt>offsets + 1</tt>.
+/// * The offsets are 64-bit if the \p value_type of \p LengthIterator is a 64-bit integer.
+/// * The sum of \p segment_lengths must not exceed \p size.
+///
+/// \tparam LengthIterator - random-access iterator type of the lengths of the segments. It can be
+/// a simple pointer type.
+///
+/// \param [in] segment_lengths - iterator to the first element of the \p segments lengths of the
+/// segments.
+template<
+    class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class LengthIterator,
+    class Key = typename std::iterator_traits<KeysInputIterator>::value_type
+>
+inline
+hipError_t segmented_radix_sort_keys_by_lengths(void * temporary_storage,
+                                                size_t& storage_size,
+                                                KeysInputIterator keys_input,
+                                                KeysOutputIterator keys_output,
+                                                size_t size,
+                                                unsigned int segments,
+                                                LengthIterator segment_lengths,
+                                                unsigned int begin_bit = 0,
+                                                unsigned int end_bit = 8 * sizeof(Key),
+                                                hipStream_t stream = 0,
+                                                bool debug_synchronous = false)
+{
+    empty_type * values = nullptr;
+    return detail::segment_lengths_to_offsets(
+        temporary_storage, storage_size,
+        segment_lengths, segments,
+        [&](void* storage, size_t& bytes, auto begin_offsets, auto end_offsets)
+        {
+            bool ignored;
+            return detail::segmented_radix_sort_impl<Config, false, FloatOrder,
+                                                     identity_decomposer>(
+                storage, bytes,
+                keys_input, nullptr, keys_output,
+                values, nullptr, values,
+                size, ignored,
+                segments, begin_offsets, end_offsets,
+                begin_bit, end_bit,
+                stream, debug_synchronous
+            );
+        },
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel descending segmented radix sort primitive for device level, the segments are
+/// given by their lengths, see \p segmented_radix_sort_keys_by_lengths.
+template<
+    class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class LengthIterator,
+    class Key = typename std::iterator_traits<KeysInputIterator>::value_type
+>
+inline
+hipError_t segmented_radix_sort_keys_desc_by_lengths(void * temporary_storage,
+                                                     size_t& storage_size,
+                                                     KeysInputIterator keys_input,
+                                                     KeysOutputIterator keys_output,
+                                                     size_t size,
+                                                     unsigned int segments,
+                                                     LengthIterator segment_lengths,
+                                                     unsigned int begin_bit = 0,
+                                                     unsigned int end_bit = 8 * sizeof(Key),
+                                                     hipStream_t stream = 0,
+                                                     bool debug_synchronous = false)
+{
+    empty_type * values = nullptr;
+    return detail::segment_lengths_to_offsets(
+        temporary_storage, storage_size,
+        segment_lengths, segments,
+        [&](void* storage, size_t& bytes, auto begin_offsets, auto end_offsets)
+        {
+            bool ignored;
+            return detail::segmented_radix_sort_impl<Config, true, FloatOrder,
+                                                     identity_decomposer>(
+                storage, bytes,
+                keys_input, nullptr, keys_output,
+                values, nullptr, values,
+                size, ignored,
+                segments, begin_offsets, end_offsets,
+                begin_bit, end_bit,
+                stream, debug_synchronous
+            );
+        },
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel ascending segmented radix sort-by-key primitive for device level, the
+/// segments are given by their lengths, see \p segmented_radix_sort_pairs and
+/// \p segmented_radix_sort_keys_by_lengths.
+template<
+    class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class LengthIterator,
+    class Key = typename std::iterator_traits<KeysInputIterator>::value_type
+>
+inline
+hipError_t segmented_radix_sort_pairs_by_lengths(void * temporary_storage,
+                                                 size_t& storage_size,
+                                                 KeysInputIterator keys_input,
+                                                 KeysOutputIterator keys_output,
+                                                 ValuesInputIterator values_input,
+                                                 ValuesOutputIterator values_output,
+                                                 size_t size,
+                                                 unsigned int segments,
+                                                 LengthIterator segment_lengths,
+                                                 unsigned int begin_bit = 0,
+                                                 unsigned int end_bit = 8 * sizeof(Key),
+                                                 hipStream_t stream = 0,
+                                                 bool debug_synchronous = false)
+{
+    return detail::segment_lengths_to_offsets(
+        temporary_storage, storage_size,
+        segment_lengths, segments,
+        [&](void* storage, size_t& bytes, auto begin_offsets, auto end_offsets)
+        {
+            bool ignored;
+            return detail::segmented_radix_sort_impl<Config, false, FloatOrder,
+                                                     identity_decomposer>(
+                storage, bytes,
+                keys_input, nullptr, keys_output,
+                values_input, nullptr, values_output,
+                size, ignored,
+                segments, begin_offsets, end_offsets,
+                begin_bit, end_bit,
+                stream, debug_synchronous
+            );
+        },
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel descending segmented radix sort-by-key primitive for device level, the
+/// segments are given by their lengths, see \p segmented_radix_sort_pairs_desc and
+/// \p segmented_radix_sort_keys_by_lengths.
+template<
+    class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class LengthIterator,
+    class Key = typename std::iterator_traits<KeysInputIterator>::value_type
+>
+inline
+hipError_t segmented_radix_sort_pairs_desc_by_lengths(void * temporary_storage,
+                                                      size_t& storage_size,
+                                                      KeysInputIterator keys_input,
+                                                      KeysOutputIterator keys_output,
+                                                      ValuesInputIterator values_input,
+                                                      ValuesOutputIterator values_output,
+                                                      size_t size,
+                                                      unsigned int segments,
+                                                      LengthIterator segment_lengths,
+                                                      unsigned int begin_bit = 0,
+                                                      unsigned int end_bit = 8 * sizeof(Key),
+                                                      hipStream_t stream = 0,
+                                                      bool debug_synchronous = false)
+{
+    return detail::segment_lengths_to_offsets(
+        temporary_storage, storage_size,
+        segment_lengths, segments,
+        [&](void* storage, size_t& bytes, auto begin_offsets, auto end_offsets)
+        {
+            bool ignored;
+            return detail::segmented_radix_sort_impl<Config, true, FloatOrder,
+                                                     identity_decomposer>(
+                storage, bytes,
+                keys_input, nullptr, keys_output,
+                values_input, nullptr, values_output,
+                size, ignored,
+                segments, begin_offsets, end_offsets,
+                begin_bit, end_bit,
+                stream, debug_synchronous
+            );
+        },
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel ascending radix sort primitive for device level.
+///
+/// \p segmented_radix_sort_keys function performs a device-wide radix sort across multiple,
+/// non-overlapping sequences of keys. Function sorts input keys in ascending order.
+///
+/// \par Overview
+/// * The contents of both buffers of \p keys may be altered by the sorting function.
+/// * \p current() of \p keys is used as the input.
+/// * The function will update \p current() of \p keys to point to the buffer
+/// that contains the output range.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * The function requires small \p temporary_storage as it does not need
+/// a temporary buffer of \p size elements.
+/// * \p Key type must be an arithmetic type (that is, an integral type or a floating-point
+/// type).
+/// * Buffers of \p keys must have at least \p size elements.
+/// * Ranges specified by \p begin_offsets and \p end_offsets must have
+/// at least \p segments elements. They may use the same sequence <tt>offsets</tt> of at least
+/// <tt>segments + 1</tt> elements: <tt>offsets</tt> for \p begin_offsets and
+/// <tt>offsets + 1</tt> for \p end_offsets.
+/// * If \p Key is an integer type and the range of keys is known in advance, the performance
+/// can be improved by setting \p begin_bit and \p end_bit, for example if all keys are in range
+/// [100, 10000], <tt>begin_bit = 0</tt> and <tt>end_bit = 14</tt> will cover the whole range.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// \p segmented_radix_sort_config or a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
+/// \tparam Key - key type. Must be an integral type or a floating-point type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in,out] keys - reference to the double-buffer of keys, its \p current()
+/// contains the input range and will be updated to point to the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+/// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+/// Non-default value not supported for floating-point key-types.
+/// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+/// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
 /// value: \p <tt>8 * sizeof(Key)</tt>. Non-default value not supported for floating-point key-types.
 /// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
 /// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
@@ -1185,6 +2053,7 @@ hipError_t segmented_radix_sort_pairs_desc(void * temporary_storage,
 /// \endparblock
 template<
     class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
     class Key,
     class OffsetIterator
 >
@@ -1192,7 +2061,7 @@ inline
 hipError_t segmented_radix_sort_keys(void * temporary_storage,
                                      size_t& storage_size,
                                      double_buffer<Key>& keys,
-                                     unsigned int size,
+                                     size_t size,
                                      unsigned int segments,
                                      OffsetIterator begin_offsets,
                                      OffsetIterator end_offsets,
@@ -1203,7 +2072,7 @@ hipError_t segmented_radix_sort_keys(void * temporary_storage,
 {
     empty_type * values = nullptr;
     bool is_result_in_output;
-    hipError_t error = detail::segmented_radix_sort_impl<Config, false>(
+    hipError_t error = detail::segmented_radix_sort_impl<Config, false, FloatOrder, identity_decomposer>(
         temporary_storage, storage_size,
         keys.current(), keys.current(), keys.alternate(),
         values, values, values,
@@ -1246,6 +2115,8 @@ hipError_t segmented_radix_sort_keys(void * temporary_storage,
 ///
 /// \tparam Config - [optional] configuration of the primitive. It can be
 /// \p segmented_radix_sort_config or a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
 /// \tparam Key - key type. Must be an integral type or a floating-point type.
 /// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
 /// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
@@ -1313,6 +2184,7 @@ hipError_t segmented_radix_sort_keys(void * temporary_storage,
 /// \endparblock
 template<
     class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
     class Key,
     class OffsetIterator
 >
@@ -1320,7 +2192,7 @@ inline
 hipError_t segmented_radix_sort_keys_desc(void * temporary_storage,
                                           size_t& storage_size,
                                           double_buffer<Key>& keys,
-                                          unsigned int size,
+                                          size_t size,
                                           unsigned int segments,
                                           OffsetIterator begin_offsets,
                                           OffsetIterator end_offsets,
@@ -1331,7 +2203,7 @@ hipError_t segmented_radix_sort_keys_desc(void * temporary_storage,
 {
     empty_type * values = nullptr;
     bool is_result_in_output;
-    hipError_t error = detail::segmented_radix_sort_impl<Config, true>(
+    hipError_t error = detail::segmented_radix_sort_impl<Config, true, FloatOrder, identity_decomposer>(
         temporary_storage, storage_size,
         keys.current(), keys.current(), keys.alternate(),
         values, values, values,
@@ -1374,6 +2246,8 @@ hipError_t segmented_radix_sort_keys_desc(void * temporary_storage,
 ///
 /// \tparam Config - [optional] configuration of the primitive. It can be
 /// \p segmented_radix_sort_config or a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
 /// \tparam Key - key type. Must be an integral type or a floating-point type.
 /// \tparam Value - value type.
 /// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
@@ -1454,6 +2328,7 @@ hipError_t segmented_radix_sort_keys_desc(void * temporary_storage,
 /// \endparblock
 template<
     class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
     class Key,
     class Value,
     class OffsetIterator
@@ -1463,7 +2338,7 @@ hipError_t segmented_radix_sort_pairs(void * temporary_storage,
                                       size_t& storage_size,
                                       double_buffer<Key>& keys,
                                       double_buffer<Value>& values,
-                                      unsigned int size,
+                                      size_t size,
                                       unsigned int segments,
                                       OffsetIterator begin_offsets,
                                       OffsetIterator end_offsets,
@@ -1473,7 +2348,7 @@ hipError_t segmented_radix_sort_pairs(void * temporary_storage,
                                       bool debug_synchronous = false)
 {
     bool is_result_in_output;
-    hipError_t error = detail::segmented_radix_sort_impl<Config, false>(
+    hipError_t error = detail::segmented_radix_sort_impl<Config, false, FloatOrder, identity_decomposer>(
         temporary_storage, storage_size,
         keys.current(), keys.current(), keys.alternate(),
         values.current(), values.current(), values.alternate(),
@@ -1517,6 +2392,8 @@ hipError_t segmented_radix_sort_pairs(void * temporary_storage,
 ///
 /// \tparam Config - [optional] configuration of the primitive. It can be
 /// \p segmented_radix_sort_config or a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
 /// \tparam Key - key type. Must be an integral type or a floating-point type.
 /// \tparam Value - value type.
 /// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
@@ -1591,6 +2468,7 @@ hipError_t segmented_radix_sort_pairs(void * temporary_storage,
 /// \endparblock
 template<
     class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
     class Key,
     class Value,
     class OffsetIterator
@@ -1600,7 +2478,7 @@ hipError_t segmented_radix_sort_pairs_desc(void * temporary_storage,
                                            size_t& storage_size,
                                            double_buffer<Key>& keys,
                                            double_buffer<Value>& values,
-                                           unsigned int size,
+                                           size_t size,
                                            unsigned int segments,
                                            OffsetIterator begin_offsets,
                                            OffsetIterator end_offsets,
@@ -1610,7 +2488,7 @@ hipError_t segmented_radix_sort_pairs_desc(void * temporary_storage,
                                            bool debug_synchronous = false)
 {
     bool is_result_in_output;
-    hipError_t error = detail::segmented_radix_sort_impl<Config, true>(
+    hipError_t error = detail::segmented_radix_sort_impl<Config, true, FloatOrder, identity_decomposer>(
         temporary_storage, storage_size,
         keys.current(), keys.current(), keys.alternate(),
         values.current(), values.current(), values.alternate(),
@@ -1627,6 +2505,657 @@ hipError_t segmented_radix_sort_pairs_desc(void * temporary_storage,
     return error;
 }
 
+/// \brief Parallel ascending radix sort primitive for device level, for keys that are
+/// decomposed into their fields.
+///
+/// \p segmented_radix_sort_keys function performs a device-wide radix sort across multiple,
+/// non-overlapping sequences of keys.
+/// Keys are ordered by the fields returned by \p decomposer in ascending order, the first field
+/// is the most significant one. This overload sorts all bits of the fields.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the sorting function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * \p decomposer must be a default-constructible class, see \p identity_decomposer. It is
+/// constructed again in device code, so it must not hold any state.
+/// * Ranges specified by \p keys_input and \p keys_output must have at least \p size elements.
+/// * Ranges specified by \p begin_offsets and \p end_offsets must have
+/// at least \p segments elements.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p segmented_radix_sort_config or
+/// a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point fields, see \p radix_float_order.
+/// \tparam Decomposer - type of the decomposer of keys into their fields.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] decomposer - decomposer of keys into a \p rocprim::tuple of references to their fields.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class OffsetIterator,
+    class Decomposer,
+    class Key = typename std::iterator_traits<KeysInputIterator>::value_type
+>
+inline
+auto segmented_radix_sort_keys(void * temporary_storage,
+                               size_t& storage_size,
+                               KeysInputIterator keys_input,
+                               KeysOutputIterator keys_output,
+                               size_t size,
+                               unsigned int segments,
+                               OffsetIterator begin_offsets,
+                               OffsetIterator end_offsets,
+                               Decomposer decomposer,
+                               hipStream_t stream = 0,
+                               bool debug_synchronous = false)
+    -> typename std::enable_if<!std::is_integral<Decomposer>::value, hipError_t>::type
+{
+    // The decomposer is stateless, it is constructed again in device code
+    (void)decomposer;
+    empty_type * values = nullptr;
+    bool ignored;
+    return detail::segmented_radix_sort_impl<Config, false, FloatOrder, Decomposer>(
+        temporary_storage, storage_size,
+        keys_input, nullptr, keys_output,
+        values, nullptr, values,
+        size, ignored,
+        segments, begin_offsets, end_offsets,
+        0, detail::radix_key_codec<Key, false, FloatOrder, Decomposer>::key_bits,
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel descending radix sort primitive for device level, for keys that are
+/// decomposed into their fields.
+///
+/// \p segmented_radix_sort_keys_desc function performs a device-wide radix sort across multiple,
+/// non-overlapping sequences of keys.
+/// Keys are ordered by the fields returned by \p decomposer in descending order, the first field
+/// is the most significant one. This overload sorts all bits of the fields.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the sorting function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * \p decomposer must be a default-constructible class, see \p identity_decomposer. It is
+/// constructed again in device code, so it must not hold any state.
+/// * Ranges specified by \p keys_input and \p keys_output must have at least \p size elements.
+/// * Ranges specified by \p begin_offsets and \p end_offsets must have
+/// at least \p segments elements.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p segmented_radix_sort_config or
+/// a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point fields, see \p radix_float_order.
+/// \tparam Decomposer - type of the decomposer of keys into their fields.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] decomposer - decomposer of keys into a \p rocprim::tuple of references to their fields.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class OffsetIterator,
+    class Decomposer,
+    class Key = typename std::iterator_traits<KeysInputIterator>::value_type
+>
+inline
+auto segmented_radix_sort_keys_desc(void * temporary_storage,
+                                    size_t& storage_size,
+                                    KeysInputIterator keys_input,
+                                    KeysOutputIterator keys_output,
+                                    size_t size,
+                                    unsigned int segments,
+                                    OffsetIterator begin_offsets,
+                                    OffsetIterator end_offsets,
+                                    Decomposer decomposer,
+                                    hipStream_t stream = 0,
+                                    bool debug_synchronous = false)
+    -> typename std::enable_if<!std::is_integral<Decomposer>::value, hipError_t>::type
+{
+    // The decomposer is stateless, it is constructed again in device code
+    (void)decomposer;
+    empty_type * values = nullptr;
+    bool ignored;
+    return detail::segmented_radix_sort_impl<Config, true, FloatOrder, Decomposer>(
+        temporary_storage, storage_size,
+        keys_input, nullptr, keys_output,
+        values, nullptr, values,
+        size, ignored,
+        segments, begin_offsets, end_offsets,
+        0, detail::radix_key_codec<Key, false, FloatOrder, Decomposer>::key_bits,
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel ascending radix sort-by-key primitive for device level, for keys that are
+/// decomposed into their fields.
+///
+/// \p segmented_radix_sort_pairs function performs a device-wide radix sort across multiple,
+/// non-overlapping sequences of (key, value) pairs.
+/// Keys are ordered by the fields returned by \p decomposer in ascending order, the first field
+/// is the most significant one. This overload sorts all bits of the fields.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the sorting function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * \p decomposer must be a default-constructible class, see \p identity_decomposer. It is
+/// constructed again in device code, so it must not hold any state.
+/// * Ranges specified by \p keys_input, \p keys_output, \p values_input and \p values_output must
+/// have at least \p size elements.
+/// * Ranges specified by \p begin_offsets and \p end_offsets must have
+/// at least \p segments elements.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p segmented_radix_sort_config or
+/// a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point fields, see \p radix_float_order.
+/// \tparam Decomposer - type of the decomposer of keys into their fields.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] values_input - pointer to the first element in the range to sort.
+/// \param [out] values_output - pointer to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] decomposer - decomposer of keys into a \p rocprim::tuple of references to their fields.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class OffsetIterator,
+    class Decomposer,
+    class Key = typename std::iterator_traits<KeysInputIterator>::value_type
+>
+inline
+auto segmented_radix_sort_pairs(void * temporary_storage,
+                                size_t& storage_size,
+                                KeysInputIterator keys_input,
+                                KeysOutputIterator keys_output,
+                                ValuesInputIterator values_input,
+                                ValuesOutputIterator values_output,
+                                size_t size,
+                                unsigned int segments,
+                                OffsetIterator begin_offsets,
+                                OffsetIterator end_offsets,
+                                Decomposer decomposer,
+                                hipStream_t stream = 0,
+                                bool debug_synchronous = false)
+    -> typename std::enable_if<!std::is_integral<Decomposer>::value, hipError_t>::type
+{
+    // The decomposer is stateless, it is constructed again in device code
+    (void)decomposer;
+    bool ignored;
+    return detail::segmented_radix_sort_impl<Config, false, FloatOrder, Decomposer>(
+        temporary_storage, storage_size,
+        keys_input, nullptr, keys_output,
+        values_input, nullptr, values_output,
+        size, ignored,
+        segments, begin_offsets, end_offsets,
+        0, detail::radix_key_codec<Key, false, FloatOrder, Decomposer>::key_bits,
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel descending radix sort-by-key primitive for device level, for keys that are
+/// decomposed into their fields.
+///
+/// \p segmented_radix_sort_pairs_desc function performs a device-wide radix sort across multiple,
+/// non-overlapping sequences of (key, value) pairs.
+/// Keys are ordered by the fields returned by \p decomposer in descending order, the first field
+/// is the most significant one. This overload sorts all bits of the fields.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the sorting function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * \p decomposer must be a default-constructible class, see \p identity_decomposer. It is
+/// constructed again in device code, so it must not hold any state.
+/// * Ranges specified by \p keys_input, \p keys_output, \p values_input and \p values_output must
+/// have at least \p size elements.
+/// * Ranges specified by \p begin_offsets and \p end_offsets must have
+/// at least \p segments elements.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p segmented_radix_sort_config or
+/// a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point fields, see \p radix_float_order.
+/// \tparam Decomposer - type of the decomposer of keys into their fields.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] values_input - pointer to the first element in the range to sort.
+/// \param [out] values_output - pointer to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] decomposer - decomposer of keys into a \p rocprim::tuple of references to their fields.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class OffsetIterator,
+    class Decomposer,
+    class Key = typename std::iterator_traits<KeysInputIterator>::value_type
+>
+inline
+auto segmented_radix_sort_pairs_desc(void * temporary_storage,
+                                     size_t& storage_size,
+                                     KeysInputIterator keys_input,
+                                     KeysOutputIterator keys_output,
+                                     ValuesInputIterator values_input,
+                                     ValuesOutputIterator values_output,
+                                     size_t size,
+                                     unsigned int segments,
+                                     OffsetIterator begin_offsets,
+                                     OffsetIterator end_offsets,
+                                     Decomposer decomposer,
+                                     hipStream_t stream = 0,
+                                     bool debug_synchronous = false)
+    -> typename std::enable_if<!std::is_integral<Decomposer>::value, hipError_t>::type
+{
+    // The decomposer is stateless, it is constructed again in device code
+    (void)decomposer;
+    bool ignored;
+    return detail::segmented_radix_sort_impl<Config, true, FloatOrder, Decomposer>(
+        temporary_storage, storage_size,
+        keys_input, nullptr, keys_output,
+        values_input, nullptr, values_output,
+        size, ignored,
+        segments, begin_offsets, end_offsets,
+        0, detail::radix_key_codec<Key, false, FloatOrder, Decomposer>::key_bits,
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel ascending radix sort primitive for device level of segments of the same size.
+///
+/// \p segmented_radix_sort_keys_fixed function performs a device-wide radix sort across multiple,
+/// non-overlapping sequences of keys that all have \p segment_size keys. Function sorts input
+/// keys in ascending order.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the sorting function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * \p Key type (a \p value_type of \p KeysInputIterator and \p KeysOutputIterator) must be
+/// an arithmetic type (that is, an integral type or a floating-point type).
+/// * Ranges specified by \p keys_input and \p keys_output must have at least
+/// <tt>segment_size * segments</tt> elements, which must fit into <tt>unsigned int</tt>.
+/// * Offsets of segments are computed from \p segment_size, so unlike \p segmented_radix_sort_keys
+/// no offsets are read and segments are not partitioned by their sizes: all segments are sorted
+/// by one kernel, selected by \p segment_size from the warp sorts and the block sort of \p Config.
+/// Temporary storage for keys is only needed for segments longer than one block sort.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// \p segmented_radix_sort_config or a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] segment_size - number of elements in every segment.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+/// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+/// Non-default value not supported for floating-point key-types.
+/// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+/// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+/// value: \p <tt>8 * sizeof(Key)</tt>. Non-default value not supported for floating-point key-types.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level ascending radix sort is performed on rows of 4
+/// \p float values.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// float * input;              // e.g., [0.6, 0.3, 0.65, 0.4, 0.2, 0.08, 1, 0.7]
+/// float * output;             // empty array of 8 elements
+/// unsigned int segment_size;  // e.g., 4
+/// unsigned int segments;      // e.g., 2
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::segmented_radix_sort_keys_fixed(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, segment_size, segments
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform sort
+/// rocprim::segmented_radix_sort_keys_fixed(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, segment_size, segments
+/// );
+/// // keys_output: [0.3, 0.4, 0.6, 0.65, 0.08, 0.2, 0.7, 1]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class Key = typename std::iterator_traits<KeysInputIterator>::value_type
+>
+inline
+hipError_t segmented_radix_sort_keys_fixed(void * temporary_storage,
+                                           size_t& storage_size,
+                                           KeysInputIterator keys_input,
+                                           KeysOutputIterator keys_output,
+                                           unsigned int segment_size,
+                                           unsigned int segments,
+                                           unsigned int begin_bit = 0,
+                                           unsigned int end_bit = 8 * sizeof(Key),
+                                           hipStream_t stream = 0,
+                                           bool debug_synchronous = false)
+{
+    empty_type * values = nullptr;
+    return detail::segmented_radix_sort_fixed_impl<Config, false, FloatOrder, identity_decomposer>(
+        temporary_storage, storage_size,
+        keys_input, keys_output,
+        values, values,
+        segment_size, segments,
+        begin_bit, end_bit,
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel descending radix sort primitive for device level of segments of the same size.
+///
+/// \p segmented_radix_sort_keys_fixed_desc function performs a device-wide radix sort across
+/// multiple, non-overlapping sequences of keys that all have \p segment_size keys. Function sorts
+/// input keys in descending order. See \p segmented_radix_sort_keys_fixed.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// \p segmented_radix_sort_config or a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] segment_size - number of elements in every segment.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+/// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+/// Non-default value not supported for floating-point key-types.
+/// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+/// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+/// value: \p <tt>8 * sizeof(Key)</tt>. Non-default value not supported for floating-point key-types.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class Key = typename std::iterator_traits<KeysInputIterator>::value_type
+>
+inline
+hipError_t segmented_radix_sort_keys_fixed_desc(void * temporary_storage,
+                                                size_t& storage_size,
+                                                KeysInputIterator keys_input,
+                                                KeysOutputIterator keys_output,
+                                                unsigned int segment_size,
+                                                unsigned int segments,
+                                                unsigned int begin_bit = 0,
+                                                unsigned int end_bit = 8 * sizeof(Key),
+                                                hipStream_t stream = 0,
+                                                bool debug_synchronous = false)
+{
+    empty_type * values = nullptr;
+    return detail::segmented_radix_sort_fixed_impl<Config, true, FloatOrder, identity_decomposer>(
+        temporary_storage, storage_size,
+        keys_input, keys_output,
+        values, values,
+        segment_size, segments,
+        begin_bit, end_bit,
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel ascending radix sort-by-key primitive for device level of segments of the
+/// same size.
+///
+/// \p segmented_radix_sort_pairs_fixed function performs a device-wide radix sort across
+/// multiple, non-overlapping sequences of (key, value) pairs that all have \p segment_size pairs.
+/// Function sorts input pairs in ascending order of keys. See \p segmented_radix_sort_keys_fixed.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// \p segmented_radix_sort_config or a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] values_input - pointer to the first element in the range to sort.
+/// \param [out] values_output - pointer to the first element in the output range.
+/// \param [in] segment_size - number of elements in every segment.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+/// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+/// Non-default value not supported for floating-point key-types.
+/// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+/// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+/// value: \p <tt>8 * sizeof(Key)</tt>. Non-default value not supported for floating-point key-types.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class Key = typename std::iterator_traits<KeysInputIterator>::value_type
+>
+inline
+hipError_t segmented_radix_sort_pairs_fixed(void * temporary_storage,
+                                            size_t& storage_size,
+                                            KeysInputIterator keys_input,
+                                            KeysOutputIterator keys_output,
+                                            ValuesInputIterator values_input,
+                                            ValuesOutputIterator values_output,
+                                            unsigned int segment_size,
+                                            unsigned int segments,
+                                            unsigned int begin_bit = 0,
+                                            unsigned int end_bit = 8 * sizeof(Key),
+                                            hipStream_t stream = 0,
+                                            bool debug_synchronous = false)
+{
+    return detail::segmented_radix_sort_fixed_impl<Config, false, FloatOrder, identity_decomposer>(
+        temporary_storage, storage_size,
+        keys_input, keys_output,
+        values_input, values_output,
+        segment_size, segments,
+        begin_bit, end_bit,
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel descending radix sort-by-key primitive for device level of segments of the
+/// same size.
+///
+/// \p segmented_radix_sort_pairs_fixed_desc function performs a device-wide radix sort across
+/// multiple, non-overlapping sequences of (key, value) pairs that all have \p segment_size pairs.
+/// Function sorts input pairs in descending order of keys. See \p segmented_radix_sort_keys_fixed.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// \p segmented_radix_sort_config or a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] values_input - pointer to the first element in the range to sort.
+/// \param [out] values_output - pointer to the first element in the output range.
+/// \param [in] segment_size - number of elements in every segment.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+/// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+/// Non-default value not supported for floating-point key-types.
+/// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+/// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+/// value: \p <tt>8 * sizeof(Key)</tt>. Non-default value not supported for floating-point key-types.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class Key = typename std::iterator_traits<KeysInputIterator>::value_type
+>
+inline
+hipError_t segmented_radix_sort_pairs_fixed_desc(void * temporary_storage,
+                                                 size_t& storage_size,
+                                                 KeysInputIterator keys_input,
+                                                 KeysOutputIterator keys_output,
+                                                 ValuesInputIterator values_input,
+                                                 ValuesOutputIterator values_output,
+                                                 unsigned int segment_size,
+                                                 unsigned int segments,
+                                                 unsigned int begin_bit = 0,
+                                                 unsigned int end_bit = 8 * sizeof(Key),
+                                                 hipStream_t stream = 0,
+                                                 bool debug_synchronous = false)
+{
+    return detail::segmented_radix_sort_fixed_impl<Config, true, FloatOrder, identity_decomposer>(
+        temporary_storage, storage_size,
+        keys_input, keys_output,
+        values_input, values_output,
+        segment_size, segments,
+        begin_bit, end_bit,
+        stream, debug_synchronous
+    );
+}
+
 END_ROCPRIM_NAMESPACE
 
 /// @}
@@ -36,7 +36,8 @@
 BEGIN_ROCPRIM_NAMESPACE
 
 /// \brief Configuration of the warp sort part of the device segmented radix sort operation.
-/// Short enough segments are processed on warp level.
+/// Short enough segments are processed on warp level with \p warp_merge_sort, which sorts
+/// only the items of the segment, so the numbers of items per thread need not be powers of two.
 ///
 /// \tparam LogicalWarpSizeSmall - number of threads in the logical warp of the kernel
 /// that processes small segments.
@@ -53,6 +54,9 @@ BEGIN_ROCPRIM_NAMESPACE
 /// \tparam ItemsPerThreadMedium - number of items processed by a thread in the kernel that processes
 /// medium segments.
 /// \tparam BlockSizeMedium - number of threads per block in the kernel which processes the medium segments.
+/// \tparam UseRadixSortSmall - if set to \p true, the small segments are sorted by
+/// \p warp_radix_sort instead of \p warp_merge_sort. It needs fewer instructions for integer keys
+/// when the small segments are long, but more shared memory.
 template<unsigned int LogicalWarpSizeSmall,
          unsigned int ItemsPerThreadSmall,
          unsigned int BlockSizeSmall              = 256,
@@ -60,7 +64,8 @@ template<unsigned int LogicalWarpSizeSmall,
          bool         EnableUnpartitionedWarpSort = true,
          unsigned int LogicalWarpSizeMedium       = std::max(32u, LogicalWarpSizeSmall),
          unsigned int ItemsPerThreadMedium        = std::max(4u, ItemsPerThreadSmall),
-         unsigned int BlockSizeMedium             = 256>
+         unsigned int BlockSizeMedium             = 256,
+         bool         UseRadixSortSmall           = false>
 struct WarpSortConfig
 {
     static_assert(LogicalWarpSizeSmall * ItemsPerThreadSmall
@@ -85,6 +90,8 @@ struct WarpSortConfig
     static constexpr unsigned int items_per_thread_medium = ItemsPerThreadMedium;
     /// \brief The number of threads per block in the medium segment processing kernel.
     static constexpr unsigned int block_size_medium = BlockSizeMedium;
+    /// \brief If set to \p true, the small segments are sorted by \p warp_radix_sort.
+    static constexpr bool use_radix_sort_small = UseRadixSortSmall;
 };
 
 /// \brief Indicates if the warp level sorting is disabled in the
@@ -109,6 +116,8 @@ struct DisabledWarpSortConfig
     static constexpr unsigned int items_per_thread_medium = 1;
     /// \brief The number of threads per block in the medium segment processing kernel.
     static constexpr unsigned int block_size_medium = 1;
+    /// \brief If set to \p true, the small segments are sorted by \p warp_radix_sort.
+    static constexpr bool use_radix_sort_small = false;
 };
 
 /// \brief Selects the appropriate \p WarpSortConfig based on the size of the key type.
@@ -141,15 +150,22 @@ using select_warp_sort_config_t
 /// If a segment's element count is low ( <= warp_sort_config::items_per_thread * warp_sort_config::logical_warp_size ),
 /// it is sorted by a special warp-level sorting method.
 ///
+/// If a segment's element count is higher than \p DeviceSortThreshold, it is sorted by the
+/// device-level radix sort, so all blocks of the device work on it instead of a single block.
+///
 /// \tparam LongRadixBits - number of bits in long iterations.
 /// \tparam ShortRadixBits - number of bits in short iterations, must be equal to or less than \p LongRadixBits.
 /// \tparam SortConfig - configuration of radix sort kernel. Must be \p kernel_config.
 /// \tparam WarpSortConfig - configuration of the warp sort that is used on the short segments.
+/// \tparam DeviceSortThreshold - segments with more elements are sorted one by one by the
+/// device-level radix sort. Finding such segments synchronizes the stream once. \p 0 disables
+/// the device-level sort of segments.
 template<
     unsigned int LongRadixBits,
     unsigned int ShortRadixBits,
     class SortConfig,
-    class WarpSortConfig = DisabledWarpSortConfig
+    class WarpSortConfig = DisabledWarpSortConfig,
+    unsigned int DeviceSortThreshold = (1u << 22)
 >
 struct segmented_radix_sort_config
 {
@@ -161,196 +177,28 @@ struct segmented_radix_sort_config
     using sort = SortConfig;
     /// \brief Configuration of the warp sort method.
     using warp_sort_config = WarpSortConfig;
+    /// \brief Segments with more elements are sorted by the device-level radix sort.
+    static constexpr unsigned int device_sort_threshold = DeviceSortThreshold;
 };
 
 namespace detail
 {
 
+// Default segmented radix sort configuration, the generated configurations derive from it when
+// the key and value types are not in the tuning benchmarks
 template<class Key, class Value>
-struct segmented_radix_sort_config_803
-{
-    static constexpr unsigned int item_scale =
-        ::rocprim::detail::ceiling_div<unsigned int>(::rocprim::max(sizeof(Key), sizeof(Value)), sizeof(int));
-
-    using type = select_type<
-        select_type_case<
-            (sizeof(Key) == 1 && sizeof(Value) <= 8),
-            segmented_radix_sort_config<8, 7, kernel_config<256, 10>, select_warp_sort_config_t<Key> >
-        >,
-        select_type_case<
-            (sizeof(Key) == 2 && sizeof(Value) <= 8),
-            segmented_radix_sort_config<8, 7, kernel_config<256, 10>, select_warp_sort_config_t<Key> >
-        >,
-        select_type_case<
-            (sizeof(Key) == 4 && sizeof(Value) <= 8),
-            segmented_radix_sort_config<7, 6, kernel_config<256, 15>, select_warp_sort_config_t<Key> >
-        >,
-        select_type_case<
-            (sizeof(Key) == 8 && sizeof(Value) <= 8),
-            segmented_radix_sort_config<7, 6, kernel_config<256, 13>, select_warp_sort_config_t<Key> >
-        >,
-        segmented_radix_sort_config<7, 6, kernel_config<256, ::rocprim::max(1u, 15u / item_scale)>, select_warp_sort_config_t<Key> >
-    >;
-};
-
-template<class Key>
-struct segmented_radix_sort_config_803<Key, empty_type>
-    : select_type<
-        select_type_case<sizeof(Key) == 1, segmented_radix_sort_config<8, 7, kernel_config<256, 10>, select_warp_sort_config_t<Key> > >,
-        select_type_case<sizeof(Key) == 2, segmented_radix_sort_config<8, 7, kernel_config<256, 10>, select_warp_sort_config_t<Key> > >,
-        select_type_case<sizeof(Key) == 4, segmented_radix_sort_config<7, 6, kernel_config<256, 9>, select_warp_sort_config_t<Key> > >,
-        select_type_case<sizeof(Key) == 8, segmented_radix_sort_config<7, 6, kernel_config<256, 7>, select_warp_sort_config_t<Key> > >
-    > { };
-
-template<class Key, class Value>
-struct segmented_radix_sort_config_900
-{
-    static constexpr unsigned int item_scale =
-        ::rocprim::detail::ceiling_div<unsigned int>(::rocprim::max(sizeof(Key), sizeof(Value)), sizeof(int));
-
-    using type = select_type<
-        select_type_case<
-            (sizeof(Key) == 1 && sizeof(Value) <= 8),
-            segmented_radix_sort_config<4, 4, kernel_config<256, 10>, select_warp_sort_config_t<Key> >
-        >,
-        select_type_case<
-            (sizeof(Key) == 2 && sizeof(Value) <= 8),
-            segmented_radix_sort_config<6, 5, kernel_config<256, 10>, select_warp_sort_config_t<Key> >
-        >,
-        select_type_case<
-            (sizeof(Key) == 4 && sizeof(Value) <= 8),
-            segmented_radix_sort_config<7, 6, kernel_config<256, 15>, select_warp_sort_config_t<Key> >
-        >,
-        select_type_case<
-            (sizeof(Key) == 8 && sizeof(Value) <= 8),
-            segmented_radix_sort_config<7, 6, kernel_config<256, 15>, select_warp_sort_config_t<Key> >
-        >,
-        segmented_radix_sort_config<7, 6, kernel_config<256, ::rocprim::max(1u, 15u / item_scale)>, select_warp_sort_config_t<Key> >
-    >;
-};
-
-template<class Key>
-struct segmented_radix_sort_config_900<Key, empty_type>
-    : select_type<
-        select_type_case<sizeof(Key) == 1, segmented_radix_sort_config<4, 3, kernel_config<256, 10>, select_warp_sort_config_t<Key> > >,
-        select_type_case<sizeof(Key) == 2, segmented_radix_sort_config<6, 5, kernel_config<256, 10>, select_warp_sort_config_t<Key> > >,
-        select_type_case<sizeof(Key) == 4, segmented_radix_sort_config<7, 6, kernel_config<256, 17>, select_warp_sort_config_t<Key> > >,
-        select_type_case<sizeof(Key) == 8, segmented_radix_sort_config<7, 6, kernel_config<256, 15>, select_warp_sort_config_t<Key> > >
-    > { };
-
-template<class Key, class Value>
-struct segmented_radix_sort_config_90a
-{
-    static constexpr unsigned int item_scale =
-        ::rocprim::detail::ceiling_div<unsigned int>(::rocprim::max(sizeof(Key), sizeof(Value)), sizeof(int));
-
-    using type = select_type<
-        select_type_case<
-            (sizeof(Key) == 1 && sizeof(Value) <= 8),
-            segmented_radix_sort_config<4,
-                                        4,
-                                        kernel_config<256, 10>,
-                                        select_warp_sort_config_t<Key, ROCPRIM_WARP_SIZE_64>>>,
-        select_type_case<
-            (sizeof(Key) == 2 && sizeof(Value) <= 8),
-            segmented_radix_sort_config<6,
-                                        5,
-                                        kernel_config<256, 10>,
-                                        select_warp_sort_config_t<Key, ROCPRIM_WARP_SIZE_64>>>,
-        select_type_case<
-            (sizeof(Key) == 4 && sizeof(Value) <= 8),
-            segmented_radix_sort_config<7,
-                                        6,
-                                        kernel_config<256, 15>,
-                                        select_warp_sort_config_t<Key, ROCPRIM_WARP_SIZE_64>>>,
-        select_type_case<
-            (sizeof(Key) == 8 && sizeof(Value) <= 8),
-            segmented_radix_sort_config<7,
-                                        6,
-                                        kernel_config<256, 15>,
-                                        select_warp_sort_config_t<Key, ROCPRIM_WARP_SIZE_64>>>,
-        segmented_radix_sort_config<7,
-                                    6,
-                                    kernel_config<256, ::rocprim::max(1u, 15u / item_scale)>,
-                                    select_warp_sort_config_t<Key, ROCPRIM_WARP_SIZE_64>>>;
-};
-
-template<class Key>
-struct segmented_radix_sort_config_90a<Key, empty_type>
-    : select_type<
-          select_type_case<
-              sizeof(Key) == 1,
-              segmented_radix_sort_config<4,
-                                          3,
-                                          kernel_config<256, 10>,
-                                          select_warp_sort_config_t<Key, ROCPRIM_WARP_SIZE_64>>>,
-          select_type_case<
-              sizeof(Key) == 2,
-              segmented_radix_sort_config<6,
-                                          5,
-                                          kernel_config<256, 10>,
-                                          select_warp_sort_config_t<Key, ROCPRIM_WARP_SIZE_64>>>,
-          select_type_case<
-              sizeof(Key) == 4,
-              segmented_radix_sort_config<7,
-                                          6,
-                                          kernel_config<256, 17>,
-                                          select_warp_sort_config_t<Key, ROCPRIM_WARP_SIZE_64>>>,
-          select_type_case<
-              sizeof(Key) == 8,
-              segmented_radix_sort_config<7,
-                                          6,
-                                          kernel_config<256, 15>,
-                                          select_warp_sort_config_t<Key, ROCPRIM_WARP_SIZE_64>>>>
-{};
-
-template<class Key, class Value>
-struct segmented_radix_sort_config_1030
-{
-    static constexpr unsigned int item_scale =
-        ::rocprim::detail::ceiling_div<unsigned int>(::rocprim::max(sizeof(Key), sizeof(Value)), sizeof(int));
-
-    using type = select_type<
-        select_type_case<
-            (sizeof(Key) == 1 && sizeof(Value) <= 8),
-            segmented_radix_sort_config<4, 4, kernel_config<256, 10>, select_warp_sort_config_t<Key> >
-        >,
-        select_type_case<
-            (sizeof(Key) == 2 && sizeof(Value) <= 8),
-            segmented_radix_sort_config<6, 5, kernel_config<256, 10>, select_warp_sort_config_t<Key> >
-        >,
-        select_type_case<
-            (sizeof(Key) == 4 && sizeof(Value) <= 8),
-            segmented_radix_sort_config<7, 6, kernel_config<256, 15>, select_warp_sort_config_t<Key> >
-        >,
-        select_type_case<
-            (sizeof(Key) == 8 && sizeof(Value) <= 8),
-            segmented_radix_sort_config<7, 6, kernel_config<256, 15>, select_warp_sort_config_t<Key> >
-        >,
-        segmented_radix_sort_config<7, 6, kernel_config<256, ::rocprim::max(1u, 15u / item_scale)>, select_warp_sort_config_t<Key> >
-    >;
-};
-
-template<class Key>
-struct segmented_radix_sort_config_1030<Key, empty_type>
-    : select_type<
-        select_type_case<sizeof(Key) == 1, segmented_radix_sort_config<4, 3, kernel_config<256, 10>, select_warp_sort_config_t<Key> > >,
-        select_type_case<sizeof(Key) == 2, segmented_radix_sort_config<6, 5, kernel_config<256, 10>, select_warp_sort_config_t<Key> > >,
-        select_type_case<sizeof(Key) == 4, segmented_radix_sort_config<7, 6, kernel_config<256, 17>, select_warp_sort_config_t<Key> > >,
-        select_type_case<sizeof(Key) == 8, segmented_radix_sort_config<7, 6, kernel_config<256, 15>, select_warp_sort_config_t<Key> > >
-    > { };
-
-template<unsigned int TargetArch, class Key, class Value>
-struct default_segmented_radix_sort_config
-    : select_arch<
-          TargetArch,
-          select_arch_case<803, detail::segmented_radix_sort_config_803<Key, Value>>,
-          select_arch_case<900, detail::segmented_radix_sort_config_900<Key, Value>>,
-          select_arch_case<906, detail::segmented_radix_sort_config_90a<Key, Value>>,
-          select_arch_case<908, detail::segmented_radix_sort_config_90a<Key, Value>>,
-          select_arch_case<ROCPRIM_ARCH_90a, detail::segmented_radix_sort_config_90a<Key, Value>>,
-          select_arch_case<1030, detail::segmented_radix_sort_config_1030<Key, Value>>,
-          detail::segmented_radix_sort_config_900<Key, Value>>
+struct default_segmented_radix_sort_config_base
+    : segmented_radix_sort_config<
+          7,
+          6,
+          kernel_config<256,
+                        ::rocprim::max(1u,
+                                       15u
+                                           / static_cast<unsigned int>(
+                                               ::rocprim::detail::ceiling_div(
+                                                   ::rocprim::max(sizeof(Key), sizeof(Value)),
+                                                   sizeof(int))))>,
+          select_warp_sort_config_t<Key>>
 {};
 
 } // end namespace detail
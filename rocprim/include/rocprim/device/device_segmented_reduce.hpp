@@ -29,9 +29,16 @@
 #include "../functional.hpp"
 #include "../detail/various.hpp"
 #include "../detail/match_result_type.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../iterator/counting_iterator.hpp"
+#include "../iterator/transform_iterator.hpp"
 
 #include "detail/config/device_reduce.hpp"
+#include "detail/device_accumulator.hpp"
+#include "detail/device_segment_lengths.hpp"
 #include "detail/device_segmented_reduce.hpp"
+#include "device_scan.hpp"
+#include "instrumentation.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -62,10 +69,109 @@ ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().block_size) void segmen
     );
 }
 
+template<class Config,
+         class InputIterator,
+         class OutputIterator,
+         class OffsetIterator,
+         class ResultType,
+         class BinaryFunction>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().block_size) void segmented_reduce_warp_kernel(
+    InputIterator      input,
+    OutputIterator     output,
+    const unsigned int segments,
+    OffsetIterator     begin_offsets,
+    OffsetIterator     end_offsets,
+    BinaryFunction     reduce_op,
+    ResultType         initial_value)
+{
+    segmented_reduce_warp<Config>(
+        input, output, segments,
+        begin_offsets, end_offsets,
+        reduce_op, initial_value
+    );
+}
+
+template<class Config,
+         class InputIterator,
+         class OutputIterator,
+         class OffsetIterator,
+         class ResultType,
+         class BinaryFunction>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().block_size) void segmented_reduce_thread_kernel(
+    InputIterator      input,
+    OutputIterator     output,
+    const unsigned int segments,
+    OffsetIterator     begin_offsets,
+    OffsetIterator     end_offsets,
+    BinaryFunction     reduce_op,
+    ResultType         initial_value)
+{
+    segmented_reduce_thread<Config>(
+        input, output, segments,
+        begin_offsets, end_offsets,
+        reduce_op, initial_value
+    );
+}
+
+// Distance from the beginning of the first segment to the end of the last segment. It is the
+// total length of all segments when the offsets are sorted and the segments do not overlap.
+template<class OffsetIterator>
+ROCPRIM_KERNEL __launch_bounds__(1) void segmented_reduce_span_kernel(
+    OffsetIterator     begin_offsets,
+    OffsetIterator     end_offsets,
+    const unsigned int segments,
+    size_t*            span)
+{
+    const auto begin_offset = begin_offsets[0];
+    const auto end_offset   = end_offsets[segments - 1];
+    *span = end_offset > begin_offset ? static_cast<size_t>(end_offset - begin_offset) : 0;
+}
+
+template<class Config,
+         class InputIterator,
+         class OutputIterator,
+         class OffsetIterator,
+         class ResultType,
+         class BinaryFunction>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().block_size) void segmented_reduce_load_balanced_kernel(
+    InputIterator                       input,
+    OutputIterator                      output,
+    const unsigned int                  segments,
+    OffsetIterator                      begin_offsets,
+    OffsetIterator                      end_offsets,
+    const size_t*                       span,
+    segmented_reduce_carry<ResultType>* heads,
+    segmented_reduce_carry<ResultType>* tails,
+    BinaryFunction                      reduce_op,
+    ResultType                          initial_value)
+{
+    segmented_reduce_load_balanced<Config>(
+        input, output, segments,
+        begin_offsets, end_offsets,
+        span, heads, tails,
+        reduce_op, initial_value
+    );
+}
+
+template<unsigned int BlockSize, class OutputIterator, class ResultType, class BinaryFunction>
+ROCPRIM_KERNEL __launch_bounds__(BlockSize) void segmented_reduce_fixup_kernel(
+    OutputIterator                            output,
+    const segmented_reduce_carry<ResultType>* heads,
+    const segmented_reduce_carry<ResultType>* tails,
+    const unsigned int                        number_of_blocks,
+    BinaryFunction                            reduce_op,
+    ResultType                                initial_value)
+{
+    segmented_reduce_fixup<BlockSize>(
+        output, heads, tails, number_of_blocks, reduce_op, initial_value
+    );
+}
+
 #define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
     { \
         auto _error = hipGetLastError(); \
         if(_error != hipSuccess) return _error; \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
         if(debug_synchronous) \
         { \
             std::cout << name << "(" << size << ")"; \
@@ -77,6 +183,142 @@ ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().block_size) void segmen
         } \
     }
 
+// Every compute unit gets several blocks of the load-balanced algorithm
+constexpr unsigned int segmented_reduce_load_balanced_blocks_per_cu = 4;
+
+template<
+    class Config,
+    class InputIterator,
+    class OutputIterator,
+    class OffsetIterator,
+    class ResultType,
+    class BinaryFunction
+>
+inline
+hipError_t segmented_reduce_load_balanced_impl(void * temporary_storage,
+                                               size_t& storage_size,
+                                               InputIterator input,
+                                               OutputIterator output,
+                                               unsigned int segments,
+                                               OffsetIterator begin_offsets,
+                                               OffsetIterator end_offsets,
+                                               BinaryFunction reduce_op,
+                                               ResultType initial_value,
+                                               const reduce_config_params params,
+                                               hipStream_t stream,
+                                               bool debug_synchronous)
+{
+    using carry_type    = segmented_reduce_carry<ResultType>;
+    using carry_op_type = segmented_reduce_carry_op<ResultType, BinaryFunction>;
+
+    constexpr unsigned int fixup_block_size = 256;
+
+    const unsigned int block_size = params.block_size;
+
+    device_properties props;
+    hipError_t        result = get_current_device_properties(props);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    // The number of blocks must not depend on the offsets, so that the size of
+    // temporary storage is known without reading them
+    const unsigned int number_of_blocks
+        = ::rocprim::max(1u, props.compute_units * segmented_reduce_load_balanced_blocks_per_cu);
+
+    carry_type* heads;
+    carry_type* tails;
+    carry_type* scanned_tails;
+    size_t*     span;
+    void*       scan_temporary_storage;
+    size_t      scan_storage_size;
+
+    result = ::rocprim::inclusive_scan(nullptr,
+                                       scan_storage_size,
+                                       static_cast<carry_type*>(nullptr),
+                                       static_cast<carry_type*>(nullptr),
+                                       number_of_blocks,
+                                       carry_op_type{reduce_op},
+                                       stream,
+                                       debug_synchronous);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&heads, number_of_blocks),
+            detail::temp_storage::ptr_aligned_array(&tails, number_of_blocks),
+            detail::temp_storage::ptr_aligned_array(&scanned_tails, number_of_blocks),
+            detail::temp_storage::ptr_aligned_array(&span, 1),
+            detail::temp_storage::make_partition(&scan_temporary_storage, scan_storage_size)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if( segments == 0u )
+        return hipSuccess;
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if(debug_synchronous)
+    {
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << number_of_blocks << '\n';
+        start = std::chrono::high_resolution_clock::now();
+    }
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("segmented_reduce_span_kernel");
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(segmented_reduce_span_kernel<OffsetIterator>),
+        dim3(1), dim3(1), 0, stream,
+        begin_offsets, end_offsets, segments, span
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_reduce_span_kernel", 1, start);
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("segmented_reduce_load_balanced_kernel");
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(segmented_reduce_load_balanced_kernel<Config>),
+        dim3(number_of_blocks), dim3(block_size), 0, stream,
+        input, output, segments,
+        begin_offsets, end_offsets,
+        span, heads, tails,
+        reduce_op, initial_value
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_reduce_load_balanced_kernel", segments, start);
+
+    // Combine values of segments that span multiple blocks
+    result = ::rocprim::inclusive_scan(scan_temporary_storage,
+                                       scan_storage_size,
+                                       tails,
+                                       scanned_tails,
+                                       number_of_blocks,
+                                       carry_op_type{reduce_op},
+                                       stream,
+                                       debug_synchronous);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("segmented_reduce_fixup_kernel");
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(segmented_reduce_fixup_kernel<fixup_block_size>),
+        dim3(::rocprim::detail::ceiling_div(number_of_blocks, fixup_block_size)),
+        dim3(fixup_block_size), 0, stream,
+        output, heads, scanned_tails, number_of_blocks,
+        reduce_op, initial_value
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_reduce_fixup_kernel", number_of_blocks, start);
+
+    return hipSuccess;
+}
+
 template<
     class Config,
     class InputIterator,
@@ -113,14 +355,34 @@ hipError_t segmented_reduce_impl(void * temporary_storage,
     }
     const reduce_config_params params = dispatch_target_arch<config>(target_arch);
 
+    if(params.segmented_algorithm == segmented_reduce_algorithm::load_balanced)
+    {
+        return segmented_reduce_load_balanced_impl<config>(temporary_storage,
+                                                           storage_size,
+                                                           input,
+                                                           output,
+                                                           segments,
+                                                           begin_offsets,
+                                                           end_offsets,
+                                                           reduce_op,
+                                                           static_cast<result_type>(initial_value),
+                                                           params,
+                                                           stream,
+                                                           debug_synchronous);
+    }
+
     const unsigned int block_size = params.block_size;
 
-    if(temporary_storage == nullptr)
+    size_t* span;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&span, 1)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
     {
-        // Make sure user won't try to allocate 0 bytes memory, because
-        // hipMalloc will return nullptr when size is zero.
-        storage_size = 4;
-        return hipSuccess;
+        return partition_result;
     }
 
     if( segments == 0u )
@@ -128,19 +390,138 @@ hipError_t segmented_reduce_impl(void * temporary_storage,
 
     std::chrono::high_resolution_clock::time_point start;
 
-    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
-    hipLaunchKernelGGL(
-        HIP_KERNEL_NAME(segmented_reduce_kernel<config>),
-        dim3(segments), dim3(block_size), 0, stream,
-        input, output,
-        begin_offsets, end_offsets,
-        reduce_op, static_cast<result_type>(initial_value)
-    );
-    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_reduce", segments, start);
+    segmented_reduce_algorithm algorithm = params.segmented_algorithm;
+    if(algorithm == segmented_reduce_algorithm::automatic)
+    {
+        // Select the algorithm from the average length of segments
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("segmented_reduce_span_kernel");
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(segmented_reduce_span_kernel<OffsetIterator>),
+            dim3(1), dim3(1), 0, stream,
+            begin_offsets, end_offsets, segments, span
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_reduce_span_kernel", 1, start);
+
+        size_t host_span;
+        result = detail::memcpy_and_sync(&host_span,
+                                         span,
+                                         sizeof(host_span),
+                                         hipMemcpyDeviceToHost,
+                                         stream);
+        if(result != hipSuccess)
+        {
+            return result;
+        }
+        algorithm = select_segmented_reduce_algorithm(params, host_span / segments);
+    }
+
+    if(algorithm == segmented_reduce_algorithm::thread_per_segment)
+    {
+        const unsigned int grid_size = ::rocprim::detail::ceiling_div(segments, block_size);
+
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("segmented_reduce_thread_kernel");
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(segmented_reduce_thread_kernel<config>),
+            dim3(grid_size), dim3(block_size), 0, stream,
+            input, output, segments,
+            begin_offsets, end_offsets,
+            reduce_op, static_cast<result_type>(initial_value)
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_reduce_thread_kernel", segments, start);
+    }
+    else if(algorithm == segmented_reduce_algorithm::warp_per_segment)
+    {
+        const unsigned int grid_size = ::rocprim::detail::ceiling_div(
+            segments, block_size / segmented_reduce_warp_size);
+
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("segmented_reduce_warp_kernel");
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(segmented_reduce_warp_kernel<config>),
+            dim3(grid_size), dim3(block_size), 0, stream,
+            input, output, segments,
+            begin_offsets, end_offsets,
+            reduce_op, static_cast<result_type>(initial_value)
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_reduce_warp_kernel", segments, start);
+    }
+    else
+    {
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("segmented_reduce");
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(segmented_reduce_kernel<config>),
+            dim3(segments), dim3(block_size), 0, stream,
+            input, output,
+            begin_offsets, end_offsets,
+            reduce_op, static_cast<result_type>(initial_value)
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_reduce", segments, start);
+    }
 
     return hipSuccess;
 }
 
+// The nonzero items are gathered while the load-balanced algorithm walks them, so rows of
+// any lengths are split evenly across the blocks, whatever the algorithm of the config
+template<class Config,
+         class XIterator,
+         class ColumnIterator,
+         class ValueIterator,
+         class OutputIterator,
+         class OffsetIterator,
+         class GatherOp,
+         class ReduceOp,
+         class InitValueType>
+inline hipError_t segmented_gather_reduce_impl(void*              temporary_storage,
+                                               size_t&            storage_size,
+                                               XIterator          x,
+                                               ColumnIterator     columns,
+                                               ValueIterator      values,
+                                               OutputIterator     output,
+                                               const unsigned int rows,
+                                               OffsetIterator     row_offsets,
+                                               GatherOp           gather_op,
+                                               ReduceOp           reduce_op,
+                                               InitValueType      initial_value,
+                                               const hipStream_t  stream,
+                                               const bool         debug_synchronous)
+{
+    using gather_op_type = segmented_gather_op<XIterator, ColumnIterator, ValueIterator, GatherOp>;
+    using gather_type    = typename gather_op_type::result_type;
+    using result_type =
+        typename ::rocprim::detail::match_result_type<gather_type, ReduceOp>::type;
+
+    using config = wrapped_reduce_config<Config, result_type>;
+
+    detail::target_arch target_arch;
+    hipError_t          result = host_target_arch(stream, target_arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const reduce_config_params params = dispatch_target_arch<config>(target_arch);
+
+    const auto input = ::rocprim::make_transform_iterator(
+        ::rocprim::counting_iterator<size_t>(0),
+        gather_op_type{x, columns, values, gather_op});
+
+    return segmented_reduce_load_balanced_impl<config>(temporary_storage,
+                                                       storage_size,
+                                                       input,
+                                                       output,
+                                                       rows,
+                                                       row_offsets,
+                                                       row_offsets + 1,
+                                                       reduce_op,
+                                                       static_cast<result_type>(initial_value),
+                                                       params,
+                                                       stream,
+                                                       debug_synchronous);
+}
+
 #undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
 
 } // end of detail namespace
@@ -159,6 +540,15 @@ hipError_t segmented_reduce_impl(void * temporary_storage,
 /// at least \p segments elements. They may use the same sequence <tt>offsets</tt> of at least
 /// <tt>segments + 1</tt> elements: <tt>offsets</tt> for \p begin_offsets and
 /// <tt>offsets + 1</tt> for \p end_offsets.
+/// * Segments are reduced by blocks, logical warps or threads depending on the
+/// \p segmented_algorithm of the config. With \p segmented_reduce_algorithm::automatic (default)
+/// the algorithm is selected from the average length of segments, which is estimated as
+/// <tt>(end_offsets[segments - 1] - begin_offsets[0]) / segments</tt>. Reading the estimate
+/// synchronizes with \p stream, set the algorithm explicitly to avoid that.
+/// * \p segmented_reduce_algorithm::load_balanced splits all segments and items evenly across
+/// blocks, so very long segments do not take a single block. It requires sorted segments that do
+/// not overlap: <tt>end_offsets[i] <= begin_offsets[i + 1]</tt>, e.g. <tt>offsets</tt> and
+/// <tt>offsets + 1</tt>.
 ///
 /// \tparam Config - [optional] configuration of the primitive. It can be \p reduce_config or
 /// a custom class with the same members.
@@ -171,6 +561,9 @@ hipError_t segmented_reduce_impl(void * temporary_storage,
 /// \tparam BinaryFunction - type of binary function used for reduction. Default type
 /// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
 /// \tparam InitValueType - type of the initial value.
+/// \tparam AccumulatorType - [optional] type used for accumulation, the input is loaded as its
+/// own type and converted to it in registers before \p reduce_op is applied. The default
+/// (\p void) is the result type of \p reduce_op.
 ///
 /// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
 /// a null pointer is passed, the required allocation size (in bytes) is written to
@@ -245,7 +638,8 @@ template<
     class OutputIterator,
     class OffsetIterator,
     class BinaryFunction = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>,
-    class InitValueType = typename std::iterator_traits<InputIterator>::value_type
+    class InitValueType = typename std::iterator_traits<InputIterator>::value_type,
+    class AccumulatorType = void
 >
 inline
 hipError_t segmented_reduce(void * temporary_storage,
@@ -260,15 +654,199 @@ hipError_t segmented_reduce(void * temporary_storage,
                             hipStream_t stream = 0,
                             bool debug_synchronous = false)
 {
+    using accumulator_type = detail::resolve_accumulator_type_t<
+        AccumulatorType,
+        typename std::iterator_traits<InputIterator>::value_type,
+        BinaryFunction>;
+
     return detail::segmented_reduce_impl<Config>(
         temporary_storage, storage_size,
-        input, output,
+        detail::to_accumulator_input<accumulator_type>(input), output,
         segments, begin_offsets, end_offsets,
         reduce_op, initial_value,
         stream, debug_synchronous
     );
 }
 
+/// \brief Parallel segmented reduction primitive for device level, the segments are given by
+/// their lengths.
+///
+/// segmented_reduce_by_lengths function reduces every segment of the input, see
+/// \p segmented_reduce. The segment \p i has \p segment_lengths[i] values and begins after the
+/// values of the previous segments.
+///
+/// \par Overview
+/// * The offsets of the segments are computed by one exclusive scan of \p segment_lengths into
+/// \p temporary_storage, so the caller does not need to scan the lengths nor to allocate the
+/// offsets. Segments that already have an array of <tt>segments + 1</tt> offsets should be
+/// reduced by \p segmented_reduce with <tt>offsets</tt> and <tt>offsets + 1</tt>.
+/// * The offsets are 64-bit if the \p value_type of \p LengthIterator is a 64-bit integer.
+///
+/// \tparam LengthIterator - random-access iterator type of the lengths of the segments. It can be
+/// a simple pointer type.
+///
+/// \param [in] segment_lengths - iterator to the first element of the \p segments lengths of the
+/// segments.
+template<
+    class Config = default_config,
+    class InputIterator,
+    class OutputIterator,
+    class LengthIterator,
+    class BinaryFunction = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>,
+    class InitValueType = typename std::iterator_traits<InputIterator>::value_type
+>
+inline
+hipError_t segmented_reduce_by_lengths(void * temporary_storage,
+                                       size_t& storage_size,
+                                       InputIterator input,
+                                       OutputIterator output,
+                                       unsigned int segments,
+                                       LengthIterator segment_lengths,
+                                       BinaryFunction reduce_op = BinaryFunction(),
+                                       InitValueType initial_value = InitValueType(),
+                                       hipStream_t stream = 0,
+                                       bool debug_synchronous = false)
+{
+    return detail::segment_lengths_to_offsets(
+        temporary_storage, storage_size,
+        segment_lengths, segments,
+        [&](void* storage, size_t& bytes, auto begin_offsets, auto end_offsets)
+        {
+            return detail::segmented_reduce_impl<Config>(
+                storage, bytes,
+                input, output,
+                segments, begin_offsets, end_offsets,
+                reduce_op, initial_value,
+                stream, debug_synchronous
+            );
+        },
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel segmented gather-reduce primitive for device level, for CSR matrices.
+///
+/// segmented_gather_reduce computes
+/// <tt>output[i] = reduce_op(initial_value, gather_op(x[columns[j]], values[j]), ...)</tt>
+/// over the nonzeros \p j of every row \p i of a matrix in the CSR format, for example the sparse
+/// matrix-vector product <tt>y = A * x</tt> with the default operations, or a PageRank iteration.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * \p row_offsets must have <tt>rows + 1</tt> elements, the nonzeros of the row \p i are
+/// <tt>[row_offsets[i], row_offsets[i + 1])</tt>. \p columns and \p values must have
+/// <tt>row_offsets[rows]</tt> elements, \p output must have \p rows elements.
+/// * The rows and the nonzeros are split evenly across the blocks by the merge path of the load
+/// balanced algorithm of \p segmented_reduce (nonzero-split), so the time does not depend on the
+/// variance of the lengths of the rows: long rows are reduced by several blocks and combined by a
+/// fix-up pass, blocks of short or empty rows do not idle. \p x is gathered while the nonzeros
+/// are reduced, without an intermediate array of products.
+/// * Empty rows are set to \p initial_value.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p reduce_config or
+/// a custom class with the same members, its \p segmented_algorithm is ignored.
+/// \tparam XIterator - random-access iterator type of the dense vector.
+/// \tparam ColumnIterator - random-access iterator type of the column indices of the nonzeros.
+/// \tparam ValueIterator - random-access iterator type of the values of the nonzeros.
+/// \tparam OutputIterator - random-access iterator type of the output range.
+/// \tparam OffsetIterator - random-access iterator type of the row offsets.
+/// \tparam GatherOp - type of binary function combining an element of \p x and a value.
+/// \tparam ReduceOp - type of binary function used for reduction of the row.
+/// \tparam InitValueType - type of the initial value.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] x - iterator to the first element of the dense vector.
+/// \param [in] columns - iterator to the column indices of the nonzeros.
+/// \param [in] values - iterator to the values of the nonzeros.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [in] rows - number of rows.
+/// \param [in] row_offsets - iterator to the <tt>rows + 1</tt> offsets of the rows.
+/// \param [in] gather_op - [optional] binary function <tt>R f(const X &x, const V &value);</tt>
+/// applied to every nonzero. The default is \p rocprim::multiplies.
+/// \param [in] reduce_op - [optional] binary function used for the reduction of the rows. The
+/// default is \p rocprim::plus.
+/// \param [in] initial_value - [optional] initial value of the reduction of every row.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int rows;     // e.g., 3
+/// int * row_offsets;     // e.g., [0, 2, 2, 5]
+/// int * columns;         // e.g., [0, 2, 0, 1, 2]
+/// float * values;        // e.g., [1, 2, 3, 4, 5]
+/// float * x;             // e.g., [1, 10, 100]
+/// float * y;             // empty array of 3 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::segmented_gather_reduce(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     x, columns, values, y, rows, row_offsets
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // compute y = A * x
+/// rocprim::segmented_gather_reduce(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     x, columns, values, y, rows, row_offsets
+/// );
+/// // y: [201, 0, 543]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class XIterator,
+    class ColumnIterator,
+    class ValueIterator,
+    class OutputIterator,
+    class OffsetIterator,
+    class GatherOp
+    = ::rocprim::multiplies<typename std::iterator_traits<ValueIterator>::value_type>,
+    class ReduceOp = ::rocprim::plus<
+        detail::segmented_gather_result_t<XIterator, ColumnIterator, ValueIterator, GatherOp>>,
+    class InitValueType
+    = detail::segmented_gather_result_t<XIterator, ColumnIterator, ValueIterator, GatherOp>
+>
+inline
+hipError_t segmented_gather_reduce(void * temporary_storage,
+                                   size_t& storage_size,
+                                   XIterator x,
+                                   ColumnIterator columns,
+                                   ValueIterator values,
+                                   OutputIterator output,
+                                   unsigned int rows,
+                                   OffsetIterator row_offsets,
+                                   GatherOp gather_op = GatherOp(),
+                                   ReduceOp reduce_op = ReduceOp(),
+                                   InitValueType initial_value = InitValueType(),
+                                   hipStream_t stream = 0,
+                                   bool debug_synchronous = false)
+{
+    return detail::segmented_gather_reduce_impl<Config>(
+        temporary_storage, storage_size,
+        x, columns, values, output,
+        rows, row_offsets,
+        gather_op, reduce_op, initial_value,
+        stream, debug_synchronous
+    );
+}
+
 /// @}
 // end of group devicemodule
 
@@ -34,10 +34,12 @@
 #include "../iterator/transform_iterator.hpp"
 #include "../iterator/counting_iterator.hpp"
 #include "../types/tuple.hpp"
+#include "../functional.hpp"
 
 #include "detail/config/device_scan.hpp"
 #include "detail/device_segmented_scan.hpp"
 #include "device_scan.hpp"
+#include "instrumentation.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -76,6 +78,7 @@ void segmented_scan_kernel(InputIterator input,
     { \
         auto _error = hipGetLastError(); \
         if(_error != hipSuccess) return _error; \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
         if(debug_synchronous) \
         { \
             std::cout << name << "(" << size << ")"; \
@@ -133,6 +136,7 @@ hipError_t segmented_scan_impl(void * temporary_storage,
 
     std::chrono::high_resolution_clock::time_point start;
     if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("segmented_scan");
     hipLaunchKernelGGL(
         HIP_KERNEL_NAME(segmented_scan_kernel<Exclusive, config, result_type>),
         dim3(segments), dim3(block_size), 0, stream,
@@ -161,6 +165,7 @@ hipError_t segmented_scan_impl(void * temporary_storage,
 /// at least \p segments elements. They may use the same sequence <tt>offsets</tt> of at least
 /// <tt>segments + 1</tt> elements: <tt>offsets</tt> for \p begin_offsets and
 /// <tt>offsets + 1</tt> for \p end_offsets.
+/// * The scan can be performed in place: \p output can be the same range as \p input.
 ///
 /// \tparam Config - [optional] configuration of the primitive. It can be \p scan_config or
 /// a custom class with the same members.
@@ -276,6 +281,7 @@ hipError_t segmented_inclusive_scan(void * temporary_storage,
 /// at least \p segments elements. They may use the same sequence <tt>offsets</tt> of at least
 /// <tt>segments + 1</tt> elements: <tt>offsets</tt> for \p begin_offsets and
 /// <tt>offsets + 1</tt> for \p end_offsets.
+/// * The scan can be performed in place: \p output can be the same range as \p input.
 ///
 /// \tparam Config - [optional] configuration of the primitive. It can be \p scan_config or
 /// a custom class with the same members.
@@ -394,6 +400,8 @@ hipError_t segmented_exclusive_scan(void * temporary_storage,
 /// if \p temporary_storage in a null pointer.
 /// * Ranges specified by \p input, \p output, and \p flags must have at least \p size elements.
 /// * \p value_type of \p HeadFlagIterator iterator should be convertible to \p bool type.
+/// * The scan can be performed in place: \p output can be the same range as \p input.
+/// \p head_flags must not alias \p output.
 ///
 /// \tparam Config - [optional] configuration of the primitive. It can be \p scan_config or
 /// a custom class with the same members.
@@ -507,6 +515,8 @@ hipError_t segmented_inclusive_scan(void * temporary_storage,
 /// if \p temporary_storage in a null pointer.
 /// * Ranges specified by \p input, \p output, and \p flags must have at least \p size elements.
 /// * \p value_type of \p HeadFlagIterator iterator should be convertible to \p bool type.
+/// * The scan can be performed in place: \p output can be the same range as \p input.
+/// \p head_flags must not alias \p output.
 ///
 /// \tparam Config - [optional] configuration of the primitive. It can be \p scan_config or
 /// a custom class with the same members.
@@ -637,6 +647,253 @@ hipError_t segmented_exclusive_scan(void * temporary_storage,
     );
 }
 
+/// \brief Parallel segmented inclusive scan by key primitive for device level.
+///
+/// segmented_inclusive_scan_by_key function performs a device-wide inclusive scan operation
+/// across multiple sequences from \p input using binary \p scan_op operator. A segment is a
+/// range of consecutive items whose keys compare equal by \p key_compare_op. The head flags
+/// are computed from \p keys_input while the values are loaded, so they are not materialized.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p keys_input, \p input and \p output must have at least \p size
+/// elements.
+/// * The result is the same as the result of \p inclusive_scan_by_key, the scan is performed
+/// by the head flags path of \p segmented_inclusive_scan.
+/// * The scan can be performed in place: \p output can be the same range as \p input.
+/// \p keys_input must not alias \p output.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p scan_config or
+/// a custom class with the same members.
+/// \tparam KeysInputIterator - random-access iterator type of the keys range. Must meet the
+/// requirements of a C++ RandomAccessIterator concept. It can be a simple pointer type.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ RandomAccessIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ RandomAccessIterator concept. It can be a simple pointer type.
+/// \tparam BinaryFunction - type of binary function used for scan operation. Default type
+/// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+/// \tparam KeyCompareFunction - type of binary function used to determine keys equality. Default
+/// type is \p rocprim::equal_to<T>, where \p T is a \p value_type of \p KeysInputIterator.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the scan operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - iterator to the first element in the range of keys.
+/// \param [in] input - iterator to the first element in the range to scan.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] scan_op - binary operation function object that will be used for scan.
+/// The signature of the function should be equivalent to the following:
+/// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] key_compare_op - binary operation function object that will be used to determine
+/// keys equality. The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p KeyCompareFunction().
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level segmented inclusive sum operation is performed in place on
+/// an array of integer values, the segments are the runs of equal keys.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t size;      // e.g., 8
+/// int * keys;       // e.g., [1, 1, 1, 2, 2, 3, 3, 3]
+/// int * values;     // e.g., [1, 2, 3, 4, 5, 6, 7, 8]
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::segmented_inclusive_scan_by_key(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys, values, values, size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform scan
+/// rocprim::segmented_inclusive_scan_by_key(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys, values, values, size
+/// );
+/// // values: [1, 3, 6, 4, 9, 6, 13, 21]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class KeysInputIterator,
+    class InputIterator,
+    class OutputIterator,
+    class BinaryFunction = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>,
+    class KeyCompareFunction
+    = ::rocprim::equal_to<typename std::iterator_traits<KeysInputIterator>::value_type>
+>
+inline
+hipError_t segmented_inclusive_scan_by_key(void * temporary_storage,
+                                           size_t& storage_size,
+                                           KeysInputIterator keys_input,
+                                           InputIterator input,
+                                           OutputIterator output,
+                                           size_t size,
+                                           BinaryFunction scan_op = BinaryFunction(),
+                                           KeyCompareFunction key_compare_op = KeyCompareFunction(),
+                                           hipStream_t stream = 0,
+                                           bool debug_synchronous = false)
+{
+    using head_flag_op_type
+        = detail::segmented_scan_key_head_flag_op<KeysInputIterator, KeyCompareFunction>;
+
+    return segmented_inclusive_scan<Config>(
+        temporary_storage, storage_size,
+        input, output,
+        rocprim::make_transform_iterator(rocprim::make_counting_iterator<size_t>(0),
+                                         head_flag_op_type{keys_input, key_compare_op}),
+        size, scan_op,
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel segmented exclusive scan by key primitive for device level.
+///
+/// segmented_exclusive_scan_by_key function performs a device-wide exclusive scan operation
+/// across multiple sequences from \p input using binary \p scan_op operator. A segment is a
+/// range of consecutive items whose keys compare equal by \p key_compare_op. The head flags
+/// are computed from \p keys_input while the values are loaded, so they are not materialized.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p keys_input, \p input and \p output must have at least \p size
+/// elements.
+/// * The result is the same as the result of \p exclusive_scan_by_key, the scan is performed
+/// by the head flags path of \p segmented_exclusive_scan.
+/// * The scan can be performed in place: \p output can be the same range as \p input.
+/// \p keys_input must not alias \p output.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p scan_config or
+/// a custom class with the same members.
+/// \tparam KeysInputIterator - random-access iterator type of the keys range. Must meet the
+/// requirements of a C++ RandomAccessIterator concept. It can be a simple pointer type.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ RandomAccessIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ RandomAccessIterator concept. It can be a simple pointer type.
+/// \tparam InitValueType - type of the initial value.
+/// \tparam BinaryFunction - type of binary function used for scan operation. Default type
+/// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+/// \tparam KeyCompareFunction - type of binary function used to determine keys equality. Default
+/// type is \p rocprim::equal_to<T>, where \p T is a \p value_type of \p KeysInputIterator.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the scan operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - iterator to the first element in the range of keys.
+/// \param [in] input - iterator to the first element in the range to scan.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [in] initial_value - initial value to start the scan of every segment.
+/// \param [in] size - number of element in the input range.
+/// \param [in] scan_op - binary operation function object that will be used for scan.
+/// The signature of the function should be equivalent to the following:
+/// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] key_compare_op - binary operation function object that will be used to determine
+/// keys equality. The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p KeyCompareFunction().
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level segmented exclusive sum operation is performed in place on
+/// an array of integer values, the segments are the runs of equal keys.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t size;      // e.g., 8
+/// int * keys;       // e.g., [1, 1, 1, 2, 2, 3, 3, 3]
+/// int * values;     // e.g., [1, 2, 3, 4, 5, 6, 7, 8]
+/// int init;         // e.g., 9
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::segmented_exclusive_scan_by_key(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys, values, values, init, size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform scan
+/// rocprim::segmented_exclusive_scan_by_key(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys, values, values, init, size
+/// );
+/// // values: [9, 10, 12, 9, 13, 9, 15, 22]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class KeysInputIterator,
+    class InputIterator,
+    class OutputIterator,
+    class InitValueType,
+    class BinaryFunction = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>,
+    class KeyCompareFunction
+    = ::rocprim::equal_to<typename std::iterator_traits<KeysInputIterator>::value_type>
+>
+inline
+hipError_t segmented_exclusive_scan_by_key(void * temporary_storage,
+                                           size_t& storage_size,
+                                           KeysInputIterator keys_input,
+                                           InputIterator input,
+                                           OutputIterator output,
+                                           const InitValueType initial_value,
+                                           size_t size,
+                                           BinaryFunction scan_op = BinaryFunction(),
+                                           KeyCompareFunction key_compare_op = KeyCompareFunction(),
+                                           hipStream_t stream = 0,
+                                           bool debug_synchronous = false)
+{
+    using head_flag_op_type
+        = detail::segmented_scan_key_head_flag_op<KeysInputIterator, KeyCompareFunction>;
+
+    return segmented_exclusive_scan<Config>(
+        temporary_storage, storage_size,
+        input, output,
+        rocprim::make_transform_iterator(rocprim::make_counting_iterator<size_t>(0),
+                                         head_flag_op_type{keys_input, key_compare_op}),
+        initial_value, size, scan_op,
+        stream, debug_synchronous
+    );
+}
+
 /// @}
 // end of group devicemodule
 
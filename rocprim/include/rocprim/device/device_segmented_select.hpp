@@ -0,0 +1,517 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_SEGMENTED_SELECT_HPP_
+#define ROCPRIM_DEVICE_DEVICE_SEGMENTED_SELECT_HPP_
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+
+#include "../config.hpp"
+#include "../detail/binary_op_wrappers.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../functional.hpp"
+
+#include "../block/block_load.hpp"
+
+#include "config_types.hpp"
+#include "detail/device_scan_common.hpp"
+#include "detail/device_segmented_select.hpp"
+#include "instrumentation.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+/// \brief Configuration of \p segmented_select and \p segmented_unique.
+///
+/// \tparam BlockSize - number of threads in a block.
+/// \tparam ItemsPerThread - number of items processed by each thread.
+/// \tparam LoadMethod - method for loading the input values.
+template<unsigned int      BlockSize      = 256,
+         unsigned int      ItemsPerThread = 8,
+         block_load_method LoadMethod     = block_load_method::block_load_transpose>
+struct segmented_select_config
+{
+    /// \brief Number of threads in a block.
+    static constexpr unsigned int block_size = BlockSize;
+    /// \brief Number of items processed by each thread.
+    static constexpr unsigned int items_per_thread = ItemsPerThread;
+    /// \brief Method for loading the input values.
+    static constexpr block_load_method load_method = LoadMethod;
+};
+
+namespace detail
+{
+
+template<bool Unique,
+         class Config,
+         class InputIterator,
+         class OutputIterator,
+         class OutputOffsetIterator,
+         class InputOffsetIterator,
+         class SelectOp,
+         class OffsetLookbackScanState>
+ROCPRIM_KERNEL __launch_bounds__(Config::block_size) void segmented_select_kernel(
+    InputIterator                  input,
+    OutputIterator                 output,
+    OutputOffsetIterator           output_offsets,
+    const unsigned int             size,
+    const unsigned int             segments,
+    InputOffsetIterator            input_offsets,
+    SelectOp                       select_op,
+    OffsetLookbackScanState        offset_scan_state,
+    const unsigned int             number_of_blocks,
+    ordered_block_id<unsigned int> ordered_bid)
+{
+    segmented_select_kernel_impl<Unique, Config>(input,
+                                                 output,
+                                                 output_offsets,
+                                                 size,
+                                                 segments,
+                                                 input_offsets,
+                                                 select_op,
+                                                 offset_scan_state,
+                                                 number_of_blocks,
+                                                 ordered_bid);
+}
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start)                           \
+    {                                                                                            \
+        auto _error = hipGetLastError();                                                         \
+        if(_error != hipSuccess)                                                                 \
+            return _error;                                                                       \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size);                                          \
+        if(debug_synchronous)                                                                    \
+        {                                                                                        \
+            std::cout << name << "(" << size << ")";                                             \
+            auto __error = hipStreamSynchronize(stream);                                         \
+            if(__error != hipSuccess)                                                            \
+                return __error;                                                                  \
+            auto _end = std::chrono::high_resolution_clock::now();                               \
+            auto _d = std::chrono::duration_cast<std::chrono::duration<double>>(_end - start);   \
+            std::cout << " " << _d.count() * 1000 << " ms" << '\n';                              \
+        }                                                                                        \
+    }
+
+template<bool Unique,
+         class Config,
+         class InputIterator,
+         class OutputIterator,
+         class OutputOffsetIterator,
+         class InputOffsetIterator,
+         class SelectOp>
+inline hipError_t segmented_select_impl(void*                temporary_storage,
+                                        size_t&              storage_size,
+                                        InputIterator        input,
+                                        OutputIterator       output,
+                                        OutputOffsetIterator output_offsets,
+                                        const unsigned int   size,
+                                        const unsigned int   segments,
+                                        InputOffsetIterator  input_offsets,
+                                        SelectOp             select_op,
+                                        const hipStream_t    stream,
+                                        bool                 debug_synchronous)
+{
+    using config = default_or_custom_config<Config, segmented_select_config<>>;
+
+    using offset_scan_state_type            = detail::lookback_scan_state<unsigned int>;
+    using offset_scan_state_with_sleep_type = detail::lookback_scan_state<unsigned int, true>;
+    using ordered_block_id_type             = detail::ordered_block_id<unsigned int>;
+
+    static constexpr unsigned int block_size      = config::block_size;
+    static constexpr unsigned int items_per_block = block_size * config::items_per_thread;
+
+    // An empty input still has a tile, it writes the offsets of the empty segments
+    const unsigned int number_of_blocks
+        = ::rocprim::max(::rocprim::detail::ceiling_div(size, items_per_block), 1u);
+
+    void*                           offset_scan_state_storage;
+    ordered_block_id_type::id_type* ordered_bid_storage;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            // This is valid even with offset_scan_state_with_sleep_type
+            detail::temp_storage::make_partition(
+                &offset_scan_state_storage,
+                offset_scan_state_type::get_temp_storage_layout(number_of_blocks)),
+            detail::temp_storage::make_partition(
+                &ordered_bid_storage,
+                ordered_block_id_type::get_temp_storage_layout())));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    auto offset_scan_state
+        = offset_scan_state_type::create(offset_scan_state_storage, number_of_blocks);
+    auto offset_scan_state_with_sleep
+        = offset_scan_state_with_sleep_type::create(offset_scan_state_storage, number_of_blocks);
+    auto ordered_bid = ordered_block_id_type::create(ordered_bid_storage);
+
+    bool       use_sleep;
+    hipError_t error = is_sleep_scan_state_used(use_sleep);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    std::chrono::high_resolution_clock::time_point start;
+    if(debug_synchronous)
+    {
+        std::cout << "size " << size << '\n';
+        std::cout << "segments " << segments << '\n';
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << number_of_blocks << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+        start = std::chrono::high_resolution_clock::now();
+    }
+
+    const unsigned int init_grid_size
+        = ::rocprim::detail::ceiling_div(number_of_blocks, block_size);
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("init_offset_scan_state_kernel");
+    if(use_sleep)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(init_lookback_scan_state_kernel<offset_scan_state_with_sleep_type>),
+            dim3(init_grid_size),
+            dim3(block_size),
+            0,
+            stream,
+            offset_scan_state_with_sleep,
+            number_of_blocks,
+            ordered_bid);
+    }
+    else
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(init_lookback_scan_state_kernel<offset_scan_state_type>),
+            dim3(init_grid_size),
+            dim3(block_size),
+            0,
+            stream,
+            offset_scan_state,
+            number_of_blocks,
+            ordered_bid);
+    }
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_offset_scan_state_kernel",
+                                                number_of_blocks,
+                                                start);
+
+    if(debug_synchronous)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("segmented_select_kernel");
+    if(use_sleep)
+    {
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(segmented_select_kernel<Unique, config>),
+                           dim3(number_of_blocks),
+                           dim3(block_size),
+                           0,
+                           stream,
+                           input,
+                           output,
+                           output_offsets,
+                           size,
+                           segments,
+                           input_offsets,
+                           select_op,
+                           offset_scan_state_with_sleep,
+                           number_of_blocks,
+                           ordered_bid);
+    }
+    else
+    {
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(segmented_select_kernel<Unique, config>),
+                           dim3(number_of_blocks),
+                           dim3(block_size),
+                           0,
+                           stream,
+                           input,
+                           output,
+                           output_offsets,
+                           size,
+                           segments,
+                           input_offsets,
+                           select_op,
+                           offset_scan_state,
+                           number_of_blocks,
+                           ordered_bid);
+    }
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_select_kernel", size, start);
+
+    return hipSuccess;
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
+} // end of detail namespace
+
+/// \brief Parallel select primitive within segments for device level.
+///
+/// \p segmented_select keeps the values of every segment that satisfy \p predicate, like
+/// \p select does for the whole range, so that the selected values of a segment stay together.
+/// The values and the new offsets of all segments are computed by a single look-back pass,
+/// instead of a launch per segment.
+///
+/// \par Overview
+/// * Segment \p i is <tt>[input_offsets[i], input_offsets[i + 1])</tt> of \p input. The
+/// \p segments + 1 offsets are sorted, <tt>input_offsets[0]</tt> is \p 0 and
+/// <tt>input_offsets[segments]</tt> is \p size.
+/// * The selected values of segment \p i are stored to
+/// <tt>[output_offsets[i], output_offsets[i + 1])</tt> of \p output, in the order of the input.
+/// <tt>output_offsets[segments]</tt> is the total number of selected values.
+/// * Sizes and offsets use 32-bit indices.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// \p segmented_select_config or a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OutputOffsetIterator - random-access iterator type of the output offsets. Must meet
+/// the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam InputOffsetIterator - random-access iterator type of the input offsets. It can be
+/// a simple pointer type.
+/// \tparam UnaryPredicate - type of a unary selection predicate.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the select operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to select values from.
+/// \param [out] output - iterator to the first element in the output range. It must not overlap
+/// \p input.
+/// \param [out] output_offsets - iterator to the <tt>segments + 1</tt> offsets of the segments
+/// in \p output.
+/// \param [in] size - number of elements in the input range.
+/// \param [in] segments - number of segments.
+/// \param [in] input_offsets - iterator to the <tt>segments + 1</tt> offsets of the segments
+/// in \p input.
+/// \param [in] predicate - unary function object which returns \p true if a value should be
+/// selected. The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the object passed to it.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// auto predicate = [] __device__ (int a) -> bool { return (a % 2) == 0; };
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int   size;           // e.g., 8
+/// unsigned int   segments;       // e.g., 3
+/// int *          input;          // e.g., [1, 2, 3, 4, 5, 6, 7, 8]
+/// unsigned int * input_offsets;  // e.g., [0, 3, 4, 8]
+/// int *          output;         // empty array of 8 elements
+/// unsigned int * output_offsets; // empty array of 4 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::segmented_select(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, output_offsets, size, segments, input_offsets, predicate
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform selection
+/// rocprim::segmented_select(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, output_offsets, size, segments, input_offsets, predicate
+/// );
+/// // output:         [2, 4, 6, 8]
+/// // output_offsets: [0, 1, 2, 4]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class OutputOffsetIterator,
+         class InputOffsetIterator,
+         class UnaryPredicate>
+inline hipError_t segmented_select(void*                temporary_storage,
+                                   size_t&              storage_size,
+                                   InputIterator        input,
+                                   OutputIterator       output,
+                                   OutputOffsetIterator output_offsets,
+                                   unsigned int         size,
+                                   unsigned int         segments,
+                                   InputOffsetIterator  input_offsets,
+                                   UnaryPredicate       predicate,
+                                   hipStream_t          stream            = 0,
+                                   bool                 debug_synchronous = false)
+{
+    return detail::segmented_select_impl<false, Config>(temporary_storage,
+                                                        storage_size,
+                                                        input,
+                                                        output,
+                                                        output_offsets,
+                                                        size,
+                                                        segments,
+                                                        input_offsets,
+                                                        predicate,
+                                                        stream,
+                                                        debug_synchronous);
+}
+
+/// \brief Parallel unique primitive within segments for device level.
+///
+/// \p segmented_unique keeps the first value of every group of consecutive equivalent values of
+/// every segment, like \p unique does for the whole range. The head of a segment is always kept,
+/// even when it is equal to the last value of the previous segment. The values and the new
+/// offsets of all segments are computed by a single look-back pass, instead of a launch per
+/// segment.
+///
+/// \par Overview
+/// * Segment \p i is <tt>[input_offsets[i], input_offsets[i + 1])</tt> of \p input. The
+/// \p segments + 1 offsets are sorted, <tt>input_offsets[0]</tt> is \p 0 and
+/// <tt>input_offsets[segments]</tt> is \p size.
+/// * The unique values of segment \p i are stored to
+/// <tt>[output_offsets[i], output_offsets[i + 1])</tt> of \p output.
+/// <tt>output_offsets[segments]</tt> is the total number of unique values.
+/// * Sizes and offsets use 32-bit indices.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// \p segmented_select_config or a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OutputOffsetIterator - random-access iterator type of the output offsets. Must meet
+/// the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam InputOffsetIterator - random-access iterator type of the input offsets. It can be
+/// a simple pointer type.
+/// \tparam EqualityOp - type of an binary operator used to compare values for equality.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the unique operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to select values from.
+/// \param [out] output - iterator to the first element in the output range. It must not overlap
+/// \p input.
+/// \param [out] output_offsets - iterator to the <tt>segments + 1</tt> offsets of the segments
+/// in \p output.
+/// \param [in] size - number of elements in the input range.
+/// \param [in] segments - number of segments.
+/// \param [in] input_offsets - iterator to the <tt>segments + 1</tt> offsets of the segments
+/// in \p input.
+/// \param [in] equality_op - [optional] binary function object used to compare input values
+/// for equality. The default is \p rocprim::equal_to<T>.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int   size;           // e.g., 8
+/// unsigned int   segments;       // e.g., 2
+/// int *          input;          // e.g., [1, 1, 2, 2, 2, 3, 3, 4]
+/// unsigned int * input_offsets;  // e.g., [0, 4, 8]
+/// int *          output;         // empty array of 8 elements
+/// unsigned int * output_offsets; // empty array of 3 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::segmented_unique(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, output_offsets, size, segments, input_offsets
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform unique operation
+/// rocprim::segmented_unique(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, output_offsets, size, segments, input_offsets
+/// );
+/// // output:         [1, 2, 2, 3, 4]
+/// // output_offsets: [0, 2, 5]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class OutputOffsetIterator,
+         class InputOffsetIterator,
+         class EqualityOp
+         = ::rocprim::equal_to<typename std::iterator_traits<InputIterator>::value_type>>
+inline hipError_t segmented_unique(void*                temporary_storage,
+                                   size_t&              storage_size,
+                                   InputIterator        input,
+                                   OutputIterator       output,
+                                   OutputOffsetIterator output_offsets,
+                                   unsigned int         size,
+                                   unsigned int         segments,
+                                   InputOffsetIterator  input_offsets,
+                                   EqualityOp           equality_op       = EqualityOp(),
+                                   hipStream_t          stream            = 0,
+                                   bool                 debug_synchronous = false)
+{
+    return detail::segmented_select_impl<true, Config>(
+        temporary_storage,
+        storage_size,
+        input,
+        output,
+        output_offsets,
+        size,
+        segments,
+        input_offsets,
+        detail::inequality_wrapper<EqualityOp>(equality_op),
+        stream,
+        debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_SEGMENTED_SELECT_HPP_
@@ -0,0 +1,427 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_SEGMENTED_SET_OPERATIONS_HPP_
+#define ROCPRIM_DEVICE_DEVICE_SEGMENTED_SET_OPERATIONS_HPP_
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../functional.hpp"
+#include "../iterator/constant_iterator.hpp"
+
+#include "config_types.hpp"
+#include "detail/device_segmented_set_operations.hpp"
+#include "device_scan.hpp"
+#include "device_transform.hpp"
+#include "instrumentation.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+/// \brief Configuration of \p segmented_set_intersection.
+///
+/// \tparam BlockSize - number of threads in a block.
+/// \tparam LogicalWarpSize - number of threads that intersect a small pair together. Every block
+/// intersects <tt>BlockSize / LogicalWarpSize</tt> consecutive pairs. It must not be greater
+/// than the warp size of the device.
+/// \tparam LargePairThreshold - pairs whose first list has more than \p LargePairThreshold keys
+/// are intersected by all threads of their block instead of a logical warp.
+template<unsigned int BlockSize          = 256,
+         unsigned int LogicalWarpSize    = 32,
+         unsigned int LargePairThreshold = 1024>
+struct segmented_set_intersection_config
+{
+    /// \brief Number of threads in a block.
+    static constexpr unsigned int block_size = BlockSize;
+    /// \brief Number of threads that intersect a small pair together.
+    static constexpr unsigned int logical_warp_size = LogicalWarpSize;
+    /// \brief Largest size of the first list of a pair intersected by a logical warp.
+    static constexpr unsigned int large_pair_threshold = LargePairThreshold;
+};
+
+namespace detail
+{
+
+template<bool WriteOutput,
+         class Config,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class KeysOutputIterator,
+         class OutputOffsetIterator,
+         class OffsetIterator1,
+         class OffsetIterator2,
+         class BinaryFunction>
+ROCPRIM_KERNEL __launch_bounds__(Config::block_size) void segmented_set_intersection_kernel(
+    KeysInputIterator1   keys_input1,
+    KeysInputIterator2   keys_input2,
+    KeysOutputIterator   keys_output,
+    OutputOffsetIterator output_offsets,
+    unsigned int*        pair_counts,
+    const unsigned int*  pair_offsets,
+    const unsigned int   pairs,
+    OffsetIterator1      begin_offsets1,
+    OffsetIterator1      end_offsets1,
+    OffsetIterator2      begin_offsets2,
+    OffsetIterator2      end_offsets2,
+    BinaryFunction       compare_function)
+{
+    segmented_set_intersection_kernel_impl<WriteOutput,
+                                           Config::block_size,
+                                           Config::logical_warp_size,
+                                           Config::large_pair_threshold>(keys_input1,
+                                                                         keys_input2,
+                                                                         keys_output,
+                                                                         output_offsets,
+                                                                         pair_counts,
+                                                                         pair_offsets,
+                                                                         pairs,
+                                                                         begin_offsets1,
+                                                                         end_offsets1,
+                                                                         begin_offsets2,
+                                                                         end_offsets2,
+                                                                         compare_function);
+}
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start)                           \
+    {                                                                                            \
+        auto _error = hipGetLastError();                                                         \
+        if(_error != hipSuccess)                                                                 \
+            return _error;                                                                       \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size);                                          \
+        if(debug_synchronous)                                                                    \
+        {                                                                                        \
+            std::cout << name << "(" << size << ")";                                             \
+            auto __error = hipStreamSynchronize(stream);                                         \
+            if(__error != hipSuccess)                                                            \
+                return __error;                                                                  \
+            auto _end = std::chrono::high_resolution_clock::now();                               \
+            auto _d = std::chrono::duration_cast<std::chrono::duration<double>>(_end - start);   \
+            std::cout << " " << _d.count() * 1000 << " ms" << '\n';                              \
+        }                                                                                        \
+    }
+
+template<class Config,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class KeysOutputIterator,
+         class OutputOffsetIterator,
+         class OffsetIterator1,
+         class OffsetIterator2,
+         class BinaryFunction>
+inline hipError_t segmented_set_intersection_impl(void*                temporary_storage,
+                                                  size_t&              storage_size,
+                                                  KeysInputIterator1   keys_input1,
+                                                  KeysInputIterator2   keys_input2,
+                                                  KeysOutputIterator   keys_output,
+                                                  OutputOffsetIterator output_offsets,
+                                                  const unsigned int   pairs,
+                                                  OffsetIterator1      begin_offsets1,
+                                                  OffsetIterator1      end_offsets1,
+                                                  OffsetIterator2      begin_offsets2,
+                                                  OffsetIterator2      end_offsets2,
+                                                  BinaryFunction       compare_function,
+                                                  const hipStream_t    stream,
+                                                  bool                 debug_synchronous)
+{
+    using config = default_or_custom_config<Config, segmented_set_intersection_config<>>;
+
+    static constexpr unsigned int block_size      = config::block_size;
+    static constexpr unsigned int warps_per_block = block_size / config::logical_warp_size;
+
+    unsigned int* pair_counts;
+    unsigned int* pair_offsets;
+    void*         scan_temporary_storage;
+    size_t        scan_storage_size;
+
+    // The counts have an extra element, so their exclusive scan ends with the total count
+    hipError_t result = ::rocprim::exclusive_scan(nullptr,
+                                                  scan_storage_size,
+                                                  pair_counts,
+                                                  pair_offsets,
+                                                  0u,
+                                                  pairs + 1,
+                                                  ::rocprim::plus<unsigned int>(),
+                                                  stream,
+                                                  debug_synchronous);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&pair_counts, pairs + 1),
+            detail::temp_storage::ptr_aligned_array(&pair_offsets, pairs + 1),
+            detail::temp_storage::make_partition(&scan_temporary_storage, scan_storage_size)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(pairs == 0u)
+    {
+        return ::rocprim::transform(::rocprim::constant_iterator<unsigned int>(0),
+                                    output_offsets,
+                                    1,
+                                    ::rocprim::identity<unsigned int>{},
+                                    stream,
+                                    debug_synchronous);
+    }
+
+    const unsigned int grid_size = ::rocprim::detail::ceiling_div(pairs, warps_per_block);
+
+    std::chrono::high_resolution_clock::time_point start;
+    if(debug_synchronous)
+    {
+        std::cout << "pairs " << pairs << '\n';
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "pairs per block " << warps_per_block << '\n';
+        start = std::chrono::high_resolution_clock::now();
+    }
+
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("segmented_set_intersection_count");
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(segmented_set_intersection_kernel<false, config>),
+                       dim3(grid_size),
+                       dim3(block_size),
+                       0,
+                       stream,
+                       keys_input1,
+                       keys_input2,
+                       keys_output,
+                       output_offsets,
+                       pair_counts,
+                       static_cast<const unsigned int*>(nullptr),
+                       pairs,
+                       begin_offsets1,
+                       end_offsets1,
+                       begin_offsets2,
+                       end_offsets2,
+                       compare_function);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_set_intersection_count", pairs, start);
+
+    result = ::rocprim::exclusive_scan(scan_temporary_storage,
+                                       scan_storage_size,
+                                       pair_counts,
+                                       pair_offsets,
+                                       0u,
+                                       pairs + 1,
+                                       ::rocprim::plus<unsigned int>(),
+                                       stream,
+                                       debug_synchronous);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    if(debug_synchronous)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("segmented_set_intersection_write");
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(segmented_set_intersection_kernel<true, config>),
+                       dim3(grid_size),
+                       dim3(block_size),
+                       0,
+                       stream,
+                       keys_input1,
+                       keys_input2,
+                       keys_output,
+                       output_offsets,
+                       static_cast<unsigned int*>(nullptr),
+                       pair_offsets,
+                       pairs,
+                       begin_offsets1,
+                       end_offsets1,
+                       begin_offsets2,
+                       end_offsets2,
+                       compare_function);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_set_intersection_write", pairs, start);
+
+    return hipSuccess;
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
+} // end of detail namespace
+
+/// \brief Parallel intersections of many pairs of sorted lists for device level.
+///
+/// \p segmented_set_intersection intersects every pair of a batch of pairs of sorted lists, like
+/// \p set_intersection does for a single pair, in a fixed number of launches. It is meant for
+/// many small pairs, for example the posting lists of the terms of many queries.
+///
+/// \par Overview
+/// * Pair \p i consists of the keys <tt>[begin_offsets1[i], end_offsets1[i])</tt> of
+/// \p keys_input1 and <tt>[begin_offsets2[i], end_offsets2[i])</tt> of \p keys_input2, both
+/// sorted by \p compare_function. A key with \p m copies in the first and \p n copies in the
+/// second list is stored \p min(m,n) times, the copies are taken from the first list.
+/// * The intersections are stored one after the other: intersection \p i is
+/// <tt>[output_offsets[i], output_offsets[i + 1])</tt> of \p keys_output, and
+/// <tt>output_offsets[pairs]</tt> is the total number of stored keys. \p keys_output must be
+/// large enough for the keys of the first lists of all pairs.
+/// * A counting pass computes the sizes of the intersections, their exclusive scan gives
+/// \p output_offsets, and a writing pass stores the keys. Pairs whose first list is not longer
+/// than \p large_pair_threshold of the config are intersected by one logical warp each, longer
+/// pairs by a block. The searches in the second lists gallop forwards from the previous ones,
+/// so intersecting a short list with a long one costs little more than the short one.
+/// * A pair much larger than the others is intersected by a single block, \p set_intersection
+/// is faster for it.
+/// * Offsets and the total size use 32-bit indices.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// \p segmented_set_intersection_config or a custom class with the same members.
+/// \tparam KeysInputIterator1 - random-access iterator type of the first lists. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysInputIterator2 - random-access iterator type of the second lists. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OutputOffsetIterator - random-access iterator type of the output offsets. Must meet
+/// the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator1 - random-access iterator type of the offsets of the first lists. It
+/// can be a simple pointer type.
+/// \tparam OffsetIterator2 - random-access iterator type of the offsets of the second lists. It
+/// can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input1 - iterator to the first key of the first lists.
+/// \param [in] keys_input2 - iterator to the first key of the second lists.
+/// \param [out] keys_output - iterator to the first key of the output range.
+/// \param [out] output_offsets - iterator to the <tt>pairs + 1</tt> offsets of the
+/// intersections in \p keys_output.
+/// \param [in] pairs - number of pairs.
+/// \param [in] begin_offsets1 - iterator to the first element in the range of beginning
+/// offsets of the first lists.
+/// \param [in] end_offsets1 - iterator to the first element in the range of ending offsets of
+/// the first lists.
+/// \param [in] begin_offsets2 - iterator to the first element in the range of beginning
+/// offsets of the second lists.
+/// \param [in] end_offsets2 - iterator to the first element in the range of ending offsets of
+/// the second lists.
+/// \param [in] compare_function - binary operation function object that will be used for
+/// comparison. The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int   pairs;          // e.g., 3
+/// int *          keys_input1;    // e.g., [1, 2, 3, 5, 5, 7, 9]
+/// int *          keys_input2;    // e.g., [2, 3, 4, 5, 1]
+/// unsigned int * begin_offsets1; // e.g., [0, 3, 6]
+/// unsigned int * end_offsets1;   // e.g., [3, 6, 7]
+/// unsigned int * begin_offsets2; // e.g., [0, 3, 4]
+/// unsigned int * end_offsets2;   // e.g., [3, 4, 5]
+/// int *          keys_output;    // empty array of 7 elements
+/// unsigned int * output_offsets; // empty array of 4 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::segmented_set_intersection(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input1, keys_input2, keys_output, output_offsets, pairs,
+///     begin_offsets1, end_offsets1, begin_offsets2, end_offsets2
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // intersect
+/// rocprim::segmented_set_intersection(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input1, keys_input2, keys_output, output_offsets, pairs,
+///     begin_offsets1, end_offsets1, begin_offsets2, end_offsets2
+/// );
+/// // keys_output:    [2, 3, 5]
+/// // output_offsets: [0, 2, 3, 3]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class KeysOutputIterator,
+         class OutputOffsetIterator,
+         class OffsetIterator1,
+         class OffsetIterator2,
+         class BinaryFunction
+         = ::rocprim::less<typename std::iterator_traits<KeysInputIterator1>::value_type>>
+inline hipError_t segmented_set_intersection(void*                temporary_storage,
+                                             size_t&              storage_size,
+                                             KeysInputIterator1   keys_input1,
+                                             KeysInputIterator2   keys_input2,
+                                             KeysOutputIterator   keys_output,
+                                             OutputOffsetIterator output_offsets,
+                                             unsigned int         pairs,
+                                             OffsetIterator1      begin_offsets1,
+                                             OffsetIterator1      end_offsets1,
+                                             OffsetIterator2      begin_offsets2,
+                                             OffsetIterator2      end_offsets2,
+                                             BinaryFunction   compare_function = BinaryFunction(),
+                                             hipStream_t      stream            = 0,
+                                             bool             debug_synchronous = false)
+{
+    return detail::segmented_set_intersection_impl<Config>(temporary_storage,
+                                                           storage_size,
+                                                           keys_input1,
+                                                           keys_input2,
+                                                           keys_output,
+                                                           output_offsets,
+                                                           pairs,
+                                                           begin_offsets1,
+                                                           end_offsets1,
+                                                           begin_offsets2,
+                                                           end_offsets2,
+                                                           compare_function,
+                                                           stream,
+                                                           debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_SEGMENTED_SET_OPERATIONS_HPP_
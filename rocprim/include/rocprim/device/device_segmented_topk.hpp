@@ -0,0 +1,783 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_SEGMENTED_TOPK_HPP_
+#define ROCPRIM_DEVICE_DEVICE_SEGMENTED_TOPK_HPP_
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/radix_sort.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../iterator/counting_iterator.hpp"
+#include "../iterator/reverse_iterator.hpp"
+#include "../iterator/transform_iterator.hpp"
+#include "../types.hpp"
+
+#include "config_types.hpp"
+#include "detail/device_segmented_topk.hpp"
+#include "device_partition.hpp"
+#include "device_segmented_radix_sort.hpp"
+#include "instrumentation.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+/// \brief Configuration of the segmented top-k primitives.
+///
+/// \tparam BlockSize - number of threads in a block that selects the items of a long segment.
+/// \tparam ItemsPerThread - number of items processed by each thread of such a block at once.
+/// \tparam LogicalWarpSize - number of threads in a logical warp that sorts a short segment.
+/// \tparam WarpItemsPerThread - number of items processed by each thread of such a warp.
+/// Segments of at most <tt>LogicalWarpSize * WarpItemsPerThread</tt> items are short.
+/// \tparam WarpBlockSize - number of threads in a block of logical warps.
+/// \tparam SortConfig - configuration of the segmented radix sort of the selected items of the
+/// long segments.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         unsigned int LogicalWarpSize,
+         unsigned int WarpItemsPerThread,
+         unsigned int WarpBlockSize = 256,
+         class SortConfig           = default_config>
+struct segmented_topk_config
+{
+    /// \brief Number of threads in a block that selects the items of a long segment.
+    static constexpr unsigned int block_size = BlockSize;
+    /// \brief Number of items processed by each thread of such a block at once.
+    static constexpr unsigned int items_per_thread = ItemsPerThread;
+    /// \brief Number of threads in a logical warp that sorts a short segment.
+    static constexpr unsigned int logical_warp_size = LogicalWarpSize;
+    /// \brief Number of items processed by each thread of such a warp.
+    static constexpr unsigned int warp_items_per_thread = WarpItemsPerThread;
+    /// \brief Number of threads in a block of logical warps.
+    static constexpr unsigned int warp_block_size = WarpBlockSize;
+    /// \brief Configuration of the segmented radix sort of the selected items.
+    using sort_config = SortConfig;
+};
+
+namespace detail
+{
+
+template<class WarpSortHelperConfig,
+         bool              Descending,
+         radix_float_order FloatOrder,
+         unsigned int      BlockSize,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class SegmentIndexIterator,
+         class OffsetIterator>
+ROCPRIM_KERNEL __launch_bounds__(BlockSize) void segmented_topk_small_kernel(
+    KeysInputIterator    keys_input,
+    KeysOutputIterator   keys_output,
+    ValuesInputIterator  values_input,
+    ValuesOutputIterator values_output,
+    const unsigned int   num_segments,
+    SegmentIndexIterator segment_indices,
+    OffsetIterator       begin_offsets,
+    OffsetIterator       end_offsets,
+    const unsigned int   k)
+{
+    segmented_topk_small<WarpSortHelperConfig, Descending, FloatOrder>(keys_input,
+                                                                      keys_output,
+                                                                      values_input,
+                                                                      values_output,
+                                                                      num_segments,
+                                                                      segment_indices,
+                                                                      begin_offsets,
+                                                                      end_offsets,
+                                                                      k);
+}
+
+template<class Config,
+         class KeyCodec,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class SegmentIndexIterator,
+         class OffsetIterator>
+ROCPRIM_KERNEL __launch_bounds__(Config::block_size) void segmented_topk_select_kernel(
+    KeysInputIterator                                               keys_input,
+    typename std::iterator_traits<KeysInputIterator>::value_type*   keys_buffer,
+    ValuesInputIterator                                             values_input,
+    typename std::iterator_traits<ValuesInputIterator>::value_type* values_buffer,
+    SegmentIndexIterator                                            segment_indices,
+    OffsetIterator                                                  begin_offsets,
+    OffsetIterator                                                  end_offsets,
+    const unsigned int                                              k)
+{
+    segmented_topk_select<Config::block_size, Config::items_per_thread, KeyCodec>(
+        keys_input,
+        keys_buffer,
+        values_input,
+        values_buffer,
+        segment_indices,
+        begin_offsets,
+        end_offsets,
+        k);
+}
+
+// Selects the segments that are too long for a logical warp
+template<class OffsetIterator>
+struct segmented_topk_long_segment_op
+{
+    OffsetIterator begin_offsets;
+    OffsetIterator end_offsets;
+    unsigned int   max_small_segment_length;
+
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    bool operator()(const unsigned int segment) const
+    {
+        OffsetIterator     begin_offsets_it = begin_offsets;
+        OffsetIterator     end_offsets_it   = end_offsets;
+        const unsigned int begin            = begin_offsets_it[segment];
+        const unsigned int end              = end_offsets_it[segment];
+        return end > begin && end - begin > max_small_segment_length;
+    }
+};
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start)                           \
+    {                                                                                            \
+        auto _error = hipGetLastError();                                                         \
+        if(_error != hipSuccess)                                                                 \
+            return _error;                                                                       \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size);                                          \
+        if(debug_synchronous)                                                                    \
+        {                                                                                        \
+            std::cout << name << "(" << size << ")";                                             \
+            auto __error = hipStreamSynchronize(stream);                                         \
+            if(__error != hipSuccess)                                                            \
+                return __error;                                                                  \
+            auto _end = std::chrono::high_resolution_clock::now();                               \
+            auto _d = std::chrono::duration_cast<std::chrono::duration<double>>(_end - start);   \
+            std::cout << " " << _d.count() * 1000 << " ms" << '\n';                              \
+        }                                                                                        \
+    }
+
+template<class Config,
+         bool              Descending,
+         radix_float_order FloatOrder,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class OffsetIterator>
+inline hipError_t segmented_topk_impl(void*                temporary_storage,
+                                      size_t&              storage_size,
+                                      KeysInputIterator    keys_input,
+                                      KeysOutputIterator   keys_output,
+                                      ValuesInputIterator  values_input,
+                                      ValuesOutputIterator values_output,
+                                      const unsigned int   segments,
+                                      OffsetIterator       begin_offsets,
+                                      OffsetIterator       end_offsets,
+                                      const unsigned int   k,
+                                      const hipStream_t    stream,
+                                      const bool           debug_synchronous)
+{
+    using key_type           = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type         = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    using key_codec          = radix_key_codec<key_type, Descending, FloatOrder>;
+    using segment_index_type = unsigned int;
+    using buffer_offset_op   = segmented_topk_buffer_offset_op<OffsetIterator>;
+    using buffer_offset_iterator
+        = transform_iterator<counting_iterator<unsigned int>, buffer_offset_op, unsigned int>;
+
+    using config = default_or_custom_config<Config, segmented_topk_config<256, 8, 32, 4>>;
+
+    using warp_sort_helper_config = WarpSortHelperConfig<config::logical_warp_size,
+                                                         config::warp_items_per_thread,
+                                                         config::warp_block_size>;
+
+    static constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+    static constexpr unsigned int max_small_segment_length
+        = config::logical_warp_size * config::warp_items_per_thread;
+    static constexpr unsigned int small_segments_per_block
+        = config::warp_block_size / config::logical_warp_size;
+
+    // The outputs of every segment start at segment * k
+    const size_t buffer_size = size_t(segments) * k;
+    if(buffer_size > std::numeric_limits<unsigned int>::max())
+    {
+        return hipErrorInvalidValue;
+    }
+
+    const segmented_topk_long_segment_op<OffsetIterator> long_segment_op{
+        begin_offsets,
+        end_offsets,
+        max_small_segment_length};
+    const buffer_offset_iterator buffer_begin_offsets(
+        counting_iterator<unsigned int>(0),
+        buffer_offset_op{begin_offsets, end_offsets, k, max_small_segment_length, false});
+    const buffer_offset_iterator buffer_end_offsets(
+        counting_iterator<unsigned int>(0),
+        buffer_offset_op{begin_offsets, end_offsets, k, max_small_segment_length, true});
+
+    // The long segments are stored from the front and the short ones from the back
+    segment_index_type* segment_indices{};
+    segment_index_type* long_segment_count_output{};
+    key_type*           keys_buffer{};
+    value_type*         values_buffer{};
+    void*               partition_storage{};
+    size_t              partition_storage_size = 0;
+    void*               sort_storage{};
+    size_t              sort_storage_size = 0;
+
+    hipError_t result = ::rocprim::partition(nullptr,
+                                             partition_storage_size,
+                                             counting_iterator<segment_index_type>(0),
+                                             segment_indices,
+                                             long_segment_count_output,
+                                             segments,
+                                             long_segment_op,
+                                             stream,
+                                             debug_synchronous);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    bool ignored;
+    result = segmented_radix_sort_impl<typename config::sort_config,
+                                       Descending,
+                                       FloatOrder,
+                                       ::rocprim::identity_decomposer>(nullptr,
+                                                                       sort_storage_size,
+                                                                       keys_buffer,
+                                                                       nullptr,
+                                                                       keys_output,
+                                                                       values_buffer,
+                                                                       nullptr,
+                                                                       values_output,
+                                                                       buffer_size,
+                                                                       ignored,
+                                                                       segments,
+                                                                       buffer_begin_offsets,
+                                                                       buffer_end_offsets,
+                                                                       0,
+                                                                       key_codec::key_bits,
+                                                                       stream,
+                                                                       debug_synchronous);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&segment_indices, segments),
+            detail::temp_storage::ptr_aligned_array(&long_segment_count_output, 1),
+            detail::temp_storage::ptr_aligned_array(&keys_buffer, buffer_size),
+            detail::temp_storage::ptr_aligned_array(&values_buffer,
+                                                    with_values ? buffer_size : 0),
+            // The segments are partitioned before the selected items are sorted
+            detail::temp_storage::make_union_partition(
+                detail::temp_storage::make_partition(&partition_storage, partition_storage_size),
+                detail::temp_storage::make_partition(&sort_storage, sort_storage_size))));
+    if(result != hipSuccess || temporary_storage == nullptr)
+    {
+        return result;
+    }
+
+    if(segments == 0 || k == 0)
+    {
+        return hipSuccess;
+    }
+
+    result = ::rocprim::partition(partition_storage,
+                                  partition_storage_size,
+                                  counting_iterator<segment_index_type>(0),
+                                  segment_indices,
+                                  long_segment_count_output,
+                                  segments,
+                                  long_segment_op,
+                                  stream,
+                                  debug_synchronous);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    segment_index_type long_segment_count;
+    result = detail::memcpy_and_sync(&long_segment_count,
+                                     long_segment_count_output,
+                                     sizeof(segment_index_type),
+                                     hipMemcpyDeviceToHost,
+                                     stream);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const segment_index_type small_segment_count = segments - long_segment_count;
+    if(debug_synchronous)
+    {
+        std::cout << "k " << k << '\n';
+        std::cout << "long_segment_count " << long_segment_count << '\n';
+        std::cout << "small_segment_count " << small_segment_count << '\n';
+    }
+
+    std::chrono::high_resolution_clock::time_point start;
+    if(small_segment_count > 0)
+    {
+        const unsigned int small_segment_grid_size
+            = ::rocprim::detail::ceiling_div(small_segment_count, small_segments_per_block);
+        if(debug_synchronous)
+        {
+            start = std::chrono::high_resolution_clock::now();
+        }
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("segmented_topk_small_kernel");
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(segmented_topk_small_kernel<warp_sort_helper_config,
+                                                                       Descending,
+                                                                       FloatOrder,
+                                                                       config::warp_block_size>),
+                           dim3(small_segment_grid_size),
+                           dim3(config::warp_block_size),
+                           0,
+                           stream,
+                           keys_input,
+                           keys_output,
+                           values_input,
+                           values_output,
+                           small_segment_count,
+                           make_reverse_iterator(segment_indices + segments),
+                           begin_offsets,
+                           end_offsets,
+                           k);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_topk_small_kernel",
+                                                    small_segment_count,
+                                                    start);
+    }
+
+    if(long_segment_count > 0)
+    {
+        if(debug_synchronous)
+        {
+            start = std::chrono::high_resolution_clock::now();
+        }
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("segmented_topk_select_kernel");
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(segmented_topk_select_kernel<config, key_codec>),
+                           dim3(long_segment_count),
+                           dim3(config::block_size),
+                           0,
+                           stream,
+                           keys_input,
+                           keys_buffer,
+                           values_input,
+                           values_buffer,
+                           segment_indices,
+                           begin_offsets,
+                           end_offsets,
+                           k);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_topk_select_kernel",
+                                                    long_segment_count,
+                                                    start);
+
+        // Only the selected items of the long segments are sorted, the ranges of the short
+        // segments are empty
+        result = segmented_radix_sort_impl<typename config::sort_config,
+                                           Descending,
+                                           FloatOrder,
+                                           ::rocprim::identity_decomposer>(sort_storage,
+                                                                           sort_storage_size,
+                                                                           keys_buffer,
+                                                                           nullptr,
+                                                                           keys_output,
+                                                                           values_buffer,
+                                                                           nullptr,
+                                                                           values_output,
+                                                                           buffer_size,
+                                                                           ignored,
+                                                                           segments,
+                                                                           buffer_begin_offsets,
+                                                                           buffer_end_offsets,
+                                                                           0,
+                                                                           key_codec::key_bits,
+                                                                           stream,
+                                                                           debug_synchronous);
+        if(result != hipSuccess)
+        {
+            return result;
+        }
+    }
+
+    return hipSuccess;
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
+} // namespace detail
+
+/// \brief Parallel segmented top-k primitive for device level.
+///
+/// \p segmented_topk_keys function selects the \p k smallest keys of every segment and stores
+/// them in ascending order to <tt>keys_output[segment * k]</tt> onward.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * \p Key type (a \p value_type of \p KeysInputIterator and \p KeysOutputIterator) must be
+/// an arithmetic type (that is, an integral type or a floating-point type).
+/// * Ranges specified by \p begin_offsets and \p end_offsets must have
+/// at least \p segments elements. They may use the same sequence <tt>offsets</tt> of at least
+/// <tt>segments + 1</tt> elements: <tt>offsets</tt> for \p begin_offsets and
+/// <tt>offsets + 1</tt> for \p end_offsets.
+/// * Range specified by \p keys_output must have at least <tt>segments * k</tt> elements, and
+/// <tt>segments * k</tt> must be less than \p 2^32. Segments shorter than \p k store all their
+/// keys, the elements after them are not written.
+/// * Keys are compared in the same way as in \p segmented_radix_sort_keys. If several keys are
+/// equal to the k-th key of a segment, the ones that come first in the input are selected.
+/// * Segments that fit into a logical warp are sorted by the warp sort of the segmented radix
+/// sort. In longer segments, the k-th key is found by a block-wide radix select, which stops as
+/// soon as all keys sharing the digits found so far are needed; then only the selected keys are
+/// sorted by the segmented radix sort.
+/// * The temporary storage holds <tt>segments * k</tt> selected keys, and as many keys for the
+/// sort of the selected keys.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// \p segmented_topk_config or a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to select keys from.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] k - number of keys to select from every segment.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful selection; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the 2 smallest keys of every segment are selected.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// int * input;            // e.g., [6, 3, 5, 4, 2, 8, 1, 7]
+/// int * output;           // empty array of 6 elements
+/// unsigned int segments;  // e.g., 3
+/// int * offsets;          // e.g. [0, 3, 4, 8]
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::segmented_topk_keys(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, segments, offsets, offsets + 1, 2
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform selection
+/// rocprim::segmented_topk_keys(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, segments, offsets, offsets + 1, 2
+/// );
+/// // output: [3, 5, 4, -, 1, 2], the element after the single key of the second segment is
+/// // not written
+/// \endcode
+/// \endparblock
+template<class Config                = default_config,
+         radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class OffsetIterator>
+inline hipError_t segmented_topk_keys(void*              temporary_storage,
+                                      size_t&            storage_size,
+                                      KeysInputIterator  keys_input,
+                                      KeysOutputIterator keys_output,
+                                      const unsigned int segments,
+                                      OffsetIterator     begin_offsets,
+                                      OffsetIterator     end_offsets,
+                                      const unsigned int k,
+                                      const hipStream_t  stream            = 0,
+                                      bool               debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::segmented_topk_impl<Config, false, FloatOrder>(temporary_storage,
+                                                                  storage_size,
+                                                                  keys_input,
+                                                                  keys_output,
+                                                                  values,
+                                                                  values,
+                                                                  segments,
+                                                                  begin_offsets,
+                                                                  end_offsets,
+                                                                  k,
+                                                                  stream,
+                                                                  debug_synchronous);
+}
+
+/// \brief Parallel descending segmented top-k primitive for device level.
+///
+/// \p segmented_topk_keys_desc function selects the \p k largest keys of every segment and
+/// stores them in descending order to <tt>keys_output[segment * k]</tt> onward.
+///
+/// \par Overview
+/// * Keys are compared in the same way as in \p segmented_radix_sort_keys_desc. If several keys
+/// are equal to the k-th key of a segment, the ones that come first in the input are selected.
+/// * Everything else is the same as in \p segmented_topk_keys.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// \p segmented_topk_config or a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to select keys from.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] k - number of keys to select from every segment.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful selection; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config                = default_config,
+         radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class OffsetIterator>
+inline hipError_t segmented_topk_keys_desc(void*              temporary_storage,
+                                           size_t&            storage_size,
+                                           KeysInputIterator  keys_input,
+                                           KeysOutputIterator keys_output,
+                                           const unsigned int segments,
+                                           OffsetIterator     begin_offsets,
+                                           OffsetIterator     end_offsets,
+                                           const unsigned int k,
+                                           const hipStream_t  stream            = 0,
+                                           bool               debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::segmented_topk_impl<Config, true, FloatOrder>(temporary_storage,
+                                                                 storage_size,
+                                                                 keys_input,
+                                                                 keys_output,
+                                                                 values,
+                                                                 values,
+                                                                 segments,
+                                                                 begin_offsets,
+                                                                 end_offsets,
+                                                                 k,
+                                                                 stream,
+                                                                 debug_synchronous);
+}
+
+/// \brief Parallel segmented top-k primitive for device level.
+///
+/// \p segmented_topk_pairs function selects the (key, value) pairs with the \p k smallest keys
+/// of every segment and stores them in ascending order of keys to
+/// <tt>keys_output[segment * k]</tt> and <tt>values_output[segment * k]</tt> onward.
+///
+/// \par Overview
+/// * Ranges specified by \p keys_output and \p values_output must have at least
+/// <tt>segments * k</tt> elements.
+/// * Everything else is the same as in \p segmented_topk_keys; the temporary storage also holds
+/// the values of the selected pairs.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// \p segmented_topk_config or a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to select keys from.
+/// \param [out] keys_output - pointer to the first element in the output range of keys.
+/// \param [in] values_input - pointer to the first element in the range of values.
+/// \param [out] values_output - pointer to the first element in the output range of values.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] k - number of pairs to select from every segment.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful selection; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config                = default_config,
+         radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class OffsetIterator>
+inline hipError_t segmented_topk_pairs(void*                temporary_storage,
+                                       size_t&              storage_size,
+                                       KeysInputIterator    keys_input,
+                                       KeysOutputIterator   keys_output,
+                                       ValuesInputIterator  values_input,
+                                       ValuesOutputIterator values_output,
+                                       const unsigned int   segments,
+                                       OffsetIterator       begin_offsets,
+                                       OffsetIterator       end_offsets,
+                                       const unsigned int   k,
+                                       const hipStream_t    stream            = 0,
+                                       bool                 debug_synchronous = false)
+{
+    return detail::segmented_topk_impl<Config, false, FloatOrder>(temporary_storage,
+                                                                  storage_size,
+                                                                  keys_input,
+                                                                  keys_output,
+                                                                  values_input,
+                                                                  values_output,
+                                                                  segments,
+                                                                  begin_offsets,
+                                                                  end_offsets,
+                                                                  k,
+                                                                  stream,
+                                                                  debug_synchronous);
+}
+
+/// \brief Parallel descending segmented top-k primitive for device level.
+///
+/// \p segmented_topk_pairs_desc function selects the (key, value) pairs with the \p k largest
+/// keys of every segment and stores them in descending order of keys to
+/// <tt>keys_output[segment * k]</tt> and <tt>values_output[segment * k]</tt> onward.
+///
+/// \par Overview
+/// * Keys are compared in the same way as in \p segmented_radix_sort_pairs_desc. If several keys
+/// are equal to the k-th key of a segment, the ones that come first in the input are selected.
+/// * Everything else is the same as in \p segmented_topk_pairs.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// \p segmented_topk_config or a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to select keys from.
+/// \param [out] keys_output - pointer to the first element in the output range of keys.
+/// \param [in] values_input - pointer to the first element in the range of values.
+/// \param [out] values_output - pointer to the first element in the output range of values.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] k - number of pairs to select from every segment.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful selection; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config                = default_config,
+         radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class OffsetIterator>
+inline hipError_t segmented_topk_pairs_desc(void*                temporary_storage,
+                                            size_t&              storage_size,
+                                            KeysInputIterator    keys_input,
+                                            KeysOutputIterator   keys_output,
+                                            ValuesInputIterator  values_input,
+                                            ValuesOutputIterator values_output,
+                                            const unsigned int   segments,
+                                            OffsetIterator       begin_offsets,
+                                            OffsetIterator       end_offsets,
+                                            const unsigned int   k,
+                                            const hipStream_t    stream            = 0,
+                                            bool                 debug_synchronous = false)
+{
+    return detail::segmented_topk_impl<Config, true, FloatOrder>(temporary_storage,
+                                                                 storage_size,
+                                                                 keys_input,
+                                                                 keys_output,
+                                                                 values_input,
+                                                                 values_output,
+                                                                 segments,
+                                                                 begin_offsets,
+                                                                 end_offsets,
+                                                                 k,
+                                                                 stream,
+                                                                 debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_SEGMENTED_TOPK_HPP_
@@ -28,10 +28,16 @@
 #include "../detail/various.hpp"
 #include "../detail/binary_op_wrappers.hpp"
 
+#include "../iterator/constant_iterator.hpp"
 #include "../iterator/transform_iterator.hpp"
+#include "../iterator/zip_iterator.hpp"
+#include "../types/tuple.hpp"
 
 #include "device_scan.hpp"
 #include "device_partition.hpp"
+#include "device_reduce.hpp"
+#include "device_reduce_by_key.hpp"
+#include "device_reduce_by_key_columns.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -41,6 +47,63 @@ BEGIN_ROCPRIM_NAMESPACE
 namespace detail
 {
 
+// Maps a (value, previous value) pair to 1 if the values are not equivalent, so the sum is
+// the number of heads of groups of equivalent values (without the first head).
+template<class EqualityOp>
+struct unique_count_head_op
+{
+    EqualityOp equality_op;
+
+    template<class T>
+    ROCPRIM_HOST_DEVICE inline
+    size_t operator()(const ::rocprim::tuple<T, T>& values) const
+    {
+        return equality_op(::rocprim::get<1>(values), ::rocprim::get<0>(values)) ? 0 : 1;
+    }
+};
+
+// Counts the groups of equivalent consecutive values as a reduction of the discontinuities,
+// no output is written except for the count.
+template<class Config, class InputIterator, class CountOutputIterator, class EqualityOp>
+inline hipError_t unique_count_impl(void*               temporary_storage,
+                                    size_t&             storage_size,
+                                    InputIterator       input,
+                                    CountOutputIterator count_output,
+                                    const size_t        size,
+                                    EqualityOp          equality_op,
+                                    const hipStream_t   stream,
+                                    const bool          debug_synchronous)
+{
+    // The first value is always a head, it is the initial value of the reduction
+    const size_t first_head = size == 0 ? 0 : 1;
+    const size_t pairs      = size == 0 ? 0 : size - 1;
+
+    const auto heads = ::rocprim::make_transform_iterator(
+        ::rocprim::make_zip_iterator(::rocprim::make_tuple(input + 1, input)),
+        unique_count_head_op<EqualityOp>{equality_op});
+
+    return ::rocprim::reduce<Config>(temporary_storage,
+                                     storage_size,
+                                     heads,
+                                     count_output,
+                                     first_head,
+                                     pairs,
+                                     ::rocprim::plus<size_t>(),
+                                     stream,
+                                     debug_synchronous);
+}
+
+// Keeps the first value of a group, it is the reduction of the values of unique_by_key
+struct unique_first_value_op
+{
+    template<class T>
+    ROCPRIM_HOST_DEVICE inline
+    T operator()(const T& first, const T& /*other*/) const
+    {
+        return first;
+    }
+};
+
 } // end detail namespace
 
 /// \brief Parallel select primitive for device level using range of flags.
@@ -56,6 +119,7 @@ namespace detail
 /// * Ranges specified by \p input and \p flags must have at least \p size elements.
 /// * Range specified by \p output must have at least so many elements, that all positively
 /// flagged values can be copied into it.
+/// * \p output can be the same as \p input, the selection is then done in place.
 /// * Range specified by \p selected_count_output must have at least 1 element.
 /// * Values of \p flag range should be implicitly convertible to `bool` type.
 ///
@@ -148,7 +212,9 @@ hipError_t select(void * temporary_storage,
     rocprim::empty_type* const no_values = nullptr; // key only
 
     return detail::partition_impl<detail::select_method::flag, true, Config, offset_type>(
-        temporary_storage, storage_size, input, no_values, flags, output, no_values, selected_count_output,
+        temporary_storage, storage_size,
+        detail::to_kernel_input_iterator(input), no_values, detail::to_kernel_input_iterator(flags),
+        output, no_values, selected_count_output,
         size, inequality_op_type(), stream, debug_synchronous, unary_predicate_type()
     );
 }
@@ -165,6 +231,7 @@ hipError_t select(void * temporary_storage,
 /// * Range specified by \p input must have at least \p size elements.
 /// * Range specified by \p output must have at least so many elements, that all selected
 /// values can be copied into it.
+/// * \p output can be the same as \p input, the selection is then done in place.
 /// * Range specified by \p selected_count_output must have at least 1 element.
 ///
 /// \tparam Config - [optional] configuration of the primitive. It can be \p select_config or
@@ -262,8 +329,138 @@ hipError_t select(void * temporary_storage,
     rocprim::empty_type* const no_values = nullptr; // key only
 
     return detail::partition_impl<detail::select_method::predicate, true, Config, offset_type>(
-        temporary_storage, storage_size, input, no_values, flags, output, no_values, selected_count_output,
-        size, inequality_op_type(), stream, debug_synchronous, predicate
+        temporary_storage, storage_size,
+        detail::to_kernel_input_iterator(input), no_values, flags, output, no_values,
+        selected_count_output, size, inequality_op_type(), stream, debug_synchronous, predicate
+    );
+}
+
+/// \brief Parallel fused transform, select and inclusive scan primitive for device level.
+///
+/// Transforms every value \p x from \p input to <tt>transform_op(x)</tt>, selects the transformed
+/// values \p y for which <tt>predicate(y)</tt> returns \p true, copies them into \p output and
+/// writes the inclusive scan of the selected values into \p scan_output. It is equivalent to
+/// \p transform, \p select and \p inclusive_scan, but the whole operation is one decoupled
+/// look-back pass, so neither the transformed values nor the compacted values are stored in
+/// temporary buffers.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Range specified by \p input must have at least \p size elements.
+/// * Ranges specified by \p output and \p scan_output must have at least so many elements,
+/// that all selected values can be copied into them. Either of them can be a
+/// \p discard_iterator if it is not needed.
+/// * Range specified by \p selected_count_output must have at least 1 element.
+/// * The scan is computed in the type of the transformed values.
+/// * \p scan_op must be associative, it is applied only to selected values.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p select_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. It can be
+/// a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. It can be
+/// a simple pointer type.
+/// \tparam ScanOutputIterator - random-access iterator type of the scan output range. It can be
+/// a simple pointer type.
+/// \tparam SelectedCountOutputIterator - random-access iterator type of the selected_count_output
+/// value. It can be a simple pointer type.
+/// \tparam TransformOp - type of a unary function applied to the input values.
+/// \tparam UnaryPredicate - type of a unary selection predicate.
+/// \tparam BinaryFunction - type of binary function used for scan. Default type
+/// is \p rocprim::plus<T>, where \p T is the type of the transformed values.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to transform and select.
+/// \param [out] output - iterator to the first element in the output range of the selected values.
+/// \param [out] scan_output - iterator to the first element in the output range of the scan.
+/// \param [out] selected_count_output - iterator to the total number of selected values (length of \p output).
+/// \param [in] size - number of element in the input range.
+/// \param [in] transform_op - unary function object that transforms the input values.
+/// \param [in] predicate - unary function object that will be used for selecting the transformed
+/// values. The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the object passed to it.
+/// \param [in] scan_op - binary operation function object that will be used for scan.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \par Example
+/// \parblock
+/// In this example the squares of the input values are computed, the even squares are selected
+/// and their running sum is written.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// auto square    = [] __device__ (int a) -> int { return a * a; };
+/// auto predicate = [] __device__ (int a) -> bool { return (a%2) == 0; };
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;     // e.g., 8
+/// int * input;           // e.g., [1, 2, 3, 4, 5, 6, 7, 8]
+/// int * output;          // empty array of 8 elements
+/// int * scan_output;     // empty array of 8 elements
+/// size_t * output_count; // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::transform_select_inclusive_scan(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, scan_output, output_count, input_size,
+///     square, predicate
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform the operation
+/// rocprim::transform_select_inclusive_scan(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, scan_output, output_count, input_size,
+///     square, predicate
+/// );
+/// // output: [4, 16, 36, 64]
+/// // scan_output: [4, 20, 56, 120]
+/// // output_count: 4
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class InputIterator,
+    class OutputIterator,
+    class ScanOutputIterator,
+    class SelectedCountOutputIterator,
+    class TransformOp,
+    class UnaryPredicate,
+    class BinaryFunction = ::rocprim::plus<typename ::rocprim::detail::invoke_result<
+        TransformOp,
+        typename std::iterator_traits<InputIterator>::value_type>::type>
+>
+inline
+hipError_t transform_select_inclusive_scan(void * temporary_storage,
+                                           size_t& storage_size,
+                                           InputIterator input,
+                                           OutputIterator output,
+                                           ScanOutputIterator scan_output,
+                                           SelectedCountOutputIterator selected_count_output,
+                                           const size_t size,
+                                           TransformOp transform_op,
+                                           UnaryPredicate predicate,
+                                           BinaryFunction scan_op = BinaryFunction(),
+                                           const hipStream_t stream = 0,
+                                           const bool debug_synchronous = false)
+{
+    return detail::transform_select_scan_impl<Config>(
+        temporary_storage, storage_size,
+        detail::to_kernel_input_iterator(input), output, scan_output, selected_count_output,
+        size, transform_op, predicate, scan_op, stream, debug_synchronous
     );
 }
 
@@ -278,6 +475,7 @@ hipError_t select(void * temporary_storage,
 /// * Range specified by \p input must have at least \p size elements.
 /// * Range specified by \p output must have at least so many elements, that all selected
 /// values can be copied into it.
+/// * \p output can be the same as \p input, the selection is then done in place.
 /// * Range specified by \p unique_count_output must have at least 1 element.
 /// * By default <tt>InputIterator::value_type</tt>'s equality operator is used to check
 /// if elements are equivalent.
@@ -371,11 +569,209 @@ hipError_t unique(void * temporary_storage,
     auto inequality_op = detail::inequality_wrapper<EqualityOp>(equality_op);
 
     return detail::partition_impl<detail::select_method::unique, true, Config, offset_type>(
-        temporary_storage, storage_size, input, no_values, flags, output, no_values, unique_count_output,
+        temporary_storage, storage_size,
+        detail::to_kernel_input_iterator(input), no_values, flags, output, no_values,
+        unique_count_output,
         size, inequality_op, stream, debug_synchronous, unary_predicate_type()
     );
 }
 
+/// \brief Device-level parallel unique primitive, which also counts the duplicates.
+///
+/// unique_with_counts selects the first element of every group of consecutive equivalent
+/// elements like \p unique, and writes the number of elements of the group to
+/// \p counts_output. Both outputs are computed from the same segment heads in a single
+/// look-back pass, without a separate \p run_length_encode.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * Range specified by \p input must have at least \p size elements.
+/// * Ranges specified by \p output and \p counts_output must have at least as many elements as
+/// there are unique values, which is written to \p unique_count_output.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// \p reduce_by_key_config_v2 or \p default_config.
+/// \tparam InputIterator - random-access iterator type of the input range. It can be
+/// a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. It can be
+/// a simple pointer type.
+/// \tparam CountsOutputIterator - random-access iterator type of the output range of the counts,
+/// its elements must be assignable from \p unsigned \p int. It can be a simple pointer type.
+/// \tparam UniqueCountOutputIterator - random-access iterator type of the unique_count_output
+/// value used to return number of unique values. It can be a simple pointer type.
+/// \tparam EqualityOp - type of an binary operator used to compare values for equality.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the unique operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to select values from.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [out] counts_output - iterator to the first element in the output range of the
+/// numbers of elements of the groups.
+/// \param [out] unique_count_output - iterator to the total number of selected values.
+/// \param [in] size - number of element in the input range.
+/// \param [in] equality_op - [optional] binary function object used to compare input values
+/// for equality. The default is \p rocprim::equal_to<T>.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;         // e.g., 8
+/// int * input;               // e.g., [1, 4, 2, 4, 4, 7, 7, 7]
+/// int * output;              // empty array of at least 5 elements
+/// unsigned int * counts;     // empty array of at least 5 elements
+/// size_t * output_count;     // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::unique_with_counts(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, counts, output_count, input_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform unique operation
+/// rocprim::unique_with_counts(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, counts, output_count, input_size
+/// );
+/// // output: [1, 4, 2, 4, 7]
+/// // counts: [1, 1, 1, 2, 3]
+/// // output_count: 5
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class InputIterator,
+    class OutputIterator,
+    class CountsOutputIterator,
+    class UniqueCountOutputIterator,
+    class EqualityOp = ::rocprim::equal_to<typename std::iterator_traits<InputIterator>::value_type>
+>
+inline
+hipError_t unique_with_counts(void * temporary_storage,
+                              size_t& storage_size,
+                              InputIterator input,
+                              OutputIterator output,
+                              CountsOutputIterator counts_output,
+                              UniqueCountOutputIterator unique_count_output,
+                              const size_t size,
+                              EqualityOp equality_op = EqualityOp(),
+                              const hipStream_t stream = 0,
+                              const bool debug_synchronous = false)
+{
+    // Every element adds one to the count of its group
+    return detail::reduce_by_key::reduce_by_key_impl<Config>(
+        temporary_storage, storage_size,
+        detail::to_kernel_input_iterator(input),
+        ::rocprim::constant_iterator<unsigned int>(1),
+        size, output, counts_output, unique_count_output,
+        ::rocprim::plus<unsigned int>(), equality_op, stream, debug_synchronous
+    );
+}
+
+/// \brief Device-level parallel unique count primitive.
+///
+/// unique_count counts the groups of consecutive equivalent elements in the given \p input
+/// range, which is the number of values \p unique would select. No other output is written.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * Range specified by \p input must have at least \p size elements.
+/// * Range specified by \p unique_count_output must have at least 1 element.
+/// * By default <tt>InputIterator::value_type</tt>'s equality operator is used to check
+/// if elements are equivalent.
+/// * The count is computed by \p reduce over the discontinuities of the input.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p reduce_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. It can be
+/// a simple pointer type.
+/// \tparam UniqueCountOutputIterator - random-access iterator type of the unique_count_output
+/// value used to return number of unique values. It can be a simple pointer type.
+/// \tparam EqualityOp - type of an binary operator used to compare values for equality.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range of values.
+/// \param [out] unique_count_output - iterator to the number of unique values.
+/// \param [in] size - number of element in the input range.
+/// \param [in] equality_op - [optional] binary function object used to compare input values for equality.
+/// The signature of the function should be equivalent to the following:
+/// <tt>bool equal_to(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the object passed to it.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level unique count operation is performed on an array of integer values.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;     // e.g., 8
+/// int * input;           // e.g., [1, 4, 2, 4, 4, 7, 7, 7]
+/// size_t * output_count; // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::unique_count(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output_count, input_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform unique count operation
+/// rocprim::unique_count(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output_count, input_size
+/// );
+/// // output_count: 5
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class InputIterator,
+    class UniqueCountOutputIterator,
+    class EqualityOp = ::rocprim::equal_to<typename std::iterator_traits<InputIterator>::value_type>
+>
+inline
+hipError_t unique_count(void * temporary_storage,
+                        size_t& storage_size,
+                        InputIterator input,
+                        UniqueCountOutputIterator unique_count_output,
+                        const size_t size,
+                        EqualityOp equality_op = EqualityOp(),
+                        const hipStream_t stream = 0,
+                        const bool debug_synchronous = false)
+{
+    return detail::unique_count_impl<Config>(
+        temporary_storage, storage_size,
+        detail::to_kernel_input_iterator(input), unique_count_output,
+        size, equality_op, stream, debug_synchronous
+    );
+}
+
 /// \brief Device-level parallel unique by key primitive.
 ///
 /// From given \p input range unique primitive eliminates all but the first element from every
@@ -388,6 +784,8 @@ hipError_t unique(void * temporary_storage,
 /// * Ranges specified by \p keys_input and value_input must have at least \p size elements each.
 /// * Ranges specified by \p keys_output and values_output each must have at least so many elements,
 /// that all selected values can be copied into them.
+/// * \p keys_output and \p values_output can be the same as \p keys_input and \p values_input
+/// respectively, the selection is then done in place.
 /// * Range specified by \p unique_count_output must have at least 1 element.
 /// * By default <tt>InputIterator::value_type</tt>'s equality operator is used to check
 /// if elements are equivalent.
@@ -453,8 +851,8 @@ inline hipError_t unique_by_key(void*                           temporary_storag
     return detail::partition_impl<detail::select_method::unique, true, Config, offset_type>(
         temporary_storage,
         storage_size,
-        keys_input,
-        values_input,
+        detail::to_kernel_input_iterator(keys_input),
+        detail::to_kernel_input_iterator(values_input),
         no_flags,
         keys_output,
         values_output,
@@ -466,6 +864,90 @@ inline hipError_t unique_by_key(void*                           temporary_storag
         no_predicate);
 }
 
+/// \brief Device-level parallel unique by key primitive, which also counts the duplicates.
+///
+/// unique_by_key_with_counts selects the first key and the first value of every group of
+/// consecutive equivalent keys like \p unique_by_key, and writes the number of elements of the
+/// group to \p counts_output. The keys, the values and the counts are computed from the same
+/// segment heads in a single look-back pass, the values and the counts are scanned in separate
+/// look-back lanes (see \p reduce_by_key_columns).
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * Ranges specified by \p keys_input and \p values_input must have at least \p size elements.
+/// * Ranges specified by \p keys_output, \p values_output and \p counts_output must have at
+/// least as many elements as there are unique keys, which is written to
+/// \p unique_count_output.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// \p reduce_by_key_config_v2 or \p default_config.
+/// \tparam KeyIterator - random-access iterator type of the input range of keys.
+/// \tparam ValueIterator - random-access iterator type of the input range of values.
+/// \tparam OutputKeyIterator - random-access iterator type of the output range of keys.
+/// \tparam OutputValueIterator - random-access iterator type of the output range of values.
+/// \tparam CountsOutputIterator - random-access iterator type of the output range of the counts,
+/// its elements must be assignable from \p unsigned \p int.
+/// \tparam UniqueCountOutputIterator - random-access iterator type of the unique_count_output
+/// value used to return number of unique keys and values. It can be a simple pointer type.
+/// \tparam EqualityOp - type of an binary operator used to compare keys for equality.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the unique operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - iterator to the first element in the range to select keys from.
+/// \param [in] values_input - iterator to the first element in the range of values
+/// corresponding to keys
+/// \param [out] keys_output - iterator to the first element in the output key range.
+/// \param [out] values_output - iterator to the first element in the output value range.
+/// \param [out] counts_output - iterator to the first element in the output range of the
+/// numbers of elements of the groups.
+/// \param [out] unique_count_output - iterator to the total number of selected values.
+/// \param [in] size - number of element in the input range.
+/// \param [in] equality_op - [optional] binary function object used to compare input keys
+/// for equality. The default is \p rocprim::equal_to<T>.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+template <typename Config = default_config,
+          typename KeyIterator,
+          typename ValueIterator,
+          typename OutputKeyIterator,
+          typename OutputValueIterator,
+          typename CountsOutputIterator,
+          typename UniqueCountOutputIterator,
+          typename EqualityOp
+          = ::rocprim::equal_to<typename std::iterator_traits<KeyIterator>::value_type>>
+inline hipError_t unique_by_key_with_counts(void*                           temporary_storage,
+                                            size_t&                         storage_size,
+                                            const KeyIterator               keys_input,
+                                            const ValueIterator             values_input,
+                                            const OutputKeyIterator         keys_output,
+                                            const OutputValueIterator       values_output,
+                                            const CountsOutputIterator      counts_output,
+                                            const UniqueCountOutputIterator unique_count_output,
+                                            const size_t                    size,
+                                            const EqualityOp  equality_op       = EqualityOp(),
+                                            const hipStream_t stream            = 0,
+                                            const bool        debug_synchronous = false)
+{
+    return detail::reduce_by_key::reduce_by_key_columns_impl<Config>(
+        temporary_storage,
+        storage_size,
+        detail::to_kernel_input_iterator(keys_input),
+        ::rocprim::make_tuple(detail::to_kernel_input_iterator(values_input),
+                              ::rocprim::constant_iterator<unsigned int>(1)),
+        size,
+        keys_output,
+        ::rocprim::make_tuple(values_output, counts_output),
+        unique_count_output,
+        ::rocprim::make_tuple(detail::unique_first_value_op{}, ::rocprim::plus<unsigned int>()),
+        equality_op,
+        stream,
+        debug_synchronous);
+}
+
 /// @}
 // end of group devicemodule
 
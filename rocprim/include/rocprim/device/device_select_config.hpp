@@ -46,6 +46,15 @@ BEGIN_ROCPRIM_NAMESPACE
 /// \tparam FlagBlockLoadMethod - method for loading flag values.
 /// \tparam BlockScanMethod - algorithm for block scan.
 /// \tparam SizeLimit - limit on the number of items for a single select kernel launch.
+/// \tparam LoadCacheModifier - cache modifier of the loads of the input keys and values, it is
+/// applied when they are pointers.
+/// \tparam StoreCacheModifier - cache modifier of the stores of the output keys and values, it is
+/// applied when they are pointers.
+/// \tparam BlocksPerCU - when not 0, the grid of select, partition and unique is limited to
+/// \p BlocksPerCU blocks per compute unit and every block processes tiles in the order of their
+/// ids until all of them are processed. A limited grid leaves compute units to kernels running
+/// concurrently on other streams.
+/// \tparam Backoff - policy of the look-back for waiting for the prefixes of the preceding blocks.
 template<
     unsigned int BlockSize,
     unsigned int ItemsPerThread,
@@ -53,7 +62,11 @@ template<
     ::rocprim::block_load_method ValueBlockLoadMethod,
     ::rocprim::block_load_method FlagBlockLoadMethod,
     ::rocprim::block_scan_algorithm BlockScanMethod,
-    unsigned int SizeLimit = ROCPRIM_GRID_SIZE_LIMIT
+    unsigned int SizeLimit = ROCPRIM_GRID_SIZE_LIMIT,
+    ::rocprim::cache_load_modifier LoadCacheModifier = ::rocprim::load_default,
+    ::rocprim::cache_store_modifier StoreCacheModifier = ::rocprim::store_default,
+    unsigned int BlocksPerCU = 0,
+    ::rocprim::lookback_backoff Backoff = ::rocprim::lookback_backoff::automatic
 >
 struct select_config
 {
@@ -71,67 +84,29 @@ struct select_config
     static constexpr block_scan_algorithm block_scan_method = BlockScanMethod;
     /// \brief Limit on the number of items for a single select kernel launch.
     static constexpr unsigned int size_limit = SizeLimit;
+    /// \brief Cache modifier of the loads of the input keys and values.
+    static constexpr cache_load_modifier load_cache_modifier = LoadCacheModifier;
+    /// \brief Cache modifier of the stores of the output keys and values.
+    static constexpr cache_store_modifier store_cache_modifier = StoreCacheModifier;
+    /// \brief Maximum number of blocks per compute unit, 0 if the grid is not limited.
+    static constexpr unsigned int blocks_per_cu = BlocksPerCU;
+    /// \brief Policy of the look-back for waiting for the prefixes of the preceding blocks.
+    static constexpr lookback_backoff backoff = Backoff;
 };
 
 namespace detail
 {
 
+// Shared by select, partition, unique and run_length_encode when there is no tuned
+// configuration for the target and the key type
 template<class Key>
-struct select_config_803
+struct default_select_config_base_helper
 {
     static constexpr unsigned int item_scale =
         ::rocprim::detail::ceiling_div<unsigned int>(sizeof(Key), sizeof(int));
 
     using type = select_config<
         limit_block_size<256U, sizeof(Key), ROCPRIM_WARP_SIZE_64>::value,
-        ::rocprim::max(1u, 13u / item_scale),
-        ::rocprim::block_load_method::block_load_transpose,
-        ::rocprim::block_load_method::block_load_transpose,
-        ::rocprim::block_load_method::block_load_transpose,
-        ::rocprim::block_scan_algorithm::using_warp_scan
-    >;
-};
-
-template<class Key>
-struct select_config_900
-{
-    static constexpr unsigned int item_scale =
-        ::rocprim::detail::ceiling_div<unsigned int>(sizeof(Key), sizeof(int));
-
-    using type = select_config<
-        limit_block_size<256U, sizeof(Key), ROCPRIM_WARP_SIZE_64>::value,
-        ::rocprim::max(1u, 15u / item_scale),
-        ::rocprim::block_load_method::block_load_transpose,
-        ::rocprim::block_load_method::block_load_transpose,
-        ::rocprim::block_load_method::block_load_transpose,
-        ::rocprim::block_scan_algorithm::using_warp_scan
-    >;
-};
-
-template<class Value>
-struct select_config_90a
-{
-    static constexpr unsigned int item_scale =
-        ::rocprim::detail::ceiling_div<unsigned int>(sizeof(Value), sizeof(int));
-
-    using type = select_config<
-        limit_block_size<256U, sizeof(Value), ROCPRIM_WARP_SIZE_64>::value,
-        ::rocprim::max(1u, 15u / item_scale),
-        ::rocprim::block_load_method::block_load_transpose,
-        ::rocprim::block_load_method::block_load_transpose,
-        ::rocprim::block_load_method::block_load_transpose,
-        ::rocprim::block_scan_algorithm::using_warp_scan
-    >;
-};
-
-template<class Value>
-struct select_config_1030
-{
-    static constexpr unsigned int item_scale =
-        ::rocprim::detail::ceiling_div<unsigned int>(sizeof(Value), sizeof(int));
-
-    using type = select_config<
-        limit_block_size<256U, sizeof(Value), ROCPRIM_WARP_SIZE_32>::value,
         ::rocprim::max(1u, 15u / item_scale),
         ::rocprim::block_load_method::block_load_transpose,
         ::rocprim::block_load_method::block_load_transpose,
@@ -140,17 +115,9 @@ struct select_config_1030
     >;
 };
 
-
-template<unsigned int TargetArch, class Key, class /*Value*/>
-struct default_select_config
-    : select_arch<
-        TargetArch,
-        select_arch_case<803, select_config_803<Key>>,
-        select_arch_case<900, select_config_900<Key>>,
-        select_arch_case<ROCPRIM_ARCH_90a, select_config_90a<Key>>,
-        select_arch_case<1030, select_config_1030<Key>>,
-        select_config_803<Key>
-    > { };
+template<class Key>
+struct default_select_config_base : default_select_config_base_helper<Key>::type
+{};
 
 } // end namespace detail
 
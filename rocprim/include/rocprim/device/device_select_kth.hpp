@@ -0,0 +1,443 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_SELECT_KTH_HPP_
+#define ROCPRIM_DEVICE_DEVICE_SELECT_KTH_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/radix_sort.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../types/future_value.hpp"
+
+#include "detail/device_radix_select.hpp"
+#include "instrumentation.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+constexpr unsigned int radix_select_histogram_block_size       = 256;
+constexpr unsigned int radix_select_histogram_items_per_thread = 8;
+// Blocks of the histogram kernel process multiple tiles, so fewer blocks add to global histograms
+constexpr unsigned int radix_select_histogram_max_blocks = 1024;
+
+template<class BitKey, class RankOp>
+ROCPRIM_KERNEL __launch_bounds__(radix_select_size) void radix_select_init_kernel(
+    radix_select_state<BitKey>* states, unsigned long long* histograms, RankOp rank_op)
+{
+    radix_select_init_kernel_impl(states, histograms, rank_op);
+}
+
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class KeyCodec,
+         class KeysInputIterator>
+ROCPRIM_KERNEL __launch_bounds__(BlockSize) void radix_select_histogram_kernel(
+    KeysInputIterator                                          keys_input,
+    const size_t                                               size,
+    const radix_select_state<typename KeyCodec::bit_key_type>* states,
+    const unsigned int                                         state_count,
+    unsigned long long*                                        histograms,
+    const unsigned int                                         bit,
+    const unsigned int                                         current_radix_bits)
+{
+    radix_select_histogram_kernel_impl<BlockSize, ItemsPerThread, KeyCodec>(keys_input,
+                                                                            size,
+                                                                            states,
+                                                                            state_count,
+                                                                            histograms,
+                                                                            bit,
+                                                                            current_radix_bits);
+}
+
+template<class BitKey>
+ROCPRIM_KERNEL __launch_bounds__(radix_select_size) void radix_select_digit_kernel(
+    radix_select_state<BitKey>* states,
+    unsigned long long*         histograms,
+    const unsigned int          bit,
+    const unsigned int          current_radix_bits)
+{
+    radix_select_digit_kernel_impl(states, histograms, bit, current_radix_bits);
+}
+
+template<class KeyCodec, class OutputIterator>
+ROCPRIM_KERNEL __launch_bounds__(radix_select_size) void radix_select_store_kernel(
+    const radix_select_state<typename KeyCodec::bit_key_type>* states,
+    const unsigned int                                         state_count,
+    OutputIterator                                             output)
+{
+    radix_select_store_kernel_impl<KeyCodec>(states, state_count, output);
+}
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
+    { \
+        auto _error = hipGetLastError(); \
+        if(_error != hipSuccess) return _error; \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
+        if(debug_synchronous) \
+        { \
+            std::cout << name << "(" << size << ")"; \
+            auto __error = hipStreamSynchronize(stream); \
+            if(__error != hipSuccess) return __error; \
+            auto _end = std::chrono::high_resolution_clock::now(); \
+            auto _d = std::chrono::duration_cast<std::chrono::duration<double>>(_end - start); \
+            std::cout << " " << _d.count() * 1000 << " ms" << '\n'; \
+        } \
+    }
+
+// Finds the selected keys of all states, after this every state's prefix is the encoded key.
+// states and histograms must have state_count and state_count * radix_select_size elements.
+template<class KeyCodec, class KeysInputIterator, class RankOp>
+inline hipError_t
+    radix_select_impl(KeysInputIterator                                    keys_input,
+                      const size_t                                         size,
+                      radix_select_state<typename KeyCodec::bit_key_type>* states,
+                      unsigned long long*                                  histograms,
+                      const unsigned int                                   state_count,
+                      RankOp                                               rank_op,
+                      const hipStream_t                                    stream,
+                      bool                                                 debug_synchronous)
+{
+    using bit_key_type = typename KeyCodec::bit_key_type;
+
+    constexpr unsigned int block_size      = radix_select_histogram_block_size;
+    constexpr unsigned int items_per_block = block_size * radix_select_histogram_items_per_thread;
+    constexpr unsigned int key_bits        = KeyCodec::key_bits;
+
+    // Start point for time measurements
+    std::chrono::high_resolution_clock::time_point start;
+
+    const unsigned int passes           = ceiling_div(key_bits, radix_select_bits);
+    const unsigned int number_of_blocks = static_cast<unsigned int>(
+        std::min<size_t>(ceiling_div(size, items_per_block), radix_select_histogram_max_blocks));
+
+    if(debug_synchronous)
+    {
+        std::cout << "size " << size << '\n';
+        std::cout << "state_count " << state_count << '\n';
+        std::cout << "passes " << passes << '\n';
+        std::cout << "number of blocks " << number_of_blocks << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+        start = std::chrono::high_resolution_clock::now();
+    }
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("radix_select_init_kernel");
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(radix_select_init_kernel<bit_key_type>),
+        dim3(state_count), dim3(radix_select_size), 0, stream,
+        states, histograms, rank_op
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("radix_select_init_kernel", state_count, start);
+
+    // Digits of the selected keys from the most significant one
+    for(unsigned int pass = 0; pass < passes; pass++)
+    {
+        const unsigned int end_bit = key_bits - pass * radix_select_bits;
+        const unsigned int bit     = end_bit > radix_select_bits ? end_bit - radix_select_bits : 0;
+        const unsigned int current_radix_bits = end_bit - bit;
+
+        // Every launch counts the keys of a group of states in shared memory
+        for(unsigned int first_state = 0; first_state < state_count;
+            first_state += radix_select_max_states)
+        {
+            const unsigned int current_state_count
+                = std::min(state_count - first_state, radix_select_max_states);
+
+            if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+            ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("radix_select_histogram_kernel");
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(radix_select_histogram_kernel<block_size,
+                                                              radix_select_histogram_items_per_thread,
+                                                              KeyCodec>),
+                dim3(number_of_blocks), dim3(block_size), 0, stream,
+                keys_input, size, states + first_state, current_state_count,
+                histograms + first_state * radix_select_size, bit, current_radix_bits
+            );
+            ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("radix_select_histogram_kernel", size, start);
+        }
+
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("radix_select_digit_kernel");
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(radix_select_digit_kernel<bit_key_type>),
+            dim3(state_count), dim3(radix_select_size), 0, stream,
+            states, histograms, bit, current_radix_bits
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("radix_select_digit_kernel", state_count, start);
+    }
+
+    return hipSuccess;
+}
+
+template<radix_float_order FloatOrder,
+         class KeysInputIterator,
+         class OutputIterator,
+         class RankOp>
+inline hipError_t select_kth_impl(void*              temporary_storage,
+                                  size_t&            storage_size,
+                                  KeysInputIterator  keys_input,
+                                  OutputIterator     output,
+                                  const size_t       size,
+                                  RankOp             rank_op,
+                                  const unsigned int k_count,
+                                  const hipStream_t  stream,
+                                  bool               debug_synchronous)
+{
+    using key_type   = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using key_codec  = radix_key_codec<key_type, false, FloatOrder>;
+    using state_type = radix_select_state<typename key_codec::bit_key_type>;
+
+    state_type*         states;
+    unsigned long long* histograms;
+
+    const hipError_t partition_result = temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        temp_storage::make_linear_partition(
+            temp_storage::ptr_aligned_array(&states, k_count),
+            temp_storage::ptr_aligned_array(&histograms, size_t(k_count) * radix_select_size)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(size == 0 || k_count == 0)
+        return hipSuccess;
+
+    hipError_t error = radix_select_impl<key_codec>(keys_input,
+                                                    size,
+                                                    states,
+                                                    histograms,
+                                                    k_count,
+                                                    rank_op,
+                                                    stream,
+                                                    debug_synchronous);
+    if(error != hipSuccess) return error;
+
+    std::chrono::high_resolution_clock::time_point start;
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("radix_select_store_kernel");
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(radix_select_store_kernel<key_codec>),
+        dim3(ceiling_div(k_count, radix_select_size)), dim3(radix_select_size), 0, stream,
+        states, k_count, output
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("radix_select_store_kernel", k_count, start);
+
+    return hipSuccess;
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
+template<class K>
+struct is_select_kth_index : std::integral_constant<bool, ::rocprim::is_integral<K>::value>
+{};
+
+template<class T, class Iter>
+struct is_select_kth_index<::rocprim::future_value<T, Iter>> : std::true_type
+{};
+
+} // end of detail namespace
+
+/// \brief Parallel k-th order statistic primitive for device level.
+///
+/// \p select_kth function finds the key that would be at index \p k if the input range was
+/// sorted in ascending order, without sorting it.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * \p Key type (a \p value_type of \p KeysInputIterator) must be an arithmetic type (that is,
+/// an integral type or a floating-point type).
+/// * Keys are compared in the same way as in \p radix_sort_keys. If the selected key is a zero
+/// of a floating-point type, its sign is only defined for \p radix_float_order::total_order.
+/// * \p k can be a \p future_value, so it can be computed on the device. Values of \p k which
+/// are not less than \p size select the largest key.
+/// * The key is found by radix select, i.e. by histograms of one 8-bit digit at a time,
+/// which needs only one read of the input per digit.
+/// * Nothing is written to \p output if \p size is 0.
+///
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output value. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam K - integral type of \p k or a \p future_value of it.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to select the key from.
+/// \param [out] output - pointer to the device-accessible output value.
+/// \param [in] size - number of element in the input range.
+/// \param [in] k - index of the key in the sorted order.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful selection; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the median of an array of floating-point values is found.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;    // e.g., 7
+/// float * input;        // e.g., [0.6, 0.3, 0.65, 0.4, 0.2, 0.08, 1]
+/// float * output;       // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::select_kth(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size, input_size / 2
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform selection
+/// rocprim::select_kth(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size, input_size / 2
+/// );
+/// // output: [0.4]
+/// \endcode
+/// \endparblock
+template<radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+         class KeysInputIterator,
+         class OutputIterator,
+         class K>
+inline auto select_kth(void*             temporary_storage,
+                       size_t&           storage_size,
+                       KeysInputIterator keys_input,
+                       OutputIterator    output,
+                       const size_t      size,
+                       K                 k,
+                       const hipStream_t stream            = 0,
+                       bool              debug_synchronous = false) ->
+    typename std::enable_if<detail::is_select_kth_index<K>::value, hipError_t>::type
+{
+    return detail::select_kth_impl<FloatOrder>(temporary_storage,
+                                               storage_size,
+                                               keys_input,
+                                               output,
+                                               size,
+                                               detail::select_kth_rank_op<K>{k, size},
+                                               1,
+                                               stream,
+                                               debug_synchronous);
+}
+
+/// \brief Parallel k-th order statistic primitive for device level, for several values of k.
+///
+/// \p select_kth function finds the keys that would be at indices \p ks if the input range was
+/// sorted in ascending order, without sorting it. All keys are found in the same passes over
+/// the input, for example all percentiles of interest at once.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * \p Key type (a \p value_type of \p KeysInputIterator) must be an arithmetic type (that is,
+/// an integral type or a floating-point type).
+/// * Ranges specified by \p ks and \p output must have at least \p k_count elements,
+/// \p ks must be device-accessible.
+/// * Keys are compared in the same way as in \p radix_sort_keys. If a selected key is a zero
+/// of a floating-point type, its sign is only defined for \p radix_float_order::total_order.
+/// * Values of \p ks which are not less than \p size select the largest key.
+/// * Nothing is written to \p output if \p size is 0.
+///
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam KIterator - random-access iterator type of the indices. It can be a simple pointer
+/// type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to select the keys from.
+/// \param [out] output - pointer to the first element in the output range, i-th element is the
+/// key at index <tt>ks[i]</tt> in the sorted order.
+/// \param [in] size - number of element in the input range.
+/// \param [in] ks - pointer to the first index of the keys in the sorted order.
+/// \param [in] k_count - number of indices.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful selection; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+         class KeysInputIterator,
+         class OutputIterator,
+         class KIterator>
+inline auto select_kth(void*              temporary_storage,
+                       size_t&            storage_size,
+                       KeysInputIterator  keys_input,
+                       OutputIterator     output,
+                       const size_t       size,
+                       KIterator          ks,
+                       const unsigned int k_count,
+                       const hipStream_t  stream            = 0,
+                       bool               debug_synchronous = false) ->
+    typename std::enable_if<!detail::is_select_kth_index<KIterator>::value, hipError_t>::type
+{
+    return detail::select_kth_impl<FloatOrder>(temporary_storage,
+                                               storage_size,
+                                               keys_input,
+                                               output,
+                                               size,
+                                               detail::select_kth_ranks_op<KIterator>{ks, size},
+                                               k_count,
+                                               stream,
+                                               debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_SELECT_KTH_HPP_
@@ -0,0 +1,1285 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_SET_OPERATIONS_HPP_
+#define ROCPRIM_DEVICE_DEVICE_SET_OPERATIONS_HPP_
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../functional.hpp"
+#include "../iterator/constant_iterator.hpp"
+
+#include "detail/device_scan_common.hpp"
+#include "detail/device_set_operations.hpp"
+#include "device_merge.hpp"
+#include "device_merge_config.hpp"
+#include "device_transform.hpp"
+#include "instrumentation.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+template<set_operation Operation,
+         unsigned int  BlockSize,
+         unsigned int  ItemsPerThread,
+         class IndexIterator,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class KeysOutputIterator,
+         class ValuesInputIterator1,
+         class ValuesInputIterator2,
+         class ValuesOutputIterator,
+         class OutputCountIterator,
+         class BinaryFunction,
+         class LookbackScanState>
+ROCPRIM_KERNEL __launch_bounds__(BlockSize) void set_operation_kernel(
+    IndexIterator                  indices,
+    KeysInputIterator1             keys_input1,
+    KeysInputIterator2             keys_input2,
+    KeysOutputIterator             keys_output,
+    ValuesInputIterator1           values_input1,
+    ValuesInputIterator2           values_input2,
+    ValuesOutputIterator           values_output,
+    OutputCountIterator            output_count,
+    const unsigned int             input1_size,
+    const unsigned int             input2_size,
+    BinaryFunction                 compare_function,
+    LookbackScanState              scan_state,
+    const unsigned int             number_of_blocks,
+    ordered_block_id<unsigned int> ordered_bid)
+{
+    set_operation_kernel_impl<Operation, BlockSize, ItemsPerThread>(indices,
+                                                                    keys_input1,
+                                                                    keys_input2,
+                                                                    keys_output,
+                                                                    values_input1,
+                                                                    values_input2,
+                                                                    values_output,
+                                                                    output_count,
+                                                                    input1_size,
+                                                                    input2_size,
+                                                                    compare_function,
+                                                                    scan_state,
+                                                                    number_of_blocks,
+                                                                    ordered_bid);
+}
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start)                           \
+    {                                                                                            \
+        auto _error = hipGetLastError();                                                         \
+        if(_error != hipSuccess)                                                                 \
+            return _error;                                                                       \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size);                                          \
+        if(debug_synchronous)                                                                    \
+        {                                                                                        \
+            std::cout << name << "(" << size << ")";                                             \
+            auto __error = hipStreamSynchronize(stream);                                         \
+            if(__error != hipSuccess)                                                            \
+                return __error;                                                                  \
+            auto _end = std::chrono::high_resolution_clock::now();                               \
+            auto _d = std::chrono::duration_cast<std::chrono::duration<double>>(_end - start);   \
+            std::cout << " " << _d.count() * 1000 << " ms" << '\n';                              \
+        }                                                                                        \
+    }
+
+template<set_operation Operation,
+         class Config,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class KeysOutputIterator,
+         class ValuesInputIterator1,
+         class ValuesInputIterator2,
+         class ValuesOutputIterator,
+         class OutputCountIterator,
+         class BinaryFunction>
+inline hipError_t set_operation_impl(void*                temporary_storage,
+                                     size_t&              storage_size,
+                                     KeysInputIterator1   keys_input1,
+                                     KeysInputIterator2   keys_input2,
+                                     KeysOutputIterator   keys_output,
+                                     ValuesInputIterator1 values_input1,
+                                     ValuesInputIterator2 values_input2,
+                                     ValuesOutputIterator values_output,
+                                     OutputCountIterator  output_count,
+                                     const size_t         input1_size,
+                                     const size_t         input2_size,
+                                     BinaryFunction       compare_function,
+                                     const hipStream_t    stream,
+                                     bool                 debug_synchronous)
+{
+    using key_type   = typename std::iterator_traits<KeysInputIterator1>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator1>::value_type;
+
+    using config = default_or_custom_config<
+        Config,
+        default_merge_config<ROCPRIM_TARGET_ARCH, key_type, value_type>>;
+
+    using scan_state_type            = lookback_scan_state<unsigned int>;
+    using scan_state_with_sleep_type = lookback_scan_state<unsigned int, true>;
+    using ordered_block_id_type      = ordered_block_id<unsigned int>;
+
+    static constexpr unsigned int block_size       = config::block_size;
+    static constexpr unsigned int half_block       = block_size / 2;
+    static constexpr unsigned int items_per_thread = config::items_per_thread;
+    static constexpr unsigned int items_per_block  = block_size * items_per_thread;
+
+    // The tiles, the merge path and the output indices use 32-bit indices
+    if(input1_size + input2_size
+       > std::numeric_limits<unsigned int>::max() - items_per_block)
+    {
+        return hipErrorInvalidValue;
+    }
+    const unsigned int number_of_blocks = static_cast<unsigned int>(
+        ::rocprim::detail::ceiling_div(input1_size + input2_size, items_per_block));
+    // Every thread of partition_kernel stores one split point of the merge path
+    const unsigned int partition_blocks
+        = ::rocprim::detail::ceiling_div(number_of_blocks + 1, half_block);
+
+    unsigned int*                   index;
+    void*                           scan_state_storage;
+    ordered_block_id_type::id_type* ordered_bid_storage;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&index, partition_blocks * half_block),
+            // This is valid even with scan_state_with_sleep_type
+            detail::temp_storage::make_partition(
+                &scan_state_storage,
+                scan_state_type::get_temp_storage_layout(number_of_blocks)),
+            detail::temp_storage::make_partition(
+                &ordered_bid_storage,
+                ordered_block_id_type::get_temp_storage_layout())));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(number_of_blocks == 0)
+    {
+        return ::rocprim::transform(::rocprim::constant_iterator<unsigned int>(0),
+                                    output_count,
+                                    1,
+                                    ::rocprim::identity<unsigned int>{},
+                                    stream,
+                                    debug_synchronous);
+    }
+
+    bool use_sleep;
+    if(const hipError_t error = is_sleep_scan_state_used(use_sleep))
+    {
+        return error;
+    }
+
+    auto scan_state = scan_state_type::create(scan_state_storage, number_of_blocks);
+    auto scan_state_with_sleep
+        = scan_state_with_sleep_type::create(scan_state_storage, number_of_blocks);
+    auto ordered_bid = ordered_block_id_type::create(ordered_bid_storage);
+
+    // Start point for time measurements
+    std::chrono::high_resolution_clock::time_point start;
+    if(debug_synchronous)
+    {
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << number_of_blocks << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+        start = std::chrono::high_resolution_clock::now();
+    }
+
+    // Merge path partitioning of the tiles, the same as of merge
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("partition_kernel");
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(partition_kernel),
+                       dim3(partition_blocks),
+                       dim3(half_block),
+                       0,
+                       stream,
+                       index,
+                       keys_input1,
+                       keys_input2,
+                       input1_size,
+                       input2_size,
+                       items_per_block,
+                       compare_function);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("partition_kernel", number_of_blocks + 1, start);
+
+    if(debug_synchronous)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    const unsigned int init_grid_size = ::rocprim::detail::ceiling_div(number_of_blocks,
+                                                                       block_size);
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("init_lookback_scan_state_kernel");
+    if(use_sleep)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(init_lookback_scan_state_kernel<scan_state_with_sleep_type>),
+            dim3(init_grid_size),
+            dim3(block_size),
+            0,
+            stream,
+            scan_state_with_sleep,
+            number_of_blocks,
+            ordered_bid);
+    }
+    else
+    {
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(init_lookback_scan_state_kernel<scan_state_type>),
+                           dim3(init_grid_size),
+                           dim3(block_size),
+                           0,
+                           stream,
+                           scan_state,
+                           number_of_blocks,
+                           ordered_bid);
+    }
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_lookback_scan_state_kernel",
+                                                number_of_blocks,
+                                                start);
+
+    if(debug_synchronous)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("set_operation_kernel");
+    auto set_operation_kernel_launch = [&](auto current_scan_state)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(set_operation_kernel<Operation, block_size, items_per_thread>),
+            dim3(number_of_blocks),
+            dim3(block_size),
+            0,
+            stream,
+            index,
+            keys_input1,
+            keys_input2,
+            keys_output,
+            values_input1,
+            values_input2,
+            values_output,
+            output_count,
+            static_cast<unsigned int>(input1_size),
+            static_cast<unsigned int>(input2_size),
+            compare_function,
+            current_scan_state,
+            number_of_blocks,
+            ordered_bid);
+    };
+    if(use_sleep)
+    {
+        set_operation_kernel_launch(scan_state_with_sleep);
+    }
+    else
+    {
+        set_operation_kernel_launch(scan_state);
+    }
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("set_operation_kernel",
+                                                input1_size + input2_size,
+                                                start);
+
+    return hipSuccess;
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
+} // end of detail namespace
+
+/// \brief Parallel intersection of sorted ranges for device level.
+///
+/// \p set_intersection stores to the output the keys present in both inputs. A key with \p m copies
+/// in the first and \p n copies in the second input is stored \p min(m,n) times, the copies are
+/// taken from the first input.
+///
+/// \par Overview
+/// * Both inputs must be sorted by \p compare_function. The output is sorted, and with equal
+/// keys it matches the output of the corresponding function of the C++ standard library.
+/// * The tiles of the merged inputs are found by the merge path partitioning of \p merge, the
+/// keys of the output are selected and compacted in a single pass with a decoupled look-back
+/// of the output counts of the tiles. Equal keys spanning tiles are counted with galloping
+/// searches, so the cost does not depend on the position of the tile boundaries.
+/// * The total size of the inputs must be less than \p 2^32 minus one tile.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p merge_config or
+/// a custom class with the same members.
+/// \tparam KeysInputIterator1 - random-access iterator type of the first input range. Must meet
+/// the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysInputIterator2 - random-access iterator type of the second input range. Must meet
+/// the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OutputCountIterator - random-access iterator type of the output count. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input1 - iterator to the first key of the first input range.
+/// \param [in] keys_input2 - iterator to the first key of the second input range.
+/// \param [out] keys_output - iterator to the first key of the output range. It must be large
+/// enough for the keys of the output.
+/// \param [out] output_count - iterator to the number of keys stored to the output.
+/// \param [in] input1_size - number of keys in the first input range.
+/// \param [in] input2_size - number of keys in the second input range.
+/// \param [in] compare_function - binary operation function object that will be used for
+/// comparison. The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful operation, \p hipErrorInvalidValue if the
+/// inputs are too large; otherwise a HIP runtime error of type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t         input1_size;  // e.g., 5
+/// size_t         input2_size;  // e.g., 4
+/// int *          keys_input1;  // e.g., [1, 3, 3, 5, 7]
+/// int *          keys_input2;  // e.g., [3, 5, 5, 6]
+/// int *          keys_output;  // empty array of 9 elements
+/// unsigned int * output_count; // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::set_intersection(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input1, keys_input2, keys_output, output_count, input1_size, input2_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform the intersection
+/// rocprim::set_intersection(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input1, keys_input2, keys_output, output_count, input1_size, input2_size
+/// );
+/// // keys_output: [3, 5]
+/// // output_count: 2
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class KeysOutputIterator,
+         class OutputCountIterator,
+         class BinaryFunction
+         = ::rocprim::less<typename std::iterator_traits<KeysInputIterator1>::value_type>>
+inline hipError_t set_intersection(void*               temporary_storage,
+                                  size_t&             storage_size,
+                                  KeysInputIterator1  keys_input1,
+                                  KeysInputIterator2  keys_input2,
+                                  KeysOutputIterator  keys_output,
+                                  OutputCountIterator output_count,
+                                  const size_t        input1_size,
+                                  const size_t        input2_size,
+                                  BinaryFunction      compare_function  = BinaryFunction(),
+                                  const hipStream_t   stream            = 0,
+                                  bool                debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::set_operation_impl<detail::set_operation::intersection, Config>(
+        temporary_storage, storage_size, keys_input1, keys_input2, keys_output, values, values,
+        values, output_count, input1_size, input2_size, compare_function, stream,
+        debug_synchronous);
+}
+
+/// \brief Parallel intersection of sorted ranges of (key, value) pairs for device level.
+///
+/// \p set_intersection_by_key stores to the output the keys present in both inputs. A key with \p m
+/// copies in the first and \p n copies in the second input is stored \p min(m,n) times, the copies
+/// are taken from the first input. The value of every stored key is stored with it.
+///
+/// \par Overview
+/// * Both inputs must be sorted by \p compare_function. The output is sorted, and with equal
+/// keys it matches the output of the corresponding function of the C++ standard library.
+/// * The tiles of the merged inputs are found by the merge path partitioning of \p merge, the
+/// keys of the output are selected and compacted in a single pass with a decoupled look-back
+/// of the output counts of the tiles. Equal keys spanning tiles are counted with galloping
+/// searches, so the cost does not depend on the position of the tile boundaries.
+/// * The total size of the inputs must be less than \p 2^32 minus one tile.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p merge_config or
+/// a custom class with the same members.
+/// \tparam KeysInputIterator1 - random-access iterator type of the first keys input range. Must
+/// meet the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysInputIterator2 - random-access iterator type of the second keys input range. Must
+/// meet the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator1 - random-access iterator type of the first values input range.
+/// Must meet the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator2 - random-access iterator type of the second values input range.
+/// Must meet the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the keys output range. Must meet
+/// the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesOutputIterator - random-access iterator type of the values output range. Must
+/// meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OutputCountIterator - random-access iterator type of the output count. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input1 - iterator to the first key of the first input range.
+/// \param [in] keys_input2 - iterator to the first key of the second input range.
+/// \param [in] values_input1 - iterator to the first value of the first input range.
+/// \param [in] values_input2 - iterator to the first value of the second input range.
+/// \param [out] keys_output - iterator to the first key of the output range. It must be large
+/// enough for the keys of the output.
+/// \param [out] values_output - iterator to the first value of the output range.
+/// \param [out] output_count - iterator to the number of pairs stored to the output.
+/// \param [in] input1_size - number of pairs in the first input range.
+/// \param [in] input2_size - number of pairs in the second input range.
+/// \param [in] compare_function - binary operation function object that will be used for key
+/// comparison. The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful operation, \p hipErrorInvalidValue if the
+/// inputs are too large; otherwise a HIP runtime error of type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t         input1_size;   // e.g., 5
+/// size_t         input2_size;   // e.g., 4
+/// int *          keys_input1;   // e.g., [1, 3, 3, 5, 7]
+/// int *          keys_input2;   // e.g., [3, 5, 5, 6]
+/// int *          values_input1; // e.g., [10, 11, 12, 13, 14]
+/// int *          values_input2; // e.g., [20, 21, 22, 23]
+/// int *          keys_output;   // empty array of 9 elements
+/// int *          values_output; // empty array of 9 elements
+/// unsigned int * output_count;  // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::set_intersection_by_key(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input1, keys_input2, values_input1, values_input2,
+///     keys_output, values_output, output_count, input1_size, input2_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform the intersection
+/// rocprim::set_intersection_by_key(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input1, keys_input2, values_input1, values_input2,
+///     keys_output, values_output, output_count, input1_size, input2_size
+/// );
+/// // keys_output: [3, 5]
+/// // values_output: [11, 13]
+/// // output_count: 2
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class ValuesInputIterator1,
+         class ValuesInputIterator2,
+         class KeysOutputIterator,
+         class ValuesOutputIterator,
+         class OutputCountIterator,
+         class BinaryFunction
+         = ::rocprim::less<typename std::iterator_traits<KeysInputIterator1>::value_type>>
+inline hipError_t set_intersection_by_key(void*                temporary_storage,
+                                         size_t&              storage_size,
+                                         KeysInputIterator1   keys_input1,
+                                         KeysInputIterator2   keys_input2,
+                                         ValuesInputIterator1 values_input1,
+                                         ValuesInputIterator2 values_input2,
+                                         KeysOutputIterator   keys_output,
+                                         ValuesOutputIterator values_output,
+                                         OutputCountIterator  output_count,
+                                         const size_t         input1_size,
+                                         const size_t         input2_size,
+                                         BinaryFunction       compare_function  = BinaryFunction(),
+                                         const hipStream_t    stream            = 0,
+                                         bool                 debug_synchronous = false)
+{
+    return detail::set_operation_impl<detail::set_operation::intersection, Config>(
+        temporary_storage, storage_size, keys_input1, keys_input2, keys_output, values_input1,
+        values_input2, values_output, output_count, input1_size, input2_size, compare_function,
+        stream, debug_synchronous);
+}
+
+/// \brief Parallel union of sorted ranges for device level.
+///
+/// \p set_union stores to the output the keys present in any of the inputs. A key with \p m copies
+/// in the first and \p n copies in the second input is stored \p max(m,n) times, all copies of the
+/// first input followed by the last \p max(n-m,0) copies of the second input.
+///
+/// \par Overview
+/// * Both inputs must be sorted by \p compare_function. The output is sorted, and with equal
+/// keys it matches the output of the corresponding function of the C++ standard library.
+/// * The tiles of the merged inputs are found by the merge path partitioning of \p merge, the
+/// keys of the output are selected and compacted in a single pass with a decoupled look-back
+/// of the output counts of the tiles. Equal keys spanning tiles are counted with galloping
+/// searches, so the cost does not depend on the position of the tile boundaries.
+/// * The total size of the inputs must be less than \p 2^32 minus one tile.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p merge_config or
+/// a custom class with the same members.
+/// \tparam KeysInputIterator1 - random-access iterator type of the first input range. Must meet
+/// the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysInputIterator2 - random-access iterator type of the second input range. Must meet
+/// the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OutputCountIterator - random-access iterator type of the output count. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input1 - iterator to the first key of the first input range.
+/// \param [in] keys_input2 - iterator to the first key of the second input range.
+/// \param [out] keys_output - iterator to the first key of the output range. It must be large
+/// enough for the keys of the output.
+/// \param [out] output_count - iterator to the number of keys stored to the output.
+/// \param [in] input1_size - number of keys in the first input range.
+/// \param [in] input2_size - number of keys in the second input range.
+/// \param [in] compare_function - binary operation function object that will be used for
+/// comparison. The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful operation, \p hipErrorInvalidValue if the
+/// inputs are too large; otherwise a HIP runtime error of type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t         input1_size;  // e.g., 5
+/// size_t         input2_size;  // e.g., 4
+/// int *          keys_input1;  // e.g., [1, 3, 3, 5, 7]
+/// int *          keys_input2;  // e.g., [3, 5, 5, 6]
+/// int *          keys_output;  // empty array of 9 elements
+/// unsigned int * output_count; // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::set_union(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input1, keys_input2, keys_output, output_count, input1_size, input2_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform the union
+/// rocprim::set_union(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input1, keys_input2, keys_output, output_count, input1_size, input2_size
+/// );
+/// // keys_output: [1, 3, 3, 5, 5, 6, 7]
+/// // output_count: 7
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class KeysOutputIterator,
+         class OutputCountIterator,
+         class BinaryFunction
+         = ::rocprim::less<typename std::iterator_traits<KeysInputIterator1>::value_type>>
+inline hipError_t set_union(void*               temporary_storage,
+                           size_t&             storage_size,
+                           KeysInputIterator1  keys_input1,
+                           KeysInputIterator2  keys_input2,
+                           KeysOutputIterator  keys_output,
+                           OutputCountIterator output_count,
+                           const size_t        input1_size,
+                           const size_t        input2_size,
+                           BinaryFunction      compare_function  = BinaryFunction(),
+                           const hipStream_t   stream            = 0,
+                           bool                debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::set_operation_impl<detail::set_operation::union_, Config>(
+        temporary_storage, storage_size, keys_input1, keys_input2, keys_output, values, values,
+        values, output_count, input1_size, input2_size, compare_function, stream,
+        debug_synchronous);
+}
+
+/// \brief Parallel union of sorted ranges of (key, value) pairs for device level.
+///
+/// \p set_union_by_key stores to the output the keys present in any of the inputs. A key with \p m
+/// copies in the first and \p n copies in the second input is stored \p max(m,n) times, all copies
+/// of the first input followed by the last \p max(n-m,0) copies of the second input. The value of
+/// every stored key is stored with it.
+///
+/// \par Overview
+/// * Both inputs must be sorted by \p compare_function. The output is sorted, and with equal
+/// keys it matches the output of the corresponding function of the C++ standard library.
+/// * The tiles of the merged inputs are found by the merge path partitioning of \p merge, the
+/// keys of the output are selected and compacted in a single pass with a decoupled look-back
+/// of the output counts of the tiles. Equal keys spanning tiles are counted with galloping
+/// searches, so the cost does not depend on the position of the tile boundaries.
+/// * The total size of the inputs must be less than \p 2^32 minus one tile.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p merge_config or
+/// a custom class with the same members.
+/// \tparam KeysInputIterator1 - random-access iterator type of the first keys input range. Must
+/// meet the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysInputIterator2 - random-access iterator type of the second keys input range. Must
+/// meet the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator1 - random-access iterator type of the first values input range.
+/// Must meet the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator2 - random-access iterator type of the second values input range.
+/// Must meet the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the keys output range. Must meet
+/// the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesOutputIterator - random-access iterator type of the values output range. Must
+/// meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OutputCountIterator - random-access iterator type of the output count. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input1 - iterator to the first key of the first input range.
+/// \param [in] keys_input2 - iterator to the first key of the second input range.
+/// \param [in] values_input1 - iterator to the first value of the first input range.
+/// \param [in] values_input2 - iterator to the first value of the second input range.
+/// \param [out] keys_output - iterator to the first key of the output range. It must be large
+/// enough for the keys of the output.
+/// \param [out] values_output - iterator to the first value of the output range.
+/// \param [out] output_count - iterator to the number of pairs stored to the output.
+/// \param [in] input1_size - number of pairs in the first input range.
+/// \param [in] input2_size - number of pairs in the second input range.
+/// \param [in] compare_function - binary operation function object that will be used for key
+/// comparison. The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful operation, \p hipErrorInvalidValue if the
+/// inputs are too large; otherwise a HIP runtime error of type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t         input1_size;   // e.g., 5
+/// size_t         input2_size;   // e.g., 4
+/// int *          keys_input1;   // e.g., [1, 3, 3, 5, 7]
+/// int *          keys_input2;   // e.g., [3, 5, 5, 6]
+/// int *          values_input1; // e.g., [10, 11, 12, 13, 14]
+/// int *          values_input2; // e.g., [20, 21, 22, 23]
+/// int *          keys_output;   // empty array of 9 elements
+/// int *          values_output; // empty array of 9 elements
+/// unsigned int * output_count;  // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::set_union_by_key(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input1, keys_input2, values_input1, values_input2,
+///     keys_output, values_output, output_count, input1_size, input2_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform the union
+/// rocprim::set_union_by_key(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input1, keys_input2, values_input1, values_input2,
+///     keys_output, values_output, output_count, input1_size, input2_size
+/// );
+/// // keys_output: [1, 3, 3, 5, 5, 6, 7]
+/// // values_output: [10, 11, 12, 13, 22, 23, 14]
+/// // output_count: 7
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class ValuesInputIterator1,
+         class ValuesInputIterator2,
+         class KeysOutputIterator,
+         class ValuesOutputIterator,
+         class OutputCountIterator,
+         class BinaryFunction
+         = ::rocprim::less<typename std::iterator_traits<KeysInputIterator1>::value_type>>
+inline hipError_t set_union_by_key(void*                temporary_storage,
+                                  size_t&              storage_size,
+                                  KeysInputIterator1   keys_input1,
+                                  KeysInputIterator2   keys_input2,
+                                  ValuesInputIterator1 values_input1,
+                                  ValuesInputIterator2 values_input2,
+                                  KeysOutputIterator   keys_output,
+                                  ValuesOutputIterator values_output,
+                                  OutputCountIterator  output_count,
+                                  const size_t         input1_size,
+                                  const size_t         input2_size,
+                                  BinaryFunction       compare_function  = BinaryFunction(),
+                                  const hipStream_t    stream            = 0,
+                                  bool                 debug_synchronous = false)
+{
+    return detail::set_operation_impl<detail::set_operation::union_, Config>(
+        temporary_storage, storage_size, keys_input1, keys_input2, keys_output, values_input1,
+        values_input2, values_output, output_count, input1_size, input2_size, compare_function,
+        stream, debug_synchronous);
+}
+
+/// \brief Parallel difference of sorted ranges for device level.
+///
+/// \p set_difference stores to the output the keys of the first input which are not present in the
+/// second input. A key with \p m copies in the first and \p n copies in the second input is stored
+/// \p max(m-n,0) times, the last copies of the first input.
+///
+/// \par Overview
+/// * Both inputs must be sorted by \p compare_function. The output is sorted, and with equal
+/// keys it matches the output of the corresponding function of the C++ standard library.
+/// * The tiles of the merged inputs are found by the merge path partitioning of \p merge, the
+/// keys of the output are selected and compacted in a single pass with a decoupled look-back
+/// of the output counts of the tiles. Equal keys spanning tiles are counted with galloping
+/// searches, so the cost does not depend on the position of the tile boundaries.
+/// * The total size of the inputs must be less than \p 2^32 minus one tile.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p merge_config or
+/// a custom class with the same members.
+/// \tparam KeysInputIterator1 - random-access iterator type of the first input range. Must meet
+/// the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysInputIterator2 - random-access iterator type of the second input range. Must meet
+/// the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OutputCountIterator - random-access iterator type of the output count. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input1 - iterator to the first key of the first input range.
+/// \param [in] keys_input2 - iterator to the first key of the second input range.
+/// \param [out] keys_output - iterator to the first key of the output range. It must be large
+/// enough for the keys of the output.
+/// \param [out] output_count - iterator to the number of keys stored to the output.
+/// \param [in] input1_size - number of keys in the first input range.
+/// \param [in] input2_size - number of keys in the second input range.
+/// \param [in] compare_function - binary operation function object that will be used for
+/// comparison. The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful operation, \p hipErrorInvalidValue if the
+/// inputs are too large; otherwise a HIP runtime error of type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t         input1_size;  // e.g., 5
+/// size_t         input2_size;  // e.g., 4
+/// int *          keys_input1;  // e.g., [1, 3, 3, 5, 7]
+/// int *          keys_input2;  // e.g., [3, 5, 5, 6]
+/// int *          keys_output;  // empty array of 9 elements
+/// unsigned int * output_count; // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::set_difference(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input1, keys_input2, keys_output, output_count, input1_size, input2_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform the difference
+/// rocprim::set_difference(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input1, keys_input2, keys_output, output_count, input1_size, input2_size
+/// );
+/// // keys_output: [1, 3, 7]
+/// // output_count: 3
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class KeysOutputIterator,
+         class OutputCountIterator,
+         class BinaryFunction
+         = ::rocprim::less<typename std::iterator_traits<KeysInputIterator1>::value_type>>
+inline hipError_t set_difference(void*               temporary_storage,
+                                size_t&             storage_size,
+                                KeysInputIterator1  keys_input1,
+                                KeysInputIterator2  keys_input2,
+                                KeysOutputIterator  keys_output,
+                                OutputCountIterator output_count,
+                                const size_t        input1_size,
+                                const size_t        input2_size,
+                                BinaryFunction      compare_function  = BinaryFunction(),
+                                const hipStream_t   stream            = 0,
+                                bool                debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::set_operation_impl<detail::set_operation::difference, Config>(
+        temporary_storage, storage_size, keys_input1, keys_input2, keys_output, values, values,
+        values, output_count, input1_size, input2_size, compare_function, stream,
+        debug_synchronous);
+}
+
+/// \brief Parallel difference of sorted ranges of (key, value) pairs for device level.
+///
+/// \p set_difference_by_key stores to the output the keys of the first input which are not present
+/// in the second input. A key with \p m copies in the first and \p n copies in the second input is
+/// stored \p max(m-n,0) times, the last copies of the first input. The value of every stored key is
+/// stored with it.
+///
+/// \par Overview
+/// * Both inputs must be sorted by \p compare_function. The output is sorted, and with equal
+/// keys it matches the output of the corresponding function of the C++ standard library.
+/// * The tiles of the merged inputs are found by the merge path partitioning of \p merge, the
+/// keys of the output are selected and compacted in a single pass with a decoupled look-back
+/// of the output counts of the tiles. Equal keys spanning tiles are counted with galloping
+/// searches, so the cost does not depend on the position of the tile boundaries.
+/// * The total size of the inputs must be less than \p 2^32 minus one tile.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p merge_config or
+/// a custom class with the same members.
+/// \tparam KeysInputIterator1 - random-access iterator type of the first keys input range. Must
+/// meet the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysInputIterator2 - random-access iterator type of the second keys input range. Must
+/// meet the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator1 - random-access iterator type of the first values input range.
+/// Must meet the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator2 - random-access iterator type of the second values input range.
+/// Must meet the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the keys output range. Must meet
+/// the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesOutputIterator - random-access iterator type of the values output range. Must
+/// meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OutputCountIterator - random-access iterator type of the output count. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input1 - iterator to the first key of the first input range.
+/// \param [in] keys_input2 - iterator to the first key of the second input range.
+/// \param [in] values_input1 - iterator to the first value of the first input range.
+/// \param [in] values_input2 - iterator to the first value of the second input range.
+/// \param [out] keys_output - iterator to the first key of the output range. It must be large
+/// enough for the keys of the output.
+/// \param [out] values_output - iterator to the first value of the output range.
+/// \param [out] output_count - iterator to the number of pairs stored to the output.
+/// \param [in] input1_size - number of pairs in the first input range.
+/// \param [in] input2_size - number of pairs in the second input range.
+/// \param [in] compare_function - binary operation function object that will be used for key
+/// comparison. The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful operation, \p hipErrorInvalidValue if the
+/// inputs are too large; otherwise a HIP runtime error of type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t         input1_size;   // e.g., 5
+/// size_t         input2_size;   // e.g., 4
+/// int *          keys_input1;   // e.g., [1, 3, 3, 5, 7]
+/// int *          keys_input2;   // e.g., [3, 5, 5, 6]
+/// int *          values_input1; // e.g., [10, 11, 12, 13, 14]
+/// int *          values_input2; // e.g., [20, 21, 22, 23]
+/// int *          keys_output;   // empty array of 9 elements
+/// int *          values_output; // empty array of 9 elements
+/// unsigned int * output_count;  // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::set_difference_by_key(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input1, keys_input2, values_input1, values_input2,
+///     keys_output, values_output, output_count, input1_size, input2_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform the difference
+/// rocprim::set_difference_by_key(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input1, keys_input2, values_input1, values_input2,
+///     keys_output, values_output, output_count, input1_size, input2_size
+/// );
+/// // keys_output: [1, 3, 7]
+/// // values_output: [10, 12, 14]
+/// // output_count: 3
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class ValuesInputIterator1,
+         class ValuesInputIterator2,
+         class KeysOutputIterator,
+         class ValuesOutputIterator,
+         class OutputCountIterator,
+         class BinaryFunction
+         = ::rocprim::less<typename std::iterator_traits<KeysInputIterator1>::value_type>>
+inline hipError_t set_difference_by_key(void*                temporary_storage,
+                                       size_t&              storage_size,
+                                       KeysInputIterator1   keys_input1,
+                                       KeysInputIterator2   keys_input2,
+                                       ValuesInputIterator1 values_input1,
+                                       ValuesInputIterator2 values_input2,
+                                       KeysOutputIterator   keys_output,
+                                       ValuesOutputIterator values_output,
+                                       OutputCountIterator  output_count,
+                                       const size_t         input1_size,
+                                       const size_t         input2_size,
+                                       BinaryFunction       compare_function  = BinaryFunction(),
+                                       const hipStream_t    stream            = 0,
+                                       bool                 debug_synchronous = false)
+{
+    return detail::set_operation_impl<detail::set_operation::difference, Config>(
+        temporary_storage, storage_size, keys_input1, keys_input2, keys_output, values_input1,
+        values_input2, values_output, output_count, input1_size, input2_size, compare_function,
+        stream, debug_synchronous);
+}
+
+/// \brief Parallel symmetric difference of sorted ranges for device level.
+///
+/// \p set_symmetric_difference stores to the output the keys present in only one of the inputs. A
+/// key with \p m copies in the first and \p n copies in the second input is stored \p |m-n| times,
+/// the last copies of the input with more copies.
+///
+/// \par Overview
+/// * Both inputs must be sorted by \p compare_function. The output is sorted, and with equal
+/// keys it matches the output of the corresponding function of the C++ standard library.
+/// * The tiles of the merged inputs are found by the merge path partitioning of \p merge, the
+/// keys of the output are selected and compacted in a single pass with a decoupled look-back
+/// of the output counts of the tiles. Equal keys spanning tiles are counted with galloping
+/// searches, so the cost does not depend on the position of the tile boundaries.
+/// * The total size of the inputs must be less than \p 2^32 minus one tile.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p merge_config or
+/// a custom class with the same members.
+/// \tparam KeysInputIterator1 - random-access iterator type of the first input range. Must meet
+/// the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysInputIterator2 - random-access iterator type of the second input range. Must meet
+/// the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OutputCountIterator - random-access iterator type of the output count. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input1 - iterator to the first key of the first input range.
+/// \param [in] keys_input2 - iterator to the first key of the second input range.
+/// \param [out] keys_output - iterator to the first key of the output range. It must be large
+/// enough for the keys of the output.
+/// \param [out] output_count - iterator to the number of keys stored to the output.
+/// \param [in] input1_size - number of keys in the first input range.
+/// \param [in] input2_size - number of keys in the second input range.
+/// \param [in] compare_function - binary operation function object that will be used for
+/// comparison. The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful operation, \p hipErrorInvalidValue if the
+/// inputs are too large; otherwise a HIP runtime error of type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t         input1_size;  // e.g., 5
+/// size_t         input2_size;  // e.g., 4
+/// int *          keys_input1;  // e.g., [1, 3, 3, 5, 7]
+/// int *          keys_input2;  // e.g., [3, 5, 5, 6]
+/// int *          keys_output;  // empty array of 9 elements
+/// unsigned int * output_count; // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::set_symmetric_difference(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input1, keys_input2, keys_output, output_count, input1_size, input2_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform the symmetric difference
+/// rocprim::set_symmetric_difference(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input1, keys_input2, keys_output, output_count, input1_size, input2_size
+/// );
+/// // keys_output: [1, 3, 5, 6, 7]
+/// // output_count: 5
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class KeysOutputIterator,
+         class OutputCountIterator,
+         class BinaryFunction
+         = ::rocprim::less<typename std::iterator_traits<KeysInputIterator1>::value_type>>
+inline hipError_t set_symmetric_difference(void*               temporary_storage,
+                                          size_t&             storage_size,
+                                          KeysInputIterator1  keys_input1,
+                                          KeysInputIterator2  keys_input2,
+                                          KeysOutputIterator  keys_output,
+                                          OutputCountIterator output_count,
+                                          const size_t        input1_size,
+                                          const size_t        input2_size,
+                                          BinaryFunction      compare_function  = BinaryFunction(),
+                                          const hipStream_t   stream            = 0,
+                                          bool                debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::set_operation_impl<detail::set_operation::symmetric_difference, Config>(
+        temporary_storage, storage_size, keys_input1, keys_input2, keys_output, values, values,
+        values, output_count, input1_size, input2_size, compare_function, stream,
+        debug_synchronous);
+}
+
+/// \brief Parallel symmetric difference of sorted ranges of (key, value) pairs for device level.
+///
+/// \p set_symmetric_difference_by_key stores to the output the keys present in only one of the
+/// inputs. A key with \p m copies in the first and \p n copies in the second input is stored \p
+/// |m-n| times, the last copies of the input with more copies. The value of every stored key is
+/// stored with it.
+///
+/// \par Overview
+/// * Both inputs must be sorted by \p compare_function. The output is sorted, and with equal
+/// keys it matches the output of the corresponding function of the C++ standard library.
+/// * The tiles of the merged inputs are found by the merge path partitioning of \p merge, the
+/// keys of the output are selected and compacted in a single pass with a decoupled look-back
+/// of the output counts of the tiles. Equal keys spanning tiles are counted with galloping
+/// searches, so the cost does not depend on the position of the tile boundaries.
+/// * The total size of the inputs must be less than \p 2^32 minus one tile.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p merge_config or
+/// a custom class with the same members.
+/// \tparam KeysInputIterator1 - random-access iterator type of the first keys input range. Must
+/// meet the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysInputIterator2 - random-access iterator type of the second keys input range. Must
+/// meet the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator1 - random-access iterator type of the first values input range.
+/// Must meet the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator2 - random-access iterator type of the second values input range.
+/// Must meet the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the keys output range. Must meet
+/// the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesOutputIterator - random-access iterator type of the values output range. Must
+/// meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OutputCountIterator - random-access iterator type of the output count. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input1 - iterator to the first key of the first input range.
+/// \param [in] keys_input2 - iterator to the first key of the second input range.
+/// \param [in] values_input1 - iterator to the first value of the first input range.
+/// \param [in] values_input2 - iterator to the first value of the second input range.
+/// \param [out] keys_output - iterator to the first key of the output range. It must be large
+/// enough for the keys of the output.
+/// \param [out] values_output - iterator to the first value of the output range.
+/// \param [out] output_count - iterator to the number of pairs stored to the output.
+/// \param [in] input1_size - number of pairs in the first input range.
+/// \param [in] input2_size - number of pairs in the second input range.
+/// \param [in] compare_function - binary operation function object that will be used for key
+/// comparison. The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful operation, \p hipErrorInvalidValue if the
+/// inputs are too large; otherwise a HIP runtime error of type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t         input1_size;   // e.g., 5
+/// size_t         input2_size;   // e.g., 4
+/// int *          keys_input1;   // e.g., [1, 3, 3, 5, 7]
+/// int *          keys_input2;   // e.g., [3, 5, 5, 6]
+/// int *          values_input1; // e.g., [10, 11, 12, 13, 14]
+/// int *          values_input2; // e.g., [20, 21, 22, 23]
+/// int *          keys_output;   // empty array of 9 elements
+/// int *          values_output; // empty array of 9 elements
+/// unsigned int * output_count;  // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::set_symmetric_difference_by_key(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input1, keys_input2, values_input1, values_input2,
+///     keys_output, values_output, output_count, input1_size, input2_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform the symmetric difference
+/// rocprim::set_symmetric_difference_by_key(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input1, keys_input2, values_input1, values_input2,
+///     keys_output, values_output, output_count, input1_size, input2_size
+/// );
+/// // keys_output: [1, 3, 5, 6, 7]
+/// // values_output: [10, 12, 22, 23, 14]
+/// // output_count: 5
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class ValuesInputIterator1,
+         class ValuesInputIterator2,
+         class KeysOutputIterator,
+         class ValuesOutputIterator,
+         class OutputCountIterator,
+         class BinaryFunction
+         = ::rocprim::less<typename std::iterator_traits<KeysInputIterator1>::value_type>>
+inline hipError_t
+    set_symmetric_difference_by_key(void*                temporary_storage,
+                                    size_t&              storage_size,
+                                    KeysInputIterator1   keys_input1,
+                                    KeysInputIterator2   keys_input2,
+                                    ValuesInputIterator1 values_input1,
+                                    ValuesInputIterator2 values_input2,
+                                    KeysOutputIterator   keys_output,
+                                    ValuesOutputIterator values_output,
+                                    OutputCountIterator  output_count,
+                                    const size_t         input1_size,
+                                    const size_t         input2_size,
+                                    BinaryFunction       compare_function  = BinaryFunction(),
+                                    const hipStream_t    stream            = 0,
+                                    bool                 debug_synchronous = false)
+{
+    return detail::set_operation_impl<detail::set_operation::symmetric_difference, Config>(
+        temporary_storage, storage_size, keys_input1, keys_input2, keys_output, values_input1,
+        values_input2, values_output, output_count, input1_size, input2_size, compare_function,
+        stream, debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_SET_OPERATIONS_HPP_
@@ -0,0 +1,113 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_SHUFFLE_HPP_
+#define ROCPRIM_DEVICE_DEVICE_SHUFFLE_HPP_
+
+#include <iterator>
+
+#include "../config.hpp"
+#include "../functional.hpp"
+#include "../iterator/random_permutation_iterator.hpp"
+
+#include "config_types.hpp"
+#include "device_transform.hpp"
+#include "device_transform_config.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+/// \brief Parallel random shuffle primitive for device level.
+///
+/// shuffle copies the items of \p input to \p output in a pseudo-random order:
+/// <tt>output[i] = input[permutation[i]]</tt>, where \p permutation is the permutation of
+/// <tt>[0, size)</tt> of a <tt>random_permutation_iterator(size, seed)</tt>.
+///
+/// \par Overview
+/// * Ranges specified by \p input and \p output must have at least \p size elements, they must
+/// not overlap.
+/// * The permutation is computed from the positions with a Feistel network keyed by \p seed, no
+/// random keys are generated or sorted. It is a single pass that reads every item once in a
+/// gather and writes the output in order, compared with the passes of sorting by random keys.
+/// * The same \p size and \p seed give the same permutation. Sampling \p k items is reading the
+/// first \p k items of <tt>make_shuffle_iterator(input, size, seed)</tt>, without shuffling
+/// the whole range.
+/// * The permutation is intended for sampling and load balancing, it is not cryptographically
+/// secure.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p transform_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] input - iterator to the first element in the range to shuffle.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] seed - seed of the permutation.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful shuffle; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;    // e.g., 8
+/// int * input;          // e.g., [1, 2, 3, 4, 5, 6, 7, 8]
+/// int * output;         // empty array of 8 elements
+///
+/// // perform shuffle
+/// rocprim::shuffle(input, output, input_size, 42);
+/// // output: a permutation of input, e.g. [6, 1, 8, 3, 2, 7, 5, 4]
+/// \endcode
+/// \endparblock
+template<class Config = default_config, class InputIterator, class OutputIterator>
+inline hipError_t shuffle(InputIterator            input,
+                          OutputIterator           output,
+                          const size_t             size,
+                          const unsigned long long seed,
+                          const hipStream_t        stream            = 0,
+                          bool                     debug_synchronous = false)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    return ::rocprim::transform<Config>(::rocprim::make_shuffle_iterator(input, size, seed),
+                                        output,
+                                        size,
+                                        ::rocprim::identity<input_type>(),
+                                        stream,
+                                        debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_SHUFFLE_HPP_
@@ -0,0 +1,326 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_SLIDING_WINDOW_REDUCE_HPP_
+#define ROCPRIM_DEVICE_DEVICE_SLIDING_WINDOW_REDUCE_HPP_
+
+#include <cstddef>
+#include <iterator>
+
+#include "../config.hpp"
+#include "../functional.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../iterator/counting_iterator.hpp"
+#include "../iterator/reverse_iterator.hpp"
+#include "../iterator/transform_iterator.hpp"
+
+#include "device_scan_by_key.hpp"
+#include "device_transform.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+// Index of the chunk of window items of the index-th item, the items of a chunk have the same key
+struct sliding_window_chunk_op
+{
+    size_t window;
+
+    ROCPRIM_HOST_DEVICE inline
+    size_t operator()(const size_t index) const
+    {
+        return index / window;
+    }
+};
+
+// Index of the chunk of the index-th item from the end
+struct sliding_window_reversed_chunk_op
+{
+    size_t size;
+    size_t window;
+
+    ROCPRIM_HOST_DEVICE inline
+    size_t operator()(const size_t index) const
+    {
+        return (size - 1 - index) / window;
+    }
+};
+
+// The reverse scan accumulates the items from the end of a chunk, so the new item is the left
+// operand and non-commutative operators keep the order of the items
+template<class BinaryFunction>
+struct sliding_window_swapped_op
+{
+    BinaryFunction op;
+
+    template<class T>
+    ROCPRIM_HOST_DEVICE inline
+    T operator()(const T& a, const T& b) const
+    {
+        return op(b, a);
+    }
+};
+
+// The window of the index-th output starts in a chunk and ends in the next one (or at the end of
+// the chunk). It is the suffix of the first chunk reduced with the prefix of the second chunk,
+// these do not overlap, so the operator does not need to be idempotent.
+template<class T, class BinaryFunction>
+struct sliding_window_combine_op
+{
+    const T*       suffixes;
+    const T*       prefixes;
+    size_t         window;
+    BinaryFunction op;
+
+    ROCPRIM_HOST_DEVICE inline
+    T operator()(const size_t index) const
+    {
+        if(index % window == 0)
+        {
+            return suffixes[index];
+        }
+        return op(suffixes[index], prefixes[index + window - 1]);
+    }
+};
+
+} // end of detail namespace
+
+/// \brief Parallel sliding window reduction primitive for device level.
+///
+/// sliding_window_reduce writes to <tt>output[i]</tt> the reduction of the \p window items
+/// <tt>input[i], input[i + 1], ..., input[i + window - 1]</tt> for every
+/// <tt>i < size - window + 1</tt>, for example rolling sums, minimums or maximums.
+///
+/// \par Overview
+/// * The input is split into chunks of \p window items. The reductions of the prefixes and of
+/// the suffixes of every chunk are computed by two scans by key (van Herk / Gil-Werman), then
+/// every window is the suffix of a chunk reduced with the prefix of the next chunk. The cost
+/// is a constant number of operations per item, independent of \p window.
+/// * The suffix and the prefix of a window do not overlap, so \p reduce_op only needs to be
+/// associative: it does not need to be commutative, idempotent or invertible. Floating-point
+/// sums have no cancellation like the difference of two prefix sums.
+/// * Nothing is written if \p size is smaller than \p window. \p window must not be 0,
+/// \p hipErrorInvalidValue is returned otherwise.
+/// * \p input is read twice, it must not alias \p output.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer. The temporary storage holds two arrays of
+/// \p size reductions.
+///
+/// \tparam Config - [optional] configuration of the scans by key. It can be \p scan_config
+/// or \p default_config.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam BinaryFunction - type of binary function used for the reduction. Default type
+/// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to reduce.
+/// \param [out] output - iterator to the first element in the output range, it must have at
+/// least <tt>size - window + 1</tt> elements.
+/// \param [in] size - number of element in the input range.
+/// \param [in] window - number of items of every window.
+/// \param [in] reduce_op - binary operation function object that will be used for reduction.
+/// The signature of the function should be equivalent to the following:
+/// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// Default is BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;    // e.g., 8
+/// size_t window;        // e.g., 3
+/// int * input;          // e.g., [1, 5, 2, 4, 3, 8, 6, 7]
+/// int * output;         // empty array of 6 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::sliding_window_reduce(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size, window, rocprim::maximum<int>()
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform the reduction
+/// rocprim::sliding_window_reduce(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size, window, rocprim::maximum<int>()
+/// );
+/// // output: [5, 5, 4, 8, 8, 8]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class BinaryFunction
+         = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>>
+inline hipError_t sliding_window_reduce(void*             temporary_storage,
+                                        size_t&           storage_size,
+                                        InputIterator     input,
+                                        OutputIterator    output,
+                                        const size_t      size,
+                                        const size_t      window,
+                                        BinaryFunction    reduce_op         = BinaryFunction(),
+                                        const hipStream_t stream            = 0,
+                                        bool              debug_synchronous = false)
+{
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    if(window == 0)
+    {
+        return hipErrorInvalidValue;
+    }
+
+    const auto input_it = detail::to_kernel_input_iterator(input);
+    const auto keys     = ::rocprim::make_transform_iterator(
+        ::rocprim::counting_iterator<size_t>(0), detail::sliding_window_chunk_op{window});
+    const auto reversed_keys = ::rocprim::make_transform_iterator(
+        ::rocprim::counting_iterator<size_t>(0),
+        detail::sliding_window_reversed_chunk_op{size, window});
+    const auto reversed_input = ::rocprim::make_reverse_iterator(input_it + size);
+    const auto swapped_op     = detail::sliding_window_swapped_op<BinaryFunction>{reduce_op};
+
+    value_type* prefixes{};
+    value_type* suffixes{};
+    size_t      prefix_storage_size{};
+    size_t      suffix_storage_size{};
+    void*       prefix_temporary_storage{};
+    void*       suffix_temporary_storage{};
+
+    hipError_t result = ::rocprim::inclusive_scan_by_key<Config>(nullptr,
+                                                                 prefix_storage_size,
+                                                                 keys,
+                                                                 input_it,
+                                                                 prefixes,
+                                                                 size,
+                                                                 reduce_op,
+                                                                 ::rocprim::equal_to<size_t>(),
+                                                                 stream,
+                                                                 debug_synchronous);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    result = ::rocprim::inclusive_scan_by_key<Config>(nullptr,
+                                                      suffix_storage_size,
+                                                      reversed_keys,
+                                                      reversed_input,
+                                                      ::rocprim::make_reverse_iterator(suffixes),
+                                                      size,
+                                                      swapped_op,
+                                                      ::rocprim::equal_to<size_t>(),
+                                                      stream,
+                                                      debug_synchronous);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    // The scans run one after the other, so they share their storage
+    result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&prefixes, size),
+            detail::temp_storage::ptr_aligned_array(&suffixes, size),
+            detail::temp_storage::make_union_partition(
+                detail::temp_storage::make_partition(&prefix_temporary_storage,
+                                                     prefix_storage_size),
+                detail::temp_storage::make_partition(&suffix_temporary_storage,
+                                                     suffix_storage_size))));
+    if(result != hipSuccess || temporary_storage == nullptr)
+    {
+        return result;
+    }
+    if(size < window)
+    {
+        return hipSuccess;
+    }
+
+    result = ::rocprim::inclusive_scan_by_key<Config>(prefix_temporary_storage,
+                                                      prefix_storage_size,
+                                                      keys,
+                                                      input_it,
+                                                      prefixes,
+                                                      size,
+                                                      reduce_op,
+                                                      ::rocprim::equal_to<size_t>(),
+                                                      stream,
+                                                      debug_synchronous);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    result = ::rocprim::inclusive_scan_by_key<Config>(
+        suffix_temporary_storage,
+        suffix_storage_size,
+        reversed_keys,
+        reversed_input,
+        ::rocprim::make_reverse_iterator(suffixes + size),
+        size,
+        swapped_op,
+        ::rocprim::equal_to<size_t>(),
+        stream,
+        debug_synchronous);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    return ::rocprim::transform(
+        ::rocprim::counting_iterator<size_t>(0),
+        output,
+        size - window + 1,
+        detail::sliding_window_combine_op<value_type, BinaryFunction>{suffixes,
+                                                                      prefixes,
+                                                                      window,
+                                                                      reduce_op},
+        stream,
+        debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_SLIDING_WINDOW_REDUCE_HPP_
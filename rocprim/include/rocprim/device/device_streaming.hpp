@@ -0,0 +1,758 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef ROCPRIM_DEVICE_DEVICE_STREAMING_HPP_
+#define ROCPRIM_DEVICE_DEVICE_STREAMING_HPP_
+
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../functional.hpp"
+#include "../intrinsics/thread.hpp"
+#include "../iterator/constant_iterator.hpp"
+#include "../iterator/counting_iterator.hpp"
+#include "../iterator/transform_iterator.hpp"
+
+#include "detail/device_scan_common.hpp"
+#include "device_reduce.hpp"
+#include "device_reduce_by_key.hpp"
+#include "device_scan.hpp"
+#include "device_transform.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+// The state of a stream object is allocated on its first use, so the constructors do not fail
+template<class T>
+inline hipError_t allocate_stream_state(T*& state, const size_t count)
+{
+    if(state != nullptr)
+    {
+        return hipSuccess;
+    }
+    const hipError_t error = hipMalloc(reinterpret_cast<void**>(&state), count * sizeof(T));
+    if(error != hipSuccess)
+    {
+        state = nullptr;
+    }
+    return error;
+}
+
+template<class T>
+inline void free_stream_state(T*& state)
+{
+    if(state != nullptr)
+    {
+        (void)hipFree(state);
+        state = nullptr;
+    }
+}
+
+// The run of reduce_by_key_stream which may continue in the next chunk
+template<class Key, class Aggregate>
+struct reduce_by_key_stream_state
+{
+    Key          key;
+    Aggregate    aggregate;
+    unsigned int has_open_run;
+};
+
+constexpr unsigned int reduce_by_key_stream_block_size = 256;
+
+// Writes the runs of a chunk which are closed: the open run of the previous chunks first, unless
+// the first run of the chunk continues it, then all runs of the chunk except the last one, which
+// becomes the new open run. When the stream is flushed, the last run is closed too.
+template<class Key,
+         class Aggregate,
+         class UniqueOutputIterator,
+         class AggregatesOutputIterator,
+         class UniqueCountOutputIterator,
+         class BinaryFunction,
+         class KeyCompareFunction>
+ROCPRIM_KERNEL
+__launch_bounds__(reduce_by_key_stream_block_size)
+void reduce_by_key_stream_kernel(
+    const Key*                                        chunk_unique,
+    const Aggregate*                                  chunk_aggregates,
+    const size_t*                                     chunk_runs,
+    const reduce_by_key_stream_state<Key, Aggregate>* previous_state,
+    reduce_by_key_stream_state<Key, Aggregate>*       next_state,
+    UniqueOutputIterator                              unique_output,
+    AggregatesOutputIterator                          aggregates_output,
+    UniqueCountOutputIterator                         unique_count_output,
+    const bool                                        flush,
+    BinaryFunction                                    reduce_op,
+    KeyCompareFunction                                key_compare_op)
+{
+    const reduce_by_key_stream_state<Key, Aggregate> open = *previous_state;
+
+    const size_t runs   = chunk_runs != nullptr ? *chunk_runs : 0;
+    const bool   merged
+        = open.has_open_run && runs > 0 && key_compare_op(open.key, chunk_unique[0]);
+    const size_t prepended = open.has_open_run && !merged && (runs > 0 || flush) ? 1 : 0;
+    const size_t closed    = runs > 0 && !flush ? runs - 1 : runs;
+    const size_t count     = prepended + closed;
+
+    const auto aggregate = [&](const size_t run) -> Aggregate
+    {
+        return run == 0 && merged ? reduce_op(open.aggregate, chunk_aggregates[0])
+                                  : chunk_aggregates[run];
+    };
+
+    constexpr unsigned int block_size = reduce_by_key_stream_block_size;
+    const size_t stride = size_t(::rocprim::detail::grid_size<0>()) * block_size;
+    for(size_t i = size_t(::rocprim::detail::block_id<0>()) * block_size
+                   + ::rocprim::detail::block_thread_id<0>();
+        i < count;
+        i += stride)
+    {
+        if(i < prepended)
+        {
+            unique_output[i]     = open.key;
+            aggregates_output[i] = open.aggregate;
+        }
+        else
+        {
+            unique_output[i]     = chunk_unique[i - prepended];
+            aggregates_output[i] = aggregate(i - prepended);
+        }
+    }
+
+    if(::rocprim::detail::block_id<0>() == 0 && ::rocprim::detail::block_thread_id<0>() == 0)
+    {
+        *unique_count_output = count;
+        reduce_by_key_stream_state<Key, Aggregate> next = open;
+        if(flush)
+        {
+            next.has_open_run = 0;
+        }
+        else if(runs > 0)
+        {
+            next.key          = chunk_unique[runs - 1];
+            next.aggregate    = aggregate(runs - 1);
+            next.has_open_run = 1;
+        }
+        *next_state = next;
+    }
+}
+
+} // end namespace detail
+
+/// \brief Inclusive scan of a stream of items which arrive in chunks.
+///
+/// \par Overview
+/// * Every call of \p scan() scans one chunk, continuing the scan of the previous chunks: the
+/// carry, the last scanned value, is kept in device memory and combined with the first item of
+/// the next chunk, so no host synchronization is needed between the chunks.
+/// * The carry is read from the last item of the output, so \p OutputIterator must be readable.
+/// * The device memory of the carry is allocated by the first call and freed by the destructor.
+/// * \p reset() starts a new stream.
+///
+/// \tparam T - the type of the scanned values and of the carry.
+/// \tparam BinaryFunction - [optional] type of binary function used for scan. Default type is
+/// \p rocprim::plus<T>.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// rocprim::inclusive_scan_stream<int> scan;
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage of a chunk
+/// scan.scan(temporary_storage_ptr, temporary_storage_size_bytes, input, output, chunk_size);
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // chunks: [1, 2, 3], [4, 5, 6]
+/// scan.scan(temporary_storage_ptr, temporary_storage_size_bytes, input, output, 3, stream);
+/// // output: [1, 3, 6]
+/// // load the next chunk into input
+/// scan.scan(temporary_storage_ptr, temporary_storage_size_bytes, input, output, 3, stream);
+/// // output: [10, 15, 21]
+/// \endcode
+/// \endparblock
+template<class T, class BinaryFunction = ::rocprim::plus<T>>
+class inclusive_scan_stream
+{
+public:
+    /// \brief Creates a stream object.
+    ///
+    /// \param [in] scan_op - [optional] binary operation function object that will be used for
+    /// scan. Default is BinaryFunction().
+    explicit inclusive_scan_stream(BinaryFunction scan_op = BinaryFunction())
+        : scan_op_(scan_op)
+    {}
+
+    inclusive_scan_stream(const inclusive_scan_stream&) = delete;
+    inclusive_scan_stream& operator=(const inclusive_scan_stream&) = delete;
+
+    ~inclusive_scan_stream()
+    {
+        detail::free_stream_state(carry_);
+    }
+
+    /// \brief Scans the next chunk of the stream.
+    ///
+    /// \tparam Config - [optional] configuration of the primitive, see \p inclusive_scan.
+    /// \tparam InputIterator - random-access iterator type of the input range.
+    /// \tparam OutputIterator - random-access iterator type of the output range, it must be
+    /// readable.
+    ///
+    /// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+    /// a null pointer is passed, the required allocation size (in bytes) is written to
+    /// \p storage_size and function returns without performing the scan operation.
+    /// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+    /// \param [in] input - iterator to the first element of the chunk.
+    /// \param [out] output - iterator to the first element in the output range of the chunk.
+    /// \param [in] size - number of elements of the chunk.
+    /// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+    /// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+    /// launch is forced in order to check for errors. Default value is \p false.
+    ///
+    /// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+    /// type \p hipError_t.
+    template<class Config = default_config, class InputIterator, class OutputIterator>
+    hipError_t scan(void* const       temporary_storage,
+                    size_t&           storage_size,
+                    InputIterator     input,
+                    OutputIterator    output,
+                    const size_t      size,
+                    const hipStream_t stream            = 0,
+                    const bool        debug_synchronous = false)
+    {
+        using input_op_type = detail::scan_first_combined_op<InputIterator, T, BinaryFunction>;
+        using input_type    = transform_iterator<counting_iterator<size_t>, input_op_type, T>;
+        const auto make_input = [&](const T* prefix)
+        {
+            return input_type(counting_iterator<size_t>(0),
+                              input_op_type{input, prefix, scan_op_});
+        };
+
+        if(temporary_storage == nullptr || size == 0)
+        {
+            return ::rocprim::inclusive_scan<Config>(temporary_storage,
+                                                     storage_size,
+                                                     make_input(nullptr),
+                                                     output,
+                                                     size,
+                                                     scan_op_,
+                                                     stream,
+                                                     debug_synchronous);
+        }
+        hipError_t error = detail::allocate_stream_state(carry_, 1);
+        if(error != hipSuccess) return error;
+
+        error = ::rocprim::inclusive_scan<Config>(temporary_storage,
+                                                  storage_size,
+                                                  make_input(has_carry_ ? carry_ : nullptr),
+                                                  output,
+                                                  size,
+                                                  scan_op_,
+                                                  stream,
+                                                  debug_synchronous);
+        if(error != hipSuccess) return error;
+        error = ::rocprim::transform(output + (size - 1),
+                                     carry_,
+                                     1,
+                                     ::rocprim::identity<T>(),
+                                     stream,
+                                     debug_synchronous);
+        if(error != hipSuccess) return error;
+        has_carry_ = true;
+        return hipSuccess;
+    }
+
+    /// \brief Returns the device pointer to the carry, the inclusive scan of all scanned items,
+    /// or \p nullptr if no items are scanned yet.
+    const T* carry() const
+    {
+        return has_carry_ ? carry_ : nullptr;
+    }
+
+    /// \brief Starts a new stream, the next chunk is scanned without a carry.
+    void reset()
+    {
+        has_carry_ = false;
+    }
+
+private:
+    BinaryFunction scan_op_;
+    T*             carry_     = nullptr;
+    bool           has_carry_ = false;
+};
+
+/// \brief Reduction of a stream of items which arrive in chunks.
+///
+/// \par Overview
+/// * Every call of \p reduce() reduces one chunk and combines its reduction with the carry, the
+/// reduction of the initial value and all previous chunks, which is kept in device memory, so no
+/// host synchronization is needed between the chunks.
+/// * \p result() returns the device pointer to the carry, it can be used for example as
+/// \p future_value of another algorithm enqueued to the same stream.
+/// * The device memory of the carry is allocated by the first call and freed by the destructor.
+/// * \p reset() starts a new stream.
+///
+/// \tparam T - the type of the reduced values and of the carry.
+/// \tparam BinaryFunction - [optional] type of binary function used for reduction. Default type
+/// is \p rocprim::plus<T>.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// rocprim::reduce_stream<int> sum(0);
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage of a chunk
+/// sum.reduce(temporary_storage_ptr, temporary_storage_size_bytes, input, chunk_size);
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // chunks: [1, 2, 3], [4, 5, 6]
+/// sum.reduce(temporary_storage_ptr, temporary_storage_size_bytes, input, 3, stream);
+/// // load the next chunk into input
+/// sum.reduce(temporary_storage_ptr, temporary_storage_size_bytes, input, 3, stream);
+/// // *sum.result(): 21
+/// \endcode
+/// \endparblock
+template<class T, class BinaryFunction = ::rocprim::plus<T>>
+class reduce_stream
+{
+public:
+    /// \brief Creates a stream object.
+    ///
+    /// \param [in] initial_value - [optional] the initial value of the reduction. Default is
+    /// T().
+    /// \param [in] reduce_op - [optional] binary operation function object that will be used for
+    /// reduction. Default is BinaryFunction().
+    explicit reduce_stream(T initial_value = T(), BinaryFunction reduce_op = BinaryFunction())
+        : initial_value_(initial_value), reduce_op_(reduce_op)
+    {}
+
+    reduce_stream(const reduce_stream&) = delete;
+    reduce_stream& operator=(const reduce_stream&) = delete;
+
+    ~reduce_stream()
+    {
+        detail::free_stream_state(carry_);
+    }
+
+    /// \brief Reduces the next chunk of the stream.
+    ///
+    /// \tparam Config - [optional] configuration of the primitive, see \p reduce.
+    /// \tparam InputIterator - random-access iterator type of the input range.
+    ///
+    /// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+    /// a null pointer is passed, the required allocation size (in bytes) is written to
+    /// \p storage_size and function returns without performing the reduction.
+    /// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+    /// \param [in] input - iterator to the first element of the chunk.
+    /// \param [in] size - number of elements of the chunk.
+    /// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+    /// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+    /// launch is forced in order to check for errors. Default value is \p false.
+    ///
+    /// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+    /// type \p hipError_t.
+    template<class Config = default_config, class InputIterator>
+    hipError_t reduce(void* const       temporary_storage,
+                      size_t&           storage_size,
+                      InputIterator     input,
+                      const size_t      size,
+                      const hipStream_t stream            = 0,
+                      const bool        debug_synchronous = false)
+    {
+        T*    chunk_reduction;
+        void* nested_storage;
+
+        size_t     nested_size = 0;
+        hipError_t error       = ::rocprim::reduce<Config>(nullptr,
+                                                     nested_size,
+                                                     input,
+                                                     chunk_reduction,
+                                                     size,
+                                                     reduce_op_,
+                                                     stream);
+        if(error != hipSuccess) return error;
+        error = detail::temp_storage::partition(
+            temporary_storage,
+            storage_size,
+            detail::temp_storage::make_linear_partition(
+                detail::temp_storage::ptr_aligned_array(&chunk_reduction, 1),
+                detail::temp_storage::make_partition(&nested_storage, nested_size)));
+        if(error != hipSuccess || temporary_storage == nullptr)
+        {
+            return error;
+        }
+
+        error = detail::allocate_stream_state(carry_, 1);
+        if(error != hipSuccess) return error;
+        if(!has_carry_)
+        {
+            error = ::rocprim::transform(constant_iterator<T>(initial_value_),
+                                         carry_,
+                                         1,
+                                         ::rocprim::identity<T>(),
+                                         stream,
+                                         debug_synchronous);
+            if(error != hipSuccess) return error;
+            has_carry_ = true;
+        }
+        if(size == 0)
+        {
+            return hipSuccess;
+        }
+
+        error = ::rocprim::reduce<Config>(nested_storage,
+                                          nested_size,
+                                          input,
+                                          chunk_reduction,
+                                          size,
+                                          reduce_op_,
+                                          stream,
+                                          debug_synchronous);
+        if(error != hipSuccess) return error;
+        return ::rocprim::transform(carry_,
+                                    chunk_reduction,
+                                    carry_,
+                                    1,
+                                    reduce_op_,
+                                    stream,
+                                    debug_synchronous);
+    }
+
+    /// \brief Returns the device pointer to the carry, the reduction of the initial value and
+    /// all reduced items, or \p nullptr if \p reduce() is not called yet.
+    const T* result() const
+    {
+        return has_carry_ ? carry_ : nullptr;
+    }
+
+    /// \brief Starts a new stream, the next chunk is reduced with the initial value.
+    void reset()
+    {
+        has_carry_ = false;
+    }
+
+private:
+    T              initial_value_;
+    BinaryFunction reduce_op_;
+    T*             carry_     = nullptr;
+    bool           has_carry_ = false;
+};
+
+/// \brief Reduce-by-key of a stream of key-value pairs which arrive in chunks.
+///
+/// \par Overview
+/// * Every call of \p reduce() reduces the runs of equal keys of one chunk. The last run of a
+/// chunk may continue in the next chunk, so it stays open: it is kept in device memory and
+/// written by a later call, when a following chunk starts with a different key or when the
+/// stream is flushed by \p flush(). No host synchronization is needed between the chunks.
+/// * Every call writes the runs closed by its chunk to the beginning of the outputs and their
+/// number to \p unique_count_output. It writes at most \p size runs, one of them may be the open
+/// run of the previous chunks.
+/// * The device memory of the open run is allocated by the first call and freed by the
+/// destructor.
+/// * \p reset() starts a new stream, discarding the open run.
+///
+/// \tparam Key - key type.
+/// \tparam Aggregate - the type of the aggregates.
+/// \tparam BinaryFunction - [optional] type of binary function used for reduction. Default type
+/// is \p rocprim::plus<Aggregate>.
+/// \tparam KeyCompareFunction - [optional] type of binary function used to determine keys
+/// equality. Default type is \p rocprim::equal_to<Key>.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// rocprim::reduce_by_key_stream<int, int> rbk;
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage of a chunk
+/// rbk.reduce(temporary_storage_ptr, temporary_storage_size_bytes, keys_input, values_input,
+///            chunk_size, unique_output, aggregates_output, unique_count_output);
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // chunks: keys [1, 1, 2], [2, 2, 3], values [1, 1, 1], [1, 1, 1]
+/// rbk.reduce(temporary_storage_ptr, temporary_storage_size_bytes, keys_input, values_input, 3,
+///            unique_output, aggregates_output, unique_count_output, stream);
+/// // unique_output: [1], aggregates_output: [2], unique_count_output: [1]
+/// rbk.reduce(temporary_storage_ptr, temporary_storage_size_bytes, keys_input, values_input, 3,
+///            unique_output, aggregates_output, unique_count_output, stream);
+/// // unique_output: [2], aggregates_output: [3], unique_count_output: [1]
+/// rbk.flush(unique_output, aggregates_output, unique_count_output, stream);
+/// // unique_output: [3], aggregates_output: [1], unique_count_output: [1]
+/// \endcode
+/// \endparblock
+template<class Key,
+         class Aggregate,
+         class BinaryFunction     = ::rocprim::plus<Aggregate>,
+         class KeyCompareFunction = ::rocprim::equal_to<Key>>
+class reduce_by_key_stream
+{
+    using state_type = detail::reduce_by_key_stream_state<Key, Aggregate>;
+
+public:
+    /// \brief Creates a stream object.
+    ///
+    /// \param [in] reduce_op - [optional] binary operation function object that will be used for
+    /// reduction. Default is BinaryFunction().
+    /// \param [in] key_compare_op - [optional] binary function object used to determine keys
+    /// equality. Default is KeyCompareFunction().
+    explicit reduce_by_key_stream(BinaryFunction     reduce_op      = BinaryFunction(),
+                                  KeyCompareFunction key_compare_op = KeyCompareFunction())
+        : reduce_op_(reduce_op), key_compare_op_(key_compare_op)
+    {}
+
+    reduce_by_key_stream(const reduce_by_key_stream&) = delete;
+    reduce_by_key_stream& operator=(const reduce_by_key_stream&) = delete;
+
+    ~reduce_by_key_stream()
+    {
+        detail::free_stream_state(states_);
+    }
+
+    /// \brief Reduces the next chunk of the stream and writes the runs it closes.
+    ///
+    /// \tparam Config - [optional] configuration of the primitive, see \p reduce_by_key.
+    ///
+    /// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+    /// a null pointer is passed, the required allocation size (in bytes) is written to
+    /// \p storage_size and function returns without performing the reduction.
+    /// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+    /// \param [in] keys_input - iterator to the first key of the chunk.
+    /// \param [in] values_input - iterator to the first value of the chunk.
+    /// \param [in] size - number of pairs of the chunk.
+    /// \param [out] unique_output - iterator to the first key of the closed runs, the range
+    /// must have at least \p size elements.
+    /// \param [out] aggregates_output - iterator to the first aggregate of the closed runs, the
+    /// range must have at least \p size elements.
+    /// \param [out] unique_count_output - iterator to the number of the closed runs.
+    /// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+    /// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+    /// launch is forced in order to check for errors. Default value is \p false.
+    ///
+    /// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+    /// type \p hipError_t.
+    template<class Config = default_config,
+             class KeysInputIterator,
+             class ValuesInputIterator,
+             class UniqueOutputIterator,
+             class AggregatesOutputIterator,
+             class UniqueCountOutputIterator>
+    hipError_t reduce(void* const               temporary_storage,
+                      size_t&                   storage_size,
+                      KeysInputIterator         keys_input,
+                      ValuesInputIterator       values_input,
+                      const size_t              size,
+                      UniqueOutputIterator      unique_output,
+                      AggregatesOutputIterator  aggregates_output,
+                      UniqueCountOutputIterator unique_count_output,
+                      const hipStream_t         stream            = 0,
+                      const bool                debug_synchronous = false)
+    {
+        Key*       chunk_unique;
+        Aggregate* chunk_aggregates;
+        size_t*    chunk_runs;
+        void*      nested_storage;
+
+        size_t     nested_size = 0;
+        hipError_t error       = ::rocprim::reduce_by_key<Config>(nullptr,
+                                                            nested_size,
+                                                            keys_input,
+                                                            values_input,
+                                                            size,
+                                                            chunk_unique,
+                                                            chunk_aggregates,
+                                                            chunk_runs,
+                                                            reduce_op_,
+                                                            key_compare_op_,
+                                                            stream);
+        if(error != hipSuccess) return error;
+        error = detail::temp_storage::partition(
+            temporary_storage,
+            storage_size,
+            detail::temp_storage::make_linear_partition(
+                detail::temp_storage::ptr_aligned_array(&chunk_unique, size),
+                detail::temp_storage::ptr_aligned_array(&chunk_aggregates, size),
+                detail::temp_storage::ptr_aligned_array(&chunk_runs, 1),
+                detail::temp_storage::make_partition(&nested_storage, nested_size)));
+        if(error != hipSuccess || temporary_storage == nullptr)
+        {
+            return error;
+        }
+
+        if(size > 0)
+        {
+            error = ::rocprim::reduce_by_key<Config>(nested_storage,
+                                                     nested_size,
+                                                     keys_input,
+                                                     values_input,
+                                                     size,
+                                                     chunk_unique,
+                                                     chunk_aggregates,
+                                                     chunk_runs,
+                                                     reduce_op_,
+                                                     key_compare_op_,
+                                                     stream,
+                                                     debug_synchronous);
+            if(error != hipSuccess) return error;
+        }
+        return close_runs(size > 0 ? chunk_unique : nullptr,
+                          chunk_aggregates,
+                          size > 0 ? chunk_runs : nullptr,
+                          size,
+                          false,
+                          unique_output,
+                          aggregates_output,
+                          unique_count_output,
+                          stream,
+                          debug_synchronous);
+    }
+
+    /// \brief Writes the open run, ending the stream. The next chunk starts a new stream.
+    ///
+    /// \param [out] unique_output - iterator to the key of the open run.
+    /// \param [out] aggregates_output - iterator to the aggregate of the open run.
+    /// \param [out] unique_count_output - iterator to the number of written runs, 0 if there is
+    /// no open run.
+    /// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+    /// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+    /// launch is forced in order to check for errors. Default value is \p false.
+    ///
+    /// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+    /// type \p hipError_t.
+    template<class UniqueOutputIterator,
+             class AggregatesOutputIterator,
+             class UniqueCountOutputIterator>
+    hipError_t flush(UniqueOutputIterator      unique_output,
+                     AggregatesOutputIterator  aggregates_output,
+                     UniqueCountOutputIterator unique_count_output,
+                     const hipStream_t         stream            = 0,
+                     const bool                debug_synchronous = false)
+    {
+        return close_runs(nullptr,
+                          nullptr,
+                          nullptr,
+                          1,
+                          true,
+                          unique_output,
+                          aggregates_output,
+                          unique_count_output,
+                          stream,
+                          debug_synchronous);
+    }
+
+    /// \brief Starts a new stream, discarding the open run.
+    void reset()
+    {
+        has_state_ = false;
+    }
+
+private:
+    template<class UniqueOutputIterator,
+             class AggregatesOutputIterator,
+             class UniqueCountOutputIterator>
+    hipError_t close_runs(const Key*                chunk_unique,
+                          const Aggregate*          chunk_aggregates,
+                          const size_t*             chunk_runs,
+                          const size_t              max_count,
+                          const bool                flush,
+                          UniqueOutputIterator      unique_output,
+                          AggregatesOutputIterator  aggregates_output,
+                          UniqueCountOutputIterator unique_count_output,
+                          const hipStream_t         stream,
+                          const bool                debug_synchronous)
+    {
+        // The state is double buffered, the kernel reads the previous one and writes the next one
+        hipError_t error = detail::allocate_stream_state(states_, 2);
+        if(error != hipSuccess) return error;
+        if(!has_state_)
+        {
+            error = hipMemsetAsync(states_ + current_state_, 0, sizeof(state_type), stream);
+            if(error != hipSuccess) return error;
+            has_state_ = true;
+        }
+
+        constexpr unsigned int block_size = detail::reduce_by_key_stream_block_size;
+        // The grid is limited, the threads write multiple runs of large chunks
+        const size_t grid_size = std::max<size_t>(
+            1, std::min<size_t>((max_count + block_size - 1) / block_size, 1 << 16));
+        if(debug_synchronous)
+        {
+            std::cout << "max_count " << max_count << '\n';
+            std::cout << "grid_size " << grid_size << '\n';
+        }
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(detail::reduce_by_key_stream_kernel),
+                           dim3(grid_size),
+                           dim3(block_size),
+                           0,
+                           stream,
+                           chunk_unique,
+                           chunk_aggregates,
+                           chunk_runs,
+                           states_ + current_state_,
+                           states_ + (current_state_ ^ 1),
+                           unique_output,
+                           aggregates_output,
+                           unique_count_output,
+                           flush,
+                           reduce_op_,
+                           key_compare_op_);
+        error = hipGetLastError();
+        if(error != hipSuccess) return error;
+        if(debug_synchronous)
+        {
+            error = hipStreamSynchronize(stream);
+            if(error != hipSuccess) return error;
+        }
+        current_state_ ^= 1;
+        return hipSuccess;
+    }
+
+    BinaryFunction     reduce_op_;
+    KeyCompareFunction key_compare_op_;
+    state_type*        states_        = nullptr;
+    unsigned int       current_state_ = 0;
+    bool               has_state_     = false;
+};
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_STREAMING_HPP_
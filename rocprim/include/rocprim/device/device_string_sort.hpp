@@ -0,0 +1,384 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_STRING_SORT_HPP_
+#define ROCPRIM_DEVICE_DEVICE_STRING_SORT_HPP_
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <utility>
+
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+
+#include "../iterator/counting_iterator.hpp"
+#include "detail/device_string_sort.hpp"
+#include "device_segmented_merge_sort.hpp"
+#include "device_segmented_radix_sort.hpp"
+#include "device_select.hpp"
+#include "instrumentation.hpp"
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+ROCPRIM_KERNEL
+__launch_bounds__(string_sort_block_size)
+void string_sort_init_kernel(unsigned int * permutation,
+                             unsigned char * flags,
+                             unsigned int * begin_offsets,
+                             unsigned int * end_offsets,
+                             const unsigned int size)
+{
+    string_sort_init(permutation, flags, begin_offsets, end_offsets, size);
+}
+
+template<class OffsetIterator>
+ROCPRIM_KERNEL
+__launch_bounds__(string_sort_block_size)
+void string_sort_load_keys_kernel(const unsigned char * chars,
+                                  OffsetIterator offsets,
+                                  const unsigned int * permutation,
+                                  const unsigned char * flags,
+                                  uint64_t * keys,
+                                  const unsigned int size,
+                                  const unsigned int pass)
+{
+    string_sort_load_keys(chars, offsets, permutation, flags, keys, size, pass);
+}
+
+ROCPRIM_KERNEL
+__launch_bounds__(string_sort_block_size)
+void string_sort_split_groups_kernel(const uint64_t * keys,
+                                     const unsigned char * flags_input,
+                                     unsigned char * flags_output,
+                                     const unsigned int size)
+{
+    string_sort_split_groups(keys, flags_input, flags_output, size);
+}
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
+    { \
+        auto _error = hipGetLastError(); \
+        if(_error != hipSuccess) return _error; \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
+        if(debug_synchronous) \
+        { \
+            std::cout << name << "(" << size << ")"; \
+            auto __error = hipStreamSynchronize(stream); \
+            if(__error != hipSuccess) return __error; \
+            auto _end = std::chrono::high_resolution_clock::now(); \
+            auto _d = std::chrono::duration_cast<std::chrono::duration<double>>(_end - start); \
+            std::cout << " " << _d.count() * 1000 << " ms" << '\n'; \
+        } \
+    }
+
+template<class OffsetIterator>
+inline
+hipError_t string_sort_impl(void * temporary_storage,
+                            size_t& storage_size,
+                            const unsigned char * chars,
+                            OffsetIterator offsets,
+                            unsigned int * permutation_output,
+                            const unsigned int size,
+                            const unsigned int radix_passes,
+                            const hipStream_t stream,
+                            const bool debug_synchronous)
+{
+    using offset_type = typename std::iterator_traits<OffsetIterator>::value_type;
+    using position_iterator = counting_iterator<unsigned int>;
+
+    // A tied group has at least two strings
+    const unsigned int max_groups = size / 2 + 1;
+
+    uint64_t *      keys{};
+    uint64_t *      keys_sorted{};
+    unsigned int *  permutation_tmp{};
+    unsigned char * flags{};
+    unsigned char * flags_tmp{};
+    unsigned int *  begin_offsets{};
+    unsigned int *  end_offsets{};
+    unsigned int *  group_count_output{};
+    void *          sort_temporary_storage{};
+    void *          select_temporary_storage{};
+    void *          merge_sort_temporary_storage{};
+
+    size_t sort_storage_size = 0;
+    hipError_t result = ::rocprim::segmented_radix_sort_pairs(nullptr, sort_storage_size,
+                                                              keys, keys_sorted,
+                                                              permutation_output, permutation_tmp,
+                                                              size, max_groups, begin_offsets, end_offsets,
+                                                              0, 64, stream, debug_synchronous);
+    if(result != hipSuccess) return result;
+
+    size_t select_storage_size = 0;
+    result = ::rocprim::select(nullptr, select_storage_size,
+                               position_iterator(0), begin_offsets, group_count_output, size,
+                               string_sort_select_group_begin{flags}, stream, debug_synchronous);
+    if(result != hipSuccess) return result;
+
+    const string_sort_compare<OffsetIterator> compare_function{
+        chars, offsets, static_cast<offset_type>(radix_passes) * string_sort_chunk_bytes};
+    size_t merge_sort_storage_size = 0;
+    result = ::rocprim::segmented_merge_sort(nullptr, merge_sort_storage_size,
+                                             permutation_output, permutation_tmp,
+                                             size, max_groups, begin_offsets, end_offsets,
+                                             compare_function, stream, debug_synchronous);
+    if(result != hipSuccess) return result;
+
+    result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&keys, size),
+            detail::temp_storage::ptr_aligned_array(&keys_sorted, size),
+            detail::temp_storage::ptr_aligned_array(&permutation_tmp, size),
+            detail::temp_storage::ptr_aligned_array(&flags, size),
+            detail::temp_storage::ptr_aligned_array(&flags_tmp, size),
+            detail::temp_storage::ptr_aligned_array(&begin_offsets, max_groups),
+            detail::temp_storage::ptr_aligned_array(&end_offsets, max_groups),
+            detail::temp_storage::ptr_aligned_array(&group_count_output, 2),
+            detail::temp_storage::make_union_partition(
+                detail::temp_storage::make_partition(&sort_temporary_storage,
+                                                     sort_storage_size),
+                detail::temp_storage::make_partition(&select_temporary_storage,
+                                                     select_storage_size),
+                detail::temp_storage::make_partition(&merge_sort_temporary_storage,
+                                                     merge_sort_storage_size))));
+    if(result != hipSuccess || temporary_storage == nullptr)
+    {
+        return result;
+    }
+
+    if(size == 0u)
+    {
+        return hipSuccess;
+    }
+
+    const unsigned int grid_size = ::rocprim::detail::ceiling_div(size, string_sort_block_size);
+
+    std::chrono::high_resolution_clock::time_point start;
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("string_sort_init_kernel");
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(string_sort_init_kernel),
+        dim3(grid_size), dim3(string_sort_block_size), 0, stream,
+        permutation_output, flags, begin_offsets, end_offsets, size
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("string_sort_init_kernel", size, start)
+
+    // The sorted permutation alternates between the output and the temporary buffer
+    unsigned int * permutation = permutation_output;
+    unsigned int groups = size > 1 ? 1 : 0;
+    for(unsigned int pass = 0; pass < radix_passes && groups > 0; pass++)
+    {
+        if(debug_synchronous)
+        {
+            std::cout << "pass " << pass << ", tied groups " << groups << '\n';
+        }
+
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("string_sort_load_keys_kernel");
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(string_sort_load_keys_kernel),
+            dim3(grid_size), dim3(string_sort_block_size), 0, stream,
+            chars, offsets, permutation, flags, keys, size, pass
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("string_sort_load_keys_kernel", size, start)
+
+        // Only the tied groups are sorted, the other positions must keep their strings
+        unsigned int * permutation_sorted
+            = permutation == permutation_output ? permutation_tmp : permutation_output;
+        result = hipMemcpyAsync(permutation_sorted, permutation, size * sizeof(unsigned int),
+                                hipMemcpyDeviceToDevice, stream);
+        if(result != hipSuccess) return result;
+
+        result = ::rocprim::segmented_radix_sort_pairs(sort_temporary_storage, sort_storage_size,
+                                                       keys, keys_sorted,
+                                                       permutation, permutation_sorted,
+                                                       size, groups, begin_offsets, end_offsets,
+                                                       0, 64, stream, debug_synchronous);
+        if(result != hipSuccess) return result;
+        permutation = permutation_sorted;
+
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("string_sort_split_groups_kernel");
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(string_sort_split_groups_kernel),
+            dim3(grid_size), dim3(string_sort_block_size), 0, stream,
+            keys_sorted, flags, flags_tmp, size
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("string_sort_split_groups_kernel", size, start)
+        std::swap(flags, flags_tmp);
+
+        // The begins and the ends of the tied groups are selected in the same order
+        result = ::rocprim::select(select_temporary_storage, select_storage_size,
+                                   position_iterator(0), begin_offsets, group_count_output, size,
+                                   string_sort_select_group_begin{flags}, stream, debug_synchronous);
+        if(result != hipSuccess) return result;
+        result = ::rocprim::select(select_temporary_storage, select_storage_size,
+                                   position_iterator(1), end_offsets, group_count_output + 1, size,
+                                   string_sort_select_group_end{flags, size}, stream, debug_synchronous);
+        if(result != hipSuccess) return result;
+
+        result = detail::memcpy_and_sync(&groups, group_count_output, sizeof(groups),
+                                         hipMemcpyDeviceToHost, stream);
+        if(result != hipSuccess) return result;
+    }
+
+    if(groups > 0)
+    {
+        // The remaining groups share a long prefix, they are sorted by comparing the suffixes
+        if(debug_synchronous)
+        {
+            std::cout << "comparison sort, tied groups " << groups << '\n';
+        }
+        unsigned int * permutation_sorted
+            = permutation == permutation_output ? permutation_tmp : permutation_output;
+        result = hipMemcpyAsync(permutation_sorted, permutation, size * sizeof(unsigned int),
+                                hipMemcpyDeviceToDevice, stream);
+        if(result != hipSuccess) return result;
+
+        result = ::rocprim::segmented_merge_sort(merge_sort_temporary_storage, merge_sort_storage_size,
+                                                 permutation, permutation_sorted,
+                                                 size, groups, begin_offsets, end_offsets,
+                                                 compare_function, stream, debug_synchronous);
+        if(result != hipSuccess) return result;
+        permutation = permutation_sorted;
+    }
+
+    if(permutation != permutation_output)
+    {
+        result = hipMemcpyAsync(permutation_output, permutation, size * sizeof(unsigned int),
+                                hipMemcpyDeviceToDevice, stream);
+        if(result != hipSuccess) return result;
+    }
+    return hipSuccess;
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
+} // end namespace detail
+
+/// \brief Parallel sort primitive for variable-length byte strings.
+///
+/// \p string_sort function computes the permutation that sorts \p size strings stored
+/// in one character buffer. The strings are not moved.
+///
+/// \par Overview
+/// * The string \p i is the range <tt>[chars + offsets[i], chars + offsets[i + 1])</tt>.
+/// * Strings are compared lexicographically by their bytes as <tt>unsigned char</tt>,
+/// a string is ordered before all strings it is a prefix of.
+/// * The sort is stable: equal strings are ordered by their index.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Range specified by \p offsets must have at least <tt>size + 1</tt> elements.
+/// * Range specified by \p permutation_output must have at least \p size elements,
+/// it receives the indices of the strings in sorted order.
+/// * The strings are sorted by most significant digit radix passes: every pass sorts, with
+/// \p segmented_radix_sort_pairs, each group of strings tied on all previous bytes by
+/// a key of the next 7 bytes and the number of remaining bytes. Groups still tied after
+/// \p radix_passes passes are sorted by comparing the rest of the strings
+/// with \p segmented_merge_sort.
+/// * Every pass synchronizes the stream once to get the number of tied groups.
+///
+/// \tparam OffsetIterator - random-access iterator type of the string offsets. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] chars - pointer to the character buffer of the strings.
+/// \param [in] offsets - iterator to the first element in the range of string offsets.
+/// \param [out] permutation_output - pointer to the first element in the output range.
+/// \param [in] size - number of strings.
+/// \param [in] radix_passes - [optional] the maximum number of radix passes, each of them
+/// compares 7 more bytes. Default value is \p 4.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the permutation that sorts 4 strings is computed.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int size;           // e.g., 4
+/// unsigned char * chars;       // e.g., "bcabbab"
+/// unsigned int * offsets;      // e.g., [0, 2, 3, 5, 7] ("bc", "a", "bb", "ab")
+/// unsigned int * permutation;  // empty array of 4 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::string_sort(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     chars, offsets, permutation, size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform sort
+/// rocprim::string_sort(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     chars, offsets, permutation, size
+/// );
+/// // permutation: [1, 3, 2, 0]
+/// \endcode
+/// \endparblock
+template<class OffsetIterator>
+inline
+hipError_t string_sort(void * temporary_storage,
+                       size_t& storage_size,
+                       const unsigned char * chars,
+                       OffsetIterator offsets,
+                       unsigned int * permutation_output,
+                       const unsigned int size,
+                       const unsigned int radix_passes = 4,
+                       const hipStream_t stream = 0,
+                       const bool debug_synchronous = false)
+{
+    return detail::string_sort_impl(
+        temporary_storage, storage_size,
+        chars, offsets, permutation_output, size, radix_passes,
+        stream, debug_synchronous
+    );
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_DEVICE_STRING_SORT_HPP_
@@ -0,0 +1,270 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef ROCPRIM_DEVICE_DEVICE_TILE_PIPELINE_HPP_
+#define ROCPRIM_DEVICE_DEVICE_TILE_PIPELINE_HPP_
+
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../functional.hpp"
+#include "../detail/various.hpp"
+#include "../iterator/discard_iterator.hpp"
+
+#include "detail/device_tile_pipeline.hpp"
+#include "device_partition.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+/// \brief The stages of a fused device-level pipeline, created by \p make_tile_pipeline and
+/// executed by \p run_tile_pipeline.
+///
+/// \tparam Stages - the types of the stages, created by \p tile_transform, \p tile_select and
+/// \p tile_inclusive_scan.
+template<class... Stages>
+struct tile_pipeline
+{
+    /// \brief The stages in the order they are applied to the values.
+    detail::tile_stage_list<Stages...> stages;
+};
+
+/// \brief A stage of a tile pipeline that replaces every value by <tt>op(value)</tt>.
+template<class Op>
+ROCPRIM_HOST_DEVICE inline
+detail::tile_transform_stage<Op> tile_transform(Op op)
+{
+    return detail::tile_transform_stage<Op>{op};
+}
+
+/// \brief A stage of a tile pipeline that keeps the values for which <tt>predicate(value)</tt>
+/// is \p true. The predicate is evaluated on the value as it is at this stage, it is not
+/// evaluated for values rejected by a previous stage.
+template<class UnaryPredicate>
+ROCPRIM_HOST_DEVICE inline
+detail::tile_select_stage<UnaryPredicate> tile_select(UnaryPredicate predicate)
+{
+    return detail::tile_select_stage<UnaryPredicate>{predicate};
+}
+
+/// \brief The last stage of a tile pipeline, which replaces the selected values by their
+/// inclusive scan with \p op. \p op must be associative.
+template<class BinaryFunction = ::rocprim::plus<>>
+ROCPRIM_HOST_DEVICE inline
+detail::tile_inclusive_scan_stage<BinaryFunction> tile_inclusive_scan(BinaryFunction op
+                                                                      = BinaryFunction())
+{
+    return detail::tile_inclusive_scan_stage<BinaryFunction>{op};
+}
+
+/// \brief Creates a tile pipeline of \p stages, which are applied to the values in order.
+template<class... Stages>
+ROCPRIM_HOST_DEVICE inline
+tile_pipeline<Stages...> make_tile_pipeline(Stages... stages)
+{
+    return tile_pipeline<Stages...>{detail::make_tile_stage_list(stages...)};
+}
+
+namespace detail
+{
+
+template<class Config,
+         class InputIterator,
+         class OutputIterator,
+         class SelectedCountOutputIterator,
+         class StageList>
+inline hipError_t run_tile_pipeline_impl(std::true_type /*has_scan*/,
+                                         void*                       temporary_storage,
+                                         size_t&                     storage_size,
+                                         InputIterator               input,
+                                         OutputIterator              output,
+                                         SelectedCountOutputIterator selected_count_output,
+                                         const size_t                size,
+                                         const StageList&            stages,
+                                         const hipStream_t           stream,
+                                         bool                        debug_synchronous)
+{
+    return transform_select_scan_impl<Config>(temporary_storage,
+                                              storage_size,
+                                              input,
+                                              ::rocprim::discard_iterator(),
+                                              output,
+                                              selected_count_output,
+                                              size,
+                                              tile_pipeline_transform_op<StageList>{stages},
+                                              tile_pipeline_select_op{},
+                                              get_tile_scan_op(stages),
+                                              stream,
+                                              debug_synchronous);
+}
+
+template<class Config,
+         class InputIterator,
+         class OutputIterator,
+         class SelectedCountOutputIterator,
+         class StageList>
+inline hipError_t run_tile_pipeline_impl(std::false_type /*has_scan*/,
+                                         void*                       temporary_storage,
+                                         size_t&                     storage_size,
+                                         InputIterator               input,
+                                         OutputIterator              output,
+                                         SelectedCountOutputIterator selected_count_output,
+                                         const size_t                size,
+                                         const StageList&            stages,
+                                         const hipStream_t           stream,
+                                         bool                        debug_synchronous)
+{
+    return transform_select_scan_impl<Config>(temporary_storage,
+                                              storage_size,
+                                              input,
+                                              output,
+                                              ::rocprim::discard_iterator(),
+                                              selected_count_output,
+                                              size,
+                                              tile_pipeline_transform_op<StageList>{stages},
+                                              tile_pipeline_select_op{},
+                                              tile_pipeline_no_scan_op{},
+                                              stream,
+                                              debug_synchronous);
+}
+
+} // end of detail namespace
+
+/// \brief Parallel fused pipeline primitive for device level.
+///
+/// run_tile_pipeline applies the stages of \p pipeline to the values of \p input and writes the
+/// results to \p output in one kernel per launch, so no intermediate results are written to
+/// global memory.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Every tile is loaded with the \p key_block_load_method of the configuration, then the
+/// transform and select stages are applied to its values in registers. The values that are
+/// kept by all select stages are compacted by a decoupled look-back over their counts, and
+/// when the last stage is a \p tile_inclusive_scan the look-back carries their reduction too,
+/// so the compacted values are scanned in the same pass.
+/// * \p output gets the kept values, or their inclusive scan if the last stage is a scan, in the
+/// order of the input. \p selected_count_output gets their number.
+/// * Range specified by \p input must have at least \p size elements, range specified by
+/// \p output must have at least so many elements, that all kept values can be copied into it.
+/// * Pipelines of transforms only are computed like pipelines with select stages, \p transform
+/// is faster for them.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p select_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. It can be
+/// a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. It can be
+/// a simple pointer type.
+/// \tparam SelectedCountOutputIterator - random-access iterator type of the selected_count_output
+/// value. It can be a simple pointer type.
+/// \tparam Stages - the types of the stages of the pipeline.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the input range.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [out] selected_count_output - iterator to the number of values written to \p output.
+/// \param [in] size - number of element in the input range.
+/// \param [in] pipeline - the stages, see \p make_tile_pipeline.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// auto square = [] __device__ (int a) -> int { return a * a; };
+/// auto is_odd = [] __device__ (int a) -> bool { return (a%2) == 1; };
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;     // e.g., 8
+/// int * input;           // e.g., [1, 2, 3, 4, 5, 6, 7, 8]
+/// int * output;          // empty array of 8 elements
+/// size_t * output_count; // empty array of 1 element
+///
+/// // Running sum of the squares of the odd values
+/// const auto pipeline = rocprim::make_tile_pipeline(rocprim::tile_select(is_odd),
+///                                                   rocprim::tile_transform(square),
+///                                                   rocprim::tile_inclusive_scan());
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::run_tile_pipeline(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, output_count, input_size, pipeline
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // run the pipeline
+/// rocprim::run_tile_pipeline(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, output_count, input_size, pipeline
+/// );
+/// // output: [1, 10, 35, 84]
+/// // output_count: 4
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class SelectedCountOutputIterator,
+         class... Stages>
+inline hipError_t run_tile_pipeline(void*                           temporary_storage,
+                                    size_t&                         storage_size,
+                                    InputIterator                   input,
+                                    OutputIterator                  output,
+                                    SelectedCountOutputIterator     selected_count_output,
+                                    const size_t                    size,
+                                    const tile_pipeline<Stages...>& pipeline,
+                                    const hipStream_t               stream            = 0,
+                                    bool                            debug_synchronous = false)
+{
+    using stage_list_type = detail::tile_stage_list<Stages...>;
+    return detail::run_tile_pipeline_impl<Config>(
+        std::integral_constant<bool, stage_list_type::has_scan>{},
+        temporary_storage,
+        storage_size,
+        detail::to_kernel_input_iterator(input),
+        output,
+        selected_count_output,
+        size,
+        pipeline.stages,
+        stream,
+        debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_TILE_PIPELINE_HPP_
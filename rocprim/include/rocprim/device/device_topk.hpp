@@ -0,0 +1,547 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_TOPK_HPP_
+#define ROCPRIM_DEVICE_DEVICE_TOPK_HPP_
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/radix_sort.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../iterator/discard_iterator.hpp"
+#include "../types.hpp"
+
+#include "detail/device_radix_select.hpp"
+#include "device_partition.hpp"
+#include "device_radix_sort.hpp"
+#include "device_select_kth.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+template<class Config,
+         bool              Descending,
+         radix_float_order FloatOrder,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator>
+inline hipError_t topk_impl(void*                temporary_storage,
+                            size_t&              storage_size,
+                            KeysInputIterator    keys_input,
+                            KeysOutputIterator   keys_output,
+                            ValuesInputIterator  values_input,
+                            ValuesOutputIterator values_output,
+                            const size_t         size,
+                            size_t               k,
+                            const hipStream_t    stream,
+                            bool                 debug_synchronous)
+{
+    using key_type     = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type   = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    using key_codec    = radix_key_codec<key_type, Descending, FloatOrder>;
+    using bit_key_type = typename key_codec::bit_key_type;
+    using state_type   = radix_select_state<bit_key_type>;
+
+    constexpr bool         with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+    constexpr unsigned int key_bits    = key_codec::key_bits;
+
+    k = std::min(k, size);
+
+    state_type*         state               = nullptr;
+    unsigned long long* histogram           = nullptr;
+    size_t*             selected_count      = nullptr;
+    key_type*           keys_buffer         = nullptr;
+    value_type*         values_buffer       = nullptr;
+    void*               nested_temp_storage = nullptr;
+
+    // Keys before the threshold go to the front of the buffer, the ones equal to the threshold
+    // follow them; all other keys are discarded.
+    const auto compact_selected = [&](void* partition_temp_storage, size_t& partition_storage_size)
+    {
+        using offset_type = uint2;
+        using keys_tie_output_type   = topk_tie_output_iterator<key_type*, bit_key_type>;
+        using values_tie_output_type = topk_tie_output_iterator<value_type*, bit_key_type>;
+        using keys_output_type       = tuple<key_type*, keys_tie_output_type, discard_iterator>;
+        using values_output_type     = tuple<value_type*, values_tie_output_type, discard_iterator>;
+        ::rocprim::empty_type* const no_flags = nullptr;
+
+        const keys_output_type keys_buffer_output{keys_buffer,
+                                                  keys_tie_output_type(keys_buffer, state),
+                                                  discard_iterator()};
+        const values_output_type values_buffer_output{values_buffer,
+                                                      values_tie_output_type(values_buffer, state),
+                                                      discard_iterator()};
+
+        return partition_impl<select_method::predicate, false, default_config, offset_type>(
+            partition_temp_storage,
+            partition_storage_size,
+            keys_input,
+            values_input,
+            no_flags,
+            keys_buffer_output,
+            values_buffer_output,
+            selected_count,
+            size,
+            ::rocprim::empty_type(),
+            stream,
+            debug_synchronous,
+            topk_before_threshold_op<key_codec>{state},
+            topk_at_threshold_op<key_codec>{state});
+    };
+
+    // The survivors are sorted from the buffer to the output
+    const auto sort_selected = [&](void* sort_temp_storage, size_t& sort_storage_size)
+    {
+        bool ignored;
+        return radix_sort_impl<Config, Descending, FloatOrder, ::rocprim::identity_decomposer>(
+            sort_temp_storage,
+            sort_storage_size,
+            keys_buffer,
+            nullptr,
+            keys_output,
+            values_buffer,
+            nullptr,
+            values_output,
+            k,
+            ignored,
+            0,
+            key_bits,
+            stream,
+            debug_synchronous);
+    };
+
+    size_t     partition_storage_size = 0;
+    size_t     sort_storage_size      = 0;
+    hipError_t error;
+    if(k > 0)
+    {
+        error = compact_selected(nullptr, partition_storage_size);
+        if(error != hipSuccess) return error;
+        error = sort_selected(nullptr, sort_storage_size);
+        if(error != hipSuccess) return error;
+    }
+
+    const hipError_t partition_result = temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        temp_storage::make_linear_partition(
+            temp_storage::ptr_aligned_array(&state, 1),
+            temp_storage::ptr_aligned_array(&histogram, radix_select_size),
+            temp_storage::ptr_aligned_array(&selected_count, 2),
+            temp_storage::ptr_aligned_array(&keys_buffer, k),
+            temp_storage::ptr_aligned_array(&values_buffer, with_values ? k : 0),
+            // The compaction and the sort run one after another, so they share the storage
+            temp_storage::make_partition(&nested_temp_storage,
+                                         std::max(partition_storage_size, sort_storage_size))));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(k == 0)
+        return hipSuccess;
+
+    // The threshold is the k-th key
+    error = radix_select_impl<key_codec>(keys_input,
+                                         size,
+                                         state,
+                                         histogram,
+                                         1,
+                                         topk_rank_op{k},
+                                         stream,
+                                         debug_synchronous);
+    if(error != hipSuccess) return error;
+
+    error = compact_selected(nested_temp_storage, partition_storage_size);
+    if(error != hipSuccess) return error;
+
+    return sort_selected(nested_temp_storage, sort_storage_size);
+}
+
+} // end of detail namespace
+
+/// \brief Parallel top-k primitive for device level.
+///
+/// \p topk_keys function selects the \p k smallest keys of the input range and stores them to
+/// the output range in ascending order.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * \p Key type (a \p value_type of \p KeysInputIterator and \p KeysOutputIterator) must be
+/// an arithmetic type (that is, an integral type or a floating-point type).
+/// * Range specified by \p keys_input must have at least \p size elements, range specified by
+/// \p keys_output must have at least <tt>min(k, size)</tt> elements.
+/// * Keys are compared in the same way as in \p radix_sort_keys. If several keys are equal to the
+/// k-th key, the ones that come first in the input are selected.
+/// * The threshold key is found by radix select, i.e. by histograms of one 8-bit digit at a time,
+/// then the selected keys are compacted and only they are sorted, which needs much less memory
+/// traffic than sorting the whole input when \p k is small.
+///
+/// \tparam Config - [optional] configuration of the sort of the selected keys. It can be
+/// \p radix_sort_config or a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to select keys from.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] k - number of keys to select.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful selection; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the 3 smallest of an array of integer values are selected.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;    // e.g., 8
+/// int * input;          // e.g., [6, 3, 5, 4, 2, 8, 1, 7]
+/// int * output;         // empty array of 3 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::topk_keys(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size, 3
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform selection
+/// rocprim::topk_keys(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size, 3
+/// );
+/// // output: [1, 2, 3]
+/// \endcode
+/// \endparblock
+template<class Config                = default_config,
+         radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+         class KeysInputIterator,
+         class KeysOutputIterator>
+inline hipError_t topk_keys(void*              temporary_storage,
+                            size_t&            storage_size,
+                            KeysInputIterator  keys_input,
+                            KeysOutputIterator keys_output,
+                            const size_t       size,
+                            const size_t       k,
+                            const hipStream_t  stream            = 0,
+                            bool               debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::topk_impl<Config, false, FloatOrder>(temporary_storage,
+                                                        storage_size,
+                                                        keys_input,
+                                                        keys_output,
+                                                        values,
+                                                        values,
+                                                        size,
+                                                        k,
+                                                        stream,
+                                                        debug_synchronous);
+}
+
+/// \brief Parallel descending top-k primitive for device level.
+///
+/// \p topk_keys_desc function selects the \p k largest keys of the input range and stores them to
+/// the output range in descending order.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * \p Key type (a \p value_type of \p KeysInputIterator and \p KeysOutputIterator) must be
+/// an arithmetic type (that is, an integral type or a floating-point type).
+/// * Range specified by \p keys_input must have at least \p size elements, range specified by
+/// \p keys_output must have at least <tt>min(k, size)</tt> elements.
+/// * Keys are compared in the same way as in \p radix_sort_keys_desc. If several keys are equal
+/// to the k-th key, the ones that come first in the input are selected.
+///
+/// \tparam Config - [optional] configuration of the sort of the selected keys. It can be
+/// \p radix_sort_config or a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to select keys from.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] k - number of keys to select.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful selection; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config                = default_config,
+         radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+         class KeysInputIterator,
+         class KeysOutputIterator>
+inline hipError_t topk_keys_desc(void*              temporary_storage,
+                                 size_t&            storage_size,
+                                 KeysInputIterator  keys_input,
+                                 KeysOutputIterator keys_output,
+                                 const size_t       size,
+                                 const size_t       k,
+                                 const hipStream_t  stream            = 0,
+                                 bool               debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::topk_impl<Config, true, FloatOrder>(temporary_storage,
+                                                       storage_size,
+                                                       keys_input,
+                                                       keys_output,
+                                                       values,
+                                                       values,
+                                                       size,
+                                                       k,
+                                                       stream,
+                                                       debug_synchronous);
+}
+
+/// \brief Parallel top-k primitive for device level.
+///
+/// \p topk_pairs function selects the (key, value) pairs with the \p k smallest keys of the
+/// input range and stores them to the output range in ascending order of keys.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * \p Key type (a \p value_type of \p KeysInputIterator and \p KeysOutputIterator) must be
+/// an arithmetic type (that is, an integral type or a floating-point type).
+/// * Ranges specified by \p keys_input and \p values_input must have at least \p size elements,
+/// ranges specified by \p keys_output and \p values_output must have at least
+/// <tt>min(k, size)</tt> elements.
+/// * Keys are compared in the same way as in \p radix_sort_pairs. If several keys are equal to
+/// the k-th key, the pairs that come first in the input are selected.
+///
+/// \tparam Config - [optional] configuration of the sort of the selected pairs. It can be
+/// \p radix_sort_config or a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to select keys from.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] values_input - pointer to the first element in the range of values.
+/// \param [out] values_output - pointer to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] k - number of pairs to select.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful selection; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the 3 pairs with the smallest keys are selected.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;          // e.g., 8
+/// int * keys_input;           // e.g., [ 6, 3,  5, 4,  1,  8,  1, 7]
+/// double * values_input;      // e.g., [-5, 2, -4, 3, -1, -8, -2, 7]
+/// int * keys_output;          // empty array of 3 elements
+/// double * values_output;     // empty array of 3 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::topk_pairs(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input, keys_output, values_input, values_output,
+///     input_size, 3
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform selection
+/// rocprim::topk_pairs(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input, keys_output, values_input, values_output,
+///     input_size, 3
+/// );
+/// // keys_output:   [ 1,  1, 3]
+/// // values_output: [-1, -2, 2]
+/// \endcode
+/// \endparblock
+template<class Config                = default_config,
+         radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator>
+inline hipError_t topk_pairs(void*                temporary_storage,
+                             size_t&              storage_size,
+                             KeysInputIterator    keys_input,
+                             KeysOutputIterator   keys_output,
+                             ValuesInputIterator  values_input,
+                             ValuesOutputIterator values_output,
+                             const size_t         size,
+                             const size_t         k,
+                             const hipStream_t    stream            = 0,
+                             bool                 debug_synchronous = false)
+{
+    return detail::topk_impl<Config, false, FloatOrder>(temporary_storage,
+                                                        storage_size,
+                                                        keys_input,
+                                                        keys_output,
+                                                        values_input,
+                                                        values_output,
+                                                        size,
+                                                        k,
+                                                        stream,
+                                                        debug_synchronous);
+}
+
+/// \brief Parallel descending top-k primitive for device level.
+///
+/// \p topk_pairs_desc function selects the (key, value) pairs with the \p k largest keys of the
+/// input range and stores them to the output range in descending order of keys.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * \p Key type (a \p value_type of \p KeysInputIterator and \p KeysOutputIterator) must be
+/// an arithmetic type (that is, an integral type or a floating-point type).
+/// * Ranges specified by \p keys_input and \p values_input must have at least \p size elements,
+/// ranges specified by \p keys_output and \p values_output must have at least
+/// <tt>min(k, size)</tt> elements.
+/// * Keys are compared in the same way as in \p radix_sort_pairs_desc. If several keys are equal
+/// to the k-th key, the pairs that come first in the input are selected.
+///
+/// \tparam Config - [optional] configuration of the sort of the selected pairs. It can be
+/// \p radix_sort_config or a custom class with the same members.
+/// \tparam FloatOrder - [optional] ordering of floating-point keys, see \p radix_float_order.
+/// Ignored for non floating-point key types. Default: \p radix_float_order::signed_zeros_equal.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to select keys from.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] values_input - pointer to the first element in the range of values.
+/// \param [out] values_output - pointer to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] k - number of pairs to select.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful selection; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config                = default_config,
+         radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator>
+inline hipError_t topk_pairs_desc(void*                temporary_storage,
+                                  size_t&              storage_size,
+                                  KeysInputIterator    keys_input,
+                                  KeysOutputIterator   keys_output,
+                                  ValuesInputIterator  values_input,
+                                  ValuesOutputIterator values_output,
+                                  const size_t         size,
+                                  const size_t         k,
+                                  const hipStream_t    stream            = 0,
+                                  bool                 debug_synchronous = false)
+{
+    return detail::topk_impl<Config, true, FloatOrder>(temporary_storage,
+                                                       storage_size,
+                                                       keys_input,
+                                                       keys_output,
+                                                       values_input,
+                                                       values_output,
+                                                       size,
+                                                       k,
+                                                       stream,
+                                                       debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_TOPK_HPP_
@@ -30,10 +30,13 @@
 #include "../detail/various.hpp"
 #include "../detail/match_result_type.hpp"
 #include "../types/tuple.hpp"
+#include "../types/future_value.hpp"
 #include "../iterator/zip_iterator.hpp"
+#include "../iterator/detail/cache_modified_iterator.hpp"
 
 #include "device_transform_config.hpp"
 #include "detail/device_transform.hpp"
+#include "instrumentation.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -63,10 +66,33 @@ void transform_kernel(InputIterator input,
     );
 }
 
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    class ResultType,
+    class InputIterator,
+    class SizeType,
+    class OutputIterator,
+    class UnaryFunction
+>
+ROCPRIM_KERNEL
+__launch_bounds__(BlockSize)
+void transform_future_size_kernel(InputIterator input,
+                                  const SizeType size,
+                                  const size_t offset,
+                                  OutputIterator output,
+                                  UnaryFunction transform_op)
+{
+    transform_future_size_kernel_impl<BlockSize, ItemsPerThread, ResultType>(
+        input, size, offset, output, transform_op
+    );
+}
+
 #define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
     { \
         auto _error = hipGetLastError(); \
         if(_error != hipSuccess) return _error; \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
         if(debug_synchronous) \
         { \
             std::cout << name << "(" << size << ")"; \
@@ -87,6 +113,10 @@ void transform_kernel(InputIterator input,
 ///
 /// \par Overview
 /// * Ranges specified by \p input and \p output must have at least \p size elements.
+/// * Data in pinned host memory can be transformed in place through a \p mapped_host_iterator,
+/// instead of being copied to device memory first. Full blocks of such ranges are accessed
+/// with 16-byte vector accesses like pointers, which is important for the throughput of the
+/// PCIe or xGMI link.
 ///
 /// \tparam Config - [optional] configuration of the primitive. It can be \p transform_config or
 /// a custom class with the same members.
@@ -182,20 +212,59 @@ hipError_t transform(InputIterator input,
 
     static constexpr auto aligned_size_limit = number_of_blocks_limit * items_per_block;
 
+    // Items before the first item where both pointers are aligned for vector accesses are
+    // transformed by a separate launch, so all following blocks are aligned
+    const size_t head = detail::transform_unaligned_head<items_per_thread>(input, output, size);
+
+    // The cache modifiers of the configuration are applied to pointer input and output
+    const auto cached_input = detail::make_cache_modified_input_iterator<
+        detail::config_load_cache_modifier<config>::value>(input);
+    const auto cached_output = detail::make_cache_modified_output_iterator<
+        detail::config_store_cache_modifier<config>::value>(output);
+    using cached_input_type = typename std::remove_const<decltype(cached_input)>::type;
+    using cached_output_type = typename std::remove_const<decltype(cached_output)>::type;
+
+    if(head > 0)
+    {
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("transform_kernel");
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(detail::transform_kernel<
+                block_size, items_per_thread, result_type,
+                cached_input_type, cached_output_type, UnaryFunction
+            >),
+            dim3(1), dim3(block_size), 0, stream,
+            cached_input, head, cached_output, transform_op
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("transform_kernel", head, start);
+    }
+
+    // The blocks of a grid limited by blocks_per_cu or scoped_grid_limit transform multiple
+    // tiles
+    size_t max_grid_size = number_of_blocks_limit;
+    const hipError_t grid_result = detail::limit_grid_size(
+        max_grid_size, detail::config_blocks_per_cu<config>::value);
+    if(grid_result != hipSuccess)
+    {
+        return grid_result;
+    }
+
     // Launch number_of_blocks_limit blocks while there is still at least as many blocks left as the limit
-    const auto number_of_launch = (size + aligned_size_limit - 1) / aligned_size_limit;
-    for(size_t i = 0, offset = 0; i < number_of_launch; ++i, offset += aligned_size_limit) {
+    const auto number_of_launch = (size - head + aligned_size_limit - 1) / aligned_size_limit;
+    for(size_t i = 0, offset = head; i < number_of_launch; ++i, offset += aligned_size_limit) {
         const auto current_size = std::min(size - offset, aligned_size_limit);
-        const auto current_blocks = (current_size + items_per_block - 1) / items_per_block;
+        const auto current_blocks
+            = std::min((current_size + items_per_block - 1) / items_per_block, max_grid_size);
 
         if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("transform_kernel");
         hipLaunchKernelGGL(
             HIP_KERNEL_NAME(detail::transform_kernel<
                 block_size, items_per_thread, result_type,
-                InputIterator, OutputIterator, UnaryFunction
+                cached_input_type, cached_output_type, UnaryFunction
             >),
             dim3(current_blocks), dim3(block_size), 0, stream,
-            input + offset, current_size, output + offset, transform_op
+            cached_input + offset, current_size, cached_output + offset, transform_op
         );
         ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("transform_kernel", current_size, start);
     }
@@ -203,6 +272,140 @@ hipError_t transform(InputIterator input,
     return hipSuccess;
 }
 
+/// \brief Parallel transform primitive for device level with a size computed on the device.
+///
+/// transform function performs a device-wide transformation operation
+/// using unary \p transform_op operator. The number of elements is read on the device, so it
+/// can be the output of a previous primitive (for example the selected count of \p select)
+/// without synchronizing with the host.
+///
+/// \par Overview
+/// * The grid is sized for \p max_size elements, blocks past the actual size exit early.
+/// * The value of \p size must not be greater than \p max_size.
+/// * Ranges specified by \p input and \p output must have at least \p size elements.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p transform_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam Size - integral type of the number of elements.
+/// \tparam SizeIterator - iterator type of the device location of the number of elements.
+/// \tparam UnaryFunction - type of unary function used for transform.
+///
+/// \param [in] input - iterator to the first element in the range to transform.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [in] size - number of element in the input range, read on the device.
+/// \param [in] max_size - upper bound of \p size, used to size the grid.
+/// \param [in] transform_op - unary operation function object that will be used for transform.
+/// The signature of the function should be equivalent to the following:
+/// <tt>U f(const T &a);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the object passed to it.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \par Example
+/// \parblock
+/// In this example the selected values of \p select are transformed without copying
+/// the number of selected values to the host.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;             // e.g., 8
+/// int * selected;                // e.g., [1, 3, 5, 7, -, -, -, -], selected by rocprim::select
+/// unsigned int * selected_count; // e.g., [4], selected count of rocprim::select
+/// int * output;                  // empty array of 8 elements
+///
+/// // perform transform
+/// rocprim::transform(
+///     selected, output,
+///     rocprim::future_value<unsigned int>(selected_count), input_size,
+///     [] __device__ (int a) -> int { return a + 1; }
+/// );
+/// // output: [2, 4, 6, 8, -, -, -, -]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class InputIterator,
+    class OutputIterator,
+    class Size,
+    class SizeIterator,
+    class UnaryFunction
+>
+inline
+hipError_t transform(InputIterator input,
+                     OutputIterator output,
+                     const ::rocprim::future_value<Size, SizeIterator> size,
+                     const size_t max_size,
+                     UnaryFunction transform_op,
+                     const hipStream_t stream = 0,
+                     bool debug_synchronous = false)
+{
+    if( max_size == size_t(0) )
+        return hipSuccess;
+
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+    using result_type = typename ::rocprim::detail::invoke_result<UnaryFunction, input_type>::type;
+
+    // Get default config if Config is default_config
+    using config = detail::default_or_custom_config<
+        Config,
+        detail::default_transform_config<ROCPRIM_TARGET_ARCH, result_type>
+    >;
+
+    static constexpr unsigned int block_size = config::block_size;
+    static constexpr unsigned int items_per_thread = config::items_per_thread;
+    static constexpr auto items_per_block = block_size * items_per_thread;
+
+    // Start point for time measurements
+    std::chrono::high_resolution_clock::time_point start;
+
+    static constexpr auto size_limit = config::size_limit;
+    static constexpr auto number_of_blocks_limit
+        = ::rocprim::max<size_t>(size_limit / items_per_block, 1);
+
+    auto number_of_blocks = (max_size + items_per_block - 1)/items_per_block;
+    if(debug_synchronous)
+    {
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << number_of_blocks << '\n';
+        std::cout << "number of blocks limit " << number_of_blocks_limit << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+    }
+
+    static constexpr auto aligned_size_limit = number_of_blocks_limit * items_per_block;
+
+    const auto cached_input = detail::make_cache_modified_input_iterator<
+        detail::config_load_cache_modifier<config>::value>(input);
+    const auto cached_output = detail::make_cache_modified_output_iterator<
+        detail::config_store_cache_modifier<config>::value>(output);
+
+    // Every launch reads the size and skips the blocks past it
+    const auto number_of_launch = (max_size + aligned_size_limit - 1) / aligned_size_limit;
+    for(size_t i = 0, offset = 0; i < number_of_launch; ++i, offset += aligned_size_limit) {
+        const auto current_size = std::min(max_size - offset, aligned_size_limit);
+        const auto current_blocks = (current_size + items_per_block - 1) / items_per_block;
+
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("transform_future_size_kernel");
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(detail::transform_future_size_kernel<
+                block_size, items_per_thread, result_type
+            >),
+            dim3(current_blocks), dim3(block_size), 0, stream,
+            cached_input + offset, size, offset, cached_output + offset, transform_op
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("transform_future_size_kernel", current_size, start);
+    }
+
+    return hipSuccess;
+}
+
 /// \brief Parallel device-level transform primitive for two inputs.
 ///
 /// transform function performs a device-wide transformation operation
@@ -286,6 +489,90 @@ hipError_t transform(InputIterator1 input1,
     );
 }
 
+/// \brief Parallel transform primitive for device level with several inputs and outputs.
+///
+/// transform function performs a device-wide transformation operation of several input
+/// ranges to several output ranges using \p transform_op operator.
+///
+/// \par Overview
+/// * Ranges specified by \p inputs and \p outputs must have at least \p size elements.
+/// * \p transform_op takes one value of every input range and returns a \p rocprim::tuple
+/// of a value for every output range.
+/// * Every input and output range is loaded and stored separately, so ranges of pointers
+/// are accessed with vector loads and stores.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p transform_config or
+/// a custom class with the same members.
+/// \tparam InputIterators - random-access iterator types of the input ranges. Must meet the
+/// requirements of a C++ InputIterator concept. They can be simple pointer types.
+/// \tparam OutputIterators - random-access iterator types of the output ranges. Must meet the
+/// requirements of a C++ OutputIterator concept. They can be simple pointer types.
+/// \tparam NaryFunction - type of the function used for transform.
+///
+/// \param [in] inputs - tuple of iterators to the first elements in the ranges to transform.
+/// \param [out] outputs - tuple of iterators to the first elements in the output ranges.
+/// \param [in] size - number of element in the input ranges.
+/// \param [in] transform_op - operation function object that will be used for transform.
+/// The signature of the function should be equivalent to the following:
+/// <tt>rocprim::tuple<U1, U2> f(const T1& a, const T2& b, const T3& c);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced. Default value is \p false.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level transform operation computes the sum and the product
+/// of three arrays of floats.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // custom transform function
+/// auto transform_op =
+///     [] __device__ (float a, float b, float c) -> rocprim::tuple<float, float>
+///     {
+///         return rocprim::make_tuple(a + b + c, a * b * c);
+///     };
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t size;    // e.g., 4
+/// float* input1;  // e.g., [1, 2, 3, 4]
+/// float* input2;  // e.g., [1, 1, 2, 2]
+/// float* input3;  // e.g., [2, 2, 1, 1]
+/// float* sums;    // empty array of 4 elements
+/// float* products; // empty array of 4 elements
+///
+/// // perform transform
+/// rocprim::transform(
+///     rocprim::make_tuple(input1, input2, input3), rocprim::make_tuple(sums, products),
+///     size, transform_op
+/// );
+/// // sums:     [4, 5, 6, 7]
+/// // products: [2, 4, 6, 8]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class... InputIterators,
+    class... OutputIterators,
+    class NaryFunction
+>
+inline
+hipError_t transform(::rocprim::tuple<InputIterators...> inputs,
+                     ::rocprim::tuple<OutputIterators...> outputs,
+                     const size_t size,
+                     NaryFunction transform_op,
+                     const hipStream_t stream = 0,
+                     bool debug_synchronous = false)
+{
+    return transform<Config>(
+        ::rocprim::make_zip_iterator(inputs), ::rocprim::make_zip_iterator(outputs),
+        size, detail::unpack_nary_op<NaryFunction>(transform_op),
+        stream, debug_synchronous
+    );
+}
+
 #undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
 
 /// @}
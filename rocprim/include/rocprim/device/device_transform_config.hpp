@@ -35,10 +35,33 @@
 BEGIN_ROCPRIM_NAMESPACE
 
 /// \brief Configuration of device-level transform primitives.
-template <unsigned int BlockSize,
-          unsigned int ItemsPerThread,
-          unsigned int SizeLimit = ROCPRIM_GRID_SIZE_LIMIT>
-using transform_config = kernel_config<BlockSize, ItemsPerThread, SizeLimit>;
+///
+/// \tparam BlockSize - number of threads in a block.
+/// \tparam ItemsPerThread - number of items processed by each thread.
+/// \tparam SizeLimit - limit on the number of items for a single transform kernel launch.
+/// \tparam LoadCacheModifier - cache modifier of the loads of the input, it is applied when
+/// the input is a pointer.
+/// \tparam StoreCacheModifier - cache modifier of the stores of the output, it is applied when
+/// the output is a pointer. \p store_cs streams the output past the caches, which is useful
+/// when the output is not read again soon.
+/// \tparam BlocksPerCU - when not 0, the grid is limited to \p BlocksPerCU blocks per compute
+/// unit and every block transforms tiles until all of them are transformed. A limited grid
+/// leaves compute units to kernels running concurrently on other streams.
+template<unsigned int        BlockSize,
+         unsigned int        ItemsPerThread,
+         unsigned int        SizeLimit          = ROCPRIM_GRID_SIZE_LIMIT,
+         cache_load_modifier  LoadCacheModifier  = load_default,
+         cache_store_modifier StoreCacheModifier = store_default,
+         unsigned int         BlocksPerCU        = 0>
+struct transform_config : kernel_config<BlockSize, ItemsPerThread, SizeLimit>
+{
+    /// \brief Cache modifier of the loads of the input.
+    static constexpr cache_load_modifier load_cache_modifier = LoadCacheModifier;
+    /// \brief Cache modifier of the stores of the output.
+    static constexpr cache_store_modifier store_cache_modifier = StoreCacheModifier;
+    /// \brief Maximum number of blocks per compute unit, 0 if the grid is not limited.
+    static constexpr unsigned int blocks_per_cu = BlocksPerCU;
+};
 
 namespace detail
 {
@@ -86,7 +109,11 @@ struct default_transform_config
         select_arch_case<803, transform_config_803<Value>>,
         select_arch_case<900, transform_config_900<Value>>,
         select_arch_case<ROCPRIM_ARCH_90a, transform_config_90a<Value>>,
+        select_arch_case<940, transform_config_90a<Value>>,
+        select_arch_case<941, transform_config_90a<Value>>,
+        select_arch_case<942, transform_config_90a<Value>>,
         select_arch_case<1030, transform_config_1030<Value>>,
+        select_arch_case<1100, transform_config_1030<Value>>,
         transform_config_900<Value>
     > { };
 
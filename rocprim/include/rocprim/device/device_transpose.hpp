@@ -0,0 +1,390 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_TRANSPOSE_HPP_
+#define ROCPRIM_DEVICE_DEVICE_TRANSPOSE_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iterator>
+
+#include "../config.hpp"
+#include "../detail/various.hpp"
+
+#include "config_types.hpp"
+#include "detail/device_transpose.hpp"
+#include "device_transform_config.hpp"
+#include "instrumentation.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+template<unsigned int BlockSize,
+         unsigned int RecordsPerThread,
+         unsigned int Fields,
+         class T,
+         class InputIterator,
+         class OutputIterator>
+ROCPRIM_KERNEL __launch_bounds__(BlockSize)
+void aos_to_soa_kernel(InputIterator                                     input,
+                       transpose_field_iterators<OutputIterator, Fields> outputs,
+                       const size_t                                      size)
+{
+    aos_to_soa_kernel_impl<BlockSize, RecordsPerThread, Fields, T>(input, outputs, size);
+}
+
+template<unsigned int BlockSize,
+         unsigned int RecordsPerThread,
+         unsigned int Fields,
+         class T,
+         class InputIterator,
+         class OutputIterator>
+ROCPRIM_KERNEL __launch_bounds__(BlockSize)
+void soa_to_aos_kernel(transpose_field_iterators<InputIterator, Fields> inputs,
+                       OutputIterator                                   output,
+                       const size_t                                     size)
+{
+    soa_to_aos_kernel_impl<BlockSize, RecordsPerThread, Fields, T>(inputs, output, size);
+}
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
+    { \
+        auto _error = hipGetLastError(); \
+        if(_error != hipSuccess) return _error; \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
+        if(debug_synchronous) \
+        { \
+            std::cout << name << "(" << size << ")"; \
+            _error = hipStreamSynchronize(stream); \
+            if(_error != hipSuccess) return _error; \
+            auto _end = std::chrono::high_resolution_clock::now(); \
+            auto _d = std::chrono::duration_cast<std::chrono::duration<double>>(_end - start); \
+            std::cout << " " << _d.count() * 1000 << " ms" << '\n'; \
+        } \
+    }
+
+// The items per thread of the configuration are the values of a thread, which are split into
+// whole records
+template<unsigned int Fields, class Config, class T>
+struct transpose_params
+{
+    using config = default_or_custom_config<Config,
+                                            default_transform_config<ROCPRIM_TARGET_ARCH, T>>;
+
+    static constexpr unsigned int block_size = config::block_size;
+    static constexpr unsigned int records_per_thread
+        = ::rocprim::max(1u, config::items_per_thread / Fields);
+    static constexpr unsigned int records_per_block = block_size * records_per_thread;
+    static constexpr size_t       blocks_limit
+        = ::rocprim::max<size_t>(config::size_limit / records_per_block, 1);
+};
+
+template<unsigned int Fields, class Config, class InputIterator, class OutputIterator>
+inline hipError_t aos_to_soa_impl(InputIterator                                     input,
+                                  transpose_field_iterators<OutputIterator, Fields> outputs,
+                                  const size_t                                      size,
+                                  const hipStream_t                                 stream,
+                                  bool debug_synchronous)
+{
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+    using params     = transpose_params<Fields, Config, value_type>;
+
+    static constexpr unsigned int block_size         = params::block_size;
+    static constexpr unsigned int records_per_thread = params::records_per_thread;
+    static constexpr unsigned int records_per_block  = params::records_per_block;
+    static constexpr size_t       size_limit         = params::blocks_limit * records_per_block;
+
+    if(debug_synchronous)
+    {
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << ceiling_div(size, records_per_block) << '\n';
+        std::cout << "records_per_block " << records_per_block << '\n';
+    }
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    for(size_t offset = 0; offset < size; offset += size_limit)
+    {
+        const size_t current_size = std::min(size - offset, size_limit);
+
+        transpose_field_iterators<OutputIterator, Fields> current_outputs = outputs;
+        for(unsigned int field = 0; field < Fields; field++)
+        {
+            current_outputs[field] = outputs[field] + offset;
+        }
+
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("aos_to_soa_kernel");
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(aos_to_soa_kernel<block_size,
+                                                             records_per_thread,
+                                                             Fields,
+                                                             value_type,
+                                                             InputIterator,
+                                                             OutputIterator>),
+                           dim3(ceiling_div(current_size, records_per_block)),
+                           dim3(block_size),
+                           0,
+                           stream,
+                           input + offset * Fields,
+                           current_outputs,
+                           current_size);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("aos_to_soa_kernel", current_size, start);
+    }
+
+    return hipSuccess;
+}
+
+template<unsigned int Fields, class Config, class InputIterator, class OutputIterator>
+inline hipError_t soa_to_aos_impl(transpose_field_iterators<InputIterator, Fields> inputs,
+                                  OutputIterator                                   output,
+                                  const size_t                                     size,
+                                  const hipStream_t                                stream,
+                                  bool debug_synchronous)
+{
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+    using params     = transpose_params<Fields, Config, value_type>;
+
+    static constexpr unsigned int block_size         = params::block_size;
+    static constexpr unsigned int records_per_thread = params::records_per_thread;
+    static constexpr unsigned int records_per_block  = params::records_per_block;
+    static constexpr size_t       size_limit         = params::blocks_limit * records_per_block;
+
+    if(debug_synchronous)
+    {
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << ceiling_div(size, records_per_block) << '\n';
+        std::cout << "records_per_block " << records_per_block << '\n';
+    }
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    for(size_t offset = 0; offset < size; offset += size_limit)
+    {
+        const size_t current_size = std::min(size - offset, size_limit);
+
+        transpose_field_iterators<InputIterator, Fields> current_inputs = inputs;
+        for(unsigned int field = 0; field < Fields; field++)
+        {
+            current_inputs[field] = inputs[field] + offset;
+        }
+
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("soa_to_aos_kernel");
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(soa_to_aos_kernel<block_size,
+                                                             records_per_thread,
+                                                             Fields,
+                                                             value_type,
+                                                             InputIterator,
+                                                             OutputIterator>),
+                           dim3(ceiling_div(current_size, records_per_block)),
+                           dim3(block_size),
+                           0,
+                           stream,
+                           current_inputs,
+                           output + offset * Fields,
+                           current_size);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("soa_to_aos_kernel", current_size, start);
+    }
+
+    return hipSuccess;
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
+} // end of detail namespace
+
+/// \brief Parallel array of structs to struct of arrays transpose primitive for device level.
+///
+/// aos_to_soa writes the field \p f of the record \p i, the value
+/// <tt>input[i * Fields + f]</tt>, to <tt>output[f][i]</tt>.
+///
+/// \par Overview
+/// * Every thread loads whole records with vector loads of its consecutive values when
+/// \p input is a pointer, the fields are moved to the striped arrangement in shared memory and
+/// every field is stored coalesced. \p zip_iterator outputs with \p transform would access the
+/// records with a stride of \p Fields values instead.
+/// * The range specified by \p input must have at least <tt>size * Fields</tt> elements, the
+/// ranges specified by \p output must have at least \p size elements.
+/// * The items per thread of the configuration are the values of a thread, every thread
+/// transposes <tt>max(1, items_per_thread / Fields)</tt> records.
+///
+/// \tparam Fields - number of fields of a record.
+/// \tparam Config - [optional] configuration of the primitive. It can be \p transform_config
+/// or a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output ranges. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] input - iterator to the first value of the first record.
+/// \param [out] output - iterators to the first element of the output range of every field.
+/// \param [in] size - number of records.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful transpose; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t size;        // e.g., 4
+/// float * input;      // e.g., [1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12]
+/// float * output[3];  // 3 empty arrays of 4 elements
+///
+/// rocprim::aos_to_soa<3>(input, output, size);
+/// // output: [[1, 4, 7, 10], [2, 5, 8, 11], [3, 6, 9, 12]]
+/// \endcode
+/// \endparblock
+template<unsigned int Fields,
+         class Config = default_config,
+         class InputIterator,
+         class OutputIterator>
+inline hipError_t aos_to_soa(InputIterator     input,
+                             OutputIterator    output[Fields],
+                             const size_t      size,
+                             const hipStream_t stream            = 0,
+                             bool              debug_synchronous = false)
+{
+    detail::transpose_field_iterators<OutputIterator, Fields> outputs;
+    for(unsigned int field = 0; field < Fields; field++)
+    {
+        outputs[field] = output[field];
+    }
+    return detail::aos_to_soa_impl<Fields, Config>(input, outputs, size, stream, debug_synchronous);
+}
+
+/// \brief Parallel struct of arrays to array of structs transpose primitive for device level.
+///
+/// soa_to_aos writes the value <tt>input[f][i]</tt> to the field \p f of the record \p i,
+/// <tt>output[i * Fields + f]</tt>. It is the inverse of \p aos_to_soa.
+///
+/// \par Overview
+/// * Every field is loaded coalesced, the fields are moved to the blocked arrangement in shared
+/// memory and every thread stores whole records with vector stores of its consecutive values
+/// when \p output is a pointer.
+/// * The ranges specified by \p input must have at least \p size elements, the range specified
+/// by \p output must have at least <tt>size * Fields</tt> elements.
+/// * The items per thread of the configuration are the values of a thread, every thread
+/// transposes <tt>max(1, items_per_thread / Fields)</tt> records.
+///
+/// \tparam Fields - number of fields of a record.
+/// \tparam Config - [optional] configuration of the primitive. It can be \p transform_config
+/// or a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input ranges. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] input - iterators to the first element of the input range of every field.
+/// \param [out] output - iterator to the first value of the first record.
+/// \param [in] size - number of records.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful transpose; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<unsigned int Fields,
+         class Config = default_config,
+         class InputIterator,
+         class OutputIterator>
+inline hipError_t soa_to_aos(InputIterator     input[Fields],
+                             OutputIterator    output,
+                             const size_t      size,
+                             const hipStream_t stream            = 0,
+                             bool              debug_synchronous = false)
+{
+    detail::transpose_field_iterators<InputIterator, Fields> inputs;
+    for(unsigned int field = 0; field < Fields; field++)
+    {
+        inputs[field] = input[field];
+    }
+    return detail::soa_to_aos_impl<Fields, Config>(inputs, output, size, stream, debug_synchronous);
+}
+
+/// \brief Parallel matrix transpose primitive for device level.
+///
+/// transpose writes the transpose of the row-major \p rows x \p Columns matrix \p input to
+/// the row-major \p Columns x \p rows matrix \p output: the value <tt>input[r * Columns + c]</tt>
+/// is written to <tt>output[c * rows + r]</tt>.
+///
+/// \par Overview
+/// * The rows are the records of \p aos_to_soa and the rows of the output are its fields, so
+/// the tiles are transposed in shared memory and both matrices are accessed coalesced.
+/// * The transpose is undone by \p soa_to_aos with the rows of the output as its inputs.
+/// * The ranges specified by \p input and \p output must have at least <tt>rows * Columns</tt>
+/// elements.
+///
+/// \tparam Columns - number of columns of the input matrix.
+/// \tparam Config - [optional] configuration of the primitive. It can be \p transform_config
+/// or a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] input - iterator to the first element of the input matrix.
+/// \param [out] output - iterator to the first element of the output matrix.
+/// \param [in] rows - number of rows of the input matrix.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful transpose; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<unsigned int Columns,
+         class Config = default_config,
+         class InputIterator,
+         class OutputIterator>
+inline hipError_t transpose(InputIterator     input,
+                            OutputIterator    output,
+                            const size_t      rows,
+                            const hipStream_t stream            = 0,
+                            bool              debug_synchronous = false)
+{
+    detail::transpose_field_iterators<OutputIterator, Columns> outputs;
+    for(unsigned int column = 0; column < Columns; column++)
+    {
+        outputs[column] = output + column * rows;
+    }
+    return detail::aos_to_soa_impl<Columns, Config>(input,
+                                                    outputs,
+                                                    rows,
+                                                    stream,
+                                                    debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_TRANSPOSE_HPP_
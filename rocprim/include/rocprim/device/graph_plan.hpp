@@ -0,0 +1,256 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_GRAPH_PLAN_HPP_
+#define ROCPRIM_DEVICE_GRAPH_PLAN_HPP_
+
+#include "../config.hpp"
+
+// The graph API is available since ROCm 5.0
+#if HIP_VERSION_MAJOR >= 5
+    #define ROCPRIM_DETAIL_HAS_GRAPHS 1
+#else
+    #define ROCPRIM_DETAIL_HAS_GRAPHS 0
+#endif
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+/// \brief A reusable launch plan of device-level algorithms recorded into a HIP graph.
+///
+/// \par Overview
+/// * \p capture() calls a function which enqueues device-level algorithms to the stream it is
+/// given. The stream is captured, so the configs, the grid sizes and the kernel arguments are
+/// resolved once and stored in a graph instead of being launched.
+/// * \p launch() replays all recorded kernels with a single graph launch, which reduces the host
+/// overhead of repetitive small problems to the cost of one launch.
+/// * When the pointers or the sizes change, \p capture() is called again. If the new graph has
+/// the same topology, the instantiated graph is updated in place, otherwise it is instantiated
+/// again.
+/// * Temporary storage must be allocated before the capture and stay valid while the plan is
+/// launched; the sizes are queried as usual with \p nullptr temporary storage, which enqueues
+/// no work. \p debug_synchronous must be \p false, as the stream cannot be synchronized while it
+/// is captured.
+/// * Algorithms which read intermediate results on the host skip such optimizations while the
+/// stream is captured (for example \p radix_sort runs the passes of uniform digits). Algorithms
+/// whose launches depend on results computed on the device, like the partitioning of the segments
+/// of \p segmented_radix_sort, cannot be captured, \p capture() then returns the error.
+/// * Graphs require ROCm 5.0 or newer, otherwise \p capture() returns \p hipErrorNotSupported.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// size_t temporary_storage_size_bytes;
+/// rocprim::radix_sort_keys(nullptr, temporary_storage_size_bytes, input, output, size);
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// rocprim::graph_plan plan;
+/// plan.capture(
+///     [&](hipStream_t capture_stream)
+///     {
+///         return rocprim::radix_sort_keys(temporary_storage_ptr, temporary_storage_size_bytes,
+///                                         input, output, size, 0, 8 * sizeof(int),
+///                                         capture_stream);
+///     });
+/// for(int batch = 0; batch < batches; batch++)
+/// {
+///     // copy the next batch to input
+///     plan.launch(stream);
+/// }
+/// \endcode
+/// \endparblock
+class graph_plan
+{
+public:
+    graph_plan() = default;
+
+    graph_plan(const graph_plan&) = delete;
+    graph_plan& operator=(const graph_plan&) = delete;
+
+    ~graph_plan()
+    {
+        (void)reset();
+    }
+
+    /// \brief Records the work enqueued by a function into the plan, replacing the work recorded
+    /// before.
+    ///
+    /// \tparam Function - [inferred] type of the function object. The signature of the function
+    /// should be equivalent to the following: <tt>hipError_t f(hipStream_t stream);</tt>, it should
+    /// enqueue device-level algorithms to \p stream.
+    ///
+    /// \param [in] enqueue - the function which enqueues the work.
+    ///
+    /// \returns \p hipSuccess (\p 0) after a successful capture, otherwise the error returned by
+    /// the function or by the HIP runtime. The plan holds no work after a failed capture.
+    template<class Function>
+    hipError_t capture(Function&& enqueue)
+    {
+#if ROCPRIM_DETAIL_HAS_GRAPHS
+        hipError_t error = hipSuccess;
+        if(capture_stream_ == nullptr)
+        {
+            error = hipStreamCreateWithFlags(&capture_stream_, hipStreamNonBlocking);
+            if(error != hipSuccess)
+            {
+                capture_stream_ = nullptr;
+                return error;
+            }
+        }
+
+        error = hipStreamBeginCapture(capture_stream_, hipStreamCaptureModeThreadLocal);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        const hipError_t enqueue_error = enqueue(capture_stream_);
+        // The capture is always ended, so the stream can be used again
+        hipGraph_t graph = nullptr;
+        error            = hipStreamEndCapture(capture_stream_, &graph);
+        if(enqueue_error != hipSuccess || error != hipSuccess)
+        {
+            if(graph != nullptr)
+            {
+                (void)hipGraphDestroy(graph);
+            }
+            (void)reset_graph();
+            return enqueue_error != hipSuccess ? enqueue_error : error;
+        }
+
+        if(exec_ != nullptr)
+        {
+            // Updating the parameters of the nodes is cheaper than a new instantiation
+            hipGraphNode_t           error_node;
+            hipGraphExecUpdateResult update_result;
+            if(hipGraphExecUpdate(exec_, graph, &error_node, &update_result) != hipSuccess)
+            {
+                (void)hipGetLastError();
+                (void)hipGraphExecDestroy(exec_);
+                exec_ = nullptr;
+            }
+        }
+        if(exec_ == nullptr)
+        {
+            error = hipGraphInstantiate(&exec_, graph, nullptr, nullptr, 0);
+            if(error != hipSuccess)
+            {
+                exec_ = nullptr;
+                (void)hipGraphDestroy(graph);
+                (void)reset_graph();
+                return error;
+            }
+        }
+
+        if(graph_ != nullptr)
+        {
+            (void)hipGraphDestroy(graph_);
+        }
+        graph_ = graph;
+        return hipSuccess;
+#else
+        (void)enqueue;
+        return hipErrorNotSupported;
+#endif
+    }
+
+    /// \brief Enqueues the recorded work to a stream.
+    ///
+    /// \param [in] stream - [optional] the stream to launch the work on. Default is \p 0
+    /// (default stream).
+    ///
+    /// \returns \p hipSuccess (\p 0) after a successful launch, \p hipErrorInvalidValue if no work
+    /// is recorded, otherwise the error of the HIP runtime.
+    hipError_t launch(hipStream_t stream = 0)
+    {
+#if ROCPRIM_DETAIL_HAS_GRAPHS
+        if(exec_ == nullptr)
+        {
+            return hipErrorInvalidValue;
+        }
+        return hipGraphLaunch(exec_, stream);
+#else
+        (void)stream;
+        return hipErrorNotSupported;
+#endif
+    }
+
+    /// \brief Returns \p true if the plan holds recorded work.
+    bool is_captured() const
+    {
+#if ROCPRIM_DETAIL_HAS_GRAPHS
+        return exec_ != nullptr;
+#else
+        return false;
+#endif
+    }
+
+    /// \brief Releases the recorded work and the resources of the plan.
+    ///
+    /// \returns \p hipSuccess (\p 0) after a successful operation, otherwise the error of the HIP
+    /// runtime.
+    hipError_t reset()
+    {
+#if ROCPRIM_DETAIL_HAS_GRAPHS
+        hipError_t error = reset_graph();
+        if(capture_stream_ != nullptr)
+        {
+            const hipError_t stream_error = hipStreamDestroy(capture_stream_);
+            error           = error == hipSuccess ? stream_error : error;
+            capture_stream_ = nullptr;
+        }
+        return error;
+#else
+        return hipSuccess;
+#endif
+    }
+
+private:
+#if ROCPRIM_DETAIL_HAS_GRAPHS
+    hipError_t reset_graph()
+    {
+        hipError_t error = hipSuccess;
+        if(exec_ != nullptr)
+        {
+            error = hipGraphExecDestroy(exec_);
+            exec_ = nullptr;
+        }
+        if(graph_ != nullptr)
+        {
+            const hipError_t graph_error = hipGraphDestroy(graph_);
+            error                        = error == hipSuccess ? graph_error : error;
+            graph_                       = nullptr;
+        }
+        return error;
+    }
+
+    hipStream_t    capture_stream_ = nullptr;
+    hipGraph_t     graph_          = nullptr;
+    hipGraphExec_t exec_           = nullptr;
+#endif
+};
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_GRAPH_PLAN_HPP_
@@ -0,0 +1,153 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_GRID_LIMIT_HPP_
+#define ROCPRIM_DEVICE_GRID_LIMIT_HPP_
+
+#include <algorithm>
+#include <cstddef>
+
+#include "../config.hpp"
+#include "../detail/device_properties.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+inline unsigned int& get_grid_limit()
+{
+    thread_local unsigned int limit = 0;
+    return limit;
+}
+
+// Limits grid_size to the limit set by scoped_grid_limit on the calling thread.
+template<class Size>
+inline Size apply_grid_limit(const Size grid_size)
+{
+    const unsigned int limit = get_grid_limit();
+    return limit == 0 ? grid_size : std::min<Size>(grid_size, static_cast<Size>(limit));
+}
+
+} // end namespace detail
+
+/// \addtogroup devicemodule
+/// @{
+
+/// \brief Limits the number of blocks of the kernels launched by device-level algorithms on
+/// the calling thread while the object exists.
+///
+/// \par Overview
+/// * The limit bounds the number of blocks, and thus the number of compute units, a call can
+/// occupy at once, which leaves the remaining compute units to kernels of other streams, for
+/// example a latency-critical stream. Combined with a stream created by
+/// \p hipExtStreamCreateWithCUMask the work is also isolated to a set of compute units.
+/// * \p transform, \p reduce, the scans with look-back, \p partition, \p select, \p unique,
+/// the histograms and \p reduce_by_key launch at most \p max_blocks blocks in every kernel,
+/// including the initialization of the look-back states and the histograms, and their blocks
+/// process tiles until all of them are processed.
+/// * The radix sort without onesweep splits the keys into at most \p max_blocks batches and
+/// scans the digits of the batches with at most \p max_blocks blocks. The onesweep and merge
+/// sort kernels, and thus the histograms which sort the samples, and the algorithms not listed
+/// above are not limited.
+/// * The size of the temporary storage depends on the limit, so the same limit must be set
+/// when the size is queried and when the algorithm is called.
+/// * The limit replaces the previous limit of the calling thread, which is restored when the
+/// object is destroyed. A limit of 0 removes the limit.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// unsigned int max_blocks;
+/// // A quarter of the compute units with 2 blocks per compute unit
+/// rocprim::grid_limit_for_cu_fraction(0.25f, 2, max_blocks);
+/// {
+///     rocprim::scoped_grid_limit limit(max_blocks);
+///     rocprim::inclusive_scan(temporary_storage_ptr, temporary_storage_size_bytes,
+///                             input, output, size, rocprim::plus<int>(), stream);
+/// }
+/// \endcode
+/// \endparblock
+class scoped_grid_limit
+{
+public:
+    /// \brief Sets the limit of the calling thread to \p max_blocks blocks.
+    explicit scoped_grid_limit(const unsigned int max_blocks)
+        : previous_limit_(detail::get_grid_limit())
+    {
+        detail::get_grid_limit() = max_blocks;
+    }
+
+    /// \brief Restores the previous limit of the calling thread.
+    ~scoped_grid_limit()
+    {
+        detail::get_grid_limit() = previous_limit_;
+    }
+
+    scoped_grid_limit(const scoped_grid_limit&)            = delete;
+    scoped_grid_limit& operator=(const scoped_grid_limit&) = delete;
+
+private:
+    unsigned int previous_limit_;
+};
+
+/// \brief Returns the limit of the number of blocks set on the calling thread, 0 if the number
+/// of blocks is not limited.
+inline unsigned int current_grid_limit()
+{
+    return detail::get_grid_limit();
+}
+
+/// \brief Computes a limit of the number of blocks for \p scoped_grid_limit from a fraction of
+/// the compute units of the current device.
+///
+/// \param [in] fraction - fraction of the compute units, in the range (0, 1].
+/// \param [in] blocks_per_cu - number of blocks per compute unit.
+/// \param [out] max_blocks - the limit, at least 1.
+///
+/// \returns \p hipSuccess (\p 0) after successful computation, \p hipErrorInvalidValue if
+/// \p fraction is not in (0, 1] or \p blocks_per_cu is 0, otherwise a HIP runtime error of
+/// the query of the device properties.
+inline hipError_t grid_limit_for_cu_fraction(const float        fraction,
+                                             const unsigned int blocks_per_cu,
+                                             unsigned int&      max_blocks)
+{
+    if(!(fraction > 0.0f && fraction <= 1.0f) || blocks_per_cu == 0)
+    {
+        return hipErrorInvalidValue;
+    }
+    detail::device_properties props;
+    const hipError_t          result = detail::get_current_device_properties(props);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const unsigned int compute_units
+        = std::max(1u, static_cast<unsigned int>(props.compute_units * fraction));
+    max_blocks = compute_units * blocks_per_cu;
+    return hipSuccess;
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_GRID_LIMIT_HPP_
@@ -0,0 +1,446 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_INSTRUMENTATION_HPP_
+#define ROCPRIM_DEVICE_INSTRUMENTATION_HPP_
+
+#include <cstddef>
+
+#include "../config.hpp"
+
+// The instrumentation is compiled in only when ROCPRIM_INSTRUMENTATION is defined to 1 before
+// rocPRIM is included, otherwise the hooks in the device-level algorithms expand to nothing.
+#ifndef ROCPRIM_INSTRUMENTATION
+    #define ROCPRIM_INSTRUMENTATION 0
+#endif
+
+#if ROCPRIM_INSTRUMENTATION
+    #include <atomic>
+    #include <cstdio>
+    #include <cstring>
+    #include <mutex>
+    #include <vector>
+
+    #include "../detail/various.hpp"
+
+    // roctx ranges require linking roctx64, without the header only the timings are recorded
+    #if defined(__has_include)
+        #if __has_include(<roctracer/roctx.h>)
+            #include <roctracer/roctx.h>
+            #define ROCPRIM_DETAIL_HAS_ROCTX 1
+        #endif
+    #endif
+    #ifndef ROCPRIM_DETAIL_HAS_ROCTX
+        #define ROCPRIM_DETAIL_HAS_ROCTX 0
+    #endif
+#endif
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+/// \brief Opt-in instrumentation of the kernels launched by the device-level algorithms.
+///
+/// \par Overview
+/// * The instrumentation is compiled in when \p ROCPRIM_INSTRUMENTATION is defined to \p 1
+/// before rocPRIM is included. Otherwise all functions of this namespace are no-ops and the
+/// device-level algorithms contain no instrumentation code.
+/// * When compiled in, it is disabled until \p set_enabled(true) is called, a disabled
+/// instrumentation costs one atomic load per kernel launch.
+/// * Every kernel launch is wrapped in a roctx range named after the internal kernel and the
+/// function which launches it, the size of the launch is added as a roctx mark in the range.
+/// The ranges are available if <tt>roctracer/roctx.h</tt> is found, the application has to link
+/// \p roctx64 then.
+/// * If a timing callback is set, events are recorded on the stream before and after every
+/// kernel. The stream is never synchronized for them: the timings of completed kernels are
+/// delivered to the callback by later launches of instrumented kernels and by \p flush().
+/// Kernels launched to a stream which is captured to a graph are not timed.
+/// * The callback is called outside of the internal lock, from the thread which launches a
+/// kernel or calls \p flush().
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #define ROCPRIM_INSTRUMENTATION 1
+/// #include <rocprim/rocprim.hpp>
+///
+/// void print_timing(const rocprim::instrumentation::kernel_timing& timing, void*)
+/// {
+///     std::printf("%s: %s(%zu) %f ms\n",
+///                 timing.function_name, timing.kernel_name, timing.size, timing.milliseconds);
+/// }
+///
+/// rocprim::instrumentation::set_timing_callback(print_timing, nullptr);
+/// rocprim::instrumentation::set_enabled(true);
+/// rocprim::radix_sort_keys(temporary_storage_ptr, temporary_storage_size_bytes,
+///                          input, output, size);
+/// // Wait for the remaining kernels and deliver their timings
+/// rocprim::instrumentation::flush(true);
+/// \endcode
+/// \endparblock
+namespace instrumentation
+{
+
+/// \brief The device time of one kernel launched by a device-level algorithm.
+struct kernel_timing
+{
+    /// The name of the kernel as printed by \p debug_synchronous.
+    const char* kernel_name;
+    /// The name of the function which launched the kernel.
+    const char* function_name;
+    /// The size of the launch as printed by \p debug_synchronous, usually the number of items.
+    size_t size;
+    /// The stream the kernel was launched to.
+    hipStream_t stream;
+    /// The time between the events recorded before and after the kernel.
+    float milliseconds;
+};
+
+/// \brief The type of the timing callback, \p user_data is the pointer passed to
+/// \p set_timing_callback().
+using timing_callback = void (*)(const kernel_timing& timing, void* user_data);
+
+/// \brief Returns \p true if the instrumentation is compiled in.
+constexpr bool is_available()
+{
+    return ROCPRIM_INSTRUMENTATION != 0;
+}
+
+} // end namespace instrumentation
+
+/// @}
+// end of group devicemodule
+
+#if ROCPRIM_INSTRUMENTATION
+
+namespace detail
+{
+namespace instrumentation
+{
+
+struct pending_kernel
+{
+    ::rocprim::instrumentation::kernel_timing timing;
+    hipEvent_t                                start;
+    hipEvent_t                                stop;
+};
+
+struct open_kernel
+{
+    const char* kernel_name;
+    const char* function_name;
+    hipStream_t stream;
+    // nullptr when the kernel is not timed
+    hipEvent_t start;
+};
+
+struct state
+{
+    std::atomic<bool>                           enabled{false};
+    std::mutex                                  mutex;
+    ::rocprim::instrumentation::timing_callback callback  = nullptr;
+    void*                                       user_data = nullptr;
+    std::vector<hipEvent_t>                     free_events;
+    std::vector<pending_kernel>                 pending;
+};
+
+// The events are not destroyed at exit, the HIP runtime may be torn down before the state
+inline state& get_state()
+{
+    static state* instance = new state();
+    return *instance;
+}
+
+// The nesting of the device-level algorithms is much lower
+constexpr size_t max_open_kernels = 32;
+
+// Kernels between their begin and end hooks, the hooks of one launch run on the same thread
+inline std::vector<open_kernel>& get_open_kernels()
+{
+    thread_local std::vector<open_kernel> open_kernels;
+    return open_kernels;
+}
+
+// Must be called with the mutex locked
+inline hipEvent_t acquire_event(state& s)
+{
+    if(!s.free_events.empty())
+    {
+        const hipEvent_t event = s.free_events.back();
+        s.free_events.pop_back();
+        return event;
+    }
+    hipEvent_t event;
+    if(hipEventCreate(&event) != hipSuccess)
+    {
+        return nullptr;
+    }
+    return event;
+}
+
+// Delivers the timings of the completed kernels, waits for all pending kernels if wait is true.
+inline hipError_t deliver_timings(const bool wait)
+{
+    state&                                      s = get_state();
+    std::vector<pending_kernel>                 completed;
+    ::rocprim::instrumentation::timing_callback callback;
+    void*                                       user_data;
+    hipError_t                                  result = hipSuccess;
+    {
+        std::lock_guard<std::mutex> lock(s.mutex);
+        size_t                      remaining = 0;
+        for(pending_kernel& kernel : s.pending)
+        {
+            hipError_t status
+                = wait ? hipEventSynchronize(kernel.stop) : hipEventQuery(kernel.stop);
+            if(status == hipErrorNotReady)
+            {
+                s.pending[remaining++] = kernel;
+                continue;
+            }
+            if(status == hipSuccess)
+            {
+                status
+                    = hipEventElapsedTime(&kernel.timing.milliseconds, kernel.start, kernel.stop);
+            }
+            if(status == hipSuccess)
+            {
+                completed.push_back(kernel);
+            }
+            result = result == hipSuccess ? status : result;
+            s.free_events.push_back(kernel.start);
+            s.free_events.push_back(kernel.stop);
+        }
+        s.pending.resize(remaining);
+        callback  = s.callback;
+        user_data = s.user_data;
+    }
+    // Not ready is not an error, it must not be reported by the next hipGetLastError()
+    (void)hipGetLastError();
+
+    if(callback != nullptr)
+    {
+        for(const pending_kernel& kernel : completed)
+        {
+            callback(kernel.timing, user_data);
+        }
+    }
+    return result;
+}
+
+inline void close_kernel(state& s, const open_kernel& kernel, const bool completed, size_t size)
+{
+#if ROCPRIM_DETAIL_HAS_ROCTX
+    if(completed)
+    {
+        char message[64];
+        std::snprintf(message, sizeof(message), "size=%zu", size);
+        roctxMarkA(message);
+    }
+    roctxRangePop();
+#endif
+    if(kernel.start == nullptr)
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(s.mutex);
+    if(!completed)
+    {
+        s.free_events.push_back(kernel.start);
+        return;
+    }
+    const hipEvent_t stop = acquire_event(s);
+    if(stop == nullptr || hipEventRecord(stop, kernel.stream) != hipSuccess)
+    {
+        s.free_events.push_back(kernel.start);
+        if(stop != nullptr)
+        {
+            s.free_events.push_back(stop);
+        }
+        return;
+    }
+    pending_kernel pending;
+    pending.timing = {kernel.kernel_name, kernel.function_name, size, kernel.stream, 0.0f};
+    pending.start  = kernel.start;
+    pending.stop   = stop;
+    s.pending.push_back(pending);
+}
+
+// Called before the launch of a kernel
+inline void kernel_begin(const char* kernel_name, const char* function_name, hipStream_t stream)
+{
+    state& s = get_state();
+    if(!s.enabled.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+#if ROCPRIM_DETAIL_HAS_ROCTX
+    char message[256];
+    std::snprintf(message, sizeof(message), "rocprim:%s:%s", function_name, kernel_name);
+    roctxRangePushA(message);
+#endif
+    open_kernel kernel{kernel_name, function_name, stream, nullptr};
+    bool        capturing = false;
+    if(::rocprim::detail::is_stream_capturing(stream, capturing) == hipSuccess && !capturing)
+    {
+        std::lock_guard<std::mutex> lock(s.mutex);
+        if(s.callback != nullptr)
+        {
+            kernel.start = acquire_event(s);
+            if(kernel.start != nullptr && hipEventRecord(kernel.start, stream) != hipSuccess)
+            {
+                s.free_events.push_back(kernel.start);
+                kernel.start = nullptr;
+            }
+        }
+    }
+    std::vector<open_kernel>& open_kernels = get_open_kernels();
+    // Launches which failed before their end hook are usually closed by the next end hook of
+    // the same kernel, a stale kernel at the bottom is closed when the stack grows too deep.
+    if(open_kernels.size() >= max_open_kernels)
+    {
+        close_kernel(s, open_kernels.front(), false, 0);
+        open_kernels.erase(open_kernels.begin());
+    }
+    open_kernels.push_back(kernel);
+}
+
+// Called after the launch of a kernel succeeded. The begin hooks of launches which returned
+// an error before their end hook are closed here too, they are not timed.
+inline void kernel_end(const char* kernel_name, const size_t size)
+{
+    std::vector<open_kernel>& open_kernels = get_open_kernels();
+    size_t                    index        = open_kernels.size();
+    while(index > 0 && std::strcmp(open_kernels[index - 1].kernel_name, kernel_name) != 0)
+    {
+        index--;
+    }
+    if(index == 0)
+    {
+        return;
+    }
+    state& s = get_state();
+    while(open_kernels.size() > index)
+    {
+        close_kernel(s, open_kernels.back(), false, 0);
+        open_kernels.pop_back();
+    }
+    const open_kernel kernel = open_kernels.back();
+    open_kernels.pop_back();
+    close_kernel(s, kernel, true, size);
+    if(kernel.start != nullptr)
+    {
+        (void)deliver_timings(false);
+    }
+}
+
+} // end namespace instrumentation
+} // end namespace detail
+
+    #define ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN(name) \
+        ::rocprim::detail::instrumentation::kernel_begin(name, __func__, stream)
+    #define ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size) \
+        ::rocprim::detail::instrumentation::kernel_end(name, static_cast<size_t>(size))
+
+#else
+
+    #define ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN(name) ((void)0)
+    #define ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size) ((void)0)
+
+#endif // ROCPRIM_INSTRUMENTATION
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace instrumentation
+{
+
+/// \brief Enables or disables the instrumentation at runtime. It has no effect if the
+/// instrumentation is not compiled in.
+///
+/// Kernels launched while it is enabled are still timed if it is disabled before they complete.
+///
+/// \param [in] enabled - \p true to instrument the kernels launched from now on.
+inline void set_enabled(const bool enabled)
+{
+#if ROCPRIM_INSTRUMENTATION
+    ::rocprim::detail::instrumentation::get_state().enabled.store(enabled,
+                                                                  std::memory_order_relaxed);
+#else
+    (void)enabled;
+#endif
+}
+
+/// \brief Returns \p true if the instrumentation is compiled in and enabled.
+inline bool is_enabled()
+{
+#if ROCPRIM_INSTRUMENTATION
+    return ::rocprim::detail::instrumentation::get_state().enabled.load(
+        std::memory_order_relaxed);
+#else
+    return false;
+#endif
+}
+
+/// \brief Sets the callback which receives the device times of the instrumented kernels.
+///
+/// \param [in] callback - the callback, \p nullptr stops recording events for the kernels
+/// launched from now on.
+/// \param [in] user_data - [optional] a pointer passed to every call of the callback.
+inline void set_timing_callback(const timing_callback callback, void* const user_data = nullptr)
+{
+#if ROCPRIM_INSTRUMENTATION
+    auto&                       state = ::rocprim::detail::instrumentation::get_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.callback  = callback;
+    state.user_data = user_data;
+#else
+    (void)callback;
+    (void)user_data;
+#endif
+}
+
+/// \brief Delivers the timings of the instrumented kernels which have completed to the timing
+/// callback.
+///
+/// \param [in] wait - [optional] if \p true, waits for all instrumented kernels to complete.
+/// Otherwise the kernels which have not completed yet are delivered later. Default is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after a successful operation, otherwise the error of the HIP
+/// runtime. The timings of failed kernels are dropped.
+inline hipError_t flush(const bool wait = false)
+{
+#if ROCPRIM_INSTRUMENTATION
+    return ::rocprim::detail::instrumentation::deliver_timings(wait);
+#else
+    (void)wait;
+    return hipSuccess;
+#endif
+}
+
+} // end namespace instrumentation
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_INSTRUMENTATION_HPP_
@@ -0,0 +1,328 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef ROCPRIM_DEVICE_LOOKBACK_STATE_CACHE_HPP_
+#define ROCPRIM_DEVICE_LOOKBACK_STATE_CACHE_HPP_
+
+#include <cstddef>
+
+#include "../config.hpp"
+#include "../detail/various.hpp"
+
+#include "detail/lookback_scan_state.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+class lookback_state_cache;
+
+namespace detail
+{
+
+inline lookback_state_cache*& get_lookback_state_cache()
+{
+    thread_local lookback_state_cache* cache = nullptr;
+    return cache;
+}
+
+// A unique address for every type of look-back state
+template<class State>
+inline const void* lookback_state_key()
+{
+    static const char key = 0;
+    return &key;
+}
+
+inline hipError_t acquire_lookback_state(const void*        key,
+                                         const size_t       bytes,
+                                         const unsigned int number_of_blocks,
+                                         const unsigned int launches,
+                                         const hipStream_t  stream,
+                                         void*&             storage,
+                                         unsigned int&      first_epoch,
+                                         bool&              clear);
+
+inline void discard_lookback_state();
+
+} // end namespace detail
+
+/// \addtogroup devicemodule
+/// @{
+
+/// \brief A persistent device buffer for the look-back states of device-level algorithms, which
+/// is reused by consecutive calls without initializing it again.
+///
+/// \par Overview
+/// * The algorithms with a decoupled look-back initialize the flags of the prefixes of their
+/// tiles with a separate kernel before every launch. While a cache is installed by
+/// \p scoped_lookback_state_cache, the flags are tagged with the epoch of the launch instead, so
+/// the flags of the previous launches are empty for the next launch and the initialization
+/// kernel is only launched when the state is cleared: on the first call, when the type of the
+/// state or the number of tiles changes and every 62 launches, when the epochs wrap.
+/// * \p inclusive_scan and \p exclusive_scan with look-back use the cache.
+/// * The buffer is allocated on the first use and grown when a call needs a larger state. It
+/// is freed by \p release and by the destructor.
+/// * The calls sharing a cache must be ordered: they must be enqueued to the same stream (or to
+/// streams synchronized with each other) of the same device. The cache is not thread-safe.
+/// * The cache is not used while the stream is captured to a graph, because the epochs chosen
+/// on the host would be replayed by every launch of the graph.
+/// * If an algorithm fails after it has taken the state, the state is cleared by the next call.
+/// * When the buffer is grown, the stream of the call is synchronized before the old buffer is
+/// freed, because the previous calls may still use it.
+/// * The size of the temporary storage does not depend on the cache.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// rocprim::lookback_state_cache cache;
+/// {
+///     rocprim::scoped_lookback_state_cache use_cache(cache);
+///     for(int i = 0; i < iterations; i++)
+///     {
+///         rocprim::inclusive_scan(temporary_storage_ptr, temporary_storage_size_bytes,
+///                                 input, output, size, rocprim::plus<int>(), stream);
+///     }
+/// }
+/// \endcode
+/// \endparblock
+class lookback_state_cache
+{
+public:
+    /// \brief Creates an empty cache, the buffer is allocated on the first use.
+    lookback_state_cache() = default;
+
+    /// \brief Frees the buffer, the calls using it must have completed.
+    ~lookback_state_cache()
+    {
+        release();
+    }
+
+    lookback_state_cache(const lookback_state_cache&)            = delete;
+    lookback_state_cache& operator=(const lookback_state_cache&) = delete;
+
+    /// \brief Frees the buffer, the calls using it must have completed. The next call using the
+    /// cache allocates and initializes a new buffer.
+    ///
+    /// \returns \p hipSuccess (\p 0) after successful release; otherwise a HIP runtime error of
+    /// type \p hipError_t.
+    hipError_t release()
+    {
+        hipError_t result = hipSuccess;
+        if(storage_ != nullptr)
+        {
+            result = hipFree(storage_);
+        }
+        storage_  = nullptr;
+        capacity_ = 0;
+        key_      = nullptr;
+        return result;
+    }
+
+private:
+    friend hipError_t detail::acquire_lookback_state(const void*,
+                                                     size_t,
+                                                     unsigned int,
+                                                     unsigned int,
+                                                     hipStream_t,
+                                                     void*&,
+                                                     unsigned int&,
+                                                     bool&);
+    friend void detail::discard_lookback_state();
+
+    void*        storage_  = nullptr;
+    size_t       capacity_ = 0;
+    int          device_   = -1;
+    const void*  key_      = nullptr;
+    size_t       bytes_    = 0;
+    unsigned int blocks_   = 0;
+    // The epoch of the last launch since the state was cleared
+    unsigned int epoch_ = 0;
+};
+
+/// \brief Installs a \p lookback_state_cache for the device-level algorithms called on the
+/// calling thread while the object exists.
+///
+/// The cache replaces the previous cache of the calling thread, which is restored when the
+/// object is destroyed.
+class scoped_lookback_state_cache
+{
+public:
+    /// \brief Installs \p cache on the calling thread.
+    explicit scoped_lookback_state_cache(lookback_state_cache& cache)
+        : previous_cache_(detail::get_lookback_state_cache())
+    {
+        detail::get_lookback_state_cache() = &cache;
+    }
+
+    /// \brief Restores the previous cache of the calling thread.
+    ~scoped_lookback_state_cache()
+    {
+        detail::get_lookback_state_cache() = previous_cache_;
+    }
+
+    scoped_lookback_state_cache(const scoped_lookback_state_cache&)            = delete;
+    scoped_lookback_state_cache& operator=(const scoped_lookback_state_cache&) = delete;
+
+private:
+    lookback_state_cache* previous_cache_;
+};
+
+/// @}
+// end of group devicemodule
+
+namespace detail
+{
+
+// Takes the look-back state of bytes bytes for launches launches from the cache of the calling
+// thread. storage is nullptr if there is no cache or it can not be used, then the state is
+// initialized before every launch as usual. Otherwise the launch i (from 0) uses the epoch
+// first_epoch + i, and if clear is true the state must be initialized before the first launch.
+// The state of the same key and number of blocks has the same layout, so every launch overwrites
+// all the prefixes that the next launch reads.
+inline hipError_t acquire_lookback_state(const void*        key,
+                                         const size_t       bytes,
+                                         const unsigned int number_of_blocks,
+                                         const unsigned int launches,
+                                         const hipStream_t  stream,
+                                         void*&             storage,
+                                         unsigned int&      first_epoch,
+                                         bool&              clear)
+{
+    storage     = nullptr;
+    first_epoch = 0;
+    clear       = false;
+
+    lookback_state_cache* cache = get_lookback_state_cache();
+    if(cache == nullptr || launches == 0 || launches > lookback_max_epoch)
+    {
+        return hipSuccess;
+    }
+    bool capturing;
+    hipError_t result = is_stream_capturing(stream, capturing);
+    if(result != hipSuccess || capturing)
+    {
+        return result;
+    }
+    int device;
+    result = hipGetDevice(&device);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    if(cache->storage_ == nullptr || cache->capacity_ < bytes || cache->device_ != device)
+    {
+        // The launches enqueued by the previous calls may still use the old buffer
+        if(cache->storage_ != nullptr && cache->device_ == device)
+        {
+            result = hipStreamSynchronize(stream);
+        }
+        else if(cache->storage_ != nullptr)
+        {
+            result = hipSetDevice(cache->device_);
+            if(result == hipSuccess)
+            {
+                result = hipDeviceSynchronize();
+            }
+            const hipError_t restore_result = hipSetDevice(device);
+            if(result == hipSuccess)
+            {
+                result = restore_result;
+            }
+        }
+        if(result != hipSuccess)
+        {
+            return result;
+        }
+        // release() also resets the key, so the state in the new buffer is cleared below
+        result = cache->release();
+        if(result != hipSuccess)
+        {
+            return result;
+        }
+        result = hipMalloc(&cache->storage_, bytes);
+        if(result != hipSuccess)
+        {
+            cache->storage_ = nullptr;
+            return result;
+        }
+        cache->capacity_ = bytes;
+        cache->device_   = device;
+    }
+
+    clear = cache->key_ != key || cache->bytes_ != bytes || cache->blocks_ != number_of_blocks
+            || cache->epoch_ + launches > lookback_max_epoch;
+    if(clear)
+    {
+        cache->key_    = key;
+        cache->bytes_  = bytes;
+        cache->blocks_ = number_of_blocks;
+        cache->epoch_  = 0;
+    }
+    first_epoch = cache->epoch_ + 1;
+    cache->epoch_ += launches;
+    storage = cache->storage_;
+    return hipSuccess;
+}
+
+// Makes the next call using the cache of the calling thread clear the state. The epochs are
+// advanced by acquire_lookback_state before the launches, so the state is not consistent with
+// them if a launch has failed.
+inline void discard_lookback_state()
+{
+    lookback_state_cache* cache = get_lookback_state_cache();
+    if(cache != nullptr)
+    {
+        cache->key_ = nullptr;
+    }
+}
+
+// Calls discard_lookback_state when it is destroyed, unless the algorithm has succeeded and
+// dismiss was called
+class lookback_state_failure_guard
+{
+public:
+    explicit lookback_state_failure_guard(const bool active) : active_(active) {}
+
+    ~lookback_state_failure_guard()
+    {
+        if(active_)
+        {
+            discard_lookback_state();
+        }
+    }
+
+    lookback_state_failure_guard(const lookback_state_failure_guard&)            = delete;
+    lookback_state_failure_guard& operator=(const lookback_state_failure_guard&) = delete;
+
+    void dismiss()
+    {
+        active_ = false;
+    }
+
+private:
+    bool active_;
+};
+
+} // end namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_LOOKBACK_STATE_CACHE_HPP_
@@ -23,6 +23,7 @@
 
 #include "../detail/device_merge_sort.hpp"
 #include "../detail/device_radix_sort.hpp"
+#include "../instrumentation.hpp"
 #include "../specialization/device_radix_single_sort.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
@@ -57,6 +58,8 @@ ROCPRIM_KERNEL
     template<
         class Config,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -99,10 +102,11 @@ ROCPRIM_KERNEL
         }
 
         if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("radix_sort_single");
 
         hipLaunchKernelGGL(
             HIP_KERNEL_NAME(sort_single_kernel<
-                block_size, items_per_thread , Descending
+                block_size, items_per_thread , Descending, FloatOrder, Decomposer
             >),
             dim3(number_of_blocks), dim3(block_size), 0, stream,
             keys_input, keys_buffer, values_input, values_buffer,
@@ -123,6 +127,7 @@ ROCPRIM_KERNEL
             {
                 if(debug_synchronous)
                     start = std::chrono::high_resolution_clock::now();
+                ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("radix_block_merge_kernel");
                 if(current_radix_bits == sizeof(key_type) * 8)
                 {
                     hipLaunchKernelGGL(
@@ -137,7 +142,7 @@ ROCPRIM_KERNEL
                         values_output_,
                         size,
                         sorted_block_size,
-                        radix_merge_compare<Descending, false, key_type>());
+                        radix_merge_compare<Descending, false, key_type, FloatOrder, Decomposer>());
                 }
                 else
                 {
@@ -153,7 +158,7 @@ ROCPRIM_KERNEL
                         values_output_,
                         size,
                         sorted_block_size,
-                        radix_merge_compare<Descending, true, key_type>(bit, current_radix_bits));
+                        radix_merge_compare<Descending, true, key_type, FloatOrder, Decomposer>(bit, current_radix_bits));
                 }
                 ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("radix_block_merge_kernel", size, start);
                 return hipSuccess;
@@ -22,6 +22,7 @@
 #define ROCPRIM_DEVICE_SPECIALIZATION_DEVICE_RADIX_SINGLE_SORT_HPP_
 
 #include "../detail/device_radix_sort.hpp"
+#include "../instrumentation.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -32,6 +33,7 @@ namespace detail
     { \
         auto _error = hipGetLastError(); \
         if(_error != hipSuccess) return _error; \
+        ROCPRIM_DETAIL_INSTRUMENTATION_END(name, size); \
         if(debug_synchronous) \
         { \
             std::cout << name << "(" << size << ")"; \
@@ -47,6 +49,8 @@ namespace detail
         unsigned int BlockSize,
         unsigned int ItemsPerThread,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -62,7 +66,7 @@ namespace detail
                            unsigned int         bit,
                            unsigned int         current_radix_bits)
    {
-       sort_single<BlockSize, ItemsPerThread, Descending>(
+       sort_single<BlockSize, ItemsPerThread, Descending, FloatOrder, Decomposer>(
            keys_input, keys_output,
            values_input, values_output,
            size, bit, current_radix_bits
@@ -73,6 +77,8 @@ namespace detail
         unsigned int BlockSize,
         unsigned int ItemsPerThread,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -101,10 +107,11 @@ namespace detail
         }
 
         if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        ROCPRIM_DETAIL_INSTRUMENTATION_BEGIN("radix_sort_single");
 
         hipLaunchKernelGGL(
             HIP_KERNEL_NAME(sort_single_kernel<
-                BlockSize, ItemsPerThread, Descending
+                BlockSize, ItemsPerThread, Descending, FloatOrder, Decomposer
             >),
             dim3(1), dim3(BlockSize), 0, stream,
             keys_input, keys_output, values_input, values_output,
@@ -119,6 +126,8 @@ namespace detail
     template<
         class Config,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -135,7 +144,7 @@ namespace detail
                                          hipStream_t stream,
                                          bool debug_synchronous)
     {
-        return radix_sort_single<64U, 1U, Descending>(
+        return radix_sort_single<64U, 1U, Descending, FloatOrder, Decomposer>(
             keys_input, keys_output, values_input, values_output,
             size, bit, end_bit, stream, debug_synchronous
         );
@@ -144,6 +153,8 @@ namespace detail
     template<
         class Config,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -161,12 +172,12 @@ namespace detail
                                           bool debug_synchronous)
     {
         if( !Config::force_single_kernel_config && size <= 64U )
-            return radix_sort_single_limit64<Config, Descending>(
+            return radix_sort_single_limit64<Config, Descending, FloatOrder, Decomposer>(
                 keys_input, keys_output, values_input, values_output,
                 size, bit, end_bit, stream, debug_synchronous
             );
         else
-            return radix_sort_single<64U, 2U, Descending>(
+            return radix_sort_single<64U, 2U, Descending, FloatOrder, Decomposer>(
                 keys_input, keys_output, values_input, values_output,
                 size, bit, end_bit, stream, debug_synchronous
             );
@@ -175,6 +186,8 @@ namespace detail
     template<
         class Config,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -192,12 +205,12 @@ namespace detail
                                           bool debug_synchronous)
     {
         if( !Config::force_single_kernel_config && size <= 128U )
-            return radix_sort_single_limit128<Config, Descending>(
+            return radix_sort_single_limit128<Config, Descending, FloatOrder, Decomposer>(
                 keys_input, keys_output, values_input, values_output,
                 size, bit, end_bit, stream, debug_synchronous
             );
         else
-            return radix_sort_single<64U, 3U, Descending>(
+            return radix_sort_single<64U, 3U, Descending, FloatOrder, Decomposer>(
                 keys_input, keys_output, values_input, values_output,
                 size, bit, end_bit, stream, debug_synchronous
             );
@@ -206,6 +219,8 @@ namespace detail
     template<
         class Config,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -223,12 +238,12 @@ namespace detail
                                           bool debug_synchronous)
     {
         if( !Config::force_single_kernel_config && size <= 192U )
-            return radix_sort_single_limit192<Config, Descending>(
+            return radix_sort_single_limit192<Config, Descending, FloatOrder, Decomposer>(
                 keys_input, keys_output, values_input, values_output,
                 size, bit, end_bit, stream, debug_synchronous
             );
         else
-            return radix_sort_single<64U, 4U, Descending>(
+            return radix_sort_single<64U, 4U, Descending, FloatOrder, Decomposer>(
                 keys_input, keys_output, values_input, values_output,
                 size, bit, end_bit, stream, debug_synchronous
             );
@@ -237,6 +252,8 @@ namespace detail
     template<
         class Config,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -254,12 +271,12 @@ namespace detail
                                           bool debug_synchronous)
     {
         if( !Config::force_single_kernel_config && size <= 256U )
-            return radix_sort_single_limit256<Config, Descending>(
+            return radix_sort_single_limit256<Config, Descending, FloatOrder, Decomposer>(
                 keys_input, keys_output, values_input, values_output,
                 size, bit, end_bit, stream, debug_synchronous
             );
         else
-            return radix_sort_single<64U, 5U, Descending>(
+            return radix_sort_single<64U, 5U, Descending, FloatOrder, Decomposer>(
                 keys_input, keys_output, values_input, values_output,
                 size, bit, end_bit, stream, debug_synchronous
             );
@@ -268,6 +285,8 @@ namespace detail
     template<
         class Config,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -285,12 +304,12 @@ namespace detail
                                           bool debug_synchronous)
     {
         if( !Config::force_single_kernel_config && size <= 320U )
-            return radix_sort_single_limit320<Config, Descending>(
+            return radix_sort_single_limit320<Config, Descending, FloatOrder, Decomposer>(
                 keys_input, keys_output, values_input, values_output,
                 size, bit, end_bit, stream, debug_synchronous
             );
         else
-            return radix_sort_single<256U, 2U, Descending>(
+            return radix_sort_single<256U, 2U, Descending, FloatOrder, Decomposer>(
                 keys_input, keys_output, values_input, values_output,
                 size, bit, end_bit, stream, debug_synchronous
             );
@@ -299,6 +318,8 @@ namespace detail
     template<
         class Config,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -316,12 +337,12 @@ namespace detail
                                           bool debug_synchronous)
     {
         if( !Config::force_single_kernel_config && size <= 512U )
-            return radix_sort_single_limit512<Config, Descending>(
+            return radix_sort_single_limit512<Config, Descending, FloatOrder, Decomposer>(
                 keys_input, keys_output, values_input, values_output,
                 size, bit, end_bit, stream, debug_synchronous
             );
         else
-            return radix_sort_single<256U, 3U, Descending>(
+            return radix_sort_single<256U, 3U, Descending, FloatOrder, Decomposer>(
                 keys_input, keys_output, values_input, values_output,
                 size, bit, end_bit, stream, debug_synchronous
             );
@@ -330,6 +351,8 @@ namespace detail
     template<
         class Config,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -347,12 +370,12 @@ namespace detail
                                            bool debug_synchronous)
     {
         if( !Config::force_single_kernel_config && size <= 768U )
-            return radix_sort_single_limit768<Config, Descending>(
+            return radix_sort_single_limit768<Config, Descending, FloatOrder, Decomposer>(
                 keys_input, keys_output, values_input, values_output,
                 size, bit, end_bit, stream, debug_synchronous
             );
         else
-            return radix_sort_single<256U, 4U, Descending>(
+            return radix_sort_single<256U, 4U, Descending, FloatOrder, Decomposer>(
                 keys_input, keys_output, values_input, values_output,
                 size, bit, end_bit, stream, debug_synchronous
             );
@@ -363,6 +386,8 @@ namespace detail
     template<
         class Config,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -380,12 +405,12 @@ namespace detail
                                            bool debug_synchronous)
     {
         if( !Config::force_single_kernel_config && size <= 1024U )
-            return radix_sort_single_limit1024<Config, Descending>(
+            return radix_sort_single_limit1024<Config, Descending, FloatOrder, Decomposer>(
                 keys_input, keys_output, values_input, values_output,
                 size, bit, end_bit, stream, debug_synchronous
             );
         else
-            return radix_sort_single<256U, 6U, Descending>(
+            return radix_sort_single<256U, 6U, Descending, FloatOrder, Decomposer>(
                 keys_input, keys_output, values_input, values_output,
                 size, bit, end_bit, stream, debug_synchronous
             );
@@ -394,6 +419,8 @@ namespace detail
     template<
         class Config,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -411,12 +438,12 @@ namespace detail
                                            bool debug_synchronous)
     {
         if( !Config::force_single_kernel_config && size <= 1536U )
-            return radix_sort_single_limit1536<Config, Descending>(
+            return radix_sort_single_limit1536<Config, Descending, FloatOrder, Decomposer>(
                 keys_input, keys_output, values_input, values_output,
                 size, bit, end_bit, stream, debug_synchronous
             );
         else
-            return radix_sort_single<256U, 8U, Descending>(
+            return radix_sort_single<256U, 8U, Descending, FloatOrder, Decomposer>(
                 keys_input, keys_output, values_input, values_output,
                 size, bit, end_bit, stream, debug_synchronous
             );
@@ -425,6 +452,8 @@ namespace detail
     template<
         class Config,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -442,12 +471,12 @@ namespace detail
                                            bool debug_synchronous)
     {
         if( !Config::force_single_kernel_config && size <= 2048U )
-            return radix_sort_single_limit2048<Config, Descending>(
+            return radix_sort_single_limit2048<Config, Descending, FloatOrder, Decomposer>(
                 keys_input, keys_output, values_input, values_output,
                 size, bit, end_bit, stream, debug_synchronous
             );
         else
-            return radix_sort_single<256U, 10U, Descending>(
+            return radix_sort_single<256U, 10U, Descending, FloatOrder, Decomposer>(
                 keys_input, keys_output, values_input, values_output,
                 size, bit, end_bit, stream, debug_synchronous
             );
@@ -456,6 +485,8 @@ namespace detail
     template<
         class Config,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -473,12 +504,12 @@ namespace detail
                                            bool debug_synchronous)
     {
         if( !Config::force_single_kernel_config && size <= 2560U )
-            return radix_sort_single_limit2560<Config, Descending>(
+            return radix_sort_single_limit2560<Config, Descending, FloatOrder, Decomposer>(
                 keys_input, keys_output, values_input, values_output,
                 size, bit, end_bit, stream, debug_synchronous
             );
         else
-            return radix_sort_single<256U, 12U, Descending>(
+            return radix_sort_single<256U, 12U, Descending, FloatOrder, Decomposer>(
                 keys_input, keys_output, values_input, values_output,
                 size, bit, end_bit, stream, debug_synchronous
             );
@@ -487,6 +518,8 @@ namespace detail
     template<
         class Config,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -504,12 +537,12 @@ namespace detail
                                            bool debug_synchronous)
     {
         if( !Config::force_single_kernel_config && size <= 3072U )
-            return radix_sort_single_limit3072<Config, Descending>(
+            return radix_sort_single_limit3072<Config, Descending, FloatOrder, Decomposer>(
                 keys_input, keys_output, values_input, values_output,
                 size, bit, end_bit, stream, debug_synchronous
             );
         else
-            return radix_sort_single<256U, 14U, Descending>(
+            return radix_sort_single<256U, 14U, Descending, FloatOrder, Decomposer>(
                 keys_input, keys_output, values_input, values_output,
                 size, bit, end_bit, stream, debug_synchronous
             );
@@ -518,6 +551,8 @@ namespace detail
     template<
         class Config,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -535,12 +570,12 @@ namespace detail
                                            bool debug_synchronous)
     {
         if( !Config::force_single_kernel_config && size <= 3584U )
-            return radix_sort_single_limit3584<Config, Descending>(
+            return radix_sort_single_limit3584<Config, Descending, FloatOrder, Decomposer>(
                 keys_input, keys_output, values_input, values_output,
                 size, bit, end_bit, stream, debug_synchronous
             );
         else
-            return radix_sort_single<256U, 16U, Descending>(
+            return radix_sort_single<256U, 16U, Descending, FloatOrder, Decomposer>(
                 keys_input, keys_output, values_input, values_output,
                 size, bit, end_bit, stream, debug_synchronous
             );
@@ -549,6 +584,8 @@ namespace detail
     template<
         class Config,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -569,7 +606,7 @@ namespace detail
             hipError_t
         >::type
     {
-        return radix_sort_single_limit64<Config, Descending>(
+        return radix_sort_single_limit64<Config, Descending, FloatOrder, Decomposer>(
             keys_input, keys_output, values_input, values_output,
             size, bit, end_bit, stream, debug_synchronous
         );
@@ -578,6 +615,8 @@ namespace detail
     template<
         class Config,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -599,7 +638,7 @@ namespace detail
             hipError_t
         >::type
     {
-        return radix_sort_single_limit128<Config, Descending>(
+        return radix_sort_single_limit128<Config, Descending, FloatOrder, Decomposer>(
             keys_input, keys_output, values_input, values_output,
             size, bit, end_bit, stream, debug_synchronous
         );
@@ -608,6 +647,8 @@ namespace detail
     template<
         class Config,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -629,7 +670,7 @@ namespace detail
             hipError_t
         >::type
     {
-        return radix_sort_single_limit192<Config, Descending>(
+        return radix_sort_single_limit192<Config, Descending, FloatOrder, Decomposer>(
             keys_input, keys_output, values_input, values_output,
             size, bit, end_bit, stream, debug_synchronous
         );
@@ -638,6 +679,8 @@ namespace detail
     template<
         class Config,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -659,7 +702,7 @@ namespace detail
             hipError_t
         >::type
     {
-        return radix_sort_single_limit256<Config, Descending>(
+        return radix_sort_single_limit256<Config, Descending, FloatOrder, Decomposer>(
             keys_input, keys_output, values_input, values_output,
             size, bit, end_bit, stream, debug_synchronous
         );
@@ -668,6 +711,8 @@ namespace detail
     template<
         class Config,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -689,7 +734,7 @@ namespace detail
             hipError_t
         >::type
     {
-        return radix_sort_single_limit320<Config, Descending>(
+        return radix_sort_single_limit320<Config, Descending, FloatOrder, Decomposer>(
             keys_input, keys_output, values_input, values_output,
             size, bit, end_bit, stream, debug_synchronous
         );
@@ -698,6 +743,8 @@ namespace detail
     template<
         class Config,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -719,7 +766,7 @@ namespace detail
             hipError_t
         >::type
     {
-        return radix_sort_single_limit512<Config, Descending>(
+        return radix_sort_single_limit512<Config, Descending, FloatOrder, Decomposer>(
             keys_input, keys_output, values_input, values_output,
             size, bit, end_bit, stream, debug_synchronous
         );
@@ -728,6 +775,8 @@ namespace detail
     template<
         class Config,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -749,7 +798,7 @@ namespace detail
             hipError_t
         >::type
     {
-        return radix_sort_single_limit768<Config, Descending>(
+        return radix_sort_single_limit768<Config, Descending, FloatOrder, Decomposer>(
             keys_input, keys_output, values_input, values_output,
             size, bit, end_bit, stream, debug_synchronous
         );
@@ -758,6 +807,8 @@ namespace detail
     template<
         class Config,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -779,7 +830,7 @@ namespace detail
             hipError_t
         >::type
     {
-        return radix_sort_single_limit1024<Config, Descending>(
+        return radix_sort_single_limit1024<Config, Descending, FloatOrder, Decomposer>(
             keys_input, keys_output, values_input, values_output,
             size, bit, end_bit, stream, debug_synchronous
         );
@@ -788,6 +839,8 @@ namespace detail
     template<
         class Config,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -809,7 +862,7 @@ namespace detail
             hipError_t
         >::type
     {
-        return radix_sort_single_limit1536<Config, Descending>(
+        return radix_sort_single_limit1536<Config, Descending, FloatOrder, Decomposer>(
             keys_input, keys_output, values_input, values_output,
             size, bit, end_bit, stream, debug_synchronous
         );
@@ -818,6 +871,8 @@ namespace detail
     template<
         class Config,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -839,7 +894,7 @@ namespace detail
             hipError_t
         >::type
     {
-        return radix_sort_single_limit2048<Config, Descending>(
+        return radix_sort_single_limit2048<Config, Descending, FloatOrder, Decomposer>(
             keys_input, keys_output, values_input, values_output,
             size, bit, end_bit, stream, debug_synchronous
         );
@@ -848,6 +903,8 @@ namespace detail
     template<
         class Config,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -869,7 +926,7 @@ namespace detail
             hipError_t
         >::type
     {
-        return radix_sort_single_limit2560<Config, Descending>(
+        return radix_sort_single_limit2560<Config, Descending, FloatOrder, Decomposer>(
             keys_input, keys_output, values_input, values_output,
             size, bit, end_bit, stream, debug_synchronous
         );
@@ -878,6 +935,8 @@ namespace detail
     template<
         class Config,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -899,7 +958,7 @@ namespace detail
             hipError_t
         >::type
     {
-        return radix_sort_single_limit3072<Config, Descending>(
+        return radix_sort_single_limit3072<Config, Descending, FloatOrder, Decomposer>(
             keys_input, keys_output, values_input, values_output,
             size, bit, end_bit, stream, debug_synchronous
         );
@@ -908,6 +967,8 @@ namespace detail
     template<
         class Config,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -929,7 +990,7 @@ namespace detail
             hipError_t
         >::type
     {
-        return radix_sort_single_limit3584<Config, Descending>(
+        return radix_sort_single_limit3584<Config, Descending, FloatOrder, Decomposer>(
             keys_input, keys_output, values_input, values_output,
             size, bit, end_bit, stream, debug_synchronous
         );
@@ -938,6 +999,8 @@ namespace detail
     template<
         class Config,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -959,7 +1022,7 @@ namespace detail
             hipError_t
         >::type
     {
-        return radix_sort_single_limit4096<Config, Descending>(
+        return radix_sort_single_limit4096<Config, Descending, FloatOrder, Decomposer>(
             keys_input, keys_output, values_input, values_output,
             size, bit, end_bit, stream, debug_synchronous
         );
@@ -968,6 +1031,8 @@ namespace detail
     template<
         class Config,
         bool Descending,
+        radix_float_order FloatOrder,
+        class Decomposer,
         class KeysInputIterator,
         class KeysOutputIterator,
         class ValuesInputIterator,
@@ -989,7 +1054,7 @@ namespace detail
         >::type
     {
         if( size < 4096 )
-            return radix_sort_single_limit4096<Config, Descending>(
+            return radix_sort_single_limit4096<Config, Descending, FloatOrder, Decomposer>(
                 keys_input, keys_output, values_input, values_output,
                 size, bit, end_bit, stream, debug_synchronous
             );
@@ -997,7 +1062,7 @@ namespace detail
             return radix_sort_single<
                 Config::sort_single::block_size,
                 Config::sort_single::items_per_thread,
-                Descending
+                Descending, FloatOrder, Decomposer
             >(
                     keys_input, keys_output, values_input, values_output,
                     size, bit, end_bit, stream, debug_synchronous
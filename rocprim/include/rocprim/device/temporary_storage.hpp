@@ -0,0 +1,182 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_TEMPORARY_STORAGE_HPP_
+#define ROCPRIM_DEVICE_TEMPORARY_STORAGE_HPP_
+
+#include <cstddef>
+
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+/// \brief Composable partitions of one allocation of temporary memory.
+///
+/// \par Overview
+/// * The layout of a single allocation is described by a tree of partitions. The leaves are
+/// the buffers of the user, like the temporary storage of a device-level algorithm or an
+/// intermediate array, and they are combined by \p make_sequence_partition(), which places
+/// its sub-partitions one after another, and \p make_union_partition(), which overlays them.
+/// * The size of a union is the maximum of the sizes of its sub-partitions instead of their
+/// sum, so the temporary storages of chained algorithms, which are not used at the same time,
+/// can share memory.
+/// * \p partition() follows the convention of the device-level algorithms: with \p nullptr
+/// temporary storage it returns the required size, otherwise it assigns the pointers of the
+/// leaves.
+/// * Leaves which require 0 bytes are assigned \p nullptr and do not add any padding.
+///
+/// \par Example
+/// \parblock
+/// Sorting keys and reducing them with one allocation, the sorted keys are kept for the whole
+/// chain while the temporary storages of both algorithms overlap.
+///
+/// \code{.cpp}
+/// size_t sort_bytes;
+/// rocprim::radix_sort_keys(nullptr, sort_bytes, input, sorted, size);
+/// size_t reduce_bytes;
+/// rocprim::reduce(nullptr, reduce_bytes, sorted, output, size, rocprim::plus<int>());
+///
+/// namespace rpts = rocprim::temporary_storage;
+/// int*  sorted;
+/// void* sort_storage;
+/// void* reduce_storage;
+/// auto layout = rpts::make_sequence_partition(
+///     rpts::ptr_aligned_array(&sorted, size),
+///     rpts::make_union_partition(rpts::make_partition(&sort_storage, sort_bytes),
+///                                rpts::make_partition(&reduce_storage, reduce_bytes)));
+///
+/// size_t storage_size;
+/// rpts::partition(nullptr, storage_size, layout);
+/// void* storage;
+/// hipMalloc(&storage, storage_size);
+/// // Assign the pointers
+/// rpts::partition(storage, storage_size, layout);
+///
+/// rocprim::radix_sort_keys(sort_storage, sort_bytes, input, sorted, size);
+/// rocprim::reduce(reduce_storage, reduce_bytes, sorted, output, size, rocprim::plus<int>());
+/// \endcode
+/// \endparblock
+namespace temporary_storage
+{
+
+/// \brief The default alignment of partitions, in bytes.
+using ::rocprim::detail::temp_storage::default_alignment;
+
+/// \brief The size and the alignment of a partition.
+using layout = ::rocprim::detail::temp_storage::layout;
+
+/// \brief A leaf partition which stores its pointer to a location of type <tt>T*</tt>.
+/// \tparam T - the type of the elements of the partition.
+template<class T>
+using simple_partition = ::rocprim::detail::temp_storage::simple_partition<T>;
+
+/// \brief A partition of sub-partitions placed one after another, padded only as required
+/// by their alignments.
+/// \tparam Ts - the sub-partitions.
+template<class... Ts>
+using sequence_partition = ::rocprim::detail::temp_storage::linear_partition<Ts...>;
+
+/// \brief A partition of sub-partitions which are not used at the same time and share memory.
+/// \tparam Ts - the sub-partitions.
+template<class... Ts>
+using union_partition = ::rocprim::detail::temp_storage::union_partition<Ts...>;
+
+/// \brief Creates a leaf partition with the given layout.
+///
+/// \param [out] dest - the location the pointer to the partition is stored to.
+/// \param [in] storage_layout - the size and the alignment of the partition.
+template<class T>
+simple_partition<T> make_partition(T** dest, layout storage_layout)
+{
+    return ::rocprim::detail::temp_storage::make_partition(dest, storage_layout);
+}
+
+/// \brief Creates a leaf partition with the given size and alignment, it can hold for example
+/// the temporary storage of a device-level algorithm.
+///
+/// \param [out] dest - the location the pointer to the partition is stored to.
+/// \param [in] size - the size of the partition in bytes.
+/// \param [in] alignment - [optional] the alignment of the partition in bytes. Default is
+/// \p default_alignment.
+template<class T>
+simple_partition<T> make_partition(T** dest, size_t size, size_t alignment = default_alignment)
+{
+    return ::rocprim::detail::temp_storage::make_partition(dest, size, alignment);
+}
+
+/// \brief Creates a leaf partition of an array of \p elements elements of type \p T with the
+/// natural alignment of \p T.
+///
+/// \param [out] dest - the location the pointer to the array is stored to.
+/// \param [in] elements - the number of elements of the array.
+template<class T>
+simple_partition<T> ptr_aligned_array(T** dest, size_t elements)
+{
+    return ::rocprim::detail::temp_storage::ptr_aligned_array(dest, elements);
+}
+
+/// \brief Creates a partition which places the sub-partitions one after another.
+///
+/// \param [in] sub_partitions - the sub-partitions, leaves or other sequences and unions.
+template<class... Ts>
+sequence_partition<Ts...> make_sequence_partition(Ts... sub_partitions)
+{
+    return ::rocprim::detail::temp_storage::make_linear_partition(sub_partitions...);
+}
+
+/// \brief Creates a partition which overlays the sub-partitions at the same address. Its size
+/// is the largest size of the sub-partitions and its alignment is the largest alignment.
+///
+/// \param [in] sub_partitions - the sub-partitions, leaves or other sequences and unions.
+template<class... Ts>
+union_partition<Ts...> make_union_partition(Ts... sub_partitions)
+{
+    return ::rocprim::detail::temp_storage::make_union_partition(sub_partitions...);
+}
+
+/// \brief Computes the required size of the temporary storage of a partition, or assigns the
+/// pointers of its leaves.
+///
+/// \param [in] temporary_storage - pointer to the allocated temporary storage, or \p nullptr
+/// to query the required size, which is then written to \p storage_size.
+/// \param [in,out] storage_size - the size of \p temporary_storage in bytes. It is at least
+/// 4 bytes even if no memory is required.
+/// \param [in] root - the root partition.
+///
+/// \returns \p hipSuccess (\p 0) after a successful operation, \p hipErrorInvalidValue if
+/// \p storage_size is insufficient.
+template<class Partition>
+hipError_t partition(void* const temporary_storage, size_t& storage_size, Partition root)
+{
+    return ::rocprim::detail::temp_storage::partition(temporary_storage, storage_size, root);
+}
+
+} // end namespace temporary_storage
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_TEMPORARY_STORAGE_HPP_
@@ -22,6 +22,7 @@
 #define ROCPRIM_FUNCTIONAL_HPP_
 
 #include <functional>
+#include <type_traits>
 
 // Meta configuration for rocPRIM
 #include "config.hpp"
@@ -315,6 +316,39 @@ struct identity<void>
     }
 };
 
+/// \brief Trait telling whether a binary operator is commutative, that is
+/// <tt>op(a, b) == op(b, a)</tt> for all values.
+///
+/// Reductions require associative operators, and use faster algorithms for operators that are
+/// also commutative: they reduce items in any order, for example loaded striped across the
+/// threads of a block. Reductions of other operators combine the items in their order.
+/// Specialize the trait with \p std::true_type for custom commutative operators to enable
+/// the faster algorithms.
+///
+/// It is \p true for \p rocprim::plus, \p rocprim::multiplies, \p rocprim::maximum and
+/// \p rocprim::minimum, and \p false for other operators.
+///
+/// \tparam BinaryFunction - type of the binary operator.
+template<class BinaryFunction>
+struct is_commutative : std::false_type
+{};
+
+template<class T>
+struct is_commutative<plus<T>> : std::true_type
+{};
+
+template<class T>
+struct is_commutative<multiplies<T>> : std::true_type
+{};
+
+template<class T>
+struct is_commutative<maximum<T>> : std::true_type
+{};
+
+template<class T>
+struct is_commutative<minimum<T>> : std::true_type
+{};
+
 /**
  * \brief Statically determine log2(N), rounded up.
  *
@@ -26,6 +26,7 @@
 
 #include "intrinsics/atomic.hpp"
 #include "intrinsics/bit.hpp"
+#include "intrinsics/buffer_load.hpp"
 #include "intrinsics/thread.hpp"
 #include "intrinsics/warp.hpp"
 #include "intrinsics/warp_shuffle.hpp"
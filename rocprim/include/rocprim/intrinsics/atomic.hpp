@@ -22,6 +22,10 @@
 #define ROCPRIM_INTRINSICS_ATOMIC_HPP_
 
 #include "../config.hpp"
+#include "bit.hpp"
+#include "thread.hpp"
+#include "warp.hpp"
+#include "warp_shuffle.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -68,6 +72,137 @@ namespace detail
     {
         return ::atomicExch(address, value);
     }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    unsigned int atomic_cas(unsigned int * address, unsigned int compare, unsigned int value)
+    {
+        return ::atomicCAS(address, compare, value);
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    unsigned long long atomic_cas(unsigned long long * address,
+                                  unsigned long long   compare,
+                                  unsigned long long   value)
+    {
+        return ::atomicCAS(address, compare, value);
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    unsigned int atomic_or(unsigned int * address, unsigned int value)
+    {
+        return ::atomicOr(address, value);
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    unsigned long long atomic_min(unsigned long long * address, unsigned long long value)
+    {
+        return ::atomicMin(address, value);
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    unsigned int atomic_max(unsigned int * address, unsigned int value)
+    {
+        return ::atomicMax(address, value);
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    unsigned long long atomic_max(unsigned long long * address, unsigned long long value)
+    {
+        return ::atomicMax(address, value);
+    }
+
+    // Lowest lane of a non-empty lane mask
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    unsigned int lane_mask_first_lane(lane_mask_type mask)
+    {
+        return static_cast<unsigned int>(__builtin_ctzll(static_cast<unsigned long long>(mask)));
+    }
+
+    // Warp-aggregated atomic add: every active lane adds value to the same address, but only the
+    // first active lane (the leader) issues one atomic operation with the sum of the warp.
+    // value must be the same for all active lanes. Returns the value at address as if the
+    // lanes had added their values one after another in the order of lane ids, so it can be
+    // used to reserve slots (e.g. address is a counter of a queue and value is 1).
+    template<class T>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    T warp_aggregated_atomic_add(T * address, T value)
+    {
+        const lane_mask_type active_mask = ::rocprim::ballot(1);
+        const unsigned int   leader      = lane_mask_first_lane(active_mask);
+        const unsigned int   rank        = ::rocprim::masked_bit_count(active_mask);
+        T                    old{};
+        if(rank == 0)
+        {
+            old = atomic_add(address, value * static_cast<T>(::rocprim::bit_count(active_mask)));
+        }
+        old = warp_readlane(old, static_cast<int>(leader));
+        return old + value * static_cast<T>(rank);
+    }
+
+    // Returns the mask of the active lanes having the same label as the current lane. Only the
+    // lowest label_bits bits of the labels are compared, one ballot is done per bit.
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    lane_mask_type warp_match_any(unsigned int label, unsigned int label_bits)
+    {
+        lane_mask_type match_mask = ::rocprim::ballot(1);
+        for(unsigned int b = 0; b < label_bits; b++)
+        {
+            const bool           bit_set      = (label & (1u << b)) != 0;
+            const lane_mask_type bit_set_mask = ::rocprim::ballot(bit_set);
+            match_mask &= (bit_set ? bit_set_mask : ~bit_set_mask);
+        }
+        return match_mask;
+    }
+
+    // Warp-aggregated atomic add to varying addresses: every active lane adds value to
+    // base[index]. The lanes are grouped by their index with warp_match_any, and the first lane
+    // of every group issues one atomic operation with the sum of the group, so a warp issues
+    // one atomic operation per distinct address. value must be the same for all lanes of a group
+    // and index must be less than 2^index_bits.
+    template<class T>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void warp_grouped_atomic_add(T * base, unsigned int index, unsigned int index_bits, T value)
+    {
+        const lane_mask_type group_mask = warp_match_any(index, index_bits);
+        if(::rocprim::masked_bit_count(group_mask) == 0)
+        {
+            atomic_add(&base[index], value * static_cast<T>(::rocprim::bit_count(group_mask)));
+        }
+    }
+
+    // Loads with acquire semantics at device scope: memory operations after the load are not
+    // reordered before it and see the stores released to the same address.
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    unsigned int atomic_load_acquire(const unsigned int * address)
+    {
+#if defined(__HIP_CPU_RT__) || !defined(__HIP_MEMORY_SCOPE_AGENT)
+        return __atomic_load_n(address, __ATOMIC_ACQUIRE);
+#else
+        return __hip_atomic_load(address, __ATOMIC_ACQUIRE, __HIP_MEMORY_SCOPE_AGENT);
+#endif
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    unsigned long long atomic_load_acquire(const unsigned long long * address)
+    {
+#if defined(__HIP_CPU_RT__) || !defined(__HIP_MEMORY_SCOPE_AGENT)
+        return __atomic_load_n(address, __ATOMIC_ACQUIRE);
+#else
+        return __hip_atomic_load(address, __ATOMIC_ACQUIRE, __HIP_MEMORY_SCOPE_AGENT);
+#endif
+    }
+
+    // Stores with release semantics at device scope: memory operations before the store are not
+    // reordered after it.
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void atomic_store_release(unsigned int * address, unsigned int value)
+    {
+#if defined(__HIP_CPU_RT__) || !defined(__HIP_MEMORY_SCOPE_AGENT)
+        __atomic_store_n(address, value, __ATOMIC_RELEASE);
+#else
+        __hip_atomic_store(address, value, __ATOMIC_RELEASE, __HIP_MEMORY_SCOPE_AGENT);
+#endif
+    }
 }
 
 END_ROCPRIM_NAMESPACE
@@ -0,0 +1,153 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_INTRINSICS_BUFFER_LOAD_HPP_
+#define ROCPRIM_INTRINSICS_BUFFER_LOAD_HPP_
+
+#include <cstdint>
+#include <type_traits>
+
+#include "../config.hpp"
+
+// Buffer loads are used on GCN and RDNA targets. The last dword of a buffer resource holds
+// the data format and the bounds checking mode, its encoding depends on the target family.
+#if defined(__HIP_DEVICE_COMPILE__) && !defined(__HIP_CPU_RT__) \
+    && (defined(__GFX9__) || defined(__GFX10__) || defined(__GFX11__))
+    #define ROCPRIM_DETAIL_USE_BUFFER_LOAD 1
+    #if defined(__GFX9__)
+        #define ROCPRIM_DETAIL_BUFFER_RESOURCE_DWORD3 0x00020000
+    #elif defined(__GFX10__)
+        #define ROCPRIM_DETAIL_BUFFER_RESOURCE_DWORD3 0x31014000
+    #else
+        #define ROCPRIM_DETAIL_BUFFER_RESOURCE_DWORD3 0x31004000
+    #endif
+#else
+    #define ROCPRIM_DETAIL_USE_BUFFER_LOAD 0
+#endif
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Values of T can be loaded with buffer loads of one, two or four dwords
+template<class T>
+struct is_buffer_loadable
+    : std::integral_constant<
+        bool,
+        ROCPRIM_DETAIL_USE_BUFFER_LOAD
+            && std::is_trivially_copyable<T>::value
+            && alignof(T) >= 4
+            && (sizeof(T) == 4 || sizeof(T) == 8 || sizeof(T) == 16)
+    >
+{};
+
+#if ROCPRIM_DETAIL_USE_BUFFER_LOAD
+
+using buffer_resource = int __attribute__((ext_vector_type(4)));
+using buffer_int2 = int __attribute__((ext_vector_type(2)));
+using buffer_int4 = int __attribute__((ext_vector_type(4)));
+
+__device__ int
+    llvm_amdgcn_raw_buffer_load_i32(buffer_resource rsrc, int voffset, int soffset, int aux)
+    __asm("llvm.amdgcn.raw.buffer.load.i32");
+
+__device__ buffer_int2
+    llvm_amdgcn_raw_buffer_load_v2i32(buffer_resource rsrc, int voffset, int soffset, int aux)
+    __asm("llvm.amdgcn.raw.buffer.load.v2i32");
+
+__device__ buffer_int4
+    llvm_amdgcn_raw_buffer_load_v4i32(buffer_resource rsrc, int voffset, int soffset, int aux)
+    __asm("llvm.amdgcn.raw.buffer.load.v4i32");
+
+// Loads through the returned resource read zeros at the offsets at or after size bytes.
+// The base of the resource should be uniform across the warp to be kept in scalar registers.
+ROCPRIM_DEVICE ROCPRIM_INLINE
+buffer_resource make_buffer_resource(const void* base, unsigned int size)
+{
+    const uintptr_t address = reinterpret_cast<uintptr_t>(base);
+    buffer_resource resource;
+    resource.x = static_cast<int>(address);
+    // The stride (the high bits of the second dword) is zero, so the buffer is raw bytes
+    resource.y = static_cast<int>(address >> 32) & 0xFFFF;
+    resource.z = static_cast<int>(size);
+    resource.w = ROCPRIM_DETAIL_BUFFER_RESOURCE_DWORD3;
+    return resource;
+}
+
+template<unsigned int Size>
+struct buffer_load_dwords;
+
+template<>
+struct buffer_load_dwords<4>
+{
+    using type = int;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static type load(buffer_resource resource, unsigned int offset)
+    {
+        return llvm_amdgcn_raw_buffer_load_i32(resource, static_cast<int>(offset), 0, 0);
+    }
+};
+
+template<>
+struct buffer_load_dwords<8>
+{
+    using type = buffer_int2;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static type load(buffer_resource resource, unsigned int offset)
+    {
+        return llvm_amdgcn_raw_buffer_load_v2i32(resource, static_cast<int>(offset), 0, 0);
+    }
+};
+
+template<>
+struct buffer_load_dwords<16>
+{
+    using type = buffer_int4;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static type load(buffer_resource resource, unsigned int offset)
+    {
+        return llvm_amdgcn_raw_buffer_load_v4i32(resource, static_cast<int>(offset), 0, 0);
+    }
+};
+
+// Loads a value at offset bytes from the base of the resource, a value out of the range
+// of the resource is all zero bits. T must satisfy is_buffer_loadable.
+template<class T>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+T buffer_load(buffer_resource resource, unsigned int offset)
+{
+    using dwords = buffer_load_dwords<sizeof(T)>;
+    const typename dwords::type raw = dwords::load(resource, offset);
+    T value;
+    __builtin_memcpy(&value, &raw, sizeof(T));
+    return value;
+}
+
+#endif // ROCPRIM_DETAIL_USE_BUFFER_LOAD
+
+} // end namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_INTRINSICS_BUFFER_LOAD_HPP_
@@ -24,6 +24,7 @@
 #include <atomic>
 
 #include "../config.hpp"
+#include "../detail/device_properties.hpp"
 #include "../detail/various.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
@@ -51,15 +52,11 @@ constexpr unsigned int warp_size()
 ROCPRIM_HOST inline
 unsigned int host_warp_size()
 {
-    int default_hip_device;
-    hipError_t success = hipGetDevice(&default_hip_device);
-    hipDeviceProp_t device_prop;
-    success = hipGetDeviceProperties(&device_prop,default_hip_device);
-
-    if(success != hipSuccess)
+    detail::device_properties props;
+    if(detail::get_current_device_properties(props) != hipSuccess)
         return -1;
     else
-        return device_prop.warpSize;
+        return props.warp_size;
 };
 
 /// \brief Returns a number of threads in a hardware warp for the actual target.
@@ -24,6 +24,7 @@
 #include <type_traits>
 
 #include "../config.hpp"
+#include "../types/tuple.hpp"
 #include "thread.hpp"
 
 /// \addtogroup warpmodule
@@ -109,6 +110,28 @@ warp_shuffle_op(const T& input, ShuffleOp&& op)
 
 }
 
+template<class... Types, class ShuffleOp>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+::rocprim::tuple<Types...> warp_shuffle_op(const ::rocprim::tuple<Types...>& input, ShuffleOp&& op);
+
+template<class... Types, class ShuffleOp, size_t... Indices>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+::rocprim::tuple<Types...> warp_shuffle_tuple_op(const ::rocprim::tuple<Types...>& input,
+                                                 ShuffleOp&                        op,
+                                                 ::rocprim::index_sequence<Indices...>)
+{
+    return ::rocprim::tuple<Types...>(warp_shuffle_op(::rocprim::get<Indices>(input), op)...);
+}
+
+// The components of a tuple are moved separately, without the padding between them, so
+// the reductions of tuples apply the operator of every component to its own moved words
+template<class... Types, class ShuffleOp>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+::rocprim::tuple<Types...> warp_shuffle_op(const ::rocprim::tuple<Types...>& input, ShuffleOp&& op)
+{
+    return warp_shuffle_tuple_op(input, op, ::rocprim::index_sequence_for<Types...>{});
+}
+
 template<class T, int dpp_ctrl, int row_mask = 0xf, int bank_mask = 0xf, bool bound_ctrl = false>
 ROCPRIM_DEVICE ROCPRIM_INLINE
 T warp_move_dpp(const T& input)
@@ -254,6 +277,84 @@ T warp_shuffle_xor(const T& input, const int lane_mask, const int width = device
     );
 }
 
+namespace detail
+{
+
+/// \brief Reads \p input of the lane \p src_lane of the hardware warp with \p v_readlane.
+///
+/// \p src_lane must be uniform across the warp, the result is uniform too.
+template<class T>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+T warp_readlane(const T& input, const int src_lane)
+{
+    return detail::warp_shuffle_op(
+        input,
+        [=](int v) -> int
+        {
+#if !defined(__HIP_CPU_RT__)
+            return ::__builtin_amdgcn_readlane(v, src_lane);
+#else
+            (void) src_lane;
+            return v;
+#endif
+        }
+    );
+}
+
+#if ROCPRIM_NAVI
+/// \brief Every lane reads \p input of the lane 15 of the other row of 16 lanes in its group
+/// of 32 lanes with \p v_permlanex16, the lanes 0-15 read the lane 31 and the lanes 16-31 read
+/// the lane 15.
+template<class T>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+T warp_permlanex16_last(const T& input)
+{
+    return detail::warp_shuffle_op(
+        input,
+        [=](int v) -> int
+        {
+            return static_cast<int>(::__builtin_amdgcn_permlanex16(static_cast<unsigned int>(v),
+                                                                   static_cast<unsigned int>(v),
+                                                                   0xFFFFFFFFu,
+                                                                   0xFFFFFFFFu,
+                                                                   false,
+                                                                   false));
+        }
+    );
+}
+#endif
+
+/// \brief Every lane reads \p input of the last lane of its logical warp of \p WarpSize lanes.
+///
+/// If the logical warp is the hardware warp or its half, it is read with \p v_readlane, and
+/// rows of 16 lanes are broadcast with DPP where it is supported, so the value does not need to
+/// go through the LDS crossbar like with \p ds_bpermute of \p warp_shuffle.
+template<unsigned int WarpSize, class T>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+T warp_shuffle_last(const T& input)
+{
+    if(WarpSize == device_warp_size())
+    {
+        return warp_readlane(input, WarpSize - 1);
+    }
+    if(2 * WarpSize == device_warp_size())
+    {
+        const T first  = warp_readlane(input, WarpSize - 1);
+        const T second = warp_readlane(input, 2 * WarpSize - 1);
+        return ::rocprim::lane_id() < WarpSize ? first : second;
+    }
+#if ROCPRIM_DETAIL_HAS_DPP_ROW_SHARE
+    if(WarpSize == 16)
+    {
+        // row_newbcast:15 or row_share:15
+        return warp_move_dpp<T, 0x15f>(input);
+    }
+#endif
+    return warp_shuffle(input, WarpSize - 1, WarpSize);
+}
+
+} // end namespace detail
+
 END_ROCPRIM_NAMESPACE
 
 #endif // ROCPRIM_INTRINSICS_WARP_SHUFFLE_HPP_
@@ -0,0 +1,281 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_ITERATOR_BITPACKED_ITERATOR_HPP_
+#define ROCPRIM_ITERATOR_BITPACKED_ITERATOR_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+
+/// \addtogroup iteratormodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Extracts the value at bit shift of the 64 bits formed by low and high, sign-extended
+// for signed value types
+template<unsigned int BitWidth, class T>
+ROCPRIM_HOST_DEVICE inline
+T bitpacked_extract(const unsigned int low, const unsigned int high, const unsigned int shift)
+{
+    constexpr unsigned int mask = BitWidth == 32 ? ~0u : (1u << BitWidth) - 1u;
+    const unsigned long long combined
+        = (static_cast<unsigned long long>(high) << 32) | static_cast<unsigned long long>(low);
+    const unsigned int value = static_cast<unsigned int>(combined >> shift) & mask;
+    if(std::is_signed<T>::value && BitWidth < 32)
+    {
+        constexpr unsigned int sign = 1u << (BitWidth - 1);
+        return static_cast<T>(static_cast<int>((value ^ sign) - sign));
+    }
+    return static_cast<T>(value);
+}
+
+} // end namespace detail
+
+/// \class bitpacked_iterator
+/// \brief A random-access input (read-only) iterator over integers packed with a fixed number
+/// of bits per value.
+///
+/// \par Overview
+/// * The values are packed into 32-bit words from the least significant bit: value \p i
+/// occupies the bits <tt>[i * BitWidth, (i + 1) * BitWidth)</tt> of the array of words, a
+/// value may span two consecutive words.
+/// * Dereferencing reads the one or two words holding the value and unpacks it, so every
+/// algorithm can read packed columns directly and only the packed bits cross the memory bus.
+/// * \p block_load with \p block_load_vectorize or \p block_load_transpose loads full tiles
+/// by reading the words of each thread with vector loads and unpacking its items in
+/// registers, when the items of a thread fill whole words.
+/// * Signed value types are sign-extended from \p BitWidth bits.
+///
+/// \tparam BitWidth - the number of bits of each value, from 1 to 32.
+/// \tparam T - [optional] the integral type of the unpacked values. Default is
+/// <tt>unsigned int</tt>.
+template<unsigned int BitWidth, class T = unsigned int>
+class bitpacked_iterator
+{
+    static_assert(BitWidth >= 1 && BitWidth <= 32, "BitWidth must be between 1 and 32");
+    static_assert(std::is_integral<T>::value, "T must be an integral type");
+
+public:
+    /// The type of the value that can be obtained by dereferencing the iterator.
+    using value_type = T;
+    /// \brief A reference type of the type iterated over (\p value_type).
+    /// It's \p value_type since the values are unpacked on every access.
+    using reference = value_type;
+    /// \brief A pointer type of the type iterated over (\p value_type).
+    using pointer = const value_type*;
+    /// A type used for identify distance between iterators.
+    using difference_type = std::ptrdiff_t;
+    /// The category of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+
+    /// The number of bits of each value.
+    static constexpr unsigned int bit_width = BitWidth;
+
+    /// \brief Creates a new bitpacked_iterator.
+    ///
+    /// \param words - pointer to the packed words.
+    /// \param index - [optional] the index of the value the iterator points to. Default is
+    /// \p 0.
+    ROCPRIM_HOST_DEVICE inline
+    explicit bitpacked_iterator(const unsigned int* words = nullptr, difference_type index = 0)
+        : words_(words), index_(index)
+    {
+    }
+
+    /// \brief Returns the pointer to the packed words.
+    ROCPRIM_HOST_DEVICE inline
+    const unsigned int* words() const
+    {
+        return words_;
+    }
+
+    /// \brief Returns the index of the value the iterator points to.
+    ROCPRIM_HOST_DEVICE inline
+    difference_type index() const
+    {
+        return index_;
+    }
+
+    //! \skip_doxy_start
+    ROCPRIM_HOST_DEVICE inline
+    bitpacked_iterator& operator++()
+    {
+        index_++;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bitpacked_iterator operator++(int)
+    {
+        bitpacked_iterator old = *this;
+        index_++;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bitpacked_iterator& operator--()
+    {
+        index_--;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bitpacked_iterator operator--(int)
+    {
+        bitpacked_iterator old = *this;
+        index_--;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    value_type operator*() const
+    {
+        return value(static_cast<size_t>(index_));
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    value_type operator[](difference_type distance) const
+    {
+        return value(static_cast<size_t>(index_ + distance));
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bitpacked_iterator operator+(difference_type distance) const
+    {
+        return bitpacked_iterator(words_, index_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bitpacked_iterator& operator+=(difference_type distance)
+    {
+        index_ += distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bitpacked_iterator operator-(difference_type distance) const
+    {
+        return bitpacked_iterator(words_, index_ - distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bitpacked_iterator& operator-=(difference_type distance)
+    {
+        index_ -= distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    difference_type operator-(bitpacked_iterator other) const
+    {
+        return index_ - other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator==(bitpacked_iterator other) const
+    {
+        return index_ == other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator!=(bitpacked_iterator other) const
+    {
+        return index_ != other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<(bitpacked_iterator other) const
+    {
+        return index_ < other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<=(bitpacked_iterator other) const
+    {
+        return index_ <= other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>(bitpacked_iterator other) const
+    {
+        return index_ > other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>=(bitpacked_iterator other) const
+    {
+        return index_ >= other.index_;
+    }
+    //! \skip_doxy_end
+
+private:
+    ROCPRIM_HOST_DEVICE inline
+    value_type value(size_t index) const
+    {
+        const size_t       bit   = index * BitWidth;
+        const size_t       word  = bit / 32;
+        const unsigned int shift = static_cast<unsigned int>(bit % 32);
+        // The next word is only read if the value spans it
+        const unsigned int high = shift + BitWidth > 32 ? words_[word + 1] : 0u;
+        return detail::bitpacked_extract<BitWidth, T>(words_[word], high, shift);
+    }
+
+    const unsigned int* words_;
+    difference_type     index_;
+};
+
+template<unsigned int BitWidth, class T>
+ROCPRIM_HOST_DEVICE inline
+bitpacked_iterator<BitWidth, T>
+operator+(typename bitpacked_iterator<BitWidth, T>::difference_type distance,
+          const bitpacked_iterator<BitWidth, T>&                    iterator)
+{
+    return iterator + distance;
+}
+
+/// make_bitpacked_iterator creates a \p bitpacked_iterator over integers packed with
+/// \p BitWidth bits per value.
+///
+/// \tparam BitWidth - the number of bits of each value, from 1 to 32.
+/// \tparam T - [optional] the integral type of the unpacked values. Default is
+/// <tt>unsigned int</tt>.
+///
+/// \param words - pointer to the packed words.
+/// \return A \p bitpacked_iterator at the first value.
+template<unsigned int BitWidth, class T = unsigned int>
+ROCPRIM_HOST_DEVICE inline
+bitpacked_iterator<BitWidth, T> make_bitpacked_iterator(const unsigned int* words)
+{
+    return bitpacked_iterator<BitWidth, T>(words);
+}
+
+/// @}
+// end of group iteratormodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_ITERATOR_BITPACKED_ITERATOR_HPP_
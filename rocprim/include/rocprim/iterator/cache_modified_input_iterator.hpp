@@ -0,0 +1,253 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_ITERATOR_CACHE_MODIFIED_INPUT_ITERATOR_HPP_
+#define ROCPRIM_ITERATOR_CACHE_MODIFIED_INPUT_ITERATOR_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <ostream>
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../thread/thread_load.hpp"
+
+/// \addtogroup iteratormodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \class cache_modified_input_iterator
+/// \brief A random-access input (read-only) iterator adaptor for dereferencing array values
+/// with a cache load modifier.
+///
+/// \par Overview
+/// * A cache_modified_input_iterator wraps a device pointer of type T, where values are
+/// obtained by \p thread_load with the given \p cache_load_modifier, for example
+/// \p load_cs for data which is read only once or \p load_ldg for read-only data.
+/// * Unlike \p texture_cache_iterator it requires no setup: it can be constructed within
+/// host and device functions, and no resources have to be created or released.
+/// * Can only be dereferenced within device functions, on the host the pointer is
+/// dereferenced directly.
+///
+/// \tparam T - type of value that can be obtained by dereferencing the iterator.
+/// \tparam Modifier - [optional] the cache load modifier of the loads. Default is
+/// \p load_ldg.
+/// \tparam Difference - [optional] a type used for identify distance between iterators.
+template<
+    class T,
+    cache_load_modifier Modifier = load_ldg,
+    class Difference = std::ptrdiff_t
+>
+class cache_modified_input_iterator
+{
+public:
+    /// The type of the value that can be obtained by dereferencing the iterator.
+    using value_type = typename std::remove_cv<T>::type;
+    /// \brief A reference type of the type iterated over (\p value_type).
+    using reference = const value_type&;
+    /// \brief A pointer type of the type iterated over (\p value_type).
+    using pointer = const value_type*;
+    /// A type used for identify distance between iterators.
+    using difference_type = Difference;
+    /// The category of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+
+    ROCPRIM_HOST_DEVICE inline
+    ~cache_modified_input_iterator() = default;
+
+    /// \brief Creates a new cache_modified_input_iterator.
+    ///
+    /// \param ptr - pointer to the first element of the array.
+    ROCPRIM_HOST_DEVICE inline
+    explicit cache_modified_input_iterator(const value_type* ptr = nullptr)
+        : ptr_(const_cast<value_type*>(ptr))
+    {
+    }
+
+    /// \brief Returns the wrapped pointer.
+    ROCPRIM_HOST_DEVICE inline
+    pointer base() const
+    {
+        return ptr_;
+    }
+
+    //! \skip_doxy_start
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_input_iterator& operator++()
+    {
+        ptr_++;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_input_iterator operator++(int)
+    {
+        cache_modified_input_iterator old = *this;
+        ptr_++;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_input_iterator& operator--()
+    {
+        ptr_--;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_input_iterator operator--(int)
+    {
+        cache_modified_input_iterator old = *this;
+        ptr_--;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    value_type operator*() const
+    {
+        #ifndef __HIP_DEVICE_COMPILE__
+        return *ptr_;
+        #else
+        return ::rocprim::thread_load<Modifier>(ptr_);
+        #endif
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    value_type operator[](difference_type distance) const
+    {
+        return *(*this + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_input_iterator operator+(difference_type distance) const
+    {
+        return cache_modified_input_iterator(ptr_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_input_iterator& operator+=(difference_type distance)
+    {
+        ptr_ += distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_input_iterator operator-(difference_type distance) const
+    {
+        return cache_modified_input_iterator(ptr_ - distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_input_iterator& operator-=(difference_type distance)
+    {
+        ptr_ -= distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    difference_type operator-(cache_modified_input_iterator other) const
+    {
+        return ptr_ - other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator==(cache_modified_input_iterator other) const
+    {
+        return ptr_ == other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator!=(cache_modified_input_iterator other) const
+    {
+        return ptr_ != other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<(cache_modified_input_iterator other) const
+    {
+        return ptr_ < other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<=(cache_modified_input_iterator other) const
+    {
+        return ptr_ <= other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>(cache_modified_input_iterator other) const
+    {
+        return ptr_ > other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>=(cache_modified_input_iterator other) const
+    {
+        return ptr_ >= other.ptr_;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os,
+                                    const cache_modified_input_iterator& /* iter */)
+    {
+        return os;
+    }
+    //! \skip_doxy_end
+
+private:
+    // thread_load takes a non-const pointer, the iterator never writes through it
+    value_type* ptr_;
+};
+
+template<
+    class T,
+    cache_load_modifier Modifier,
+    class Difference
+>
+ROCPRIM_HOST_DEVICE inline
+cache_modified_input_iterator<T, Modifier, Difference>
+operator+(typename cache_modified_input_iterator<T, Modifier, Difference>::difference_type distance,
+          const cache_modified_input_iterator<T, Modifier, Difference>& iterator)
+{
+    return iterator + distance;
+}
+
+/// make_cache_modified_input_iterator creates a \p cache_modified_input_iterator which loads
+/// the values of an array with a cache load modifier.
+///
+/// \tparam Modifier - [optional] the cache load modifier of the loads. Default is
+/// \p load_ldg.
+/// \tparam T - [inferred] type of the elements of the array.
+///
+/// \param ptr - pointer to the first element of the array.
+/// \return A \p cache_modified_input_iterator at the first element of the array.
+template<cache_load_modifier Modifier = load_ldg, class T>
+ROCPRIM_HOST_DEVICE inline
+cache_modified_input_iterator<T, Modifier> make_cache_modified_input_iterator(const T* ptr)
+{
+    return cache_modified_input_iterator<T, Modifier>(ptr);
+}
+
+/// @}
+// end of group iteratormodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_ITERATOR_CACHE_MODIFIED_INPUT_ITERATOR_HPP_
@@ -0,0 +1,280 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_ITERATOR_DELTA_DECODING_ITERATOR_HPP_
+#define ROCPRIM_ITERATOR_DELTA_DECODING_ITERATOR_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+
+/// \addtogroup iteratormodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \class delta_decoding_iterator
+/// \brief A random-access input (read-only) iterator over delta-encoded values.
+///
+/// \par Overview
+/// * The values are stored as differences of consecutive values: <tt>deltas[0] = values[0]</tt>
+/// and <tt>deltas[i] = values[i] - values[i - 1]</tt>. Additionally every \p interval-th value
+/// is stored as a checkpoint: <tt>checkpoints[k] = values[k * interval]</tt>.
+/// * Dereferencing the iterator at \p i starts from the preceding checkpoint and adds the
+/// following deltas up to \p i, so the cost of a random access is proportional to
+/// \p interval. The values are decoded while an algorithm loads them and are never written
+/// to global memory.
+/// * In custom kernels which process consecutive tiles, \p block_delta_decode decodes a whole
+/// tile of deltas with a block-wide scan and a prefix carried from the previous tile, without
+/// reading the checkpoints.
+///
+/// \tparam DeltaIterator - a random-access iterator over the deltas.
+/// \tparam CheckpointIterator - [optional] a random-access iterator over the checkpoints,
+/// its value type is the type of the decoded values. Default is \p DeltaIterator.
+template<class DeltaIterator, class CheckpointIterator = DeltaIterator>
+class delta_decoding_iterator
+{
+public:
+    /// The type of the value that can be obtained by dereferencing the iterator.
+    using value_type = typename std::iterator_traits<CheckpointIterator>::value_type;
+    /// \brief A reference type of the type iterated over (\p value_type).
+    /// It's \p value_type since the values are decoded on every access.
+    using reference = value_type;
+    /// \brief A pointer type of the type iterated over (\p value_type).
+    using pointer = const value_type*;
+    /// A type used for identify distance between iterators.
+    using difference_type = std::ptrdiff_t;
+    /// The category of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+
+    /// \brief Creates a new delta_decoding_iterator.
+    ///
+    /// \param deltas - iterator at the first delta.
+    /// \param checkpoints - iterator at the first checkpoint.
+    /// \param interval - the number of values between consecutive checkpoints, must be
+    /// greater than 0.
+    /// \param index - [optional] the index of the value the iterator points to. Default is
+    /// \p 0.
+    ROCPRIM_HOST_DEVICE inline
+    delta_decoding_iterator(DeltaIterator      deltas,
+                            CheckpointIterator checkpoints,
+                            unsigned int       interval,
+                            difference_type    index = 0)
+        : deltas_(deltas), checkpoints_(checkpoints), interval_(interval), index_(index)
+    {
+    }
+
+    /// \brief Returns the iterator at the first delta.
+    ROCPRIM_HOST_DEVICE inline
+    DeltaIterator deltas() const
+    {
+        return deltas_;
+    }
+
+    /// \brief Returns the iterator at the first checkpoint.
+    ROCPRIM_HOST_DEVICE inline
+    CheckpointIterator checkpoints() const
+    {
+        return checkpoints_;
+    }
+
+    /// \brief Returns the number of values between consecutive checkpoints.
+    ROCPRIM_HOST_DEVICE inline
+    unsigned int interval() const
+    {
+        return interval_;
+    }
+
+    /// \brief Returns the index of the value the iterator points to.
+    ROCPRIM_HOST_DEVICE inline
+    difference_type index() const
+    {
+        return index_;
+    }
+
+    //! \skip_doxy_start
+    ROCPRIM_HOST_DEVICE inline
+    delta_decoding_iterator& operator++()
+    {
+        index_++;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    delta_decoding_iterator operator++(int)
+    {
+        delta_decoding_iterator old = *this;
+        index_++;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    delta_decoding_iterator& operator--()
+    {
+        index_--;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    delta_decoding_iterator operator--(int)
+    {
+        delta_decoding_iterator old = *this;
+        index_--;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    value_type operator*() const
+    {
+        return value(static_cast<size_t>(index_));
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    value_type operator[](difference_type distance) const
+    {
+        return value(static_cast<size_t>(index_ + distance));
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    delta_decoding_iterator operator+(difference_type distance) const
+    {
+        return delta_decoding_iterator(deltas_, checkpoints_, interval_, index_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    delta_decoding_iterator& operator+=(difference_type distance)
+    {
+        index_ += distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    delta_decoding_iterator operator-(difference_type distance) const
+    {
+        return delta_decoding_iterator(deltas_, checkpoints_, interval_, index_ - distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    delta_decoding_iterator& operator-=(difference_type distance)
+    {
+        index_ -= distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    difference_type operator-(delta_decoding_iterator other) const
+    {
+        return index_ - other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator==(delta_decoding_iterator other) const
+    {
+        return index_ == other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator!=(delta_decoding_iterator other) const
+    {
+        return index_ != other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<(delta_decoding_iterator other) const
+    {
+        return index_ < other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<=(delta_decoding_iterator other) const
+    {
+        return index_ <= other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>(delta_decoding_iterator other) const
+    {
+        return index_ > other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>=(delta_decoding_iterator other) const
+    {
+        return index_ >= other.index_;
+    }
+    //! \skip_doxy_end
+
+private:
+    ROCPRIM_HOST_DEVICE inline
+    value_type value(size_t index) const
+    {
+        const size_t checkpoint = index / interval_;
+        const size_t first      = checkpoint * interval_;
+        value_type   result     = checkpoints_[checkpoint];
+        for(size_t i = first + 1; i <= index; i++)
+        {
+            result = result + static_cast<value_type>(deltas_[i]);
+        }
+        return result;
+    }
+
+    DeltaIterator      deltas_;
+    CheckpointIterator checkpoints_;
+    unsigned int       interval_;
+    difference_type    index_;
+};
+
+template<class DeltaIterator, class CheckpointIterator>
+ROCPRIM_HOST_DEVICE inline
+delta_decoding_iterator<DeltaIterator, CheckpointIterator>
+operator+(typename delta_decoding_iterator<DeltaIterator, CheckpointIterator>::difference_type
+              distance,
+          const delta_decoding_iterator<DeltaIterator, CheckpointIterator>& iterator)
+{
+    return iterator + distance;
+}
+
+/// make_delta_decoding_iterator creates a \p delta_decoding_iterator over delta-encoded values.
+///
+/// \param deltas - iterator at the first delta.
+/// \param checkpoints - iterator at the first checkpoint.
+/// \param interval - the number of values between consecutive checkpoints, must be greater
+/// than 0.
+/// \return A \p delta_decoding_iterator at the first value.
+template<class DeltaIterator, class CheckpointIterator>
+ROCPRIM_HOST_DEVICE inline
+delta_decoding_iterator<DeltaIterator, CheckpointIterator>
+make_delta_decoding_iterator(DeltaIterator      deltas,
+                             CheckpointIterator checkpoints,
+                             unsigned int       interval)
+{
+    return delta_decoding_iterator<DeltaIterator, CheckpointIterator>(deltas,
+                                                                      checkpoints,
+                                                                      interval);
+}
+
+/// @}
+// end of group iteratormodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_ITERATOR_DELTA_DECODING_ITERATOR_HPP_
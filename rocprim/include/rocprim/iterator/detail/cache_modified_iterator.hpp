@@ -0,0 +1,294 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_ITERATOR_DETAIL_CACHE_MODIFIED_ITERATOR_HPP_
+#define ROCPRIM_ITERATOR_DETAIL_CACHE_MODIFIED_ITERATOR_HPP_
+
+#include <iterator>
+#include <cstddef>
+#include <type_traits>
+
+#include "../../config.hpp"
+#include "../../types.hpp"
+#include "../../thread/thread_load.hpp"
+#include "../../thread/thread_store.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Reads the values of a pointer with thread_load using the cache modifier. Used by device-level
+// algorithms to apply the load cache modifier of their configuration to raw pointer inputs.
+template<class T, cache_load_modifier Modifier>
+class cache_modified_input_iterator
+{
+public:
+    using value_type = typename std::remove_cv<T>::type;
+    using reference = value_type;
+    using pointer = const value_type*;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::random_access_iterator_tag;
+
+    ROCPRIM_HOST_DEVICE inline
+    ~cache_modified_input_iterator() = default;
+
+    ROCPRIM_HOST_DEVICE inline
+    explicit cache_modified_input_iterator(T* ptr)
+        : ptr_(const_cast<value_type*>(ptr))
+    {
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_input_iterator& operator++()
+    {
+        ptr_++;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_input_iterator operator++(int)
+    {
+        cache_modified_input_iterator old = *this;
+        ptr_++;
+        return old;
+    }
+
+    ROCPRIM_DEVICE inline
+    value_type operator*() const
+    {
+        return thread_load<Modifier>(ptr_);
+    }
+
+    ROCPRIM_DEVICE inline
+    value_type operator[](difference_type distance) const
+    {
+        return thread_load<Modifier>(ptr_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_input_iterator operator+(difference_type distance) const
+    {
+        return cache_modified_input_iterator(ptr_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_input_iterator& operator+=(difference_type distance)
+    {
+        ptr_ += distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_input_iterator operator-(difference_type distance) const
+    {
+        return cache_modified_input_iterator(ptr_ - distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_input_iterator& operator-=(difference_type distance)
+    {
+        ptr_ -= distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    difference_type operator-(cache_modified_input_iterator other) const
+    {
+        return ptr_ - other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator==(cache_modified_input_iterator other) const
+    {
+        return ptr_ == other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator!=(cache_modified_input_iterator other) const
+    {
+        return ptr_ != other.ptr_;
+    }
+
+private:
+    value_type* ptr_;
+};
+
+// Writes the values to a pointer with thread_store using the cache modifier. Used by device-level
+// algorithms to apply the store cache modifier of their configuration to raw pointer outputs.
+template<class T, cache_store_modifier Modifier>
+class cache_modified_output_iterator
+{
+    struct reference_proxy
+    {
+        T* ptr;
+
+        template<class U>
+        ROCPRIM_DEVICE inline
+        reference_proxy& operator=(const U& value)
+        {
+            thread_store<Modifier>(ptr, static_cast<T>(value));
+            return *this;
+        }
+    };
+
+public:
+    using value_type = T;
+    using reference = reference_proxy;
+    using pointer = T*;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::random_access_iterator_tag;
+
+    ROCPRIM_HOST_DEVICE inline
+    ~cache_modified_output_iterator() = default;
+
+    ROCPRIM_HOST_DEVICE inline
+    explicit cache_modified_output_iterator(T* ptr)
+        : ptr_(ptr)
+    {
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_output_iterator& operator++()
+    {
+        ptr_++;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_output_iterator operator++(int)
+    {
+        cache_modified_output_iterator old = *this;
+        ptr_++;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator*() const
+    {
+        return reference{ptr_};
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator[](difference_type distance) const
+    {
+        return reference{ptr_ + distance};
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_output_iterator operator+(difference_type distance) const
+    {
+        return cache_modified_output_iterator(ptr_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_output_iterator& operator+=(difference_type distance)
+    {
+        ptr_ += distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_output_iterator operator-(difference_type distance) const
+    {
+        return cache_modified_output_iterator(ptr_ - distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_output_iterator& operator-=(difference_type distance)
+    {
+        ptr_ -= distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    difference_type operator-(cache_modified_output_iterator other) const
+    {
+        return ptr_ - other.ptr_;
+    }
+
+private:
+    T* ptr_;
+};
+
+// Only pointers to values can be wrapped, rocprim::empty_type* stands for a missing range
+template<class Iterator>
+struct is_cache_modifiable : std::false_type
+{};
+
+template<class T>
+struct is_cache_modifiable<T*>
+    : std::integral_constant<bool,
+                             !std::is_same<typename std::remove_cv<T>::type, empty_type>::value>
+{};
+
+// Wraps the pointers in cache-modified iterators if the modifier is not the default one,
+// other iterators are returned unchanged.
+template<cache_load_modifier Modifier, class InputIterator>
+ROCPRIM_HOST_DEVICE inline
+auto make_cache_modified_input_iterator(InputIterator input)
+    -> typename std::enable_if<
+        Modifier == load_default || !is_cache_modifiable<InputIterator>::value,
+        InputIterator
+    >::type
+{
+    return input;
+}
+
+template<cache_load_modifier Modifier, class InputIterator>
+ROCPRIM_HOST_DEVICE inline
+auto make_cache_modified_input_iterator(InputIterator input)
+    -> typename std::enable_if<
+        Modifier != load_default && is_cache_modifiable<InputIterator>::value,
+        cache_modified_input_iterator<typename std::remove_pointer<InputIterator>::type, Modifier>
+    >::type
+{
+    using T = typename std::remove_pointer<InputIterator>::type;
+    return cache_modified_input_iterator<T, Modifier>(input);
+}
+
+template<cache_store_modifier Modifier, class OutputIterator>
+ROCPRIM_HOST_DEVICE inline
+auto make_cache_modified_output_iterator(OutputIterator output)
+    -> typename std::enable_if<
+        Modifier == store_default || !is_cache_modifiable<OutputIterator>::value,
+        OutputIterator
+    >::type
+{
+    return output;
+}
+
+template<cache_store_modifier Modifier, class OutputIterator>
+ROCPRIM_HOST_DEVICE inline
+auto make_cache_modified_output_iterator(OutputIterator output)
+    -> typename std::enable_if<
+        Modifier != store_default && is_cache_modifiable<OutputIterator>::value,
+        cache_modified_output_iterator<typename std::remove_pointer<OutputIterator>::type, Modifier>
+    >::type
+{
+    using T = typename std::remove_pointer<OutputIterator>::type;
+    return cache_modified_output_iterator<T, Modifier>(output);
+}
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_ITERATOR_DETAIL_CACHE_MODIFIED_ITERATOR_HPP_
@@ -0,0 +1,252 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_ITERATOR_DICTIONARY_ITERATOR_HPP_
+#define ROCPRIM_ITERATOR_DICTIONARY_ITERATOR_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+
+/// \addtogroup iteratormodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \class dictionary_iterator
+/// \brief A random-access input (read-only) iterator over dictionary-encoded values.
+///
+/// \par Overview
+/// * The values are stored as an array of codes, which are indices into a dictionary of the
+/// distinct values. Dereferencing the iterator at \p i returns <tt>dictionary[codes[i]]</tt>.
+/// * Passing the iterator as the input of a device-level algorithm decodes the values while
+/// they are loaded, so the decoded values are never written to global memory.
+/// * In custom kernels \p block_dictionary copies the dictionary to shared memory once per
+/// block, when it fits, and returns an iterator which resolves the codes in shared memory.
+///
+/// \tparam DictionaryIterator - a random-access iterator over the dictionary.
+/// \tparam CodeIterator - a random-access iterator over the codes, the type of the codes
+/// must be integral.
+template<class DictionaryIterator, class CodeIterator>
+class dictionary_iterator
+{
+    using code_type = typename std::iterator_traits<CodeIterator>::value_type;
+    static_assert(std::is_integral<code_type>::value, "The codes must be of an integral type");
+
+public:
+    /// The type of the value that can be obtained by dereferencing the iterator.
+    using value_type = typename std::iterator_traits<DictionaryIterator>::value_type;
+    /// \brief A reference type of the type iterated over (\p value_type).
+    /// It's \p value_type since the values are looked up on every access.
+    using reference = value_type;
+    /// \brief A pointer type of the type iterated over (\p value_type).
+    using pointer = const value_type*;
+    /// A type used for identify distance between iterators.
+    using difference_type = typename std::iterator_traits<CodeIterator>::difference_type;
+    /// The category of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+
+    /// \brief Creates a new dictionary_iterator.
+    ///
+    /// \param dictionary - iterator at the first value of the dictionary.
+    /// \param dictionary_size - the number of values in the dictionary.
+    /// \param codes - iterator at the code of the element the iterator points to.
+    ROCPRIM_HOST_DEVICE inline
+    dictionary_iterator(DictionaryIterator dictionary,
+                        unsigned int       dictionary_size,
+                        CodeIterator       codes)
+        : dictionary_(dictionary), dictionary_size_(dictionary_size), codes_(codes)
+    {
+    }
+
+    /// \brief Returns the iterator over the dictionary.
+    ROCPRIM_HOST_DEVICE inline
+    DictionaryIterator dictionary() const
+    {
+        return dictionary_;
+    }
+
+    /// \brief Returns the number of values in the dictionary.
+    ROCPRIM_HOST_DEVICE inline
+    unsigned int dictionary_size() const
+    {
+        return dictionary_size_;
+    }
+
+    /// \brief Returns the iterator at the code of the element the iterator points to.
+    ROCPRIM_HOST_DEVICE inline
+    CodeIterator codes() const
+    {
+        return codes_;
+    }
+
+    //! \skip_doxy_start
+    ROCPRIM_HOST_DEVICE inline
+    dictionary_iterator& operator++()
+    {
+        codes_++;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    dictionary_iterator operator++(int)
+    {
+        dictionary_iterator old = *this;
+        codes_++;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    dictionary_iterator& operator--()
+    {
+        codes_--;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    dictionary_iterator operator--(int)
+    {
+        dictionary_iterator old = *this;
+        codes_--;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    value_type operator*() const
+    {
+        return dictionary_[static_cast<difference_type>(*codes_)];
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    value_type operator[](difference_type distance) const
+    {
+        return dictionary_[static_cast<difference_type>(codes_[distance])];
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    dictionary_iterator operator+(difference_type distance) const
+    {
+        return dictionary_iterator(dictionary_, dictionary_size_, codes_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    dictionary_iterator& operator+=(difference_type distance)
+    {
+        codes_ += distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    dictionary_iterator operator-(difference_type distance) const
+    {
+        return dictionary_iterator(dictionary_, dictionary_size_, codes_ - distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    dictionary_iterator& operator-=(difference_type distance)
+    {
+        codes_ -= distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    difference_type operator-(dictionary_iterator other) const
+    {
+        return codes_ - other.codes_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator==(dictionary_iterator other) const
+    {
+        return codes_ == other.codes_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator!=(dictionary_iterator other) const
+    {
+        return codes_ != other.codes_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<(dictionary_iterator other) const
+    {
+        return codes_ < other.codes_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<=(dictionary_iterator other) const
+    {
+        return codes_ <= other.codes_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>(dictionary_iterator other) const
+    {
+        return codes_ > other.codes_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>=(dictionary_iterator other) const
+    {
+        return codes_ >= other.codes_;
+    }
+    //! \skip_doxy_end
+
+private:
+    DictionaryIterator dictionary_;
+    unsigned int       dictionary_size_;
+    CodeIterator       codes_;
+};
+
+template<class DictionaryIterator, class CodeIterator>
+ROCPRIM_HOST_DEVICE inline
+dictionary_iterator<DictionaryIterator, CodeIterator>
+operator+(typename dictionary_iterator<DictionaryIterator, CodeIterator>::difference_type distance,
+          const dictionary_iterator<DictionaryIterator, CodeIterator>&                    iterator)
+{
+    return iterator + distance;
+}
+
+/// make_dictionary_iterator creates a \p dictionary_iterator over dictionary-encoded values.
+///
+/// \param dictionary - iterator at the first value of the dictionary.
+/// \param dictionary_size - the number of values in the dictionary.
+/// \param codes - iterator at the first code.
+/// \return A \p dictionary_iterator at the first element.
+template<class DictionaryIterator, class CodeIterator>
+ROCPRIM_HOST_DEVICE inline
+dictionary_iterator<DictionaryIterator, CodeIterator>
+make_dictionary_iterator(DictionaryIterator dictionary,
+                         unsigned int       dictionary_size,
+                         CodeIterator       codes)
+{
+    return dictionary_iterator<DictionaryIterator, CodeIterator>(dictionary,
+                                                                 dictionary_size,
+                                                                 codes);
+}
+
+/// @}
+// end of group iteratormodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_ITERATOR_DICTIONARY_ITERATOR_HPP_
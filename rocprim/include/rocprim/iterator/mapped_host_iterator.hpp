@@ -0,0 +1,259 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_ITERATOR_MAPPED_HOST_ITERATOR_HPP_
+#define ROCPRIM_ITERATOR_MAPPED_HOST_ITERATOR_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+
+/// \addtogroup iteratormodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \class mapped_host_iterator
+/// \brief A random-access iterator over host memory which is accessed by the device in place,
+/// without copying it to device memory first.
+///
+/// \par Overview
+/// * A mapped_host_iterator wraps the device pointer of pinned host memory allocated with
+/// \p hipHostMallocMapped (or registered with \p hipHostRegisterMapped), or a pointer to
+/// managed memory allocated with \p hipMallocManaged. It is created for pinned memory by
+/// \p make_mapped_host_iterator(), which queries the device pointer.
+/// * Reads of pinned memory cross the PCIe or xGMI link, which is efficient only for wide
+/// accesses of consecutive addresses. \p transform loads and stores full blocks through the
+/// iterator with 16-byte vector accesses as it does for pointers, other algorithms access the
+/// elements as through a pointer.
+/// * Managed memory is migrated to the device on first touch one page at a time, \p prefetch()
+/// migrates a range of elements in bulk before the algorithm reads it. A prefetch enqueued to
+/// another stream overlaps with the work of the stream reading the data when the ranges are
+/// prefetched in the order they are processed.
+/// * The data is read once per algorithm, in-place accesses are faster than a copy followed by
+/// the algorithm only when the algorithm reads each element once.
+///
+/// \tparam T - type of the elements, \p const for read-only access.
+template<class T>
+class mapped_host_iterator
+{
+public:
+    /// The type of the value that can be obtained by dereferencing the iterator.
+    using value_type = typename std::remove_cv<T>::type;
+    /// \brief A reference type of the type iterated over (\p value_type).
+    using reference = T&;
+    /// \brief A pointer type of the type iterated over (\p value_type).
+    using pointer = T*;
+    /// A type used for identify distance between iterators.
+    using difference_type = std::ptrdiff_t;
+    /// The category of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+
+    /// \brief Creates a new mapped_host_iterator.
+    ///
+    /// \param ptr - the pointer to the first element which is valid on the device: the
+    /// device pointer of mapped pinned memory, or a pointer to managed memory.
+    ROCPRIM_HOST_DEVICE inline
+    explicit mapped_host_iterator(T* ptr = nullptr) : ptr_(ptr) {}
+
+    /// \brief Returns the wrapped device pointer.
+    ROCPRIM_HOST_DEVICE inline
+    T* base() const
+    {
+        return ptr_;
+    }
+
+    /// \brief Migrates elements of managed memory to a device.
+    ///
+    /// \param [in] size - the number of elements to prefetch, starting at the current position.
+    /// \param [in] device - the device to migrate the elements to.
+    /// \param [in] stream - [optional] the stream to enqueue the prefetch to. Default is \p 0
+    /// (default stream).
+    ///
+    /// \returns \p hipSuccess (\p 0) after a successful operation, otherwise the error of
+    /// \p hipMemPrefetchAsync, for example when the memory is not managed.
+    inline
+    hipError_t prefetch(size_t size, int device, hipStream_t stream = 0) const
+    {
+        if(size == 0)
+        {
+            return hipSuccess;
+        }
+        return hipMemPrefetchAsync(ptr_, size * sizeof(T), device, stream);
+    }
+
+    //! \skip_doxy_start
+    ROCPRIM_HOST_DEVICE inline
+    mapped_host_iterator& operator++()
+    {
+        ptr_++;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    mapped_host_iterator operator++(int)
+    {
+        mapped_host_iterator old = *this;
+        ptr_++;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    mapped_host_iterator& operator--()
+    {
+        ptr_--;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    mapped_host_iterator operator--(int)
+    {
+        mapped_host_iterator old = *this;
+        ptr_--;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator*() const
+    {
+        return *ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator[](difference_type distance) const
+    {
+        return ptr_[distance];
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    mapped_host_iterator operator+(difference_type distance) const
+    {
+        return mapped_host_iterator(ptr_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    mapped_host_iterator& operator+=(difference_type distance)
+    {
+        ptr_ += distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    mapped_host_iterator operator-(difference_type distance) const
+    {
+        return mapped_host_iterator(ptr_ - distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    mapped_host_iterator& operator-=(difference_type distance)
+    {
+        ptr_ -= distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    difference_type operator-(mapped_host_iterator other) const
+    {
+        return ptr_ - other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator==(mapped_host_iterator other) const
+    {
+        return ptr_ == other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator!=(mapped_host_iterator other) const
+    {
+        return ptr_ != other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<(mapped_host_iterator other) const
+    {
+        return ptr_ < other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<=(mapped_host_iterator other) const
+    {
+        return ptr_ <= other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>(mapped_host_iterator other) const
+    {
+        return ptr_ > other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>=(mapped_host_iterator other) const
+    {
+        return ptr_ >= other.ptr_;
+    }
+    //! \skip_doxy_end
+
+private:
+    T* ptr_;
+};
+
+template<class T>
+ROCPRIM_HOST_DEVICE inline
+mapped_host_iterator<T>
+operator+(typename mapped_host_iterator<T>::difference_type distance,
+          const mapped_host_iterator<T>&                    iterator)
+{
+    return iterator + distance;
+}
+
+/// \brief Creates a \p mapped_host_iterator over mapped pinned host memory.
+///
+/// \tparam T - [inferred] type of the elements.
+///
+/// \param [in] host_ptr - pointer to pinned host memory allocated with \p hipHostMallocMapped,
+/// or registered with \p hipHostRegisterMapped.
+/// \param [out] iterator - the iterator over the device pointer of \p host_ptr.
+///
+/// \returns \p hipSuccess (\p 0) after a successful operation, otherwise the error of
+/// \p hipHostGetDevicePointer, for example when the memory is not mapped.
+template<class T>
+inline
+hipError_t make_mapped_host_iterator(T* host_ptr, mapped_host_iterator<T>& iterator)
+{
+    void* device_ptr = nullptr;
+    const hipError_t error = hipHostGetDevicePointer(
+        &device_ptr, const_cast<typename std::remove_cv<T>::type*>(host_ptr), 0);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+    iterator = mapped_host_iterator<T>(static_cast<T*>(device_ptr));
+    return hipSuccess;
+}
+
+/// @}
+// end of group iteratormodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_ITERATOR_MAPPED_HOST_ITERATOR_HPP_
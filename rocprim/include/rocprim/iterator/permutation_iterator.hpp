@@ -0,0 +1,275 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_ITERATOR_PERMUTATION_ITERATOR_HPP_
+#define ROCPRIM_ITERATOR_PERMUTATION_ITERATOR_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+
+/// \addtogroup iteratormodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \class permutation_iterator
+/// \brief A random-access iterator adaptor which accesses a range in the order given by a range
+/// of indices.
+///
+/// \par Overview
+/// * Dereferencing the iterator at position \p i accesses <tt>values[indices[i]]</tt>, so reading
+/// through it gathers the values and writing through it scatters them.
+/// * The gathers of sorted indices, for example the values of <tt>radix_sort_pairs</tt> which are
+/// sorted by the original positions, do not need an intermediate range of indices read by
+/// a \p transform_iterator.
+/// * When \p IndexIterator is a pointer, \p block_load and \p block_store with the vectorized
+/// methods (\p block_load_vectorize and \p block_store_vectorize), and \p transform for full
+/// blocks, read the indices as vectors and only the gathers and the scatters access single
+/// items.
+///
+/// \tparam ValueIterator - type of the random-access iterator of the values.
+/// \tparam IndexIterator - type of the random-access iterator of the indices. Its value type
+/// must be an integral type.
+template<class ValueIterator, class IndexIterator>
+class permutation_iterator
+{
+public:
+    static_assert(
+        std::is_integral<typename std::iterator_traits<IndexIterator>::value_type>::value,
+        "The value type of IndexIterator must be an integral type");
+
+    /// The type of the value that can be obtained by dereferencing the iterator.
+    using value_type = typename std::iterator_traits<ValueIterator>::value_type;
+    /// \brief A reference type of the type iterated over (\p value_type).
+    using reference = typename std::iterator_traits<ValueIterator>::reference;
+    /// \brief A pointer type of the type iterated over (\p value_type).
+    using pointer = typename std::iterator_traits<ValueIterator>::pointer;
+    /// A type used for identify distance between iterators.
+    using difference_type = typename std::iterator_traits<IndexIterator>::difference_type;
+    /// The category of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+    /// The type of the indices.
+    using index_type = typename std::iterator_traits<IndexIterator>::value_type;
+
+    /// \brief Creates a new permutation_iterator.
+    ///
+    /// \param values - the iterator of the values, the indices are relative to it.
+    /// \param indices - the iterator of the indices, its position is the position of the
+    /// new iterator.
+    ROCPRIM_HOST_DEVICE inline
+    permutation_iterator(ValueIterator values, IndexIterator indices)
+        : values_(values), indices_(indices)
+    {
+    }
+
+    /// \brief Returns the iterator of the values.
+    ROCPRIM_HOST_DEVICE inline
+    ValueIterator values() const
+    {
+        return values_;
+    }
+
+    /// \brief Returns the iterator of the indices at the current position.
+    ROCPRIM_HOST_DEVICE inline
+    IndexIterator indices() const
+    {
+        return indices_;
+    }
+
+    //! \skip_doxy_start
+    ROCPRIM_HOST_DEVICE inline
+    permutation_iterator& operator++()
+    {
+        ++indices_;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    permutation_iterator operator++(int)
+    {
+        permutation_iterator old = *this;
+        ++indices_;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    permutation_iterator& operator--()
+    {
+        --indices_;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    permutation_iterator operator--(int)
+    {
+        permutation_iterator old = *this;
+        --indices_;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator*() const
+    {
+        return values_[*indices_];
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator[](difference_type distance) const
+    {
+        return values_[indices_[distance]];
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    permutation_iterator operator+(difference_type distance) const
+    {
+        return permutation_iterator(values_, indices_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    permutation_iterator& operator+=(difference_type distance)
+    {
+        indices_ += distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    permutation_iterator operator-(difference_type distance) const
+    {
+        return permutation_iterator(values_, indices_ - distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    permutation_iterator& operator-=(difference_type distance)
+    {
+        indices_ -= distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    difference_type operator-(permutation_iterator other) const
+    {
+        return indices_ - other.indices_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator==(permutation_iterator other) const
+    {
+        return indices_ == other.indices_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator!=(permutation_iterator other) const
+    {
+        return indices_ != other.indices_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<(permutation_iterator other) const
+    {
+        return indices_ < other.indices_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<=(permutation_iterator other) const
+    {
+        return indices_ <= other.indices_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>(permutation_iterator other) const
+    {
+        return indices_ > other.indices_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>=(permutation_iterator other) const
+    {
+        return indices_ >= other.indices_;
+    }
+    //! \skip_doxy_end
+
+private:
+    ValueIterator values_;
+    IndexIterator indices_;
+};
+
+template<class ValueIterator, class IndexIterator>
+ROCPRIM_HOST_DEVICE inline
+permutation_iterator<ValueIterator, IndexIterator>
+operator+(typename permutation_iterator<ValueIterator, IndexIterator>::difference_type distance,
+          const permutation_iterator<ValueIterator, IndexIterator>& iterator)
+{
+    return iterator + distance;
+}
+
+/// \brief An output iterator adaptor which scatters the values written through it to the
+/// positions given by a range of indices.
+///
+/// It is a \p permutation_iterator, writing through it at position \p i stores to
+/// <tt>output[indices[i]]</tt>.
+///
+/// \tparam OutputIterator - type of the random-access iterator of the output.
+/// \tparam IndexIterator - type of the random-access iterator of the indices.
+template<class OutputIterator, class IndexIterator>
+using scatter_iterator = permutation_iterator<OutputIterator, IndexIterator>;
+
+/// make_permutation_iterator creates a \p permutation_iterator which gathers the values of
+/// \p values in the order of \p indices.
+///
+/// \tparam ValueIterator - type of \p values.
+/// \tparam IndexIterator - type of \p indices.
+///
+/// \param values - the iterator of the values.
+/// \param indices - the iterator of the indices.
+/// \return A \p permutation_iterator accessing <tt>values[indices[i]]</tt> at position \p i.
+template<class ValueIterator, class IndexIterator>
+ROCPRIM_HOST_DEVICE inline
+permutation_iterator<ValueIterator, IndexIterator>
+make_permutation_iterator(ValueIterator values, IndexIterator indices)
+{
+    return permutation_iterator<ValueIterator, IndexIterator>(values, indices);
+}
+
+/// make_scatter_iterator creates a \p scatter_iterator which stores the values written through
+/// it to \p output at the positions given by \p indices.
+///
+/// \tparam OutputIterator - type of \p output.
+/// \tparam IndexIterator - type of \p indices.
+///
+/// \param output - the iterator of the output.
+/// \param indices - the iterator of the indices.
+/// \return A \p scatter_iterator accessing <tt>output[indices[i]]</tt> at position \p i.
+template<class OutputIterator, class IndexIterator>
+ROCPRIM_HOST_DEVICE inline
+scatter_iterator<OutputIterator, IndexIterator>
+make_scatter_iterator(OutputIterator output, IndexIterator indices)
+{
+    return scatter_iterator<OutputIterator, IndexIterator>(output, indices);
+}
+
+/// @}
+// end of group iteratormodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_ITERATOR_PERMUTATION_ITERATOR_HPP_
@@ -0,0 +1,271 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_ITERATOR_PITCHED_2D_ITERATOR_HPP_
+#define ROCPRIM_ITERATOR_PITCHED_2D_ITERATOR_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+
+/// \addtogroup iteratormodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \class pitched_2d_iterator
+/// \brief A random-access iterator over the rows of a pitched 2D allocation, as returned by
+/// \p hipMallocPitch.
+///
+/// \par Overview
+/// * The elements are iterated in row-major order: position \p i accesses the element
+/// <tt>i % width</tt> of row <tt>i / width</tt>, the rows start \p pitch bytes apart. The
+/// padding at the end of the rows is skipped.
+/// * Striped loads (\p block_load_direct_striped and the \p block_load_transpose method of
+/// \p block_load) advance the row and the column of each thread incrementally, so the items
+/// of a row are accessed contiguously without a division for every item.
+///
+/// \tparam T - type of the elements, \p const for read-only access.
+template<class T>
+class pitched_2d_iterator
+{
+    using byte_type = typename std::conditional<std::is_const<T>::value, const char, char>::type;
+
+public:
+    /// The type of the value that can be obtained by dereferencing the iterator.
+    using value_type = typename std::remove_cv<T>::type;
+    /// \brief A reference type of the type iterated over (\p value_type).
+    using reference = T&;
+    /// \brief A pointer type of the type iterated over (\p value_type).
+    using pointer = T*;
+    /// A type used for identify distance between iterators.
+    using difference_type = std::ptrdiff_t;
+    /// The category of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+
+    /// \brief Creates a new pitched_2d_iterator.
+    ///
+    /// \param base - pointer to the first element of the first row.
+    /// \param pitch - the distance of the starts of two consecutive rows in bytes. It must be
+    /// a multiple of the alignment of \p T.
+    /// \param width - the number of elements of a row, at least 1.
+    /// \param index - [optional] the linear position of the new iterator. Default is \p 0.
+    ROCPRIM_HOST_DEVICE inline
+    pitched_2d_iterator(T* base, size_t pitch, size_t width, difference_type index = 0)
+        : base_(base), pitch_(pitch), width_(width), index_(index)
+    {
+    }
+
+    /// \brief Returns the pointer to the first element of the first row.
+    ROCPRIM_HOST_DEVICE inline
+    T* base() const
+    {
+        return base_;
+    }
+
+    /// \brief Returns the distance of the rows in bytes.
+    ROCPRIM_HOST_DEVICE inline
+    size_t pitch() const
+    {
+        return pitch_;
+    }
+
+    /// \brief Returns the number of elements of a row.
+    ROCPRIM_HOST_DEVICE inline
+    size_t width() const
+    {
+        return width_;
+    }
+
+    /// \brief Returns the linear position of the iterator.
+    ROCPRIM_HOST_DEVICE inline
+    difference_type index() const
+    {
+        return index_;
+    }
+
+    /// \brief Returns the pointer to the first element of a row.
+    ///
+    /// \param row - the index of the row.
+    ROCPRIM_HOST_DEVICE inline
+    T* row(size_t row) const
+    {
+        return reinterpret_cast<T*>(reinterpret_cast<byte_type*>(base_) + row * pitch_);
+    }
+
+    //! \skip_doxy_start
+    ROCPRIM_HOST_DEVICE inline
+    pitched_2d_iterator& operator++()
+    {
+        ++index_;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    pitched_2d_iterator operator++(int)
+    {
+        pitched_2d_iterator old = *this;
+        ++index_;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    pitched_2d_iterator& operator--()
+    {
+        --index_;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    pitched_2d_iterator operator--(int)
+    {
+        pitched_2d_iterator old = *this;
+        --index_;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator*() const
+    {
+        return element(static_cast<size_t>(index_));
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator[](difference_type distance) const
+    {
+        return element(static_cast<size_t>(index_ + distance));
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    pitched_2d_iterator operator+(difference_type distance) const
+    {
+        return pitched_2d_iterator(base_, pitch_, width_, index_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    pitched_2d_iterator& operator+=(difference_type distance)
+    {
+        index_ += distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    pitched_2d_iterator operator-(difference_type distance) const
+    {
+        return pitched_2d_iterator(base_, pitch_, width_, index_ - distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    pitched_2d_iterator& operator-=(difference_type distance)
+    {
+        index_ -= distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    difference_type operator-(pitched_2d_iterator other) const
+    {
+        return index_ - other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator==(pitched_2d_iterator other) const
+    {
+        return index_ == other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator!=(pitched_2d_iterator other) const
+    {
+        return index_ != other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<(pitched_2d_iterator other) const
+    {
+        return index_ < other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<=(pitched_2d_iterator other) const
+    {
+        return index_ <= other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>(pitched_2d_iterator other) const
+    {
+        return index_ > other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>=(pitched_2d_iterator other) const
+    {
+        return index_ >= other.index_;
+    }
+    //! \skip_doxy_end
+
+private:
+    ROCPRIM_HOST_DEVICE inline
+    reference element(size_t index) const
+    {
+        const size_t row_index = index / width_;
+        return row(row_index)[index - row_index * width_];
+    }
+
+    T*              base_;
+    size_t          pitch_;
+    size_t          width_;
+    difference_type index_;
+};
+
+template<class T>
+ROCPRIM_HOST_DEVICE inline
+pitched_2d_iterator<T>
+operator+(typename pitched_2d_iterator<T>::difference_type distance,
+          const pitched_2d_iterator<T>&                    iterator)
+{
+    return iterator + distance;
+}
+
+/// make_pitched_2d_iterator creates a \p pitched_2d_iterator over the rows of a pitched 2D
+/// allocation.
+///
+/// \tparam T - [inferred] type of the elements.
+///
+/// \param base - pointer to the first element of the first row.
+/// \param pitch - the distance of the starts of two consecutive rows in bytes.
+/// \param width - the number of elements of a row.
+/// \return A \p pitched_2d_iterator at the first element of the first row.
+template<class T>
+ROCPRIM_HOST_DEVICE inline
+pitched_2d_iterator<T> make_pitched_2d_iterator(T* base, size_t pitch, size_t width)
+{
+    return pitched_2d_iterator<T>(base, pitch, width);
+}
+
+/// @}
+// end of group iteratormodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_ITERATOR_PITCHED_2D_ITERATOR_HPP_
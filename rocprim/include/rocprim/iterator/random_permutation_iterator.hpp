@@ -0,0 +1,357 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_ITERATOR_RANDOM_PERMUTATION_ITERATOR_HPP_
+#define ROCPRIM_ITERATOR_RANDOM_PERMUTATION_ITERATOR_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+
+#include "permutation_iterator.hpp"
+
+/// \addtogroup iteratormodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// A pseudo-random bijection of [0, size) computed by a balanced Feistel network over the
+// smallest domain of an even number of bits containing [0, size). The indices mapped outside of
+// [0, size) are mapped again (cycle walking). The domain is less than 4 times larger than the
+// range, so an index takes at most 4 evaluations on average.
+class feistel_bijection
+{
+public:
+    static constexpr unsigned int rounds = 4;
+
+    ROCPRIM_HOST_DEVICE inline
+    feistel_bijection() = default;
+
+    ROCPRIM_HOST_DEVICE inline
+    feistel_bijection(const unsigned long long size, unsigned long long seed) : size_(size)
+    {
+        half_bits_ = 1;
+        while(half_bits_ < 32 && (1ull << (2 * half_bits_)) < size)
+        {
+            half_bits_++;
+        }
+        // splitmix64 expands the seed to the keys of the rounds
+        for(unsigned int round = 0; round < rounds; round++)
+        {
+            seed += 0x9E3779B97F4A7C15ull;
+            keys_[round] = mix(seed);
+        }
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    unsigned long long operator()(unsigned long long index) const
+    {
+        do
+        {
+            index = permute(index);
+        }
+        while(index >= size_);
+        return index;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    unsigned long long size() const
+    {
+        return size_;
+    }
+
+private:
+    // The finalizer of MurmurHash3, every bit of the result depends on every bit of the value
+    ROCPRIM_HOST_DEVICE inline
+    static unsigned long long mix(unsigned long long value)
+    {
+        value ^= value >> 33;
+        value *= 0xFF51AFD7ED558CCDull;
+        value ^= value >> 33;
+        value *= 0xC4CEB9FE1A85EC53ull;
+        value ^= value >> 33;
+        return value;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    unsigned long long permute(const unsigned long long index) const
+    {
+        const unsigned long long mask = (1ull << half_bits_) - 1;
+
+        unsigned long long left  = index >> half_bits_;
+        unsigned long long right = index & mask;
+        for(unsigned int round = 0; round < rounds; round++)
+        {
+            const unsigned long long next_right = left ^ (mix(right ^ keys_[round]) & mask);
+            left                                = right;
+            right                               = next_right;
+        }
+        return (left << half_bits_) | right;
+    }
+
+    unsigned long long size_;
+    unsigned int       half_bits_;
+    unsigned long long keys_[rounds];
+};
+
+} // end of detail namespace
+
+/// \class random_permutation_iterator
+/// \brief A random-access input (read-only) iterator over a pseudo-random permutation of the
+/// indices <tt>[0, size)</tt>.
+///
+/// \par Overview
+/// * Dereferencing the iterator at position \p i computes the index at position \p i of the
+/// permutation from \p i alone with a Feistel network keyed by the seed, so the permutation is
+/// never stored and every position is computed independently.
+/// * The permutation is fully defined by \p size and \p seed. Iterators with the same size and
+/// seed produce the same permutation, different seeds produce unrelated permutations.
+/// * The positions must be in <tt>[0, size)</tt>, the permutation is not defined outside.
+/// * The permutation is intended for sampling and load balancing, it is not cryptographically
+/// secure.
+///
+/// \tparam Index - integral type of the indices. It must be able to represent <tt>size - 1</tt>.
+/// \tparam Difference - a type used for identify distance between iterators.
+template<class Index = size_t, class Difference = std::ptrdiff_t>
+class random_permutation_iterator
+{
+public:
+    static_assert(std::is_integral<Index>::value, "Index must be an integral type");
+
+    /// The type of the value that can be obtained by dereferencing the iterator.
+    using value_type = Index;
+    /// \brief A reference type of the type iterated over (\p value_type).
+    /// It's same as `value_type` since random_permutation_iterator is a read-only iterator.
+    using reference = value_type;
+    /// \brief A pointer type of the type iterated over (\p value_type).
+    using pointer = const value_type*;
+    /// A type used for identify distance between iterators.
+    using difference_type = Difference;
+    /// The category of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+
+    ROCPRIM_HOST_DEVICE inline
+    random_permutation_iterator() = default;
+
+    /// \brief Creates a new random_permutation_iterator at position \p position of the
+    /// permutation of <tt>[0, size)</tt> seeded by \p seed.
+    ///
+    /// \param size - the number of indices of the permutation.
+    /// \param seed - the seed of the permutation.
+    /// \param position - the position of the new iterator.
+    ROCPRIM_HOST_DEVICE inline
+    random_permutation_iterator(const size_t             size,
+                                const unsigned long long seed,
+                                const difference_type    position = 0)
+        : bijection_(size, seed), position_(position)
+    {
+    }
+
+    /// \brief Returns the current position of the iterator.
+    ROCPRIM_HOST_DEVICE inline
+    difference_type position() const
+    {
+        return position_;
+    }
+
+    //! \skip_doxy_start
+    ROCPRIM_HOST_DEVICE inline
+    random_permutation_iterator& operator++()
+    {
+        ++position_;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    random_permutation_iterator operator++(int)
+    {
+        random_permutation_iterator old = *this;
+        ++position_;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    random_permutation_iterator& operator--()
+    {
+        --position_;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    random_permutation_iterator operator--(int)
+    {
+        random_permutation_iterator old = *this;
+        --position_;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    value_type operator*() const
+    {
+        return static_cast<value_type>(bijection_(static_cast<unsigned long long>(position_)));
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    value_type operator[](difference_type distance) const
+    {
+        return static_cast<value_type>(
+            bijection_(static_cast<unsigned long long>(position_ + distance)));
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    random_permutation_iterator operator+(difference_type distance) const
+    {
+        random_permutation_iterator result = *this;
+        result.position_ += distance;
+        return result;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    random_permutation_iterator& operator+=(difference_type distance)
+    {
+        position_ += distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    random_permutation_iterator operator-(difference_type distance) const
+    {
+        random_permutation_iterator result = *this;
+        result.position_ -= distance;
+        return result;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    random_permutation_iterator& operator-=(difference_type distance)
+    {
+        position_ -= distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    difference_type operator-(random_permutation_iterator other) const
+    {
+        return position_ - other.position_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator==(random_permutation_iterator other) const
+    {
+        return position_ == other.position_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator!=(random_permutation_iterator other) const
+    {
+        return position_ != other.position_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<(random_permutation_iterator other) const
+    {
+        return position_ < other.position_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<=(random_permutation_iterator other) const
+    {
+        return position_ <= other.position_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>(random_permutation_iterator other) const
+    {
+        return position_ > other.position_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>=(random_permutation_iterator other) const
+    {
+        return position_ >= other.position_;
+    }
+    //! \skip_doxy_end
+
+private:
+    detail::feistel_bijection bijection_;
+    difference_type           position_;
+};
+
+template<class Index, class Difference>
+ROCPRIM_HOST_DEVICE inline
+random_permutation_iterator<Index, Difference>
+operator+(typename random_permutation_iterator<Index, Difference>::difference_type distance,
+          const random_permutation_iterator<Index, Difference>& iterator)
+{
+    return iterator + distance;
+}
+
+/// \brief A random-access iterator adaptor which accesses a range in a pseudo-random order.
+///
+/// It is a \p permutation_iterator with the indices of a \p random_permutation_iterator,
+/// reading through it at position \p i reads <tt>values[permutation[i]]</tt>.
+///
+/// \tparam ValueIterator - type of the random-access iterator of the values.
+template<class ValueIterator>
+using shuffle_iterator = permutation_iterator<ValueIterator, random_permutation_iterator<>>;
+
+/// make_random_permutation_iterator creates a \p random_permutation_iterator at the first
+/// position of the permutation of <tt>[0, size)</tt> seeded by \p seed.
+///
+/// \tparam Index - integral type of the indices.
+///
+/// \param size - the number of indices of the permutation.
+/// \param seed - the seed of the permutation.
+/// \return A \p random_permutation_iterator.
+template<class Index = size_t>
+ROCPRIM_HOST_DEVICE inline
+random_permutation_iterator<Index>
+make_random_permutation_iterator(const size_t size, const unsigned long long seed)
+{
+    return random_permutation_iterator<Index>(size, seed);
+}
+
+/// make_shuffle_iterator creates a \p shuffle_iterator which reads the first \p size values of
+/// \p values in the order of the permutation seeded by \p seed.
+///
+/// \tparam ValueIterator - type of \p values.
+///
+/// \param values - the iterator of the values.
+/// \param size - the number of values.
+/// \param seed - the seed of the permutation.
+/// \return A \p shuffle_iterator accessing <tt>values[permutation[i]]</tt> at position \p i.
+template<class ValueIterator>
+ROCPRIM_HOST_DEVICE inline
+shuffle_iterator<ValueIterator>
+make_shuffle_iterator(ValueIterator values, const size_t size, const unsigned long long seed)
+{
+    return shuffle_iterator<ValueIterator>(values, random_permutation_iterator<>(size, seed));
+}
+
+/// @}
+// end of group iteratormodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_ITERATOR_RANDOM_PERMUTATION_ITERATOR_HPP_
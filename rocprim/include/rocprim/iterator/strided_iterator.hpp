@@ -0,0 +1,236 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_ITERATOR_STRIDED_ITERATOR_HPP_
+#define ROCPRIM_ITERATOR_STRIDED_ITERATOR_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+
+/// \addtogroup iteratormodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \class strided_iterator
+/// \brief A random-access iterator adaptor which advances a wrapped iterator by a fixed stride.
+///
+/// \par Overview
+/// * Position \p i of the iterator accesses <tt>base[i * stride]</tt>, for example a column of
+/// a row-major matrix with \p stride columns.
+/// * Unlike a \p transform_iterator over a \p counting_iterator, the contiguity is visible to
+/// the library: \p block_load with \p block_load_transpose loads small strides of pointers as
+/// contiguous tiles through shared memory, and a stride of 1 as the pointer itself.
+///
+/// \tparam Iterator - type of the wrapped random-access iterator.
+template<class Iterator>
+class strided_iterator
+{
+public:
+    static_assert(
+        std::is_base_of<std::random_access_iterator_tag,
+                        typename std::iterator_traits<Iterator>::iterator_category>::value,
+        "Iterator must be a random access iterator");
+
+    /// The type of the value that can be obtained by dereferencing the iterator.
+    using value_type = typename std::iterator_traits<Iterator>::value_type;
+    /// \brief A reference type of the type iterated over (\p value_type).
+    using reference = typename std::iterator_traits<Iterator>::reference;
+    /// \brief A pointer type of the type iterated over (\p value_type).
+    using pointer = typename std::iterator_traits<Iterator>::pointer;
+    /// A type used for identify distance between iterators.
+    using difference_type = typename std::iterator_traits<Iterator>::difference_type;
+    /// The category of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+
+    /// \brief Creates a new strided_iterator.
+    ///
+    /// \param base - the wrapped iterator, the first element of the new iterator.
+    /// \param stride - the distance of two consecutive elements in the wrapped iterator. It must
+    /// be positive.
+    ROCPRIM_HOST_DEVICE inline
+    strided_iterator(Iterator base, difference_type stride) : base_(base), stride_(stride) {}
+
+    /// \brief Returns the wrapped iterator at the current position.
+    ROCPRIM_HOST_DEVICE inline
+    Iterator base() const
+    {
+        return base_;
+    }
+
+    /// \brief Returns the stride.
+    ROCPRIM_HOST_DEVICE inline
+    difference_type stride() const
+    {
+        return stride_;
+    }
+
+    //! \skip_doxy_start
+    ROCPRIM_HOST_DEVICE inline
+    strided_iterator& operator++()
+    {
+        base_ += stride_;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    strided_iterator operator++(int)
+    {
+        strided_iterator old = *this;
+        base_ += stride_;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    strided_iterator& operator--()
+    {
+        base_ -= stride_;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    strided_iterator operator--(int)
+    {
+        strided_iterator old = *this;
+        base_ -= stride_;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator*() const
+    {
+        return *base_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator[](difference_type distance) const
+    {
+        return base_[distance * stride_];
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    strided_iterator operator+(difference_type distance) const
+    {
+        return strided_iterator(base_ + distance * stride_, stride_);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    strided_iterator& operator+=(difference_type distance)
+    {
+        base_ += distance * stride_;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    strided_iterator operator-(difference_type distance) const
+    {
+        return strided_iterator(base_ - distance * stride_, stride_);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    strided_iterator& operator-=(difference_type distance)
+    {
+        base_ -= distance * stride_;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    difference_type operator-(strided_iterator other) const
+    {
+        return (base_ - other.base_) / stride_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator==(strided_iterator other) const
+    {
+        return base_ == other.base_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator!=(strided_iterator other) const
+    {
+        return base_ != other.base_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<(strided_iterator other) const
+    {
+        return base_ < other.base_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<=(strided_iterator other) const
+    {
+        return base_ <= other.base_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>(strided_iterator other) const
+    {
+        return base_ > other.base_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>=(strided_iterator other) const
+    {
+        return base_ >= other.base_;
+    }
+    //! \skip_doxy_end
+
+private:
+    Iterator        base_;
+    difference_type stride_;
+};
+
+template<class Iterator>
+ROCPRIM_HOST_DEVICE inline
+strided_iterator<Iterator>
+operator+(typename strided_iterator<Iterator>::difference_type distance,
+          const strided_iterator<Iterator>&                    iterator)
+{
+    return iterator + distance;
+}
+
+/// make_strided_iterator creates a \p strided_iterator which accesses every \p stride -th
+/// element of \p base.
+///
+/// \tparam Iterator - type of \p base.
+///
+/// \param base - the iterator to wrap in the created \p strided_iterator.
+/// \param stride - the distance of two consecutive elements in \p base.
+/// \return A \p strided_iterator accessing <tt>base[i * stride]</tt> at position \p i.
+template<class Iterator>
+ROCPRIM_HOST_DEVICE inline
+strided_iterator<Iterator>
+make_strided_iterator(Iterator base,
+                      typename std::iterator_traits<Iterator>::difference_type stride)
+{
+    return strided_iterator<Iterator>(base, stride);
+}
+
+/// @}
+// end of group iteratormodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_ITERATOR_STRIDED_ITERATOR_HPP_
@@ -0,0 +1,267 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_ITERATOR_TEE_OUTPUT_ITERATOR_HPP_
+#define ROCPRIM_ITERATOR_TEE_OUTPUT_ITERATOR_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+
+/// \addtogroup iteratormodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \class tee_output_iterator
+/// \brief A random-access output (write-only) iterator which stores the values assigned to it
+/// to two underlying output iterators.
+///
+/// \par Overview
+/// * Assigning \p x through the iterator at position \p i stores \p x at position \p i of
+/// both underlying iterators, so an algorithm writes two copies of its output, for example
+/// one of them through a \p transform_output_iterator, without a separate pass.
+/// * The value type of the iterator is \p void, algorithms which deduce the type of their
+/// results from the output, like \p transform, use the type of their operation instead.
+/// Algorithms which require the value type of the output to match their input, like
+/// \p radix_sort_keys, do not accept the iterator.
+/// * When both underlying iterators are pointers (or \p transform_output_iterator over
+/// pointers with trivially copyable functions), \p block_store with \p block_store_vectorize
+/// and \p transform store both copies with vector stores.
+///
+/// \tparam OutputIterator1 - the type of the first underlying output iterator.
+/// \tparam OutputIterator2 - the type of the second underlying output iterator.
+template<class OutputIterator1, class OutputIterator2>
+class tee_output_iterator
+{
+public:
+    /// \brief A proxy returned by dereferencing the iterator, which stores the values assigned
+    /// to it to both underlying iterators.
+    class proxy
+    {
+    public:
+        ROCPRIM_HOST_DEVICE inline
+        proxy(OutputIterator1 first, OutputIterator2 second)
+            : first_(first), second_(second)
+        {
+        }
+
+        template<class U>
+        ROCPRIM_HOST_DEVICE inline
+        proxy& operator=(const U& value)
+        {
+            *first_  = value;
+            *second_ = value;
+            return *this;
+        }
+
+    private:
+        OutputIterator1 first_;
+        OutputIterator2 second_;
+    };
+
+    /// The type of the value that can be obtained by dereferencing the iterator.
+    /// It's \p void since the iterator can only be written to.
+    using value_type = void;
+    /// \brief A reference type of the type iterated over, a proxy which can be assigned to.
+    using reference = proxy;
+    /// \brief A pointer type of the type iterated over (\p value_type).
+    using pointer = void;
+    /// A type used for identify distance between iterators.
+    using difference_type = std::ptrdiff_t;
+    /// The category of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+
+    /// \brief Creates a new tee_output_iterator.
+    ///
+    /// \param first - the first underlying output iterator.
+    /// \param second - the second underlying output iterator.
+    ROCPRIM_HOST_DEVICE inline
+    tee_output_iterator(OutputIterator1 first, OutputIterator2 second)
+        : first_(first), second_(second)
+    {
+    }
+
+    /// \brief Returns the first underlying output iterator.
+    ROCPRIM_HOST_DEVICE inline
+    OutputIterator1 first() const
+    {
+        return first_;
+    }
+
+    /// \brief Returns the second underlying output iterator.
+    ROCPRIM_HOST_DEVICE inline
+    OutputIterator2 second() const
+    {
+        return second_;
+    }
+
+    //! \skip_doxy_start
+    ROCPRIM_HOST_DEVICE inline
+    tee_output_iterator& operator++()
+    {
+        first_++;
+        second_++;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    tee_output_iterator operator++(int)
+    {
+        tee_output_iterator old = *this;
+        ++(*this);
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    tee_output_iterator& operator--()
+    {
+        first_--;
+        second_--;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    tee_output_iterator operator--(int)
+    {
+        tee_output_iterator old = *this;
+        --(*this);
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator*() const
+    {
+        return reference(first_, second_);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator[](difference_type distance) const
+    {
+        return reference(first_ + distance, second_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    tee_output_iterator operator+(difference_type distance) const
+    {
+        return tee_output_iterator(first_ + distance, second_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    tee_output_iterator& operator+=(difference_type distance)
+    {
+        first_ += distance;
+        second_ += distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    tee_output_iterator operator-(difference_type distance) const
+    {
+        return tee_output_iterator(first_ - distance, second_ - distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    tee_output_iterator& operator-=(difference_type distance)
+    {
+        first_ -= distance;
+        second_ -= distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    difference_type operator-(tee_output_iterator other) const
+    {
+        return first_ - other.first_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator==(tee_output_iterator other) const
+    {
+        return first_ == other.first_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator!=(tee_output_iterator other) const
+    {
+        return first_ != other.first_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<(tee_output_iterator other) const
+    {
+        return first_ < other.first_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<=(tee_output_iterator other) const
+    {
+        return first_ <= other.first_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>(tee_output_iterator other) const
+    {
+        return first_ > other.first_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>=(tee_output_iterator other) const
+    {
+        return first_ >= other.first_;
+    }
+    //! \skip_doxy_end
+
+private:
+    OutputIterator1 first_;
+    OutputIterator2 second_;
+};
+
+template<class OutputIterator1, class OutputIterator2>
+ROCPRIM_HOST_DEVICE inline
+tee_output_iterator<OutputIterator1, OutputIterator2>
+operator+(typename tee_output_iterator<OutputIterator1, OutputIterator2>::difference_type distance,
+          const tee_output_iterator<OutputIterator1, OutputIterator2>&                    iterator)
+{
+    return iterator + distance;
+}
+
+/// make_tee_output_iterator creates a \p tee_output_iterator which stores the values assigned
+/// to it to both \p first and \p second.
+///
+/// \param first - the first underlying output iterator.
+/// \param second - the second underlying output iterator.
+/// \return A \p tee_output_iterator at the first elements of \p first and \p second.
+template<class OutputIterator1, class OutputIterator2>
+ROCPRIM_HOST_DEVICE inline
+tee_output_iterator<OutputIterator1, OutputIterator2>
+make_tee_output_iterator(OutputIterator1 first, OutputIterator2 second)
+{
+    return tee_output_iterator<OutputIterator1, OutputIterator2>(first, second);
+}
+
+/// @}
+// end of group iteratormodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_ITERATOR_TEE_OUTPUT_ITERATOR_HPP_
@@ -27,6 +27,7 @@
 
 #include "../config.hpp"
 #include "../detail/various.hpp"
+#include "../thread/thread_load.hpp"
 
 /// \addtogroup iteratormodule
 /// @{
@@ -120,6 +121,10 @@ struct match_texture_type
 /// * Can only be constructed within host functions, and can only be dereferenced within
 /// device functions.
 /// * Accepts any data type from memory, and loads through texture cache.
+/// * Texture objects are only created when \p ROCPRIM_TEXTURE_CACHE_ITERATOR_USE_TEXTURES is
+/// defined to 1. By default the values are loaded by \p thread_load with \p load_ldg, as a
+/// \p cache_modified_input_iterator does, and \p bind_texture() and \p unbind_texture() do
+/// not call the HIP runtime. New code can use \p cache_modified_input_iterator directly.
 ///
 /// \tparam T - type of value that can be obtained by dereferencing the iterator.
 /// \tparam Difference - a type used for identify distance between iterators.
@@ -160,27 +165,37 @@ public:
                             size_t bytes = size_t(-1),
                             size_t texture_offset = 0)
     {
-        this->ptr = const_cast<typename std::remove_cv<Qualified>::type*>(ptr);
+        // ptr points to the current element, texture_offset is its index in the texture
+        value_type* base = const_cast<typename std::remove_cv<Qualified>::type*>(ptr);
+        this->ptr = base + texture_offset;
         this->texture_offset = texture_offset;
-
+#if ROCPRIM_TEXTURE_CACHE_ITERATOR_USE_TEXTURES
         hipChannelFormatDesc channel_desc = hipCreateChannelDesc<texture_type>();
         hipResourceDesc resourse_desc;
         hipTextureDesc texture_desc;
         memset(&resourse_desc, 0, sizeof(hipResourceDesc));
         memset(&texture_desc, 0, sizeof(hipTextureDesc));
         resourse_desc.resType = hipResourceTypeLinear;
-        resourse_desc.res.linear.devPtr = this->ptr;
+        resourse_desc.res.linear.devPtr = base;
         resourse_desc.res.linear.desc = channel_desc;
         resourse_desc.res.linear.sizeInBytes = bytes;
         texture_desc.readMode = hipReadModeElementType;
 
         return hipCreateTextureObject(&texture_object, &resourse_desc, &texture_desc, NULL);
+#else
+        (void)bytes;
+        return hipSuccess;
+#endif
     }
 
     inline
     hipError_t unbind_texture()
     {
+#if ROCPRIM_TEXTURE_CACHE_ITERATOR_USE_TEXTURES
         return hipDestroyTextureObject(texture_object);
+#else
+        return hipSuccess;
+#endif
     }
 
     //! \skip_doxy_start
@@ -205,7 +220,9 @@ public:
     value_type operator*() const
     {
         #ifndef __HIP_DEVICE_COMPILE__
-        return ptr[texture_offset];
+        return *ptr;
+        #elif !ROCPRIM_TEXTURE_CACHE_ITERATOR_USE_TEXTURES
+        return ::rocprim::thread_load<load_ldg>(ptr);
         #else
         texture_type words[multiple];
 
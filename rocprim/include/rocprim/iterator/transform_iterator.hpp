@@ -91,6 +91,20 @@ public:
     {
     }
 
+    /// \brief Returns the underlying input iterator.
+    ROCPRIM_HOST_DEVICE inline
+    InputIterator base() const
+    {
+        return iterator_;
+    }
+
+    /// \brief Returns the function applied to the dereferenced values.
+    ROCPRIM_HOST_DEVICE inline
+    UnaryFunction transform_op() const
+    {
+        return transform_;
+    }
+
     //! \skip_doxy_start
     ROCPRIM_HOST_DEVICE inline
     transform_iterator& operator++()
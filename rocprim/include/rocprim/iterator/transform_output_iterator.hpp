@@ -0,0 +1,265 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_ITERATOR_TRANSFORM_OUTPUT_ITERATOR_HPP_
+#define ROCPRIM_ITERATOR_TRANSFORM_OUTPUT_ITERATOR_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+
+/// \addtogroup iteratormodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \class transform_output_iterator
+/// \brief A random-access output (write-only) iterator which applies a unary function to the
+/// values assigned to it and stores the results to an underlying output iterator.
+///
+/// \par Overview
+/// * Assigning \p x through the iterator at position \p i stores <tt>transform_op(x)</tt> at
+/// position \p i of the underlying iterator, so the outputs of an algorithm can be converted,
+/// clamped or otherwise post-processed without a separate pass.
+/// * The value type of the iterator is \p void, algorithms which deduce the type of their
+/// results from the output, like \p transform, use the type of their operation instead.
+/// Algorithms which require the value type of the output to match their input, like
+/// \p radix_sort_keys, do not accept the iterator.
+/// * When the underlying iterator is a pointer and \p UnaryFunction is trivially copyable,
+/// \p block_store with \p block_store_vectorize and \p transform apply the function in
+/// registers and store the results with vector stores.
+///
+/// \tparam OutputIterator - the type of the underlying output iterator.
+/// \tparam UnaryFunction - the type of the function applied to the assigned values.
+template<class OutputIterator, class UnaryFunction>
+class transform_output_iterator
+{
+public:
+    /// \brief A proxy returned by dereferencing the iterator, which transforms and stores the
+    /// values assigned to it.
+    class proxy
+    {
+    public:
+        ROCPRIM_HOST_DEVICE inline
+        proxy(OutputIterator output, UnaryFunction transform_op)
+            : output_(output), transform_op_(transform_op)
+        {
+        }
+
+        template<class U>
+        ROCPRIM_HOST_DEVICE inline
+        proxy& operator=(const U& value)
+        {
+            *output_ = transform_op_(value);
+            return *this;
+        }
+
+    private:
+        OutputIterator output_;
+        UnaryFunction  transform_op_;
+    };
+
+    /// The type of the value that can be obtained by dereferencing the iterator.
+    /// It's \p void since the iterator can only be written to.
+    using value_type = void;
+    /// \brief A reference type of the type iterated over, a proxy which can be assigned to.
+    using reference = proxy;
+    /// \brief A pointer type of the type iterated over (\p value_type).
+    using pointer = void;
+    /// A type used for identify distance between iterators.
+    using difference_type = typename std::iterator_traits<OutputIterator>::difference_type;
+    /// The category of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+    /// The type of the function applied to the assigned values.
+    using unary_function = UnaryFunction;
+
+    /// \brief Creates a new transform_output_iterator.
+    ///
+    /// \param output - the underlying output iterator.
+    /// \param transform_op - the function applied to the assigned values.
+    ROCPRIM_HOST_DEVICE inline
+    transform_output_iterator(OutputIterator output, UnaryFunction transform_op)
+        : output_(output), transform_op_(transform_op)
+    {
+    }
+
+    /// \brief Returns the underlying output iterator.
+    ROCPRIM_HOST_DEVICE inline
+    OutputIterator base() const
+    {
+        return output_;
+    }
+
+    /// \brief Returns the function applied to the assigned values.
+    ROCPRIM_HOST_DEVICE inline
+    UnaryFunction transform_op() const
+    {
+        return transform_op_;
+    }
+
+    //! \skip_doxy_start
+    ROCPRIM_HOST_DEVICE inline
+    transform_output_iterator& operator++()
+    {
+        output_++;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    transform_output_iterator operator++(int)
+    {
+        transform_output_iterator old = *this;
+        output_++;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    transform_output_iterator& operator--()
+    {
+        output_--;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    transform_output_iterator operator--(int)
+    {
+        transform_output_iterator old = *this;
+        output_--;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator*() const
+    {
+        return reference(output_, transform_op_);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator[](difference_type distance) const
+    {
+        return reference(output_ + distance, transform_op_);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    transform_output_iterator operator+(difference_type distance) const
+    {
+        return transform_output_iterator(output_ + distance, transform_op_);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    transform_output_iterator& operator+=(difference_type distance)
+    {
+        output_ += distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    transform_output_iterator operator-(difference_type distance) const
+    {
+        return transform_output_iterator(output_ - distance, transform_op_);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    transform_output_iterator& operator-=(difference_type distance)
+    {
+        output_ -= distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    difference_type operator-(transform_output_iterator other) const
+    {
+        return output_ - other.output_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator==(transform_output_iterator other) const
+    {
+        return output_ == other.output_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator!=(transform_output_iterator other) const
+    {
+        return output_ != other.output_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<(transform_output_iterator other) const
+    {
+        return output_ < other.output_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<=(transform_output_iterator other) const
+    {
+        return output_ <= other.output_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>(transform_output_iterator other) const
+    {
+        return output_ > other.output_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>=(transform_output_iterator other) const
+    {
+        return output_ >= other.output_;
+    }
+    //! \skip_doxy_end
+
+private:
+    OutputIterator output_;
+    UnaryFunction  transform_op_;
+};
+
+template<class OutputIterator, class UnaryFunction>
+ROCPRIM_HOST_DEVICE inline
+transform_output_iterator<OutputIterator, UnaryFunction>
+operator+(typename transform_output_iterator<OutputIterator, UnaryFunction>::difference_type
+              distance,
+          const transform_output_iterator<OutputIterator, UnaryFunction>& iterator)
+{
+    return iterator + distance;
+}
+
+/// make_transform_output_iterator creates a \p transform_output_iterator which applies
+/// \p transform_op to the values assigned to it and stores the results to \p output.
+///
+/// \param output - the underlying output iterator.
+/// \param transform_op - the function applied to the assigned values.
+/// \return A \p transform_output_iterator at the first element of \p output.
+template<class OutputIterator, class UnaryFunction>
+ROCPRIM_HOST_DEVICE inline
+transform_output_iterator<OutputIterator, UnaryFunction>
+make_transform_output_iterator(OutputIterator output, UnaryFunction transform_op)
+{
+    return transform_output_iterator<OutputIterator, UnaryFunction>(output, transform_op);
+}
+
+/// @}
+// end of group iteratormodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_ITERATOR_TRANSFORM_OUTPUT_ITERATOR_HPP_
@@ -36,36 +36,93 @@
 #include "type_traits.hpp"
 #include "iterator.hpp"
 
+#include "warp/warp_merge.hpp"
+#include "warp/warp_merge_sort.hpp"
+#include "warp/warp_radix_select.hpp"
+#include "warp/warp_radix_sort.hpp"
 #include "warp/warp_reduce.hpp"
 #include "warp/warp_scan.hpp"
 #include "warp/warp_sort.hpp"
 
+#include "block/block_axis_reduce.hpp"
+#include "block/block_axis_scan.hpp"
+#include "block/block_decode.hpp"
 #include "block/block_discontinuity.hpp"
+#include "block/block_dynamic_storage.hpp"
 #include "block/block_exchange.hpp"
 #include "block/block_histogram.hpp"
 #include "block/block_load.hpp"
+#include "block/block_load_balance.hpp"
+#include "block/block_load_pipelined.hpp"
+#include "block/block_merge.hpp"
+#include "block/block_radix_rank.hpp"
+#include "block/block_radix_select.hpp"
 #include "block/block_radix_sort.hpp"
 #include "block/block_scan.hpp"
 #include "block/block_sort.hpp"
 #include "block/block_store.hpp"
 
+#include "device/autotune.hpp"
+#include "device/caching_allocator.hpp"
+#include "device/call_info.hpp"
 #include "device/device_adjacent_difference.hpp"
+#include "device/device_adjacent_difference_reduce.hpp"
+#include "device/device_argminmax.hpp"
+#include "device/device_batch_memcpy.hpp"
+#include "device/device_batched_reduce.hpp"
+#include "device/device_batched_scan.hpp"
 #include "device/device_binary_search.hpp"
+#include "device/device_bitmask.hpp"
+#include "device/device_bucket_partition.hpp"
+#include "device/device_find.hpp"
+#include "device/device_for_each.hpp"
+#include "device/device_hash_reduce_by_key.hpp"
+#include "device/device_hash_table.hpp"
 #include "device/device_histogram.hpp"
+#include "device/device_is_sorted.hpp"
+#include "device/device_load_balanced_search.hpp"
 #include "device/device_merge.hpp"
+#include "device/device_merge_k.hpp"
 #include "device/device_merge_sort.hpp"
+#include "device/device_moments.hpp"
 #include "device/device_partition.hpp"
 #include "device/device_radix_sort.hpp"
+#include "device/device_radix_sort_in_place.hpp"
+#include "device/device_radix_sort_multi_device.hpp"
+#include "device/device_radix_sort_out_of_core.hpp"
 #include "device/device_reduce_by_key.hpp"
+#include "device/device_reduce_by_key_columns.hpp"
 #include "device/device_reduce.hpp"
+#include "device/device_reduce_multi_device.hpp"
 #include "device/device_run_length_encode.hpp"
+#include "device/device_scan_2d.hpp"
 #include "device/device_scan_by_key.hpp"
 #include "device/device_scan.hpp"
+#include "device/device_scan_multi_device.hpp"
+#include "device/device_segmented_histogram.hpp"
+#include "device/device_segmented_merge_sort.hpp"
 #include "device/device_segmented_radix_sort.hpp"
 #include "device/device_segmented_reduce.hpp"
 #include "device/device_segmented_scan.hpp"
+#include "device/device_segmented_select.hpp"
+#include "device/device_segmented_set_operations.hpp"
+#include "device/device_segmented_topk.hpp"
 #include "device/device_select.hpp"
+#include "device/device_select_kth.hpp"
+#include "device/device_set_operations.hpp"
+#include "device/device_shuffle.hpp"
+#include "device/device_sliding_window_reduce.hpp"
+#include "device/device_streaming.hpp"
+#include "device/device_string_sort.hpp"
+#include "device/device_tile_pipeline.hpp"
+#include "device/device_topk.hpp"
 #include "device/device_transform.hpp"
+#include "device/device_transpose.hpp"
+#include "device/graph_plan.hpp"
+#include "device/grid_limit.hpp"
+#include "device/instrumentation.hpp"
+#include "device/lookback_state_cache.hpp"
+#include "device/temporary_storage.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -30,6 +30,9 @@
 #ifndef ROCPRIM_THREAD_THREAD_LOAD_HPP_
 #define ROCPRIM_THREAD_THREAD_LOAD_HPP_
 
+#include <iterator>
+#include <type_traits>
+
 #include "../config.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
@@ -48,10 +51,63 @@ enum cache_load_modifier : int
 namespace detail
 {
 
+template<class T>
+ROCPRIM_DEVICE __forceinline__ T nontemporal_load_words(const T * ptr, std::true_type)
+{
+    constexpr unsigned int words = sizeof(T) / sizeof(unsigned int);
+    const unsigned int * word_ptr = reinterpret_cast<const unsigned int *>(ptr);
+    unsigned int raw[words];
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < words; i++)
+    {
+        raw[i] = __builtin_nontemporal_load(word_ptr + i);
+    }
+    T retval;
+    __builtin_memcpy(&retval, raw, sizeof(T));
+    return retval;
+}
+
+template<class T>
+ROCPRIM_DEVICE __forceinline__ T nontemporal_load_words(const T * ptr, std::false_type)
+{
+    T retval;
+    __builtin_memcpy(&retval, ptr, sizeof(T));
+    return retval;
+}
+
+// Streaming loads are nontemporal loads, the compiler selects the cache policy of the target.
+// Other than arithmetic types of at most 64 bits (128-bit integers included) are loaded as
+// dwords if their size and alignment allow it.
+template<class T>
+ROCPRIM_DEVICE __forceinline__
+auto nontemporal_load(const T * ptr)
+    -> typename std::enable_if<std::is_arithmetic<T>::value && !std::is_same<T, bool>::value
+                               && sizeof(T) <= sizeof(unsigned long long), T>::type
+{
+    return __builtin_nontemporal_load(ptr);
+}
+
+template<class T>
+ROCPRIM_DEVICE __forceinline__
+auto nontemporal_load(const T * ptr)
+    -> typename std::enable_if<!std::is_arithmetic<T>::value || std::is_same<T, bool>::value
+                               || (sizeof(T) > sizeof(unsigned long long)), T>::type
+{
+    return nontemporal_load_words(
+        ptr,
+        std::integral_constant<bool,
+                               sizeof(T) % sizeof(unsigned int) == 0
+                                   && alignof(T) >= alignof(unsigned int)>());
+}
+
 template<cache_load_modifier MODIFIER = load_default, typename T>
 ROCPRIM_DEVICE __forceinline__ T AsmThreadLoad(void * ptr)
 {
-    T retval = 0;
+    if(MODIFIER == load_cs)
+    {
+        return nontemporal_load(static_cast<const T *>(ptr));
+    }
+    T retval;
     __builtin_memcpy(&retval, ptr, sizeof(T));
     return retval;
 }
@@ -96,7 +152,6 @@ ROCPRIM_ASM_THREAD_LOAD_GROUP(load_volatile, "glc", "vmcnt");
 
 // TODO find correct modifiers to match these
 ROCPRIM_ASM_THREAD_LOAD_GROUP(load_ldg, "", "");
-ROCPRIM_ASM_THREAD_LOAD_GROUP(load_cs, "", "");
 #endif // __HIP_CPU_RT__
 
 #endif
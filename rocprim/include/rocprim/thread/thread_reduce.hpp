@@ -31,10 +31,182 @@
 #define ROCPRIM_THREAD_THREAD_REDUCE_HPP_
 
 
+#include <type_traits>
+
 #include "../config.hpp"
+#include "../functional.hpp"
+#include "../types.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
+namespace detail
+{
+
+// Reduces the items of a thread in order
+template<class T, class ReductionOp>
+struct thread_reduce_items_impl
+{
+    template<unsigned int Length>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    T reduce(const T (&input)[Length], ReductionOp reduction_op)
+    {
+        T result = input[0];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 1; i < Length; i++)
+        {
+            result = reduction_op(result, input[i]);
+        }
+        return result;
+    }
+};
+
+// Reduces the items of a thread for commutative operators: two accumulators reduce the items
+// with even and odd indices, which halves the chain of dependent operations
+template<class T, class ReductionOp>
+struct thread_reduce_commutative_impl
+{
+    template<unsigned int Length>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    T reduce(const T (&input)[Length], ReductionOp reduction_op)
+    {
+        // Fewer items do not have a chain worth splitting
+        return reduce(input, reduction_op, std::integral_constant<bool, (Length >= 4)>{});
+    }
+
+private:
+    template<unsigned int Length>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    T reduce(const T (&input)[Length], ReductionOp reduction_op, std::false_type)
+    {
+        return thread_reduce_items_impl<T, ReductionOp>::reduce(input, reduction_op);
+    }
+
+    template<unsigned int Length>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    T reduce(const T (&input)[Length], ReductionOp reduction_op, std::true_type)
+    {
+        T even = input[0];
+        T odd  = input[1];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 1; i < Length / 2; i++)
+        {
+            even = reduction_op(even, input[2 * i]);
+            odd  = reduction_op(odd, input[2 * i + 1]);
+        }
+        T result = reduction_op(even, odd);
+        if(Length % 2 != 0)
+        {
+            result = reduction_op(result, input[Length - 1]);
+        }
+        return result;
+    }
+};
+
+template<class T, class ReductionOp>
+struct is_plus_of
+    : std::integral_constant<bool,
+                             std::is_same<ReductionOp, ::rocprim::plus<T>>::value
+                                 || std::is_same<ReductionOp, ::rocprim::plus<>>::value>
+{};
+
+#ifndef __HIP_CPU_RT__
+// Sums of half values add pairs of items with packed instructions (v_pk_add_f16), the two
+// lanes are added at the end, so the items are summed in a different order
+template<class ReductionOp>
+struct thread_reduce_half_plus_impl
+{
+    typedef _Float16 packed_type __attribute__((ext_vector_type(2)));
+
+    template<unsigned int Length>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    ::rocprim::half reduce(const ::rocprim::half (&input)[Length], ReductionOp reduction_op)
+    {
+        // Fewer items are not worth the packing
+        return reduce(input, reduction_op, std::integral_constant<bool, (Length >= 4)>{});
+    }
+
+private:
+    template<unsigned int Length>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    ::rocprim::half reduce(const ::rocprim::half (&input)[Length],
+                           ReductionOp reduction_op,
+                           std::false_type)
+    {
+        return thread_reduce_items_impl<::rocprim::half, ReductionOp>::reduce(input, reduction_op);
+    }
+
+    template<unsigned int Length>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    ::rocprim::half reduce(const ::rocprim::half (&input)[Length],
+                           ReductionOp reduction_op,
+                           std::true_type)
+    {
+        packed_type sums = {__builtin_bit_cast(_Float16, input[0]),
+                            __builtin_bit_cast(_Float16, input[1])};
+        ROCPRIM_UNROLL
+        for(unsigned int i = 1; i < Length / 2; i++)
+        {
+            const packed_type pair = {__builtin_bit_cast(_Float16, input[2 * i]),
+                                      __builtin_bit_cast(_Float16, input[2 * i + 1])};
+            sums = sums + pair;
+        }
+        ::rocprim::half result = __builtin_bit_cast(::rocprim::half, _Float16(sums.x + sums.y));
+        if(Length % 2 != 0)
+        {
+            result = reduction_op(result, input[Length - 1]);
+        }
+        return result;
+    }
+};
+#endif
+
+// Sums of bfloat16 values are accumulated in fp32 and rounded once, bfloat16 additions are
+// computed in fp32 and rounded after every item otherwise
+template<class ReductionOp>
+struct thread_reduce_bfloat16_plus_impl
+{
+    template<unsigned int Length>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    ::rocprim::bfloat16 reduce(const ::rocprim::bfloat16 (&input)[Length], ReductionOp)
+    {
+        float result = static_cast<float>(input[0]);
+        ROCPRIM_UNROLL
+        for(unsigned int i = 1; i < Length; i++)
+        {
+            result += static_cast<float>(input[i]);
+        }
+        return ::rocprim::bfloat16(result);
+    }
+};
+
+template<class T, class ReductionOp>
+using thread_reduce_items_selector = typename std::conditional<
+#ifndef __HIP_CPU_RT__
+    std::is_same<T, ::rocprim::half>::value && is_plus_of<T, ReductionOp>::value,
+    thread_reduce_half_plus_impl<ReductionOp>,
+#else
+    false,
+    void,
+#endif
+    typename std::conditional<std::is_same<T, ::rocprim::bfloat16>::value
+                                  && is_plus_of<T, ReductionOp>::value,
+                              thread_reduce_bfloat16_plus_impl<ReductionOp>,
+                              typename std::conditional<
+                                  ::rocprim::is_commutative<ReductionOp>::value,
+                                  thread_reduce_commutative_impl<T, ReductionOp>,
+                                  thread_reduce_items_impl<T, ReductionOp>>::type>::type>::type;
+
+// Reduces the items of a thread, with packed or fp32 arithmetic for sums of half and bfloat16,
+// and in any order for commutative operators
+template<unsigned int Length, class T, class ReductionOp>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+T thread_reduce_items(const T (&input)[Length], ReductionOp reduction_op)
+{
+    return thread_reduce_items_selector<T, ReductionOp>::reduce(input, reduction_op);
+}
+
+} // end namespace detail
+
 /// \brief Carry out a reduction on an array of elements in one thread
 /// \tparam LENGTH - Length of the array to be reduced
 /// \tparam T - the input/output type
@@ -88,6 +260,11 @@ ROCPRIM_DEVICE ROCPRIM_INLINE T thread_reduce(
 }
 
 /// \brief Carry out a reduction on an array of elements in one thread
+///
+/// Sums of \p rocprim::half add pairs of elements with packed instructions and sums of
+/// \p rocprim::bfloat16 are accumulated in fp32, so the elements are summed in a different
+/// order than one by one.
+///
 /// \tparam LENGTH - Length of the array to be reduced
 /// \tparam T - the input/output type
 /// \tparam ReductionOp - Binary Operation that used to carry out the reduction
@@ -102,7 +279,7 @@ ROCPRIM_DEVICE ROCPRIM_INLINE T thread_reduce(
     T           (&input)[LENGTH],
     ReductionOp reduction_op)
 {
-    return thread_reduce<LENGTH, true>((T*)input, reduction_op);
+    return detail::thread_reduce_items(input, reduction_op);
 }
 
 END_ROCPRIM_NAMESPACE
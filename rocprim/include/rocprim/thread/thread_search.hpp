@@ -27,8 +27,8 @@
  *
  ******************************************************************************/
 
- #ifndef ROCPRIM_THREAD_THREAD_SCAN_HPP_
- #define ROCPRIM_THREAD_THREAD_SCAN_HPP_
+ #ifndef ROCPRIM_THREAD_THREAD_SEARCH_HPP_
+ #define ROCPRIM_THREAD_THREAD_SEARCH_HPP_
 
  #include <iterator>
  #include "../config.hpp"
@@ -150,6 +150,172 @@ ROCPRIM_DEVICE ROCPRIM_INLINE OffsetT upper_bound(
     return retval;
 }
 
+/// \brief Returns the offset of the first value within <tt>input[begin, num_items)</tt> which
+/// does not compare less than \p val, values before \p begin must compare less than \p val.
+/// The search gallops forwards from \p begin, so its cost is logarithmic in the distance to the
+/// result, which makes it fast for successive searches of increasing values.
+/// \tparam InputIteratorT   - <b>[inferred]</b> Type of iterator for the input data to be searched
+/// \tparam OffsetT          - <b>[inferred]</b> The unsigned data type of num_items
+/// \tparam T                - <b>[inferred]</b> The data type of the input sequence elements
+/// \tparam CompareOpT       - <b>[inferred]</b> Type of the less-than comparison operator
+/// \param input     [in]    - Input sequence
+/// \param begin     [in]    - Offset to start the search at
+/// \param num_items [in]    - Input sequence length
+/// \param val       [in]    - Search key
+/// \param compare   [in]    - Less-than comparison operator
+/// \return                  - Offset at which val was found
+template <
+    typename InputIteratorT,
+    typename OffsetT,
+    typename T,
+    typename CompareOpT>
+ROCPRIM_DEVICE ROCPRIM_INLINE OffsetT gallop_lower_bound(
+    InputIteratorT      input,
+    OffsetT             begin,
+    OffsetT             num_items,
+    const T&            val,
+    CompareOpT          compare)
+{
+    // input[begin, low) compare less than val
+    OffsetT low  = begin;
+    OffsetT step = 1;
+    while (low < num_items)
+    {
+        const OffsetT probe = num_items - low > step ? low + step - 1 : num_items - 1;
+        if (!compare(input[probe], val))
+        {
+            // The result is in [low, probe]
+            OffsetT high = probe;
+            while (low < high)
+            {
+                const OffsetT mid = low + (high - low) / 2;
+                if (compare(input[mid], val))
+                {
+                    low = mid + 1;
+                }
+                else
+                {
+                    high = mid;
+                }
+            }
+            return low;
+        }
+        low = probe + 1;
+        step *= 2;
+    }
+    return num_items;
+}
+
+/// \brief Returns the offset of the first value within <tt>input[begin, num_items)</tt> which
+/// compares greater than \p val, values before \p begin must not compare greater than \p val.
+/// The search gallops forwards from \p begin, so its cost is logarithmic in the distance to the
+/// result.
+/// \tparam InputIteratorT   - <b>[inferred]</b> Type of iterator for the input data to be searched
+/// \tparam OffsetT          - <b>[inferred]</b> The unsigned data type of num_items
+/// \tparam T                - <b>[inferred]</b> The data type of the input sequence elements
+/// \tparam CompareOpT       - <b>[inferred]</b> Type of the less-than comparison operator
+/// \param input     [in]    - Input sequence
+/// \param begin     [in]    - Offset to start the search at
+/// \param num_items [in]    - Input sequence length
+/// \param val       [in]    - Search key
+/// \param compare   [in]    - Less-than comparison operator
+/// \return                  - Offset at which val was found
+template <
+    typename InputIteratorT,
+    typename OffsetT,
+    typename T,
+    typename CompareOpT>
+ROCPRIM_DEVICE ROCPRIM_INLINE OffsetT gallop_upper_bound(
+    InputIteratorT      input,
+    OffsetT             begin,
+    OffsetT             num_items,
+    const T&            val,
+    CompareOpT          compare)
+{
+    // input[begin, low) do not compare greater than val
+    OffsetT low  = begin;
+    OffsetT step = 1;
+    while (low < num_items)
+    {
+        const OffsetT probe = num_items - low > step ? low + step - 1 : num_items - 1;
+        if (compare(val, input[probe]))
+        {
+            // The result is in [low, probe]
+            OffsetT high = probe;
+            while (low < high)
+            {
+                const OffsetT mid = low + (high - low) / 2;
+                if (compare(val, input[mid]))
+                {
+                    high = mid;
+                }
+                else
+                {
+                    low = mid + 1;
+                }
+            }
+            return low;
+        }
+        low = probe + 1;
+        step *= 2;
+    }
+    return num_items;
+}
+
+/// \brief Returns the offset of the first value within <tt>input[0, end)</tt> which does not
+/// compare less than \p val, values from \p end on must not compare less than \p val. The
+/// search gallops backwards from \p end, so its cost is logarithmic in the distance to the
+/// result, which makes it fast for finding the first of a short run of equal values.
+/// \tparam InputIteratorT   - <b>[inferred]</b> Type of iterator for the input data to be searched
+/// \tparam OffsetT          - <b>[inferred]</b> The unsigned data type of end
+/// \tparam T                - <b>[inferred]</b> The data type of the input sequence elements
+/// \tparam CompareOpT       - <b>[inferred]</b> Type of the less-than comparison operator
+/// \param input     [in]    - Input sequence
+/// \param end       [in]    - Offset to start the search at
+/// \param val       [in]    - Search key
+/// \param compare   [in]    - Less-than comparison operator
+/// \return                  - Offset at which val was found
+template <
+    typename InputIteratorT,
+    typename OffsetT,
+    typename T,
+    typename CompareOpT>
+ROCPRIM_DEVICE ROCPRIM_INLINE OffsetT gallop_lower_bound_backward(
+    InputIteratorT      input,
+    OffsetT             end,
+    const T&            val,
+    CompareOpT          compare)
+{
+    // input[high, end) do not compare less than val
+    OffsetT high = end;
+    OffsetT step = 1;
+    while (high > 0)
+    {
+        const OffsetT probe = high > step ? high - step : 0;
+        if (compare(input[probe], val))
+        {
+            // The result is in (probe, high]
+            OffsetT low = probe + 1;
+            while (low < high)
+            {
+                const OffsetT mid = low + (high - low) / 2;
+                if (compare(input[mid], val))
+                {
+                    low = mid + 1;
+                }
+                else
+                {
+                    high = mid;
+                }
+            }
+            return low;
+        }
+        high = probe;
+        step *= 2;
+    }
+    return 0;
+}
+
 END_ROCPRIM_NAMESPACE
 
-#endif // ROCPRIM_THREAD_THREAD_SCAN_HPP_
+#endif // ROCPRIM_THREAD_THREAD_SEARCH_HPP_
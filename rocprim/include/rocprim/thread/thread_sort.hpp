@@ -0,0 +1,250 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef ROCPRIM_THREAD_THREAD_SORT_HPP_
+#define ROCPRIM_THREAD_THREAD_SORT_HPP_
+
+#include "../config.hpp"
+#include "../types.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief Sorting networks of \p thread_sort.
+enum class thread_sort_network
+{
+    /// \brief Batcher's odd-even merge sort, which needs the fewest comparators of the two
+    /// networks (19 instead of 28 for 8 items). It is not stable.
+    odd_even_merge,
+    /// \brief Odd-even transposition sort, which only swaps neighbours in the wrong order, so it
+    /// is stable: equivalent keys keep their order.
+    odd_even_transposition,
+    /// \brief Default network.
+    default_network = odd_even_merge
+};
+
+namespace detail
+{
+
+// Swaps items i and j (i < j) if item j goes before item i. The items are selected instead of
+// swapped in a branch, so they stay in registers when the network is unrolled.
+template<class Key, class Value, class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void thread_sort_compare_swap(Key&           key_i,
+                              Key&           key_j,
+                              Value&         value_i,
+                              Value&         value_j,
+                              const bool     valid_j,
+                              BinaryFunction compare_function)
+{
+    const bool swap = valid_j && compare_function(key_j, key_i);
+
+    const Key key = key_i;
+    key_i         = swap ? key_j : key_i;
+    key_j         = swap ? key : key_j;
+
+    const Value value = value_i;
+    value_i           = swap ? value_j : value_i;
+    value_j           = swap ? value : value_j;
+}
+
+template<thread_sort_network Network>
+struct thread_sort_impl;
+
+// The comparators of the network of the next power of two items that involve items past the
+// last valid item are skipped, which is equivalent to sorting these items as the largest ones
+template<>
+struct thread_sort_impl<thread_sort_network::odd_even_merge>
+{
+    template<class Key, class Value, unsigned int ItemsPerThread, class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    void sort(Key (&keys)[ItemsPerThread],
+              Value (&values)[ItemsPerThread],
+              const unsigned int valid,
+              BinaryFunction     compare_function)
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int p = 1; p < ItemsPerThread; p *= 2)
+        {
+            ROCPRIM_UNROLL
+            for(unsigned int k = p; k >= 1; k /= 2)
+            {
+                ROCPRIM_UNROLL
+                for(unsigned int j = k % p; j + k < ItemsPerThread; j += 2 * k)
+                {
+                    ROCPRIM_UNROLL
+                    for(unsigned int i = 0; i < k && i + j + k < ItemsPerThread; i++)
+                    {
+                        // Only the items of the same pair of merged runs are compared
+                        if((i + j) / (2 * p) == (i + j + k) / (2 * p))
+                        {
+                            thread_sort_compare_swap(keys[i + j],
+                                                     keys[i + j + k],
+                                                     values[i + j],
+                                                     values[i + j + k],
+                                                     i + j + k < valid,
+                                                     compare_function);
+                        }
+                    }
+                }
+            }
+        }
+    }
+};
+
+template<>
+struct thread_sort_impl<thread_sort_network::odd_even_transposition>
+{
+    template<class Key, class Value, unsigned int ItemsPerThread, class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static
+    void sort(Key (&keys)[ItemsPerThread],
+              Value (&values)[ItemsPerThread],
+              const unsigned int valid,
+              BinaryFunction     compare_function)
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int pass = 0; pass < ItemsPerThread; pass++)
+        {
+            ROCPRIM_UNROLL
+            for(unsigned int i = pass & 1; i + 1 < ItemsPerThread; i += 2)
+            {
+                thread_sort_compare_swap(keys[i],
+                                         keys[i + 1],
+                                         values[i],
+                                         values[i + 1],
+                                         i + 1 < valid,
+                                         compare_function);
+            }
+        }
+    }
+};
+
+} // end namespace detail
+
+/// \brief Sorts the items of a thread in registers with a sorting network.
+///
+/// The network is unrolled at compile time, so the items stay in registers and no shared memory
+/// is used. The number of comparators grows with the square of \p ItemsPerThread for
+/// \p thread_sort_network::odd_even_transposition and with <tt>n log^2 n</tt> for
+/// \p thread_sort_network::odd_even_merge, so it is meant for small numbers of items.
+///
+/// \tparam Network - [optional] sorting network, only
+/// \p thread_sort_network::odd_even_transposition is stable.
+/// \tparam Key - the key type.
+/// \tparam ItemsPerThread - the number of items.
+/// \tparam BinaryFunction - type of the comparator.
+///
+/// \param [in,out] keys - the keys to sort.
+/// \param [in] compare_function - comparison function object which returns true if the first
+/// argument is ordered before the second.
+template<thread_sort_network Network = thread_sort_network::default_network,
+         class Key,
+         unsigned int ItemsPerThread,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void thread_sort(Key (&keys)[ItemsPerThread], BinaryFunction compare_function)
+{
+    empty_type values[ItemsPerThread];
+    detail::thread_sort_impl<Network>::sort(keys, values, ItemsPerThread, compare_function);
+}
+
+/// \brief Sorts the first \p valid items of a thread in registers with a sorting network.
+///
+/// \tparam Network - [optional] sorting network, only
+/// \p thread_sort_network::odd_even_transposition is stable.
+/// \tparam Key - the key type.
+/// \tparam ItemsPerThread - the number of items.
+/// \tparam BinaryFunction - type of the comparator.
+///
+/// \param [in,out] keys - the keys to sort, the items past \p valid are not compared or moved.
+/// \param [in] valid - the number of valid items.
+/// \param [in] compare_function - comparison function object which returns true if the first
+/// argument is ordered before the second.
+template<thread_sort_network Network = thread_sort_network::default_network,
+         class Key,
+         unsigned int ItemsPerThread,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void thread_sort(Key (&keys)[ItemsPerThread],
+                 const unsigned int valid,
+                 BinaryFunction     compare_function)
+{
+    empty_type values[ItemsPerThread];
+    detail::thread_sort_impl<Network>::sort(keys, values, valid, compare_function);
+}
+
+/// \brief Sorts the key-value pairs of a thread in registers with a sorting network.
+///
+/// \tparam Network - [optional] sorting network, only
+/// \p thread_sort_network::odd_even_transposition is stable.
+/// \tparam Key - the key type.
+/// \tparam Value - the value type.
+/// \tparam ItemsPerThread - the number of items.
+/// \tparam BinaryFunction - type of the comparator.
+///
+/// \param [in,out] keys - the keys to sort.
+/// \param [in,out] values - the values, which are moved with their keys.
+/// \param [in] compare_function - comparison function object which returns true if the first
+/// argument is ordered before the second.
+template<thread_sort_network Network = thread_sort_network::default_network,
+         class Key,
+         class Value,
+         unsigned int ItemsPerThread,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void thread_sort(Key (&keys)[ItemsPerThread],
+                 Value (&values)[ItemsPerThread],
+                 BinaryFunction compare_function)
+{
+    detail::thread_sort_impl<Network>::sort(keys, values, ItemsPerThread, compare_function);
+}
+
+/// \brief Sorts the first \p valid key-value pairs of a thread in registers with a sorting
+/// network.
+///
+/// \tparam Network - [optional] sorting network, only
+/// \p thread_sort_network::odd_even_transposition is stable.
+/// \tparam Key - the key type.
+/// \tparam Value - the value type.
+/// \tparam ItemsPerThread - the number of items.
+/// \tparam BinaryFunction - type of the comparator.
+///
+/// \param [in,out] keys - the keys to sort, the items past \p valid are not compared or moved.
+/// \param [in,out] values - the values, which are moved with their keys.
+/// \param [in] valid - the number of valid items.
+/// \param [in] compare_function - comparison function object which returns true if the first
+/// argument is ordered before the second.
+template<thread_sort_network Network = thread_sort_network::default_network,
+         class Key,
+         class Value,
+         unsigned int ItemsPerThread,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void thread_sort(Key (&keys)[ItemsPerThread],
+                 Value (&values)[ItemsPerThread],
+                 const unsigned int valid,
+                 BinaryFunction     compare_function)
+{
+    detail::thread_sort_impl<Network>::sort(keys, values, valid, compare_function);
+}
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_THREAD_THREAD_SORT_HPP_
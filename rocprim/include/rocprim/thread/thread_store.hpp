@@ -30,6 +30,7 @@
 #ifndef ROCPRIM_THREAD_THREAD_STORE_HPP_
 #define ROCPRIM_THREAD_THREAD_STORE_HPP_
 
+#include <type_traits>
 
 #include "../config.hpp"
 
@@ -48,9 +49,60 @@ enum cache_store_modifier
 namespace detail
 {
 
+template<class T>
+ROCPRIM_DEVICE __forceinline__ void nontemporal_store_words(T * ptr, T val, std::true_type)
+{
+    constexpr unsigned int words = sizeof(T) / sizeof(unsigned int);
+    unsigned int * word_ptr = reinterpret_cast<unsigned int *>(ptr);
+    unsigned int raw[words];
+    __builtin_memcpy(raw, &val, sizeof(T));
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < words; i++)
+    {
+        __builtin_nontemporal_store(raw[i], word_ptr + i);
+    }
+}
+
+template<class T>
+ROCPRIM_DEVICE __forceinline__ void nontemporal_store_words(T * ptr, T val, std::false_type)
+{
+    __builtin_memcpy(ptr, &val, sizeof(T));
+}
+
+// Streaming stores are nontemporal stores, the compiler selects the cache policy of the target.
+// Other than arithmetic types of at most 64 bits (128-bit integers included) are stored as
+// dwords if their size and alignment allow it.
+template<class T>
+ROCPRIM_DEVICE __forceinline__
+auto nontemporal_store(T * ptr, T val)
+    -> typename std::enable_if<std::is_arithmetic<T>::value && !std::is_same<T, bool>::value
+                               && sizeof(T) <= sizeof(unsigned long long)>::type
+{
+    __builtin_nontemporal_store(val, ptr);
+}
+
+template<class T>
+ROCPRIM_DEVICE __forceinline__
+auto nontemporal_store(T * ptr, T val)
+    -> typename std::enable_if<!std::is_arithmetic<T>::value || std::is_same<T, bool>::value
+                               || (sizeof(T) > sizeof(unsigned long long))>::type
+{
+    nontemporal_store_words(
+        ptr,
+        val,
+        std::integral_constant<bool,
+                               sizeof(T) % sizeof(unsigned int) == 0
+                                   && alignof(T) >= alignof(unsigned int)>());
+}
+
 template<cache_store_modifier MODIFIER = store_default, typename T>
 ROCPRIM_DEVICE __forceinline__ void AsmThreadStore(void * ptr, T val)
 {
+    if(MODIFIER == store_cs)
+    {
+        nontemporal_store(static_cast<T *>(ptr), val);
+        return;
+    }
     __builtin_memcpy(ptr, &val, sizeof(T));
 }
 
@@ -95,8 +147,6 @@ ROCPRIM_ASM_THREAD_STORE_GROUP(store_cg, "glc slc", "");
 ROCPRIM_ASM_THREAD_STORE_GROUP(store_wt, "glc", "vmcnt");
 ROCPRIM_ASM_THREAD_STORE_GROUP(store_volatile, "glc", "vmcnt");
 
-// TODO find correct modifiers to match these
-ROCPRIM_ASM_THREAD_STORE_GROUP(store_cs, "", "");
 #endif // __HIP_CPU_RT__
 
 #endif
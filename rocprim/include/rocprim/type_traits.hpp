@@ -43,54 +43,98 @@ struct is_floating_point
         std::is_same<::rocprim::bfloat16, typename std::remove_cv<T>::type>::value
     > {};
 
-/// \brief Alias for std::is_integral.
+namespace detail
+{
+
 template<class T>
-using is_integral = std::is_integral<T>;
+struct is_int128 : std::false_type
+{};
+
+template<class T>
+struct is_uint128 : std::false_type
+{};
+
+#if ROCPRIM_HAS_INT128_SUPPORT
+template<>
+struct is_int128<::rocprim::int128_t> : std::true_type
+{};
+
+template<>
+struct is_uint128<::rocprim::uint128_t> : std::true_type
+{};
+#endif
+
+} // end namespace detail
+
+/// \brief Behaves like std::is_integral, but also includes 128-bit integer types
+/// (\ref rocprim::int128_t and \ref rocprim::uint128_t) when the standard library does not
+/// classify them as integral (for example in strict ISO C++ mode).
+template<class T>
+struct is_integral
+    : std::integral_constant<
+        bool,
+        std::is_integral<T>::value ||
+        detail::is_int128<typename std::remove_cv<T>::type>::value ||
+        detail::is_uint128<typename std::remove_cv<T>::type>::value
+    > {};
 
 /// \brief Behaves like std::is_arithmetic, but also includes half-precision and bfloat16-precision
-/// floating point type (\ref rocprim::half).
+/// floating point type (\ref rocprim::half) and 128-bit integer types.
 template<class T>
 struct is_arithmetic
     : std::integral_constant<
         bool,
         std::is_arithmetic<T>::value ||
+        detail::is_int128<typename std::remove_cv<T>::type>::value ||
+        detail::is_uint128<typename std::remove_cv<T>::type>::value ||
         std::is_same<::rocprim::half, typename std::remove_cv<T>::type>::value ||
         std::is_same<::rocprim::bfloat16, typename std::remove_cv<T>::type>::value
     > {};
 
 /// \brief Behaves like std::is_fundamental, but also includes half-precision and bfloat16-precision
-/// floating point type (\ref rocprim::half).
+/// floating point type (\ref rocprim::half) and 128-bit integer types.
 template<class T>
 struct is_fundamental
   : std::integral_constant<
         bool,
         std::is_fundamental<T>::value ||
+        detail::is_int128<typename std::remove_cv<T>::type>::value ||
+        detail::is_uint128<typename std::remove_cv<T>::type>::value ||
         std::is_same<::rocprim::half, typename std::remove_cv<T>::type>::value ||
         std::is_same<::rocprim::bfloat16, typename std::remove_cv<T>::type>::value
 > {};
 
-/// \brief Alias for std::is_unsigned.
+/// \brief Behaves like std::is_unsigned, but also includes the 128-bit unsigned integer type
+/// (\ref rocprim::uint128_t).
 template<class T>
-using is_unsigned = std::is_unsigned<T>;
+struct is_unsigned
+    : std::integral_constant<
+        bool,
+        std::is_unsigned<T>::value ||
+        detail::is_uint128<typename std::remove_cv<T>::type>::value
+    > {};
 
 /// \brief Behaves like std::is_signed, but also includes half-precision and bfloat16-precision
-/// floating point type (\ref rocprim::half).
+/// floating point type (\ref rocprim::half) and the 128-bit signed integer type.
 template<class T>
 struct is_signed
     : std::integral_constant<
         bool,
         std::is_signed<T>::value ||
+        detail::is_int128<typename std::remove_cv<T>::type>::value ||
         std::is_same<::rocprim::half, typename std::remove_cv<T>::type>::value ||
         std::is_same<::rocprim::bfloat16, typename std::remove_cv<T>::type>::value
     > {};
 
 /// \brief Behaves like std::is_scalar, but also includes half-precision and bfloat16-precision
-/// floating point type (\ref rocprim::half).
+/// floating point type (\ref rocprim::half) and 128-bit integer types.
 template<class T>
 struct is_scalar
     : std::integral_constant<
         bool,
         std::is_scalar<T>::value ||
+        detail::is_int128<typename std::remove_cv<T>::type>::value ||
+        detail::is_uint128<typename std::remove_cv<T>::type>::value ||
         std::is_same<::rocprim::half, typename std::remove_cv<T>::type>::value ||
         std::is_same<::rocprim::bfloat16, typename std::remove_cv<T>::type>::value
     > {};
@@ -137,6 +181,14 @@ struct get_unsigned_bits_type<T,8>
   typedef uint64_t unsigned_type;
 };
 
+#if ROCPRIM_HAS_INT128_SUPPORT
+template<typename T>
+struct get_unsigned_bits_type<T,16>
+{
+  typedef ::rocprim::uint128_t unsigned_type;
+};
+#endif
+
 template<typename T, typename UnsignedBits>
 ROCPRIM_DEVICE ROCPRIM_INLINE
 auto TwiddleIn(UnsignedBits key)
@@ -146,6 +146,16 @@ using half = ::__half;
 /// \brief bfloat16 floating point type
 using bfloat16 = ::hip_bfloat16;
 
+#if defined(__SIZEOF_INT128__)
+    #define ROCPRIM_HAS_INT128_SUPPORT 1
+/// \brief 128-bit signed integer type
+using int128_t = __int128_t;
+/// \brief 128-bit unsigned integer type
+using uint128_t = __uint128_t;
+#else
+    #define ROCPRIM_HAS_INT128_SUPPORT 0
+#endif
+
 // The lane_mask_type only exist at device side
 #ifndef __AMDGCN_WAVEFRONT_SIZE
 // When not compiling with hipcc, we're compiling with HIP-CPU
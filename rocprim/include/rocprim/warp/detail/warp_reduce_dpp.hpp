@@ -29,6 +29,7 @@
 #include "../../detail/various.hpp"
 
 #include "warp_reduce_shuffle.hpp"
+#include "warp_segment_bounds.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -76,8 +77,8 @@ public:
 #if ROCPRIM_NAVI
         if(WarpSize > 16)
         {
-            // row_bcast:15
-            output = reduce_op(warp_swizzle<T, 0x1e0>(output), output);
+            // row_bcast:15 is not supported, the lane 15 of the other row is read with permlanex16
+            output = reduce_op(warp_permlanex16_last(output), output);
         }
 #else
         if(WarpSize > 16)
@@ -92,7 +93,7 @@ public:
         }
 #endif
         // Read the result from the last lane of the logical warp
-        output = warp_shuffle(output, WarpSize - 1, WarpSize);
+        output = warp_shuffle_last<WarpSize>(output);
     }
 
     template<class BinaryFunction>
@@ -125,18 +126,14 @@ public:
     ROCPRIM_DEVICE ROCPRIM_INLINE
     void head_segmented_reduce(T input, T& output, Flag flag, BinaryFunction reduce_op)
     {
-        // Fallback to shuffle-based implementation
-        warp_reduce_shuffle<T, WarpSize, UseAllReduce>()
-            .head_segmented_reduce(input, output, flag, reduce_op);
+        this->segmented_reduce<true>(input, output, flag, reduce_op);
     }
 
     template<class Flag, class BinaryFunction>
     ROCPRIM_DEVICE ROCPRIM_INLINE
     void tail_segmented_reduce(T input, T& output, Flag flag, BinaryFunction reduce_op)
     {
-        // Fallback to shuffle-based implementation
-        warp_reduce_shuffle<T, WarpSize, UseAllReduce>()
-            .tail_segmented_reduce(input, output, flag, reduce_op);
+        this->segmented_reduce<false>(input, output, flag, reduce_op);
     }
 
     template<class Flag, class BinaryFunction>
@@ -144,9 +141,8 @@ public:
     void head_segmented_reduce(T input, T& output, Flag flag,
                                storage_type& storage, BinaryFunction reduce_op)
     {
-        // Fallback to shuffle-based implementation
-        warp_reduce_shuffle<T, WarpSize, UseAllReduce>()
-            .head_segmented_reduce(input, output, flag, storage, reduce_op);
+        (void) storage;
+        this->segmented_reduce<true>(input, output, flag, reduce_op);
     }
 
     template<class Flag, class BinaryFunction>
@@ -154,9 +150,87 @@ public:
     void tail_segmented_reduce(T input, T& output, Flag flag,
                                storage_type& storage, BinaryFunction reduce_op)
     {
-        // Fallback to shuffle-based implementation
-        warp_reduce_shuffle<T, WarpSize, UseAllReduce>()
-            .tail_segmented_reduce(input, output, flag, storage, reduce_op);
+        (void) storage;
+        this->segmented_reduce<false>(input, output, flag, reduce_op);
+    }
+
+private:
+    static constexpr unsigned int row_size = 16;
+    static constexpr unsigned int rows = ::rocprim::device_warp_size() / row_size;
+
+    // Every lane gets the reduction of its value and the values of the following lanes of its
+    // segment, like in the shuffle-based implementation. The values are reduced within rows of
+    // 16 lanes with DPP row_shl, then the lanes whose segments continue in the following rows
+    // add the reductions of the segments from the first lanes of these rows, which are read with
+    // v_readlane.
+    template<bool HeadSegmented, class Flag, class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void segmented_reduce(T input, T& output, Flag flag, BinaryFunction reduce_op)
+    {
+        const unsigned int lane_id = ::rocprim::lane_id();
+        // Lane id of the last lane of the segment in the hardware warp
+        const unsigned int last = (lane_id / WarpSize) * WarpSize
+            + last_in_warp_segment<HeadSegmented, WarpSize>(flag);
+        // The number of the following lanes of the segment in the row is computed once, so
+        // every step compares it with its constant offset
+        const unsigned int row_remaining
+            = ::rocprim::min(last, lane_id | (row_size - 1)) - lane_id;
+
+        output = input;
+
+        if(WarpSize > 1)
+        {
+            T t = reduce_op(output, warp_move_dpp<T, 0x101>(output)); // row_shl:1
+            if(row_remaining >= 1) output = t;
+        }
+        if(WarpSize > 2)
+        {
+            T t = reduce_op(output, warp_move_dpp<T, 0x102>(output)); // row_shl:2
+            if(row_remaining >= 2) output = t;
+        }
+        if(WarpSize > 4)
+        {
+            T t = reduce_op(output, warp_move_dpp<T, 0x104>(output)); // row_shl:4
+            if(row_remaining >= 4) output = t;
+        }
+        if(WarpSize > 8)
+        {
+            T t = reduce_op(output, warp_move_dpp<T, 0x108>(output)); // row_shl:8
+            if(row_remaining >= 8) output = t;
+        }
+        if(WarpSize > row_size)
+        {
+            // Tail flags of the hardware warp, the last lanes of logical warps are tails too
+            lane_mask_type tails = ::rocprim::ballot(flag);
+            if(HeadSegmented)
+            {
+                tails >>= 1;
+            }
+            ROCPRIM_UNROLL
+            for(unsigned int warp_last = WarpSize - 1; warp_last < rows * row_size;
+                warp_last += WarpSize)
+            {
+                tails |= lane_mask_type(1) << warp_last;
+            }
+
+            // The reductions from the first lanes of the rows to the ends of their segments,
+            // they are uniform so they are computed by all lanes
+            const unsigned int row = lane_id / row_size;
+            T suffix = warp_readlane(output, (rows - 1) * row_size);
+            T next = suffix;
+            ROCPRIM_UNROLL
+            for(unsigned int r = rows - 1; r > 0; r--)
+            {
+                if(r < rows - 1)
+                {
+                    const T first = warp_readlane(output, r * row_size);
+                    const bool row_has_tail = ((tails >> (r * row_size)) & 0xFFFFu) != 0;
+                    suffix = row_has_tail ? first : reduce_op(first, suffix);
+                }
+                if(row + 1 == r) next = suffix;
+            }
+            if(last >= (row + 1) * row_size) output = reduce_op(output, next);
+        }
     }
 };
 
@@ -77,7 +77,8 @@ public:
 #if ROCPRIM_NAVI
         if(WarpSize > 16)
         {
-            T t = scan_op(warp_swizzle<T, 0x1e0>(output), output); // row_bcast:15
+            // row_bcast:15 is not supported, the lane 15 of the other row is read with permlanex16
+            T t = scan_op(warp_permlanex16_last(output), output);
             if(lane_id % 32 >= 16) output = t;
         }
 #else
@@ -110,7 +111,7 @@ public:
     {
         inclusive_scan(input, output, scan_op);
         // Broadcast value from the last thread in warp
-        reduction = warp_shuffle(output, WarpSize-1, WarpSize);
+        reduction = warp_shuffle_last<WarpSize>(output);
     }
 
     template<class BinaryFunction>
@@ -158,7 +159,7 @@ public:
     {
         inclusive_scan(input, output, scan_op);
         // Broadcast value from the last thread in warp
-        reduction = warp_shuffle(output, WarpSize-1, WarpSize);
+        reduction = warp_shuffle_last<WarpSize>(output);
         // Convert inclusive scan result to exclusive
         to_exclusive(output, output, init, scan_op);
     }
@@ -209,7 +210,7 @@ public:
     {
         inclusive_scan(input, inclusive_output, scan_op);
         // Broadcast value from the last thread in warp
-        reduction = warp_shuffle(inclusive_output, WarpSize-1, WarpSize);
+        reduction = warp_shuffle_last<WarpSize>(inclusive_output);
         // Convert inclusive scan result to exclusive
         to_exclusive(inclusive_output, exclusive_output, init, scan_op);
     }
@@ -248,7 +249,7 @@ private:
         // include init value in scan results
         exclusive_output = scan_op(init, inclusive_input);
         // get exclusive results
-        exclusive_output = warp_shuffle_up(exclusive_output, 1, WarpSize);
+        exclusive_output = shift_up(exclusive_output);
         if(detail::logical_lane_id<WarpSize>() == 0)
         {
             exclusive_output = init;
@@ -259,7 +260,31 @@ private:
     void to_exclusive(T inclusive_input, T& exclusive_output)
     {
         // shift to get exclusive results
-        exclusive_output = warp_shuffle_up(inclusive_input, 1, WarpSize);
+        exclusive_output = shift_up(inclusive_input);
+    }
+
+    // Same as warp_shuffle_up by 1 lane with cross-lane moves instead of ds_bpermute, only
+    // the first lanes of the logical warps read values of other logical warps, they keep
+    // their own values
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    T shift_up(T input)
+    {
+#if ROCPRIM_NAVI
+        if(WarpSize <= 32)
+        {
+            // The first lane of a row reads the lane 15 of the previous row with permlanex16,
+            // other lanes read their neighbours in the row with row_shr:1
+            const unsigned int lane_id = ::rocprim::lane_id();
+            T shifted = warp_move_dpp<T, 0x111>(input); // row_shr:1
+            const T from_row = warp_permlanex16_last(input);
+            if(lane_id % 16 == 0) shifted = from_row;
+            return detail::logical_lane_id<WarpSize>() == 0 ? input : shifted;
+        }
+        return warp_shuffle_up(input, 1, WarpSize);
+#else
+        const T shifted = warp_move_dpp<T, 0x138>(input); // wave_shr:1
+        return detail::logical_lane_id<WarpSize>() == 0 ? input : shifted;
+#endif
     }
 };
 
@@ -21,6 +21,8 @@
 #ifndef ROCPRIM_WARP_WARP_EXCHANGE_HPP_
 #define ROCPRIM_WARP_WARP_EXCHANGE_HPP_
 
+#include <type_traits>
+
 #include "../config.hpp"
 #include "../detail/various.hpp"
 
@@ -34,12 +36,26 @@
 
 BEGIN_ROCPRIM_NAMESPACE
 
+/// \brief \p warp_exchange_algorithm enumerates the algorithms of \p warp_exchange for
+/// the transpositions between blocked and striped arrangements.
+enum class warp_exchange_algorithm
+{
+    /// Items are exchanged through the shared memory of \p storage_type.
+    shared_memory,
+    /// Items are exchanged in registers with \p ItemsPerThread warp shuffles per thread,
+    /// \p storage_type is empty, so the exchange does not limit the occupancy of kernels.
+    /// \p ItemsPerThread must be a divisor of \p WarpSize. \p scatter_to_striped is not supported.
+    shuffle
+};
+
 /// \brief The \p warp_exchange class is a warp level parallel primitive which provides
 /// methods for rearranging items partitioned across threads in a warp.
 ///
 /// \tparam T - the input type.
 /// \tparam ItemsPerThread - the number of items contributed by each thread.
 /// \tparam WarpSize - the number of threads in a warp.
+/// \tparam Algorithm - [optional] the algorithm of \p blocked_to_striped and
+/// \p striped_to_blocked, see \p warp_exchange_algorithm.
 ///
 /// \par Overview
 /// * The \p warp_exchange class supports the following rearrangement methods:
@@ -75,7 +91,8 @@ BEGIN_ROCPRIM_NAMESPACE
 template<
     class T,
     unsigned int ItemsPerThread,
-    unsigned int WarpSize = ::rocprim::device_warp_size()
+    unsigned int WarpSize = ::rocprim::device_warp_size(),
+    warp_exchange_algorithm Algorithm = warp_exchange_algorithm::shared_memory
 >
 class warp_exchange
 {
@@ -83,6 +100,11 @@ class warp_exchange
                   "Logical warp size must be a power of two.");
     static_assert(WarpSize <= ::rocprim::device_warp_size(),
                   "Logical warp size cannot be larger than physical warp size.");
+    static_assert(Algorithm != warp_exchange_algorithm::shuffle || WarpSize % ItemsPerThread == 0,
+                  "ItemsPerThread must be a divisor of WarpSize to use "
+                  "warp_exchange_algorithm::shuffle");
+
+    static constexpr bool use_shuffle = Algorithm == warp_exchange_algorithm::shuffle;
 
     // Struct used for creating a raw_storage object for this primitive's temporary storage.
     struct storage_type_
@@ -101,7 +123,9 @@ public:
     /// an externally allocated memory, or be a part of a union type with other storage types
     /// to increase shared memory reusability.
     #ifndef DOXYGEN_SHOULD_SKIP_THIS // hides storage_type implementation for Doxygen
-    using storage_type = detail::raw_storage<storage_type_>;
+    using storage_type = typename std::conditional<use_shuffle,
+                                                   detail::empty_storage_type,
+                                                   detail::raw_storage<storage_type_>>::type;
     #else
     using storage_type = storage_type_; // only for Doxygen
     #endif
@@ -146,21 +170,10 @@ public:
                             U (&output)[ItemsPerThread],
                             storage_type& storage)
     {
-        const unsigned int flat_id = ::rocprim::detail::logical_lane_id<WarpSize>();
-        storage_type_& storage_ = storage.get();
-
-        ROCPRIM_UNROLL
-        for(unsigned int i = 0; i < ItemsPerThread; i++)
-        {
-            storage_.buffer[flat_id * ItemsPerThread + i] = input[i];
-        }
-        ::rocprim::wave_barrier();
-
-        ROCPRIM_UNROLL
-        for(unsigned int i = 0; i < ItemsPerThread; i++)
-        {
-            output[i] = storage_.buffer[i * WarpSize + flat_id];
-        }
+        blocked_to_striped_impl(std::integral_constant<bool, use_shuffle>(),
+                                input,
+                                output,
+                                storage);
     }
 
     /// \brief Transposes a blocked arrangement of items to a striped arrangement
@@ -199,22 +212,27 @@ public:
     {
         static_assert(WarpSize % ItemsPerThread == 0,
                       "ItemsPerThread must be a divisor of WarpSize to use blocked_to_striped_shuffle");
+        constexpr unsigned int stride = WarpSize / ItemsPerThread;
         const unsigned int flat_id = ::rocprim::detail::logical_lane_id<WarpSize>();
         U work_array[ItemsPerThread];
 
+        // Output item i of lane l is input item l % ItemsPerThread of lane
+        // i * stride + l / ItemsPerThread. The items are rotated by the round, so in every round
+        // each lane is read by one lane and only ItemsPerThread shuffles are needed.
         ROCPRIM_UNROLL
-        for(unsigned int dst_idx = 0; dst_idx < ItemsPerThread; dst_idx++)
+        for(unsigned int round = 0; round < ItemsPerThread; round++)
         {
+            const T sent = select_item(
+                input, (flat_id / stride + ItemsPerThread - round) % ItemsPerThread);
+            const unsigned int dst_idx = (flat_id % ItemsPerThread + round) % ItemsPerThread;
+            const T value = ::rocprim::warp_shuffle(
+                sent, dst_idx * stride + flat_id / ItemsPerThread, WarpSize);
             ROCPRIM_UNROLL
-            for(unsigned int src_idx = 0; src_idx < ItemsPerThread; src_idx++)
+            for(unsigned int i = 0; i < ItemsPerThread; i++)
             {
-                const auto value = ::rocprim::warp_shuffle(
-                    input[src_idx],
-                    flat_id / ItemsPerThread + dst_idx * (WarpSize / ItemsPerThread)
-                );
-                if(src_idx == flat_id % ItemsPerThread)
+                if(i == dst_idx)
                 {
-                    work_array[dst_idx] = value;
+                    work_array[i] = value;
                 }
             }
         }
@@ -266,21 +284,10 @@ public:
                             U (&output)[ItemsPerThread],
                             storage_type& storage)
     {
-        const unsigned int flat_id = ::rocprim::detail::logical_lane_id<WarpSize>();
-        storage_type_& storage_ = storage.get();
-
-        ROCPRIM_UNROLL
-        for(unsigned int i = 0; i < ItemsPerThread; i++)
-        {
-            storage_.buffer[i * WarpSize + flat_id] = input[i];
-        }
-        ::rocprim::wave_barrier();
-
-        ROCPRIM_UNROLL
-        for(unsigned int i = 0; i < ItemsPerThread; i++)
-        {
-            output[i] = storage_.buffer[flat_id * ItemsPerThread + i];
-        }
+        striped_to_blocked_impl(std::integral_constant<bool, use_shuffle>(),
+                                input,
+                                output,
+                                storage);
     }
 
     /// \brief Transposes a striped arrangement of items to a blocked arrangement
@@ -319,22 +326,26 @@ public:
     {
         static_assert(WarpSize % ItemsPerThread == 0,
                       "ItemsPerThread must be a divisor of WarpSize to use striped_to_blocked_shuffle");
+        constexpr unsigned int stride = WarpSize / ItemsPerThread;
         const unsigned int flat_id = ::rocprim::detail::logical_lane_id<WarpSize>();
         U work_array[ItemsPerThread];
 
+        // Output item j of lane l is input item (l * ItemsPerThread + j) / WarpSize of lane
+        // (l * ItemsPerThread + j) % WarpSize, rotated by the round like in blocked_to_striped.
         ROCPRIM_UNROLL
-        for(unsigned int dst_idx = 0; dst_idx < ItemsPerThread; dst_idx++)
+        for(unsigned int round = 0; round < ItemsPerThread; round++)
         {
+            const T sent = select_item(
+                input, (flat_id % ItemsPerThread + ItemsPerThread - round) % ItemsPerThread);
+            const unsigned int dst_idx = (flat_id / stride + round) % ItemsPerThread;
+            const T value = ::rocprim::warp_shuffle(
+                sent, (ItemsPerThread * flat_id + dst_idx) % WarpSize, WarpSize);
             ROCPRIM_UNROLL
-            for(unsigned int src_idx = 0; src_idx < ItemsPerThread; src_idx++)
+            for(unsigned int i = 0; i < ItemsPerThread; i++)
             {
-                const auto value = ::rocprim::warp_shuffle(
-                    input[src_idx],
-                    (ItemsPerThread * flat_id + dst_idx) % WarpSize
-                );
-                if(flat_id / (WarpSize / ItemsPerThread) == src_idx)
+                if(i == dst_idx)
                 {
-                    work_array[dst_idx] = value;
+                    work_array[i] = value;
                 }
             }
         }
@@ -393,6 +404,8 @@ public:
             const OffsetT (&ranks)[ItemsPerThread],
             storage_type& storage)
     {
+        static_assert(!use_shuffle,
+                      "scatter_to_striped is not supported by warp_exchange_algorithm::shuffle");
         const unsigned int flat_id = ::rocprim::detail::logical_lane_id<WarpSize>();
         storage_type_& storage_ = storage.get();
 
@@ -410,6 +423,90 @@ public:
             output[i] = storage_.buffer[item_offset];
         }
     }
+
+private:
+    // Returns items[index] for an index that differs between lanes. The item is selected
+    // instead of indexing the array dynamically, which would move the array to scratch memory.
+    template<class V>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static V select_item(const V (&items)[ItemsPerThread], const unsigned int index)
+    {
+        V value = items[0];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 1; i < ItemsPerThread; i++)
+        {
+            value = i == index ? items[i] : value;
+        }
+        return value;
+    }
+
+    template<class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void blocked_to_striped_impl(std::false_type /*use_shuffle*/,
+                                 const T (&input)[ItemsPerThread],
+                                 U (&output)[ItemsPerThread],
+                                 storage_type& storage)
+    {
+        const unsigned int flat_id = ::rocprim::detail::logical_lane_id<WarpSize>();
+        storage_type_& storage_ = storage.get();
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            storage_.buffer[flat_id * ItemsPerThread + i] = input[i];
+        }
+        ::rocprim::wave_barrier();
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            output[i] = storage_.buffer[i * WarpSize + flat_id];
+        }
+    }
+
+    template<class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void blocked_to_striped_impl(std::true_type /*use_shuffle*/,
+                                 const T (&input)[ItemsPerThread],
+                                 U (&output)[ItemsPerThread],
+                                 storage_type& /*storage*/)
+    {
+        blocked_to_striped_shuffle(input, output);
+    }
+
+    template<class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void striped_to_blocked_impl(std::false_type /*use_shuffle*/,
+                                 const T (&input)[ItemsPerThread],
+                                 U (&output)[ItemsPerThread],
+                                 storage_type& storage)
+    {
+        const unsigned int flat_id = ::rocprim::detail::logical_lane_id<WarpSize>();
+        storage_type_& storage_ = storage.get();
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            storage_.buffer[i * WarpSize + flat_id] = input[i];
+        }
+        ::rocprim::wave_barrier();
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            output[i] = storage_.buffer[flat_id * ItemsPerThread + i];
+        }
+    }
+
+    template<class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void striped_to_blocked_impl(std::true_type /*use_shuffle*/,
+                                 const T (&input)[ItemsPerThread],
+                                 U (&output)[ItemsPerThread],
+                                 storage_type& /*storage*/)
+    {
+        striped_to_blocked_shuffle(input, output);
+    }
 };
 
 END_ROCPRIM_NAMESPACE
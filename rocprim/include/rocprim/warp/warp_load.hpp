@@ -52,6 +52,8 @@ enum class warp_load_method
     /// * Performance remains high due to increased memory coalescing, provided that
     /// vectorization requirements are fulfilled. Otherwise, performance will default
     /// to \p warp_load_direct.
+    /// * When the input is guarded by \p valid, the threads whose items are all valid still
+    /// load them as vectors.
     /// \par Requirements:
     /// * The input offset (\p block_input) must be quad-item aligned.
     /// * The following conditions will prevent vectorization and switch to default
@@ -144,6 +146,79 @@ public:
     using storage_type = storage_type_; // only for Doxygen
     #endif
 
+    /// \brief Loads data from continuous memory into an arrangement of items across the
+    /// warp.
+    ///
+    /// \tparam InputIterator - [inferred] an iterator type for input (can be a simple
+    /// pointer.
+    ///
+    /// \param [in] input - the input iterator to load from.
+    /// \param [out] items - array that data is loaded to.
+    ///
+    /// \par Overview
+    /// * The type \p T must be such that an object of type \p InputIterator
+    /// can be dereferenced and then implicitly converted to \p T.
+    template<class InputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(InputIterator input,
+              T (&items)[ItemsPerThread])
+    {
+        storage_type storage;
+        load(input, items, storage);
+    }
+
+    /// \brief Loads data from continuous memory into an arrangement of items across the
+    /// warp, which is guarded by range \p valid.
+    ///
+    /// \tparam InputIterator - [inferred] an iterator type for input (can be a simple
+    /// pointer.
+    ///
+    /// \param [in] input - the input iterator to load from.
+    /// \param [out] items - array that data is loaded to.
+    /// \param [in] valid - maximum range of valid numbers to load.
+    ///
+    /// \par Overview
+    /// * The type \p T must be such that an object of type \p InputIterator
+    /// can be dereferenced and then implicitly converted to \p T.
+    template<class InputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(InputIterator input,
+              T (&items)[ItemsPerThread],
+              unsigned int valid)
+    {
+        storage_type storage;
+        load(input, items, valid, storage);
+    }
+
+    /// \brief Loads data from continuous memory into an arrangement of items across the
+    /// warp, which is guarded by range with a fall-back value for out-of-bound elements.
+    ///
+    /// \tparam InputIterator - [inferred] an iterator type for input (can be a simple
+    /// pointer.
+    /// \tparam Default - [inferred] The data type of the default value.
+    ///
+    /// \param [in] input - the input iterator to load from.
+    /// \param [out] items - array that data is loaded to.
+    /// \param [in] valid - maximum range of valid numbers to load.
+    /// \param [in] out_of_bounds - default value assigned to out-of-bound items.
+    ///
+    /// \par Overview
+    /// * The type \p T must be such that an object of type \p InputIterator
+    /// can be dereferenced and then implicitly converted to \p T.
+    template<
+        class InputIterator,
+        class Default
+    >
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(InputIterator input,
+              T (&items)[ItemsPerThread],
+              unsigned int valid,
+              Default out_of_bounds)
+    {
+        storage_type storage;
+        load(input, items, valid, out_of_bounds, storage);
+    }
+
     /// \brief Loads data from continuous memory into an arrangement of items across the
     /// warp.
     ///
@@ -256,6 +331,39 @@ class warp_load<T, ItemsPerThread, WarpSize, warp_load_method::warp_load_striped
 public:
     using storage_type = typename ::rocprim::detail::empty_storage_type;
 
+    template<class InputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(InputIterator input,
+              T (&items)[ItemsPerThread])
+    {
+        storage_type storage;
+        load(input, items, storage);
+    }
+
+    template<class InputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(InputIterator input,
+              T (&items)[ItemsPerThread],
+              unsigned int valid)
+    {
+        storage_type storage;
+        load(input, items, valid, storage);
+    }
+
+    template<
+        class InputIterator,
+        class Default
+    >
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(InputIterator input,
+              T (&items)[ItemsPerThread],
+              unsigned int valid,
+              Default out_of_bounds)
+    {
+        storage_type storage;
+        load(input, items, valid, out_of_bounds, storage);
+    }
+
     template<class InputIterator>
     ROCPRIM_DEVICE ROCPRIM_INLINE
     void load(InputIterator input,
@@ -321,6 +429,103 @@ class warp_load<T, ItemsPerThread, WarpSize, warp_load_method::warp_load_vectori
 public:
     using storage_type = typename ::rocprim::detail::empty_storage_type;
 
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(T* input,
+              T (&items)[ItemsPerThread])
+    {
+        const unsigned int flat_id = ::rocprim::detail::logical_lane_id<WarpSize>();
+        block_load_direct_blocked_vectorized(flat_id, input, items);
+    }
+
+    // Threads whose items are all valid load them as vectors, only the thread with the last
+    // valid item loads its items one by one
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(T* input,
+              T (&items)[ItemsPerThread],
+              unsigned int valid)
+    {
+        const unsigned int flat_id = ::rocprim::detail::logical_lane_id<WarpSize>();
+        if((flat_id + 1) * ItemsPerThread <= valid)
+        {
+            block_load_direct_blocked_vectorized(flat_id, input, items);
+        }
+        else
+        {
+            block_load_direct_blocked(flat_id, input, items, valid);
+        }
+    }
+
+    template<class Default>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(T* input,
+              T (&items)[ItemsPerThread],
+              unsigned int valid,
+              Default out_of_bounds)
+    {
+        const unsigned int flat_id = ::rocprim::detail::logical_lane_id<WarpSize>();
+        if((flat_id + 1) * ItemsPerThread <= valid)
+        {
+            block_load_direct_blocked_vectorized(flat_id, input, items);
+        }
+        else
+        {
+            block_load_direct_blocked(flat_id, input, items, valid, out_of_bounds);
+        }
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(T* input,
+              T (&items)[ItemsPerThread],
+              unsigned int valid,
+              storage_type& /*storage*/)
+    {
+        load(input, items, valid);
+    }
+
+    template<class Default>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(T* input,
+              T (&items)[ItemsPerThread],
+              unsigned int valid,
+              Default out_of_bounds,
+              storage_type& /*storage*/)
+    {
+        load(input, items, valid, out_of_bounds);
+    }
+
+    template<class InputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(InputIterator input,
+              T (&items)[ItemsPerThread])
+    {
+        storage_type storage;
+        load(input, items, storage);
+    }
+
+    template<class InputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(InputIterator input,
+              T (&items)[ItemsPerThread],
+              unsigned int valid)
+    {
+        storage_type storage;
+        load(input, items, valid, storage);
+    }
+
+    template<
+        class InputIterator,
+        class Default
+    >
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(InputIterator input,
+              T (&items)[ItemsPerThread],
+              unsigned int valid,
+              Default out_of_bounds)
+    {
+        storage_type storage;
+        load(input, items, valid, out_of_bounds, storage);
+    }
+
     ROCPRIM_DEVICE ROCPRIM_INLINE
     void load(T* input,
               T (&items)[ItemsPerThread],
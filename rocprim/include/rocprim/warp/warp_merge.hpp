@@ -0,0 +1,329 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef ROCPRIM_WARP_WARP_MERGE_HPP_
+#define ROCPRIM_WARP_WARP_MERGE_HPP_
+
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/merge_path.hpp"
+#include "../detail/various.hpp"
+
+#include "../intrinsics.hpp"
+#include "../functional.hpp"
+#include "../types.hpp"
+
+/// \addtogroup warpmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief The warp_merge class provides warp-wide methods for merging two sorted sequences
+/// held by the threads of a warp in a blocked arrangement.
+///
+/// \tparam Key - the key type.
+/// \tparam ItemsPerThread - the number of items held by each thread, it can be any number.
+/// \tparam WarpSize - [optional] the number of threads in a warp.
+/// \tparam Value - [optional] the value type. By default, it's empty_type (keys only).
+///
+/// \par Overview
+/// * \p WarpSize must be power of two and equal to or less than the size of hardware warp (see
+/// rocprim::device_warp_size()). If it is less, merge is performed separately within groups
+/// determined by \p WarpSize.
+/// * The first \p size1 items of the warp (in the blocked arrangement) are the first sorted
+/// sequence and the next \p size2 items are the second one. After the merge the first
+/// <tt>size1 + size2</tt> items of the warp are sorted, the items past them are not compared
+/// and left unchanged.
+/// * The merge is stable and is partitioned evenly across threads by the merge path, like
+/// \p block_merge.
+///
+/// \par Example:
+/// \parblock
+/// In the example a logical warp of 16 threads merges two sorted lists of up to 32 keys.
+///
+/// \code{.cpp}
+/// __global__ void example_kernel(...)
+/// {
+///     using warp_merge_type = rocprim::warp_merge<int, 4, 16>;
+///     constexpr unsigned int warps_per_block = 256 / 16;
+///     __shared__ typename warp_merge_type::storage_type storage[warps_per_block];
+///
+///     const unsigned int warp_id = threadIdx.x / 16;
+///     int keys[4];
+///     unsigned int size1 = ...;
+///     unsigned int size2 = ...;
+///     ...
+///     warp_merge_type().merge(keys, size1, size2, storage[warp_id]);
+///     ...
+/// }
+/// \endcode
+/// \endparblock
+template<
+    class Key,
+    unsigned int ItemsPerThread,
+    unsigned int WarpSize = device_warp_size(),
+    class Value = empty_type
+>
+class warp_merge
+{
+    static_assert(::rocprim::detail::is_power_of_two(WarpSize),
+                  "Logical warp size must be a power of two.");
+    static_assert(WarpSize <= ::rocprim::device_warp_size(),
+                  "Logical warp size cannot be larger than physical warp size.");
+
+    static constexpr unsigned int items_per_warp = WarpSize * ItemsPerThread;
+
+    using storage_type_ = detail::merge_storage<Key, Value, items_per_warp>;
+
+public:
+    /// \brief Struct used to allocate a temporary memory that is required for thread
+    /// communication during operations provided by related parallel primitive.
+    ///
+    /// Depending on the implemention the operations exposed by parallel primitive may
+    /// require a temporary storage for thread communication. The storage should be allocated
+    /// using keywords \p __shared__. It can be aliased to
+    /// an externally allocated memory, or be a part of a union with other storage types
+    /// to increase shared memory reusability. Every logical warp needs its own storage.
+    using storage_type = detail::raw_storage<storage_type_>;
+
+    /// \brief Merges the first \p size1 keys of the warp with the rest of the keys.
+    ///
+    /// \tparam BinaryFunction - type of binary function used for comparison. Default type
+    /// is rocprim::less<Key>.
+    ///
+    /// \param [in, out] thread_keys - reference to an array of keys provided by a thread.
+    /// \param [in] size1 - number of items of the first sequence, the rest of the items of the
+    /// warp are the second sequence.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] compare_function - comparison function object which returns true if the
+    /// first argument is ordered before the second. The signature of the function should be
+    /// equivalent to the following: <tt>bool f(const Key &a, const Key &b);</tt>. The signature
+    /// does not need to have <tt>const &</tt>, but function object must not modify the objects
+    /// passed to it.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class BinaryFunction = ::rocprim::less<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void merge(Key (&thread_keys)[ItemsPerThread],
+               unsigned int size1,
+               storage_type& storage,
+               BinaryFunction compare_function = BinaryFunction())
+    {
+        empty_type thread_values[ItemsPerThread];
+        merge_impl(thread_keys,
+                   thread_values,
+                   size1,
+                   items_per_warp - ::rocprim::min(size1, items_per_warp),
+                   storage.get(),
+                   compare_function);
+    }
+
+    /// \brief Merges the first \p size1 keys of the warp with the next \p size2 keys.
+    ///
+    /// \tparam BinaryFunction - type of binary function used for comparison. Default type
+    /// is rocprim::less<Key>.
+    ///
+    /// \param [in, out] thread_keys - reference to an array of keys provided by a thread.
+    /// \param [in] size1 - number of items of the first sequence.
+    /// \param [in] size2 - number of items of the second sequence, the items past
+    /// <tt>size1 + size2</tt> are not compared and left unchanged.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] compare_function - comparison function object which returns true if the
+    /// first argument is ordered before the second.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class BinaryFunction = ::rocprim::less<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void merge(Key (&thread_keys)[ItemsPerThread],
+               unsigned int size1,
+               unsigned int size2,
+               storage_type& storage,
+               BinaryFunction compare_function = BinaryFunction())
+    {
+        empty_type thread_values[ItemsPerThread];
+        merge_impl(thread_keys, thread_values, size1, size2, storage.get(), compare_function);
+    }
+
+    /// \brief Merges the first \p size1 keys and values of the warp with the rest of them
+    /// by the keys.
+    ///
+    /// \tparam BinaryFunction - type of binary function used for comparison. Default type
+    /// is rocprim::less<Key>.
+    ///
+    /// \param [in, out] thread_keys - reference to an array of keys provided by a thread.
+    /// \param [in, out] thread_values - reference to an array of values provided by a thread.
+    /// \param [in] size1 - number of items of the first sequence, the rest of the items of the
+    /// warp are the second sequence.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] compare_function - comparison function object which returns true if the
+    /// first argument is ordered before the second.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class BinaryFunction = ::rocprim::less<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void merge(Key (&thread_keys)[ItemsPerThread],
+               Value (&thread_values)[ItemsPerThread],
+               unsigned int size1,
+               storage_type& storage,
+               BinaryFunction compare_function = BinaryFunction())
+    {
+        merge_impl(thread_keys,
+                   thread_values,
+                   size1,
+                   items_per_warp - ::rocprim::min(size1, items_per_warp),
+                   storage.get(),
+                   compare_function);
+    }
+
+    /// \brief Merges the first \p size1 keys and values of the warp with the next \p size2
+    /// ones by the keys.
+    ///
+    /// \tparam BinaryFunction - type of binary function used for comparison. Default type
+    /// is rocprim::less<Key>.
+    ///
+    /// \param [in, out] thread_keys - reference to an array of keys provided by a thread.
+    /// \param [in, out] thread_values - reference to an array of values provided by a thread.
+    /// \param [in] size1 - number of items of the first sequence.
+    /// \param [in] size2 - number of items of the second sequence, the items past
+    /// <tt>size1 + size2</tt> are not compared and left unchanged.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] compare_function - comparison function object which returns true if the
+    /// first argument is ordered before the second.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class BinaryFunction = ::rocprim::less<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void merge(Key (&thread_keys)[ItemsPerThread],
+               Value (&thread_values)[ItemsPerThread],
+               unsigned int size1,
+               unsigned int size2,
+               storage_type& storage,
+               BinaryFunction compare_function = BinaryFunction())
+    {
+        merge_impl(thread_keys, thread_values, size1, size2, storage.get(), compare_function);
+    }
+
+private:
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static void store_values(const Value (&values)[ItemsPerThread],
+                             const unsigned int thread_offset,
+                             storage_type_& storage,
+                             std::true_type)
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            storage.values[thread_offset + i] = values[i];
+        }
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static void store_values(const empty_type (&)[ItemsPerThread],
+                             const unsigned int,
+                             storage_type_&,
+                             std::false_type)
+    {}
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static void load_values(Value (&values)[ItemsPerThread],
+                            const unsigned int (&indices)[ItemsPerThread],
+                            const unsigned int thread_valid,
+                            storage_type_& storage,
+                            std::true_type)
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            if(i < thread_valid)
+            {
+                values[i] = storage.values[indices[i]];
+            }
+        }
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static void load_values(empty_type (&)[ItemsPerThread],
+                            const unsigned int (&)[ItemsPerThread],
+                            const unsigned int,
+                            storage_type_&,
+                            std::false_type)
+    {}
+
+    template<class V, class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void merge_impl(Key (&keys)[ItemsPerThread],
+                    V (&values)[ItemsPerThread],
+                    unsigned int size1,
+                    unsigned int size2,
+                    storage_type_& storage,
+                    BinaryFunction compare_function)
+    {
+        using with_values_type = std::integral_constant<bool, !std::is_same<V, empty_type>::value>;
+
+        size1 = ::rocprim::min(size1, items_per_warp);
+        size2 = ::rocprim::min(size2, items_per_warp - size1);
+        const unsigned int size = size1 + size2;
+        const unsigned int lane = ::rocprim::detail::logical_lane_id<WarpSize>();
+        const unsigned int thread_offset = lane * ItemsPerThread;
+        const unsigned int thread_begin = ::rocprim::min(size, thread_offset);
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            storage.keys[thread_offset + i] = keys[i];
+        }
+        store_values(values, thread_offset, storage, with_values_type());
+        ::rocprim::wave_barrier();
+
+        const unsigned int split = ::rocprim::detail::merge_path(storage.keys,
+                                                                 storage.keys + size1,
+                                                                 size1,
+                                                                 size2,
+                                                                 thread_begin,
+                                                                 compare_function);
+        const ::rocprim::detail::range_t range{split, size1, size1 + thread_begin - split, size};
+
+        unsigned int indices[ItemsPerThread];
+        ::rocprim::detail::serial_merge_stable(storage.keys, range, keys, indices,
+                                               compare_function);
+        load_values(values,
+                    indices,
+                    ::rocprim::min(size - thread_begin, ItemsPerThread),
+                    storage,
+                    with_values_type());
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group warpmodule
+
+#endif // ROCPRIM_WARP_WARP_MERGE_HPP_
@@ -0,0 +1,355 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_WARP_WARP_MERGE_SORT_HPP_
+#define ROCPRIM_WARP_WARP_MERGE_SORT_HPP_
+
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/merge_path.hpp"
+#include "../detail/various.hpp"
+
+#include "../intrinsics.hpp"
+#include "../functional.hpp"
+#include "../thread/thread_sort.hpp"
+#include "../types.hpp"
+
+/// \addtogroup warpmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+template<class Key, class Value, unsigned int Size>
+struct warp_merge_sort_storage
+{
+    Key   keys[Size];
+    Value values[Size];
+};
+
+template<class Key, unsigned int Size>
+struct warp_merge_sort_storage<Key, empty_type, Size>
+{
+    Key keys[Size];
+};
+
+} // end namespace detail
+
+/// \brief The warp_merge_sort class provides warp-wide methods for computing a stable
+/// parallel merge sort of items in a blocked arrangement across thread warps.
+///
+/// \tparam Key - the key type.
+/// \tparam ItemsPerThread - the number of items held by each thread, it can be any number.
+/// \tparam WarpSize - [optional] the number of threads in a warp.
+/// \tparam Value - [optional] the value type. By default, it's empty_type (keys only).
+///
+/// \par Overview
+/// * \p WarpSize must be power of two and equal to or less than the size of hardware warp (see
+/// rocprim::device_warp_size()). If it is less, sort is performed separately within groups
+/// determined by \p WarpSize.
+/// * Every thread first sorts its own items, then sorted runs of the logical warp are merged
+/// through shared memory, with the merge path partitioning every merge evenly across threads.
+/// * The sort is stable: equivalent keys keep the order of their blocked positions.
+/// * The sort can be limited to the first \p valid items of the warp (in the blocked
+/// arrangement). Only these items are compared, so no out-of-bounds sentinel keys are
+/// needed and the segment lengths are not rounded up to powers of two; the items at and
+/// past \p valid are left unchanged.
+///
+/// \par Example:
+/// \parblock
+/// In the example a logical warp of 16 threads sorts segments of up to 48 keys.
+///
+/// \code{.cpp}
+/// __global__ void example_kernel(...)
+/// {
+///     using warp_sort_type = rocprim::warp_merge_sort<int, 3, 16>;
+///     constexpr unsigned int warps_per_block = 256 / 16;
+///     __shared__ typename warp_sort_type::storage_type storage[warps_per_block];
+///
+///     const unsigned int warp_id = threadIdx.x / 16;
+///     int keys[3];
+///     unsigned int valid = ...; // not greater than 48
+///     ...
+///     warp_sort_type().sort(keys, valid, storage[warp_id]);
+///     ...
+/// }
+/// \endcode
+/// \endparblock
+template<
+    class Key,
+    unsigned int ItemsPerThread,
+    unsigned int WarpSize = device_warp_size(),
+    class Value = empty_type
+>
+class warp_merge_sort
+{
+    static_assert(::rocprim::detail::is_power_of_two(WarpSize),
+                  "Logical warp size must be a power of two.");
+    static_assert(WarpSize <= ::rocprim::device_warp_size(),
+                  "Logical warp size cannot be larger than physical warp size.");
+
+    static constexpr unsigned int items_per_warp = WarpSize * ItemsPerThread;
+
+    using storage_type_ = detail::warp_merge_sort_storage<Key, Value, items_per_warp>;
+
+public:
+    /// \brief Struct used to allocate a temporary memory that is required for thread
+    /// communication during operations provided by related parallel primitive.
+    ///
+    /// Depending on the implemention the operations exposed by parallel primitive may
+    /// require a temporary storage for thread communication. The storage should be allocated
+    /// using keywords \p __shared__. It can be aliased to
+    /// an externally allocated memory, or be a part of a union with other storage types
+    /// to increase shared memory reusability. Every logical warp needs its own storage.
+    using storage_type = detail::raw_storage<storage_type_>;
+
+    /// \brief Sorts the keys of the warp.
+    ///
+    /// \tparam BinaryFunction - type of binary function used for sort. Default type
+    /// is rocprim::less<Key>.
+    ///
+    /// \param [in, out] thread_keys - reference to an array of keys provided by a thread.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] compare_function - binary operation function object that will be used for sort.
+    /// The signature of the function should be equivalent to the following:
+    /// <tt>bool f(const Key &a, const Key &b);</tt>. The signature does not need to have
+    /// <tt>const &</tt>, but function object must not modify the objects passed to it.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class BinaryFunction = ::rocprim::less<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort(Key (&thread_keys)[ItemsPerThread],
+              storage_type& storage,
+              BinaryFunction compare_function = BinaryFunction())
+    {
+        empty_type thread_values[ItemsPerThread];
+        sort_impl(thread_keys, thread_values, items_per_warp, storage.get(), compare_function);
+    }
+
+    /// \brief Sorts the first \p valid keys of the warp.
+    ///
+    /// \tparam BinaryFunction - type of binary function used for sort. Default type
+    /// is rocprim::less<Key>.
+    ///
+    /// \param [in, out] thread_keys - reference to an array of keys provided by a thread.
+    /// \param [in] valid - number of valid items in the warp, the items in blocked positions
+    /// at and past it are not compared and left unchanged.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] compare_function - binary operation function object that will be used for sort.
+    /// The signature of the function should be equivalent to the following:
+    /// <tt>bool f(const Key &a, const Key &b);</tt>. The signature does not need to have
+    /// <tt>const &</tt>, but function object must not modify the objects passed to it.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class BinaryFunction = ::rocprim::less<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort(Key (&thread_keys)[ItemsPerThread],
+              unsigned int valid,
+              storage_type& storage,
+              BinaryFunction compare_function = BinaryFunction())
+    {
+        empty_type thread_values[ItemsPerThread];
+        sort_impl(thread_keys, thread_values, valid, storage.get(), compare_function);
+    }
+
+    /// \brief Sorts the keys and the values of the warp by the keys.
+    ///
+    /// \tparam BinaryFunction - type of binary function used for sort. Default type
+    /// is rocprim::less<Key>.
+    ///
+    /// \param [in, out] thread_keys - reference to an array of keys provided by a thread.
+    /// \param [in, out] thread_values - reference to an array of values provided by a thread.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] compare_function - binary operation function object that will be used for sort.
+    /// The signature of the function should be equivalent to the following:
+    /// <tt>bool f(const Key &a, const Key &b);</tt>. The signature does not need to have
+    /// <tt>const &</tt>, but function object must not modify the objects passed to it.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class BinaryFunction = ::rocprim::less<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort(Key (&thread_keys)[ItemsPerThread],
+              Value (&thread_values)[ItemsPerThread],
+              storage_type& storage,
+              BinaryFunction compare_function = BinaryFunction())
+    {
+        sort_impl(thread_keys, thread_values, items_per_warp, storage.get(), compare_function);
+    }
+
+    /// \brief Sorts the first \p valid keys and values of the warp by the keys.
+    ///
+    /// \tparam BinaryFunction - type of binary function used for sort. Default type
+    /// is rocprim::less<Key>.
+    ///
+    /// \param [in, out] thread_keys - reference to an array of keys provided by a thread.
+    /// \param [in, out] thread_values - reference to an array of values provided by a thread.
+    /// \param [in] valid - number of valid items in the warp, the items in blocked positions
+    /// at and past it are not compared and left unchanged.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] compare_function - binary operation function object that will be used for sort.
+    /// The signature of the function should be equivalent to the following:
+    /// <tt>bool f(const Key &a, const Key &b);</tt>. The signature does not need to have
+    /// <tt>const &</tt>, but function object must not modify the objects passed to it.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class BinaryFunction = ::rocprim::less<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort(Key (&thread_keys)[ItemsPerThread],
+              Value (&thread_values)[ItemsPerThread],
+              unsigned int valid,
+              storage_type& storage,
+              BinaryFunction compare_function = BinaryFunction())
+    {
+        sort_impl(thread_keys, thread_values, valid, storage.get(), compare_function);
+    }
+
+private:
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static void store_values(const Value (&values)[ItemsPerThread],
+                             const unsigned int thread_offset,
+                             storage_type_& storage,
+                             std::true_type)
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            storage.values[thread_offset + i] = values[i];
+        }
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static void store_values(const empty_type (&)[ItemsPerThread],
+                             const unsigned int,
+                             storage_type_&,
+                             std::false_type)
+    {}
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static void load_value(Value& value,
+                           const unsigned int index,
+                           storage_type_& storage,
+                           std::true_type)
+    {
+        value = storage.values[index];
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static void load_value(empty_type&, const unsigned int, storage_type_&, std::false_type)
+    {}
+
+    template<class V, class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort_impl(Key (&keys)[ItemsPerThread],
+                   V (&values)[ItemsPerThread],
+                   unsigned int valid,
+                   storage_type_& storage,
+                   BinaryFunction compare_function)
+    {
+        using with_values_type = std::integral_constant<bool, !std::is_same<V, empty_type>::value>;
+
+        valid = ::rocprim::min(valid, items_per_warp);
+        const unsigned int lane = ::rocprim::detail::logical_lane_id<WarpSize>();
+        const unsigned int thread_offset = lane * ItemsPerThread;
+        const unsigned int thread_begin = ::rocprim::min(valid, thread_offset);
+
+        // The transposition network only swaps neighbours in the wrong order, so it is stable
+        ::rocprim::thread_sort<thread_sort_network::odd_even_transposition>(
+            keys, values, ::rocprim::min(valid - thread_begin, ItemsPerThread), compare_function);
+
+        // Sorted runs of run_threads threads are merged in pairs, the number of valid items
+        // is the same in all lanes, so all of them finish the loop together
+        for(unsigned int run_threads = 1;
+            run_threads < WarpSize && run_threads * ItemsPerThread < valid;
+            run_threads *= 2)
+        {
+            ::rocprim::wave_barrier();
+            ROCPRIM_UNROLL
+            for(unsigned int i = 0; i < ItemsPerThread; i++)
+            {
+                storage.keys[thread_offset + i] = keys[i];
+            }
+            store_values(values, thread_offset, storage, with_values_type());
+            ::rocprim::wave_barrier();
+
+            const unsigned int run_items = run_threads * ItemsPerThread;
+            const unsigned int pair_offset = (lane & ~(2 * run_threads - 1)) * ItemsPerThread;
+            const unsigned int keys1_begin = ::rocprim::min(valid, pair_offset);
+            const unsigned int keys1_end = ::rocprim::min(valid, pair_offset + run_items);
+            const unsigned int keys2_end = ::rocprim::min(valid, pair_offset + 2 * run_items);
+            const unsigned int diag = thread_begin - keys1_begin;
+
+            const unsigned int split = ::rocprim::detail::merge_path(&storage.keys[keys1_begin],
+                                                                     &storage.keys[keys1_end],
+                                                                     keys1_end - keys1_begin,
+                                                                     keys2_end - keys1_end,
+                                                                     diag,
+                                                                     compare_function);
+            unsigned int begin1 = keys1_begin + split;
+            unsigned int begin2 = keys1_end + diag - split;
+
+            // Only the remaining items of the runs are read, the outputs at positions
+            // past the valid items are not written
+            Key key1;
+            Key key2;
+            if(begin1 < keys1_end) key1 = storage.keys[begin1];
+            if(begin2 < keys2_end) key2 = storage.keys[begin2];
+            ROCPRIM_UNROLL
+            for(unsigned int i = 0; i < ItemsPerThread; i++)
+            {
+                const bool has1 = begin1 < keys1_end;
+                const bool has2 = begin2 < keys2_end;
+                if(has1 || has2)
+                {
+                    const bool take1 = has1 && (!has2 || !compare_function(key2, key1));
+                    if(take1)
+                    {
+                        keys[i] = key1;
+                        load_value(values[i], begin1, storage, with_values_type());
+                        if(++begin1 < keys1_end) key1 = storage.keys[begin1];
+                    }
+                    else
+                    {
+                        keys[i] = key2;
+                        load_value(values[i], begin2, storage, with_values_type());
+                        if(++begin2 < keys2_end) key2 = storage.keys[begin2];
+                    }
+                }
+            }
+        }
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group warpmodule
+
+#endif // ROCPRIM_WARP_WARP_MERGE_SORT_HPP_
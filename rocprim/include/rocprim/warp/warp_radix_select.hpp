@@ -0,0 +1,468 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef ROCPRIM_WARP_WARP_RADIX_SELECT_HPP_
+#define ROCPRIM_WARP_WARP_RADIX_SELECT_HPP_
+
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/radix_sort.hpp"
+#include "../detail/various.hpp"
+
+#include "../intrinsics.hpp"
+#include "../functional.hpp"
+#include "../types.hpp"
+
+/// \addtogroup warpmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+template<class Key, class Value, unsigned int Size>
+struct warp_radix_select_storage
+{
+    Key   keys[Size];
+    Value values[Size];
+};
+
+template<class Key, unsigned int Size>
+struct warp_radix_select_storage<Key, empty_type, Size>
+{
+    Key keys[Size];
+};
+
+} // end namespace detail
+
+/// \brief The warp_radix_select class provides warp-wide methods for moving the \p k smallest
+/// (or largest) items of a warp to the front of the warp, without sorting the whole warp.
+///
+/// \tparam Key - the key type.
+/// \tparam ItemsPerThread - the number of items held by each thread, it can be any number.
+/// \tparam WarpSize - [optional] the number of threads in a warp.
+/// \tparam Value - [optional] the value type. By default, it's empty_type (keys only).
+///
+/// \par Overview
+/// * \p Key type must be an arithmetic type (that is, an integral type or a floating-point
+/// type). Keys are ordered as by \p warp_radix_sort.
+/// * \p WarpSize must be power of two and equal to or less than the size of hardware warp (see
+/// rocprim::device_warp_size()). If it is less, selection is performed separately within groups
+/// determined by \p WarpSize.
+/// * The k-th key is found bit by bit starting from the most significant one, the keys matching
+/// the bits found so far are counted with ballots and bit counts, so no shared memory is used
+/// until the selected items are compacted to the front of the warp.
+/// * The keys before the k-th key and the first ties of it are moved to the first \p k
+/// positions, and the other items after them, both in their blocked order. The first \p k
+/// items are not sorted.
+/// * The selection can be limited to the first \p valid items of the warp (in the blocked
+/// arrangement), the items at and past \p valid are not compared and keep their positions.
+///
+/// \par Example:
+/// \parblock
+/// In the example logical warps of 32 threads select the 8 largest of their 128 keys.
+///
+/// \code{.cpp}
+/// __global__ void example_kernel(...)
+/// {
+///     using warp_select_type = rocprim::warp_radix_select<float, 4, 32>;
+///     constexpr unsigned int warps_per_block = 256 / 32;
+///     __shared__ typename warp_select_type::storage_type storage[warps_per_block];
+///
+///     const unsigned int warp_id = threadIdx.x / 32;
+///     float keys[4];
+///     ...
+///     warp_select_type().select_desc(keys, 8, storage[warp_id]);
+///     // the first 8 keys of the warp (lanes 0 and 1) are the 8 largest ones
+///     ...
+/// }
+/// \endcode
+/// \endparblock
+template<
+    class Key,
+    unsigned int ItemsPerThread,
+    unsigned int WarpSize = device_warp_size(),
+    class Value = empty_type
+>
+class warp_radix_select
+{
+    static_assert(::rocprim::detail::is_power_of_two(WarpSize),
+                  "Logical warp size must be a power of two.");
+    static_assert(WarpSize <= ::rocprim::device_warp_size(),
+                  "Logical warp size cannot be larger than physical warp size.");
+
+    static constexpr unsigned int items_per_warp = WarpSize * ItemsPerThread;
+
+    using bit_key_type = typename ::rocprim::detail::radix_key_codec<Key>::bit_key_type;
+
+    using storage_type_ = detail::warp_radix_select_storage<Key, Value, items_per_warp>;
+
+public:
+    /// \brief Struct used to allocate a temporary memory that is required for thread
+    /// communication during operations provided by related parallel primitive.
+    ///
+    /// Depending on the implemention the operations exposed by parallel primitive may
+    /// require a temporary storage for thread communication. The storage should be allocated
+    /// using keywords \p __shared__. It can be aliased to
+    /// an externally allocated memory, or be a part of a union with other storage types
+    /// to increase shared memory reusability. Every logical warp needs its own storage.
+    using storage_type = detail::raw_storage<storage_type_>;
+
+    /// \brief Moves the \p k smallest keys of the warp to the first \p k positions.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in] k - number of selected keys.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void select(Key (&keys)[ItemsPerThread], unsigned int k, storage_type& storage)
+    {
+        empty_type values[ItemsPerThread];
+        select_impl<false>(keys, values, k, items_per_warp, storage.get());
+    }
+
+    /// \brief Moves the \p k smallest of the first \p valid keys of the warp to the first
+    /// \p k positions.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in] k - number of selected keys.
+    /// \param [in] valid - number of valid items in the warp, the items in blocked positions
+    /// at and past it keep their positions.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void select(Key (&keys)[ItemsPerThread],
+                unsigned int k,
+                unsigned int valid,
+                storage_type& storage)
+    {
+        empty_type values[ItemsPerThread];
+        select_impl<false>(keys, values, k, valid, storage.get());
+    }
+
+    /// \brief Moves the \p k items of the warp with the smallest keys to the first \p k
+    /// positions.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in, out] values - reference to an array of values provided by a thread.
+    /// \param [in] k - number of selected items.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void select(Key (&keys)[ItemsPerThread],
+                Value (&values)[ItemsPerThread],
+                unsigned int k,
+                storage_type& storage)
+    {
+        select_impl<false>(keys, values, k, items_per_warp, storage.get());
+    }
+
+    /// \brief Moves the \p k of the first \p valid items of the warp with the smallest keys
+    /// to the first \p k positions.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in, out] values - reference to an array of values provided by a thread.
+    /// \param [in] k - number of selected items.
+    /// \param [in] valid - number of valid items in the warp, the items in blocked positions
+    /// at and past it keep their positions.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void select(Key (&keys)[ItemsPerThread],
+                Value (&values)[ItemsPerThread],
+                unsigned int k,
+                unsigned int valid,
+                storage_type& storage)
+    {
+        select_impl<false>(keys, values, k, valid, storage.get());
+    }
+
+    /// \brief Moves the \p k largest keys of the warp to the first \p k positions.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in] k - number of selected keys.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void select_desc(Key (&keys)[ItemsPerThread], unsigned int k, storage_type& storage)
+    {
+        empty_type values[ItemsPerThread];
+        select_impl<true>(keys, values, k, items_per_warp, storage.get());
+    }
+
+    /// \brief Moves the \p k largest of the first \p valid keys of the warp to the first
+    /// \p k positions.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in] k - number of selected keys.
+    /// \param [in] valid - number of valid items in the warp, the items in blocked positions
+    /// at and past it keep their positions.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void select_desc(Key (&keys)[ItemsPerThread],
+                     unsigned int k,
+                     unsigned int valid,
+                     storage_type& storage)
+    {
+        empty_type values[ItemsPerThread];
+        select_impl<true>(keys, values, k, valid, storage.get());
+    }
+
+    /// \brief Moves the \p k items of the warp with the largest keys to the first \p k
+    /// positions.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in, out] values - reference to an array of values provided by a thread.
+    /// \param [in] k - number of selected items.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void select_desc(Key (&keys)[ItemsPerThread],
+                     Value (&values)[ItemsPerThread],
+                     unsigned int k,
+                     storage_type& storage)
+    {
+        select_impl<true>(keys, values, k, items_per_warp, storage.get());
+    }
+
+    /// \brief Moves the \p k of the first \p valid items of the warp with the largest keys
+    /// to the first \p k positions.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in, out] values - reference to an array of values provided by a thread.
+    /// \param [in] k - number of selected items.
+    /// \param [in] valid - number of valid items in the warp, the items in blocked positions
+    /// at and past it keep their positions.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void select_desc(Key (&keys)[ItemsPerThread],
+                     Value (&values)[ItemsPerThread],
+                     unsigned int k,
+                     unsigned int valid,
+                     storage_type& storage)
+    {
+        select_impl<true>(keys, values, k, valid, storage.get());
+    }
+
+private:
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static lane_mask_type logical_warp_mask()
+    {
+        constexpr unsigned int mask_bits = 8 * sizeof(lane_mask_type);
+        const unsigned int first_lane
+            = ::rocprim::lane_id() - ::rocprim::detail::logical_lane_id<WarpSize>();
+        return (~lane_mask_type(0) >> (mask_bits - WarpSize)) << first_lane;
+    }
+
+    // Number of items of the warp that satisfy their predicates
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static unsigned int warp_count(const bool (&predicates)[ItemsPerThread],
+                                   const lane_mask_type warp_mask)
+    {
+        unsigned int count = 0;
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            count += ::rocprim::bit_count(::rocprim::ballot(predicates[i]) & warp_mask);
+        }
+        return count;
+    }
+
+    // Number of items of the lower lanes of the warp that satisfy their predicates
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static unsigned int lanes_before_count(const bool (&predicates)[ItemsPerThread],
+                                           const lane_mask_type warp_mask)
+    {
+        unsigned int count = 0;
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            count = ::rocprim::masked_bit_count(::rocprim::ballot(predicates[i]) & warp_mask,
+                                                count);
+        }
+        return count;
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static void store_value(const Value& value,
+                            const unsigned int index,
+                            storage_type_& storage,
+                            std::true_type)
+    {
+        storage.values[index] = value;
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static void store_value(const empty_type&, const unsigned int, storage_type_&, std::false_type)
+    {}
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static void load_value(Value& value,
+                           const unsigned int index,
+                           storage_type_& storage,
+                           std::true_type)
+    {
+        value = storage.values[index];
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static void load_value(empty_type&, const unsigned int, storage_type_&, std::false_type)
+    {}
+
+    template<bool Descending, class V>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void select_impl(Key (&keys)[ItemsPerThread],
+                     V (&values)[ItemsPerThread],
+                     unsigned int k,
+                     unsigned int valid,
+                     storage_type_& storage)
+    {
+        using codec = ::rocprim::detail::radix_key_codec<Key, Descending>;
+        using with_values_type = std::integral_constant<bool, !std::is_same<V, empty_type>::value>;
+
+        valid = ::rocprim::min(valid, items_per_warp);
+        // No items or all of them are selected, they are already in place
+        if(k == 0 || k >= valid)
+        {
+            return;
+        }
+
+        const unsigned int lane = ::rocprim::detail::logical_lane_id<WarpSize>();
+        const unsigned int thread_offset = lane * ItemsPerThread;
+        const lane_mask_type warp_mask = logical_warp_mask();
+
+        bit_key_type bit_keys[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            bit_keys[i] = ::rocprim::detail::radix_select_encode<codec>(keys[i]);
+        }
+
+        // Bits of the k-th key found so far, and the number of keys equal to it which are
+        // needed to reach k. The counts are the same in all lanes, so they finish together.
+        bit_key_type prefix = 0;
+        bit_key_type prefix_mask = 0;
+        unsigned int remaining = k;
+        for(unsigned int bit = codec::key_bits; bit > 0;)
+        {
+            bit--;
+            const bit_key_type bit_mask = static_cast<bit_key_type>(bit_key_type(1) << bit);
+
+            bool matches[ItemsPerThread];
+            bool zeros[ItemsPerThread];
+            ROCPRIM_UNROLL
+            for(unsigned int i = 0; i < ItemsPerThread; i++)
+            {
+                matches[i] = thread_offset + i < valid
+                             && static_cast<bit_key_type>(bit_keys[i] & prefix_mask) == prefix;
+                zeros[i] = matches[i] && (bit_keys[i] & bit_mask) == 0;
+            }
+            const unsigned int zero_count = warp_count(zeros, warp_mask);
+
+            prefix_mask |= bit_mask;
+            unsigned int count = zero_count;
+            if(remaining > zero_count)
+            {
+                prefix |= bit_mask;
+                remaining -= zero_count;
+                count = warp_count(matches, warp_mask) - zero_count;
+            }
+            // Every key with the bits found so far is selected, the lower bits do not matter
+            if(count == remaining)
+            {
+                break;
+            }
+        }
+
+        // The keys before the k-th key and the first ties go to the front in their blocked
+        // order, the other valid items after them
+        bool less[ItemsPerThread];
+        bool ties[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            const bit_key_type masked_key = static_cast<bit_key_type>(bit_keys[i] & prefix_mask);
+            less[i] = thread_offset + i < valid && masked_key < prefix;
+            ties[i] = thread_offset + i < valid && masked_key == prefix;
+        }
+        unsigned int less_before = lanes_before_count(less, warp_mask);
+        unsigned int ties_before = lanes_before_count(ties, warp_mask);
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            const unsigned int position = thread_offset + i;
+            const unsigned int selected_before
+                = less_before + ::rocprim::min(ties_before, remaining);
+            const bool selected = less[i] || (ties[i] && ties_before < remaining);
+            const unsigned int rank = position >= valid ? position
+                                      : selected        ? selected_before
+                                                        : k + position - selected_before;
+            storage.keys[rank] = keys[i];
+            store_value(values[i], rank, storage, with_values_type());
+            less_before += less[i] ? 1 : 0;
+            ties_before += ties[i] ? 1 : 0;
+        }
+        ::rocprim::wave_barrier();
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            keys[i] = storage.keys[thread_offset + i];
+            load_value(values[i], thread_offset + i, storage, with_values_type());
+        }
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group warpmodule
+
+#endif // ROCPRIM_WARP_WARP_RADIX_SELECT_HPP_
@@ -0,0 +1,543 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_WARP_WARP_RADIX_SORT_HPP_
+#define ROCPRIM_WARP_WARP_RADIX_SORT_HPP_
+
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/radix_sort.hpp"
+#include "../detail/various.hpp"
+
+#include "../intrinsics.hpp"
+#include "../functional.hpp"
+#include "../types.hpp"
+
+#include "warp_scan.hpp"
+
+/// \addtogroup warpmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+template<class BitKey, class Value, unsigned int Size, unsigned int RadixSize, class ScanStorage>
+struct warp_radix_sort_storage
+{
+    BitKey       keys[Size];
+    Value        values[Size];
+    unsigned int digit_counts[RadixSize];
+    ScanStorage  scan;
+};
+
+template<class BitKey, unsigned int Size, unsigned int RadixSize, class ScanStorage>
+struct warp_radix_sort_storage<BitKey, empty_type, Size, RadixSize, ScanStorage>
+{
+    BitKey       keys[Size];
+    unsigned int digit_counts[RadixSize];
+    ScanStorage  scan;
+};
+
+} // end namespace detail
+
+/// \brief The warp_radix_sort class provides warp-wide methods for computing a stable
+/// parallel radix sort of items in a blocked arrangement across thread warps.
+///
+/// \tparam Key - the key type.
+/// \tparam ItemsPerThread - the number of items held by each thread, it can be any number.
+/// \tparam WarpSize - [optional] the number of threads in a warp.
+/// \tparam Value - [optional] the value type. By default, it's empty_type (keys only).
+/// \tparam FloatOrder - [optional] the order of floating-point keys, see \p radix_float_order.
+/// \tparam Decomposer - [optional] decomposer of keys into their fields, see
+/// \p identity_decomposer.
+/// \tparam RadixBitsPerPass - [optional] the number of bits of the digits sorted by one pass,
+/// from 1 to 8, defaults to 4.
+///
+/// \par Overview
+/// * \p Key type must be an arithmetic type (that is, an integral type or a floating-point
+/// type), or a type that is decomposed into such types by \p Decomposer.
+/// * \p WarpSize must be power of two and equal to or less than the size of hardware warp (see
+/// rocprim::device_warp_size()). If it is less, sort is performed separately within groups
+/// determined by \p WarpSize.
+/// * Every pass ranks the digits of the warp by matching the lanes having the same digit with
+/// ballots and counting them in shared memory, then scatters the items to their ranks. Unlike
+/// the bitonic warp_sort, the number of instructions grows linearly with the number of items,
+/// so it is faster on integer keys when there are many items per warp.
+/// * The sort is stable: equivalent keys keep the order of their blocked positions.
+/// * The sort can be limited to the first \p valid items of the warp (in the blocked
+/// arrangement), the items at and past \p valid keep their positions.
+///
+/// \par Example:
+/// \parblock
+/// In the example a logical warp of 32 threads sorts segments of up to 256 keys.
+///
+/// \code{.cpp}
+/// __global__ void example_kernel(...)
+/// {
+///     using warp_sort_type = rocprim::warp_radix_sort<unsigned int, 8, 32>;
+///     constexpr unsigned int warps_per_block = 256 / 32;
+///     __shared__ typename warp_sort_type::storage_type storage[warps_per_block];
+///
+///     const unsigned int warp_id = threadIdx.x / 32;
+///     unsigned int keys[8];
+///     unsigned int valid = ...; // not greater than 256
+///     ...
+///     warp_sort_type().sort(keys, valid, storage[warp_id]);
+///     ...
+/// }
+/// \endcode
+/// \endparblock
+template<
+    class Key,
+    unsigned int ItemsPerThread,
+    unsigned int WarpSize = device_warp_size(),
+    class Value = empty_type,
+    radix_float_order FloatOrder = radix_float_order::signed_zeros_equal,
+    class Decomposer = identity_decomposer,
+    unsigned int RadixBitsPerPass = 4
+>
+class warp_radix_sort
+{
+    static_assert(::rocprim::detail::is_power_of_two(WarpSize),
+                  "Logical warp size must be a power of two.");
+    static_assert(WarpSize <= ::rocprim::device_warp_size(),
+                  "Logical warp size cannot be larger than physical warp size.");
+    static_assert(RadixBitsPerPass >= 1 && RadixBitsPerPass <= 8,
+                  "RadixBitsPerPass must be in range [1; 8]");
+
+    static constexpr unsigned int items_per_warp = WarpSize * ItemsPerThread;
+    static constexpr unsigned int radix_size = 1u << RadixBitsPerPass;
+    // Every lane scans this number of consecutive digit counters
+    static constexpr unsigned int counters_per_lane
+        = ::rocprim::detail::ceiling_div(radix_size, WarpSize);
+
+    using bit_key_type =
+        typename ::rocprim::detail::radix_key_codec<Key, false, FloatOrder, Decomposer>::bit_key_type;
+    using counter_scan_type = ::rocprim::warp_scan<unsigned int, WarpSize>;
+
+    using storage_type_ = detail::warp_radix_sort_storage<bit_key_type,
+                                                          Value,
+                                                          items_per_warp,
+                                                          radix_size,
+                                                          typename counter_scan_type::storage_type>;
+
+public:
+    /// \brief Struct used to allocate a temporary memory that is required for thread
+    /// communication during operations provided by related parallel primitive.
+    ///
+    /// Depending on the implemention the operations exposed by parallel primitive may
+    /// require a temporary storage for thread communication. The storage should be allocated
+    /// using keywords \p __shared__. It can be aliased to
+    /// an externally allocated memory, or be a part of a union with other storage types
+    /// to increase shared memory reusability. Every logical warp needs its own storage.
+    using storage_type = detail::raw_storage<storage_type_>;
+
+    /// \brief Performs ascending radix sort over the keys of the warp.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+    /// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+    /// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+    /// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+    /// value: \p <tt>8 * sizeof(Key)</tt>.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort(Key (&keys)[ItemsPerThread],
+              storage_type& storage,
+              unsigned int begin_bit = 0,
+              unsigned int end_bit = 8 * sizeof(Key))
+    {
+        empty_type values[ItemsPerThread];
+        sort_impl<false>(keys, values, items_per_warp, storage.get(), begin_bit, end_bit);
+    }
+
+    /// \brief Performs ascending radix sort over the first \p valid keys of the warp.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in] valid - number of valid items in the warp, the items in blocked positions
+    /// at and past it keep their positions.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+    /// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+    /// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+    /// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+    /// value: \p <tt>8 * sizeof(Key)</tt>.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort(Key (&keys)[ItemsPerThread],
+              unsigned int valid,
+              storage_type& storage,
+              unsigned int begin_bit = 0,
+              unsigned int end_bit = 8 * sizeof(Key))
+    {
+        empty_type values[ItemsPerThread];
+        sort_impl<false>(keys, values, valid, storage.get(), begin_bit, end_bit);
+    }
+
+    /// \brief Performs ascending radix sort over the keys and the values of the warp
+    /// by the keys.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in, out] values - reference to an array of values provided by a thread.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+    /// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+    /// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+    /// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+    /// value: \p <tt>8 * sizeof(Key)</tt>.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort(Key (&keys)[ItemsPerThread],
+              Value (&values)[ItemsPerThread],
+              storage_type& storage,
+              unsigned int begin_bit = 0,
+              unsigned int end_bit = 8 * sizeof(Key))
+    {
+        sort_impl<false>(keys, values, items_per_warp, storage.get(), begin_bit, end_bit);
+    }
+
+    /// \brief Performs ascending radix sort over the first \p valid keys and values of
+    /// the warp by the keys.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in, out] values - reference to an array of values provided by a thread.
+    /// \param [in] valid - number of valid items in the warp, the items in blocked positions
+    /// at and past it keep their positions.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+    /// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+    /// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+    /// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+    /// value: \p <tt>8 * sizeof(Key)</tt>.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort(Key (&keys)[ItemsPerThread],
+              Value (&values)[ItemsPerThread],
+              unsigned int valid,
+              storage_type& storage,
+              unsigned int begin_bit = 0,
+              unsigned int end_bit = 8 * sizeof(Key))
+    {
+        sort_impl<false>(keys, values, valid, storage.get(), begin_bit, end_bit);
+    }
+
+    /// \brief Performs descending radix sort over the keys of the warp.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+    /// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+    /// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+    /// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+    /// value: \p <tt>8 * sizeof(Key)</tt>.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort_desc(Key (&keys)[ItemsPerThread],
+                   storage_type& storage,
+                   unsigned int begin_bit = 0,
+                   unsigned int end_bit = 8 * sizeof(Key))
+    {
+        empty_type values[ItemsPerThread];
+        sort_impl<true>(keys, values, items_per_warp, storage.get(), begin_bit, end_bit);
+    }
+
+    /// \brief Performs descending radix sort over the first \p valid keys of the warp.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in] valid - number of valid items in the warp, the items in blocked positions
+    /// at and past it keep their positions.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+    /// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+    /// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+    /// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+    /// value: \p <tt>8 * sizeof(Key)</tt>.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort_desc(Key (&keys)[ItemsPerThread],
+                   unsigned int valid,
+                   storage_type& storage,
+                   unsigned int begin_bit = 0,
+                   unsigned int end_bit = 8 * sizeof(Key))
+    {
+        empty_type values[ItemsPerThread];
+        sort_impl<true>(keys, values, valid, storage.get(), begin_bit, end_bit);
+    }
+
+    /// \brief Performs descending radix sort over the keys and the values of the warp
+    /// by the keys.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in, out] values - reference to an array of values provided by a thread.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+    /// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+    /// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+    /// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+    /// value: \p <tt>8 * sizeof(Key)</tt>.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort_desc(Key (&keys)[ItemsPerThread],
+                   Value (&values)[ItemsPerThread],
+                   storage_type& storage,
+                   unsigned int begin_bit = 0,
+                   unsigned int end_bit = 8 * sizeof(Key))
+    {
+        sort_impl<true>(keys, values, items_per_warp, storage.get(), begin_bit, end_bit);
+    }
+
+    /// \brief Performs descending radix sort over the first \p valid keys and values of
+    /// the warp by the keys.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in, out] values - reference to an array of values provided by a thread.
+    /// \param [in] valid - number of valid items in the warp, the items in blocked positions
+    /// at and past it keep their positions.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+    /// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+    /// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+    /// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+    /// value: \p <tt>8 * sizeof(Key)</tt>.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort_desc(Key (&keys)[ItemsPerThread],
+                   Value (&values)[ItemsPerThread],
+                   unsigned int valid,
+                   storage_type& storage,
+                   unsigned int begin_bit = 0,
+                   unsigned int end_bit = 8 * sizeof(Key))
+    {
+        sort_impl<true>(keys, values, valid, storage.get(), begin_bit, end_bit);
+    }
+
+private:
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static void store_value(const Value& value,
+                            const unsigned int index,
+                            storage_type_& storage,
+                            std::true_type)
+    {
+        storage.values[index] = value;
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static void store_value(const empty_type&, const unsigned int, storage_type_&, std::false_type)
+    {}
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static void load_value(Value& value,
+                           const unsigned int index,
+                           storage_type_& storage,
+                           std::true_type)
+    {
+        value = storage.values[index];
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static void load_value(empty_type&, const unsigned int, storage_type_&, std::false_type)
+    {}
+
+    // Lanes of the hardware warp that belong to the logical warp of the calling thread
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static lane_mask_type logical_warp_mask()
+    {
+        constexpr unsigned int mask_bits = 8 * sizeof(lane_mask_type);
+        const unsigned int first_lane
+            = ::rocprim::lane_id() - ::rocprim::detail::logical_lane_id<WarpSize>();
+        return (~lane_mask_type(0) >> (mask_bits - WarpSize)) << first_lane;
+    }
+
+    // Replaces the digit counters by their exclusive prefix sums
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static void scan_counters(const unsigned int lane, storage_type_& storage)
+    {
+        unsigned int counts[counters_per_lane];
+        unsigned int thread_count = 0;
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < counters_per_lane; i++)
+        {
+            const unsigned int digit = lane * counters_per_lane + i;
+            counts[i] = digit < radix_size ? storage.digit_counts[digit] : 0;
+            thread_count += counts[i];
+        }
+
+        unsigned int prefix;
+        counter_scan_type().exclusive_scan(thread_count, prefix, 0u, storage.scan);
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < counters_per_lane; i++)
+        {
+            const unsigned int digit = lane * counters_per_lane + i;
+            if(digit < radix_size)
+            {
+                storage.digit_counts[digit] = prefix;
+            }
+            prefix += counts[i];
+        }
+        ::rocprim::wave_barrier();
+    }
+
+    template<bool Descending, class V>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort_impl(Key (&keys)[ItemsPerThread],
+                   V (&values)[ItemsPerThread],
+                   unsigned int valid,
+                   storage_type_& storage,
+                   unsigned int begin_bit,
+                   unsigned int end_bit)
+    {
+        using codec = ::rocprim::detail::radix_key_codec<Key, Descending, FloatOrder, Decomposer>;
+        using with_values_type = std::integral_constant<bool, !std::is_same<V, empty_type>::value>;
+
+        if(begin_bit >= end_bit)
+        {
+            return;
+        }
+
+        const unsigned int lane = ::rocprim::detail::logical_lane_id<WarpSize>();
+        const lane_mask_type warp_mask = logical_warp_mask();
+
+        // The items are ranked in the striped arrangement, so the lanes having the same digit
+        // are matched in the order of the positions of their items
+        bit_key_type bit_keys[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            storage.keys[lane * ItemsPerThread + i] = codec::encode(keys[i]);
+            store_value(values[i], lane * ItemsPerThread + i, storage, with_values_type());
+        }
+        ::rocprim::wave_barrier();
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            bit_keys[i] = storage.keys[i * WarpSize + lane];
+            load_value(values[i], i * WarpSize + lane, storage, with_values_type());
+        }
+
+        for(unsigned int bit = begin_bit; bit < end_bit; bit += RadixBitsPerPass)
+        {
+            const unsigned int pass_bits = ::rocprim::min(RadixBitsPerPass, end_bit - bit);
+
+            ::rocprim::wave_barrier();
+            for(unsigned int digit = lane; digit < radix_size; digit += WarpSize)
+            {
+                storage.digit_counts[digit] = 0;
+            }
+            ::rocprim::wave_barrier();
+
+            unsigned int digits[ItemsPerThread];
+            unsigned int ranks[ItemsPerThread];
+            ROCPRIM_UNROLL
+            for(unsigned int i = 0; i < ItemsPerThread; i++)
+            {
+                // The items past the valid ones have the last digit, so they stay after
+                // all valid items and keep their order
+                const bool is_valid = i * WarpSize + lane < valid;
+                const unsigned int digit
+                    = is_valid ? codec::extract_digit(bit_keys[i], bit, pass_bits) : radix_size - 1;
+                digits[i] = digit;
+
+                lane_mask_type peers = warp_mask;
+                ROCPRIM_UNROLL
+                for(unsigned int b = 0; b < RadixBitsPerPass; b++)
+                {
+                    const bool bit_set = (digit & (1u << b)) != 0;
+                    const lane_mask_type bit_mask = ::rocprim::ballot(bit_set);
+                    peers &= bit_set ? bit_mask : ~bit_mask;
+                }
+                const unsigned int peers_before = ::rocprim::masked_bit_count(peers);
+
+                unsigned int& counter = storage.digit_counts[digit];
+                const unsigned int warp_count = counter;
+                ::rocprim::wave_barrier();
+                if(peers_before == 0)
+                {
+                    counter = warp_count + ::rocprim::bit_count(peers);
+                }
+                ::rocprim::wave_barrier();
+                ranks[i] = warp_count + peers_before;
+            }
+
+            scan_counters(lane, storage);
+
+            ROCPRIM_UNROLL
+            for(unsigned int i = 0; i < ItemsPerThread; i++)
+            {
+                const unsigned int rank = ranks[i] + storage.digit_counts[digits[i]];
+                storage.keys[rank] = bit_keys[i];
+                store_value(values[i], rank, storage, with_values_type());
+            }
+            ::rocprim::wave_barrier();
+
+            // The last pass reads the sorted items back in the blocked arrangement
+            const bool last_pass = bit + pass_bits >= end_bit;
+            ROCPRIM_UNROLL
+            for(unsigned int i = 0; i < ItemsPerThread; i++)
+            {
+                const unsigned int index
+                    = last_pass ? lane * ItemsPerThread + i : i * WarpSize + lane;
+                bit_keys[i] = storage.keys[index];
+                load_value(values[i], index, storage, with_values_type());
+            }
+        }
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            keys[i] = codec::decode(bit_keys[i]);
+        }
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group warpmodule
+
+#endif // ROCPRIM_WARP_WARP_RADIX_SORT_HPP_
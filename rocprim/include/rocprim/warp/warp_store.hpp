@@ -54,6 +54,8 @@ enum class warp_store_method
     /// * Performance remains high due to increased memory coalescing, provided that
     /// vectorization requirements are fulfilled. Otherwise, performance will default
     /// to \p warp_store_direct.
+    /// * When the output is guarded by \p valid, the threads whose items are all valid still
+    /// store them as vectors.
     /// \par Requirements:
     /// * The output offset (\p block_output) must be quad-item aligned.
     /// * The following conditions will prevent vectorization and switch to default
@@ -146,6 +148,50 @@ public:
     using storage_type = storage_type_; // only for Doxygen
     #endif
 
+    /// \brief Stores an arrangement of items from across the warp into an
+    /// arrangement on continuous memory.
+    ///
+    /// \tparam OutputIterator - [inferred] an iterator type for output (can be a simple
+    /// pointer.
+    ///
+    /// \param [out] output - the output iterator to store to.
+    /// \param [in] items - array that data is read from.
+    ///
+    /// \par Overview
+    /// * The type \p T must be such that an object of type \p OutputIterator
+    /// can be dereferenced and then implicitly assigned from \p T.
+    template<class OutputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store(OutputIterator output,
+               T (&items)[ItemsPerThread])
+    {
+        storage_type storage;
+        store(output, items, storage);
+    }
+
+    /// \brief Stores an arrangement of items from across the warp into an
+    /// arrangement on continuous memory, which is guarded by range \p valid.
+    ///
+    /// \tparam OutputIterator - [inferred] an iterator type for output (can be a simple
+    /// pointer.
+    ///
+    /// \param [out] output - the output iterator to store to.
+    /// \param [in] items - array that data is read from.
+    /// \param [in] valid - maximum range of valid numbers to read.
+    ///
+    /// \par Overview
+    /// * The type \p T must be such that an object of type \p OutputIterator
+    /// can be dereferenced and then implicitly assigned from \p T.
+    template<class OutputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store(OutputIterator output,
+               T (&items)[ItemsPerThread],
+               unsigned int valid)
+    {
+        storage_type storage;
+        store(output, items, valid, storage);
+    }
+
     /// \brief Stores an arrangement of items from across the warp into an
     /// arrangement on continuous memory.
     ///
@@ -232,6 +278,25 @@ class warp_store<T, ItemsPerThread, WarpSize, warp_store_method::warp_store_stri
 public:
     using storage_type = typename ::rocprim::detail::empty_storage_type;
 
+    template<class OutputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store(OutputIterator output,
+               T (&items)[ItemsPerThread])
+    {
+        storage_type storage;
+        store(output, items, storage);
+    }
+
+    template<class OutputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store(OutputIterator output,
+               T (&items)[ItemsPerThread],
+               unsigned int valid)
+    {
+        storage_type storage;
+        store(output, items, valid, storage);
+    }
+
     template<class OutputIterator>
     ROCPRIM_DEVICE ROCPRIM_INLINE
     void store(OutputIterator output,
@@ -277,6 +342,60 @@ class warp_store<T, ItemsPerThread, WarpSize, warp_store_method::warp_store_vect
 public:
     using storage_type = typename ::rocprim::detail::empty_storage_type;
 
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store(T* output,
+               T (&items)[ItemsPerThread])
+    {
+        const unsigned int flat_id = ::rocprim::detail::logical_lane_id<WarpSize>();
+        block_store_direct_blocked_vectorized(flat_id, output, items);
+    }
+
+    // Threads whose items are all valid store them as vectors, only the thread with the last
+    // valid item stores its items one by one
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store(T* output,
+               T (&items)[ItemsPerThread],
+               unsigned int valid)
+    {
+        const unsigned int flat_id = ::rocprim::detail::logical_lane_id<WarpSize>();
+        if((flat_id + 1) * ItemsPerThread <= valid)
+        {
+            block_store_direct_blocked_vectorized(flat_id, output, items);
+        }
+        else
+        {
+            block_store_direct_blocked(flat_id, output, items, valid);
+        }
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store(T* output,
+               T (&items)[ItemsPerThread],
+               unsigned int valid,
+               storage_type& /*storage*/)
+    {
+        store(output, items, valid);
+    }
+
+    template<class OutputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store(OutputIterator output,
+               T (&items)[ItemsPerThread])
+    {
+        storage_type storage;
+        store(output, items, storage);
+    }
+
+    template<class OutputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store(OutputIterator output,
+               T (&items)[ItemsPerThread],
+               unsigned int valid)
+    {
+        storage_type storage;
+        store(output, items, valid, storage);
+    }
+
     ROCPRIM_DEVICE ROCPRIM_INLINE
     void store(T* output,
                T (&items)[ItemsPerThread],
@@ -28,6 +28,7 @@ installation and the correctness of the files
 """
 
 import json
+import math
 import re
 import argparse
 import os
@@ -39,7 +40,8 @@ from collections import defaultdict
 from typing import Dict, List
 from jinja2 import Environment, PackageLoader, select_autoescape
 
-TARGET_ARCHITECTURES = ['gfx803', 'gfx900', 'gfx906', 'gfx908', 'gfx90a', 'gfx1030']
+TARGET_ARCHITECTURES = ['gfx803', 'gfx900', 'gfx906', 'gfx908', 'gfx90a', 'gfx940', 'gfx941', 'gfx942',
+                        'gfx1030', 'gfx1100']
 # C++ typename used for optional types
 EMPTY_TYPENAME = "rocprim::empty_type"
 
@@ -167,6 +169,36 @@ class BenchmarksOfArchitecture:
             output[instance] = self.__get_best_benchmark(instance)
         return output
 
+    @property
+    def best_configs_by_size_bucket(self):
+        """
+        Returns a dictionary containing each instantion of the selection configuration which is
+        measured with more than one input size as a key, and a list of (max_size, single best
+        performing benchmark run of the size) pairs sorted by size as a value.
+
+        The boundary between the buckets of two measured sizes is their geometric mean, the
+        bucket of the largest size covers all larger inputs.
+        """
+        output = {}
+        for instance, benchmarks in self.benchmarks.items():
+            benchmarks_by_size = defaultdict(list)
+            for benchmark in benchmarks:
+                if 'size' in benchmark:
+                    benchmarks_by_size[benchmark['size']].append(benchmark)
+            if len(benchmarks_by_size) < 2:
+                continue
+            sizes = sorted(benchmarks_by_size.keys())
+            buckets = []
+            for index, size in enumerate(sizes):
+                if index + 1 < len(sizes):
+                    max_size = str(math.isqrt(size * sizes[index + 1]))
+                else:
+                    max_size = 'std::numeric_limits<size_t>::max()'
+                best_benchmark = max(benchmarks_by_size[size], key=lambda x: x['items_per_second'])
+                buckets.append((max_size, best_benchmark))
+            output[instance] = buckets
+        return output
+
     def __non_optional_selection_types(self):
         """
         Get a list of the non-optional selection types
@@ -209,6 +241,10 @@ class Algorithm:
     the configuration file.
     """
 
+    # Whether the template can emit size_bucketed_config tables, when the benchmarks are run
+    # with several input sizes
+    supports_size_buckets = False
+
     def __init__(self, fallback_entries):
         self.architectures: Dict(str, BenchmarksOfArchitecture) = {}
         self.fallback_entries = fallback_entries
@@ -228,7 +264,10 @@ class Algorithm:
         """
         
         algorithm_template = env.get_template(self.cpp_configuration_template_name)
-        rendered_template = algorithm_template.render(all_architectures=self.architectures.values())
+        has_size_buckets = self.supports_size_buckets and any(
+            arch.best_configs_by_size_bucket for arch in self.architectures.values())
+        rendered_template = algorithm_template.render(all_architectures=self.architectures.values(),
+                                                      has_size_buckets=has_size_buckets)
 
         return rendered_template
 
@@ -277,12 +316,14 @@ class AlgorithmDeviceRadixSort(Algorithm):
     config_selection_types = [
             SelectionType(name='key_type', is_optional=False),
             SelectionType(name='value_type', is_optional=True)]
+    supports_size_buckets = True
     def __init__(self, fallback_entries):
         Algorithm.__init__(self, fallback_entries)
 class AlgorithmDeviceReduce(Algorithm):
     algorithm_name = 'device_reduce'
     config_selection_types = [SelectionType(name='datatype', is_optional=False)]
     cpp_configuration_template_name = "reduce_config_template"
+    supports_size_buckets = True
     def __init__(self, fallback_entries):
         Algorithm.__init__(self, fallback_entries)
 
@@ -302,6 +343,41 @@ class AlgorithmDeviceScanByKey(Algorithm):
     def __init__(self, fallback_entries):
         Algorithm.__init__(self, fallback_entries)
 
+class AlgorithmDeviceReduceByKey(Algorithm):
+    algorithm_name = 'device_reduce_by_key'
+    cpp_configuration_template_name = 'reducebykey_config_template'
+    config_selection_types = [
+            SelectionType(name='key_type', is_optional=False),
+            SelectionType(name='value_type', is_optional=False)]
+    def __init__(self, fallback_entries):
+        Algorithm.__init__(self, fallback_entries)
+
+class AlgorithmDeviceSelect(Algorithm):
+    algorithm_name = 'device_select'
+    cpp_configuration_template_name = 'select_config_template'
+    config_selection_types = [SelectionType(name='key_type', is_optional=False)]
+    def __init__(self, fallback_entries):
+        Algorithm.__init__(self, fallback_entries)
+
+class AlgorithmDeviceHistogram(Algorithm):
+    algorithm_name = 'device_histogram'
+    cpp_configuration_template_name = 'histogram_config_template'
+    config_selection_types = [
+            SelectionType(name='sample_type', is_optional=False),
+            SelectionType(name='channels', is_optional=False),
+            SelectionType(name='active_channels', is_optional=False)]
+    def __init__(self, fallback_entries):
+        Algorithm.__init__(self, fallback_entries)
+
+class AlgorithmDeviceSegmentedRadixSort(Algorithm):
+    algorithm_name = 'device_segmented_radix_sort'
+    cpp_configuration_template_name = 'segmentedradixsort_config_template'
+    config_selection_types = [
+            SelectionType(name='key_type', is_optional=False),
+            SelectionType(name='value_type', is_optional=True)]
+    def __init__(self, fallback_entries):
+        Algorithm.__init__(self, fallback_entries)
+
 def create_algorithm(algorithm_name: str, fallback_entries):
     if algorithm_name == 'device_merge_sort':
         return AlgorithmDeviceMergeSort(fallback_entries)
@@ -313,6 +389,14 @@ def create_algorithm(algorithm_name: str, fallback_entries):
         return AlgorithmDeviceScan(fallback_entries)
     elif algorithm_name == 'device_scan_by_key':  
         return AlgorithmDeviceScanByKey(fallback_entries)
+    elif algorithm_name == 'device_reduce_by_key':
+        return AlgorithmDeviceReduceByKey(fallback_entries)
+    elif algorithm_name == 'device_select':
+        return AlgorithmDeviceSelect(fallback_entries)
+    elif algorithm_name == 'device_histogram':
+        return AlgorithmDeviceHistogram(fallback_entries)
+    elif algorithm_name == 'device_segmented_radix_sort':
+        return AlgorithmDeviceSegmentedRadixSort(fallback_entries)
     else:
         raise(NotSupportedError(f'Algorithm "{algorithm_name}" is not supported (yet)'))
 
@@ -400,8 +484,12 @@ class BenchmarkDataManager:
         try:
             arch = self.__get_target_architecture_from_context(benchmark_run_data)
             name_regex = benchmark_run_data['context']['autotune_config_pattern']
+            # The input size of all benchmarks of the run
+            size = benchmark_run_data['context'].get('size')
             for raw_single_benchmark in benchmark_run_data['benchmarks']:
                 single_benchmark = self.__get_single_benchmark(name_regex, raw_single_benchmark)
+                if size is not None:
+                    single_benchmark['size'] = int(size)
                 self.__add_benchmark_to_algorithm(single_benchmark, arch)
             print(f'INFO: Successfully processed file "{benchmark_run_file_path}"')
         except NotSupportedError as error:
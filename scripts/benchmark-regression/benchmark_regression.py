@@ -0,0 +1,227 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+"""
+This Python script runs a subset of the rocPRIM benchmarks and compares their results
+with a stored baseline. The `run` command writes the Google Benchmark JSON of every
+benchmark target with the properties of the device, the `compare` command reports the
+benchmarks which are slower than in the baseline by more than the threshold and the noise
+of the repetitions, summarized per algorithm. `compare` exits with 1 if any benchmark
+regressed, so it can gate upgrades.
+"""
+
+import argparse
+import json
+import math
+import os
+import re
+import statistics
+import subprocess
+import sys
+from collections import defaultdict
+from dataclasses import dataclass
+from typing import Dict, List
+
+# Context keys written by add_common_benchmark_info() which must match to compare runs
+DEVICE_KEYS = ['hdp_name', 'hdp_gcn_arch_name', 'hdp_multi_processor_count']
+
+TIME_UNITS = {'ns': 1e-9, 'us': 1e-6, 'ms': 1e-3, 's': 1.0}
+
+
+@dataclass
+class Measurement:
+    """
+    The repetitions of one benchmark, times are in seconds.
+    """
+    times: List[float]
+
+    @property
+    def median(self) -> float:
+        return statistics.median(self.times)
+
+    @property
+    def relative_noise(self) -> float:
+        """
+        The median absolute deviation relative to the median, it is robust to outliers.
+        """
+        if len(self.times) < 2 or self.median == 0:
+            return 0.0
+        deviation = statistics.median([abs(t - self.median) for t in self.times])
+        return deviation / self.median
+
+
+def run_benchmarks(args) -> int:
+    os.makedirs(args.output_dir, exist_ok=True)
+    failed = False
+    for target in args.targets.split(','):
+        executable = os.path.join(args.benchmark_dir, target)
+        if not os.path.exists(executable):
+            print(f'{executable} does not exist, is the target built?', file=sys.stderr)
+            failed = True
+            continue
+        output = os.path.join(args.output_dir, f'{target}.json')
+        command = [executable,
+                   f'--benchmark_out={output}',
+                   '--benchmark_out_format=json',
+                   f'--benchmark_repetitions={args.repetitions}']
+        if args.filter:
+            command.append(f'--benchmark_filter={args.filter}')
+        command += args.benchmark_args
+        print(' '.join(command), flush=True)
+        if subprocess.call(command) != 0:
+            print(f'{target} failed', file=sys.stderr)
+            failed = True
+    return 1 if failed else 0
+
+
+def load_results(path: str) -> Dict[str, dict]:
+    """
+    Loads the JSON files of a file or a directory, keyed by the name of the file.
+    """
+    if os.path.isdir(path):
+        files = sorted(os.path.join(path, name) for name in os.listdir(path)
+                       if name.endswith('.json'))
+    else:
+        files = [path]
+    results = {}
+    for file in files:
+        with open(file) as f:
+            results[os.path.basename(file)] = json.load(f)
+    return results
+
+
+def get_measurements(result: dict) -> Dict[str, Measurement]:
+    measurements = defaultdict(lambda: Measurement([]))
+    for benchmark in result.get('benchmarks', []):
+        # Aggregates (mean, median, stddev) are recomputed from the repetitions
+        if benchmark.get('run_type') == 'aggregate' or 'error_occurred' in benchmark:
+            continue
+        name = benchmark.get('run_name', benchmark['name'])
+        unit = TIME_UNITS[benchmark.get('time_unit', 'ns')]
+        measurements[name].times.append(benchmark['real_time'] * unit)
+    return dict(measurements)
+
+
+def get_algorithm(name: str) -> str:
+    """
+    The algorithm of a benchmark is the part of its name before the template arguments,
+    for example `device_radix_sort_keys` of `device_radix_sort_keys<int>(...)`.
+    """
+    return re.split(r'[<(/]', name, maxsplit=1)[0]
+
+
+def check_device(baseline: dict, current: dict, file: str) -> bool:
+    baseline_context = baseline.get('context', {})
+    current_context = current.get('context', {})
+    matching = True
+    for key in DEVICE_KEYS:
+        if baseline_context.get(key) != current_context.get(key):
+            print(f'{file}: {key} differs, baseline: {baseline_context.get(key)}, '
+                  f'current: {current_context.get(key)}', file=sys.stderr)
+            matching = False
+    return matching
+
+
+def compare_results(args) -> int:
+    baseline_results = load_results(args.baseline)
+    current_results = load_results(args.current)
+
+    regressions = []
+    ratios = defaultdict(list)
+    missing = 0
+    for file, current in sorted(current_results.items()):
+        baseline = baseline_results.get(file)
+        if baseline is None:
+            print(f'{file}: no baseline', file=sys.stderr)
+            continue
+        if not check_device(baseline, current, file) and not args.ignore_device:
+            return 2
+        baseline_measurements = get_measurements(baseline)
+        for name, measurement in sorted(get_measurements(current).items()):
+            reference = baseline_measurements.get(name)
+            if reference is None or reference.median == 0:
+                missing += 1
+                continue
+            ratio = measurement.median / reference.median
+            ratios[get_algorithm(name)].append(ratio)
+            # The difference must exceed the threshold and the noise of both runs
+            threshold = max(args.threshold,
+                            args.noise_factor
+                            * (reference.relative_noise + measurement.relative_noise))
+            if ratio > 1.0 + threshold:
+                regressions.append((name, ratio, threshold))
+
+    print(f'{"algorithm":<48} {"benchmarks":>10} {"geomean":>8} {"min":>8} {"max":>8}')
+    for algorithm, values in sorted(ratios.items()):
+        geomean = math.exp(sum(math.log(v) for v in values) / len(values))
+        print(f'{algorithm:<48} {len(values):>10} {geomean:>8.3f} '
+              f'{min(values):>8.3f} {max(values):>8.3f}')
+    if missing:
+        print(f'{missing} benchmarks are not in the baseline')
+
+    if regressions:
+        print(f'\n{len(regressions)} regressions (time relative to the baseline):')
+        for name, ratio, threshold in regressions:
+            print(f'  {name}: {ratio:.3f} (threshold {1.0 + threshold:.3f})')
+        return 1
+    print('\nNo regressions')
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Runs rocPRIM benchmarks and compares them with a baseline')
+    subparsers = parser.add_subparsers(dest='command', required=True)
+
+    run_parser = subparsers.add_parser('run', help='run the benchmarks and store the JSON results')
+    run_parser.add_argument('--benchmark-dir', required=True,
+                            help='directory of the benchmark executables')
+    run_parser.add_argument('--output-dir', required=True,
+                            help='directory the JSON results are written to')
+    run_parser.add_argument('--targets', required=True,
+                            help='comma separated list of the benchmark targets')
+    run_parser.add_argument('--repetitions', type=int, default=5,
+                            help='repetitions of every benchmark, they measure the noise')
+    run_parser.add_argument('--filter', default='',
+                            help='regular expression of the benchmarks to run')
+    run_parser.add_argument('benchmark_args', nargs='*',
+                            help='additional arguments of the benchmarks, after --')
+    run_parser.set_defaults(function=run_benchmarks)
+
+    compare_parser = subparsers.add_parser('compare', help='compare results with a baseline')
+    compare_parser.add_argument('baseline', help='JSON file or directory of the baseline')
+    compare_parser.add_argument('current', help='JSON file or directory of the current results')
+    compare_parser.add_argument('--threshold', type=float, default=0.05,
+                                help='minimal relative slowdown reported as a regression')
+    compare_parser.add_argument('--noise-factor', type=float, default=3.0,
+                                help='multiple of the relative noise of the repetitions which '
+                                     'a slowdown must exceed')
+    compare_parser.add_argument('--ignore-device', action='store_true',
+                                help='compare results of different devices')
+    compare_parser.set_defaults(function=compare_results)
+
+    args = parser.parse_args()
+    sys.exit(args.function(args))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,364 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+"""
+This Python script reports the resources of the rocPRIM kernels compiled into HIP executables
+or AMDGPU code objects: registers, LDS, scratch and spills from the code object metadata, and
+the occupancy (waves per SIMD) they allow on the target of the code object. The code objects
+are extracted from the offload bundles of the `.hip_fatbin` section of the executables, and
+their metadata is read with `llvm-readelf --notes`.
+
+The occupancy is an estimate in the manner of the occupancy calculators. It is limited by the
+VGPRs, the SGPRs (on gfx9), the static LDS of the block and the waves of the target, dynamic
+LDS is not known from the metadata.
+"""
+
+import argparse
+import csv
+import math
+import os
+import re
+import shutil
+import struct
+import subprocess
+import sys
+import tempfile
+from dataclasses import dataclass
+from typing import Dict, List, Optional, Tuple
+
+BUNDLE_MAGIC = b'__CLANG_OFFLOAD_BUNDLE__'
+COMPRESSED_BUNDLE_MAGIC = b'CCOB'
+ELF_MAGIC = b'\x7fELF'
+EM_AMDGPU = 224
+
+
+@dataclass
+class Target:
+    """
+    The resources of a compute unit which limit the occupancy.
+    """
+    # VGPRs of a SIMD lane available to waves of 64 lanes (of 32 lanes on gfx10 and newer)
+    vgprs: int
+    vgpr_granule: int
+    max_waves: int
+    simds: int
+    lds: int
+    # SGPRs of a SIMD, 0 if the SGPRs do not limit the occupancy
+    sgprs: int = 0
+    sgpr_granule: int = 16
+    # The accumulation registers are allocated with the VGPRs
+    unified_agprs: bool = False
+    # The accumulation registers are a separate file of the same size as the VGPRs
+    separate_agprs: bool = False
+    native_wave_size: int = 64
+
+
+def get_target(arch: str) -> Target:
+    if arch in ('gfx90a', 'gfx940', 'gfx941', 'gfx942'):
+        return Target(512, 8, 8, 4, 65536, sgprs=800, unified_agprs=True)
+    if arch == 'gfx908':
+        return Target(256, 4, 10, 4, 65536, sgprs=800, separate_agprs=True)
+    if arch in ('gfx1100', 'gfx1101', 'gfx1151'):
+        return Target(1536, 24, 16, 2, 65536, native_wave_size=32)
+    if arch.startswith('gfx11'):
+        return Target(1024, 16, 16, 2, 65536, native_wave_size=32)
+    if arch.startswith('gfx10'):
+        return Target(1024, 8, 20, 2, 65536, native_wave_size=32)
+    # gfx8 and the other gfx9 targets
+    return Target(256, 4, 10, 4, 65536, sgprs=800)
+
+
+def round_up(value: int, granule: int) -> int:
+    return int(math.ceil(value / granule)) * granule
+
+
+@dataclass
+class Kernel:
+    name: str
+    arch: str
+    file: str
+    block_size: int
+    wave_size: int
+    vgprs: int
+    agprs: int
+    sgprs: int
+    lds: int
+    scratch: int
+    vgpr_spills: int
+    sgpr_spills: int
+
+    def occupancy(self) -> Tuple[int, str]:
+        """
+        Returns the waves per SIMD and the resource which limits them.
+        """
+        target = get_target(self.arch)
+        limits = [(target.max_waves, 'waves')]
+
+        registers = max(self.vgprs, 1)
+        if target.unified_agprs:
+            registers = round_up(registers, 4) + self.agprs
+        elif target.separate_agprs:
+            registers = max(registers, self.agprs)
+        # Waves wider than the SIMD use more registers of the file
+        available = target.vgprs * target.native_wave_size // max(self.wave_size, 1)
+        limits.append((available // round_up(registers, target.vgpr_granule), 'vgpr'))
+
+        if target.sgprs:
+            limits.append((target.sgprs // round_up(max(self.sgprs, 1), target.sgpr_granule),
+                           'sgpr'))
+
+        if self.lds > 0:
+            blocks = target.lds // self.lds
+            waves_per_block = int(math.ceil(self.block_size / max(self.wave_size, 1)))
+            limits.append((blocks * waves_per_block // target.simds, 'lds'))
+
+        waves, limiter = min(limits, key=lambda limit: limit[0])
+        return max(waves, 0), limiter
+
+
+def get_section(data: bytes, section_name: str) -> Optional[bytes]:
+    """
+    Returns the contents of a section of a 64-bit little endian ELF file.
+    """
+    if data[:4] != ELF_MAGIC or data[4] != 2 or data[5] != 1:
+        return None
+    shoff, = struct.unpack_from('<Q', data, 0x28)
+    shentsize, shnum, shstrndx = struct.unpack_from('<HHH', data, 0x3a)
+    sections = []
+    for index in range(shnum):
+        name, _, _, _, offset, size = struct.unpack_from('<IIQQQQ', data,
+                                                         shoff + index * shentsize)
+        sections.append((name, offset, size))
+    _, names_offset, _ = sections[shstrndx]
+    for name, offset, size in sections:
+        end = data.index(b'\0', names_offset + name)
+        if data[names_offset + name:end].decode() == section_name:
+            return data[offset:offset + size]
+    return None
+
+
+def get_code_objects(path: str) -> List[Tuple[str, bytes]]:
+    """
+    Returns the AMDGPU code objects of an executable or a code object, with their targets.
+    """
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:4] == ELF_MAGIC and struct.unpack_from('<H', data, 0x12)[0] == EM_AMDGPU:
+        return [('', data)]
+
+    fatbin = get_section(data, '.hip_fatbin')
+    if fatbin is None:
+        return []
+    if COMPRESSED_BUNDLE_MAGIC in fatbin and BUNDLE_MAGIC not in fatbin:
+        print(f'{path}: compressed offload bundles are not supported, build without '
+              '--offload-compress', file=sys.stderr)
+        return []
+
+    # Every translation unit adds a bundle, they are concatenated by the linker
+    code_objects = []
+    start = fatbin.find(BUNDLE_MAGIC)
+    while start >= 0:
+        entries, = struct.unpack_from('<Q', fatbin, start + len(BUNDLE_MAGIC))
+        position = start + len(BUNDLE_MAGIC) + 8
+        for _ in range(entries):
+            offset, size, triple_size = struct.unpack_from('<QQQ', fatbin, position)
+            position += 24
+            triple = fatbin[position:position + triple_size].decode()
+            position += triple_size
+            if triple.startswith('hip') and size > 0:
+                code_objects.append((triple, fatbin[start + offset:start + offset + size]))
+        start = fatbin.find(BUNDLE_MAGIC, position)
+    return code_objects
+
+
+def parse_metadata(notes: str) -> List[Dict[str, str]]:
+    """
+    Returns the scalar fields of the kernels of the YAML metadata printed by llvm-readelf.
+    """
+    kernels = []
+    kernel_indent = None
+    in_kernels = False
+    for line in notes.splitlines():
+        stripped = line.lstrip()
+        indent = len(line) - len(stripped)
+        if stripped.startswith('amdhsa.kernels:'):
+            in_kernels = True
+            continue
+        if not in_kernels or not stripped:
+            continue
+        if kernel_indent is None and stripped.startswith('- '):
+            kernel_indent = indent
+        if kernel_indent is None:
+            continue
+        if indent < kernel_indent or (indent == kernel_indent and not stripped.startswith('- ')):
+            in_kernels = False
+            continue
+        if indent == kernel_indent:
+            kernels.append({})
+            stripped = stripped[2:]
+            indent += 2
+        if indent == kernel_indent + 2 and ':' in stripped:
+            key, value = stripped.split(':', 1)
+            value = value.strip().strip("'\"")
+            if value:
+                kernels[-1][key.strip()] = value
+    return kernels
+
+
+def get_arch(metadata: str, triple: str) -> str:
+    match = re.search(r'amdhsa.target:\s*[\'"]?amdgcn-amd-amdhsa--(gfx\w+)', metadata)
+    if match is None:
+        match = re.search(r'(gfx\w+)', triple)
+    return match.group(1) if match else 'unknown'
+
+
+def demangle(names: List[str], cxxfilt: Optional[str]) -> Dict[str, str]:
+    if not cxxfilt or not names:
+        return {name: name for name in names}
+    result = subprocess.run([cxxfilt], input='\n'.join(names), capture_output=True, text=True,
+                            check=True)
+    return dict(zip(names, result.stdout.splitlines()))
+
+
+def find_tool(name: str, llvm_dir: Optional[str]) -> Optional[str]:
+    directories = [llvm_dir] if llvm_dir else []
+    directories.append(os.path.join(os.environ.get('ROCM_PATH', '/opt/rocm'), 'llvm', 'bin'))
+    for directory in directories:
+        path = os.path.join(directory, name)
+        if os.path.exists(path):
+            return path
+    return shutil.which(name)
+
+
+def get_kernels(paths: List[str], readelf: str) -> List[Kernel]:
+    kernels = []
+    with tempfile.TemporaryDirectory() as directory:
+        for path in paths:
+            code_objects = get_code_objects(path)
+            if not code_objects:
+                print(f'{path}: no AMDGPU code objects found', file=sys.stderr)
+            for index, (triple, code_object) in enumerate(code_objects):
+                code_object_path = os.path.join(directory, f'{index}.co')
+                with open(code_object_path, 'wb') as f:
+                    f.write(code_object)
+                notes = subprocess.run([readelf, '--notes', code_object_path],
+                                       capture_output=True, text=True, check=True).stdout
+                arch = get_arch(notes, triple)
+                for fields in parse_metadata(notes):
+                    def field(key: str) -> int:
+                        return int(fields.get(key, '0'))
+                    kernels.append(Kernel(
+                        name=fields.get('.name', fields.get('.symbol', '')),
+                        arch=arch,
+                        file=os.path.basename(path),
+                        block_size=field('.max_flat_workgroup_size'),
+                        wave_size=field('.wavefront_size') or 64,
+                        vgprs=field('.vgpr_count'),
+                        agprs=field('.agpr_count'),
+                        sgprs=field('.sgpr_count'),
+                        lds=field('.group_segment_fixed_size'),
+                        scratch=field('.private_segment_fixed_size'),
+                        vgpr_spills=field('.vgpr_spill_count'),
+                        sgpr_spills=field('.sgpr_spill_count')))
+    return kernels
+
+
+COLUMNS = ['kernel', 'arch', 'block', 'vgpr', 'agpr', 'sgpr', 'lds', 'scratch', 'vgpr_spill',
+           'sgpr_spill', 'waves', 'limiter']
+
+
+def get_rows(kernels: List[Kernel]) -> List[List[str]]:
+    rows = []
+    for kernel in kernels:
+        waves, limiter = kernel.occupancy()
+        rows.append([kernel.name, kernel.arch, kernel.block_size, kernel.vgprs, kernel.agprs,
+                     kernel.sgprs, kernel.lds, kernel.scratch, kernel.vgpr_spills,
+                     kernel.sgpr_spills, waves, limiter])
+    return [[str(value) for value in row] for row in rows]
+
+
+def shorten(name: str, width: int) -> str:
+    if width <= 0 or len(name) <= width:
+        return name
+    return name[:width - 3] + '...'
+
+
+def print_table(rows: List[List[str]], name_width: int, markdown: bool):
+    rows = [[shorten(row[0], name_width)] + row[1:] for row in rows]
+    widths = [max([len(column)] + [len(row[index]) for row in rows])
+              for index, column in enumerate(COLUMNS)]
+
+    def format_row(row):
+        cells = [row[0].ljust(widths[0])] + [cell.rjust(width)
+                                              for cell, width in zip(row[1:], widths[1:])]
+        return '| ' + ' | '.join(cells) + ' |' if markdown else '  '.join(cells)
+
+    print(format_row(COLUMNS))
+    if markdown:
+        print('|' + '|'.join('-' * (width + 2) for width in widths) + '|')
+    for row in rows:
+        print(format_row(row))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Reports the registers, LDS and occupancy of the rocPRIM kernels of HIP '
+                    'executables or code objects')
+    parser.add_argument('files', nargs='+', help='HIP executables or AMDGPU code objects')
+    parser.add_argument('--filter', default=r'rocprim::',
+                        help='regular expression of the (demangled) names of the reported kernels')
+    parser.add_argument('--csv', help='also write the full table as CSV to this file')
+    parser.add_argument('--markdown', action='store_true', help='print a Markdown table')
+    parser.add_argument('--name-width', type=int, default=100,
+                        help='kernel names are shortened to this width, 0 for full names')
+    parser.add_argument('--llvm-dir', help='directory of llvm-readelf and llvm-cxxfilt, the '
+                                           'default is $ROCM_PATH/llvm/bin')
+    args = parser.parse_args()
+
+    readelf = find_tool('llvm-readelf', args.llvm_dir)
+    if readelf is None:
+        print('llvm-readelf not found, use --llvm-dir', file=sys.stderr)
+        sys.exit(2)
+    kernels = get_kernels(args.files, readelf)
+
+    names = demangle(sorted({kernel.name for kernel in kernels}),
+                     find_tool('llvm-cxxfilt', args.llvm_dir))
+    filter_regex = re.compile(args.filter)
+    unique = {}
+    for kernel in kernels:
+        kernel.name = names[kernel.name]
+        # The same instantiation is compiled into many executables
+        if filter_regex.search(kernel.name):
+            unique.setdefault((kernel.name, kernel.arch), kernel)
+    kernels = sorted(unique.values(), key=lambda kernel: (kernel.arch, kernel.name))
+
+    rows = get_rows(kernels)
+    if args.csv:
+        with open(args.csv, 'w', newline='') as f:
+            writer = csv.writer(f)
+            writer.writerow(COLUMNS)
+            writer.writerows(rows)
+    print_table(rows, args.name_width, args.markdown)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,143 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+#include <cstdio>
+#include <numeric>
+
+// required rocprim headers
+#include <rocprim/device/autotune.hpp>
+#include <rocprim/device/device_reduce.hpp>
+#include <rocprim/functional.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+TEST(RocprimAutotuneTests, CachePersistence)
+{
+    const std::string path = "rocprim_autotune_cache_test.txt";
+    std::remove(path.c_str());
+    {
+        rocprim::autotune_cache cache(path);
+        ASSERT_EQ(cache.size(), size_t(0));
+        cache.insert("gfx000;reduce;i,;10;3", 2);
+        cache.insert("gfx000;reduce;i,;20;3", 0);
+        unsigned int index;
+        ASSERT_TRUE(cache.find("gfx000;reduce;i,;10;3", index));
+        ASSERT_EQ(index, 2u);
+        ASSERT_FALSE(cache.find("gfx000;reduce;f,;10;3", index));
+    }
+    {
+        // Another process loads the winners
+        rocprim::autotune_cache cache(path);
+        ASSERT_EQ(cache.size(), size_t(2));
+        unsigned int index;
+        ASSERT_TRUE(cache.find("gfx000;reduce;i,;20;3", index));
+        ASSERT_EQ(index, 0u);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(RocprimAutotuneTests, AutotunedReduce)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T          = int;
+    using algorithm  = rocprim::block_reduce_algorithm;
+    using candidates = rocprim::autotune_candidates<
+        rocprim::default_config,
+        rocprim::reduce_config<64, 2, algorithm::default_algorithm>,
+        rocprim::reduce_config<256, 8, algorithm::default_algorithm>>;
+
+    hipStream_t stream = 0; // default
+
+    // The winners are not persisted
+    rocprim::autotune_cache cache;
+
+    const std::vector<size_t> sizes = {100000, 123456, 1 << 20};
+    T*                       d_input;
+    T*                       d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, sizes.back() * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(T)));
+
+    for(const size_t size : sizes)
+    {
+        SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+        const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, size);
+        const T              expected = std::accumulate(input.begin(), input.end(), T(0));
+        HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+        auto run = [&](auto config, void* temporary_storage, size_t& storage_size)
+        {
+            return rocprim::reduce<decltype(config)>(temporary_storage,
+                                                     storage_size,
+                                                     d_input,
+                                                     d_output,
+                                                     size,
+                                                     rocprim::plus<T>(),
+                                                     stream);
+        };
+
+        size_t temporary_storage_bytes;
+        HIP_CHECK((rocprim::autotuned<candidates, T>(nullptr,
+                                                     temporary_storage_bytes,
+                                                     "reduce",
+                                                     size,
+                                                     run,
+                                                     stream,
+                                                     false,
+                                                     cache)));
+        void* d_temporary_storage;
+        HIP_CHECK(
+            test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+        // Tuned by the first call, the second one uses the cache
+        for(unsigned int call = 0; call < 2; call++)
+        {
+            SCOPED_TRACE(testing::Message() << "with call = " << call);
+            HIP_CHECK(hipMemset(d_output, 0, sizeof(T)));
+            HIP_CHECK((rocprim::autotuned<candidates, T>(d_temporary_storage,
+                                                         temporary_storage_bytes,
+                                                         "reduce",
+                                                         size,
+                                                         run,
+                                                         stream,
+                                                         false,
+                                                         cache)));
+            HIP_CHECK(hipGetLastError());
+            T output;
+            HIP_CHECK(hipMemcpy(&output, d_output, sizeof(T), hipMemcpyDeviceToHost));
+            ASSERT_EQ(output, expected);
+        }
+
+        HIP_CHECK(hipFree(d_temporary_storage));
+    }
+    // 100000 and 123456 are in the same size bucket
+    ASSERT_EQ(cache.size(), size_t(2));
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
@@ -0,0 +1,412 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+// required rocprim headers
+#include <rocprim/block/block_load.hpp>
+#include <rocprim/device/device_histogram.hpp>
+#include <rocprim/device/device_radix_sort.hpp>
+#include <rocprim/device/device_reduce.hpp>
+#include <rocprim/device/device_select.hpp>
+#include <rocprim/functional.hpp>
+#include <rocprim/iterator/bitpacked_iterator.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+template<unsigned int BitWidth>
+struct RocprimBitpackedIteratorParams
+{
+    static constexpr unsigned int bit_width = BitWidth;
+};
+
+template<class Params>
+class RocprimBitpackedIteratorTests : public ::testing::Test
+{
+public:
+    static constexpr unsigned int bit_width = Params::bit_width;
+};
+
+typedef ::testing::Types<RocprimBitpackedIteratorParams<3>,
+                         RocprimBitpackedIteratorParams<5>,
+                         RocprimBitpackedIteratorParams<8>,
+                         RocprimBitpackedIteratorParams<17>,
+                         RocprimBitpackedIteratorParams<32>>
+    RocprimBitpackedIteratorTestsParams;
+
+TYPED_TEST_SUITE(RocprimBitpackedIteratorTests, RocprimBitpackedIteratorTestsParams);
+
+// Packs the low BitWidth bits of the values, with one padding word for over-reads
+template<unsigned int BitWidth, class T>
+std::vector<unsigned int> pack_bits(const std::vector<T>& values)
+{
+    std::vector<unsigned int> words((values.size() * BitWidth + 31) / 32 + 1, 0u);
+    for(size_t i = 0; i < values.size(); i++)
+    {
+        const unsigned long long value = static_cast<unsigned long long>(values[i])
+                                         & ((1ull << BitWidth) - 1);
+        const size_t       bit   = i * BitWidth;
+        const unsigned int shift = bit % 32;
+        words[bit / 32] |= static_cast<unsigned int>(value << shift);
+        if(shift + BitWidth > 32)
+        {
+            words[bit / 32 + 1] |= static_cast<unsigned int>(value >> (32 - shift));
+        }
+    }
+    return words;
+}
+
+template<unsigned int BitWidth>
+std::vector<unsigned int> get_random_packable_data(size_t size, unsigned int seed_value)
+{
+    const unsigned int max_value = BitWidth == 32 ? ~0u : (1u << BitWidth) - 1;
+    return test_utils::get_random_data<unsigned int>(size, 0, max_value, seed_value);
+}
+
+TEST(RocprimBitpackedIteratorHostTests, Host)
+{
+    const std::vector<unsigned int> values = {5, 0, 7, 3, 1, 6, 2, 4, 7, 7, 0, 1};
+    const std::vector<unsigned int> words  = pack_bits<3>(values);
+
+    auto iterator = rocprim::make_bitpacked_iterator<3>(words.data());
+    for(size_t i = 0; i < values.size(); i++)
+    {
+        ASSERT_EQ(iterator[i], values[i]) << "where index = " << i;
+    }
+    // Value 10 spans the first two words
+    ASSERT_EQ(*(iterator + 10), 0u);
+    ASSERT_EQ((iterator + 12) - iterator, 12);
+    ASSERT_EQ(std::accumulate(iterator, iterator + 12, 0u), 43u);
+
+    const std::vector<int> signed_values = {-4, 3, -1, 0, 2, -3};
+    const std::vector<unsigned int> signed_words = pack_bits<3>(signed_values);
+    auto signed_iterator = rocprim::make_bitpacked_iterator<3, int>(signed_words.data());
+    for(size_t i = 0; i < signed_values.size(); i++)
+    {
+        ASSERT_EQ(signed_iterator[i], signed_values[i]) << "where index = " << i;
+    }
+}
+
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         rocprim::block_load_method Method,
+         unsigned int BitWidth>
+__global__ __launch_bounds__(BlockSize) void bitpacked_load_kernel(const unsigned int* words,
+                                                                   unsigned int*       output)
+{
+    using load_type = rocprim::block_load<unsigned int, BlockSize, ItemsPerThread, Method>;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    const unsigned int     offset          = blockIdx.x * items_per_block;
+
+    unsigned int items[ItemsPerThread];
+    load_type().load(rocprim::make_bitpacked_iterator<BitWidth>(words) + offset, items);
+
+    for(unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        output[offset + threadIdx.x * ItemsPerThread + item] = items[item];
+    }
+}
+
+template<unsigned int BitWidth,
+         unsigned int ItemsPerThread,
+         rocprim::block_load_method Method>
+void test_bitpacked_block_load()
+{
+    SCOPED_TRACE(testing::Message() << "with items_per_thread = " << ItemsPerThread);
+    SCOPED_TRACE(testing::Message() << "with method = " << int(Method));
+
+    constexpr unsigned int block_size      = 128;
+    constexpr unsigned int items_per_block = block_size * ItemsPerThread;
+    constexpr unsigned int blocks          = 13;
+    constexpr size_t       size            = items_per_block * blocks;
+
+    const std::vector<unsigned int> input = get_random_packable_data<BitWidth>(size, seeds[0]);
+    const std::vector<unsigned int> words = pack_bits<BitWidth>(input);
+
+    unsigned int* d_words;
+    unsigned int* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_words, words.size() * sizeof(unsigned int)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(unsigned int)));
+    HIP_CHECK(hipMemcpy(d_words,
+                        words.data(),
+                        words.size() * sizeof(unsigned int),
+                        hipMemcpyHostToDevice));
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(bitpacked_load_kernel<block_size, ItemsPerThread, Method, BitWidth>),
+        dim3(blocks),
+        dim3(block_size),
+        0,
+        0,
+        d_words,
+        d_output);
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<unsigned int> output(size);
+    HIP_CHECK(hipMemcpy(output.data(),
+                        d_output,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(output[i], input[i]) << "where index = " << i;
+    }
+
+    HIP_CHECK(hipFree(d_words));
+    HIP_CHECK(hipFree(d_output));
+}
+
+TYPED_TEST(RocprimBitpackedIteratorTests, BlockLoad)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    constexpr unsigned int bit_width = TestFixture::bit_width;
+
+    // 32 items of a thread fill whole words for every width, 3 items only for width 32
+    test_bitpacked_block_load<bit_width, 32, rocprim::block_load_method::block_load_vectorize>();
+    test_bitpacked_block_load<bit_width, 32, rocprim::block_load_method::block_load_transpose>();
+    test_bitpacked_block_load<bit_width, 3, rocprim::block_load_method::block_load_vectorize>();
+    test_bitpacked_block_load<bit_width, 4, rocprim::block_load_method::block_load_transpose>();
+}
+
+struct is_odd_op
+{
+    __device__ __host__
+    bool operator()(unsigned int value) const
+    {
+        return (value & 1u) != 0;
+    }
+};
+
+TYPED_TEST(RocprimBitpackedIteratorTests, DeviceAlgorithms)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    constexpr unsigned int bit_width = TestFixture::bit_width;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+            if(size == 0)
+            {
+                continue;
+            }
+
+            const std::vector<unsigned int> input
+                = get_random_packable_data<bit_width>(size, seed_value);
+            const std::vector<unsigned int> words = pack_bits<bit_width>(input);
+
+            unsigned int* d_words;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_words, words.size() * sizeof(unsigned int)));
+            HIP_CHECK(hipMemcpy(d_words,
+                                words.data(),
+                                words.size() * sizeof(unsigned int),
+                                hipMemcpyHostToDevice));
+            const auto packed = rocprim::make_bitpacked_iterator<bit_width>(d_words);
+
+            unsigned int* d_output;
+            unsigned int* d_count;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(unsigned int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_count, sizeof(unsigned int)));
+
+            // reduce
+            {
+                size_t temp_storage_size_bytes;
+                HIP_CHECK(rocprim::reduce(nullptr,
+                                          temp_storage_size_bytes,
+                                          packed,
+                                          d_output,
+                                          size,
+                                          rocprim::maximum<unsigned int>(),
+                                          stream));
+                void* d_temp_storage;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+                HIP_CHECK(rocprim::reduce(d_temp_storage,
+                                          temp_storage_size_bytes,
+                                          packed,
+                                          d_output,
+                                          size,
+                                          rocprim::maximum<unsigned int>(),
+                                          stream));
+                HIP_CHECK(hipGetLastError());
+
+                unsigned int output;
+                HIP_CHECK(
+                    hipMemcpy(&output, d_output, sizeof(unsigned int), hipMemcpyDeviceToHost));
+                ASSERT_EQ(output, *std::max_element(input.begin(), input.end()));
+                HIP_CHECK(hipFree(d_temp_storage));
+            }
+
+            // histogram_even of the top 4 bits
+            {
+                constexpr unsigned int bins  = 16;
+                const double           upper = bit_width == 32 ? 4294967296.0
+                                                               : double(1ull << bit_width);
+                std::vector<unsigned int> expected(bins, 0);
+                for(unsigned int value : input)
+                {
+                    expected[static_cast<size_t>(value / upper * bins)]++;
+                }
+
+                // The levels are bound to the range of the sample type
+                const unsigned long long upper_level = bit_width == 32 ? 0ull : 1ull << bit_width;
+                if(upper_level != 0)
+                {
+                    size_t temp_storage_size_bytes;
+                    HIP_CHECK(rocprim::histogram_even(nullptr,
+                                                      temp_storage_size_bytes,
+                                                      packed,
+                                                      size,
+                                                      d_output,
+                                                      bins + 1,
+                                                      0u,
+                                                      static_cast<unsigned int>(upper_level),
+                                                      stream));
+                    void* d_temp_storage;
+                    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage,
+                                                                 temp_storage_size_bytes));
+                    HIP_CHECK(rocprim::histogram_even(d_temp_storage,
+                                                      temp_storage_size_bytes,
+                                                      packed,
+                                                      size,
+                                                      d_output,
+                                                      bins + 1,
+                                                      0u,
+                                                      static_cast<unsigned int>(upper_level),
+                                                      stream));
+                    HIP_CHECK(hipGetLastError());
+
+                    std::vector<unsigned int> histogram(bins);
+                    HIP_CHECK(hipMemcpy(histogram.data(),
+                                        d_output,
+                                        bins * sizeof(unsigned int),
+                                        hipMemcpyDeviceToHost));
+                    ASSERT_EQ(histogram, expected);
+                    HIP_CHECK(hipFree(d_temp_storage));
+                }
+            }
+
+            // select the odd values
+            {
+                const is_odd_op is_odd;
+                std::vector<unsigned int> expected;
+                std::copy_if(input.begin(),
+                             input.end(),
+                             std::back_inserter(expected),
+                             is_odd);
+
+                size_t temp_storage_size_bytes;
+                HIP_CHECK(rocprim::select(nullptr,
+                                          temp_storage_size_bytes,
+                                          packed,
+                                          d_output,
+                                          d_count,
+                                          size,
+                                          is_odd,
+                                          stream));
+                void* d_temp_storage;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+                HIP_CHECK(rocprim::select(d_temp_storage,
+                                          temp_storage_size_bytes,
+                                          packed,
+                                          d_output,
+                                          d_count,
+                                          size,
+                                          is_odd,
+                                          stream));
+                HIP_CHECK(hipGetLastError());
+
+                unsigned int count;
+                HIP_CHECK(hipMemcpy(&count, d_count, sizeof(unsigned int), hipMemcpyDeviceToHost));
+                ASSERT_EQ(count, expected.size());
+                std::vector<unsigned int> output(count);
+                HIP_CHECK(hipMemcpy(output.data(),
+                                    d_output,
+                                    count * sizeof(unsigned int),
+                                    hipMemcpyDeviceToHost));
+                ASSERT_EQ(output, expected);
+                HIP_CHECK(hipFree(d_temp_storage));
+            }
+
+            // radix_sort_keys of the packed bits only
+            {
+                std::vector<unsigned int> expected = input;
+                std::sort(expected.begin(), expected.end());
+
+                size_t temp_storage_size_bytes;
+                HIP_CHECK(rocprim::radix_sort_keys(nullptr,
+                                                   temp_storage_size_bytes,
+                                                   packed,
+                                                   d_output,
+                                                   size,
+                                                   0,
+                                                   bit_width,
+                                                   stream));
+                void* d_temp_storage;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+                HIP_CHECK(rocprim::radix_sort_keys(d_temp_storage,
+                                                   temp_storage_size_bytes,
+                                                   packed,
+                                                   d_output,
+                                                   size,
+                                                   0,
+                                                   bit_width,
+                                                   stream));
+                HIP_CHECK(hipGetLastError());
+
+                std::vector<unsigned int> output(size);
+                HIP_CHECK(hipMemcpy(output.data(),
+                                    d_output,
+                                    size * sizeof(unsigned int),
+                                    hipMemcpyDeviceToHost));
+                ASSERT_EQ(output, expected);
+                HIP_CHECK(hipFree(d_temp_storage));
+            }
+
+            HIP_CHECK(hipFree(d_words));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_count));
+        }
+    }
+}
@@ -138,3 +138,37 @@ typed_test_def(RocprimBlockAdjacentDifference, name_suffix, SubtractRightPartial
     static_for<4, n_items, T, T, op_type_3, 6, block_size>::run();
     // clang-format on
 }
+
+typed_test_def(RocprimBlockAdjacentDifference, name_suffix, SubtractLeftSegmented)
+{
+    using T = typename TestFixture::params::input_type;
+
+    using op_type_1 = rocprim::minus<>;
+    using op_type_2 = rocprim::plus<>;
+    using op_type_3 = test_op<T>;
+
+    constexpr size_t block_size = TestFixture::params::block_size;
+
+    // clang-format off
+    static_for<0, 2,       T, T, op_type_1, 7, block_size>::run();
+    static_for<2, 4,       T, T, op_type_2, 7, block_size>::run();
+    static_for<4, n_items, T, T, op_type_3, 7, block_size>::run();
+    // clang-format on
+}
+
+typed_test_def(RocprimBlockAdjacentDifference, name_suffix, SubtractRightSegmented)
+{
+    using T = typename TestFixture::params::input_type;
+
+    using op_type_1 = rocprim::minus<>;
+    using op_type_2 = rocprim::plus<>;
+    using op_type_3 = test_op<T>;
+
+    constexpr size_t block_size = TestFixture::params::block_size;
+
+    // clang-format off
+    static_for<0, 2,       T, T, op_type_1, 8, block_size>::run();
+    static_for<2, 4,       T, T, op_type_2, 8, block_size>::run();
+    static_for<4, n_items, T, T, op_type_3, 8, block_size>::run();
+    // clang-format on
+}
@@ -237,6 +237,69 @@ void subtract_right_partial_kernel(const T* input, unsigned int* tile_sizes, Sto
     rocprim::block_store_direct_blocked(lid, output + block_offset, thread_output);
 }
 
+template<
+    typename T,
+    typename Output,
+    typename StorageType,
+    typename BinaryFunction,
+    bool Left,
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread
+>
+__global__
+__launch_bounds__(BlockSize, ROCPRIM_DEFAULT_MIN_WARPS_PER_EU)
+void subtract_segmented_kernel(const T* input, const int* flags, StorageType* output)
+{
+    const unsigned int lid = threadIdx.x;
+    const unsigned int items_per_block = BlockSize * ItemsPerThread;
+    const unsigned int block_offset = blockIdx.x * items_per_block;
+
+    T thread_items[ItemsPerThread];
+    rocprim::block_load_direct_blocked(lid, input + block_offset, thread_items);
+    int thread_flags[ItemsPerThread];
+    rocprim::block_load_direct_blocked(lid, flags + block_offset, thread_flags);
+
+    rocprim::block_adjacent_difference<T, BlockSize> adjacent_difference;
+    __shared__ typename decltype(adjacent_difference)::storage_type storage;
+
+    Output thread_output[ItemsPerThread];
+
+    // The odd blocks (left) or the even blocks (right) use the item of the neighbouring tile
+    const bool with_neighbour = blockIdx.x % 2 == (Left ? 1 : 0);
+    if(Left && with_neighbour)
+    {
+        const T tile_predecessor_item = input[block_offset - 1];
+        adjacent_difference.subtract_left_segmented(thread_items,
+                                                    thread_output,
+                                                    thread_flags,
+                                                    BinaryFunction{},
+                                                    tile_predecessor_item,
+                                                    storage);
+    }
+    else if(Left)
+    {
+        adjacent_difference.subtract_left_segmented(
+            thread_items, thread_output, thread_flags, BinaryFunction{}, storage);
+    }
+    else if(with_neighbour)
+    {
+        const T tile_successor_item = input[block_offset + items_per_block];
+        adjacent_difference.subtract_right_segmented(thread_items,
+                                                     thread_output,
+                                                     thread_flags,
+                                                     BinaryFunction{},
+                                                     tile_successor_item,
+                                                     storage);
+    }
+    else
+    {
+        adjacent_difference.subtract_right_segmented(
+            thread_items, thread_output, thread_flags, BinaryFunction{}, storage);
+    }
+
+    rocprim::block_store_direct_blocked(lid, output + block_offset, thread_output);
+}
+
 template<
     class Type,
     class FlagType,
@@ -1089,6 +1152,109 @@ auto test_block_adjacent_difference() -> typename std::enable_if<Method == 6>::t
     }
 }
 
+// Method 7 is the segmented subtract_left, method 8 is the segmented subtract_right
+template <typename T,
+          typename Output,
+          typename BinaryFunction,
+          unsigned int Method,
+          unsigned int BlockSize,
+          unsigned int ItemsPerThread>
+auto test_block_adjacent_difference() -> typename std::enable_if<Method == 7 || Method == 8>::type
+{
+    using stored_type = std::conditional_t<std::is_same<Output, bool>::value, int, Output>;
+
+    static constexpr bool left             = Method == 7;
+    static constexpr auto block_size       = BlockSize;
+    static constexpr auto items_per_thread = ItemsPerThread;
+    static constexpr auto items_per_block  = block_size * items_per_thread;
+    static constexpr auto grid_size        = 20;
+    static constexpr auto size             = grid_size * items_per_block;
+
+    SCOPED_TRACE(testing::Message() << "with block_size = " << block_size << ", items_per_thread = "
+                                    << items_per_thread << ", size = " << size);
+
+    // Given block size not supported
+    if(block_size > test_utils::get_max_block_size())
+    {
+        return;
+    }
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        const unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // Generate data
+        const std::vector<T>     input = test_utils::get_random_data<T>(size, 0, 10, seed_value);
+        const std::vector<int>   flags = test_utils::get_random_data<int>(size, 0, 1, seed_value);
+        std::vector<stored_type> output(size);
+
+        // Calculate expected results on host
+        std::vector<stored_type> expected(size);
+        BinaryFunction           op;
+        for(size_t block_index = 0; block_index < grid_size; ++block_index)
+        {
+            const bool with_neighbour = block_index % 2 == (left ? 1 : 0);
+            for(unsigned int item = 0; item < items_per_block; ++item)
+            {
+                const size_t i = block_index * items_per_block + item;
+                const bool   tile_boundary = left ? item == 0 : item == items_per_block - 1;
+                if(flags[i] || (tile_boundary && !with_neighbour))
+                {
+                    expected[i] = input[i];
+                }
+                else
+                {
+                    expected[i] = left ? op(input[i], input[i - 1]) : op(input[i], input[i + 1]);
+                }
+            }
+        }
+
+        // Preparing Device
+        T*           d_input;
+        int*         d_flags;
+        stored_type* d_output;
+        HIP_CHECK(hipMalloc(&d_input, input.size() * sizeof(input[0])));
+        HIP_CHECK(hipMalloc(&d_flags, flags.size() * sizeof(flags[0])));
+        HIP_CHECK(hipMalloc(&d_output, output.size() * sizeof(output[0])));
+        HIP_CHECK(hipMemcpy(
+            d_input, input.data(), input.size() * sizeof(input[0]), hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(
+            d_flags, flags.data(), flags.size() * sizeof(flags[0]), hipMemcpyHostToDevice));
+
+        // Running kernel
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(subtract_segmented_kernel<T,
+                                                                     Output,
+                                                                     stored_type,
+                                                                     BinaryFunction,
+                                                                     left,
+                                                                     block_size,
+                                                                     items_per_thread>),
+                           dim3(grid_size),
+                           dim3(block_size),
+                           0,
+                           0,
+                           d_input,
+                           d_flags,
+                           d_output);
+        HIP_CHECK(hipGetLastError());
+
+        // Reading results
+        HIP_CHECK(hipMemcpy(
+            output.data(), d_output, output.size() * sizeof(output[0]), hipMemcpyDeviceToHost));
+
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_near(
+            output,
+            expected,
+            std::max(test_utils::precision<T>, test_utils::precision<stored_type>)));
+
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_flags));
+        HIP_CHECK(hipFree(d_output));
+    }
+}
+
 // Static for-loop
 template <
     unsigned int First,
@@ -0,0 +1,218 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+#include <vector>
+
+// required rocprim headers
+#include <rocprim/block/block_axis_reduce.hpp>
+#include <rocprim/block/block_axis_scan.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+template<class T, unsigned int BlockSizeX, unsigned int BlockSizeY, unsigned int BlockSizeZ = 1>
+struct params
+{
+    using type                                 = T;
+    static constexpr unsigned int block_size_x = BlockSizeX;
+    static constexpr unsigned int block_size_y = BlockSizeY;
+    static constexpr unsigned int block_size_z = BlockSizeZ;
+};
+
+template<class Params>
+class RocprimBlockAxisTests : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<params<int, 16, 16>,
+                         params<int, 8, 32>,
+                         params<int, 32, 4>,
+                         params<long long, 4, 8, 2>,
+                         params<test_utils::custom_test_type<int>, 16, 4>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimBlockAxisTests, Params);
+
+template<class T,
+         unsigned int         BlockSizeX,
+         unsigned int         BlockSizeY,
+         unsigned int         BlockSizeZ,
+         rocprim::block_axis Axis>
+__global__
+__launch_bounds__(BlockSizeX * BlockSizeY * BlockSizeZ)
+void block_axis_kernel(const T* input, T* reductions, T* inclusive_scans, T* exclusive_scans)
+{
+    constexpr unsigned int block_size = BlockSizeX * BlockSizeY * BlockSizeZ;
+    const unsigned int     flat_id
+        = (threadIdx.z * BlockSizeY + threadIdx.y) * BlockSizeX + threadIdx.x;
+    const unsigned int index = blockIdx.x * block_size + flat_id;
+
+    using reduce_type = rocprim::block_axis_reduce<T, BlockSizeX, BlockSizeY, Axis, BlockSizeZ>;
+    using scan_type   = rocprim::block_axis_scan<T, BlockSizeX, BlockSizeY, Axis, BlockSizeZ>;
+    __shared__ typename reduce_type::storage_type reduce_storage;
+    __shared__ typename scan_type::storage_type   scan_storage;
+
+    const T value = input[index];
+    T       reduction;
+    T       inclusive_scan;
+    T       exclusive_scan;
+    reduce_type().reduce(value, reduction, reduce_storage);
+    scan_type().inclusive_scan(value, inclusive_scan, scan_storage);
+    rocprim::syncthreads();
+    scan_type().exclusive_scan(value, exclusive_scan, T(10), scan_storage);
+
+    reductions[index]      = reduction;
+    inclusive_scans[index] = inclusive_scan;
+    exclusive_scans[index] = exclusive_scan;
+}
+
+template<class Params, rocprim::block_axis Axis>
+void test_block_axis()
+{
+    using T                             = typename Params::type;
+    constexpr unsigned int block_size_x = Params::block_size_x;
+    constexpr unsigned int block_size_y = Params::block_size_y;
+    constexpr unsigned int block_size_z = Params::block_size_z;
+    constexpr unsigned int block_size   = block_size_x * block_size_y * block_size_z;
+    constexpr unsigned int line_size
+        = Axis == rocprim::block_axis::x ? block_size_x : block_size_y;
+
+    // The lines must fit in a warp
+    if(line_size > rocprim::host_warp_size())
+    {
+        return;
+    }
+
+    const unsigned int grid_size = 37;
+    const size_t       size      = grid_size * block_size;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+
+        // Calculate expected results on host, every line is identified by its first item
+        std::vector<T> expected_reductions(size);
+        std::vector<T> expected_inclusive_scans(size);
+        std::vector<T> expected_exclusive_scans(size);
+        const size_t   stride = Axis == rocprim::block_axis::x ? 1 : block_size_x;
+        for(size_t i = 0; i < size; i++)
+        {
+            const size_t flat_id  = i % block_size;
+            const size_t position = Axis == rocprim::block_axis::x
+                                        ? flat_id % block_size_x
+                                        : flat_id / block_size_x % block_size_y;
+            if(position != 0)
+            {
+                continue;
+            }
+            T reduction = input[i];
+            for(size_t j = 1; j < line_size; j++)
+            {
+                reduction = reduction + input[i + j * stride];
+            }
+            T inclusive_scan = T(0);
+            T exclusive_scan = T(10);
+            for(size_t j = 0; j < line_size; j++)
+            {
+                const size_t item = i + j * stride;
+                inclusive_scan    = j == 0 ? input[item] : inclusive_scan + input[item];
+                expected_reductions[item]      = reduction;
+                expected_inclusive_scans[item] = inclusive_scan;
+                expected_exclusive_scans[item] = exclusive_scan;
+                exclusive_scan                 = exclusive_scan + input[item];
+            }
+        }
+
+        T* d_input;
+        T* d_reductions;
+        T* d_inclusive_scans;
+        T* d_exclusive_scans;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_reductions, size * sizeof(T)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_inclusive_scans, size * sizeof(T)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_exclusive_scans, size * sizeof(T)));
+        HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(
+                block_axis_kernel<T, block_size_x, block_size_y, block_size_z, Axis>),
+            dim3(grid_size),
+            dim3(block_size_x, block_size_y, block_size_z),
+            0,
+            0,
+            d_input,
+            d_reductions,
+            d_inclusive_scans,
+            d_exclusive_scans);
+        HIP_CHECK(hipGetLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<T> reductions(size);
+        std::vector<T> inclusive_scans(size);
+        std::vector<T> exclusive_scans(size);
+        HIP_CHECK(
+            hipMemcpy(reductions.data(), d_reductions, size * sizeof(T), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(inclusive_scans.data(),
+                            d_inclusive_scans,
+                            size * sizeof(T),
+                            hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(exclusive_scans.data(),
+                            d_exclusive_scans,
+                            size * sizeof(T),
+                            hipMemcpyDeviceToHost));
+
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(reductions, expected_reductions));
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(inclusive_scans, expected_inclusive_scans));
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(exclusive_scans, expected_exclusive_scans));
+
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_reductions));
+        HIP_CHECK(hipFree(d_inclusive_scans));
+        HIP_CHECK(hipFree(d_exclusive_scans));
+    }
+}
+
+TYPED_TEST(RocprimBlockAxisTests, Rows)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    test_block_axis<typename TestFixture::params, rocprim::block_axis::x>();
+}
+
+TYPED_TEST(RocprimBlockAxisTests, Columns)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    test_block_axis<typename TestFixture::params, rocprim::block_axis::y>();
+}
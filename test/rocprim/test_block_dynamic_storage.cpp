@@ -0,0 +1,180 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/block/block_dynamic_storage.hpp>
+#include <rocprim/block/block_exchange.hpp>
+#include <rocprim/block/block_load_func.hpp>
+#include <rocprim/block/block_radix_sort.hpp>
+#include <rocprim/block/block_scan.hpp>
+#include <rocprim/block/block_store_func.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+template<unsigned int BlockSize>
+struct params
+{
+    static constexpr unsigned int block_size = BlockSize;
+};
+
+template<class Params>
+class RocprimBlockDynamicStorageTests : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<params<64>, params<128>, params<256>> Params;
+
+TYPED_TEST_SUITE(RocprimBlockDynamicStorageTests, Params);
+
+template<unsigned int BlockSize, unsigned int ItemsPerThread>
+struct dynamic_storage_primitives
+{
+    using sort_type     = rocprim::block_radix_sort<int, BlockSize, ItemsPerThread>;
+    using scan_type     = rocprim::block_scan<int, BlockSize>;
+    using exchange_type = rocprim::block_exchange<int, BlockSize, ItemsPerThread>;
+
+    static constexpr unsigned int storage_size
+        = rocprim::storage_size_bytes<sort_type, scan_type, exchange_type>();
+};
+
+// Sorts the tile of the block and writes the inclusive scan of the sorted items, the storages of
+// the primitives alias in the dynamic shared memory
+template<unsigned int BlockSize, unsigned int ItemsPerThread>
+__device__
+void sort_and_scan_tile(const int* input, int* output)
+{
+    using primitives = dynamic_storage_primitives<BlockSize, ItemsPerThread>;
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int offset = blockIdx.x * items_per_block;
+
+    int keys[ItemsPerThread];
+    rocprim::block_load_direct_blocked(threadIdx.x, input + offset, keys);
+
+    typename primitives::sort_type().sort(
+        keys, rocprim::dynamic_storage<typename primitives::sort_type>());
+    rocprim::syncthreads();
+
+    typename primitives::scan_type().inclusive_scan(
+        keys, keys, rocprim::dynamic_storage<typename primitives::scan_type>());
+    rocprim::syncthreads();
+
+    typename primitives::exchange_type().blocked_to_striped(
+        keys, keys, rocprim::dynamic_storage<typename primitives::exchange_type>());
+
+    rocprim::block_store_direct_striped<BlockSize>(threadIdx.x, output + offset, keys);
+}
+
+// The shape of the tile is selected at run time, the kernel is launched with the dynamic shared
+// memory of the selected shape only
+template<unsigned int BlockSize>
+__global__
+__launch_bounds__(BlockSize)
+void dynamic_storage_kernel(const int* input, int* output, const unsigned int items_per_thread)
+{
+    if(items_per_thread == 4)
+    {
+        sort_and_scan_tile<BlockSize, 4>(input, output);
+    }
+    else
+    {
+        sort_and_scan_tile<BlockSize, 1>(input, output);
+    }
+}
+
+TYPED_TEST(RocprimBlockDynamicStorageTests, RuntimeItemsPerThread)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    constexpr unsigned int block_size = TestFixture::params::block_size;
+    constexpr unsigned int grid_size  = 8;
+
+    static_assert(dynamic_storage_primitives<block_size, 1>::storage_size > 0,
+                  "The primitives need shared memory");
+
+    for(const unsigned int items_per_thread : {1u, 4u})
+    {
+        SCOPED_TRACE(testing::Message() << "with items_per_thread = " << items_per_thread);
+
+        const unsigned int items_per_block = block_size * items_per_thread;
+        const unsigned int size            = grid_size * items_per_block;
+        const unsigned int shared_memory
+            = items_per_thread == 4 ? dynamic_storage_primitives<block_size, 4>::storage_size
+                                    : dynamic_storage_primitives<block_size, 1>::storage_size;
+
+        for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+        {
+            unsigned int seed_value
+                = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+            SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+            std::vector<int> input = test_utils::get_random_data<int>(size, -100, 100, seed_value);
+
+            std::vector<int> expected(input);
+            for(unsigned int block = 0; block < grid_size; block++)
+            {
+                const auto first = expected.begin() + block * items_per_block;
+                std::sort(first, first + items_per_block);
+                std::partial_sum(first, first + items_per_block, first);
+            }
+
+            int* d_input;
+            int* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(int)));
+            HIP_CHECK(
+                hipMemcpy(d_input, input.data(), size * sizeof(int), hipMemcpyHostToDevice));
+
+            hipLaunchKernelGGL(HIP_KERNEL_NAME(dynamic_storage_kernel<block_size>),
+                               dim3(grid_size),
+                               dim3(block_size),
+                               shared_memory,
+                               0,
+                               d_input,
+                               d_output,
+                               items_per_thread);
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<int> output(size);
+            HIP_CHECK(
+                hipMemcpy(output.data(), d_output, size * sizeof(int), hipMemcpyDeviceToHost));
+
+            test_utils::assert_eq(output, expected);
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
@@ -77,3 +77,51 @@ typed_test_def(suite_name, name_suffix, ScatterToStriped)
 
     static_for<0, 4, type, output_type, 5, block_size>::run();
 }
+
+typed_test_def(suite_name, name_suffix, BlockedToStripedPolicies)
+{
+    using type = typename TestFixture::params::input_type;
+    using output_type = typename TestFixture::params::output_type;
+    constexpr size_t block_size = TestFixture::params::block_size;
+    using policy = rocprim::block_exchange_policy;
+
+    static_for<0, 4, type, output_type, 0, block_size, policy::none>::run();
+    static_for<0, 4, type, output_type, 0, block_size, policy::swizzle>::run();
+    static_for<0, 4, type, output_type, 0, block_size, policy::warp_shuffle>::run();
+}
+
+typed_test_def(suite_name, name_suffix, StripedToBlockedPolicies)
+{
+    using type = typename TestFixture::params::input_type;
+    using output_type = typename TestFixture::params::output_type;
+    constexpr size_t block_size = TestFixture::params::block_size;
+    using policy = rocprim::block_exchange_policy;
+
+    static_for<0, 4, type, output_type, 1, block_size, policy::none>::run();
+    static_for<0, 4, type, output_type, 1, block_size, policy::swizzle>::run();
+    static_for<0, 4, type, output_type, 1, block_size, policy::warp_shuffle>::run();
+}
+
+typed_test_def(suite_name, name_suffix, BlockedToWarpStripedPolicies)
+{
+    using type = typename TestFixture::params::input_type;
+    using output_type = typename TestFixture::params::output_type;
+    constexpr size_t block_size = TestFixture::params::block_size;
+    using policy = rocprim::block_exchange_policy;
+
+    static_for<0, 4, type, output_type, 2, block_size, policy::none>::run();
+    static_for<0, 4, type, output_type, 2, block_size, policy::swizzle>::run();
+    static_for<0, 4, type, output_type, 2, block_size, policy::warp_shuffle>::run();
+}
+
+typed_test_def(suite_name, name_suffix, WarpStripedToBlockedPolicies)
+{
+    using type = typename TestFixture::params::input_type;
+    using output_type = typename TestFixture::params::output_type;
+    constexpr size_t block_size = TestFixture::params::block_size;
+    using policy = rocprim::block_exchange_policy;
+
+    static_for<0, 4, type, output_type, 3, block_size, policy::none>::run();
+    static_for<0, 4, type, output_type, 3, block_size, policy::swizzle>::run();
+    static_for<0, 4, type, output_type, 3, block_size, policy::warp_shuffle>::run();
+}
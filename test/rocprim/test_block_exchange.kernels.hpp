@@ -27,7 +27,8 @@ template<
     class Type,
     class OutputType,
     unsigned int ItemsPerBlock,
-    unsigned int ItemsPerThread
+    unsigned int ItemsPerThread,
+    rocprim::block_exchange_policy Policy = rocprim::block_exchange_policy::padding
 >
 __global__
 __launch_bounds__(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE)
@@ -41,7 +42,7 @@ void blocked_to_striped_kernel(Type* device_input, OutputType* device_output)
     OutputType output[ItemsPerThread];
     rocprim::block_load_direct_blocked(lid, device_input + block_offset, input);
 
-    rocprim::block_exchange<Type, block_size, ItemsPerThread> exchange;
+    rocprim::block_exchange<Type, block_size, ItemsPerThread, 1, 1, Policy> exchange;
     exchange.blocked_to_striped(input, output);
 
     rocprim::block_store_direct_blocked(lid, device_output + block_offset, output);
@@ -51,7 +52,8 @@ template<
     class Type,
     class OutputType,
     unsigned int ItemsPerBlock,
-    unsigned int ItemsPerThread
+    unsigned int ItemsPerThread,
+    rocprim::block_exchange_policy Policy = rocprim::block_exchange_policy::padding
 >
 __global__
 __launch_bounds__(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE)
@@ -65,7 +67,7 @@ void striped_to_blocked_kernel(Type* device_input, OutputType* device_output)
     OutputType output[ItemsPerThread];
     rocprim::block_load_direct_blocked(lid, device_input + block_offset, input);
 
-    rocprim::block_exchange<Type, block_size, ItemsPerThread> exchange;
+    rocprim::block_exchange<Type, block_size, ItemsPerThread, 1, 1, Policy> exchange;
     exchange.striped_to_blocked(input, output);
 
     rocprim::block_store_direct_blocked(lid, device_output + block_offset, output);
@@ -75,7 +77,8 @@ template<
     class Type,
     class OutputType,
     unsigned int ItemsPerBlock,
-    unsigned int ItemsPerThread
+    unsigned int ItemsPerThread,
+    rocprim::block_exchange_policy Policy = rocprim::block_exchange_policy::padding
 >
 __global__
 __launch_bounds__(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE)
@@ -89,7 +92,7 @@ void blocked_to_warp_striped_kernel(Type* device_input, OutputType* device_outpu
     OutputType output[ItemsPerThread];
     rocprim::block_load_direct_blocked(lid, device_input + block_offset, input);
 
-    rocprim::block_exchange<Type, block_size, ItemsPerThread> exchange;
+    rocprim::block_exchange<Type, block_size, ItemsPerThread, 1, 1, Policy> exchange;
     exchange.blocked_to_warp_striped(input, output);
 
     rocprim::block_store_direct_blocked(lid, device_output + block_offset, output);
@@ -99,7 +102,8 @@ template<
     class Type,
     class OutputType,
     unsigned int ItemsPerBlock,
-    unsigned int ItemsPerThread
+    unsigned int ItemsPerThread,
+    rocprim::block_exchange_policy Policy = rocprim::block_exchange_policy::padding
 >
 __global__
 __launch_bounds__(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE)
@@ -113,7 +117,7 @@ void warp_striped_to_blocked_kernel(Type* device_input, OutputType* device_outpu
     OutputType output[ItemsPerThread];
     rocprim::block_load_direct_blocked(lid, device_input + block_offset, input);
 
-    rocprim::block_exchange<Type, block_size, ItemsPerThread> exchange;
+    rocprim::block_exchange<Type, block_size, ItemsPerThread, 1, 1, Policy> exchange;
     exchange.warp_striped_to_blocked(input, output);
 
     rocprim::block_store_direct_blocked(lid, device_output + block_offset, output);
@@ -177,7 +181,8 @@ template<
     class U,
     int Method,
     unsigned int BlockSize = 256U,
-    unsigned int ItemsPerThread = 1U
+    unsigned int ItemsPerThread = 1U,
+    rocprim::block_exchange_policy Policy = rocprim::block_exchange_policy::padding
 >
 auto test_block_exchange()
 -> typename std::enable_if<Method == 0>::type
@@ -234,7 +239,7 @@ auto test_block_exchange()
     // Running kernel
     constexpr unsigned int grid_size = (size / items_per_block);
     hipLaunchKernelGGL(
-        HIP_KERNEL_NAME(blocked_to_striped_kernel<type, output_type, items_per_block, items_per_thread>),
+        HIP_KERNEL_NAME(blocked_to_striped_kernel<type, output_type, items_per_block, items_per_thread, Policy>),
         dim3(grid_size), dim3(block_size), 0, 0,
         device_input, device_output
     );
@@ -261,7 +266,8 @@ template<
     class U,
     int Method,
     unsigned int BlockSize = 256U,
-    unsigned int ItemsPerThread = 1U
+    unsigned int ItemsPerThread = 1U,
+    rocprim::block_exchange_policy Policy = rocprim::block_exchange_policy::padding
 >
 auto test_block_exchange()
 -> typename std::enable_if<Method == 1>::type
@@ -318,7 +324,7 @@ auto test_block_exchange()
     // Running kernel
     constexpr unsigned int grid_size = (size / items_per_block);
     hipLaunchKernelGGL(
-        HIP_KERNEL_NAME(striped_to_blocked_kernel<type, output_type, items_per_block, items_per_thread>),
+        HIP_KERNEL_NAME(striped_to_blocked_kernel<type, output_type, items_per_block, items_per_thread, Policy>),
         dim3(grid_size), dim3(block_size), 0, 0,
         device_input, device_output
     );
@@ -345,7 +351,8 @@ template<
     class U,
     int Method,
     unsigned int BlockSize = 256U,
-    unsigned int ItemsPerThread = 1U
+    unsigned int ItemsPerThread = 1U,
+    rocprim::block_exchange_policy Policy = rocprim::block_exchange_policy::padding
 >
 auto test_block_exchange()
 -> typename std::enable_if<Method == 2>::type
@@ -413,7 +420,7 @@ auto test_block_exchange()
     constexpr unsigned int grid_size = (size / items_per_block);
     hipLaunchKernelGGL(
         HIP_KERNEL_NAME(blocked_to_warp_striped_kernel<
-                type, output_type, items_per_block, items_per_thread
+                type, output_type, items_per_block, items_per_thread, Policy
         >),
         dim3(grid_size), dim3(block_size), 0, 0,
         device_input, device_output
@@ -441,7 +448,8 @@ template<
     class U,
     int Method,
     unsigned int BlockSize = 256U,
-    unsigned int ItemsPerThread = 1U
+    unsigned int ItemsPerThread = 1U,
+    rocprim::block_exchange_policy Policy = rocprim::block_exchange_policy::padding
 >
 auto test_block_exchange()
 -> typename std::enable_if<Method == 3>::type
@@ -508,7 +516,7 @@ auto test_block_exchange()
     // Running kernel
     constexpr unsigned int grid_size = (size / items_per_block);
     hipLaunchKernelGGL(
-        HIP_KERNEL_NAME(warp_striped_to_blocked_kernel<type, output_type, items_per_block, items_per_thread>),
+        HIP_KERNEL_NAME(warp_striped_to_blocked_kernel<type, output_type, items_per_block, items_per_thread, Policy>),
         dim3(grid_size), dim3(block_size), 0, 0,
         device_input, device_output
     );
@@ -535,7 +543,8 @@ template<
     class U,
     int Method,
     unsigned int BlockSize = 256U,
-    unsigned int ItemsPerThread = 1U
+    unsigned int ItemsPerThread = 1U,
+    rocprim::block_exchange_policy Policy = rocprim::block_exchange_policy::padding
 >
 auto test_block_exchange()
 -> typename std::enable_if<Method == 4>::type
@@ -637,7 +646,8 @@ template<
     class U,
     int Method,
     unsigned int BlockSize = 256U,
-    unsigned int ItemsPerThread = 1U
+    unsigned int ItemsPerThread = 1U,
+    rocprim::block_exchange_policy Policy = rocprim::block_exchange_policy::padding
 >
 auto test_block_exchange()
 -> typename std::enable_if<Method == 5>::type
@@ -743,7 +753,8 @@ template <
     class T,
     class U,
     int Method,
-    unsigned int BlockSize = 256U
+    unsigned int BlockSize = 256U,
+    rocprim::block_exchange_policy Policy = rocprim::block_exchange_policy::padding
 >
 struct static_for
 {
@@ -753,8 +764,8 @@ struct static_for
         SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
         HIP_CHECK(hipSetDevice(device_id));
 
-        test_block_exchange<T, U, Method, BlockSize, items[First]>();
-        static_for<First + 1, Last, T, U, Method, BlockSize>::run();
+        test_block_exchange<T, U, Method, BlockSize, items[First], Policy>();
+        static_for<First + 1, Last, T, U, Method, BlockSize, Policy>::run();
     }
 };
 
@@ -763,9 +774,10 @@ template <
     class T,
     class U,
     int Method,
-    unsigned int BlockSize
+    unsigned int BlockSize,
+    rocprim::block_exchange_policy Policy
 >
-struct static_for<N, N, T, U, Method, BlockSize>
+struct static_for<N, N, T, U, Method, BlockSize, Policy>
 {
     static void run()
     {
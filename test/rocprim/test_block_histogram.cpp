@@ -36,10 +36,12 @@
 // Start stamping out tests
 struct RocprimBlockHistogramAtomicInputArrayTests;
 struct RocprimBlockHistogramSortInputArrayTests;
+struct RocprimBlockHistogramWarpPrivatizedInputArrayTests;
 
 struct Integral;
 #define suite_name_atomic RocprimBlockHistogramAtomicInputArrayTests
 #define suite_name_sort RocprimBlockHistogramSortInputArrayTests
+#define suite_name_warp_privatized RocprimBlockHistogramWarpPrivatizedInputArrayTests
 #define block_params_atomic BlockHistAtomicParamsIntegral
 #define block_params_sort BlockHistSortParamsIntegral
 #define name_suffix Integral
@@ -48,6 +50,7 @@ struct Integral;
 
 #undef suite_name_atomic
 #undef suite_name_sort
+#undef suite_name_warp_privatized
 #undef block_params_atomic
 #undef block_params_sort
 #undef name_suffix
@@ -55,6 +58,7 @@ struct Integral;
 struct Floating;
 #define suite_name_atomic RocprimBlockHistogramAtomicInputArrayTests
 #define suite_name_sort RocprimBlockHistogramSortInputArrayTests
+#define suite_name_warp_privatized RocprimBlockHistogramWarpPrivatizedInputArrayTests
 #define block_params_atomic BlockHistAtomicParamsFloating
 #define block_params_sort BlockHistSortParamsFloating
 #define name_suffix Floating
@@ -38,10 +38,12 @@
 // Start stamping out tests
 struct RocprimBlockHistogramAtomicInputArrayTests;
 struct RocprimBlockHistogramSortInputArrayTests;
+struct RocprimBlockHistogramWarpPrivatizedInputArrayTests;
 
 struct Integral;
 #define suite_name_atomic RocprimBlockHistogramAtomicInputArrayTests
 #define suite_name_sort RocprimBlockHistogramSortInputArrayTests
+#define suite_name_warp_privatized RocprimBlockHistogramWarpPrivatizedInputArrayTests
 #define block_params_atomic BlockHistAtomicParamsIntegral
 #define block_params_sort BlockHistSortParamsIntegral
 #define name_suffix Integral
@@ -50,9 +52,11 @@ struct Integral;
 
 block_histo_test_suite_type_def(suite_name_atomic, name_suffix)
 block_histo_test_suite_type_def(suite_name_sort, name_suffix)
+block_histo_test_suite_type_def(suite_name_warp_privatized, name_suffix)
 
 typed_test_suite_def(suite_name_atomic, name_suffix, block_params_atomic);
 typed_test_suite_def(suite_name_sort, name_suffix, block_params_sort);
+typed_test_suite_def(suite_name_warp_privatized, name_suffix, block_params_sort);
 
 typed_test_def(suite_name_atomic, name_suffix, Histogram)
 {
@@ -71,3 +75,12 @@ typed_test_def(suite_name_sort, name_suffix, Histogram)
 
     static_for_input_array<0, 4, T, BinType, block_size, rocprim::block_histogram_algorithm::using_sort>::run();
 }
+
+typed_test_def(suite_name_warp_privatized, name_suffix, Histogram)
+{
+    using T = typename TestFixture::type;
+    using BinType = typename TestFixture::bin_type;
+    constexpr size_t block_size = TestFixture::block_size;
+
+    static_for_input_array<0, 4, T, BinType, block_size, rocprim::block_histogram_algorithm::using_warp_privatized>::run();
+}
@@ -24,6 +24,7 @@
 
 // required rocprim headers
 #include <rocprim/block/block_load.hpp>
+#include <rocprim/block/block_load_pipelined.hpp>
 #include <rocprim/block/block_store.hpp>
 
 // required test headers
@@ -60,6 +61,144 @@ TYPED_TEST(RocprimVectorizationTests, MatchVectorType)
     ASSERT_TRUE(input);
 }
 
+template<class Type, unsigned int BlockSize, unsigned int ItemsPerThread>
+struct tile_params
+{
+    using type = Type;
+    static constexpr unsigned int block_size = BlockSize;
+    static constexpr unsigned int items_per_thread = ItemsPerThread;
+};
+
+template<class Params>
+class RocprimBlockLoadPipelinedTests : public ::testing::Test {
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<
+    tile_params<int, 64U, 1>,
+    tile_params<int, 256U, 8>,
+    tile_params<double, 128U, 3>,
+    tile_params<rocprim::half, 256U, 4>,
+    tile_params<test_utils::custom_test_type<int>, 64U, 5>
+> TileParams;
+
+TYPED_TEST_SUITE(RocprimBlockLoadPipelinedTests, TileParams);
+
+TYPED_TEST(RocprimBlockLoadPipelinedTests, LoadTiles)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using Type = typename TestFixture::params::type;
+    constexpr size_t block_size = TestFixture::params::block_size;
+    constexpr size_t items_per_thread = TestFixture::params::items_per_thread;
+    constexpr size_t items_per_tile = block_size * items_per_thread;
+    const size_t grid_size = 7;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // Several tiles per block, the last tile is partial
+        for(size_t size : {items_per_tile * 3, items_per_tile * grid_size * 5 + 17})
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<Type> input = test_utils::get_random_data<Type>(size, -100, 100, seed_value);
+            std::vector<Type> output(size, Type(0));
+
+            Type* device_input;
+            Type* device_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&device_input, size * sizeof(Type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&device_output, size * sizeof(Type)));
+            HIP_CHECK(hipMemcpy(device_input, input.data(), size * sizeof(Type), hipMemcpyHostToDevice));
+
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(load_pipelined_kernel<Type, block_size, items_per_thread>),
+                dim3(grid_size), dim3(block_size), 0, 0,
+                device_input, device_output, size
+            );
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            HIP_CHECK(hipMemcpy(output.data(), device_output, size * sizeof(Type), hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, input));
+
+            HIP_CHECK(hipFree(device_input));
+            HIP_CHECK(hipFree(device_output));
+        }
+    }
+}
+
+template<class Params>
+class RocprimBlockLoadBufferTests : public ::testing::Test {
+public:
+    using params = Params;
+};
+
+TYPED_TEST_SUITE(RocprimBlockLoadBufferTests, TileParams);
+
+TYPED_TEST(RocprimBlockLoadBufferTests, LoadValidDefault)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using Type = typename TestFixture::params::type;
+    constexpr size_t block_size = TestFixture::params::block_size;
+    constexpr size_t items_per_thread = TestFixture::params::items_per_thread;
+    constexpr size_t items_per_block = block_size * items_per_thread;
+    const Type _default = Type(-1);
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t valid : {size_t(0), size_t(1), items_per_block / 2 + 1, items_per_block})
+        {
+            SCOPED_TRACE(testing::Message() << "with valid = " << valid);
+
+            // Only the valid items are allocated, out-of-bound reads would be detected
+            std::vector<Type> input = test_utils::get_random_data<Type>(valid, 0, 100, seed_value);
+            std::vector<Type> expected(items_per_block, _default);
+            std::copy(input.begin(), input.end(), expected.begin());
+
+            Type* device_input;
+            Type* device_blocked_output;
+            Type* device_striped_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&device_input, std::max<size_t>(valid, 1) * sizeof(Type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&device_blocked_output, items_per_block * sizeof(Type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&device_striped_output, items_per_block * sizeof(Type)));
+            HIP_CHECK(hipMemcpy(device_input, input.data(), valid * sizeof(Type), hipMemcpyHostToDevice));
+
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(load_buffer_kernel<Type, block_size, items_per_thread, Type>),
+                dim3(1), dim3(block_size), 0, 0,
+                device_input, device_blocked_output, device_striped_output, valid, _default
+            );
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<Type> blocked_output(items_per_block);
+            std::vector<Type> striped_output(items_per_block);
+            HIP_CHECK(hipMemcpy(blocked_output.data(), device_blocked_output, items_per_block * sizeof(Type), hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(striped_output.data(), device_striped_output, items_per_block * sizeof(Type), hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(blocked_output, expected));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(striped_output, expected));
+
+            HIP_CHECK(hipFree(device_input));
+            HIP_CHECK(hipFree(device_blocked_output));
+            HIP_CHECK(hipFree(device_striped_output));
+        }
+    }
+}
+
 // Start stamping out tests
 struct RocprimBlockLoadStoreClassTests;
 
@@ -299,4 +299,67 @@ void load_store_valid_default_kernel(Type* device_input, Type* device_output, si
     store.store(device_output + offset, _items);
 }
 
+template<
+    class Type,
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread
+>
+__global__
+__launch_bounds__(BlockSize)
+void load_pipelined_kernel(Type* device_input, Type* device_output, size_t size)
+{
+    constexpr unsigned int items_per_tile = BlockSize * ItemsPerThread;
+    using block_load_type = rocprim::block_load_pipelined<Type, BlockSize, ItemsPerThread>;
+    ROCPRIM_SHARED_MEMORY typename block_load_type::storage_type storage;
+
+    // Every block processes every gridDim.x-th tile
+    const size_t tiles = (size + items_per_tile - 1) / items_per_tile;
+    auto valid_in_tile = [&](size_t tile)
+    { return (unsigned int)rocprim::min<size_t>(size - tile * items_per_tile, items_per_tile); };
+
+    block_load_type load;
+    size_t tile = blockIdx.x;
+    if(tile < tiles)
+    {
+        load.prefetch(device_input + tile * items_per_tile, valid_in_tile(tile));
+    }
+    for(; tile < tiles; tile += gridDim.x)
+    {
+        Type _items[ItemsPerThread];
+        load.load(_items, storage);
+        if(tile + gridDim.x < tiles)
+        {
+            load.prefetch(device_input + (tile + gridDim.x) * items_per_tile,
+                          valid_in_tile(tile + gridDim.x));
+        }
+        rocprim::block_store_direct_blocked(threadIdx.x,
+                                            device_output + tile * items_per_tile,
+                                            _items,
+                                            valid_in_tile(tile));
+        rocprim::syncthreads();
+    }
+}
+
+template<
+    class Type,
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    class Def
+>
+__global__
+__launch_bounds__(BlockSize)
+void load_buffer_kernel(Type* device_input,
+                        Type* device_blocked_output,
+                        Type* device_striped_output,
+                        size_t valid,
+                        Def _default)
+{
+    Type _items[ItemsPerThread];
+    const unsigned int lid = threadIdx.x;
+    rocprim::block_load_direct_blocked_buffer(lid, device_input, _items, (unsigned int)valid, _default);
+    rocprim::block_store_direct_blocked(lid, device_blocked_output, _items);
+    rocprim::block_load_direct_striped_buffer<BlockSize>(lid, device_input, _items, (unsigned int)valid, _default);
+    rocprim::block_store_direct_striped<BlockSize>(lid, device_striped_output, _items);
+}
+
 #endif // TEST_BLOCK_LOAD_STORE_KERNELS_HPP_
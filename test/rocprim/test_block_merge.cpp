@@ -0,0 +1,293 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/block/block_load_func.hpp>
+#include <rocprim/block/block_merge.hpp>
+#include <rocprim/block/block_store_func.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+template<unsigned int BlockSize, unsigned int ItemsPerThread>
+struct params
+{
+    static constexpr unsigned int block_size       = BlockSize;
+    static constexpr unsigned int items_per_thread = ItemsPerThread;
+};
+
+template<class Params>
+class RocprimBlockMergeTests : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<params<64, 1>,
+                         params<64, 7>,
+                         params<128, 4>,
+                         params<192, 3>,
+                         params<256, 2>,
+                         params<256, 8>,
+                         params<1024, 1>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimBlockMergeTests, Params);
+
+// The first sizes1 items of every block are merged with the next sizes2 items, the values
+// hold the positions of the items
+template<unsigned int BlockSize, unsigned int ItemsPerThread>
+__global__
+__launch_bounds__(BlockSize)
+void block_merge_kernel(int*                keys,
+                        unsigned int*       values,
+                        const unsigned int* sizes1,
+                        const unsigned int* sizes2)
+{
+    using block_merge_type = rocprim::block_merge<int, BlockSize, ItemsPerThread, unsigned int>;
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int offset = blockIdx.x * items_per_block;
+
+    ROCPRIM_SHARED_MEMORY typename block_merge_type::storage_type storage;
+
+    int          thread_keys[ItemsPerThread];
+    unsigned int thread_values[ItemsPerThread];
+    rocprim::block_load_direct_blocked(threadIdx.x, keys + offset, thread_keys);
+    rocprim::block_load_direct_blocked(threadIdx.x, values + offset, thread_values);
+
+    block_merge_type().merge(thread_keys,
+                             thread_values,
+                             sizes1[blockIdx.x],
+                             sizes2[blockIdx.x],
+                             storage);
+
+    rocprim::block_store_direct_blocked(threadIdx.x, keys + offset, thread_keys);
+    rocprim::block_store_direct_blocked(threadIdx.x, values + offset, thread_values);
+}
+
+// Only keys, the whole block is merged, in descending order
+template<unsigned int BlockSize, unsigned int ItemsPerThread>
+__global__
+__launch_bounds__(BlockSize)
+void block_merge_keys_kernel(int* keys, const unsigned int* sizes1)
+{
+    using block_merge_type = rocprim::block_merge<int, BlockSize, ItemsPerThread>;
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int offset = blockIdx.x * items_per_block;
+
+    ROCPRIM_SHARED_MEMORY typename block_merge_type::storage_type storage;
+
+    int thread_keys[ItemsPerThread];
+    rocprim::block_load_direct_blocked(threadIdx.x, keys + offset, thread_keys);
+
+    block_merge_type().merge(thread_keys, sizes1[blockIdx.x], storage, rocprim::greater<int>());
+
+    rocprim::block_store_direct_blocked(threadIdx.x, keys + offset, thread_keys);
+}
+
+TYPED_TEST(RocprimBlockMergeTests, MergePairs)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    constexpr unsigned int block_size       = TestFixture::params::block_size;
+    constexpr unsigned int items_per_thread = TestFixture::params::items_per_thread;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+    constexpr unsigned int grid_size        = 8;
+    constexpr unsigned int size             = grid_size * items_per_block;
+
+    using pair_type = std::pair<int, unsigned int>;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // Few distinct keys to check the stability
+        std::vector<int> keys = test_utils::get_random_data<int>(size, 0, 16, seed_value);
+        std::vector<unsigned int> values(size);
+        std::iota(values.begin(), values.end(), 0u);
+        std::vector<unsigned int> sizes1 = test_utils::get_random_data<unsigned int>(
+            grid_size, 0, items_per_block, seed_value + 1);
+        std::vector<unsigned int> sizes2(grid_size);
+        // Empty sequences and full blocks
+        sizes1[0] = 0;
+        sizes1[1] = items_per_block;
+        for(unsigned int block = 0; block < grid_size; block++)
+        {
+            sizes2[block] = block < 3 ? items_per_block - sizes1[block]
+                                      : test_utils::get_random_value<unsigned int>(
+                                          0, items_per_block - sizes1[block], seed_value + block);
+            const auto first = keys.begin() + block * items_per_block;
+            std::sort(first, first + sizes1[block]);
+            std::sort(first + sizes1[block], first + sizes1[block] + sizes2[block]);
+        }
+
+        std::vector<pair_type> expected(size);
+        for(size_t i = 0; i < size; i++)
+        {
+            expected[i] = std::make_pair(keys[i], values[i]);
+        }
+        for(unsigned int block = 0; block < grid_size; block++)
+        {
+            const auto first = expected.begin() + block * items_per_block;
+            std::stable_sort(first,
+                             first + sizes1[block] + sizes2[block],
+                             [](const pair_type& a, const pair_type& b)
+                             { return a.first < b.first; });
+        }
+
+        int*          d_keys;
+        unsigned int* d_values;
+        unsigned int* d_sizes1;
+        unsigned int* d_sizes2;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, size * sizeof(int)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_values, size * sizeof(unsigned int)));
+        HIP_CHECK(
+            test_common_utils::hipMallocHelper(&d_sizes1, grid_size * sizeof(unsigned int)));
+        HIP_CHECK(
+            test_common_utils::hipMallocHelper(&d_sizes2, grid_size * sizeof(unsigned int)));
+        HIP_CHECK(hipMemcpy(d_keys, keys.data(), size * sizeof(int), hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_values,
+                            values.data(),
+                            size * sizeof(unsigned int),
+                            hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_sizes1,
+                            sizes1.data(),
+                            grid_size * sizeof(unsigned int),
+                            hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_sizes2,
+                            sizes2.data(),
+                            grid_size * sizeof(unsigned int),
+                            hipMemcpyHostToDevice));
+
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(block_merge_kernel<block_size, items_per_thread>),
+                           dim3(grid_size),
+                           dim3(block_size),
+                           0,
+                           0,
+                           d_keys,
+                           d_values,
+                           d_sizes1,
+                           d_sizes2);
+        HIP_CHECK(hipGetLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<int>          output_keys(size);
+        std::vector<unsigned int> output_values(size);
+        HIP_CHECK(hipMemcpy(output_keys.data(), d_keys, size * sizeof(int), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(output_values.data(),
+                            d_values,
+                            size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+
+        // The items past the merged ones are left unchanged
+        for(size_t i = 0; i < size; i++)
+        {
+            ASSERT_EQ(output_keys[i], expected[i].first) << "where index = " << i;
+            ASSERT_EQ(output_values[i], expected[i].second) << "where index = " << i;
+        }
+
+        HIP_CHECK(hipFree(d_keys));
+        HIP_CHECK(hipFree(d_values));
+        HIP_CHECK(hipFree(d_sizes1));
+        HIP_CHECK(hipFree(d_sizes2));
+    }
+}
+
+TYPED_TEST(RocprimBlockMergeTests, MergeKeysDescending)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    constexpr unsigned int block_size       = TestFixture::params::block_size;
+    constexpr unsigned int items_per_thread = TestFixture::params::items_per_thread;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+    constexpr unsigned int grid_size        = 8;
+    constexpr unsigned int size             = grid_size * items_per_block;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        std::vector<int> keys = test_utils::get_random_data<int>(size, -1000, 1000, seed_value);
+        const std::vector<unsigned int> sizes1 = test_utils::get_random_data<unsigned int>(
+            grid_size, 0, items_per_block, seed_value + 1);
+        std::vector<int> expected(size);
+        for(unsigned int block = 0; block < grid_size; block++)
+        {
+            const auto first = keys.begin() + block * items_per_block;
+            std::sort(first, first + sizes1[block], std::greater<int>());
+            std::sort(first + sizes1[block], first + items_per_block, std::greater<int>());
+            std::merge(first,
+                       first + sizes1[block],
+                       first + sizes1[block],
+                       first + items_per_block,
+                       expected.begin() + block * items_per_block,
+                       std::greater<int>());
+        }
+
+        int*          d_keys;
+        unsigned int* d_sizes1;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, size * sizeof(int)));
+        HIP_CHECK(
+            test_common_utils::hipMallocHelper(&d_sizes1, grid_size * sizeof(unsigned int)));
+        HIP_CHECK(hipMemcpy(d_keys, keys.data(), size * sizeof(int), hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_sizes1,
+                            sizes1.data(),
+                            grid_size * sizeof(unsigned int),
+                            hipMemcpyHostToDevice));
+
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(block_merge_keys_kernel<block_size, items_per_thread>),
+                           dim3(grid_size),
+                           dim3(block_size),
+                           0,
+                           0,
+                           d_keys,
+                           d_sizes1);
+        HIP_CHECK(hipGetLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<int> output(size);
+        HIP_CHECK(hipMemcpy(output.data(), d_keys, size * sizeof(int), hipMemcpyDeviceToHost));
+
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+        HIP_CHECK(hipFree(d_keys));
+        HIP_CHECK(hipFree(d_sizes1));
+    }
+}
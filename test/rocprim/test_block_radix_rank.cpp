@@ -0,0 +1,215 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/block/block_load.hpp>
+#include <rocprim/block/block_radix_rank.hpp>
+#include <rocprim/block/block_store.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+template<unsigned int BlockSize, unsigned int ItemsPerThread, unsigned int RadixBits>
+struct params
+{
+    static constexpr unsigned int block_size       = BlockSize;
+    static constexpr unsigned int items_per_thread = ItemsPerThread;
+    static constexpr unsigned int radix_bits       = RadixBits;
+};
+
+template<class Params>
+class RocprimBlockRadixRank : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<params<64, 1, 1>,
+                         params<64, 4, 4>,
+                         params<128, 3, 8>,
+                         params<256, 2, 5>,
+                         params<256, 8, 8>,
+                         params<512, 1, 3>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimBlockRadixRank, Params);
+
+template<unsigned int RadixBits>
+struct low_bits_digit
+{
+    __device__ unsigned int operator()(const unsigned int key) const
+    {
+        return key & ((1u << RadixBits) - 1);
+    }
+};
+
+template<unsigned int BlockSize, unsigned int ItemsPerThread, unsigned int RadixBits>
+__global__
+__launch_bounds__(BlockSize)
+void rank_kernel(const unsigned int* keys_input,
+                 unsigned int*       ranks_output,
+                 unsigned int*       digit_prefix_output,
+                 unsigned int*       digit_counts_output)
+{
+    using block_rank_type = rocprim::block_radix_rank<BlockSize, RadixBits>;
+    constexpr unsigned int items_per_block   = BlockSize * ItemsPerThread;
+    constexpr unsigned int radix_size        = 1u << RadixBits;
+    constexpr unsigned int digits_per_thread = block_rank_type::digits_per_thread;
+
+    const unsigned int lid          = threadIdx.x;
+    const unsigned int block_offset = blockIdx.x * items_per_block;
+
+    __shared__ typename block_rank_type::storage_type storage;
+
+    unsigned int keys[ItemsPerThread];
+    rocprim::block_load_direct_warp_striped(lid, keys_input + block_offset, keys);
+
+    unsigned int ranks[ItemsPerThread];
+    unsigned int digit_prefix[digits_per_thread];
+    unsigned int digit_counts[digits_per_thread];
+    block_rank_type().rank_keys(keys,
+                                ranks,
+                                storage,
+                                low_bits_digit<RadixBits>(),
+                                digit_prefix,
+                                digit_counts);
+
+    rocprim::block_store_direct_warp_striped(lid, ranks_output + block_offset, ranks);
+    for(unsigned int i = 0; i < digits_per_thread; i++)
+    {
+        const unsigned int digit = lid * digits_per_thread + i;
+        if(digit < radix_size)
+        {
+            digit_prefix_output[blockIdx.x * radix_size + digit] = digit_prefix[i];
+            digit_counts_output[blockIdx.x * radix_size + digit] = digit_counts[i];
+        }
+    }
+}
+
+TYPED_TEST(RocprimBlockRadixRank, RankKeys)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    constexpr unsigned int block_size       = TestFixture::params::block_size;
+    constexpr unsigned int items_per_thread = TestFixture::params::items_per_thread;
+    constexpr unsigned int radix_bits       = TestFixture::params::radix_bits;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+    constexpr unsigned int radix_size       = 1u << radix_bits;
+
+    // Given block size not supported
+    if(block_size > test_utils::get_max_block_size())
+    {
+        return;
+    }
+
+    const size_t grid_size = 23;
+    const size_t size      = items_per_block * grid_size;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        const std::vector<unsigned int> keys
+            = test_utils::get_random_data<unsigned int>(size, 0, 1u << 20, seed_value);
+
+        // In the warp-striped arrangement the items are ranked in their order in memory,
+        // so the expected ranks are the positions after a stable sort of every block.
+        std::vector<unsigned int> ranks_expected(size);
+        std::vector<unsigned int> digit_prefix_expected(grid_size * radix_size);
+        std::vector<unsigned int> digit_counts_expected(grid_size * radix_size, 0);
+        for(size_t block = 0; block < grid_size; block++)
+        {
+            unsigned int* counts = &digit_counts_expected[block * radix_size];
+            unsigned int* prefix = &digit_prefix_expected[block * radix_size];
+            for(size_t i = 0; i < items_per_block; i++)
+            {
+                counts[keys[block * items_per_block + i] & (radix_size - 1)]++;
+            }
+            unsigned int sum = 0;
+            for(unsigned int digit = 0; digit < radix_size; digit++)
+            {
+                prefix[digit] = sum;
+                sum += counts[digit];
+            }
+            std::vector<unsigned int> next(prefix, prefix + radix_size);
+            for(size_t i = 0; i < items_per_block; i++)
+            {
+                const size_t index    = block * items_per_block + i;
+                ranks_expected[index] = next[keys[index] & (radix_size - 1)]++;
+            }
+        }
+
+        unsigned int* d_keys;
+        unsigned int* d_ranks;
+        unsigned int* d_digit_prefix;
+        unsigned int* d_digit_counts;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, size * sizeof(unsigned int)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_ranks, size * sizeof(unsigned int)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_digit_prefix,
+                                                     grid_size * radix_size * sizeof(unsigned int)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_digit_counts,
+                                                     grid_size * radix_size * sizeof(unsigned int)));
+        HIP_CHECK(
+            hipMemcpy(d_keys, keys.data(), size * sizeof(unsigned int), hipMemcpyHostToDevice));
+
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(rank_kernel<block_size, items_per_thread, radix_bits>),
+                           dim3(grid_size),
+                           dim3(block_size),
+                           0,
+                           0,
+                           d_keys,
+                           d_ranks,
+                           d_digit_prefix,
+                           d_digit_counts);
+        HIP_CHECK(hipGetLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<unsigned int> ranks(size);
+        std::vector<unsigned int> digit_prefix(grid_size * radix_size);
+        std::vector<unsigned int> digit_counts(grid_size * radix_size);
+        HIP_CHECK(
+            hipMemcpy(ranks.data(), d_ranks, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(digit_prefix.data(),
+                            d_digit_prefix,
+                            grid_size * radix_size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(digit_counts.data(),
+                            d_digit_counts,
+                            grid_size * radix_size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(ranks, ranks_expected));
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(digit_prefix, digit_prefix_expected));
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(digit_counts, digit_counts_expected));
+
+        HIP_CHECK(hipFree(d_keys));
+        HIP_CHECK(hipFree(d_ranks));
+        HIP_CHECK(hipFree(d_digit_prefix));
+        HIP_CHECK(hipFree(d_digit_counts));
+    }
+}
@@ -49,3 +49,29 @@ typed_test_def(suite_name, name_suffix, SortKeysValues)
 
     static_for<0, n_sizes, key_type, value_type, 1, block_size>::run();
 }
+
+typed_test_def(suite_name, name_suffix, SortKeysMatchRank)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type = typename TestFixture::params::input_type;
+    using value_type = typename TestFixture::params::output_type;
+    constexpr size_t block_size = TestFixture::params::block_size;
+
+    static_for<0, n_sizes, key_type, value_type, 0, block_size, 4>::run();
+}
+
+typed_test_def(suite_name, name_suffix, SortKeysValuesMatchRank)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type = typename TestFixture::params::input_type;
+    using value_type = typename TestFixture::params::output_type;
+    constexpr size_t block_size = TestFixture::params::block_size;
+
+    static_for<0, n_sizes, key_type, value_type, 1, block_size, 8>::run();
+}
@@ -43,7 +43,8 @@ static constexpr unsigned int end_radix[n_sizes] = {
 template<
     unsigned int BlockSize,
     unsigned int ItemsPerThread,
-    class key_type
+    class key_type,
+    unsigned int RadixBitsPerPass = 1
 >
 __global__
 __launch_bounds__(BlockSize)
@@ -66,7 +67,11 @@ void sort_key_kernel(
 #endif
     rocprim::block_load_direct_blocked(lid, device_keys_output + block_offset, keys);
 
-    rocprim::block_radix_sort<key_type, BlockSize, ItemsPerThread> bsort;
+    rocprim::block_radix_sort<
+        key_type, BlockSize, ItemsPerThread, rocprim::empty_type, 1, 1,
+        rocprim::radix_float_order::signed_zeros_equal, rocprim::identity_decomposer,
+        RadixBitsPerPass
+    > bsort;
 
     if(to_striped)
     {
@@ -92,7 +97,8 @@ template<
     unsigned int BlockSize,
     unsigned int ItemsPerThread,
     class key_type,
-    class value_type
+    class value_type,
+    unsigned int RadixBitsPerPass = 1
 >
 __global__
 __launch_bounds__(BlockSize)
@@ -113,7 +119,11 @@ void sort_key_value_kernel(
     rocprim::block_load_direct_blocked(lid, device_keys_output + block_offset, keys);
     rocprim::block_load_direct_blocked(lid, device_values_output + block_offset, values);
 
-    rocprim::block_radix_sort<key_type, BlockSize, ItemsPerThread, value_type> bsort;
+    rocprim::block_radix_sort<
+        key_type, BlockSize, ItemsPerThread, value_type, 1, 1,
+        rocprim::radix_float_order::signed_zeros_equal, rocprim::identity_decomposer,
+        RadixBitsPerPass
+    > bsort;
     if(to_striped)
     {
         if(descending)
@@ -146,7 +156,8 @@ template<
     bool Descending = false,
     bool ToStriped = false,
     unsigned int StartBit = 0,
-    unsigned int EndBit = sizeof(Key) * 8
+    unsigned int EndBit = sizeof(Key) * 8,
+    unsigned int RadixBitsPerPass = 1
 >
 auto test_block_radix_sort()
 -> typename std::enable_if<Method == 0>::type
@@ -215,7 +226,7 @@ auto test_block_radix_sort()
 
         // Running kernel
         hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(sort_key_kernel<block_size, items_per_thread, key_type>),
+            HIP_KERNEL_NAME(sort_key_kernel<block_size, items_per_thread, key_type, RadixBitsPerPass>),
             dim3(grid_size), dim3(block_size), 0, 0,
             device_keys_output, to_striped, descending, start_bit, end_bit
         );
@@ -246,7 +257,8 @@ template<
     bool Descending = false,
     bool ToStriped = false,
     unsigned int StartBit = 0,
-    unsigned int EndBit = sizeof(Key) * 8
+    unsigned int EndBit = sizeof(Key) * 8,
+    unsigned int RadixBitsPerPass = 1
 >
 auto test_block_radix_sort()
 -> typename std::enable_if<Method == 1>::type
@@ -342,7 +354,7 @@ auto test_block_radix_sort()
 
         // Running kernel
         hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(sort_key_value_kernel<block_size, items_per_thread, key_type, value_type>),
+            HIP_KERNEL_NAME(sort_key_value_kernel<block_size, items_per_thread, key_type, value_type, RadixBitsPerPass>),
             dim3(grid_size), dim3(block_size), 0, 0,
             device_keys_output, device_values_output, to_striped, descending, start_bit, end_bit
         );
@@ -380,7 +392,8 @@ template <
     class T,
     class U,
     int Method,
-    unsigned int BlockSize = 256U
+    unsigned int BlockSize = 256U,
+    unsigned int RadixBitsPerPass = 1
 >
 struct static_for
 {
@@ -388,8 +401,8 @@ struct static_for
 
     static void run()
     {
-        test_block_radix_sort<T, U, Method, BlockSize, items_radix[First], desc_radix[First], striped_radix[First], start_radix[First], end>();
-        static_for<First + 1, Last, T, U, Method, BlockSize>::run();
+        test_block_radix_sort<T, U, Method, BlockSize, items_radix[First], desc_radix[First], striped_radix[First], start_radix[First], end, RadixBitsPerPass>();
+        static_for<First + 1, Last, T, U, Method, BlockSize, RadixBitsPerPass>::run();
     }
 };
 
@@ -398,9 +411,10 @@ template <
     class T,
     class U,
     int Method,
-    unsigned int BlockSize
+    unsigned int BlockSize,
+    unsigned int RadixBitsPerPass
 >
-struct static_for<N, N, T, U, Method, BlockSize>
+struct static_for<N, N, T, U, Method, BlockSize, RadixBitsPerPass>
 {
     static void run()
     {
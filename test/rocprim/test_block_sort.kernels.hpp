@@ -30,8 +30,7 @@ constexpr bool is_buildable(unsigned int                  BlockSize,
     switch(algorithm)
     {
         case rocprim::block_sort_algorithm::merge_sort:
-            return (rocprim::detail::is_power_of_two(ItemsPerThread)
-                    && rocprim::detail::is_power_of_two(BlockSize));
+            return rocprim::detail::is_power_of_two(BlockSize);
         case rocprim::block_sort_algorithm::bitonic_sort:
             return ItemsPerThread == 1u
                    || (ItemsPerThread > 1u && rocprim::detail::is_power_of_two(ItemsPerThread)
@@ -66,10 +65,10 @@ __global__ __launch_bounds__(BlockSize) void sort_keys_kernel(key_type* device_k
     else
     {
         key_type key  = device_key_output[index];
-        using st_type = typename rocprim::
-            block_sort<key_type, BlockSize, ItemsPerThread, rocprim::empty_type>::storage_type;
-        ROCPRIM_SHARED_MEMORY st_type                                                 storage;
-        rocprim::block_sort<key_type, BlockSize, ItemsPerThread, rocprim::empty_type> bsort;
+        using block_sort_type
+            = rocprim::block_sort<key_type, BlockSize, ItemsPerThread, rocprim::empty_type, algorithm>;
+        ROCPRIM_SHARED_MEMORY typename block_sort_type::storage_type storage;
+        block_sort_type                                              bsort;
         bsort.sort(key,
                    storage,
                    std::min(static_cast<size_t>(ItemsPerBlock), size - block_offset),
@@ -55,3 +55,151 @@ struct Floating;
 #define name_suffix Floating
 
 #include "test_block_sort.hpp"
+
+#undef suite_name
+#undef block_params
+#undef name_suffix
+
+template<unsigned int BlockSize, unsigned int ItemsPerThread>
+struct stable_params
+{
+    static constexpr unsigned int block_size       = BlockSize;
+    static constexpr unsigned int items_per_thread = ItemsPerThread;
+};
+
+template<class Params>
+class RocprimBlockSortMergeStableTests : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<stable_params<64, 3>,
+                         stable_params<64, 32>,
+                         stable_params<128, 7>,
+                         stable_params<128, 16>,
+                         stable_params<256, 1>,
+                         stable_params<256, 8>,
+                         stable_params<512, 2>>
+    StableParams;
+
+TYPED_TEST_SUITE(RocprimBlockSortMergeStableTests, StableParams);
+
+// Keys of every block are sorted with the values holding their positions, only the first
+// valid items of the block are sorted, the number of them depends on the block
+template<unsigned int BlockSize, unsigned int ItemsPerThread>
+__global__
+__launch_bounds__(BlockSize)
+void sort_pairs_valid_kernel(int* keys, unsigned int* values, const unsigned int* valid)
+{
+    using block_sort_type = rocprim::block_sort<int,
+                                                BlockSize,
+                                                ItemsPerThread,
+                                                unsigned int,
+                                                rocprim::block_sort_algorithm::merge_sort>;
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int lid    = threadIdx.x;
+    const unsigned int offset = blockIdx.x * items_per_block;
+
+    ROCPRIM_SHARED_MEMORY typename block_sort_type::storage_type storage;
+
+    int          thread_keys[ItemsPerThread];
+    unsigned int thread_values[ItemsPerThread];
+    rocprim::block_load_direct_blocked(lid, keys + offset, thread_keys);
+    rocprim::block_load_direct_blocked(lid, values + offset, thread_values);
+
+    block_sort_type().sort(thread_keys, thread_values, storage, valid[blockIdx.x]);
+
+    rocprim::block_store_direct_blocked(lid, keys + offset, thread_keys);
+    rocprim::block_store_direct_blocked(lid, values + offset, thread_values);
+}
+
+TYPED_TEST(RocprimBlockSortMergeStableTests, SortPairsValid)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    constexpr unsigned int block_size       = TestFixture::params::block_size;
+    constexpr unsigned int items_per_thread = TestFixture::params::items_per_thread;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+    constexpr unsigned int grid_size        = 37;
+    constexpr unsigned int size             = grid_size * items_per_block;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // Few distinct keys to check the stability
+        const std::vector<int> keys = test_utils::get_random_data<int>(size, 0, 16, seed_value);
+        std::vector<unsigned int> values(size);
+        std::iota(values.begin(), values.end(), 0u);
+        std::vector<unsigned int> valid = test_utils::get_random_data<unsigned int>(
+            grid_size, 0, items_per_block, seed_value + 1);
+        valid[0] = items_per_block;
+
+        std::vector<std::pair<int, unsigned int>> expected(size);
+        for(size_t i = 0; i < size; i++)
+        {
+            expected[i] = std::make_pair(keys[i], values[i]);
+        }
+        for(unsigned int block = 0; block < grid_size; block++)
+        {
+            const auto first = expected.begin() + block * items_per_block;
+            std::stable_sort(first,
+                             first + valid[block],
+                             [](const std::pair<int, unsigned int>& a,
+                                const std::pair<int, unsigned int>& b)
+                             { return a.first < b.first; });
+        }
+
+        int*          d_keys;
+        unsigned int* d_values;
+        unsigned int* d_valid;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, size * sizeof(int)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_values, size * sizeof(unsigned int)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_valid, grid_size * sizeof(unsigned int)));
+        HIP_CHECK(hipMemcpy(d_keys, keys.data(), size * sizeof(int), hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_values,
+                            values.data(),
+                            size * sizeof(unsigned int),
+                            hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_valid,
+                            valid.data(),
+                            grid_size * sizeof(unsigned int),
+                            hipMemcpyHostToDevice));
+
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(sort_pairs_valid_kernel<block_size, items_per_thread>),
+                           dim3(grid_size),
+                           dim3(block_size),
+                           0,
+                           0,
+                           d_keys,
+                           d_values,
+                           d_valid);
+        HIP_CHECK(hipGetLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<int>          output_keys(size);
+        std::vector<unsigned int> output_values(size);
+        HIP_CHECK(hipMemcpy(output_keys.data(), d_keys, size * sizeof(int), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(output_values.data(),
+                            d_values,
+                            size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+
+        // The items past the valid ones are left unchanged
+        for(size_t i = 0; i < size; i++)
+        {
+            ASSERT_EQ(output_keys[i], expected[i].first) << "where index = " << i;
+            ASSERT_EQ(output_values[i], expected[i].second) << "where index = " << i;
+        }
+
+        HIP_CHECK(hipFree(d_keys));
+        HIP_CHECK(hipFree(d_values));
+        HIP_CHECK(hipFree(d_valid));
+    }
+}
@@ -0,0 +1,141 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_transform.hpp>
+#include <rocprim/iterator/cache_modified_input_iterator.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+// Params for tests
+template<class InputType, rocprim::cache_load_modifier Modifier>
+struct RocprimCacheModifiedInputIteratorParams
+{
+    using input_type = InputType;
+    static constexpr rocprim::cache_load_modifier modifier = Modifier;
+};
+
+template<class Params>
+class RocprimCacheModifiedInputIteratorTests : public ::testing::Test
+{
+public:
+    using input_type = typename Params::input_type;
+    static constexpr rocprim::cache_load_modifier modifier = Params::modifier;
+};
+
+typedef ::testing::Types<
+    RocprimCacheModifiedInputIteratorParams<int, rocprim::load_default>,
+    RocprimCacheModifiedInputIteratorParams<int, rocprim::load_ldg>,
+    RocprimCacheModifiedInputIteratorParams<unsigned int, rocprim::load_cs>,
+    RocprimCacheModifiedInputIteratorParams<unsigned char, rocprim::load_cg>,
+    RocprimCacheModifiedInputIteratorParams<float, rocprim::load_ca>,
+    RocprimCacheModifiedInputIteratorParams<double, rocprim::load_cv>,
+    RocprimCacheModifiedInputIteratorParams<unsigned long long, rocprim::load_ldg>,
+    RocprimCacheModifiedInputIteratorParams<test_utils::custom_test_type<int>, rocprim::load_cs>,
+    RocprimCacheModifiedInputIteratorParams<test_utils::custom_test_type<float>,
+                                            rocprim::load_ldg>>
+    RocprimCacheModifiedInputIteratorTestsParams;
+
+TYPED_TEST_SUITE(RocprimCacheModifiedInputIteratorTests,
+                 RocprimCacheModifiedInputIteratorTestsParams);
+
+template<class T>
+struct transform
+{
+    __device__ __host__
+    constexpr T operator()(const T& a) const
+    {
+        return a + 5;
+    }
+};
+
+TEST(RocprimCacheModifiedInputIteratorHostTests, Host)
+{
+    const std::vector<int> values = {1, 2, 3, 4, 5};
+
+    auto iterator = rocprim::make_cache_modified_input_iterator<rocprim::load_cs>(values.data());
+    ASSERT_EQ(*iterator, 1);
+    ASSERT_EQ(iterator[3], 4);
+    ASSERT_EQ(*(iterator + 4), 5);
+    ASSERT_EQ((iterator + 4) - iterator, 4);
+    ++iterator;
+    ASSERT_EQ(*iterator, 2);
+    ASSERT_EQ(iterator.base(), values.data() + 1);
+}
+
+TYPED_TEST(RocprimCacheModifiedInputIteratorTests, Transform)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T        = typename TestFixture::input_type;
+    using Iterator = rocprim::cache_modified_input_iterator<T, TestFixture::modifier>;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<T> input(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                input[i] = test_utils::get_random_value<T>(1, 200, seed_value + i);
+            }
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            std::vector<T> expected(size);
+            std::transform(input.begin(), input.end(), expected.begin(), transform<T>());
+
+            HIP_CHECK(
+                rocprim::transform(Iterator(d_input), d_output, size, transform<T>(), stream));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<T> output(size);
+            HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+
+            for(size_t i = 0; i < size; i++)
+            {
+                ASSERT_EQ(output[i], expected[i]) << "where index = " << i;
+            }
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
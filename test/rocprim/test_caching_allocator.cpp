@@ -0,0 +1,178 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+#include <numeric>
+
+// required rocprim headers
+#include <rocprim/device/caching_allocator.hpp>
+#include <rocprim/device/device_reduce.hpp>
+#include <rocprim/functional.hpp>
+
+TEST(RocprimCachingAllocatorTests, ReuseOnSameStream)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreate(&stream));
+    {
+        rocprim::caching_allocator allocator;
+
+        void* first;
+        HIP_CHECK(allocator.allocate(&first, 1000, stream));
+        ASSERT_NE(first, nullptr);
+        HIP_CHECK(allocator.deallocate(first));
+        // 1000 bytes are rounded up to the 4096-byte bin
+        ASSERT_EQ(allocator.cached_bytes(), size_t(4096));
+
+        // A block of the same bin is reused without waiting on the same stream
+        void* second;
+        HIP_CHECK(allocator.allocate(&second, 3000, stream));
+        ASSERT_EQ(second, first);
+        ASSERT_EQ(allocator.cached_bytes(), size_t(0));
+
+        // The block is in use, so another one is allocated
+        void* third;
+        HIP_CHECK(allocator.allocate(&third, 3000, stream));
+        ASSERT_NE(third, second);
+
+        HIP_CHECK(allocator.deallocate(second));
+        HIP_CHECK(allocator.deallocate(third));
+        ASSERT_EQ(allocator.cached_bytes(), size_t(2 * 4096));
+
+        HIP_CHECK(allocator.free_all_cached());
+        ASSERT_EQ(allocator.cached_bytes(), size_t(0));
+    }
+    HIP_CHECK(hipStreamDestroy(stream));
+}
+
+TEST(RocprimCachingAllocatorTests, ReuseOnOtherStream)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    hipStream_t stream0;
+    hipStream_t stream1;
+    HIP_CHECK(hipStreamCreate(&stream0));
+    HIP_CHECK(hipStreamCreate(&stream1));
+    {
+        rocprim::caching_allocator allocator;
+
+        void* first;
+        HIP_CHECK(allocator.allocate(&first, 100, stream0));
+        HIP_CHECK(allocator.deallocate(first));
+
+        // Once the work of the first stream is completed, the block can be used by another one
+        HIP_CHECK(hipStreamSynchronize(stream0));
+        void* second;
+        HIP_CHECK(allocator.allocate(&second, 100, stream1));
+        ASSERT_EQ(second, first);
+        HIP_CHECK(allocator.deallocate(second));
+    }
+    HIP_CHECK(hipStreamDestroy(stream0));
+    HIP_CHECK(hipStreamDestroy(stream1));
+}
+
+TEST(RocprimCachingAllocatorTests, LargeBlocksAreNotCached)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    // Bins from 2^4 to 2^10 bytes, up to 2048 cached bytes
+    rocprim::caching_allocator allocator(2, 4, 10, 2048);
+
+    void* large;
+    HIP_CHECK(allocator.allocate(&large, 5000));
+    HIP_CHECK(allocator.deallocate(large));
+    ASSERT_EQ(allocator.cached_bytes(), size_t(0));
+
+    void* blocks[3];
+    for(void*& block : blocks)
+    {
+        HIP_CHECK(allocator.allocate(&block, 1024));
+    }
+    for(void* block : blocks)
+    {
+        HIP_CHECK(allocator.deallocate(block));
+    }
+    // The third block is above the limit
+    ASSERT_EQ(allocator.cached_bytes(), size_t(2048));
+
+    int unknown;
+    ASSERT_EQ(allocator.deallocate(&unknown), hipErrorInvalidValue);
+}
+
+TEST(RocprimCachingAllocatorTests, WithTemporaryStorage)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    const size_t     size = 1 << 20;
+    std::vector<int> input(size);
+    std::iota(input.begin(), input.end(), 0);
+    const long long expected = std::accumulate(input.begin(), input.end(), 0ll);
+
+    int*       d_input;
+    long long* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(int)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(long long)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(int), hipMemcpyHostToDevice));
+
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreate(&stream));
+    {
+        rocprim::caching_allocator allocator;
+        // The temporary storage of the first run is reused by the following ones
+        for(int run = 0; run < 3; run++)
+        {
+            HIP_CHECK(rocprim::with_temporary_storage(
+                allocator,
+                stream,
+                [&](void* temporary_storage, size_t& storage_size)
+                {
+                    return rocprim::reduce(temporary_storage,
+                                           storage_size,
+                                           d_input,
+                                           d_output,
+                                           size,
+                                           rocprim::plus<long long>(),
+                                           stream);
+                }));
+            HIP_CHECK(hipGetLastError());
+            ASSERT_GT(allocator.cached_bytes(), size_t(0));
+        }
+        HIP_CHECK(hipStreamSynchronize(stream));
+
+        long long output;
+        HIP_CHECK(hipMemcpy(&output, d_output, sizeof(long long), hipMemcpyDeviceToHost));
+        ASSERT_EQ(output, expected);
+    }
+    HIP_CHECK(hipStreamDestroy(stream));
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
@@ -0,0 +1,154 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/call_info.hpp>
+#include <rocprim/device/device_histogram.hpp>
+#include <rocprim/device/device_radix_sort.hpp>
+
+#include <string>
+#include <vector>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+namespace
+{
+
+// Sorts size random keys and returns the recorded information
+rocprim::device_call_info sort_keys(const size_t size, const unsigned int max_key)
+{
+    const std::vector<unsigned int> input
+        = test_utils::get_random_data<unsigned int>(size, 0, max_key, size);
+
+    unsigned int* d_input;
+    unsigned int* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(unsigned int)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(unsigned int)));
+    HIP_CHECK(
+        hipMemcpy(d_input, input.data(), size * sizeof(unsigned int), hipMemcpyHostToDevice));
+
+    size_t storage_bytes;
+    rocprim::reset_last_call_info();
+    HIP_CHECK(rocprim::radix_sort_keys(nullptr, storage_bytes, d_input, d_output, size));
+    // Queries of the size of the temporary storage are not recorded
+    EXPECT_EQ(rocprim::last_call_info().algorithm, nullptr);
+
+    void* d_temp_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, storage_bytes));
+    HIP_CHECK(rocprim::radix_sort_keys(d_temp_storage, storage_bytes, d_input, d_output, size));
+    const rocprim::device_call_info info = rocprim::last_call_info();
+
+    std::vector<unsigned int> output(size);
+    HIP_CHECK(
+        hipMemcpy(output.data(), d_output, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    std::vector<unsigned int> expected(input);
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(output, expected);
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipFree(d_temp_storage));
+    return info;
+}
+
+} // namespace
+
+TEST(RocprimCallInfoTests, RadixSort)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    const rocprim::device_call_info small = sort_keys(100, 1000000);
+    ASSERT_NE(small.algorithm, nullptr);
+    ASSERT_EQ(std::string(small.algorithm), "radix_sort");
+    ASSERT_EQ(std::string(small.path), "single");
+    ASSERT_EQ(small.bytes_read, 100 * sizeof(unsigned int));
+
+    const size_t                    large_size = 1 << 22;
+    const rocprim::device_call_info large      = sort_keys(large_size, 1000000);
+    ASSERT_NE(large.algorithm, nullptr);
+    ASSERT_EQ(std::string(large.algorithm), "radix_sort");
+    const std::string large_path = large.path;
+    ASSERT_TRUE(large_path == "onesweep" || large_path == "iterations") << large_path;
+    // The digits above 2^20 are uniform and skipped
+    const rocprim::device_call_info full = sort_keys(large_size, 0xFFFFFFFFu);
+    ASSERT_GT(large.passes, 0u);
+    ASSERT_LT(large.passes, full.passes);
+    ASSERT_GE(large.bytes_read, large.passes * large_size * sizeof(unsigned int));
+    ASSERT_GE(large.bytes_written, large.passes * large_size * sizeof(unsigned int));
+
+    rocprim::reset_last_call_info();
+    ASSERT_EQ(rocprim::last_call_info().algorithm, nullptr);
+}
+
+TEST(RocprimCallInfoTests, Histogram)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    const size_t             size  = 1 << 20;
+    const std::vector<float> input = test_utils::get_random_data<float>(size, 0.0f, 1.0f, size);
+
+    float*        d_input;
+    unsigned int* d_histogram;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(float)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_histogram, 256 * sizeof(unsigned int)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(float), hipMemcpyHostToDevice));
+
+    size_t storage_bytes;
+    HIP_CHECK(rocprim::histogram_even(nullptr,
+                                      storage_bytes,
+                                      d_input,
+                                      static_cast<unsigned int>(size),
+                                      d_histogram,
+                                      257,
+                                      0.0f,
+                                      1.0f));
+    void* d_temp_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, storage_bytes));
+    HIP_CHECK(rocprim::histogram_even(d_temp_storage,
+                                      storage_bytes,
+                                      d_input,
+                                      static_cast<unsigned int>(size),
+                                      d_histogram,
+                                      257,
+                                      0.0f,
+                                      1.0f));
+
+    const rocprim::device_call_info info = rocprim::last_call_info();
+    ASSERT_NE(info.algorithm, nullptr);
+    ASSERT_EQ(std::string(info.algorithm), "histogram");
+    // 256 bins fit in shared memory with the default configs
+    ASSERT_EQ(std::string(info.path), "shared");
+    ASSERT_EQ(info.passes, 1u);
+    ASSERT_EQ(info.bytes_read, size * sizeof(float));
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_histogram));
+    HIP_CHECK(hipFree(d_temp_storage));
+}
@@ -77,6 +77,12 @@ TEST(RocprimConfigDispatchTests, ParseCommonArches)
     ASSERT_EQ(parse_gcn_arch("gfx906:::"), target_arch::gfx906);
     ASSERT_EQ(parse_gcn_arch("gfx908:"), target_arch::gfx908);
     ASSERT_EQ(parse_gcn_arch("gfx90a:sramecc+:xnack-"), target_arch::gfx90a);
+    ASSERT_EQ(parse_gcn_arch("gfx940:sramecc+:xnack-"), target_arch::gfx940);
+    ASSERT_EQ(parse_gcn_arch("gfx941"), target_arch::gfx941);
+    ASSERT_EQ(parse_gcn_arch("gfx942:sramecc+:xnack+"), target_arch::gfx942);
+    ASSERT_EQ(parse_gcn_arch("gfx1030"), target_arch::gfx1030);
+    ASSERT_EQ(parse_gcn_arch("gfx1100"), target_arch::gfx1100);
+    ASSERT_EQ(parse_gcn_arch("gfx11000"), target_arch::unknown);
 }
 
 #ifndef WIN32
@@ -108,3 +114,36 @@ TEST(RocprimConfigDispatchTests, DeviceIdFromStream)
     ASSERT_EQ(result, device_id);
 }
 #endif
+
+TEST(RocprimConfigDispatchTests, CachedDeviceProperties)
+{
+    using rocprim::detail::device_properties;
+    using rocprim::detail::get_device_properties;
+
+    const int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    hipDeviceProp_t expected;
+    HIP_CHECK(hipGetDeviceProperties(&expected, device_id));
+
+    device_properties props;
+    HIP_CHECK(get_device_properties(device_id, props));
+    ASSERT_EQ(props.warp_size, static_cast<unsigned int>(expected.warpSize));
+    ASSERT_EQ(props.compute_units, static_cast<unsigned int>(expected.multiProcessorCount));
+    ASSERT_EQ(rocprim::host_warp_size(), static_cast<unsigned int>(expected.warpSize));
+
+    target_arch arch_before;
+    HIP_CHECK(rocprim::detail::host_target_arch(0, arch_before));
+
+    rocprim::invalidate_device_properties_cache();
+
+    // Properties are queried again after invalidation
+    HIP_CHECK(get_device_properties(device_id, props));
+    ASSERT_EQ(props.warp_size, static_cast<unsigned int>(expected.warpSize));
+    ASSERT_EQ(props.compute_units, static_cast<unsigned int>(expected.multiProcessorCount));
+
+    target_arch arch_after;
+    HIP_CHECK(rocprim::detail::host_target_arch(0, arch_after));
+    ASSERT_EQ(arch_before, arch_after);
+}
@@ -0,0 +1,330 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+// required rocprim headers
+#include <rocprim/block/block_decode.hpp>
+#include <rocprim/device/device_histogram.hpp>
+#include <rocprim/device/device_reduce.hpp>
+#include <rocprim/device/device_select.hpp>
+#include <rocprim/functional.hpp>
+#include <rocprim/iterator/delta_decoding_iterator.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+// Returns the checkpoints of every interval-th value
+std::vector<int> get_checkpoints(const std::vector<int>& values, unsigned int interval)
+{
+    std::vector<int> checkpoints;
+    for(size_t i = 0; i < values.size(); i += interval)
+    {
+        checkpoints.push_back(values[i]);
+    }
+    return checkpoints;
+}
+
+TEST(RocprimDeltaDecodingIteratorTests, Host)
+{
+    const std::vector<int> deltas      = {4, 1, -2, 5, 0, 3, -1};
+    const std::vector<int> values      = {4, 5, 3, 8, 8, 11, 10};
+    const std::vector<int> checkpoints = get_checkpoints(values, 3);
+
+    auto iterator = rocprim::make_delta_decoding_iterator(deltas.data(), checkpoints.data(), 3);
+    for(size_t i = 0; i < values.size(); i++)
+    {
+        ASSERT_EQ(iterator[i], values[i]) << "where index = " << i;
+    }
+    ASSERT_EQ(*(iterator + 5), 11);
+    ASSERT_EQ(*(--(iterator + 4)), 8);
+    ASSERT_EQ((iterator + 7) - iterator, 7);
+    ASSERT_EQ(std::accumulate(iterator, iterator + 7, 0), 49);
+}
+
+template<unsigned int BlockSize, unsigned int ItemsPerThread>
+__global__ __launch_bounds__(BlockSize) void delta_decode_kernel(const int*   deltas,
+                                                                 int*         output,
+                                                                 unsigned int size)
+{
+    using decode_type = rocprim::block_delta_decode<int, BlockSize, ItemsPerThread>;
+    __shared__ typename decode_type::storage_type storage;
+
+    constexpr unsigned int items_per_tile = BlockSize * ItemsPerThread;
+
+    // A single block decodes all tiles, carrying the prefix
+    int prefix = 0;
+    for(unsigned int offset = 0; offset < size; offset += items_per_tile)
+    {
+        const unsigned int valid = rocprim::min(size - offset, items_per_tile);
+
+        int values[ItemsPerThread];
+        if(valid == items_per_tile)
+        {
+            decode_type().decode(deltas + offset, values, prefix, storage);
+        }
+        else
+        {
+            decode_type().decode(deltas + offset, values, valid, prefix, storage);
+        }
+        rocprim::syncthreads();
+
+        for(unsigned int item = 0; item < ItemsPerThread; item++)
+        {
+            const unsigned int index = offset + threadIdx.x * ItemsPerThread + item;
+            if(index < size)
+            {
+                output[index] = values[item];
+            }
+        }
+    }
+}
+
+TEST(RocprimDeltaDecodingIteratorTests, BlockDeltaDecode)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    constexpr unsigned int block_size       = 128;
+    constexpr unsigned int items_per_thread = 4;
+
+    for(size_t size : {size_t(512), size_t(1000), size_t(12345)})
+    {
+        SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+        const std::vector<int> deltas = test_utils::get_random_data<int>(size, -100, 100, seeds[0]);
+        std::vector<int>       values(size);
+        std::partial_sum(deltas.begin(), deltas.end(), values.begin());
+
+        int* d_deltas;
+        int* d_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_deltas, size * sizeof(int)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(int)));
+        HIP_CHECK(
+            hipMemcpy(d_deltas, deltas.data(), size * sizeof(int), hipMemcpyHostToDevice));
+
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(delta_decode_kernel<block_size, items_per_thread>),
+                           dim3(1),
+                           dim3(block_size),
+                           0,
+                           0,
+                           d_deltas,
+                           d_output,
+                           static_cast<unsigned int>(size));
+        HIP_CHECK(hipGetLastError());
+
+        std::vector<int> output(size);
+        HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(int), hipMemcpyDeviceToHost));
+        ASSERT_EQ(output, values);
+
+        HIP_CHECK(hipFree(d_deltas));
+        HIP_CHECK(hipFree(d_output));
+    }
+}
+
+struct is_odd_op
+{
+    __device__ __host__
+    bool operator()(int value) const
+    {
+        return (value & 1) != 0;
+    }
+};
+
+TEST(RocprimDeltaDecodingIteratorTests, DeviceAlgorithms)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    constexpr unsigned int interval = 32;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+            if(size == 0)
+            {
+                continue;
+            }
+
+            // Non-negative deltas keep the values in the range of the histogram
+            const std::vector<int> deltas
+                = test_utils::get_random_data<int>(size, 0, 2, seed_value);
+            std::vector<int> input(size);
+            std::partial_sum(deltas.begin(), deltas.end(), input.begin());
+            const std::vector<int> checkpoints = get_checkpoints(input, interval);
+
+            int* d_deltas;
+            int* d_checkpoints;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_deltas, size * sizeof(int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_checkpoints,
+                                                         checkpoints.size() * sizeof(int)));
+            HIP_CHECK(
+                hipMemcpy(d_deltas, deltas.data(), size * sizeof(int), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_checkpoints,
+                                checkpoints.data(),
+                                checkpoints.size() * sizeof(int),
+                                hipMemcpyHostToDevice));
+            const auto decoded
+                = rocprim::make_delta_decoding_iterator(d_deltas, d_checkpoints, interval);
+
+            int*          d_output;
+            unsigned int* d_count;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_count, sizeof(unsigned int)));
+
+            // reduce
+            {
+                size_t temp_storage_size_bytes;
+                HIP_CHECK(rocprim::reduce(nullptr,
+                                          temp_storage_size_bytes,
+                                          decoded,
+                                          d_output,
+                                          size,
+                                          rocprim::maximum<int>(),
+                                          stream));
+                void* d_temp_storage;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+                HIP_CHECK(rocprim::reduce(d_temp_storage,
+                                          temp_storage_size_bytes,
+                                          decoded,
+                                          d_output,
+                                          size,
+                                          rocprim::maximum<int>(),
+                                          stream));
+                HIP_CHECK(hipGetLastError());
+
+                int output;
+                HIP_CHECK(hipMemcpy(&output, d_output, sizeof(int), hipMemcpyDeviceToHost));
+                ASSERT_EQ(output, input.back());
+                HIP_CHECK(hipFree(d_temp_storage));
+            }
+
+            // histogram_even
+            {
+                constexpr unsigned int bins        = 8;
+                const int              upper_level = input.back() + 1;
+                std::vector<unsigned int> expected(bins, 0);
+                for(int value : input)
+                {
+                    expected[static_cast<size_t>(static_cast<long long>(value) * bins
+                                                 / upper_level)]++;
+                }
+
+                unsigned int* d_histogram;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_histogram, bins * sizeof(unsigned int)));
+                size_t temp_storage_size_bytes;
+                HIP_CHECK(rocprim::histogram_even(nullptr,
+                                                  temp_storage_size_bytes,
+                                                  decoded,
+                                                  size,
+                                                  d_histogram,
+                                                  bins + 1,
+                                                  0,
+                                                  upper_level,
+                                                  stream));
+                void* d_temp_storage;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+                HIP_CHECK(rocprim::histogram_even(d_temp_storage,
+                                                  temp_storage_size_bytes,
+                                                  decoded,
+                                                  size,
+                                                  d_histogram,
+                                                  bins + 1,
+                                                  0,
+                                                  upper_level,
+                                                  stream));
+                HIP_CHECK(hipGetLastError());
+
+                std::vector<unsigned int> histogram(bins);
+                HIP_CHECK(hipMemcpy(histogram.data(),
+                                    d_histogram,
+                                    bins * sizeof(unsigned int),
+                                    hipMemcpyDeviceToHost));
+                ASSERT_EQ(histogram, expected);
+                HIP_CHECK(hipFree(d_temp_storage));
+                HIP_CHECK(hipFree(d_histogram));
+            }
+
+            // select the odd values
+            {
+                const is_odd_op  is_odd;
+                std::vector<int> expected;
+                std::copy_if(input.begin(), input.end(), std::back_inserter(expected), is_odd);
+
+                size_t temp_storage_size_bytes;
+                HIP_CHECK(rocprim::select(nullptr,
+                                          temp_storage_size_bytes,
+                                          decoded,
+                                          d_output,
+                                          d_count,
+                                          size,
+                                          is_odd,
+                                          stream));
+                void* d_temp_storage;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+                HIP_CHECK(rocprim::select(d_temp_storage,
+                                          temp_storage_size_bytes,
+                                          decoded,
+                                          d_output,
+                                          d_count,
+                                          size,
+                                          is_odd,
+                                          stream));
+                HIP_CHECK(hipGetLastError());
+
+                unsigned int count;
+                HIP_CHECK(hipMemcpy(&count, d_count, sizeof(unsigned int), hipMemcpyDeviceToHost));
+                ASSERT_EQ(count, expected.size());
+                std::vector<int> output(count);
+                HIP_CHECK(hipMemcpy(output.data(),
+                                    d_output,
+                                    count * sizeof(int),
+                                    hipMemcpyDeviceToHost));
+                ASSERT_EQ(output, expected);
+                HIP_CHECK(hipFree(d_temp_storage));
+            }
+
+            HIP_CHECK(hipFree(d_deltas));
+            HIP_CHECK(hipFree(d_checkpoints));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_count));
+        }
+    }
+}
@@ -32,11 +32,12 @@
 #include <rocprim/iterator/transform_iterator.hpp>
 
 #include <numeric>
+#include <random>
 #include <type_traits>
 
 namespace
 {
-template <typename T, unsigned int SizeLimit>
+template <typename T, unsigned int SizeLimit, bool OrderedInPlace>
 struct size_limit_config
 {
     static constexpr unsigned int item_scale
@@ -47,17 +48,18 @@ struct size_limit_config
                                               ::rocprim::max(1u, 16u / item_scale),
                                               rocprim::block_load_method::block_load_transpose,
                                               rocprim::block_store_method::block_store_transpose,
-                                              SizeLimit>;
+                                              SizeLimit,
+                                              OrderedInPlace>;
 };
 
 template <typename T>
-struct size_limit_config<T, ROCPRIM_GRID_SIZE_LIMIT>
+struct size_limit_config<T, ROCPRIM_GRID_SIZE_LIMIT, false>
 {
     using type = rocprim::default_config;
 };
 
-template <typename T, unsigned int SizeLimit>
-using size_limit_config_t = typename size_limit_config<T, SizeLimit>::type;
+template <typename T, unsigned int SizeLimit, bool OrderedInPlace = false>
+using size_limit_config_t = typename size_limit_config<T, SizeLimit, OrderedInPlace>::type;
 
 template <typename Config = rocprim::default_config,
           typename InputIt,
@@ -123,6 +125,112 @@ auto dispatch_adjacent_difference(std::false_type /*left*/,
         temporary_storage, storage_size, input, std::forward<Args>(args)...);
 }
 
+template <typename Config = rocprim::default_config,
+          typename InputIt,
+          typename OutputIt,
+          typename... Args>
+auto dispatch_segmented_adjacent_difference(std::true_type /*left*/,
+                                            std::false_type /*in_place*/,
+                                            void* const    temporary_storage,
+                                            std::size_t&   storage_size,
+                                            const InputIt  input,
+                                            const OutputIt output,
+                                            Args&&... args)
+{
+    return ::rocprim::segmented_adjacent_difference<Config>(
+        temporary_storage, storage_size, input, output, std::forward<Args>(args)...);
+}
+
+template <typename Config = rocprim::default_config,
+          typename InputIt,
+          typename OutputIt,
+          typename... Args>
+auto dispatch_segmented_adjacent_difference(std::false_type /*left*/,
+                                            std::false_type /*in_place*/,
+                                            void* const    temporary_storage,
+                                            std::size_t&   storage_size,
+                                            const InputIt  input,
+                                            const OutputIt output,
+                                            Args&&... args)
+{
+    return ::rocprim::segmented_adjacent_difference_right<Config>(
+        temporary_storage, storage_size, input, output, std::forward<Args>(args)...);
+}
+
+template <typename Config = rocprim::default_config,
+          typename InputIt,
+          typename OutputIt,
+          typename... Args>
+auto dispatch_segmented_adjacent_difference(std::true_type /*left*/,
+                                            std::true_type /*in_place*/,
+                                            void* const   temporary_storage,
+                                            std::size_t&  storage_size,
+                                            const InputIt input,
+                                            const OutputIt /*output*/,
+                                            Args&&... args)
+{
+    return ::rocprim::segmented_adjacent_difference_inplace<Config>(
+        temporary_storage, storage_size, input, std::forward<Args>(args)...);
+}
+
+template <typename Config = rocprim::default_config,
+          typename InputIt,
+          typename OutputIt,
+          typename... Args>
+auto dispatch_segmented_adjacent_difference(std::false_type /*left*/,
+                                            std::true_type /*in_place*/,
+                                            void* const   temporary_storage,
+                                            std::size_t&  storage_size,
+                                            const InputIt input,
+                                            const OutputIt /*output*/,
+                                            Args&&... args)
+{
+    return ::rocprim::segmented_adjacent_difference_right_inplace<Config>(
+        temporary_storage, storage_size, input, std::forward<Args>(args)...);
+}
+
+template <typename Output, typename T, typename BinaryFunction>
+auto get_expected_segmented_result(const std::vector<T>&             input,
+                                   const std::vector<unsigned char>& head_flags,
+                                   const BinaryFunction              op,
+                                   std::true_type /*left*/)
+{
+    std::vector<Output> result(input.size());
+    for(std::size_t i = 0; i < input.size(); ++i)
+    {
+        if(i == 0 || head_flags[i])
+        {
+            result[i] = input[i];
+        }
+        else
+        {
+            result[i] = op(input[i], input[i - 1]);
+        }
+    }
+    return result;
+}
+
+template <typename Output, typename T, typename BinaryFunction>
+auto get_expected_segmented_result(const std::vector<T>&             input,
+                                   const std::vector<unsigned char>& head_flags,
+                                   const BinaryFunction              op,
+                                   std::false_type /*left*/)
+{
+    std::vector<Output> result(input.size());
+    for(std::size_t i = 0; i < input.size(); ++i)
+    {
+        if(i + 1 == input.size() || head_flags[i + 1])
+        {
+            result[i] = input[i];
+        }
+        else
+        {
+            result[i] = op(input[i], input[i + 1]);
+        }
+    }
+    return result;
+}
+
 template <typename Output, typename T, typename BinaryFunction>
 auto get_expected_result(const std::vector<T>& input,
                          const BinaryFunction  op,
@@ -151,7 +259,8 @@ template <class InputType,
           bool         Left                = true,
           bool         InPlace             = false,
           bool         UseIdentityIterator = false,
-          unsigned int SizeLimit           = ROCPRIM_GRID_SIZE_LIMIT>
+          unsigned int SizeLimit           = ROCPRIM_GRID_SIZE_LIMIT,
+          bool         OrderedInPlace      = false>
 struct DeviceAdjacentDifferenceParams
 {
     using input_type                              = InputType;
@@ -160,6 +269,7 @@ struct DeviceAdjacentDifferenceParams
     static constexpr bool   in_place              = InPlace;
     static constexpr bool   use_identity_iterator = UseIdentityIterator;
     static constexpr size_t size_limit            = SizeLimit;
+    static constexpr bool   ordered_in_place      = OrderedInPlace;
 };
 
 template <class Params>
@@ -173,6 +283,7 @@ public:
     static constexpr bool   use_identity_iterator = Params::use_identity_iterator;
     static constexpr bool   debug_synchronous     = false;
     static constexpr size_t size_limit            = Params::size_limit;
+    static constexpr bool   ordered_in_place      = Params::ordered_in_place;
 };
 
 using custom_double2     = test_utils::custom_test_type<double>;
@@ -190,7 +301,10 @@ using RocprimDeviceAdjacentDifferenceTestsParams = ::testing::Types<
                                    false,
                                    true,
                                    true,
-                                   4096>>;
+                                   4096>,
+    DeviceAdjacentDifferenceParams<int, int, true, true, false, ROCPRIM_GRID_SIZE_LIMIT, true>,
+    DeviceAdjacentDifferenceParams<int8_t, int8_t, false, true, false, 2048, true>,
+    DeviceAdjacentDifferenceParams<custom_double2, custom_double2, true, true, false, 8192, true>>;
 
 TYPED_TEST_SUITE(RocprimDeviceAdjacentDifferenceTests, RocprimDeviceAdjacentDifferenceTestsParams);
 
@@ -206,7 +320,7 @@ TYPED_TEST(RocprimDeviceAdjacentDifferenceTests, AdjacentDifference)
     static constexpr bool in_place              = TestFixture::in_place;
     static constexpr bool use_identity_iterator = TestFixture::use_identity_iterator;
     static constexpr bool debug_synchronous     = TestFixture::debug_synchronous;
-    using Config                                = size_limit_config_t<T, TestFixture::size_limit>;
+    using Config = size_limit_config_t<T, TestFixture::size_limit, TestFixture::ordered_in_place>;
 
     SCOPED_TRACE(testing::Message() << "left = " << left << ", in_place = " << in_place);
 
@@ -304,6 +418,166 @@ TYPED_TEST(RocprimDeviceAdjacentDifferenceTests, AdjacentDifference)
 }
 
 // Params for tests
+TYPED_TEST(RocprimDeviceAdjacentDifferenceTests, SegmentedAdjacentDifference)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                                     = typename TestFixture::input_type;
+    using output_type                           = typename TestFixture::output_type;
+    static constexpr bool left                  = TestFixture::left;
+    static constexpr bool in_place              = TestFixture::in_place;
+    static constexpr bool use_identity_iterator = TestFixture::use_identity_iterator;
+    static constexpr bool debug_synchronous     = TestFixture::debug_synchronous;
+    using Config = size_limit_config_t<T, TestFixture::size_limit, TestFixture::ordered_in_place>;
+
+    SCOPED_TRACE(testing::Message() << "left = " << left << ", in_place = " << in_place);
+
+    for(std::size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        const unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        std::default_random_engine                  gen(seed_value);
+        std::uniform_int_distribution<unsigned int> segment_length_dis(1, 1000);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            // The segments are given by head flags or by offsets
+            for(const bool use_offsets : {false, true})
+            {
+                static constexpr hipStream_t stream = 0; // default
+
+                SCOPED_TRACE(testing::Message()
+                             << "with size = " << size << ", use_offsets = " << use_offsets);
+
+                // Generate data
+                const std::vector<T> input
+                    = test_utils::get_random_data<T>(size, 1, 100, seed_value);
+                std::vector<output_type> output(input.size());
+
+                std::vector<unsigned char> head_flags(size, 0);
+                std::vector<unsigned int>  offsets;
+                for(std::size_t offset = 0; offset < size; offset += segment_length_dis(gen))
+                {
+                    head_flags[offset] = 1;
+                    offsets.push_back(static_cast<unsigned int>(offset));
+                }
+
+                T*             d_input;
+                output_type*   d_output = nullptr;
+                unsigned char* d_head_flags;
+                unsigned int*  d_offsets;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_input, input.size() * sizeof(input[0])));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_head_flags,
+                                                             head_flags.size()
+                                                                 * sizeof(head_flags[0])));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_offsets,
+                                                             offsets.size() * sizeof(offsets[0])));
+                HIP_CHECK(hipMemcpy(d_input,
+                                    input.data(),
+                                    input.size() * sizeof(input[0]),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_head_flags,
+                                    head_flags.data(),
+                                    head_flags.size() * sizeof(head_flags[0]),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_offsets,
+                                    offsets.data(),
+                                    offsets.size() * sizeof(offsets[0]),
+                                    hipMemcpyHostToDevice));
+
+                if(!in_place)
+                {
+                    HIP_CHECK(test_common_utils::hipMallocHelper(
+                        &d_output,
+                        output.size() * sizeof(output[0])));
+                }
+
+                static constexpr auto left_tag     = rocprim::detail::bool_constant<left> {};
+                static constexpr auto in_place_tag = rocprim::detail::bool_constant<in_place> {};
+
+                // Calculate expected results on host
+                const auto expected = get_expected_segmented_result<output_type>(
+                    input, head_flags, rocprim::minus<> {}, left_tag);
+
+                const auto output_it
+                    = test_utils::wrap_in_identity_iterator<use_identity_iterator>(d_output);
+
+                const auto run = [&](void* d_temp_storage, std::size_t& temp_storage_size)
+                {
+                    if(use_offsets)
+                    {
+                        return dispatch_segmented_adjacent_difference<Config>(
+                            left_tag,
+                            in_place_tag,
+                            d_temp_storage,
+                            temp_storage_size,
+                            d_input,
+                            output_it,
+                            rocprim::make_segment_head_flags(
+                                d_offsets,
+                                static_cast<unsigned int>(offsets.size())),
+                            size,
+                            rocprim::minus<> {},
+                            stream,
+                            debug_synchronous);
+                    }
+                    return dispatch_segmented_adjacent_difference<Config>(left_tag,
+                                                                          in_place_tag,
+                                                                          d_temp_storage,
+                                                                          temp_storage_size,
+                                                                          d_input,
+                                                                          output_it,
+                                                                          d_head_flags,
+                                                                          size,
+                                                                          rocprim::minus<> {},
+                                                                          stream,
+                                                                          debug_synchronous);
+                };
+
+                // Allocate temporary storage
+                std::size_t temp_storage_size;
+                void*       d_temp_storage = nullptr;
+                HIP_CHECK(run(d_temp_storage, temp_storage_size));
+
+                ASSERT_GT(temp_storage_size, 0);
+
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size));
+
+                // Run
+                HIP_CHECK(run(d_temp_storage, temp_storage_size));
+                HIP_CHECK(hipGetLastError());
+
+                // Copy output to host
+                HIP_CHECK(
+                    hipMemcpy(output.data(),
+                              in_place ? static_cast<void*>(d_input) : static_cast<void*>(d_output),
+                              output.size() * sizeof(output[0]),
+                              hipMemcpyDeviceToHost));
+
+                // Check if output values are as expected
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_near(
+                    output,
+                    expected,
+                    std::max(test_utils::precision<T>, test_utils::precision<output_type>)));
+
+                hipFree(d_input);
+                if(!in_place)
+                {
+                    hipFree(d_output);
+                }
+                hipFree(d_head_flags);
+                hipFree(d_offsets);
+                hipFree(d_temp_storage);
+            }
+        }
+    }
+}
+
 template <bool Left = true, bool InPlace = false>
 struct DeviceAdjacentDifferenceLargeParams
 {
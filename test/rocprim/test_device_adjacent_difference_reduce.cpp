@@ -0,0 +1,207 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_adjacent_difference_reduce.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+template<class Value, class Config = rocprim::default_config>
+struct params
+{
+    using value_type = Value;
+    using config     = Config;
+};
+
+template<class Params>
+class RocprimDeviceAdjacentDifferenceReduce : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+using small_block_config
+    = rocprim::reduce_config<64, 2, rocprim::block_reduce_algorithm::raking_reduce>;
+
+// The differences are reduced by several launches of 8 tiles
+using size_limit_config
+    = rocprim::reduce_config<256, 4, rocprim::block_reduce_algorithm::default_algorithm, 8192>;
+
+typedef ::testing::Types<params<int>,
+                         params<short>,
+                         params<float>,
+                         params<double>,
+                         params<long long, small_block_config>,
+                         params<int, size_limit_config>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimDeviceAdjacentDifferenceReduce, Params);
+
+template<class Config, class T, class U, class DifferenceOp, class ReduceOp>
+U run_adjacent_difference_reduce(const std::vector<T>& input,
+                                 const U               initial_value,
+                                 DifferenceOp          difference_op,
+                                 ReduceOp              reduce_op,
+                                 const hipStream_t     stream)
+{
+    const bool debug_synchronous = false;
+
+    const size_t size = input.size();
+
+    T* d_input;
+    U* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, (size + 1) * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(U)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+    size_t temporary_storage_bytes;
+    HIP_CHECK(rocprim::adjacent_difference_reduce<Config>(nullptr,
+                                                          temporary_storage_bytes,
+                                                          d_input,
+                                                          d_output,
+                                                          initial_value,
+                                                          size,
+                                                          difference_op,
+                                                          reduce_op,
+                                                          stream,
+                                                          debug_synchronous));
+    EXPECT_GT(temporary_storage_bytes, 0);
+    void* d_temporary_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(rocprim::adjacent_difference_reduce<Config>(d_temporary_storage,
+                                                          temporary_storage_bytes,
+                                                          d_input,
+                                                          d_output,
+                                                          initial_value,
+                                                          size,
+                                                          difference_op,
+                                                          reduce_op,
+                                                          stream,
+                                                          debug_synchronous));
+    HIP_CHECK(hipGetLastError());
+    HIP_CHECK(hipDeviceSynchronize());
+
+    U output;
+    HIP_CHECK(hipMemcpy(&output, d_output, sizeof(U), hipMemcpyDeviceToHost));
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+
+    return output;
+}
+
+// Few different values produce runs of equal items
+template<class T>
+std::vector<T> get_input(const size_t size, const unsigned int seed_value)
+{
+    return test_utils::get_random_data<T>(size, T(0), T(3), seed_value);
+}
+
+TYPED_TEST(RocprimDeviceAdjacentDifferenceReduce, CountChanges)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T      = typename TestFixture::params::value_type;
+    using config = typename TestFixture::params::config;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = get_input<T>(size, seed_value);
+
+            size_t expected = 5;
+            for(size_t i = 1; i < size; i++)
+            {
+                expected += input[i] != input[i - 1] ? 1 : 0;
+            }
+
+            const size_t output = run_adjacent_difference_reduce<config>(input,
+                                                                         size_t(5),
+                                                                         rocprim::not_equal_to<T>(),
+                                                                         rocprim::plus<size_t>(),
+                                                                         stream);
+            ASSERT_EQ(output, expected);
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceAdjacentDifferenceReduce, MaxDifference)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T      = typename TestFixture::params::value_type;
+    using config = typename TestFixture::params::config;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input
+                = test_utils::get_random_data<T>(size, T(-100), T(100), seed_value);
+
+            // The differences of the host are computed the same way, so they are exact
+            const T lowest   = std::numeric_limits<T>::lowest();
+            T       expected = lowest;
+            for(size_t i = 1; i < size; i++)
+            {
+                expected = std::max(expected, static_cast<T>(input[i] - input[i - 1]));
+            }
+
+            const T output = run_adjacent_difference_reduce<config>(input,
+                                                                    lowest,
+                                                                    rocprim::minus<T>(),
+                                                                    rocprim::maximum<T>(),
+                                                                    stream);
+            ASSERT_EQ(output, expected);
+        }
+    }
+}
@@ -0,0 +1,315 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_argminmax.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <limits>
+#include <random>
+#include <vector>
+
+template<class Value, class Config = rocprim::default_config>
+struct params
+{
+    using value_type = Value;
+    using config     = Config;
+};
+
+template<class Params>
+class RocprimDeviceArgMinMax : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+template<rocprim::segmented_reduce_algorithm Algorithm>
+using segmented_config = rocprim::reduce_config<256,
+                                                4,
+                                                rocprim::block_reduce_algorithm::default_algorithm,
+                                                ROCPRIM_GRID_SIZE_LIMIT,
+                                                false,
+                                                Algorithm>;
+
+using small_block_config
+    = rocprim::reduce_config<64, 2, rocprim::block_reduce_algorithm::raking_reduce>;
+
+typedef ::testing::Types<
+    params<int>,
+    params<unsigned char>,
+    params<float>,
+    params<double>,
+    params<long long, small_block_config>,
+    params<int, segmented_config<rocprim::segmented_reduce_algorithm::thread_per_segment>>,
+    params<double, segmented_config<rocprim::segmented_reduce_algorithm::warp_per_segment>>,
+    params<short, segmented_config<rocprim::segmented_reduce_algorithm::block_per_segment>>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimDeviceArgMinMax, Params);
+
+// Returns the index of the first smallest (or largest) value of [begin, end) relative to begin,
+// {1, max} (or {1, lowest}) if the range is empty
+template<bool Max, class T>
+rocprim::key_value_pair<int, T>
+    get_expected(const std::vector<T>& input, const size_t begin, const size_t end)
+{
+    if(begin == end)
+    {
+        return rocprim::key_value_pair<int, T>(1,
+                                               Max ? std::numeric_limits<T>::lowest()
+                                                   : std::numeric_limits<T>::max());
+    }
+    size_t best = begin;
+    for(size_t i = begin + 1; i < end; i++)
+    {
+        if(Max ? input[i] > input[best] : input[i] < input[best])
+        {
+            best = i;
+        }
+    }
+    return rocprim::key_value_pair<int, T>(best - begin, input[best]);
+}
+
+template<bool Max, class Config, class T>
+void test_argminmax(const std::vector<T>& input, const hipStream_t stream)
+{
+    using output_type = rocprim::key_value_pair<int, T>;
+
+    const bool debug_synchronous = false;
+
+    const size_t size = input.size();
+
+    T*           d_input;
+    output_type* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, (size + 1) * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(output_type)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+    auto run = [&](void* temporary_storage, size_t& storage_size)
+    {
+        if(Max)
+        {
+            return rocprim::argmax<Config>(temporary_storage,
+                                           storage_size,
+                                           d_input,
+                                           d_output,
+                                           size,
+                                           stream,
+                                           debug_synchronous);
+        }
+        return rocprim::argmin<Config>(temporary_storage,
+                                       storage_size,
+                                       d_input,
+                                       d_output,
+                                       size,
+                                       stream,
+                                       debug_synchronous);
+    };
+
+    size_t temporary_storage_bytes;
+    HIP_CHECK(run(nullptr, temporary_storage_bytes));
+    ASSERT_GT(temporary_storage_bytes, 0);
+    void* d_temporary_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(hipGetLastError());
+    HIP_CHECK(hipDeviceSynchronize());
+
+    output_type output;
+    HIP_CHECK(hipMemcpy(&output, d_output, sizeof(output_type), hipMemcpyDeviceToHost));
+
+    const output_type expected = get_expected<Max>(input, 0, size);
+    ASSERT_EQ(output.key, expected.key);
+    ASSERT_EQ(output.value, expected.value);
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
+
+template<bool Max, class Config, class T>
+void test_segmented_argminmax(const std::vector<T>&            input,
+                              const std::vector<unsigned int>& offsets,
+                              const hipStream_t                stream)
+{
+    using output_type = rocprim::key_value_pair<int, T>;
+
+    const bool debug_synchronous = false;
+
+    const size_t       size     = input.size();
+    const unsigned int segments = offsets.size() - 1;
+
+    T*            d_input;
+    output_type*  d_output;
+    unsigned int* d_offsets;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, (size + 1) * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, (segments + 1) * sizeof(output_type)));
+    HIP_CHECK(
+        test_common_utils::hipMallocHelper(&d_offsets, offsets.size() * sizeof(unsigned int)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemcpy(d_offsets,
+                        offsets.data(),
+                        offsets.size() * sizeof(unsigned int),
+                        hipMemcpyHostToDevice));
+
+    auto run = [&](void* temporary_storage, size_t& storage_size)
+    {
+        if(Max)
+        {
+            return rocprim::segmented_argmax<Config>(temporary_storage,
+                                                     storage_size,
+                                                     d_input,
+                                                     d_output,
+                                                     segments,
+                                                     d_offsets,
+                                                     d_offsets + 1,
+                                                     stream,
+                                                     debug_synchronous);
+        }
+        return rocprim::segmented_argmin<Config>(temporary_storage,
+                                                 storage_size,
+                                                 d_input,
+                                                 d_output,
+                                                 segments,
+                                                 d_offsets,
+                                                 d_offsets + 1,
+                                                 stream,
+                                                 debug_synchronous);
+    };
+
+    size_t temporary_storage_bytes;
+    HIP_CHECK(run(nullptr, temporary_storage_bytes));
+    ASSERT_GT(temporary_storage_bytes, 0);
+    void* d_temporary_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(hipGetLastError());
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<output_type> output(segments);
+    HIP_CHECK(hipMemcpy(output.data(),
+                        d_output,
+                        segments * sizeof(output_type),
+                        hipMemcpyDeviceToHost));
+
+    for(unsigned int segment = 0; segment < segments; segment++)
+    {
+        const output_type expected
+            = get_expected<Max>(input, offsets[segment], offsets[segment + 1]);
+        ASSERT_EQ(output[segment].key, expected.key) << "with segment = " << segment;
+        ASSERT_EQ(output[segment].value, expected.value) << "with segment = " << segment;
+    }
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipFree(d_offsets));
+}
+
+// Few different values produce many ties, which the smallest index must win
+template<class T>
+std::vector<T> get_input(const size_t size, const unsigned int seed_value)
+{
+    return test_utils::get_random_data<T>(size, T(0), T(100), seed_value);
+}
+
+TYPED_TEST(RocprimDeviceArgMinMax, ArgMinMax)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T      = typename TestFixture::params::value_type;
+    using config = typename TestFixture::params::config;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = get_input<T>(size, seed_value);
+            test_argminmax<false, config>(input, stream);
+            test_argminmax<true, config>(input, stream);
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceArgMinMax, SegmentedArgMinMax)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T      = typename TestFixture::params::value_type;
+    using config = typename TestFixture::params::config;
+
+    hipStream_t stream = 0; // default
+
+    std::random_device         rd;
+    std::default_random_engine gen(rd());
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // Short segments select the thread and warp algorithms, long ones the block algorithm
+        for(size_t max_segment_length : {4, 40, 1000, 100000})
+        {
+            SCOPED_TRACE(testing::Message() << "with max_segment_length = " << max_segment_length);
+
+            std::uniform_int_distribution<size_t> segment_length_dis(0, max_segment_length);
+
+            for(size_t size : test_utils::get_sizes(seed_value))
+            {
+                SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+                const std::vector<T> input = get_input<T>(size, seed_value);
+
+                std::vector<unsigned int> offsets;
+                size_t                    offset = 0;
+                while(offset < size)
+                {
+                    offsets.push_back(offset);
+                    offset += segment_length_dis(gen);
+                }
+                offsets.push_back(size);
+
+                test_segmented_argminmax<false, config>(input, offsets, stream);
+                test_segmented_argminmax<true, config>(input, offsets, stream);
+            }
+        }
+    }
+}
@@ -0,0 +1,199 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// required rocprim headers
+#include <rocprim/device/device_batch_memcpy.hpp>
+
+template<class Config = rocprim::default_config>
+struct params
+{
+    using config = Config;
+};
+
+template<class Params>
+class RocprimDeviceBatchMemcpy : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<params<>,
+                         params<rocprim::batch_memcpy_config<64, 16, 1024, 4096, 1>>,
+                         params<rocprim::batch_memcpy_config<128, 64, 4096, 8192, 2>>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimDeviceBatchMemcpy, Params);
+
+TYPED_TEST(RocprimDeviceBatchMemcpy, BatchMemcpy)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using config = typename TestFixture::params::config;
+
+    const bool debug_synchronous = false;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(unsigned int num_buffers : {0u, 1u, 10u, 1000u, 5000u})
+        {
+            SCOPED_TRACE(testing::Message() << "with num_buffers = " << num_buffers);
+
+            std::mt19937 engine(seed_value);
+            // Mostly small buffers, with some medium and large ones of every configuration
+            std::uniform_int_distribution<size_t> kind_distribution(0, 9);
+            std::uniform_int_distribution<size_t> small_distribution(0, 64);
+            std::uniform_int_distribution<size_t> medium_distribution(65, 16384);
+            std::uniform_int_distribution<size_t> large_distribution(16385, 100000);
+            // Offsets make the sources and the destinations differently aligned
+            std::uniform_int_distribution<size_t> offset_distribution(0, 15);
+
+            std::vector<size_t> sizes(num_buffers);
+            std::vector<size_t> source_offsets(num_buffers);
+            std::vector<size_t> destination_offsets(num_buffers);
+            size_t              source_bytes      = 0;
+            size_t              destination_bytes = 0;
+            for(unsigned int i = 0; i < num_buffers; i++)
+            {
+                const size_t kind = kind_distribution(engine);
+                sizes[i]          = kind < 7   ? small_distribution(engine)
+                                    : kind < 9 ? medium_distribution(engine)
+                                               : large_distribution(engine);
+                source_offsets[i]
+                    = source_bytes + (i % 2 == 0 ? 0 : offset_distribution(engine));
+                destination_offsets[i]
+                    = destination_bytes + (i % 3 == 0 ? 0 : offset_distribution(engine));
+                source_bytes      = (source_offsets[i] + sizes[i] + 15) / 16 * 16;
+                destination_bytes = (destination_offsets[i] + sizes[i] + 15) / 16 * 16;
+            }
+
+            std::vector<unsigned char> input(source_bytes);
+            std::uniform_int_distribution<int> byte_distribution(0, 255);
+            std::generate(input.begin(),
+                          input.end(),
+                          [&] { return static_cast<unsigned char>(byte_distribution(engine)); });
+
+            unsigned char* d_input;
+            unsigned char* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, source_bytes + 1));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, destination_bytes + 1));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), source_bytes, hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemset(d_output, 0, destination_bytes + 1));
+
+            std::vector<const unsigned char*> sources(num_buffers);
+            std::vector<unsigned char*>       destinations(num_buffers);
+            for(unsigned int i = 0; i < num_buffers; i++)
+            {
+                sources[i]      = d_input + source_offsets[i];
+                destinations[i] = d_output + destination_offsets[i];
+            }
+
+            const unsigned char** d_sources;
+            unsigned char**       d_destinations;
+            size_t*               d_sizes;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_sources,
+                                                         (num_buffers + 1) * sizeof(*d_sources)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(
+                &d_destinations,
+                (num_buffers + 1) * sizeof(*d_destinations)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_sizes,
+                                                         (num_buffers + 1) * sizeof(*d_sizes)));
+            HIP_CHECK(hipMemcpy(d_sources,
+                                sources.data(),
+                                num_buffers * sizeof(*d_sources),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_destinations,
+                                destinations.data(),
+                                num_buffers * sizeof(*d_destinations),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_sizes,
+                                sizes.data(),
+                                num_buffers * sizeof(*d_sizes),
+                                hipMemcpyHostToDevice));
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(rocprim::batch_memcpy<config>(nullptr,
+                                                    temp_storage_size_bytes,
+                                                    d_sources,
+                                                    d_destinations,
+                                                    d_sizes,
+                                                    num_buffers,
+                                                    stream,
+                                                    debug_synchronous));
+
+            // temp_storage_size_bytes must be >0
+            ASSERT_GT(temp_storage_size_bytes, 0);
+
+            void* d_temp_storage = nullptr;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            HIP_CHECK(rocprim::batch_memcpy<config>(d_temp_storage,
+                                                    temp_storage_size_bytes,
+                                                    d_sources,
+                                                    d_destinations,
+                                                    d_sizes,
+                                                    num_buffers,
+                                                    stream,
+                                                    debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<unsigned char> output(destination_bytes);
+            HIP_CHECK(
+                hipMemcpy(output.data(), d_output, destination_bytes, hipMemcpyDeviceToHost));
+
+            // Every buffer is copied and the bytes between the buffers are not written
+            std::vector<unsigned char> expected(destination_bytes, 0);
+            for(unsigned int i = 0; i < num_buffers; i++)
+            {
+                std::copy_n(input.begin() + source_offsets[i],
+                            sizes[i],
+                            expected.begin() + destination_offsets[i]);
+            }
+            for(size_t i = 0; i < destination_bytes; i++)
+            {
+                ASSERT_EQ(output[i], expected[i]) << "where index = " << i;
+            }
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_sources));
+            HIP_CHECK(hipFree(d_destinations));
+            HIP_CHECK(hipFree(d_sizes));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
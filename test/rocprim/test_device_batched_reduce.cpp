@@ -0,0 +1,226 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_batched_reduce.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+template<class Input,
+         class Output,
+         class ReduceOp = ::rocprim::plus<Input>,
+         int          Init            = 0,
+         unsigned int MaxProblemSize  = 100000,
+         class Config                 = rocprim::default_config>
+struct params
+{
+    using input_type                            = Input;
+    using output_type                           = Output;
+    using reduce_op_type                        = ReduceOp;
+    static constexpr int          init          = Init;
+    static constexpr unsigned int max_problem_size = MaxProblemSize;
+    using config                                = Config;
+};
+
+template<class Params>
+class RocprimDeviceBatchedReduce : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+using custom_int2 = test_utils::custom_test_type<int>;
+
+typedef ::testing::Types<
+    params<int, int>,
+    params<unsigned char, unsigned int, rocprim::plus<unsigned int>, 10>,
+    params<int, int, rocprim::maximum<int>, -100, 1000>,
+    params<long long, long long, rocprim::minimum<long long>, 1000, 1000000>,
+    params<custom_int2, custom_int2, rocprim::plus<custom_int2>, 5>,
+    params<int,
+           int,
+           rocprim::plus<int>,
+           0,
+           100000,
+           rocprim::reduce_config<64, 2, rocprim::block_reduce_algorithm::raking_reduce>>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimDeviceBatchedReduce, Params);
+
+// Sizes of problems of mixed sizes: many small, a few large and some empty ones
+inline std::vector<size_t> get_batched_problem_sizes(const unsigned int problems,
+                                                     const size_t       max_problem_size,
+                                                     const unsigned int seed_value)
+{
+    std::default_random_engine            gen(seed_value);
+    std::uniform_int_distribution<int>    kind_dis(0, 9);
+    std::uniform_int_distribution<size_t> small_dis(0, 100);
+    std::uniform_int_distribution<size_t> large_dis(0, max_problem_size);
+
+    std::vector<size_t> sizes(problems);
+    for(size_t& size : sizes)
+    {
+        size = kind_dis(gen) == 0 ? large_dis(gen) : small_dis(gen);
+    }
+    return sizes;
+}
+
+TYPED_TEST(RocprimDeviceBatchedReduce, Reduce)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using input_type     = typename TestFixture::params::input_type;
+    using output_type    = typename TestFixture::params::output_type;
+    using reduce_op_type = typename TestFixture::params::reduce_op_type;
+    using config         = typename TestFixture::params::config;
+
+    reduce_op_type reduce_op;
+
+    const output_type init              = output_type{TestFixture::params::init};
+    const bool        debug_synchronous = false;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(unsigned int problems : {0u, 1u, 10u, 1000u})
+        {
+            SCOPED_TRACE(testing::Message() << "with problems = " << problems);
+
+            const std::vector<size_t> sizes
+                = get_batched_problem_sizes(problems,
+                                            TestFixture::params::max_problem_size,
+                                            seed_value);
+            std::vector<size_t> offsets(problems + 1, 0);
+            for(unsigned int i = 0; i < problems; i++)
+            {
+                offsets[i + 1] = offsets[i] + sizes[i];
+            }
+            const size_t size = offsets[problems];
+
+            std::vector<input_type> input
+                = test_utils::get_random_data<input_type>(size, 0, 100, seed_value);
+
+            // Calculate expected results on host
+            std::vector<output_type> expected(problems);
+            for(unsigned int i = 0; i < problems; i++)
+            {
+                output_type aggregate = init;
+                for(size_t j = offsets[i]; j < offsets[i + 1]; j++)
+                {
+                    aggregate = reduce_op(aggregate, input[j]);
+                }
+                expected[i] = aggregate;
+            }
+
+            input_type*  d_input;
+            output_type* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(size, 1)
+                                                             * sizeof(input_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output,
+                                                         std::max(problems, 1u)
+                                                             * sizeof(output_type)));
+            HIP_CHECK(
+                hipMemcpy(d_input, input.data(), size * sizeof(input_type), hipMemcpyHostToDevice));
+
+            std::vector<input_type*>  inputs(problems);
+            std::vector<output_type*> outputs(problems);
+            for(unsigned int i = 0; i < problems; i++)
+            {
+                inputs[i]  = d_input + offsets[i];
+                outputs[i] = d_output + i;
+            }
+
+            input_type**  d_inputs;
+            output_type** d_outputs;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_inputs,
+                                                         std::max(problems, 1u)
+                                                             * sizeof(input_type*)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_outputs,
+                                                         std::max(problems, 1u)
+                                                             * sizeof(output_type*)));
+            HIP_CHECK(hipMemcpy(d_inputs,
+                                inputs.data(),
+                                problems * sizeof(input_type*),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_outputs,
+                                outputs.data(),
+                                problems * sizeof(output_type*),
+                                hipMemcpyHostToDevice));
+
+            size_t temporary_storage_bytes;
+            HIP_CHECK(rocprim::batched_reduce<config>(nullptr,
+                                                      temporary_storage_bytes,
+                                                      d_inputs,
+                                                      d_outputs,
+                                                      sizes.data(),
+                                                      problems,
+                                                      reduce_op,
+                                                      init,
+                                                      stream,
+                                                      debug_synchronous));
+
+            ASSERT_GT(temporary_storage_bytes, 0);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(rocprim::batched_reduce<config>(d_temporary_storage,
+                                                      temporary_storage_bytes,
+                                                      d_inputs,
+                                                      d_outputs,
+                                                      sizes.data(),
+                                                      problems,
+                                                      reduce_op,
+                                                      init,
+                                                      stream,
+                                                      debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<output_type> output(problems);
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                problems * sizeof(output_type),
+                                hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_inputs));
+            HIP_CHECK(hipFree(d_outputs));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+        }
+    }
+}
@@ -0,0 +1,378 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_batched_scan.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <utility>
+#include <vector>
+
+template<class T,
+         class ScanOp                   = ::rocprim::plus<T>,
+         int          Init              = 0,
+         unsigned int MaxProblemSize    = 100000,
+         class Config                   = rocprim::default_config>
+struct params
+{
+    using type                                     = T;
+    using scan_op_type                             = ScanOp;
+    static constexpr int          init             = Init;
+    static constexpr unsigned int max_problem_size = MaxProblemSize;
+    using config                                   = Config;
+};
+
+template<class Params>
+class RocprimDeviceBatchedScan : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+using custom_int2 = test_utils::custom_test_type<int>;
+
+typedef ::testing::Types<
+    params<int>,
+    params<unsigned int, rocprim::plus<unsigned int>, 10>,
+    params<int, rocprim::maximum<int>, -100, 1000>,
+    params<long long, rocprim::minimum<long long>, 1000, 1000000>,
+    params<custom_int2, rocprim::plus<custom_int2>, 5>,
+    params<int,
+           rocprim::plus<int>,
+           0,
+           100000,
+           rocprim::scan_config<64,
+                                2,
+                                true,
+                                rocprim::block_load_method::block_load_transpose,
+                                rocprim::block_store_method::block_store_transpose,
+                                rocprim::block_scan_algorithm::using_warp_scan>>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimDeviceBatchedScan, Params);
+
+// Sizes of problems of mixed sizes: many small, a few large and some empty ones
+inline std::vector<size_t> get_batched_problem_sizes(const unsigned int problems,
+                                                     const size_t       max_problem_size,
+                                                     const unsigned int seed_value)
+{
+    std::default_random_engine            gen(seed_value);
+    std::uniform_int_distribution<int>    kind_dis(0, 9);
+    std::uniform_int_distribution<size_t> small_dis(0, 100);
+    std::uniform_int_distribution<size_t> large_dis(0, max_problem_size);
+
+    std::vector<size_t> sizes(problems);
+    for(size_t& size : sizes)
+    {
+        size = kind_dis(gen) == 0 ? large_dis(gen) : small_dis(gen);
+    }
+    return sizes;
+}
+
+template<bool Exclusive, class Params>
+void test_batched_scan()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T            = typename Params::type;
+    using scan_op_type = typename Params::scan_op_type;
+    using config       = typename Params::config;
+
+    scan_op_type scan_op;
+
+    const T    init              = T{Params::init};
+    const bool debug_synchronous = false;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(unsigned int problems : {0u, 1u, 10u, 1000u})
+        {
+            SCOPED_TRACE(testing::Message() << "with problems = " << problems);
+
+            const std::vector<size_t> sizes
+                = get_batched_problem_sizes(problems, Params::max_problem_size, seed_value);
+            std::vector<size_t> offsets(problems + 1, 0);
+            for(unsigned int i = 0; i < problems; i++)
+            {
+                offsets[i + 1] = offsets[i] + sizes[i];
+            }
+            const size_t size = offsets[problems];
+
+            std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+
+            // Calculate expected results on host
+            std::vector<T> expected(size);
+            for(unsigned int i = 0; i < problems; i++)
+            {
+                T aggregate = init;
+                for(size_t j = offsets[i]; j < offsets[i + 1]; j++)
+                {
+                    if(Exclusive)
+                    {
+                        expected[j] = aggregate;
+                        aggregate   = scan_op(aggregate, input[j]);
+                    }
+                    else
+                    {
+                        aggregate   = j == offsets[i] ? input[j] : scan_op(aggregate, input[j]);
+                        expected[j] = aggregate;
+                    }
+                }
+            }
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            std::vector<T*> inputs(problems);
+            std::vector<T*> outputs(problems);
+            for(unsigned int i = 0; i < problems; i++)
+            {
+                inputs[i]  = d_input + offsets[i];
+                outputs[i] = d_output + offsets[i];
+            }
+
+            T** d_inputs;
+            T** d_outputs;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_inputs,
+                                                         std::max(problems, 1u) * sizeof(T*)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_outputs,
+                                                         std::max(problems, 1u) * sizeof(T*)));
+            HIP_CHECK(hipMemcpy(d_inputs,
+                                inputs.data(),
+                                problems * sizeof(T*),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_outputs,
+                                outputs.data(),
+                                problems * sizeof(T*),
+                                hipMemcpyHostToDevice));
+
+            auto run = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+            {
+                if(Exclusive)
+                {
+                    return rocprim::batched_exclusive_scan<config>(d_temporary_storage,
+                                                                   temporary_storage_bytes,
+                                                                   d_inputs,
+                                                                   d_outputs,
+                                                                   sizes.data(),
+                                                                   problems,
+                                                                   init,
+                                                                   scan_op,
+                                                                   stream,
+                                                                   debug_synchronous);
+                }
+                return rocprim::batched_inclusive_scan<config>(d_temporary_storage,
+                                                               temporary_storage_bytes,
+                                                               d_inputs,
+                                                               d_outputs,
+                                                               sizes.data(),
+                                                               problems,
+                                                               scan_op,
+                                                               stream,
+                                                               debug_synchronous);
+            };
+
+            size_t temporary_storage_bytes;
+            HIP_CHECK(run(nullptr, temporary_storage_bytes));
+
+            ASSERT_GT(temporary_storage_bytes, 0);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<T> output(size);
+            HIP_CHECK(
+                hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_inputs));
+            HIP_CHECK(hipFree(d_outputs));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceBatchedScan, InclusiveScan)
+{
+    test_batched_scan<false, typename TestFixture::params>();
+}
+
+TYPED_TEST(RocprimDeviceBatchedScan, ExclusiveScan)
+{
+    test_batched_scan<true, typename TestFixture::params>();
+}
+
+template<bool Exclusive, class Params>
+void test_batched_scan_rows()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T            = typename Params::type;
+    using scan_op_type = typename Params::scan_op_type;
+    using config       = typename Params::config;
+
+    scan_op_type scan_op;
+
+    const T    init              = T{Params::init};
+    const bool debug_synchronous = false;
+
+    hipStream_t stream = 0; // default
+
+    // Pairs of the numbers of rows and the lengths of the rows: rows of single threads, of
+    // logical warps of all sizes and of multiple tiles
+    const std::vector<std::pair<unsigned int, size_t>> shapes = {
+        {0, 10}, {10, 0}, {1, 1}, {1000, 3}, {1000, 17}, {777, 100}, {300, 500}, {100, 3000},
+        {5, 100000}, {3, Params::max_problem_size},
+    };
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(const auto& shape : shapes)
+        {
+            const unsigned int rows       = shape.first;
+            const size_t       row_length = shape.second;
+            SCOPED_TRACE(testing::Message() << "with rows = " << rows);
+            SCOPED_TRACE(testing::Message() << "with row_length = " << row_length);
+
+            const size_t   size  = rows * row_length;
+            std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+
+            // Calculate expected results on host
+            std::vector<T> expected(size);
+            for(unsigned int i = 0; i < rows; i++)
+            {
+                T aggregate = init;
+                for(size_t j = i * row_length; j < (i + 1) * row_length; j++)
+                {
+                    if(Exclusive)
+                    {
+                        expected[j] = aggregate;
+                        aggregate   = scan_op(aggregate, input[j]);
+                    }
+                    else
+                    {
+                        aggregate   = j == i * row_length ? input[j] : scan_op(aggregate, input[j]);
+                        expected[j] = aggregate;
+                    }
+                }
+            }
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            auto run = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+            {
+                if(Exclusive)
+                {
+                    return rocprim::batched_exclusive_scan_rows<config>(d_temporary_storage,
+                                                                        temporary_storage_bytes,
+                                                                        d_input,
+                                                                        d_output,
+                                                                        rows,
+                                                                        row_length,
+                                                                        init,
+                                                                        scan_op,
+                                                                        stream,
+                                                                        debug_synchronous);
+                }
+                return rocprim::batched_inclusive_scan_rows<config>(d_temporary_storage,
+                                                                    temporary_storage_bytes,
+                                                                    d_input,
+                                                                    d_output,
+                                                                    rows,
+                                                                    row_length,
+                                                                    scan_op,
+                                                                    stream,
+                                                                    debug_synchronous);
+            };
+
+            size_t temporary_storage_bytes;
+            HIP_CHECK(run(nullptr, temporary_storage_bytes));
+
+            ASSERT_GT(temporary_storage_bytes, 0);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<T> output(size);
+            HIP_CHECK(
+                hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceBatchedScan, RowsInclusiveScan)
+{
+    test_batched_scan_rows<false, typename TestFixture::params>();
+}
+
+TYPED_TEST(RocprimDeviceBatchedScan, RowsExclusiveScan)
+{
+    test_batched_scan_rows<true, typename TestFixture::params>();
+}
@@ -415,3 +415,474 @@ TYPED_TEST(RocprimDeviceBinarySearch, BinarySearch)
         }
     }
 }
+
+TYPED_TEST(RocprimDeviceBinarySearch, SortedSearch)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using haystack_type = typename TestFixture::params::haystack_type;
+    using needle_type = typename TestFixture::params::needle_type;
+    using output_type = typename TestFixture::params::output_type;
+    using compare_op_type = typename TestFixture::params::compare_op_type;
+
+    hipStream_t stream = 0;
+
+    const bool debug_synchronous = false;
+
+    compare_op_type compare_op;
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const size_t haystack_size = size;
+            const size_t d = haystack_size / 100;
+
+            // Generate data
+            std::vector<haystack_type> haystack = test_utils::get_random_data<haystack_type>(
+                haystack_size, 0, haystack_size + 2 * d, seed_value
+            );
+            std::sort(haystack.begin(), haystack.end(), compare_op);
+
+            for(size_t needles_size : {(size_t)std::sqrt(size), size})
+            {
+                SCOPED_TRACE(testing::Message() << "with needles_size = " << needles_size);
+
+                // Use a narrower range for needles for checking out-of-haystack cases
+                std::vector<needle_type> needles = test_utils::get_random_data<needle_type>(
+                    needles_size, d, haystack_size + d, seed_value
+                );
+                std::sort(needles.begin(), needles.end(), compare_op);
+
+                haystack_type * d_haystack;
+                needle_type * d_needles;
+                output_type * d_output;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_haystack, haystack_size * sizeof(haystack_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_needles, needles_size * sizeof(needle_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, needles_size * sizeof(output_type)));
+                HIP_CHECK(
+                    hipMemcpy(
+                        d_haystack, haystack.data(),
+                        haystack_size * sizeof(haystack_type),
+                        hipMemcpyHostToDevice
+                    )
+                );
+                HIP_CHECK(
+                    hipMemcpy(
+                        d_needles, needles.data(),
+                        needles_size * sizeof(needle_type),
+                        hipMemcpyHostToDevice
+                    )
+                );
+
+                for(bool upper : {false, true})
+                {
+                    SCOPED_TRACE(testing::Message() << "with upper = " << upper);
+
+                    // Calculate expected results on host
+                    std::vector<output_type> expected(needles_size);
+                    for(size_t i = 0; i < needles_size; i++)
+                    {
+                        expected[i] = upper
+                            ? std::upper_bound(haystack.begin(), haystack.end(), needles[i], compare_op) - haystack.begin()
+                            : std::lower_bound(haystack.begin(), haystack.end(), needles[i], compare_op) - haystack.begin();
+                    }
+
+                    const auto sorted_search = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+                    {
+                        return upper
+                            ? rocprim::sorted_upper_bound(
+                                d_temporary_storage, temporary_storage_bytes,
+                                d_haystack, d_needles, d_output,
+                                haystack_size, needles_size,
+                                compare_op,
+                                stream, debug_synchronous
+                            )
+                            : rocprim::sorted_lower_bound(
+                                d_temporary_storage, temporary_storage_bytes,
+                                d_haystack, d_needles, d_output,
+                                haystack_size, needles_size,
+                                compare_op,
+                                stream, debug_synchronous
+                            );
+                    };
+
+                    size_t temporary_storage_bytes;
+                    HIP_CHECK(sorted_search(nullptr, temporary_storage_bytes));
+
+                    ASSERT_GT(temporary_storage_bytes, 0);
+
+                    void * d_temporary_storage;
+                    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+                    HIP_CHECK(sorted_search(d_temporary_storage, temporary_storage_bytes));
+
+                    std::vector<output_type> output(needles_size);
+                    HIP_CHECK(
+                        hipMemcpy(
+                            output.data(), d_output,
+                            needles_size * sizeof(output_type),
+                            hipMemcpyDeviceToHost
+                        )
+                    );
+
+                    HIP_CHECK(hipFree(d_temporary_storage));
+
+                    ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+                }
+
+                HIP_CHECK(hipFree(d_haystack));
+                HIP_CHECK(hipFree(d_needles));
+                HIP_CHECK(hipFree(d_output));
+            }
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceBinarySearch, IndexedSearch)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using haystack_type = typename TestFixture::params::haystack_type;
+    using needle_type = typename TestFixture::params::needle_type;
+    using output_type = typename TestFixture::params::output_type;
+    using compare_op_type = typename TestFixture::params::compare_op_type;
+
+    hipStream_t stream = 0;
+
+    const bool debug_synchronous = false;
+
+    compare_op_type compare_op;
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const size_t haystack_size = size;
+            const size_t needles_size = (size_t)std::sqrt(size); // cast promises no data loss, silences warning
+            const size_t d = haystack_size / 100;
+
+            // Generate data
+            std::vector<haystack_type> haystack = test_utils::get_random_data<haystack_type>(
+                haystack_size, 0, haystack_size + 2 * d, seed_value
+            );
+            std::sort(haystack.begin(), haystack.end(), compare_op);
+
+            // Use a narrower range for needles for checking out-of-haystack cases
+            std::vector<needle_type> needles = test_utils::get_random_data<needle_type>(
+                needles_size, d, haystack_size + d, seed_value
+            );
+
+            haystack_type * d_haystack;
+            needle_type * d_needles;
+            output_type * d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_haystack, haystack_size * sizeof(haystack_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_needles, needles_size * sizeof(needle_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, needles_size * sizeof(output_type)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_haystack, haystack.data(),
+                    haystack_size * sizeof(haystack_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+            HIP_CHECK(
+                hipMemcpy(
+                    d_needles, needles.data(),
+                    needles_size * sizeof(needle_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            for(unsigned int index_size : {1u, 7u, 1024u})
+            {
+                SCOPED_TRACE(testing::Message() << "with index_size = " << index_size);
+
+                haystack_type * d_index;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_index, index_size * sizeof(haystack_type)));
+
+                void * d_temporary_storage = nullptr;
+                size_t temporary_storage_bytes;
+                HIP_CHECK(
+                    rocprim::build_search_index(
+                        d_temporary_storage, temporary_storage_bytes,
+                        d_haystack, d_index,
+                        haystack_size, index_size,
+                        stream, debug_synchronous
+                    )
+                );
+
+                ASSERT_GT(temporary_storage_bytes, 0);
+
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+                HIP_CHECK(
+                    rocprim::build_search_index(
+                        d_temporary_storage, temporary_storage_bytes,
+                        d_haystack, d_index,
+                        haystack_size, index_size,
+                        stream, debug_synchronous
+                    )
+                );
+
+                HIP_CHECK(hipFree(d_temporary_storage));
+
+                for(bool upper : {false, true})
+                {
+                    SCOPED_TRACE(testing::Message() << "with upper = " << upper);
+
+                    // Calculate expected results on host
+                    std::vector<output_type> expected(needles_size);
+                    for(size_t i = 0; i < needles_size; i++)
+                    {
+                        expected[i] = upper
+                            ? std::upper_bound(haystack.begin(), haystack.end(), needles[i], compare_op) - haystack.begin()
+                            : std::lower_bound(haystack.begin(), haystack.end(), needles[i], compare_op) - haystack.begin();
+                    }
+
+                    const auto indexed_search = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+                    {
+                        return upper
+                            ? rocprim::indexed_upper_bound(
+                                d_temporary_storage, temporary_storage_bytes,
+                                d_haystack, d_index, index_size, d_needles, d_output,
+                                haystack_size, needles_size,
+                                compare_op,
+                                stream, debug_synchronous
+                            )
+                            : rocprim::indexed_lower_bound(
+                                d_temporary_storage, temporary_storage_bytes,
+                                d_haystack, d_index, index_size, d_needles, d_output,
+                                haystack_size, needles_size,
+                                compare_op,
+                                stream, debug_synchronous
+                            );
+                    };
+
+                    HIP_CHECK(indexed_search(nullptr, temporary_storage_bytes));
+
+                    ASSERT_GT(temporary_storage_bytes, 0);
+
+                    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+                    HIP_CHECK(indexed_search(d_temporary_storage, temporary_storage_bytes));
+
+                    std::vector<output_type> output(needles_size);
+                    HIP_CHECK(
+                        hipMemcpy(
+                            output.data(), d_output,
+                            needles_size * sizeof(output_type),
+                            hipMemcpyDeviceToHost
+                        )
+                    );
+
+                    HIP_CHECK(hipFree(d_temporary_storage));
+
+                    ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+                }
+
+                HIP_CHECK(hipFree(d_index));
+            }
+
+            HIP_CHECK(hipFree(d_haystack));
+            HIP_CHECK(hipFree(d_needles));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceBinarySearch, SegmentedSearch)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using haystack_type = typename TestFixture::params::haystack_type;
+    using needle_type = typename TestFixture::params::needle_type;
+    using output_type = typename TestFixture::params::output_type;
+    using compare_op_type = typename TestFixture::params::compare_op_type;
+
+    hipStream_t stream = 0;
+
+    const bool debug_synchronous = false;
+
+    compare_op_type compare_op;
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Short segments are staged in shared memory, long ones are searched in global memory
+            for(unsigned int max_segment_length : {20u, 5000u})
+            {
+                SCOPED_TRACE(testing::Message() << "with max_segment_length = " << max_segment_length);
+
+                std::default_random_engine engine(seed_value);
+                std::uniform_int_distribution<unsigned int> length_distribution(0, max_segment_length);
+
+                const unsigned int segments = 1 + static_cast<unsigned int>(size / max_segment_length);
+                std::vector<unsigned int> offsets(segments + 1, 0);
+                for(unsigned int segment = 0; segment < segments; segment++)
+                {
+                    offsets[segment + 1] = offsets[segment] + length_distribution(engine);
+                }
+                const size_t haystack_size = offsets[segments];
+                const size_t needles_size = size;
+
+                // Generate data
+                std::vector<haystack_type> haystack = test_utils::get_random_data<haystack_type>(
+                    haystack_size, 0, 100, seed_value
+                );
+                for(unsigned int segment = 0; segment < segments; segment++)
+                {
+                    std::sort(haystack.begin() + offsets[segment],
+                              haystack.begin() + offsets[segment + 1],
+                              compare_op);
+                }
+
+                std::vector<needle_type> needles = test_utils::get_random_data<needle_type>(
+                    needles_size, 0, 100, seed_value + 1
+                );
+
+                haystack_type * d_haystack;
+                unsigned int * d_offsets;
+                needle_type * d_needles;
+                unsigned int * d_needle_segments;
+                output_type * d_output;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_haystack, haystack_size * sizeof(haystack_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_offsets, (segments + 1) * sizeof(unsigned int)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_needles, needles_size * sizeof(needle_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_needle_segments, needles_size * sizeof(unsigned int)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, needles_size * sizeof(output_type)));
+                HIP_CHECK(
+                    hipMemcpy(
+                        d_haystack, haystack.data(),
+                        haystack_size * sizeof(haystack_type),
+                        hipMemcpyHostToDevice
+                    )
+                );
+                HIP_CHECK(
+                    hipMemcpy(
+                        d_offsets, offsets.data(),
+                        (segments + 1) * sizeof(unsigned int),
+                        hipMemcpyHostToDevice
+                    )
+                );
+                HIP_CHECK(
+                    hipMemcpy(
+                        d_needles, needles.data(),
+                        needles_size * sizeof(needle_type),
+                        hipMemcpyHostToDevice
+                    )
+                );
+
+                // Needles in random segments and needles sorted by segment
+                for(bool sorted_segments : {false, true})
+                {
+                    SCOPED_TRACE(testing::Message() << "with sorted_segments = " << sorted_segments);
+
+                    std::uniform_int_distribution<unsigned int> segment_distribution(0, segments - 1);
+                    std::vector<unsigned int> needle_segments(needles_size);
+                    for(size_t i = 0; i < needles_size; i++)
+                    {
+                        needle_segments[i] = segment_distribution(engine);
+                    }
+                    if(sorted_segments)
+                    {
+                        std::sort(needle_segments.begin(), needle_segments.end());
+                    }
+                    HIP_CHECK(
+                        hipMemcpy(
+                            d_needle_segments, needle_segments.data(),
+                            needles_size * sizeof(unsigned int),
+                            hipMemcpyHostToDevice
+                        )
+                    );
+
+                    for(bool upper : {false, true})
+                    {
+                        SCOPED_TRACE(testing::Message() << "with upper = " << upper);
+
+                        // Calculate expected results on host
+                        std::vector<output_type> expected(needles_size);
+                        for(size_t i = 0; i < needles_size; i++)
+                        {
+                            const auto first = haystack.begin() + offsets[needle_segments[i]];
+                            const auto last = haystack.begin() + offsets[needle_segments[i] + 1];
+                            expected[i] = upper
+                                ? std::upper_bound(first, last, needles[i], compare_op) - first
+                                : std::lower_bound(first, last, needles[i], compare_op) - first;
+                        }
+
+                        const auto segmented_search = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+                        {
+                            return upper
+                                ? rocprim::segmented_upper_bound(
+                                    d_temporary_storage, temporary_storage_bytes,
+                                    d_haystack, d_offsets, d_needles, d_needle_segments, d_output,
+                                    needles_size,
+                                    compare_op,
+                                    stream, debug_synchronous
+                                )
+                                : rocprim::segmented_lower_bound(
+                                    d_temporary_storage, temporary_storage_bytes,
+                                    d_haystack, d_offsets, d_needles, d_needle_segments, d_output,
+                                    needles_size,
+                                    compare_op,
+                                    stream, debug_synchronous
+                                );
+                        };
+
+                        void * d_temporary_storage = nullptr;
+                        size_t temporary_storage_bytes;
+                        HIP_CHECK(segmented_search(nullptr, temporary_storage_bytes));
+
+                        ASSERT_GT(temporary_storage_bytes, 0);
+
+                        HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+                        HIP_CHECK(segmented_search(d_temporary_storage, temporary_storage_bytes));
+
+                        std::vector<output_type> output(needles_size);
+                        HIP_CHECK(
+                            hipMemcpy(
+                                output.data(), d_output,
+                                needles_size * sizeof(output_type),
+                                hipMemcpyDeviceToHost
+                            )
+                        );
+
+                        HIP_CHECK(hipFree(d_temporary_storage));
+
+                        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+                    }
+                }
+
+                HIP_CHECK(hipFree(d_haystack));
+                HIP_CHECK(hipFree(d_offsets));
+                HIP_CHECK(hipFree(d_needles));
+                HIP_CHECK(hipFree(d_needle_segments));
+                HIP_CHECK(hipFree(d_output));
+            }
+        }
+    }
+}
@@ -0,0 +1,316 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_histogram.hpp>
+#include <rocprim/device/device_reduce.hpp>
+#include <rocprim/device/device_scan.hpp>
+#include <rocprim/device/device_select.hpp>
+#include <rocprim/device/device_transform.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <vector>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+// Grids limited to one block per compute unit, so every block processes many tiles
+namespace
+{
+
+constexpr unsigned int blocks_per_cu = 1;
+constexpr size_t       size          = 1 << 22;
+
+using transform_config = rocprim::transform_config<256,
+                                                   4,
+                                                   ROCPRIM_GRID_SIZE_LIMIT,
+                                                   rocprim::load_default,
+                                                   rocprim::store_default,
+                                                   blocks_per_cu>;
+
+using reduce_config = rocprim::reduce_config<256,
+                                             4,
+                                             rocprim::block_reduce_algorithm::using_warp_reduce,
+                                             ROCPRIM_GRID_SIZE_LIMIT,
+                                             false,
+                                             rocprim::segmented_reduce_algorithm::automatic,
+                                             blocks_per_cu>;
+
+using scan_config = rocprim::scan_config<256,
+                                         4,
+                                         true,
+                                         rocprim::block_load_method::block_load_transpose,
+                                         rocprim::block_store_method::block_store_transpose,
+                                         rocprim::block_scan_algorithm::using_warp_scan,
+                                         ROCPRIM_GRID_SIZE_LIMIT,
+                                         blocks_per_cu>;
+
+using select_config = rocprim::select_config<256,
+                                             4,
+                                             rocprim::block_load_method::block_load_transpose,
+                                             rocprim::block_load_method::block_load_transpose,
+                                             rocprim::block_load_method::block_load_transpose,
+                                             rocprim::block_scan_algorithm::using_warp_scan,
+                                             ROCPRIM_GRID_SIZE_LIMIT,
+                                             rocprim::load_default,
+                                             rocprim::store_default,
+                                             blocks_per_cu>;
+
+struct is_even
+{
+    ROCPRIM_HOST_DEVICE
+    bool operator()(const int value) const
+    {
+        return value % 2 == 0;
+    }
+};
+
+struct plus_one
+{
+    ROCPRIM_HOST_DEVICE
+    int operator()(const int value) const
+    {
+        return value + 1;
+    }
+};
+
+int* copy_to_device(const std::vector<int>& input)
+{
+    int* d_input;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input.size() * sizeof(int)));
+    HIP_CHECK(
+        hipMemcpy(d_input, input.data(), input.size() * sizeof(int), hipMemcpyHostToDevice));
+    return d_input;
+}
+
+template<class T>
+std::vector<T> copy_to_host(const T* d_output, const size_t count)
+{
+    std::vector<T> output(count);
+    HIP_CHECK(hipMemcpy(output.data(), d_output, count * sizeof(T), hipMemcpyDeviceToHost));
+    return output;
+}
+
+// Counts 256 bins of samples 0..255 with the config and compares them with the host histogram
+template<class Config>
+void test_histogram()
+{
+    const std::vector<int> input = test_utils::get_random_data<int>(size, 0, 255, size);
+    int* const             d_input = copy_to_device(input);
+    unsigned int*          d_histogram;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_histogram, 256 * sizeof(unsigned int)));
+
+    size_t storage_bytes;
+    HIP_CHECK(rocprim::histogram_even<Config>(nullptr,
+                                              storage_bytes,
+                                              d_input,
+                                              static_cast<unsigned int>(size),
+                                              d_histogram,
+                                              257,
+                                              0,
+                                              256));
+    void* d_temp_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, storage_bytes));
+    HIP_CHECK(rocprim::histogram_even<Config>(d_temp_storage,
+                                              storage_bytes,
+                                              d_input,
+                                              static_cast<unsigned int>(size),
+                                              d_histogram,
+                                              257,
+                                              0,
+                                              256));
+
+    std::vector<unsigned int> expected(256, 0);
+    for(const int value : input)
+    {
+        expected[value]++;
+    }
+    ASSERT_EQ(copy_to_host(d_histogram, 256), expected);
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_histogram));
+    HIP_CHECK(hipFree(d_temp_storage));
+}
+
+} // namespace
+
+TEST(RocprimDeviceBlocksPerCuTests, Transform)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    const std::vector<int> input = test_utils::get_random_data<int>(size, -1000, 1000, size);
+    int* const             d_input = copy_to_device(input);
+    int*                   d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(int)));
+
+    HIP_CHECK(rocprim::transform<transform_config>(d_input, d_output, size, plus_one()));
+
+    std::vector<int> expected(size);
+    std::transform(input.begin(), input.end(), expected.begin(), plus_one());
+    ASSERT_EQ(copy_to_host(d_output, size), expected);
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
+
+TEST(RocprimDeviceBlocksPerCuTests, Reduce)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    const std::vector<int> input = test_utils::get_random_data<int>(size, 0, 10, size);
+    int* const             d_input = copy_to_device(input);
+    int*                   d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(int)));
+
+    size_t storage_bytes;
+    HIP_CHECK(rocprim::reduce<reduce_config>(nullptr,
+                                             storage_bytes,
+                                             d_input,
+                                             d_output,
+                                             size,
+                                             rocprim::plus<int>()));
+    void* d_temp_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, storage_bytes));
+    HIP_CHECK(rocprim::reduce<reduce_config>(d_temp_storage,
+                                             storage_bytes,
+                                             d_input,
+                                             d_output,
+                                             size,
+                                             rocprim::plus<int>()));
+
+    ASSERT_EQ(copy_to_host(d_output, 1)[0], std::accumulate(input.begin(), input.end(), 0));
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipFree(d_temp_storage));
+}
+
+TEST(RocprimDeviceBlocksPerCuTests, InclusiveScan)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    const std::vector<int> input = test_utils::get_random_data<int>(size, 0, 10, size);
+    int* const             d_input = copy_to_device(input);
+    int*                   d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(int)));
+
+    size_t storage_bytes;
+    HIP_CHECK(rocprim::inclusive_scan<scan_config>(nullptr,
+                                                   storage_bytes,
+                                                   d_input,
+                                                   d_output,
+                                                   size,
+                                                   rocprim::plus<int>()));
+    void* d_temp_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, storage_bytes));
+    HIP_CHECK(rocprim::inclusive_scan<scan_config>(d_temp_storage,
+                                                   storage_bytes,
+                                                   d_input,
+                                                   d_output,
+                                                   size,
+                                                   rocprim::plus<int>()));
+
+    std::vector<int> expected(size);
+    std::partial_sum(input.begin(), input.end(), expected.begin());
+    ASSERT_EQ(copy_to_host(d_output, size), expected);
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipFree(d_temp_storage));
+}
+
+TEST(RocprimDeviceBlocksPerCuTests, Select)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    const std::vector<int> input = test_utils::get_random_data<int>(size, -1000, 1000, size);
+    int* const             d_input = copy_to_device(input);
+    int*                   d_output;
+    unsigned int*          d_selected_count;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(int)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_selected_count, sizeof(unsigned int)));
+
+    size_t storage_bytes;
+    HIP_CHECK(rocprim::select<select_config>(nullptr,
+                                             storage_bytes,
+                                             d_input,
+                                             d_output,
+                                             d_selected_count,
+                                             size,
+                                             is_even()));
+    void* d_temp_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, storage_bytes));
+    HIP_CHECK(rocprim::select<select_config>(d_temp_storage,
+                                             storage_bytes,
+                                             d_input,
+                                             d_output,
+                                             d_selected_count,
+                                             size,
+                                             is_even()));
+
+    std::vector<int> expected;
+    std::copy_if(input.begin(), input.end(), std::back_inserter(expected), is_even());
+    ASSERT_EQ(copy_to_host(d_selected_count, 1)[0], expected.size());
+    ASSERT_EQ(copy_to_host(d_output, expected.size()), expected);
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipFree(d_selected_count));
+    HIP_CHECK(hipFree(d_temp_storage));
+}
+
+TEST(RocprimDeviceBlocksPerCuTests, Histogram)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    // Shared memory bins
+    test_histogram<rocprim::histogram_config<rocprim::kernel_config<256, 4>,
+                                             1024,
+                                             2048,
+                                             3,
+                                             false,
+                                             rocprim::histogram_algorithm::using_atomic,
+                                             blocks_per_cu>>();
+    // Global memory bins, 256 windows of one bin are too many for the shared memory
+    test_histogram<rocprim::histogram_config<rocprim::kernel_config<256, 4>,
+                                             1024,
+                                             1,
+                                             1,
+                                             false,
+                                             rocprim::histogram_algorithm::using_atomic,
+                                             blocks_per_cu>>();
+}
@@ -0,0 +1,314 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+// required rocprim headers
+#include <rocprim/device/device_bucket_partition.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+template<unsigned int NumBuckets, class Config = rocprim::default_config>
+struct params
+{
+    static constexpr unsigned int num_buckets = NumBuckets;
+    using config                              = Config;
+};
+
+template<class Params>
+class RocprimDeviceBucketPartition : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<params<1>,
+                         params<7>,
+                         params<256>,
+                         params<4096>,
+                         params<300, rocprim::bucket_partition_config<64, 4, 64, 1>>,
+                         params<16, rocprim::bucket_partition_config<128, 3, 16, 4>>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimDeviceBucketPartition, Params);
+
+// The bucket of a key is its remainder, the keys are larger than the number of buckets
+struct modulo_bucket_op
+{
+    unsigned int num_buckets;
+
+    ROCPRIM_HOST_DEVICE
+    unsigned int operator()(const int key) const
+    {
+        return static_cast<unsigned int>(key) % num_buckets;
+    }
+};
+
+TYPED_TEST(RocprimDeviceBucketPartition, Keys)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using config = typename TestFixture::params::config;
+
+    const unsigned int num_buckets       = TestFixture::params::num_buckets;
+    const bool         debug_synchronous = false;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<unsigned int> input
+                = test_utils::get_random_data<unsigned int>(size, 0, num_buckets - 1, seed_value);
+
+            std::vector<unsigned int> expected(input);
+            std::sort(expected.begin(), expected.end());
+            std::vector<size_t> expected_offsets(num_buckets + 1);
+            for(unsigned int bucket = 0; bucket <= num_buckets; bucket++)
+            {
+                expected_offsets[bucket]
+                    = std::lower_bound(expected.begin(), expected.end(), bucket)
+                      - expected.begin();
+            }
+
+            unsigned int* d_input;
+            unsigned int* d_output;
+            size_t*       d_bucket_offsets;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_input, (size + 1) * sizeof(unsigned int)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_output, (size + 1) * sizeof(unsigned int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_bucket_offsets,
+                                                         (num_buckets + 1) * sizeof(size_t)));
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                size * sizeof(unsigned int),
+                                hipMemcpyHostToDevice));
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(rocprim::bucket_partition_keys<config>(nullptr,
+                                                             temp_storage_size_bytes,
+                                                             d_input,
+                                                             d_output,
+                                                             d_bucket_offsets,
+                                                             size,
+                                                             num_buckets));
+
+            // temp_storage_size_bytes must be >0
+            ASSERT_GT(temp_storage_size_bytes, 0);
+
+            void* d_temp_storage = nullptr;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            HIP_CHECK(rocprim::bucket_partition_keys<config>(d_temp_storage,
+                                                             temp_storage_size_bytes,
+                                                             d_input,
+                                                             d_output,
+                                                             d_bucket_offsets,
+                                                             size,
+                                                             num_buckets,
+                                                             rocprim::identity<unsigned int>(),
+                                                             stream,
+                                                             debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<unsigned int> output(size);
+            std::vector<size_t>       bucket_offsets(num_buckets + 1);
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                size * sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(bucket_offsets.data(),
+                                d_bucket_offsets,
+                                (num_buckets + 1) * sizeof(size_t),
+                                hipMemcpyDeviceToHost));
+
+            ASSERT_EQ(output, expected);
+            ASSERT_EQ(bucket_offsets, expected_offsets);
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_bucket_offsets));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceBucketPartition, PairsStable)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using config = typename TestFixture::params::config;
+
+    const unsigned int num_buckets       = TestFixture::params::num_buckets;
+    const bool         debug_synchronous = false;
+
+    const modulo_bucket_op bucket_op{num_buckets};
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<int> keys
+                = test_utils::get_random_data<int>(size, 0, 1 << 20, seed_value);
+            // The values are the positions, so the order within the buckets is checked
+            std::vector<unsigned int> values(size);
+            std::iota(values.begin(), values.end(), 0u);
+
+            std::vector<unsigned int> expected_values(values);
+            std::stable_sort(expected_values.begin(),
+                             expected_values.end(),
+                             [&](const unsigned int a, const unsigned int b)
+                             { return bucket_op(keys[a]) < bucket_op(keys[b]); });
+            std::vector<int> expected_keys(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                expected_keys[i] = keys[expected_values[i]];
+            }
+            std::vector<size_t> expected_offsets(num_buckets + 1, 0);
+            for(size_t i = 0; i < size; i++)
+            {
+                expected_offsets[bucket_op(keys[i]) + 1]++;
+            }
+            std::partial_sum(expected_offsets.begin(),
+                             expected_offsets.end(),
+                             expected_offsets.begin());
+
+            int*          d_keys_input;
+            int*          d_keys_output;
+            unsigned int* d_values_input;
+            unsigned int* d_values_output;
+            size_t*       d_bucket_offsets;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, (size + 1) * sizeof(int)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_keys_output, (size + 1) * sizeof(int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input,
+                                                         (size + 1) * sizeof(unsigned int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output,
+                                                         (size + 1) * sizeof(unsigned int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_bucket_offsets,
+                                                         (num_buckets + 1) * sizeof(size_t)));
+            HIP_CHECK(
+                hipMemcpy(d_keys_input, keys.data(), size * sizeof(int), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values_input,
+                                values.data(),
+                                size * sizeof(unsigned int),
+                                hipMemcpyHostToDevice));
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(rocprim::bucket_partition_pairs<config>(nullptr,
+                                                              temp_storage_size_bytes,
+                                                              d_keys_input,
+                                                              d_keys_output,
+                                                              d_values_input,
+                                                              d_values_output,
+                                                              d_bucket_offsets,
+                                                              size,
+                                                              num_buckets,
+                                                              bucket_op));
+
+            void* d_temp_storage = nullptr;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            HIP_CHECK(rocprim::bucket_partition_pairs<config>(d_temp_storage,
+                                                              temp_storage_size_bytes,
+                                                              d_keys_input,
+                                                              d_keys_output,
+                                                              d_values_input,
+                                                              d_values_output,
+                                                              d_bucket_offsets,
+                                                              size,
+                                                              num_buckets,
+                                                              bucket_op,
+                                                              stream,
+                                                              debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<int>          keys_output(size);
+            std::vector<unsigned int> values_output(size);
+            std::vector<size_t>       bucket_offsets(num_buckets + 1);
+            HIP_CHECK(hipMemcpy(keys_output.data(),
+                                d_keys_output,
+                                size * sizeof(int),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(values_output.data(),
+                                d_values_output,
+                                size * sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(bucket_offsets.data(),
+                                d_bucket_offsets,
+                                (num_buckets + 1) * sizeof(size_t),
+                                hipMemcpyDeviceToHost));
+
+            ASSERT_EQ(keys_output, expected_keys);
+            ASSERT_EQ(values_output, expected_values);
+            ASSERT_EQ(bucket_offsets, expected_offsets);
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_values_output));
+            HIP_CHECK(hipFree(d_bucket_offsets));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
+
+TEST(RocprimDeviceBucketPartitionTests, ZeroBuckets)
+{
+    size_t temp_storage_size_bytes;
+    ASSERT_EQ(rocprim::bucket_partition_keys(nullptr,
+                                             temp_storage_size_bytes,
+                                             static_cast<unsigned int*>(nullptr),
+                                             static_cast<unsigned int*>(nullptr),
+                                             static_cast<size_t*>(nullptr),
+                                             size_t(0),
+                                             0u),
+              hipErrorInvalidValue);
+}
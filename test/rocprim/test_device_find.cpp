@@ -0,0 +1,232 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_find.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+template<class Value, class Config = rocprim::default_config>
+struct params
+{
+    using value_type = Value;
+    using config     = Config;
+};
+
+template<class Params>
+class RocprimDeviceFind : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+using small_block_config
+    = rocprim::reduce_config<64, 2, rocprim::block_reduce_algorithm::raking_reduce>;
+
+// The tiles are searched by several launches of 8 tiles
+using size_limit_config
+    = rocprim::reduce_config<256, 4, rocprim::block_reduce_algorithm::default_algorithm, 8192>;
+
+typedef ::testing::Types<params<int>,
+                         params<unsigned char>,
+                         params<float>,
+                         params<double>,
+                         params<long long, small_block_config>,
+                         params<int, size_limit_config>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimDeviceFind, Params);
+
+// The random values are smaller than the values that are looked for
+template<class T>
+struct is_large_op
+{
+    ROCPRIM_HOST_DEVICE
+    bool operator()(const T& value) const
+    {
+        return value >= T(100);
+    }
+};
+
+template<class T>
+struct is_small_op
+{
+    ROCPRIM_HOST_DEVICE
+    bool operator()(const T& value) const
+    {
+        return value < T(100);
+    }
+};
+
+template<class Config, class T>
+void test_find(const std::vector<T>& input, const std::vector<T>& other, const hipStream_t stream)
+{
+    const bool debug_synchronous = false;
+
+    const size_t size = input.size();
+
+    T*      d_input;
+    T*      d_other;
+    size_t* d_indices;
+    bool*   d_flags;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, (size + 1) * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_other, (size + 1) * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_indices, 2 * sizeof(size_t)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_flags, 3 * sizeof(bool)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemcpy(d_other, other.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+    size_t temporary_storage_bytes;
+    HIP_CHECK(rocprim::find_if<Config>(nullptr,
+                                       temporary_storage_bytes,
+                                       d_input,
+                                       d_indices,
+                                       size,
+                                       is_large_op<T>(),
+                                       stream,
+                                       debug_synchronous));
+    ASSERT_GT(temporary_storage_bytes, 0);
+    void* d_temporary_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+    // All functions need the same temporary storage
+    HIP_CHECK(rocprim::find_if<Config>(d_temporary_storage,
+                                       temporary_storage_bytes,
+                                       d_input,
+                                       d_indices,
+                                       size,
+                                       is_large_op<T>(),
+                                       stream,
+                                       debug_synchronous));
+    HIP_CHECK(rocprim::mismatch<Config>(d_temporary_storage,
+                                        temporary_storage_bytes,
+                                        d_input,
+                                        d_other,
+                                        d_indices + 1,
+                                        size,
+                                        rocprim::equal_to<T>(),
+                                        stream,
+                                        debug_synchronous));
+    HIP_CHECK(rocprim::any_of<Config>(d_temporary_storage,
+                                      temporary_storage_bytes,
+                                      d_input,
+                                      d_flags,
+                                      size,
+                                      is_large_op<T>(),
+                                      stream,
+                                      debug_synchronous));
+    HIP_CHECK(rocprim::all_of<Config>(d_temporary_storage,
+                                      temporary_storage_bytes,
+                                      d_input,
+                                      d_flags + 1,
+                                      size,
+                                      is_small_op<T>(),
+                                      stream,
+                                      debug_synchronous));
+    HIP_CHECK(rocprim::none_of<Config>(d_temporary_storage,
+                                       temporary_storage_bytes,
+                                       d_input,
+                                       d_flags + 2,
+                                       size,
+                                       is_large_op<T>(),
+                                       stream,
+                                       debug_synchronous));
+    HIP_CHECK(hipGetLastError());
+    HIP_CHECK(hipDeviceSynchronize());
+
+    size_t indices[2];
+    bool   flags[3];
+    HIP_CHECK(hipMemcpy(indices, d_indices, 2 * sizeof(size_t), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(flags, d_flags, 3 * sizeof(bool), hipMemcpyDeviceToHost));
+
+    const size_t expected_found
+        = std::find_if(input.begin(), input.end(), is_large_op<T>()) - input.begin();
+    const size_t expected_mismatch
+        = std::mismatch(input.begin(), input.end(), other.begin()).first - input.begin();
+    ASSERT_EQ(indices[0], expected_found);
+    ASSERT_EQ(indices[1], expected_mismatch);
+    ASSERT_EQ(flags[0], expected_found != size);
+    ASSERT_EQ(flags[1], expected_found == size);
+    ASSERT_EQ(flags[2], expected_found == size);
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_other));
+    HIP_CHECK(hipFree(d_indices));
+    HIP_CHECK(hipFree(d_flags));
+}
+
+TYPED_TEST(RocprimDeviceFind, Find)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T      = typename TestFixture::params::value_type;
+    using config = typename TestFixture::params::config;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        std::default_random_engine gen(seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<T> input = test_utils::get_random_data<T>(size, T(0), T(99), seed_value);
+            std::vector<T> other = input;
+
+            // Nothing is found
+            test_find<config>(input, other, stream);
+
+            if(size == 0)
+            {
+                continue;
+            }
+
+            // Large items and differences placed at random positions, the first one is the result
+            std::uniform_int_distribution<size_t> position_dis(0, size - 1);
+            for(unsigned int i = 0; i < 3; i++)
+            {
+                const size_t position = position_dis(gen);
+                input[position]       = T(100);
+                other[position_dis(gen)] += T(1);
+                SCOPED_TRACE(testing::Message() << "with position = " << position);
+                test_find<config>(input, other, stream);
+            }
+        }
+    }
+}
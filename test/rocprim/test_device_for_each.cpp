@@ -0,0 +1,215 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+#include <vector>
+
+// required rocprim headers
+#include <rocprim/device/device_for_each.hpp>
+#include <rocprim/iterator/counting_iterator.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+template<class Value, class Config = rocprim::default_config>
+struct params
+{
+    using value_type = Value;
+    using config     = Config;
+};
+
+template<class Params>
+class RocprimDeviceForEach : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<params<int>,
+                         params<unsigned char>,
+                         params<short>,
+                         params<double>,
+                         params<int, rocprim::transform_config<64, 2>>,
+                         params<unsigned int,
+                                rocprim::transform_config<128,
+                                                          4,
+                                                          ROCPRIM_GRID_SIZE_LIMIT,
+                                                          rocprim::load_default,
+                                                          rocprim::store_default,
+                                                          1>>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimDeviceForEach, Params);
+
+// Counts the values in bins of a histogram, bins[value % bin_count] is incremented
+struct count_op
+{
+    unsigned int* bins;
+    unsigned int  bin_count;
+
+    template<class T>
+    ROCPRIM_DEVICE
+    void operator()(const T value) const
+    {
+        atomicAdd(bins + static_cast<unsigned int>(value) % bin_count, 1u);
+    }
+};
+
+// Writes twice the index to output and the index to indices, transform has one output only
+template<class T>
+struct scatter_op
+{
+    T*            output;
+    unsigned int* indices;
+
+    ROCPRIM_DEVICE
+    void operator()(const size_t index) const
+    {
+        output[index]  = T(2 * index);
+        indices[index] = static_cast<unsigned int>(index);
+    }
+};
+
+TYPED_TEST(RocprimDeviceForEach, Histogram)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T      = typename TestFixture::params::value_type;
+    using config = typename TestFixture::params::config;
+
+    const bool debug_synchronous = false;
+
+    const unsigned int bin_count = 37;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Misaligned inputs start with the unaligned head
+            for(size_t offset : {0, 1})
+            {
+                SCOPED_TRACE(testing::Message() << "with offset = " << offset);
+
+                const std::vector<T> input
+                    = test_utils::get_random_data<T>(size + offset, 0, 100, seed_value);
+
+                std::vector<unsigned int> expected(bin_count, 0);
+                for(size_t i = 0; i < size; i++)
+                {
+                    expected[static_cast<unsigned int>(input[offset + i]) % bin_count]++;
+                }
+
+                T*            d_input;
+                unsigned int* d_bins;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                             (size + offset) * sizeof(T)));
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_bins, bin_count * sizeof(unsigned int)));
+                HIP_CHECK(hipMemcpy(d_input,
+                                    input.data(),
+                                    (size + offset) * sizeof(T),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemset(d_bins, 0, bin_count * sizeof(unsigned int)));
+
+                HIP_CHECK(rocprim::for_each_n<config>(d_input + offset,
+                                                      size,
+                                                      count_op{d_bins, bin_count},
+                                                      stream,
+                                                      debug_synchronous));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+
+                std::vector<unsigned int> bins(bin_count);
+                HIP_CHECK(hipMemcpy(bins.data(),
+                                    d_bins,
+                                    bin_count * sizeof(unsigned int),
+                                    hipMemcpyDeviceToHost));
+                ASSERT_EQ(bins, expected);
+
+                HIP_CHECK(hipFree(d_input));
+                HIP_CHECK(hipFree(d_bins));
+            }
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceForEach, CountingIterator)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T      = typename TestFixture::params::value_type;
+    using config = typename TestFixture::params::config;
+
+    const bool debug_synchronous = false;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t size : test_utils::get_sizes(seeds[0]))
+    {
+        SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+        T*            d_output;
+        unsigned int* d_indices;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, (size + 1) * sizeof(T)));
+        HIP_CHECK(
+            test_common_utils::hipMallocHelper(&d_indices, (size + 1) * sizeof(unsigned int)));
+
+        const auto first = rocprim::make_counting_iterator<size_t>(0);
+        HIP_CHECK(rocprim::for_each<config>(first,
+                                            first + size,
+                                            scatter_op<T>{d_output, d_indices},
+                                            stream,
+                                            debug_synchronous));
+        HIP_CHECK(hipGetLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<T>            output(size);
+        std::vector<unsigned int> indices(size);
+        HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(indices.data(),
+                            d_indices,
+                            size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+        for(size_t i = 0; i < size; i++)
+        {
+            ASSERT_EQ(output[i], T(2 * i)) << "where index = " << i;
+            ASSERT_EQ(indices[i], i) << "where index = " << i;
+        }
+
+        HIP_CHECK(hipFree(d_output));
+        HIP_CHECK(hipFree(d_indices));
+    }
+}
@@ -0,0 +1,355 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_histogram.hpp>
+#include <rocprim/device/device_radix_sort.hpp>
+#include <rocprim/device/device_reduce.hpp>
+#include <rocprim/device/device_reduce_by_key.hpp>
+#include <rocprim/device/device_scan.hpp>
+#include <rocprim/device/device_select.hpp>
+#include <rocprim/device/grid_limit.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <vector>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+// The algorithms with the default configs and a grid of a few blocks, so every kernel
+// processes many tiles (or digits, prefixes and bins) per block
+namespace
+{
+
+constexpr unsigned int max_blocks = 3;
+constexpr size_t       size       = 1 << 20;
+
+struct is_even
+{
+    ROCPRIM_HOST_DEVICE
+    bool operator()(const int value) const
+    {
+        return value % 2 == 0;
+    }
+};
+
+template<class T>
+T* copy_to_device(const std::vector<T>& input)
+{
+    T* d_input;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input.size() * sizeof(T)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), input.size() * sizeof(T), hipMemcpyHostToDevice));
+    return d_input;
+}
+
+template<class T>
+std::vector<T> copy_to_host(const T* d_output, const size_t count)
+{
+    std::vector<T> output(count);
+    HIP_CHECK(hipMemcpy(output.data(), d_output, count * sizeof(T), hipMemcpyDeviceToHost));
+    return output;
+}
+
+// Algorithm must be callable as hipError_t(void* temporary_storage, size_t& storage_size)
+template<class Algorithm>
+void run_with_temporary_storage(Algorithm algorithm)
+{
+    size_t storage_bytes;
+    HIP_CHECK(algorithm(nullptr, storage_bytes));
+    void* d_temp_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, storage_bytes));
+    HIP_CHECK(algorithm(d_temp_storage, storage_bytes));
+    HIP_CHECK(hipFree(d_temp_storage));
+}
+
+} // namespace
+
+TEST(RocprimDeviceGridLimitTests, ScopedLimit)
+{
+    ASSERT_EQ(rocprim::current_grid_limit(), 0u);
+    {
+        rocprim::scoped_grid_limit outer(16);
+        ASSERT_EQ(rocprim::current_grid_limit(), 16u);
+        {
+            rocprim::scoped_grid_limit inner(max_blocks);
+            ASSERT_EQ(rocprim::current_grid_limit(), max_blocks);
+        }
+        ASSERT_EQ(rocprim::current_grid_limit(), 16u);
+    }
+    ASSERT_EQ(rocprim::current_grid_limit(), 0u);
+}
+
+TEST(RocprimDeviceGridLimitTests, CuFraction)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    hipDeviceProp_t props;
+    HIP_CHECK(hipGetDeviceProperties(&props, device_id));
+
+    unsigned int limit = 0;
+    HIP_CHECK(rocprim::grid_limit_for_cu_fraction(1.0f, 2, limit));
+    ASSERT_EQ(limit, static_cast<unsigned int>(props.multiProcessorCount) * 2);
+    HIP_CHECK(rocprim::grid_limit_for_cu_fraction(1e-6f, 2, limit));
+    ASSERT_EQ(limit, 2u);
+
+    ASSERT_EQ(rocprim::grid_limit_for_cu_fraction(0.0f, 2, limit), hipErrorInvalidValue);
+    ASSERT_EQ(rocprim::grid_limit_for_cu_fraction(1.5f, 2, limit), hipErrorInvalidValue);
+    ASSERT_EQ(rocprim::grid_limit_for_cu_fraction(0.5f, 0, limit), hipErrorInvalidValue);
+}
+
+TEST(RocprimDeviceGridLimitTests, Reduce)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    const std::vector<int> input = test_utils::get_random_data<int>(size, 0, 10, size);
+    int* const             d_input = copy_to_device(input);
+    int*                   d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(int)));
+
+    rocprim::scoped_grid_limit limit(max_blocks);
+    run_with_temporary_storage(
+        [&](void* temporary_storage, size_t& storage_bytes)
+        {
+            return rocprim::reduce(temporary_storage,
+                                   storage_bytes,
+                                   d_input,
+                                   d_output,
+                                   size,
+                                   rocprim::plus<int>());
+        });
+
+    ASSERT_EQ(copy_to_host(d_output, 1)[0], std::accumulate(input.begin(), input.end(), 0));
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
+
+TEST(RocprimDeviceGridLimitTests, InclusiveScan)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    const std::vector<int> input = test_utils::get_random_data<int>(size, 0, 10, size);
+    int* const             d_input = copy_to_device(input);
+    int*                   d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(int)));
+
+    rocprim::scoped_grid_limit limit(max_blocks);
+    run_with_temporary_storage(
+        [&](void* temporary_storage, size_t& storage_bytes)
+        {
+            return rocprim::inclusive_scan(temporary_storage,
+                                           storage_bytes,
+                                           d_input,
+                                           d_output,
+                                           size,
+                                           rocprim::plus<int>());
+        });
+
+    std::vector<int> expected(size);
+    std::partial_sum(input.begin(), input.end(), expected.begin());
+    ASSERT_EQ(copy_to_host(d_output, size), expected);
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
+
+TEST(RocprimDeviceGridLimitTests, Select)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    const std::vector<int> input = test_utils::get_random_data<int>(size, -1000, 1000, size);
+    int* const             d_input = copy_to_device(input);
+    int*                   d_output;
+    unsigned int*          d_selected_count;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(int)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_selected_count, sizeof(unsigned int)));
+
+    rocprim::scoped_grid_limit limit(max_blocks);
+    run_with_temporary_storage(
+        [&](void* temporary_storage, size_t& storage_bytes)
+        {
+            return rocprim::select(temporary_storage,
+                                   storage_bytes,
+                                   d_input,
+                                   d_output,
+                                   d_selected_count,
+                                   size,
+                                   is_even());
+        });
+
+    std::vector<int> expected;
+    std::copy_if(input.begin(), input.end(), std::back_inserter(expected), is_even());
+    ASSERT_EQ(copy_to_host(d_selected_count, 1)[0], expected.size());
+    ASSERT_EQ(copy_to_host(d_output, expected.size()), expected);
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipFree(d_selected_count));
+}
+
+TEST(RocprimDeviceGridLimitTests, ReduceByKey)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    // Runs of 1 to 100 equal keys
+    std::vector<int> keys(size);
+    {
+        const std::vector<int> run_lengths = test_utils::get_random_data<int>(size, 1, 100, size);
+        int                    key         = 0;
+        for(size_t i = 0, run = 0; i < size; run++)
+        {
+            const size_t end = std::min(size, i + run_lengths[run]);
+            std::fill(keys.begin() + i, keys.begin() + end, key++);
+            i = end;
+        }
+    }
+    const std::vector<int> values   = test_utils::get_random_data<int>(size, 0, 10, size);
+    int* const             d_keys   = copy_to_device(keys);
+    int* const             d_values = copy_to_device(values);
+    int*                   d_unique;
+    int*                   d_aggregates;
+    unsigned int*          d_unique_count;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_unique, size * sizeof(int)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_aggregates, size * sizeof(int)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_unique_count, sizeof(unsigned int)));
+
+    rocprim::scoped_grid_limit limit(max_blocks);
+    run_with_temporary_storage(
+        [&](void* temporary_storage, size_t& storage_bytes)
+        {
+            return rocprim::reduce_by_key(temporary_storage,
+                                          storage_bytes,
+                                          d_keys,
+                                          d_values,
+                                          size,
+                                          d_unique,
+                                          d_aggregates,
+                                          d_unique_count,
+                                          rocprim::plus<int>());
+        });
+
+    std::vector<int> expected_unique;
+    std::vector<int> expected_aggregates;
+    for(size_t i = 0; i < size; i++)
+    {
+        if(i == 0 || keys[i] != keys[i - 1])
+        {
+            expected_unique.push_back(keys[i]);
+            expected_aggregates.push_back(0);
+        }
+        expected_aggregates.back() += values[i];
+    }
+    ASSERT_EQ(copy_to_host(d_unique_count, 1)[0], expected_unique.size());
+    ASSERT_EQ(copy_to_host(d_unique, expected_unique.size()), expected_unique);
+    ASSERT_EQ(copy_to_host(d_aggregates, expected_unique.size()), expected_aggregates);
+
+    HIP_CHECK(hipFree(d_keys));
+    HIP_CHECK(hipFree(d_values));
+    HIP_CHECK(hipFree(d_unique));
+    HIP_CHECK(hipFree(d_aggregates));
+    HIP_CHECK(hipFree(d_unique_count));
+}
+
+TEST(RocprimDeviceGridLimitTests, RadixSort)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    const std::vector<unsigned int> input
+        = test_utils::get_random_data<unsigned int>(size, 0, 0xFFFFFFFFu, size);
+    unsigned int* const d_input = copy_to_device(input);
+    unsigned int*       d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(unsigned int)));
+
+    rocprim::scoped_grid_limit limit(max_blocks);
+    run_with_temporary_storage(
+        [&](void* temporary_storage, size_t& storage_bytes)
+        {
+            return rocprim::radix_sort_keys(temporary_storage,
+                                            storage_bytes,
+                                            d_input,
+                                            d_output,
+                                            size);
+        });
+
+    std::vector<unsigned int> expected(input);
+    std::sort(expected.begin(), expected.end());
+    ASSERT_EQ(copy_to_host(d_output, size), expected);
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
+
+TEST(RocprimDeviceGridLimitTests, Histogram)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    // More bins than threads of the limited grid of the initialization kernel
+    constexpr unsigned int bins = 4096;
+
+    const std::vector<int> input = test_utils::get_random_data<int>(size, 0, bins - 1, size);
+    int* const             d_input = copy_to_device(input);
+    unsigned int*          d_histogram;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_histogram, bins * sizeof(unsigned int)));
+
+    rocprim::scoped_grid_limit limit(max_blocks);
+    run_with_temporary_storage(
+        [&](void* temporary_storage, size_t& storage_bytes)
+        {
+            return rocprim::histogram_even(temporary_storage,
+                                           storage_bytes,
+                                           d_input,
+                                           static_cast<unsigned int>(size),
+                                           d_histogram,
+                                           bins + 1,
+                                           0,
+                                           static_cast<int>(bins));
+        });
+
+    std::vector<unsigned int> expected(bins, 0);
+    for(const int value : input)
+    {
+        expected[value]++;
+    }
+    ASSERT_EQ(copy_to_host(d_histogram, bins), expected);
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_histogram));
+}
@@ -0,0 +1,258 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_hash_reduce_by_key.hpp>
+
+// required test headers
+#include "test_utils_custom_test_types.hpp"
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+template<class Key,
+         class Value,
+         class ReduceOp,
+         unsigned int UniqueKeys,
+         // The table is sized for fewer keys than there are, so the sort-based path is used
+         bool Overflow = false,
+         class Config  = rocprim::default_config>
+struct params
+{
+    using key_type                            = Key;
+    using value_type                          = Value;
+    using reduce_op_type                      = ReduceOp;
+    static constexpr unsigned int unique_keys = UniqueKeys;
+    static constexpr bool         overflow    = Overflow;
+    using config                              = Config;
+};
+
+template<class Params>
+class RocprimDeviceHashReduceByKey : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+using custom_double2 = test_utils::custom_test_type<double>;
+
+typedef ::testing::Types<
+    params<int, int, rocprim::plus<int>, 1>,
+    params<int, int, rocprim::plus<int>, 10>,
+    params<unsigned int, float, rocprim::plus<float>, 1000>,
+    params<unsigned long long, double, rocprim::plus<double>, 100000>,
+    params<int, unsigned long long, rocprim::maximum<unsigned long long>, 5000>,
+    params<short,
+           int,
+           rocprim::minimum<int>,
+           300,
+           false,
+           rocprim::hash_reduce_by_key_config<64, 2>>,
+    params<int, int, rocprim::plus<int>, 10000, true>,
+    // 16-byte accumulators always use the sort-based path
+    params<int, custom_double2, rocprim::plus<custom_double2>, 100>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimDeviceHashReduceByKey, Params);
+
+TYPED_TEST(RocprimDeviceHashReduceByKey, HashReduceByKey)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type                     = typename TestFixture::params::key_type;
+    using value_type                   = typename TestFixture::params::value_type;
+    using reduce_op_type               = typename TestFixture::params::reduce_op_type;
+    using config                       = typename TestFixture::params::config;
+    constexpr unsigned int unique_keys = TestFixture::params::unique_keys;
+    constexpr bool         overflow    = TestFixture::params::overflow;
+    const bool             debug_synchronous = false;
+
+    hipStream_t    stream = 0; // default
+    reduce_op_type reduce_op;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Unsorted keys of at most unique_keys values spread over the key range, and small
+            // integral values so sums are exact in any order
+            const std::vector<int> key_ids
+                = test_utils::get_random_data<int>(size, 0, unique_keys - 1, seed_value);
+            std::vector<key_type> keys_input(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                keys_input[i] = static_cast<key_type>(key_ids[i] * 7 - 1000);
+            }
+            const std::vector<int> values_ints
+                = test_utils::get_random_data<int>(size, 0, 10, seed_value + 1);
+            std::vector<value_type> values_input(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                values_input[i] = static_cast<value_type>(values_ints[i]);
+            }
+
+            // Calculate expected results on host
+            std::map<key_type, value_type> expected;
+            for(size_t i = 0; i < size; i++)
+            {
+                const auto it = expected.find(keys_input[i]);
+                if(it == expected.end())
+                {
+                    expected.emplace(keys_input[i], values_input[i]);
+                }
+                else
+                {
+                    it->second = reduce_op(it->second, values_input[i]);
+                }
+            }
+            const size_t max_unique_keys = overflow ? unique_keys / 10 : unique_keys;
+
+            key_type*     d_keys_input;
+            value_type*   d_values_input;
+            key_type*     d_unique_output;
+            value_type*   d_aggregates_output;
+            unsigned int* d_unique_count_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input,
+                                                         (size + 1) * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input,
+                                                         (size + 1) * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_unique_output,
+                                                         (size + 1) * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_aggregates_output,
+                                                         (size + 1) * sizeof(value_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_unique_count_output, sizeof(unsigned int)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values_input,
+                                values_input.data(),
+                                size * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+
+            size_t temporary_storage_bytes;
+            HIP_CHECK(rocprim::hash_reduce_by_key<config>(nullptr,
+                                                          temporary_storage_bytes,
+                                                          d_keys_input,
+                                                          d_values_input,
+                                                          size,
+                                                          d_unique_output,
+                                                          d_aggregates_output,
+                                                          d_unique_count_output,
+                                                          max_unique_keys,
+                                                          reduce_op,
+                                                          rocprim::equal_to<key_type>(),
+                                                          rocprim::default_key_hash<key_type>(),
+                                                          stream,
+                                                          debug_synchronous));
+            ASSERT_GT(temporary_storage_bytes, 0);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(rocprim::hash_reduce_by_key<config>(d_temporary_storage,
+                                                          temporary_storage_bytes,
+                                                          d_keys_input,
+                                                          d_values_input,
+                                                          size,
+                                                          d_unique_output,
+                                                          d_aggregates_output,
+                                                          d_unique_count_output,
+                                                          max_unique_keys,
+                                                          reduce_op,
+                                                          rocprim::equal_to<key_type>(),
+                                                          rocprim::default_key_hash<key_type>(),
+                                                          stream,
+                                                          debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            unsigned int unique_count;
+            HIP_CHECK(hipMemcpy(&unique_count,
+                                d_unique_count_output,
+                                sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+            ASSERT_EQ(unique_count, expected.size());
+
+            std::vector<key_type>   unique_output(unique_count);
+            std::vector<value_type> aggregates_output(unique_count);
+            HIP_CHECK(hipMemcpy(unique_output.data(),
+                                d_unique_output,
+                                unique_count * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(aggregates_output.data(),
+                                d_aggregates_output,
+                                unique_count * sizeof(value_type),
+                                hipMemcpyDeviceToHost));
+
+            // The order of the groups is unspecified
+            std::vector<size_t> order(unique_count);
+            for(size_t i = 0; i < unique_count; i++)
+            {
+                order[i] = i;
+            }
+            std::sort(order.begin(),
+                      order.end(),
+                      [&](const size_t a, const size_t b)
+                      { return unique_output[a] < unique_output[b]; });
+            std::vector<key_type>   sorted_unique_output;
+            std::vector<value_type> sorted_aggregates_output;
+            std::vector<key_type>   expected_unique;
+            std::vector<value_type> expected_aggregates;
+            for(size_t i = 0; i < unique_count; i++)
+            {
+                sorted_unique_output.push_back(unique_output[order[i]]);
+                sorted_aggregates_output.push_back(aggregates_output[order[i]]);
+            }
+            for(const auto& group : expected)
+            {
+                expected_unique.push_back(group.first);
+                expected_aggregates.push_back(group.second);
+            }
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(sorted_unique_output, expected_unique));
+            ASSERT_NO_FATAL_FAILURE(
+                test_utils::assert_eq(sorted_aggregates_output, expected_aggregates));
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_unique_output));
+            HIP_CHECK(hipFree(d_aggregates_output));
+            HIP_CHECK(hipFree(d_unique_count_output));
+            HIP_CHECK(hipFree(d_temporary_storage));
+        }
+    }
+}
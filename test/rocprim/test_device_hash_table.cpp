@@ -0,0 +1,281 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_hash_table.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <map>
+#include <utility>
+#include <vector>
+
+template<class Key,
+         class ProbeKey,
+         // The keys are drawn from [0, KeyRange), so both sides have duplicates when it is
+         // smaller than the sizes
+         unsigned int KeyRange,
+         class Config = rocprim::default_config>
+struct params
+{
+    using key_type                          = Key;
+    using probe_key_type                    = ProbeKey;
+    static constexpr unsigned int key_range = KeyRange;
+    using config                            = Config;
+};
+
+template<class Params>
+class RocprimDeviceHashTable : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<params<int, int, 1>,
+                         params<int, int, 100>,
+                         params<int, int, 1000000>,
+                         params<unsigned int, unsigned short, 30000>,
+                         params<unsigned long long, int, 5000>,
+                         params<long long, long long, 1 << 20, rocprim::hash_table_config<64, 3>>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimDeviceHashTable, Params);
+
+TYPED_TEST(RocprimDeviceHashTable, Join)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type                   = typename TestFixture::params::key_type;
+    using probe_key_type             = typename TestFixture::params::probe_key_type;
+    using config                     = typename TestFixture::params::config;
+    constexpr unsigned int key_range = TestFixture::params::key_range;
+    const bool             debug_synchronous = false;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            const size_t build_size = size / 2;
+            const size_t probe_size = size;
+            // Few keys and large sizes produce too many matches
+            if(static_cast<double>(build_size) * probe_size / key_range > (1 << 24))
+            {
+                continue;
+            }
+            SCOPED_TRACE(testing::Message() << "with build_size = " << build_size);
+            SCOPED_TRACE(testing::Message() << "with probe_size = " << probe_size);
+
+            const std::vector<key_type> build_keys
+                = test_utils::get_random_data<key_type>(build_size,
+                                                        key_type(0),
+                                                        key_type(key_range - 1),
+                                                        seed_value);
+            const std::vector<probe_key_type> probe_keys
+                = test_utils::get_random_data<probe_key_type>(probe_size,
+                                                              probe_key_type(0),
+                                                              probe_key_type(key_range - 1),
+                                                              seed_value + 1);
+
+            // Calculate expected results on host
+            std::map<key_type, std::vector<unsigned int>> build_items;
+            for(size_t i = 0; i < build_size; i++)
+            {
+                build_items[build_keys[i]].push_back(i);
+            }
+            std::vector<std::pair<unsigned int, unsigned int>> expected;
+            for(size_t i = 0; i < probe_size; i++)
+            {
+                const auto it = build_items.find(static_cast<key_type>(probe_keys[i]));
+                if(it != build_items.end())
+                {
+                    for(const unsigned int build_index : it->second)
+                    {
+                        expected.emplace_back(i, build_index);
+                    }
+                }
+            }
+
+            key_type*       d_build_keys;
+            probe_key_type* d_probe_keys;
+            size_t*         d_match_count_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_build_keys,
+                                                         (build_size + 1) * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(
+                &d_probe_keys,
+                (probe_size + 1) * sizeof(probe_key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_match_count_output, sizeof(size_t)));
+            HIP_CHECK(hipMemcpy(d_build_keys,
+                                build_keys.data(),
+                                build_size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_probe_keys,
+                                probe_keys.data(),
+                                probe_size * sizeof(probe_key_type),
+                                hipMemcpyHostToDevice));
+
+            size_t table_storage_size;
+            HIP_CHECK(rocprim::hash_table_build<config>(nullptr,
+                                                        table_storage_size,
+                                                        d_build_keys,
+                                                        build_size));
+            ASSERT_GT(table_storage_size, 0);
+            void* d_table_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_table_storage, table_storage_size));
+            HIP_CHECK(rocprim::hash_table_build<config>(d_table_storage,
+                                                        table_storage_size,
+                                                        d_build_keys,
+                                                        build_size,
+                                                        rocprim::equal_to<key_type>(),
+                                                        rocprim::default_key_hash<key_type>(),
+                                                        stream,
+                                                        debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+
+            // Count the matches
+            size_t temporary_storage_bytes;
+            HIP_CHECK(rocprim::hash_table_probe_count<config>(nullptr,
+                                                              temporary_storage_bytes,
+                                                              d_table_storage,
+                                                              table_storage_size,
+                                                              d_build_keys,
+                                                              build_size,
+                                                              d_probe_keys,
+                                                              probe_size,
+                                                              d_match_count_output));
+            ASSERT_GT(temporary_storage_bytes, 0);
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(rocprim::hash_table_probe_count<config>(d_temporary_storage,
+                                                              temporary_storage_bytes,
+                                                              d_table_storage,
+                                                              table_storage_size,
+                                                              d_build_keys,
+                                                              build_size,
+                                                              d_probe_keys,
+                                                              probe_size,
+                                                              d_match_count_output,
+                                                              rocprim::equal_to<key_type>(),
+                                                              rocprim::default_key_hash<key_type>(),
+                                                              stream,
+                                                              debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipFree(d_temporary_storage));
+
+            size_t match_count;
+            HIP_CHECK(hipMemcpy(&match_count,
+                                d_match_count_output,
+                                sizeof(size_t),
+                                hipMemcpyDeviceToHost));
+            ASSERT_EQ(match_count, expected.size());
+
+            // Write the matches
+            unsigned int* d_build_indices_output;
+            unsigned int* d_probe_indices_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_build_indices_output,
+                                                         (match_count + 1) * sizeof(unsigned int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_probe_indices_output,
+                                                         (match_count + 1) * sizeof(unsigned int)));
+            HIP_CHECK(hipMemset(d_match_count_output, 0, sizeof(size_t)));
+
+            HIP_CHECK(rocprim::hash_table_probe<config>(nullptr,
+                                                        temporary_storage_bytes,
+                                                        d_table_storage,
+                                                        table_storage_size,
+                                                        d_build_keys,
+                                                        build_size,
+                                                        d_probe_keys,
+                                                        probe_size,
+                                                        d_build_indices_output,
+                                                        d_probe_indices_output,
+                                                        d_match_count_output));
+            ASSERT_GT(temporary_storage_bytes, 0);
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(rocprim::hash_table_probe<config>(d_temporary_storage,
+                                                        temporary_storage_bytes,
+                                                        d_table_storage,
+                                                        table_storage_size,
+                                                        d_build_keys,
+                                                        build_size,
+                                                        d_probe_keys,
+                                                        probe_size,
+                                                        d_build_indices_output,
+                                                        d_probe_indices_output,
+                                                        d_match_count_output,
+                                                        rocprim::equal_to<key_type>(),
+                                                        rocprim::default_key_hash<key_type>(),
+                                                        stream,
+                                                        debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            HIP_CHECK(hipMemcpy(&match_count,
+                                d_match_count_output,
+                                sizeof(size_t),
+                                hipMemcpyDeviceToHost));
+            ASSERT_EQ(match_count, expected.size());
+
+            std::vector<unsigned int> build_indices_output(match_count);
+            std::vector<unsigned int> probe_indices_output(match_count);
+            HIP_CHECK(hipMemcpy(build_indices_output.data(),
+                                d_build_indices_output,
+                                match_count * sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(probe_indices_output.data(),
+                                d_probe_indices_output,
+                                match_count * sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+
+            // The pairs are ordered by probe item, the build items of one probe item are not
+            ASSERT_TRUE(std::is_sorted(probe_indices_output.begin(), probe_indices_output.end()));
+            std::vector<std::pair<unsigned int, unsigned int>> output;
+            for(size_t i = 0; i < match_count; i++)
+            {
+                output.emplace_back(probe_indices_output[i], build_indices_output[i]);
+            }
+            std::sort(output.begin(), output.end());
+            ASSERT_EQ(output, expected);
+
+            HIP_CHECK(hipFree(d_build_keys));
+            HIP_CHECK(hipFree(d_probe_keys));
+            HIP_CHECK(hipFree(d_match_count_output));
+            HIP_CHECK(hipFree(d_table_storage));
+            HIP_CHECK(hipFree(d_build_indices_output));
+            HIP_CHECK(hipFree(d_probe_indices_output));
+            HIP_CHECK(hipFree(d_temporary_storage));
+        }
+    }
+}
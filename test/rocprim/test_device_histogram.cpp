@@ -25,6 +25,7 @@
 // required rocprim headers
 #include <rocprim/iterator/transform_iterator.hpp>
 #include <rocprim/device/device_histogram.hpp>
+#include <rocprim/device/device_segmented_histogram.hpp>
 
 // required test headers
 #include "test_utils_types.hpp"
@@ -106,7 +107,9 @@ template<
     int LowerLevel,
     int UpperLevel,
     class LevelType = SampleType,
-    class CounterType = int
+    class CounterType = int,
+    rocprim::histogram_algorithm Algorithm = rocprim::histogram_algorithm::default_algorithm,
+    bool WarpAggregation = false
 >
 struct params1
 {
@@ -116,6 +119,8 @@ struct params1
     static constexpr int upper_level = UpperLevel;
     using level_type = LevelType;
     using counter_type = CounterType;
+    static constexpr rocprim::histogram_algorithm algorithm = Algorithm;
+    static constexpr bool warp_aggregation = WarpAggregation;
 };
 
 template<class Params>
@@ -129,12 +134,21 @@ typedef ::testing::Types<
     params1<int, 128, 0, 256>,
     params1<unsigned int, 12345, 10, 12355, short>,
     params1<unsigned short, 65536, 0, 65536, int>,
+    params1<unsigned int, 1000000, 0, 1000000, int>,
     params1<unsigned char, 10, 20, 240, unsigned char, unsigned int>,
     params1<unsigned char, 256, 0, 256, short>,
 
     params1<double, 10, 0, 1000, double, int>,
     params1<int, 123, 100, 5635, int>,
-    params1<double, 55, -123, +123, double>
+    params1<double, 55, -123, +123, double>,
+
+    params1<int, 10, 0, 10, int, int, rocprim::histogram_algorithm::using_sort>,
+    params1<double, 55, -123, +123, double, unsigned int, rocprim::histogram_algorithm::using_sort>,
+    params1<unsigned int, 1000000, 0, 1000000, int, int, rocprim::histogram_algorithm::using_sort>,
+
+    params1<int, 10, 0, 10, int, int, rocprim::histogram_algorithm::using_atomic, true>,
+    params1<unsigned char, 256, 0, 256, short, int, rocprim::histogram_algorithm::using_atomic, true>,
+    params1<double, 55, -123, +123, double, unsigned int, rocprim::histogram_algorithm::using_atomic, true>
 > Params1;
 
 TYPED_TEST_SUITE(RocprimDeviceHistogramEven, Params1);
@@ -228,7 +242,12 @@ TYPED_TEST(RocprimDeviceHistogramEven, Even)
                 }
             }
 
-            using config = rocprim::histogram_config<rocprim::kernel_config<128, 5>>;
+            using config = rocprim::histogram_config<rocprim::kernel_config<128, 5>,
+                                                     1024,
+                                                     2048,
+                                                     3,
+                                                     TestFixture::params::warp_aggregation,
+                                                     TestFixture::params::algorithm>;
 
             size_t temporary_storage_bytes = 0;
             if(rows == 1)
@@ -308,6 +327,307 @@ TYPED_TEST(RocprimDeviceHistogramEven, Even)
     }
 }
 
+template<class Params>
+class RocprimDeviceHistogramWeighted : public ::testing::Test {
+public:
+    using params = Params;
+};
+
+// Shared memory, shared memory windows and global memory paths
+typedef ::testing::Types<
+    params1<int, 10, 0, 10, int, float>,
+    params1<unsigned short, 10000, 0, 10000, int, float>,
+    params1<unsigned int, 1000000, 0, 1000000, int, float>,
+    params1<float, 123, -123, +123, float, float>
+> ParamsWeighted;
+
+TYPED_TEST_SUITE(RocprimDeviceHistogramWeighted, ParamsWeighted);
+
+TYPED_TEST(RocprimDeviceHistogramWeighted, EvenAndRange)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using sample_type = typename TestFixture::params::sample_type;
+    using counter_type = typename TestFixture::params::counter_type;
+    using level_type = typename TestFixture::params::level_type;
+    constexpr unsigned int bins = TestFixture::params::bins;
+    constexpr level_type lower_level = TestFixture::params::lower_level;
+    constexpr level_type upper_level = TestFixture::params::upper_level;
+
+    hipStream_t stream = 0;
+
+    const bool debug_synchronous = false;
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Small integer weights, so the sums are exact
+            std::vector<sample_type> input = get_random_samples<sample_type>(size, lower_level, upper_level, seed_value);
+            std::vector<int> weights_int = test_utils::get_random_data<int>(size, 0, 4, seed_value);
+            std::vector<counter_type> weights(weights_int.begin(), weights_int.end());
+
+            const level_type scale = (upper_level - lower_level) / bins;
+            std::vector<level_type> levels(bins + 1);
+            for(unsigned int bin = 0; bin <= bins; bin++)
+            {
+                levels[bin] = lower_level + bin * scale;
+            }
+
+            // Calculate expected results on host
+            std::vector<counter_type> histogram_expected(bins, 0);
+            for(size_t i = 0; i < size; i++)
+            {
+                const level_type s = static_cast<level_type>(input[i]);
+                if(s >= lower_level && s < levels[bins])
+                {
+                    const unsigned int bin = static_cast<unsigned int>(
+                        std::upper_bound(levels.begin(), levels.end(), s) - levels.begin() - 1);
+                    histogram_expected[bin] += weights[i];
+                }
+            }
+
+            sample_type * d_input;
+            counter_type * d_weights;
+            level_type * d_levels;
+            counter_type * d_histogram;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(sample_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_weights, size * sizeof(counter_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_levels, (bins + 1) * sizeof(level_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_histogram, bins * sizeof(counter_type)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(sample_type), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_weights, weights.data(), size * sizeof(counter_type), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_levels, levels.data(), (bins + 1) * sizeof(level_type), hipMemcpyHostToDevice));
+
+            for(bool range : {false, true})
+            {
+                SCOPED_TRACE(testing::Message() << "with range = " << range);
+
+                // The ranges of histogram_range are the same as the bins of histogram_even
+                const auto histogram_weighted = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+                {
+                    return range
+                        ? rocprim::histogram_range_weighted(
+                            d_temporary_storage, temporary_storage_bytes,
+                            d_input, d_weights, size,
+                            d_histogram,
+                            bins + 1, d_levels,
+                            stream, debug_synchronous
+                        )
+                        : rocprim::histogram_even_weighted(
+                            d_temporary_storage, temporary_storage_bytes,
+                            d_input, d_weights, size,
+                            d_histogram,
+                            bins + 1, lower_level, levels[bins],
+                            stream, debug_synchronous
+                        );
+                };
+
+                size_t temporary_storage_bytes = 0;
+                HIP_CHECK(histogram_weighted(nullptr, temporary_storage_bytes));
+
+                ASSERT_GT(temporary_storage_bytes, 0U);
+
+                void * d_temporary_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+                HIP_CHECK(histogram_weighted(d_temporary_storage, temporary_storage_bytes));
+
+                std::vector<counter_type> histogram(bins);
+                HIP_CHECK(
+                    hipMemcpy(
+                        histogram.data(), d_histogram,
+                        bins * sizeof(counter_type),
+                        hipMemcpyDeviceToHost
+                    )
+                );
+
+                HIP_CHECK(hipFree(d_temporary_storage));
+
+                for(size_t i = 0; i < bins; i++)
+                {
+                    ASSERT_EQ(histogram[i], histogram_expected[i]);
+                }
+            }
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_weights));
+            HIP_CHECK(hipFree(d_levels));
+            HIP_CHECK(hipFree(d_histogram));
+        }
+    }
+}
+
+template<class Params>
+class RocprimDeviceHistogramAccumulate : public ::testing::Test {
+public:
+    using params = Params;
+};
+
+// Shared memory, shared memory windows, global memory and sort paths with 64-bit counters
+typedef ::testing::Types<
+    params1<int, 10, 0, 10, int, unsigned long long>,
+    params1<unsigned short, 10000, 0, 10000, int, unsigned long long>,
+    params1<unsigned int, 1000000, 0, 1000000, int, unsigned long long>,
+    params1<int, 123, 100, 5635, int, unsigned int>,
+    params1<int, 10, 0, 10, int, unsigned long long, rocprim::histogram_algorithm::using_sort>,
+    params1<unsigned int, 1000000, 0, 1000000, int, unsigned long long, rocprim::histogram_algorithm::using_sort>
+> ParamsAccumulate;
+
+TYPED_TEST_SUITE(RocprimDeviceHistogramAccumulate, ParamsAccumulate);
+
+TYPED_TEST(RocprimDeviceHistogramAccumulate, EvenAndRange)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using sample_type = typename TestFixture::params::sample_type;
+    using counter_type = typename TestFixture::params::counter_type;
+    using level_type = typename TestFixture::params::level_type;
+    constexpr unsigned int bins = TestFixture::params::bins;
+    constexpr level_type lower_level = TestFixture::params::lower_level;
+    constexpr level_type upper_level = TestFixture::params::upper_level;
+
+    using config = rocprim::histogram_config<rocprim::kernel_config<128, 5>,
+                                             1024,
+                                             2048,
+                                             3,
+                                             TestFixture::params::warp_aggregation,
+                                             TestFixture::params::algorithm>;
+
+    hipStream_t stream = 0;
+
+    const bool debug_synchronous = false;
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<sample_type> input = get_random_samples<sample_type>(size, lower_level, upper_level, seed_value);
+
+            const level_type scale = (upper_level - lower_level) / bins;
+            std::vector<level_type> levels(bins + 1);
+            for(unsigned int bin = 0; bin <= bins; bin++)
+            {
+                levels[bin] = lower_level + bin * scale;
+            }
+
+            // The bins start with counts that 32-bit counters could not hold
+            std::vector<counter_type> histogram_initial(bins);
+            for(unsigned int bin = 0; bin < bins; bin++)
+            {
+                histogram_initial[bin] = std::numeric_limits<counter_type>::max() / 2 + bin;
+            }
+
+            // Calculate expected results on host
+            std::vector<counter_type> histogram_expected(histogram_initial);
+            for(size_t i = 0; i < size; i++)
+            {
+                const level_type s = static_cast<level_type>(input[i]);
+                if(s >= lower_level && s < levels[bins])
+                {
+                    const unsigned int bin = static_cast<unsigned int>(
+                        std::upper_bound(levels.begin(), levels.end(), s) - levels.begin() - 1);
+                    histogram_expected[bin]++;
+                }
+            }
+
+            sample_type * d_input;
+            level_type * d_levels;
+            counter_type * d_histogram;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, (size + 1) * sizeof(sample_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_levels, (bins + 1) * sizeof(level_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_histogram, bins * sizeof(counter_type)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(sample_type), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_levels, levels.data(), (bins + 1) * sizeof(level_type), hipMemcpyHostToDevice));
+
+            for(bool range : {false, true})
+            {
+                SCOPED_TRACE(testing::Message() << "with range = " << range);
+
+                HIP_CHECK(
+                    hipMemcpy(
+                        d_histogram, histogram_initial.data(),
+                        bins * sizeof(counter_type),
+                        hipMemcpyHostToDevice
+                    )
+                );
+
+                const auto histogram_accumulate = [&](void* d_temporary_storage,
+                                                      size_t& temporary_storage_bytes,
+                                                      size_t offset,
+                                                      size_t batch_size)
+                {
+                    return range
+                        ? rocprim::histogram_range_accumulate<config>(
+                            d_temporary_storage, temporary_storage_bytes,
+                            d_input + offset, batch_size,
+                            d_histogram,
+                            bins + 1, d_levels,
+                            stream, debug_synchronous
+                        )
+                        : rocprim::histogram_even_accumulate<config>(
+                            d_temporary_storage, temporary_storage_bytes,
+                            d_input + offset, batch_size,
+                            d_histogram,
+                            bins + 1, lower_level, levels[bins],
+                            stream, debug_synchronous
+                        );
+                };
+
+                size_t temporary_storage_bytes = 0;
+                HIP_CHECK(histogram_accumulate(nullptr, temporary_storage_bytes, 0, size));
+
+                ASSERT_GT(temporary_storage_bytes, 0U);
+
+                void * d_temporary_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+                // The samples are added in two batches
+                const size_t first_batch_size = size / 3;
+                HIP_CHECK(histogram_accumulate(d_temporary_storage, temporary_storage_bytes, 0, first_batch_size));
+                HIP_CHECK(histogram_accumulate(d_temporary_storage,
+                                               temporary_storage_bytes,
+                                               first_batch_size,
+                                               size - first_batch_size));
+
+                std::vector<counter_type> histogram(bins);
+                HIP_CHECK(
+                    hipMemcpy(
+                        histogram.data(), d_histogram,
+                        bins * sizeof(counter_type),
+                        hipMemcpyDeviceToHost
+                    )
+                );
+
+                HIP_CHECK(hipFree(d_temporary_storage));
+
+                for(size_t i = 0; i < bins; i++)
+                {
+                    ASSERT_EQ(histogram[i], histogram_expected[i]);
+                }
+            }
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_levels));
+            HIP_CHECK(hipFree(d_histogram));
+        }
+    }
+}
+
 template<
     class SampleType,
     unsigned int Bins,
@@ -342,7 +662,10 @@ typedef ::testing::Types<
     params2<unsigned char, 256, 0, 1, 1, unsigned short>,
 
     params2<float, 456, -100, 1, 123>,
-    params2<double, 3, 10000, 1000, 1000, double, unsigned int>
+    params2<float, 512, 1, 1, 5>,
+    params2<double, 3, 10000, 1000, 1000, double, unsigned int>,
+    // more levels than fit into the shared memory, the coarse levels are searched first
+    params2<double, 1500, -500, 1, 3, double, unsigned int>
 > Params2;
 
 TYPED_TEST_SUITE(RocprimDeviceHistogramRange, Params2);
@@ -801,6 +1124,161 @@ TYPED_TEST(RocprimDeviceHistogramMultiEven, MultiEven)
     }
 }
 
+template<class Params>
+class RocprimDeviceHistogramJointEven : public ::testing::Test {
+public:
+    using params = Params;
+};
+
+// Shared memory, shared memory windows and global memory paths (by the total number of bins)
+typedef ::testing::Types<
+    params3<unsigned char, 4, 2, 16, 0, 256, int>,
+    params3<unsigned short, 2, 2, 256, 0, 65536, int>,
+    params3<int, 3, 1, 1000, -500, 500>,
+    params3<float, 3, 3, 100, -50, 50, float, unsigned int>
+> ParamsJointEven;
+
+TYPED_TEST_SUITE(RocprimDeviceHistogramJointEven, ParamsJointEven);
+
+TYPED_TEST(RocprimDeviceHistogramJointEven, JointEven)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using sample_type = typename TestFixture::params::sample_type;
+    using counter_type = typename TestFixture::params::counter_type;
+    using level_type = typename TestFixture::params::level_type;
+    constexpr unsigned int channels = TestFixture::params::channels;
+    constexpr unsigned int active_channels = TestFixture::params::active_channels;
+    constexpr unsigned int bins = TestFixture::params::bins;
+    constexpr level_type lower_level = TestFixture::params::lower_level;
+    constexpr level_type upper_level = TestFixture::params::upper_level;
+
+    unsigned int levels[active_channels];
+    level_type lower_levels[active_channels];
+    level_type upper_levels[active_channels];
+    size_t total_bins = 1;
+    for(unsigned int channel = 0; channel < active_channels; channel++)
+    {
+        levels[channel] = bins + 1;
+        lower_levels[channel] = lower_level;
+        upper_levels[channel] = upper_level;
+        total_bins *= bins;
+    }
+
+    hipStream_t stream = 0;
+
+    const bool debug_synchronous = false;
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<sample_type> input
+                = get_random_samples<sample_type>(size * channels, lower_level, upper_level, seed_value);
+
+            // Calculate expected results on host, the last active channel varies fastest
+            const level_type scale = (upper_level - lower_level) / bins;
+            std::vector<counter_type> histogram_expected(total_bins, 0);
+            for(size_t i = 0; i < size; i++)
+            {
+                size_t bin = 0;
+                bool is_valid = true;
+                for(unsigned int channel = 0; channel < active_channels; channel++)
+                {
+                    const level_type s = static_cast<level_type>(input[i * channels + channel]);
+                    if(s >= lower_level && s < upper_level)
+                    {
+                        const size_t channel_bin = std::min<size_t>(
+                            static_cast<size_t>((s - lower_level) / scale), bins - 1);
+                        bin = bin * bins + channel_bin;
+                    }
+                    else
+                    {
+                        is_valid = false;
+                    }
+                }
+                if(is_valid)
+                {
+                    histogram_expected[bin]++;
+                }
+            }
+
+            sample_type * d_input;
+            counter_type * d_histogram;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * channels * sizeof(sample_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_histogram, total_bins * sizeof(counter_type)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_input, input.data(),
+                    size * channels * sizeof(sample_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            for(bool use_iterator : {false, true})
+            {
+                SCOPED_TRACE(testing::Message() << "with use_iterator = " << use_iterator);
+
+                auto d_input_iterator = rocprim::make_transform_iterator(d_input, transform_op<sample_type>());
+                const auto joint_histogram = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+                {
+                    return use_iterator
+                        ? rocprim::joint_histogram_even<channels, active_channels>(
+                            d_temporary_storage, temporary_storage_bytes,
+                            d_input_iterator, size,
+                            d_histogram,
+                            levels, lower_levels, upper_levels,
+                            stream, debug_synchronous
+                        )
+                        : rocprim::joint_histogram_even<channels, active_channels>(
+                            d_temporary_storage, temporary_storage_bytes,
+                            d_input, size,
+                            d_histogram,
+                            levels, lower_levels, upper_levels,
+                            stream, debug_synchronous
+                        );
+                };
+
+                size_t temporary_storage_bytes = 0;
+                HIP_CHECK(joint_histogram(nullptr, temporary_storage_bytes));
+
+                ASSERT_GT(temporary_storage_bytes, 0U);
+
+                void * d_temporary_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+                HIP_CHECK(joint_histogram(d_temporary_storage, temporary_storage_bytes));
+
+                std::vector<counter_type> histogram(total_bins);
+                HIP_CHECK(
+                    hipMemcpy(
+                        histogram.data(), d_histogram,
+                        total_bins * sizeof(counter_type),
+                        hipMemcpyDeviceToHost
+                    )
+                );
+
+                HIP_CHECK(hipFree(d_temporary_storage));
+
+                for(size_t i = 0; i < total_bins; i++)
+                {
+                    ASSERT_EQ(histogram[i], histogram_expected[i]);
+                }
+            }
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_histogram));
+        }
+    }
+}
+
 template<
     class SampleType,
     unsigned int Channels,
@@ -1081,3 +1559,333 @@ TYPED_TEST(RocprimDeviceHistogramMultiRange, MultiRange)
 
     }
 }
+
+// Segments of random lengths with empty segments, and one long segment counted by several blocks
+std::vector<unsigned int> get_segment_offsets(unsigned int segments, unsigned int seed_value)
+{
+    std::vector<unsigned int> lengths
+        = test_utils::get_random_data<unsigned int>(segments, 0, 5000, seed_value);
+    if(segments > 0)
+    {
+        lengths[seed_value % segments] = 1 << 18;
+    }
+    std::vector<unsigned int> offsets(segments + 1, 0);
+    for(unsigned int i = 0; i < segments; i++)
+    {
+        offsets[i + 1] = offsets[i] + lengths[i];
+    }
+    return offsets;
+}
+
+template<bool Even>
+void test_segmented_histogram(const unsigned int bins)
+{
+    using sample_type  = float;
+    using counter_type = unsigned int;
+
+    const bool  debug_synchronous = false;
+    hipStream_t stream            = 0; // default
+
+    // Bins of equal widths in [0, bins), or the squares of [0, bins] for the range variant
+    std::vector<sample_type> levels(bins + 1);
+    for(unsigned int i = 0; i <= bins; i++)
+    {
+        levels[i] = Even ? static_cast<sample_type>(i) : static_cast<sample_type>(i * i);
+    }
+    const sample_type upper_level = levels[bins];
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(unsigned int segments : {0u, 1u, 7u, 1000u})
+        {
+            SCOPED_TRACE(testing::Message() << "with segments = " << segments);
+
+            const std::vector<unsigned int> offsets = get_segment_offsets(segments, seed_value);
+            const size_t                    size    = offsets[segments];
+
+            // Some samples are outside the histogram range
+            const std::vector<sample_type> input
+                = test_utils::get_random_data<sample_type>(size,
+                                                           -upper_level / 10,
+                                                           upper_level * 1.1f,
+                                                           seed_value);
+
+            std::vector<counter_type> expected(size_t(segments) * bins, 0);
+            for(unsigned int segment = 0; segment < segments; segment++)
+            {
+                for(size_t i = offsets[segment]; i < offsets[segment + 1]; i++)
+                {
+                    const sample_type s = input[i];
+                    if(s >= levels[0] && s < levels[bins])
+                    {
+                        const auto bin = std::upper_bound(levels.begin(), levels.end(), s)
+                                         - levels.begin() - 1;
+                        expected[size_t(segment) * bins + bin]++;
+                    }
+                }
+            }
+
+            sample_type*  d_input;
+            unsigned int* d_offsets;
+            sample_type*  d_levels;
+            counter_type* d_histogram;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         (size + 1) * sizeof(sample_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_offsets,
+                                                         (segments + 1) * sizeof(unsigned int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_levels,
+                                                         (bins + 1) * sizeof(sample_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(
+                &d_histogram,
+                (size_t(segments) * bins + 1) * sizeof(counter_type)));
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                size * sizeof(sample_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_offsets,
+                                offsets.data(),
+                                (segments + 1) * sizeof(unsigned int),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_levels,
+                                levels.data(),
+                                (bins + 1) * sizeof(sample_type),
+                                hipMemcpyHostToDevice));
+
+            const auto segmented_histogram = [&](void* d_temporary_storage, size_t& bytes)
+            {
+                if(Even)
+                {
+                    return rocprim::segmented_histogram_even(d_temporary_storage,
+                                                             bytes,
+                                                             d_input,
+                                                             segments,
+                                                             d_offsets,
+                                                             d_offsets + 1,
+                                                             d_histogram,
+                                                             bins + 1,
+                                                             levels[0],
+                                                             upper_level,
+                                                             stream,
+                                                             debug_synchronous);
+                }
+                return rocprim::segmented_histogram_range(d_temporary_storage,
+                                                          bytes,
+                                                          d_input,
+                                                          segments,
+                                                          d_offsets,
+                                                          d_offsets + 1,
+                                                          d_histogram,
+                                                          bins + 1,
+                                                          d_levels,
+                                                          stream,
+                                                          debug_synchronous);
+            };
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(segmented_histogram(nullptr, temporary_storage_bytes));
+            ASSERT_GT(temporary_storage_bytes, 0U);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(segmented_histogram(d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<counter_type> histogram(size_t(segments) * bins);
+            HIP_CHECK(hipMemcpy(histogram.data(),
+                                d_histogram,
+                                histogram.size() * sizeof(counter_type),
+                                hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_offsets));
+            HIP_CHECK(hipFree(d_levels));
+            HIP_CHECK(hipFree(d_histogram));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(histogram, expected));
+        }
+    }
+}
+
+TEST(RocprimDeviceSegmentedHistogram, Even)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    // The largest number of bins does not fit in several shared histograms
+    for(unsigned int bins : {1u, 10u, 256u, 3000u})
+    {
+        SCOPED_TRACE(testing::Message() << "with bins = " << bins);
+        test_segmented_histogram<true>(bins);
+    }
+}
+
+TEST(RocprimDeviceSegmentedHistogram, Range)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    for(unsigned int bins : {10u, 256u})
+    {
+        SCOPED_TRACE(testing::Message() << "with bins = " << bins);
+        test_segmented_histogram<false>(bins);
+    }
+}
+
+TEST(RocprimDeviceSegmentedHistogram, IncorrectInput)
+{
+    size_t temporary_storage_bytes = 0;
+    int*   histogram               = nullptr;
+    int*   offsets                 = nullptr;
+    float* samples                 = nullptr;
+
+    // No bins, and more bins than the shared memory of the default config
+    for(unsigned int levels : {1u, 1u << 20})
+    {
+        ASSERT_EQ(rocprim::segmented_histogram_even(nullptr,
+                                                    temporary_storage_bytes,
+                                                    samples,
+                                                    1u,
+                                                    offsets,
+                                                    offsets + 1,
+                                                    histogram,
+                                                    levels,
+                                                    0.0f,
+                                                    10.0f),
+                  hipErrorInvalidValue);
+    }
+}
+
+TEST(RocprimDeviceHistogramMultiEven, PackedPixels)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using sample_type  = unsigned char;
+    using counter_type = unsigned int;
+
+    constexpr unsigned int channels        = 4;
+    constexpr unsigned int active_channels = 3;
+    constexpr unsigned int bins            = 256;
+
+    const bool  debug_synchronous = false;
+    hipStream_t stream            = 0; // default
+
+    counter_type* d_histogram[active_channels];
+    unsigned int  num_levels[active_channels];
+    int           lower_level[active_channels];
+    int           upper_level[active_channels];
+    for(unsigned int channel = 0; channel < active_channels; channel++)
+    {
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_histogram[channel],
+                                                     bins * sizeof(counter_type)));
+        num_levels[channel]  = bins + 1;
+        lower_level[channel] = 0;
+        upper_level[channel] = bins;
+    }
+
+    // RGBA rows with strides of whole and of partial pixels
+    for(auto dim : {std::make_tuple(1, 100000, 0), std::make_tuple(100, 3000, 4),
+                    std::make_tuple(37, 1029, 2)})
+    {
+        const size_t rows       = std::get<0>(dim);
+        const size_t columns    = std::get<1>(dim);
+        const size_t row_stride = columns * channels + std::get<2>(dim);
+        SCOPED_TRACE(testing::Message() << "with rows = " << rows << ", columns = " << columns
+                                        << ", row_stride = " << row_stride);
+
+        // The samples start at aligned addresses, after one pixel and after one byte, so the
+        // vector, word and unaligned loads are used
+        for(size_t offset : {0, 4, 1})
+        {
+            SCOPED_TRACE(testing::Message() << "with offset = " << offset);
+
+            const size_t size = offset + rows * row_stride;
+            const std::vector<sample_type> input
+                = test_utils::get_random_data<sample_type>(size, 0, 255, rows + offset);
+
+            std::vector<counter_type> expected[active_channels];
+            for(unsigned int channel = 0; channel < active_channels; channel++)
+            {
+                expected[channel] = std::vector<counter_type>(bins, 0);
+                for(size_t row = 0; row < rows; row++)
+                {
+                    for(size_t column = 0; column < columns; column++)
+                    {
+                        expected[channel]
+                                [input[offset + row * row_stride + column * channels + channel]]++;
+                    }
+                }
+            }
+
+            sample_type* d_input;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(sample_type)));
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                size * sizeof(sample_type),
+                                hipMemcpyHostToDevice));
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK((rocprim::multi_histogram_even<channels, active_channels>(
+                nullptr,
+                temporary_storage_bytes,
+                d_input + offset,
+                columns,
+                rows,
+                row_stride * sizeof(sample_type),
+                d_histogram,
+                num_levels,
+                lower_level,
+                upper_level,
+                stream,
+                debug_synchronous)));
+            ASSERT_GT(temporary_storage_bytes, 0U);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK((rocprim::multi_histogram_even<channels, active_channels>(
+                d_temporary_storage,
+                temporary_storage_bytes,
+                d_input + offset,
+                columns,
+                rows,
+                row_stride * sizeof(sample_type),
+                d_histogram,
+                num_levels,
+                lower_level,
+                upper_level,
+                stream,
+                debug_synchronous)));
+            HIP_CHECK(hipGetLastError());
+
+            for(unsigned int channel = 0; channel < active_channels; channel++)
+            {
+                SCOPED_TRACE(testing::Message() << "with channel = " << channel);
+
+                std::vector<counter_type> histogram(bins);
+                HIP_CHECK(hipMemcpy(histogram.data(),
+                                    d_histogram[channel],
+                                    bins * sizeof(counter_type),
+                                    hipMemcpyDeviceToHost));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(histogram, expected[channel]));
+            }
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_input));
+        }
+    }
+
+    for(unsigned int channel = 0; channel < active_channels; channel++)
+    {
+        HIP_CHECK(hipFree(d_histogram[channel]));
+    }
+}
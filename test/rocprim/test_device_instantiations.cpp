@@ -0,0 +1,311 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+// The test is linked with rocprim_instantiations, so the algorithms called with the
+// instantiated types are not instantiated here but called from the library.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_radix_sort.hpp>
+#include <rocprim/device/device_reduce.hpp>
+#include <rocprim/device/device_scan.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#ifndef ROCPRIM_USE_INSTANTIATIONS
+    #error "The test must be linked with rocprim_instantiations"
+#endif
+
+template<class T>
+class RocprimDeviceInstantiationsTests : public ::testing::Test
+{
+public:
+    using type = T;
+};
+
+typedef ::testing::Types<int, unsigned int, long long, float, double> Types;
+
+TYPED_TEST_SUITE(RocprimDeviceInstantiationsTests, Types);
+
+inline std::vector<size_t> get_instantiations_sizes()
+{
+    return {0, 1, 100, 1000, 12345, 1 << 18};
+}
+
+// Small integral values, so the sums of floating point values are exact
+template<class T>
+std::vector<T> get_integral_data(const size_t size)
+{
+    const std::vector<int> data = test_utils::get_random_data<int>(size, 0, 4, size);
+    return std::vector<T>(data.begin(), data.end());
+}
+
+template<class T>
+void check_device_output(const T* d_output, const std::vector<T>& expected)
+{
+    std::vector<T> output(expected.size());
+    HIP_CHECK(hipMemcpy(output.data(),
+                        d_output,
+                        output.size() * sizeof(T),
+                        hipMemcpyDeviceToHost));
+    ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+}
+
+TYPED_TEST(RocprimDeviceInstantiationsTests, Scan)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::type;
+
+    const hipStream_t stream = 0;
+    for(const size_t size : get_instantiations_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+        const std::vector<T> input = get_integral_data<T>(size);
+
+        std::vector<T> inclusive(size);
+        std::vector<T> exclusive(size);
+        T              sum = T(0);
+        for(size_t i = 0; i < size; i++)
+        {
+            exclusive[i] = sum;
+            sum          = sum + input[i];
+            inclusive[i] = sum;
+        }
+
+        T* d_input;
+        T* d_output;
+        const size_t alloc_size = std::max<size_t>(1, size);
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, alloc_size * sizeof(T)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, alloc_size * sizeof(T)));
+        HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+        size_t storage_size = 0;
+        HIP_CHECK(rocprim::inclusive_scan(nullptr,
+                                          storage_size,
+                                          d_input,
+                                          d_output,
+                                          size,
+                                          rocprim::plus<T>(),
+                                          stream));
+        void* d_temporary_storage;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage, storage_size));
+        HIP_CHECK(rocprim::inclusive_scan(d_temporary_storage,
+                                          storage_size,
+                                          d_input,
+                                          d_output,
+                                          size,
+                                          rocprim::plus<T>(),
+                                          stream));
+        ASSERT_NO_FATAL_FAILURE(check_device_output(d_output, inclusive));
+        HIP_CHECK(hipFree(d_temporary_storage));
+
+        storage_size = 0;
+        HIP_CHECK(rocprim::exclusive_scan(nullptr,
+                                          storage_size,
+                                          d_input,
+                                          d_output,
+                                          T(0),
+                                          size,
+                                          rocprim::plus<T>(),
+                                          stream));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage, storage_size));
+        HIP_CHECK(rocprim::exclusive_scan(d_temporary_storage,
+                                          storage_size,
+                                          d_input,
+                                          d_output,
+                                          T(0),
+                                          size,
+                                          rocprim::plus<T>(),
+                                          stream));
+        ASSERT_NO_FATAL_FAILURE(check_device_output(d_output, exclusive));
+        HIP_CHECK(hipFree(d_temporary_storage));
+
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_output));
+    }
+}
+
+TYPED_TEST(RocprimDeviceInstantiationsTests, Reduce)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::type;
+
+    const hipStream_t stream = 0;
+    for(const size_t size : get_instantiations_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+        const std::vector<T> input = get_integral_data<T>(size);
+        const T expected = std::accumulate(input.begin(), input.end(), T(10), rocprim::plus<T>());
+
+        T* d_input;
+        T* d_output;
+        const size_t alloc_size = std::max<size_t>(1, size);
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, alloc_size * sizeof(T)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(T)));
+        HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+        size_t storage_size = 0;
+        HIP_CHECK(rocprim::reduce(nullptr,
+                                  storage_size,
+                                  d_input,
+                                  d_output,
+                                  T(10),
+                                  size,
+                                  rocprim::plus<T>(),
+                                  stream));
+        void* d_temporary_storage;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage, storage_size));
+        HIP_CHECK(rocprim::reduce(d_temporary_storage,
+                                  storage_size,
+                                  d_input,
+                                  d_output,
+                                  T(10),
+                                  size,
+                                  rocprim::plus<T>(),
+                                  stream));
+        ASSERT_NO_FATAL_FAILURE(check_device_output(d_output, std::vector<T>{expected}));
+        HIP_CHECK(hipFree(d_temporary_storage));
+
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_output));
+    }
+}
+
+TYPED_TEST(RocprimDeviceInstantiationsTests, RadixSort)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type   = typename TestFixture::type;
+    using value_type = unsigned int;
+
+    const hipStream_t stream = 0;
+    for(const size_t size : get_instantiations_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+        const std::vector<key_type> keys
+            = test_utils::get_random_data<key_type>(size, 0, 1000, size);
+        std::vector<value_type> values(size);
+        std::iota(values.begin(), values.end(), 0u);
+
+        // The sort is stable, so the values of equal keys keep their order
+        std::vector<value_type> expected_values(values);
+        std::stable_sort(expected_values.begin(),
+                         expected_values.end(),
+                         [&](const value_type a, const value_type b) { return keys[a] < keys[b]; });
+        std::vector<key_type> expected_keys(size);
+        for(size_t i = 0; i < size; i++)
+        {
+            expected_keys[i] = keys[expected_values[i]];
+        }
+
+        const size_t alloc_size = std::max<size_t>(1, size);
+        key_type*   d_keys_input;
+        key_type*   d_keys_output;
+        value_type* d_values_input;
+        value_type* d_values_output;
+        const size_t key_bytes   = alloc_size * sizeof(key_type);
+        const size_t value_bytes = alloc_size * sizeof(value_type);
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, key_bytes));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, key_bytes));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input, value_bytes));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output, value_bytes));
+        HIP_CHECK(hipMemcpy(d_keys_input,
+                            keys.data(),
+                            size * sizeof(key_type),
+                            hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_values_input,
+                            values.data(),
+                            size * sizeof(value_type),
+                            hipMemcpyHostToDevice));
+
+        size_t storage_size = 0;
+        HIP_CHECK(rocprim::radix_sort_keys(nullptr,
+                                           storage_size,
+                                           d_keys_input,
+                                           d_keys_output,
+                                           size,
+                                           0,
+                                           sizeof(key_type) * 8,
+                                           stream));
+        void* d_temporary_storage;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage, storage_size));
+        HIP_CHECK(rocprim::radix_sort_keys(d_temporary_storage,
+                                           storage_size,
+                                           d_keys_input,
+                                           d_keys_output,
+                                           size,
+                                           0,
+                                           sizeof(key_type) * 8,
+                                           stream));
+        ASSERT_NO_FATAL_FAILURE(check_device_output(d_keys_output, expected_keys));
+        HIP_CHECK(hipFree(d_temporary_storage));
+
+        storage_size = 0;
+        HIP_CHECK(rocprim::radix_sort_pairs(nullptr,
+                                            storage_size,
+                                            d_keys_input,
+                                            d_keys_output,
+                                            d_values_input,
+                                            d_values_output,
+                                            size,
+                                            0,
+                                            sizeof(key_type) * 8,
+                                            stream));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage, storage_size));
+        HIP_CHECK(rocprim::radix_sort_pairs(d_temporary_storage,
+                                            storage_size,
+                                            d_keys_input,
+                                            d_keys_output,
+                                            d_values_input,
+                                            d_values_output,
+                                            size,
+                                            0,
+                                            sizeof(key_type) * 8,
+                                            stream));
+        ASSERT_NO_FATAL_FAILURE(check_device_output(d_keys_output, expected_keys));
+        ASSERT_NO_FATAL_FAILURE(check_device_output(d_values_output, expected_values));
+        HIP_CHECK(hipFree(d_temporary_storage));
+
+        HIP_CHECK(hipFree(d_keys_input));
+        HIP_CHECK(hipFree(d_keys_output));
+        HIP_CHECK(hipFree(d_values_input));
+        HIP_CHECK(hipFree(d_values_output));
+    }
+}
@@ -0,0 +1,270 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_radix_sort.hpp>
+#include <rocprim/device/device_reduce.hpp>
+#include <rocprim/device/device_scan.hpp>
+#include <rocprim/type_traits.hpp>
+
+// required test headers
+#include "test_seed.hpp"
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <vector>
+
+#if ROCPRIM_HAS_INT128_SUPPORT
+
+static_assert(rocprim::is_integral<rocprim::int128_t>::value, "");
+static_assert(rocprim::is_integral<rocprim::uint128_t>::value, "");
+static_assert(rocprim::is_signed<rocprim::int128_t>::value, "");
+static_assert(rocprim::is_unsigned<rocprim::uint128_t>::value, "");
+static_assert(!rocprim::is_unsigned<rocprim::int128_t>::value, "");
+
+template<class T>
+class RocprimDeviceInt128Tests : public ::testing::Test
+{
+public:
+    using type = T;
+};
+
+typedef ::testing::Types<rocprim::int128_t, rocprim::uint128_t> Int128Types;
+
+TYPED_TEST_SUITE(RocprimDeviceInt128Tests, Int128Types);
+
+// The generator of the test utilities does not support 128-bit integers, the values are composed
+// of two random 64-bit halves
+template<class T>
+std::vector<T> get_random_int128_data(const size_t size, const unsigned int seed_value)
+{
+    std::mt19937_64                         gen(seed_value);
+    std::uniform_int_distribution<uint64_t> distribution;
+    std::vector<T>                          data(size);
+    for(T& value : data)
+    {
+        const rocprim::uint128_t high = distribution(gen);
+        const rocprim::uint128_t low  = distribution(gen);
+        value                         = static_cast<T>((high << 64) | low);
+    }
+    return data;
+}
+
+template<class T>
+void assert_int128_eq(const std::vector<T>& output, const std::vector<T>& expected)
+{
+    ASSERT_EQ(output.size(), expected.size());
+    for(size_t i = 0; i < output.size(); i++)
+    {
+        ASSERT_TRUE(output[i] == expected[i]) << "where index = " << i;
+    }
+}
+
+TYPED_TEST(RocprimDeviceInt128Tests, RadixSortKeys)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type = typename TestFixture::type;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            for(bool descending : {false, true})
+            {
+                SCOPED_TRACE(testing::Message() << "with descending = " << descending);
+
+                const std::vector<key_type> input
+                    = get_random_int128_data<key_type>(size, seed_value);
+                std::vector<key_type> expected(input);
+                if(descending)
+                {
+                    std::sort(expected.begin(), expected.end(), std::greater<key_type>());
+                }
+                else
+                {
+                    std::sort(expected.begin(), expected.end());
+                }
+
+                key_type* d_input;
+                key_type* d_output;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(key_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(key_type)));
+                HIP_CHECK(hipMemcpy(d_input,
+                                    input.data(),
+                                    size * sizeof(key_type),
+                                    hipMemcpyHostToDevice));
+
+                size_t temporary_storage_bytes;
+                HIP_CHECK(rocprim::radix_sort_keys(nullptr,
+                                                   temporary_storage_bytes,
+                                                   d_input,
+                                                   d_output,
+                                                   size));
+
+                void* d_temporary_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                             temporary_storage_bytes));
+
+                if(descending)
+                {
+                    HIP_CHECK(rocprim::radix_sort_keys_desc(d_temporary_storage,
+                                                            temporary_storage_bytes,
+                                                            d_input,
+                                                            d_output,
+                                                            size));
+                }
+                else
+                {
+                    HIP_CHECK(rocprim::radix_sort_keys(d_temporary_storage,
+                                                       temporary_storage_bytes,
+                                                       d_input,
+                                                       d_output,
+                                                       size));
+                }
+
+                std::vector<key_type> output(size);
+                HIP_CHECK(hipMemcpy(output.data(),
+                                    d_output,
+                                    size * sizeof(key_type),
+                                    hipMemcpyDeviceToHost));
+
+                HIP_CHECK(hipFree(d_temporary_storage));
+                HIP_CHECK(hipFree(d_input));
+                HIP_CHECK(hipFree(d_output));
+
+                ASSERT_NO_FATAL_FAILURE(assert_int128_eq(output, expected));
+            }
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceInt128Tests, ReduceAndScanSum)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::type;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            if(size == 0)
+            {
+                continue;
+            }
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Values close to the 64-bit limit, so the sums overflow 64-bit accumulators
+            std::vector<T> input = get_random_int128_data<T>(size, seed_value);
+            for(T& value : input)
+            {
+                value = static_cast<T>(static_cast<rocprim::uint128_t>(value) >> 62);
+            }
+
+            std::vector<T> expected_scan(size);
+            T              sum = 0;
+            for(size_t i = 0; i < size; i++)
+            {
+                sum += input[i];
+                expected_scan[i] = sum;
+            }
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            size_t reduce_bytes;
+            HIP_CHECK(
+                rocprim::reduce(nullptr, reduce_bytes, d_input, d_output, size, rocprim::plus<T>()));
+            size_t scan_bytes;
+            HIP_CHECK(rocprim::inclusive_scan(nullptr,
+                                              scan_bytes,
+                                              d_input,
+                                              d_output,
+                                              size,
+                                              rocprim::plus<T>()));
+
+            size_t temporary_storage_bytes = std::max(reduce_bytes, scan_bytes);
+            void*  d_temporary_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                         temporary_storage_bytes));
+
+            HIP_CHECK(rocprim::reduce(d_temporary_storage,
+                                      temporary_storage_bytes,
+                                      d_input,
+                                      d_output,
+                                      size,
+                                      rocprim::plus<T>()));
+            T reduction;
+            HIP_CHECK(hipMemcpy(&reduction, d_output, sizeof(T), hipMemcpyDeviceToHost));
+            ASSERT_TRUE(reduction == sum);
+
+            // The decoupled look-back of 16-byte prefixes uses the flags and payloads of
+            // lookback_scan_state for large types
+            HIP_CHECK(rocprim::inclusive_scan(d_temporary_storage,
+                                              temporary_storage_bytes,
+                                              d_input,
+                                              d_output,
+                                              size,
+                                              rocprim::plus<T>()));
+            std::vector<T> output(size);
+            HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+
+            ASSERT_NO_FATAL_FAILURE(assert_int128_eq(output, expected_scan));
+        }
+    }
+}
+
+#else
+
+TEST(RocprimDeviceInt128Tests, NotSupported)
+{
+    GTEST_SKIP() << "128-bit integers are not supported by the compiler";
+}
+
+#endif
@@ -0,0 +1,179 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_is_sorted.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+template<class Value, class Config = rocprim::default_config>
+struct params
+{
+    using value_type = Value;
+    using config     = Config;
+};
+
+template<class Params>
+class RocprimDeviceIsSorted : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+using small_block_config
+    = rocprim::reduce_config<64, 2, rocprim::block_reduce_algorithm::raking_reduce>;
+
+// The tiles are checked by several launches of 8 tiles
+using size_limit_config
+    = rocprim::reduce_config<256, 4, rocprim::block_reduce_algorithm::default_algorithm, 8192>;
+
+typedef ::testing::Types<params<int>,
+                         params<unsigned char>,
+                         params<float>,
+                         params<double>,
+                         params<long long, small_block_config>,
+                         params<int, size_limit_config>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimDeviceIsSorted, Params);
+
+template<class Config, class T, class CompareFunction>
+void test_is_sorted(const std::vector<T>& input,
+                    CompareFunction       compare,
+                    const hipStream_t     stream)
+{
+    const bool debug_synchronous = false;
+
+    const size_t size = input.size();
+
+    T*      d_input;
+    bool*   d_sorted;
+    size_t* d_sorted_until;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, (size + 1) * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_sorted, sizeof(bool)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_sorted_until, sizeof(size_t)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+    size_t temporary_storage_bytes;
+    HIP_CHECK(rocprim::is_sorted<Config>(nullptr,
+                                         temporary_storage_bytes,
+                                         d_input,
+                                         d_sorted,
+                                         size,
+                                         compare,
+                                         stream,
+                                         debug_synchronous));
+    ASSERT_GT(temporary_storage_bytes, 0);
+    void* d_temporary_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(rocprim::is_sorted<Config>(d_temporary_storage,
+                                         temporary_storage_bytes,
+                                         d_input,
+                                         d_sorted,
+                                         size,
+                                         compare,
+                                         stream,
+                                         debug_synchronous));
+    // Both functions need the same temporary storage
+    HIP_CHECK(rocprim::is_sorted_until<Config>(d_temporary_storage,
+                                               temporary_storage_bytes,
+                                               d_input,
+                                               d_sorted_until,
+                                               size,
+                                               compare,
+                                               stream,
+                                               debug_synchronous));
+    HIP_CHECK(hipGetLastError());
+    HIP_CHECK(hipDeviceSynchronize());
+
+    bool   sorted;
+    size_t sorted_until;
+    HIP_CHECK(hipMemcpy(&sorted, d_sorted, sizeof(bool), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(&sorted_until, d_sorted_until, sizeof(size_t), hipMemcpyDeviceToHost));
+
+    const size_t expected = std::is_sorted_until(input.begin(), input.end(), compare)
+                            - input.begin();
+    ASSERT_EQ(sorted_until, expected);
+    ASSERT_EQ(sorted, expected == size);
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_sorted));
+    HIP_CHECK(hipFree(d_sorted_until));
+}
+
+TYPED_TEST(RocprimDeviceIsSorted, IsSorted)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T      = typename TestFixture::params::value_type;
+    using config = typename TestFixture::params::config;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        std::default_random_engine gen(seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<T> input = test_utils::get_random_data<T>(size, T(0), T(100), seed_value);
+            std::sort(input.begin(), input.end());
+
+            // Sorted, and sorted in the other order
+            test_is_sorted<config>(input, rocprim::less<T>(), stream);
+            test_is_sorted<config>(input, rocprim::greater<T>(), stream);
+
+            if(size < 2)
+            {
+                continue;
+            }
+
+            // Smaller items placed at random positions, the first one is the result
+            std::uniform_int_distribution<size_t> position_dis(1, size - 1);
+            for(unsigned int i = 0; i < 3; i++)
+            {
+                const size_t position = position_dis(gen);
+                input[position]       = T(0);
+                input[position - 1]   = T(100);
+                SCOPED_TRACE(testing::Message() << "with position = " << position);
+                test_is_sorted<config>(input, rocprim::less<T>(), stream);
+            }
+        }
+    }
+}
@@ -0,0 +1,269 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/block/block_load_balance.hpp>
+#include <rocprim/device/device_load_balanced_search.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+template<class Offset, class Config = rocprim::default_config>
+struct params
+{
+    using offset_type = Offset;
+    using config      = Config;
+};
+
+template<class Params>
+class RocprimDeviceLoadBalancedSearch : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<params<int>,
+                         params<unsigned int>,
+                         params<size_t>,
+                         params<int, rocprim::kernel_config<64, 3>>,
+                         params<size_t, rocprim::kernel_config<128, 1>>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimDeviceLoadBalancedSearch, Params);
+
+TYPED_TEST(RocprimDeviceLoadBalancedSearch, LoadBalancedSearch)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using offset_type = typename TestFixture::params::offset_type;
+    using config      = typename TestFixture::params::config;
+
+    const bool  debug_synchronous = false;
+    hipStream_t stream            = 0; // default
+
+    std::random_device         rd;
+    std::default_random_engine gen(rd());
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // Short maximum lengths make runs of empty segments, long ones segments that span
+        // several tiles
+        for(size_t max_segment_length : {0, 1, 4, 100, 10000})
+        {
+            SCOPED_TRACE(testing::Message() << "with max_segment_length = " << max_segment_length);
+
+            std::uniform_int_distribution<size_t> segment_length_dis(0, max_segment_length);
+
+            for(size_t segments : test_utils::get_sizes(seed_value))
+            {
+                // Keeps the number of outputs within the range of int offsets and the memory
+                if(segments == 0 || segments * max_segment_length > (size_t(1) << 24))
+                {
+                    continue;
+                }
+                SCOPED_TRACE(testing::Message() << "with segments = " << segments);
+
+                std::vector<offset_type> offsets(segments);
+                size_t                   outputs = 0;
+                for(size_t segment = 0; segment < segments; segment++)
+                {
+                    offsets[segment] = static_cast<offset_type>(outputs);
+                    outputs += segment_length_dis(gen);
+                }
+                SCOPED_TRACE(testing::Message() << "with outputs = " << outputs);
+
+                std::vector<unsigned int> expected(outputs);
+                for(size_t i = 0; i < outputs; i++)
+                {
+                    expected[i] = static_cast<unsigned int>(
+                        std::upper_bound(offsets.begin(),
+                                         offsets.end(),
+                                         static_cast<offset_type>(i))
+                        - offsets.begin() - 1);
+                }
+
+                offset_type*  d_offsets;
+                unsigned int* d_segment_ids;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_offsets,
+                                                             segments * sizeof(offset_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_segment_ids,
+                                                             (outputs + 1) * sizeof(unsigned int)));
+                HIP_CHECK(hipMemcpy(d_offsets,
+                                    offsets.data(),
+                                    segments * sizeof(offset_type),
+                                    hipMemcpyHostToDevice));
+
+                HIP_CHECK(rocprim::load_balanced_search<config>(d_offsets,
+                                                                segments,
+                                                                outputs,
+                                                                d_segment_ids,
+                                                                stream,
+                                                                debug_synchronous));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+
+                std::vector<unsigned int> output(outputs);
+                HIP_CHECK(hipMemcpy(output.data(),
+                                    d_segment_ids,
+                                    outputs * sizeof(unsigned int),
+                                    hipMemcpyDeviceToHost));
+
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+                HIP_CHECK(hipFree(d_offsets));
+                HIP_CHECK(hipFree(d_segment_ids));
+            }
+        }
+    }
+}
+
+template<unsigned int BlockSize, unsigned int ItemsPerThread>
+__global__ __launch_bounds__(BlockSize)
+void block_load_balance_kernel(const int*          segment_offsets,
+                               const unsigned int  segments,
+                               const size_t        outputs,
+                               unsigned int*       segment_ids_output,
+                               unsigned long long* tile_outputs_output)
+{
+    using block_load_balance_type = rocprim::block_load_balance<BlockSize, ItemsPerThread>;
+
+    unsigned int segment_ids[ItemsPerThread];
+    size_t       tile_output_begin;
+    unsigned int tile_outputs;
+    block_load_balance_type().search(segment_offsets,
+                                     segments,
+                                     outputs,
+                                     size_t(blockIdx.x) * block_load_balance_type::items_per_tile,
+                                     segment_ids,
+                                     tile_output_begin,
+                                     tile_outputs);
+
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        const unsigned int index = threadIdx.x * ItemsPerThread + i;
+        if(index < tile_outputs)
+        {
+            segment_ids_output[tile_output_begin + index] = segment_ids[i];
+        }
+    }
+    if(threadIdx.x == 0)
+    {
+        tile_outputs_output[blockIdx.x] = tile_outputs;
+    }
+}
+
+TEST(RocprimBlockLoadBalanceTests, TileOutputs)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    constexpr unsigned int block_size       = 64;
+    constexpr unsigned int items_per_thread = 2;
+    using block_load_balance_type = rocprim::block_load_balance<block_size, items_per_thread>;
+    constexpr unsigned int items_per_tile = block_load_balance_type::items_per_tile;
+
+    // A long segment, a run of empty segments and short segments
+    std::vector<int> offsets;
+    offsets.push_back(0);
+    for(int i = 0; i < 1000; i++)
+    {
+        offsets.push_back(500);
+    }
+    for(int i = 0; i < 300; i++)
+    {
+        offsets.push_back(500 + 3 * i);
+    }
+    const unsigned int segments = offsets.size();
+    const size_t       outputs  = 500 + 3 * 300;
+
+    const size_t path_size = block_load_balance_type::path_size(segments, outputs);
+    ASSERT_EQ(path_size, outputs + segments - 1);
+    const unsigned int blocks = (path_size + items_per_tile - 1) / items_per_tile;
+
+    int*                d_offsets;
+    unsigned int*       d_segment_ids;
+    unsigned long long* d_tile_outputs;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_offsets, segments * sizeof(int)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_segment_ids, outputs * sizeof(unsigned int)));
+    HIP_CHECK(
+        test_common_utils::hipMallocHelper(&d_tile_outputs, blocks * sizeof(unsigned long long)));
+    HIP_CHECK(
+        hipMemcpy(d_offsets, offsets.data(), segments * sizeof(int), hipMemcpyHostToDevice));
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(block_load_balance_kernel<block_size, items_per_thread>),
+                       dim3(blocks),
+                       dim3(block_size),
+                       0,
+                       0,
+                       d_offsets,
+                       segments,
+                       outputs,
+                       d_segment_ids,
+                       d_tile_outputs);
+    HIP_CHECK(hipGetLastError());
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int>       output(outputs);
+    std::vector<unsigned long long> tile_outputs(blocks);
+    HIP_CHECK(hipMemcpy(output.data(),
+                        d_segment_ids,
+                        outputs * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(tile_outputs.data(),
+                        d_tile_outputs,
+                        blocks * sizeof(unsigned long long),
+                        hipMemcpyDeviceToHost));
+
+    for(size_t i = 0; i < outputs; i++)
+    {
+        const unsigned int expected
+            = std::upper_bound(offsets.begin(), offsets.end(), static_cast<int>(i))
+              - offsets.begin() - 1;
+        ASSERT_EQ(output[i], expected) << "where index = " << i;
+    }
+
+    // Every tile has at most items_per_tile outputs and the tiles cover all outputs
+    unsigned long long total_outputs = 0;
+    for(unsigned int block = 0; block < blocks; block++)
+    {
+        ASSERT_LE(tile_outputs[block], items_per_tile);
+        total_outputs += tile_outputs[block];
+    }
+    ASSERT_EQ(total_outputs, outputs);
+
+    HIP_CHECK(hipFree(d_offsets));
+    HIP_CHECK(hipFree(d_segment_ids));
+    HIP_CHECK(hipFree(d_tile_outputs));
+}
@@ -27,6 +27,7 @@
 // required rocprim headers
 #include <rocprim/device/device_merge.hpp>
 #include <rocprim/functional.hpp>
+#include <rocprim/iterator/constant_iterator.hpp>
 #include <rocprim/iterator/counting_iterator.hpp>
 #include <rocprim/iterator/transform_iterator.hpp>
 
@@ -521,3 +522,76 @@ TEST(RocprimDeviceMergeTests, MergeMismatchedIteratorTypes)
     HIP_CHECK(hipFree(d_keys_output));
     HIP_CHECK(hipFree(d_keys_input1));
 }
+
+// Inputs of more than 2^32 keys in total are merged with 64-bit partitions
+TEST(RocprimDeviceMergeTests, MergeKeyOver4G)
+{
+    const int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type                          = uint8_t;
+    constexpr size_t      input1_size       = (1ull << 31) + 32;
+    constexpr size_t      input2_size       = (1ull << 31) + 48;
+    constexpr size_t      size              = input1_size + input2_size;
+    static constexpr bool debug_synchronous = false;
+
+    // All keys of the first input are ordered before the keys of the second input
+    const auto d_keys_input1 = rocprim::make_constant_iterator<key_type>(1);
+    const auto d_keys_input2 = rocprim::make_constant_iterator<key_type>(2);
+
+    size_t temp_storage_size_bytes = 0;
+    HIP_CHECK(rocprim::merge(nullptr,
+                             temp_storage_size_bytes,
+                             d_keys_input1,
+                             d_keys_input2,
+                             static_cast<key_type*>(nullptr),
+                             input1_size,
+                             input2_size,
+                             rocprim::less<key_type>{},
+                             hipStreamDefault,
+                             debug_synchronous));
+    ASSERT_GT(temp_storage_size_bytes, 0);
+
+    hipDeviceProp_t prop;
+    HIP_CHECK(hipGetDeviceProperties(&prop, device_id));
+    const size_t total_storage_bytes = size * sizeof(key_type) + temp_storage_size_bytes;
+    if(total_storage_bytes > prop.totalGlobalMem)
+    {
+        GTEST_SKIP() << "Test case device memory requirement (" << total_storage_bytes
+                     << " bytes) exceeds available memory on current device ("
+                     << prop.totalGlobalMem << " bytes). Skipping test";
+    }
+
+    key_type* d_keys_output  = nullptr;
+    void*     d_temp_storage = nullptr;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(key_type)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+    HIP_CHECK(rocprim::merge(d_temp_storage,
+                             temp_storage_size_bytes,
+                             d_keys_input1,
+                             d_keys_input2,
+                             d_keys_output,
+                             input1_size,
+                             input2_size,
+                             rocprim::less<key_type>{},
+                             hipStreamDefault,
+                             debug_synchronous));
+    HIP_CHECK(hipGetLastError());
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<key_type> keys_output(size);
+    HIP_CHECK(hipMemcpy(keys_output.data(),
+                        d_keys_output,
+                        size * sizeof(key_type),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(d_temp_storage));
+    HIP_CHECK(hipFree(d_keys_output));
+
+    ASSERT_EQ(keys_output[input1_size - 1], 1);
+    ASSERT_EQ(keys_output[input1_size], 2);
+    ASSERT_EQ(static_cast<size_t>(std::count(keys_output.begin(), keys_output.end(), key_type(1))),
+              input1_size);
+    ASSERT_TRUE(std::is_sorted(keys_output.begin(), keys_output.end()));
+}
@@ -0,0 +1,294 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_merge_k.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+template<class Key, class Value, class CompareFunction = ::rocprim::less<Key>>
+struct params
+{
+    using key_type         = Key;
+    using value_type       = Value;
+    using compare_function = CompareFunction;
+};
+
+template<class Params>
+class RocprimDeviceMergeK : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<params<int, int>,
+                         params<unsigned long long, int, ::rocprim::greater<unsigned long long>>,
+                         params<float, double>,
+                         params<short, long long>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimDeviceMergeK, Params);
+
+struct merge_k_input
+{
+    std::vector<size_t> run_sizes;
+    std::vector<size_t> run_offsets;
+};
+
+// Runs of random sizes, some of them empty
+inline merge_k_input
+    get_merge_k_input(const size_t size, const unsigned int runs, const unsigned int seed_value)
+{
+    merge_k_input input;
+    std::vector<size_t> bounds
+        = test_utils::get_random_data<size_t>(runs - 1, 0, size, seed_value);
+    bounds.push_back(0);
+    bounds.push_back(size);
+    std::sort(bounds.begin(), bounds.end());
+    for(unsigned int run = 0; run < runs; run++)
+    {
+        input.run_offsets.push_back(bounds[run]);
+        input.run_sizes.push_back(bounds[run + 1] - bounds[run]);
+    }
+    return input;
+}
+
+TYPED_TEST(RocprimDeviceMergeK, MergeK)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type         = typename TestFixture::params::key_type;
+    using value_type       = typename TestFixture::params::value_type;
+    using compare_function = typename TestFixture::params::compare_function;
+
+    hipStream_t stream = 0;
+
+    const bool debug_synchronous = false;
+
+    compare_function compare_op;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            for(unsigned int runs : {1u, 2u, 5u, 64u, 256u})
+            {
+                SCOPED_TRACE(testing::Message() << "with runs = " << runs);
+
+                const merge_k_input input = get_merge_k_input(size, runs, seed_value);
+
+                // Few distinct keys, so equal keys are in many runs
+                std::vector<key_type> keys_input
+                    = test_utils::get_random_data<key_type>(size, 0, 100, seed_value);
+                std::vector<value_type> values_input(size);
+                test_utils::iota(values_input.begin(), values_input.end(), 0);
+                for(unsigned int run = 0; run < runs; run++)
+                {
+                    const auto first = keys_input.begin() + input.run_offsets[run];
+                    std::sort(first, first + input.run_sizes[run], compare_op);
+                }
+
+                // Values are the indices of the keys, a stable sort gives the merged order
+                using key_value = std::pair<key_type, value_type>;
+                std::vector<key_value> expected(size);
+                for(size_t i = 0; i < size; i++)
+                {
+                    expected[i] = key_value(keys_input[i], values_input[i]);
+                }
+                std::stable_sort(expected.begin(),
+                                 expected.end(),
+                                 [compare_op](const key_value& a, const key_value& b)
+                                 { return compare_op(a.first, b.first); });
+                std::vector<key_type>   keys_expected(size);
+                std::vector<value_type> values_expected(size);
+                for(size_t i = 0; i < size; i++)
+                {
+                    keys_expected[i]   = expected[i].first;
+                    values_expected[i] = expected[i].second;
+                }
+
+                key_type*    d_keys_input;
+                key_type*    d_keys_output;
+                value_type*  d_values_input;
+                value_type*  d_values_output;
+                key_type**   d_keys_inputs;
+                value_type** d_values_inputs;
+                size_t*      d_run_sizes;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(key_type)));
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_values_input, size * sizeof(value_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output,
+                                                             size * sizeof(value_type)));
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_keys_inputs, runs * sizeof(key_type*)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_inputs,
+                                                             runs * sizeof(value_type*)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_run_sizes, runs * sizeof(size_t)));
+
+                std::vector<key_type*>   keys_inputs(runs);
+                std::vector<value_type*> values_inputs(runs);
+                for(unsigned int run = 0; run < runs; run++)
+                {
+                    keys_inputs[run]   = d_keys_input + input.run_offsets[run];
+                    values_inputs[run] = d_values_input + input.run_offsets[run];
+                }
+
+                HIP_CHECK(hipMemcpy(d_keys_input,
+                                    keys_input.data(),
+                                    size * sizeof(key_type),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_values_input,
+                                    values_input.data(),
+                                    size * sizeof(value_type),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_keys_inputs,
+                                    keys_inputs.data(),
+                                    runs * sizeof(key_type*),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_values_inputs,
+                                    values_inputs.data(),
+                                    runs * sizeof(value_type*),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_run_sizes,
+                                    input.run_sizes.data(),
+                                    runs * sizeof(size_t),
+                                    hipMemcpyHostToDevice));
+
+                for(bool with_values : {false, true})
+                {
+                    SCOPED_TRACE(testing::Message() << "with with_values = " << with_values);
+
+                    size_t temporary_storage_bytes;
+                    HIP_CHECK(rocprim::merge_k(nullptr,
+                                               temporary_storage_bytes,
+                                               d_keys_inputs,
+                                               d_keys_output,
+                                               d_run_sizes,
+                                               runs,
+                                               size,
+                                               compare_op));
+
+                    // temp_storage_size_bytes must be >0
+                    ASSERT_GT(temporary_storage_bytes, 0);
+
+                    void* d_temporary_storage;
+                    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                                 temporary_storage_bytes));
+
+                    if(with_values)
+                    {
+                        HIP_CHECK(rocprim::merge_k(d_temporary_storage,
+                                                   temporary_storage_bytes,
+                                                   d_keys_inputs,
+                                                   d_keys_output,
+                                                   d_values_inputs,
+                                                   d_values_output,
+                                                   d_run_sizes,
+                                                   runs,
+                                                   size,
+                                                   compare_op,
+                                                   stream,
+                                                   debug_synchronous));
+                    }
+                    else
+                    {
+                        HIP_CHECK(rocprim::merge_k(d_temporary_storage,
+                                                   temporary_storage_bytes,
+                                                   d_keys_inputs,
+                                                   d_keys_output,
+                                                   d_run_sizes,
+                                                   runs,
+                                                   size,
+                                                   compare_op,
+                                                   stream,
+                                                   debug_synchronous));
+                    }
+
+                    std::vector<key_type> keys_output(size);
+                    HIP_CHECK(hipMemcpy(keys_output.data(),
+                                        d_keys_output,
+                                        size * sizeof(key_type),
+                                        hipMemcpyDeviceToHost));
+
+                    HIP_CHECK(hipFree(d_temporary_storage));
+
+                    ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, keys_expected));
+
+                    if(with_values)
+                    {
+                        std::vector<value_type> values_output(size);
+                        HIP_CHECK(hipMemcpy(values_output.data(),
+                                            d_values_output,
+                                            size * sizeof(value_type),
+                                            hipMemcpyDeviceToHost));
+
+                        ASSERT_NO_FATAL_FAILURE(
+                            test_utils::assert_eq(values_output, values_expected));
+                    }
+                }
+
+                HIP_CHECK(hipFree(d_keys_input));
+                HIP_CHECK(hipFree(d_keys_output));
+                HIP_CHECK(hipFree(d_values_input));
+                HIP_CHECK(hipFree(d_values_output));
+                HIP_CHECK(hipFree(d_keys_inputs));
+                HIP_CHECK(hipFree(d_values_inputs));
+                HIP_CHECK(hipFree(d_run_sizes));
+            }
+        }
+    }
+}
+
+TEST(RocprimDeviceMergeKTests, TooManyRuns)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    int**   keys_inputs = nullptr;
+    int*    keys_output = nullptr;
+    size_t* run_sizes   = nullptr;
+
+    size_t temporary_storage_bytes;
+    ASSERT_EQ(rocprim::merge_k(nullptr,
+                               temporary_storage_bytes,
+                               keys_inputs,
+                               keys_output,
+                               run_sizes,
+                               257u,
+                               size_t(1000)),
+              hipErrorInvalidValue);
+}
@@ -25,6 +25,8 @@
 // required rocprim headers
 #include <rocprim/functional.hpp>
 #include <rocprim/device/device_merge_sort.hpp>
+#include <rocprim/iterator/counting_iterator.hpp>
+#include <rocprim/iterator/transform_iterator.hpp>
 
 // required test headers
 #include "test_utils_custom_float_type.hpp"
@@ -34,13 +36,15 @@
 template<
     class KeyType,
     class ValueType = KeyType,
-    class CompareFunction = ::rocprim::less<KeyType>
+    class CompareFunction = ::rocprim::less<KeyType>,
+    class Config = ::rocprim::default_config
 >
 struct DeviceSortParams
 {
     using key_type = KeyType;
     using value_type = ValueType;
     using compare_function = CompareFunction;
+    using config = Config;
 };
 
 // ---------------------------------------------------------
@@ -54,6 +58,7 @@ public:
     using key_type = typename Params::key_type;
     using value_type = typename Params::value_type;
     using compare_function = typename Params::compare_function;
+    using config = typename Params::config;
     const bool debug_synchronous = false;
 };
 
@@ -74,7 +79,49 @@ using RocprimDeviceSortTestsParams = ::testing::Types<
     DeviceSortParams<double, test_utils::custom_test_type<double>>,
     DeviceSortParams<test_utils::custom_test_type<float>, test_utils::custom_test_type<double>>,
     DeviceSortParams<int, test_utils::custom_float_type>,
-    DeviceSortParams<test_utils::custom_test_array_type<int, 4>>>;
+    DeviceSortParams<test_utils::custom_test_array_type<int, 4>>,
+    // Large values are sorted indirectly through indices
+    DeviceSortParams<unsigned int, test_utils::custom_test_array_type<long long, 16>>,
+    // The stable block merge sort in the block-sort step, with items per thread that are not
+    // a power of two and with many items per thread
+    DeviceSortParams<int,
+                     int,
+                     ::rocprim::less<int>,
+                     rocprim::merge_sort_config<768,
+                                                256,
+                                                6,
+                                                128,
+                                                128,
+                                                12,
+                                                200000,
+                                                32,
+                                                rocprim::block_sort_algorithm::merge_sort>>,
+    DeviceSortParams<double,
+                     double,
+                     ::rocprim::greater<double>,
+                     rocprim::merge_sort_config<256,
+                                                128,
+                                                32,
+                                                128,
+                                                128,
+                                                32,
+                                                200000,
+                                                32,
+                                                rocprim::block_sort_algorithm::merge_sort>>,
+    // Natural merge sort of the sorted runs
+    DeviceSortParams<int,
+                     int,
+                     ::rocprim::less<int>,
+                     rocprim::merge_sort_config<512,
+                                                256,
+                                                4,
+                                                128,
+                                                128,
+                                                8,
+                                                0,
+                                                32,
+                                                rocprim::block_sort_algorithm::default_algorithm,
+                                                true>>>;
 
 static_assert(std::is_trivially_copyable<test_utils::custom_float_type>::value,
               "Type must be trivially copyable to cover merge sort specialized kernel");
@@ -89,6 +136,7 @@ TYPED_TEST(RocprimDeviceSortTests, SortKey)
 
     using key_type = typename TestFixture::key_type;
     using compare_function = typename TestFixture::compare_function;
+    using config = typename TestFixture::config;
     const bool debug_synchronous = TestFixture::debug_synchronous;
 
     bool in_place = false;
@@ -146,7 +194,7 @@ TYPED_TEST(RocprimDeviceSortTests, SortKey)
             void * d_temp_storage = nullptr;
             // Get size of d_temp_storage
             HIP_CHECK(
-                rocprim::merge_sort(
+                rocprim::merge_sort<config>(
                     d_temp_storage, temp_storage_size_bytes,
                     d_input, d_output, input.size(),
                     compare_op, stream, debug_synchronous
@@ -162,7 +210,7 @@ TYPED_TEST(RocprimDeviceSortTests, SortKey)
 
             // Run
             HIP_CHECK(
-                rocprim::merge_sort(
+                rocprim::merge_sort<config>(
                     d_temp_storage, temp_storage_size_bytes,
                     d_input, d_output, input.size(),
                     compare_op, stream, debug_synchronous
@@ -204,6 +252,7 @@ TYPED_TEST(RocprimDeviceSortTests, SortKeyValue)
     using key_type = typename TestFixture::key_type;
     using value_type = typename TestFixture::value_type;
     using compare_function = typename TestFixture::compare_function;
+    using config = typename TestFixture::config;
     const bool debug_synchronous = TestFixture::debug_synchronous;
 
     bool in_place = false;
@@ -291,7 +340,7 @@ TYPED_TEST(RocprimDeviceSortTests, SortKeyValue)
             void * d_temp_storage = nullptr;
             // Get size of d_temp_storage
             HIP_CHECK(
-                rocprim::merge_sort(
+                rocprim::merge_sort<config>(
                     d_temp_storage, temp_storage_size_bytes,
                     d_keys_input, d_keys_output,
                     d_values_input, d_values_output, keys_input.size(),
@@ -308,7 +357,7 @@ TYPED_TEST(RocprimDeviceSortTests, SortKeyValue)
 
             // Run
             HIP_CHECK(
-                rocprim::merge_sort(
+                rocprim::merge_sort<config>(
                     d_temp_storage, temp_storage_size_bytes,
                     d_keys_input, d_keys_output,
                     d_values_input, d_values_output, keys_input.size(),
@@ -359,3 +408,487 @@ TYPED_TEST(RocprimDeviceSortTests, SortKeyValue)
     }
 
 }
+
+// Inputs made of sorted runs, which are merged by the natural merge sort. The ties are sorted by
+// the values to check that the sort is stable.
+TEST(RocprimDeviceSortTests, SortKeyValueSortedRuns)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type   = int;
+    using value_type = unsigned int;
+    // The merge step uses mergepath already for small inputs
+    using config = rocprim::merge_sort_config<512,
+                                              256,
+                                              4,
+                                              128,
+                                              128,
+                                              8,
+                                              0,
+                                              32,
+                                              rocprim::block_sort_algorithm::default_algorithm,
+                                              true>;
+    const bool  debug_synchronous = false;
+    hipStream_t stream            = 0; // default
+
+    const std::vector<size_t>      sizes = {1, 1000, 1024, 5000, 100000, (1 << 20) + 123};
+    const std::vector<const char*> patterns
+        = {"sorted", "reverse_sorted", "runs", "almost_sorted"};
+    for(size_t size : sizes)
+    {
+        SCOPED_TRACE(testing::Message() << "with size = " << size);
+        for(const char* pattern : patterns)
+        {
+            SCOPED_TRACE(testing::Message() << "with pattern = " << pattern);
+
+            const std::string     name = pattern;
+            std::vector<key_type> keys_input(size);
+            if(name == "sorted")
+            {
+                for(size_t i = 0; i < size; i++)
+                {
+                    keys_input[i] = static_cast<key_type>(i / 3);
+                }
+            }
+            else if(name == "reverse_sorted")
+            {
+                for(size_t i = 0; i < size; i++)
+                {
+                    keys_input[i] = static_cast<key_type>((size - i) / 3);
+                }
+            }
+            else if(name == "runs")
+            {
+                // 7 sorted runs of different lengths and overlapping ranges of keys
+                for(size_t i = 0; i < size; i++)
+                {
+                    const size_t run = i * 7 / size;
+                    keys_input[i] = static_cast<key_type>(run * 11 + (i - run * size / 7) / 2);
+                }
+            }
+            else
+            {
+                for(size_t i = 0; i < size; i++)
+                {
+                    keys_input[i] = static_cast<key_type>(i);
+                }
+                for(size_t i = 1; i < size; i += 4093)
+                {
+                    std::swap(keys_input[i - 1], keys_input[i]);
+                }
+            }
+
+            std::vector<value_type> values_input(size);
+            test_utils::iota(values_input.begin(), values_input.end(), 0);
+
+            key_type*   d_keys_input;
+            key_type*   d_keys_output;
+            value_type* d_values_input;
+            value_type* d_values_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(key_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_values_input, size * sizeof(value_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_values_output, size * sizeof(value_type)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values_input,
+                                values_input.data(),
+                                size * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+
+            // Calculate expected results on host
+            using key_value = std::pair<key_type, value_type>;
+            std::vector<key_value> expected(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                expected[i] = key_value(keys_input[i], values_input[i]);
+            }
+            std::stable_sort(expected.begin(),
+                             expected.end(),
+                             [](const key_value& a, const key_value& b)
+                             { return a.first < b.first; });
+
+            size_t temp_storage_size_bytes;
+            void*  d_temp_storage = nullptr;
+            HIP_CHECK(rocprim::merge_sort<config>(d_temp_storage,
+                                                  temp_storage_size_bytes,
+                                                  d_keys_input,
+                                                  d_keys_output,
+                                                  d_values_input,
+                                                  d_values_output,
+                                                  size,
+                                                  ::rocprim::less<key_type>(),
+                                                  stream,
+                                                  debug_synchronous));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            HIP_CHECK(rocprim::merge_sort<config>(d_temp_storage,
+                                                  temp_storage_size_bytes,
+                                                  d_keys_input,
+                                                  d_keys_output,
+                                                  d_values_input,
+                                                  d_values_output,
+                                                  size,
+                                                  ::rocprim::less<key_type>(),
+                                                  stream,
+                                                  debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<key_type>   keys_output(size);
+            std::vector<value_type> values_output(size);
+            HIP_CHECK(hipMemcpy(keys_output.data(),
+                                d_keys_output,
+                                size * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(values_output.data(),
+                                d_values_output,
+                                size * sizeof(value_type),
+                                hipMemcpyDeviceToHost));
+
+            std::vector<key_type>   expected_key(size);
+            std::vector<value_type> expected_value(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                expected_key[i]   = expected[i].first;
+                expected_value[i] = expected[i].second;
+            }
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, expected_key));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, expected_value));
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_values_output));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
+
+// Keys with few distinct values give long runs of equal keys in both merged blocks. The values
+// are the positions of the keys to check that the ties are merged stably.
+template<class Config>
+void sort_key_value_few_unique()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type                = int;
+    using value_type              = unsigned int;
+    const bool  debug_synchronous = false;
+    hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(const key_type max_key : {0, 2, 9})
+        {
+            SCOPED_TRACE(testing::Message() << "with max_key = " << max_key);
+            for(size_t size : test_utils::get_sizes(seed_value))
+            {
+                SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+                std::vector<key_type> keys_input
+                    = test_utils::get_random_data<key_type>(size, 0, max_key, seed_value);
+                std::vector<value_type> values_input(size);
+                test_utils::iota(values_input.begin(), values_input.end(), 0);
+
+                key_type*   d_keys_input;
+                key_type*   d_keys_output;
+                value_type* d_values_input;
+                value_type* d_values_output;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(key_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input,
+                                                             size * sizeof(value_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output,
+                                                             size * sizeof(value_type)));
+                HIP_CHECK(hipMemcpy(d_keys_input,
+                                    keys_input.data(),
+                                    size * sizeof(key_type),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_values_input,
+                                    values_input.data(),
+                                    size * sizeof(value_type),
+                                    hipMemcpyHostToDevice));
+
+                // Calculate expected results on host
+                using key_value = std::pair<key_type, value_type>;
+                std::vector<key_value> expected(size);
+                for(size_t i = 0; i < size; i++)
+                {
+                    expected[i] = key_value(keys_input[i], values_input[i]);
+                }
+                std::stable_sort(expected.begin(),
+                                 expected.end(),
+                                 [](const key_value& a, const key_value& b)
+                                 { return a.first < b.first; });
+
+                size_t temp_storage_size_bytes;
+                void*  d_temp_storage = nullptr;
+                HIP_CHECK(rocprim::merge_sort<Config>(d_temp_storage,
+                                                      temp_storage_size_bytes,
+                                                      d_keys_input,
+                                                      d_keys_output,
+                                                      d_values_input,
+                                                      d_values_output,
+                                                      size,
+                                                      ::rocprim::less<key_type>(),
+                                                      stream,
+                                                      debug_synchronous));
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+                HIP_CHECK(rocprim::merge_sort<Config>(d_temp_storage,
+                                                      temp_storage_size_bytes,
+                                                      d_keys_input,
+                                                      d_keys_output,
+                                                      d_values_input,
+                                                      d_values_output,
+                                                      size,
+                                                      ::rocprim::less<key_type>(),
+                                                      stream,
+                                                      debug_synchronous));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+
+                std::vector<key_type>   keys_output(size);
+                std::vector<value_type> values_output(size);
+                HIP_CHECK(hipMemcpy(keys_output.data(),
+                                    d_keys_output,
+                                    size * sizeof(key_type),
+                                    hipMemcpyDeviceToHost));
+                HIP_CHECK(hipMemcpy(values_output.data(),
+                                    d_values_output,
+                                    size * sizeof(value_type),
+                                    hipMemcpyDeviceToHost));
+
+                std::vector<key_type>   expected_key(size);
+                std::vector<value_type> expected_value(size);
+                for(size_t i = 0; i < size; i++)
+                {
+                    expected_key[i]   = expected[i].first;
+                    expected_value[i] = expected[i].second;
+                }
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, expected_key));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, expected_value));
+
+                HIP_CHECK(hipFree(d_keys_input));
+                HIP_CHECK(hipFree(d_keys_output));
+                HIP_CHECK(hipFree(d_values_input));
+                HIP_CHECK(hipFree(d_values_output));
+                HIP_CHECK(hipFree(d_temp_storage));
+            }
+        }
+    }
+}
+
+TEST(RocprimDeviceSortTests, SortKeyValueFewUnique)
+{
+    sort_key_value_few_unique<rocprim::default_config>();
+}
+
+// The odd-even block merge is used for all sizes
+TEST(RocprimDeviceSortTests, SortKeyValueFewUniqueBlockMerge)
+{
+    sort_key_value_few_unique<rocprim::merge_sort_config<512, 256, 4, 128, 128, 8, (1u << 30)>>();
+}
+
+// The mergepath merge is used for all sizes
+TEST(RocprimDeviceSortTests, SortKeyValueFewUniqueMergepath)
+{
+    sort_key_value_few_unique<rocprim::merge_sort_config<512, 256, 4, 128, 128, 8, 0>>();
+}
+
+// The permutation of a stable sort, the indices are generated by the sort
+TEST(RocprimDeviceSortTests, Argsort)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type                = int;
+    using index_type              = unsigned int;
+    const bool  debug_synchronous = false;
+    hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Few distinct keys, so the order of the ties is checked
+            std::vector<key_type> keys_input
+                = test_utils::get_random_data<key_type>(size, -100, 100, seed_value);
+
+            key_type*   d_keys_input;
+            key_type*   d_keys_output;
+            index_type* d_indices_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(key_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_indices_output, size * sizeof(index_type)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+
+            std::vector<index_type> expected_indices(size);
+            test_utils::iota(expected_indices.begin(), expected_indices.end(), 0);
+            std::stable_sort(expected_indices.begin(),
+                             expected_indices.end(),
+                             [&](const index_type a, const index_type b)
+                             { return keys_input[a] < keys_input[b]; });
+            std::vector<key_type> expected_keys(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                expected_keys[i] = keys_input[expected_indices[i]];
+            }
+
+            size_t temp_storage_size_bytes;
+            void*  d_temp_storage = nullptr;
+            HIP_CHECK(rocprim::merge_sort_argsort(d_temp_storage,
+                                                  temp_storage_size_bytes,
+                                                  d_keys_input,
+                                                  d_keys_output,
+                                                  d_indices_output,
+                                                  size,
+                                                  ::rocprim::less<key_type>(),
+                                                  stream,
+                                                  debug_synchronous));
+            ASSERT_GT(temp_storage_size_bytes, 0);
+
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(rocprim::merge_sort_argsort(d_temp_storage,
+                                                  temp_storage_size_bytes,
+                                                  d_keys_input,
+                                                  d_keys_output,
+                                                  d_indices_output,
+                                                  size,
+                                                  ::rocprim::less<key_type>(),
+                                                  stream,
+                                                  debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<key_type>   keys_output(size);
+            std::vector<index_type> indices_output(size);
+            HIP_CHECK(hipMemcpy(keys_output.data(),
+                                d_keys_output,
+                                size * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(indices_output.data(),
+                                d_indices_output,
+                                size * sizeof(index_type),
+                                hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, expected_keys));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(indices_output, expected_indices));
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_indices_output));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
+
+struct low_byte_op
+{
+    ROCPRIM_HOST_DEVICE inline
+    uint8_t operator()(const size_t i) const
+    {
+        return static_cast<uint8_t>(i & 0xFF);
+    }
+};
+
+// Inputs of more than 2^32 keys are sorted with 64-bit offsets
+TEST(RocprimDeviceSortTests, SortKeyOver4G)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type                   = uint8_t;
+    constexpr size_t size            = (1ull << 32) + 32;
+    constexpr size_t possible_keys   = 256;
+    const bool       debug_synchronous = false;
+    hipStream_t      stream            = 0; // default
+
+    // The keys are 0, 1, ..., 255, 0, 1, ..., so every key is in every sorted block
+    const auto keys_input = rocprim::make_transform_iterator(rocprim::counting_iterator<size_t>(0),
+                                                             low_byte_op{});
+
+    size_t temp_storage_size_bytes;
+    HIP_CHECK(rocprim::merge_sort(nullptr,
+                                  temp_storage_size_bytes,
+                                  keys_input,
+                                  static_cast<key_type*>(nullptr),
+                                  size,
+                                  ::rocprim::less<key_type>(),
+                                  stream,
+                                  debug_synchronous));
+    ASSERT_GT(temp_storage_size_bytes, 0);
+
+    hipDeviceProp_t prop;
+    HIP_CHECK(hipGetDeviceProperties(&prop, device_id));
+    const size_t total_storage_bytes = size * sizeof(key_type) + temp_storage_size_bytes;
+    if(total_storage_bytes > prop.totalGlobalMem)
+    {
+        GTEST_SKIP() << "Test case device memory requirement (" << total_storage_bytes
+                     << " bytes) exceeds available memory on current device ("
+                     << prop.totalGlobalMem << " bytes). Skipping test";
+    }
+
+    key_type* d_keys_output;
+    void*     d_temp_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(key_type)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+    HIP_CHECK(rocprim::merge_sort(d_temp_storage,
+                                  temp_storage_size_bytes,
+                                  keys_input,
+                                  d_keys_output,
+                                  size,
+                                  ::rocprim::less<key_type>(),
+                                  stream,
+                                  debug_synchronous));
+    HIP_CHECK(hipGetLastError());
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<key_type> keys_output(size);
+    HIP_CHECK(hipMemcpy(keys_output.data(),
+                        d_keys_output,
+                        size * sizeof(key_type),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(d_keys_output));
+    HIP_CHECK(hipFree(d_temp_storage));
+
+    // Each key is in the input size / 256 times, the first size % 256 keys once more
+    size_t expected_end = 0;
+    for(size_t key = 0; key < possible_keys; key++)
+    {
+        const size_t expected_begin = expected_end;
+        expected_end += size / possible_keys + (key < size % possible_keys ? 1 : 0);
+        ASSERT_EQ(keys_output[expected_begin], key) << "at index " << expected_begin;
+        ASSERT_EQ(keys_output[expected_end - 1], key) << "at index " << expected_end - 1;
+    }
+    ASSERT_TRUE(std::is_sorted(keys_output.begin(), keys_output.end()));
+}
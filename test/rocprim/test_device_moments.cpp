@@ -0,0 +1,331 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_moments.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <cmath>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+template<class Value, class Config = rocprim::default_config>
+struct params
+{
+    using value_type = Value;
+    using config     = Config;
+};
+
+template<class Params>
+class RocprimDeviceMoments : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+template<rocprim::segmented_reduce_algorithm Algorithm>
+using segmented_config = rocprim::reduce_config<256,
+                                                4,
+                                                rocprim::block_reduce_algorithm::default_algorithm,
+                                                ROCPRIM_GRID_SIZE_LIMIT,
+                                                false,
+                                                Algorithm>;
+
+using small_block_config
+    = rocprim::reduce_config<64, 2, rocprim::block_reduce_algorithm::raking_reduce>;
+
+typedef ::testing::Types<
+    params<float>,
+    params<double>,
+    params<int>,
+    params<unsigned char>,
+    params<float, small_block_config>,
+    params<float, segmented_config<rocprim::segmented_reduce_algorithm::thread_per_segment>>,
+    params<double, segmented_config<rocprim::segmented_reduce_algorithm::warp_per_segment>>,
+    params<int, segmented_config<rocprim::segmented_reduce_algorithm::block_per_segment>>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimDeviceMoments, Params);
+
+// Two-pass mean and sum of squared deviations in double
+template<class T>
+rocprim::moments_result<double>
+    get_expected(const std::vector<T>& input, const size_t begin, const size_t end)
+{
+    rocprim::moments_result<double> expected{end - begin, 0.0, 0.0};
+    if(begin == end)
+    {
+        return expected;
+    }
+    for(size_t i = begin; i < end; i++)
+    {
+        expected.mean += static_cast<double>(input[i]);
+    }
+    expected.mean /= static_cast<double>(end - begin);
+    for(size_t i = begin; i < end; i++)
+    {
+        const double deviation = static_cast<double>(input[i]) - expected.mean;
+        expected.m2 += deviation * deviation;
+    }
+    return expected;
+}
+
+template<class A>
+void assert_moments_near(const rocprim::moments_result<A>&      output,
+                         const rocprim::moments_result<double>& expected)
+{
+    // The combination is stable, the error grows with the magnitude of the values and
+    // logarithmically with the count
+    const double precision = std::is_same<A, double>::value ? 1e-10 : 1e-3;
+    ASSERT_EQ(output.count, expected.count);
+    ASSERT_NEAR(output.mean, expected.mean, precision * (1.0 + std::abs(expected.mean)));
+    ASSERT_NEAR(output.m2, expected.m2, precision * (1.0 + expected.m2));
+}
+
+template<class Config, class T>
+void test_moments(const std::vector<T>& input, const hipStream_t stream)
+{
+    using accumulator_type = typename std::conditional<std::is_same<T, double>::value,
+                                                       double,
+                                                       float>::type;
+    using output_type      = rocprim::moments_result<accumulator_type>;
+
+    const bool debug_synchronous = false;
+
+    const size_t size = input.size();
+
+    T*           d_input;
+    output_type* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, (size + 1) * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(output_type)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+    size_t temporary_storage_bytes;
+    HIP_CHECK(rocprim::moments<Config>(nullptr,
+                                       temporary_storage_bytes,
+                                       d_input,
+                                       d_output,
+                                       size,
+                                       stream,
+                                       debug_synchronous));
+    ASSERT_GT(temporary_storage_bytes, 0);
+    void* d_temporary_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(rocprim::moments<Config>(d_temporary_storage,
+                                       temporary_storage_bytes,
+                                       d_input,
+                                       d_output,
+                                       size,
+                                       stream,
+                                       debug_synchronous));
+    HIP_CHECK(hipGetLastError());
+    HIP_CHECK(hipDeviceSynchronize());
+
+    output_type output;
+    HIP_CHECK(hipMemcpy(&output, d_output, sizeof(output_type), hipMemcpyDeviceToHost));
+
+    assert_moments_near(output, get_expected(input, 0, size));
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
+
+template<class Config, class T>
+void test_segmented_moments(const std::vector<T>&            input,
+                            const std::vector<unsigned int>& offsets,
+                            const hipStream_t                stream)
+{
+    using accumulator_type = typename std::conditional<std::is_same<T, double>::value,
+                                                       double,
+                                                       float>::type;
+    using output_type      = rocprim::moments_result<accumulator_type>;
+
+    const bool debug_synchronous = false;
+
+    const size_t       size     = input.size();
+    const unsigned int segments = offsets.size() - 1;
+
+    T*            d_input;
+    output_type*  d_output;
+    unsigned int* d_offsets;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, (size + 1) * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, (segments + 1) * sizeof(output_type)));
+    HIP_CHECK(
+        test_common_utils::hipMallocHelper(&d_offsets, offsets.size() * sizeof(unsigned int)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemcpy(d_offsets,
+                        offsets.data(),
+                        offsets.size() * sizeof(unsigned int),
+                        hipMemcpyHostToDevice));
+
+    size_t temporary_storage_bytes;
+    HIP_CHECK(rocprim::segmented_moments<Config>(nullptr,
+                                                 temporary_storage_bytes,
+                                                 d_input,
+                                                 d_output,
+                                                 segments,
+                                                 d_offsets,
+                                                 d_offsets + 1,
+                                                 stream,
+                                                 debug_synchronous));
+    ASSERT_GT(temporary_storage_bytes, 0);
+    void* d_temporary_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(rocprim::segmented_moments<Config>(d_temporary_storage,
+                                                 temporary_storage_bytes,
+                                                 d_input,
+                                                 d_output,
+                                                 segments,
+                                                 d_offsets,
+                                                 d_offsets + 1,
+                                                 stream,
+                                                 debug_synchronous));
+    HIP_CHECK(hipGetLastError());
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<output_type> output(segments);
+    HIP_CHECK(hipMemcpy(output.data(),
+                        d_output,
+                        segments * sizeof(output_type),
+                        hipMemcpyDeviceToHost));
+
+    for(unsigned int segment = 0; segment < segments; segment++)
+    {
+        SCOPED_TRACE(testing::Message() << "with segment = " << segment);
+        assert_moments_near(output[segment],
+                            get_expected(input, offsets[segment], offsets[segment + 1]));
+    }
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipFree(d_offsets));
+}
+
+// Floating-point values have a large mean compared to their deviations, which makes the naive
+// E[x^2] - E[x]^2 lose all digits of the variance
+template<class T>
+auto get_input(const size_t size, const unsigned int seed_value) ->
+    typename std::enable_if<std::is_floating_point<T>::value, std::vector<T>>::type
+{
+    return test_utils::get_random_data<T>(size, T(1000), T(1001), seed_value);
+}
+
+template<class T>
+auto get_input(const size_t size, const unsigned int seed_value) ->
+    typename std::enable_if<!std::is_floating_point<T>::value, std::vector<T>>::type
+{
+    return test_utils::get_random_data<T>(size, T(0), T(100), seed_value);
+}
+
+TYPED_TEST(RocprimDeviceMoments, Moments)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T      = typename TestFixture::params::value_type;
+    using config = typename TestFixture::params::config;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            test_moments<config>(get_input<T>(size, seed_value), stream);
+        }
+    }
+}
+
+TEST(RocprimDeviceMomentsTests, Variance)
+{
+    // {count = 4, mean = 2.5, m2 = 5}
+    const rocprim::moments_result<float> moments{4, 2.5f, 5.0f};
+    ASSERT_FLOAT_EQ(moments.variance(), 1.25f);
+    ASSERT_FLOAT_EQ(moments.sample_variance(), 5.0f / 3.0f);
+
+    const rocprim::moments_result<float> single{1, 2.0f, 0.0f};
+    ASSERT_FLOAT_EQ(single.variance(), 0.0f);
+    ASSERT_FLOAT_EQ(single.sample_variance(), 0.0f);
+}
+
+TYPED_TEST(RocprimDeviceMoments, SegmentedMoments)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T      = typename TestFixture::params::value_type;
+    using config = typename TestFixture::params::config;
+
+    hipStream_t stream = 0; // default
+
+    std::random_device         rd;
+    std::default_random_engine gen(rd());
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // Short segments select the thread and warp algorithms, long ones the block algorithm
+        for(size_t max_segment_length : {4, 40, 1000, 100000})
+        {
+            SCOPED_TRACE(testing::Message() << "with max_segment_length = " << max_segment_length);
+
+            std::uniform_int_distribution<size_t> segment_length_dis(0, max_segment_length);
+
+            for(size_t size : test_utils::get_sizes(seed_value))
+            {
+                SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+                const std::vector<T> input = get_input<T>(size, seed_value);
+
+                std::vector<unsigned int> offsets;
+                size_t                    offset = 0;
+                while(offset < size)
+                {
+                    offsets.push_back(offset);
+                    offset += segment_length_dis(gen);
+                }
+                offsets.push_back(size);
+
+                test_segmented_moments<config>(input, offsets, stream);
+            }
+        }
+    }
+}
@@ -24,6 +24,7 @@
 
 // required rocprim headers
 #include <rocprim/device/device_partition.hpp>
+#include <rocprim/device/device_select.hpp>
 #include <rocprim/iterator/constant_iterator.hpp>
 #include <rocprim/iterator/counting_iterator.hpp>
 #include <rocprim/iterator/discard_iterator.hpp>
@@ -649,6 +650,141 @@ TYPED_TEST(RocprimDevicePartitionTests, PredicateThreeWay)
     }
 }
 
+// Selected and rejected values are written to separate outputs in their input order, both with
+// flags and with a predicate
+TYPED_TEST(RocprimDevicePartitionTests, TwoWay)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::input_type;
+    using U = typename TestFixture::output_type;
+    using F = typename TestFixture::flag_type;
+    static constexpr bool use_identity_iterator = TestFixture::use_identity_iterator;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    hipStream_t stream = 0; // default stream
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data
+            std::vector<T> input = test_utils::get_random_data<T>(size, 1, 100, seed_value);
+            std::vector<F> flags = test_utils::get_random_data01<F>(size, 0.25, seed_value);
+            const auto predicate = LessOp<T>{static_cast<T>(50)};
+
+            T*      d_input;
+            F*      d_flags;
+            U*      d_selected_output;
+            U*      d_rejected_output;
+            size_t* d_selected_count_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input.size() * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_flags, flags.size() * sizeof(F)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_selected_output, input.size() * sizeof(U)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_rejected_output, input.size() * sizeof(U)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_selected_count_output, sizeof(size_t)));
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                input.size() * sizeof(T),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_flags,
+                                flags.data(),
+                                flags.size() * sizeof(F),
+                                hipMemcpyHostToDevice));
+
+            for(const bool use_flags : {true, false})
+            {
+                SCOPED_TRACE(testing::Message() << "with flags = " << use_flags);
+
+                // Calculate expected results on host, both outputs are stable
+                std::vector<U> expected_selected;
+                std::vector<U> expected_rejected;
+                for(size_t i = 0; i < input.size(); i++)
+                {
+                    const bool selected = use_flags ? flags[i] != 0 : predicate(input[i]);
+                    (selected ? expected_selected : expected_rejected).push_back(input[i]);
+                }
+
+                auto dispatch = [&](void* d_temp_storage, size_t& temp_storage_size_bytes)
+                {
+                    const auto selected_output
+                        = test_utils::wrap_in_identity_iterator<use_identity_iterator>(
+                            d_selected_output);
+                    return use_flags ? rocprim::partition_two_way(d_temp_storage,
+                                                                  temp_storage_size_bytes,
+                                                                  d_input,
+                                                                  d_flags,
+                                                                  selected_output,
+                                                                  d_rejected_output,
+                                                                  d_selected_count_output,
+                                                                  input.size(),
+                                                                  stream,
+                                                                  debug_synchronous)
+                                     : rocprim::partition_two_way(d_temp_storage,
+                                                                  temp_storage_size_bytes,
+                                                                  d_input,
+                                                                  selected_output,
+                                                                  d_rejected_output,
+                                                                  d_selected_count_output,
+                                                                  input.size(),
+                                                                  predicate,
+                                                                  stream,
+                                                                  debug_synchronous);
+                };
+
+                size_t temp_storage_size_bytes;
+                HIP_CHECK(dispatch(nullptr, temp_storage_size_bytes));
+                ASSERT_GT(temp_storage_size_bytes, 0);
+                void* d_temp_storage = nullptr;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+                HIP_CHECK(dispatch(d_temp_storage, temp_storage_size_bytes));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+
+                size_t selected_count_output = 0;
+                HIP_CHECK(hipMemcpy(&selected_count_output,
+                                    d_selected_count_output,
+                                    sizeof(size_t),
+                                    hipMemcpyDeviceToHost));
+                ASSERT_EQ(selected_count_output, expected_selected.size());
+
+                std::vector<U> selected_output(expected_selected.size());
+                std::vector<U> rejected_output(expected_rejected.size());
+                HIP_CHECK(hipMemcpy(selected_output.data(),
+                                    d_selected_output,
+                                    selected_output.size() * sizeof(U),
+                                    hipMemcpyDeviceToHost));
+                HIP_CHECK(hipMemcpy(rejected_output.data(),
+                                    d_rejected_output,
+                                    rejected_output.size() * sizeof(U),
+                                    hipMemcpyDeviceToHost));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(selected_output, expected_selected));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(rejected_output, expected_rejected));
+
+                HIP_CHECK(hipFree(d_temp_storage));
+            }
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_flags));
+            HIP_CHECK(hipFree(d_selected_output));
+            HIP_CHECK(hipFree(d_rejected_output));
+            HIP_CHECK(hipFree(d_selected_count_output));
+        }
+    }
+}
+
 namespace
 {
 
@@ -672,6 +808,156 @@ std::vector<size_t> get_large_sizes()
 /// \brief An output iterator which checks the values written to it.
 /// The expected output values should be partitioned with regards to the \p modulo parameter.
 /// The check algorithm depends on \p CheckValue.
+// Values with the remainder Buckets are in no bucket
+template<unsigned int Buckets>
+struct partition_n_bucket_op
+{
+    ROCPRIM_HOST_DEVICE unsigned int operator()(const int& value) const
+    {
+        return static_cast<unsigned int>(value) % (Buckets + 1);
+    }
+};
+
+template<unsigned int Buckets>
+void test_partition_n()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = int;
+    const bool debug_synchronous = false;
+
+    const hipStream_t stream = 0; // default stream
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        const unsigned int seed_value = seed_index < random_seeds_count
+            ? static_cast<unsigned int>(rand()) : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data
+            const auto input = test_utils::get_random_data<T>(size, 0, 1000, seed_value);
+
+            // Calculate expected results on host
+            std::array<std::vector<T>, Buckets> expected;
+            for(const T value : input)
+            {
+                const unsigned int bucket = partition_n_bucket_op<Buckets>()(value);
+                if(bucket < Buckets)
+                {
+                    expected[bucket].push_back(value);
+                }
+            }
+
+            T*      d_input;
+            T*      d_outputs[Buckets];
+            size_t* d_bucket_counts;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input.size() * sizeof(T)));
+            for(unsigned int bucket = 0; bucket < Buckets; bucket++)
+            {
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_outputs[bucket],
+                                                             input.size() * sizeof(T)));
+            }
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_bucket_counts, Buckets * sizeof(size_t)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_input, input.data(),
+                    input.size() * sizeof(T),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(
+                rocprim::partition_n(
+                    nullptr,
+                    temp_storage_size_bytes,
+                    d_input,
+                    d_outputs,
+                    d_bucket_counts,
+                    input.size(),
+                    partition_n_bucket_op<Buckets>(),
+                    stream,
+                    debug_synchronous
+                )
+            );
+
+            // temp_storage_size_bytes must be >0
+            ASSERT_GT(temp_storage_size_bytes, 0);
+
+            void* d_temp_storage = nullptr;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            HIP_CHECK(
+                rocprim::partition_n(
+                    d_temp_storage,
+                    temp_storage_size_bytes,
+                    d_input,
+                    d_outputs,
+                    d_bucket_counts,
+                    input.size(),
+                    partition_n_bucket_op<Buckets>(),
+                    stream,
+                    debug_synchronous
+                )
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::array<size_t, Buckets> bucket_counts;
+            HIP_CHECK(
+                hipMemcpy(
+                    bucket_counts.data(), d_bucket_counts,
+                    Buckets * sizeof(size_t),
+                    hipMemcpyDeviceToHost
+                )
+            );
+            for(unsigned int bucket = 0; bucket < Buckets; bucket++)
+            {
+                SCOPED_TRACE(testing::Message() << "with bucket = " << bucket);
+                ASSERT_EQ(bucket_counts[bucket], expected[bucket].size());
+
+                std::vector<T> output(expected[bucket].size());
+                HIP_CHECK(
+                    hipMemcpy(
+                        output.data(), d_outputs[bucket],
+                        output.size() * sizeof(T),
+                        hipMemcpyDeviceToHost
+                    )
+                );
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected[bucket]));
+            }
+
+            HIP_CHECK(hipFree(d_input));
+            for(unsigned int bucket = 0; bucket < Buckets; bucket++)
+            {
+                HIP_CHECK(hipFree(d_outputs[bucket]));
+            }
+            HIP_CHECK(hipFree(d_bucket_counts));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
+
+TEST(RocprimDevicePartitionTests, PartitionNOneBucket)
+{
+    test_partition_n<1>();
+}
+
+TEST(RocprimDevicePartitionTests, PartitionNThreeBuckets)
+{
+    test_partition_n<3>();
+}
+
+TEST(RocprimDevicePartitionTests, PartitionNSixteenBuckets)
+{
+    test_partition_n<16>();
+}
+
 template<class CheckValue>
 class check_modulo_iterator
 {
@@ -1043,3 +1329,150 @@ TEST_P(RocprimDevicePartitionLargeInputTests, LargeInputPartitionThreeWay)
         HIP_CHECK(hipFree(d_incorrect_flag));
     }
 }
+
+struct is_even_predicate
+{
+    ROCPRIM_HOST_DEVICE bool operator()(const int& value) const
+    {
+        return value % 2 == 0;
+    }
+};
+
+// The look-back of partition and select waits for the selected counts of the preceding blocks
+// with Backoff
+template<rocprim::lookback_backoff Backoff>
+void test_partition_lookback_backoff()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T      = int;
+    using config = rocprim::select_config<256,
+                                          4,
+                                          rocprim::block_load_method::block_load_transpose,
+                                          rocprim::block_load_method::block_load_transpose,
+                                          rocprim::block_load_method::block_load_transpose,
+                                          rocprim::block_scan_algorithm::using_warp_scan,
+                                          ROCPRIM_GRID_SIZE_LIMIT,
+                                          rocprim::load_default,
+                                          rocprim::store_default,
+                                          0,
+                                          Backoff>;
+
+    const hipStream_t stream = 0; // default stream
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        const unsigned int seed_value = seed_index < random_seeds_count
+            ? static_cast<unsigned int>(rand()) : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(const size_t size : test_utils::get_sizes(seed_value))
+        {
+            if(size == 0)
+            {
+                continue;
+            }
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 1000, seed_value);
+
+            // The selected values in order, then the rejected values in reverse order
+            std::vector<T> expected_selected;
+            std::vector<T> expected_rejected;
+            for(const T value : input)
+            {
+                (is_even_predicate()(value) ? expected_selected : expected_rejected)
+                    .push_back(value);
+            }
+            std::vector<T> expected_partition(expected_selected);
+            expected_partition.insert(expected_partition.end(),
+                                      expected_rejected.rbegin(),
+                                      expected_rejected.rend());
+
+            T*            d_input;
+            T*            d_output;
+            unsigned int* d_selected_count_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_selected_count_output, sizeof(unsigned int)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            for(const bool partition : {true, false})
+            {
+                SCOPED_TRACE(testing::Message() << "with partition = " << partition);
+
+                const auto algorithm = [&](void* d_temp_storage, size_t& temp_storage_size_bytes)
+                {
+                    return partition ? rocprim::partition<config>(d_temp_storage,
+                                                                  temp_storage_size_bytes,
+                                                                  d_input,
+                                                                  d_output,
+                                                                  d_selected_count_output,
+                                                                  size,
+                                                                  is_even_predicate(),
+                                                                  stream)
+                                     : rocprim::select<config>(d_temp_storage,
+                                                               temp_storage_size_bytes,
+                                                               d_input,
+                                                               d_output,
+                                                               d_selected_count_output,
+                                                               size,
+                                                               is_even_predicate(),
+                                                               stream);
+                };
+
+                size_t temp_storage_size_bytes;
+                HIP_CHECK(algorithm(nullptr, temp_storage_size_bytes));
+                void* d_temp_storage;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+                HIP_CHECK(algorithm(d_temp_storage, temp_storage_size_bytes));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipFree(d_temp_storage));
+
+                unsigned int selected_count_output;
+                HIP_CHECK(hipMemcpy(&selected_count_output,
+                                    d_selected_count_output,
+                                    sizeof(unsigned int),
+                                    hipMemcpyDeviceToHost));
+                ASSERT_EQ(selected_count_output, expected_selected.size());
+
+                const std::vector<T>& expected
+                    = partition ? expected_partition : expected_selected;
+                std::vector<T> output(expected.size());
+                HIP_CHECK(hipMemcpy(output.data(),
+                                    d_output,
+                                    output.size() * sizeof(T),
+                                    hipMemcpyDeviceToHost));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+            }
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_selected_count_output));
+        }
+    }
+}
+
+TEST(RocprimDevicePartitionTests, LookbackBackoffAutomatic)
+{
+    test_partition_lookback_backoff<rocprim::lookback_backoff::automatic>();
+}
+
+TEST(RocprimDevicePartitionTests, LookbackBackoffSpin)
+{
+    test_partition_lookback_backoff<rocprim::lookback_backoff::spin>();
+}
+
+TEST(RocprimDevicePartitionTests, LookbackBackoffExponentialSleep)
+{
+    test_partition_lookback_backoff<rocprim::lookback_backoff::exponential_sleep>();
+}
+
+TEST(RocprimDevicePartitionTests, LookbackBackoffBoundedSleep)
+{
+    test_partition_lookback_backoff<rocprim::lookback_backoff::bounded_sleep>();
+}
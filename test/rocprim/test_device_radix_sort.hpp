@@ -25,6 +25,10 @@
 
 #include "../common_test_header.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
 // required rocprim headers
 #include <rocprim/device/device_radix_sort.hpp>
 
@@ -58,7 +62,136 @@ public:
 
 TYPED_TEST_SUITE_P(RocprimDeviceRadixSort);
 
-template<typename TestFixture>
+using custom_radix_sort_config = rocprim::radix_sort_config<8,
+                                                           5,
+                                                           rocprim::kernel_config<256, 3>,
+                                                           rocprim::kernel_config<256, 8>>;
+
+// All inputs that do not fit into a single block are sorted by the onesweep algorithm
+using onesweep_radix_sort_config = rocprim::radix_sort_config<8,
+                                                             5,
+                                                             rocprim::kernel_config<256, 3>,
+                                                             rocprim::kernel_config<256, 8>,
+                                                             rocprim::kernel_config<256, 10>,
+                                                             rocprim::kernel_config<1024, 1>,
+                                                             1,
+                                                             false,
+                                                             true>;
+
+// All inputs that do not fit into a single block are sorted by the iterations algorithm
+using iterations_radix_sort_config = rocprim::radix_sort_config<8,
+                                                               5,
+                                                               rocprim::kernel_config<256, 3>,
+                                                               rocprim::kernel_config<256, 8>,
+                                                               rocprim::kernel_config<256, 10>,
+                                                               rocprim::kernel_config<1024, 1>,
+                                                               1>;
+
+// The iterations and onesweep algorithms write the runs of at least 16 items as aligned segments
+using write_combining_radix_sort_config
+    = rocprim::radix_sort_config<8,
+                                 5,
+                                 rocprim::kernel_config<256, 3>,
+                                 rocprim::kernel_config<256, 8>,
+                                 rocprim::kernel_config<256, 10>,
+                                 rocprim::kernel_config<1024, 1>,
+                                 1,
+                                 false,
+                                 false,
+                                 rocprim::kernel_config<256, 8>,
+                                 rocprim::kernel_config<256, 8>,
+                                 rocprim::store_default,
+                                 16>;
+
+using onesweep_write_combining_radix_sort_config
+    = rocprim::radix_sort_config<8,
+                                 5,
+                                 rocprim::kernel_config<256, 3>,
+                                 rocprim::kernel_config<256, 8>,
+                                 rocprim::kernel_config<256, 10>,
+                                 rocprim::kernel_config<1024, 1>,
+                                 1,
+                                 false,
+                                 true,
+                                 rocprim::kernel_config<256, 8>,
+                                 rocprim::kernel_config<256, 8>,
+                                 rocprim::store_default,
+                                 16>;
+
+// Sorted and strictly reverse sorted inputs that do not fit into a single block are copied
+template<bool UseOnesweep>
+using check_sorted_radix_sort_config = rocprim::radix_sort_config<8,
+                                                                 5,
+                                                                 rocprim::kernel_config<256, 3>,
+                                                                 rocprim::kernel_config<256, 8>,
+                                                                 rocprim::kernel_config<256, 10>,
+                                                                 rocprim::kernel_config<1024, 1>,
+                                                                 1,
+                                                                 false,
+                                                                 UseOnesweep,
+                                                                 rocprim::kernel_config<256, 8>,
+                                                                 rocprim::kernel_config<256, 8>,
+                                                                 rocprim::store_default,
+                                                                 0,
+                                                                 true>;
+
+// Narrow ranges of integer keys that do not fit into a single block are sorted on their range
+template<bool UseOnesweep>
+using compress_key_range_radix_sort_config
+    = rocprim::radix_sort_config<8,
+                                 5,
+                                 rocprim::kernel_config<256, 3>,
+                                 rocprim::kernel_config<256, 8>,
+                                 rocprim::kernel_config<256, 10>,
+                                 rocprim::kernel_config<1024, 1>,
+                                 1,
+                                 false,
+                                 UseOnesweep,
+                                 rocprim::kernel_config<256, 8>,
+                                 rocprim::kernel_config<256, 8>,
+                                 rocprim::store_default,
+                                 0,
+                                 false,
+                                 true>;
+
+// Inputs of up to 4M items that do not fit into a single block are sorted by a single launch
+using cooperative_radix_sort_config
+    = rocprim::radix_sort_config<8,
+                                 5,
+                                 rocprim::kernel_config<256, 3>,
+                                 rocprim::kernel_config<256, 8>,
+                                 rocprim::kernel_config<256, 10>,
+                                 rocprim::kernel_config<1024, 1>,
+                                 1,
+                                 false,
+                                 false,
+                                 rocprim::kernel_config<256, 8>,
+                                 rocprim::kernel_config<256, 8>,
+                                 rocprim::store_default,
+                                 0,
+                                 false,
+                                 false,
+                                 1 << 22>;
+
+// Small inputs are sorted by the cooperative kernel, large inputs by onesweep
+using bucketed_radix_sort_config = rocprim::size_bucketed_config<
+    rocprim::size_bucket<(1 << 20), cooperative_radix_sort_config>,
+    rocprim::size_bucket<std::numeric_limits<size_t>::max(), onesweep_radix_sort_config>>;
+
+// Large values are moved by every pass with this config
+struct direct_radix_sort_config : onesweep_radix_sort_config
+{
+    static constexpr unsigned int indirect_value_size_threshold
+        = std::numeric_limits<unsigned int>::max();
+};
+
+// Values larger than 8 bytes are sorted as indices with this config
+struct indirect_radix_sort_config : onesweep_radix_sort_config
+{
+    static constexpr unsigned int indirect_value_size_threshold = 8;
+};
+
+template<typename TestFixture, class Config = custom_radix_sort_config>
 inline void sort_keys()
 {
     int device_id = test_common_utils::obtain_device_from_ctest();
@@ -138,14 +271,8 @@ inline void sort_keys()
                 expected.end(),
                 test_utils::key_comparator<key_type, descending, start_bit, end_bit>());
 
-            // Use custom config
-            using config = rocprim::radix_sort_config<8,
-                                                      5,
-                                                      rocprim::kernel_config<256, 3>,
-                                                      rocprim::kernel_config<256, 8>>;
-
             size_t temporary_storage_bytes;
-            HIP_CHECK(rocprim::radix_sort_keys<config>(nullptr,
+            HIP_CHECK(rocprim::radix_sort_keys<Config>(nullptr,
                                                        temporary_storage_bytes,
                                                        d_keys_input,
                                                        d_keys_output,
@@ -161,7 +288,7 @@ inline void sort_keys()
 
             if(descending)
             {
-                HIP_CHECK(rocprim::radix_sort_keys_desc<config>(d_temporary_storage,
+                HIP_CHECK(rocprim::radix_sort_keys_desc<Config>(d_temporary_storage,
                                                                 temporary_storage_bytes,
                                                                 d_keys_input,
                                                                 d_keys_output,
@@ -173,7 +300,7 @@ inline void sort_keys()
             }
             else
             {
-                HIP_CHECK(rocprim::radix_sort_keys<config>(d_temporary_storage,
+                HIP_CHECK(rocprim::radix_sort_keys<Config>(d_temporary_storage,
                                                            temporary_storage_bytes,
                                                            d_keys_input,
                                                            d_keys_output,
@@ -202,7 +329,7 @@ inline void sort_keys()
     }
 }
 
-template<typename TestFixture>
+template<typename TestFixture, class Config = rocprim::default_config>
 inline void sort_pairs()
 {
     int device_id = test_common_utils::obtain_device_from_ctest();
@@ -320,15 +447,15 @@ inline void sort_pairs()
 
             void*  d_temporary_storage = nullptr;
             size_t temporary_storage_bytes;
-            HIP_CHECK(rocprim::radix_sort_pairs(d_temporary_storage,
-                                                temporary_storage_bytes,
-                                                d_keys_input,
-                                                d_keys_output,
-                                                d_values_input,
-                                                d_values_output,
-                                                size,
-                                                start_bit,
-                                                end_bit));
+            HIP_CHECK(rocprim::radix_sort_pairs<Config>(d_temporary_storage,
+                                                        temporary_storage_bytes,
+                                                        d_keys_input,
+                                                        d_keys_output,
+                                                        d_values_input,
+                                                        d_values_output,
+                                                        size,
+                                                        start_bit,
+                                                        end_bit));
 
             ASSERT_GT(temporary_storage_bytes, 0);
 
@@ -337,31 +464,31 @@ inline void sort_pairs()
 
             if(descending)
             {
-                HIP_CHECK(rocprim::radix_sort_pairs_desc(d_temporary_storage,
-                                                         temporary_storage_bytes,
-                                                         d_keys_input,
-                                                         d_keys_output,
-                                                         d_values_input,
-                                                         d_values_output,
-                                                         size,
-                                                         start_bit,
-                                                         end_bit,
-                                                         stream,
-                                                         debug_synchronous));
+                HIP_CHECK(rocprim::radix_sort_pairs_desc<Config>(d_temporary_storage,
+                                                                 temporary_storage_bytes,
+                                                                 d_keys_input,
+                                                                 d_keys_output,
+                                                                 d_values_input,
+                                                                 d_values_output,
+                                                                 size,
+                                                                 start_bit,
+                                                                 end_bit,
+                                                                 stream,
+                                                                 debug_synchronous));
             }
             else
             {
-                HIP_CHECK(rocprim::radix_sort_pairs(d_temporary_storage,
-                                                    temporary_storage_bytes,
-                                                    d_keys_input,
-                                                    d_keys_output,
-                                                    d_values_input,
-                                                    d_values_output,
-                                                    size,
-                                                    start_bit,
-                                                    end_bit,
-                                                    stream,
-                                                    debug_synchronous));
+                HIP_CHECK(rocprim::radix_sort_pairs<Config>(d_temporary_storage,
+                                                            temporary_storage_bytes,
+                                                            d_keys_input,
+                                                            d_keys_output,
+                                                            d_values_input,
+                                                            d_values_output,
+                                                            size,
+                                                            start_bit,
+                                                            end_bit,
+                                                            stream,
+                                                            debug_synchronous));
             }
 
             std::vector<key_type> keys_output(size);
@@ -770,4 +897,1335 @@ inline void sort_keys_over_4g()
     HIP_CHECK(hipFree(d_temporary_storage));
 }
 
+// Digits that are the same for all keys must be skipped without changing the result
+template<class Config>
+inline void sort_pairs_uniform_digits()
+{
+    using key_type                           = unsigned long long;
+    using value_type                         = unsigned int;
+    constexpr hipStream_t  stream            = 0;
+    constexpr bool         debug_synchronous = false;
+    // The high 5 bytes of keys are the same, only the 3 low bytes need passes
+    constexpr key_type     high_bits         = 0x0123456700000000ull;
+    constexpr unsigned int varying_bits      = 24;
+
+    const int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : {size_t(5000), size_t(100000), size_t(1) << 20})
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            for(bool all_equal : {false, true})
+            {
+                SCOPED_TRACE(testing::Message() << "with all_equal = " << all_equal);
+
+                std::vector<key_type> keys_input = test_utils::get_random_data<key_type>(
+                    size, 0, (key_type(1) << varying_bits) - 1, seed_value);
+                for(key_type& key : keys_input)
+                {
+                    key = all_equal ? high_bits : (high_bits | key);
+                }
+                std::vector<value_type> values_input(size);
+                test_utils::iota(values_input.begin(), values_input.end(), 0);
+
+                key_type*   d_keys_input;
+                key_type*   d_keys_output;
+                value_type* d_values_input;
+                value_type* d_values_output;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(key_type)));
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_values_input, size * sizeof(value_type)));
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_values_output, size * sizeof(value_type)));
+                HIP_CHECK(hipMemcpy(d_keys_input,
+                                    keys_input.data(),
+                                    size * sizeof(key_type),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_values_input,
+                                    values_input.data(),
+                                    size * sizeof(value_type),
+                                    hipMemcpyHostToDevice));
+
+                // Values are indices, so the stable sort is checked too
+                std::vector<value_type> values_expected(values_input);
+                std::stable_sort(values_expected.begin(),
+                                 values_expected.end(),
+                                 [&](const value_type& a, const value_type& b)
+                                 { return keys_input[a] < keys_input[b]; });
+
+                size_t temporary_storage_bytes;
+                HIP_CHECK(rocprim::radix_sort_pairs<Config>(nullptr,
+                                                            temporary_storage_bytes,
+                                                            d_keys_input,
+                                                            d_keys_output,
+                                                            d_values_input,
+                                                            d_values_output,
+                                                            size));
+                ASSERT_GT(temporary_storage_bytes, 0);
+
+                void* d_temporary_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                             temporary_storage_bytes));
+
+                unsigned int executed_passes;
+                HIP_CHECK(rocprim::radix_sort_pairs<Config>(d_temporary_storage,
+                                                            temporary_storage_bytes,
+                                                            d_keys_input,
+                                                            d_keys_output,
+                                                            d_values_input,
+                                                            d_values_output,
+                                                            size,
+                                                            0,
+                                                            8 * sizeof(key_type),
+                                                            stream,
+                                                            debug_synchronous,
+                                                            &executed_passes));
+                HIP_CHECK(hipFree(d_temporary_storage));
+
+                ASSERT_EQ(executed_passes, all_equal ? 0u : varying_bits / 8);
+
+                std::vector<key_type>   keys_output(size);
+                std::vector<value_type> values_output(size);
+                HIP_CHECK(hipMemcpy(keys_output.data(),
+                                    d_keys_output,
+                                    size * sizeof(key_type),
+                                    hipMemcpyDeviceToHost));
+                HIP_CHECK(hipMemcpy(values_output.data(),
+                                    d_values_output,
+                                    size * sizeof(value_type),
+                                    hipMemcpyDeviceToHost));
+
+                for(size_t i = 0; i < size; i++)
+                {
+                    ASSERT_EQ(keys_output[i], keys_input[values_expected[i]]) << "at index " << i;
+                    ASSERT_EQ(values_output[i], values_expected[i]) << "at index " << i;
+                }
+
+                HIP_CHECK(hipFree(d_keys_input));
+                HIP_CHECK(hipFree(d_keys_output));
+                HIP_CHECK(hipFree(d_values_input));
+                HIP_CHECK(hipFree(d_values_output));
+            }
+        }
+    }
+}
+
+// Sorted and strictly reverse sorted inputs must be copied without passes, other inputs, even with
+// only a few keys out of order or with equal keys in reverse sorted inputs, must be sorted
+template<class Config>
+inline void sort_pairs_presorted()
+{
+    using key_type                           = int;
+    using value_type                         = unsigned int;
+    constexpr hipStream_t  stream            = 0;
+    constexpr bool         debug_synchronous = false;
+
+    enum class input_order
+    {
+        sorted,
+        reverse_sorted,
+        reverse_sorted_with_ties,
+        almost_sorted
+    };
+
+    const int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : {size_t(5000), size_t(100003), size_t(1) << 20})
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            for(input_order order : {input_order::sorted,
+                                     input_order::reverse_sorted,
+                                     input_order::reverse_sorted_with_ties,
+                                     input_order::almost_sorted})
+            {
+                SCOPED_TRACE(testing::Message() << "with order = " << static_cast<int>(order));
+
+                // Distinct keys are needed for the strictly reverse sorted input
+                std::vector<key_type> keys_input(size);
+                for(size_t i = 0; i < size; i++)
+                {
+                    keys_input[i] = static_cast<key_type>(i) * 3 - static_cast<key_type>(size);
+                }
+                if(order == input_order::reverse_sorted_with_ties)
+                {
+                    for(size_t i = 0; i < size; i++)
+                    {
+                        keys_input[i] = keys_input[i / 2 * 2];
+                    }
+                }
+                if(order == input_order::reverse_sorted
+                   || order == input_order::reverse_sorted_with_ties)
+                {
+                    std::reverse(keys_input.begin(), keys_input.end());
+                }
+                if(order == input_order::almost_sorted)
+                {
+                    const size_t i = test_utils::get_random_value<size_t>(0, size - 2, seed_value);
+                    std::swap(keys_input[i], keys_input[i + 1]);
+                }
+                const bool copied
+                    = order == input_order::sorted || order == input_order::reverse_sorted;
+
+                std::vector<value_type> values_input(size);
+                test_utils::iota(values_input.begin(), values_input.end(), 0);
+
+                // Values are indices, so the stable sort is checked too
+                std::vector<value_type> values_expected(values_input);
+                std::stable_sort(values_expected.begin(),
+                                 values_expected.end(),
+                                 [&](const value_type& a, const value_type& b)
+                                 { return keys_input[a] < keys_input[b]; });
+
+                // The reverse sorted inputs are sorted in place, they are reversed through
+                // the temporary storage
+                const bool in_place = order != input_order::sorted;
+
+                key_type*   d_keys_input;
+                key_type*   d_keys_output;
+                value_type* d_values_input;
+                value_type* d_values_output;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_values_input, size * sizeof(value_type)));
+                if(in_place)
+                {
+                    d_keys_output   = d_keys_input;
+                    d_values_output = d_values_input;
+                }
+                else
+                {
+                    HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output,
+                                                                 size * sizeof(key_type)));
+                    HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output,
+                                                                 size * sizeof(value_type)));
+                }
+                HIP_CHECK(hipMemcpy(d_keys_input,
+                                    keys_input.data(),
+                                    size * sizeof(key_type),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_values_input,
+                                    values_input.data(),
+                                    size * sizeof(value_type),
+                                    hipMemcpyHostToDevice));
+
+                size_t temporary_storage_bytes;
+                HIP_CHECK(rocprim::radix_sort_pairs<Config>(nullptr,
+                                                            temporary_storage_bytes,
+                                                            d_keys_input,
+                                                            d_keys_output,
+                                                            d_values_input,
+                                                            d_values_output,
+                                                            size));
+                ASSERT_GT(temporary_storage_bytes, 0);
+
+                void* d_temporary_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                             temporary_storage_bytes));
+
+                unsigned int executed_passes;
+                HIP_CHECK(rocprim::radix_sort_pairs<Config>(d_temporary_storage,
+                                                            temporary_storage_bytes,
+                                                            d_keys_input,
+                                                            d_keys_output,
+                                                            d_values_input,
+                                                            d_values_output,
+                                                            size,
+                                                            0,
+                                                            8 * sizeof(key_type),
+                                                            stream,
+                                                            debug_synchronous,
+                                                            &executed_passes));
+                HIP_CHECK(hipFree(d_temporary_storage));
+
+                if(copied)
+                {
+                    ASSERT_EQ(executed_passes, 0u);
+                }
+                else
+                {
+                    ASSERT_GT(executed_passes, 0u);
+                }
+
+                std::vector<key_type>   keys_output(size);
+                std::vector<value_type> values_output(size);
+                HIP_CHECK(hipMemcpy(keys_output.data(),
+                                    d_keys_output,
+                                    size * sizeof(key_type),
+                                    hipMemcpyDeviceToHost));
+                HIP_CHECK(hipMemcpy(values_output.data(),
+                                    d_values_output,
+                                    size * sizeof(value_type),
+                                    hipMemcpyDeviceToHost));
+
+                for(size_t i = 0; i < size; i++)
+                {
+                    ASSERT_EQ(keys_output[i], keys_input[values_expected[i]]) << "at index " << i;
+                    ASSERT_EQ(values_output[i], values_expected[i]) << "at index " << i;
+                }
+
+                HIP_CHECK(hipFree(d_keys_input));
+                HIP_CHECK(hipFree(d_values_input));
+                if(!in_place)
+                {
+                    HIP_CHECK(hipFree(d_keys_output));
+                    HIP_CHECK(hipFree(d_values_output));
+                }
+            }
+        }
+    }
+}
+
+// Keys of a narrow range under a large base differ in all bytes, because the range crosses
+// the carries into the high bytes. They must be sorted on the bits of the range only.
+template<class Config, bool Descending>
+inline void sort_pairs_compressed_keys()
+{
+    using key_type                           = long long;
+    using value_type                         = unsigned int;
+    constexpr hipStream_t  stream            = 0;
+    constexpr bool         debug_synchronous = false;
+    constexpr key_type     base              = 0x0FFFFFFFFFF80000ll;
+    constexpr unsigned int range_bits        = 20;
+
+    const int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : {size_t(100003), size_t(1) << 20})
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            for(bool in_place : {false, true})
+            {
+                SCOPED_TRACE(testing::Message() << "with in_place = " << in_place);
+
+                std::vector<key_type> keys_input = test_utils::get_random_data<key_type>(
+                    size, 0, (key_type(1) << range_bits) - 1, seed_value);
+                // The range spans all 20 bits and the keys cross 0x1000000000000000
+                keys_input[0] = 0;
+                keys_input[size - 1] = (key_type(1) << range_bits) - 1;
+                for(key_type& key : keys_input)
+                {
+                    key += base;
+                }
+
+                std::vector<value_type> values_input(size);
+                test_utils::iota(values_input.begin(), values_input.end(), 0);
+
+                // Values are indices, so the stable sort is checked too
+                std::vector<value_type> values_expected(values_input);
+                std::stable_sort(values_expected.begin(),
+                                 values_expected.end(),
+                                 [&](const value_type& a, const value_type& b)
+                                 {
+                                     return Descending ? keys_input[b] < keys_input[a]
+                                                       : keys_input[a] < keys_input[b];
+                                 });
+
+                key_type*   d_keys_input;
+                key_type*   d_keys_output;
+                value_type* d_values_input;
+                value_type* d_values_output;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_values_input, size * sizeof(value_type)));
+                if(in_place)
+                {
+                    d_keys_output   = d_keys_input;
+                    d_values_output = d_values_input;
+                }
+                else
+                {
+                    HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output,
+                                                                 size * sizeof(key_type)));
+                    HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output,
+                                                                 size * sizeof(value_type)));
+                }
+                HIP_CHECK(hipMemcpy(d_keys_input,
+                                    keys_input.data(),
+                                    size * sizeof(key_type),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_values_input,
+                                    values_input.data(),
+                                    size * sizeof(value_type),
+                                    hipMemcpyHostToDevice));
+
+                unsigned int executed_passes;
+                const auto   dispatch = [&](void* d_temporary_storage, size_t& storage_bytes)
+                {
+                    return Descending ? rocprim::radix_sort_pairs_desc<Config>(d_temporary_storage,
+                                                                               storage_bytes,
+                                                                               d_keys_input,
+                                                                               d_keys_output,
+                                                                               d_values_input,
+                                                                               d_values_output,
+                                                                               size,
+                                                                               0,
+                                                                               8 * sizeof(key_type),
+                                                                               stream,
+                                                                               debug_synchronous,
+                                                                               &executed_passes)
+                                      : rocprim::radix_sort_pairs<Config>(d_temporary_storage,
+                                                                          storage_bytes,
+                                                                          d_keys_input,
+                                                                          d_keys_output,
+                                                                          d_values_input,
+                                                                          d_values_output,
+                                                                          size,
+                                                                          0,
+                                                                          8 * sizeof(key_type),
+                                                                          stream,
+                                                                          debug_synchronous,
+                                                                          &executed_passes);
+                };
+
+                size_t temporary_storage_bytes;
+                HIP_CHECK(dispatch(nullptr, temporary_storage_bytes));
+                ASSERT_GT(temporary_storage_bytes, 0);
+
+                void* d_temporary_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                             temporary_storage_bytes));
+                HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+                HIP_CHECK(hipFree(d_temporary_storage));
+
+                // 20 bits need 3 passes of 8 bits instead of 8 passes
+                ASSERT_LE(executed_passes, 3u);
+
+                std::vector<key_type>   keys_output(size);
+                std::vector<value_type> values_output(size);
+                HIP_CHECK(hipMemcpy(keys_output.data(),
+                                    d_keys_output,
+                                    size * sizeof(key_type),
+                                    hipMemcpyDeviceToHost));
+                HIP_CHECK(hipMemcpy(values_output.data(),
+                                    d_values_output,
+                                    size * sizeof(value_type),
+                                    hipMemcpyDeviceToHost));
+
+                for(size_t i = 0; i < size; i++)
+                {
+                    ASSERT_EQ(keys_output[i], keys_input[values_expected[i]]) << "at index " << i;
+                    ASSERT_EQ(values_output[i], values_expected[i]) << "at index " << i;
+                }
+
+                HIP_CHECK(hipFree(d_keys_input));
+                HIP_CHECK(hipFree(d_values_input));
+                if(!in_place)
+                {
+                    HIP_CHECK(hipFree(d_keys_output));
+                    HIP_CHECK(hipFree(d_values_output));
+                }
+            }
+        }
+    }
+}
+
+// Keys-only sorts of all bits of 8-bit and 16-bit keys that do not fit into a single block are
+// counting sorts, the sorted keys are written from the counts of the values in one pass
+template<class Key, bool Descending>
+inline void sort_keys_counting()
+{
+    using key_type                           = Key;
+    constexpr hipStream_t  stream            = 0;
+    constexpr bool         debug_synchronous = false;
+
+    const int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : {size_t(100003), size_t(1) << 20})
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Few distinct values make long runs of equal keys in the input and in the output
+            for(bool few_values : {false, true})
+            {
+                SCOPED_TRACE(testing::Message() << "with few_values = " << few_values);
+
+                const key_type min_key = std::numeric_limits<key_type>::min();
+                const key_type max_key = few_values ? key_type(min_key + 3)
+                                                    : std::numeric_limits<key_type>::max();
+                std::vector<key_type> keys_input
+                    = test_utils::get_random_data<key_type>(size, min_key, max_key, seed_value);
+
+                std::vector<key_type> expected(keys_input);
+                std::sort(expected.begin(), expected.end());
+                if(Descending)
+                {
+                    std::reverse(expected.begin(), expected.end());
+                }
+
+                key_type* d_keys;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, size * sizeof(key_type)));
+                HIP_CHECK(hipMemcpy(d_keys,
+                                    keys_input.data(),
+                                    size * sizeof(key_type),
+                                    hipMemcpyHostToDevice));
+
+                // The keys are sorted in place, they are only read by the counting pass
+                unsigned int executed_passes;
+                const auto   dispatch = [&](void* d_temporary_storage, size_t& storage_bytes)
+                {
+                    return Descending ? rocprim::radix_sort_keys_desc(d_temporary_storage,
+                                                                      storage_bytes,
+                                                                      d_keys,
+                                                                      d_keys,
+                                                                      size,
+                                                                      0,
+                                                                      8 * sizeof(key_type),
+                                                                      stream,
+                                                                      debug_synchronous,
+                                                                      &executed_passes)
+                                      : rocprim::radix_sort_keys(d_temporary_storage,
+                                                                 storage_bytes,
+                                                                 d_keys,
+                                                                 d_keys,
+                                                                 size,
+                                                                 0,
+                                                                 8 * sizeof(key_type),
+                                                                 stream,
+                                                                 debug_synchronous,
+                                                                 &executed_passes);
+                };
+
+                size_t temporary_storage_bytes;
+                HIP_CHECK(dispatch(nullptr, temporary_storage_bytes));
+                ASSERT_GT(temporary_storage_bytes, 0);
+
+                void* d_temporary_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                             temporary_storage_bytes));
+                HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+                HIP_CHECK(hipFree(d_temporary_storage));
+
+                ASSERT_EQ(executed_passes, 1u);
+
+                std::vector<key_type> keys_output(size);
+                HIP_CHECK(hipMemcpy(keys_output.data(),
+                                    d_keys,
+                                    size * sizeof(key_type),
+                                    hipMemcpyDeviceToHost));
+                HIP_CHECK(hipFree(d_keys));
+
+                for(size_t i = 0; i < size; i++)
+                {
+                    ASSERT_EQ(keys_output[i], expected[i]) << "at index " << i;
+                }
+            }
+        }
+    }
+}
+
+// The permutation of a stable sort of keys with many ties, the indices are generated by the sort
+template<class Config, bool Descending>
+inline void sort_argsort()
+{
+    using key_type                           = int;
+    using index_type                         = unsigned int;
+    constexpr hipStream_t  stream            = 0;
+    constexpr bool         debug_synchronous = false;
+
+    const int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : {size_t(1000), size_t(100003), size_t(1) << 20})
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<key_type> keys_input
+                = test_utils::get_random_data<key_type>(size, -1000, 1000, seed_value);
+
+            std::vector<index_type> expected_indices(size);
+            test_utils::iota(expected_indices.begin(), expected_indices.end(), 0);
+            std::stable_sort(expected_indices.begin(),
+                             expected_indices.end(),
+                             [&](const index_type a, const index_type b)
+                             {
+                                 return Descending ? keys_input[a] > keys_input[b]
+                                                   : keys_input[a] < keys_input[b];
+                             });
+            std::vector<key_type> expected_keys(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                expected_keys[i] = keys_input[expected_indices[i]];
+            }
+
+            key_type*   d_keys_input;
+            key_type*   d_keys_output;
+            index_type* d_indices_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(key_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_indices_output, size * sizeof(index_type)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+
+            const auto dispatch = [&](void* d_temporary_storage, size_t& storage_bytes)
+            {
+                return Descending ? rocprim::radix_sort_argsort_desc<Config>(d_temporary_storage,
+                                                                             storage_bytes,
+                                                                             d_keys_input,
+                                                                             d_keys_output,
+                                                                             d_indices_output,
+                                                                             size,
+                                                                             0,
+                                                                             8 * sizeof(key_type),
+                                                                             stream,
+                                                                             debug_synchronous)
+                                  : rocprim::radix_sort_argsort<Config>(d_temporary_storage,
+                                                                        storage_bytes,
+                                                                        d_keys_input,
+                                                                        d_keys_output,
+                                                                        d_indices_output,
+                                                                        size,
+                                                                        0,
+                                                                        8 * sizeof(key_type),
+                                                                        stream,
+                                                                        debug_synchronous);
+            };
+
+            size_t temporary_storage_bytes;
+            HIP_CHECK(dispatch(nullptr, temporary_storage_bytes));
+            ASSERT_GT(temporary_storage_bytes, 0);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(hipFree(d_temporary_storage));
+
+            std::vector<key_type>   keys_output(size);
+            std::vector<index_type> indices_output(size);
+            HIP_CHECK(hipMemcpy(keys_output.data(),
+                                d_keys_output,
+                                size * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(indices_output.data(),
+                                d_indices_output,
+                                size * sizeof(index_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_indices_output));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, expected_keys));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(indices_output, expected_indices));
+        }
+    }
+}
+
+template<rocprim::radix_float_order FloatOrder, bool Descending>
+inline void sort_keys_float_order()
+{
+    using key_type                           = float;
+    using bits_type                          = uint32_t;
+    constexpr hipStream_t stream             = 0;
+    constexpr bool        debug_synchronous  = false;
+    constexpr bool        nans_last          = FloatOrder == rocprim::radix_float_order::nans_last;
+    constexpr bool        total_order        = FloatOrder == rocprim::radix_float_order::total_order;
+
+    const int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        const size_t size = 5000;
+
+        std::vector<key_type> keys_input
+            = test_utils::get_random_data<key_type>(size, -1000.0f, 1000.0f, seed_value);
+        // Sprinkle the special values over the whole input
+        const key_type special[] = {-0.0f,
+                                    0.0f,
+                                    std::numeric_limits<key_type>::infinity(),
+                                    -std::numeric_limits<key_type>::infinity(),
+                                    std::numeric_limits<key_type>::quiet_NaN(),
+                                    -std::numeric_limits<key_type>::quiet_NaN()};
+        for(size_t i = 0; i < size; i += 7)
+        {
+            keys_input[i] = special[(i / 7) % (sizeof(special) / sizeof(special[0]))];
+        }
+
+        // Sorting key of the reference: the bits of a key mapped to an unsigned integer
+        // that preserves IEEE 754 totalOrder
+        auto ordered_bits = [](const key_type key)
+        {
+            bits_type bits;
+            std::memcpy(&bits, &key, sizeof(bits));
+            return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+        };
+        auto canonical_bits = [&](key_type key)
+        {
+            if(!total_order && key == 0.0f)
+            {
+                key = 0.0f;
+            }
+            return ordered_bits(key);
+        };
+        std::vector<key_type> keys_expected(keys_input);
+        std::stable_sort(keys_expected.begin(),
+                         keys_expected.end(),
+                         [&](const key_type& a, const key_type& b)
+                         {
+                             if(nans_last && (std::isnan(a) || std::isnan(b)))
+                             {
+                                 return !std::isnan(a) && std::isnan(b);
+                             }
+                             return Descending ? canonical_bits(b) < canonical_bits(a)
+                                               : canonical_bits(a) < canonical_bits(b);
+                         });
+
+        key_type* d_keys_input;
+        key_type* d_keys_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(key_type)));
+        HIP_CHECK(hipMemcpy(d_keys_input,
+                            keys_input.data(),
+                            size * sizeof(key_type),
+                            hipMemcpyHostToDevice));
+
+        auto sort = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+        {
+            return Descending ? rocprim::radix_sort_keys_desc<rocprim::default_config, FloatOrder>(
+                       d_temporary_storage,
+                       temporary_storage_bytes,
+                       d_keys_input,
+                       d_keys_output,
+                       size,
+                       0,
+                       sizeof(key_type) * 8,
+                       stream,
+                       debug_synchronous)
+                              : rocprim::radix_sort_keys<rocprim::default_config, FloatOrder>(
+                                  d_temporary_storage,
+                                  temporary_storage_bytes,
+                                  d_keys_input,
+                                  d_keys_output,
+                                  size,
+                                  0,
+                                  sizeof(key_type) * 8,
+                                  stream,
+                                  debug_synchronous);
+        };
+
+        size_t temporary_storage_bytes;
+        HIP_CHECK(sort(nullptr, temporary_storage_bytes));
+        ASSERT_GT(temporary_storage_bytes, 0);
+
+        void* d_temporary_storage;
+        HIP_CHECK(
+            test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+        HIP_CHECK(sort(d_temporary_storage, temporary_storage_bytes));
+
+        std::vector<key_type> keys_output(size);
+        HIP_CHECK(hipMemcpy(keys_output.data(),
+                            d_keys_output,
+                            size * sizeof(key_type),
+                            hipMemcpyDeviceToHost));
+
+        HIP_CHECK(hipFree(d_temporary_storage));
+        HIP_CHECK(hipFree(d_keys_input));
+        HIP_CHECK(hipFree(d_keys_output));
+
+        for(size_t i = 0; i < size; i++)
+        {
+            SCOPED_TRACE(testing::Message() << "with index = " << i);
+            if(nans_last && std::isnan(keys_expected[i]))
+            {
+                // NaN keys are canonicalised
+                ASSERT_TRUE(std::isnan(keys_output[i]));
+            }
+            else
+            {
+                ASSERT_EQ(ordered_bits(keys_output[i]), ordered_bits(keys_expected[i]));
+            }
+        }
+    }
+}
+
+struct decomposed_key
+{
+    unsigned int   shard;
+    float          score;
+    unsigned short tag;
+};
+
+struct decomposed_key_decomposer
+{
+    ROCPRIM_HOST_DEVICE
+    rocprim::tuple<unsigned int&, float&, unsigned short&> operator()(decomposed_key& key) const
+    {
+        return rocprim::tie(key.shard, key.score, key.tag);
+    }
+};
+
+template<bool Descending>
+inline void sort_decomposed_keys()
+{
+    using key_type                          = decomposed_key;
+    using value_type                        = unsigned int;
+    constexpr hipStream_t stream            = 0;
+    constexpr bool        debug_synchronous = false;
+
+    const int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : {size_t(0), size_t(100), size_t(5000), size_t(100000)})
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Few different values of every field, so all fields are compared
+            const std::vector<unsigned int> shards
+                = test_utils::get_random_data<unsigned int>(size, 0u, 7u, seed_value);
+            const std::vector<float> scores
+                = test_utils::get_random_data<float>(size, -4.0f, 4.0f, seed_value + 1);
+            const std::vector<unsigned short> tags
+                = test_utils::get_random_data<unsigned short>(size,
+                                                              static_cast<unsigned short>(0),
+                                                              static_cast<unsigned short>(3),
+                                                              seed_value + 2);
+            std::vector<key_type>   keys_input(size);
+            std::vector<value_type> values_input(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                // Quantize scores to have equal ones
+                keys_input[i]   = {shards[i], std::round(scores[i] * 4.0f) / 4.0f, tags[i]};
+                values_input[i] = static_cast<value_type>(i);
+            }
+
+            auto as_tuple = [](const key_type& key)
+            { return std::make_tuple(key.shard, key.score, key.tag); };
+            std::vector<value_type> values_expected(values_input);
+            std::stable_sort(values_expected.begin(),
+                             values_expected.end(),
+                             [&](const value_type& a, const value_type& b)
+                             {
+                                 return Descending
+                                            ? as_tuple(keys_input[b]) < as_tuple(keys_input[a])
+                                            : as_tuple(keys_input[a]) < as_tuple(keys_input[b]);
+                             });
+
+            key_type*   d_keys_input;
+            key_type*   d_keys_output;
+            value_type* d_values_input;
+            value_type* d_values_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(key_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_values_input, size * sizeof(value_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_values_output, size * sizeof(value_type)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values_input,
+                                values_input.data(),
+                                size * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+
+            for(bool with_values : {false, true})
+            {
+                SCOPED_TRACE(testing::Message() << "with values = " << with_values);
+
+                auto sort = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+                {
+                    if(with_values)
+                    {
+                        return Descending
+                                   ? rocprim::radix_sort_pairs_desc(d_temporary_storage,
+                                                                    temporary_storage_bytes,
+                                                                    d_keys_input,
+                                                                    d_keys_output,
+                                                                    d_values_input,
+                                                                    d_values_output,
+                                                                    size,
+                                                                    decomposed_key_decomposer{},
+                                                                    stream,
+                                                                    debug_synchronous)
+                                   : rocprim::radix_sort_pairs(d_temporary_storage,
+                                                               temporary_storage_bytes,
+                                                               d_keys_input,
+                                                               d_keys_output,
+                                                               d_values_input,
+                                                               d_values_output,
+                                                               size,
+                                                               decomposed_key_decomposer{},
+                                                               stream,
+                                                               debug_synchronous);
+                    }
+                    return Descending
+                               ? rocprim::radix_sort_keys_desc(d_temporary_storage,
+                                                               temporary_storage_bytes,
+                                                               d_keys_input,
+                                                               d_keys_output,
+                                                               size,
+                                                               decomposed_key_decomposer{},
+                                                               stream,
+                                                               debug_synchronous)
+                               : rocprim::radix_sort_keys(d_temporary_storage,
+                                                          temporary_storage_bytes,
+                                                          d_keys_input,
+                                                          d_keys_output,
+                                                          size,
+                                                          decomposed_key_decomposer{},
+                                                          stream,
+                                                          debug_synchronous);
+                };
+
+                size_t temporary_storage_bytes;
+                HIP_CHECK(sort(nullptr, temporary_storage_bytes));
+                ASSERT_GT(temporary_storage_bytes, 0);
+
+                void* d_temporary_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                             temporary_storage_bytes));
+                HIP_CHECK(sort(d_temporary_storage, temporary_storage_bytes));
+                HIP_CHECK(hipFree(d_temporary_storage));
+
+                std::vector<key_type>   keys_output(size);
+                std::vector<value_type> values_output(size);
+                HIP_CHECK(hipMemcpy(keys_output.data(),
+                                    d_keys_output,
+                                    size * sizeof(key_type),
+                                    hipMemcpyDeviceToHost));
+                if(with_values)
+                {
+                    HIP_CHECK(hipMemcpy(values_output.data(),
+                                        d_values_output,
+                                        size * sizeof(value_type),
+                                        hipMemcpyDeviceToHost));
+                }
+
+                for(size_t i = 0; i < size; i++)
+                {
+                    SCOPED_TRACE(testing::Message() << "with index = " << i);
+                    const key_type& expected = keys_input[values_expected[i]];
+                    ASSERT_EQ(keys_output[i].shard, expected.shard);
+                    ASSERT_EQ(keys_output[i].score, expected.score);
+                    ASSERT_EQ(keys_output[i].tag, expected.tag);
+                    if(with_values)
+                    {
+                        ASSERT_EQ(values_output[i], values_expected[i]);
+                    }
+                }
+            }
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_values_output));
+        }
+    }
+}
+
+// Large inputs of 32-bit keys and values are sorted as packed 64-bit words
+template<class Key, rocprim::radix_float_order FloatOrder, bool Descending>
+inline void sort_pairs_packed()
+{
+    using key_type                          = Key;
+    using value_type                        = unsigned int;
+    using bits_type                         = uint32_t;
+    constexpr hipStream_t stream            = 0;
+    constexpr bool        debug_synchronous = false;
+
+    const int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // Larger than the limit of the merge sort
+        for(size_t size : {(size_t(1) << 22) + 1357, size_t(1) << 23})
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Few different keys, so the order of the values shows whether the sort is stable
+            std::vector<key_type> keys_input
+                = test_utils::get_random_data<key_type>(size,
+                                                        static_cast<key_type>(-50),
+                                                        static_cast<key_type>(50),
+                                                        seed_value);
+            std::vector<value_type> values_input(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                if(std::is_floating_point<key_type>::value)
+                {
+                    keys_input[i] = i % 5 == 0 ? static_cast<key_type>(-0.0f)
+                                               : static_cast<key_type>(std::round(keys_input[i]));
+                }
+                values_input[i] = static_cast<value_type>(i);
+            }
+
+            // The bits of a key mapped to an unsigned integer that preserves the order of
+            // integers and IEEE 754 totalOrder of floating-point values
+            auto ordered_bits = [](const key_type key)
+            {
+                bits_type bits;
+                std::memcpy(&bits, &key, sizeof(bits));
+                if(std::is_floating_point<key_type>::value)
+                {
+                    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+                }
+                return bits ^ 0x80000000u;
+            };
+            std::vector<value_type> values_expected(values_input);
+            std::stable_sort(values_expected.begin(),
+                             values_expected.end(),
+                             [&](const value_type& a, const value_type& b)
+                             {
+                                 return Descending ? ordered_bits(keys_input[b])
+                                                         < ordered_bits(keys_input[a])
+                                                   : ordered_bits(keys_input[a])
+                                                         < ordered_bits(keys_input[b]);
+                             });
+
+            key_type*   d_keys_input;
+            key_type*   d_keys_output;
+            value_type* d_values_input;
+            value_type* d_values_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(key_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_values_input, size * sizeof(value_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_values_output, size * sizeof(value_type)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values_input,
+                                values_input.data(),
+                                size * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+
+            auto sort = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+            {
+                return Descending
+                           ? rocprim::radix_sort_pairs_desc<rocprim::default_config, FloatOrder>(
+                               d_temporary_storage,
+                               temporary_storage_bytes,
+                               d_keys_input,
+                               d_keys_output,
+                               d_values_input,
+                               d_values_output,
+                               size,
+                               0,
+                               sizeof(key_type) * 8,
+                               stream,
+                               debug_synchronous)
+                           : rocprim::radix_sort_pairs<rocprim::default_config, FloatOrder>(
+                               d_temporary_storage,
+                               temporary_storage_bytes,
+                               d_keys_input,
+                               d_keys_output,
+                               d_values_input,
+                               d_values_output,
+                               size,
+                               0,
+                               sizeof(key_type) * 8,
+                               stream,
+                               debug_synchronous);
+            };
+
+            size_t temporary_storage_bytes;
+            HIP_CHECK(sort(nullptr, temporary_storage_bytes));
+            ASSERT_GT(temporary_storage_bytes, 0);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(sort(d_temporary_storage, temporary_storage_bytes));
+
+            std::vector<key_type>   keys_output(size);
+            std::vector<value_type> values_output(size);
+            HIP_CHECK(hipMemcpy(keys_output.data(),
+                                d_keys_output,
+                                size * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(values_output.data(),
+                                d_values_output,
+                                size * sizeof(value_type),
+                                hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_values_output));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, values_expected));
+            for(size_t i = 0; i < size; i++)
+            {
+                ASSERT_EQ(ordered_bits(keys_output[i]),
+                          ordered_bits(keys_input[values_expected[i]]))
+                    << "where index = " << i;
+            }
+        }
+    }
+}
+
 #endif // TEST_DEVICE_RADIX_SORT_HPP_
+
+// The storage bound is not smaller than the queried storage of any sort of at most max_size items
+template<class Key, class Value, class Config>
+inline void sort_storage_bound()
+{
+    using key_type   = Key;
+    using value_type = Value;
+
+    constexpr unsigned int key_bits   = sizeof(key_type) * 8;
+    const size_t           max_size   = (size_t(1) << 23) + 123;
+    const size_t           keys_bound = rocprim::radix_sort_keys_storage_bound<key_type, Config>(
+        max_size);
+    const size_t pairs_bound
+        = rocprim::radix_sort_pairs_storage_bound<key_type, value_type, Config>(max_size);
+    ASSERT_GT(keys_bound, 0);
+    ASSERT_GT(pairs_bound, 0);
+
+    for(size_t size : {size_t(0),
+                       size_t(1),
+                       size_t(1000),
+                       size_t(4096),
+                       size_t(4097),
+                       size_t(1) << 16,
+                       (size_t(1) << 16) + 1,
+                       size_t(1) << 20,
+                       (size_t(1) << 22) + 1357,
+                       max_size})
+    {
+        SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+        for(unsigned int end_bit : {key_bits, key_bits - 1, key_bits / 2})
+        {
+            SCOPED_TRACE(testing::Message() << "with end_bit = " << end_bit);
+
+            size_t storage_size;
+            HIP_CHECK(rocprim::radix_sort_keys<Config>(nullptr,
+                                                       storage_size,
+                                                       static_cast<key_type*>(nullptr),
+                                                       static_cast<key_type*>(nullptr),
+                                                       size,
+                                                       0,
+                                                       end_bit));
+            ASSERT_LE(storage_size, keys_bound);
+
+            HIP_CHECK(rocprim::radix_sort_keys_desc<Config>(nullptr,
+                                                            storage_size,
+                                                            static_cast<key_type*>(nullptr),
+                                                            static_cast<key_type*>(nullptr),
+                                                            static_cast<unsigned int>(size),
+                                                            1,
+                                                            end_bit));
+            ASSERT_LE(storage_size, keys_bound);
+
+            HIP_CHECK(rocprim::radix_sort_pairs<Config>(nullptr,
+                                                        storage_size,
+                                                        static_cast<key_type*>(nullptr),
+                                                        static_cast<key_type*>(nullptr),
+                                                        static_cast<value_type*>(nullptr),
+                                                        static_cast<value_type*>(nullptr),
+                                                        size,
+                                                        0,
+                                                        end_bit));
+            ASSERT_LE(storage_size, pairs_bound);
+
+            if(rocprim::is_floating_point<key_type>::value)
+            {
+                HIP_CHECK((rocprim::radix_sort_pairs<Config,
+                                                     rocprim::radix_float_order::total_order>(
+                    nullptr,
+                    storage_size,
+                    static_cast<key_type*>(nullptr),
+                    static_cast<key_type*>(nullptr),
+                    static_cast<value_type*>(nullptr),
+                    static_cast<value_type*>(nullptr),
+                    size,
+                    0,
+                    end_bit)));
+                ASSERT_LE(storage_size, pairs_bound);
+            }
+        }
+    }
+}
+
+// Large inputs of large values are sorted as (key, index) pairs and the values are gathered
+template<class Config, bool InPlace>
+inline void sort_pairs_indirect()
+{
+    using key_type                          = int;
+    using value_type                        = test_utils::custom_test_array_type<long long, 4>;
+    constexpr hipStream_t stream            = 0;
+    constexpr bool        debug_synchronous = false;
+
+    const int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // Larger than the limit of the merge sort
+        for(size_t size : {(size_t(1) << 22) + 1357, size_t(1) << 23})
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Few different keys, so the order of the values shows whether the sort is stable
+            std::vector<key_type> keys_input
+                = test_utils::get_random_data<key_type>(size, -1000, 1000, seed_value);
+            std::vector<value_type> values_input(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                values_input[i] = value_type(static_cast<long long>(i));
+            }
+
+            std::vector<size_t> indices(size);
+            std::iota(indices.begin(), indices.end(), 0);
+            std::stable_sort(indices.begin(),
+                             indices.end(),
+                             [&](const size_t a, const size_t b)
+                             { return keys_input[a] < keys_input[b]; });
+
+            key_type*   d_keys_input;
+            key_type*   d_keys_output;
+            value_type* d_values_input;
+            value_type* d_values_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(key_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_values_input, size * sizeof(value_type)));
+            if(InPlace)
+            {
+                d_values_output = d_values_input;
+            }
+            else
+            {
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output,
+                                                             size * sizeof(value_type)));
+            }
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values_input,
+                                values_input.data(),
+                                size * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+
+            size_t temporary_storage_bytes;
+            HIP_CHECK(rocprim::radix_sort_pairs<Config>(nullptr,
+                                                        temporary_storage_bytes,
+                                                        d_keys_input,
+                                                        d_keys_output,
+                                                        d_values_input,
+                                                        d_values_output,
+                                                        size,
+                                                        0,
+                                                        sizeof(key_type) * 8,
+                                                        stream,
+                                                        debug_synchronous));
+            ASSERT_GT(temporary_storage_bytes, 0);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(rocprim::radix_sort_pairs<Config>(d_temporary_storage,
+                                                        temporary_storage_bytes,
+                                                        d_keys_input,
+                                                        d_keys_output,
+                                                        d_values_input,
+                                                        d_values_output,
+                                                        size,
+                                                        0,
+                                                        sizeof(key_type) * 8,
+                                                        stream,
+                                                        debug_synchronous));
+
+            std::vector<key_type>   keys_output(size);
+            std::vector<value_type> values_output(size);
+            HIP_CHECK(hipMemcpy(keys_output.data(),
+                                d_keys_output,
+                                size * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(values_output.data(),
+                                d_values_output,
+                                size * sizeof(value_type),
+                                hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_values_input));
+            if(!InPlace)
+            {
+                HIP_CHECK(hipFree(d_values_output));
+            }
+
+            for(size_t i = 0; i < size; i++)
+            {
+                ASSERT_EQ(keys_output[i], keys_input[indices[i]]) << "with index = " << i;
+                ASSERT_EQ(values_output[i], values_input[indices[i]]) << "with index = " << i;
+            }
+        }
+    }
+}
@@ -0,0 +1,324 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_radix_sort_in_place.hpp>
+
+// required test headers
+#include "test_utils_sort_comparator.hpp"
+#include "test_utils_types.hpp"
+
+template<class Key, class Value, bool Descending = false>
+struct params
+{
+    using key_type                   = Key;
+    using value_type                 = Value;
+    static constexpr bool descending = Descending;
+};
+
+template<class Params>
+class RocprimDeviceRadixSortInPlace : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<params<int, int>,
+                         params<int, int, true>,
+                         params<unsigned char, int>,
+                         params<long long, short, true>,
+                         params<float, int>,
+                         params<double, long long, true>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimDeviceRadixSortInPlace, Params);
+
+// Few distinct keys make groups of equal keys that do not fit into the scratch
+template<class Key>
+inline std::vector<Key>
+    get_in_place_input(const size_t size, const bool few_keys, const unsigned int seed_value)
+{
+    if(few_keys)
+    {
+        const std::vector<int> digits = test_utils::get_random_data<int>(size, 0, 4, seed_value);
+        return std::vector<Key>(digits.begin(), digits.end());
+    }
+    if(rocprim::is_floating_point<Key>::value)
+    {
+        return test_utils::get_random_data<Key>(size,
+                                                static_cast<Key>(-1000),
+                                                static_cast<Key>(+1000),
+                                                seed_value);
+    }
+    return test_utils::get_random_data<Key>(size,
+                                            std::numeric_limits<Key>::min(),
+                                            std::numeric_limits<Key>::max(),
+                                            seed_value);
+}
+
+inline std::vector<size_t> get_scratch_sizes(const size_t size)
+{
+    return {size / 10, size / 3, size};
+}
+
+TYPED_TEST(RocprimDeviceRadixSortInPlace, SortKeysInPlace)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type            = typename TestFixture::params::key_type;
+    constexpr bool descending = TestFixture::params::descending;
+
+    hipStream_t stream = 0;
+
+    const bool debug_synchronous = false;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            for(bool few_keys : {false, true})
+            {
+                SCOPED_TRACE(testing::Message() << "with few_keys = " << few_keys);
+
+                const std::vector<key_type> keys_input
+                    = get_in_place_input<key_type>(size, few_keys, seed_value);
+
+                std::vector<key_type> expected(keys_input);
+                std::stable_sort(
+                    expected.begin(),
+                    expected.end(),
+                    test_utils::key_comparator<key_type, descending, 0, sizeof(key_type) * 8>());
+
+                key_type* d_keys;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, size * sizeof(key_type)));
+
+                for(size_t scratch_size : get_scratch_sizes(size))
+                {
+                    SCOPED_TRACE(testing::Message() << "with scratch_size = " << scratch_size);
+
+                    HIP_CHECK(hipMemcpy(d_keys,
+                                        keys_input.data(),
+                                        size * sizeof(key_type),
+                                        hipMemcpyHostToDevice));
+
+                    size_t temporary_storage_bytes;
+                    HIP_CHECK(rocprim::radix_sort_keys_in_place(nullptr,
+                                                                temporary_storage_bytes,
+                                                                d_keys,
+                                                                size,
+                                                                scratch_size));
+
+                    ASSERT_GT(temporary_storage_bytes, 0);
+
+                    void* d_temporary_storage;
+                    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                                 temporary_storage_bytes));
+
+                    if(descending)
+                    {
+                        HIP_CHECK(rocprim::radix_sort_keys_in_place_desc(d_temporary_storage,
+                                                                         temporary_storage_bytes,
+                                                                         d_keys,
+                                                                         size,
+                                                                         scratch_size,
+                                                                         0,
+                                                                         sizeof(key_type) * 8,
+                                                                         stream,
+                                                                         debug_synchronous));
+                    }
+                    else
+                    {
+                        HIP_CHECK(rocprim::radix_sort_keys_in_place(d_temporary_storage,
+                                                                    temporary_storage_bytes,
+                                                                    d_keys,
+                                                                    size,
+                                                                    scratch_size,
+                                                                    0,
+                                                                    sizeof(key_type) * 8,
+                                                                    stream,
+                                                                    debug_synchronous));
+                    }
+
+                    std::vector<key_type> keys_output(size);
+                    HIP_CHECK(hipMemcpy(keys_output.data(),
+                                        d_keys,
+                                        size * sizeof(key_type),
+                                        hipMemcpyDeviceToHost));
+
+                    HIP_CHECK(hipFree(d_temporary_storage));
+
+                    ASSERT_NO_FATAL_FAILURE(test_utils::assert_bit_eq(keys_output, expected));
+                }
+
+                HIP_CHECK(hipFree(d_keys));
+            }
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceRadixSortInPlace, SortPairsInPlace)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type            = typename TestFixture::params::key_type;
+    using value_type          = typename TestFixture::params::value_type;
+    constexpr bool descending = TestFixture::params::descending;
+
+    hipStream_t stream = 0;
+
+    const bool debug_synchronous = false;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            for(bool few_keys : {false, true})
+            {
+                SCOPED_TRACE(testing::Message() << "with few_keys = " << few_keys);
+
+                const std::vector<key_type> keys_input
+                    = get_in_place_input<key_type>(size, few_keys, seed_value);
+
+                std::vector<value_type> values_input(size);
+                test_utils::iota(values_input.begin(), values_input.end(), 0);
+
+                // Values are the indices of the keys, equal keys must keep their order
+                using key_value = std::pair<key_type, value_type>;
+                std::vector<key_value> expected(size);
+                for(size_t i = 0; i < size; i++)
+                {
+                    expected[i] = key_value(keys_input[i], values_input[i]);
+                }
+                constexpr unsigned int end_bit = sizeof(key_type) * 8;
+                std::stable_sort(expected.begin(),
+                                 expected.end(),
+                                 test_utils::
+                                     key_value_comparator<key_type, value_type, descending, 0, end_bit>());
+                std::vector<key_type>   keys_expected(size);
+                std::vector<value_type> values_expected(size);
+                for(size_t i = 0; i < size; i++)
+                {
+                    keys_expected[i]   = expected[i].first;
+                    values_expected[i] = expected[i].second;
+                }
+
+                key_type*   d_keys;
+                value_type* d_values;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, size * sizeof(key_type)));
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_values, size * sizeof(value_type)));
+
+                for(size_t scratch_size : get_scratch_sizes(size))
+                {
+                    SCOPED_TRACE(testing::Message() << "with scratch_size = " << scratch_size);
+
+                    HIP_CHECK(hipMemcpy(d_keys,
+                                        keys_input.data(),
+                                        size * sizeof(key_type),
+                                        hipMemcpyHostToDevice));
+                    HIP_CHECK(hipMemcpy(d_values,
+                                        values_input.data(),
+                                        size * sizeof(value_type),
+                                        hipMemcpyHostToDevice));
+
+                    size_t temporary_storage_bytes;
+                    HIP_CHECK(rocprim::radix_sort_pairs_in_place(nullptr,
+                                                                 temporary_storage_bytes,
+                                                                 d_keys,
+                                                                 d_values,
+                                                                 size,
+                                                                 scratch_size));
+
+                    ASSERT_GT(temporary_storage_bytes, 0);
+
+                    void* d_temporary_storage;
+                    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                                 temporary_storage_bytes));
+
+                    if(descending)
+                    {
+                        HIP_CHECK(rocprim::radix_sort_pairs_in_place_desc(d_temporary_storage,
+                                                                          temporary_storage_bytes,
+                                                                          d_keys,
+                                                                          d_values,
+                                                                          size,
+                                                                          scratch_size,
+                                                                          0,
+                                                                          end_bit,
+                                                                          stream,
+                                                                          debug_synchronous));
+                    }
+                    else
+                    {
+                        HIP_CHECK(rocprim::radix_sort_pairs_in_place(d_temporary_storage,
+                                                                     temporary_storage_bytes,
+                                                                     d_keys,
+                                                                     d_values,
+                                                                     size,
+                                                                     scratch_size,
+                                                                     0,
+                                                                     end_bit,
+                                                                     stream,
+                                                                     debug_synchronous));
+                    }
+
+                    std::vector<key_type>   keys_output(size);
+                    std::vector<value_type> values_output(size);
+                    HIP_CHECK(hipMemcpy(keys_output.data(),
+                                        d_keys,
+                                        size * sizeof(key_type),
+                                        hipMemcpyDeviceToHost));
+                    HIP_CHECK(hipMemcpy(values_output.data(),
+                                        d_values,
+                                        size * sizeof(value_type),
+                                        hipMemcpyDeviceToHost));
+
+                    HIP_CHECK(hipFree(d_temporary_storage));
+
+                    ASSERT_NO_FATAL_FAILURE(test_utils::assert_bit_eq(keys_output, keys_expected));
+                    ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, values_expected));
+                }
+
+                HIP_CHECK(hipFree(d_keys));
+                HIP_CHECK(hipFree(d_values));
+            }
+        }
+    }
+}
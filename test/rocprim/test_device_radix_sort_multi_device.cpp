@@ -0,0 +1,261 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+#include <limits>
+
+// required rocprim headers
+#include <rocprim/device/device_radix_sort_multi_device.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+template<class Key, unsigned int DeviceCount>
+struct params
+{
+    using key_type                             = Key;
+    static constexpr unsigned int device_count = DeviceCount;
+};
+
+template<class Params>
+class RocprimMultiDeviceRadixSortTests : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<params<int, 1>,
+                         params<int, 3>,
+                         params<unsigned long long, 4>,
+                         params<float, 2>,
+                         params<unsigned char, 3>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimMultiDeviceRadixSortTests, Params);
+
+TYPED_TEST(RocprimMultiDeviceRadixSortTests, SortPairs)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type                      = typename TestFixture::params::key_type;
+    using value_type                    = unsigned int;
+    constexpr unsigned int device_count = TestFixture::params::device_count;
+
+    // The parts are placed on the device of the test, the copies between them are the same as
+    // between different devices
+    const std::vector<int> devices(device_count, device_id);
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        std::vector<size_t> sizes
+            = test_utils::get_random_data<size_t>(device_count, 0, 100000, seed_value);
+        // Small and empty parts
+        sizes[0] = std::min(sizes[0], size_t(100));
+        if(device_count > 2)
+        {
+            sizes[device_count - 1] = 0;
+        }
+        const size_t total_size = std::accumulate(sizes.begin(), sizes.end(), size_t(0));
+        // Many equal keys for the narrow types, they are not split between devices
+        const std::vector<size_t> capacities(device_count, total_size);
+
+        std::vector<std::pair<key_type, value_type>> expected;
+        std::vector<key_type*>                       d_keys_input(device_count);
+        std::vector<key_type*>                       d_keys_output(device_count);
+        std::vector<value_type*>                     d_values_input(device_count);
+        std::vector<value_type*>                     d_values_output(device_count);
+        for(unsigned int d = 0; d < device_count; d++)
+        {
+            const std::vector<key_type> keys = test_utils::get_random_data<key_type>(
+                sizes[d],
+                std::is_floating_point<key_type>::value ? key_type(-1000)
+                                                        : std::numeric_limits<key_type>::min(),
+                std::is_floating_point<key_type>::value ? key_type(1000)
+                                                        : std::numeric_limits<key_type>::max(),
+                seed_value + d + 1);
+            std::vector<value_type> values(sizes[d]);
+            std::iota(values.begin(), values.end(), value_type(expected.size()));
+            for(size_t i = 0; i < sizes[d]; i++)
+            {
+                expected.emplace_back(keys[i], values[i]);
+            }
+
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input[d],
+                                                         std::max(sizes[d], size_t(1))
+                                                             * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input[d],
+                                                         std::max(sizes[d], size_t(1))
+                                                             * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output[d],
+                                                         capacities[d] * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output[d],
+                                                         capacities[d] * sizeof(value_type)));
+            HIP_CHECK(hipMemcpy(d_keys_input[d],
+                                keys.data(),
+                                sizes[d] * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values_input[d],
+                                values.data(),
+                                sizes[d] * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+        }
+        // The values hold the global positions of the keys, so the expected order is unique
+        std::stable_sort(expected.begin(),
+                         expected.end(),
+                         [](const std::pair<key_type, value_type>& a,
+                            const std::pair<key_type, value_type>& b)
+                         { return a.first < b.first; });
+
+        std::vector<size_t> storage_sizes(device_count);
+        std::vector<size_t> output_sizes(device_count);
+        HIP_CHECK(rocprim::multi_device_radix_sort_pairs(nullptr,
+                                                         storage_sizes.data(),
+                                                         devices.data(),
+                                                         device_count,
+                                                         d_keys_input.data(),
+                                                         d_keys_output.data(),
+                                                         d_values_input.data(),
+                                                         d_values_output.data(),
+                                                         sizes.data(),
+                                                         capacities.data(),
+                                                         output_sizes.data()));
+        std::vector<void*> d_temporary_storage(device_count);
+        for(unsigned int d = 0; d < device_count; d++)
+        {
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage[d], storage_sizes[d]));
+        }
+
+        HIP_CHECK(rocprim::multi_device_radix_sort_pairs(d_temporary_storage.data(),
+                                                         storage_sizes.data(),
+                                                         devices.data(),
+                                                         device_count,
+                                                         d_keys_input.data(),
+                                                         d_keys_output.data(),
+                                                         d_values_input.data(),
+                                                         d_values_output.data(),
+                                                         sizes.data(),
+                                                         capacities.data(),
+                                                         output_sizes.data()));
+        HIP_CHECK(hipGetLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        // The outputs of the devices are consecutive ranges of the sorted pairs
+        ASSERT_EQ(std::accumulate(output_sizes.begin(), output_sizes.end(), size_t(0)),
+                  total_size);
+        size_t offset = 0;
+        for(unsigned int d = 0; d < device_count; d++)
+        {
+            std::vector<key_type>   keys_output(output_sizes[d]);
+            std::vector<value_type> values_output(output_sizes[d]);
+            HIP_CHECK(hipMemcpy(keys_output.data(),
+                                d_keys_output[d],
+                                output_sizes[d] * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(values_output.data(),
+                                d_values_output[d],
+                                output_sizes[d] * sizeof(value_type),
+                                hipMemcpyDeviceToHost));
+            for(size_t i = 0; i < output_sizes[d]; i++)
+            {
+                ASSERT_EQ(keys_output[i], expected[offset + i].first)
+                    << "where device = " << d << ", index = " << i;
+                ASSERT_EQ(values_output[i], expected[offset + i].second)
+                    << "where device = " << d << ", index = " << i;
+            }
+            offset += output_sizes[d];
+
+            HIP_CHECK(hipFree(d_temporary_storage[d]));
+            HIP_CHECK(hipFree(d_keys_input[d]));
+            HIP_CHECK(hipFree(d_keys_output[d]));
+            HIP_CHECK(hipFree(d_values_input[d]));
+            HIP_CHECK(hipFree(d_values_output[d]));
+        }
+    }
+}
+
+TEST(RocprimMultiDeviceRadixSortTests, InsufficientCapacity)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    // All keys are equal, they go to one device
+    constexpr size_t size = 1000;
+    const int        devices[2] = {device_id, device_id};
+    const size_t     sizes[2]   = {size, size};
+    const size_t     capacities[2] = {size, size};
+
+    int* d_keys[2];
+    int* d_values[2];
+    for(int d = 0; d < 2; d++)
+    {
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys[d], size * sizeof(int)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_values[d], size * sizeof(int)));
+        HIP_CHECK(hipMemset(d_keys[d], 0, size * sizeof(int)));
+    }
+
+    size_t storage_sizes[2];
+    size_t output_sizes[2];
+    HIP_CHECK(rocprim::multi_device_radix_sort_pairs(nullptr,
+                                                     storage_sizes,
+                                                     devices,
+                                                     2,
+                                                     d_keys,
+                                                     d_keys,
+                                                     d_values,
+                                                     d_values,
+                                                     sizes,
+                                                     capacities,
+                                                     output_sizes));
+    void* d_temporary_storage[2];
+    for(int d = 0; d < 2; d++)
+    {
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage[d], storage_sizes[d]));
+    }
+    ASSERT_EQ(rocprim::multi_device_radix_sort_pairs(d_temporary_storage,
+                                                     storage_sizes,
+                                                     devices,
+                                                     2,
+                                                     d_keys,
+                                                     d_keys,
+                                                     d_values,
+                                                     d_values,
+                                                     sizes,
+                                                     capacities,
+                                                     output_sizes),
+              hipErrorInvalidValue);
+
+    for(int d = 0; d < 2; d++)
+    {
+        HIP_CHECK(hipFree(d_temporary_storage[d]));
+        HIP_CHECK(hipFree(d_keys[d]));
+        HIP_CHECK(hipFree(d_values[d]));
+    }
+}
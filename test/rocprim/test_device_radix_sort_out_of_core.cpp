@@ -0,0 +1,190 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+#include <limits>
+
+// required rocprim headers
+#include <rocprim/device/device_radix_sort_out_of_core.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+template<class Key, class Value>
+struct params
+{
+    using key_type   = Key;
+    using value_type = Value;
+};
+
+template<class Params>
+class RocprimDeviceRadixSortOutOfCoreTests : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<params<int, unsigned int>,
+                         params<unsigned long long, unsigned int>,
+                         params<float, unsigned long long>,
+                         params<unsigned char, unsigned int>,
+                         params<short, unsigned int>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimDeviceRadixSortOutOfCoreTests, Params);
+
+template<class T>
+T* allocate_host(const size_t size)
+{
+    T* ptr;
+    HIP_CHECK(hipHostMalloc(&ptr, std::max(size, size_t(1)) * sizeof(T)));
+    return ptr;
+}
+
+TYPED_TEST(RocprimDeviceRadixSortOutOfCoreTests, SortPairs)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type   = typename TestFixture::params::key_type;
+    using value_type = typename TestFixture::params::value_type;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // A single chunk, a few chunks, many small chunks and a partial last chunk
+        const std::vector<std::pair<size_t, size_t>> sizes_and_chunks = {
+            {     0,    16},
+            {  1000,  4096},
+            {100000, 25000},
+            { 54321,  1000},
+            { 65536,   256},
+        };
+        for(const auto& size_and_chunk : sizes_and_chunks)
+        {
+            const size_t size       = size_and_chunk.first;
+            const size_t chunk_size = size_and_chunk.second;
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+            SCOPED_TRACE(testing::Message() << "with chunk_size = " << chunk_size);
+
+            const std::vector<key_type> keys = test_utils::get_random_data<key_type>(
+                size,
+                std::is_floating_point<key_type>::value ? key_type(-1000)
+                                                        : std::numeric_limits<key_type>::min(),
+                std::is_floating_point<key_type>::value ? key_type(1000)
+                                                        : std::numeric_limits<key_type>::max(),
+                seed_value);
+
+            key_type*   keys_input    = allocate_host<key_type>(size);
+            key_type*   keys_runs     = allocate_host<key_type>(size);
+            key_type*   keys_output   = allocate_host<key_type>(size);
+            value_type* values_input  = allocate_host<value_type>(size);
+            value_type* values_runs   = allocate_host<value_type>(size);
+            value_type* values_output = allocate_host<value_type>(size);
+            std::copy(keys.begin(), keys.end(), keys_input);
+            std::iota(values_input, values_input + size, value_type(0));
+
+            // The values hold the positions of the keys, so the expected order is unique
+            std::vector<std::pair<key_type, value_type>> expected(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                expected[i] = {keys_input[i], values_input[i]};
+            }
+            std::stable_sort(expected.begin(),
+                             expected.end(),
+                             [](const std::pair<key_type, value_type>& a,
+                                const std::pair<key_type, value_type>& b)
+                             { return a.first < b.first; });
+
+            size_t temporary_storage_bytes;
+            HIP_CHECK(rocprim::radix_sort_pairs_out_of_core(nullptr,
+                                                            temporary_storage_bytes,
+                                                            keys_input,
+                                                            keys_runs,
+                                                            keys_output,
+                                                            values_input,
+                                                            values_runs,
+                                                            values_output,
+                                                            size,
+                                                            chunk_size,
+                                                            stream));
+            ASSERT_GT(temporary_storage_bytes, size_t(0));
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(rocprim::radix_sort_pairs_out_of_core(d_temporary_storage,
+                                                            temporary_storage_bytes,
+                                                            keys_input,
+                                                            keys_runs,
+                                                            keys_output,
+                                                            values_input,
+                                                            values_runs,
+                                                            values_output,
+                                                            size,
+                                                            chunk_size,
+                                                            stream));
+            HIP_CHECK(hipGetLastError());
+
+            for(size_t i = 0; i < size; i++)
+            {
+                ASSERT_EQ(keys_output[i], expected[i].first) << "where index = " << i;
+                ASSERT_EQ(values_output[i], expected[i].second) << "where index = " << i;
+            }
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipHostFree(keys_input));
+            HIP_CHECK(hipHostFree(keys_runs));
+            HIP_CHECK(hipHostFree(keys_output));
+            HIP_CHECK(hipHostFree(values_input));
+            HIP_CHECK(hipHostFree(values_runs));
+            HIP_CHECK(hipHostFree(values_output));
+        }
+    }
+}
+
+TEST(RocprimDeviceRadixSortOutOfCoreTests, TooManyChunks)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    size_t storage_size;
+    ASSERT_EQ(rocprim::radix_sort_pairs_out_of_core(nullptr,
+                                                    storage_size,
+                                                    static_cast<const int*>(nullptr),
+                                                    static_cast<int*>(nullptr),
+                                                    static_cast<int*>(nullptr),
+                                                    static_cast<const int*>(nullptr),
+                                                    static_cast<int*>(nullptr),
+                                                    static_cast<int*>(nullptr),
+                                                    size_t(1000),
+                                                    size_t(3)),
+              hipErrorInvalidValue);
+}
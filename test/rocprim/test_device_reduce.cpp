@@ -22,6 +22,10 @@
 
 #include "../common_test_header.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
 // required rocprim headers
 #include <rocprim/device/device_reduce.hpp>
 #include <rocprim/functional.hpp>
@@ -36,7 +40,8 @@ template<
     class InputType,
     class OutputType = InputType,
     bool UseIdentityIterator = false,
-    size_t SizeLimit = ROCPRIM_GRID_SIZE_LIMIT
+    size_t SizeLimit = ROCPRIM_GRID_SIZE_LIMIT,
+    bool SinglePass = false
 >
 struct DeviceReduceParams
 {
@@ -45,11 +50,12 @@ struct DeviceReduceParams
     // Tests output iterator with void value_type (OutputIterator concept)
     static constexpr bool use_identity_iterator = UseIdentityIterator;
     static constexpr size_t size_limit = SizeLimit;
+    static constexpr bool single_pass = SinglePass;
 };
 
-template <unsigned int SizeLimit>
+template <unsigned int SizeLimit, bool SinglePass = false>
 struct size_limit_config {
-    using type = rocprim::reduce_config<256, 16, rocprim::block_reduce_algorithm::default_algorithm, SizeLimit>;
+    using type = rocprim::reduce_config<256, 16, rocprim::block_reduce_algorithm::default_algorithm, SizeLimit, SinglePass>;
 };
 
 template <>
@@ -57,8 +63,8 @@ struct size_limit_config<ROCPRIM_GRID_SIZE_LIMIT> {
     using type = rocprim::default_config;
 };
 
-template <unsigned int SizeLimit>
-using size_limit_config_t = typename size_limit_config<SizeLimit>::type;
+template <unsigned int SizeLimit, bool SinglePass = false>
+using size_limit_config_t = typename size_limit_config<SizeLimit, SinglePass>::type;
 
 // ---------------------------------------------------------
 // Test for reduce ops taking single input value
@@ -73,6 +79,7 @@ public:
     const bool debug_synchronous = false;
     static constexpr bool use_identity_iterator = Params::use_identity_iterator;
     static constexpr size_t size_limit = Params::size_limit;
+    static constexpr bool single_pass = Params::single_pass;
 };
 
 template<class Params>
@@ -88,6 +95,9 @@ typedef ::testing::Types<
     DeviceReduceParams<int, int, false, 4096>,
     DeviceReduceParams<int, int, false, 2097152>,
     DeviceReduceParams<int, int, false, 1073741824>,
+    DeviceReduceParams<int, int, false, ROCPRIM_GRID_SIZE_LIMIT, true>,
+    DeviceReduceParams<float, double, true, ROCPRIM_GRID_SIZE_LIMIT, true>,
+    DeviceReduceParams<int, int, false, 2097152, true>,
     DeviceReduceParams<int8_t, int8_t>,
     DeviceReduceParams<uint8_t, uint8_t>,
     // #156 temporarily disable half test due to known issue with converting from double to half
@@ -117,7 +127,7 @@ TYPED_TEST(RocprimDeviceReduceTests, ReduceEmptyInput)
     using T = typename TestFixture::input_type;
     using U = typename TestFixture::output_type;
     const bool debug_synchronous = TestFixture::debug_synchronous;
-    using Config = size_limit_config_t<TestFixture::size_limit>;
+    using Config = size_limit_config_t<TestFixture::size_limit, TestFixture::single_pass>;
 
     hipStream_t stream = 0; // default stream
 
@@ -178,7 +188,7 @@ TYPED_TEST(RocprimDeviceReduceTests, ReduceSum)
 
     const bool debug_synchronous = TestFixture::debug_synchronous;
     static constexpr bool use_identity_iterator = TestFixture::use_identity_iterator;
-    using Config = size_limit_config_t<TestFixture::size_limit>;
+    using Config = size_limit_config_t<TestFixture::size_limit, TestFixture::single_pass>;
 
     for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
     {
@@ -276,6 +286,125 @@ TYPED_TEST(RocprimDeviceReduceTests, ReduceSum)
 
 }
 
+TYPED_TEST(RocprimDeviceReduceTests, ReduceSumFutureSize)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::input_type;
+    using U = typename TestFixture::output_type;
+
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+    static constexpr bool use_identity_iterator = TestFixture::use_identity_iterator;
+    using Config = size_limit_config_t<TestFixture::size_limit, TestFixture::single_pass>;
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto max_size : test_utils::get_sizes(seed_value))
+        {
+            if(test_utils::precision<U> * max_size > 0.5)
+            {
+                std::cout << "Test is skipped from size " << max_size
+                          << " on, potential error of summation is more than 0.5 of the result "
+                             "with current or larger size"
+                          << std::endl;
+                break;
+            }
+
+            hipStream_t stream = 0; // default
+
+            // Only a part of the input is reduced, the size is read on the device
+            const size_t size = max_size - max_size / 3;
+
+            SCOPED_TRACE(testing::Message() << "with max_size = " << max_size);
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data
+            std::vector<T> input = test_utils::get_random_data<T>(max_size, 0, 100, seed_value);
+            std::vector<U> output(1, U(0));
+
+            T * d_input;
+            U * d_output;
+            size_t * d_size;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input.size() * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, output.size() * sizeof(U)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_size, sizeof(size_t)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_input, input.data(),
+                    input.size() * sizeof(T),
+                    hipMemcpyHostToDevice
+                )
+            );
+            HIP_CHECK(hipMemcpy(d_size, &size, sizeof(size_t), hipMemcpyHostToDevice));
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Calculate expected results on host
+            U expected = test_utils::host_reduce(input.begin(), input.begin() + size, rocprim::plus<U>());
+            if(size == 0)
+                expected = U(0);
+
+            const auto future_size = rocprim::future_value<size_t>(d_size);
+
+            // temp storage
+            size_t temp_storage_size_bytes;
+            void * d_temp_storage = nullptr;
+            // Get size of d_temp_storage
+            HIP_CHECK(
+                rocprim::reduce<Config>(
+                    d_temp_storage, temp_storage_size_bytes,
+                    d_input,
+                    test_utils::wrap_in_identity_iterator<use_identity_iterator>(d_output),
+                    U(0), future_size, max_size, rocprim::plus<U>(), stream, debug_synchronous
+                )
+            );
+
+            // temp_storage_size_bytes must be >0
+            ASSERT_GT(temp_storage_size_bytes, 0);
+
+            // allocate temporary storage
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Run
+            HIP_CHECK(
+                rocprim::reduce<Config>(
+                    d_temp_storage, temp_storage_size_bytes,
+                    d_input,
+                    test_utils::wrap_in_identity_iterator<use_identity_iterator>(d_output),
+                    U(0), future_size, max_size, rocprim::plus<U>(), stream, debug_synchronous
+                )
+            );
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Copy output to host
+            HIP_CHECK(
+                hipMemcpy(
+                    output.data(), d_output,
+                    output.size() * sizeof(U),
+                    hipMemcpyDeviceToHost
+                )
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Check if output values are as expected
+            ASSERT_NO_FATAL_FAILURE(
+                test_utils::assert_near(output[0], expected, test_utils::precision<U> * size));
+
+            hipFree(d_input);
+            hipFree(d_output);
+            hipFree(d_size);
+            hipFree(d_temp_storage);
+        }
+    }
+
+}
+
 TYPED_TEST(RocprimDeviceReduceTests, ReduceMinimum)
 {
     int device_id = test_common_utils::obtain_device_from_ctest();
@@ -289,7 +418,7 @@ TYPED_TEST(RocprimDeviceReduceTests, ReduceMinimum)
 
     const bool debug_synchronous = TestFixture::debug_synchronous;
     static constexpr bool use_identity_iterator = TestFixture::use_identity_iterator;
-    using Config = size_limit_config_t<TestFixture::size_limit>;
+    using Config = size_limit_config_t<TestFixture::size_limit, TestFixture::single_pass>;
 
     for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
     {
@@ -417,7 +546,7 @@ TYPED_TEST(RocprimDeviceReduceTests, ReduceArgMinimum)
     using key_value = rocprim::key_value_pair<int, T>;
     const bool debug_synchronous = TestFixture::debug_synchronous;
     static constexpr bool use_identity_iterator = TestFixture::use_identity_iterator;
-    using Config = size_limit_config_t<TestFixture::size_limit>;
+    using Config = size_limit_config_t<TestFixture::size_limit, TestFixture::single_pass>;
 
     for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
     {
@@ -589,6 +718,378 @@ TEST(RocprimDeviceReduceTests, LargeIndices)
     }
 }
 
+TEST(RocprimDeviceReduceTests, ReduceHalfFloatAccumulation)
+{
+    const int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    const hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(const auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // The sums of large inputs do not fit in half, they are accumulated in fp32
+            const std::vector<rocprim::half> input
+                = test_utils::get_random_data<rocprim::half>(size, 0.0f, 1.0f, seed_value);
+            double expected = 0.0;
+            for(const rocprim::half value : input)
+            {
+                expected += static_cast<float>(value);
+            }
+
+            rocprim::half* d_input;
+            float*         d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         input.size() * sizeof(rocprim::half)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(float)));
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                input.size() * sizeof(rocprim::half),
+                                hipMemcpyHostToDevice));
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(rocprim::reduce(nullptr,
+                                      temp_storage_size_bytes,
+                                      d_input,
+                                      d_output,
+                                      size,
+                                      rocprim::plus<float>(),
+                                      stream));
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(rocprim::reduce(d_temp_storage,
+                                      temp_storage_size_bytes,
+                                      d_input,
+                                      d_output,
+                                      size,
+                                      rocprim::plus<float>(),
+                                      stream));
+            HIP_CHECK(hipGetLastError());
+
+            float output;
+            HIP_CHECK(hipMemcpy(&output, d_output, sizeof(float), hipMemcpyDeviceToHost));
+            ASSERT_NEAR(output, expected, std::max(1.0, expected) * 1e-4);
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+// Affine map x -> a * x + b modulo 2^32, composition of the maps is associative but not
+// commutative
+struct affine_map
+{
+    unsigned int a;
+    unsigned int b;
+
+    ROCPRIM_HOST_DEVICE
+    bool operator==(const affine_map& other) const
+    {
+        return a == other.a && b == other.b;
+    }
+};
+
+inline std::ostream& operator<<(std::ostream& stream, const affine_map& value)
+{
+    return stream << "(" << value.a << ", " << value.b << ")";
+}
+
+// Applies lhs and then rhs
+struct compose_affine_maps
+{
+    ROCPRIM_HOST_DEVICE
+    affine_map operator()(const affine_map& lhs, const affine_map& rhs) const
+    {
+        return affine_map{lhs.a * rhs.a, lhs.b * rhs.a + rhs.b};
+    }
+};
+
+template<class Config>
+void test_non_commutative_reduce()
+{
+    const int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    const hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(const auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<unsigned int> coefficients
+                = test_utils::get_random_data<unsigned int>(2 * size, 0, 1000, seed_value);
+            std::vector<affine_map> input(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                // Odd factors keep the composition from collapsing to a constant map
+                input[i] = affine_map{2 * coefficients[2 * i] + 1, coefficients[2 * i + 1]};
+            }
+
+            const affine_map initial_value{1, 0};
+            affine_map       expected = initial_value;
+            for(const affine_map& value : input)
+            {
+                expected = compose_affine_maps{}(expected, value);
+            }
+
+            affine_map* d_input;
+            affine_map* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         input.size() * sizeof(affine_map)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(affine_map)));
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                input.size() * sizeof(affine_map),
+                                hipMemcpyHostToDevice));
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(rocprim::reduce<Config>(nullptr,
+                                              temp_storage_size_bytes,
+                                              d_input,
+                                              d_output,
+                                              initial_value,
+                                              size,
+                                              compose_affine_maps{},
+                                              stream));
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(rocprim::reduce<Config>(d_temp_storage,
+                                              temp_storage_size_bytes,
+                                              d_input,
+                                              d_output,
+                                              initial_value,
+                                              size,
+                                              compose_affine_maps{},
+                                              stream));
+            HIP_CHECK(hipGetLastError());
+
+            affine_map output;
+            HIP_CHECK(hipMemcpy(&output, d_output, sizeof(affine_map), hipMemcpyDeviceToHost));
+            ASSERT_EQ(output, expected);
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+TEST(RocprimDeviceReduceTests, ReduceNonCommutative)
+{
+    test_non_commutative_reduce<rocprim::default_config>();
+}
+
+TEST(RocprimDeviceReduceTests, ReduceNonCommutativeRaking)
+{
+    test_non_commutative_reduce<
+        rocprim::reduce_config<256, 7, rocprim::block_reduce_algorithm::raking_reduce>>();
+}
+
+TEST(RocprimDeviceReduceTests, ReduceNonCommutativeSinglePass)
+{
+    test_non_commutative_reduce<rocprim::reduce_config<256,
+                                                       4,
+                                                       rocprim::block_reduce_algorithm::raking_reduce,
+                                                       ROCPRIM_GRID_SIZE_LIMIT,
+                                                       true>>();
+}
+
+struct square_to_int
+{
+    ROCPRIM_HOST_DEVICE
+    int operator()(const int8_t value) const
+    {
+        return int(value) * int(value);
+    }
+};
+
+// The input is offset by 0 and 1 items, so full tiles are loaded as vectors and item by item
+TEST(RocprimDeviceReduceTests, TransformReduce)
+{
+    const int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                  = int8_t;
+    using U                  = int;
+    const hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(const auto size : test_utils::get_sizes(seed_value))
+        {
+            for(const size_t offset : {size_t(0), size_t(1)})
+            {
+                SCOPED_TRACE(testing::Message() << "with size = " << size);
+                SCOPED_TRACE(testing::Message() << "with offset = " << offset);
+
+                const std::vector<T> input
+                    = test_utils::get_random_data<T>(size + offset, -10, 10, seed_value);
+                U expected = 3;
+                for(size_t i = 0; i < size; i++)
+                {
+                    expected += square_to_int{}(input[offset + i]);
+                }
+
+                T* d_input;
+                U* d_output;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input.size() * sizeof(T)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(U)));
+                HIP_CHECK(hipMemcpy(d_input,
+                                    input.data(),
+                                    input.size() * sizeof(T),
+                                    hipMemcpyHostToDevice));
+
+                size_t temp_storage_size_bytes;
+                HIP_CHECK(rocprim::transform_reduce(nullptr,
+                                                    temp_storage_size_bytes,
+                                                    d_input + offset,
+                                                    d_output,
+                                                    U(3),
+                                                    size,
+                                                    rocprim::plus<U>(),
+                                                    square_to_int{},
+                                                    stream));
+                void* d_temp_storage;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+                HIP_CHECK(rocprim::transform_reduce(d_temp_storage,
+                                                    temp_storage_size_bytes,
+                                                    d_input + offset,
+                                                    d_output,
+                                                    U(3),
+                                                    size,
+                                                    rocprim::plus<U>(),
+                                                    square_to_int{},
+                                                    stream));
+                HIP_CHECK(hipGetLastError());
+
+                U output;
+                HIP_CHECK(hipMemcpy(&output, d_output, sizeof(U), hipMemcpyDeviceToHost));
+                ASSERT_EQ(output, expected);
+
+                HIP_CHECK(hipFree(d_temp_storage));
+                HIP_CHECK(hipFree(d_input));
+                HIP_CHECK(hipFree(d_output));
+            }
+        }
+    }
+}
+
+TEST(RocprimDeviceReduceTests, MultiReduce)
+{
+    const int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                  = int;
+    using S                  = long long;
+    const hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(const auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input
+                = test_utils::get_random_data<T>(size, -100000, 100000, seed_value);
+            T expected_min = std::numeric_limits<T>::max();
+            T expected_max = std::numeric_limits<T>::lowest();
+            S expected_sum = 0;
+            for(const T value : input)
+            {
+                expected_min = std::min(expected_min, value);
+                expected_max = std::max(expected_max, value);
+                expected_sum += value;
+            }
+
+            T* d_input;
+            T* d_min;
+            T* d_max;
+            S* d_sum;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input.size() * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_min, sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_max, sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_sum, sizeof(S)));
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                input.size() * sizeof(T),
+                                hipMemcpyHostToDevice));
+
+            const auto outputs        = rocprim::make_tuple(d_min, d_max, d_sum);
+            const auto initial_values = rocprim::make_tuple(std::numeric_limits<T>::max(),
+                                                            std::numeric_limits<T>::lowest(),
+                                                            S(0));
+            const auto reduce_ops     = rocprim::make_tuple(rocprim::minimum<T>(),
+                                                        rocprim::maximum<T>(),
+                                                        rocprim::plus<S>());
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(rocprim::multi_reduce(nullptr,
+                                            temp_storage_size_bytes,
+                                            d_input,
+                                            outputs,
+                                            initial_values,
+                                            size,
+                                            reduce_ops,
+                                            stream));
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(rocprim::multi_reduce(d_temp_storage,
+                                            temp_storage_size_bytes,
+                                            d_input,
+                                            outputs,
+                                            initial_values,
+                                            size,
+                                            reduce_ops,
+                                            stream));
+            HIP_CHECK(hipGetLastError());
+
+            T output_min;
+            T output_max;
+            S output_sum;
+            HIP_CHECK(hipMemcpy(&output_min, d_min, sizeof(T), hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(&output_max, d_max, sizeof(T), hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(&output_sum, d_sum, sizeof(S), hipMemcpyDeviceToHost));
+            ASSERT_EQ(output_min, expected_min);
+            ASSERT_EQ(output_max, expected_max);
+            ASSERT_EQ(output_sum, expected_sum);
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_min));
+            HIP_CHECK(hipFree(d_max));
+            HIP_CHECK(hipFree(d_sum));
+        }
+    }
+}
+
 TYPED_TEST(RocprimDeviceReducePrecisionTests, ReduceSumInputEqualExponentFunction)
 {
     int device_id = test_common_utils::obtain_device_from_ctest();
@@ -600,7 +1101,7 @@ TYPED_TEST(RocprimDeviceReducePrecisionTests, ReduceSumInputEqualExponentFunctio
 
     const bool            debug_synchronous     = TestFixture::debug_synchronous;
     static constexpr bool use_identity_iterator = TestFixture::use_identity_iterator;
-    using Config                                = size_limit_config_t<TestFixture::size_limit>;
+    using Config = size_limit_config_t<TestFixture::size_limit, TestFixture::single_pass>;
 
     for(auto size : test_utils::get_sizes(42))
     {
@@ -690,3 +1191,334 @@ TYPED_TEST(RocprimDeviceReducePrecisionTests, ReduceSumInputEqualExponentFunctio
         hipFree(d_temp_storage);
     }
 }
+
+template<class T>
+class RocprimDeviceDeterministicReduceTests : public ::testing::Test
+{
+public:
+    using input_type             = T;
+    const bool debug_synchronous = false;
+};
+
+typedef ::testing::Types<float, double> RocprimDeviceDeterministicReduceTestsParams;
+
+TYPED_TEST_SUITE(RocprimDeviceDeterministicReduceTests,
+                 RocprimDeviceDeterministicReduceTestsParams);
+
+template<class Config, class T>
+T deterministic_reduce_on_device(T* d_input, const size_t size, const bool debug_synchronous)
+{
+    const hipStream_t stream = 0; // default
+
+    T* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(T)));
+
+    size_t temp_storage_size_bytes;
+    void*  d_temp_storage = nullptr;
+    HIP_CHECK(rocprim::deterministic_reduce<Config>(d_temp_storage,
+                                                    temp_storage_size_bytes,
+                                                    d_input,
+                                                    d_output,
+                                                    size,
+                                                    stream,
+                                                    debug_synchronous));
+
+    // temp_storage_size_bytes must be >0
+    EXPECT_GT(temp_storage_size_bytes, 0);
+
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    HIP_CHECK(rocprim::deterministic_reduce<Config>(d_temp_storage,
+                                                    temp_storage_size_bytes,
+                                                    d_input,
+                                                    d_output,
+                                                    size,
+                                                    stream,
+                                                    debug_synchronous));
+    HIP_CHECK(hipGetLastError());
+    HIP_CHECK(hipDeviceSynchronize());
+
+    T output;
+    HIP_CHECK(hipMemcpy(&output, d_output, sizeof(T), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipFree(d_output);
+    hipFree(d_temp_storage);
+    return output;
+}
+
+TYPED_TEST(RocprimDeviceDeterministicReduceTests, ReduceSumEqualForAllConfigs)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                      = typename TestFixture::input_type;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Values of mixed signs and magnitudes, so the sum depends on the order of additions
+            std::vector<T> input = test_utils::get_random_data<T>(size, T(-1000), T(1000), seed_value);
+            for(size_t i = 0; i < size; i += 7)
+            {
+                input[i] *= static_cast<T>(1e6);
+            }
+
+            T* d_input;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input.size() * sizeof(T)));
+            HIP_CHECK(
+                hipMemcpy(d_input, input.data(), input.size() * sizeof(T), hipMemcpyHostToDevice));
+            HIP_CHECK(hipDeviceSynchronize());
+
+            double expected = 0.0;
+            double max_abs  = 0.0;
+            for(const T value : input)
+            {
+                expected += static_cast<double>(value);
+                max_abs = std::max(max_abs, std::abs(static_cast<double>(value)));
+            }
+
+            const T output = deterministic_reduce_on_device<rocprim::default_config>(
+                d_input,
+                size,
+                debug_synchronous);
+            const T output_small = deterministic_reduce_on_device<
+                rocprim::reduce_config<64, 1, rocprim::block_reduce_algorithm::default_algorithm>>(
+                d_input,
+                size,
+                debug_synchronous);
+            const T output_large = deterministic_reduce_on_device<
+                rocprim::reduce_config<256,
+                                       16,
+                                       rocprim::block_reduce_algorithm::default_algorithm,
+                                       ROCPRIM_GRID_SIZE_LIMIT,
+                                       true>>(d_input, size, debug_synchronous);
+
+            // The results must be bitwise equal
+            ASSERT_EQ(std::memcmp(&output, &output_small, sizeof(T)), 0);
+            ASSERT_EQ(std::memcmp(&output, &output_large, sizeof(T)), 0);
+
+            // Errors of the host sum in double are far larger than the errors of the device sum
+            const double tolerance
+                = std::max(static_cast<double>(test_utils::precision<T>) * std::abs(expected),
+                           static_cast<double>(size) * max_abs * 1e-15);
+            ASSERT_NEAR(static_cast<double>(output), expected, tolerance);
+
+            hipFree(d_input);
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceDeterministicReduceTests, ReduceSumNonFinite)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                      = typename TestFixture::input_type;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    const size_t   size = 10000;
+    std::vector<T> input(size, T(1));
+    input[123] = std::numeric_limits<T>::infinity();
+
+    T* d_input;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input.size() * sizeof(T)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), input.size() * sizeof(T), hipMemcpyHostToDevice));
+    HIP_CHECK(hipDeviceSynchronize());
+    ASSERT_EQ(deterministic_reduce_on_device<rocprim::default_config>(d_input,
+                                                                      size,
+                                                                      debug_synchronous),
+              std::numeric_limits<T>::infinity());
+
+    input[4567] = -std::numeric_limits<T>::infinity();
+    HIP_CHECK(hipMemcpy(d_input, input.data(), input.size() * sizeof(T), hipMemcpyHostToDevice));
+    HIP_CHECK(hipDeviceSynchronize());
+    ASSERT_TRUE(std::isnan(
+        deterministic_reduce_on_device<rocprim::default_config>(d_input, size, debug_synchronous)));
+
+    hipFree(d_input);
+}
+
+// The result type of the sum of two int8_t is int8_t, so the items overflow without an explicit
+// accumulator type
+struct generic_plus
+{
+    template<class T>
+    ROCPRIM_HOST_DEVICE
+    T operator()(const T& a, const T& b) const
+    {
+        return a + b;
+    }
+};
+
+TEST(RocprimDeviceReduceTests, ReduceAccumulatorType)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                  = int8_t;
+    using U                  = int;
+    const hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(const size_t size : test_utils::get_sizes(seed_value))
+        {
+            if(size == 0)
+            {
+                continue;
+            }
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+            U                    expected = 0;
+            for(const T value : input)
+            {
+                expected += value;
+            }
+
+            T* d_input;
+            U* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, (size + 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, 2 * sizeof(U)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            size_t storage_sizes[2] = {};
+            HIP_CHECK((rocprim::reduce<rocprim::default_config, T*, U*, generic_plus, U>(
+                nullptr, storage_sizes[0], d_input, d_output, size, generic_plus(), stream)));
+            HIP_CHECK((rocprim::reduce<rocprim::default_config, T*, U*, T, generic_plus, U>(
+                nullptr, storage_sizes[1], d_input, d_output + 1, T(5), size, generic_plus(),
+                stream)));
+            size_t temp_storage_size_bytes = std::max(storage_sizes[0], storage_sizes[1]);
+            void*  d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            HIP_CHECK((rocprim::reduce<rocprim::default_config, T*, U*, generic_plus, U>(
+                d_temp_storage, temp_storage_size_bytes, d_input, d_output, size, generic_plus(),
+                stream)));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK((rocprim::reduce<rocprim::default_config, T*, U*, T, generic_plus, U>(
+                d_temp_storage, temp_storage_size_bytes, d_input, d_output + 1, T(5), size,
+                generic_plus(), stream)));
+            HIP_CHECK(hipGetLastError());
+
+            U output[2];
+            HIP_CHECK(hipMemcpy(output, d_output, 2 * sizeof(U), hipMemcpyDeviceToHost));
+            ASSERT_EQ(output[0], expected);
+            ASSERT_EQ(output[1], expected + 5);
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+TEST(RocprimDeviceReduceTests, ReduceDeducedWithStream)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = int;
+
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreate(&stream));
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(const size_t size : test_utils::get_sizes(seed_value))
+        {
+            if(size == 0)
+            {
+                continue;
+            }
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+            T                    expected = 0;
+            for(const T value : input)
+            {
+                expected += value;
+            }
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, 2 * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            // All template arguments are deduced, the stream must not be taken as the operator
+            // of the overload with an initial value
+            size_t storage_sizes[2] = {};
+            HIP_CHECK(rocprim::reduce(nullptr,
+                                      storage_sizes[0],
+                                      d_input,
+                                      d_output,
+                                      size,
+                                      rocprim::plus<T>(),
+                                      stream));
+            HIP_CHECK(rocprim::reduce(nullptr,
+                                      storage_sizes[1],
+                                      d_input,
+                                      d_output + 1,
+                                      T(5),
+                                      size,
+                                      rocprim::plus<T>(),
+                                      stream));
+            size_t temp_storage_size_bytes = std::max(storage_sizes[0], storage_sizes[1]);
+            void*  d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            HIP_CHECK(rocprim::reduce(d_temp_storage,
+                                      temp_storage_size_bytes,
+                                      d_input,
+                                      d_output,
+                                      size,
+                                      rocprim::plus<T>(),
+                                      stream));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(rocprim::reduce(d_temp_storage,
+                                      temp_storage_size_bytes,
+                                      d_input,
+                                      d_output + 1,
+                                      T(5),
+                                      size,
+                                      rocprim::plus<T>(),
+                                      stream));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipStreamSynchronize(stream));
+
+            T output[2];
+            HIP_CHECK(hipMemcpy(output, d_output, 2 * sizeof(T), hipMemcpyDeviceToHost));
+            ASSERT_EQ(output[0], expected);
+            ASSERT_EQ(output[1], expected + 5);
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+
+    HIP_CHECK(hipStreamDestroy(stream));
+}
@@ -24,6 +24,7 @@
 
 // required rocprim headers
 #include <rocprim/device/device_reduce_by_key.hpp>
+#include <rocprim/device/device_reduce_by_key_columns.hpp>
 #include <rocprim/iterator/constant_iterator.hpp>
 #include <rocprim/iterator/counting_iterator.hpp>
 #include <rocprim/iterator/discard_iterator.hpp>
@@ -318,7 +319,7 @@ TYPED_TEST(RocprimDeviceReduceByKey, ReduceByKey)
 
 }
 
-template<typename value_type>
+template<typename value_type, typename Config = rocprim::default_config>
 void large_indices_reduce_by_key()
 {
     int device_id = test_common_utils::obtain_device_from_ctest();
@@ -369,18 +370,18 @@ void large_indices_reduce_by_key()
 
         size_t temporary_storage_bytes;
 
-        HIP_CHECK(rocprim::reduce_by_key(nullptr,
-                                         temporary_storage_bytes,
-                                         d_keys_input,
-                                         d_values_input,
-                                         size,
-                                         d_unique_output,
-                                         d_aggregates_output,
-                                         d_unique_count_output,
-                                         reduce_op,
-                                         key_compare_op,
-                                         stream,
-                                         debug_synchronous));
+        HIP_CHECK(rocprim::reduce_by_key<Config>(nullptr,
+                                                 temporary_storage_bytes,
+                                                 d_keys_input,
+                                                 d_values_input,
+                                                 size,
+                                                 d_unique_output,
+                                                 d_aggregates_output,
+                                                 d_unique_count_output,
+                                                 reduce_op,
+                                                 key_compare_op,
+                                                 stream,
+                                                 debug_synchronous));
 
         ASSERT_GT(temporary_storage_bytes, 0);
 
@@ -388,18 +389,18 @@ void large_indices_reduce_by_key()
         HIP_CHECK(
             test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
 
-        HIP_CHECK(rocprim::reduce_by_key(d_temporary_storage,
-                                         temporary_storage_bytes,
-                                         d_keys_input,
-                                         d_values_input,
-                                         size,
-                                         d_unique_output,
-                                         d_aggregates_output,
-                                         d_unique_count_output,
-                                         reduce_op,
-                                         key_compare_op,
-                                         stream,
-                                         debug_synchronous));
+        HIP_CHECK(rocprim::reduce_by_key<Config>(d_temporary_storage,
+                                                 temporary_storage_bytes,
+                                                 d_keys_input,
+                                                 d_values_input,
+                                                 size,
+                                                 d_unique_output,
+                                                 d_aggregates_output,
+                                                 d_unique_count_output,
+                                                 reduce_op,
+                                                 key_compare_op,
+                                                 stream,
+                                                 debug_synchronous));
 
         HIP_CHECK(hipFree(d_temporary_storage));
 
@@ -451,7 +452,22 @@ TEST(RocprimDeviceReduceByKey, LargeIndicesReduceByKeyLargeValueType)
     large_indices_reduce_by_key<test_utils::custom_test_type<size_t>>();
 }
 
-template<typename value_type>
+// A size limit splits the input into multiple launches instead of a single persistent launch
+using size_limit_reduce_by_key_config
+    = rocprim::reduce_by_key_config_v2<256,
+                                       15,
+                                       rocprim::block_load_method::block_load_transpose,
+                                       rocprim::block_load_method::block_load_transpose,
+                                       rocprim::block_scan_algorithm::using_warp_scan,
+                                       1,
+                                       (1u << 30)>;
+
+TEST(RocprimDeviceReduceByKey, LargeIndicesReduceByKeySizeLimit)
+{
+    large_indices_reduce_by_key<unsigned int, size_limit_reduce_by_key_config>();
+}
+
+template<typename value_type, typename Config = rocprim::default_config>
 void large_segment_count_reduce_by_key()
 {
     int device_id = test_common_utils::obtain_device_from_ctest();
@@ -487,18 +503,18 @@ void large_segment_count_reduce_by_key()
 
         size_t temporary_storage_bytes;
 
-        HIP_CHECK(rocprim::reduce_by_key(nullptr,
-                                         temporary_storage_bytes,
-                                         d_keys_input,
-                                         d_values_input,
-                                         size,
-                                         d_unique_output,
-                                         d_aggregates_output,
-                                         d_unique_count_output,
-                                         reduce_op,
-                                         key_compare_op,
-                                         stream,
-                                         debug_synchronous));
+        HIP_CHECK(rocprim::reduce_by_key<Config>(nullptr,
+                                                 temporary_storage_bytes,
+                                                 d_keys_input,
+                                                 d_values_input,
+                                                 size,
+                                                 d_unique_output,
+                                                 d_aggregates_output,
+                                                 d_unique_count_output,
+                                                 reduce_op,
+                                                 key_compare_op,
+                                                 stream,
+                                                 debug_synchronous));
 
         ASSERT_GT(temporary_storage_bytes, 0);
 
@@ -506,18 +522,18 @@ void large_segment_count_reduce_by_key()
         HIP_CHECK(
             test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
 
-        HIP_CHECK(rocprim::reduce_by_key(d_temporary_storage,
-                                         temporary_storage_bytes,
-                                         d_keys_input,
-                                         d_values_input,
-                                         size,
-                                         d_unique_output,
-                                         d_aggregates_output,
-                                         d_unique_count_output,
-                                         reduce_op,
-                                         key_compare_op,
-                                         stream,
-                                         debug_synchronous));
+        HIP_CHECK(rocprim::reduce_by_key<Config>(d_temporary_storage,
+                                                 temporary_storage_bytes,
+                                                 d_keys_input,
+                                                 d_values_input,
+                                                 size,
+                                                 d_unique_output,
+                                                 d_aggregates_output,
+                                                 d_unique_count_output,
+                                                 reduce_op,
+                                                 key_compare_op,
+                                                 stream,
+                                                 debug_synchronous));
 
         HIP_CHECK(hipFree(d_temporary_storage));
 
@@ -543,3 +559,379 @@ TEST(RocprimDeviceReduceByKey, LargeSegmentCountReduceByKeyLargeValueType)
     // large value type to test TilesPerBlock > 1
     large_segment_count_reduce_by_key<test_utils::custom_test_type<size_t>>();
 }
+
+TEST(RocprimDeviceReduceByKey, LargeSegmentCountReduceByKeySizeLimit)
+{
+    large_segment_count_reduce_by_key<unsigned int, size_limit_reduce_by_key_config>();
+}
+
+template<typename Config = rocprim::default_config>
+void reduce_by_key_columns()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type = unsigned int;
+    using sum_type = int;
+    using max_type = float;
+    using min_type = unsigned short;
+
+    const bool  debug_synchronous = false;
+    hipStream_t stream            = 0; // default
+
+    const auto reduce_ops = rocprim::make_tuple(rocprim::plus<sum_type>(),
+                                                rocprim::maximum<max_type>(),
+                                                rocprim::minimum<min_type>());
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        std::default_random_engine gen(seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data and calculate expected results
+            std::vector<key_type> keys_input(size);
+            std::vector<sum_type> sums_input
+                = test_utils::get_random_data<sum_type>(size, -100, 100, seed_value);
+            std::vector<max_type> maxs_input
+                = test_utils::get_random_data<max_type>(size, -100, 100, seed_value + 1);
+            std::vector<min_type> mins_input
+                = test_utils::get_random_data<min_type>(size, 0, 1000, seed_value + 2);
+
+            std::vector<key_type> unique_expected;
+            std::vector<sum_type> sums_expected;
+            std::vector<max_type> maxs_expected;
+            std::vector<min_type> mins_expected;
+
+            std::uniform_int_distribution<size_t> key_count_dis(1, 300);
+            for(size_t offset = 0; offset < size;)
+            {
+                const size_t   end = std::min(size, offset + key_count_dis(gen));
+                const key_type key = static_cast<key_type>(unique_expected.size() * 3);
+                unique_expected.push_back(key);
+                sums_expected.push_back(sums_input[offset]);
+                maxs_expected.push_back(maxs_input[offset]);
+                mins_expected.push_back(mins_input[offset]);
+                for(size_t i = offset; i < end; i++)
+                {
+                    keys_input[i] = key;
+                    if(i != offset)
+                    {
+                        sums_expected.back() = sums_expected.back() + sums_input[i];
+                        maxs_expected.back() = std::max(maxs_expected.back(), maxs_input[i]);
+                        mins_expected.back() = std::min(mins_expected.back(), mins_input[i]);
+                    }
+                }
+                offset = end;
+            }
+            const size_t unique_count_expected = unique_expected.size();
+
+            key_type* d_keys_input;
+            sum_type* d_sums_input;
+            max_type* d_maxs_input;
+            min_type* d_mins_input;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_sums_input, size * sizeof(sum_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_maxs_input, size * sizeof(max_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_mins_input, size * sizeof(min_type)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_sums_input,
+                                sums_input.data(),
+                                size * sizeof(sum_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_maxs_input,
+                                maxs_input.data(),
+                                size * sizeof(max_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_mins_input,
+                                mins_input.data(),
+                                size * sizeof(min_type),
+                                hipMemcpyHostToDevice));
+
+            key_type* d_unique_output;
+            sum_type* d_sums_output;
+            max_type* d_maxs_output;
+            min_type* d_mins_output;
+            size_t*   d_unique_count_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_unique_output,
+                                                         unique_count_expected * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_sums_output,
+                                                         unique_count_expected * sizeof(sum_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_maxs_output,
+                                                         unique_count_expected * sizeof(max_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_mins_output,
+                                                         unique_count_expected * sizeof(min_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_unique_count_output, sizeof(size_t)));
+
+            const auto values_input
+                = rocprim::make_tuple(d_sums_input, d_maxs_input, d_mins_input);
+            const auto aggregates_output
+                = rocprim::make_tuple(d_sums_output, d_maxs_output, d_mins_output);
+
+            size_t temporary_storage_bytes;
+            HIP_CHECK(rocprim::reduce_by_key_columns<Config>(nullptr,
+                                                             temporary_storage_bytes,
+                                                             d_keys_input,
+                                                             values_input,
+                                                             size,
+                                                             d_unique_output,
+                                                             aggregates_output,
+                                                             d_unique_count_output,
+                                                             reduce_ops,
+                                                             rocprim::equal_to<key_type>(),
+                                                             stream,
+                                                             debug_synchronous));
+
+            ASSERT_GT(temporary_storage_bytes, 0);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(rocprim::reduce_by_key_columns<Config>(d_temporary_storage,
+                                                             temporary_storage_bytes,
+                                                             d_keys_input,
+                                                             values_input,
+                                                             size,
+                                                             d_unique_output,
+                                                             aggregates_output,
+                                                             d_unique_count_output,
+                                                             reduce_ops,
+                                                             rocprim::equal_to<key_type>(),
+                                                             stream,
+                                                             debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+
+            size_t unique_count_output;
+            HIP_CHECK(hipMemcpy(&unique_count_output,
+                                d_unique_count_output,
+                                sizeof(unique_count_output),
+                                hipMemcpyDeviceToHost));
+            ASSERT_EQ(unique_count_output, unique_count_expected);
+
+            std::vector<key_type> unique_output(unique_count_expected);
+            std::vector<sum_type> sums_output(unique_count_expected);
+            std::vector<max_type> maxs_output(unique_count_expected);
+            std::vector<min_type> mins_output(unique_count_expected);
+            HIP_CHECK(hipMemcpy(unique_output.data(),
+                                d_unique_output,
+                                unique_count_expected * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(sums_output.data(),
+                                d_sums_output,
+                                unique_count_expected * sizeof(sum_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(maxs_output.data(),
+                                d_maxs_output,
+                                unique_count_expected * sizeof(max_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(mins_output.data(),
+                                d_mins_output,
+                                unique_count_expected * sizeof(min_type),
+                                hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_sums_input));
+            HIP_CHECK(hipFree(d_maxs_input));
+            HIP_CHECK(hipFree(d_mins_input));
+            HIP_CHECK(hipFree(d_unique_output));
+            HIP_CHECK(hipFree(d_sums_output));
+            HIP_CHECK(hipFree(d_maxs_output));
+            HIP_CHECK(hipFree(d_mins_output));
+            HIP_CHECK(hipFree(d_unique_count_output));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(unique_output, unique_expected));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(sums_output, sums_expected));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(maxs_output, maxs_expected));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(mins_output, mins_expected));
+        }
+    }
+}
+
+TEST(RocprimDeviceReduceByKey, ReduceByKeyColumns)
+{
+    reduce_by_key_columns();
+}
+
+TEST(RocprimDeviceReduceByKey, ReduceByKeyColumnsSmallTiles)
+{
+    using config
+        = rocprim::reduce_by_key_config_v2<64,
+                                           3,
+                                           rocprim::block_load_method::block_load_transpose,
+                                           rocprim::block_load_method::block_load_transpose,
+                                           rocprim::block_scan_algorithm::using_warp_scan>;
+    reduce_by_key_columns<config>();
+}
+
+// The look-back of reduce_by_key waits for the carry-outs of the preceding tiles with Backoff
+template<rocprim::lookback_backoff Backoff>
+void reduce_by_key_lookback_backoff()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type   = int;
+    using value_type = int;
+    using config     = rocprim::reduce_by_key_config_v2<
+        256,
+        4,
+        rocprim::block_load_method::block_load_transpose,
+        rocprim::block_load_method::block_load_transpose,
+        rocprim::block_scan_algorithm::using_warp_scan,
+        1,
+        ROCPRIM_GRID_SIZE_LIMIT,
+        Backoff>;
+
+    const hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(const size_t size : test_utils::get_sizes(seed_value))
+        {
+            if(size == 0)
+            {
+                continue;
+            }
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Runs of 1 to 1000 equal keys, so some runs span several tiles
+            const std::vector<size_t> lengths
+                = test_utils::get_random_data<size_t>(size, 1, 1000, seed_value);
+            const std::vector<value_type> values_input
+                = test_utils::get_random_data<value_type>(size, -100, 100, seed_value + 1);
+            std::vector<key_type>   keys_input(size);
+            std::vector<key_type>   unique_expected;
+            std::vector<value_type> aggregates_expected;
+            for(size_t run = 0, offset = 0; offset < size; run++)
+            {
+                const size_t end = std::min(size, offset + lengths[run]);
+                unique_expected.push_back(static_cast<key_type>(run));
+                aggregates_expected.push_back(0);
+                for(; offset < end; offset++)
+                {
+                    keys_input[offset] = static_cast<key_type>(run);
+                    aggregates_expected.back() += values_input[offset];
+                }
+            }
+            const size_t unique_count_expected = unique_expected.size();
+
+            key_type*     d_keys_input;
+            value_type*   d_values_input;
+            key_type*     d_unique_output;
+            value_type*   d_aggregates_output;
+            unsigned int* d_unique_count_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_values_input, size * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_unique_output,
+                                                         unique_count_expected * sizeof(key_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_aggregates_output,
+                                                   unique_count_expected * sizeof(value_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_unique_count_output, sizeof(unsigned int)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values_input,
+                                values_input.data(),
+                                size * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+
+            size_t temporary_storage_bytes;
+            HIP_CHECK(rocprim::reduce_by_key<config>(nullptr,
+                                                     temporary_storage_bytes,
+                                                     d_keys_input,
+                                                     d_values_input,
+                                                     size,
+                                                     d_unique_output,
+                                                     d_aggregates_output,
+                                                     d_unique_count_output,
+                                                     rocprim::plus<value_type>(),
+                                                     rocprim::equal_to<key_type>(),
+                                                     stream));
+            void* d_temporary_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                         temporary_storage_bytes));
+            HIP_CHECK(rocprim::reduce_by_key<config>(d_temporary_storage,
+                                                     temporary_storage_bytes,
+                                                     d_keys_input,
+                                                     d_values_input,
+                                                     size,
+                                                     d_unique_output,
+                                                     d_aggregates_output,
+                                                     d_unique_count_output,
+                                                     rocprim::plus<value_type>(),
+                                                     rocprim::equal_to<key_type>(),
+                                                     stream));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipFree(d_temporary_storage));
+
+            std::vector<key_type>   unique_output(unique_count_expected);
+            std::vector<value_type> aggregates_output(unique_count_expected);
+            unsigned int            unique_count_output;
+            HIP_CHECK(hipMemcpy(unique_output.data(),
+                                d_unique_output,
+                                unique_count_expected * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(aggregates_output.data(),
+                                d_aggregates_output,
+                                unique_count_expected * sizeof(value_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(&unique_count_output,
+                                d_unique_count_output,
+                                sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_unique_output));
+            HIP_CHECK(hipFree(d_aggregates_output));
+            HIP_CHECK(hipFree(d_unique_count_output));
+
+            ASSERT_EQ(unique_count_output, unique_count_expected);
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(unique_output, unique_expected));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(aggregates_output, aggregates_expected));
+        }
+    }
+}
+
+TEST(RocprimDeviceReduceByKey, LookbackBackoffAutomatic)
+{
+    reduce_by_key_lookback_backoff<rocprim::lookback_backoff::automatic>();
+}
+
+TEST(RocprimDeviceReduceByKey, LookbackBackoffSpin)
+{
+    reduce_by_key_lookback_backoff<rocprim::lookback_backoff::spin>();
+}
+
+TEST(RocprimDeviceReduceByKey, LookbackBackoffExponentialSleep)
+{
+    reduce_by_key_lookback_backoff<rocprim::lookback_backoff::exponential_sleep>();
+}
+
+TEST(RocprimDeviceReduceByKey, LookbackBackoffBoundedSleep)
+{
+    reduce_by_key_lookback_backoff<rocprim::lookback_backoff::bounded_sleep>();
+}
@@ -245,6 +245,120 @@ TYPED_TEST(RocprimDeviceRunLengthEncode, Encode)
 
 }
 
+TYPED_TEST(RocprimDeviceRunLengthEncode, EncodeCount)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type = typename TestFixture::params::key_type;
+
+    constexpr bool use_identity_iterator = TestFixture::params::use_identity_iterator;
+    const bool debug_synchronous = false;
+
+    const unsigned int seed = 123;
+    std::default_random_engine gen(seed);
+    std::vector<key_type> random_keys = test_utils::get_random_data<key_type>(64, -100, 100, seed);
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            hipStream_t stream = 0; // default
+
+            // Generate data and calculate expected results
+            size_t runs_count_expected = 0;
+
+            std::vector<key_type> input(size);
+            std::uniform_int_distribution<size_t> key_count_dis(
+                TestFixture::params::min_segment_length,
+                TestFixture::params::max_segment_length
+            );
+
+            size_t offset = 0;
+            key_type current_key = get_random_value_no_duplicate(key_type(0), random_keys, size);
+            while(offset < size)
+            {
+                size_t key_count = key_count_dis(gen);
+                const size_t end = std::min(size, offset + key_count);
+
+                current_key = get_random_value_no_duplicate(current_key, random_keys, end);
+
+                key_count = end - offset;
+                for(size_t i = offset; i < end; i++)
+                {
+                    input[i] = current_key;
+                }
+
+                runs_count_expected++;
+
+                offset += key_count;
+            }
+
+            key_type * d_input;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(key_type)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_input, input.data(),
+                    size * sizeof(key_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            size_t * d_runs_count_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_runs_count_output, sizeof(size_t)));
+
+            size_t temporary_storage_bytes = 0;
+
+            HIP_CHECK(
+                rocprim::run_length_encode_count(
+                    nullptr, temporary_storage_bytes,
+                    d_input, size,
+                    test_utils::wrap_in_identity_iterator<use_identity_iterator>(d_runs_count_output),
+                    stream, debug_synchronous
+                )
+            );
+
+            ASSERT_GT(temporary_storage_bytes, 0U);
+
+            void * d_temporary_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(
+                rocprim::run_length_encode_count(
+                    d_temporary_storage, temporary_storage_bytes,
+                    d_input, size,
+                    test_utils::wrap_in_identity_iterator<use_identity_iterator>(d_runs_count_output),
+                    stream, debug_synchronous
+                )
+            );
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+
+            size_t runs_count_output = 0;
+            HIP_CHECK(
+                hipMemcpy(
+                    &runs_count_output, d_runs_count_output,
+                    sizeof(size_t),
+                    hipMemcpyDeviceToHost
+                )
+            );
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_runs_count_output));
+
+            // Validating results
+            ASSERT_EQ(runs_count_output, runs_count_expected);
+        }
+    }
+
+}
+
 TYPED_TEST(RocprimDeviceRunLengthEncode, NonTrivialRuns)
 {
     int device_id = test_common_utils::obtain_device_from_ctest();
@@ -413,3 +527,329 @@ TYPED_TEST(RocprimDeviceRunLengthEncode, NonTrivialRuns)
     }
 
 }
+
+TYPED_TEST(RocprimDeviceRunLengthEncode, Decode)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type = typename TestFixture::params::key_type;
+    // Counts of all types of the parameters are not convertible to size_t
+    using count_type = unsigned int;
+
+    constexpr bool use_identity_iterator = TestFixture::params::use_identity_iterator;
+    const bool debug_synchronous = false;
+
+    const unsigned int seed = 123;
+    std::default_random_engine gen(seed);
+    std::vector<key_type> random_keys = test_utils::get_random_data<key_type>(64, -100, 100, seed);
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            hipStream_t stream = 0; // default
+
+            // Generate runs, some of them empty, and calculate expected results
+            std::vector<key_type> values_input;
+            std::vector<count_type> counts_input;
+            std::vector<key_type> output_expected;
+            std::uniform_int_distribution<size_t> key_count_dis(
+                TestFixture::params::min_segment_length,
+                TestFixture::params::max_segment_length
+            );
+
+            key_type current_key = get_random_value_no_duplicate(key_type(0), random_keys, size);
+            while(output_expected.size() < size)
+            {
+                size_t key_count = values_input.size() % 7 == 3 ? 0 : key_count_dis(gen);
+                key_count = std::min(key_count, size - output_expected.size());
+
+                current_key = get_random_value_no_duplicate(current_key, random_keys, output_expected.size());
+
+                values_input.push_back(current_key);
+                counts_input.push_back(static_cast<count_type>(key_count));
+                output_expected.insert(output_expected.end(), key_count, current_key);
+            }
+            const size_t runs = values_input.size();
+
+            key_type * d_values_input;
+            count_type * d_counts_input;
+            key_type * d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input, runs * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_counts_input, runs * sizeof(count_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(key_type)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_values_input, values_input.data(),
+                    runs * sizeof(key_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+            HIP_CHECK(
+                hipMemcpy(
+                    d_counts_input, counts_input.data(),
+                    runs * sizeof(count_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            size_t temporary_storage_bytes = 0;
+
+            HIP_CHECK(
+                rocprim::run_length_decode(
+                    nullptr, temporary_storage_bytes,
+                    d_values_input, d_counts_input, runs,
+                    test_utils::wrap_in_identity_iterator<use_identity_iterator>(d_output),
+                    stream, debug_synchronous
+                )
+            );
+
+            ASSERT_GT(temporary_storage_bytes, 0U);
+
+            void * d_temporary_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(
+                rocprim::run_length_decode(
+                    d_temporary_storage, temporary_storage_bytes,
+                    d_values_input, d_counts_input, runs,
+                    test_utils::wrap_in_identity_iterator<use_identity_iterator>(d_output),
+                    stream, debug_synchronous
+                )
+            );
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+
+            std::vector<key_type> output(size);
+            HIP_CHECK(
+                hipMemcpy(
+                    output.data(), d_output,
+                    size * sizeof(key_type),
+                    hipMemcpyDeviceToHost
+                )
+            );
+
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_counts_input));
+            HIP_CHECK(hipFree(d_output));
+
+            // Validating results
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, output_expected));
+        }
+    }
+
+}
+
+// Lengths of the runs of inputs with the boundaries of the runs placed relative to the
+// boundaries of tiles of tile_size items
+std::vector<std::vector<size_t>> get_boundary_run_lengths(const size_t tile_size)
+{
+    std::vector<std::vector<size_t>> patterns;
+    // One run covering the whole input
+    patterns.push_back({13 * tile_size + 5});
+    // All items are unique
+    patterns.push_back(std::vector<size_t>(9 * tile_size + 3, 1));
+    // Runs spanning several tiles, separated by trivial runs
+    patterns.push_back(
+        {3 * tile_size + 7, 1, 2 * tile_size, 1, 1, 5 * tile_size - 3, tile_size + 1});
+    // Runs ending exactly at the ends of tiles and the input is a multiple of the tile size
+    patterns.push_back({tile_size, tile_size, 1, tile_size - 1, tile_size - 2, 2, tile_size});
+    // A trivial run at the beginning and at the end of every tile
+    std::vector<size_t> trivial_at_boundaries;
+    for(size_t tile = 0; tile < 11; tile++)
+    {
+        trivial_at_boundaries.push_back(1);
+        trivial_at_boundaries.push_back(tile_size - 2);
+        trivial_at_boundaries.push_back(1);
+    }
+    patterns.push_back(trivial_at_boundaries);
+    // Runs continuing over the end of the tile by one item
+    std::vector<size_t> one_past_boundaries(1, tile_size + 1);
+    for(size_t tile = 1; tile < 7; tile++)
+    {
+        one_past_boundaries.push_back(tile_size);
+    }
+    patterns.push_back(one_past_boundaries);
+    // Inputs of one and two items
+    patterns.push_back({1});
+    patterns.push_back({2});
+    patterns.push_back({1, 1});
+    return patterns;
+}
+
+template<class Config>
+void test_run_length_encode_boundaries(const size_t tile_size)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type   = int;
+    using count_type = unsigned int;
+
+    const hipStream_t stream            = 0; // default
+    const bool        debug_synchronous = false;
+
+    for(const std::vector<size_t>& run_lengths : get_boundary_run_lengths(tile_size))
+    {
+        // Every run has the key of its index, so neighbouring runs differ
+        std::vector<key_type>   input;
+        std::vector<key_type>   unique_expected;
+        std::vector<count_type> counts_expected;
+        std::vector<count_type> offsets_expected;
+        std::vector<count_type> non_trivial_counts_expected;
+        for(size_t run = 0; run < run_lengths.size(); run++)
+        {
+            const key_type key = static_cast<key_type>(run);
+            if(run_lengths[run] > 1)
+            {
+                offsets_expected.push_back(static_cast<count_type>(input.size()));
+                non_trivial_counts_expected.push_back(static_cast<count_type>(run_lengths[run]));
+            }
+            input.insert(input.end(), run_lengths[run], key);
+            unique_expected.push_back(key);
+            counts_expected.push_back(static_cast<count_type>(run_lengths[run]));
+        }
+        const size_t size = input.size();
+        const size_t runs = unique_expected.size();
+        const size_t non_trivial_runs = offsets_expected.size();
+        SCOPED_TRACE(testing::Message() << "with size = " << size << ", runs = " << runs);
+
+        key_type*   d_input;
+        key_type*   d_unique_output;
+        count_type* d_counts_output;
+        count_type* d_runs_count_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(key_type)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_unique_output, runs * sizeof(key_type)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_counts_output, runs * sizeof(count_type)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_runs_count_output, sizeof(count_type)));
+        HIP_CHECK(
+            hipMemcpy(d_input, input.data(), size * sizeof(key_type), hipMemcpyHostToDevice));
+
+        size_t temporary_storage_bytes = 0;
+        HIP_CHECK(rocprim::run_length_encode<Config>(nullptr,
+                                                     temporary_storage_bytes,
+                                                     d_input,
+                                                     size,
+                                                     d_unique_output,
+                                                     d_counts_output,
+                                                     d_runs_count_output,
+                                                     stream,
+                                                     debug_synchronous));
+        void* d_temporary_storage;
+        HIP_CHECK(
+            test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+        HIP_CHECK(rocprim::run_length_encode<Config>(d_temporary_storage,
+                                                     temporary_storage_bytes,
+                                                     d_input,
+                                                     size,
+                                                     d_unique_output,
+                                                     d_counts_output,
+                                                     d_runs_count_output,
+                                                     stream,
+                                                     debug_synchronous));
+        HIP_CHECK(hipFree(d_temporary_storage));
+
+        std::vector<key_type>   unique_output(runs);
+        std::vector<count_type> counts_output(runs);
+        count_type              runs_count_output;
+        HIP_CHECK(hipMemcpy(unique_output.data(),
+                            d_unique_output,
+                            runs * sizeof(key_type),
+                            hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(counts_output.data(),
+                            d_counts_output,
+                            runs * sizeof(count_type),
+                            hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(&runs_count_output,
+                            d_runs_count_output,
+                            sizeof(count_type),
+                            hipMemcpyDeviceToHost));
+
+        ASSERT_EQ(runs_count_output, runs);
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(unique_output, unique_expected));
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(counts_output, counts_expected));
+
+        // The non-trivial runs of the same input, the outputs of the encoding are large enough
+        count_type* d_offsets_output = d_counts_output;
+        count_type* d_non_trivial_counts_output;
+        HIP_CHECK(
+            test_common_utils::hipMallocHelper(&d_non_trivial_counts_output,
+                                               std::max<size_t>(non_trivial_runs, 1)
+                                                   * sizeof(count_type)));
+
+        HIP_CHECK(rocprim::run_length_encode_non_trivial_runs<Config>(nullptr,
+                                                                      temporary_storage_bytes,
+                                                                      d_input,
+                                                                      size,
+                                                                      d_offsets_output,
+                                                                      d_non_trivial_counts_output,
+                                                                      d_runs_count_output,
+                                                                      stream,
+                                                                      debug_synchronous));
+        HIP_CHECK(
+            test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+        HIP_CHECK(rocprim::run_length_encode_non_trivial_runs<Config>(d_temporary_storage,
+                                                                      temporary_storage_bytes,
+                                                                      d_input,
+                                                                      size,
+                                                                      d_offsets_output,
+                                                                      d_non_trivial_counts_output,
+                                                                      d_runs_count_output,
+                                                                      stream,
+                                                                      debug_synchronous));
+        HIP_CHECK(hipFree(d_temporary_storage));
+
+        std::vector<count_type> offsets_output(non_trivial_runs);
+        std::vector<count_type> non_trivial_counts_output(non_trivial_runs);
+        HIP_CHECK(hipMemcpy(offsets_output.data(),
+                            d_offsets_output,
+                            non_trivial_runs * sizeof(count_type),
+                            hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(non_trivial_counts_output.data(),
+                            d_non_trivial_counts_output,
+                            non_trivial_runs * sizeof(count_type),
+                            hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(&runs_count_output,
+                            d_runs_count_output,
+                            sizeof(count_type),
+                            hipMemcpyDeviceToHost));
+
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_unique_output));
+        HIP_CHECK(hipFree(d_counts_output));
+        HIP_CHECK(hipFree(d_runs_count_output));
+        HIP_CHECK(hipFree(d_non_trivial_counts_output));
+
+        ASSERT_EQ(runs_count_output, non_trivial_runs);
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(offsets_output, offsets_expected));
+        ASSERT_NO_FATAL_FAILURE(
+            test_utils::assert_eq(non_trivial_counts_output, non_trivial_counts_expected));
+    }
+}
+
+TEST(RocprimDeviceRunLengthEncodeBoundaries, SmallTiles)
+{
+    // 128 items per tile, so every input spans many tiles
+    using config = rocprim::run_length_encode_config<
+        rocprim::default_config,
+        rocprim::select_config<64,
+                               2,
+                               rocprim::block_load_method::block_load_transpose,
+                               rocprim::block_load_method::block_load_transpose,
+                               rocprim::block_load_method::block_load_transpose,
+                               rocprim::block_scan_algorithm::using_warp_scan>>;
+    test_run_length_encode_boundaries<config>(128);
+}
+
+TEST(RocprimDeviceRunLengthEncodeBoundaries, DefaultConfig)
+{
+    test_run_length_encode_boundaries<rocprim::default_config>(4096);
+}
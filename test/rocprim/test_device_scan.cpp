@@ -26,6 +26,7 @@
 #include <rocprim/device/device_reduce.hpp>
 #include <rocprim/device/device_scan.hpp>
 #include <rocprim/device/device_scan_by_key.hpp>
+#include <rocprim/device/grid_limit.hpp>
 #include <rocprim/iterator/constant_iterator.hpp>
 #include <rocprim/iterator/counting_iterator.hpp>
 #include <rocprim/iterator/transform_iterator.hpp>
@@ -33,6 +34,7 @@
 // required test headers
 #include "test_utils_types.hpp"
 
+#include <cstring>
 #include <functional>
 #include <iterator>
 #include <numeric>
@@ -1427,3 +1429,989 @@ TYPED_TEST(RocprimDeviceScanFutureTests, ExclusiveScan)
         }
     }
 }
+
+template<class T>
+class RocprimDeviceDeterministicScanTests : public ::testing::Test
+{
+public:
+    using input_type             = T;
+    const bool debug_synchronous = false;
+};
+
+typedef ::testing::Types<float, double> RocprimDeviceDeterministicScanTestsParams;
+
+TYPED_TEST_SUITE(RocprimDeviceDeterministicScanTests, RocprimDeviceDeterministicScanTestsParams);
+
+template<class Config, class T>
+std::vector<T>
+    deterministic_inclusive_scan_on_device(T* d_input, const size_t size, const bool debug_synchronous)
+{
+    const hipStream_t stream = 0; // default
+
+    T* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, std::max<size_t>(size, 1) * sizeof(T)));
+
+    size_t temp_storage_size_bytes;
+    void*  d_temp_storage = nullptr;
+    HIP_CHECK(rocprim::deterministic_inclusive_scan<Config>(d_temp_storage,
+                                                            temp_storage_size_bytes,
+                                                            d_input,
+                                                            d_output,
+                                                            size,
+                                                            stream,
+                                                            debug_synchronous));
+
+    // temp_storage_size_bytes must be >0
+    EXPECT_GT(temp_storage_size_bytes, 0);
+
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    HIP_CHECK(rocprim::deterministic_inclusive_scan<Config>(d_temp_storage,
+                                                            temp_storage_size_bytes,
+                                                            d_input,
+                                                            d_output,
+                                                            size,
+                                                            stream,
+                                                            debug_synchronous));
+    HIP_CHECK(hipGetLastError());
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<T> output(size);
+    HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipFree(d_output);
+    hipFree(d_temp_storage);
+    return output;
+}
+
+TYPED_TEST(RocprimDeviceDeterministicScanTests, InclusiveScanEqualForAllConfigs)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                      = typename TestFixture::input_type;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    using small_config
+        = rocprim::scan_config<64,
+                               1,
+                               true,
+                               rocprim::block_load_method::block_load_direct,
+                               rocprim::block_store_method::block_store_direct,
+                               rocprim::block_scan_algorithm::using_warp_scan>;
+    using reduce_then_scan_config
+        = rocprim::scan_config<256,
+                               16,
+                               false,
+                               rocprim::block_load_method::block_load_transpose,
+                               rocprim::block_store_method::block_store_transpose,
+                               rocprim::block_scan_algorithm::reduce_then_scan>;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Values of mixed signs and magnitudes, so the sums depend on the order of additions
+            std::vector<T> input
+                = test_utils::get_random_data<T>(size, T(-1000), T(1000), seed_value);
+            for(size_t i = 0; i < size; i += 7)
+            {
+                input[i] *= static_cast<T>(1e6);
+            }
+
+            T* d_input;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input.size() * sizeof(T)));
+            HIP_CHECK(
+                hipMemcpy(d_input, input.data(), input.size() * sizeof(T), hipMemcpyHostToDevice));
+            HIP_CHECK(hipDeviceSynchronize());
+
+            const std::vector<T> output
+                = deterministic_inclusive_scan_on_device<rocprim::default_config>(
+                    d_input,
+                    size,
+                    debug_synchronous);
+            const std::vector<T> output_small
+                = deterministic_inclusive_scan_on_device<small_config>(d_input,
+                                                                       size,
+                                                                       debug_synchronous);
+            const std::vector<T> output_reduce_then_scan
+                = deterministic_inclusive_scan_on_device<reduce_then_scan_config>(
+                    d_input,
+                    size,
+                    debug_synchronous);
+
+            double max_abs = 0.0;
+            for(const T value : input)
+            {
+                max_abs = std::max(max_abs, std::abs(static_cast<double>(value)));
+            }
+
+            double expected = 0.0;
+            for(size_t i = 0; i < size; i++)
+            {
+                SCOPED_TRACE(testing::Message() << "with index = " << i);
+
+                // The results must be bitwise equal
+                ASSERT_EQ(std::memcmp(&output[i], &output_small[i], sizeof(T)), 0);
+                ASSERT_EQ(std::memcmp(&output[i], &output_reduce_then_scan[i], sizeof(T)), 0);
+
+                // Errors of the host sum in double are far larger than the errors of the device sum
+                expected += static_cast<double>(input[i]);
+                const double tolerance
+                    = std::max(static_cast<double>(test_utils::precision<T>) * std::abs(expected),
+                               static_cast<double>(i + 1) * max_abs * 1e-15);
+                ASSERT_NEAR(static_cast<double>(output[i]), expected, tolerance);
+            }
+
+            hipFree(d_input);
+        }
+    }
+}
+
+// Scans of T* and const T* inputs use the same kernels
+TEST(RocprimDeviceScanTests, ConstInputPointer)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = int;
+    static_assert(std::is_same<decltype(rocprim::detail::to_kernel_input_iterator(
+                                   std::declval<T*>())),
+                               const T*>::value,
+                  "Raw pointers must be passed to the kernels as pointers to const");
+    static_assert(std::is_same<decltype(rocprim::detail::to_kernel_input_iterator(
+                                   std::declval<rocprim::counting_iterator<T>>())),
+                               rocprim::counting_iterator<T>>::value,
+                  "Other iterators must be passed to the kernels unchanged");
+
+    const hipStream_t    stream = 0;
+    const size_t         size   = 100000;
+    const std::vector<T> input  = test_utils::get_random_data<T>(size, 1, 10, size);
+
+    std::vector<T> expected(size);
+    std::partial_sum(input.begin(), input.end(), expected.begin());
+
+    T* d_input;
+    T* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+    const T* d_const_input = d_input;
+
+    size_t temp_storage_size_bytes = 0;
+    HIP_CHECK(rocprim::inclusive_scan(nullptr,
+                                      temp_storage_size_bytes,
+                                      d_const_input,
+                                      d_output,
+                                      size,
+                                      rocprim::plus<T>(),
+                                      stream));
+    void* d_temp_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+    for(const bool use_const_input : {false, true})
+    {
+        SCOPED_TRACE(testing::Message() << "with use_const_input = " << use_const_input);
+
+        HIP_CHECK(hipMemset(d_output, 0, size * sizeof(T)));
+        if(use_const_input)
+        {
+            HIP_CHECK(rocprim::inclusive_scan(d_temp_storage,
+                                              temp_storage_size_bytes,
+                                              d_const_input,
+                                              d_output,
+                                              size,
+                                              rocprim::plus<T>(),
+                                              stream));
+        }
+        else
+        {
+            HIP_CHECK(rocprim::inclusive_scan(d_temp_storage,
+                                              temp_storage_size_bytes,
+                                              d_input,
+                                              d_output,
+                                              size,
+                                              rocprim::plus<T>(),
+                                              stream));
+        }
+
+        std::vector<T> output(size);
+        HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+    }
+
+    HIP_CHECK(hipFree(d_temp_storage));
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
+
+template<unsigned int BlocksPerCU>
+void test_small_tiles_scan(const std::vector<int>& input, const std::vector<int>& expected)
+{
+    using T      = int;
+    using config = rocprim::scan_config<64,
+                                        1,
+                                        true,
+                                        rocprim::block_load_method::block_load_transpose,
+                                        rocprim::block_store_method::block_store_transpose,
+                                        rocprim::block_scan_algorithm::using_warp_scan,
+                                        ROCPRIM_GRID_SIZE_LIMIT,
+                                        BlocksPerCU>;
+    SCOPED_TRACE(testing::Message() << "with BlocksPerCU = " << BlocksPerCU);
+
+    const hipStream_t stream = 0;
+    const size_t      size   = input.size();
+
+    T* d_input;
+    T* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+    size_t temp_storage_size_bytes = 0;
+    HIP_CHECK(rocprim::inclusive_scan<config>(nullptr,
+                                              temp_storage_size_bytes,
+                                              d_input,
+                                              d_output,
+                                              size,
+                                              rocprim::plus<T>(),
+                                              stream));
+    void* d_temp_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+    // Repeated calls reuse the counters of the tile ids
+    for(unsigned int run = 0; run < 3; run++)
+    {
+        HIP_CHECK(hipMemset(d_output, 0, size * sizeof(T)));
+        HIP_CHECK(rocprim::inclusive_scan<config>(d_temp_storage,
+                                                  temp_storage_size_bytes,
+                                                  d_input,
+                                                  d_output,
+                                                  size,
+                                                  rocprim::plus<T>(),
+                                                  stream));
+
+        std::vector<T> output(size);
+        HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+    }
+
+    HIP_CHECK(hipFree(d_temp_storage));
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
+
+// Small tiles take many tile ids, with and without a grid of persistent blocks that take
+// multiple tile ids each
+TEST(RocprimDeviceScanTests, SmallTilesOrderedBlockId)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = int;
+    // Sizes that are not multiples of the number of counters of the tile ids
+    for(const size_t size : {size_t(65), size_t(64 * 7 + 3), size_t(1 << 20) + 17})
+    {
+        SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+        const std::vector<T> input = test_utils::get_random_data<T>(size, 1, 10, size);
+        std::vector<T>       expected(size);
+        std::partial_sum(input.begin(), input.end(), expected.begin());
+
+        ASSERT_NO_FATAL_FAILURE(test_small_tiles_scan<0>(input, expected));
+        ASSERT_NO_FATAL_FAILURE(test_small_tiles_scan<1>(input, expected));
+    }
+}
+
+// A grid of fewer blocks than tiles, so every block of the look-back scan processes many tiles
+// and carries its ordered tile id and the prefixes over from one tile to the next
+TEST(RocprimDeviceScanTests, LookbackPersistentBlocks)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T      = int;
+    using config = rocprim::scan_config<64,
+                                        2,
+                                        true,
+                                        rocprim::block_load_method::block_load_transpose,
+                                        rocprim::block_store_method::block_store_transpose,
+                                        rocprim::block_scan_algorithm::using_warp_scan>;
+    constexpr size_t items_per_tile = 64 * 2;
+
+    const hipStream_t stream        = 0; // default
+    const T           initial_value = T(7);
+
+    for(const size_t size : {items_per_tile * 50 + 5, items_per_tile * 64, size_t(1 << 18) + 3})
+    {
+        SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+        const std::vector<T> input = test_utils::get_random_data<T>(size, -10, 10, size);
+        std::vector<T>       expected_inclusive(size);
+        std::partial_sum(input.begin(), input.end(), expected_inclusive.begin());
+        std::vector<T> expected_exclusive(size);
+        expected_exclusive[0] = initial_value;
+        for(size_t i = 1; i < size; i++)
+        {
+            expected_exclusive[i] = initial_value + expected_inclusive[i - 1];
+        }
+
+        T* d_input;
+        T* d_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+        HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+        for(const unsigned int grid_limit : {1u, 2u, 7u})
+        {
+            SCOPED_TRACE(testing::Message() << "with grid_limit = " << grid_limit);
+            rocprim::scoped_grid_limit limit(grid_limit);
+
+            for(const bool exclusive : {false, true})
+            {
+                SCOPED_TRACE(testing::Message() << "with exclusive = " << exclusive);
+
+                const auto scan = [&](void* d_temp_storage, size_t& temp_storage_size_bytes)
+                {
+                    return exclusive ? rocprim::exclusive_scan<config>(d_temp_storage,
+                                                                       temp_storage_size_bytes,
+                                                                       d_input,
+                                                                       d_output,
+                                                                       initial_value,
+                                                                       size,
+                                                                       rocprim::plus<T>(),
+                                                                       stream)
+                                     : rocprim::inclusive_scan<config>(d_temp_storage,
+                                                                       temp_storage_size_bytes,
+                                                                       d_input,
+                                                                       d_output,
+                                                                       size,
+                                                                       rocprim::plus<T>(),
+                                                                       stream);
+                };
+
+                size_t temp_storage_size_bytes;
+                HIP_CHECK(scan(nullptr, temp_storage_size_bytes));
+                void* d_temp_storage;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+                HIP_CHECK(hipMemset(d_output, 0, size * sizeof(T)));
+                HIP_CHECK(scan(d_temp_storage, temp_storage_size_bytes));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipFree(d_temp_storage));
+
+                std::vector<T> output(size);
+                HIP_CHECK(
+                    hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(
+                    output,
+                    exclusive ? expected_exclusive : expected_inclusive));
+            }
+        }
+
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_output));
+    }
+}
+
+struct square_to_int
+{
+    ROCPRIM_HOST_DEVICE
+    int operator()(const int8_t value) const
+    {
+        return int(value) * int(value);
+    }
+};
+
+// The input is offset by 0 and 1 items, so full tiles are loaded as vectors and item by item
+TEST(RocprimDeviceScanTests, TransformScan)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                  = int8_t;
+    using U                  = int;
+    const hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(const size_t size : test_utils::get_sizes(seed_value))
+        {
+            for(const size_t offset : {size_t(0), size_t(1)})
+            {
+                SCOPED_TRACE(testing::Message() << "with size = " << size);
+                SCOPED_TRACE(testing::Message() << "with offset = " << offset);
+
+                const std::vector<T> input
+                    = test_utils::get_random_data<T>(size + offset, -10, 10, seed_value);
+                std::vector<U> expected_inclusive(size);
+                std::vector<U> expected_exclusive(size);
+                U              inclusive = 0;
+                U              exclusive = 5;
+                for(size_t i = 0; i < size; i++)
+                {
+                    const U square        = square_to_int{}(input[offset + i]);
+                    expected_exclusive[i] = exclusive;
+                    exclusive += square;
+                    inclusive += square;
+                    expected_inclusive[i] = inclusive;
+                }
+
+                T* d_input;
+                U* d_output;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input.size() * sizeof(T)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(U)));
+                HIP_CHECK(hipMemcpy(d_input,
+                                    input.data(),
+                                    input.size() * sizeof(T),
+                                    hipMemcpyHostToDevice));
+
+                size_t inclusive_storage_size = 0;
+                HIP_CHECK(rocprim::transform_inclusive_scan(nullptr,
+                                                            inclusive_storage_size,
+                                                            d_input + offset,
+                                                            d_output,
+                                                            size,
+                                                            rocprim::plus<U>(),
+                                                            square_to_int{},
+                                                            stream));
+                size_t exclusive_storage_size = 0;
+                HIP_CHECK(rocprim::transform_exclusive_scan(nullptr,
+                                                            exclusive_storage_size,
+                                                            d_input + offset,
+                                                            d_output,
+                                                            U(5),
+                                                            size,
+                                                            rocprim::plus<U>(),
+                                                            square_to_int{},
+                                                            stream));
+                size_t temp_storage_size_bytes
+                    = std::max(inclusive_storage_size, exclusive_storage_size);
+                void* d_temp_storage;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+                std::vector<U> output(size);
+                HIP_CHECK(rocprim::transform_inclusive_scan(d_temp_storage,
+                                                            temp_storage_size_bytes,
+                                                            d_input + offset,
+                                                            d_output,
+                                                            size,
+                                                            rocprim::plus<U>(),
+                                                            square_to_int{},
+                                                            stream));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipMemcpy(output.data(),
+                                    d_output,
+                                    size * sizeof(U),
+                                    hipMemcpyDeviceToHost));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected_inclusive));
+
+                HIP_CHECK(rocprim::transform_exclusive_scan(d_temp_storage,
+                                                            temp_storage_size_bytes,
+                                                            d_input + offset,
+                                                            d_output,
+                                                            U(5),
+                                                            size,
+                                                            rocprim::plus<U>(),
+                                                            square_to_int{},
+                                                            stream));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipMemcpy(output.data(),
+                                    d_output,
+                                    size * sizeof(U),
+                                    hipMemcpyDeviceToHost));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected_exclusive));
+
+                HIP_CHECK(hipFree(d_temp_storage));
+                HIP_CHECK(hipFree(d_input));
+                HIP_CHECK(hipFree(d_output));
+            }
+        }
+    }
+}
+
+template<class T>
+void test_lookback_state_cache()
+{
+    const hipStream_t stream = 0; // default
+
+    const size_t         max_size = size_t(1) << 20;
+    const std::vector<T> input    = test_utils::get_random_data<T>(max_size, 1, 10, 123);
+
+    T* d_input;
+    T* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, max_size * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, max_size * sizeof(T)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), max_size * sizeof(T), hipMemcpyHostToDevice));
+
+    size_t temp_storage_size_bytes;
+    HIP_CHECK(rocprim::inclusive_scan(nullptr,
+                                      temp_storage_size_bytes,
+                                      d_input,
+                                      d_output,
+                                      max_size,
+                                      rocprim::plus<T>(),
+                                      stream));
+    void* d_temp_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+    rocprim::lookback_state_cache cache;
+    {
+        rocprim::scoped_lookback_state_cache use_cache(cache);
+
+        // More calls than epochs, with runs of the same size and changes of the size, which clear
+        // the state
+        for(unsigned int run = 0; run < 150; run++)
+        {
+            const size_t size = run % 50 < 40 ? max_size - run : size_t(10000) + run;
+            SCOPED_TRACE(testing::Message() << "with run = " << run);
+
+            size_t storage_size = temp_storage_size_bytes;
+            HIP_CHECK(rocprim::inclusive_scan(d_temp_storage,
+                                              storage_size,
+                                              d_input,
+                                              d_output,
+                                              size,
+                                              rocprim::plus<T>(),
+                                              stream));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<T> output(size);
+            HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+            std::vector<T> expected(size);
+            std::partial_sum(input.begin(), input.begin() + size, expected.begin());
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+        }
+    }
+    HIP_CHECK(cache.release());
+
+    HIP_CHECK(hipFree(d_temp_storage));
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
+
+// Consecutive scans reuse the look-back state of the cache without initializing it
+TEST(RocprimDeviceScanTests, LookbackStateCache)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    ASSERT_NO_FATAL_FAILURE(test_lookback_state_cache<int>());
+    ASSERT_NO_FATAL_FAILURE(test_lookback_state_cache<double>());
+}
+
+template<bool UseLookback>
+void test_scan_with_total()
+{
+    using T      = int;
+    using config = rocprim::scan_config<256,
+                                        4,
+                                        UseLookback,
+                                        rocprim::block_load_method::block_load_transpose,
+                                        rocprim::block_store_method::block_store_transpose,
+                                        rocprim::block_scan_algorithm::using_warp_scan>;
+    SCOPED_TRACE(testing::Message() << "with UseLookback = " << UseLookback);
+
+    const hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(const size_t size : test_utils::get_sizes(seed_value))
+        {
+            if(size == 0)
+            {
+                continue;
+            }
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = test_utils::get_random_data<T>(size, -10, 10, seed_value);
+            const std::vector<T> keys  = test_utils::get_random_data<T>(size, 0, 3, seed_value + 1);
+
+            // Totals of the whole input and of the last segment of keys
+            size_t last_segment = size - 1;
+            while(last_segment > 0 && keys[last_segment - 1] == keys[size - 1])
+            {
+                last_segment--;
+            }
+            const T total = std::accumulate(input.begin(), input.end(), T(0));
+            const T last_segment_total
+                = std::accumulate(input.begin() + last_segment, input.end(), T(0));
+
+            T* d_input;
+            T* d_keys;
+            T* d_output;
+            T* d_total;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_total, 4 * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_keys, keys.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            size_t storage_sizes[4] = {};
+            HIP_CHECK(rocprim::inclusive_scan_with_total<config>(nullptr,
+                                                                 storage_sizes[0],
+                                                                 d_input,
+                                                                 d_output,
+                                                                 d_total,
+                                                                 size,
+                                                                 rocprim::plus<T>(),
+                                                                 stream));
+            HIP_CHECK(rocprim::exclusive_scan_with_total<config>(nullptr,
+                                                                 storage_sizes[1],
+                                                                 d_input,
+                                                                 d_output,
+                                                                 d_total + 1,
+                                                                 T(5),
+                                                                 size,
+                                                                 rocprim::plus<T>(),
+                                                                 stream));
+            HIP_CHECK(rocprim::inclusive_scan_by_key_with_total(nullptr,
+                                                                storage_sizes[2],
+                                                                d_keys,
+                                                                d_input,
+                                                                d_output,
+                                                                d_total + 2,
+                                                                size,
+                                                                rocprim::plus<T>(),
+                                                                rocprim::equal_to<T>(),
+                                                                stream));
+            HIP_CHECK(rocprim::exclusive_scan_by_key_with_total(nullptr,
+                                                                storage_sizes[3],
+                                                                d_keys,
+                                                                d_input,
+                                                                d_output,
+                                                                d_total + 3,
+                                                                T(5),
+                                                                size,
+                                                                rocprim::plus<T>(),
+                                                                rocprim::equal_to<T>(),
+                                                                stream));
+            size_t temp_storage_size_bytes = *std::max_element(storage_sizes, storage_sizes + 4);
+            void*  d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            HIP_CHECK(rocprim::inclusive_scan_with_total<config>(d_temp_storage,
+                                                                 temp_storage_size_bytes,
+                                                                 d_input,
+                                                                 d_output,
+                                                                 d_total,
+                                                                 size,
+                                                                 rocprim::plus<T>(),
+                                                                 stream));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(rocprim::exclusive_scan_with_total<config>(d_temp_storage,
+                                                                 temp_storage_size_bytes,
+                                                                 d_input,
+                                                                 d_output,
+                                                                 d_total + 1,
+                                                                 T(5),
+                                                                 size,
+                                                                 rocprim::plus<T>(),
+                                                                 stream));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(rocprim::inclusive_scan_by_key_with_total(d_temp_storage,
+                                                                temp_storage_size_bytes,
+                                                                d_keys,
+                                                                d_input,
+                                                                d_output,
+                                                                d_total + 2,
+                                                                size,
+                                                                rocprim::plus<T>(),
+                                                                rocprim::equal_to<T>(),
+                                                                stream));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(rocprim::exclusive_scan_by_key_with_total(d_temp_storage,
+                                                                temp_storage_size_bytes,
+                                                                d_keys,
+                                                                d_input,
+                                                                d_output,
+                                                                d_total + 3,
+                                                                T(5),
+                                                                size,
+                                                                rocprim::plus<T>(),
+                                                                rocprim::equal_to<T>(),
+                                                                stream));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<T> totals(4);
+            HIP_CHECK(hipMemcpy(totals.data(), d_total, 4 * sizeof(T), hipMemcpyDeviceToHost));
+            ASSERT_EQ(totals[0], total);
+            ASSERT_EQ(totals[1], total + 5);
+            ASSERT_EQ(totals[2], last_segment_total);
+            ASSERT_EQ(totals[3], last_segment_total + 5);
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_keys));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_total));
+        }
+    }
+}
+
+// The last block writes the total of the scan, both with look-back and reduce-then-scan
+TEST(RocprimDeviceScanTests, ScanWithTotal)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    ASSERT_NO_FATAL_FAILURE(test_scan_with_total<true>());
+    ASSERT_NO_FATAL_FAILURE(test_scan_with_total<false>());
+}
+
+// The int8_t inputs are loaded as int8_t and accumulated as int
+TEST(RocprimDeviceScanTests, ScanAccumulatorType)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                  = int8_t;
+    using U                  = int;
+    const hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(const size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+            std::vector<U>       expected_inclusive(size);
+            std::vector<U>       expected_exclusive(size);
+            U                    inclusive = 0;
+            U                    exclusive = 5;
+            for(size_t i = 0; i < size; i++)
+            {
+                expected_exclusive[i] = exclusive;
+                exclusive += input[i];
+                inclusive += input[i];
+                expected_inclusive[i] = inclusive;
+            }
+
+            T* d_input;
+            U* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, (size + 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, (size + 1) * sizeof(U)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            size_t storage_sizes[2] = {};
+            HIP_CHECK((rocprim::inclusive_scan<rocprim::default_config,
+                                               T*,
+                                               U*,
+                                               rocprim::plus<U>,
+                                               U>(nullptr,
+                                                  storage_sizes[0],
+                                                  d_input,
+                                                  d_output,
+                                                  size,
+                                                  rocprim::plus<U>(),
+                                                  stream)));
+            HIP_CHECK((rocprim::exclusive_scan<rocprim::default_config,
+                                               T*,
+                                               U*,
+                                               T,
+                                               rocprim::plus<U>,
+                                               U>(nullptr,
+                                                  storage_sizes[1],
+                                                  d_input,
+                                                  d_output,
+                                                  T(5),
+                                                  size,
+                                                  rocprim::plus<U>(),
+                                                  stream)));
+            size_t temp_storage_size_bytes = std::max(storage_sizes[0], storage_sizes[1]);
+            void*  d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            std::vector<U> output(size);
+            HIP_CHECK((rocprim::inclusive_scan<rocprim::default_config,
+                                               T*,
+                                               U*,
+                                               rocprim::plus<U>,
+                                               U>(d_temp_storage,
+                                                  temp_storage_size_bytes,
+                                                  d_input,
+                                                  d_output,
+                                                  size,
+                                                  rocprim::plus<U>(),
+                                                  stream)));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(U), hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected_inclusive));
+
+            HIP_CHECK((rocprim::exclusive_scan<rocprim::default_config,
+                                               T*,
+                                               U*,
+                                               T,
+                                               rocprim::plus<U>,
+                                               U>(d_temp_storage,
+                                                  temp_storage_size_bytes,
+                                                  d_input,
+                                                  d_output,
+                                                  T(5),
+                                                  size,
+                                                  rocprim::plus<U>(),
+                                                  stream)));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(U), hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected_exclusive));
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+// The look-back of the scans waits for the prefixes of the preceding blocks with Backoff
+template<rocprim::lookback_backoff Backoff>
+void test_scan_lookback_backoff()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T      = int;
+    using config = rocprim::scan_config<256,
+                                        4,
+                                        true,
+                                        rocprim::block_load_method::block_load_transpose,
+                                        rocprim::block_store_method::block_store_transpose,
+                                        rocprim::block_scan_algorithm::using_warp_scan,
+                                        ROCPRIM_GRID_SIZE_LIMIT,
+                                        0,
+                                        Backoff>;
+
+    const hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(const size_t size : test_utils::get_sizes(seed_value))
+        {
+            if(size == 0)
+            {
+                continue;
+            }
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = test_utils::get_random_data<T>(size, -10, 10, seed_value);
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            for(const bool exclusive : {false, true})
+            {
+                SCOPED_TRACE(testing::Message() << "with exclusive = " << exclusive);
+
+                const auto scan = [&](void* d_temp_storage, size_t& temp_storage_size_bytes)
+                {
+                    return exclusive ? rocprim::exclusive_scan<config>(d_temp_storage,
+                                                                       temp_storage_size_bytes,
+                                                                       d_input,
+                                                                       d_output,
+                                                                       T(5),
+                                                                       size,
+                                                                       rocprim::plus<T>(),
+                                                                       stream)
+                                     : rocprim::inclusive_scan<config>(d_temp_storage,
+                                                                       temp_storage_size_bytes,
+                                                                       d_input,
+                                                                       d_output,
+                                                                       size,
+                                                                       rocprim::plus<T>(),
+                                                                       stream);
+                };
+
+                size_t temp_storage_size_bytes;
+                HIP_CHECK(scan(nullptr, temp_storage_size_bytes));
+                void* d_temp_storage;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+                HIP_CHECK(scan(d_temp_storage, temp_storage_size_bytes));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipFree(d_temp_storage));
+
+                std::vector<T> expected(size);
+                if(exclusive)
+                {
+                    expected[0] = T(5);
+                    std::partial_sum(input.begin(), input.end() - 1, expected.begin() + 1);
+                    for(size_t i = 1; i < size; i++)
+                    {
+                        expected[i] += T(5);
+                    }
+                }
+                else
+                {
+                    std::partial_sum(input.begin(), input.end(), expected.begin());
+                }
+
+                std::vector<T> output(size);
+                HIP_CHECK(
+                    hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+            }
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+TEST(RocprimDeviceScanTests, LookbackBackoffAutomatic)
+{
+    test_scan_lookback_backoff<rocprim::lookback_backoff::automatic>();
+}
+
+TEST(RocprimDeviceScanTests, LookbackBackoffSpin)
+{
+    test_scan_lookback_backoff<rocprim::lookback_backoff::spin>();
+}
+
+TEST(RocprimDeviceScanTests, LookbackBackoffExponentialSleep)
+{
+    test_scan_lookback_backoff<rocprim::lookback_backoff::exponential_sleep>();
+}
+
+TEST(RocprimDeviceScanTests, LookbackBackoffBoundedSleep)
+{
+    test_scan_lookback_backoff<rocprim::lookback_backoff::bounded_sleep>();
+}
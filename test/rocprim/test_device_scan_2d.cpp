@@ -0,0 +1,207 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_scan_2d.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <utility>
+#include <vector>
+
+template<class T,
+         class ScanOp = ::rocprim::plus<T>,
+         int Init     = 0,
+         class Config = rocprim::default_config>
+struct params
+{
+    using type                = T;
+    using scan_op_type        = ScanOp;
+    static constexpr int init = Init;
+    using config              = Config;
+};
+
+template<class Params>
+class RocprimDeviceScan2D : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+using custom_int2 = test_utils::custom_test_type<int>;
+
+typedef ::testing::Types<params<int>,
+                         params<unsigned int, rocprim::maximum<unsigned int>, 10>,
+                         params<long long, rocprim::plus<long long>, -100>,
+                         params<custom_int2, rocprim::plus<custom_int2>, 5>,
+                         params<int, rocprim::plus<int>, 0, rocprim::scan_2d_config<32, 4, 4>>,
+                         params<int, rocprim::minimum<int>, 1000, rocprim::scan_2d_config<8, 8, 1>>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimDeviceScan2D, Params);
+
+// Pairs of width and height, including images smaller than a tile and partial tiles
+inline std::vector<std::pair<unsigned int, unsigned int>> get_2d_sizes()
+{
+    return {{0, 0}, {0, 10}, {1, 1}, {7, 3}, {100, 1}, {1, 100}, {129, 33},
+            {300, 300}, {1000, 517}};
+}
+
+template<bool Exclusive, class Params>
+void test_scan_2d()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T            = typename Params::type;
+    using scan_op_type = typename Params::scan_op_type;
+    using config       = typename Params::config;
+
+    scan_op_type scan_op;
+
+    const T    init              = T{Params::init};
+    const bool debug_synchronous = false;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(const auto& image_size : get_2d_sizes())
+        {
+            const unsigned int width  = image_size.first;
+            const unsigned int height = image_size.second;
+            SCOPED_TRACE(testing::Message() << "with size = " << width << "x" << height);
+
+            const size_t   size  = static_cast<size_t>(width) * height;
+            std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+
+            // Calculate expected results on host: the rows are scanned, then the columns
+            std::vector<T> inclusive(input);
+            for(unsigned int i = 0; i < height; i++)
+            {
+                for(unsigned int j = 1; j < width; j++)
+                {
+                    const size_t index = static_cast<size_t>(i) * width + j;
+                    inclusive[index]   = scan_op(inclusive[index - 1], inclusive[index]);
+                }
+            }
+            for(unsigned int i = 1; i < height; i++)
+            {
+                for(unsigned int j = 0; j < width; j++)
+                {
+                    const size_t index = static_cast<size_t>(i) * width + j;
+                    inclusive[index]   = scan_op(inclusive[index - width], inclusive[index]);
+                }
+            }
+            std::vector<T> expected(inclusive);
+            if(Exclusive)
+            {
+                for(unsigned int i = 0; i < height; i++)
+                {
+                    for(unsigned int j = 0; j < width; j++)
+                    {
+                        const size_t index = static_cast<size_t>(i) * width + j;
+                        expected[index]    = i == 0 || j == 0
+                                                 ? init
+                                                 : scan_op(init, inclusive[index - width - 1]);
+                    }
+                }
+            }
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            auto run = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+            {
+                if(Exclusive)
+                {
+                    return rocprim::exclusive_scan_2d<config>(d_temporary_storage,
+                                                              temporary_storage_bytes,
+                                                              d_input,
+                                                              d_output,
+                                                              width,
+                                                              height,
+                                                              init,
+                                                              scan_op,
+                                                              stream,
+                                                              debug_synchronous);
+                }
+                return rocprim::inclusive_scan_2d<config>(d_temporary_storage,
+                                                          temporary_storage_bytes,
+                                                          d_input,
+                                                          d_output,
+                                                          width,
+                                                          height,
+                                                          scan_op,
+                                                          stream,
+                                                          debug_synchronous);
+            };
+
+            size_t temporary_storage_bytes;
+            HIP_CHECK(run(nullptr, temporary_storage_bytes));
+
+            ASSERT_GT(temporary_storage_bytes, 0);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<T> output(size);
+            HIP_CHECK(
+                hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceScan2D, InclusiveScan)
+{
+    test_scan_2d<false, typename TestFixture::params>();
+}
+
+TYPED_TEST(RocprimDeviceScan2D, ExclusiveScan)
+{
+    test_scan_2d<true, typename TestFixture::params>();
+}
@@ -0,0 +1,268 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_reduce_multi_device.hpp>
+#include <rocprim/device/device_scan_multi_device.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+template<unsigned int DeviceCount>
+struct params
+{
+    static constexpr unsigned int device_count = DeviceCount;
+};
+
+template<class Params>
+class RocprimMultiDeviceScanTests : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<params<1>, params<2>, params<5>> Params;
+
+TYPED_TEST_SUITE(RocprimMultiDeviceScanTests, Params);
+
+// The parts of the input are placed on the device of the test, the copies between them are the
+// same as between different devices
+struct multi_device_input
+{
+    std::vector<int>                    devices;
+    std::vector<size_t>                 sizes;
+    std::vector<std::vector<long long>> host_inputs;
+    std::vector<long long*>             inputs;
+    std::vector<long long*>             outputs;
+    std::vector<void*>                  temporary_storage;
+    std::vector<size_t>                 storage_sizes;
+
+    multi_device_input(int device_id, unsigned int device_count, unsigned int seed_value)
+        : devices(device_count, device_id)
+        , sizes(test_utils::get_random_data<size_t>(device_count, 0, 1 << 20, seed_value))
+        , host_inputs(device_count)
+        , inputs(device_count)
+        , outputs(device_count)
+        , temporary_storage(device_count)
+        , storage_sizes(device_count)
+    {
+        // Small and empty parts
+        sizes[0] = std::min(sizes[0], size_t(10));
+        if(device_count > 2)
+        {
+            sizes[1] = 0;
+        }
+        for(unsigned int d = 0; d < device_count; d++)
+        {
+            host_inputs[d]
+                = test_utils::get_random_data<long long>(sizes[d], -100, 100, seed_value + d);
+            HIP_CHECK(test_common_utils::hipMallocHelper(&inputs[d],
+                                                         std::max(sizes[d], size_t(1))
+                                                             * sizeof(long long)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&outputs[d],
+                                                         std::max(sizes[d], size_t(1))
+                                                             * sizeof(long long)));
+            HIP_CHECK(hipMemcpy(inputs[d],
+                                host_inputs[d].data(),
+                                sizes[d] * sizeof(long long),
+                                hipMemcpyHostToDevice));
+        }
+    }
+
+    void allocate_storage()
+    {
+        for(size_t d = 0; d < devices.size(); d++)
+        {
+            HIP_CHECK(test_common_utils::hipMallocHelper(&temporary_storage[d], storage_sizes[d]));
+        }
+    }
+
+    std::vector<long long> output(unsigned int d) const
+    {
+        std::vector<long long> result(sizes[d]);
+        HIP_CHECK(hipMemcpy(result.data(),
+                            outputs[d],
+                            sizes[d] * sizeof(long long),
+                            hipMemcpyDeviceToHost));
+        return result;
+    }
+
+    ~multi_device_input()
+    {
+        for(size_t d = 0; d < devices.size(); d++)
+        {
+            HIP_CHECK(hipFree(inputs[d]));
+            HIP_CHECK(hipFree(outputs[d]));
+            HIP_CHECK(hipFree(temporary_storage[d]));
+        }
+    }
+};
+
+TYPED_TEST(RocprimMultiDeviceScanTests, Reduce)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    constexpr unsigned int device_count = TestFixture::params::device_count;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        multi_device_input data(device_id, device_count, seed_value);
+        long long          expected = 1000;
+        for(const std::vector<long long>& input : data.host_inputs)
+        {
+            expected = std::accumulate(input.begin(), input.end(), expected);
+        }
+
+        long long* d_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(long long)));
+
+        HIP_CHECK(rocprim::multi_device_reduce(nullptr,
+                                               data.storage_sizes.data(),
+                                               data.devices.data(),
+                                               device_count,
+                                               data.inputs.data(),
+                                               d_output,
+                                               1000ll,
+                                               data.sizes.data()));
+        data.allocate_storage();
+        HIP_CHECK(rocprim::multi_device_reduce(data.temporary_storage.data(),
+                                               data.storage_sizes.data(),
+                                               data.devices.data(),
+                                               device_count,
+                                               data.inputs.data(),
+                                               d_output,
+                                               1000ll,
+                                               data.sizes.data()));
+        HIP_CHECK(hipGetLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        long long output;
+        HIP_CHECK(hipMemcpy(&output, d_output, sizeof(long long), hipMemcpyDeviceToHost));
+        ASSERT_EQ(output, expected);
+
+        HIP_CHECK(hipFree(d_output));
+    }
+}
+
+TYPED_TEST(RocprimMultiDeviceScanTests, InclusiveScan)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    constexpr unsigned int device_count = TestFixture::params::device_count;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        multi_device_input data(device_id, device_count, seed_value);
+
+        HIP_CHECK(rocprim::multi_device_inclusive_scan(nullptr,
+                                                       data.storage_sizes.data(),
+                                                       data.devices.data(),
+                                                       device_count,
+                                                       data.inputs.data(),
+                                                       data.outputs.data(),
+                                                       data.sizes.data()));
+        data.allocate_storage();
+        HIP_CHECK(rocprim::multi_device_inclusive_scan(data.temporary_storage.data(),
+                                                       data.storage_sizes.data(),
+                                                       data.devices.data(),
+                                                       device_count,
+                                                       data.inputs.data(),
+                                                       data.outputs.data(),
+                                                       data.sizes.data()));
+        HIP_CHECK(hipGetLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        long long prefix = 0;
+        for(unsigned int d = 0; d < device_count; d++)
+        {
+            const std::vector<long long> output = data.output(d);
+            for(size_t i = 0; i < data.sizes[d]; i++)
+            {
+                prefix += data.host_inputs[d][i];
+                ASSERT_EQ(output[i], prefix) << "where device = " << d << ", index = " << i;
+            }
+        }
+    }
+}
+
+TYPED_TEST(RocprimMultiDeviceScanTests, ExclusiveScan)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    constexpr unsigned int device_count = TestFixture::params::device_count;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        multi_device_input data(device_id, device_count, seed_value);
+
+        HIP_CHECK(rocprim::multi_device_exclusive_scan(nullptr,
+                                                       data.storage_sizes.data(),
+                                                       data.devices.data(),
+                                                       device_count,
+                                                       data.inputs.data(),
+                                                       data.outputs.data(),
+                                                       -7ll,
+                                                       data.sizes.data()));
+        data.allocate_storage();
+        HIP_CHECK(rocprim::multi_device_exclusive_scan(data.temporary_storage.data(),
+                                                       data.storage_sizes.data(),
+                                                       data.devices.data(),
+                                                       device_count,
+                                                       data.inputs.data(),
+                                                       data.outputs.data(),
+                                                       -7ll,
+                                                       data.sizes.data()));
+        HIP_CHECK(hipGetLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        long long prefix = -7;
+        for(unsigned int d = 0; d < device_count; d++)
+        {
+            const std::vector<long long> output = data.output(d);
+            for(size_t i = 0; i < data.sizes[d]; i++)
+            {
+                ASSERT_EQ(output[i], prefix) << "where device = " << d << ", index = " << i;
+                prefix += data.host_inputs[d][i];
+            }
+        }
+    }
+}
@@ -0,0 +1,265 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_segmented_merge_sort.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+template<class Key,
+         class Value,
+         class CompareFunction,
+         unsigned int MinSegmentLength,
+         unsigned int MaxSegmentLength,
+         class Config = rocprim::default_config>
+struct params
+{
+    using key_type                                   = Key;
+    using value_type                                 = Value;
+    using compare_function                           = CompareFunction;
+    static constexpr unsigned int min_segment_length = MinSegmentLength;
+    static constexpr unsigned int max_segment_length = MaxSegmentLength;
+    using config                                     = Config;
+};
+
+// Partitions any number of segments to small, medium and large segments
+using config_partitioned = rocprim::segmented_merge_sort_config<
+    16, //< logical warp size small
+    4, //< items per thread small
+    256, //< block size small
+    rocprim::kernel_config<128, 4>, //< medium block size, items per thread
+    rocprim::kernel_config<128, 2>, //< large block size, items per thread
+    0 //< partitioning threshold
+    >;
+
+template<class Params>
+class RocprimDeviceSegmentedMergeSort : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<
+    params<int, int, ::rocprim::less<int>, 0, 100>,
+    params<unsigned int, float, ::rocprim::greater<unsigned int>, 0, 5000>,
+    params<double, long long, ::rocprim::less<double>, 1000, 30000>,
+    params<short, int, ::rocprim::greater<short>, 0, 1, config_partitioned>,
+    params<int, double, ::rocprim::less<int>, 0, 3000, config_partitioned>,
+    params<test_utils::custom_test_type<int>,
+           int,
+           ::rocprim::less<test_utils::custom_test_type<int>>,
+           0,
+           2000,
+           config_partitioned>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimDeviceSegmentedMergeSort, Params);
+
+TYPED_TEST(RocprimDeviceSegmentedMergeSort, SortKeysAndPairs)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type         = typename TestFixture::params::key_type;
+    using value_type       = typename TestFixture::params::value_type;
+    using compare_function = typename TestFixture::params::compare_function;
+    using config           = typename TestFixture::params::config;
+    using offset_type      = unsigned int;
+
+    constexpr unsigned int min_segment_length = TestFixture::params::min_segment_length;
+    constexpr unsigned int max_segment_length = TestFixture::params::max_segment_length;
+
+    hipStream_t stream = 0;
+
+    const bool debug_synchronous = false;
+
+    compare_function compare_op;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        std::default_random_engine            gen(seed_value);
+        std::uniform_int_distribution<size_t> segment_length_dis(min_segment_length,
+                                                                 max_segment_length);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Few distinct keys, so the stability of the sort is checked
+            std::vector<key_type> keys_input
+                = test_utils::get_random_data<key_type>(size, 0, 100, seed_value);
+            std::vector<value_type> values_input(size);
+            test_utils::iota(values_input.begin(), values_input.end(), 0);
+
+            std::vector<offset_type> offsets;
+            unsigned int             segments_count = 0;
+            size_t                   offset         = 0;
+            while(offset < size)
+            {
+                const size_t segment_length = segment_length_dis(gen);
+                offsets.push_back(offset);
+                segments_count++;
+                offset += segment_length;
+            }
+            offsets.push_back(size);
+
+            using key_value = std::pair<key_type, value_type>;
+            std::vector<key_value> expected(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                expected[i] = key_value(keys_input[i], values_input[i]);
+            }
+            for(unsigned int segment = 0; segment < segments_count; segment++)
+            {
+                std::stable_sort(expected.begin() + offsets[segment],
+                                 expected.begin() + offsets[segment + 1],
+                                 [compare_op](const key_value& a, const key_value& b)
+                                 { return compare_op(a.first, b.first); });
+            }
+            std::vector<key_type>   keys_expected(size);
+            std::vector<value_type> values_expected(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                keys_expected[i]   = expected[i].first;
+                values_expected[i] = expected[i].second;
+            }
+
+            key_type*    d_keys_input;
+            key_type*    d_keys_output;
+            value_type*  d_values_input;
+            value_type*  d_values_output;
+            offset_type* d_offsets;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(key_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_values_input, size * sizeof(value_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_values_output, size * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(
+                &d_offsets,
+                (segments_count + 1) * sizeof(offset_type)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values_input,
+                                values_input.data(),
+                                size * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_offsets,
+                                offsets.data(),
+                                (segments_count + 1) * sizeof(offset_type),
+                                hipMemcpyHostToDevice));
+
+            for(bool with_values : {false, true})
+            {
+                SCOPED_TRACE(testing::Message() << "with with_values = " << with_values);
+
+                size_t temporary_storage_bytes;
+                HIP_CHECK(rocprim::segmented_merge_sort<config>(nullptr,
+                                                                temporary_storage_bytes,
+                                                                d_keys_input,
+                                                                d_keys_output,
+                                                                d_values_input,
+                                                                d_values_output,
+                                                                size,
+                                                                segments_count,
+                                                                d_offsets,
+                                                                d_offsets + 1,
+                                                                compare_op));
+
+                // temp_storage_size_bytes must be >0
+                ASSERT_GT(temporary_storage_bytes, 0);
+
+                void* d_temporary_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                             temporary_storage_bytes));
+
+                if(with_values)
+                {
+                    HIP_CHECK(rocprim::segmented_merge_sort<config>(d_temporary_storage,
+                                                                    temporary_storage_bytes,
+                                                                    d_keys_input,
+                                                                    d_keys_output,
+                                                                    d_values_input,
+                                                                    d_values_output,
+                                                                    size,
+                                                                    segments_count,
+                                                                    d_offsets,
+                                                                    d_offsets + 1,
+                                                                    compare_op,
+                                                                    stream,
+                                                                    debug_synchronous));
+                }
+                else
+                {
+                    HIP_CHECK(rocprim::segmented_merge_sort<config>(d_temporary_storage,
+                                                                    temporary_storage_bytes,
+                                                                    d_keys_input,
+                                                                    d_keys_output,
+                                                                    size,
+                                                                    segments_count,
+                                                                    d_offsets,
+                                                                    d_offsets + 1,
+                                                                    compare_op,
+                                                                    stream,
+                                                                    debug_synchronous));
+                }
+
+                std::vector<key_type> keys_output(size);
+                HIP_CHECK(hipMemcpy(keys_output.data(),
+                                    d_keys_output,
+                                    size * sizeof(key_type),
+                                    hipMemcpyDeviceToHost));
+
+                HIP_CHECK(hipFree(d_temporary_storage));
+
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, keys_expected));
+
+                if(with_values)
+                {
+                    std::vector<value_type> values_output(size);
+                    HIP_CHECK(hipMemcpy(values_output.data(),
+                                        d_values_output,
+                                        size * sizeof(value_type),
+                                        hipMemcpyDeviceToHost));
+
+                    ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, values_expected));
+                }
+            }
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_values_output));
+            HIP_CHECK(hipFree(d_offsets));
+        }
+    }
+}
@@ -40,7 +40,8 @@ template<class Key,
          unsigned int EndBit,
          unsigned int MinSegmentLength,
          unsigned int MaxSegmentLength,
-         class Config = rocprim::default_config>
+         class Config = rocprim::default_config,
+         class Offset = unsigned int>
 struct params
 {
     using key_type                                   = Key;
@@ -51,6 +52,7 @@ struct params
     static constexpr unsigned int min_segment_length = MinSegmentLength;
     static constexpr unsigned int max_segment_length = MaxSegmentLength;
     using config                                     = Config;
+    using offset_type                                = Offset;
 };
 
 using config_default = rocprim::segmented_radix_sort_config<
@@ -92,6 +94,31 @@ using config_custom = rocprim::segmented_radix_sort_config<
                             256 //< block size medium
                             >>;
 
+using config_warp_radix_sort = rocprim::segmented_radix_sort_config<
+    4, //< long radix bits
+    3, //< short radix bits
+    rocprim::kernel_config<256, 4>, //< sort block size, items per thread
+    rocprim::WarpSortConfig<32, //< logical warp size small
+                            8, //< items per thread small
+                            256, //< block size small
+                            0, //< partitioning threshold
+                            true, //< enable unpartitioned sort
+                            32, //< logical warp size medium
+                            16, //< items per thread medium
+                            256, //< block size medium
+                            true //< use radix sort small
+                            >>;
+
+using config_device_sort = rocprim::segmented_radix_sort_config<
+    4, //< long radix bits
+    3, //< short radix bits
+    rocprim::kernel_config<256, 4>, //< sort block size, items per thread
+    rocprim::WarpSortConfig<32, //< logical warp size small
+                            4 //< items per thread small
+                            >,
+    3000 //< device sort threshold
+    >;
+
 template<class Params>
 class RocprimDeviceSegmentedRadixSort : public ::testing::Test
 {
@@ -114,7 +141,7 @@ inline void sort_keys()
     static constexpr unsigned int start_bit  = TestFixture::params::start_bit;
     static constexpr unsigned int end_bit    = TestFixture::params::end_bit;
 
-    using offset_type = unsigned int;
+    using offset_type = typename TestFixture::params::offset_type;
 
     hipStream_t stream = 0;
 
@@ -260,6 +287,172 @@ inline void sort_keys()
     }
 }
 
+template<typename TestFixture>
+inline void sort_keys_by_lengths()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type                           = typename TestFixture::params::key_type;
+    using config                             = typename TestFixture::params::config;
+    static constexpr bool         descending = TestFixture::params::descending;
+    static constexpr unsigned int start_bit  = TestFixture::params::start_bit;
+    static constexpr unsigned int end_bit    = TestFixture::params::end_bit;
+
+    using offset_type = typename TestFixture::params::offset_type;
+
+    hipStream_t stream = 0;
+
+    const bool debug_synchronous = false;
+
+    std::random_device         rd;
+    std::default_random_engine gen(rd());
+
+    std::uniform_int_distribution<size_t> segment_length_dis(
+        TestFixture::params::min_segment_length,
+        TestFixture::params::max_segment_length);
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data
+            std::vector<key_type> keys_input;
+            if(rocprim::is_floating_point<key_type>::value)
+            {
+                keys_input = test_utils::get_random_data<key_type>(size,
+                                                                   static_cast<key_type>(-1000),
+                                                                   static_cast<key_type>(+1000),
+                                                                   seed_value);
+            }
+            else
+            {
+                keys_input
+                    = test_utils::get_random_data<key_type>(size,
+                                                            std::numeric_limits<key_type>::min(),
+                                                            std::numeric_limits<key_type>::max(),
+                                                            seed_index);
+            }
+
+            std::vector<offset_type> offsets;
+            unsigned int             segments_count = 0;
+            size_t                   offset         = 0;
+            while(offset < size)
+            {
+                const size_t segment_length = segment_length_dis(gen);
+                offsets.push_back(offset);
+                segments_count++;
+                offset += segment_length;
+            }
+            offsets.push_back(size);
+
+            // The same segments given by their lengths
+            std::vector<offset_type> lengths(segments_count);
+            for(size_t i = 0; i < segments_count; i++)
+            {
+                lengths[i] = offsets[i + 1] - offsets[i];
+            }
+
+            key_type* d_keys_input;
+            key_type* d_keys_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(key_type)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+
+            offset_type* d_lengths;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_lengths,
+                                                   (segments_count + 1) * sizeof(offset_type)));
+            HIP_CHECK(hipMemcpy(d_lengths,
+                                lengths.data(),
+                                segments_count * sizeof(offset_type),
+                                hipMemcpyHostToDevice));
+
+            // Calculate expected results on host
+            std::vector<key_type> expected(keys_input);
+            for(size_t i = 0; i < segments_count; i++)
+            {
+                std::stable_sort(
+                    expected.begin() + offsets[i],
+                    expected.begin() + offsets[i + 1],
+                    test_utils::key_comparator<key_type, descending, start_bit, end_bit>());
+            }
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(rocprim::segmented_radix_sort_keys_by_lengths<config>(
+                nullptr,
+                temporary_storage_bytes,
+                d_keys_input,
+                d_keys_output,
+                size,
+                segments_count,
+                d_lengths,
+                start_bit,
+                end_bit));
+
+            ASSERT_GT(temporary_storage_bytes, 0U);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            if(descending)
+            {
+                HIP_CHECK(rocprim::segmented_radix_sort_keys_desc_by_lengths<config>(
+                    d_temporary_storage,
+                    temporary_storage_bytes,
+                    d_keys_input,
+                    d_keys_output,
+                    size,
+                    segments_count,
+                    d_lengths,
+                    start_bit,
+                    end_bit,
+                    stream,
+                    debug_synchronous));
+            }
+            else
+            {
+                HIP_CHECK(rocprim::segmented_radix_sort_keys_by_lengths<config>(
+                    d_temporary_storage,
+                    temporary_storage_bytes,
+                    d_keys_input,
+                    d_keys_output,
+                    size,
+                    segments_count,
+                    d_lengths,
+                    start_bit,
+                    end_bit,
+                    stream,
+                    debug_synchronous));
+            }
+
+            std::vector<key_type> keys_output(size);
+            HIP_CHECK(hipMemcpy(keys_output.data(),
+                                d_keys_output,
+                                size * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_lengths));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, expected));
+        }
+    }
+}
+
 template<typename TestFixture>
 inline void sort_pairs()
 {
@@ -274,7 +467,7 @@ inline void sort_pairs()
     constexpr unsigned int start_bit  = TestFixture::params::start_bit;
     constexpr unsigned int end_bit    = TestFixture::params::end_bit;
 
-    using offset_type = unsigned int;
+    using offset_type = typename TestFixture::params::offset_type;
 
     hipStream_t stream = 0;
 
@@ -465,6 +658,194 @@ inline void sort_pairs()
     }
 }
 
+template<typename TestFixture>
+inline void sort_pairs_fixed()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type                    = typename TestFixture::params::key_type;
+    using value_type                  = typename TestFixture::params::value_type;
+    using config                      = typename TestFixture::params::config;
+    constexpr bool         descending = TestFixture::params::descending;
+    constexpr unsigned int start_bit  = TestFixture::params::start_bit;
+    constexpr unsigned int end_bit    = TestFixture::params::end_bit;
+
+    hipStream_t stream = 0;
+
+    const bool debug_synchronous = false;
+
+    const unsigned int min_segment_length
+        = std::max<unsigned int>(1, TestFixture::params::min_segment_length);
+    const unsigned int max_segment_length
+        = std::max<unsigned int>(1, TestFixture::params::max_segment_length);
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            for(unsigned int segment_size : {min_segment_length,
+                                             (min_segment_length + max_segment_length) / 2,
+                                             max_segment_length})
+            {
+                SCOPED_TRACE(testing::Message() << "with segment_size = " << segment_size);
+
+                // The tail that does not form a whole segment is not sorted
+                const unsigned int segments_count = static_cast<unsigned int>(size / segment_size);
+                const size_t       sorted_size    = static_cast<size_t>(segments_count) * segment_size;
+
+                // Generate data
+                std::vector<key_type> keys_input;
+                if(rocprim::is_floating_point<key_type>::value)
+                {
+                    keys_input = test_utils::get_random_data<key_type>(sorted_size,
+                                                                       static_cast<key_type>(-1000),
+                                                                       static_cast<key_type>(+1000),
+                                                                       seed_value);
+                }
+                else
+                {
+                    keys_input
+                        = test_utils::get_random_data<key_type>(sorted_size,
+                                                                std::numeric_limits<key_type>::min(),
+                                                                std::numeric_limits<key_type>::max(),
+                                                                seed_index);
+                }
+
+                std::vector<value_type> values_input(sorted_size);
+                test_utils::iota(values_input.begin(), values_input.end(), 0);
+
+                key_type* d_keys_input;
+                key_type* d_keys_output;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input,
+                                                             sorted_size * sizeof(key_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output,
+                                                             sorted_size * sizeof(key_type)));
+                HIP_CHECK(hipMemcpy(d_keys_input,
+                                    keys_input.data(),
+                                    sorted_size * sizeof(key_type),
+                                    hipMemcpyHostToDevice));
+
+                value_type* d_values_input;
+                value_type* d_values_output;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input,
+                                                             sorted_size * sizeof(value_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output,
+                                                             sorted_size * sizeof(value_type)));
+                HIP_CHECK(hipMemcpy(d_values_input,
+                                    values_input.data(),
+                                    sorted_size * sizeof(value_type),
+                                    hipMemcpyHostToDevice));
+
+                using key_value = std::pair<key_type, value_type>;
+
+                // Calculate expected results on host
+                std::vector<key_value> expected(sorted_size);
+                for(size_t i = 0; i < sorted_size; i++)
+                {
+                    expected[i] = key_value(keys_input[i], values_input[i]);
+                }
+                for(size_t i = 0; i < segments_count; i++)
+                {
+                    std::stable_sort(expected.begin() + i * segment_size,
+                                     expected.begin() + (i + 1) * segment_size,
+                                     test_utils::key_value_comparator<key_type,
+                                                                      value_type,
+                                                                      descending,
+                                                                      start_bit,
+                                                                      end_bit>());
+                }
+                std::vector<key_type>   keys_expected(sorted_size);
+                std::vector<value_type> values_expected(sorted_size);
+                for(size_t i = 0; i < sorted_size; i++)
+                {
+                    keys_expected[i]   = expected[i].first;
+                    values_expected[i] = expected[i].second;
+                }
+
+                void*  d_temporary_storage     = nullptr;
+                size_t temporary_storage_bytes = 0;
+                HIP_CHECK(rocprim::segmented_radix_sort_pairs_fixed<config>(d_temporary_storage,
+                                                                            temporary_storage_bytes,
+                                                                            d_keys_input,
+                                                                            d_keys_output,
+                                                                            d_values_input,
+                                                                            d_values_output,
+                                                                            segment_size,
+                                                                            segments_count,
+                                                                            start_bit,
+                                                                            end_bit));
+
+                ASSERT_GT(temporary_storage_bytes, 0U);
+
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                             temporary_storage_bytes));
+
+                if(descending)
+                {
+                    HIP_CHECK(
+                        rocprim::segmented_radix_sort_pairs_fixed_desc<config>(d_temporary_storage,
+                                                                               temporary_storage_bytes,
+                                                                               d_keys_input,
+                                                                               d_keys_output,
+                                                                               d_values_input,
+                                                                               d_values_output,
+                                                                               segment_size,
+                                                                               segments_count,
+                                                                               start_bit,
+                                                                               end_bit,
+                                                                               stream,
+                                                                               debug_synchronous));
+                }
+                else
+                {
+                    HIP_CHECK(
+                        rocprim::segmented_radix_sort_pairs_fixed<config>(d_temporary_storage,
+                                                                          temporary_storage_bytes,
+                                                                          d_keys_input,
+                                                                          d_keys_output,
+                                                                          d_values_input,
+                                                                          d_values_output,
+                                                                          segment_size,
+                                                                          segments_count,
+                                                                          start_bit,
+                                                                          end_bit,
+                                                                          stream,
+                                                                          debug_synchronous));
+                }
+
+                std::vector<key_type> keys_output(sorted_size);
+                HIP_CHECK(hipMemcpy(keys_output.data(),
+                                    d_keys_output,
+                                    sorted_size * sizeof(key_type),
+                                    hipMemcpyDeviceToHost));
+
+                std::vector<value_type> values_output(sorted_size);
+                HIP_CHECK(hipMemcpy(values_output.data(),
+                                    d_values_output,
+                                    sorted_size * sizeof(value_type),
+                                    hipMemcpyDeviceToHost));
+
+                HIP_CHECK(hipFree(d_temporary_storage));
+                HIP_CHECK(hipFree(d_keys_input));
+                HIP_CHECK(hipFree(d_values_input));
+                HIP_CHECK(hipFree(d_keys_output));
+                HIP_CHECK(hipFree(d_values_output));
+
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, keys_expected));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, values_expected));
+            }
+        }
+    }
+}
+
 template<typename TestFixture>
 inline void sort_keys_double_buffer()
 {
@@ -478,7 +859,7 @@ inline void sort_keys_double_buffer()
     constexpr unsigned int start_bit  = TestFixture::params::start_bit;
     constexpr unsigned int end_bit    = TestFixture::params::end_bit;
 
-    using offset_type = unsigned int;
+    using offset_type = typename TestFixture::params::offset_type;
 
     hipStream_t stream = 0;
 
@@ -637,7 +1018,7 @@ inline void sort_pairs_double_buffer()
     constexpr unsigned int start_bit  = TestFixture::params::start_bit;
     constexpr unsigned int end_bit    = TestFixture::params::end_bit;
 
-    using offset_type = unsigned int;
+    using offset_type = typename TestFixture::params::offset_type;
 
     hipStream_t stream = 0;
 
@@ -36,7 +36,9 @@ template<
     unsigned int MinSegmentLength = 0,
     unsigned int MaxSegmentLength = 1000,
     // Tests output iterator with void value_type (OutputIterator concept)
-    bool UseIdentityIterator = false
+    bool UseIdentityIterator = false,
+    class Config = rocprim::default_config,
+    class Offset = unsigned int
 >
 struct params
 {
@@ -47,6 +49,8 @@ struct params
     static constexpr unsigned int min_segment_length = MinSegmentLength;
     static constexpr unsigned int max_segment_length = MaxSegmentLength;
     static constexpr bool use_identity_iterator = UseIdentityIterator;
+    using config = Config;
+    using offset_type = Offset;
 };
 
 template<class Params>
@@ -61,6 +65,15 @@ using custom_double2 = test_utils::custom_test_type<double>;
 using half           = rocprim::half;
 using bfloat16       = rocprim::bfloat16;
 
+template<rocprim::segmented_reduce_algorithm Algorithm>
+using segmented_algorithm_config
+    = rocprim::reduce_config<256,
+                             4,
+                             rocprim::block_reduce_algorithm::using_warp_reduce,
+                             ROCPRIM_GRID_SIZE_LIMIT,
+                             false,
+                             Algorithm>;
+
 typedef ::testing::Types<
     params<unsigned char, unsigned int, rocprim::plus<unsigned int>>,
     params<int, int, rocprim::plus<int>, -100, 0, 10000>,
@@ -79,7 +92,31 @@ typedef ::testing::Types<
     params<half, float, rocprim::plus<float>, 0, 10, 300>,
     params<bfloat16, float, rocprim::plus<float>, 0, 10, 300>,
     params<half, half, rocprim::minimum<half>, 0, 1000, 30000>,
-    params<bfloat16, bfloat16, rocprim::minimum<bfloat16>, 0, 1000, 30000>>
+    params<bfloat16, bfloat16, rocprim::minimum<bfloat16>, 0, 1000, 30000>,
+    params<int, int, rocprim::plus<int>, 5, 0, 20, false,
+           segmented_algorithm_config<rocprim::segmented_reduce_algorithm::thread_per_segment>>,
+    params<int, int, rocprim::plus<int>, 5, 0, 2000, false,
+           segmented_algorithm_config<rocprim::segmented_reduce_algorithm::thread_per_segment>>,
+    params<int, int, rocprim::maximum<int>, 0, 0, 100, true,
+           segmented_algorithm_config<rocprim::segmented_reduce_algorithm::warp_per_segment>>,
+    params<custom_int2, custom_int2, rocprim::plus<custom_int2>, 10, 0, 2000, false,
+           segmented_algorithm_config<rocprim::segmented_reduce_algorithm::warp_per_segment>>,
+    params<int, int, rocprim::plus<int>, 5, 0, 10, false,
+           segmented_algorithm_config<rocprim::segmented_reduce_algorithm::block_per_segment>>,
+    params<int, int, rocprim::plus<int>, 5, 0, 10, false,
+           segmented_algorithm_config<rocprim::segmented_reduce_algorithm::load_balanced>>,
+    params<int, int, rocprim::maximum<int>, 0, 1000, 30000, true,
+           segmented_algorithm_config<rocprim::segmented_reduce_algorithm::load_balanced>>,
+    params<custom_int2, custom_int2, rocprim::plus<custom_int2>, 10, 0, 2000, false,
+           segmented_algorithm_config<rocprim::segmented_reduce_algorithm::load_balanced>>,
+    // 64-bit offsets
+    params<int, int, rocprim::plus<int>, 5, 0, 10000, false, rocprim::default_config, size_t>,
+    params<int, int, rocprim::plus<int>, 5, 0, 2000, false,
+           segmented_algorithm_config<rocprim::segmented_reduce_algorithm::thread_per_segment>,
+           size_t>,
+    params<int, int, rocprim::maximum<int>, 0, 0, 100, true,
+           segmented_algorithm_config<rocprim::segmented_reduce_algorithm::warp_per_segment>,
+           size_t>>
     Params;
 
 TYPED_TEST_SUITE(RocprimDeviceSegmentedReduce, Params);
@@ -93,7 +130,8 @@ TYPED_TEST(RocprimDeviceSegmentedReduce, Reduce)
     using input_type     = typename TestFixture::params::input_type;
     using output_type    = typename TestFixture::params::output_type;
     using reduce_op_type = typename TestFixture::params::reduce_op_type;
-    using offset_type    = unsigned int;
+    using offset_type    = typename TestFixture::params::offset_type;
+    using config         = typename TestFixture::params::config;
 
     reduce_op_type reduce_op;
 
@@ -190,7 +228,7 @@ TYPED_TEST(RocprimDeviceSegmentedReduce, Reduce)
             size_t temporary_storage_bytes;
 
             HIP_CHECK(
-                rocprim::segmented_reduce(
+                rocprim::segmented_reduce<config>(
                     nullptr, temporary_storage_bytes,
                     d_values_input, d_aggregates_output,
                     segments_count,
@@ -206,7 +244,7 @@ TYPED_TEST(RocprimDeviceSegmentedReduce, Reduce)
             HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
 
             HIP_CHECK(
-                rocprim::segmented_reduce(
+                rocprim::segmented_reduce<config>(
                     d_temporary_storage, temporary_storage_bytes,
                     d_values_input,
                     test_utils::wrap_in_identity_iterator<use_identity_iterator>(d_aggregates_output),
@@ -238,3 +276,394 @@ TYPED_TEST(RocprimDeviceSegmentedReduce, Reduce)
     }
 
 }
+
+TEST(RocprimDeviceSegmentedReduceTests, ReduceByLengths)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using value_type  = int;
+    using length_type = unsigned int;
+
+    const bool  debug_synchronous = false;
+    hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(unsigned int segments : {0u, 1u, 10u, 1000u, 10000u})
+        {
+            SCOPED_TRACE(testing::Message() << "with segments = " << segments);
+
+            // Empty segments are included
+            const std::vector<length_type> lengths
+                = test_utils::get_random_data<length_type>(segments, 0, 300, seed_value);
+            size_t size = 0;
+            for(const length_type length : lengths)
+            {
+                size += length;
+            }
+            const std::vector<value_type> input
+                = test_utils::get_random_data<value_type>(size, -100, 100, seed_value);
+
+            std::vector<value_type> expected(segments);
+            size_t                  offset = 0;
+            for(unsigned int i = 0; i < segments; i++)
+            {
+                value_type aggregate = 0;
+                for(size_t j = offset; j < offset + lengths[i]; j++)
+                {
+                    aggregate += input[j];
+                }
+                expected[i] = aggregate;
+                offset += lengths[i];
+            }
+
+            value_type*  d_input;
+            length_type* d_lengths;
+            value_type*  d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         (size + 1) * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_lengths,
+                                                         (segments + 1) * sizeof(length_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output,
+                                                         (segments + 1) * sizeof(value_type)));
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                size * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_lengths,
+                                lengths.data(),
+                                segments * sizeof(length_type),
+                                hipMemcpyHostToDevice));
+
+            size_t temporary_storage_bytes;
+            HIP_CHECK(rocprim::segmented_reduce_by_lengths(nullptr,
+                                                           temporary_storage_bytes,
+                                                           d_input,
+                                                           d_output,
+                                                           segments,
+                                                           d_lengths,
+                                                           rocprim::plus<value_type>(),
+                                                           value_type(0),
+                                                           stream,
+                                                           debug_synchronous));
+            ASSERT_GT(temporary_storage_bytes, 0);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(rocprim::segmented_reduce_by_lengths(d_temporary_storage,
+                                                           temporary_storage_bytes,
+                                                           d_input,
+                                                           d_output,
+                                                           segments,
+                                                           d_lengths,
+                                                           rocprim::plus<value_type>(),
+                                                           value_type(0),
+                                                           stream,
+                                                           debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<value_type> output(segments);
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                segments * sizeof(value_type),
+                                hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_lengths));
+            HIP_CHECK(hipFree(d_output));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+        }
+    }
+}
+
+struct gather_sum_op
+{
+    __host__ __device__
+    int operator()(const int x, const int value) const
+    {
+        return x + value;
+    }
+};
+
+template<class GatherOp, class ReduceOp>
+void test_segmented_gather_reduce(GatherOp gather_op, ReduceOp reduce_op, const int initial_value)
+{
+    using value_type  = int;
+    using offset_type = unsigned int;
+
+    const bool  debug_synchronous = false;
+    hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(unsigned int rows : {0u, 1u, 10u, 1000u, 10000u})
+        {
+            SCOPED_TRACE(testing::Message() << "with rows = " << rows);
+
+            // Empty rows are included, and one long row makes the lengths very uneven
+            std::vector<offset_type> lengths
+                = test_utils::get_random_data<offset_type>(rows, 0, 30, seed_value);
+            if(rows > 0)
+            {
+                lengths[seed_value % rows] = 100000;
+            }
+            std::vector<offset_type> row_offsets(rows + 1, 0);
+            for(unsigned int i = 0; i < rows; i++)
+            {
+                row_offsets[i + 1] = row_offsets[i] + lengths[i];
+            }
+            const size_t       nonzeros = row_offsets[rows];
+            const unsigned int x_size   = 5000;
+
+            const std::vector<value_type> x
+                = test_utils::get_random_data<value_type>(x_size, -10, 10, seed_value);
+            const std::vector<value_type> values
+                = test_utils::get_random_data<value_type>(nonzeros, -10, 10, seed_value + 1);
+            const std::vector<unsigned int> columns
+                = test_utils::get_random_data<unsigned int>(nonzeros, 0, x_size - 1, seed_value);
+
+            std::vector<value_type> expected(rows);
+            for(unsigned int i = 0; i < rows; i++)
+            {
+                value_type aggregate = initial_value;
+                for(size_t j = row_offsets[i]; j < row_offsets[i + 1]; j++)
+                {
+                    aggregate = reduce_op(aggregate, gather_op(x[columns[j]], values[j]));
+                }
+                expected[i] = aggregate;
+            }
+
+            value_type*   d_x;
+            value_type*   d_values;
+            unsigned int* d_columns;
+            offset_type*  d_row_offsets;
+            value_type*   d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_x, x_size * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values,
+                                                         (nonzeros + 1) * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_columns,
+                                                         (nonzeros + 1) * sizeof(unsigned int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_row_offsets,
+                                                         (rows + 1) * sizeof(offset_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output,
+                                                         (rows + 1) * sizeof(value_type)));
+            HIP_CHECK(
+                hipMemcpy(d_x, x.data(), x_size * sizeof(value_type), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values,
+                                values.data(),
+                                nonzeros * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_columns,
+                                columns.data(),
+                                nonzeros * sizeof(unsigned int),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_row_offsets,
+                                row_offsets.data(),
+                                (rows + 1) * sizeof(offset_type),
+                                hipMemcpyHostToDevice));
+
+            size_t temporary_storage_bytes;
+            HIP_CHECK(rocprim::segmented_gather_reduce(nullptr,
+                                                       temporary_storage_bytes,
+                                                       d_x,
+                                                       d_columns,
+                                                       d_values,
+                                                       d_output,
+                                                       rows,
+                                                       d_row_offsets,
+                                                       gather_op,
+                                                       reduce_op,
+                                                       initial_value,
+                                                       stream,
+                                                       debug_synchronous));
+            ASSERT_GT(temporary_storage_bytes, 0);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(rocprim::segmented_gather_reduce(d_temporary_storage,
+                                                       temporary_storage_bytes,
+                                                       d_x,
+                                                       d_columns,
+                                                       d_values,
+                                                       d_output,
+                                                       rows,
+                                                       d_row_offsets,
+                                                       gather_op,
+                                                       reduce_op,
+                                                       initial_value,
+                                                       stream,
+                                                       debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<value_type> output(rows);
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                rows * sizeof(value_type),
+                                hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_x));
+            HIP_CHECK(hipFree(d_values));
+            HIP_CHECK(hipFree(d_columns));
+            HIP_CHECK(hipFree(d_row_offsets));
+            HIP_CHECK(hipFree(d_output));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+        }
+    }
+}
+
+TEST(RocprimDeviceSegmentedReduceTests, SegmentedGatherReduce)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    // Sparse matrix-vector product
+    test_segmented_gather_reduce(rocprim::multiplies<int>(), rocprim::plus<int>(), 0);
+}
+
+TEST(RocprimDeviceSegmentedReduceTests, SegmentedGatherReduceMaximum)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    // Max-plus product, empty rows are the initial value
+    test_segmented_gather_reduce(gather_sum_op(), rocprim::maximum<int>(), -1000);
+}
+
+// The result type of the sum of two int8_t is int8_t, so the items overflow without an explicit
+// accumulator type
+struct generic_plus
+{
+    template<class T>
+    ROCPRIM_HOST_DEVICE
+    T operator()(const T& a, const T& b) const
+    {
+        return a + b;
+    }
+};
+
+TEST(RocprimDeviceSegmentedReduceTests, ReduceAccumulatorType)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T           = int8_t;
+    using U           = int;
+    using offset_type = unsigned int;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(unsigned int segments : {1u, 10u, 1000u})
+        {
+            SCOPED_TRACE(testing::Message() << "with segments = " << segments);
+
+            const std::vector<offset_type> lengths
+                = test_utils::get_random_data<offset_type>(segments, 0, 3000, seed_value);
+            std::vector<offset_type> offsets(segments + 1, 0);
+            for(unsigned int i = 0; i < segments; i++)
+            {
+                offsets[i + 1] = offsets[i] + lengths[i];
+            }
+            const size_t         size = offsets[segments];
+            const std::vector<T> input
+                = test_utils::get_random_data<T>(size, 0, 100, seed_value + 1);
+
+            std::vector<U> expected(segments);
+            for(unsigned int i = 0; i < segments; i++)
+            {
+                U aggregate = 3;
+                for(size_t j = offsets[i]; j < offsets[i + 1]; j++)
+                {
+                    aggregate += input[j];
+                }
+                expected[i] = aggregate;
+            }
+
+            T*           d_input;
+            offset_type* d_offsets;
+            U*           d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, (size + 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_offsets,
+                                                         offsets.size() * sizeof(offset_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, segments * sizeof(U)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_offsets,
+                                offsets.data(),
+                                offsets.size() * sizeof(offset_type),
+                                hipMemcpyHostToDevice));
+
+            size_t temporary_storage_bytes;
+            HIP_CHECK((rocprim::segmented_reduce<rocprim::default_config,
+                                                 T*,
+                                                 U*,
+                                                 offset_type*,
+                                                 generic_plus,
+                                                 U,
+                                                 U>(nullptr,
+                                                    temporary_storage_bytes,
+                                                    d_input,
+                                                    d_output,
+                                                    segments,
+                                                    d_offsets,
+                                                    d_offsets + 1,
+                                                    generic_plus(),
+                                                    U(3),
+                                                    stream)));
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK((rocprim::segmented_reduce<rocprim::default_config,
+                                                 T*,
+                                                 U*,
+                                                 offset_type*,
+                                                 generic_plus,
+                                                 U,
+                                                 U>(d_temporary_storage,
+                                                    temporary_storage_bytes,
+                                                    d_input,
+                                                    d_output,
+                                                    segments,
+                                                    d_offsets,
+                                                    d_offsets + 1,
+                                                    generic_plus(),
+                                                    U(3),
+                                                    stream)));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<U> output(segments);
+            HIP_CHECK(
+                hipMemcpy(output.data(), d_output, segments * sizeof(U), hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_offsets));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
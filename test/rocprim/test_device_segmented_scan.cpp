@@ -714,3 +714,186 @@ TYPED_TEST(RocprimDeviceSegmentedScan, ExclusiveScanUsingHeadFlags)
     }
 
 }
+
+TYPED_TEST(RocprimDeviceSegmentedScan, ScanByKeyInPlace)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    // The values are scanned in place, so the input and the output have the same type
+    using value_type   = typename TestFixture::params::output_type;
+    using key_type     = unsigned int;
+    using scan_op_type = rocprim::plus<value_type>;
+
+    const bool debug_synchronous = false;
+
+    // scan function
+    scan_op_type scan_op;
+    const value_type init = value_type{TestFixture::params::init};
+
+    hipStream_t stream = 0; // default stream
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data, a new key starts a segment
+            std::vector<value_type> input = test_utils::get_random_data<value_type>(size, 1, 10, seed_value);
+            std::vector<key_type> flags = test_utils::get_random_data<key_type>(size, 0, 10, seed_value);
+            std::vector<key_type> keys(size);
+
+            size_t max_segment_length = 1;
+            size_t curr_segment_start = 0;
+            key_type key = 0;
+            for(size_t i = 0; i < size; ++i)
+            {
+                flags[i] = i == 0 || flags[i] == 1U ? 1U : 0U;
+                if(i != 0 && flags[i] == 1U)
+                {
+                    max_segment_length = std::max(max_segment_length, i - curr_segment_start);
+                    curr_segment_start = i;
+                    key++;
+                }
+                keys[i] = key;
+            }
+            max_segment_length = std::max(max_segment_length, size - curr_segment_start);
+
+            const float precision = test_utils::precision<value_type> * max_segment_length;
+            if(precision > 0.5)
+            {
+                std::cout << "Test is skipped from size " << size
+                          << " on, potential error of summation is more than 0.5 of the result "
+                             "with current or larger size"
+                          << std::endl;
+                continue;
+            }
+
+            key_type * d_keys;
+            value_type * d_values;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, keys.size() * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values, input.size() * sizeof(value_type)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_keys, keys.data(),
+                    keys.size() * sizeof(key_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            for(bool exclusive : {false, true})
+            {
+                SCOPED_TRACE(testing::Message() << "with exclusive = " << exclusive);
+
+
+                HIP_CHECK(
+                    hipMemcpy(
+                        d_values, input.data(),
+                        input.size() * sizeof(value_type),
+                        hipMemcpyHostToDevice
+                    )
+                );
+
+                // Calculate expected results on host
+                std::vector<value_type> expected(input.size());
+                if(exclusive)
+                {
+                    test_utils::host_exclusive_segmented_scan_headflags(input.begin(),
+                                                                        input.end(),
+                                                                        flags.begin(),
+                                                                        expected.begin(),
+                                                                        scan_op,
+                                                                        init);
+                }
+                else
+                {
+                    test_utils::host_inclusive_segmented_scan_headflags<value_type>(input.begin(),
+                                                                                    input.end(),
+                                                                                    flags.begin(),
+                                                                                    expected.begin(),
+                                                                                    scan_op);
+                }
+
+                // Get size of d_temp_storage
+                size_t temp_storage_size_bytes;
+                if(exclusive)
+                {
+                    HIP_CHECK(
+                        rocprim::segmented_exclusive_scan_by_key(
+                            nullptr, temp_storage_size_bytes,
+                            d_keys, d_values, d_values, init,
+                            input.size(), scan_op, rocprim::equal_to<key_type>(),
+                            stream, debug_synchronous
+                        )
+                    );
+                }
+                else
+                {
+                    HIP_CHECK(
+                        rocprim::segmented_inclusive_scan_by_key(
+                            nullptr, temp_storage_size_bytes,
+                            d_keys, d_values, d_values,
+                            input.size(), scan_op, rocprim::equal_to<key_type>(),
+                            stream, debug_synchronous
+                        )
+                    );
+                }
+
+                // temp_storage_size_bytes must be >0
+                ASSERT_GT(temp_storage_size_bytes, 0);
+
+                // allocate temporary storage
+                void * d_temp_storage = nullptr;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+                // Run
+                if(exclusive)
+                {
+                    HIP_CHECK(
+                        rocprim::segmented_exclusive_scan_by_key(
+                            d_temp_storage, temp_storage_size_bytes,
+                            d_keys, d_values, d_values, init,
+                            input.size(), scan_op, rocprim::equal_to<key_type>(),
+                            stream, debug_synchronous
+                        )
+                    );
+                }
+                else
+                {
+                    HIP_CHECK(
+                        rocprim::segmented_inclusive_scan_by_key(
+                            d_temp_storage, temp_storage_size_bytes,
+                            d_keys, d_values, d_values,
+                            input.size(), scan_op, rocprim::equal_to<key_type>(),
+                            stream, debug_synchronous
+                        )
+                    );
+                }
+                HIP_CHECK(hipDeviceSynchronize());
+
+                // Check if output values are as expected
+                std::vector<value_type> output(input.size());
+                HIP_CHECK(
+                    hipMemcpy(
+                        output.data(), d_values,
+                        output.size() * sizeof(value_type),
+                        hipMemcpyDeviceToHost
+                    )
+                );
+
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_near(output, expected, precision));
+
+                HIP_CHECK(hipFree(d_temp_storage));
+            }
+
+            HIP_CHECK(hipFree(d_keys));
+            HIP_CHECK(hipFree(d_values));
+        }
+    }
+
+}
@@ -0,0 +1,291 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_segmented_select.hpp>
+#include <rocprim/functional.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <vector>
+
+template<class Value,
+         unsigned int MaxSegmentLength = 100,
+         unsigned int MaxValue         = 10,
+         class Config                  = rocprim::default_config>
+struct params
+{
+    using value_type                                 = Value;
+    static constexpr unsigned int max_segment_length = MaxSegmentLength;
+    static constexpr unsigned int max_value          = MaxValue;
+    using config                                     = Config;
+};
+
+template<class Params>
+class RocprimDeviceSegmentedSelect : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+// Small tiles have many segments that begin in one tile and end in another
+using small_tile_config = rocprim::segmented_select_config<64, 2>;
+
+typedef ::testing::Types<params<int>,
+                         params<unsigned int, 3000, 1000>,
+                         params<unsigned long long, 300, 3>,
+                         params<uint8_t, 500, 20>,
+                         params<short, 200, 5, small_tile_config>,
+                         params<double, 20, 4, small_tile_config>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimDeviceSegmentedSelect, Params);
+
+namespace
+{
+
+std::vector<unsigned int> get_segment_counts()
+{
+    return {0, 1, 10, 200, 1234, 5000};
+}
+
+// Offsets of segments that cover the input, some segments are empty and most are short.
+// Returns the size of the input.
+unsigned int get_segment_offsets(const unsigned int          segments,
+                                 const unsigned int          max_segment_length,
+                                 std::vector<unsigned int>&  offsets,
+                                 std::default_random_engine& engine)
+{
+    std::uniform_int_distribution<unsigned int> long_distribution(0, max_segment_length);
+    std::uniform_int_distribution<unsigned int> short_distribution(0, 20);
+    std::uniform_int_distribution<unsigned int> long_segment_distribution(0, 9);
+
+    offsets.resize(segments + 1);
+    offsets[0] = 0;
+    for(unsigned int i = 0; i < segments; i++)
+    {
+        const unsigned int length = long_segment_distribution(engine) == 0
+                                        ? long_distribution(engine)
+                                        : short_distribution(engine);
+        offsets[i + 1]            = offsets[i] + length;
+    }
+    return offsets[segments];
+}
+
+template<class T>
+struct is_even
+{
+    ROCPRIM_HOST_DEVICE bool operator()(const T& a) const
+    {
+        return static_cast<unsigned long long>(a) % 2 == 0;
+    }
+};
+
+template<bool Unique, class Config, class T>
+hipError_t run_segmented_select(void*               temporary_storage,
+                                size_t&             storage_size,
+                                const T*            input,
+                                T*                  output,
+                                unsigned int*       output_offsets,
+                                const unsigned int  size,
+                                const unsigned int  segments,
+                                const unsigned int* input_offsets,
+                                const hipStream_t   stream,
+                                const bool          debug_synchronous)
+{
+    if(Unique)
+    {
+        return rocprim::segmented_unique<Config>(temporary_storage,
+                                                 storage_size,
+                                                 input,
+                                                 output,
+                                                 output_offsets,
+                                                 size,
+                                                 segments,
+                                                 input_offsets,
+                                                 rocprim::equal_to<T>(),
+                                                 stream,
+                                                 debug_synchronous);
+    }
+    return rocprim::segmented_select<Config>(temporary_storage,
+                                             storage_size,
+                                             input,
+                                             output,
+                                             output_offsets,
+                                             size,
+                                             segments,
+                                             input_offsets,
+                                             is_even<T>(),
+                                             stream,
+                                             debug_synchronous);
+}
+
+template<bool Unique, class Params>
+void test_segmented_select()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using value_type                  = typename Params::value_type;
+    using config                      = typename Params::config;
+    constexpr unsigned int max_length = Params::max_segment_length;
+    constexpr unsigned int max_value  = Params::max_value;
+    const bool             debug_synchronous = false;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+        std::default_random_engine engine(seed_value);
+
+        for(const unsigned int segments : get_segment_counts())
+        {
+            SCOPED_TRACE(testing::Message() << "with segments = " << segments);
+
+            std::vector<unsigned int> offsets;
+            const unsigned int        size
+                = get_segment_offsets(segments, max_length, offsets, engine);
+
+            // Few distinct values give long runs of equal values that cross segment heads
+            std::vector<value_type> input
+                = test_utils::get_random_data<value_type>(size, 0, max_value, seed_value);
+            if(Unique)
+            {
+                std::sort(input.begin(), input.end());
+            }
+
+            // Calculate expected results on host
+            std::vector<value_type>   expected;
+            std::vector<unsigned int> expected_offsets(1, 0);
+            for(unsigned int i = 0; i < segments; i++)
+            {
+                const auto segment_begin = input.begin() + offsets[i];
+                const auto segment_end   = input.begin() + offsets[i + 1];
+                if(Unique)
+                {
+                    std::unique_copy(segment_begin, segment_end, std::back_inserter(expected));
+                }
+                else
+                {
+                    std::copy_if(segment_begin,
+                                 segment_end,
+                                 std::back_inserter(expected),
+                                 is_even<value_type>());
+                }
+                expected_offsets.push_back(static_cast<unsigned int>(expected.size()));
+            }
+
+            value_type*   d_input;
+            value_type*   d_output;
+            unsigned int* d_input_offsets;
+            unsigned int* d_output_offsets;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_input, (size + 1) * sizeof(value_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_output, (size + 1) * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input_offsets,
+                                                         (segments + 1) * sizeof(unsigned int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output_offsets,
+                                                         (segments + 1) * sizeof(unsigned int)));
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                size * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_input_offsets,
+                                offsets.data(),
+                                (segments + 1) * sizeof(unsigned int),
+                                hipMemcpyHostToDevice));
+
+            size_t temporary_storage_bytes;
+            HIP_CHECK((run_segmented_select<Unique, config>(nullptr,
+                                                            temporary_storage_bytes,
+                                                            d_input,
+                                                            d_output,
+                                                            d_output_offsets,
+                                                            size,
+                                                            segments,
+                                                            d_input_offsets,
+                                                            stream,
+                                                            debug_synchronous)));
+            ASSERT_GT(temporary_storage_bytes, 0);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK((run_segmented_select<Unique, config>(d_temporary_storage,
+                                                            temporary_storage_bytes,
+                                                            d_input,
+                                                            d_output,
+                                                            d_output_offsets,
+                                                            size,
+                                                            segments,
+                                                            d_input_offsets,
+                                                            stream,
+                                                            debug_synchronous)));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<unsigned int> output_offsets(segments + 1);
+            HIP_CHECK(hipMemcpy(output_offsets.data(),
+                                d_output_offsets,
+                                (segments + 1) * sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output_offsets, expected_offsets));
+
+            std::vector<value_type> output(expected.size());
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                expected.size() * sizeof(value_type),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_input_offsets));
+            HIP_CHECK(hipFree(d_output_offsets));
+            HIP_CHECK(hipFree(d_temporary_storage));
+        }
+    }
+}
+
+} // namespace
+
+TYPED_TEST(RocprimDeviceSegmentedSelect, SegmentedSelect)
+{
+    test_segmented_select<false, typename TestFixture::params>();
+}
+
+TYPED_TEST(RocprimDeviceSegmentedSelect, SegmentedUnique)
+{
+    test_segmented_select<true, typename TestFixture::params>();
+}
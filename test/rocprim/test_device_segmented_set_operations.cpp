@@ -0,0 +1,276 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_segmented_set_operations.hpp>
+#include <rocprim/functional.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <vector>
+
+template<class Key,
+         class CompareOp            = ::rocprim::less<Key>,
+         unsigned int MaxListLength = 100,
+         unsigned int MaxKey        = 50,
+         class Config               = rocprim::default_config>
+struct params
+{
+    using key_type                                = Key;
+    using compare_op_type                         = CompareOp;
+    static constexpr unsigned int max_list_length = MaxListLength;
+    static constexpr unsigned int max_key         = MaxKey;
+    using config                                  = Config;
+};
+
+template<class Params>
+class RocprimDeviceSegmentedSetIntersection : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+// Small warps and a small threshold intersect more pairs by blocks
+using small_warp_config = rocprim::segmented_set_intersection_config<64, 8, 40>;
+
+typedef ::testing::Types<params<int>,
+                         params<unsigned int, rocprim::less<unsigned int>, 3000, 1000>,
+                         params<int, rocprim::greater<int>, 2000, 10>,
+                         params<unsigned long long, rocprim::less<unsigned long long>, 300, 100000>,
+                         params<uint8_t, rocprim::less<uint8_t>, 500, 20>,
+                         params<short, rocprim::less<short>, 200, 30, small_warp_config>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimDeviceSegmentedSetIntersection, Params);
+
+namespace
+{
+
+std::vector<unsigned int> get_pair_counts()
+{
+    return {0, 1, 10, 200, 1234, 5000};
+}
+
+// Offsets of the lists of the pairs with gaps in between, most lists are short. Returns the
+// number of keys covered by the lists.
+unsigned int get_list_offsets(const unsigned int pairs,
+                                           const unsigned int max_list_length,
+                                           std::vector<unsigned int>& begin_offsets,
+                                           std::vector<unsigned int>& end_offsets,
+                                           std::default_random_engine& engine)
+{
+    std::uniform_int_distribution<unsigned int> long_distribution(0, max_list_length);
+    std::uniform_int_distribution<unsigned int> short_distribution(0, 20);
+    std::uniform_int_distribution<unsigned int> gap_distribution(0, 2);
+    std::uniform_int_distribution<unsigned int> long_list_distribution(0, 9);
+
+    begin_offsets.resize(pairs);
+    end_offsets.resize(pairs);
+    unsigned int offset = 0;
+    for(unsigned int i = 0; i < pairs; i++)
+    {
+        const unsigned int length = long_list_distribution(engine) == 0
+                                        ? long_distribution(engine)
+                                        : short_distribution(engine);
+        begin_offsets[i] = offset + gap_distribution(engine);
+        end_offsets[i]   = begin_offsets[i] + length;
+        offset           = end_offsets[i];
+    }
+    return offset;
+}
+
+} // namespace
+
+TYPED_TEST(RocprimDeviceSegmentedSetIntersection, SegmentedSetIntersection)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type                    = typename TestFixture::params::key_type;
+    using compare_op_type             = typename TestFixture::params::compare_op_type;
+    using config                      = typename TestFixture::params::config;
+    constexpr unsigned int max_length = TestFixture::params::max_list_length;
+    constexpr unsigned int max_key    = TestFixture::params::max_key;
+    const bool             debug_synchronous = false;
+
+    hipStream_t stream = 0; // default
+    compare_op_type compare_op;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+        std::default_random_engine engine(seed_value);
+
+        for(const unsigned int pairs : get_pair_counts())
+        {
+            SCOPED_TRACE(testing::Message() << "with pairs = " << pairs);
+
+            std::vector<unsigned int> begin_offsets1;
+            std::vector<unsigned int> end_offsets1;
+            std::vector<unsigned int> begin_offsets2;
+            std::vector<unsigned int> end_offsets2;
+            const unsigned int        size1
+                = get_list_offsets(pairs, max_length, begin_offsets1, end_offsets1, engine);
+            const unsigned int size2
+                = get_list_offsets(pairs, max_length, begin_offsets2, end_offsets2, engine);
+
+            // Few distinct keys give many equal keys in both lists
+            std::vector<key_type> keys_input1
+                = test_utils::get_random_data<key_type>(size1, 0, max_key, seed_value);
+            std::vector<key_type> keys_input2
+                = test_utils::get_random_data<key_type>(size2, 0, max_key, seed_value + 1);
+
+            // Calculate expected results on host
+            std::vector<key_type>     expected_keys;
+            std::vector<unsigned int> expected_offsets(1, 0);
+            for(unsigned int i = 0; i < pairs; i++)
+            {
+                std::sort(keys_input1.begin() + begin_offsets1[i],
+                          keys_input1.begin() + end_offsets1[i],
+                          compare_op);
+                std::sort(keys_input2.begin() + begin_offsets2[i],
+                          keys_input2.begin() + end_offsets2[i],
+                          compare_op);
+                std::set_intersection(keys_input1.begin() + begin_offsets1[i],
+                                      keys_input1.begin() + end_offsets1[i],
+                                      keys_input2.begin() + begin_offsets2[i],
+                                      keys_input2.begin() + end_offsets2[i],
+                                      std::back_inserter(expected_keys),
+                                      compare_op);
+                expected_offsets.push_back(static_cast<unsigned int>(expected_keys.size()));
+            }
+
+            key_type*     d_keys_input1;
+            key_type*     d_keys_input2;
+            key_type*     d_keys_output;
+            unsigned int* d_offsets;
+            unsigned int* d_output_offsets;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input1,
+                                                         (size1 + 1) * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input2,
+                                                         (size2 + 1) * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output,
+                                                         (size1 + 1) * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_offsets,
+                                                         (4 * pairs + 1) * sizeof(unsigned int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output_offsets,
+                                                         (pairs + 1) * sizeof(unsigned int)));
+            HIP_CHECK(hipMemcpy(d_keys_input1,
+                                keys_input1.data(),
+                                size1 * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_keys_input2,
+                                keys_input2.data(),
+                                size2 * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            unsigned int* const d_begin_offsets1 = d_offsets;
+            unsigned int* const d_end_offsets1   = d_offsets + pairs;
+            unsigned int* const d_begin_offsets2 = d_offsets + 2 * pairs;
+            unsigned int* const d_end_offsets2   = d_offsets + 3 * pairs;
+            HIP_CHECK(hipMemcpy(d_begin_offsets1,
+                                begin_offsets1.data(),
+                                pairs * sizeof(unsigned int),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_end_offsets1,
+                                end_offsets1.data(),
+                                pairs * sizeof(unsigned int),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_begin_offsets2,
+                                begin_offsets2.data(),
+                                pairs * sizeof(unsigned int),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_end_offsets2,
+                                end_offsets2.data(),
+                                pairs * sizeof(unsigned int),
+                                hipMemcpyHostToDevice));
+
+            size_t temporary_storage_bytes;
+            HIP_CHECK(rocprim::segmented_set_intersection<config>(nullptr,
+                                                                  temporary_storage_bytes,
+                                                                  d_keys_input1,
+                                                                  d_keys_input2,
+                                                                  d_keys_output,
+                                                                  d_output_offsets,
+                                                                  pairs,
+                                                                  d_begin_offsets1,
+                                                                  d_end_offsets1,
+                                                                  d_begin_offsets2,
+                                                                  d_end_offsets2,
+                                                                  compare_op,
+                                                                  stream,
+                                                                  debug_synchronous));
+            ASSERT_GT(temporary_storage_bytes, 0);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(rocprim::segmented_set_intersection<config>(d_temporary_storage,
+                                                                  temporary_storage_bytes,
+                                                                  d_keys_input1,
+                                                                  d_keys_input2,
+                                                                  d_keys_output,
+                                                                  d_output_offsets,
+                                                                  pairs,
+                                                                  d_begin_offsets1,
+                                                                  d_end_offsets1,
+                                                                  d_begin_offsets2,
+                                                                  d_end_offsets2,
+                                                                  compare_op,
+                                                                  stream,
+                                                                  debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<unsigned int> output_offsets(pairs + 1);
+            HIP_CHECK(hipMemcpy(output_offsets.data(),
+                                d_output_offsets,
+                                (pairs + 1) * sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output_offsets, expected_offsets));
+
+            std::vector<key_type> keys_output(expected_keys.size());
+            HIP_CHECK(hipMemcpy(keys_output.data(),
+                                d_keys_output,
+                                expected_keys.size() * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, expected_keys));
+
+            HIP_CHECK(hipFree(d_keys_input1));
+            HIP_CHECK(hipFree(d_keys_input2));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_offsets));
+            HIP_CHECK(hipFree(d_output_offsets));
+            HIP_CHECK(hipFree(d_temporary_storage));
+        }
+    }
+}
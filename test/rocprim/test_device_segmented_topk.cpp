@@ -0,0 +1,321 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_segmented_topk.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+template<class Key,
+         class Value,
+         bool         Descending,
+         unsigned int K,
+         unsigned int MinSegmentLength,
+         unsigned int MaxSegmentLength,
+         class Config = rocprim::default_config>
+struct params
+{
+    using key_type                                   = Key;
+    using value_type                                 = Value;
+    static constexpr bool         descending         = Descending;
+    static constexpr unsigned int k                  = K;
+    static constexpr unsigned int min_segment_length = MinSegmentLength;
+    static constexpr unsigned int max_segment_length = MaxSegmentLength;
+    using config                                     = Config;
+};
+
+template<class Params>
+class RocprimDeviceSegmentedTopk : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+using small_warp_topk_config = rocprim::segmented_topk_config<128, 4, 16, 2, 128>;
+
+typedef ::testing::Types<
+    params<int, unsigned int, false, 1, 0, 100>,
+    params<int, unsigned int, true, 10, 0, 3000>,
+    params<unsigned char, unsigned int, false, 100, 50, 5000>,
+    params<unsigned short, unsigned int, true, 10, 1000, 30000>,
+    params<float, unsigned int, false, 100, 0, 1000>,
+    params<double, unsigned int, true, 1, 10, 200000>,
+    params<long long, unsigned int, false, 10, 0, 50000>,
+    params<unsigned int, unsigned int, true, 100, 0, 20000, small_warp_topk_config>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimDeviceSegmentedTopk, Params);
+
+// Returns the expected output: the first min(k, length) items of every segment after a stable
+// sort, at segment * k
+template<class Key, class Value, bool Descending>
+void get_expected(const std::vector<Key>&          keys,
+                  const std::vector<Value>&        values,
+                  const std::vector<unsigned int>& offsets,
+                  const unsigned int               k,
+                  std::vector<Key>&                expected_keys,
+                  std::vector<Value>&              expected_values,
+                  std::vector<unsigned int>&       expected_counts)
+{
+    const size_t segments = offsets.size() - 1;
+    expected_keys.assign(segments * k, Key());
+    expected_values.assign(segments * k, Value());
+    expected_counts.assign(segments, 0);
+    for(size_t segment = 0; segment < segments; segment++)
+    {
+        std::vector<size_t> order(offsets[segment + 1] - offsets[segment]);
+        std::iota(order.begin(), order.end(), offsets[segment]);
+        std::stable_sort(order.begin(),
+                         order.end(),
+                         [&](const size_t a, const size_t b)
+                         { return Descending ? keys[b] < keys[a] : keys[a] < keys[b]; });
+        const unsigned int count = std::min<size_t>(k, order.size());
+        for(unsigned int i = 0; i < count; i++)
+        {
+            expected_keys[segment * k + i]   = keys[order[i]];
+            expected_values[segment * k + i] = values[order[i]];
+        }
+        expected_counts[segment] = count;
+    }
+}
+
+TYPED_TEST(RocprimDeviceSegmentedTopk, Select)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type                = typename TestFixture::params::key_type;
+    using value_type              = typename TestFixture::params::value_type;
+    using config                  = typename TestFixture::params::config;
+    constexpr bool         descending        = TestFixture::params::descending;
+    constexpr unsigned int k                 = TestFixture::params::k;
+    const bool             debug_synchronous = false;
+
+    hipStream_t stream = 0; // default
+
+    std::random_device         rd;
+    std::default_random_engine gen(rd());
+
+    std::uniform_int_distribution<size_t> segment_length_dis(
+        TestFixture::params::min_segment_length,
+        TestFixture::params::max_segment_length);
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data, small key types and ranges produce many ties
+            std::vector<key_type> keys_input;
+            if(rocprim::is_floating_point<key_type>::value)
+            {
+                keys_input = test_utils::get_random_data<key_type>(size,
+                                                                   static_cast<key_type>(-1000),
+                                                                   static_cast<key_type>(+1000),
+                                                                   seed_value);
+            }
+            else
+            {
+                keys_input
+                    = test_utils::get_random_data<key_type>(size,
+                                                            std::numeric_limits<key_type>::min(),
+                                                            std::numeric_limits<key_type>::max(),
+                                                            seed_value);
+            }
+            // Values are the indices of the keys, so the choice among tied keys is checked
+            std::vector<value_type> values_input(size);
+            std::iota(values_input.begin(), values_input.end(), value_type(0));
+
+            std::vector<unsigned int> offsets;
+            size_t                    offset = 0;
+            while(offset < size)
+            {
+                offsets.push_back(offset);
+                offset += segment_length_dis(gen);
+            }
+            offsets.push_back(size);
+            const unsigned int segments = offsets.size() - 1;
+            SCOPED_TRACE(testing::Message() << "with segments = " << segments);
+
+            std::vector<key_type>     expected_keys;
+            std::vector<value_type>   expected_values;
+            std::vector<unsigned int> expected_counts;
+            get_expected<key_type, value_type, descending>(keys_input,
+                                                           values_input,
+                                                           offsets,
+                                                           k,
+                                                           expected_keys,
+                                                           expected_values,
+                                                           expected_counts);
+
+            key_type*     d_keys_input;
+            key_type*     d_keys_output;
+            value_type*   d_values_input;
+            value_type*   d_values_output;
+            unsigned int* d_offsets;
+            const size_t  output_size = std::max<size_t>(1, size_t(segments) * k);
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input,
+                                                         (size + 1) * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output,
+                                                         output_size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input,
+                                                         (size + 1) * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output,
+                                                         output_size * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_offsets,
+                                                         offsets.size() * sizeof(unsigned int)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values_input,
+                                values_input.data(),
+                                size * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_offsets,
+                                offsets.data(),
+                                offsets.size() * sizeof(unsigned int),
+                                hipMemcpyHostToDevice));
+
+            auto run = [&](void* temporary_storage, size_t& storage_size, const bool pairs)
+            {
+                if(pairs && descending)
+                {
+                    return rocprim::segmented_topk_pairs_desc<config>(temporary_storage,
+                                                                      storage_size,
+                                                                      d_keys_input,
+                                                                      d_keys_output,
+                                                                      d_values_input,
+                                                                      d_values_output,
+                                                                      segments,
+                                                                      d_offsets,
+                                                                      d_offsets + 1,
+                                                                      k,
+                                                                      stream,
+                                                                      debug_synchronous);
+                }
+                if(pairs)
+                {
+                    return rocprim::segmented_topk_pairs<config>(temporary_storage,
+                                                                 storage_size,
+                                                                 d_keys_input,
+                                                                 d_keys_output,
+                                                                 d_values_input,
+                                                                 d_values_output,
+                                                                 segments,
+                                                                 d_offsets,
+                                                                 d_offsets + 1,
+                                                                 k,
+                                                                 stream,
+                                                                 debug_synchronous);
+                }
+                if(descending)
+                {
+                    return rocprim::segmented_topk_keys_desc<config>(temporary_storage,
+                                                                     storage_size,
+                                                                     d_keys_input,
+                                                                     d_keys_output,
+                                                                     segments,
+                                                                     d_offsets,
+                                                                     d_offsets + 1,
+                                                                     k,
+                                                                     stream,
+                                                                     debug_synchronous);
+                }
+                return rocprim::segmented_topk_keys<config>(temporary_storage,
+                                                            storage_size,
+                                                            d_keys_input,
+                                                            d_keys_output,
+                                                            segments,
+                                                            d_offsets,
+                                                            d_offsets + 1,
+                                                            k,
+                                                            stream,
+                                                            debug_synchronous);
+            };
+
+            for(const bool pairs : {false, true})
+            {
+                SCOPED_TRACE(testing::Message() << "with pairs = " << pairs);
+
+                size_t temporary_storage_bytes;
+                HIP_CHECK(run(nullptr, temporary_storage_bytes, pairs));
+                ASSERT_GT(temporary_storage_bytes, 0);
+                void* d_temporary_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                             temporary_storage_bytes));
+                HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes, pairs));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+                HIP_CHECK(hipFree(d_temporary_storage));
+
+                std::vector<key_type>   keys_output(output_size);
+                std::vector<value_type> values_output(output_size);
+                HIP_CHECK(hipMemcpy(keys_output.data(),
+                                    d_keys_output,
+                                    output_size * sizeof(key_type),
+                                    hipMemcpyDeviceToHost));
+                HIP_CHECK(hipMemcpy(values_output.data(),
+                                    d_values_output,
+                                    output_size * sizeof(value_type),
+                                    hipMemcpyDeviceToHost));
+
+                for(unsigned int segment = 0; segment < segments; segment++)
+                {
+                    for(unsigned int i = 0; i < expected_counts[segment]; i++)
+                    {
+                        const size_t index = size_t(segment) * k + i;
+                        ASSERT_EQ(keys_output[index], expected_keys[index])
+                            << "with segment = " << segment << ", index = " << i;
+                        if(pairs)
+                        {
+                            ASSERT_EQ(values_output[index], expected_values[index])
+                                << "with segment = " << segment << ", index = " << i;
+                        }
+                    }
+                }
+            }
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_values_output));
+            HIP_CHECK(hipFree(d_offsets));
+        }
+    }
+}
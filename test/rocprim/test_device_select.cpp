@@ -23,6 +23,7 @@
 #include "../common_test_header.hpp"
 
 // required rocprim headers
+#include <rocprim/device/device_bitmask.hpp>
 #include <rocprim/device/device_select.hpp>
 #include <rocprim/iterator/constant_iterator.hpp>
 #include <rocprim/iterator/discard_iterator.hpp>
@@ -345,6 +346,298 @@ TYPED_TEST(RocprimDeviceSelectTests, SelectOp)
 
 }
 
+TYPED_TEST(RocprimDeviceSelectTests, SelectOpInPlace)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::input_type;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    hipStream_t stream = 0; // default stream
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data
+            std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+
+            T * d_data;
+            unsigned int * d_selected_count_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_data, input.size() * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_selected_count_output, sizeof(unsigned int)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_data, input.data(),
+                    input.size() * sizeof(T),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            // Calculate expected results on host
+            std::vector<T> expected;
+            expected.reserve(input.size());
+            for(size_t i = 0; i < input.size(); i++)
+            {
+                if(select_op<T>()(input[i]))
+                {
+                    expected.push_back(input[i]);
+                }
+            }
+
+            // temp storage
+            size_t temp_storage_size_bytes;
+            // Get size of d_temp_storage
+            HIP_CHECK(
+                rocprim::select(
+                    nullptr,
+                    temp_storage_size_bytes,
+                    d_data,
+                    d_data,
+                    d_selected_count_output,
+                    input.size(),
+                    select_op<T>(),
+                    stream,
+                    debug_synchronous
+                )
+            );
+
+            // temp_storage_size_bytes must be >0
+            ASSERT_GT(temp_storage_size_bytes, 0);
+
+            // allocate temporary storage
+            void * d_temp_storage = nullptr;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            // Run, the output is the input
+            HIP_CHECK(
+                rocprim::select(
+                    d_temp_storage,
+                    temp_storage_size_bytes,
+                    d_data,
+                    d_data,
+                    d_selected_count_output,
+                    input.size(),
+                    select_op<T>(),
+                    stream,
+                    debug_synchronous
+                )
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Check if number of selected value is as expected
+            unsigned int selected_count_output = 0;
+            HIP_CHECK(
+                hipMemcpy(
+                    &selected_count_output, d_selected_count_output,
+                    sizeof(unsigned int),
+                    hipMemcpyDeviceToHost
+                )
+            );
+            ASSERT_EQ(selected_count_output, expected.size());
+
+            // Check if output values are as expected
+            std::vector<T> output(input.size());
+            HIP_CHECK(
+                hipMemcpy(
+                    output.data(), d_data,
+                    output.size() * sizeof(T),
+                    hipMemcpyDeviceToHost
+                )
+            );
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected, expected.size()));
+
+            hipFree(d_data);
+            hipFree(d_selected_count_output);
+            hipFree(d_temp_storage);
+        }
+    }
+
+}
+
+struct transform_select_square_op
+{
+    __device__ __host__ inline
+    long long operator()(const int& value) const
+    {
+        return static_cast<long long>(value) * value;
+    }
+};
+
+struct transform_select_even_op
+{
+    __device__ __host__ inline
+    bool operator()(const long long& value) const
+    {
+        return value % 2 == 0;
+    }
+};
+
+template<class Config>
+void test_transform_select_inclusive_scan()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = int;
+    using U = long long;
+    const bool debug_synchronous = false;
+
+    hipStream_t stream = 0; // default stream
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data
+            std::vector<T> input = test_utils::get_random_data<T>(size, -100, 100, seed_value);
+
+            T * d_input;
+            U * d_output;
+            U * d_scan_output;
+            size_t * d_selected_count_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input.size() * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, input.size() * sizeof(U)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_scan_output, input.size() * sizeof(U)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_selected_count_output, sizeof(size_t)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_input, input.data(),
+                    input.size() * sizeof(T),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            // Calculate expected results on host
+            std::vector<U> expected;
+            std::vector<U> expected_scan;
+            for(size_t i = 0; i < input.size(); i++)
+            {
+                const U value = transform_select_square_op()(input[i]);
+                if(transform_select_even_op()(value))
+                {
+                    expected.push_back(value);
+                    expected_scan.push_back(expected_scan.empty() ? value : expected_scan.back() + value);
+                }
+            }
+
+            // temp storage
+            size_t temp_storage_size_bytes;
+            // Get size of d_temp_storage
+            HIP_CHECK(
+                rocprim::transform_select_inclusive_scan<Config>(
+                    nullptr,
+                    temp_storage_size_bytes,
+                    d_input,
+                    d_output,
+                    d_scan_output,
+                    d_selected_count_output,
+                    input.size(),
+                    transform_select_square_op(),
+                    transform_select_even_op(),
+                    rocprim::plus<U>(),
+                    stream,
+                    debug_synchronous
+                )
+            );
+
+            // temp_storage_size_bytes must be >0
+            ASSERT_GT(temp_storage_size_bytes, 0);
+
+            // allocate temporary storage
+            void * d_temp_storage = nullptr;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            // Run
+            HIP_CHECK(
+                rocprim::transform_select_inclusive_scan<Config>(
+                    d_temp_storage,
+                    temp_storage_size_bytes,
+                    d_input,
+                    d_output,
+                    d_scan_output,
+                    d_selected_count_output,
+                    input.size(),
+                    transform_select_square_op(),
+                    transform_select_even_op(),
+                    rocprim::plus<U>(),
+                    stream,
+                    debug_synchronous
+                )
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Check if number of selected value is as expected
+            size_t selected_count_output = 0;
+            HIP_CHECK(
+                hipMemcpy(
+                    &selected_count_output, d_selected_count_output,
+                    sizeof(size_t),
+                    hipMemcpyDeviceToHost
+                )
+            );
+            ASSERT_EQ(selected_count_output, expected.size());
+
+            // Check if output values and their scan are as expected
+            std::vector<U> output(input.size());
+            std::vector<U> scan_output(input.size());
+            HIP_CHECK(
+                hipMemcpy(
+                    output.data(), d_output,
+                    output.size() * sizeof(U),
+                    hipMemcpyDeviceToHost
+                )
+            );
+            HIP_CHECK(
+                hipMemcpy(
+                    scan_output.data(), d_scan_output,
+                    scan_output.size() * sizeof(U),
+                    hipMemcpyDeviceToHost
+                )
+            );
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected, expected.size()));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(scan_output, expected_scan, expected_scan.size()));
+
+            hipFree(d_input);
+            hipFree(d_output);
+            hipFree(d_scan_output);
+            hipFree(d_selected_count_output);
+            hipFree(d_temp_storage);
+        }
+    }
+}
+
+TEST(RocprimDeviceSelectTests, TransformSelectInclusiveScan)
+{
+    test_transform_select_inclusive_scan<rocprim::default_config>();
+}
+
+TEST(RocprimDeviceSelectTests, TransformSelectInclusiveScanMultipleLaunches)
+{
+    // A small size limit splits the input into several launches
+    using config = rocprim::select_config<128,
+                                          4,
+                                          rocprim::block_load_method::block_load_transpose,
+                                          rocprim::block_load_method::block_load_transpose,
+                                          rocprim::block_load_method::block_load_transpose,
+                                          rocprim::block_scan_algorithm::using_warp_scan,
+                                          3000>;
+    test_transform_select_inclusive_scan<config>();
+}
+
 std::vector<float> get_discontinuity_probabilities()
 {
     std::vector<float> probabilities = {
@@ -499,6 +792,125 @@ TYPED_TEST(RocprimDeviceSelectTests, Unique)
 }
 
 // The operator must be only called, when we have valid element in a block
+TYPED_TEST(RocprimDeviceSelectTests, UniqueCount)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::input_type;
+
+    using op_type      = rocprim::equal_to<T>;
+    using scan_op_type = rocprim::plus<T>;
+
+    static constexpr bool use_identity_iterator = TestFixture::use_identity_iterator;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    hipStream_t stream = 0; // default stream
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        const auto probabilities = get_discontinuity_probabilities();
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+            for(auto p : probabilities)
+            {
+                SCOPED_TRACE(testing::Message() << "with p = " << p);
+
+                // Generate data
+                std::vector<T> input(size);
+                {
+                    std::vector<T> input01 = test_utils::get_random_data01<T>(size, p, seed_value);
+                    std::partial_sum(
+                        input01.begin(), input01.end(), input.begin(), scan_op_type()
+                    );
+                }
+
+                // Allocate and copy to device
+                T * d_input;
+                size_t * d_unique_count_output;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input.size() * sizeof(T)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_unique_count_output, sizeof(size_t)));
+                HIP_CHECK(
+                    hipMemcpy(
+                        d_input, input.data(),
+                        input.size() * sizeof(T),
+                        hipMemcpyHostToDevice
+                    )
+                );
+
+                // Calculate expected results on host
+                size_t expected = size > 0 ? 1 : 0;
+                for(size_t i = 1; i < input.size(); i++)
+                {
+                    if(!op_type()(input[i - 1], input[i]))
+                    {
+                        expected++;
+                    }
+                }
+
+                // temp storage
+                size_t temp_storage_size_bytes;
+                // Get size of d_temp_storage
+                HIP_CHECK(
+                    rocprim::unique_count(
+                        nullptr,
+                        temp_storage_size_bytes,
+                        d_input,
+                        test_utils::wrap_in_identity_iterator<use_identity_iterator>(d_unique_count_output),
+                        input.size(),
+                        op_type(),
+                        stream,
+                        debug_synchronous
+                    )
+                );
+
+                // temp_storage_size_bytes must be >0
+                ASSERT_GT(temp_storage_size_bytes, 0);
+
+                // allocate temporary storage
+                void * d_temp_storage = nullptr;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+                // Run
+                HIP_CHECK(
+                    rocprim::unique_count(
+                        d_temp_storage,
+                        temp_storage_size_bytes,
+                        d_input,
+                        test_utils::wrap_in_identity_iterator<use_identity_iterator>(d_unique_count_output),
+                        input.size(),
+                        op_type(),
+                        stream,
+                        debug_synchronous
+                    )
+                );
+                HIP_CHECK(hipDeviceSynchronize());
+
+                // Check if number of unique values is as expected
+                size_t unique_count_output = 0;
+                HIP_CHECK(
+                    hipMemcpy(
+                        &unique_count_output, d_unique_count_output,
+                        sizeof(size_t),
+                        hipMemcpyDeviceToHost
+                    )
+                );
+                ASSERT_EQ(unique_count_output, expected);
+
+                hipFree(d_input);
+                hipFree(d_unique_count_output);
+                hipFree(d_temp_storage);
+            }
+        }
+    }
+
+}
+
 template<class T, class F>
 struct element_equal_operator
 {
@@ -898,6 +1310,167 @@ TYPED_TEST(RocprimDeviceUniqueByKeyTests, UniqueByKey)
     }
 }
 
+template<class Config>
+void test_unique_by_key_in_place()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type   = int;
+    using value_type = long long;
+
+    hipStream_t stream = 0; // default stream
+    const bool debug_synchronous = false;
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Few distinct keys, so there are many runs of equal keys
+            std::vector<key_type> keys = test_utils::get_random_data<key_type>(size, 0, 3, seed_value);
+            std::vector<value_type> values(size);
+            std::iota(values.begin(), values.end(), 0);
+
+            key_type * d_keys;
+            value_type * d_values;
+            size_t * d_unique_count_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, keys.size() * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values, values.size() * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_unique_count_output, sizeof(size_t)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_keys, keys.data(),
+                    keys.size() * sizeof(key_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+            HIP_CHECK(
+                hipMemcpy(
+                    d_values, values.data(),
+                    values.size() * sizeof(value_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            // Calculate expected results on host
+            std::vector<key_type> expected_keys;
+            std::vector<value_type> expected_values;
+            for(size_t i = 0; i < size; i++)
+            {
+                if(i == 0 || keys[i - 1] != keys[i])
+                {
+                    expected_keys.push_back(keys[i]);
+                    expected_values.push_back(values[i]);
+                }
+            }
+
+            // temp storage
+            size_t temp_storage_size_bytes;
+            // Get size of d_temp_storage
+            HIP_CHECK(
+                rocprim::unique_by_key<Config>(
+                    nullptr,
+                    temp_storage_size_bytes,
+                    d_keys,
+                    d_values,
+                    d_keys,
+                    d_values,
+                    d_unique_count_output,
+                    size,
+                    rocprim::equal_to<key_type>(),
+                    stream,
+                    debug_synchronous
+                )
+            );
+
+            // temp_storage_size_bytes must be >0
+            ASSERT_GT(temp_storage_size_bytes, 0);
+
+            // allocate temporary storage
+            void * d_temp_storage = nullptr;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            // Run, the outputs are the inputs
+            HIP_CHECK(
+                rocprim::unique_by_key<Config>(
+                    d_temp_storage,
+                    temp_storage_size_bytes,
+                    d_keys,
+                    d_values,
+                    d_keys,
+                    d_values,
+                    d_unique_count_output,
+                    size,
+                    rocprim::equal_to<key_type>(),
+                    stream,
+                    debug_synchronous
+                )
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Check if number of unique values is as expected
+            size_t unique_count_output = 0;
+            HIP_CHECK(
+                hipMemcpy(
+                    &unique_count_output, d_unique_count_output,
+                    sizeof(size_t),
+                    hipMemcpyDeviceToHost
+                )
+            );
+            ASSERT_EQ(unique_count_output, expected_keys.size());
+
+            // Check if output keys and values are as expected
+            std::vector<key_type> output_keys(size);
+            std::vector<value_type> output_values(size);
+            HIP_CHECK(
+                hipMemcpy(
+                    output_keys.data(), d_keys,
+                    output_keys.size() * sizeof(key_type),
+                    hipMemcpyDeviceToHost
+                )
+            );
+            HIP_CHECK(
+                hipMemcpy(
+                    output_values.data(), d_values,
+                    output_values.size() * sizeof(value_type),
+                    hipMemcpyDeviceToHost
+                )
+            );
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output_keys, expected_keys, expected_keys.size()));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output_values, expected_values, expected_values.size()));
+
+            hipFree(d_keys);
+            hipFree(d_values);
+            hipFree(d_unique_count_output);
+            hipFree(d_temp_storage);
+        }
+    }
+}
+
+TEST(RocprimDeviceSelectTests, UniqueByKeyInPlace)
+{
+    test_unique_by_key_in_place<rocprim::default_config>();
+}
+
+TEST(RocprimDeviceSelectTests, UniqueByKeyInPlaceMultipleLaunches)
+{
+    // A small size limit splits the input into several launches
+    using config = rocprim::select_config<128,
+                                          4,
+                                          rocprim::block_load_method::block_load_transpose,
+                                          rocprim::block_load_method::block_load_transpose,
+                                          rocprim::block_load_method::block_load_transpose,
+                                          rocprim::block_scan_algorithm::using_warp_scan,
+                                          3000>;
+    test_unique_by_key_in_place<config>();
+}
+
 class RocprimDeviceSelectLargeInputTests : public ::testing::TestWithParam<unsigned int> {
     public:
         const bool debug_synchronous = false;
@@ -1108,3 +1681,253 @@ TEST_P(RocprimDeviceSelectLargeInputTests, LargeInputUnique)
         HIP_CHECK(hipFree(d_temp_storage));
     }
 }
+
+struct less_than_30
+{
+    ROCPRIM_HOST_DEVICE
+    bool operator()(const int value) const
+    {
+        return value < 30;
+    }
+};
+
+template<class Word>
+void test_select_bitmask()
+{
+    constexpr size_t  word_bits = sizeof(Word) * 8;
+    const hipStream_t stream    = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(const size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<int> input
+                = test_utils::get_random_data<int>(size, 1, 100, seed_value);
+            const size_t           words = (size + word_bits - 1) / word_bits;
+
+            // Calculate expected results on host
+            std::vector<Word> expected_bitmask(words, 0);
+            std::vector<int>  expected;
+            for(size_t i = 0; i < size; i++)
+            {
+                if(less_than_30{}(input[i]))
+                {
+                    expected_bitmask[i / word_bits] |= Word(1) << (i % word_bits);
+                    expected.push_back(input[i]);
+                }
+            }
+
+            int*    d_input;
+            Word*   d_bitmask;
+            int*    d_output;
+            size_t* d_selected_count_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_bitmask, words * sizeof(Word)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_selected_count_output, sizeof(size_t)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(int), hipMemcpyHostToDevice));
+
+            HIP_CHECK(
+                rocprim::predicate_to_bitmask(d_input, d_bitmask, size, less_than_30{}, stream));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<Word> bitmask(words);
+            HIP_CHECK(
+                hipMemcpy(bitmask.data(), d_bitmask, words * sizeof(Word), hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(bitmask, expected_bitmask));
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(rocprim::select_bitmask(nullptr,
+                                              temp_storage_size_bytes,
+                                              d_input,
+                                              d_bitmask,
+                                              d_output,
+                                              d_selected_count_output,
+                                              size,
+                                              stream));
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(rocprim::select_bitmask(d_temp_storage,
+                                              temp_storage_size_bytes,
+                                              d_input,
+                                              d_bitmask,
+                                              d_output,
+                                              d_selected_count_output,
+                                              size,
+                                              stream));
+            HIP_CHECK(hipGetLastError());
+
+            size_t selected_count_output;
+            HIP_CHECK(hipMemcpy(&selected_count_output,
+                                d_selected_count_output,
+                                sizeof(size_t),
+                                hipMemcpyDeviceToHost));
+            ASSERT_EQ(selected_count_output, expected.size());
+            std::vector<int> output(expected.size());
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                output.size() * sizeof(int),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_bitmask));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_selected_count_output));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
+
+TEST(RocprimDeviceSelectTests, Bitmask)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    ASSERT_NO_FATAL_FAILURE(test_select_bitmask<unsigned int>());
+    ASSERT_NO_FATAL_FAILURE(test_select_bitmask<unsigned long long>());
+}
+
+template<bool ByKey>
+void test_unique_with_counts()
+{
+    const hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(const size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Few distinct keys, so there are runs of different lengths
+            const std::vector<int> keys = test_utils::get_random_data<int>(size, 0, 3, seed_value);
+            const std::vector<long long> values
+                = test_utils::get_random_data<long long>(size, -1000, 1000, seed_value + 1);
+
+            // Calculate expected results on host
+            std::vector<int>          expected_keys;
+            std::vector<long long>    expected_values;
+            std::vector<unsigned int> expected_counts;
+            for(size_t i = 0; i < size; i++)
+            {
+                if(i == 0 || keys[i] != keys[i - 1])
+                {
+                    expected_keys.push_back(keys[i]);
+                    expected_values.push_back(values[i]);
+                    expected_counts.push_back(0);
+                }
+                expected_counts.back()++;
+            }
+
+            int*          d_keys;
+            long long*    d_values;
+            int*          d_keys_output;
+            long long*    d_values_output;
+            unsigned int* d_counts_output;
+            size_t*       d_unique_count_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, size * sizeof(int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values, size * sizeof(long long)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(int)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_values_output, size * sizeof(long long)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_counts_output, size * sizeof(unsigned int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_unique_count_output, sizeof(size_t)));
+            HIP_CHECK(hipMemcpy(d_keys, keys.data(), size * sizeof(int), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values,
+                                values.data(),
+                                size * sizeof(long long),
+                                hipMemcpyHostToDevice));
+
+            auto dispatch = [&](void* d_temp_storage, size_t& temp_storage_size_bytes)
+            {
+                return ByKey ? rocprim::unique_by_key_with_counts(d_temp_storage,
+                                                                  temp_storage_size_bytes,
+                                                                  d_keys,
+                                                                  d_values,
+                                                                  d_keys_output,
+                                                                  d_values_output,
+                                                                  d_counts_output,
+                                                                  d_unique_count_output,
+                                                                  size,
+                                                                  rocprim::equal_to<int>(),
+                                                                  stream)
+                             : rocprim::unique_with_counts(d_temp_storage,
+                                                           temp_storage_size_bytes,
+                                                           d_keys,
+                                                           d_keys_output,
+                                                           d_counts_output,
+                                                           d_unique_count_output,
+                                                           size,
+                                                           rocprim::equal_to<int>(),
+                                                           stream);
+            };
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(dispatch(nullptr, temp_storage_size_bytes));
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(dispatch(d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            size_t unique_count_output;
+            HIP_CHECK(hipMemcpy(&unique_count_output,
+                                d_unique_count_output,
+                                sizeof(size_t),
+                                hipMemcpyDeviceToHost));
+            ASSERT_EQ(unique_count_output, expected_keys.size());
+
+            std::vector<int>          keys_output(expected_keys.size());
+            std::vector<unsigned int> counts_output(expected_counts.size());
+            HIP_CHECK(hipMemcpy(keys_output.data(),
+                                d_keys_output,
+                                keys_output.size() * sizeof(int),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(counts_output.data(),
+                                d_counts_output,
+                                counts_output.size() * sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, expected_keys));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(counts_output, expected_counts));
+            if(ByKey)
+            {
+                std::vector<long long> values_output(expected_values.size());
+                HIP_CHECK(hipMemcpy(values_output.data(),
+                                    d_values_output,
+                                    values_output.size() * sizeof(long long),
+                                    hipMemcpyDeviceToHost));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, expected_values));
+            }
+
+            HIP_CHECK(hipFree(d_keys));
+            HIP_CHECK(hipFree(d_values));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_values_output));
+            HIP_CHECK(hipFree(d_counts_output));
+            HIP_CHECK(hipFree(d_unique_count_output));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
+
+TEST(RocprimDeviceSelectTests, UniqueWithCounts)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    ASSERT_NO_FATAL_FAILURE(test_unique_with_counts<false>());
+    ASSERT_NO_FATAL_FAILURE(test_unique_with_counts<true>());
+}
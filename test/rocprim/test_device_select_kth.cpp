@@ -0,0 +1,284 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_select_kth.hpp>
+
+// required test headers
+#include "test_utils_sort_comparator.hpp"
+#include "test_utils_types.hpp"
+
+template<class Key>
+struct params
+{
+    using key_type = Key;
+};
+
+template<class Params>
+class RocprimDeviceSelectKth : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<params<int>,
+                         params<unsigned char>,
+                         params<short>,
+                         params<unsigned long long>,
+                         params<float>,
+                         params<double>,
+                         params<rocprim::half>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimDeviceSelectKth, Params);
+
+// Special values are not added: the sign of a selected zero is only defined for total_order
+template<class Key>
+inline std::vector<Key> get_select_kth_input(const size_t size, const unsigned int seed_value)
+{
+    if(rocprim::is_floating_point<Key>::value)
+    {
+        return test_utils::get_random_data<Key>(size,
+                                                static_cast<Key>(-1000),
+                                                static_cast<Key>(+1000),
+                                                seed_value);
+    }
+    return test_utils::get_random_data<Key>(size,
+                                            std::numeric_limits<Key>::min(),
+                                            std::numeric_limits<Key>::max(),
+                                            seed_value);
+}
+
+TYPED_TEST(RocprimDeviceSelectKth, SelectKth)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type = typename TestFixture::params::key_type;
+
+    hipStream_t stream = 0;
+
+    const bool debug_synchronous = false;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            if(size == 0)
+                continue;
+
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<key_type> keys_input = get_select_kth_input<key_type>(size, seed_value);
+
+            key_type* d_keys_input;
+            key_type* d_output;
+            size_t*   d_k;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_k, sizeof(size_t)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+
+            std::vector<key_type> sorted(keys_input);
+            std::stable_sort(
+                sorted.begin(),
+                sorted.end(),
+                test_utils::key_comparator<key_type, false, 0, sizeof(key_type) * 8>());
+
+            for(size_t k : {size_t(0), size / 2, size - 1, size + 10})
+            {
+                SCOPED_TRACE(testing::Message() << "with k = " << k);
+
+                for(bool use_future_value : {false, true})
+                {
+                    SCOPED_TRACE(testing::Message()
+                                 << "with use_future_value = " << use_future_value);
+
+                    size_t temporary_storage_bytes;
+                    HIP_CHECK(rocprim::select_kth(nullptr,
+                                                  temporary_storage_bytes,
+                                                  d_keys_input,
+                                                  d_output,
+                                                  size,
+                                                  k));
+
+                    ASSERT_GT(temporary_storage_bytes, 0);
+
+                    void* d_temporary_storage;
+                    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                                 temporary_storage_bytes));
+
+                    if(use_future_value)
+                    {
+                        HIP_CHECK(
+                            hipMemcpy(d_k, &k, sizeof(size_t), hipMemcpyHostToDevice));
+                        HIP_CHECK(rocprim::select_kth(d_temporary_storage,
+                                                      temporary_storage_bytes,
+                                                      d_keys_input,
+                                                      d_output,
+                                                      size,
+                                                      rocprim::future_value<size_t>{d_k},
+                                                      stream,
+                                                      debug_synchronous));
+                    }
+                    else
+                    {
+                        HIP_CHECK(rocprim::select_kth(d_temporary_storage,
+                                                      temporary_storage_bytes,
+                                                      d_keys_input,
+                                                      d_output,
+                                                      size,
+                                                      k,
+                                                      stream,
+                                                      debug_synchronous));
+                    }
+
+                    std::vector<key_type> output(1);
+                    HIP_CHECK(hipMemcpy(output.data(),
+                                        d_output,
+                                        sizeof(key_type),
+                                        hipMemcpyDeviceToHost));
+
+                    HIP_CHECK(hipFree(d_temporary_storage));
+
+                    const std::vector<key_type> expected{sorted[std::min(k, size - 1)]};
+                    ASSERT_NO_FATAL_FAILURE(test_utils::assert_bit_eq(output, expected));
+                }
+            }
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_k));
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceSelectKth, SelectKthMultiple)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type = typename TestFixture::params::key_type;
+
+    hipStream_t stream = 0;
+
+    const bool debug_synchronous = false;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            if(size == 0)
+                continue;
+
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<key_type> keys_input = get_select_kth_input<key_type>(size, seed_value);
+
+            // Percentiles and more ks than one histogram launch counts at once
+            std::vector<size_t> ks;
+            for(double p : {0.0, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.95, 0.99, 0.999, 1.0})
+            {
+                ks.push_back(static_cast<size_t>(p * (size - 1)));
+            }
+            ks.push_back(size + 1);
+            const unsigned int k_count = static_cast<unsigned int>(ks.size());
+
+            key_type* d_keys_input;
+            key_type* d_output;
+            size_t*   d_ks;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, k_count * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_ks, k_count * sizeof(size_t)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(
+                hipMemcpy(d_ks, ks.data(), k_count * sizeof(size_t), hipMemcpyHostToDevice));
+
+            std::vector<key_type> sorted(keys_input);
+            std::stable_sort(
+                sorted.begin(),
+                sorted.end(),
+                test_utils::key_comparator<key_type, false, 0, sizeof(key_type) * 8>());
+            std::vector<key_type> expected(k_count);
+            for(unsigned int i = 0; i < k_count; i++)
+            {
+                expected[i] = sorted[std::min(ks[i], size - 1)];
+            }
+
+            size_t temporary_storage_bytes;
+            HIP_CHECK(rocprim::select_kth(nullptr,
+                                          temporary_storage_bytes,
+                                          d_keys_input,
+                                          d_output,
+                                          size,
+                                          d_ks,
+                                          k_count));
+
+            ASSERT_GT(temporary_storage_bytes, 0);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(rocprim::select_kth(d_temporary_storage,
+                                          temporary_storage_bytes,
+                                          d_keys_input,
+                                          d_output,
+                                          size,
+                                          d_ks,
+                                          k_count,
+                                          stream,
+                                          debug_synchronous));
+
+            std::vector<key_type> output(k_count);
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                k_count * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_ks));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_bit_eq(output, expected));
+        }
+    }
+}
@@ -0,0 +1,350 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+// required test headers
+#include "../common_test_header.hpp"
+#include "test_utils_types.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_set_operations.hpp>
+#include <rocprim/functional.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+// Params for tests
+template<class KeyType, class ValueType, class CompareOp = ::rocprim::less<KeyType>>
+struct DeviceSetOperationsParams
+{
+    using key_type        = KeyType;
+    using value_type      = ValueType;
+    using compare_op_type = CompareOp;
+};
+
+template<class Params>
+class RocprimDeviceSetOperationsTests : public ::testing::Test
+{
+public:
+    using key_type        = typename Params::key_type;
+    using value_type      = typename Params::value_type;
+    using compare_op_type = typename Params::compare_op_type;
+    static constexpr bool debug_synchronous = false;
+};
+
+typedef ::testing::Types<DeviceSetOperationsParams<int, int>,
+                         DeviceSetOperationsParams<unsigned long long, float>,
+                         DeviceSetOperationsParams<int, double, rocprim::greater<int>>,
+                         DeviceSetOperationsParams<uint8_t, short>>
+    RocprimDeviceSetOperationsTestsParams;
+
+TYPED_TEST_SUITE(RocprimDeviceSetOperationsTests, RocprimDeviceSetOperationsTestsParams);
+
+namespace
+{
+
+// size1, size2, max_key: few keys give long runs of equal keys spanning many tiles
+std::vector<std::tuple<size_t, size_t, size_t>> get_sizes()
+{
+    return {std::make_tuple(0, 0, 10),
+            std::make_tuple(0, 100, 10),
+            std::make_tuple(100, 0, 10),
+            std::make_tuple(2, 1, 2),
+            std::make_tuple(111, 111, 50),
+            std::make_tuple(1024, 512, 3),
+            std::make_tuple(17867, 41, 100000),
+            std::make_tuple(17867, 34567, 2000),
+            std::make_tuple(34567, (1 << 17) - 1220, 10),
+            std::make_tuple(924353, 1723454, 1000000)};
+}
+
+enum class set_operation_type
+{
+    intersection,
+    union_,
+    difference,
+    symmetric_difference
+};
+
+// Calls the rocPRIM and the standard library functions of the operation
+template<set_operation_type Operation>
+struct set_operation_caller;
+
+#define DEFINE_SET_OPERATION_CALLER(OPERATION, NAME)                                      \
+    template<>                                                                            \
+    struct set_operation_caller<set_operation_type::OPERATION>                            \
+    {                                                                                     \
+        template<class... Args>                                                           \
+        static hipError_t keys(Args&&... args)                                            \
+        {                                                                                 \
+            return rocprim::NAME(std::forward<Args>(args)...);                            \
+        }                                                                                 \
+        template<class... Args>                                                           \
+        static hipError_t pairs(Args&&... args)                                           \
+        {                                                                                 \
+            return rocprim::NAME##_by_key(std::forward<Args>(args)...);                   \
+        }                                                                                 \
+        template<class Iterator1, class Iterator2, class OutputIterator, class Compare>   \
+        static void host(Iterator1      first1,                                           \
+                         Iterator1      last1,                                            \
+                         Iterator2      first2,                                           \
+                         Iterator2      last2,                                            \
+                         OutputIterator output,                                           \
+                         Compare        compare)                                          \
+        {                                                                                 \
+            std::NAME(first1, last1, first2, last2, output, compare);                     \
+        }                                                                                 \
+    };
+
+DEFINE_SET_OPERATION_CALLER(intersection, set_intersection)
+DEFINE_SET_OPERATION_CALLER(union_, set_union)
+DEFINE_SET_OPERATION_CALLER(difference, set_difference)
+DEFINE_SET_OPERATION_CALLER(symmetric_difference, set_symmetric_difference)
+
+#undef DEFINE_SET_OPERATION_CALLER
+
+template<class T>
+T* copy_to_device(const std::vector<T>& input)
+{
+    T* d_input;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                 std::max<size_t>(1, input.size()) * sizeof(T)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), input.size() * sizeof(T), hipMemcpyHostToDevice));
+    return d_input;
+}
+
+template<class T>
+std::vector<T> copy_to_host(const T* d_output, const size_t count)
+{
+    std::vector<T> output(count);
+    HIP_CHECK(hipMemcpy(output.data(), d_output, count * sizeof(T), hipMemcpyDeviceToHost));
+    return output;
+}
+
+template<class KeyType, class CompareOp>
+std::vector<KeyType>
+    get_sorted_keys(const size_t size, const size_t max_key, const unsigned int seed)
+{
+    std::vector<KeyType> keys = test_utils::get_random_data<KeyType>(
+        size,
+        0,
+        static_cast<KeyType>(std::min<size_t>(max_key, test_utils::numeric_limits<KeyType>::max())),
+        seed);
+    std::sort(keys.begin(), keys.end(), CompareOp());
+    return keys;
+}
+
+template<set_operation_type Operation, class TestFixture>
+void test_set_operation(const bool with_values)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type               = typename TestFixture::key_type;
+    using value_type             = typename TestFixture::value_type;
+    using compare_op_type        = typename TestFixture::compare_op_type;
+    using caller                 = set_operation_caller<Operation>;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    hipStream_t stream = 0; // default
+
+    for(const auto sizes : get_sizes())
+    {
+        const size_t size1   = std::get<0>(sizes);
+        const size_t size2   = std::get<1>(sizes);
+        const size_t max_key = std::get<2>(sizes);
+        SCOPED_TRACE(testing::Message() << "with sizes = {" << size1 << ", " << size2
+                                        << "}, max_key = " << max_key);
+
+        for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+        {
+            unsigned int seed_value
+                = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+            SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+            const std::vector<key_type> keys_input1
+                = get_sorted_keys<key_type, compare_op_type>(size1, max_key, seed_value);
+            const std::vector<key_type> keys_input2
+                = get_sorted_keys<key_type, compare_op_type>(size2, max_key, seed_value + 1);
+            // The values identify the input and the position of every key
+            std::vector<value_type> values_input1(size1);
+            std::vector<value_type> values_input2(size2);
+            for(size_t i = 0; i < size1; i++)
+            {
+                values_input1[i] = static_cast<value_type>(i % 1000);
+            }
+            for(size_t i = 0; i < size2; i++)
+            {
+                values_input2[i] = static_cast<value_type>(-1 - static_cast<int>(i % 1000));
+            }
+
+            // Calculate expected results on host
+            using pair_type = std::pair<key_type, value_type>;
+            std::vector<pair_type> pairs_input1(size1);
+            std::vector<pair_type> pairs_input2(size2);
+            for(size_t i = 0; i < size1; i++)
+            {
+                pairs_input1[i] = pair_type(keys_input1[i], values_input1[i]);
+            }
+            for(size_t i = 0; i < size2; i++)
+            {
+                pairs_input2[i] = pair_type(keys_input2[i], values_input2[i]);
+            }
+            std::vector<pair_type> expected;
+            caller::host(pairs_input1.begin(),
+                         pairs_input1.end(),
+                         pairs_input2.begin(),
+                         pairs_input2.end(),
+                         std::back_inserter(expected),
+                         [](const pair_type& a, const pair_type& b)
+                         { return compare_op_type()(a.first, b.first); });
+
+            key_type* const   d_keys_input1   = copy_to_device(keys_input1);
+            key_type* const   d_keys_input2   = copy_to_device(keys_input2);
+            value_type* const d_values_input1 = copy_to_device(values_input1);
+            value_type* const d_values_input2 = copy_to_device(values_input2);
+            key_type*         d_keys_output;
+            value_type*       d_values_output;
+            unsigned int*     d_output_count;
+            const size_t      output_capacity = std::max<size_t>(1, size1 + size2);
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output,
+                                                         output_capacity * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output,
+                                                         output_capacity * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output_count, sizeof(unsigned int)));
+
+            auto run = [&](void* d_temp_storage, size_t& temp_storage_size_bytes)
+            {
+                if(with_values)
+                {
+                    return caller::pairs(d_temp_storage,
+                                         temp_storage_size_bytes,
+                                         d_keys_input1,
+                                         d_keys_input2,
+                                         d_values_input1,
+                                         d_values_input2,
+                                         d_keys_output,
+                                         d_values_output,
+                                         d_output_count,
+                                         size1,
+                                         size2,
+                                         compare_op_type(),
+                                         stream,
+                                         debug_synchronous);
+                }
+                return caller::keys(d_temp_storage,
+                                    temp_storage_size_bytes,
+                                    d_keys_input1,
+                                    d_keys_input2,
+                                    d_keys_output,
+                                    d_output_count,
+                                    size1,
+                                    size2,
+                                    compare_op_type(),
+                                    stream,
+                                    debug_synchronous);
+            };
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(run(nullptr, temp_storage_size_bytes));
+            ASSERT_GT(temp_storage_size_bytes, 0);
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(run(d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            const unsigned int output_count = copy_to_host(d_output_count, 1)[0];
+            ASSERT_EQ(output_count, expected.size());
+
+            std::vector<key_type>   expected_keys(expected.size());
+            std::vector<value_type> expected_values(expected.size());
+            for(size_t i = 0; i < expected.size(); i++)
+            {
+                expected_keys[i]   = expected[i].first;
+                expected_values[i] = expected[i].second;
+            }
+            ASSERT_NO_FATAL_FAILURE(
+                test_utils::assert_eq(copy_to_host(d_keys_output, output_count), expected_keys));
+            if(with_values)
+            {
+                ASSERT_NO_FATAL_FAILURE(
+                    test_utils::assert_eq(copy_to_host(d_values_output, output_count),
+                                          expected_values));
+            }
+
+            HIP_CHECK(hipFree(d_keys_input1));
+            HIP_CHECK(hipFree(d_keys_input2));
+            HIP_CHECK(hipFree(d_values_input1));
+            HIP_CHECK(hipFree(d_values_input2));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_values_output));
+            HIP_CHECK(hipFree(d_output_count));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
+
+} // namespace
+
+TYPED_TEST(RocprimDeviceSetOperationsTests, Intersection)
+{
+    test_set_operation<set_operation_type::intersection, TestFixture>(false);
+}
+
+TYPED_TEST(RocprimDeviceSetOperationsTests, IntersectionByKey)
+{
+    test_set_operation<set_operation_type::intersection, TestFixture>(true);
+}
+
+TYPED_TEST(RocprimDeviceSetOperationsTests, Union)
+{
+    test_set_operation<set_operation_type::union_, TestFixture>(false);
+}
+
+TYPED_TEST(RocprimDeviceSetOperationsTests, UnionByKey)
+{
+    test_set_operation<set_operation_type::union_, TestFixture>(true);
+}
+
+TYPED_TEST(RocprimDeviceSetOperationsTests, Difference)
+{
+    test_set_operation<set_operation_type::difference, TestFixture>(false);
+}
+
+TYPED_TEST(RocprimDeviceSetOperationsTests, DifferenceByKey)
+{
+    test_set_operation<set_operation_type::difference, TestFixture>(true);
+}
+
+TYPED_TEST(RocprimDeviceSetOperationsTests, SymmetricDifference)
+{
+    test_set_operation<set_operation_type::symmetric_difference, TestFixture>(false);
+}
+
+TYPED_TEST(RocprimDeviceSetOperationsTests, SymmetricDifferenceByKey)
+{
+    test_set_operation<set_operation_type::symmetric_difference, TestFixture>(true);
+}
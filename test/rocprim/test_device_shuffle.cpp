@@ -0,0 +1,169 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+// required rocprim headers
+#include <rocprim/device/device_shuffle.hpp>
+#include <rocprim/iterator/random_permutation_iterator.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+template<class Value, class Config = rocprim::default_config>
+struct params
+{
+    using value_type = Value;
+    using config     = Config;
+};
+
+template<class Params>
+class RocprimDeviceShuffle : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<params<int>,
+                         params<unsigned char>,
+                         params<double>,
+                         params<test_utils::custom_test_type<long long>>,
+                         params<long long, rocprim::transform_config<64, 2>>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimDeviceShuffle, Params);
+
+TEST(RocprimRandomPermutationIterator, Permutation)
+{
+    for(size_t size : {1, 2, 3, 4, 5, 17, 100, 1000, 4096, 10000})
+    {
+        SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+        for(unsigned long long seed : {0ull, 1ull, 123456789ull})
+        {
+            SCOPED_TRACE(testing::Message() << "with seed = " << seed);
+
+            const auto iterator
+                = rocprim::make_random_permutation_iterator<unsigned int>(size, seed);
+
+            std::vector<unsigned int> indices(iterator, iterator + size);
+            // The iterator is random-access, a position gives the same index as iterating to it
+            ASSERT_EQ(iterator[size - 1], indices[size - 1]);
+
+            std::sort(indices.begin(), indices.end());
+            for(size_t i = 0; i < size; i++)
+            {
+                ASSERT_EQ(indices[i], i);
+            }
+        }
+    }
+}
+
+TEST(RocprimRandomPermutationIterator, Seeds)
+{
+    const size_t size = 1000;
+
+    const auto first  = rocprim::make_random_permutation_iterator(size, 1);
+    const auto second = rocprim::make_random_permutation_iterator(size, 2);
+
+    // The same seed gives the same permutation, different seeds unrelated ones
+    const std::vector<size_t> first_indices(first, first + size);
+    const std::vector<size_t> again(rocprim::make_random_permutation_iterator(size, 1),
+                                    rocprim::make_random_permutation_iterator(size, 1) + size);
+    ASSERT_EQ(first_indices, again);
+
+    size_t same_positions  = 0;
+    size_t fixed_positions = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        same_positions += first[i] == second[i] ? 1 : 0;
+        fixed_positions += first[i] == i ? 1 : 0;
+    }
+    // About 1 of both is expected from random permutations
+    ASSERT_LT(same_positions, 20);
+    ASSERT_LT(fixed_positions, 20);
+}
+
+TYPED_TEST(RocprimDeviceShuffle, Shuffle)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T      = typename TestFixture::params::value_type;
+    using config = typename TestFixture::params::config;
+
+    const bool debug_synchronous = false;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<T> input(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                input[i] = T(i);
+            }
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, (size + 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, (size + 1) * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            HIP_CHECK(rocprim::shuffle<config>(d_input,
+                                               d_output,
+                                               size,
+                                               seed_value,
+                                               stream,
+                                               debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<T> output(size);
+            HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+
+            // The device gathers in the order of the host iterator
+            const auto expected = rocprim::make_shuffle_iterator(input.data(), size, seed_value);
+            for(size_t i = 0; i < size; i++)
+            {
+                ASSERT_EQ(output[i], expected[i]) << "where index = " << i;
+            }
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
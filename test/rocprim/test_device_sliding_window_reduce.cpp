@@ -0,0 +1,187 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_sliding_window_reduce.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <vector>
+
+template<class Value, class ReduceOp, class Config = rocprim::default_config>
+struct params
+{
+    using value_type = Value;
+    using reduce_op  = ReduceOp;
+    using config     = Config;
+};
+
+template<class Params>
+class RocprimDeviceSlidingWindowReduce : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+// Keeps the last item, so the windows are reduced in order
+struct last_op
+{
+    template<class T>
+    ROCPRIM_HOST_DEVICE
+    T operator()(const T& /*a*/, const T& b) const
+    {
+        return b;
+    }
+};
+
+using small_config = rocprim::scan_config<64,
+                                          2,
+                                          true,
+                                          rocprim::block_load_method::block_load_transpose,
+                                          rocprim::block_store_method::block_store_transpose,
+                                          rocprim::block_scan_algorithm::using_warp_scan>;
+
+typedef ::testing::Types<params<int, rocprim::plus<int>>,
+                         params<int, rocprim::minimum<int>>,
+                         params<unsigned char, rocprim::maximum<unsigned char>>,
+                         params<float, rocprim::maximum<float>>,
+                         params<double, rocprim::minimum<double>, small_config>,
+                         params<long long, last_op>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimDeviceSlidingWindowReduce, Params);
+
+TYPED_TEST(RocprimDeviceSlidingWindowReduce, SlidingWindowReduce)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T         = typename TestFixture::params::value_type;
+    using reduce_op = typename TestFixture::params::reduce_op;
+    using config    = typename TestFixture::params::config;
+
+    const bool  debug_synchronous = false;
+    hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, (size + 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, (size + 1) * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            for(size_t window : {size_t(1), size_t(3), size_t(60), size_t(1000), size, size + 1})
+            {
+                if(window == 0)
+                {
+                    continue;
+                }
+                SCOPED_TRACE(testing::Message() << "with window = " << window);
+
+                size_t temporary_storage_bytes;
+                HIP_CHECK(rocprim::sliding_window_reduce<config>(nullptr,
+                                                                 temporary_storage_bytes,
+                                                                 d_input,
+                                                                 d_output,
+                                                                 size,
+                                                                 window,
+                                                                 reduce_op(),
+                                                                 stream,
+                                                                 debug_synchronous));
+                void* d_temporary_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                             temporary_storage_bytes + 1));
+                HIP_CHECK(rocprim::sliding_window_reduce<config>(d_temporary_storage,
+                                                                 temporary_storage_bytes,
+                                                                 d_input,
+                                                                 d_output,
+                                                                 size,
+                                                                 window,
+                                                                 reduce_op(),
+                                                                 stream,
+                                                                 debug_synchronous));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+
+                const size_t   output_size = size < window ? 0 : size - window + 1;
+                std::vector<T> output(output_size);
+                HIP_CHECK(hipMemcpy(output.data(),
+                                    d_output,
+                                    output_size * sizeof(T),
+                                    hipMemcpyDeviceToHost));
+
+                // Every window is reduced from its first item
+                std::vector<T> expected(output_size);
+                for(size_t i = 0; i < output_size; i++)
+                {
+                    T value = input[i];
+                    for(size_t j = 1; j < window; j++)
+                    {
+                        value = reduce_op()(value, input[i + j]);
+                    }
+                    expected[i] = value;
+                }
+                test_utils::assert_eq(output, expected);
+
+                HIP_CHECK(hipFree(d_temporary_storage));
+            }
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+TEST(RocprimDeviceSlidingWindowReduceTests, EmptyWindow)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    size_t temporary_storage_bytes;
+    int*   d_input  = nullptr;
+    int*   d_output = nullptr;
+    ASSERT_EQ(rocprim::sliding_window_reduce(nullptr,
+                                             temporary_storage_bytes,
+                                             d_input,
+                                             d_output,
+                                             size_t(16),
+                                             size_t(0)),
+              hipErrorInvalidValue);
+}
@@ -0,0 +1,372 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_streaming.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+// Splits size items into chunks of random sizes, including empty chunks
+std::vector<size_t> get_chunk_sizes(const size_t size, const unsigned int seed_value)
+{
+    std::vector<size_t> chunk_sizes;
+    const std::vector<size_t> random_sizes
+        = test_utils::get_random_data<size_t>(64, 0, std::max(size / 8, size_t(1)), seed_value);
+    size_t offset = 0;
+    for(size_t i = 0; offset < size; i++)
+    {
+        const size_t chunk_size
+            = i % 5 == 4 ? 0
+                         : std::min(std::max(random_sizes[i % random_sizes.size()], size_t(1)),
+                                    size - offset);
+        chunk_sizes.push_back(chunk_size);
+        offset += chunk_size;
+    }
+    return chunk_sizes;
+}
+
+// Small integers, so the floating-point sums are exact
+template<class T>
+std::vector<T> get_small_integers(const size_t size, const unsigned int seed_value)
+{
+    const std::vector<int> integers = test_utils::get_random_data<int>(size, 0, 10, seed_value);
+    return std::vector<T>(integers.begin(), integers.end());
+}
+
+template<class T>
+class RocprimDeviceStreamingTests : public ::testing::Test
+{
+public:
+    using type = T;
+};
+
+typedef ::testing::Types<int, unsigned long long, float> Types;
+
+TYPED_TEST_SUITE(RocprimDeviceStreamingTests, Types);
+
+TYPED_TEST(RocprimDeviceStreamingTests, InclusiveScanStream)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::type;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = get_small_integers<T>(size, seed_value);
+            std::vector<T>       expected(size);
+            std::partial_sum(input.begin(), input.end(), expected.begin());
+
+            const std::vector<size_t> chunk_sizes = get_chunk_sizes(size, seed_value);
+            const size_t max_chunk_size
+                = std::accumulate(chunk_sizes.begin(),
+                                  chunk_sizes.end(),
+                                  size_t(1),
+                                  [](size_t a, size_t b) { return std::max(a, b); });
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, max_chunk_size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, max_chunk_size * sizeof(T)));
+
+            rocprim::inclusive_scan_stream<T> scan;
+            size_t                            temporary_storage_bytes;
+            HIP_CHECK(scan.scan(nullptr,
+                                temporary_storage_bytes,
+                                d_input,
+                                d_output,
+                                max_chunk_size,
+                                stream));
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            std::vector<T> output;
+            size_t         offset = 0;
+            for(const size_t chunk_size : chunk_sizes)
+            {
+                HIP_CHECK(hipMemcpy(d_input,
+                                    input.data() + offset,
+                                    chunk_size * sizeof(T),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(scan.scan(d_temporary_storage,
+                                    temporary_storage_bytes,
+                                    d_input,
+                                    d_output,
+                                    chunk_size,
+                                    stream));
+                HIP_CHECK(hipGetLastError());
+                output.resize(offset + chunk_size);
+                HIP_CHECK(hipMemcpy(output.data() + offset,
+                                    d_output,
+                                    chunk_size * sizeof(T),
+                                    hipMemcpyDeviceToHost));
+                offset += chunk_size;
+            }
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            if(size > 0)
+            {
+                T carry;
+                HIP_CHECK(hipMemcpy(&carry, scan.carry(), sizeof(T), hipMemcpyDeviceToHost));
+                ASSERT_EQ(carry, expected.back());
+            }
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceStreamingTests, ReduceStream)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::type;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = get_small_integers<T>(size, seed_value);
+            const T              initial_value = T(5);
+            const T expected = std::accumulate(input.begin(), input.end(), initial_value);
+
+            const std::vector<size_t> chunk_sizes = get_chunk_sizes(size, seed_value);
+            const size_t max_chunk_size
+                = std::accumulate(chunk_sizes.begin(),
+                                  chunk_sizes.end(),
+                                  size_t(1),
+                                  [](size_t a, size_t b) { return std::max(a, b); });
+
+            T* d_input;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max(size, size_t(1)) * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            rocprim::reduce_stream<T> sum(initial_value);
+            size_t                    temporary_storage_bytes;
+            HIP_CHECK(
+                sum.reduce(nullptr, temporary_storage_bytes, d_input, max_chunk_size, stream));
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            // The chunks are enqueued without synchronization
+            size_t offset = 0;
+            for(const size_t chunk_size : chunk_sizes)
+            {
+                HIP_CHECK(sum.reduce(d_temporary_storage,
+                                     temporary_storage_bytes,
+                                     d_input + offset,
+                                     chunk_size,
+                                     stream));
+                offset += chunk_size;
+            }
+            HIP_CHECK(sum.reduce(d_temporary_storage,
+                                 temporary_storage_bytes,
+                                 d_input,
+                                 0,
+                                 stream));
+            HIP_CHECK(hipGetLastError());
+
+            T result;
+            HIP_CHECK(hipMemcpy(&result, sum.result(), sizeof(T), hipMemcpyDeviceToHost));
+            ASSERT_EQ(result, expected);
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_input));
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceStreamingTests, ReduceByKeyStream)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type   = unsigned int;
+    using value_type = typename TestFixture::type;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Long runs which span multiple chunks
+            std::vector<key_type> keys(size);
+            const std::vector<size_t> run_lengths
+                = test_utils::get_random_data<size_t>(64, 1, 1000, seed_value);
+            for(size_t i = 0, run = 0, key = 0; i < size; run++, key++)
+            {
+                const size_t length = std::min(run_lengths[run % run_lengths.size()], size - i);
+                std::fill(keys.begin() + i, keys.begin() + i + length, key_type(key % 7));
+                i += length;
+            }
+            const std::vector<value_type> values
+                = get_small_integers<value_type>(size, seed_value);
+
+            std::vector<key_type>   expected_unique;
+            std::vector<value_type> expected_aggregates;
+            for(size_t i = 0; i < size; i++)
+            {
+                if(i == 0 || keys[i] != keys[i - 1])
+                {
+                    expected_unique.push_back(keys[i]);
+                    expected_aggregates.push_back(values[i]);
+                }
+                else
+                {
+                    expected_aggregates.back() += values[i];
+                }
+            }
+
+            const std::vector<size_t> chunk_sizes = get_chunk_sizes(size, seed_value);
+            const size_t max_chunk_size
+                = std::accumulate(chunk_sizes.begin(),
+                                  chunk_sizes.end(),
+                                  size_t(1),
+                                  [](size_t a, size_t b) { return std::max(a, b); });
+
+            key_type*   d_keys;
+            value_type* d_values;
+            key_type*   d_unique;
+            value_type* d_aggregates;
+            size_t*     d_count;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys,
+                                                         std::max(size, size_t(1))
+                                                             * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values,
+                                                         std::max(size, size_t(1))
+                                                             * sizeof(value_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_unique, max_chunk_size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_aggregates,
+                                                         max_chunk_size * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_count, sizeof(size_t)));
+            HIP_CHECK(
+                hipMemcpy(d_keys, keys.data(), size * sizeof(key_type), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values,
+                                values.data(),
+                                size * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+
+            rocprim::reduce_by_key_stream<key_type, value_type> rbk;
+            size_t temporary_storage_bytes;
+            HIP_CHECK(rbk.reduce(nullptr,
+                                 temporary_storage_bytes,
+                                 d_keys,
+                                 d_values,
+                                 max_chunk_size,
+                                 d_unique,
+                                 d_aggregates,
+                                 d_count,
+                                 stream));
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            std::vector<key_type>   unique;
+            std::vector<value_type> aggregates;
+            const auto              append_output = [&]()
+            {
+                size_t count;
+                HIP_CHECK(hipMemcpy(&count, d_count, sizeof(size_t), hipMemcpyDeviceToHost));
+                ASSERT_LE(count, max_chunk_size);
+                const size_t offset = unique.size();
+                unique.resize(offset + count);
+                aggregates.resize(offset + count);
+                HIP_CHECK(hipMemcpy(unique.data() + offset,
+                                    d_unique,
+                                    count * sizeof(key_type),
+                                    hipMemcpyDeviceToHost));
+                HIP_CHECK(hipMemcpy(aggregates.data() + offset,
+                                    d_aggregates,
+                                    count * sizeof(value_type),
+                                    hipMemcpyDeviceToHost));
+            };
+
+            size_t offset = 0;
+            for(const size_t chunk_size : chunk_sizes)
+            {
+                HIP_CHECK(rbk.reduce(d_temporary_storage,
+                                     temporary_storage_bytes,
+                                     d_keys + offset,
+                                     d_values + offset,
+                                     chunk_size,
+                                     d_unique,
+                                     d_aggregates,
+                                     d_count,
+                                     stream));
+                HIP_CHECK(hipGetLastError());
+                ASSERT_NO_FATAL_FAILURE(append_output());
+                offset += chunk_size;
+            }
+            HIP_CHECK(rbk.flush(d_unique, d_aggregates, d_count, stream));
+            HIP_CHECK(hipGetLastError());
+            ASSERT_NO_FATAL_FAILURE(append_output());
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(unique, expected_unique));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(aggregates, expected_aggregates));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_keys));
+            HIP_CHECK(hipFree(d_values));
+            HIP_CHECK(hipFree(d_unique));
+            HIP_CHECK(hipFree(d_aggregates));
+            HIP_CHECK(hipFree(d_count));
+        }
+    }
+}
@@ -0,0 +1,180 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_string_sort.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+struct string_sort_input
+{
+    std::vector<unsigned char> chars;
+    std::vector<unsigned int>  offsets;
+};
+
+// Strings over a small alphabet, all of them start with a common prefix
+inline string_sort_input get_string_sort_input(const size_t       size,
+                                               const size_t       prefix_length,
+                                               const size_t       max_length,
+                                               const unsigned int seed_value)
+{
+    std::default_random_engine                  gen(seed_value);
+    std::uniform_int_distribution<size_t>       length_dis(0, max_length);
+    std::uniform_int_distribution<unsigned int> char_dis(0, 3);
+
+    // Bytes above 127 check that the bytes are compared as unsigned
+    const unsigned char alphabet[] = {0, 'a', 'b', 200};
+
+    string_sort_input input;
+    input.offsets.push_back(0);
+    for(size_t i = 0; i < size; i++)
+    {
+        for(size_t j = 0; j < prefix_length; j++)
+        {
+            input.chars.push_back('p');
+        }
+        const size_t length = length_dis(gen);
+        for(size_t j = 0; j < length; j++)
+        {
+            input.chars.push_back(alphabet[char_dis(gen)]);
+        }
+        input.offsets.push_back(static_cast<unsigned int>(input.chars.size()));
+    }
+    return input;
+}
+
+TEST(RocprimDeviceStringSortTests, SortStrings)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    hipStream_t stream = 0;
+
+    const bool debug_synchronous = false;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            // The buffer of the strings is much larger than the number of strings
+            if(size > (1 << 20))
+            {
+                continue;
+            }
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            for(size_t prefix_length : {0, 30})
+            {
+                SCOPED_TRACE(testing::Message() << "with prefix_length = " << prefix_length);
+
+                const string_sort_input input
+                    = get_string_sort_input(size, prefix_length, 12, seed_value);
+
+                std::vector<unsigned int> expected(size);
+                test_utils::iota(expected.begin(), expected.end(), 0u);
+                std::stable_sort(expected.begin(),
+                                 expected.end(),
+                                 [&input](const unsigned int a, const unsigned int b)
+                                 {
+                                     return std::lexicographical_compare(
+                                         input.chars.begin() + input.offsets[a],
+                                         input.chars.begin() + input.offsets[a + 1],
+                                         input.chars.begin() + input.offsets[b],
+                                         input.chars.begin() + input.offsets[b + 1]);
+                                 });
+
+                unsigned char* d_chars;
+                unsigned int*  d_offsets;
+                unsigned int*  d_permutation;
+                HIP_CHECK(test_common_utils::hipMallocHelper(
+                    &d_chars,
+                    std::max<size_t>(input.chars.size(), 1) * sizeof(unsigned char)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_offsets,
+                                                             (size + 1) * sizeof(unsigned int)));
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_permutation, size * sizeof(unsigned int)));
+                HIP_CHECK(hipMemcpy(d_chars,
+                                    input.chars.data(),
+                                    input.chars.size() * sizeof(unsigned char),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_offsets,
+                                    input.offsets.data(),
+                                    (size + 1) * sizeof(unsigned int),
+                                    hipMemcpyHostToDevice));
+
+                // One pass leaves long tied groups to the comparison sort
+                for(unsigned int radix_passes : {1u, 4u, 8u})
+                {
+                    SCOPED_TRACE(testing::Message() << "with radix_passes = " << radix_passes);
+
+                    size_t temporary_storage_bytes;
+                    HIP_CHECK(rocprim::string_sort(nullptr,
+                                                   temporary_storage_bytes,
+                                                   d_chars,
+                                                   d_offsets,
+                                                   d_permutation,
+                                                   size,
+                                                   radix_passes));
+
+                    // temp_storage_size_bytes must be >0
+                    ASSERT_GT(temporary_storage_bytes, 0);
+
+                    void* d_temporary_storage;
+                    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                                 temporary_storage_bytes));
+
+                    HIP_CHECK(rocprim::string_sort(d_temporary_storage,
+                                                   temporary_storage_bytes,
+                                                   d_chars,
+                                                   d_offsets,
+                                                   d_permutation,
+                                                   size,
+                                                   radix_passes,
+                                                   stream,
+                                                   debug_synchronous));
+
+                    std::vector<unsigned int> permutation(size);
+                    HIP_CHECK(hipMemcpy(permutation.data(),
+                                        d_permutation,
+                                        size * sizeof(unsigned int),
+                                        hipMemcpyDeviceToHost));
+
+                    HIP_CHECK(hipFree(d_temporary_storage));
+
+                    ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(permutation, expected));
+                }
+
+                HIP_CHECK(hipFree(d_chars));
+                HIP_CHECK(hipFree(d_offsets));
+                HIP_CHECK(hipFree(d_permutation));
+            }
+        }
+    }
+}
@@ -0,0 +1,197 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_tile_pipeline.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+struct tile_pipeline_positive_op
+{
+    __device__ __host__ inline
+    bool operator()(const int& value) const
+    {
+        return value > 0;
+    }
+};
+
+struct tile_pipeline_square_op
+{
+    __device__ __host__ inline
+    long long operator()(const int& value) const
+    {
+        return static_cast<long long>(value) * value;
+    }
+};
+
+struct tile_pipeline_not_multiple_of_3_op
+{
+    __device__ __host__ inline
+    bool operator()(const long long& value) const
+    {
+        return value % 3 != 0;
+    }
+};
+
+// Positive values are squared, the squares which are not multiples of 3 are kept and optionally
+// scanned
+template<class Config, bool WithScan>
+void test_tile_pipeline()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = int;
+    using U = long long;
+
+    hipStream_t stream = 0; // default stream
+
+    const auto select_and_transform = rocprim::make_tile_pipeline(
+        rocprim::tile_select(tile_pipeline_positive_op()),
+        rocprim::tile_transform(tile_pipeline_square_op()),
+        rocprim::tile_select(tile_pipeline_not_multiple_of_3_op()));
+    const auto with_scan = rocprim::make_tile_pipeline(
+        rocprim::tile_select(tile_pipeline_positive_op()),
+        rocprim::tile_transform(tile_pipeline_square_op()),
+        rocprim::tile_select(tile_pipeline_not_multiple_of_3_op()),
+        rocprim::tile_inclusive_scan(rocprim::plus<U>()));
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data
+            std::vector<T> input = test_utils::get_random_data<T>(size, -100, 100, seed_value);
+
+            // Calculate expected results on host
+            std::vector<U> expected;
+            for(size_t i = 0; i < input.size(); i++)
+            {
+                if(!tile_pipeline_positive_op()(input[i]))
+                {
+                    continue;
+                }
+                const U value = tile_pipeline_square_op()(input[i]);
+                if(tile_pipeline_not_multiple_of_3_op()(value))
+                {
+                    expected.push_back(WithScan && !expected.empty() ? expected.back() + value
+                                                                     : value);
+                }
+            }
+
+            T*      d_input;
+            U*      d_output;
+            size_t* d_selected_count_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input.size() * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, input.size() * sizeof(U)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_selected_count_output, sizeof(size_t)));
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                input.size() * sizeof(T),
+                                hipMemcpyHostToDevice));
+
+            auto dispatch = [&](void* d_temp_storage, size_t& temp_storage_size_bytes)
+            {
+                return WithScan ? rocprim::run_tile_pipeline<Config>(d_temp_storage,
+                                                                     temp_storage_size_bytes,
+                                                                     d_input,
+                                                                     d_output,
+                                                                     d_selected_count_output,
+                                                                     input.size(),
+                                                                     with_scan,
+                                                                     stream)
+                                : rocprim::run_tile_pipeline<Config>(d_temp_storage,
+                                                                     temp_storage_size_bytes,
+                                                                     d_input,
+                                                                     d_output,
+                                                                     d_selected_count_output,
+                                                                     input.size(),
+                                                                     select_and_transform,
+                                                                     stream);
+            };
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(dispatch(nullptr, temp_storage_size_bytes));
+            ASSERT_GT(temp_storage_size_bytes, 0);
+            void* d_temp_storage = nullptr;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            HIP_CHECK(dispatch(d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            size_t selected_count_output = 0;
+            HIP_CHECK(hipMemcpy(&selected_count_output,
+                                d_selected_count_output,
+                                sizeof(size_t),
+                                hipMemcpyDeviceToHost));
+            ASSERT_EQ(selected_count_output, expected.size());
+
+            std::vector<U> output(expected.size());
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                output.size() * sizeof(U),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_selected_count_output));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
+
+// A small size limit splits the input into several launches
+using tile_pipeline_multiple_launches_config
+    = rocprim::select_config<128,
+                             4,
+                             rocprim::block_load_method::block_load_transpose,
+                             rocprim::block_load_method::block_load_transpose,
+                             rocprim::block_load_method::block_load_transpose,
+                             rocprim::block_scan_algorithm::using_warp_scan,
+                             3000>;
+
+TEST(RocprimDeviceTilePipelineTests, SelectTransformSelect)
+{
+    test_tile_pipeline<rocprim::default_config, false>();
+}
+
+TEST(RocprimDeviceTilePipelineTests, SelectTransformSelectScan)
+{
+    test_tile_pipeline<rocprim::default_config, true>();
+}
+
+TEST(RocprimDeviceTilePipelineTests, SelectTransformSelectScanMultipleLaunches)
+{
+    test_tile_pipeline<tile_pipeline_multiple_launches_config, true>();
+}
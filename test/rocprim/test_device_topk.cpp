@@ -0,0 +1,343 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_topk.hpp>
+
+// required test headers
+#include "test_utils_sort_comparator.hpp"
+#include "test_utils_types.hpp"
+
+template<class Key, class Value, bool Descending = false>
+struct params
+{
+    using key_type                   = Key;
+    using value_type                 = Value;
+    static constexpr bool descending = Descending;
+};
+
+template<class Params>
+class RocprimDeviceTopk : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<params<int, int>,
+                         params<int, int, true>,
+                         params<unsigned char, int>,
+                         params<short, unsigned int, true>,
+                         params<long long, int>,
+                         params<float, int>,
+                         params<double, long long, true>,
+                         params<rocprim::half, int>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimDeviceTopk, Params);
+
+inline std::vector<size_t> get_k_values(const size_t size)
+{
+    return {0, 1, 3, 100, 1000, size / 2, size, size + 10};
+}
+
+TYPED_TEST(RocprimDeviceTopk, TopkKeys)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type            = typename TestFixture::params::key_type;
+    constexpr bool descending = TestFixture::params::descending;
+
+    hipStream_t stream = 0;
+
+    const bool debug_synchronous = false;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data
+            std::vector<key_type> keys_input;
+            if(rocprim::is_floating_point<key_type>::value)
+            {
+                keys_input = test_utils::get_random_data<key_type>(size,
+                                                                   static_cast<key_type>(-1000),
+                                                                   static_cast<key_type>(+1000),
+                                                                   seed_value);
+                test_utils::add_special_values(keys_input, seed_value);
+            }
+            else
+            {
+                keys_input
+                    = test_utils::get_random_data<key_type>(size,
+                                                            std::numeric_limits<key_type>::min(),
+                                                            std::numeric_limits<key_type>::max(),
+                                                            seed_value);
+            }
+
+            key_type* d_keys_input;
+            key_type* d_keys_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(key_type)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+
+            // The k first keys of the sorted input are expected
+            std::vector<key_type> expected(keys_input);
+            std::stable_sort(
+                expected.begin(),
+                expected.end(),
+                test_utils::key_comparator<key_type, descending, 0, sizeof(key_type) * 8>());
+
+            for(size_t k : get_k_values(size))
+            {
+                SCOPED_TRACE(testing::Message() << "with k = " << k);
+
+                size_t temporary_storage_bytes;
+                HIP_CHECK(rocprim::topk_keys(nullptr,
+                                             temporary_storage_bytes,
+                                             d_keys_input,
+                                             d_keys_output,
+                                             size,
+                                             k));
+
+                ASSERT_GT(temporary_storage_bytes, 0);
+
+                void* d_temporary_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                             temporary_storage_bytes));
+
+                if(descending)
+                {
+                    HIP_CHECK(rocprim::topk_keys_desc(d_temporary_storage,
+                                                      temporary_storage_bytes,
+                                                      d_keys_input,
+                                                      d_keys_output,
+                                                      size,
+                                                      k,
+                                                      stream,
+                                                      debug_synchronous));
+                }
+                else
+                {
+                    HIP_CHECK(rocprim::topk_keys(d_temporary_storage,
+                                                 temporary_storage_bytes,
+                                                 d_keys_input,
+                                                 d_keys_output,
+                                                 size,
+                                                 k,
+                                                 stream,
+                                                 debug_synchronous));
+                }
+
+                const size_t selected = std::min(k, size);
+
+                std::vector<key_type> keys_output(selected);
+                HIP_CHECK(hipMemcpy(keys_output.data(),
+                                    d_keys_output,
+                                    selected * sizeof(key_type),
+                                    hipMemcpyDeviceToHost));
+
+                HIP_CHECK(hipFree(d_temporary_storage));
+
+                const std::vector<key_type> keys_expected(expected.begin(),
+                                                          expected.begin() + selected);
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_bit_eq(keys_output, keys_expected));
+            }
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceTopk, TopkPairs)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type            = typename TestFixture::params::key_type;
+    using value_type          = typename TestFixture::params::value_type;
+    constexpr bool descending = TestFixture::params::descending;
+
+    hipStream_t stream = 0;
+
+    const bool debug_synchronous = false;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data
+            std::vector<key_type> keys_input;
+            if(rocprim::is_floating_point<key_type>::value)
+            {
+                keys_input = test_utils::get_random_data<key_type>(size,
+                                                                   static_cast<key_type>(-1000),
+                                                                   static_cast<key_type>(+1000),
+                                                                   seed_value);
+                test_utils::add_special_values(keys_input, seed_value);
+            }
+            else
+            {
+                keys_input
+                    = test_utils::get_random_data<key_type>(size,
+                                                            std::numeric_limits<key_type>::min(),
+                                                            std::numeric_limits<key_type>::max(),
+                                                            seed_value);
+            }
+
+            std::vector<value_type> values_input(size);
+            test_utils::iota(values_input.begin(), values_input.end(), 0);
+
+            key_type*   d_keys_input;
+            key_type*   d_keys_output;
+            value_type* d_values_input;
+            value_type* d_values_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(key_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_values_input, size * sizeof(value_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_values_output, size * sizeof(value_type)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values_input,
+                                values_input.data(),
+                                size * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+
+            using key_value = std::pair<key_type, value_type>;
+
+            // Keys equal to the k-th key are selected in the order of the input, so the k first
+            // pairs of the stable sorted input are expected
+            std::vector<key_value> expected(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                expected[i] = key_value(keys_input[i], values_input[i]);
+            }
+            constexpr unsigned int end_bit = sizeof(key_type) * 8;
+            std::stable_sort(
+                expected.begin(),
+                expected.end(),
+                test_utils::key_value_comparator<key_type, value_type, descending, 0, end_bit>());
+
+            for(size_t k : get_k_values(size))
+            {
+                SCOPED_TRACE(testing::Message() << "with k = " << k);
+
+                size_t temporary_storage_bytes;
+                HIP_CHECK(rocprim::topk_pairs(nullptr,
+                                              temporary_storage_bytes,
+                                              d_keys_input,
+                                              d_keys_output,
+                                              d_values_input,
+                                              d_values_output,
+                                              size,
+                                              k));
+
+                ASSERT_GT(temporary_storage_bytes, 0);
+
+                void* d_temporary_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                             temporary_storage_bytes));
+
+                if(descending)
+                {
+                    HIP_CHECK(rocprim::topk_pairs_desc(d_temporary_storage,
+                                                       temporary_storage_bytes,
+                                                       d_keys_input,
+                                                       d_keys_output,
+                                                       d_values_input,
+                                                       d_values_output,
+                                                       size,
+                                                       k,
+                                                       stream,
+                                                       debug_synchronous));
+                }
+                else
+                {
+                    HIP_CHECK(rocprim::topk_pairs(d_temporary_storage,
+                                                  temporary_storage_bytes,
+                                                  d_keys_input,
+                                                  d_keys_output,
+                                                  d_values_input,
+                                                  d_values_output,
+                                                  size,
+                                                  k,
+                                                  stream,
+                                                  debug_synchronous));
+                }
+
+                const size_t selected = std::min(k, size);
+
+                std::vector<key_type>   keys_output(selected);
+                std::vector<value_type> values_output(selected);
+                HIP_CHECK(hipMemcpy(keys_output.data(),
+                                    d_keys_output,
+                                    selected * sizeof(key_type),
+                                    hipMemcpyDeviceToHost));
+                HIP_CHECK(hipMemcpy(values_output.data(),
+                                    d_values_output,
+                                    selected * sizeof(value_type),
+                                    hipMemcpyDeviceToHost));
+
+                HIP_CHECK(hipFree(d_temporary_storage));
+
+                std::vector<key_type>   keys_expected(selected);
+                std::vector<value_type> values_expected(selected);
+                for(size_t i = 0; i < selected; i++)
+                {
+                    keys_expected[i]   = expected[i].first;
+                    values_expected[i] = expected[i].second;
+                }
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_bit_eq(keys_output, keys_expected));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, values_expected));
+            }
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_values_output));
+        }
+    }
+}
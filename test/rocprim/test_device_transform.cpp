@@ -183,6 +183,239 @@ TYPED_TEST(RocprimDeviceTransformTests, Transform)
 
 }
 
+TYPED_TEST(RocprimDeviceTransformTests, TransformCacheModifiers)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::input_type;
+    using U = typename TestFixture::output_type;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+    using Config = rocprim::transform_config<256,
+                                             16,
+                                             TestFixture::size_limit,
+                                             rocprim::load_cs,
+                                             rocprim::store_cs>;
+
+    const unsigned int seed_value = seeds[0];
+    hipStream_t stream = 0; // default
+
+    for(auto size : test_utils::get_sizes(seed_value))
+    {
+        SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+        // Generate data
+        std::vector<T> input = test_utils::get_random_data<T>(size, 1, 100, seed_value);
+        std::vector<U> output(size, (U)0);
+
+        T * d_input;
+        U * d_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(U)));
+        HIP_CHECK(
+            hipMemcpy(
+                d_input, input.data(),
+                size * sizeof(T),
+                hipMemcpyHostToDevice
+            )
+        );
+
+        // Calculate expected results on host
+        std::vector<U> expected(size);
+        std::transform(input.begin(), input.end(), expected.begin(), transform<U>());
+
+        // Run
+        HIP_CHECK(
+            rocprim::transform<Config>(
+                d_input, d_output,
+                size, transform<U>(), stream, debug_synchronous
+            )
+        );
+        HIP_CHECK(hipGetLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        // Copy output to host
+        HIP_CHECK(
+            hipMemcpy(
+                output.data(), d_output,
+                size * sizeof(U),
+                hipMemcpyDeviceToHost
+            )
+        );
+
+        // Check if output values are as expected
+        ASSERT_NO_FATAL_FAILURE(
+            test_utils::assert_near(output, expected, test_utils::precision<U>));
+
+        hipFree(d_input);
+        hipFree(d_output);
+    }
+}
+
+TYPED_TEST(RocprimDeviceTransformTests, TransformUnaligned)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::input_type;
+    using U = typename TestFixture::output_type;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+    using Config = size_limit_config_t<TestFixture::size_limit>;
+
+    const unsigned int seed_value = seeds[0];
+    const size_t size = 100000;
+
+    hipStream_t stream = 0; // default
+
+    // Vector accesses are used if the pointers can be aligned together
+    const std::vector<std::pair<size_t, size_t>> offsets = {{0, 0}, {1, 1}, {3, 3}, {1, 2}};
+    for(const auto& offset : offsets)
+    {
+        SCOPED_TRACE(testing::Message() << "with input offset = " << offset.first);
+        SCOPED_TRACE(testing::Message() << "with output offset = " << offset.second);
+
+        // Generate data
+        std::vector<T> input = test_utils::get_random_data<T>(size, 1, 100, seed_value);
+        std::vector<U> output(size, (U)0);
+
+        T * d_input;
+        U * d_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, (size + offset.first) * sizeof(T)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, (size + offset.second) * sizeof(U)));
+        HIP_CHECK(
+            hipMemcpy(
+                d_input + offset.first, input.data(),
+                size * sizeof(T),
+                hipMemcpyHostToDevice
+            )
+        );
+
+        // Calculate expected results on host
+        std::vector<U> expected(size);
+        std::transform(input.begin(), input.end(), expected.begin(), transform<U>());
+
+        // Run
+        HIP_CHECK(
+            rocprim::transform<Config>(
+                d_input + offset.first, d_output + offset.second,
+                size, transform<U>(), stream, debug_synchronous
+            )
+        );
+        HIP_CHECK(hipGetLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        // Copy output to host
+        HIP_CHECK(
+            hipMemcpy(
+                output.data(), d_output + offset.second,
+                size * sizeof(U),
+                hipMemcpyDeviceToHost
+            )
+        );
+
+        // Check if output values are as expected
+        ASSERT_NO_FATAL_FAILURE(
+            test_utils::assert_near(output, expected, test_utils::precision<U>));
+
+        hipFree(d_input);
+        hipFree(d_output);
+    }
+}
+
+TYPED_TEST(RocprimDeviceTransformTests, TransformFutureSize)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::input_type;
+    using U = typename TestFixture::output_type;
+    static constexpr bool use_identity_iterator = TestFixture::use_identity_iterator;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+    using Config = size_limit_config_t<TestFixture::size_limit>;
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto max_size : test_utils::get_sizes(seed_value))
+        {
+            hipStream_t stream = 0; // default
+
+            // Only a part of the input is transformed, the size is read on the device
+            const unsigned int size = static_cast<unsigned int>(max_size - max_size / 3);
+
+            SCOPED_TRACE(testing::Message() << "with max_size = " << max_size);
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data
+            std::vector<T> input = test_utils::get_random_data<T>(max_size, 1, 100, seed_value);
+            std::vector<U> output(input.size(), (U)0);
+
+            T * d_input;
+            U * d_output;
+            unsigned int * d_size;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input.size() * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, output.size() * sizeof(U)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_size, sizeof(unsigned int)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_input, input.data(),
+                    input.size() * sizeof(T),
+                    hipMemcpyHostToDevice
+                )
+            );
+            HIP_CHECK(
+                hipMemcpy(
+                    d_output, output.data(),
+                    output.size() * sizeof(U),
+                    hipMemcpyHostToDevice
+                )
+            );
+            HIP_CHECK(hipMemcpy(d_size, &size, sizeof(unsigned int), hipMemcpyHostToDevice));
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Calculate expected results on host, elements past the size are not written
+            std::vector<U> expected(input.size(), (U)0);
+            std::transform(input.begin(), input.begin() + size, expected.begin(), transform<U>());
+
+            // Run
+            HIP_CHECK(
+                rocprim::transform<Config>(
+                    d_input,
+                    test_utils::wrap_in_identity_iterator<use_identity_iterator>(d_output),
+                    rocprim::future_value<unsigned int>(d_size), input.size(),
+                    transform<U>(), stream, debug_synchronous
+                )
+            );
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Copy output to host
+            HIP_CHECK(
+                hipMemcpy(
+                    output.data(), d_output,
+                    output.size() * sizeof(U),
+                    hipMemcpyDeviceToHost
+                )
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Check if output values are as expected
+            ASSERT_NO_FATAL_FAILURE(
+                test_utils::assert_near(output, expected, test_utils::precision<U>));
+
+            hipFree(d_input);
+            hipFree(d_output);
+            hipFree(d_size);
+        }
+    }
+
+}
+
 template<class T1, class T2, class U>
 struct binary_transform
 {
@@ -284,6 +517,108 @@ TYPED_TEST(RocprimDeviceTransformTests, BinaryTransform)
 
 }
 
+template<class T, class U>
+struct nary_transform
+{
+    __device__ __host__ inline
+    rocprim::tuple<U, U> operator()(const T& a, const T& b, const T& c) const
+    {
+        const U sum  = a + b + c;
+        const U sum2 = a + b;
+        return rocprim::tuple<U, U>(sum, sum2);
+    }
+};
+
+TYPED_TEST(RocprimDeviceTransformTests, NaryTransform)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::input_type;
+    using U = typename TestFixture::output_type;
+    static constexpr bool use_identity_iterator = TestFixture::use_identity_iterator;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+    using Config = size_limit_config_t<TestFixture::size_limit>;
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            hipStream_t stream = 0; // default
+
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data
+            std::vector<T> input1 = test_utils::get_random_data<T>(size, 1, 30, seed_value);
+            std::vector<T> input2 = test_utils::get_random_data<T>(size, 1, 30, seed_value + 1);
+            std::vector<T> input3 = test_utils::get_random_data<T>(size, 1, 30, seed_value + 2);
+            std::vector<U> output1(size, (U)0);
+            std::vector<U> output2(size, (U)0);
+
+            T * d_input1;
+            T * d_input2;
+            T * d_input3;
+            U * d_output1;
+            U * d_output2;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input1, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input2, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input3, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output1, size * sizeof(U)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output2, size * sizeof(U)));
+            HIP_CHECK(hipMemcpy(d_input1, input1.data(), size * sizeof(T), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_input2, input2.data(), size * sizeof(T), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_input3, input3.data(), size * sizeof(T), hipMemcpyHostToDevice));
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Calculate expected results on host
+            std::vector<U> expected1(size);
+            std::vector<U> expected2(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                const rocprim::tuple<U, U> result
+                    = nary_transform<T, U>()(input1[i], input2[i], input3[i]);
+                expected1[i] = rocprim::get<0>(result);
+                expected2[i] = rocprim::get<1>(result);
+            }
+
+            // Run
+            HIP_CHECK(
+                rocprim::transform<Config>(
+                    rocprim::make_tuple(d_input1, d_input2, d_input3),
+                    rocprim::make_tuple(
+                        test_utils::wrap_in_identity_iterator<use_identity_iterator>(d_output1),
+                        d_output2
+                    ),
+                    size, nary_transform<T, U>(), stream, debug_synchronous
+                )
+            );
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Copy output to host
+            HIP_CHECK(hipMemcpy(output1.data(), d_output1, size * sizeof(U), hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(output2.data(), d_output2, size * sizeof(U), hipMemcpyDeviceToHost));
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Check if output values are as expected
+            ASSERT_NO_FATAL_FAILURE(
+                test_utils::assert_near(output1, expected1, test_utils::precision<U>));
+            ASSERT_NO_FATAL_FAILURE(
+                test_utils::assert_near(output2, expected2, test_utils::precision<U>));
+
+            hipFree(d_input1);
+            hipFree(d_input2);
+            hipFree(d_input3);
+            hipFree(d_output1);
+            hipFree(d_output2);
+        }
+    }
+}
+
 TEST(RocprimDeviceTransformTests, LargeIndices)
 {
     const int device_id = test_common_utils::obtain_device_from_ctest();
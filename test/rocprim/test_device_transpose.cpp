@@ -0,0 +1,166 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_transpose.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <vector>
+
+template<class Value, unsigned int Fields, class Config = rocprim::default_config>
+struct params
+{
+    using value_type = Value;
+    using config     = Config;
+
+    static constexpr unsigned int fields = Fields;
+};
+
+template<class Params>
+class RocprimDeviceTranspose : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+// One record per thread, so the fields are not exchanged
+using one_record_config = rocprim::transform_config<64, 4>;
+
+// The records are transposed by several launches of 16 blocks
+using size_limit_config = rocprim::transform_config<64, 16, 64 * 4 * 16>;
+
+typedef ::testing::Types<params<int, 4>,
+                         params<float, 3>,
+                         params<double, 16>,
+                         params<unsigned char, 5>,
+                         params<short, 2>,
+                         params<int, 4, one_record_config>,
+                         params<int, 4, size_limit_config>,
+                         params<long long, 1>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimDeviceTranspose, Params);
+
+TYPED_TEST(RocprimDeviceTranspose, AosToSoaAndBack)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                       = typename TestFixture::params::value_type;
+    using config                  = typename TestFixture::params::config;
+    constexpr unsigned int fields = TestFixture::params::fields;
+
+    const bool  debug_synchronous = false;
+    hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input
+                = test_utils::get_random_data<T>(size * fields, 0, 100, seed_value);
+
+            // The fields of the records are the rows of the transposed matrix
+            std::vector<T> expected(size * fields);
+            for(size_t record = 0; record < size; record++)
+            {
+                for(unsigned int field = 0; field < fields; field++)
+                {
+                    expected[field * size + record] = input[record * fields + field];
+                }
+            }
+
+            T* d_input;
+            T* d_soa;
+            T* d_aos;
+            const size_t bytes = (size * fields + 1) * sizeof(T);
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, bytes));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_soa, bytes));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_aos, bytes));
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                size * fields * sizeof(T),
+                                hipMemcpyHostToDevice));
+
+            T* d_fields[fields];
+            for(unsigned int field = 0; field < fields; field++)
+            {
+                d_fields[field] = d_soa + field * size;
+            }
+
+            std::vector<T> output(size * fields);
+
+            HIP_CHECK((rocprim::aos_to_soa<fields, config>(d_input,
+                                                           d_fields,
+                                                           size,
+                                                           stream,
+                                                           debug_synchronous)));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_soa,
+                                size * fields * sizeof(T),
+                                hipMemcpyDeviceToHost));
+            test_utils::assert_eq(output, expected);
+
+            HIP_CHECK((rocprim::soa_to_aos<fields, config>(d_fields,
+                                                           d_aos,
+                                                           size,
+                                                           stream,
+                                                           debug_synchronous)));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_aos,
+                                size * fields * sizeof(T),
+                                hipMemcpyDeviceToHost));
+            test_utils::assert_eq(output, input);
+
+            HIP_CHECK(hipMemset(d_soa, 0, size * fields * sizeof(T)));
+            HIP_CHECK((rocprim::transpose<fields, config>(d_input,
+                                                          d_soa,
+                                                          size,
+                                                          stream,
+                                                          debug_synchronous)));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_soa,
+                                size * fields * sizeof(T),
+                                hipMemcpyDeviceToHost));
+            test_utils::assert_eq(output, expected);
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_soa));
+            HIP_CHECK(hipFree(d_aos));
+        }
+    }
+}
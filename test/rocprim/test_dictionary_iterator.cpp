@@ -0,0 +1,326 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+// required rocprim headers
+#include <rocprim/block/block_decode.hpp>
+#include <rocprim/block/block_load_func.hpp>
+#include <rocprim/device/device_histogram.hpp>
+#include <rocprim/device/device_reduce.hpp>
+#include <rocprim/device/device_select.hpp>
+#include <rocprim/functional.hpp>
+#include <rocprim/iterator/dictionary_iterator.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+TEST(RocprimDictionaryIteratorTests, Host)
+{
+    const std::vector<int>            dictionary = {-7, 12, 30, 5};
+    const std::vector<unsigned short> codes      = {2, 0, 0, 3, 1, 2, 3};
+
+    auto iterator = rocprim::make_dictionary_iterator(dictionary.data(),
+                                                      static_cast<unsigned int>(dictionary.size()),
+                                                      codes.data());
+    for(size_t i = 0; i < codes.size(); i++)
+    {
+        ASSERT_EQ(iterator[i], dictionary[codes[i]]) << "where index = " << i;
+    }
+    ASSERT_EQ(*(iterator + 3), 5);
+    ASSERT_EQ((iterator + 7) - iterator, 7);
+    ASSERT_EQ(iterator.dictionary_size(), 4u);
+    ASSERT_EQ(std::accumulate(iterator, iterator + 7, 0), 68);
+}
+
+template<unsigned int BlockSize, unsigned int ItemsPerThread, unsigned int MaxDictionarySize>
+__global__ __launch_bounds__(BlockSize) void dictionary_stage_kernel(
+    const int* dictionary, unsigned int dictionary_size, const unsigned short* codes, int* output)
+{
+    using dictionary_type = rocprim::block_dictionary<int, BlockSize, MaxDictionarySize>;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    const unsigned int     offset          = blockIdx.x * items_per_block;
+
+    const auto input  = rocprim::make_dictionary_iterator(dictionary, dictionary_size, codes);
+    const auto staged = dictionary_type().stage(input + offset);
+
+    int items[ItemsPerThread];
+    rocprim::block_load_direct_blocked(threadIdx.x, staged, items);
+
+    for(unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        output[offset + threadIdx.x * ItemsPerThread + item] = items[item];
+    }
+}
+
+TEST(RocprimDictionaryIteratorTests, BlockDictionary)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    constexpr unsigned int block_size        = 256;
+    constexpr unsigned int items_per_thread  = 4;
+    constexpr unsigned int max_dictionary    = 512;
+    constexpr unsigned int blocks            = 17;
+    constexpr size_t       size              = block_size * items_per_thread * blocks;
+
+    // The first dictionary is copied to shared memory, the second one is too large
+    for(unsigned int dictionary_size : {300u, 2000u})
+    {
+        SCOPED_TRACE(testing::Message() << "with dictionary_size = " << dictionary_size);
+
+        const std::vector<int> dictionary
+            = test_utils::get_random_data<int>(dictionary_size, -10000, 10000, seeds[0]);
+        const std::vector<unsigned short> codes = test_utils::get_random_data<unsigned short>(
+            size, 0, static_cast<unsigned short>(dictionary_size - 1), seeds[0]);
+
+        int*            d_dictionary;
+        unsigned short* d_codes;
+        int*            d_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_dictionary, dictionary_size * sizeof(int)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_codes, size * sizeof(unsigned short)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(int)));
+        HIP_CHECK(hipMemcpy(d_dictionary,
+                            dictionary.data(),
+                            dictionary_size * sizeof(int),
+                            hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_codes,
+                            codes.data(),
+                            size * sizeof(unsigned short),
+                            hipMemcpyHostToDevice));
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(dictionary_stage_kernel<block_size, items_per_thread, max_dictionary>),
+            dim3(blocks),
+            dim3(block_size),
+            0,
+            0,
+            d_dictionary,
+            dictionary_size,
+            d_codes,
+            d_output);
+        HIP_CHECK(hipGetLastError());
+
+        std::vector<int> output(size);
+        HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(int), hipMemcpyDeviceToHost));
+        for(size_t i = 0; i < size; i++)
+        {
+            ASSERT_EQ(output[i], dictionary[codes[i]]) << "where index = " << i;
+        }
+
+        HIP_CHECK(hipFree(d_dictionary));
+        HIP_CHECK(hipFree(d_codes));
+        HIP_CHECK(hipFree(d_output));
+    }
+}
+
+struct is_odd_op
+{
+    __device__ __host__
+    bool operator()(int value) const
+    {
+        return (value & 1) != 0;
+    }
+};
+
+TEST(RocprimDictionaryIteratorTests, DeviceAlgorithms)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    constexpr unsigned int dictionary_size = 100;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+            if(size == 0)
+            {
+                continue;
+            }
+
+            const std::vector<int> dictionary
+                = test_utils::get_random_data<int>(dictionary_size, 0, 999, seed_value);
+            const std::vector<unsigned char> codes = test_utils::get_random_data<unsigned char>(
+                size, 0, dictionary_size - 1, seed_value);
+            std::vector<int> input(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                input[i] = dictionary[codes[i]];
+            }
+
+            int*           d_dictionary;
+            unsigned char* d_codes;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_dictionary, dictionary_size * sizeof(int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_codes, size * sizeof(unsigned char)));
+            HIP_CHECK(hipMemcpy(d_dictionary,
+                                dictionary.data(),
+                                dictionary_size * sizeof(int),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_codes,
+                                codes.data(),
+                                size * sizeof(unsigned char),
+                                hipMemcpyHostToDevice));
+            const auto decoded
+                = rocprim::make_dictionary_iterator(d_dictionary, dictionary_size, d_codes);
+
+            int*          d_output;
+            unsigned int* d_count;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_count, sizeof(unsigned int)));
+
+            // reduce
+            {
+                size_t temp_storage_size_bytes;
+                HIP_CHECK(rocprim::reduce(nullptr,
+                                          temp_storage_size_bytes,
+                                          decoded,
+                                          d_output,
+                                          size,
+                                          rocprim::plus<int>(),
+                                          stream));
+                void* d_temp_storage;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+                HIP_CHECK(rocprim::reduce(d_temp_storage,
+                                          temp_storage_size_bytes,
+                                          decoded,
+                                          d_output,
+                                          size,
+                                          rocprim::plus<int>(),
+                                          stream));
+                HIP_CHECK(hipGetLastError());
+
+                int output;
+                HIP_CHECK(hipMemcpy(&output, d_output, sizeof(int), hipMemcpyDeviceToHost));
+                ASSERT_EQ(output, std::accumulate(input.begin(), input.end(), 0));
+                HIP_CHECK(hipFree(d_temp_storage));
+            }
+
+            // histogram_even
+            {
+                constexpr unsigned int bins = 10;
+                std::vector<unsigned int> expected(bins, 0);
+                for(int value : input)
+                {
+                    expected[value / 100]++;
+                }
+
+                unsigned int* d_histogram;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_histogram, bins * sizeof(unsigned int)));
+                size_t temp_storage_size_bytes;
+                HIP_CHECK(rocprim::histogram_even(nullptr,
+                                                  temp_storage_size_bytes,
+                                                  decoded,
+                                                  size,
+                                                  d_histogram,
+                                                  bins + 1,
+                                                  0,
+                                                  1000,
+                                                  stream));
+                void* d_temp_storage;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+                HIP_CHECK(rocprim::histogram_even(d_temp_storage,
+                                                  temp_storage_size_bytes,
+                                                  decoded,
+                                                  size,
+                                                  d_histogram,
+                                                  bins + 1,
+                                                  0,
+                                                  1000,
+                                                  stream));
+                HIP_CHECK(hipGetLastError());
+
+                std::vector<unsigned int> histogram(bins);
+                HIP_CHECK(hipMemcpy(histogram.data(),
+                                    d_histogram,
+                                    bins * sizeof(unsigned int),
+                                    hipMemcpyDeviceToHost));
+                ASSERT_EQ(histogram, expected);
+                HIP_CHECK(hipFree(d_temp_storage));
+                HIP_CHECK(hipFree(d_histogram));
+            }
+
+            // select the odd values
+            {
+                const is_odd_op  is_odd;
+                std::vector<int> expected;
+                std::copy_if(input.begin(), input.end(), std::back_inserter(expected), is_odd);
+
+                size_t temp_storage_size_bytes;
+                HIP_CHECK(rocprim::select(nullptr,
+                                          temp_storage_size_bytes,
+                                          decoded,
+                                          d_output,
+                                          d_count,
+                                          size,
+                                          is_odd,
+                                          stream));
+                void* d_temp_storage;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+                HIP_CHECK(rocprim::select(d_temp_storage,
+                                          temp_storage_size_bytes,
+                                          decoded,
+                                          d_output,
+                                          d_count,
+                                          size,
+                                          is_odd,
+                                          stream));
+                HIP_CHECK(hipGetLastError());
+
+                unsigned int count;
+                HIP_CHECK(hipMemcpy(&count, d_count, sizeof(unsigned int), hipMemcpyDeviceToHost));
+                ASSERT_EQ(count, expected.size());
+                std::vector<int> output(count);
+                HIP_CHECK(hipMemcpy(output.data(),
+                                    d_output,
+                                    count * sizeof(int),
+                                    hipMemcpyDeviceToHost));
+                ASSERT_EQ(output, expected);
+                HIP_CHECK(hipFree(d_temp_storage));
+            }
+
+            HIP_CHECK(hipFree(d_dictionary));
+            HIP_CHECK(hipFree(d_codes));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_count));
+        }
+    }
+}
@@ -0,0 +1,145 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_radix_sort.hpp>
+#include <rocprim/device/device_reduce.hpp>
+#include <rocprim/device/graph_plan.hpp>
+#include <rocprim/functional.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+TEST(RocprimGraphPlanTests, SortAndReduce)
+{
+#if !ROCPRIM_DETAIL_HAS_GRAPHS
+    GTEST_SKIP() << "HIP graphs are not supported";
+#else
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    const size_t max_size = 1 << 18;
+
+    unsigned int* d_input;
+    unsigned int* d_output;
+    unsigned int* d_sum;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, max_size * sizeof(unsigned int)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, max_size * sizeof(unsigned int)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_sum, sizeof(unsigned int)));
+
+    size_t sort_bytes;
+    size_t reduce_bytes;
+    HIP_CHECK(rocprim::radix_sort_keys(nullptr, sort_bytes, d_input, d_output, max_size));
+    HIP_CHECK(rocprim::reduce(nullptr,
+                              reduce_bytes,
+                              d_output,
+                              d_sum,
+                              max_size,
+                              rocprim::plus<unsigned int>()));
+    const size_t storage_bytes = std::max(sort_bytes, reduce_bytes);
+    void*        d_temp_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, storage_bytes));
+
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreate(&stream));
+
+    rocprim::graph_plan plan;
+    ASSERT_FALSE(plan.is_captured());
+    ASSERT_EQ(plan.launch(stream), hipErrorInvalidValue);
+
+    // The plan is captured again for every size, the second capture of each size updates it
+    for(size_t size : {size_t(1000), max_size, size_t(12345)})
+    {
+        SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+        // Keys with uniform high digits, which are not skipped while the stream is captured
+        const std::vector<unsigned int> input
+            = test_utils::get_random_data<unsigned int>(size, 0, 255, size);
+        std::vector<unsigned int> expected(input);
+        std::sort(expected.begin(), expected.end());
+        const unsigned int expected_sum = std::accumulate(input.begin(), input.end(), 0u);
+
+        const auto enqueue = [&](hipStream_t capture_stream)
+        {
+            size_t     temp_bytes = storage_bytes;
+            hipError_t error      = rocprim::radix_sort_keys(d_temp_storage,
+                                                        temp_bytes,
+                                                        d_input,
+                                                        d_output,
+                                                        size,
+                                                        0,
+                                                        8 * sizeof(unsigned int),
+                                                        capture_stream);
+            if(error != hipSuccess)
+            {
+                return error;
+            }
+            temp_bytes = storage_bytes;
+            return rocprim::reduce(d_temp_storage,
+                                   temp_bytes,
+                                   d_output,
+                                   d_sum,
+                                   size,
+                                   rocprim::plus<unsigned int>(),
+                                   capture_stream);
+        };
+        HIP_CHECK(plan.capture(enqueue));
+        HIP_CHECK(plan.capture(enqueue));
+        ASSERT_TRUE(plan.is_captured());
+
+        // The plan is replayed with new inputs
+        for(int launch = 0; launch < 2; launch++)
+        {
+            HIP_CHECK(hipMemsetAsync(d_output, 0, size * sizeof(unsigned int), stream));
+            HIP_CHECK(hipMemcpyAsync(d_input,
+                                     input.data(),
+                                     size * sizeof(unsigned int),
+                                     hipMemcpyHostToDevice,
+                                     stream));
+            HIP_CHECK(plan.launch(stream));
+            HIP_CHECK(hipStreamSynchronize(stream));
+
+            std::vector<unsigned int> output(size);
+            unsigned int              sum;
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                size * sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(&sum, d_sum, sizeof(unsigned int), hipMemcpyDeviceToHost));
+            ASSERT_EQ(output, expected);
+            ASSERT_EQ(sum, expected_sum);
+        }
+    }
+
+    HIP_CHECK(plan.reset());
+    ASSERT_FALSE(plan.is_captured());
+
+    HIP_CHECK(hipStreamDestroy(stream));
+    HIP_CHECK(hipFree(d_temp_storage));
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipFree(d_sum));
+#endif
+}
@@ -0,0 +1,133 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// The hooks in the device-level algorithms are compiled in only if this is defined first
+#define ROCPRIM_INSTRUMENTATION 1
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_scan.hpp>
+#include <rocprim/device/instrumentation.hpp>
+#include <rocprim/functional.hpp>
+
+#include <string>
+#include <vector>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+namespace
+{
+
+struct recorded_timing
+{
+    std::string kernel_name;
+    size_t      size;
+    float       milliseconds;
+};
+
+void record_timing(const rocprim::instrumentation::kernel_timing& timing, void* user_data)
+{
+    static_cast<std::vector<recorded_timing>*>(user_data)->push_back(
+        {timing.kernel_name, timing.size, timing.milliseconds});
+}
+
+} // namespace
+
+TEST(RocprimInstrumentationTests, ScanTimings)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    ASSERT_TRUE(rocprim::instrumentation::is_available());
+
+    const size_t                 size  = 1 << 20;
+    const std::vector<int>       input = test_utils::get_random_data<int>(size, -100, 100, size);
+    std::vector<recorded_timing> timings;
+
+    int* d_input;
+    int* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(int)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(int)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(int), hipMemcpyHostToDevice));
+
+    size_t storage_bytes;
+    HIP_CHECK(rocprim::inclusive_scan(nullptr,
+                                      storage_bytes,
+                                      d_input,
+                                      d_output,
+                                      size,
+                                      rocprim::plus<int>()));
+    void* d_temp_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, storage_bytes));
+
+    const auto run_scan = [&]()
+    {
+        HIP_CHECK(rocprim::inclusive_scan(d_temp_storage,
+                                          storage_bytes,
+                                          d_input,
+                                          d_output,
+                                          size,
+                                          rocprim::plus<int>()));
+    };
+
+    rocprim::instrumentation::set_timing_callback(record_timing, &timings);
+
+    // Nothing is recorded while the instrumentation is disabled
+    run_scan();
+    HIP_CHECK(rocprim::instrumentation::flush(true));
+    ASSERT_TRUE(timings.empty());
+
+    rocprim::instrumentation::set_enabled(true);
+    ASSERT_TRUE(rocprim::instrumentation::is_enabled());
+    run_scan();
+    HIP_CHECK(rocprim::instrumentation::flush(true));
+    rocprim::instrumentation::set_enabled(false);
+    rocprim::instrumentation::set_timing_callback(nullptr);
+
+    ASSERT_FALSE(timings.empty());
+    bool found_size = false;
+    for(const recorded_timing& timing : timings)
+    {
+        ASSERT_FALSE(timing.kernel_name.empty());
+        ASSERT_GE(timing.milliseconds, 0.0f);
+        found_size = found_size || timing.size == size;
+    }
+    // The scan kernel is launched over all items
+    ASSERT_TRUE(found_size);
+
+    // The results are not affected by the instrumentation
+    std::vector<int> output(size);
+    HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(int), hipMemcpyDeviceToHost));
+    int sum = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        sum += input[i];
+        ASSERT_EQ(output[i], sum) << "where index = " << i;
+    }
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipFree(d_temp_storage));
+}
@@ -23,6 +23,7 @@
 #include "../common_test_header.hpp"
 
 // required rocprim headers
+#include <rocprim/intrinsics/atomic.hpp>
 #include <rocprim/intrinsics/thread.hpp>
 #include <rocprim/intrinsics/warp_shuffle.hpp>
 
@@ -613,3 +614,149 @@ TEST(RocprimIntrinsicsTests, ShuffleUpCustomAlignedStruct)
     }
 
 }
+
+__global__
+__launch_bounds__(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE)
+void warp_aggregated_atomic_add_kernel(const unsigned int* flags,
+                                       unsigned int*       slots,
+                                       unsigned int*       counter)
+{
+    const unsigned int index = (blockIdx.x * blockDim.x) + threadIdx.x;
+    if(flags[index] != 0)
+    {
+        slots[index] = rocprim::detail::warp_aggregated_atomic_add(counter, 1u);
+    }
+}
+
+TEST(RocprimIntrinsicsTests, WarpAggregatedAtomicAdd)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    const size_t block_size = 256;
+    const size_t size       = block_size * 37;
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        const std::vector<unsigned int> flags
+            = test_utils::get_random_data<unsigned int>(size, 0, 1, seed_value);
+        const unsigned int expected_count
+            = static_cast<unsigned int>(std::count(flags.begin(), flags.end(), 1u));
+
+        unsigned int* d_flags;
+        unsigned int* d_slots;
+        unsigned int* d_counter;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_flags, size * sizeof(unsigned int)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_slots, size * sizeof(unsigned int)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_counter, sizeof(unsigned int)));
+        HIP_CHECK(
+            hipMemcpy(d_flags, flags.data(), size * sizeof(unsigned int), hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemset(d_counter, 0, sizeof(unsigned int)));
+
+        hipLaunchKernelGGL(warp_aggregated_atomic_add_kernel,
+                           dim3(size / block_size), dim3(block_size), 0, 0,
+                           d_flags, d_slots, d_counter);
+        HIP_CHECK(hipGetLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<unsigned int> slots(size);
+        unsigned int              count;
+        HIP_CHECK(
+            hipMemcpy(slots.data(), d_slots, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(&count, d_counter, sizeof(unsigned int), hipMemcpyDeviceToHost));
+        ASSERT_EQ(count, expected_count);
+
+        // Every flagged item must have reserved a unique slot
+        std::vector<unsigned int> reserved(expected_count, 0);
+        for(size_t i = 0; i < size; i++)
+        {
+            if(flags[i] != 0)
+            {
+                ASSERT_LT(slots[i], expected_count) << "where index = " << i;
+                reserved[slots[i]]++;
+            }
+        }
+        for(size_t i = 0; i < reserved.size(); i++)
+        {
+            ASSERT_EQ(reserved[i], 1u) << "where slot = " << i;
+        }
+
+        HIP_CHECK(hipFree(d_flags));
+        HIP_CHECK(hipFree(d_slots));
+        HIP_CHECK(hipFree(d_counter));
+    }
+}
+
+__global__
+__launch_bounds__(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE)
+void warp_grouped_atomic_add_kernel(const unsigned int* input,
+                                    unsigned int*       histogram,
+                                    unsigned int        bins_bits)
+{
+    const unsigned int index = (blockIdx.x * blockDim.x) + threadIdx.x;
+    rocprim::detail::warp_grouped_atomic_add(histogram, input[index], bins_bits, 1u);
+}
+
+TEST(RocprimIntrinsicsTests, WarpGroupedAtomicAdd)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    const size_t block_size = 256;
+    const size_t size       = block_size * 37;
+
+    for(unsigned int bins_bits : {0u, 1u, 3u, 6u})
+    {
+        SCOPED_TRACE(testing::Message() << "with bins_bits = " << bins_bits);
+        const unsigned int bins = 1u << bins_bits;
+
+        for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+        {
+            unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+            SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+            const std::vector<unsigned int> input
+                = test_utils::get_random_data<unsigned int>(size, 0, bins - 1, seed_value);
+            std::vector<unsigned int> expected(bins, 0);
+            for(auto bin : input)
+            {
+                expected[bin]++;
+            }
+
+            unsigned int* d_input;
+            unsigned int* d_histogram;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(unsigned int)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_histogram, bins * sizeof(unsigned int)));
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                size * sizeof(unsigned int),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemset(d_histogram, 0, bins * sizeof(unsigned int)));
+
+            hipLaunchKernelGGL(warp_grouped_atomic_add_kernel,
+                               dim3(size / block_size), dim3(block_size), 0, 0,
+                               d_input, d_histogram, bins_bits);
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<unsigned int> histogram(bins);
+            HIP_CHECK(hipMemcpy(histogram.data(),
+                                d_histogram,
+                                bins * sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+            for(size_t i = 0; i < bins; i++)
+            {
+                ASSERT_EQ(histogram[i], expected[i]) << "where bin = " << i;
+            }
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_histogram));
+        }
+    }
+}
@@ -0,0 +1,216 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+// required rocprim headers
+#include <rocprim/device/device_reduce.hpp>
+#include <rocprim/device/device_transform.hpp>
+#include <rocprim/functional.hpp>
+#include <rocprim/iterator/mapped_host_iterator.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+template<class T>
+class RocprimMappedHostIteratorTests : public ::testing::Test
+{
+public:
+    using value_type = T;
+};
+
+typedef ::testing::Types<int, unsigned char, double, test_utils::custom_test_type<int>>
+    RocprimMappedHostIteratorTestsParams;
+
+TYPED_TEST_SUITE(RocprimMappedHostIteratorTests, RocprimMappedHostIteratorTestsParams);
+
+template<class T>
+struct transform
+{
+    __device__ __host__
+    constexpr T operator()(const T& a) const
+    {
+        return a + 5;
+    }
+};
+
+TYPED_TEST(RocprimMappedHostIteratorTests, TransformPinned)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::value_type;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+            if(size == 0)
+            {
+                continue;
+            }
+
+            const std::vector<T> input = test_utils::get_random_data<T>(size, 1, 100, seed_value);
+
+            // The input and the output both reside in mapped pinned memory
+            T* h_input;
+            T* h_output;
+            HIP_CHECK(hipHostMalloc(&h_input, size * sizeof(T), hipHostMallocMapped));
+            HIP_CHECK(hipHostMalloc(&h_output, size * sizeof(T), hipHostMallocMapped));
+            std::copy(input.begin(), input.end(), h_input);
+
+            rocprim::mapped_host_iterator<T> mapped_input;
+            rocprim::mapped_host_iterator<T> mapped_output;
+            HIP_CHECK(rocprim::make_mapped_host_iterator(h_input, mapped_input));
+            HIP_CHECK(rocprim::make_mapped_host_iterator(h_output, mapped_output));
+
+            HIP_CHECK(
+                rocprim::transform(mapped_input, mapped_output, size, transform<T>(), stream));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipStreamSynchronize(stream));
+
+            for(size_t i = 0; i < size; i++)
+            {
+                ASSERT_EQ(h_output[i], transform<T>()(input[i])) << "where index = " << i;
+            }
+
+            HIP_CHECK(hipHostFree(h_input));
+            HIP_CHECK(hipHostFree(h_output));
+        }
+    }
+}
+
+TYPED_TEST(RocprimMappedHostIteratorTests, ReducePinnedAndManaged)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::value_type;
+
+    int managed_memory = 0;
+    HIP_CHECK(
+        hipDeviceGetAttribute(&managed_memory, hipDeviceAttributeManagedMemory, device_id));
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+            if(size == 0)
+            {
+                continue;
+            }
+
+            const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 10, seed_value);
+            T expected = T(0);
+            for(size_t i = 0; i < size; i++)
+            {
+                expected = expected + input[i];
+            }
+
+            for(bool managed : {false, true})
+            {
+                SCOPED_TRACE(testing::Message() << "with managed = " << managed);
+                if(managed && !managed_memory)
+                {
+                    continue;
+                }
+
+                T*                               h_input;
+                rocprim::mapped_host_iterator<T> mapped_input;
+                if(managed)
+                {
+                    HIP_CHECK(hipMallocManaged(&h_input, size * sizeof(T)));
+                    mapped_input = rocprim::mapped_host_iterator<T>(h_input);
+                }
+                else
+                {
+                    HIP_CHECK(hipHostMalloc(&h_input, size * sizeof(T), hipHostMallocMapped));
+                    HIP_CHECK(rocprim::make_mapped_host_iterator(h_input, mapped_input));
+                }
+                std::copy(input.begin(), input.end(), h_input);
+
+                T* d_output;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(T)));
+
+                size_t temp_storage_size_bytes;
+                HIP_CHECK(rocprim::reduce(nullptr,
+                                          temp_storage_size_bytes,
+                                          mapped_input,
+                                          d_output,
+                                          size,
+                                          rocprim::plus<T>(),
+                                          stream));
+                void* d_temp_storage;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+                if(managed)
+                {
+                    HIP_CHECK(mapped_input.prefetch(size, device_id, stream));
+                }
+                HIP_CHECK(rocprim::reduce(d_temp_storage,
+                                          temp_storage_size_bytes,
+                                          mapped_input,
+                                          d_output,
+                                          size,
+                                          rocprim::plus<T>(),
+                                          stream));
+                HIP_CHECK(hipGetLastError());
+
+                T output;
+                HIP_CHECK(hipMemcpy(&output, d_output, sizeof(T), hipMemcpyDeviceToHost));
+                ASSERT_EQ(output, expected);
+
+                HIP_CHECK(hipFree(d_temp_storage));
+                HIP_CHECK(hipFree(d_output));
+                if(managed)
+                {
+                    HIP_CHECK(hipFree(h_input));
+                }
+                else
+                {
+                    HIP_CHECK(hipHostFree(h_input));
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,271 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+// required rocprim headers
+#include <rocprim/block/block_load.hpp>
+#include <rocprim/block/block_store.hpp>
+#include <rocprim/device/device_transform.hpp>
+#include <rocprim/functional.hpp>
+#include <rocprim/iterator/permutation_iterator.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+template<class ValueType, class IndexType>
+struct RocprimPermutationIteratorParams
+{
+    using value_type = ValueType;
+    using index_type = IndexType;
+};
+
+template<class Params>
+class RocprimPermutationIteratorTests : public ::testing::Test
+{
+public:
+    using value_type = typename Params::value_type;
+    using index_type = typename Params::index_type;
+};
+
+typedef ::testing::Types<RocprimPermutationIteratorParams<int, unsigned int>,
+                         RocprimPermutationIteratorParams<double, unsigned int>,
+                         RocprimPermutationIteratorParams<unsigned char, int>,
+                         RocprimPermutationIteratorParams<float, unsigned long long>>
+    RocprimPermutationIteratorTestsParams;
+
+TYPED_TEST_SUITE(RocprimPermutationIteratorTests, RocprimPermutationIteratorTestsParams);
+
+template<class IndexType>
+std::vector<IndexType> get_random_permutation(size_t size, unsigned int seed_value)
+{
+    std::vector<IndexType> indices(size);
+    std::iota(indices.begin(), indices.end(), IndexType(0));
+    std::shuffle(indices.begin(), indices.end(), std::default_random_engine(seed_value));
+    return indices;
+}
+
+TYPED_TEST(RocprimPermutationIteratorTests, Host)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+
+    std::vector<value_type> values = {1, 2, 3, 4, 5};
+    std::vector<index_type> indices = {4, 0, 3, 3, 1};
+
+    auto iterator = rocprim::make_permutation_iterator(values.data(), indices.data());
+    ASSERT_EQ(*iterator, value_type(5));
+    ASSERT_EQ(iterator[2], value_type(4));
+    ASSERT_EQ(*(iterator + 4), value_type(2));
+    ASSERT_EQ((iterator + 4) - iterator, 4);
+    ASSERT_EQ(std::accumulate(iterator, iterator + 5, value_type(0)), value_type(16));
+
+    auto scatter = rocprim::make_scatter_iterator(values.data(), indices.data());
+    scatter[1] = value_type(10);
+    ++scatter;
+    ASSERT_EQ(values[0], value_type(10));
+    ASSERT_EQ(*scatter, value_type(10));
+}
+
+TYPED_TEST(RocprimPermutationIteratorTests, TransformGatherScatter)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<value_type> input
+                = test_utils::get_random_data<value_type>(size, 0, 100, seed_value);
+            const std::vector<index_type> indices
+                = get_random_permutation<index_type>(size, seed_value);
+
+            value_type* d_input;
+            index_type* d_indices;
+            value_type* d_gathered;
+            value_type* d_scattered;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_indices, size * sizeof(index_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_gathered, size * sizeof(value_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_scattered, size * sizeof(value_type)));
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                size * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_indices,
+                                indices.data(),
+                                size * sizeof(index_type),
+                                hipMemcpyHostToDevice));
+
+            HIP_CHECK(rocprim::transform(rocprim::make_permutation_iterator(d_input, d_indices),
+                                         d_gathered,
+                                         size,
+                                         rocprim::identity<value_type>(),
+                                         stream));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(rocprim::transform(d_input,
+                                         rocprim::make_scatter_iterator(d_scattered, d_indices),
+                                         size,
+                                         rocprim::identity<value_type>(),
+                                         stream));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<value_type> gathered(size);
+            std::vector<value_type> scattered(size);
+            HIP_CHECK(hipMemcpy(gathered.data(),
+                                d_gathered,
+                                size * sizeof(value_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(scattered.data(),
+                                d_scattered,
+                                size * sizeof(value_type),
+                                hipMemcpyDeviceToHost));
+
+            for(size_t i = 0; i < size; i++)
+            {
+                ASSERT_EQ(gathered[i], input[indices[i]]) << "where index = " << i;
+                ASSERT_EQ(scattered[indices[i]], input[i]) << "where index = " << i;
+            }
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_indices));
+            HIP_CHECK(hipFree(d_gathered));
+            HIP_CHECK(hipFree(d_scattered));
+        }
+    }
+}
+
+template<unsigned int BlockSize, unsigned int ItemsPerThread, class T, class Index>
+__global__ __launch_bounds__(BlockSize) void permute_vectorized_kernel(const T*     input,
+                                                                       const Index* gather,
+                                                                       const Index* scatter,
+                                                                       T*           output)
+{
+    using load_type  = rocprim::block_load<T,
+                                          BlockSize,
+                                          ItemsPerThread,
+                                          rocprim::block_load_method::block_load_vectorize>;
+    using store_type = rocprim::block_store<T,
+                                            BlockSize,
+                                            ItemsPerThread,
+                                            rocprim::block_store_method::block_store_vectorize>;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    const unsigned int     offset          = blockIdx.x * items_per_block;
+
+    T items[ItemsPerThread];
+    load_type().load(rocprim::make_permutation_iterator(input, gather + offset), items);
+    store_type().store(rocprim::make_scatter_iterator(output, scatter + offset), items);
+}
+
+TYPED_TEST(RocprimPermutationIteratorTests, BlockLoadStoreVectorize)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+
+    constexpr unsigned int block_size       = 256;
+    constexpr unsigned int items_per_thread = 4;
+    constexpr unsigned int blocks           = 37;
+    constexpr size_t       size             = block_size * items_per_thread * blocks;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        const std::vector<value_type> input
+            = test_utils::get_random_data<value_type>(size, 0, 100, seed_value);
+        const std::vector<index_type> gather
+            = get_random_permutation<index_type>(size, seed_value);
+        const std::vector<index_type> scatter
+            = get_random_permutation<index_type>(size, seed_value + 1);
+
+        value_type* d_input;
+        index_type* d_gather;
+        index_type* d_scatter;
+        value_type* d_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(value_type)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_gather, size * sizeof(index_type)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_scatter, size * sizeof(index_type)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(value_type)));
+        HIP_CHECK(
+            hipMemcpy(d_input, input.data(), size * sizeof(value_type), hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_gather,
+                            gather.data(),
+                            size * sizeof(index_type),
+                            hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_scatter,
+                            scatter.data(),
+                            size * sizeof(index_type),
+                            hipMemcpyHostToDevice));
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(
+                permute_vectorized_kernel<block_size, items_per_thread, value_type, index_type>),
+            dim3(blocks),
+            dim3(block_size),
+            0,
+            0,
+            d_input,
+            d_gather,
+            d_scatter,
+            d_output);
+        HIP_CHECK(hipGetLastError());
+
+        std::vector<value_type> output(size);
+        HIP_CHECK(
+            hipMemcpy(output.data(), d_output, size * sizeof(value_type), hipMemcpyDeviceToHost));
+
+        for(size_t i = 0; i < size; i++)
+        {
+            ASSERT_EQ(output[scatter[i]], input[gather[i]]) << "where index = " << i;
+        }
+
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_gather));
+        HIP_CHECK(hipFree(d_scatter));
+        HIP_CHECK(hipFree(d_output));
+    }
+}
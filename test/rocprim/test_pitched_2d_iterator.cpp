@@ -0,0 +1,252 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+#include <numeric>
+
+// required rocprim headers
+#include <rocprim/block/block_load.hpp>
+#include <rocprim/device/device_reduce.hpp>
+#include <rocprim/functional.hpp>
+#include <rocprim/iterator/pitched_2d_iterator.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+template<class T>
+class RocprimPitched2dIteratorTests : public ::testing::Test
+{
+public:
+    using value_type = T;
+};
+
+typedef ::testing::Types<int, unsigned char, double> RocprimPitched2dIteratorTestsParams;
+
+TYPED_TEST_SUITE(RocprimPitched2dIteratorTests, RocprimPitched2dIteratorTestsParams);
+
+TEST(RocprimPitched2dIteratorHostTests, Host)
+{
+    // 3 rows of 4 elements with a pitch of 6 elements
+    std::vector<int> values(18);
+    std::iota(values.begin(), values.end(), 0);
+
+    auto iterator = rocprim::make_pitched_2d_iterator(values.data(), 6 * sizeof(int), 4);
+    ASSERT_EQ(*iterator, 0);
+    ASSERT_EQ(iterator[3], 3);
+    ASSERT_EQ(iterator[4], 6);
+    ASSERT_EQ(*(iterator + 11), 15);
+    ASSERT_EQ((iterator + 12) - iterator, 12);
+    ASSERT_EQ(std::accumulate(iterator, iterator + 12, 0), 90);
+    ASSERT_EQ(iterator.row(2), values.data() + 12);
+
+    iterator += 5;
+    ASSERT_EQ(iterator.index(), 5);
+    *iterator = 100;
+    ASSERT_EQ(values[7], 100);
+
+    const std::vector<int>& const_values = values;
+    auto                    const_iterator
+        = rocprim::make_pitched_2d_iterator(const_values.data(), 6 * sizeof(int), 4);
+    ASSERT_EQ(const_iterator[5], 100);
+}
+
+template<class T>
+struct pitched_matrix
+{
+    std::vector<T> host;
+    T*             device;
+    size_t         pitch;
+};
+
+template<class T>
+pitched_matrix<T> make_pitched_matrix(size_t height, size_t pitch_elements, unsigned int seed)
+{
+    pitched_matrix<T> matrix;
+    matrix.pitch = pitch_elements * sizeof(T);
+    matrix.host  = test_utils::get_random_data<T>(pitch_elements * height, 0, 10, seed);
+    HIP_CHECK(test_common_utils::hipMallocHelper(&matrix.device, matrix.host.size() * sizeof(T)));
+    HIP_CHECK(hipMemcpy(matrix.device,
+                        matrix.host.data(),
+                        matrix.host.size() * sizeof(T),
+                        hipMemcpyHostToDevice));
+    return matrix;
+}
+
+TYPED_TEST(RocprimPitched2dIteratorTests, Reduce)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::value_type;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t width : {1, 100, 1000})
+        {
+            for(size_t height : {1, 37, 1000})
+            {
+                SCOPED_TRACE(testing::Message() << "with width = " << width);
+                SCOPED_TRACE(testing::Message() << "with height = " << height);
+
+                const size_t      pitch_elements = width + 13;
+                pitched_matrix<T> matrix
+                    = make_pitched_matrix<T>(height, pitch_elements, seed_value);
+
+                T expected = T(0);
+                for(size_t row = 0; row < height; row++)
+                {
+                    for(size_t column = 0; column < width; column++)
+                    {
+                        expected = expected + matrix.host[row * pitch_elements + column];
+                    }
+                }
+
+                T* d_output;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(T)));
+
+                auto input = rocprim::make_pitched_2d_iterator(
+                    static_cast<const T*>(matrix.device), matrix.pitch, width);
+                size_t temp_storage_size_bytes;
+                HIP_CHECK(rocprim::reduce(nullptr,
+                                          temp_storage_size_bytes,
+                                          input,
+                                          d_output,
+                                          width * height,
+                                          rocprim::plus<T>()));
+                void* d_temp_storage;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+                HIP_CHECK(rocprim::reduce(d_temp_storage,
+                                          temp_storage_size_bytes,
+                                          input,
+                                          d_output,
+                                          width * height,
+                                          rocprim::plus<T>()));
+                HIP_CHECK(hipGetLastError());
+
+                T output;
+                HIP_CHECK(hipMemcpy(&output, d_output, sizeof(T), hipMemcpyDeviceToHost));
+                ASSERT_EQ(output, expected);
+
+                HIP_CHECK(hipFree(d_temp_storage));
+                HIP_CHECK(hipFree(d_output));
+                HIP_CHECK(hipFree(matrix.device));
+            }
+        }
+    }
+}
+
+template<unsigned int BlockSize, unsigned int ItemsPerThread, class T>
+__global__ __launch_bounds__(BlockSize) void pitched_load_kernel(const T*     input,
+                                                                 size_t       pitch,
+                                                                 size_t       width,
+                                                                 T*           output,
+                                                                 unsigned int valid)
+{
+    using load_type = rocprim::block_load<T,
+                                         BlockSize,
+                                         ItemsPerThread,
+                                         rocprim::block_load_method::block_load_transpose>;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    const unsigned int     offset          = blockIdx.x * items_per_block;
+
+    T items[ItemsPerThread];
+    load_type().load(rocprim::make_pitched_2d_iterator(input, pitch, width) + offset,
+                     items,
+                     valid,
+                     T(-1));
+
+    const unsigned int flat_id = threadIdx.x;
+    for(unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        output[offset + flat_id * ItemsPerThread + item] = items[item];
+    }
+}
+
+TYPED_TEST(RocprimPitched2dIteratorTests, BlockLoadTranspose)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::value_type;
+
+    constexpr unsigned int block_size       = 128;
+    constexpr unsigned int items_per_thread = 3;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+    constexpr unsigned int blocks           = 5;
+    constexpr size_t       size             = items_per_block * blocks;
+
+    for(size_t width : {1, 7, 128, 1000})
+    {
+        SCOPED_TRACE(testing::Message() << "with width = " << width);
+
+        const size_t      height         = (size + width - 1) / width;
+        const size_t      pitch_elements = width + 5;
+        pitched_matrix<T> matrix = make_pitched_matrix<T>(height, pitch_elements, seeds[0]);
+
+        T* d_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+
+        for(unsigned int valid : {0u, 1u, 100u, items_per_block})
+        {
+            SCOPED_TRACE(testing::Message() << "with valid = " << valid);
+
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(pitched_load_kernel<block_size, items_per_thread, T>),
+                dim3(blocks),
+                dim3(block_size),
+                0,
+                0,
+                matrix.device,
+                matrix.pitch,
+                width,
+                d_output,
+                valid);
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<T> output(size);
+            HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+
+            for(size_t i = 0; i < size; i++)
+            {
+                const size_t row      = i / width;
+                const size_t column   = i % width;
+                const T      expected = i % items_per_block < valid
+                                            ? matrix.host[row * pitch_elements + column]
+                                            : T(-1);
+                ASSERT_EQ(output[i], expected) << "where index = " << i;
+            }
+        }
+
+        HIP_CHECK(hipFree(d_output));
+        HIP_CHECK(hipFree(matrix.device));
+    }
+}
@@ -0,0 +1,237 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+// required rocprim headers
+#include <rocprim/device/config_types.hpp>
+#include <rocprim/device/device_radix_sort.hpp>
+#include <rocprim/device/device_reduce.hpp>
+#include <rocprim/functional.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+using small_reduce_config
+    = rocprim::reduce_config<64, 2, rocprim::block_reduce_algorithm::default_algorithm>;
+using large_reduce_config
+    = rocprim::reduce_config<256, 8, rocprim::block_reduce_algorithm::default_algorithm>;
+
+using reduce_buckets
+    = rocprim::size_bucketed_config<rocprim::size_bucket<1000, small_reduce_config>,
+                                    rocprim::size_bucket<100000, rocprim::default_config>,
+                                    rocprim::size_bucket<0, large_reduce_config>>;
+
+using small_radix_sort_config = rocprim::radix_sort_config<8,
+                                                          5,
+                                                          rocprim::kernel_config<256, 3>,
+                                                          rocprim::kernel_config<256, 8>,
+                                                          rocprim::kernel_config<64, 4>>;
+
+using radix_sort_buckets = rocprim::size_bucketed_config<
+    rocprim::size_bucket<10000, small_radix_sort_config>,
+    rocprim::size_bucket<std::numeric_limits<size_t>::max(), rocprim::default_config>>;
+
+const std::vector<size_t> size_bucket_test_sizes = {1, 1000, 1001, 54321, 100001, 1 << 20};
+
+TEST(RocprimSizeBucketedConfigTests, BucketSelection)
+{
+    auto block_size = [](auto config) { return decltype(config)::block_size; };
+    using rocprim::detail::dispatch_size_bucket;
+
+    ASSERT_EQ(dispatch_size_bucket<small_reduce_config>(1 << 30, block_size), 64u);
+
+    using buckets = rocprim::size_bucketed_config<rocprim::size_bucket<10, small_reduce_config>,
+                                                  rocprim::size_bucket<20, large_reduce_config>>;
+    ASSERT_EQ(dispatch_size_bucket<buckets>(0, block_size), 64u);
+    ASSERT_EQ(dispatch_size_bucket<buckets>(10, block_size), 64u);
+    ASSERT_EQ(dispatch_size_bucket<buckets>(11, block_size), 256u);
+    ASSERT_EQ(dispatch_size_bucket<buckets>(20, block_size), 256u);
+    // The last bucket covers all larger sizes
+    ASSERT_EQ(dispatch_size_bucket<buckets>(21, block_size), 256u);
+
+    static_assert(rocprim::detail::is_size_bucketed_config<buckets>::value, "");
+    static_assert(!rocprim::detail::is_size_bucketed_config<small_reduce_config>::value, "");
+}
+
+TEST(RocprimSizeBucketedConfigTests, Reduce)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = unsigned int;
+
+    hipStream_t stream = 0; // default
+
+    const size_t max_size = size_bucket_test_sizes.back();
+    T*           d_input;
+    T*           d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, max_size * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(T)));
+
+    for(const size_t size : size_bucket_test_sizes)
+    {
+        SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+        const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, size);
+        const T expected = std::accumulate(input.begin(), input.end(), T(7));
+        HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+        size_t temporary_storage_bytes;
+        HIP_CHECK(rocprim::reduce<reduce_buckets>(nullptr,
+                                                  temporary_storage_bytes,
+                                                  d_input,
+                                                  d_output,
+                                                  T(7),
+                                                  size,
+                                                  rocprim::plus<T>(),
+                                                  stream));
+        void* d_temporary_storage;
+        HIP_CHECK(
+            test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+        HIP_CHECK(rocprim::reduce<reduce_buckets>(d_temporary_storage,
+                                                  temporary_storage_bytes,
+                                                  d_input,
+                                                  d_output,
+                                                  T(7),
+                                                  size,
+                                                  rocprim::plus<T>(),
+                                                  stream));
+        HIP_CHECK(hipGetLastError());
+
+        T output;
+        HIP_CHECK(hipMemcpy(&output, d_output, sizeof(T), hipMemcpyDeviceToHost));
+        ASSERT_EQ(output, expected);
+
+        HIP_CHECK(hipFree(d_temporary_storage));
+    }
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
+
+TEST(RocprimSizeBucketedConfigTests, RadixSortPairs)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type   = int;
+    using value_type = unsigned int;
+
+    hipStream_t stream = 0; // default
+
+    const size_t max_size = size_bucket_test_sizes.back();
+    key_type*    d_keys_input;
+    key_type*    d_keys_output;
+    value_type*  d_values_input;
+    value_type*  d_values_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, max_size * sizeof(key_type)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, max_size * sizeof(key_type)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input, max_size * sizeof(value_type)));
+    HIP_CHECK(
+        test_common_utils::hipMallocHelper(&d_values_output, max_size * sizeof(value_type)));
+
+    for(const size_t size : size_bucket_test_sizes)
+    {
+        SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+        const std::vector<key_type> keys
+            = test_utils::get_random_data<key_type>(size, -1000, 1000, size);
+        std::vector<value_type> values(size);
+        std::iota(values.begin(), values.end(), 0u);
+        HIP_CHECK(hipMemcpy(d_keys_input,
+                            keys.data(),
+                            size * sizeof(key_type),
+                            hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_values_input,
+                            values.data(),
+                            size * sizeof(value_type),
+                            hipMemcpyHostToDevice));
+
+        // The sort is stable, the values are the original positions
+        std::vector<std::pair<key_type, value_type>> expected(size);
+        for(size_t i = 0; i < size; i++)
+        {
+            expected[i] = {keys[i], values[i]};
+        }
+        std::stable_sort(expected.begin(),
+                         expected.end(),
+                         [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        size_t temporary_storage_bytes;
+        HIP_CHECK(rocprim::radix_sort_pairs<radix_sort_buckets>(nullptr,
+                                                                temporary_storage_bytes,
+                                                                d_keys_input,
+                                                                d_keys_output,
+                                                                d_values_input,
+                                                                d_values_output,
+                                                                size,
+                                                                0,
+                                                                8 * sizeof(key_type),
+                                                                stream));
+        void* d_temporary_storage;
+        HIP_CHECK(
+            test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+        HIP_CHECK(rocprim::radix_sort_pairs<radix_sort_buckets>(d_temporary_storage,
+                                                                temporary_storage_bytes,
+                                                                d_keys_input,
+                                                                d_keys_output,
+                                                                d_values_input,
+                                                                d_values_output,
+                                                                size,
+                                                                0,
+                                                                8 * sizeof(key_type),
+                                                                stream));
+        HIP_CHECK(hipGetLastError());
+
+        std::vector<key_type>   keys_output(size);
+        std::vector<value_type> values_output(size);
+        HIP_CHECK(hipMemcpy(keys_output.data(),
+                            d_keys_output,
+                            size * sizeof(key_type),
+                            hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(values_output.data(),
+                            d_values_output,
+                            size * sizeof(value_type),
+                            hipMemcpyDeviceToHost));
+        for(size_t i = 0; i < size; i++)
+        {
+            ASSERT_EQ(keys_output[i], expected[i].first) << "where index = " << i;
+            ASSERT_EQ(values_output[i], expected[i].second) << "where index = " << i;
+        }
+
+        HIP_CHECK(hipFree(d_temporary_storage));
+    }
+
+    HIP_CHECK(hipFree(d_keys_input));
+    HIP_CHECK(hipFree(d_keys_output));
+    HIP_CHECK(hipFree(d_values_input));
+    HIP_CHECK(hipFree(d_values_output));
+}
@@ -0,0 +1,227 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+#include <numeric>
+
+// required rocprim headers
+#include <rocprim/block/block_load.hpp>
+#include <rocprim/device/device_reduce.hpp>
+#include <rocprim/functional.hpp>
+#include <rocprim/iterator/counting_iterator.hpp>
+#include <rocprim/iterator/strided_iterator.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+template<class T>
+class RocprimStridedIteratorTests : public ::testing::Test
+{
+public:
+    using value_type = T;
+};
+
+typedef ::testing::Types<int, unsigned char, double>
+    RocprimStridedIteratorTestsParams;
+
+TYPED_TEST_SUITE(RocprimStridedIteratorTests, RocprimStridedIteratorTestsParams);
+
+TEST(RocprimStridedIteratorHostTests, Host)
+{
+    std::vector<int> values(12);
+    std::iota(values.begin(), values.end(), 0);
+
+    auto iterator = rocprim::make_strided_iterator(values.data(), 3);
+    ASSERT_EQ(*iterator, 0);
+    ASSERT_EQ(iterator[2], 6);
+    ASSERT_EQ(*(iterator + 3), 9);
+    ASSERT_EQ((iterator + 4) - iterator, 4);
+    ASSERT_EQ(std::accumulate(iterator, iterator + 4, 0), 18);
+
+    ++iterator;
+    ASSERT_EQ(*iterator, 3);
+    ASSERT_EQ(iterator.base(), values.data() + 3);
+    ASSERT_EQ(iterator.stride(), 3);
+    *iterator = 10;
+    ASSERT_EQ(values[3], 10);
+
+    auto counting = rocprim::make_strided_iterator(rocprim::make_counting_iterator(5), 2);
+    ASSERT_EQ(counting[3], 11);
+}
+
+TYPED_TEST(RocprimStridedIteratorTests, Reduce)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::value_type;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+            if(size == 0)
+            {
+                continue;
+            }
+
+            for(int stride : {1, 3, 16})
+            {
+                SCOPED_TRACE(testing::Message() << "with stride = " << stride);
+
+                const size_t         input_size = (size - 1) * stride + 1;
+                const std::vector<T> input
+                    = test_utils::get_random_data<T>(input_size, 0, 10, seed_value);
+
+                T expected = T(0);
+                for(size_t i = 0; i < size; i++)
+                {
+                    expected = expected + input[i * stride];
+                }
+
+                T* d_input;
+                T* d_output;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input_size * sizeof(T)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(T)));
+                HIP_CHECK(hipMemcpy(d_input,
+                                    input.data(),
+                                    input_size * sizeof(T),
+                                    hipMemcpyHostToDevice));
+
+                auto   strided = rocprim::make_strided_iterator(d_input, stride);
+                size_t temp_storage_size_bytes;
+                HIP_CHECK(rocprim::reduce(nullptr,
+                                          temp_storage_size_bytes,
+                                          strided,
+                                          d_output,
+                                          size,
+                                          rocprim::plus<T>()));
+                void* d_temp_storage;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+                HIP_CHECK(rocprim::reduce(d_temp_storage,
+                                          temp_storage_size_bytes,
+                                          strided,
+                                          d_output,
+                                          size,
+                                          rocprim::plus<T>()));
+                HIP_CHECK(hipGetLastError());
+
+                T output;
+                HIP_CHECK(hipMemcpy(&output, d_output, sizeof(T), hipMemcpyDeviceToHost));
+                ASSERT_EQ(output, expected);
+
+                HIP_CHECK(hipFree(d_temp_storage));
+                HIP_CHECK(hipFree(d_input));
+                HIP_CHECK(hipFree(d_output));
+            }
+        }
+    }
+}
+
+template<unsigned int BlockSize, unsigned int ItemsPerThread, class T>
+__global__ __launch_bounds__(BlockSize) void strided_load_kernel(const T*     input,
+                                                                 T*           output,
+                                                                 int          stride,
+                                                                 unsigned int valid)
+{
+    using load_type = rocprim::block_load<T,
+                                         BlockSize,
+                                         ItemsPerThread,
+                                         rocprim::block_load_method::block_load_transpose>;
+
+    T items[ItemsPerThread];
+    load_type().load(rocprim::make_strided_iterator(input, stride), items, valid, T(-1));
+
+    const unsigned int flat_id = threadIdx.x;
+    for(unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        output[flat_id * ItemsPerThread + item] = items[item];
+    }
+}
+
+TYPED_TEST(RocprimStridedIteratorTests, BlockLoadTranspose)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::value_type;
+
+    constexpr unsigned int block_size       = 128;
+    constexpr unsigned int items_per_thread = 3;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+    constexpr int          max_stride       = 6;
+    constexpr size_t       input_size       = items_per_block * max_stride;
+
+    const std::vector<T> input = test_utils::get_random_data<T>(input_size, 0, 100, seeds[0]);
+
+    T* d_input;
+    T* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input_size * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, items_per_block * sizeof(T)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), input_size * sizeof(T), hipMemcpyHostToDevice));
+
+    for(int stride = 1; stride <= max_stride; stride++)
+    {
+        SCOPED_TRACE(testing::Message() << "with stride = " << stride);
+        for(unsigned int valid : {0u, 1u, 100u, items_per_block - 1, items_per_block})
+        {
+            SCOPED_TRACE(testing::Message() << "with valid = " << valid);
+
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(strided_load_kernel<block_size, items_per_thread, T>),
+                dim3(1),
+                dim3(block_size),
+                0,
+                0,
+                d_input,
+                d_output,
+                stride,
+                valid);
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<T> output(items_per_block);
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                items_per_block * sizeof(T),
+                                hipMemcpyDeviceToHost));
+
+            for(size_t i = 0; i < items_per_block; i++)
+            {
+                const T expected = i < valid ? input[i * stride] : T(-1);
+                ASSERT_EQ(output[i], expected) << "where index = " << i;
+            }
+        }
+    }
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
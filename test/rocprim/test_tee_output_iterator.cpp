@@ -0,0 +1,214 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+#include <algorithm>
+
+// required rocprim headers
+#include <rocprim/block/block_store.hpp>
+#include <rocprim/device/device_transform.hpp>
+#include <rocprim/functional.hpp>
+#include <rocprim/iterator/tee_output_iterator.hpp>
+#include <rocprim/iterator/transform_output_iterator.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+struct square_op
+{
+    ROCPRIM_HOST_DEVICE
+    int operator()(int value) const
+    {
+        return value * value;
+    }
+};
+
+struct to_short_op
+{
+    ROCPRIM_HOST_DEVICE
+    short operator()(int value) const
+    {
+        return static_cast<short>(rocprim::min(value, 32767));
+    }
+};
+
+TEST(RocprimTeeOutputIteratorTests, Host)
+{
+    std::vector<int>   first(4, 0);
+    std::vector<short> second(4, 0);
+    auto iterator = rocprim::make_tee_output_iterator(
+        first.data(),
+        rocprim::make_transform_output_iterator(second.data(), to_short_op()));
+
+    const std::vector<int> input = {5, 40000, -7, 12};
+    for(size_t i = 0; i < input.size(); i++)
+    {
+        iterator[i] = input[i];
+    }
+    ASSERT_EQ(first, input);
+    ASSERT_EQ(second, std::vector<short>({5, 32767, -7, 12}));
+
+    *(iterator + 1) = 3;
+    ASSERT_EQ(first[1], 3);
+    ASSERT_EQ(second[1], 3);
+    ASSERT_EQ((iterator + 4) - iterator, 4);
+    ASSERT_EQ((iterator + 4).first(), first.data() + 4);
+}
+
+TEST(RocprimTeeOutputIteratorTests, Transform)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+            if(size == 0)
+            {
+                continue;
+            }
+
+            const std::vector<int> input
+                = test_utils::get_random_data<int>(size, -300, 300, seed_value);
+            std::vector<int>   expected_first(size);
+            std::vector<short> expected_second(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                expected_first[i]  = square_op()(input[i]);
+                expected_second[i] = to_short_op()(expected_first[i]);
+            }
+
+            int*   d_input;
+            int*   d_first;
+            short* d_second;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_first, size * sizeof(int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_second, size * sizeof(short)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(int), hipMemcpyHostToDevice));
+
+            HIP_CHECK(rocprim::transform(
+                d_input,
+                rocprim::make_tee_output_iterator(
+                    d_first,
+                    rocprim::make_transform_output_iterator(d_second, to_short_op())),
+                size,
+                square_op(),
+                stream));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<int>   first(size);
+            std::vector<short> second(size);
+            HIP_CHECK(hipMemcpy(first.data(), d_first, size * sizeof(int), hipMemcpyDeviceToHost));
+            HIP_CHECK(
+                hipMemcpy(second.data(), d_second, size * sizeof(short), hipMemcpyDeviceToHost));
+            ASSERT_EQ(first, expected_first);
+            ASSERT_EQ(second, expected_second);
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_first));
+            HIP_CHECK(hipFree(d_second));
+        }
+    }
+}
+
+template<unsigned int BlockSize, unsigned int ItemsPerThread, rocprim::block_store_method Method>
+__global__ __launch_bounds__(BlockSize) void tee_output_store_kernel(const int* input,
+                                                                     int*       first,
+                                                                     int*       second)
+{
+    using store_type = rocprim::block_store<int, BlockSize, ItemsPerThread, Method>;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    const unsigned int     offset          = blockIdx.x * items_per_block;
+
+    int items[ItemsPerThread];
+    for(unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        items[item] = input[offset + threadIdx.x * ItemsPerThread + item];
+    }
+    store_type().store(rocprim::make_tee_output_iterator(first + offset, second + offset), items);
+}
+
+template<unsigned int ItemsPerThread, rocprim::block_store_method Method>
+void test_tee_output_block_store()
+{
+    SCOPED_TRACE(testing::Message() << "with items_per_thread = " << ItemsPerThread);
+    SCOPED_TRACE(testing::Message() << "with method = " << int(Method));
+
+    constexpr unsigned int block_size      = 128;
+    constexpr unsigned int items_per_block = block_size * ItemsPerThread;
+    constexpr unsigned int blocks          = 9;
+    constexpr size_t       size            = items_per_block * blocks;
+
+    const std::vector<int> input = test_utils::get_random_data<int>(size, -1000, 1000, seeds[0]);
+
+    int* d_input;
+    int* d_first;
+    int* d_second;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(int)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_first, size * sizeof(int)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_second, size * sizeof(int)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(int), hipMemcpyHostToDevice));
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(tee_output_store_kernel<block_size, ItemsPerThread, Method>),
+                       dim3(blocks),
+                       dim3(block_size),
+                       0,
+                       0,
+                       d_input,
+                       d_first,
+                       d_second);
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<int> first(size);
+    std::vector<int> second(size);
+    HIP_CHECK(hipMemcpy(first.data(), d_first, size * sizeof(int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(second.data(), d_second, size * sizeof(int), hipMemcpyDeviceToHost));
+    ASSERT_EQ(first, input);
+    ASSERT_EQ(second, input);
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_first));
+    HIP_CHECK(hipFree(d_second));
+}
+
+TEST(RocprimTeeOutputIteratorTests, BlockStore)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    test_tee_output_block_store<4, rocprim::block_store_method::block_store_vectorize>();
+    test_tee_output_block_store<8, rocprim::block_store_method::block_store_vectorize>();
+    test_tee_output_block_store<3, rocprim::block_store_method::block_store_transpose>();
+}
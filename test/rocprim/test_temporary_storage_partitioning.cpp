@@ -276,3 +276,74 @@ TEST(RocprimTemporaryStoragePartitioningTests, InsufficientAllocation)
 
     HIP_CHECK(hipFree(temporary_storage));
 }
+
+TEST(RocprimTemporaryStoragePartitioningTests, ChainedAlgorithms)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    namespace rpt = rocprim::temporary_storage;
+
+    const size_t           size  = 1 << 16;
+    const std::vector<int> input = test_utils::get_random_data<int>(size, -1000, 1000, 0);
+    const long long        expected = std::accumulate(input.begin(), input.end(), 0ll);
+
+    int*       d_input;
+    long long* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(int)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(long long)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(int), hipMemcpyHostToDevice));
+
+    int*  d_sorted       = nullptr;
+    void* sort_storage   = nullptr;
+    void* reduce_storage = nullptr;
+
+    size_t sort_bytes;
+    size_t reduce_bytes;
+    HIP_CHECK(rocprim::radix_sort_keys(nullptr, sort_bytes, d_input, d_sorted, size));
+    HIP_CHECK(rocprim::reduce(nullptr,
+                              reduce_bytes,
+                              d_sorted,
+                              d_output,
+                              size,
+                              rocprim::plus<long long>()));
+
+    // The sorted keys live through both algorithms, their temporary storages overlap
+    const auto layout = rpt::make_sequence_partition(
+        rpt::ptr_aligned_array(&d_sorted, size),
+        rpt::make_union_partition(rpt::make_partition(&sort_storage, sort_bytes),
+                                  rpt::make_partition(&reduce_storage, reduce_bytes)));
+
+    size_t storage_size;
+    HIP_CHECK(rpt::partition(nullptr, storage_size, layout));
+    ASSERT_EQ(storage_size,
+              rocprim::detail::align_size(size * sizeof(int), rpt::default_alignment)
+                  + std::max(sort_bytes, reduce_bytes));
+
+    void* storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&storage, storage_size));
+    HIP_CHECK(rpt::partition(storage, storage_size, layout));
+    ASSERT_EQ(d_sorted, storage);
+    ASSERT_EQ(sort_storage, reduce_storage);
+
+    HIP_CHECK(rocprim::radix_sort_keys(sort_storage, sort_bytes, d_input, d_sorted, size));
+    HIP_CHECK(rocprim::reduce(reduce_storage,
+                              reduce_bytes,
+                              d_sorted,
+                              d_output,
+                              size,
+                              rocprim::plus<long long>()));
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<int> sorted(size);
+    long long        output;
+    HIP_CHECK(hipMemcpy(sorted.data(), d_sorted, size * sizeof(int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(&output, d_output, sizeof(long long), hipMemcpyDeviceToHost));
+    ASSERT_TRUE(std::is_sorted(sorted.begin(), sorted.end()));
+    ASSERT_EQ(output, expected);
+
+    HIP_CHECK(hipFree(storage));
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
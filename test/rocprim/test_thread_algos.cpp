@@ -28,11 +28,14 @@
  ******************************************************************************/
 
 
+#include <cmath>
+
 #include "rocprim/thread/thread_load.hpp"
 #include "rocprim/thread/thread_store.hpp"
 #include "rocprim/thread/thread_reduce.hpp"
 #include "rocprim/thread/thread_scan.hpp"
 #include "rocprim/thread/thread_search.hpp"
+#include "rocprim/thread/thread_sort.hpp"
 
 #include "../common_test_header.hpp"
 #include "test_utils.hpp"
@@ -290,6 +293,81 @@ TYPED_TEST(RocprimThreadOperationTests, Reduction)
     }
 }
 
+template<class Type, int32_t Length>
+__global__
+void thread_reduce_array_kernel(Type* const device_input, Type* device_output)
+{
+    const size_t index = blockIdx.x * blockDim.x + threadIdx.x;
+    Type         items[Length];
+    for(int32_t i = 0; i < Length; i++)
+    {
+        items[i] = device_input[index * Length + i];
+    }
+    device_output[index] = rocprim::thread_reduce(items, rocprim::plus<Type>());
+}
+
+template<class T, int32_t Length>
+void test_thread_reduce_floating()
+{
+    SCOPED_TRACE(testing::Message() << "with length = " << Length);
+
+    static constexpr uint32_t block_size = 64;
+    static constexpr uint32_t grid_size  = 32;
+    static constexpr uint32_t threads    = block_size * grid_size;
+
+    // Small integers are summed exactly in any order
+    std::vector<T> input = test_utils::get_random_data<T>(threads * Length, 0, 4, seeds[0]);
+    for(T& value : input)
+    {
+        value = static_cast<T>(std::floor(static_cast<float>(value)));
+    }
+    std::vector<float> expected(threads, 0.0f);
+    for(uint32_t i = 0; i < threads; i++)
+    {
+        for(int32_t j = 0; j < Length; j++)
+        {
+            expected[i] += static_cast<float>(input[i * Length + j]);
+        }
+    }
+
+    T* device_input;
+    T* device_output;
+    HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&device_input), input.size() * sizeof(T)));
+    HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&device_output), threads * sizeof(T)));
+    HIP_CHECK(
+        hipMemcpy(device_input, input.data(), input.size() * sizeof(T), hipMemcpyHostToDevice));
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(thread_reduce_array_kernel<T, Length>),
+                       grid_size,
+                       block_size,
+                       0,
+                       0,
+                       device_input,
+                       device_output);
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<T> output(threads);
+    HIP_CHECK(
+        hipMemcpy(output.data(), device_output, threads * sizeof(T), hipMemcpyDeviceToHost));
+    for(uint32_t i = 0; i < threads; i++)
+    {
+        ASSERT_EQ(static_cast<float>(output[i]), expected[i]) << "where index = " << i;
+    }
+
+    HIP_CHECK(hipFree(device_input));
+    HIP_CHECK(hipFree(device_output));
+}
+
+TEST(RocprimThreadOperationTests, ReductionHalfAndBfloat16)
+{
+    // Sums of half use packed additions from 4 items, sums of bfloat16 are accumulated in fp32
+    test_thread_reduce_floating<rocprim::half, 2>();
+    test_thread_reduce_floating<rocprim::half, 8>();
+    test_thread_reduce_floating<rocprim::half, 13>();
+    test_thread_reduce_floating<rocprim::bfloat16, 3>();
+    test_thread_reduce_floating<rocprim::bfloat16, 16>();
+}
+
 template<class Type, int32_t Length>
 __global__
 void thread_scan_kernel(Type* const device_input, Type* device_output)
@@ -376,3 +454,128 @@ TYPED_TEST(RocprimThreadOperationTests, Scan)
         HIP_CHECK(hipFree(device_output));
     }
 }
+
+// Every thread sorts its first valid items by key, the values are the indices of the input items
+template<rocprim::thread_sort_network Network, unsigned int Length>
+__global__
+void thread_sort_kernel(const int* device_keys, int* device_output_keys, int* device_output_values)
+{
+    const unsigned int thread_id = blockIdx.x * blockDim.x + threadIdx.x;
+    const unsigned int valid     = thread_id % (Length + 1);
+
+    int keys[Length];
+    int values[Length];
+    for(unsigned int i = 0; i < Length; i++)
+    {
+        keys[i]   = device_keys[thread_id * Length + i];
+        values[i] = thread_id * Length + i;
+    }
+    rocprim::thread_sort<Network>(keys, values, valid, rocprim::less<int>());
+    for(unsigned int i = 0; i < Length; i++)
+    {
+        device_output_keys[thread_id * Length + i]   = keys[i];
+        device_output_values[thread_id * Length + i] = values[i];
+    }
+}
+
+template<rocprim::thread_sort_network Network, unsigned int Length>
+void test_thread_sort()
+{
+    SCOPED_TRACE(testing::Message() << "with Length = " << Length);
+
+    static constexpr unsigned int block_size = 64;
+    static constexpr unsigned int grid_size  = 8;
+    static constexpr unsigned int size       = block_size * grid_size * Length;
+    constexpr bool stable = Network == rocprim::thread_sort_network::odd_even_transposition;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // Few distinct keys, so there are many equivalent keys
+        const std::vector<int> keys = test_utils::get_random_data<int>(size, 0, 5, seed_value);
+
+        int* device_keys;
+        int* device_output_keys;
+        int* device_output_values;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&device_keys, size * sizeof(int)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&device_output_keys, size * sizeof(int)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&device_output_values, size * sizeof(int)));
+        HIP_CHECK(hipMemcpy(device_keys, keys.data(), size * sizeof(int), hipMemcpyHostToDevice));
+
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(thread_sort_kernel<Network, Length>),
+                           grid_size,
+                           block_size,
+                           0,
+                           0,
+                           device_keys,
+                           device_output_keys,
+                           device_output_values);
+        HIP_CHECK(hipGetLastError());
+
+        std::vector<int> output_keys(size);
+        std::vector<int> output_values(size);
+        HIP_CHECK(hipMemcpy(output_keys.data(),
+                            device_output_keys,
+                            size * sizeof(int),
+                            hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(output_values.data(),
+                            device_output_values,
+                            size * sizeof(int),
+                            hipMemcpyDeviceToHost));
+
+        for(unsigned int thread_id = 0; thread_id < block_size * grid_size; thread_id++)
+        {
+            const unsigned int offset = thread_id * Length;
+            const unsigned int valid  = thread_id % (Length + 1);
+
+            std::vector<int> expected_values(Length);
+            std::iota(expected_values.begin(), expected_values.end(), int(offset));
+            std::stable_sort(expected_values.begin(),
+                             expected_values.begin() + valid,
+                             [&](int a, int b) { return keys[a] < keys[b]; });
+            for(unsigned int i = 0; i < Length; i++)
+            {
+                // The pairs are moved together and the items past valid are not moved
+                ASSERT_EQ(output_keys[offset + i], keys[output_values[offset + i]]);
+                ASSERT_EQ(output_keys[offset + i], keys[expected_values[i]]);
+                if(stable || i >= valid)
+                {
+                    ASSERT_EQ(output_values[offset + i], expected_values[i]);
+                }
+            }
+            // Every input item is in the output once
+            std::vector<int> sorted_values(output_values.begin() + offset,
+                                           output_values.begin() + offset + Length);
+            std::sort(sorted_values.begin(), sorted_values.end());
+            for(unsigned int i = 0; i < Length; i++)
+            {
+                ASSERT_EQ(sorted_values[i], int(offset + i));
+            }
+        }
+
+        HIP_CHECK(hipFree(device_keys));
+        HIP_CHECK(hipFree(device_output_keys));
+        HIP_CHECK(hipFree(device_output_values));
+    }
+}
+
+TEST(RocprimThreadOperationTests, Sort)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using network = rocprim::thread_sort_network;
+    test_thread_sort<network::odd_even_merge, 1>();
+    test_thread_sort<network::odd_even_merge, 2>();
+    test_thread_sort<network::odd_even_merge, 5>();
+    test_thread_sort<network::odd_even_merge, 8>();
+    test_thread_sort<network::odd_even_merge, 13>();
+    test_thread_sort<network::odd_even_merge, 16>();
+    test_thread_sort<network::odd_even_transposition, 3>();
+    test_thread_sort<network::odd_even_transposition, 8>();
+    test_thread_sort<network::odd_even_transposition, 11>();
+}
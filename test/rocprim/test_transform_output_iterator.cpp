@@ -0,0 +1,287 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+// required rocprim headers
+#include <rocprim/block/block_store.hpp>
+#include <rocprim/device/device_scan.hpp>
+#include <rocprim/device/device_transform.hpp>
+#include <rocprim/functional.hpp>
+#include <rocprim/iterator/transform_output_iterator.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+struct clamp_op
+{
+    ROCPRIM_HOST_DEVICE
+    int operator()(float value) const
+    {
+        return static_cast<int>(rocprim::max(-100.0f, rocprim::min(value, 100.0f)));
+    }
+};
+
+struct halve_op
+{
+    ROCPRIM_HOST_DEVICE
+    float operator()(float value) const
+    {
+        return value * 0.5f;
+    }
+};
+
+struct times_three
+{
+    ROCPRIM_HOST_DEVICE
+    int operator()(int value) const
+    {
+        return 3 * value;
+    }
+};
+
+TEST(RocprimTransformOutputIteratorTests, Host)
+{
+    std::vector<int> output(5, 0);
+    auto iterator = rocprim::make_transform_output_iterator(output.data(), clamp_op());
+
+    const std::vector<float> input = {-250.5f, -3.5f, 0.0f, 42.25f, 1000.0f};
+    for(size_t i = 0; i < input.size(); i++)
+    {
+        iterator[i] = input[i];
+    }
+    ASSERT_EQ(output, std::vector<int>({-100, -3, 0, 42, 100}));
+
+    *(iterator + 2) = 7.0f;
+    ASSERT_EQ(output[2], 7);
+    ASSERT_EQ((iterator + 5) - iterator, 5);
+    ASSERT_EQ((iterator + 5).base(), output.data() + 5);
+}
+
+TEST(RocprimTransformOutputIteratorTests, Transform)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+            if(size == 0)
+            {
+                continue;
+            }
+
+            const std::vector<float> input
+                = test_utils::get_random_data<float>(size, -200.0f, 200.0f, seed_value);
+            std::vector<int> expected(size);
+            std::transform(input.begin(),
+                           input.end(),
+                           expected.begin(),
+                           [](float value) { return clamp_op()(halve_op()(value)); });
+
+            float* d_input;
+            int*   d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(float)));
+            // One more element, so the output is also tested at an unaligned offset
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, (size + 1) * sizeof(int)));
+            HIP_CHECK(
+                hipMemcpy(d_input, input.data(), size * sizeof(float), hipMemcpyHostToDevice));
+
+            for(size_t output_offset : {size_t(0), size_t(1)})
+            {
+                SCOPED_TRACE(testing::Message() << "with output_offset = " << output_offset);
+
+                HIP_CHECK(rocprim::transform(
+                    d_input,
+                    rocprim::make_transform_output_iterator(d_output + output_offset, clamp_op()),
+                    size,
+                    halve_op(),
+                    stream));
+                HIP_CHECK(hipGetLastError());
+
+                std::vector<int> output(size);
+                HIP_CHECK(hipMemcpy(output.data(),
+                                    d_output + output_offset,
+                                    size * sizeof(int),
+                                    hipMemcpyDeviceToHost));
+                ASSERT_EQ(output, expected);
+            }
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+template<unsigned int BlockSize, unsigned int ItemsPerThread, rocprim::block_store_method Method>
+__global__ __launch_bounds__(BlockSize) void transform_output_store_kernel(const int* input,
+                                                                           int*       output)
+{
+    using store_type = rocprim::block_store<int, BlockSize, ItemsPerThread, Method>;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    const unsigned int     offset          = blockIdx.x * items_per_block;
+
+    int items[ItemsPerThread];
+    for(unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        items[item] = input[offset + threadIdx.x * ItemsPerThread + item];
+    }
+    store_type().store(rocprim::make_transform_output_iterator(output + offset, times_three()),
+                       items);
+}
+
+template<unsigned int ItemsPerThread, rocprim::block_store_method Method>
+void test_transform_output_block_store()
+{
+    SCOPED_TRACE(testing::Message() << "with items_per_thread = " << ItemsPerThread);
+    SCOPED_TRACE(testing::Message() << "with method = " << int(Method));
+
+    constexpr unsigned int block_size      = 256;
+    constexpr unsigned int items_per_block = block_size * ItemsPerThread;
+    constexpr unsigned int blocks          = 11;
+    constexpr size_t       size            = items_per_block * blocks;
+
+    const std::vector<int> input = test_utils::get_random_data<int>(size, -1000, 1000, seeds[0]);
+
+    int* d_input;
+    int* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(int)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(int)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(int), hipMemcpyHostToDevice));
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(transform_output_store_kernel<block_size, ItemsPerThread, Method>),
+        dim3(blocks),
+        dim3(block_size),
+        0,
+        0,
+        d_input,
+        d_output);
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<int> output(size);
+    HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(int), hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(output[i], 3 * input[i]) << "where index = " << i;
+    }
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
+
+TEST(RocprimTransformOutputIteratorTests, BlockStore)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    test_transform_output_block_store<4, rocprim::block_store_method::block_store_vectorize>();
+    test_transform_output_block_store<3, rocprim::block_store_method::block_store_vectorize>();
+    test_transform_output_block_store<4, rocprim::block_store_method::block_store_direct>();
+    test_transform_output_block_store<5, rocprim::block_store_method::block_store_transpose>();
+}
+
+TEST(RocprimTransformOutputIteratorTests, InclusiveScan)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+            if(size == 0)
+            {
+                continue;
+            }
+
+            const std::vector<int> input
+                = test_utils::get_random_data<int>(size, -5, 5, seed_value);
+            std::vector<int> expected(size);
+            std::partial_sum(input.begin(), input.end(), expected.begin());
+            for(int& value : expected)
+            {
+                value = times_three()(value);
+            }
+
+            int* d_input;
+            int* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(int)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(int), hipMemcpyHostToDevice));
+
+            const auto output_iterator
+                = rocprim::make_transform_output_iterator(d_output, times_three());
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(rocprim::inclusive_scan(nullptr,
+                                              temp_storage_size_bytes,
+                                              d_input,
+                                              output_iterator,
+                                              size,
+                                              rocprim::plus<int>(),
+                                              stream));
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(rocprim::inclusive_scan(d_temp_storage,
+                                              temp_storage_size_bytes,
+                                              d_input,
+                                              output_iterator,
+                                              size,
+                                              rocprim::plus<int>(),
+                                              stream));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<int> output(size);
+            HIP_CHECK(
+                hipMemcpy(output.data(), d_output, size * sizeof(int), hipMemcpyDeviceToHost));
+            ASSERT_EQ(output, expected);
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
@@ -110,6 +110,31 @@ struct StripedToBlockedShuffleOp
     }
 };
 
+// The same as BlockedToStripedOp and StripedToBlockedOp, with warp_exchange_algorithm::shuffle
+struct BlockedToStripedShuffleAlgorithmOp : BlockedToStripedOp
+{};
+
+struct StripedToBlockedShuffleAlgorithmOp : StripedToBlockedOp
+{};
+
+template<class Op>
+struct exchange_op_algorithm
+    : std::integral_constant<rocprim::warp_exchange_algorithm,
+                             rocprim::warp_exchange_algorithm::shared_memory>
+{};
+
+template<>
+struct exchange_op_algorithm<BlockedToStripedShuffleAlgorithmOp>
+    : std::integral_constant<rocprim::warp_exchange_algorithm,
+                             rocprim::warp_exchange_algorithm::shuffle>
+{};
+
+template<>
+struct exchange_op_algorithm<StripedToBlockedShuffleAlgorithmOp>
+    : std::integral_constant<rocprim::warp_exchange_algorithm,
+                             rocprim::warp_exchange_algorithm::shuffle>
+{};
+
 struct ScatterToStripedOp
 {
     template<
@@ -153,7 +178,17 @@ using WarpExchangeTestParams = ::testing::Types<
     Params<int, 4U, 16U, StripedToBlockedShuffleOp>,
     Params<int, 2U, 32U, StripedToBlockedShuffleOp>,
     Params<int, 4U, 32U, StripedToBlockedShuffleOp>,
-    Params<int, 4U, 64U, StripedToBlockedShuffleOp>
+    Params<int, 4U, 64U, StripedToBlockedShuffleOp>,
+
+    Params<int, 1U, 32U, BlockedToStripedShuffleAlgorithmOp>,
+    Params<int, 4U, 16U, BlockedToStripedShuffleAlgorithmOp>,
+    Params<int, 8U, 32U, BlockedToStripedShuffleAlgorithmOp>,
+    Params<double, 8U, 64U, BlockedToStripedShuffleAlgorithmOp>,
+
+    Params<int, 1U, 32U, StripedToBlockedShuffleAlgorithmOp>,
+    Params<int, 4U, 16U, StripedToBlockedShuffleAlgorithmOp>,
+    Params<int, 8U, 32U, StripedToBlockedShuffleAlgorithmOp>,
+    Params<double, 8U, 64U, StripedToBlockedShuffleAlgorithmOp>
 >;
 
 template<
@@ -173,7 +208,8 @@ void warp_exchange_kernel(T* d_input,
     using warp_exchange_type = ::rocprim::warp_exchange<
         T,
         ItemsPerThread,
-        test_utils::DeviceSelectWarpSize<LogicalWarpSize>::value
+        test_utils::DeviceSelectWarpSize<LogicalWarpSize>::value,
+        exchange_op_algorithm<Op>::value
     >;
 
     ROCPRIM_SHARED_MEMORY typename warp_exchange_type::storage_type storage;
@@ -227,7 +263,8 @@ TYPED_TEST(WarpExchangeTest, WarpExchange)
     std::iota(input.begin(), input.end(), static_cast<T>(0));
     auto expected = input;
     if(std::is_same<exchange_op, StripedToBlockedOp>::value
-        || std::is_same<exchange_op, StripedToBlockedShuffleOp>::value)
+        || std::is_same<exchange_op, StripedToBlockedShuffleOp>::value
+        || std::is_same<exchange_op, StripedToBlockedShuffleAlgorithmOp>::value)
     {
         input = stripe_vector(input, warp_size, items_per_thread);
     }
@@ -261,7 +298,8 @@ TYPED_TEST(WarpExchangeTest, WarpExchange)
     HIP_CHECK(hipFree(d_output));
 
     if(std::is_same<exchange_op, BlockedToStripedOp>::value
-        || std::is_same<exchange_op, BlockedToStripedShuffleOp>::value)
+        || std::is_same<exchange_op, BlockedToStripedShuffleOp>::value
+        || std::is_same<exchange_op, BlockedToStripedShuffleAlgorithmOp>::value)
     {
         expected = stripe_vector(expected, warp_size, items_per_thread);
     }
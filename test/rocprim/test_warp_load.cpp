@@ -235,7 +235,6 @@ TYPED_TEST(WarpLoadTest, WarpLoadGuarded)
     constexpr unsigned int items_per_thread = TestFixture::params::items_per_thread;
     constexpr unsigned int block_size = 1024;
     constexpr unsigned int items_count = items_per_thread * block_size;
-    constexpr unsigned int valid_items = warp_size / 4;
     constexpr T oob_default = std::numeric_limits<T>::max();
 
     SKIP_IF_UNSUPPORTED_WARP_SIZE(warp_size);
@@ -249,41 +248,48 @@ TYPED_TEST(WarpLoadTest, WarpLoadGuarded)
     T* d_output{};
     HIP_CHECK(hipMalloc(&d_output, items_count * sizeof(T)));
 
-    hipLaunchKernelGGL(
-        HIP_KERNEL_NAME(
-            warp_load_guarded_kernel<
-                T,
-                block_size,
-                items_per_thread,
-                warp_size,
-                method
-            >
-        ),
-        dim3(1), dim3(block_size), 0, 0,
-        d_input, d_output,
-        valid_items, oob_default
-    );
-    HIP_CHECK(hipPeekAtLastError());
-    HIP_CHECK(hipDeviceSynchronize());
-
-    std::vector<T> output(items_count);
-    HIP_CHECK(hipMemcpy(output.data(), d_output, items_count * sizeof(T), hipMemcpyDeviceToHost));
+    // The second number of valid items ends in the middle of the items of a thread
+    for(const unsigned int valid_items :
+        {warp_size / 4, warp_size * items_per_thread / 2 + 1})
+    {
+        SCOPED_TRACE(testing::Message() << "with valid_items = " << valid_items);
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(
+                warp_load_guarded_kernel<
+                    T,
+                    block_size,
+                    items_per_thread,
+                    warp_size,
+                    method
+                >
+            ),
+            dim3(1), dim3(block_size), 0, 0,
+            d_input, d_output,
+            valid_items, oob_default
+        );
+        HIP_CHECK(hipPeekAtLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<T> output(items_count);
+        HIP_CHECK(hipMemcpy(output.data(), d_output, items_count * sizeof(T), hipMemcpyDeviceToHost));
+
+        auto expected = input;
+        for(size_t warp_idx = 0; warp_idx < block_size / warp_size; ++warp_idx)
+        {
+            auto segment_begin = std::next(expected.begin(), warp_idx * warp_size * items_per_thread);
+            auto segment_end = std::next(expected.begin(), (warp_idx + 1) * warp_size * items_per_thread);
+            std::fill(std::next(segment_begin, valid_items), segment_end, oob_default);
+        }
+
+        if(method == ::rocprim::warp_load_method::warp_load_striped)
+        {
+            expected = stripe_vector(expected, warp_size, items_per_thread);
+        }
+
+        ASSERT_EQ(expected, output);
+    }
 
     HIP_CHECK(hipFree(d_input));
     HIP_CHECK(hipFree(d_output));
-
-    auto expected = input;
-    for(size_t warp_idx = 0; warp_idx < block_size / warp_size; ++warp_idx)
-    {
-        auto segment_begin = std::next(expected.begin(), warp_idx * warp_size * items_per_thread);
-        auto segment_end = std::next(expected.begin(), (warp_idx + 1) * warp_size * items_per_thread);
-        std::fill(std::next(segment_begin, valid_items), segment_end, oob_default);
-    }
-    
-    if(method == ::rocprim::warp_load_method::warp_load_striped)
-    {
-        expected = stripe_vector(expected, warp_size, items_per_thread);
-    }
-    
-    ASSERT_EQ(expected, output);
 }
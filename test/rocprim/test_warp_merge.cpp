@@ -0,0 +1,216 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/block/block_load_func.hpp>
+#include <rocprim/block/block_store_func.hpp>
+#include <rocprim/warp/warp_merge.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+template<unsigned int WarpSize, unsigned int ItemsPerThread>
+struct params
+{
+    static constexpr unsigned int warp_size        = WarpSize;
+    static constexpr unsigned int items_per_thread = ItemsPerThread;
+};
+
+template<class Params>
+class RocprimWarpMergeTests : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<params<1, 7>,
+                         params<8, 5>,
+                         params<16, 3>,
+                         params<32, 4>,
+                         params<64, 1>,
+                         params<64, 2>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimWarpMergeTests, Params);
+
+// The first sizes1 items of every warp are merged with the next sizes2 items, the values
+// hold the positions of the items
+template<unsigned int BlockSize, unsigned int WarpSize, unsigned int ItemsPerThread>
+__global__
+__launch_bounds__(BlockSize)
+void warp_merge_kernel(int*                keys,
+                       unsigned int*       values,
+                       const unsigned int* sizes1,
+                       const unsigned int* sizes2)
+{
+    using warp_merge_type = rocprim::warp_merge<int,
+                                                ItemsPerThread,
+                                                test_utils::DeviceSelectWarpSize<WarpSize>::value,
+                                                unsigned int>;
+    constexpr unsigned int warps_per_block = BlockSize / WarpSize;
+    constexpr unsigned int items_per_warp  = WarpSize * ItemsPerThread;
+
+    const unsigned int warp_id     = threadIdx.x / WarpSize;
+    const unsigned int global_warp = blockIdx.x * warps_per_block + warp_id;
+    const unsigned int lane        = threadIdx.x % WarpSize;
+    const unsigned int offset      = global_warp * items_per_warp;
+
+    ROCPRIM_SHARED_MEMORY typename warp_merge_type::storage_type storage[warps_per_block];
+
+    int          thread_keys[ItemsPerThread];
+    unsigned int thread_values[ItemsPerThread];
+    rocprim::block_load_direct_blocked(lane, keys + offset, thread_keys);
+    rocprim::block_load_direct_blocked(lane, values + offset, thread_values);
+
+    warp_merge_type().merge(thread_keys,
+                            thread_values,
+                            sizes1[global_warp],
+                            sizes2[global_warp],
+                            storage[warp_id]);
+
+    rocprim::block_store_direct_blocked(lane, keys + offset, thread_keys);
+    rocprim::block_store_direct_blocked(lane, values + offset, thread_values);
+}
+
+TYPED_TEST(RocprimWarpMergeTests, MergePairs)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    constexpr unsigned int warp_size        = TestFixture::params::warp_size;
+    constexpr unsigned int items_per_thread = TestFixture::params::items_per_thread;
+    constexpr unsigned int block_size       = 256;
+    constexpr unsigned int items_per_warp   = warp_size * items_per_thread;
+    constexpr unsigned int grid_size        = 4;
+    constexpr unsigned int warps            = grid_size * block_size / warp_size;
+    constexpr unsigned int size             = warps * items_per_warp;
+
+    SKIP_IF_UNSUPPORTED_WARP_SIZE(warp_size);
+
+    using pair_type = std::pair<int, unsigned int>;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // Few distinct keys to check the stability
+        std::vector<int> keys = test_utils::get_random_data<int>(size, 0, 16, seed_value);
+        std::vector<unsigned int> values(size);
+        std::iota(values.begin(), values.end(), 0u);
+        std::vector<unsigned int> sizes1 = test_utils::get_random_data<unsigned int>(
+            warps, 0, items_per_warp, seed_value + 1);
+        const std::vector<unsigned int> splits = test_utils::get_random_data<unsigned int>(
+            warps, 0, items_per_warp, seed_value + 2);
+        std::vector<unsigned int> sizes2(warps);
+        sizes1[0] = 0;
+        sizes1[1] = items_per_warp;
+        for(unsigned int warp = 0; warp < warps; warp++)
+        {
+            // The first warps merge all their items
+            const unsigned int rest = items_per_warp - sizes1[warp];
+            sizes2[warp]            = warp < 3 ? rest : splits[warp] % (rest + 1);
+
+            const auto first = keys.begin() + warp * items_per_warp;
+            std::sort(first, first + sizes1[warp]);
+            std::sort(first + sizes1[warp], first + sizes1[warp] + sizes2[warp]);
+        }
+
+        std::vector<pair_type> expected(size);
+        for(size_t i = 0; i < size; i++)
+        {
+            expected[i] = std::make_pair(keys[i], values[i]);
+        }
+        for(unsigned int warp = 0; warp < warps; warp++)
+        {
+            const auto first = expected.begin() + warp * items_per_warp;
+            std::stable_sort(first,
+                             first + sizes1[warp] + sizes2[warp],
+                             [](const pair_type& a, const pair_type& b)
+                             { return a.first < b.first; });
+        }
+
+        int*          d_keys;
+        unsigned int* d_values;
+        unsigned int* d_sizes1;
+        unsigned int* d_sizes2;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, size * sizeof(int)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_values, size * sizeof(unsigned int)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_sizes1, warps * sizeof(unsigned int)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_sizes2, warps * sizeof(unsigned int)));
+        HIP_CHECK(hipMemcpy(d_keys, keys.data(), size * sizeof(int), hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_values,
+                            values.data(),
+                            size * sizeof(unsigned int),
+                            hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_sizes1,
+                            sizes1.data(),
+                            warps * sizeof(unsigned int),
+                            hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_sizes2,
+                            sizes2.data(),
+                            warps * sizeof(unsigned int),
+                            hipMemcpyHostToDevice));
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(warp_merge_kernel<block_size, warp_size, items_per_thread>),
+            dim3(grid_size),
+            dim3(block_size),
+            0,
+            0,
+            d_keys,
+            d_values,
+            d_sizes1,
+            d_sizes2);
+        HIP_CHECK(hipGetLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<int>          output_keys(size);
+        std::vector<unsigned int> output_values(size);
+        HIP_CHECK(hipMemcpy(output_keys.data(), d_keys, size * sizeof(int), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(output_values.data(),
+                            d_values,
+                            size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+
+        // The items past the merged ones are left unchanged
+        for(size_t i = 0; i < size; i++)
+        {
+            ASSERT_EQ(output_keys[i], expected[i].first) << "where index = " << i;
+            ASSERT_EQ(output_values[i], expected[i].second) << "where index = " << i;
+        }
+
+        HIP_CHECK(hipFree(d_keys));
+        HIP_CHECK(hipFree(d_values));
+        HIP_CHECK(hipFree(d_sizes1));
+        HIP_CHECK(hipFree(d_sizes2));
+    }
+}
@@ -0,0 +1,182 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/block/block_load_func.hpp>
+#include <rocprim/block/block_store_func.hpp>
+#include <rocprim/warp/warp_merge_sort.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+template<unsigned int WarpSize, unsigned int ItemsPerThread>
+struct params
+{
+    static constexpr unsigned int warp_size        = WarpSize;
+    static constexpr unsigned int items_per_thread = ItemsPerThread;
+};
+
+template<class Params>
+class RocprimWarpMergeSortTests : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<params<1, 7>,
+                         params<8, 5>,
+                         params<16, 3>,
+                         params<32, 3>,
+                         params<32, 4>,
+                         params<64, 1>,
+                         params<64, 2>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimWarpMergeSortTests, Params);
+
+// Keys of every warp are sorted with the values holding their positions, only the first
+// valid items of the warp are sorted, the number of them depends on the warp
+template<unsigned int BlockSize, unsigned int WarpSize, unsigned int ItemsPerThread>
+__global__
+__launch_bounds__(BlockSize)
+void warp_merge_sort_kernel(int* keys, unsigned int* values, const unsigned int* valid)
+{
+    using warp_sort_type = rocprim::warp_merge_sort<int,
+                                                    ItemsPerThread,
+                                                    test_utils::DeviceSelectWarpSize<WarpSize>::value,
+                                                    unsigned int>;
+    constexpr unsigned int warps_per_block = BlockSize / WarpSize;
+    constexpr unsigned int items_per_warp  = WarpSize * ItemsPerThread;
+
+    const unsigned int warp_id     = threadIdx.x / WarpSize;
+    const unsigned int global_warp = blockIdx.x * warps_per_block + warp_id;
+    const unsigned int lane        = threadIdx.x % WarpSize;
+    const unsigned int offset      = global_warp * items_per_warp;
+
+    ROCPRIM_SHARED_MEMORY typename warp_sort_type::storage_type storage[warps_per_block];
+
+    int          thread_keys[ItemsPerThread];
+    unsigned int thread_values[ItemsPerThread];
+    rocprim::block_load_direct_blocked(lane, keys + offset, thread_keys);
+    rocprim::block_load_direct_blocked(lane, values + offset, thread_values);
+
+    warp_sort_type().sort(thread_keys, thread_values, valid[global_warp], storage[warp_id]);
+
+    rocprim::block_store_direct_blocked(lane, keys + offset, thread_keys);
+    rocprim::block_store_direct_blocked(lane, values + offset, thread_values);
+}
+
+TYPED_TEST(RocprimWarpMergeSortTests, SortValid)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    constexpr unsigned int warp_size        = TestFixture::params::warp_size;
+    constexpr unsigned int items_per_thread = TestFixture::params::items_per_thread;
+    constexpr unsigned int block_size       = 256;
+    constexpr unsigned int items_per_warp   = warp_size * items_per_thread;
+    constexpr unsigned int grid_size        = 4;
+    constexpr unsigned int warps            = grid_size * block_size / warp_size;
+    constexpr unsigned int size             = warps * items_per_warp;
+
+    SKIP_IF_UNSUPPORTED_WARP_SIZE(warp_size);
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // Few distinct keys to check the stability
+        const std::vector<int> keys = test_utils::get_random_data<int>(size, 0, 16, seed_value);
+        std::vector<unsigned int> values(size);
+        std::iota(values.begin(), values.end(), 0u);
+        std::vector<unsigned int> valid = test_utils::get_random_data<unsigned int>(
+            warps, 0, items_per_warp, seed_value + 1);
+        valid[0] = items_per_warp;
+
+        std::vector<std::pair<int, unsigned int>> expected(size);
+        for(size_t i = 0; i < size; i++)
+        {
+            expected[i] = std::make_pair(keys[i], values[i]);
+        }
+        for(unsigned int warp = 0; warp < warps; warp++)
+        {
+            const auto first = expected.begin() + warp * items_per_warp;
+            std::stable_sort(first,
+                             first + valid[warp],
+                             [](const std::pair<int, unsigned int>& a,
+                                const std::pair<int, unsigned int>& b)
+                             { return a.first < b.first; });
+        }
+
+        int*          d_keys;
+        unsigned int* d_values;
+        unsigned int* d_valid;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, size * sizeof(int)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_values, size * sizeof(unsigned int)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_valid, warps * sizeof(unsigned int)));
+        HIP_CHECK(hipMemcpy(d_keys, keys.data(), size * sizeof(int), hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_values,
+                            values.data(),
+                            size * sizeof(unsigned int),
+                            hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_valid,
+                            valid.data(),
+                            warps * sizeof(unsigned int),
+                            hipMemcpyHostToDevice));
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(warp_merge_sort_kernel<block_size, warp_size, items_per_thread>),
+            dim3(grid_size),
+            dim3(block_size),
+            0,
+            0,
+            d_keys,
+            d_values,
+            d_valid);
+        HIP_CHECK(hipGetLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<int>          output_keys(size);
+        std::vector<unsigned int> output_values(size);
+        HIP_CHECK(hipMemcpy(output_keys.data(), d_keys, size * sizeof(int), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(output_values.data(),
+                            d_values,
+                            size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+
+        // The items past the valid ones are left unchanged
+        for(size_t i = 0; i < size; i++)
+        {
+            ASSERT_EQ(output_keys[i], expected[i].first) << "where index = " << i;
+            ASSERT_EQ(output_values[i], expected[i].second) << "where index = " << i;
+        }
+
+        HIP_CHECK(hipFree(d_keys));
+        HIP_CHECK(hipFree(d_values));
+        HIP_CHECK(hipFree(d_valid));
+    }
+}
@@ -0,0 +1,277 @@
+// MIT License
+//
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/block/block_load_func.hpp>
+#include <rocprim/block/block_store_func.hpp>
+#include <rocprim/warp/warp_radix_select.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+template<class Key, unsigned int WarpSize, unsigned int ItemsPerThread, bool Descending>
+struct params
+{
+    using key_type                                 = Key;
+    static constexpr unsigned int warp_size        = WarpSize;
+    static constexpr unsigned int items_per_thread = ItemsPerThread;
+    static constexpr bool         descending       = Descending;
+};
+
+template<class Params>
+class RocprimWarpRadixSelectTests : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<params<int, 1, 7, false>,
+                         params<int, 8, 5, true>,
+                         params<unsigned char, 16, 4, false>,
+                         params<short, 32, 3, false>,
+                         params<float, 32, 8, true>,
+                         params<double, 64, 2, false>,
+                         params<unsigned long long, 64, 1, true>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimWarpRadixSelectTests, Params);
+
+// Limits of keys which are spread over all digits
+template<class Key>
+auto wide_key_limit(const bool upper) ->
+    typename std::enable_if<std::is_floating_point<Key>::value, Key>::type
+{
+    return upper ? Key(1e6) : Key(-1e6);
+}
+
+template<class Key>
+auto wide_key_limit(const bool upper) ->
+    typename std::enable_if<!std::is_floating_point<Key>::value, Key>::type
+{
+    return upper ? std::numeric_limits<Key>::max() : std::numeric_limits<Key>::lowest();
+}
+
+// The k items of the first valid ones of every warp are selected, the values hold the
+// positions of the items
+template<bool         Descending,
+         class Key,
+         unsigned int BlockSize,
+         unsigned int WarpSize,
+         unsigned int ItemsPerThread>
+__global__
+__launch_bounds__(BlockSize)
+void warp_radix_select_kernel(Key*                keys,
+                              unsigned int*       values,
+                              const unsigned int* ks,
+                              const unsigned int* valid)
+{
+    using warp_select_type
+        = rocprim::warp_radix_select<Key,
+                                     ItemsPerThread,
+                                     test_utils::DeviceSelectWarpSize<WarpSize>::value,
+                                     unsigned int>;
+    constexpr unsigned int warps_per_block = BlockSize / WarpSize;
+    constexpr unsigned int items_per_warp  = WarpSize * ItemsPerThread;
+
+    const unsigned int warp_id     = threadIdx.x / WarpSize;
+    const unsigned int global_warp = blockIdx.x * warps_per_block + warp_id;
+    const unsigned int lane        = threadIdx.x % WarpSize;
+    const unsigned int offset      = global_warp * items_per_warp;
+
+    ROCPRIM_SHARED_MEMORY typename warp_select_type::storage_type storage[warps_per_block];
+
+    Key          thread_keys[ItemsPerThread];
+    unsigned int thread_values[ItemsPerThread];
+    rocprim::block_load_direct_blocked(lane, keys + offset, thread_keys);
+    rocprim::block_load_direct_blocked(lane, values + offset, thread_values);
+
+    if(Descending)
+    {
+        warp_select_type().select_desc(thread_keys,
+                                       thread_values,
+                                       ks[global_warp],
+                                       valid[global_warp],
+                                       storage[warp_id]);
+    }
+    else
+    {
+        warp_select_type().select(thread_keys,
+                                  thread_values,
+                                  ks[global_warp],
+                                  valid[global_warp],
+                                  storage[warp_id]);
+    }
+
+    rocprim::block_store_direct_blocked(lane, keys + offset, thread_keys);
+    rocprim::block_store_direct_blocked(lane, values + offset, thread_values);
+}
+
+TYPED_TEST(RocprimWarpRadixSelectTests, SelectPairs)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type                          = typename TestFixture::params::key_type;
+    constexpr unsigned int warp_size        = TestFixture::params::warp_size;
+    constexpr unsigned int items_per_thread = TestFixture::params::items_per_thread;
+    constexpr bool         descending       = TestFixture::params::descending;
+    constexpr unsigned int block_size       = 256;
+    constexpr unsigned int items_per_warp   = warp_size * items_per_thread;
+    constexpr unsigned int grid_size        = 2;
+    constexpr unsigned int warps            = grid_size * block_size / warp_size;
+    constexpr unsigned int size             = warps * items_per_warp;
+
+    SKIP_IF_UNSUPPORTED_WARP_SIZE(warp_size);
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // Few distinct keys in some warps to check the ties
+        std::vector<key_type> keys
+            = test_utils::get_random_data<key_type>(size, 0, 100, seed_value);
+        const std::vector<key_type> wide_keys = test_utils::get_random_data<key_type>(
+            size,
+            wide_key_limit<key_type>(false),
+            wide_key_limit<key_type>(true),
+            seed_value + 1);
+        std::copy(wide_keys.begin() + size / 2, wide_keys.end(), keys.begin() + size / 2);
+        std::vector<unsigned int> values(size);
+        std::iota(values.begin(), values.end(), 0u);
+
+        std::vector<unsigned int> valid = test_utils::get_random_data<unsigned int>(
+            warps, 0, items_per_warp, seed_value + 2);
+        const std::vector<unsigned int> splits = test_utils::get_random_data<unsigned int>(
+            warps, 0, items_per_warp, seed_value + 3);
+        std::vector<unsigned int> ks(warps);
+        for(unsigned int warp = 0; warp < warps; warp++)
+        {
+            if(warp < 2)
+            {
+                valid[warp] = items_per_warp;
+            }
+            ks[warp] = warp == 1 ? 1 : splits[warp] % (valid[warp] + 1);
+        }
+
+        // The selected items are the first k in the stable order, followed by the rest of the
+        // valid items, both in their input order
+        std::vector<key_type>     expected_keys(keys);
+        std::vector<unsigned int> expected_values(values);
+        for(unsigned int warp = 0; warp < warps; warp++)
+        {
+            const unsigned int        offset = warp * items_per_warp;
+            std::vector<unsigned int> order(valid[warp]);
+            std::iota(order.begin(), order.end(), offset);
+            std::stable_sort(order.begin(),
+                             order.end(),
+                             [&](const unsigned int a, const unsigned int b)
+                             {
+                                 return descending ? keys[b] < keys[a] : keys[a] < keys[b];
+                             });
+            std::vector<bool> selected(valid[warp], false);
+            for(unsigned int i = 0; i < ks[warp]; i++)
+            {
+                selected[order[i] - offset] = true;
+            }
+            unsigned int selected_position = offset;
+            unsigned int other_position    = offset + ks[warp];
+            for(unsigned int i = 0; i < valid[warp]; i++)
+            {
+                unsigned int& position = selected[i] ? selected_position : other_position;
+                expected_keys[position]   = keys[offset + i];
+                expected_values[position] = values[offset + i];
+                position++;
+            }
+        }
+
+        key_type*     d_keys;
+        unsigned int* d_values;
+        unsigned int* d_ks;
+        unsigned int* d_valid;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, size * sizeof(key_type)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_values, size * sizeof(unsigned int)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_ks, warps * sizeof(unsigned int)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_valid, warps * sizeof(unsigned int)));
+        HIP_CHECK(
+            hipMemcpy(d_keys, keys.data(), size * sizeof(key_type), hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_values,
+                            values.data(),
+                            size * sizeof(unsigned int),
+                            hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_ks,
+                            ks.data(),
+                            warps * sizeof(unsigned int),
+                            hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_valid,
+                            valid.data(),
+                            warps * sizeof(unsigned int),
+                            hipMemcpyHostToDevice));
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(warp_radix_select_kernel<descending,
+                                                     key_type,
+                                                     block_size,
+                                                     warp_size,
+                                                     items_per_thread>),
+            dim3(grid_size),
+            dim3(block_size),
+            0,
+            0,
+            d_keys,
+            d_values,
+            d_ks,
+            d_valid);
+        HIP_CHECK(hipGetLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<key_type>     output_keys(size);
+        std::vector<unsigned int> output_values(size);
+        HIP_CHECK(hipMemcpy(output_keys.data(),
+                            d_keys,
+                            size * sizeof(key_type),
+                            hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(output_values.data(),
+                            d_values,
+                            size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+
+        // The items past the valid ones are left unchanged
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output_values, expected_values));
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output_keys, expected_keys));
+
+        HIP_CHECK(hipFree(d_keys));
+        HIP_CHECK(hipFree(d_values));
+        HIP_CHECK(hipFree(d_ks));
+        HIP_CHECK(hipFree(d_valid));
+    }
+}
@@ -225,7 +225,6 @@ TYPED_TEST(WarpStoreTest, WarpStoreGuarded)
     constexpr unsigned items_per_thread = 4;
     constexpr unsigned block_size = 1024;
     constexpr unsigned items_count = items_per_thread * block_size;
-    constexpr int valid_items = warp_size / 4;
 
     SKIP_IF_UNSUPPORTED_WARP_SIZE(warp_size);
 
@@ -237,41 +236,49 @@ TYPED_TEST(WarpStoreTest, WarpStoreGuarded)
     HIP_CHECK(hipMemcpy(d_input, input.data(), items_count * sizeof(T), hipMemcpyHostToDevice));
     T* d_output{};
     HIP_CHECK(hipMalloc(&d_output, items_count * sizeof(T)));
-    HIP_CHECK(hipMemset(d_output, 0, items_count * sizeof(T)));
 
-    hipLaunchKernelGGL(
-        HIP_KERNEL_NAME(
-            warp_store_guarded_kernel<
-                T,
-                block_size,
-                items_per_thread,
-                warp_size,
-                method
-            >
-        ),
-        dim3(1), dim3(block_size), 0, 0,
-        d_input, d_output, valid_items
-    );
-    HIP_CHECK(hipPeekAtLastError());
-    HIP_CHECK(hipDeviceSynchronize());
-
-    std::vector<T> output(items_count);
-    HIP_CHECK(hipMemcpy(output.data(), d_output, items_count * sizeof(T), hipMemcpyDeviceToHost));
-
-    HIP_CHECK(hipFree(d_input));
-    HIP_CHECK(hipFree(d_output));
-
-    auto expected = input;
-    if(method == ::rocprim::warp_store_method::warp_store_striped)
-    {
-        expected = stripe_vector(expected, warp_size, items_per_thread);
-    }
-    for(size_t warp_idx = 0; warp_idx < block_size / warp_size; ++warp_idx)
+    // The second number of valid items ends in the middle of the items of a thread
+    for(const unsigned int valid_items :
+        {warp_size / 4, warp_size * items_per_thread / 2 + 1})
     {
-        auto segment_begin = std::next(expected.begin(), warp_idx * warp_size * items_per_thread);
-        auto segment_end = std::next(expected.begin(), (warp_idx + 1) * warp_size * items_per_thread);
-        std::fill(std::next(segment_begin, valid_items), segment_end, static_cast<T>(0));
+        SCOPED_TRACE(testing::Message() << "with valid_items = " << valid_items);
+
+        HIP_CHECK(hipMemset(d_output, 0, items_count * sizeof(T)));
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(
+                warp_store_guarded_kernel<
+                    T,
+                    block_size,
+                    items_per_thread,
+                    warp_size,
+                    method
+                >
+            ),
+            dim3(1), dim3(block_size), 0, 0,
+            d_input, d_output, valid_items
+        );
+        HIP_CHECK(hipPeekAtLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<T> output(items_count);
+        HIP_CHECK(hipMemcpy(output.data(), d_output, items_count * sizeof(T), hipMemcpyDeviceToHost));
+
+        auto expected = input;
+        if(method == ::rocprim::warp_store_method::warp_store_striped)
+        {
+            expected = stripe_vector(expected, warp_size, items_per_thread);
+        }
+        for(size_t warp_idx = 0; warp_idx < block_size / warp_size; ++warp_idx)
+        {
+            auto segment_begin = std::next(expected.begin(), warp_idx * warp_size * items_per_thread);
+            auto segment_end = std::next(expected.begin(), (warp_idx + 1) * warp_size * items_per_thread);
+            std::fill(std::next(segment_begin, valid_items), segment_end, static_cast<T>(0));
+        }
+
+        ASSERT_EQ(expected, output);
     }
 
-    ASSERT_EQ(expected, output);
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
 }